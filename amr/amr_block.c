@@ -12,6 +12,197 @@ skin_ghost_ranges_init_block(struct skin_ghost_ranges_block* sgr, const struct g
   }
 }
 
+// Index of edge e (0: lower, 1: upper) along direction d of block bid, in the per-edge arrays of a block decomposition.
+static int
+block_edge_index(int ndim, int bid, int d, int e)
+{
+  return (bid * ndim + d) * 2 + e;
+}
+
+// Layer of cells of a block along edge e (0: lower, 1: upper) in direction d.
+static void
+block_edge_layer(const struct euler_block_data* bdata, int d, int e, struct gkyl_range* layer)
+{
+  if (e == 0) {
+    gkyl_range_shorten_from_above(layer, &bdata->range, d, 1);
+  }
+  else {
+    gkyl_range_shorten_from_below(layer, &bdata->range, d, 1);
+  }
+}
+
+struct gkyl_comm*
+block_comm_new(bool use_mpi)
+{
+  struct gkyl_comm *comm = 0;
+#ifdef GKYL_HAVE_MPI
+  if (use_mpi) {
+    comm = gkyl_mpi_comm_new( &(struct gkyl_mpi_comm_inp) {
+        .mpi_comm = MPI_COMM_WORLD,
+      }
+    );
+  }
+#endif
+  if (!comm) {
+    comm = gkyl_null_comm_new();
+  }
+
+  return comm;
+}
+
+struct block_decomp*
+block_decomp_new(struct gkyl_comm* comm, const struct gkyl_block_topo* btopo, const struct euler_block_data bdata[], int meqn)
+{
+  int num_blocks = btopo->num_blocks;
+  int ndim = btopo->ndim;
+  int num_edges = num_blocks * ndim * 2;
+
+  struct block_decomp *decomp = gkyl_malloc(sizeof(struct block_decomp));
+  decomp->comm = gkyl_comm_acquire(comm);
+  decomp->num_blocks = num_blocks;
+  decomp->ndim = ndim;
+
+  int num_ranks;
+  gkyl_comm_get_rank(comm, &decomp->rank);
+  gkyl_comm_get_size(comm, &num_ranks);
+
+  int nsub[num_blocks];
+  euler_block_nsub(num_blocks, bdata, nsub);
+
+  double cost[num_blocks];
+  double total_cost = 0.0;
+  for (int i = 0; i < num_blocks; i++) {
+    cost[i] = (double) bdata[i].range.volume * nsub[i];
+    total_cost += cost[i];
+  }
+
+  // Blocks are assigned whole, so the most expensive one bounds the speedup (see block_layout_balance for splitting them first).
+  decomp->owner = gkyl_malloc(sizeof(int[num_blocks]));
+  decomp->max_speedup = total_cost / gkyl_block_topo_partition(btopo, cost, num_ranks, decomp->owner);
+
+  decomp->layer = gkyl_malloc(sizeof(struct gkyl_range[num_edges]));
+  decomp->skin_buff = gkyl_calloc(num_edges, sizeof(struct gkyl_array*));
+  decomp->fdup_buff = gkyl_calloc(num_edges, sizeof(struct gkyl_array*));
+  decomp->reg_buff = gkyl_calloc(num_edges, sizeof(struct gkyl_array*));
+  decomp->state = gkyl_calloc(num_edges, sizeof(struct gkyl_comm_state*));
+
+  for (int i = 0; i < num_blocks; i++) {
+    for (int d = 0; d < ndim; d++) {
+      for (int e = 0; e < 2; e++) {
+        int k = block_edge_index(ndim, i, d, e);
+        const struct gkyl_target_edge *te = &btopo->conn[i].connections[d][e];
+
+        struct gkyl_range layer;
+        block_edge_layer(&bdata[i], d, e, &layer);
+        gkyl_range_init(&decomp->layer[k], ndim, layer.lower, layer.upper);
+
+        // Buffers are only needed on the two ranks sharing an edge between blocks they own.
+        if (te->edge == GKYL_PHYSICAL || decomp->owner[i] == decomp->owner[te->bid] ||
+          (decomp->owner[i] != decomp->rank && decomp->owner[te->bid] != decomp->rank)) {
+          continue;
+        }
+
+        const struct gkyl_range *skin = (e == 0) ? &bdata[i].skin_ghost.lower_skin[d] : &bdata[i].skin_ghost.upper_skin[d];
+
+        decomp->skin_buff[k] = gkyl_array_new(GKYL_DOUBLE, meqn, skin->volume);
+        decomp->fdup_buff[k] = gkyl_array_new(GKYL_DOUBLE, meqn, layer.volume);
+        decomp->reg_buff[k] = gkyl_array_new(GKYL_DOUBLE, meqn, layer.volume);
+        gkyl_array_clear(decomp->reg_buff[k], 0.0);
+
+        decomp->state[k] = gkyl_comm_state_new(comm);
+      }
+    }
+  }
+
+  return decomp;
+}
+
+bool
+block_decomp_is_local(const struct block_decomp* decomp, int bid)
+{
+  return !decomp || decomp->owner[bid] == decomp->rank;
+}
+
+void
+block_decomp_report_partition(const struct block_decomp* decomp)
+{
+  int num_ranks;
+  gkyl_comm_get_size(decomp->comm, &num_ranks);
+
+  if (decomp->rank == 0 && num_ranks > 1) {
+    printf("Distributed %d blocks across %d ranks; the partition is bounded to a speedup of %g\n", decomp->num_blocks, num_ranks,
+      decomp->max_speedup);
+  }
+}
+
+void
+block_decomp_release(struct block_decomp* decomp)
+{
+  int num_edges = decomp->num_blocks * decomp->ndim * 2;
+
+  for (int k = 0; k < num_edges; k++) {
+    if (decomp->state[k]) {
+      gkyl_array_release(decomp->skin_buff[k]);
+      gkyl_array_release(decomp->fdup_buff[k]);
+      gkyl_array_release(decomp->reg_buff[k]);
+      gkyl_comm_state_release(decomp->comm, decomp->state[k]);
+    }
+  }
+
+  gkyl_free(decomp->state);
+  gkyl_free(decomp->reg_buff);
+  gkyl_free(decomp->fdup_buff);
+  gkyl_free(decomp->skin_buff);
+  gkyl_free(decomp->layer);
+  gkyl_free(decomp->owner);
+
+  gkyl_comm_release(decomp->comm);
+  gkyl_free(decomp);
+}
+
+// Reduce values to their minimum across the ranks of a block decomposition.
+static void
+block_decomp_reduce_min(const struct block_decomp* decomp, int n, double vals[])
+{
+  if (decomp) {
+    double local[n];
+    for (int i = 0; i < n; i++) {
+      local[i] = vals[i];
+    }
+
+    gkyl_comm_all_reduce(decomp->comm, GKYL_DOUBLE, GKYL_MIN, n, local, vals);
+  }
+}
+
+// Reduce values to their maximum across the ranks of a block decomposition (there may be too many values for the stack).
+static void
+block_decomp_reduce_max(const struct block_decomp* decomp, int n, double vals[])
+{
+  if (decomp) {
+    double *local = gkyl_malloc(sizeof(double[n]));
+    for (int i = 0; i < n; i++) {
+      local[i] = vals[i];
+    }
+
+    gkyl_comm_all_reduce(decomp->comm, GKYL_DOUBLE, GKYL_MAX, n, local, vals);
+    gkyl_free(local);
+  }
+}
+
+// Reduce values to their sum across the ranks of a block decomposition.
+static void
+block_decomp_reduce_sum(const struct block_decomp* decomp, int n, double vals[])
+{
+  if (decomp) {
+    double local[n];
+    for (int i = 0; i < n; i++) {
+      local[i] = vals[i];
+    }
+
+    gkyl_comm_all_reduce(decomp->comm, GKYL_DOUBLE, GKYL_SUM, n, local, vals);
+  }
+}
+
 void
 euler_wall_bc(const struct gkyl_wv_eqn* eqn, double t, int nc, const double* GKYL_RESTRICT skin, double* GKYL_RESTRICT ghost, void* ctx)
 {
@@ -125,6 +316,8 @@ euler_block_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct euler_block_d
   }
 
   bdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 5, buff_sz);
+
+  euler_block_reflux_init(bdata);
 }
 
 void
@@ -180,6 +373,8 @@ euler_nested_block_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct euler_
   }
 
   bdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 5, buff_sz);
+
+  euler_block_reflux_init(bdata);
 }
 
 void
@@ -235,6 +430,8 @@ gr_euler_block_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct euler_bloc
   }
 
   bdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 29, buff_sz);
+
+  euler_block_reflux_init(bdata);
 }
 
 void
@@ -290,6 +487,8 @@ gr_euler_nested_block_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct eul
   }
 
   bdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 29, buff_sz);
+
+  euler_block_reflux_init(bdata);
 }
 
 void
@@ -348,6 +547,8 @@ euler_mixture_block_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct euler
   }
 
   bdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 4 + (2 * num_species), buff_sz);
+
+  euler_block_reflux_init(bdata);
 }
 
 void
@@ -406,6 +607,28 @@ euler_mixture_nested_block_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struc
   }
 
   bdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 4 + (2 * num_species), buff_sz);
+
+  euler_block_reflux_init(bdata);
+}
+
+void
+euler_block_reflux_init(struct euler_block_data* bdata)
+{
+  int meqn = bdata->euler->num_equations;
+
+  // The flux register and the solution at the start of the time-step are combined with the solution itself, which may carry
+  // more components than there are equations (as for the general relativistic Euler equations): size them like the boundary
+  // condition buffer, which holds the whole solution.
+  int ncomp = bdata->bc_buffer->ncomp;
+
+  bdata->bfluct = gkyl_array_new(GKYL_DOUBLE, 2 * meqn, bdata->ext_range.volume);
+  bdata->flux_reg = gkyl_array_new(GKYL_DOUBLE, ncomp, bdata->ext_range.volume);
+  gkyl_array_clear(bdata->flux_reg, 0.0);
+  bdata->fstart = gkyl_array_new(GKYL_DOUBLE, ncomp, bdata->ext_range.volume);
+
+  for (int d = 0; d < 2; d++) {
+    gkyl_wave_prop_set_boundary_fluct(bdata->slvr[d], bdata->bfluct);
+  }
 }
 
 void
@@ -422,6 +645,9 @@ euler_block_bc_updaters_release(struct euler_block_data* bdata)
   }
 
   gkyl_array_release(bdata->bc_buffer);
+  gkyl_array_release(bdata->bfluct);
+  gkyl_array_release(bdata->flux_reg);
+  gkyl_array_release(bdata->fstart);
 }
 
 void
@@ -451,7 +677,7 @@ block_ll_projection_op(const int tbid, const int tdir, const int i, const int d,
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(&(bdata[tbid].skin_ghost.lower_ghost[tdir]), iter.idx);
 
-    if ((bdata[tbid].skin_ghost.lower_ghost[tdir].upper[0] - bdata[tbid].skin_ghost.lower_ghost[tdir].lower[0]) == 1) {
+    if (tdir == 0) {
       memcpy(gkyl_array_fetch(fld[tbid], start),
         ((char*) bc_buffer->data) + fld[tbid]->esznc * ((int)(ref_factor_inv * count++)), fld[tbid]->esznc);
     }
@@ -476,7 +702,7 @@ block_ll_restriction_op(const int tbid, const int tdir, const int i, const int d
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(&(bdata[tbid].skin_ghost.lower_ghost[tdir]), iter.idx);
 
-    if ((bdata[tbid].skin_ghost.lower_ghost[tdir].upper[0] - bdata[tbid].skin_ghost.lower_ghost[tdir].lower[0]) == 1) {
+    if (tdir == 0) {
       memcpy(gkyl_array_fetch(fld[tbid], start),
         ((char*) bc_buffer->data) + fld[tbid]->esznc * (ref_factor * count++), fld[tbid]->esznc);
     }
@@ -501,7 +727,7 @@ block_lu_projection_op(const int tbid, const int tdir, const int i, const int d,
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(&(bdata[tbid].skin_ghost.upper_ghost[tdir]), iter.idx);
 
-    if ((bdata[tbid].skin_ghost.upper_ghost[tdir].upper[0] - bdata[tbid].skin_ghost.upper_ghost[tdir].lower[0]) == 1) {
+    if (tdir == 0) {
       memcpy(gkyl_array_fetch(fld[tbid], start),
         ((char*) bc_buffer->data) + fld[tbid]->esznc * ((int)(ref_factor_inv * count++)), fld[tbid]->esznc);
     }
@@ -526,7 +752,7 @@ block_lu_restriction_op(const int tbid, const int tdir, const int i, const int d
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(&(bdata[tbid].skin_ghost.upper_ghost[tdir]), iter.idx);
 
-    if ((bdata[tbid].skin_ghost.upper_ghost[tdir].upper[0] - bdata[tbid].skin_ghost.upper_ghost[tdir].lower[0]) == 1) {
+    if (tdir == 0) {
       memcpy(gkyl_array_fetch(fld[tbid], start),
         ((char*) bc_buffer->data) + fld[tbid]->esznc * (ref_factor * count++), fld[tbid]->esznc);
     }
@@ -551,7 +777,7 @@ block_ul_projection_op(const int tbid, const int tdir, const int i, const int d,
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(&(bdata[tbid].skin_ghost.lower_ghost[tdir]), iter.idx);
     
-    if ((bdata[tbid].skin_ghost.lower_ghost[tdir].upper[0] - bdata[tbid].skin_ghost.lower_ghost[tdir].lower[0]) == 1) {
+    if (tdir == 0) {
       memcpy(gkyl_array_fetch(fld[tbid], start),
         ((char*) bc_buffer->data) + fld[tbid]->esznc * ((int)(ref_factor_inv * count++)), fld[tbid]->esznc);
     }
@@ -576,7 +802,7 @@ block_ul_restriction_op(const int tbid, const int tdir, const int i, const int d
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(&(bdata[tbid].skin_ghost.lower_ghost[tdir]), iter.idx);
 
-    if ((bdata[tbid].skin_ghost.lower_ghost[tdir].upper[0] - bdata[tbid].skin_ghost.lower_ghost[tdir].lower[0]) == 1) {
+    if (tdir == 0) {
       memcpy(gkyl_array_fetch(fld[tbid], start),
         ((char*) bc_buffer->data) + fld[tbid]->esznc * (ref_factor * count++), fld[tbid]->esznc);
     }
@@ -601,7 +827,7 @@ block_uu_projection_op(const int tbid, const int tdir, const int i, const int d,
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(&(bdata[tbid].skin_ghost.upper_ghost[tdir]), iter.idx);
 
-    if ((bdata[tbid].skin_ghost.upper_ghost[tdir].upper[0] - bdata[tbid].skin_ghost.upper_ghost[tdir].lower[0]) == 1) {
+    if (tdir == 0) {
       memcpy(gkyl_array_fetch(fld[tbid], start),
         ((char*) bc_buffer->data) + fld[tbid]->esznc * ((int)(ref_factor_inv * count++)), fld[tbid]->esznc);
     }
@@ -626,7 +852,7 @@ block_uu_restriction_op(const int tbid, const int tdir, const int i, const int d
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(&(bdata[tbid].skin_ghost.upper_ghost[tdir]), iter.idx);
     
-    if ((bdata[tbid].skin_ghost.upper_ghost[tdir].upper[0] - bdata[tbid].skin_ghost.upper_ghost[tdir].lower[0]) == 1) {
+    if (tdir == 0) {
       memcpy(gkyl_array_fetch(fld[tbid], start),
         ((char*) bc_buffer->data) + fld[tbid]->esznc * (ref_factor * count++), fld[tbid]->esznc);
     }
@@ -638,81 +864,168 @@ block_uu_restriction_op(const int tbid, const int tdir, const int i, const int d
   }
 }
 
+static void
+block_src_to_buffer(void* data, const struct block_sync_src* src, const struct gkyl_range* skin)
+{
+  if (src->fold) {
+    gkyl_array_set_range(src->scratch, 1.0 - src->alpha, src->fold, skin);
+    gkyl_array_accumulate_range(src->scratch, src->alpha, src->fnew, skin);
+    gkyl_array_copy_to_buffer(data, src->scratch, skin);
+  }
+  else {
+    gkyl_array_copy_to_buffer(data, src->fnew, skin);
+  }
+}
+
+// Fill the ghost cells of the target of edge e (0: lower, 1: upper) along direction d of block i from the skin data of that edge in
+// buffer, projecting or restricting it if the blocks have different resolutions.
+static void
+block_buffer_to_ghost(const struct gkyl_target_edge* te, int i, int d, int e, const struct euler_block_data bdata[],
+  const struct gkyl_array* buffer, struct gkyl_array* fld[])
+{
+  int tbid = te->bid;
+  int tdir = te->dir;
+
+  if (e == 0) {
+    if (te->edge == GKYL_LOWER_POSITIVE) {
+      if (bdata[i].skin_ghost.lower_skin[d].volume == bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
+        gkyl_array_copy_from_buffer(fld[tbid], buffer->data, &(bdata[tbid].skin_ghost.lower_ghost[tdir]));
+      }
+      else if (bdata[i].skin_ghost.lower_skin[d].volume > bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
+        block_ll_restriction_op(tbid, tdir, i, d, bdata, buffer, fld);
+      }
+      else if (bdata[i].skin_ghost.lower_skin[d].volume < bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
+        block_ll_projection_op(tbid, tdir, i, d, bdata, buffer, fld);
+      }
+    }
+    else if (te->edge == GKYL_UPPER_POSITIVE) {
+      if (bdata[i].skin_ghost.lower_skin[d].volume == bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
+        gkyl_array_copy_from_buffer(fld[tbid], buffer->data, &(bdata[tbid].skin_ghost.upper_ghost[tdir]));
+      }
+      else if (bdata[i].skin_ghost.lower_skin[d].volume > bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
+        block_lu_restriction_op(tbid, tdir, i, d, bdata, buffer, fld);
+      }
+      else if (bdata[i].skin_ghost.lower_skin[d].volume < bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
+        block_lu_projection_op(tbid, tdir, i, d, bdata, buffer, fld);
+      }
+    }
+  }
+  else {
+    if (te->edge == GKYL_LOWER_POSITIVE) {
+      if (bdata[i].skin_ghost.upper_skin[d].volume == bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
+        gkyl_array_copy_from_buffer(fld[tbid], buffer->data, &(bdata[tbid].skin_ghost.lower_ghost[tdir]));
+      }
+      else if (bdata[i].skin_ghost.upper_skin[d].volume > bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
+        block_ul_restriction_op(tbid, tdir, i, d, bdata, buffer, fld);
+      }
+      else if (bdata[i].skin_ghost.upper_skin[d].volume < bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
+        block_ul_projection_op(tbid, tdir, i, d, bdata, buffer, fld);
+      }
+    }
+    else if (te->edge == GKYL_UPPER_POSITIVE) {
+      if (bdata[i].skin_ghost.upper_skin[d].volume == bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
+        gkyl_array_copy_from_buffer(fld[tbid], buffer->data, &(bdata[tbid].skin_ghost.upper_ghost[tdir]));
+      }
+      else if (bdata[i].skin_ghost.upper_skin[d].volume > bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
+        block_uu_restriction_op(tbid, tdir, i, d, bdata, buffer, fld);
+      }
+      else if (bdata[i].skin_ghost.upper_skin[d].volume < bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
+        block_uu_projection_op(tbid, tdir, i, d, bdata, buffer, fld);
+      }
+    }
+  }
+}
+
 void
-euler_sync_blocks(const struct gkyl_block_topo* btopo, const struct euler_block_data bdata[], struct gkyl_array* fld[])
+euler_sync_blocks_src(const struct gkyl_block_topo* btopo, const struct euler_block_data bdata[], const struct block_decomp* decomp,
+  const struct block_sync_src src[], struct gkyl_array* fld[], const bool is_target[])
 {
   int num_blocks = btopo->num_blocks;
   int ndim = btopo->ndim;
-  
-  for (int i = 0; i < num_blocks; i++) {
-    for (int d = 0; d < ndim; d++) {
-      const struct gkyl_target_edge *te = btopo->conn[i].connections[d];
 
-      if (te[0].edge != GKYL_PHYSICAL) {
-        struct gkyl_array *bc_buffer = bdata[i].bc_buffer;
-
-        gkyl_array_copy_to_buffer(bc_buffer->data, fld[i], &(bdata[i].skin_ghost.lower_skin[d]));
+  // Edges between local and remote blocks: post the receives of the skin data of remote blocks, and send the skin data of local
+  // blocks, so that the exchange overlaps with the copies between local blocks.
+  int num_pending = 0;
+  int pending[decomp ? num_blocks * ndim * 2 : 1];
 
-        int tbid = te[0].bid;
-        int tdir = te[0].dir;
+  if (decomp) {
+    for (int i = 0; i < num_blocks; i++) {
+      for (int d = 0; d < ndim; d++) {
+        for (int e = 0; e < 2; e++) {
+          const struct gkyl_target_edge *te = &btopo->conn[i].connections[d][e];
+          int k = block_edge_index(ndim, i, d, e);
 
-        if (te[0].edge == GKYL_LOWER_POSITIVE) {
-          if (bdata[i].skin_ghost.lower_skin[d].volume == bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
-            gkyl_array_copy_from_buffer(fld[tbid], bc_buffer->data, &(bdata[tbid].skin_ghost.lower_ghost[tdir]));
-          }
-          else if (bdata[i].skin_ghost.lower_skin[d].volume > bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
-            block_ll_restriction_op(tbid, tdir, i, d, bdata, bc_buffer, fld);
+          if (te->edge == GKYL_PHYSICAL || (is_target && !is_target[te->bid]) || !decomp->skin_buff[k]) {
+            continue;
           }
-          else if (bdata[i].skin_ghost.lower_skin[d].volume < bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
-            block_ll_projection_op(tbid, tdir, i, d, bdata, bc_buffer, fld);
-          }
-        }
-        else if (te[0].edge == GKYL_UPPER_POSITIVE) {
-          if (bdata[i].skin_ghost.lower_skin[d].volume == bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
-            gkyl_array_copy_from_buffer(fld[tbid], bc_buffer->data, &(bdata[tbid].skin_ghost.upper_ghost[tdir]));
-          }
-          else if (bdata[i].skin_ghost.lower_skin[d].volume > bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
-            block_lu_restriction_op(tbid, tdir, i, d, bdata, bc_buffer, fld);
+
+          if (block_decomp_is_local(decomp, te->bid)) {
+            gkyl_comm_array_irecv(decomp->comm, decomp->skin_buff[k], decomp->owner[i], k, decomp->state[k]);
           }
-          else if (bdata[i].skin_ghost.lower_skin[d].volume < bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
-            block_lu_projection_op(tbid, tdir, i, d, bdata, bc_buffer, fld);
+          else {
+            const struct gkyl_range *skin = (e == 0) ? &bdata[i].skin_ghost.lower_skin[d] : &bdata[i].skin_ghost.upper_skin[d];
+
+            block_src_to_buffer(decomp->skin_buff[k]->data, &src[i], skin);
+            gkyl_comm_array_isend(decomp->comm, decomp->skin_buff[k], decomp->owner[te->bid], k, decomp->state[k]);
           }
+
+          pending[num_pending++] = k;
         }
       }
+    }
+  }
 
-      if (te[1].edge != GKYL_PHYSICAL) {
-        struct gkyl_array *bc_buffer = bdata[i].bc_buffer;
-
-        gkyl_array_copy_to_buffer(bc_buffer->data, fld[i], &(bdata[i].skin_ghost.upper_skin[d]));
+  for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
 
-        int tbid = te[1].bid;
-        int tdir = te[1].dir;
+    for (int d = 0; d < ndim; d++) {
+      for (int e = 0; e < 2; e++) {
+        const struct gkyl_target_edge *te = &btopo->conn[i].connections[d][e];
 
-        if (te[1].edge == GKYL_LOWER_POSITIVE) {
-          if (bdata[i].skin_ghost.upper_skin[d].volume == bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
-            gkyl_array_copy_from_buffer(fld[tbid], bc_buffer->data, &(bdata[tbid].skin_ghost.lower_ghost[tdir]));
-          }
-          else if (bdata[i].skin_ghost.upper_skin[d].volume > bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
-            block_ul_restriction_op(tbid, tdir, i, d, bdata, bc_buffer, fld);
-          }
-          else if (bdata[i].skin_ghost.upper_skin[d].volume < bdata[tbid].skin_ghost.lower_ghost[tdir].volume) {
-            block_ul_projection_op(tbid, tdir, i, d, bdata, bc_buffer, fld);
-          }
-        }
-        else if (te[1].edge == GKYL_UPPER_POSITIVE) {
-          if (bdata[i].skin_ghost.upper_skin[d].volume == bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
-            gkyl_array_copy_from_buffer(fld[tbid], bc_buffer->data, &(bdata[tbid].skin_ghost.upper_ghost[tdir]));
-          }
-          else if (bdata[i].skin_ghost.upper_skin[d].volume > bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
-            block_uu_restriction_op(tbid, tdir, i, d, bdata, bc_buffer, fld);
-          }
-          else if (bdata[i].skin_ghost.upper_skin[d].volume < bdata[tbid].skin_ghost.upper_ghost[tdir].volume) {
-            block_uu_projection_op(tbid, tdir, i, d, bdata, bc_buffer, fld);
-          }
+        if (te->edge == GKYL_PHYSICAL || (is_target && !is_target[te->bid]) || !block_decomp_is_local(decomp, te->bid)) {
+          continue;
         }
+
+        struct gkyl_array *bc_buffer = bdata[i].bc_buffer;
+        const struct gkyl_range *skin = (e == 0) ? &bdata[i].skin_ghost.lower_skin[d] : &bdata[i].skin_ghost.upper_skin[d];
+
+        block_src_to_buffer(bc_buffer->data, &src[i], skin);
+        block_buffer_to_ghost(te, i, d, e, bdata, bc_buffer, fld);
       }
     }
   }
+
+  for (int n = 0; n < num_pending; n++) {
+    int k = pending[n];
+    gkyl_comm_state_wait(decomp->comm, decomp->state[k]);
+
+    int e = k % 2;
+    int d = (k / 2) % ndim;
+    int i = k / (2 * ndim);
+    const struct gkyl_target_edge *te = &btopo->conn[i].connections[d][e];
+
+    if (block_decomp_is_local(decomp, te->bid)) {
+      block_buffer_to_ghost(te, i, d, e, bdata, decomp->skin_buff[k], fld);
+    }
+  }
+}
+
+void
+euler_sync_blocks(const struct gkyl_block_topo* btopo, const struct euler_block_data bdata[], struct gkyl_array* fld[])
+{
+  int num_blocks = btopo->num_blocks;
+
+  struct block_sync_src src[num_blocks];
+  for (int i = 0; i < num_blocks; i++) {
+    src[i] = (struct block_sync_src) {
+      .fnew = fld[i],
+      .alpha = 1.0,
+    };
+  }
+
+  euler_sync_blocks_src(btopo, bdata, 0, src, fld, 0);
 }
 
 void
@@ -748,154 +1061,592 @@ euler_update_block_job_func(void* ctx)
   euler_block_bc_updaters_apply(bdata, t_curr, bdata->f[d + 1]);
 }
 
-struct gkyl_update_status
-euler_update_all_blocks(const struct gkyl_job_pool* job_pool, const struct gkyl_block_topo* btopo,
-  const struct euler_block_data bdata[], double t_curr, double dt)
+// Number of time-steps each block takes per coarse time-step, from the smallest cell size h of each block (see euler_block_nsub).
+static int
+block_nsub(int num_blocks, const double h[], int nsub[])
 {
-  int num_blocks  = btopo->num_blocks;
-  int ndim = btopo->ndim;
+  double h_max = 0.0;
+  for (int i = 0; i < num_blocks; i++) {
+    h_max = fmax(h_max, h[i]);
+  }
 
-  double dt_suggested = DBL_MAX;
+  int nsub_cfl[num_blocks];
+  for (int i = 0; i < num_blocks; i++) {
+    nsub_cfl[i] = (int) floor((h_max / h[i]) * (1.0 + 1.0e-8));
+    nsub[i] = 1;
+  }
 
-  for (int d = 0; d < ndim; d++) {
-    struct euler_update_block_ctx euler_block_ctx[num_blocks];
-    
-    for (int i = 0; i < num_blocks; i++) {
-      euler_block_ctx[i] = (struct euler_update_block_ctx) {
-        .bdata = &bdata[i],
-        .t_curr = t_curr,
-        .dir = d,
-        .dt = dt,
-        .bidx = i,
-      };
-    }
+  // Round the counts down, from the smallest up, so that each one is a multiple of the next smaller one.
+  int prev = 1, prev_cfl = 1;
 
-#ifdef AMR_USETHREADS
+  while (true) {
+    int next_cfl = INT_MAX;
     for (int i = 0; i < num_blocks; i++) {
-      gkyl_job_pool_add_work(job_pool, euler_update_block_job_func, &euler_block_ctx[i]);
-    }
-    gkyl_job_pool_wait(job_pool);
-#else
-    for (int i = 0; i < num_blocks; i++) {
-      euler_update_block_job_func(&euler_block_ctx[i]);
+      if (nsub_cfl[i] > prev_cfl && nsub_cfl[i] < next_cfl) {
+        next_cfl = nsub_cfl[i];
+      }
     }
-#endif
 
-    struct gkyl_array *fld[num_blocks];
+    if (next_cfl == INT_MAX) {
+      break;
+    }
 
+    int next = prev * (next_cfl / prev);
     for (int i = 0; i < num_blocks; i++) {
-      if (euler_block_ctx[i].stat.success == false) {
-        return (struct gkyl_update_status) {
-          .success = false,
-          .dt_suggested = euler_block_ctx[i].stat.dt_suggested,
-        };
+      if (nsub_cfl[i] == next_cfl) {
+        nsub[i] = next;
       }
-
-      dt_suggested = fmin(dt_suggested, euler_block_ctx[i].stat.dt_suggested);
-      fld[i] = bdata[i].f[d + 1];
     }
 
-    euler_sync_blocks(btopo, bdata, fld);
+    prev = next;
+    prev_cfl = next_cfl;
   }
 
-  return (struct gkyl_update_status) {
-    .success = true,
-    .dt_suggested = dt_suggested,
-  };
+  return prev;
 }
 
-void
-euler_init_job_func_block(void* ctx)
+int
+euler_block_nsub(int num_blocks, const struct euler_block_data bdata[], int nsub[])
 {
-  struct euler_block_data *bdata = ctx;
+  double h[num_blocks];
+  for (int i = 0; i < num_blocks; i++) {
+    h[i] = fmin(bdata[i].grid.dx[0], bdata[i].grid.dx[1]);
+  }
 
-  gkyl_fv_proj_advance(bdata->fv_proj, 0.0, &bdata->ext_range, bdata->f[0]);
+  return block_nsub(num_blocks, h, nsub);
 }
 
-void
-copy_job_func(void* ctx)
+// Flux jump F(q) - F(ref) along direction d, in the global frame.
+static void
+block_flux_jump(const struct gkyl_wv_eqn* eqn, const struct gkyl_wave_geom* geom, const int* idx, int d,
+  const double* ref, const double* q, double* jump)
 {
-  struct copy_job_ctx *j_ctx = ctx;
+  int meqn = eqn->num_equations;
+  double ref_local[meqn], q_local[meqn], jump_local[meqn];
 
-  gkyl_array_copy(j_ctx->out, j_ctx->inp);
+  const struct gkyl_wave_cell_geom *cg = gkyl_wave_geom_get(geom, idx);
+
+  gkyl_wv_eqn_rotate_to_local(eqn, cg->tau1[d], cg->tau2[d], cg->norm[d], ref, ref_local);
+  gkyl_wv_eqn_rotate_to_local(eqn, cg->tau1[d], cg->tau2[d], cg->norm[d], q, q_local);
+  gkyl_wv_eqn_flux_jump(eqn, ref_local, q_local, jump_local);
+  gkyl_wv_eqn_rotate_to_global(eqn, cg->tau1[d], cg->tau2[d], cg->norm[d], jump_local, jump);
 }
 
-struct gkyl_update_status
-euler_update_block(const struct gkyl_job_pool* job_pool, const struct gkyl_block_topo* btopo,
-  const struct euler_block_data bdata[], double t_curr, double dt0, struct sim_stats* stats)
+// Side of the interface between blocks i and j, across direction d, that block i is on for refluxing: 1 if it is the coarse side,
+// -1 if it is the fine side and 0 if the fluxes already match. The coarse side has the larger faces, or matching faces and the
+// longer time-step. With a uniform cell size on each level, the side with the larger faces also takes the longer time-step.
+static int
+block_reflux_side(const struct euler_block_data* bi, const struct euler_block_data* bj, int d, double dti, double dtj)
+{
+  int t = (d + 1) % 2;
+  double hi = bi->grid.dx[t], hj = bj->grid.dx[t];
+
+  int h_cmp = (hi > hj * (1.0 + 1.0e-8)) - (hj > hi * (1.0 + 1.0e-8));
+  int dt_cmp = (dti > dtj * (1.0 + 1.0e-8)) - (dtj > dti * (1.0 + 1.0e-8));
+
+  return h_cmp != 0 ? h_cmp : dt_cmp;
+}
+
+// Send the solution at the start of the time-step along the edges where a local coarse block meets a remote fine one, and receive
+// it where a remote coarse block meets a local fine one, for the fine side of the flux corrections.
+static void
+block_reflux_send_fdup(const struct gkyl_block_topo* btopo, const struct euler_block_data bdata[], const struct block_decomp* decomp,
+  const double dt_blk[])
 {
   int num_blocks = btopo->num_blocks;
-  double dt_suggested = DBL_MAX;
+  int ndim = btopo->ndim;
+  int num_edges = num_blocks * ndim * 2;
 
-  enum {
-    UPDATE_DONE = 0,
-    PRE_UPDATE,
-    POST_UPDATE,
-    FLUID_UPDATE,
-    UPDATE_REDO,
-  } state = PRE_UPDATE;
+  int num_pending = 0;
+  int pending[num_edges];
 
-  struct copy_job_ctx euler_copy_ctx[num_blocks];
-  double dt = dt0;
+  for (int i = 0; i < num_blocks; i++) {
+    for (int d = 0; d < ndim; d++) {
+      for (int e = 0; e < 2; e++) {
+        const struct gkyl_target_edge *te = &btopo->conn[i].connections[d][e];
+        int k = block_edge_index(ndim, i, d, e);
 
-  while (state != UPDATE_DONE) {
-    if (state == PRE_UPDATE) {
-      state = FLUID_UPDATE;
+        if (te->edge == GKYL_PHYSICAL || !decomp->skin_buff[k] ||
+          block_reflux_side(&bdata[i], &bdata[te->bid], d, dt_blk[i], dt_blk[te->bid]) != 1) {
+          continue;
+        }
 
-      for (int i = 0; i < num_blocks; i++) {
-        euler_copy_ctx[i] = (struct copy_job_ctx) {
-          .bidx = i,
-          .inp = bdata[i].f[0],
-          .out = bdata[i].fdup,
-        };
-      }
+        if (block_decomp_is_local(decomp, i)) {
+          struct gkyl_range layer;
+          block_edge_layer(&bdata[i], d, e, &layer);
 
-#ifdef AMR_USETHREADS
-      for (int i = 0; i < num_blocks; i++) {
-        gkyl_job_pool_add_work(job_pool, copy_job_func, &euler_copy_ctx[i]);
-      }
-      gkyl_job_pool_wait(job_pool);
-#else
-      for (int i = 0; i < num_blocks; i++) {
-        copy_job_func(&euler_copy_ctx[i]);
+          gkyl_array_copy_to_buffer(decomp->fdup_buff[k]->data, bdata[i].fdup, &layer);
+          gkyl_comm_array_isend(decomp->comm, decomp->fdup_buff[k], decomp->owner[te->bid], num_edges + k, decomp->state[k]);
+        }
+        else {
+          gkyl_array_clear(decomp->reg_buff[k], 0.0);
+          gkyl_comm_array_irecv(decomp->comm, decomp->fdup_buff[k], decomp->owner[i], num_edges + k, decomp->state[k]);
+        }
+
+        pending[num_pending++] = k;
       }
-#endif
     }
-    else if (state == FLUID_UPDATE) {
-      state = POST_UPDATE;
+  }
 
-      struct gkyl_update_status s = euler_update_all_blocks(job_pool, btopo, bdata, t_curr, dt);
+  for (int n = 0; n < num_pending; n++) {
+    gkyl_comm_state_wait(decomp->comm, decomp->state[pending[n]]);
+  }
+}
 
-      if (!s.success) {
-        stats->nfail += 1;
-        dt = s.dt_suggested;
-        state = UPDATE_REDO;
-      }
-      else {
-        dt_suggested = fmin(dt_suggested, s.dt_suggested);
-      }
-    }
-    else if (state == POST_UPDATE) {
-      state = UPDATE_DONE;
+// Collect the flux corrections accumulated by remote fine blocks for the local coarse blocks whose time-step ends (flagged in
+// ending) into their flux registers, and send those accumulated by local fine blocks for remote coarse ones.
+static void
+block_reflux_collect(const struct gkyl_block_topo* btopo, const struct euler_block_data bdata[], const struct block_decomp* decomp,
+  const double dt_blk[], const bool ending[])
+{
+  int num_blocks = btopo->num_blocks;
+  int ndim = btopo->ndim;
+  int num_edges = num_blocks * ndim * 2;
 
-      for (int i = 0; i < num_blocks; i++) {
+  int num_pending = 0;
+  int pending[num_edges];
+
+  for (int i = 0; i < num_blocks; i++) {
+    if (!ending[i]) {
+      continue;
+    }
+
+    for (int d = 0; d < ndim; d++) {
+      for (int e = 0; e < 2; e++) {
+        const struct gkyl_target_edge *te = &btopo->conn[i].connections[d][e];
+        int k = block_edge_index(ndim, i, d, e);
+
+        if (te->edge == GKYL_PHYSICAL || !decomp->skin_buff[k] ||
+          block_reflux_side(&bdata[i], &bdata[te->bid], d, dt_blk[i], dt_blk[te->bid]) != 1) {
+          continue;
+        }
+
+        if (block_decomp_is_local(decomp, i)) {
+          gkyl_comm_array_irecv(decomp->comm, decomp->reg_buff[k], decomp->owner[te->bid], 2 * num_edges + k, decomp->state[k]);
+        }
+        else {
+          gkyl_comm_array_isend(decomp->comm, decomp->reg_buff[k], decomp->owner[i], 2 * num_edges + k, decomp->state[k]);
+        }
+
+        pending[num_pending++] = k;
+      }
+    }
+  }
+
+  for (int n = 0; n < num_pending; n++) {
+    int k = pending[n];
+    gkyl_comm_state_wait(decomp->comm, decomp->state[k]);
+
+    int e = k % 2;
+    int d = (k / 2) % ndim;
+    int i = k / (2 * ndim);
+
+    if (block_decomp_is_local(decomp, i)) {
+      struct gkyl_range layer;
+      block_edge_layer(&bdata[i], d, e, &layer);
+
+      struct gkyl_range_iter iter;
+      gkyl_range_iter_init(&iter, &layer);
+
+      const double *reg = decomp->reg_buff[k]->data;
+      while (gkyl_range_iter_next(&iter)) {
+        double *flux_reg = gkyl_array_fetch(bdata[i].flux_reg, gkyl_range_idx(&layer, iter.idx));
+
+        for (int m = 0; m < decomp->reg_buff[k]->ncomp; m++) {
+          flux_reg[m] += *reg++;
+        }
+      }
+    }
+    else {
+      gkyl_array_clear(decomp->reg_buff[k], 0.0);
+    }
+  }
+}
+
+void
+euler_block_reflux_accumulate(const struct gkyl_block_topo* btopo, const struct euler_block_data bdata[],
+  const struct block_decomp* decomp, const bool active[], int d, const double dt_blk[])
+{
+  int num_blocks = btopo->num_blocks;
+  int t = (d + 1) % 2;
+
+  // The flux through a face, as seen from a cell with outward normal sign sigma on that face, is F(q) + sigma * R, where R is the
+  // fluctuation through the face stored by the wave-propagation updater. F(q) is taken relative to the coarse cell's solution at
+  // the start of the coarse time-step, which cancels from the correction.
+  for (int i = 0; i < num_blocks; i++) {
+    if (!active[i] || !block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
+    const struct euler_block_data *bi = &bdata[i];
+    int meqn = bi->euler->num_equations;
+
+    for (int e = 0; e < 2; e++) {
+      const struct gkyl_target_edge *te = &btopo->conn[i].connections[d][e];
+
+      if (te->edge == GKYL_PHYSICAL) {
+        continue;
+      }
+
+      const struct euler_block_data *bj = &bdata[te->bid];
+      double hi = bi->grid.dx[t], hj = bj->grid.dx[t];
+
+      int side = block_reflux_side(bi, bj, d, dt_blk[i], dt_blk[te->bid]);
+      if (side == 0) {
+        continue;
+      }
+
+      bool is_coarse = (side == 1);
+
+      // Cells of the coarse block across the edge, with its solution at the start of the time-step and its flux register: those
+      // of a remote coarse block are only held along the edge.
+      const struct gkyl_range *crange = &bj->range;
+      const struct gkyl_array *cfdup = bj->fdup;
+      struct gkyl_array *creg = bj->flux_reg;
+
+      if (!is_coarse && !block_decomp_is_local(decomp, te->bid)) {
+        int ej = (te->edge == GKYL_LOWER_POSITIVE || te->edge == GKYL_LOWER_NEGATIVE) ? 0 : 1;
+        int kj = block_edge_index(btopo->ndim, te->bid, te->dir, ej);
+
+        crange = &decomp->layer[kj];
+        cfdup = decomp->fdup_buff[kj];
+        creg = decomp->reg_buff[kj];
+      }
+
+      double sigma = (e == 0) ? -1.0 : 1.0;
+
+      struct gkyl_range skin;
+      if (e == 0) {
+        gkyl_range_shorten_from_above(&skin, &bi->range, d, 1);
+      }
+      else {
+        gkyl_range_shorten_from_below(&skin, &bi->range, d, 1);
+      }
+
+      struct gkyl_range_iter iter;
+      gkyl_range_iter_init(&iter, &skin);
+
+      while (gkyl_range_iter_next(&iter)) {
+        long loc = gkyl_range_idx(&bi->range, iter.idx);
+        const double *q = gkyl_array_cfetch(bi->f[d], loc);
+        const double *r = (const double*) gkyl_array_cfetch(bi->bfluct, loc) + (e == 0 ? 0 : meqn);
+
+        double jump[meqn];
+
+        if (is_coarse) {
+          // Coarse side: this block's own flux, over the whole face.
+          const double *ref = gkyl_array_cfetch(bi->fdup, loc);
+          block_flux_jump(bi->euler, bi->geom, iter.idx, d, ref, q, jump);
+
+          double *reg = gkyl_array_fetch(bi->flux_reg, loc);
+          double fact = sigma * dt_blk[i] / bi->grid.dx[d];
+          for (int m = 0; m < meqn; m++) {
+            reg[m] += fact * (jump[m] + sigma * r[m]);
+          }
+        }
+        else {
+          // Fine side: this face is shared between the faces of the coarse cells across it that it overlaps.
+          double xc[2];
+          gkyl_rect_grid_cell_center(&bi->grid, iter.idx, xc);
+          xc[d] += sigma * 0.5 * (bi->grid.dx[d] + bj->grid.dx[d]);
+
+          double face_lo = xc[t] - 0.5 * hi, face_up = xc[t] + 0.5 * hi;
+
+          int cidx[2];
+          xc[t] = face_lo + 1.0e-8 * hi;
+          gkyl_rect_grid_coord_idx(&bj->grid, xc, cidx);
+          int ct_lo = cidx[t];
+          xc[t] = face_up - 1.0e-8 * hi;
+          gkyl_rect_grid_coord_idx(&bj->grid, xc, cidx);
+          int ct_up = cidx[t];
+
+          for (int ct = ct_lo; ct <= ct_up; ct++) {
+            cidx[t] = ct;
+            if (!gkyl_range_contains_idx(crange, cidx)) {
+              continue;
+            }
+
+            double cell_lo = bj->grid.lower[t] + (ct - bj->range.lower[t]) * hj;
+            double overlap = fmin(face_up, cell_lo + hj) - fmax(face_lo, cell_lo);
+            if (overlap <= 0.0) {
+              continue;
+            }
+
+            long cloc = gkyl_range_idx(crange, cidx);
+            const double *ref = gkyl_array_cfetch(cfdup, cloc);
+            block_flux_jump(bi->euler, bi->geom, iter.idx, d, ref, q, jump);
+
+            double *reg = gkyl_array_fetch(creg, cloc);
+            double fact = sigma * (dt_blk[i] * overlap) / (hj * bj->grid.dx[d]);
+            for (int m = 0; m < meqn; m++) {
+              reg[m] += fact * (jump[m] + sigma * r[m]);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+// Run job func on the active blocks, using the thread-based job pool if enabled.
+static void
+block_run_jobs(const struct gkyl_job_pool* job_pool, int num_blocks, const bool active[], void (*func)(void* ctx),
+  void* ctx, size_t ctx_sz)
+{
+#ifdef AMR_USETHREADS
+  for (int i = 0; i < num_blocks; i++) {
+    if (active[i]) {
+      gkyl_job_pool_add_work(job_pool, func, (char*) ctx + i * ctx_sz);
+    }
+  }
+  gkyl_job_pool_wait(job_pool);
+#else
+  for (int i = 0; i < num_blocks; i++) {
+    if (active[i]) {
+      func((char*) ctx + i * ctx_sz);
+    }
+  }
+#endif
+}
+
+struct gkyl_update_status
+euler_update_all_blocks(const struct gkyl_job_pool* job_pool, const struct gkyl_block_topo* btopo,
+  const struct euler_block_data bdata[], const struct block_decomp* decomp, double t_curr, double dt)
+{
+  int num_blocks  = btopo->num_blocks;
+  int ndim = btopo->ndim;
+
+  double dt_suggested = DBL_MAX;
+
+  int nsub[num_blocks];
+  int nmax = euler_block_nsub(num_blocks, bdata, nsub);
+
+  bool local[num_blocks];
+  double dt_blk[num_blocks];
+  for (int i = 0; i < num_blocks; i++) {
+    local[i] = block_decomp_is_local(decomp, i);
+    dt_blk[i] = dt / nsub[i];
+
+    if (local[i]) {
+      gkyl_array_clear(bdata[i].flux_reg, 0.0);
+    }
+  }
+
+  if (decomp) {
+    block_reflux_send_fdup(btopo, bdata, decomp, dt_blk);
+  }
+
+  struct euler_update_block_ctx euler_block_ctx[num_blocks];
+  struct copy_job_ctx euler_copy_ctx[num_blocks];
+  struct block_sync_src src[num_blocks];
+  struct gkyl_array *fld[num_blocks];
+
+  // Time-steps of all blocks start on a grid of nmax micro-steps. At each micro-step, the blocks starting a time-step are
+  // advanced from the coarsest to the finest, so coarser neighbors are already at the end of their time-step (and are
+  // interpolated in time) while finer neighbors are still at its start.
+  for (int k = 0; k < nmax; k++) {
+    for (int lev = 1; lev <= nmax; lev++) {
+      bool active[num_blocks], run[num_blocks];
+      bool any_active = false;
+
+      for (int i = 0; i < num_blocks; i++) {
+        active[i] = (nsub[i] == lev) && (k % (nmax / lev) == 0);
+        run[i] = active[i] && local[i];
+        any_active = any_active || active[i];
+      }
+
+      if (!any_active) {
+        continue;
+      }
+
+      double t_lev = t_curr + k * (dt / nmax);
+
+      // Keep the solution at the start of the time-step of blocks with finer neighbors, whose ghost data it is interpolated from.
+      bool keep[num_blocks];
+      for (int i = 0; i < num_blocks; i++) {
+        keep[i] = run[i] && (nsub[i] < nmax);
         euler_copy_ctx[i] = (struct copy_job_ctx) {
           .bidx = i,
-          .inp = bdata[i].f[2],
-          .out = bdata[i].f[0],
+          .inp = bdata[i].f[0],
+          .out = bdata[i].fstart,
         };
       }
 
-#ifdef AMR_USETHREADS
+      block_run_jobs(job_pool, num_blocks, keep, copy_job_func, euler_copy_ctx, sizeof euler_copy_ctx[0]);
+
+      for (int d = 0; d < ndim; d++) {
+        // Time of the input to this sweep, in micro-steps.
+        double tm = k + ((double) d / ndim) * (nmax / lev);
+
+        for (int j = 0; j < num_blocks; j++) {
+          fld[j] = bdata[j].f[d];
+
+          if (nsub[j] == lev) {
+            src[j] = (struct block_sync_src) { .fnew = bdata[j].f[d], .alpha = 1.0 };
+          }
+          else if (nsub[j] > lev) {
+            src[j] = (struct block_sync_src) { .fnew = bdata[j].f[0], .alpha = 1.0 };
+          }
+          else {
+            // Coarser neighbor, at the end of its time-step of s micro-steps that started on micro-step tm_start.
+            int s = nmax / nsub[j];
+            int tm_start = (k / s) * s;
+            src[j] = (struct block_sync_src) {
+              .fold = bdata[j].fstart,
+              .fnew = bdata[j].f[0],
+              .alpha = (tm - tm_start) / s,
+              .scratch = bdata[j].f[1],
+            };
+          }
+
+          if (d == 0 && run[j]) {
+            euler_block_bc_updaters_apply(&bdata[j], t_lev, bdata[j].f[0]);
+          }
+        }
+
+        euler_sync_blocks_src(btopo, bdata, decomp, src, fld, active);
+
+        for (int i = 0; i < num_blocks; i++) {
+          euler_block_ctx[i] = (struct euler_update_block_ctx) {
+            .bdata = &bdata[i],
+            .t_curr = t_lev,
+            .dir = d,
+            .dt = dt_blk[i],
+            .bidx = i,
+          };
+        }
+
+        block_run_jobs(job_pool, num_blocks, run, euler_update_block_job_func, euler_block_ctx, sizeof euler_block_ctx[0]);
+
+        // The time-step fails on all ranks if it fails for any block.
+        double dt_min[2] = { DBL_MAX, dt_suggested }; // { suggested time-step of failed blocks, suggested time-step }
+
+        for (int i = 0; i < num_blocks; i++) {
+          if (!run[i]) {
+            continue;
+          }
+
+          if (euler_block_ctx[i].stat.success == false) {
+            dt_min[0] = fmin(dt_min[0], nsub[i] * euler_block_ctx[i].stat.dt_suggested);
+          }
+
+          dt_min[1] = fmin(dt_min[1], nsub[i] * euler_block_ctx[i].stat.dt_suggested);
+        }
+
+        block_decomp_reduce_min(decomp, 2, dt_min);
+
+        if (dt_min[0] < DBL_MAX) {
+          return (struct gkyl_update_status) {
+            .success = false,
+            .dt_suggested = dt_min[0],
+          };
+        }
+
+        dt_suggested = dt_min[1];
+
+        euler_block_reflux_accumulate(btopo, bdata, decomp, active, d, dt_blk);
+      }
+
       for (int i = 0; i < num_blocks; i++) {
-        gkyl_job_pool_add_work(job_pool, copy_job_func, &euler_copy_ctx[i]);
+        euler_copy_ctx[i] = (struct copy_job_ctx) {
+          .bidx = i,
+          .inp = bdata[i].f[ndim],
+          .out = bdata[i].f[0],
+        };
       }
-      gkyl_job_pool_wait(job_pool);
-#else
+
+      block_run_jobs(job_pool, num_blocks, run, copy_job_func, euler_copy_ctx, sizeof euler_copy_ctx[0]);
+    }
+
+    // Blocks whose time-step ends with this micro-step have all their finer neighbors caught up: correct their fluxes.
+    bool ending[num_blocks];
+    for (int i = 0; i < num_blocks; i++) {
+      ending[i] = (k + 1) % (nmax / nsub[i]) == 0;
+    }
+
+    if (decomp) {
+      block_reflux_collect(btopo, bdata, decomp, dt_blk, ending);
+    }
+
+    for (int i = 0; i < num_blocks; i++) {
+      if (ending[i] && local[i]) {
+        gkyl_array_accumulate_range(bdata[i].f[0], 1.0, bdata[i].flux_reg, &bdata[i].range);
+        gkyl_array_clear(bdata[i].flux_reg, 0.0);
+      }
+    }
+  }
+
+  return (struct gkyl_update_status) {
+    .success = true,
+    .dt_suggested = dt_suggested,
+  };
+}
+
+void
+euler_init_job_func_block(void* ctx)
+{
+  struct euler_block_data *bdata = ctx;
+
+  gkyl_fv_proj_advance(bdata->fv_proj, 0.0, &bdata->ext_range, bdata->f[0]);
+}
+
+void
+copy_job_func(void* ctx)
+{
+  struct copy_job_ctx *j_ctx = ctx;
+
+  gkyl_array_copy(j_ctx->out, j_ctx->inp);
+}
+
+struct gkyl_update_status
+euler_update_block(const struct gkyl_job_pool* job_pool, const struct gkyl_block_topo* btopo,
+  const struct euler_block_data bdata[], const struct block_decomp* decomp, double t_curr, double dt0, struct sim_stats* stats)
+{
+  int num_blocks = btopo->num_blocks;
+  double dt_suggested = DBL_MAX;
+
+  bool local[num_blocks];
+  for (int i = 0; i < num_blocks; i++) {
+    local[i] = block_decomp_is_local(decomp, i);
+  }
+
+  enum {
+    UPDATE_DONE = 0,
+    PRE_UPDATE,
+    FLUID_UPDATE,
+    UPDATE_REDO,
+  } state = PRE_UPDATE;
+
+  struct copy_job_ctx euler_copy_ctx[num_blocks];
+  double dt = dt0;
+
+  while (state != UPDATE_DONE) {
+    if (state == PRE_UPDATE) {
+      state = FLUID_UPDATE;
+
       for (int i = 0; i < num_blocks; i++) {
-        copy_job_func(&euler_copy_ctx[i]);
+        euler_copy_ctx[i] = (struct copy_job_ctx) {
+          .bidx = i,
+          .inp = bdata[i].f[0],
+          .out = bdata[i].fdup,
+        };
+      }
+
+      block_run_jobs(job_pool, num_blocks, local, copy_job_func, euler_copy_ctx, sizeof euler_copy_ctx[0]);
+    }
+    else if (state == FLUID_UPDATE) {
+      state = UPDATE_DONE;
+
+      struct gkyl_update_status s = euler_update_all_blocks(job_pool, btopo, bdata, decomp, t_curr, dt);
+
+      if (!s.success) {
+        stats->nfail += 1;
+        dt = s.dt_suggested;
+        state = UPDATE_REDO;
+      }
+      else {
+        dt_suggested = fmin(dt_suggested, s.dt_suggested);
       }
-#endif
     }
     else if (state == UPDATE_REDO) {
       state = PRE_UPDATE;
@@ -908,16 +1659,7 @@ euler_update_block(const struct gkyl_job_pool* job_pool, const struct gkyl_block
         };
       }
 
-#ifdef AMR_USETHREADS
-      for (int i = 0; i < num_blocks; i++) {
-        gkyl_job_pool_add_work(job_pool, copy_job_func, &euler_copy_ctx[i]);
-      }
-      gkyl_job_pool_wait(job_pool);
-#else
-      for (int i = 0; i < num_blocks; i++) {
-        copy_job_func(&euler_copy_ctx[i]);
-      }
-#endif
+      block_run_jobs(job_pool, num_blocks, local, copy_job_func, euler_copy_ctx, sizeof euler_copy_ctx[0]);
     }
   }
 
@@ -929,9 +1671,13 @@ euler_update_block(const struct gkyl_job_pool* job_pool, const struct gkyl_block
 }
 
 void
-euler_write_sol_block(const char* fbase, int num_blocks, const struct euler_block_data bdata[])
+euler_write_sol_block(const char* fbase, int num_blocks, const struct euler_block_data bdata[], const struct block_decomp* decomp)
 {
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     const char *fmt = "%s_b%d.gkyl";
     int sz = snprintf(0, 0, fmt, fbase, i);
     char file_nm[sz + 1];
@@ -942,17 +1688,830 @@ euler_write_sol_block(const char* fbase, int num_blocks, const struct euler_bloc
 }
 
 double
-euler_max_dt_block(int num_blocks, const struct euler_block_data bdata[])
+euler_max_dt_block(int num_blocks, const struct euler_block_data bdata[], const struct block_decomp* decomp)
 {
   double dt = DBL_MAX;
 
+  int nsub[num_blocks];
+  euler_block_nsub(num_blocks, bdata, nsub);
+
   for (int i = 0; i < num_blocks; i++) {
-    dt = fmin(dt, euler_block_data_max_dt(&bdata[i]));
+    if (block_decomp_is_local(decomp, i)) {
+      dt = fmin(dt, nsub[i] * euler_block_data_max_dt(&bdata[i]));
+    }
   }
 
+  block_decomp_reduce_min(decomp, 1, &dt);
+
   return dt;
 }
 
+void
+euler_block_integrate(int num_blocks, const struct euler_block_data bdata[], const struct block_decomp* decomp, int meqn,
+  double tot[])
+{
+  for (int m = 0; m < meqn; m++) {
+    tot[m] = 0.0;
+  }
+
+  for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
+    const struct euler_block_data *bi = &bdata[i];
+    double vol = bi->grid.cellVolume;
+
+    struct gkyl_range_iter iter;
+    gkyl_range_iter_init(&iter, &bi->range);
+
+    while (gkyl_range_iter_next(&iter)) {
+      const double *q = gkyl_array_cfetch(bi->f[0], gkyl_range_idx(&bi->range, iter.idx));
+      for (int m = 0; m < meqn; m++) {
+        tot[m] += vol * q[m];
+      }
+    }
+  }
+
+  block_decomp_reduce_sum(decomp, meqn, tot);
+}
+
+// Box of tiles in the clustering of flagged cells, between the tiles at lo and up (inclusive).
+struct tile_box {
+  int lo[2];
+  int up[2];
+  int num_flagged; // number of flagged tiles in the box
+  bool final; // whether the box cannot be split any further
+};
+
+// Shrink a box of tiles to the bounding box of the flagged tiles in it (on a grid of nt0 tiles in the x-direction), and count them.
+// Returns false if none of them are flagged.
+static bool
+tile_box_shrink(const bool tiles[], int nt0, struct tile_box* box)
+{
+  int lo[2] = { box->up[0], box->up[1] };
+  int up[2] = { box->lo[0], box->lo[1] };
+  int num_flagged = 0;
+
+  for (int j = box->lo[1]; j <= box->up[1]; j++) {
+    for (int i = box->lo[0]; i <= box->up[0]; i++) {
+      if (tiles[i + nt0 * j]) {
+        lo[0] = i < lo[0] ? i : lo[0];
+        lo[1] = j < lo[1] ? j : lo[1];
+        up[0] = i > up[0] ? i : up[0];
+        up[1] = j > up[1] ? j : up[1];
+        num_flagged++;
+      }
+    }
+  }
+
+  if (num_flagged == 0) {
+    return false;
+  }
+
+  for (int d = 0; d < 2; d++) {
+    box->lo[d] = lo[d];
+    box->up[d] = up[d];
+  }
+  box->num_flagged = num_flagged;
+  box->final = false;
+
+  return true;
+}
+
+// Fraction of the tiles in a box that are flagged.
+static double
+tile_box_efficiency(const struct tile_box* box)
+{
+  return (double) box->num_flagged / ((box->up[0] - box->lo[0] + 1) * (box->up[1] - box->lo[1] + 1));
+}
+
+// Choose where to split a box of tiles shrunk to its flagged tiles (on a grid of nt0 tiles in the x-direction), as in Berger and
+// Rigoutsos (1991): at the hole in the signature of the box closest to its middle, else at the strongest inflection point of the
+// signature, else in half along the longer side of the box. On output, the box is split along direction dir, after the tile at
+// index cut. Returns false if the box is a single tile.
+static bool
+tile_box_split_at(const bool tiles[], int nt0, const struct tile_box* box, int* dir, int* cut)
+{
+  int len[2] = { box->up[0] - box->lo[0] + 1, box->up[1] - box->lo[1] + 1 };
+  int max_len = len[0] > len[1] ? len[0] : len[1];
+
+  if (max_len == 1) {
+    return false;
+  }
+
+  // Signature of the box: number of flagged tiles across each slice of the box, in each direction.
+  int sig[2][max_len];
+  for (int d = 0; d < 2; d++) {
+    for (int k = 0; k < max_len; k++) {
+      sig[d][k] = 0;
+    }
+  }
+
+  for (int j = box->lo[1]; j <= box->up[1]; j++) {
+    for (int i = box->lo[0]; i <= box->up[0]; i++) {
+      if (tiles[i + nt0 * j]) {
+        sig[0][i - box->lo[0]] += 1;
+        sig[1][j - box->lo[1]] += 1;
+      }
+    }
+  }
+
+  // The box is shrunk, so holes can only be inside it. Splitting at a hole leaves it out of both halves once they are shrunk.
+  int best_dist = INT_MAX;
+  for (int d = 0; d < 2; d++) {
+    for (int k = 1; k < len[d] - 1; k++) {
+      int dist = abs(2 * k - (len[d] - 1));
+
+      if (sig[d][k] == 0 && dist < best_dist) {
+        best_dist = dist;
+        *dir = d;
+        *cut = box->lo[d] + k;
+      }
+    }
+  }
+
+  if (best_dist < INT_MAX) {
+    return true;
+  }
+
+  // Inflection points of the signature, where its second difference changes sign between two slices. The box is split between
+  // them, at the one with the largest jump in the second difference.
+  int best_jump = 0;
+  for (int d = 0; d < 2; d++) {
+    for (int k = 1; k < len[d] - 2; k++) {
+      int lap = sig[d][k - 1] - 2 * sig[d][k] + sig[d][k + 1];
+      int lap_next = sig[d][k] - 2 * sig[d][k + 1] + sig[d][k + 2];
+      int jump = abs(lap_next - lap);
+      int dist = abs(2 * k + 1 - (len[d] - 1));
+
+      if (lap * lap_next < 0 && (jump > best_jump || (jump == best_jump && dist < best_dist))) {
+        best_jump = jump;
+        best_dist = dist;
+        *dir = d;
+        *cut = box->lo[d] + k;
+      }
+    }
+  }
+
+  if (best_jump > 0) {
+    return true;
+  }
+
+  *dir = len[1] > len[0] ? 1 : 0;
+  *cut = box->lo[*dir] + len[*dir] / 2 - 1;
+
+  return true;
+}
+
+int
+euler_block_refined_boxes(int num_blocks, const struct euler_block_data bdata[], const struct block_decomp* decomp,
+  double thresh, int buffer, int min_cells, double efficiency, int max_boxes, const double lower[2], const double upper[2],
+  const int lattice[2], double boxes[][4])
+{
+  int n[2] = { lattice[0], lattice[1] };
+  double h[2] = { (upper[0] - lower[0]) / n[0], (upper[1] - lower[1]) / n[1] };
+  int nt[2] = { n[0] / min_cells, n[1] / min_cells };
+
+  // The boxes need a gap of at least one tile to the domain boundary on either side.
+  if (nt[0] < 3 || nt[1] < 3) {
+    return 0;
+  }
+
+  // Flags of the lattice cells, set where a cell of a block (centered in the lattice cell) is flagged.
+  double *flags = gkyl_calloc(n[0] * n[1], sizeof(double));
+
+  for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
+    const struct euler_block_data *bi = &bdata[i];
+
+    struct gkyl_range_iter iter;
+    gkyl_range_iter_init(&iter, &bi->range);
+
+    while (gkyl_range_iter_next(&iter)) {
+      const double *q = gkyl_array_cfetch(bi->f[0], gkyl_range_idx(&bi->range, iter.idx));
+      bool flag = false;
+
+      // Flag the cell if the relative jump in mass density to a neighboring cell in the block, scaled to the lattice spacing so
+      // that the flagging does not depend on the resolution of the block, exceeds thresh.
+      for (int d = 0; d < 2 && !flag; d++) {
+        for (int s = -1; s <= 1 && !flag; s += 2) {
+          int nidx[2] = { iter.idx[0], iter.idx[1] };
+          nidx[d] += s;
+
+          if (gkyl_range_contains_idx(&bi->range, nidx)) {
+            const double *qn = gkyl_array_cfetch(bi->f[0], gkyl_range_idx(&bi->range, nidx));
+            flag = fabs(qn[0] - q[0]) * (h[d] / bi->grid.dx[d]) > thresh * fmin(fabs(qn[0]), fabs(q[0]));
+          }
+        }
+      }
+
+      if (flag) {
+        double xc[2];
+        gkyl_rect_grid_cell_center(&bi->grid, iter.idx, xc);
+
+        int idx[2];
+        for (int d = 0; d < 2; d++) {
+          idx[d] = (int) floor((xc[d] - lower[d]) / h[d]);
+          idx[d] = idx[d] < 0 ? 0 : (idx[d] > n[d] - 1 ? n[d] - 1 : idx[d]);
+        }
+        flags[idx[0] + n[0] * idx[1]] = 1.0;
+      }
+    }
+  }
+
+  block_decomp_reduce_max(decomp, n[0] * n[1], flags);
+
+  // Pad the flagged lattice cells by buffer cells and gather them onto the tiles, clamped to the tiles at least one tile away from
+  // the domain boundary.
+  bool *tiles = gkyl_calloc(nt[0] * nt[1], sizeof(bool));
+
+  for (int j = 0; j < n[1]; j++) {
+    for (int i = 0; i < n[0]; i++) {
+      if (flags[i + n[0] * j] == 0.0) {
+        continue;
+      }
+
+      int tlo[2], tup[2];
+      int idx[2] = { i, j };
+      for (int d = 0; d < 2; d++) {
+        tlo[d] = (idx[d] - buffer < 0 ? 0 : idx[d] - buffer) / min_cells;
+        tup[d] = (idx[d] + buffer > n[d] - 1 ? n[d] - 1 : idx[d] + buffer) / min_cells;
+
+        tlo[d] = tlo[d] < 1 ? 1 : (tlo[d] > nt[d] - 2 ? nt[d] - 2 : tlo[d]);
+        tup[d] = tup[d] < 1 ? 1 : (tup[d] > nt[d] - 2 ? nt[d] - 2 : tup[d]);
+      }
+
+      for (int tj = tlo[1]; tj <= tup[1]; tj++) {
+        for (int ti = tlo[0]; ti <= tup[0]; ti++) {
+          tiles[ti + nt[0] * tj] = true;
+        }
+      }
+    }
+  }
+
+  gkyl_free(flags);
+
+  // Start from the bounding box of all flagged tiles, and split the least efficient box until all of them are efficient enough.
+  struct tile_box *tbox = gkyl_malloc(sizeof(struct tile_box[max_boxes]));
+  int num_boxes = 0;
+
+  tbox[0] = (struct tile_box) { .lo = { 1, 1 }, .up = { nt[0] - 2, nt[1] - 2 } };
+  if (tile_box_shrink(tiles, nt[0], &tbox[0])) {
+    num_boxes = 1;
+  }
+
+  while (num_boxes > 0 && num_boxes < max_boxes) {
+    int worst = -1;
+    for (int b = 0; b < num_boxes; b++) {
+      if (!tbox[b].final && tile_box_efficiency(&tbox[b]) < efficiency &&
+        (worst < 0 || tile_box_efficiency(&tbox[b]) < tile_box_efficiency(&tbox[worst]))) {
+        worst = b;
+      }
+    }
+
+    if (worst < 0) {
+      break;
+    }
+
+    int dir, cut;
+    if (!tile_box_split_at(tiles, nt[0], &tbox[worst], &dir, &cut)) {
+      tbox[worst].final = true;
+      continue;
+    }
+
+    // Both halves keep a flagged tile, since the box is shrunk to its flagged tiles and the cut is strictly inside it.
+    struct tile_box lo_box = tbox[worst], up_box = tbox[worst];
+    lo_box.up[dir] = cut;
+    up_box.lo[dir] = cut + 1;
+
+    tile_box_shrink(tiles, nt[0], &lo_box);
+    tile_box_shrink(tiles, nt[0], &up_box);
+
+    tbox[worst] = lo_box;
+    tbox[num_boxes] = up_box;
+    num_boxes += 1;
+  }
+
+  for (int b = 0; b < num_boxes; b++) {
+    for (int d = 0; d < 2; d++) {
+      boxes[b][d] = lower[d] + tbox[b].lo[d] * min_cells * h[d];
+      boxes[b][d + 2] = lower[d] + (tbox[b].up[d] + 1) * min_cells * h[d];
+    }
+  }
+
+  gkyl_free(tbox);
+  gkyl_free(tiles);
+
+  return num_boxes;
+}
+
+// Whether the grids of two blocks overlap (over a region of non-zero area).
+static bool
+block_grids_overlap(const struct gkyl_rect_grid* a, const struct gkyl_rect_grid* b)
+{
+  for (int d = 0; d < a->ndim; d++) {
+    if (fmin(a->upper[d], b->upper[d]) <= fmax(a->lower[d], b->lower[d])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void
+euler_block_transfer(int num_src, const struct euler_block_data src[], const struct block_decomp* src_decomp,
+  int num_tar, const struct euler_block_data tar[], const struct block_decomp* tar_decomp)
+{
+  // Solution in each source block: local blocks are used in place, and remote blocks overlapping local target blocks are
+  // received (whole) from the ranks owning them.
+  const struct gkyl_array *src_f[num_src];
+  struct gkyl_array *recv_f[num_src];
+
+  int num_pending = 0;
+  struct gkyl_comm_state **pending = 0;
+
+  for (int j = 0; j < num_src; j++) {
+    src_f[j] = block_decomp_is_local(src_decomp, j) ? src[j].f[0] : 0;
+    recv_f[j] = 0;
+  }
+
+  if (src_decomp) {
+    struct gkyl_comm *comm = src_decomp->comm;
+    int num_ranks;
+    gkyl_comm_get_size(comm, &num_ranks);
+
+    pending = gkyl_malloc(sizeof(struct gkyl_comm_state*[num_src * num_ranks]));
+
+    for (int j = 0; j < num_src; j++) {
+      bool is_sent[num_ranks];
+      for (int r = 0; r < num_ranks; r++) {
+        is_sent[r] = false;
+      }
+
+      for (int i = 0; i < num_tar; i++) {
+        int r = tar_decomp->owner[i];
+
+        if (r == src_decomp->owner[j] || is_sent[r] || !block_grids_overlap(&src[j].grid, &tar[i].grid)) {
+          continue;
+        }
+
+        if (block_decomp_is_local(src_decomp, j)) {
+          pending[num_pending] = gkyl_comm_state_new(comm);
+          gkyl_comm_array_isend(comm, src[j].f[0], r, j, pending[num_pending++]);
+        }
+        else if (block_decomp_is_local(tar_decomp, i)) {
+          recv_f[j] = gkyl_array_new(GKYL_DOUBLE, tar[i].f[0]->ncomp, src[j].ext_range.volume);
+          src_f[j] = recv_f[j];
+
+          pending[num_pending] = gkyl_comm_state_new(comm);
+          gkyl_comm_array_irecv(comm, recv_f[j], src_decomp->owner[j], j, pending[num_pending++]);
+        }
+
+        is_sent[r] = true;
+      }
+    }
+
+    for (int n = 0; n < num_pending; n++) {
+      gkyl_comm_state_wait(comm, pending[n]);
+      gkyl_comm_state_release(comm, pending[n]);
+    }
+
+    gkyl_free(pending);
+  }
+
+  for (int i = 0; i < num_tar; i++) {
+    if (!block_decomp_is_local(tar_decomp, i)) {
+      continue;
+    }
+
+    const struct euler_block_data *ti = &tar[i];
+    int meqn = ti->euler->num_equations;
+
+    struct gkyl_range_iter iter;
+    gkyl_range_iter_init(&iter, &ti->range);
+
+    while (gkyl_range_iter_next(&iter)) {
+      double cell_lo[2], cell_up[2];
+      for (int d = 0; d < 2; d++) {
+        cell_lo[d] = ti->grid.lower[d] + (iter.idx[d] - ti->range.lower[d]) * ti->grid.dx[d];
+        cell_up[d] = cell_lo[d] + ti->grid.dx[d];
+      }
+
+      double avg[meqn];
+      for (int m = 0; m < meqn; m++) {
+        avg[m] = 0.0;
+      }
+
+      // Average of the source cells, weighted by their overlap with this cell.
+      for (int j = 0; j < num_src; j++) {
+        const struct euler_block_data *sj = &src[j];
+
+        int slo[2], sup[2];
+        bool overlap = true;
+
+        for (int d = 0; d < 2; d++) {
+          double lo = fmax(cell_lo[d], sj->grid.lower[d]);
+          double up = fmin(cell_up[d], sj->grid.upper[d]);
+
+          if (up <= lo) {
+            overlap = false;
+            break;
+          }
+
+          slo[d] = sj->range.lower[d] + (int) floor((lo - sj->grid.lower[d]) / sj->grid.dx[d]);
+          sup[d] = sj->range.lower[d] + (int) ceil((up - sj->grid.lower[d]) / sj->grid.dx[d]) - 1;
+
+          slo[d] = slo[d] < sj->range.lower[d] ? sj->range.lower[d] : slo[d];
+          sup[d] = sup[d] > sj->range.upper[d] ? sj->range.upper[d] : sup[d];
+        }
+
+        if (!overlap) {
+          continue;
+        }
+
+        for (int ix = slo[0]; ix <= sup[0]; ix++) {
+          for (int iy = slo[1]; iy <= sup[1]; iy++) {
+            int sidx[2] = { ix, iy };
+            double w = 1.0;
+
+            for (int d = 0; d < 2; d++) {
+              double lo = sj->grid.lower[d] + (sidx[d] - sj->range.lower[d]) * sj->grid.dx[d];
+              double up = lo + sj->grid.dx[d];
+
+              w *= fmax(0.0, fmin(up, cell_up[d]) - fmax(lo, cell_lo[d])) / ti->grid.dx[d];
+            }
+
+            const double *q = gkyl_array_cfetch(src_f[j], gkyl_range_idx(&sj->range, sidx));
+            for (int m = 0; m < meqn; m++) {
+              avg[m] += w * q[m];
+            }
+          }
+        }
+      }
+
+      double *qt = gkyl_array_fetch(ti->f[0], gkyl_range_idx(&ti->range, iter.idx));
+      for (int m = 0; m < meqn; m++) {
+        qt[m] = avg[m];
+      }
+    }
+  }
+
+  for (int j = 0; j < num_src; j++) {
+    gkyl_array_release(recv_f[j]);
+  }
+}
+
+// Number the blocks of a tensor-product block layout: from the finest level to the coarsest, each level in rows from the top of the
+// domain down and from left to right within a row.
+static void
+block_layout_number(struct block_layout* layout)
+{
+  int nc0 = layout->num_cuts[0], nc1 = layout->num_cuts[1];
+  int max_level = 0;
+  for (int k = 0; k < nc0 * nc1; k++) {
+    max_level = layout->level[k] > max_level ? layout->level[k] : max_level;
+  }
+
+  int next = 0;
+  for (int l = max_level; l >= 0; l--) {
+    for (int j = nc1 - 1; j >= 0; j--) {
+      for (int i = 0; i < nc0; i++) {
+        if (layout->level[i + nc0 * j] == l) {
+          layout->bid[i + nc0 * j] = next++;
+        }
+      }
+    }
+  }
+}
+
+struct block_layout*
+block_layout_new(const int num_cuts[2], const double* edges[2], const int* cells[2], const int level[])
+{
+  struct block_layout *layout = gkyl_malloc(sizeof(struct block_layout));
+
+  for (int d = 0; d < 2; d++) {
+    int nc = num_cuts[d];
+    layout->num_cuts[d] = nc;
+
+    layout->edges[d] = gkyl_malloc(sizeof(double[nc + 1]));
+    layout->cells[d] = gkyl_malloc(sizeof(int[nc]));
+    memcpy(layout->edges[d], edges[d], sizeof(double[nc + 1]));
+    memcpy(layout->cells[d], cells[d], sizeof(int[nc]));
+  }
+
+  int num_blocks = num_cuts[0] * num_cuts[1];
+  layout->level = gkyl_malloc(sizeof(int[num_blocks]));
+  layout->bid = gkyl_malloc(sizeof(int[num_blocks]));
+  memcpy(layout->level, level, sizeof(int[num_blocks]));
+
+  block_layout_number(layout);
+
+  return layout;
+}
+
+struct block_layout*
+block_layout_nested_new(int num_levels, const double lower[2], const double upper[2], const double patch[][4], const int cells[2])
+{
+  int nc = 2 * num_levels - 1;
+  double edges[2][nc + 1];
+  int band_cells[2][nc];
+
+  for (int d = 0; d < 2; d++) {
+    edges[d][0] = lower[d];
+    edges[d][nc] = upper[d];
+
+    for (int l = 1; l < num_levels; l++) {
+      edges[d][l] = patch[l - 1][d];
+      edges[d][nc - l] = patch[l - 1][d + 2];
+    }
+
+    for (int k = 0; k < nc; k++) {
+      band_cells[d][k] = cells[d];
+    }
+  }
+
+  // The level of a block is its distance, in blocks, from the domain boundary.
+  int level[nc * nc];
+  for (int j = 0; j < nc; j++) {
+    for (int i = 0; i < nc; i++) {
+      int di = i < nc - 1 - i ? i : nc - 1 - i;
+      int dj = j < nc - 1 - j ? j : nc - 1 - j;
+
+      level[i + nc * j] = di < dj ? di : dj;
+    }
+  }
+
+  return block_layout_new((int []) { nc, nc }, (const double* []) { edges[0], edges[1] },
+    (const int* []) { band_cells[0], band_cells[1] }, level);
+}
+
+// Split column (d = 0) or row (d = 1) k of a tensor-product block layout into num_pieces columns or rows, whose coarse cell counts
+// differ by at most one.
+static void
+block_layout_split(struct block_layout* layout, int d, int k, int num_pieces)
+{
+  int nc_old = layout->num_cuts[d];
+  int nc = nc_old + num_pieces - 1;
+
+  double *edges = gkyl_malloc(sizeof(double[nc + 1]));
+  int *cells = gkyl_malloc(sizeof(int[nc]));
+
+  for (int m = 0; m <= k; m++) {
+    edges[m] = layout->edges[d][m];
+  }
+  for (int m = 0; m < k; m++) {
+    cells[m] = layout->cells[d][m];
+  }
+
+  double lo = layout->edges[d][k], up = layout->edges[d][k + 1];
+  int n = layout->cells[d][k];
+  int c = 0;
+
+  for (int p = 0; p < num_pieces; p++) {
+    cells[k + p] = n / num_pieces + (p < n % num_pieces ? 1 : 0);
+    c += cells[k + p];
+    edges[k + p + 1] = (p == num_pieces - 1) ? up : lo + c * (up - lo) / n;
+  }
+
+  for (int m = k + 1; m < nc_old; m++) {
+    cells[m + num_pieces - 1] = layout->cells[d][m];
+    edges[m + num_pieces] = layout->edges[d][m + 1];
+  }
+
+  // Every block across the split column or row is split alike.
+  int num_cuts[2] = { layout->num_cuts[0], layout->num_cuts[1] };
+  num_cuts[d] = nc;
+
+  int *level = gkyl_malloc(sizeof(int[num_cuts[0] * num_cuts[1]]));
+  for (int j = 0; j < num_cuts[1]; j++) {
+    for (int i = 0; i < num_cuts[0]; i++) {
+      int old_idx[2] = { i, j };
+      int m = old_idx[d];
+      old_idx[d] = m < k ? m : (m < k + num_pieces ? k : m - num_pieces + 1);
+
+      level[i + num_cuts[0] * j] = layout->level[old_idx[0] + layout->num_cuts[0] * old_idx[1]];
+    }
+  }
+
+  gkyl_free(layout->edges[d]);
+  gkyl_free(layout->cells[d]);
+  gkyl_free(layout->level);
+  gkyl_free(layout->bid);
+
+  layout->num_cuts[d] = nc;
+  layout->edges[d] = edges;
+  layout->cells[d] = cells;
+  layout->level = level;
+  layout->bid = gkyl_malloc(sizeof(int[num_cuts[0] * num_cuts[1]]));
+
+  block_layout_number(layout);
+}
+
+void
+block_layout_balance(struct block_layout* layout, const int level_ref[], int min_cells, int num_ranks)
+{
+  if (num_ranks <= 1) {
+    return;
+  }
+
+  while (true) {
+    int nc0 = layout->num_cuts[0];
+    int num_blocks = block_layout_num_blocks(layout);
+
+    // Cost of each block, as in block_decomp_new: cells times time-steps per coarse time-step.
+    double h[num_blocks], cost[num_blocks];
+    int nsub[num_blocks];
+
+    for (int k = 0; k < num_blocks; k++) {
+      int i = k % nc0, j = k / nc0;
+      int r = level_ref[layout->level[k]];
+
+      h[k] = fmin((layout->edges[0][i + 1] - layout->edges[0][i]) / (layout->cells[0][i] * r),
+        (layout->edges[1][j + 1] - layout->edges[1][j]) / (layout->cells[1][j] * r));
+    }
+    block_nsub(num_blocks, h, nsub);
+
+    double total_cost = 0.0;
+    for (int k = 0; k < num_blocks; k++) {
+      int i = k % nc0, j = k / nc0;
+      int r = level_ref[layout->level[k]];
+
+      cost[k] = (double) (layout->cells[0][i] * r) * (layout->cells[1][j] * r) * nsub[k];
+      total_cost += cost[k];
+    }
+    double share = total_cost / num_ranks;
+
+    // Most expensive block costing more than an even share that can still be split, along its longer side if possible.
+    int best = -1, best_dir = 0;
+    for (int k = 0; k < num_blocks; k++) {
+      int n[2] = { layout->cells[0][k % nc0], layout->cells[1][k / nc0] };
+      int dir = n[1] > n[0] ? 1 : 0;
+
+      if (n[dir] < 2 * min_cells) {
+        dir = 1 - dir;
+      }
+
+      if (cost[k] > share && n[dir] >= 2 * min_cells && (best < 0 || cost[k] > cost[best])) {
+        best = k;
+        best_dir = dir;
+      }
+    }
+
+    if (best < 0) {
+      break;
+    }
+
+    int idx[2] = { best % nc0, best / nc0 };
+    int n = layout->cells[best_dir][idx[best_dir]];
+    int num_pieces = (int) ceil(cost[best] / share);
+    num_pieces = num_pieces > n / min_cells ? n / min_cells : num_pieces;
+
+    block_layout_split(layout, best_dir, idx[best_dir], num_pieces);
+  }
+}
+
+// Comparison of lattice indices, for sorting them.
+static int
+lattice_idx_cmp(const void* a, const void* b)
+{
+  return *(const int*) a - *(const int*) b;
+}
+
+struct block_layout*
+block_layout_from_boxes(const double lower[2], const double upper[2], const int lattice[2], int num_boxes, const double boxes[][4])
+{
+  int num_cuts[2];
+  double *edges[2];
+  int *cells[2];
+
+  // Cut the columns and rows at the domain boundary and at the edges of every box, on the lattice.
+  for (int d = 0; d < 2; d++) {
+    double h = (upper[d] - lower[d]) / lattice[d];
+
+    int idx[2 * num_boxes + 2];
+    idx[0] = 0;
+    idx[1] = lattice[d];
+    for (int b = 0; b < num_boxes; b++) {
+      idx[2 * b + 2] = (int) round((boxes[b][d] - lower[d]) / h);
+      idx[2 * b + 3] = (int) round((boxes[b][d + 2] - lower[d]) / h);
+    }
+    qsort(idx, 2 * num_boxes + 2, sizeof(int), lattice_idx_cmp);
+
+    int num_idx = 1;
+    for (int k = 1; k < 2 * num_boxes + 2; k++) {
+      if (idx[k] != idx[num_idx - 1]) {
+        idx[num_idx++] = idx[k];
+      }
+    }
+
+    num_cuts[d] = num_idx - 1;
+    edges[d] = gkyl_malloc(sizeof(double[num_idx]));
+    cells[d] = gkyl_malloc(sizeof(int[num_idx - 1]));
+
+    for (int k = 0; k < num_idx; k++) {
+      edges[d][k] = (k == num_idx - 1) ? upper[d] : lower[d] + idx[k] * h;
+    }
+    for (int k = 0; k < num_idx - 1; k++) {
+      cells[d][k] = idx[k + 1] - idx[k];
+    }
+  }
+
+  // A block is refined if its center is inside one of the boxes.
+  int level[num_cuts[0] * num_cuts[1]];
+  for (int j = 0; j < num_cuts[1]; j++) {
+    for (int i = 0; i < num_cuts[0]; i++) {
+      double xc[2] = { 0.5 * (edges[0][i] + edges[0][i + 1]), 0.5 * (edges[1][j] + edges[1][j + 1]) };
+
+      level[i + num_cuts[0] * j] = 0;
+      for (int b = 0; b < num_boxes; b++) {
+        if (xc[0] > boxes[b][0] && xc[0] < boxes[b][2] && xc[1] > boxes[b][1] && xc[1] < boxes[b][3]) {
+          level[i + num_cuts[0] * j] = 1;
+        }
+      }
+    }
+  }
+
+  struct block_layout *layout = block_layout_new(num_cuts, (const double* []) { edges[0], edges[1] },
+    (const int* []) { cells[0], cells[1] }, level);
+
+  for (int d = 0; d < 2; d++) {
+    gkyl_free(edges[d]);
+    gkyl_free(cells[d]);
+  }
+
+  return layout;
+}
+
+int
+block_layout_num_blocks(const struct block_layout* layout)
+{
+  return layout->num_cuts[0] * layout->num_cuts[1];
+}
+
+void
+block_layout_block_grid(const struct block_layout* layout, int bid, const int level_ref[], struct gkyl_rect_grid* grid)
+{
+  int nc0 = layout->num_cuts[0];
+
+  for (int k = 0; k < block_layout_num_blocks(layout); k++) {
+    if (layout->bid[k] == bid) {
+      int i = k % nc0, j = k / nc0;
+      int r = level_ref[layout->level[k]];
+
+      gkyl_rect_grid_init(grid, 2, (double []) { layout->edges[0][i], layout->edges[1][j] },
+        (double []) { layout->edges[0][i + 1], layout->edges[1][j + 1] }, (int []) { layout->cells[0][i] * r, layout->cells[1][j] * r });
+      return;
+    }
+  }
+}
+
+struct gkyl_block_topo*
+block_layout_topo(const struct block_layout* layout)
+{
+  int nc0 = layout->num_cuts[0], nc1 = layout->num_cuts[1];
+  struct gkyl_block_topo *btopo = gkyl_block_topo_new(2, nc0 * nc1);
+
+  for (int j = 0; j < nc1; j++) {
+    for (int i = 0; i < nc0; i++) {
+      int bid = layout->bid[i + nc0 * j];
+
+      // The lower edge of a block connects to the upper edge of its neighbor, and vice versa; edges on the domain boundary are physical.
+      for (int d = 0; d < 2; d++) {
+        for (int e = 0; e < 2; e++) {
+          int nidx[2] = { i, j };
+          nidx[d] += (e == 0) ? -1 : 1;
+
+          if (nidx[d] < 0 || nidx[d] >= layout->num_cuts[d]) {
+            btopo->conn[bid].connections[d][e] = (struct gkyl_target_edge) { .bid = 0, .dir = d, .edge = GKYL_PHYSICAL };
+          }
+          else {
+            btopo->conn[bid].connections[d][e] = (struct gkyl_target_edge) { .bid = layout->bid[nidx[0] + nc0 * nidx[1]], .dir = d,
+              .edge = (e == 0) ? GKYL_UPPER_POSITIVE : GKYL_LOWER_POSITIVE };
+          }
+        }
+      }
+    }
+  }
+
+  return btopo;
+}
+
+void
+block_layout_release(struct block_layout* layout)
+{
+  for (int d = 0; d < 2; d++) {
+    gkyl_free(layout->edges[d]);
+    gkyl_free(layout->cells[d]);
+  }
+  gkyl_free(layout->level);
+  gkyl_free(layout->bid);
+  gkyl_free(layout);
+}
+
 struct gkyl_block_topo*
 create_block_topo()
 {
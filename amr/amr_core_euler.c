@@ -431,152 +431,328 @@ euler1d_run_double(int argc, char **argv, struct euler1d_double_init* init)
   gkyl_job_pool_release(mesh_job_pool);
 }
 
-void
-euler2d_run_single(int argc, char **argv, struct euler2d_single_init* init)
+// Minimum width, in coarse cells, of the coarse blocks around the refined blocks: the ghost layer of a block must be filled from
+// the blocks next to it alone.
+static const int euler2d_single_min_cells = 2;
+
+// Maximum number of refined boxes when regridding. Each box cuts the coarse blocks around it into up to four more columns and rows.
+static const int euler2d_single_max_boxes = 4;
+
+// Number of coarse cells across the three bands of blocks in each direction (below, across and above the refinement patch covering
+// region = { x1, y1, x2, y2 }). Without a lattice, every block has base_Nx x base_Ny coarse cells. With one, the coarse blocks share
+// the lattice of lattice_Nx x lattice_Ny cells over the whole domain; false is then returned if the patch is not on that lattice, or
+// leaves less than euler2d_single_min_cells for the coarse blocks around it.
+static bool
+euler2d_single_band_cells(const struct euler2d_single_init* init, const double region[4], int cells[2][3])
 {
-  struct gkyl_app_args app_args = parse_app_args(argc, argv);
+  if (init->lattice_Nx <= 0 || init->lattice_Ny <= 0) {
+    for (int b = 0; b < 3; b++) {
+      cells[0][b] = init->base_Nx;
+      cells[1][b] = init->base_Ny;
+    }
 
-  if (app_args.trace_mem) {
-    gkyl_cu_dev_mem_debug_set(true);
-    gkyl_mem_debug_set(true);
+    return true;
   }
 
-  int base_Nx = init->base_Nx;
-  int base_Ny = init->base_Ny;
-  int ref_factor = init->ref_factor;
+  double lower[2] = { init->coarse_x1, init->coarse_y1 }, upper[2] = { init->coarse_x2, init->coarse_y2 };
+  int N[2] = { init->lattice_Nx, init->lattice_Ny };
 
-  double coarse_x1 = init->coarse_x1;
-  double coarse_y1 = init->coarse_y1;
-  double coarse_x2 = init->coarse_x2;
-  double coarse_y2 = init->coarse_y2;
+  for (int d = 0; d < 2; d++) {
+    double h = (upper[d] - lower[d]) / N[d];
+    double edges[4] = { lower[d], region[d], region[d + 2], upper[d] };
 
-  double refined_x1 = init->refined_x1;
-  double refined_y1 = init->refined_y1;
-  double refined_x2 = init->refined_x2;
-  double refined_y2 = init->refined_y2;
+    for (int b = 0; b < 3; b++) {
+      double width = edges[b + 1] - edges[b];
+      cells[d][b] = (int) round(width / h);
 
-  evalf_t eval = init->eval;
-  double gas_gamma = init->gas_gamma;
+      if (fabs(cells[d][b] * h - width) > 1.0e-8 * h) {
+        return false;
+      }
+    }
 
-  bool copy_x = init->copy_x;
-  bool copy_y = init->copy_y;
+    if (cells[d][0] < euler2d_single_min_cells || cells[d][1] < 1 || cells[d][2] < euler2d_single_min_cells) {
+      return false;
+    }
+  }
 
-  bool wall_x = init->wall_x;
-  bool wall_y = init->wall_y;
+  return true;
+}
 
-  char euler_output[64];
-  strcpy(euler_output, init->euler_output);
-  
-  bool low_order_flux = init->low_order_flux;
-  int num_frames = init->num_frames;
+// Snap the refinement patch covering region = { x1, y1, x2, y2 } outwards onto the lattice of lattice_Nx x lattice_Ny coarse cells
+// (if one is set), keeping it at least euler2d_single_min_cells from the domain boundary.
+static void
+euler2d_single_snap_region(const struct euler2d_single_init* init, double region[4])
+{
+  if (init->lattice_Nx <= 0 || init->lattice_Ny <= 0) {
+    return;
+  }
+
+  double lower[2] = { init->coarse_x1, init->coarse_y1 }, upper[2] = { init->coarse_x2, init->coarse_y2 };
+  int N[2] = { init->lattice_Nx, init->lattice_Ny };
+
+  for (int d = 0; d < 2; d++) {
+    double h = (upper[d] - lower[d]) / N[d];
+    int ilo = (int) floor((region[d] - lower[d]) / h + 1.0e-8);
+    int iup = (int) ceil((region[d + 2] - lower[d]) / h - 1.0e-8);
+
+    ilo = ilo < euler2d_single_min_cells ? euler2d_single_min_cells : ilo;
+    iup = iup > N[d] - euler2d_single_min_cells ? N[d] - euler2d_single_min_cells : iup;
 
+    region[d] = lower[d] + ilo * h;
+    region[d + 2] = lower[d] + iup * h;
+  }
+}
+
+// Layout of the mesh with a single refinement patch covering region = { x1, y1, x2, y2 }: three columns and rows of blocks with
+// the coarse cell counts of euler2d_single_band_cells, refined in the center.
+static struct block_layout*
+euler2d_single_layout_new(const struct euler2d_single_init* init, const double region[4])
+{
+  int cells[2][3];
+  euler2d_single_band_cells(init, region, cells);
+
+  double edges[2][4] = {
+    { init->coarse_x1, region[0], region[2], init->coarse_x2 },
+    { init->coarse_y1, region[1], region[3], init->coarse_y2 },
+  };
+  int level[9] = { 0, 0, 0, 0, 1, 0, 0, 0, 0 };
+
+  return block_layout_new((int []) { 3, 3 }, (const double* []) { edges[0], edges[1] }, (const int* []) { cells[0], cells[1] },
+    level);
+}
+
+// Create the blocks of a tensor-product layout with one level of refinement, distributed across the ranks of comm: the arrays and
+// updaters of each block are only created on the rank that owns it.
+static struct block_decomp*
+euler2d_single_blocks_init(const struct euler2d_single_init* init, bool use_gpu, struct gkyl_comm* comm,
+  const struct block_layout* layout, const struct gkyl_block_topo* btopo, struct euler_block_data bdata[])
+{
+  evalf_t eval = init->eval;
+  double gas_gamma = init->gas_gamma;
+  bool low_order_flux = init->low_order_flux;
   double cfl_frac = init->cfl_frac;
-  double t_end = init->t_end;
-  double dt_failure_tol = init->dt_failure_tol;
-  int num_failures_max = init->num_failures_max;
 
   int ndim = 2;
-  int num_blocks = 9;
-  int Nx = base_Nx;
-  int Ny = base_Ny;
+  int num_blocks = block_layout_num_blocks(layout);
 
-  struct euler_block_data mesh_bdata[num_blocks];
-  struct gkyl_job_pool *mesh_job_pool = gkyl_thread_pool_new(app_args.num_threads);
-
-  gkyl_rect_grid_init(&mesh_bdata[0].grid, 2, (double []) { refined_x1, refined_y1 }, (double []) { refined_x2, refined_y2 },
-    (int []) { Nx * ref_factor, Ny * ref_factor });
-
-  gkyl_rect_grid_init(&mesh_bdata[1].grid, 2, (double []) { coarse_x1, refined_y2 }, (double []) { refined_x1, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[2].grid, 2, (double []) { refined_x1, refined_y2 }, (double []) { refined_x2, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[3].grid, 2, (double []) { refined_x2, refined_y2 }, (double []) { coarse_x2, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[4].grid, 2, (double []) { coarse_x1, refined_y1 }, (double []) { refined_x1, refined_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[5].grid, 2, (double []) { refined_x2, refined_y1 }, (double []) { coarse_x2, refined_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[6].grid, 2, (double []) { coarse_x1, coarse_y1 }, (double []) { refined_x1, refined_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[7].grid, 2, (double []) { refined_x1, coarse_y1 }, (double []) { refined_x2, refined_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[8].grid, 2, (double []) { refined_x2, coarse_y1 }, (double []) { coarse_x2, refined_y1 },
-    (int []) { Nx, Ny });
+  memset(bdata, 0, num_blocks * sizeof(struct euler_block_data));
 
   for (int i = 0; i < num_blocks; i++) {
-    mesh_bdata[i].fv_proj = gkyl_fv_proj_new(&mesh_bdata[i].grid, 2, 5, eval, 0);
+    block_layout_block_grid(layout, i, (int []) { 1, init->ref_factor }, &bdata[i].grid);
   }
-  
+
   for (int i = 0; i < num_blocks; i++) {
-    gkyl_create_grid_ranges(&mesh_bdata[i].grid, (int []) { 2, 2 }, &mesh_bdata[i].ext_range, &mesh_bdata[i].range);
-    mesh_bdata[i].geom = gkyl_wave_geom_new(&mesh_bdata[i].grid, &mesh_bdata[i].ext_range, 0, 0, false);
+    gkyl_create_grid_ranges(&bdata[i].grid, (int []) { 2, 2 }, &bdata[i].ext_range, &bdata[i].range);
+    skin_ghost_ranges_init_block(&bdata[i].skin_ghost, &bdata[i].ext_range, (int []) { 2, 2 });
 
-    mesh_bdata[i].copy_x = copy_x;
-    mesh_bdata[i].copy_y = copy_y;
+    bdata[i].copy_x = init->copy_x;
+    bdata[i].copy_y = init->copy_y;
 
-    mesh_bdata[i].wall_x = wall_x;
-    mesh_bdata[i].wall_y = wall_y;
+    bdata[i].wall_x = init->wall_x;
+    bdata[i].wall_y = init->wall_y;
   }
 
+  struct block_decomp *decomp = block_decomp_new(comm, btopo, bdata, 5);
+
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
+    bdata[i].fv_proj = gkyl_fv_proj_new(&bdata[i].grid, 2, 5, eval, 0);
+    bdata[i].geom = gkyl_wave_geom_new(&bdata[i].grid, &bdata[i].ext_range, 0, 0, false);
+
     if (low_order_flux) {
       struct gkyl_wv_euler_inp inp = {
         .gas_gamma = gas_gamma,
         .rp_type = WV_EULER_RP_HLL,
-        .use_gpu = app_args.use_gpu,
+        .use_gpu = use_gpu,
       };
-      mesh_bdata[i].euler = gkyl_wv_euler_inew(&inp);
+      bdata[i].euler = gkyl_wv_euler_inew(&inp);
     }
     else {
-      mesh_bdata[i].euler = gkyl_wv_euler_new(gas_gamma, app_args.use_gpu);
+      bdata[i].euler = gkyl_wv_euler_new(gas_gamma, use_gpu);
     }
 
     for (int d = 0; d < ndim; d++) {
-      mesh_bdata[i].slvr[d] = gkyl_wave_prop_new(& (struct gkyl_wave_prop_inp) {
-          .grid = &mesh_bdata[i].grid,
-          .equation = mesh_bdata[i].euler,
+      bdata[i].slvr[d] = gkyl_wave_prop_new(& (struct gkyl_wave_prop_inp) {
+          .grid = &bdata[i].grid,
+          .equation = bdata[i].euler,
           .limiter = GKYL_MONOTONIZED_CENTERED,
           .num_up_dirs = 1,
           .update_dirs = { d },
           .cfl = cfl_frac,
-          .geom = mesh_bdata[i].geom,
+          .geom = bdata[i].geom,
         }
       );
     }
-  }
 
-  struct gkyl_block_topo *btopo = create_block_topo();
+    euler_block_bc_updaters_init(bdata[i].euler, &bdata[i], &btopo->conn[i]);
 
-  for (int i = 0; i < num_blocks; i++) {
-    euler_block_bc_updaters_init(mesh_bdata[i].euler, &mesh_bdata[i], &btopo->conn[i]);
+    bdata[i].fdup = gkyl_array_new(GKYL_DOUBLE, 5, bdata[i].ext_range.volume);
+
+    for (int d = 0; d < ndim + 1; d++) {
+      bdata[i].f[d] = gkyl_array_new(GKYL_DOUBLE, 5, bdata[i].ext_range.volume);
+    }
   }
 
+  return decomp;
+}
+
+// Release the blocks created by euler2d_single_blocks_init, and their decomposition.
+static void
+euler2d_single_blocks_release(struct block_decomp* decomp, int num_blocks, struct euler_block_data bdata[])
+{
+  int ndim = 2;
+
   for (int i = 0; i < num_blocks; i++) {
-    mesh_bdata[i].fdup = gkyl_array_new(GKYL_DOUBLE, 5, mesh_bdata[i].ext_range.volume);
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
+    gkyl_fv_proj_release(bdata[i].fv_proj);
+    gkyl_wv_eqn_release(bdata[i].euler);
+    euler_block_bc_updaters_release(&bdata[i]);
+    gkyl_wave_geom_release(bdata[i].geom);
 
+    for (int d = 0; d < ndim; d++) {
+      gkyl_wave_prop_release(bdata[i].slvr[d]);
+    }
+    
+    gkyl_array_release(bdata[i].fdup);
+    
     for (int d = 0; d < ndim + 1; d++) {
-      mesh_bdata[i].f[d] = gkyl_array_new(GKYL_DOUBLE, 5, mesh_bdata[i].ext_range.volume);
+      gkyl_array_release(bdata[i].f[d]);
+    }
+  }
+
+  block_decomp_release(decomp);
+}
+
+void
+euler2d_run_single(int argc, char **argv, struct euler2d_single_init* init)
+{
+  struct gkyl_app_args app_args = parse_app_args(argc, argv);
+
+#ifdef GKYL_HAVE_MPI
+  if (app_args.use_mpi) {
+    MPI_Init(&argc, &argv);
+  }
+#endif
+
+  if (app_args.trace_mem) {
+    gkyl_cu_dev_mem_debug_set(true);
+    gkyl_mem_debug_set(true);
+  }
+
+  int ref_factor = init->ref_factor;
+
+  double coarse_x1 = init->coarse_x1;
+  double coarse_y1 = init->coarse_y1;
+  double coarse_x2 = init->coarse_x2;
+  double coarse_y2 = init->coarse_y2;
+
+  double refined_x1 = init->refined_x1;
+  double refined_y1 = init->refined_y1;
+  double refined_x2 = init->refined_x2;
+  double refined_y2 = init->refined_y2;
+
+  char euler_output[64];
+  strcpy(euler_output, init->euler_output);
+  
+  int num_frames = init->num_frames;
+
+  double t_end = init->t_end;
+  double dt_failure_tol = init->dt_failure_tol;
+  int num_failures_max = init->num_failures_max;
+
+  int regrid_interval = init->regrid_interval;
+  double regrid_thresh = init->regrid_thresh;
+  int regrid_buffer = init->regrid_buffer;
+
+  double regrid_efficiency = init->regrid_efficiency;
+
+  int lattice_Nx = init->lattice_Nx;
+  int lattice_Ny = init->lattice_Ny;
+
+  struct gkyl_job_pool *mesh_job_pool = gkyl_thread_pool_new(app_args.num_threads);
+
+  // Blocks are split and distributed across the MPI ranks, if MPI is used.
+  struct gkyl_comm *comm = block_comm_new(app_args.use_mpi);
+
+  int my_rank, num_ranks;
+  gkyl_comm_get_rank(comm, &my_rank);
+  gkyl_comm_get_size(comm, &num_ranks);
+
+  double region[4] = { refined_x1, refined_y1, refined_x2, refined_y2 };
+  euler2d_single_snap_region(init, region);
+
+  if (my_rank == 0 && (region[0] != refined_x1 || region[1] != refined_y1 || region[2] != refined_x2 || region[3] != refined_y2)) {
+    printf("Refined patch snapped onto the coarse lattice: [%g, %g] x [%g, %g]\n", region[0], region[2], region[1], region[3]);
+  }
+
+  // Regridding places the patch on the coarse lattice, so that the coarse blocks around it keep the same cell size.
+  bool has_lattice = lattice_Nx > 0 && lattice_Ny > 0;
+  int region_cells[2][3];
+
+  if ((regrid_interval > 0 && !has_lattice) || !euler2d_single_band_cells(init, region, region_cells)) {
+    if (my_rank == 0) {
+      if (!has_lattice) {
+        fprintf(stderr, "ERROR: Regridding requires a coarse lattice (lattice_Nx x lattice_Ny cells).\n");
+      }
+      else {
+        fprintf(stderr, "ERROR: The domain is too small for a refined patch at least %d coarse cells from its boundary.\n",
+          euler2d_single_min_cells);
+      }
+    }
+    gkyl_job_pool_release(mesh_job_pool);
+    gkyl_comm_release(comm);
+
+#ifdef GKYL_HAVE_MPI
+    if (app_args.use_mpi) {
+      MPI_Finalize();
     }
+#endif
+    return;
   }
 
+  // The blocks are rebuilt, with a new layout and topology, on every regrid.
+  struct block_layout *layout = euler2d_single_layout_new(init, region);
+  block_layout_balance(layout, (int []) { 1, ref_factor }, euler2d_single_min_cells, num_ranks);
+  struct gkyl_block_topo *btopo = block_layout_topo(layout);
+  int num_blocks = block_layout_num_blocks(layout);
+
+  struct euler_block_data *mesh_bdata = gkyl_malloc(sizeof(struct euler_block_data[num_blocks]));
+  struct block_decomp *decomp = euler2d_single_blocks_init(init, app_args.use_gpu, comm, layout, btopo, mesh_bdata);
+
+  int num_boxes = 1;
+  double boxes[euler2d_single_max_boxes][4];
+  memcpy(boxes[0], region, sizeof region);
+
+  block_decomp_report_partition(decomp);
+
 #ifdef AMR_USETHREADS
   for (int i = 0; i < num_blocks; i++) {
-    gkyl_job_pool_add_work(mesh_job_pool, euler_init_job_func_block, &mesh_bdata[i]);
+    if (block_decomp_is_local(decomp, i)) {
+      gkyl_job_pool_add_work(mesh_job_pool, euler_init_job_func_block, &mesh_bdata[i]);
+    }
   }
   gkyl_job_pool_wait(mesh_job_pool);
 #else
   for (int i = 0; i < num_blocks; i++) {
-    euler_init_job_func_block(&mesh_bdata[i]);
+    if (block_decomp_is_local(decomp, i)) {
+      euler_init_job_func_block(&mesh_bdata[i]);
+    }
   }
 #endif
 
   char amr0[64];
   snprintf(amr0, 64, "%s_0", euler_output);
-  euler_write_sol_block(amr0, num_blocks, mesh_bdata);
+  euler_write_sol_block(amr0, num_blocks, mesh_bdata, decomp);
 
   double coarse_t_curr = 0.0;
   double fine_t_curr = 0.0;
-  double coarse_dt = euler_max_dt_block(num_blocks, mesh_bdata);
+  double coarse_dt = euler_max_dt_block(num_blocks, mesh_bdata, decomp);
 
   double fine_dt = (1.0 / ref_factor) * coarse_dt;
 
@@ -593,18 +769,27 @@ euler2d_run_single(int argc, char **argv, struct euler2d_single_init* init)
   int num_failures = 0;
 
   while ((coarse_t_curr < t_end) && (coarse_step <= num_steps)) {
-    printf("Taking coarse (level 0) time-step %ld at t = %g; ", coarse_step, coarse_t_curr);
-    struct gkyl_update_status coarse_status = euler_update_block(mesh_job_pool, btopo, mesh_bdata, coarse_t_curr, coarse_dt, &stats);
-    printf(" dt = %g\n", coarse_status.dt_actual);
+    if (my_rank == 0) {
+      printf("Taking coarse (level 0) time-step %ld at t = %g; ", coarse_step, coarse_t_curr);
+    }
+    struct gkyl_update_status coarse_status = euler_update_block(mesh_job_pool, btopo, mesh_bdata, decomp, coarse_t_curr, coarse_dt,
+      &stats);
+    if (my_rank == 0) {
+      printf(" dt = %g\n", coarse_status.dt_actual);
+    }
 
     if (!coarse_status.success) {
-      printf("** Update method failed! Aborting simulation ....\n");
+      if (my_rank == 0) {
+        printf("** Update method failed! Aborting simulation ....\n");
+      }
       break;
     }
 
     for (long fine_step = 1; fine_step < ref_factor + 1; fine_step++) {
-      printf("   Taking fine (level 1) time-step %ld at t = %g", fine_step, fine_t_curr);
-      printf(" dt = %g\n", (1.0 / ref_factor) * coarse_status.dt_actual);
+      if (my_rank == 0) {
+        printf("   Taking fine (level 1) time-step %ld at t = %g", fine_step, fine_t_curr);
+        printf(" dt = %g\n", (1.0 / ref_factor) * coarse_status.dt_actual);
+      }
 
       fine_t_curr += (1.0 / ref_factor) * coarse_status.dt_actual;
       fine_dt = (1.0 / ref_factor) * coarse_status.dt_suggested;
@@ -615,7 +800,7 @@ euler2d_run_single(int argc, char **argv, struct euler2d_single_init* init)
         char buf[64];
         snprintf(buf, 64, "%s_%d", euler_output, i);
 
-        euler_write_sol_block(buf, num_blocks, mesh_bdata);
+        euler_write_sol_block(buf, num_blocks, mesh_bdata, decomp);
       }
     }
 
@@ -628,12 +813,16 @@ euler2d_run_single(int argc, char **argv, struct euler2d_single_init* init)
     else if (coarse_status.dt_actual < dt_failure_tol * dt_init) {
       num_failures += 1;
 
-      printf("WARNING: Time-step dt = %g", coarse_status.dt_actual);
-      printf(" is below %g*dt_init ...", dt_failure_tol);
-      printf(" num_failures = %d\n", num_failures);
+      if (my_rank == 0) {
+        printf("WARNING: Time-step dt = %g", coarse_status.dt_actual);
+        printf(" is below %g*dt_init ...", dt_failure_tol);
+        printf(" num_failures = %d\n", num_failures);
+      }
       if (num_failures >= num_failures_max) {
-        printf("ERROR: Time-step was below %g*dt_init ", dt_failure_tol);
-        printf("%d consecutive times. Aborting simulation ....\n", num_failures_max);
+        if (my_rank == 0) {
+          printf("ERROR: Time-step was below %g*dt_init ", dt_failure_tol);
+          printf("%d consecutive times. Aborting simulation ....\n", num_failures_max);
+        }
         break;
       }
     }
@@ -641,6 +830,77 @@ euler2d_run_single(int argc, char **argv, struct euler2d_single_init* init)
       num_failures = 0;
     }
 
+    if (regrid_interval > 0 && coarse_step % regrid_interval == 0) {
+      double lower[2] = { coarse_x1, coarse_y1 }, upper[2] = { coarse_x2, coarse_y2 };
+      int lattice[2] = { lattice_Nx, lattice_Ny };
+      double new_boxes[euler2d_single_max_boxes][4];
+
+      int num_new_boxes = euler_block_refined_boxes(num_blocks, mesh_bdata, decomp, regrid_thresh, regrid_buffer,
+        euler2d_single_min_cells, regrid_efficiency, euler2d_single_max_boxes, lower, upper, lattice, new_boxes);
+
+      if (num_new_boxes > 0 && (num_new_boxes != num_boxes || memcmp(new_boxes, boxes, sizeof(double[num_boxes][4])) != 0)) {
+        if (my_rank == 0) {
+          printf("Regridding to %d refined box(es):", num_new_boxes);
+          for (int b = 0; b < num_new_boxes; b++) {
+            printf(" [%g, %g] x [%g, %g]", new_boxes[b][0], new_boxes[b][2], new_boxes[b][1], new_boxes[b][3]);
+          }
+          printf("\n");
+        }
+
+        double tot_old[5];
+        if (init->check_regrid_conservation) {
+          euler_block_integrate(num_blocks, mesh_bdata, decomp, 5, tot_old);
+        }
+
+        // The layout and topology are rebuilt around the new boxes, and the costs of the blocks change with them, so the new blocks
+        // are split and distributed afresh.
+        struct block_layout *regrid_layout = block_layout_from_boxes(lower, upper, lattice, num_new_boxes, new_boxes);
+        block_layout_balance(regrid_layout, (int []) { 1, ref_factor }, euler2d_single_min_cells, num_ranks);
+        struct gkyl_block_topo *regrid_btopo = block_layout_topo(regrid_layout);
+        int regrid_num_blocks = block_layout_num_blocks(regrid_layout);
+
+        struct euler_block_data *regrid_bdata = gkyl_malloc(sizeof(struct euler_block_data[regrid_num_blocks]));
+        struct block_decomp *regrid_decomp = euler2d_single_blocks_init(init, app_args.use_gpu, comm, regrid_layout, regrid_btopo,
+          regrid_bdata);
+        euler_block_transfer(num_blocks, mesh_bdata, decomp, regrid_num_blocks, regrid_bdata, regrid_decomp);
+
+        euler2d_single_blocks_release(decomp, num_blocks, mesh_bdata);
+        gkyl_free(mesh_bdata);
+        gkyl_block_topo_release(btopo);
+        block_layout_release(layout);
+
+        layout = regrid_layout;
+        btopo = regrid_btopo;
+        num_blocks = regrid_num_blocks;
+        mesh_bdata = regrid_bdata;
+        decomp = regrid_decomp;
+
+        num_boxes = num_new_boxes;
+        memcpy(boxes, new_boxes, sizeof(double[num_boxes][4]));
+
+        if (init->check_regrid_conservation) {
+          // The blocks of both hierarchies are on the same lattices, so the transfer conserves mass and energy to round-off.
+          double tot_new[5];
+          euler_block_integrate(num_blocks, mesh_bdata, decomp, 5, tot_new);
+
+          double err_mass = fabs(tot_new[0] - tot_old[0]) / fabs(tot_old[0]);
+          double err_energy = fabs(tot_new[4] - tot_old[4]) / fabs(tot_old[4]);
+
+          if (my_rank == 0) {
+            printf("   Relative change in total mass = %g, total energy = %g\n", err_mass, err_energy);
+          }
+          if (err_mass > 1.0e-12 || err_energy > 1.0e-12) {
+            if (my_rank == 0) {
+              printf("ERROR: Mass or energy not conserved across regrid. Aborting simulation ....\n");
+            }
+            break;
+          }
+        }
+
+        coarse_dt = fmin(coarse_dt, euler_max_dt_block(num_blocks, mesh_bdata, decomp));
+      }
+    }
+
     coarse_step += 1;
   }
 
@@ -649,32 +909,28 @@ euler2d_run_single(int argc, char **argv, struct euler2d_single_init* init)
   char buf[64];
   snprintf(buf, 64, "%s_%d", euler_output, num_frames);
 
-  euler_write_sol_block(buf, num_blocks, mesh_bdata);
+  euler_write_sol_block(buf, num_blocks, mesh_bdata, decomp);
 
-  printf("\n");
-  printf("Number of update calls %ld\n", (coarse_step - 1));
-  printf("Number of failed time-steps %d\n", stats.nfail);
-  printf("Total updates took %g secs\n", tm_total_sec);
-
-  for (int i = 0; i < num_blocks; i++) {
-    gkyl_fv_proj_release(mesh_bdata[i].fv_proj);
-    gkyl_wv_eqn_release(mesh_bdata[i].euler);
-    euler_block_bc_updaters_release(&mesh_bdata[i]);
-    gkyl_wave_geom_release(mesh_bdata[i].geom);
-
-    for (int d = 0; d < ndim; d++) {
-      gkyl_wave_prop_release(mesh_bdata[i].slvr[d]);
-    }
-    
-    gkyl_array_release(mesh_bdata[i].fdup);
-    
-    for (int d = 0; d < ndim; d++) {
-      gkyl_array_release(mesh_bdata[i].f[d]);
-    }
+  if (my_rank == 0) {
+    printf("\n");
+    printf("Number of update calls %ld\n", (coarse_step - 1));
+    printf("Number of failed time-steps %d\n", stats.nfail);
+    printf("Total updates took %g secs\n", tm_total_sec);
   }
 
+  euler2d_single_blocks_release(decomp, num_blocks, mesh_bdata);
+  gkyl_free(mesh_bdata);
+
   gkyl_block_topo_release(btopo);
+  block_layout_release(layout);
   gkyl_job_pool_release(mesh_job_pool);
+  gkyl_comm_release(comm);
+
+#ifdef GKYL_HAVE_MPI
+  if (app_args.use_mpi) {
+    MPI_Finalize();
+  }
+#endif
 }
 
 void
@@ -682,6 +938,12 @@ euler2d_run_double(int argc, char **argv, struct euler2d_double_init* init)
 {
   struct gkyl_app_args app_args = parse_app_args(argc, argv);
 
+#ifdef GKYL_HAVE_MPI
+  if (app_args.use_mpi) {
+    MPI_Init(&argc, &argv);
+  }
+#endif
+
   if (app_args.trace_mem) {
     gkyl_cu_dev_mem_debug_set(true);
     gkyl_mem_debug_set(true);
@@ -728,73 +990,38 @@ euler2d_run_double(int argc, char **argv, struct euler2d_double_init* init)
   int num_failures_max = init->num_failures_max;
 
   int ndim = 2;
-  int num_blocks = 25;
-  int Nx = base_Nx;
-  int Ny = base_Ny;
-
-  struct euler_block_data mesh_bdata[num_blocks];
   struct gkyl_job_pool *mesh_job_pool = gkyl_thread_pool_new(app_args.num_threads);
 
-  gkyl_rect_grid_init(&mesh_bdata[0].grid, 2, (double []) { refined_x1, refined_y1 }, (double []) { refined_x2, refined_y2 },
-    (int []) { Nx * (ref_factor1 * ref_factor2), Ny * (ref_factor1 * ref_factor2) });
-
-  gkyl_rect_grid_init(&mesh_bdata[1].grid, 2, (double []) { intermediate_x1, refined_y2 }, (double []) { refined_x1, intermediate_y2 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[2].grid, 2, (double []) { refined_x1, refined_y2 }, (double []) { refined_x2, intermediate_y2 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[3].grid, 2, (double []) { refined_x2, refined_y2 }, (double []) { intermediate_x2, intermediate_y2 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[4].grid, 2, (double []) { intermediate_x1, refined_y1 }, (double []) { refined_x1, refined_y2 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[5].grid, 2, (double []) { refined_x2, refined_y1 }, (double []) { intermediate_x2, refined_y2 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[6].grid, 2, (double []) { intermediate_x1, intermediate_y1 }, (double []) { refined_x1, refined_y1 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[7].grid, 2, (double []) { refined_x1, intermediate_y1 }, (double []) { refined_x2, refined_y1 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[8].grid, 2, (double []) { refined_x2, intermediate_y1 }, (double []) { intermediate_x2, refined_y1 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-
-  gkyl_rect_grid_init(&mesh_bdata[9].grid, 2, (double []) { coarse_x1, intermediate_y2 }, (double []) { intermediate_x1, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[10].grid, 2, (double []) { intermediate_x1, intermediate_y2 }, (double []) { refined_x1, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[11].grid, 2, (double []) { refined_x1, intermediate_y2 }, (double []) { refined_x2, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[12].grid, 2, (double []) { refined_x2, intermediate_y2 }, (double []) { intermediate_x2, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[13].grid, 2, (double []) { intermediate_x2, intermediate_y2 }, (double []) { coarse_x2, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[14].grid, 2, (double []) { coarse_x1, refined_y2 }, (double []) { intermediate_x1, intermediate_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[15].grid, 2, (double []) { intermediate_x2, refined_y2 }, (double []) { coarse_x2, intermediate_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[16].grid, 2, (double []) { coarse_x1, refined_y1 }, (double []) { intermediate_x1, refined_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[17].grid, 2, (double []) { intermediate_x2, refined_y1 }, (double []) { coarse_x2, refined_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[18].grid, 2, (double []) { coarse_x1, intermediate_y1 }, (double []) { intermediate_x1, refined_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[19].grid, 2, (double []) { intermediate_x2, intermediate_y1 }, (double []) { coarse_x2, refined_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[20].grid, 2, (double []) { coarse_x1, coarse_y1 }, (double []) { intermediate_x1, intermediate_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[21].grid, 2, (double []) { intermediate_x1, coarse_y1 }, (double []) { refined_x1, intermediate_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[22].grid, 2, (double []) { refined_x1, coarse_y1 }, (double []) { refined_x2, intermediate_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[23].grid, 2, (double []) { refined_x2, coarse_y1 }, (double []) { intermediate_x2, intermediate_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[24].grid, 2, (double []) { intermediate_x2, coarse_y1 }, (double []) { coarse_x2, intermediate_y1 },
-    (int []) { Nx, Ny });
+  // Blocks are split and distributed across the MPI ranks, if MPI is used.
+  struct gkyl_comm *comm = block_comm_new(app_args.use_mpi);
+
+  int my_rank, num_ranks;
+  gkyl_comm_get_rank(comm, &my_rank);
+  gkyl_comm_get_size(comm, &num_ranks);
+
+  int level_ref[3] = { 1, ref_factor1, ref_factor1 * ref_factor2 };
+  double patch[2][4] = {
+    { intermediate_x1, intermediate_y1, intermediate_x2, intermediate_y2 },
+    { refined_x1, refined_y1, refined_x2, refined_y2 },
+  };
+  struct block_layout *layout = block_layout_nested_new(3, (double []) { coarse_x1, coarse_y1 }, (double []) { coarse_x2, coarse_y2 },
+    patch, (int []) { base_Nx, base_Ny });
+
+  // Blocks are not split below two coarse cells, the width of the ghost layer.
+  block_layout_balance(layout, level_ref, 2, num_ranks);
+
+  struct gkyl_block_topo *btopo = block_layout_topo(layout);
+  int num_blocks = block_layout_num_blocks(layout);
+
+  struct euler_block_data *mesh_bdata = gkyl_calloc(num_blocks, sizeof(struct euler_block_data));
 
   for (int i = 0; i < num_blocks; i++) {
-    mesh_bdata[i].fv_proj = gkyl_fv_proj_new(&mesh_bdata[i].grid, 2, 5, eval, 0);
+    block_layout_block_grid(layout, i, level_ref, &mesh_bdata[i].grid);
   }
-  
+
   for (int i = 0; i < num_blocks; i++) {
     gkyl_create_grid_ranges(&mesh_bdata[i].grid, (int []) { 2, 2 }, &mesh_bdata[i].ext_range, &mesh_bdata[i].range);
-    mesh_bdata[i].geom = gkyl_wave_geom_new(&mesh_bdata[i].grid, &mesh_bdata[i].ext_range, 0, 0, false);
+    skin_ghost_ranges_init_block(&mesh_bdata[i].skin_ghost, &mesh_bdata[i].ext_range, (int []) { 2, 2 });
 
     mesh_bdata[i].copy_x = copy_x;
     mesh_bdata[i].copy_y = copy_y;
@@ -803,7 +1030,23 @@ euler2d_run_double(int argc, char **argv, struct euler2d_double_init* init)
     mesh_bdata[i].wall_y = wall_y;
   }
 
+  struct block_decomp *decomp = block_decomp_new(comm, btopo, mesh_bdata, 5);
+  block_decomp_report_partition(decomp);
+
+  for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
+    mesh_bdata[i].fv_proj = gkyl_fv_proj_new(&mesh_bdata[i].grid, 2, 5, eval, 0);
+    mesh_bdata[i].geom = gkyl_wave_geom_new(&mesh_bdata[i].grid, &mesh_bdata[i].ext_range, 0, 0, false);
+  }
+
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     if (low_order_flux) {
       struct gkyl_wv_euler_inp inp = {
         .gas_gamma = gas_gamma,
@@ -830,13 +1073,19 @@ euler2d_run_double(int argc, char **argv, struct euler2d_double_init* init)
     }
   }
 
-  struct gkyl_block_topo *btopo = create_nested_block_topo();
-
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     euler_nested_block_bc_updaters_init(mesh_bdata[i].euler, &mesh_bdata[i], &btopo->conn[i]);
   }
 
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     mesh_bdata[i].fdup = gkyl_array_new(GKYL_DOUBLE, 5, mesh_bdata[i].ext_range.volume);
 
     for (int d = 0; d < ndim + 1; d++) {
@@ -846,23 +1095,27 @@ euler2d_run_double(int argc, char **argv, struct euler2d_double_init* init)
 
 #ifdef AMR_USETHREADS
   for (int i = 0; i < num_blocks; i++) {
-    gkyl_job_pool_add_work(mesh_job_pool, euler_init_job_func_block, &mesh_bdata[i]);
+    if (block_decomp_is_local(decomp, i)) {
+      gkyl_job_pool_add_work(mesh_job_pool, euler_init_job_func_block, &mesh_bdata[i]);
+    }
   }
   gkyl_job_pool_wait(mesh_job_pool);
 #else
   for (int i = 0; i < num_blocks; i++) {
-    euler_init_job_func_block(&mesh_bdata[i]);
+    if (block_decomp_is_local(decomp, i)) {
+      euler_init_job_func_block(&mesh_bdata[i]);
+    }
   }
 #endif
 
   char amr0[64];
   snprintf(amr0, 64, "%s_0", euler_output);
-  euler_write_sol_block(amr0, num_blocks, mesh_bdata);
+  euler_write_sol_block(amr0, num_blocks, mesh_bdata, decomp);
 
   double coarse_t_curr = 0.0;
   double intermediate_t_curr = 0.0;
   double fine_t_curr = 0.0;
-  double coarse_dt = euler_max_dt_block(num_blocks, mesh_bdata);
+  double coarse_dt = euler_max_dt_block(num_blocks, mesh_bdata, decomp);
 
   double intermediate_dt = (1.0 / ref_factor1) * coarse_dt;
   double fine_dt = (1.0 / (ref_factor1 * ref_factor2)) * coarse_dt;
@@ -880,22 +1133,32 @@ euler2d_run_double(int argc, char **argv, struct euler2d_double_init* init)
   int num_failures = 0;
 
   while ((coarse_t_curr < t_end) && (coarse_step <= num_steps)) {
-    printf("Taking coarse (level 0) time-step %ld at t = %g; ", coarse_step, coarse_t_curr);
-    struct gkyl_update_status coarse_status = euler_update_block(mesh_job_pool, btopo, mesh_bdata, coarse_t_curr, coarse_dt, &stats);
-    printf(" dt = %g\n", coarse_status.dt_actual);
+    if (my_rank == 0) {
+      printf("Taking coarse (level 0) time-step %ld at t = %g; ", coarse_step, coarse_t_curr);
+    }
+    struct gkyl_update_status coarse_status = euler_update_block(mesh_job_pool, btopo, mesh_bdata, decomp, coarse_t_curr, coarse_dt, &stats);
+    if (my_rank == 0) {
+      printf(" dt = %g\n", coarse_status.dt_actual);
+    }
 
     if (!coarse_status.success) {
-      printf("** Update method failed! Aborting simulation ....\n");
+      if (my_rank == 0) {
+        printf("** Update method failed! Aborting simulation ....\n");
+      }
       break;
     }
 
     for (long intermediate_step = 1; intermediate_step < ref_factor1 + 1; intermediate_step++) {
-      printf("   Taking intermediate (level 1) time-step %ld at t = %g", intermediate_step, intermediate_t_curr);
-      printf(" dt = %g\n", (1.0 / ref_factor1) * coarse_status.dt_actual);
+      if (my_rank == 0) {
+        printf("   Taking intermediate (level 1) time-step %ld at t = %g", intermediate_step, intermediate_t_curr);
+        printf(" dt = %g\n", (1.0 / ref_factor1) * coarse_status.dt_actual);
+      }
 
       for (long fine_step = 1; fine_step < ref_factor2 + 1; fine_step++) {
-        printf("      Taking fine (level 2) time-step %ld at t = %g", fine_step, fine_t_curr);
-        printf(" dt = %g\n", (1.0 / (ref_factor1 * ref_factor2)) * coarse_status.dt_actual);
+        if (my_rank == 0) {
+          printf("      Taking fine (level 2) time-step %ld at t = %g", fine_step, fine_t_curr);
+          printf(" dt = %g\n", (1.0 / (ref_factor1 * ref_factor2)) * coarse_status.dt_actual);
+        }
 
         fine_t_curr += (1.0 / (ref_factor1 * ref_factor2)) * coarse_status.dt_actual;
         fine_dt = (1.0 / (ref_factor1 * ref_factor2)) * coarse_status.dt_suggested;
@@ -910,7 +1173,7 @@ euler2d_run_double(int argc, char **argv, struct euler2d_double_init* init)
         char buf[64];
         snprintf(buf, 64, "%s_%d", euler_output, i);
 
-        euler_write_sol_block(buf, num_blocks, mesh_bdata);
+        euler_write_sol_block(buf, num_blocks, mesh_bdata, decomp);
       }
     }
 
@@ -923,12 +1186,16 @@ euler2d_run_double(int argc, char **argv, struct euler2d_double_init* init)
     else if (coarse_status.dt_actual < dt_failure_tol * dt_init) {
       num_failures += 1;
 
-      printf("WARNING: Time-step dt = %g", coarse_status.dt_actual);
-      printf(" is below %g*dt_init ...", dt_failure_tol);
-      printf(" num_failures = %d\n", num_failures);
+      if (my_rank == 0) {
+        printf("WARNING: Time-step dt = %g", coarse_status.dt_actual);
+        printf(" is below %g*dt_init ...", dt_failure_tol);
+        printf(" num_failures = %d\n", num_failures);
+      }
       if (num_failures >= num_failures_max) {
-        printf("ERROR: Time-step was below %g*dt_init ", dt_failure_tol);
-        printf("%d consecutive times. Aborting simulation ....\n", num_failures_max);
+        if (my_rank == 0) {
+          printf("ERROR: Time-step was below %g*dt_init ", dt_failure_tol);
+          printf("%d consecutive times. Aborting simulation ....\n", num_failures_max);
+        }
         break;
       }
     }
@@ -944,14 +1211,20 @@ euler2d_run_double(int argc, char **argv, struct euler2d_double_init* init)
   char buf[64];
   snprintf(buf, 64, "%s_%d", euler_output, num_frames);
 
-  euler_write_sol_block(buf, num_blocks, mesh_bdata);
+  euler_write_sol_block(buf, num_blocks, mesh_bdata, decomp);
 
-  printf("\n");
-  printf("Number of update calls %ld\n", (coarse_step - 1));
-  printf("Number of failed time-steps %d\n", stats.nfail);
-  printf("Total updates took %g secs\n", tm_total_sec);
+  if (my_rank == 0) {
+    printf("\n");
+    printf("Number of update calls %ld\n", (coarse_step - 1));
+    printf("Number of failed time-steps %d\n", stats.nfail);
+    printf("Total updates took %g secs\n", tm_total_sec);
+  }
 
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     gkyl_fv_proj_release(mesh_bdata[i].fv_proj);
     gkyl_wv_eqn_release(mesh_bdata[i].euler);
     euler_block_bc_updaters_release(&mesh_bdata[i]);
@@ -968,6 +1241,17 @@ euler2d_run_double(int argc, char **argv, struct euler2d_double_init* init)
     }
   }
 
+  block_decomp_release(decomp);
+  gkyl_free(mesh_bdata);
+
   gkyl_block_topo_release(btopo);
+  block_layout_release(layout);
   gkyl_job_pool_release(mesh_job_pool);
+  gkyl_comm_release(comm);
+
+#ifdef GKYL_HAVE_MPI
+  if (app_args.use_mpi) {
+    MPI_Finalize();
+  }
+#endif
 }
\ No newline at end of file
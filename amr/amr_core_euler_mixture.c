@@ -418,6 +418,12 @@ euler_mixture2d_run_single(int argc, char **argv, struct euler_mixture2d_single_
 {
   struct gkyl_app_args app_args = parse_app_args(argc, argv);
 
+#ifdef GKYL_HAVE_MPI
+  if (app_args.use_mpi) {
+    MPI_Init(&argc, &argv);
+  }
+#endif
+
   if (app_args.trace_mem) {
     gkyl_cu_dev_mem_debug_set(true);
     gkyl_mem_debug_set(true);
@@ -459,40 +465,37 @@ euler_mixture2d_run_single(int argc, char **argv, struct euler_mixture2d_single_
   int num_failures_max = init->num_failures_max;
 
   int ndim = 2;
-  int num_blocks = 9;
-  int Nx = base_Nx;
-  int Ny = base_Ny;
-
-  struct euler_block_data mesh_bdata[num_blocks];
   struct gkyl_job_pool *mesh_job_pool = gkyl_thread_pool_new(app_args.num_threads);
 
-  gkyl_rect_grid_init(&mesh_bdata[0].grid, 2, (double []) { refined_x1, refined_y1 }, (double []) { refined_x2, refined_y2 },
-    (int []) { Nx * ref_factor, Ny * ref_factor });
-
-  gkyl_rect_grid_init(&mesh_bdata[1].grid, 2, (double []) { coarse_x1, refined_y2 }, (double []) { refined_x1, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[2].grid, 2, (double []) { refined_x1, refined_y2 }, (double []) { refined_x2, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[3].grid, 2, (double []) { refined_x2, refined_y2 }, (double []) { coarse_x2, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[4].grid, 2, (double []) { coarse_x1, refined_y1 }, (double []) { refined_x1, refined_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[5].grid, 2, (double []) { refined_x2, refined_y1 }, (double []) { coarse_x2, refined_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[6].grid, 2, (double []) { coarse_x1, coarse_y1 }, (double []) { refined_x1, refined_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[7].grid, 2, (double []) { refined_x1, coarse_y1 }, (double []) { refined_x2, refined_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[8].grid, 2, (double []) { refined_x2, coarse_y1 }, (double []) { coarse_x2, refined_y1 },
-    (int []) { Nx, Ny });
+  // Blocks are split and distributed across the MPI ranks, if MPI is used.
+  struct gkyl_comm *comm = block_comm_new(app_args.use_mpi);
+
+  int my_rank, num_ranks;
+  gkyl_comm_get_rank(comm, &my_rank);
+  gkyl_comm_get_size(comm, &num_ranks);
+
+  int level_ref[2] = { 1, ref_factor };
+  double patch[1][4] = {
+    { refined_x1, refined_y1, refined_x2, refined_y2 },
+  };
+  struct block_layout *layout = block_layout_nested_new(2, (double []) { coarse_x1, coarse_y1 }, (double []) { coarse_x2, coarse_y2 },
+    patch, (int []) { base_Nx, base_Ny });
+
+  // Blocks are not split below two coarse cells, the width of the ghost layer.
+  block_layout_balance(layout, level_ref, 2, num_ranks);
+
+  struct gkyl_block_topo *btopo = block_layout_topo(layout);
+  int num_blocks = block_layout_num_blocks(layout);
+
+  struct euler_block_data *mesh_bdata = gkyl_calloc(num_blocks, sizeof(struct euler_block_data));
 
   for (int i = 0; i < num_blocks; i++) {
-    mesh_bdata[i].fv_proj = gkyl_fv_proj_new(&mesh_bdata[i].grid, 2, 4 + (2 * num_species), eval, 0);
+    block_layout_block_grid(layout, i, level_ref, &mesh_bdata[i].grid);
   }
-  
+
   for (int i = 0; i < num_blocks; i++) {
     gkyl_create_grid_ranges(&mesh_bdata[i].grid, (int []) { 2, 2 }, &mesh_bdata[i].ext_range, &mesh_bdata[i].range);
-    mesh_bdata[i].geom = gkyl_wave_geom_new(&mesh_bdata[i].grid, &mesh_bdata[i].ext_range, 0, 0, false);
+    skin_ghost_ranges_init_block(&mesh_bdata[i].skin_ghost, &mesh_bdata[i].ext_range, (int []) { 2, 2 });
 
     mesh_bdata[i].copy_x = copy_x;
     mesh_bdata[i].copy_y = copy_y;
@@ -501,7 +504,23 @@ euler_mixture2d_run_single(int argc, char **argv, struct euler_mixture2d_single_
     mesh_bdata[i].wall_y = wall_y;
   }
 
+  struct block_decomp *decomp = block_decomp_new(comm, btopo, mesh_bdata, 4 + (2 * num_species));
+  block_decomp_report_partition(decomp);
+
+  for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
+    mesh_bdata[i].fv_proj = gkyl_fv_proj_new(&mesh_bdata[i].grid, 2, 4 + (2 * num_species), eval, 0);
+    mesh_bdata[i].geom = gkyl_wave_geom_new(&mesh_bdata[i].grid, &mesh_bdata[i].ext_range, 0, 0, false);
+  }
+
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     mesh_bdata[i].euler = gkyl_wv_euler_mixture_new(num_species, gas_gamma_s, app_args.use_gpu);
 
     for (int d = 0; d < ndim; d++) {
@@ -518,13 +537,19 @@ euler_mixture2d_run_single(int argc, char **argv, struct euler_mixture2d_single_
     }
   }
 
-  struct gkyl_block_topo *btopo = create_block_topo();
-
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     euler_mixture_block_bc_updaters_init(mesh_bdata[i].euler, &mesh_bdata[i], &btopo->conn[i]);
   }
 
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     mesh_bdata[i].fdup = gkyl_array_new(GKYL_DOUBLE, 4 + (2 * num_species), mesh_bdata[i].ext_range.volume);
 
     for (int d = 0; d < ndim + 1; d++) {
@@ -534,22 +559,26 @@ euler_mixture2d_run_single(int argc, char **argv, struct euler_mixture2d_single_
 
 #ifdef AMR_USETHREADS
   for (int i = 0; i < num_blocks; i++) {
-    gkyl_job_pool_add_work(mesh_job_pool, euler_init_job_func_block, &mesh_bdata[i]);
+    if (block_decomp_is_local(decomp, i)) {
+      gkyl_job_pool_add_work(mesh_job_pool, euler_init_job_func_block, &mesh_bdata[i]);
+    }
   }
   gkyl_job_pool_wait(mesh_job_pool);
 #else
   for (int i = 0; i < num_blocks; i++) {
-    euler_init_job_func_block(&mesh_bdata[i]);
+    if (block_decomp_is_local(decomp, i)) {
+      euler_init_job_func_block(&mesh_bdata[i]);
+    }
   }
 #endif
 
   char amr0[64];
   snprintf(amr0, 64, "%s_0", euler_mixture_output);
-  euler_write_sol_block(amr0, num_blocks, mesh_bdata);
+  euler_write_sol_block(amr0, num_blocks, mesh_bdata, decomp);
 
   double coarse_t_curr = 0.0;
   double fine_t_curr = 0.0;
-  double coarse_dt = euler_max_dt_block(num_blocks, mesh_bdata);
+  double coarse_dt = euler_max_dt_block(num_blocks, mesh_bdata, decomp);
 
   double fine_dt = (1.0 / ref_factor) * coarse_dt;
 
@@ -566,18 +595,26 @@ euler_mixture2d_run_single(int argc, char **argv, struct euler_mixture2d_single_
   int num_failures = 0;
 
   while ((coarse_t_curr < t_end) && (coarse_step <= num_steps)) {
-    printf("Taking coarse (level 0) time-step %ld at t = %g; ", coarse_step, coarse_t_curr);
-    struct gkyl_update_status coarse_status = euler_update_block(mesh_job_pool, btopo, mesh_bdata, coarse_t_curr, coarse_dt, &stats);
-    printf(" dt = %g\n", coarse_status.dt_actual);
+    if (my_rank == 0) {
+      printf("Taking coarse (level 0) time-step %ld at t = %g; ", coarse_step, coarse_t_curr);
+    }
+    struct gkyl_update_status coarse_status = euler_update_block(mesh_job_pool, btopo, mesh_bdata, decomp, coarse_t_curr, coarse_dt, &stats);
+    if (my_rank == 0) {
+      printf(" dt = %g\n", coarse_status.dt_actual);
+    }
 
     if (!coarse_status.success) {
-      printf("** Update method failed! Aborting simulation ....\n");
+      if (my_rank == 0) {
+        printf("** Update method failed! Aborting simulation ....\n");
+      }
       break;
     }
 
     for (long fine_step = 1; fine_step < ref_factor + 1; fine_step++) {
-      printf("   Taking fine (level 1) time-step %ld at t = %g", fine_step, fine_t_curr);
-      printf(" dt = %g\n", (1.0 / ref_factor) * coarse_status.dt_actual);
+      if (my_rank == 0) {
+        printf("   Taking fine (level 1) time-step %ld at t = %g", fine_step, fine_t_curr);
+        printf(" dt = %g\n", (1.0 / ref_factor) * coarse_status.dt_actual);
+      }
 
       fine_t_curr += (1.0 / ref_factor) * coarse_status.dt_actual;
       fine_dt = (1.0 / ref_factor) * coarse_status.dt_suggested;
@@ -588,7 +625,7 @@ euler_mixture2d_run_single(int argc, char **argv, struct euler_mixture2d_single_
         char buf[64];
         snprintf(buf, 64, "%s_%d", euler_mixture_output, i);
 
-        euler_write_sol_block(buf, num_blocks, mesh_bdata);
+        euler_write_sol_block(buf, num_blocks, mesh_bdata, decomp);
       }
     }
 
@@ -601,12 +638,16 @@ euler_mixture2d_run_single(int argc, char **argv, struct euler_mixture2d_single_
     else if (coarse_status.dt_actual < dt_failure_tol * dt_init) {
       num_failures += 1;
 
-      printf("WARNING: Time-step dt = %g", coarse_status.dt_actual);
-      printf(" is below %g*dt_init ...", dt_failure_tol);
-      printf(" num_failures = %d\n", num_failures);
+      if (my_rank == 0) {
+        printf("WARNING: Time-step dt = %g", coarse_status.dt_actual);
+        printf(" is below %g*dt_init ...", dt_failure_tol);
+        printf(" num_failures = %d\n", num_failures);
+      }
       if (num_failures >= num_failures_max) {
-        printf("ERROR: Time-step was below %g*dt_init ", dt_failure_tol);
-        printf("%d consecutive times. Aborting simulation ....\n", num_failures_max);
+        if (my_rank == 0) {
+          printf("ERROR: Time-step was below %g*dt_init ", dt_failure_tol);
+          printf("%d consecutive times. Aborting simulation ....\n", num_failures_max);
+        }
         break;
       }
     }
@@ -622,14 +663,20 @@ euler_mixture2d_run_single(int argc, char **argv, struct euler_mixture2d_single_
   char buf[64];
   snprintf(buf, 64, "%s_%d", euler_mixture_output, num_frames);
 
-  euler_write_sol_block(buf, num_blocks, mesh_bdata);
+  euler_write_sol_block(buf, num_blocks, mesh_bdata, decomp);
 
-  printf("\n");
-  printf("Number of update calls %ld\n", (coarse_step - 1));
-  printf("Number of failed time-steps %d\n", stats.nfail);
-  printf("Total updates took %g secs\n", tm_total_sec);
+  if (my_rank == 0) {
+    printf("\n");
+    printf("Number of update calls %ld\n", (coarse_step - 1));
+    printf("Number of failed time-steps %d\n", stats.nfail);
+    printf("Total updates took %g secs\n", tm_total_sec);
+  }
 
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     gkyl_fv_proj_release(mesh_bdata[i].fv_proj);
     gkyl_wv_eqn_release(mesh_bdata[i].euler);
     euler_block_bc_updaters_release(&mesh_bdata[i]);
@@ -646,8 +693,19 @@ euler_mixture2d_run_single(int argc, char **argv, struct euler_mixture2d_single_
     }
   }
 
+  block_decomp_release(decomp);
+  gkyl_free(mesh_bdata);
+
   gkyl_block_topo_release(btopo);
+  block_layout_release(layout);
   gkyl_job_pool_release(mesh_job_pool);
+  gkyl_comm_release(comm);
+
+#ifdef GKYL_HAVE_MPI
+  if (app_args.use_mpi) {
+    MPI_Finalize();
+  }
+#endif
 }
 
 void
@@ -655,6 +713,12 @@ euler_mixture2d_run_double(int argc, char **argv, struct euler_mixture2d_double_
 {
   struct gkyl_app_args app_args = parse_app_args(argc, argv);
 
+#ifdef GKYL_HAVE_MPI
+  if (app_args.use_mpi) {
+    MPI_Init(&argc, &argv);
+  }
+#endif
+
   if (app_args.trace_mem) {
     gkyl_cu_dev_mem_debug_set(true);
     gkyl_mem_debug_set(true);
@@ -702,73 +766,38 @@ euler_mixture2d_run_double(int argc, char **argv, struct euler_mixture2d_double_
   int num_failures_max = init->num_failures_max;
 
   int ndim = 2;
-  int num_blocks = 25;
-  int Nx = base_Nx;
-  int Ny = base_Ny;
-
-  struct euler_block_data mesh_bdata[num_blocks];
   struct gkyl_job_pool *mesh_job_pool = gkyl_thread_pool_new(app_args.num_threads);
 
-  gkyl_rect_grid_init(&mesh_bdata[0].grid, 2, (double []) { refined_x1, refined_y1 }, (double []) { refined_x2, refined_y2 },
-    (int []) { Nx * (ref_factor1 * ref_factor2), Ny * (ref_factor1 * ref_factor2) });
-
-  gkyl_rect_grid_init(&mesh_bdata[1].grid, 2, (double []) { intermediate_x1, refined_y2 }, (double []) { refined_x1, intermediate_y2 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[2].grid, 2, (double []) { refined_x1, refined_y2 }, (double []) { refined_x2, intermediate_y2 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[3].grid, 2, (double []) { refined_x2, refined_y2 }, (double []) { intermediate_x2, intermediate_y2 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[4].grid, 2, (double []) { intermediate_x1, refined_y1 }, (double []) { refined_x1, refined_y2 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[5].grid, 2, (double []) { refined_x2, refined_y1 }, (double []) { intermediate_x2, refined_y2 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[6].grid, 2, (double []) { intermediate_x1, intermediate_y1 }, (double []) { refined_x1, refined_y1 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[7].grid, 2, (double []) { refined_x1, intermediate_y1 }, (double []) { refined_x2, refined_y1 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-  gkyl_rect_grid_init(&mesh_bdata[8].grid, 2, (double []) { refined_x2, intermediate_y1 }, (double []) { intermediate_x2, refined_y1 },
-    (int []) { Nx * ref_factor1, Ny * ref_factor1 });
-
-  gkyl_rect_grid_init(&mesh_bdata[9].grid, 2, (double []) { coarse_x1, intermediate_y2 }, (double []) { intermediate_x1, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[10].grid, 2, (double []) { intermediate_x1, intermediate_y2 }, (double []) { refined_x1, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[11].grid, 2, (double []) { refined_x1, intermediate_y2 }, (double []) { refined_x2, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[12].grid, 2, (double []) { refined_x2, intermediate_y2 }, (double []) { intermediate_x2, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[13].grid, 2, (double []) { intermediate_x2, intermediate_y2 }, (double []) { coarse_x2, coarse_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[14].grid, 2, (double []) { coarse_x1, refined_y2 }, (double []) { intermediate_x1, intermediate_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[15].grid, 2, (double []) { intermediate_x2, refined_y2 }, (double []) { coarse_x2, intermediate_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[16].grid, 2, (double []) { coarse_x1, refined_y1 }, (double []) { intermediate_x1, refined_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[17].grid, 2, (double []) { intermediate_x2, refined_y1 }, (double []) { coarse_x2, refined_y2 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[18].grid, 2, (double []) { coarse_x1, intermediate_y1 }, (double []) { intermediate_x1, refined_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[19].grid, 2, (double []) { intermediate_x2, intermediate_y1 }, (double []) { coarse_x2, refined_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[20].grid, 2, (double []) { coarse_x1, coarse_y1 }, (double []) { intermediate_x1, intermediate_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[21].grid, 2, (double []) { intermediate_x1, coarse_y1 }, (double []) { refined_x1, intermediate_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[22].grid, 2, (double []) { refined_x1, coarse_y1 }, (double []) { refined_x2, intermediate_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[23].grid, 2, (double []) { refined_x2, coarse_y1 }, (double []) { intermediate_x2, intermediate_y1 },
-    (int []) { Nx, Ny });
-  gkyl_rect_grid_init(&mesh_bdata[24].grid, 2, (double []) { intermediate_x2, coarse_y1 }, (double []) { coarse_x2, intermediate_y1 },
-    (int []) { Nx, Ny });
+  // Blocks are split and distributed across the MPI ranks, if MPI is used.
+  struct gkyl_comm *comm = block_comm_new(app_args.use_mpi);
+
+  int my_rank, num_ranks;
+  gkyl_comm_get_rank(comm, &my_rank);
+  gkyl_comm_get_size(comm, &num_ranks);
+
+  int level_ref[3] = { 1, ref_factor1, ref_factor1 * ref_factor2 };
+  double patch[2][4] = {
+    { intermediate_x1, intermediate_y1, intermediate_x2, intermediate_y2 },
+    { refined_x1, refined_y1, refined_x2, refined_y2 },
+  };
+  struct block_layout *layout = block_layout_nested_new(3, (double []) { coarse_x1, coarse_y1 }, (double []) { coarse_x2, coarse_y2 },
+    patch, (int []) { base_Nx, base_Ny });
+
+  // Blocks are not split below two coarse cells, the width of the ghost layer.
+  block_layout_balance(layout, level_ref, 2, num_ranks);
+
+  struct gkyl_block_topo *btopo = block_layout_topo(layout);
+  int num_blocks = block_layout_num_blocks(layout);
+
+  struct euler_block_data *mesh_bdata = gkyl_calloc(num_blocks, sizeof(struct euler_block_data));
 
   for (int i = 0; i < num_blocks; i++) {
-    mesh_bdata[i].fv_proj = gkyl_fv_proj_new(&mesh_bdata[i].grid, 2, 4 + (2 * num_species), eval, 0);
+    block_layout_block_grid(layout, i, level_ref, &mesh_bdata[i].grid);
   }
-  
+
   for (int i = 0; i < num_blocks; i++) {
     gkyl_create_grid_ranges(&mesh_bdata[i].grid, (int []) { 2, 2 }, &mesh_bdata[i].ext_range, &mesh_bdata[i].range);
-    mesh_bdata[i].geom = gkyl_wave_geom_new(&mesh_bdata[i].grid, &mesh_bdata[i].ext_range, 0, 0, false);
+    skin_ghost_ranges_init_block(&mesh_bdata[i].skin_ghost, &mesh_bdata[i].ext_range, (int []) { 2, 2 });
 
     mesh_bdata[i].copy_x = copy_x;
     mesh_bdata[i].copy_y = copy_y;
@@ -777,7 +806,23 @@ euler_mixture2d_run_double(int argc, char **argv, struct euler_mixture2d_double_
     mesh_bdata[i].wall_y = wall_y;
   }
 
+  struct block_decomp *decomp = block_decomp_new(comm, btopo, mesh_bdata, 4 + (2 * num_species));
+  block_decomp_report_partition(decomp);
+
+  for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
+    mesh_bdata[i].fv_proj = gkyl_fv_proj_new(&mesh_bdata[i].grid, 2, 4 + (2 * num_species), eval, 0);
+    mesh_bdata[i].geom = gkyl_wave_geom_new(&mesh_bdata[i].grid, &mesh_bdata[i].ext_range, 0, 0, false);
+  }
+
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     mesh_bdata[i].euler = gkyl_wv_euler_mixture_new(num_species, gas_gamma_s, app_args.use_gpu);
 
     for (int d = 0; d < ndim; d++) {
@@ -794,13 +839,19 @@ euler_mixture2d_run_double(int argc, char **argv, struct euler_mixture2d_double_
     }
   }
 
-  struct gkyl_block_topo *btopo = create_nested_block_topo();
-
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     euler_mixture_nested_block_bc_updaters_init(mesh_bdata[i].euler, &mesh_bdata[i], &btopo->conn[i]);
   }
 
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     mesh_bdata[i].fdup = gkyl_array_new(GKYL_DOUBLE, 4 + (2 * num_species), mesh_bdata[i].ext_range.volume);
 
     for (int d = 0; d < ndim + 1; d++) {
@@ -810,23 +861,27 @@ euler_mixture2d_run_double(int argc, char **argv, struct euler_mixture2d_double_
 
 #ifdef AMR_USETHREADS
   for (int i = 0; i < num_blocks; i++) {
-    gkyl_job_pool_add_work(mesh_job_pool, euler_init_job_func_block, &mesh_bdata[i]);
+    if (block_decomp_is_local(decomp, i)) {
+      gkyl_job_pool_add_work(mesh_job_pool, euler_init_job_func_block, &mesh_bdata[i]);
+    }
   }
   gkyl_job_pool_wait(mesh_job_pool);
 #else
   for (int i = 0; i < num_blocks; i++) {
-    euler_init_job_func_block(&mesh_bdata[i]);
+    if (block_decomp_is_local(decomp, i)) {
+      euler_init_job_func_block(&mesh_bdata[i]);
+    }
   }
 #endif
 
   char amr0[64];
   snprintf(amr0, 64, "%s_0", euler_mixture_output);
-  euler_write_sol_block(amr0, num_blocks, mesh_bdata);
+  euler_write_sol_block(amr0, num_blocks, mesh_bdata, decomp);
 
   double coarse_t_curr = 0.0;
   double intermediate_t_curr = 0.0;
   double fine_t_curr = 0.0;
-  double coarse_dt = euler_max_dt_block(num_blocks, mesh_bdata);
+  double coarse_dt = euler_max_dt_block(num_blocks, mesh_bdata, decomp);
 
   double intermediate_dt = (1.0 / ref_factor1) * coarse_dt;
   double fine_dt = (1.0 / (ref_factor1 * ref_factor2)) * coarse_dt;
@@ -844,22 +899,32 @@ euler_mixture2d_run_double(int argc, char **argv, struct euler_mixture2d_double_
   int num_failures = 0;
 
   while ((coarse_t_curr < t_end) && (coarse_step <= num_steps)) {
-    printf("Taking coarse (level 0) time-step %ld at t = %g; ", coarse_step, coarse_t_curr);
-    struct gkyl_update_status coarse_status = euler_update_block(mesh_job_pool, btopo, mesh_bdata, coarse_t_curr, coarse_dt, &stats);
-    printf(" dt = %g\n", coarse_status.dt_actual);
+    if (my_rank == 0) {
+      printf("Taking coarse (level 0) time-step %ld at t = %g; ", coarse_step, coarse_t_curr);
+    }
+    struct gkyl_update_status coarse_status = euler_update_block(mesh_job_pool, btopo, mesh_bdata, decomp, coarse_t_curr, coarse_dt, &stats);
+    if (my_rank == 0) {
+      printf(" dt = %g\n", coarse_status.dt_actual);
+    }
 
     if (!coarse_status.success) {
-      printf("** Update method failed! Aborting simulation ....\n");
+      if (my_rank == 0) {
+        printf("** Update method failed! Aborting simulation ....\n");
+      }
       break;
     }
 
     for (long intermediate_step = 1; intermediate_step < ref_factor1 + 1; intermediate_step++) {
-      printf("   Taking intermediate (level 1) time-step %ld at t = %g", intermediate_step, intermediate_t_curr);
-      printf(" dt = %g\n", (1.0 / ref_factor1) * coarse_status.dt_actual);
+      if (my_rank == 0) {
+        printf("   Taking intermediate (level 1) time-step %ld at t = %g", intermediate_step, intermediate_t_curr);
+        printf(" dt = %g\n", (1.0 / ref_factor1) * coarse_status.dt_actual);
+      }
 
       for (long fine_step = 1; fine_step < ref_factor2 + 1; fine_step++) {
-        printf("      Taking fine (level 2) time-step %ld at t = %g", fine_step, fine_t_curr);
-        printf(" dt = %g\n", (1.0 / (ref_factor1 * ref_factor2)) * coarse_status.dt_actual);
+        if (my_rank == 0) {
+          printf("      Taking fine (level 2) time-step %ld at t = %g", fine_step, fine_t_curr);
+          printf(" dt = %g\n", (1.0 / (ref_factor1 * ref_factor2)) * coarse_status.dt_actual);
+        }
 
         fine_t_curr += (1.0 / (ref_factor1 * ref_factor2)) * coarse_status.dt_actual;
         fine_dt = (1.0 / (ref_factor1 * ref_factor2)) * coarse_status.dt_suggested;
@@ -874,7 +939,7 @@ euler_mixture2d_run_double(int argc, char **argv, struct euler_mixture2d_double_
         char buf[64];
         snprintf(buf, 64, "%s_%d", euler_mixture_output, i);
 
-        euler_write_sol_block(buf, num_blocks, mesh_bdata);
+        euler_write_sol_block(buf, num_blocks, mesh_bdata, decomp);
       }
     }
 
@@ -887,12 +952,16 @@ euler_mixture2d_run_double(int argc, char **argv, struct euler_mixture2d_double_
     else if (coarse_status.dt_actual < dt_failure_tol * dt_init) {
       num_failures += 1;
 
-      printf("WARNING: Time-step dt = %g", coarse_status.dt_actual);
-      printf(" is below %g*dt_init ...", dt_failure_tol);
-      printf(" num_failures = %d\n", num_failures);
+      if (my_rank == 0) {
+        printf("WARNING: Time-step dt = %g", coarse_status.dt_actual);
+        printf(" is below %g*dt_init ...", dt_failure_tol);
+        printf(" num_failures = %d\n", num_failures);
+      }
       if (num_failures >= num_failures_max) {
-        printf("ERROR: Time-step was below %g*dt_init ", dt_failure_tol);
-        printf("%d consecutive times. Aborting simulation ....\n", num_failures_max);
+        if (my_rank == 0) {
+          printf("ERROR: Time-step was below %g*dt_init ", dt_failure_tol);
+          printf("%d consecutive times. Aborting simulation ....\n", num_failures_max);
+        }
         break;
       }
     }
@@ -908,14 +977,20 @@ euler_mixture2d_run_double(int argc, char **argv, struct euler_mixture2d_double_
   char buf[64];
   snprintf(buf, 64, "%s_%d", euler_mixture_output, num_frames);
 
-  euler_write_sol_block(buf, num_blocks, mesh_bdata);
+  euler_write_sol_block(buf, num_blocks, mesh_bdata, decomp);
 
-  printf("\n");
-  printf("Number of update calls %ld\n", (coarse_step - 1));
-  printf("Number of failed time-steps %d\n", stats.nfail);
-  printf("Total updates took %g secs\n", tm_total_sec);
+  if (my_rank == 0) {
+    printf("\n");
+    printf("Number of update calls %ld\n", (coarse_step - 1));
+    printf("Number of failed time-steps %d\n", stats.nfail);
+    printf("Total updates took %g secs\n", tm_total_sec);
+  }
 
   for (int i = 0; i < num_blocks; i++) {
+    if (!block_decomp_is_local(decomp, i)) {
+      continue;
+    }
+
     gkyl_fv_proj_release(mesh_bdata[i].fv_proj);
     gkyl_wv_eqn_release(mesh_bdata[i].euler);
     euler_block_bc_updaters_release(&mesh_bdata[i]);
@@ -932,6 +1007,17 @@ euler_mixture2d_run_double(int argc, char **argv, struct euler_mixture2d_double_
     }
   }
 
+  block_decomp_release(decomp);
+  gkyl_free(mesh_bdata);
+
   gkyl_block_topo_release(btopo);
+  block_layout_release(layout);
   gkyl_job_pool_release(mesh_job_pool);
+  gkyl_comm_release(comm);
+
+#ifdef GKYL_HAVE_MPI
+  if (app_args.use_mpi) {
+    MPI_Finalize();
+  }
+#endif
 }
\ No newline at end of file
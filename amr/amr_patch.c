@@ -38,6 +38,8 @@ euler_patch_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct euler_patch_d
   }
 
   pdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 5, buff_sz);
+
+  euler_patch_reflux_init(pdata);
 }
 
 void
@@ -70,6 +72,8 @@ euler_nested_patch_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct euler_
   }
 
   pdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 5, buff_sz);
+
+  euler_patch_reflux_init(pdata);
 }
 
 void
@@ -102,6 +106,8 @@ gr_euler_patch_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct euler_patc
   }
 
   pdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 29, buff_sz);
+
+  euler_patch_reflux_init(pdata);
 }
 
 void
@@ -134,6 +140,8 @@ gr_euler_nested_patch_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct eul
   }
 
   pdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 29, buff_sz);
+
+  euler_patch_reflux_init(pdata);
 }
 
 void
@@ -169,6 +177,8 @@ euler_mixture_patch_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct euler
   }
 
   pdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 4 + (2 * num_species), buff_sz);
+
+  euler_patch_reflux_init(pdata);
 }
 
 void
@@ -204,6 +214,26 @@ euler_mixture_nested_patch_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struc
   }
 
   pdata->bc_buffer = gkyl_array_new(GKYL_DOUBLE, 4 + (2 * num_species), buff_sz);
+
+  euler_patch_reflux_init(pdata);
+}
+
+void
+euler_patch_reflux_init(struct euler_patch_data* pdata)
+{
+  int meqn = pdata->euler->num_equations;
+
+  // The flux register and the solution at the start of the time-step are combined with the solution itself, which may carry
+  // more components than there are equations (as for the general relativistic Euler equations): size them like the boundary
+  // condition buffer, which holds the whole solution.
+  int ncomp = pdata->bc_buffer->ncomp;
+
+  pdata->bfluct = gkyl_array_new(GKYL_DOUBLE, 2 * meqn, pdata->ext_range.volume);
+  pdata->flux_reg = gkyl_array_new(GKYL_DOUBLE, ncomp, pdata->ext_range.volume);
+  gkyl_array_clear(pdata->flux_reg, 0.0);
+  pdata->fstart = gkyl_array_new(GKYL_DOUBLE, ncomp, pdata->ext_range.volume);
+
+  gkyl_wave_prop_set_boundary_fluct(pdata->slvr[0], pdata->bfluct);
 }
 
 void
@@ -218,6 +248,9 @@ euler_patch_bc_updaters_release(struct euler_patch_data* pdata)
   }
 
   gkyl_array_release(pdata->bc_buffer);
+  gkyl_array_release(pdata->bfluct);
+  gkyl_array_release(pdata->flux_reg);
+  gkyl_array_release(pdata->fstart);
 }
 
 void
@@ -432,18 +465,32 @@ patch_uu_restriction_op(const int tbid, const int tdir, const int i, const int d
   }
 }
 
+static void
+patch_src_to_buffer(void* data, const struct block_sync_src* src, const struct gkyl_range* skin)
+{
+  if (src->fold) {
+    gkyl_array_set_range(src->scratch, 1.0 - src->alpha, src->fold, skin);
+    gkyl_array_accumulate_range(src->scratch, src->alpha, src->fnew, skin);
+    gkyl_array_copy_to_buffer(data, src->scratch, skin);
+  }
+  else {
+    gkyl_array_copy_to_buffer(data, src->fnew, skin);
+  }
+}
+
 void
-euler_sync_patches(const struct gkyl_block_topo* ptopo, const struct euler_patch_data pdata[], struct gkyl_array* fld[])
+euler_sync_patches_src(const struct gkyl_block_topo* ptopo, const struct euler_patch_data pdata[], const struct block_sync_src src[],
+  struct gkyl_array* fld[], const bool is_target[])
 {
   int num_patches = ptopo->num_blocks;
 
   for (int i = 0; i < num_patches; i++) {
     const struct gkyl_target_edge *te = ptopo->conn[i].connections[0];
 
-    if (te[0].edge != GKYL_PHYSICAL) {
+    if (te[0].edge != GKYL_PHYSICAL && (!is_target || is_target[te[0].bid])) {
       struct gkyl_array *bc_buffer = pdata[i].bc_buffer;
       
-      gkyl_array_copy_to_buffer(bc_buffer->data, fld[i], &(pdata[i].skin_ghost.lower_skin[0]));
+      patch_src_to_buffer(bc_buffer->data, &src[i], &(pdata[i].skin_ghost.lower_skin[0]));
 
       int tbid = te[0].bid;
       int tdir = te[0].dir;
@@ -472,10 +519,10 @@ euler_sync_patches(const struct gkyl_block_topo* ptopo, const struct euler_patch
       }
     }
 
-    if (te[1].edge != GKYL_PHYSICAL) {
+    if (te[1].edge != GKYL_PHYSICAL && (!is_target || is_target[te[1].bid])) {
       struct gkyl_array *bc_buffer = pdata[i].bc_buffer;
 
-      gkyl_array_copy_to_buffer(bc_buffer->data, fld[i], &(pdata[i].skin_ghost.upper_skin[0]));
+      patch_src_to_buffer(bc_buffer->data, &src[i], &(pdata[i].skin_ghost.upper_skin[0]));
 
       int tbid = te[1].bid;
       int tdir = te[1].dir;
@@ -506,6 +553,22 @@ euler_sync_patches(const struct gkyl_block_topo* ptopo, const struct euler_patch
   }
 }
 
+void
+euler_sync_patches(const struct gkyl_block_topo* ptopo, const struct euler_patch_data pdata[], struct gkyl_array* fld[])
+{
+  int num_patches = ptopo->num_blocks;
+
+  struct block_sync_src src[num_patches];
+  for (int i = 0; i < num_patches; i++) {
+    src[i] = (struct block_sync_src) {
+      .fnew = fld[i],
+      .alpha = 1.0,
+    };
+  }
+
+  euler_sync_patches_src(ptopo, pdata, src, fld, 0);
+}
+
 void
 euler_patch_data_write(const char* file_nm, const struct euler_patch_data* pdata)
 {
@@ -537,52 +600,292 @@ euler_update_patch_job_func(void* ctx)
   euler_patch_bc_updaters_apply(pdata, t_curr, pdata->f[d + 1]);
 }
 
-struct gkyl_update_status
-euler_update_all_patches(const struct gkyl_job_pool* job_pool, const struct gkyl_block_topo* ptopo,
-  const struct euler_patch_data pdata[], double t_curr, double dt)
+int
+euler_patch_nsub(int num_patches, const struct euler_patch_data pdata[], int nsub[])
 {
-  int num_patches = ptopo->num_blocks;
-  double dt_suggested = DBL_MAX;
+  double h_max = 0.0;
 
-  struct euler_update_patch_ctx euler_patch_ctx[num_patches];
+  for (int i = 0; i < num_patches; i++) {
+    h_max = fmax(h_max, pdata[i].grid.dx[0]);
+  }
 
+  int nsub_cfl[num_patches];
   for (int i = 0; i < num_patches; i++) {
-    euler_patch_ctx[i] = (struct euler_update_patch_ctx) {
-      .pdata = &pdata[i],
-      .t_curr = t_curr,
-      .dir = 0,
-      .dt = dt,
-      .pidx = i,
-    };
+    nsub_cfl[i] = (int) floor((h_max / pdata[i].grid.dx[0]) * (1.0 + 1.0e-8));
+    nsub[i] = 1;
+  }
+
+  // Round the counts down, from the smallest up, so that each one is a multiple of the next smaller one.
+  int prev = 1, prev_cfl = 1;
+
+  while (true) {
+    int next_cfl = INT_MAX;
+    for (int i = 0; i < num_patches; i++) {
+      if (nsub_cfl[i] > prev_cfl && nsub_cfl[i] < next_cfl) {
+        next_cfl = nsub_cfl[i];
+      }
+    }
+
+    if (next_cfl == INT_MAX) {
+      break;
+    }
+
+    int next = prev * (next_cfl / prev);
+    for (int i = 0; i < num_patches; i++) {
+      if (nsub_cfl[i] == next_cfl) {
+        nsub[i] = next;
+      }
+    }
+
+    prev = next;
+    prev_cfl = next_cfl;
   }
 
+  return prev;
+}
+
+// Flux jump F(q) - F(ref), in the global frame.
+static void
+patch_flux_jump(const struct gkyl_wv_eqn* eqn, const struct gkyl_wave_geom* geom, const int* idx,
+  const double* ref, const double* q, double* jump)
+{
+  int meqn = eqn->num_equations;
+  double ref_local[meqn], q_local[meqn], jump_local[meqn];
+
+  const struct gkyl_wave_cell_geom *cg = gkyl_wave_geom_get(geom, idx);
+
+  gkyl_wv_eqn_rotate_to_local(eqn, cg->tau1[0], cg->tau2[0], cg->norm[0], ref, ref_local);
+  gkyl_wv_eqn_rotate_to_local(eqn, cg->tau1[0], cg->tau2[0], cg->norm[0], q, q_local);
+  gkyl_wv_eqn_flux_jump(eqn, ref_local, q_local, jump_local);
+  gkyl_wv_eqn_rotate_to_global(eqn, cg->tau1[0], cg->tau2[0], cg->norm[0], jump_local, jump);
+}
+
+void
+euler_patch_reflux_accumulate(const struct gkyl_block_topo* ptopo, const struct euler_patch_data pdata[], const bool active[],
+  const double dt_patch[])
+{
+  int num_patches = ptopo->num_blocks;
+
+  // The flux through a face, as seen from a cell with outward normal sign sigma on that face, is F(q) + sigma * R, where R is the
+  // fluctuation through the face stored by the wave-propagation updater. F(q) is taken relative to the coarse cell's solution at
+  // the start of the coarse time-step, which cancels from the correction.
+  for (int i = 0; i < num_patches; i++) {
+    if (!active[i]) {
+      continue;
+    }
+
+    const struct euler_patch_data *pi = &pdata[i];
+    int meqn = pi->euler->num_equations;
+
+    for (int e = 0; e < 2; e++) {
+      const struct gkyl_target_edge *te = &ptopo->conn[i].connections[0][e];
+
+      if (te->edge == GKYL_PHYSICAL) {
+        continue;
+      }
+
+      const struct euler_patch_data *pj = &pdata[te->bid];
+      bool is_coarse = dt_patch[i] > dt_patch[te->bid] * (1.0 + 1.0e-8);
+      bool is_fine = dt_patch[te->bid] > dt_patch[i] * (1.0 + 1.0e-8);
+
+      if (!is_coarse && !is_fine) {
+        continue;
+      }
+
+      double sigma = (e == 0) ? -1.0 : 1.0;
+      int idx[1] = { (e == 0) ? pi->range.lower[0] : pi->range.upper[0] };
+
+      long loc = gkyl_range_idx(&pi->range, idx);
+      const double *q = gkyl_array_cfetch(pi->f[0], loc);
+      const double *r = (const double*) gkyl_array_cfetch(pi->bfluct, loc) + (e == 0 ? 0 : meqn);
+
+      double jump[meqn];
+
+      if (is_coarse) {
+        // Coarse side: this patch's own flux.
+        const double *ref = gkyl_array_cfetch(pi->fdup, loc);
+        patch_flux_jump(pi->euler, pi->geom, idx, ref, q, jump);
+
+        double *reg = gkyl_array_fetch(pi->flux_reg, loc);
+        double fact = sigma * dt_patch[i] / pi->grid.dx[0];
+        for (int m = 0; m < meqn; m++) {
+          reg[m] += fact * (jump[m] + sigma * r[m]);
+        }
+      }
+      else {
+        // Fine side: this face is the face of the coarse cell across it.
+        double xc[1];
+        gkyl_rect_grid_cell_center(&pi->grid, idx, xc);
+        xc[0] += sigma * 0.5 * (pi->grid.dx[0] + pj->grid.dx[0]);
+
+        int cidx[1];
+        gkyl_rect_grid_coord_idx(&pj->grid, xc, cidx);
+        if (!gkyl_range_contains_idx(&pj->range, cidx)) {
+          continue;
+        }
+
+        long cloc = gkyl_range_idx(&pj->range, cidx);
+        const double *ref = gkyl_array_cfetch(pj->fdup, cloc);
+        patch_flux_jump(pi->euler, pi->geom, idx, ref, q, jump);
+
+        double *reg = gkyl_array_fetch(pj->flux_reg, cloc);
+        double fact = sigma * dt_patch[i] / pj->grid.dx[0];
+        for (int m = 0; m < meqn; m++) {
+          reg[m] += fact * (jump[m] + sigma * r[m]);
+        }
+      }
+    }
+  }
+}
+
+// Run job func on the active patches, using the thread-based job pool if enabled.
+static void
+patch_run_jobs(const struct gkyl_job_pool* job_pool, int num_patches, const bool active[], void (*func)(void* ctx),
+  void* ctx, size_t ctx_sz)
+{
 #ifdef AMR_USETHREADS
   for (int i = 0; i < num_patches; i++) {
-    gkyl_job_pool_add_work(job_pool, euler_update_patch_job_func, &euler_patch_ctx[i]);
+    if (active[i]) {
+      gkyl_job_pool_add_work(job_pool, func, (char*) ctx + i * ctx_sz);
+    }
   }
   gkyl_job_pool_wait(job_pool);
 #else
   for (int i = 0; i < num_patches; i++) {
-    euler_update_patch_job_func(&euler_patch_ctx[i]);
+    if (active[i]) {
+      func((char*) ctx + i * ctx_sz);
+    }
   }
 #endif
-  
-  struct gkyl_array *fld[num_patches];
+}
+
+struct gkyl_update_status
+euler_update_all_patches(const struct gkyl_job_pool* job_pool, const struct gkyl_block_topo* ptopo,
+  const struct euler_patch_data pdata[], double t_curr, double dt)
+{
+  int num_patches = ptopo->num_blocks;
+  double dt_suggested = DBL_MAX;
 
+  int nsub[num_patches];
+  int nmax = euler_patch_nsub(num_patches, pdata, nsub);
+
+  double dt_patch[num_patches];
   for (int i = 0; i < num_patches; i++) {
-    if (euler_patch_ctx[i].stat.success == false) {
-      return (struct gkyl_update_status) {
-        .success = false,
-        .dt_suggested = euler_patch_ctx[i].stat.dt_suggested,
-      };
+    dt_patch[i] = dt / nsub[i];
+    gkyl_array_clear(pdata[i].flux_reg, 0.0);
+  }
+
+  struct euler_update_patch_ctx euler_patch_ctx[num_patches];
+  struct copy_job_ctx euler_copy_ctx[num_patches];
+  struct block_sync_src src[num_patches];
+  struct gkyl_array *fld[num_patches];
+
+  // Time-steps of all patches start on a grid of nmax micro-steps. At each micro-step, the patches starting a time-step are
+  // advanced from the coarsest to the finest, so coarser neighbors are already at the end of their time-step (and are
+  // interpolated in time) while finer neighbors are still at its start.
+  for (int k = 0; k < nmax; k++) {
+    for (int lev = 1; lev <= nmax; lev++) {
+      bool active[num_patches];
+      bool any_active = false;
+
+      for (int i = 0; i < num_patches; i++) {
+        active[i] = (nsub[i] == lev) && (k % (nmax / lev) == 0);
+        any_active = any_active || active[i];
+      }
+
+      if (!any_active) {
+        continue;
+      }
+
+      double t_lev = t_curr + k * (dt / nmax);
+
+      // Keep the solution at the start of the time-step of patches with finer neighbors, whose ghost data it is interpolated from.
+      bool keep[num_patches];
+      for (int i = 0; i < num_patches; i++) {
+        keep[i] = active[i] && (nsub[i] < nmax);
+        euler_copy_ctx[i] = (struct copy_job_ctx) {
+          .bidx = i,
+          .inp = pdata[i].f[0],
+          .out = pdata[i].fstart,
+        };
+      }
+
+      patch_run_jobs(job_pool, num_patches, keep, copy_job_func, euler_copy_ctx, sizeof euler_copy_ctx[0]);
+
+      for (int j = 0; j < num_patches; j++) {
+        fld[j] = pdata[j].f[0];
+
+        if (nsub[j] >= lev) {
+          src[j] = (struct block_sync_src) { .fnew = pdata[j].f[0], .alpha = 1.0 };
+        }
+        else {
+          // Coarser neighbor, at the end of its time-step of s micro-steps that started on micro-step k_start.
+          int s = nmax / nsub[j];
+          int k_start = (k / s) * s;
+          src[j] = (struct block_sync_src) {
+            .fold = pdata[j].fstart,
+            .fnew = pdata[j].f[0],
+            .alpha = (double) (k - k_start) / s,
+            .scratch = pdata[j].f[1],
+          };
+        }
+
+        if (active[j]) {
+          euler_patch_bc_updaters_apply(&pdata[j], t_lev, pdata[j].f[0]);
+        }
+      }
+
+      euler_sync_patches_src(ptopo, pdata, src, fld, active);
+
+      for (int i = 0; i < num_patches; i++) {
+        euler_patch_ctx[i] = (struct euler_update_patch_ctx) {
+          .pdata = &pdata[i],
+          .t_curr = t_lev,
+          .dir = 0,
+          .dt = dt_patch[i],
+          .pidx = i,
+        };
+      }
+
+      patch_run_jobs(job_pool, num_patches, active, euler_update_patch_job_func, euler_patch_ctx, sizeof euler_patch_ctx[0]);
+
+      for (int i = 0; i < num_patches; i++) {
+        if (!active[i]) {
+          continue;
+        }
+
+        if (euler_patch_ctx[i].stat.success == false) {
+          return (struct gkyl_update_status) {
+            .success = false,
+            .dt_suggested = nsub[i] * euler_patch_ctx[i].stat.dt_suggested,
+          };
+        }
+
+        dt_suggested = fmin(dt_suggested, nsub[i] * euler_patch_ctx[i].stat.dt_suggested);
+      }
+
+      euler_patch_reflux_accumulate(ptopo, pdata, active, dt_patch);
+
+      for (int i = 0; i < num_patches; i++) {
+        euler_copy_ctx[i] = (struct copy_job_ctx) {
+          .bidx = i,
+          .inp = pdata[i].f[1],
+          .out = pdata[i].f[0],
+        };
+      }
+
+      patch_run_jobs(job_pool, num_patches, active, copy_job_func, euler_copy_ctx, sizeof euler_copy_ctx[0]);
     }
 
-    dt_suggested = fmin(dt_suggested, euler_patch_ctx[i].stat.dt_suggested);
-    fld[i] = pdata[i].f[1];
+    // Patches whose time-step ends with this micro-step have all their finer neighbors caught up: correct their fluxes.
+    for (int i = 0; i < num_patches; i++) {
+      if ((k + 1) % (nmax / nsub[i]) == 0) {
+        gkyl_array_accumulate_range(pdata[i].f[0], 1.0, pdata[i].flux_reg, &pdata[i].range);
+        gkyl_array_clear(pdata[i].flux_reg, 0.0);
+      }
+    }
   }
 
-  euler_sync_patches(ptopo, pdata, fld);
-
   return (struct gkyl_update_status) {
     .success = true,
     .dt_suggested = dt_suggested,
@@ -607,7 +910,6 @@ euler_update_patch(const struct gkyl_job_pool* job_pool, const struct gkyl_block
   enum {
     UPDATE_DONE = 0,
     PRE_UPDATE,
-    POST_UPDATE,
     FLUID_UPDATE,
     UPDATE_REDO,
   } state = PRE_UPDATE;
@@ -639,7 +941,7 @@ euler_update_patch(const struct gkyl_job_pool* job_pool, const struct gkyl_block
 #endif
     }
     else if (state == FLUID_UPDATE) {
-      state = POST_UPDATE;
+      state = UPDATE_DONE;
 
       struct gkyl_update_status s = euler_update_all_patches(job_pool, ptopo, pdata, t_curr, dt);
 
@@ -652,28 +954,6 @@ euler_update_patch(const struct gkyl_job_pool* job_pool, const struct gkyl_block
         dt_suggested = fmin(dt_suggested, s.dt_suggested);
       }
     }
-    else if (state == POST_UPDATE) {
-      state = UPDATE_DONE;
-
-      for (int i = 0; i < num_patches; i++) {
-        euler_copy_ctx[i] = (struct copy_job_ctx) {
-          .bidx = i,
-          .inp = pdata[i].f[1],
-          .out = pdata[i].f[0],
-        };
-      }
-
-#ifdef AMR_USETHREADAS
-      for (int i = 0; i < num_patches; i++) {
-        gkyl_job_pool_add_work(job_pool, copy_job_func, &euler_copy_ctx[i]);
-      }
-      gkyl_job_pool_wait(job_pool);
-#else
-      for (int i = 0; i < num_patches; i++) {
-        copy_job_func(&euler_copy_ctx[i]);
-      }
-#endif
-    }
     else if (state == UPDATE_REDO) {
       state = PRE_UPDATE;
 
@@ -723,13 +1003,39 @@ euler_max_dt_patch(int num_patches, const struct euler_patch_data pdata[])
 {
   double dt = DBL_MAX;
 
+  int nsub[num_patches];
+  euler_patch_nsub(num_patches, pdata, nsub);
+
   for (int i = 0; i < num_patches; i++) {
-    dt = fmin(dt, euler_patch_data_max_dt(&pdata[i]));
+    dt = fmin(dt, nsub[i] * euler_patch_data_max_dt(&pdata[i]));
   }
 
   return dt;
 }
 
+void
+euler_patch_integrate(int num_patches, const struct euler_patch_data pdata[], int meqn, double tot[])
+{
+  for (int m = 0; m < meqn; m++) {
+    tot[m] = 0.0;
+  }
+
+  for (int i = 0; i < num_patches; i++) {
+    const struct euler_patch_data *pi = &pdata[i];
+    double vol = pi->grid.cellVolume;
+
+    struct gkyl_range_iter iter;
+    gkyl_range_iter_init(&iter, &pi->range);
+
+    while (gkyl_range_iter_next(&iter)) {
+      const double *q = gkyl_array_cfetch(pi->f[0], gkyl_range_idx(&pi->range, iter.idx));
+      for (int m = 0; m < meqn; m++) {
+        tot[m] += vol * q[m];
+      }
+    }
+  }
+}
+
 struct gkyl_block_topo*
 create_patch_topo()
 {
@@ -2,8 +2,10 @@
 
 #include <assert.h>
 #include <float.h>
+#include <limits.h>
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
@@ -12,9 +14,11 @@
 #include <gkyl_array_ops.h>
 #include <gkyl_array_rio.h>
 #include <gkyl_block_topo.h>
+#include <gkyl_comm.h>
 #include <gkyl_fv_proj.h>
 #include <gkyl_moment.h>
 #include <gkyl_moment_em_coupling.h>
+#include <gkyl_null_comm.h>
 #include <gkyl_null_pool.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_decomp.h>
@@ -33,6 +37,11 @@
 
 #include <thpool.h>
 
+#ifdef GKYL_HAVE_MPI
+#include <mpi.h>
+#include <gkyl_mpi_comm.h>
+#endif
+
 #define AMR_USETHREADS
 
 // Definitions of private structs and APIs attached to these objects, for use in the block AMR subsystem.
@@ -67,6 +76,10 @@ struct euler_block_data {
   struct gkyl_wv_apply_bc *lower_bc[2];
   struct gkyl_wv_apply_bc *upper_bc[2];
 
+  struct gkyl_array *bfluct; // fluctuations through the block boundary, stored by the wave-propagation updaters
+  struct gkyl_array *flux_reg; // flux corrections accumulated at coarse-fine interfaces
+  struct gkyl_array *fstart; // solution at the start of the current (subcycled) time-step, for the ghost data of finer neighbors
+
   bool copy_x;
   bool copy_y;
   
@@ -74,6 +87,47 @@ struct euler_block_data {
   bool wall_y;
 };
 
+// Source data for filling inter-block ghost cells: skin cells are taken from fnew or, if fold is set, from
+// (1 - alpha) * fold + alpha * fnew, computed in the skin cells of scratch.
+struct block_sync_src {
+  const struct gkyl_array *fold;
+  const struct gkyl_array *fnew;
+  double alpha;
+  struct gkyl_array *scratch;
+};
+
+// Distribution of the blocks across the ranks of a communicator. Every rank holds the grids and ranges of all blocks, but the
+// arrays and updaters of a block only exist on the rank that owns it. Data needed across an edge between blocks owned by different
+// ranks is exchanged through the communicator, in buffers indexed by the edge (block, direction, lower/upper) of the block it comes
+// from: the skin cells of the block and, if the block is on the coarse side of the edge for refluxing, its solution at the start of
+// the time-step and the flux corrections from the fine side, over the layer of cells along the edge.
+struct block_decomp {
+  struct gkyl_comm *comm;
+  int rank;
+  int num_blocks;
+  int ndim;
+  int *owner; // rank owning each block
+  double max_speedup; // bound on the parallel speedup of the partition: total cost over the largest cost owned by a rank
+
+  struct gkyl_range *layer; // layer of cells along each edge (indexed from the start of the layer)
+  struct gkyl_array **skin_buff; // skin data of each edge with a remote neighbor (0 for other edges)
+  struct gkyl_array **fdup_buff; // solution at the start of the time-step over the layer of each edge with a remote neighbor
+  struct gkyl_array **reg_buff; // flux corrections over the layer of each edge with a remote neighbor
+  struct gkyl_comm_state **state; // state of the pending send or receive for each edge with a remote neighbor
+};
+
+// Tensor-product layout of the blocks of a block hierarchy in 2D: the domain is cut into columns (along x) and rows (along y) of
+// blocks, each of which is at some level of refinement. Blocks are numbered from the finest level to the coarsest, each level in
+// rows from the top of the domain down and from left to right within a row, so that the nested layouts of block_layout_nested_new
+// with two and three levels are numbered as in create_block_topo and create_nested_block_topo.
+struct block_layout {
+  int num_cuts[2]; // number of columns (d = 0) and rows (d = 1) of blocks
+  double *edges[2]; // edges of the columns and rows (num_cuts[d] + 1 in each direction)
+  int *cells[2]; // number of coarse cells across each column and row
+  int *level; // level of refinement of the block in column i and row j (at i + num_cuts[0] * j)
+  int *bid; // index of the block in column i and row j (at i + num_cuts[0] * j)
+};
+
 // Job pool information context for updating block-structured data for the Euler equations using threads.
 struct euler_update_block_ctx {
   const struct euler_block_data *bdata;
@@ -105,6 +159,53 @@ struct sim_stats {
 */
 void skin_ghost_ranges_init_block(struct skin_ghost_ranges_block* sgr, const struct gkyl_range* parent, const int* ghost);
 
+/**
+* Create the communicator across which the blocks of the block AMR hierarchy are distributed: MPI_COMM_WORLD if use_mpi is set
+* (and MPI is available), or a single rank otherwise.
+*
+* @param use_mpi Whether to use MPI.
+* @return New communicator.
+*/
+struct gkyl_comm* block_comm_new(bool use_mpi);
+
+/**
+* Distribute the blocks of the block AMR hierarchy across the ranks of a communicator, balancing the number of cell updates per
+* coarse time-step (cells times subcycled time-steps) of the blocks on each rank. The grids, ranges and skin/ghost ranges of all
+* blocks must be set.
+*
+* @param comm Communicator.
+* @param btopo Topology/connectivity information for the entire block hierarchy.
+* @param bdata Array of block-structured data for the Euler equations.
+* @param meqn Number of equations.
+* @return New block decomposition.
+*/
+struct block_decomp* block_decomp_new(struct gkyl_comm* comm, const struct gkyl_block_topo* btopo, const struct euler_block_data bdata[],
+  int meqn);
+
+/**
+* Check whether a block is stored and updated on this rank.
+*
+* @param decomp Block decomposition (NULL if all blocks are on this rank).
+* @param bid Block ID.
+* @return Whether the block is owned by this rank.
+*/
+bool block_decomp_is_local(const struct block_decomp* decomp, int bid);
+
+/**
+* Report (on rank 0, when there are several ranks) the number of blocks and the bound on the parallel speedup of a block
+* decomposition.
+*
+* @param decomp Block decomposition.
+*/
+void block_decomp_report_partition(const struct block_decomp* decomp);
+
+/**
+* Free a block decomposition.
+*
+* @param decomp Block decomposition to free.
+*/
+void block_decomp_release(struct block_decomp* decomp);
+
 /**
 * Boundary condition function for applying wall boundary conditions for the Euler equations.
 *
@@ -231,6 +332,15 @@ void euler_mixture_block_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct
 */
 void euler_mixture_nested_block_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct euler_block_data* bdata, const struct gkyl_block_connections* conn);
 
+/**
+* Initialize the arrays used for flux correction (refluxing) at coarse-fine interfaces for the Euler equations, and have the
+* wave-propagation updaters store the fluctuations through the block boundary. Called by the block AMR boundary condition
+* initializers once the boundary condition buffer is allocated; the arrays are freed by euler_block_bc_updaters_release.
+*
+* @param bdata Block-structured data for the Euler equations.
+*/
+void euler_block_reflux_init(struct euler_block_data* bdata);
+
 /**
 * Release block AMR updaters for both physical (outer-block) and non-physical (inter-block) boundary conditions for the Euler equations.
 *
@@ -369,6 +479,49 @@ void block_uu_restriction_op(const int tbid, const int tdir, const int i, const
 */
 void euler_sync_blocks(const struct gkyl_block_topo* btopo, const struct euler_block_data bdata[], struct gkyl_array* fld[]);
 
+/**
+* Synchronize the blocks in the block AMR hierarchy for the Euler equations, taking the skin data of each block from src and
+* only filling ghost cells of the target blocks. Ghost cells of local blocks whose neighbors are remote are filled through the
+* communicator of decomp.
+*
+* @param btopo Topology/connectivity information for the entire block hierarchy.
+* @param bdata Block-structured data for the Euler equations.
+* @param decomp Block decomposition (NULL if all blocks are local).
+* @param src Skin data to use for each block.
+* @param fld Output array.
+* @param is_target Flags for blocks whose ghost cells are filled (NULL for all blocks).
+*/
+void euler_sync_blocks_src(const struct gkyl_block_topo* btopo, const struct euler_block_data bdata[], const struct block_decomp* decomp,
+  const struct block_sync_src src[], struct gkyl_array* fld[], const bool is_target[]);
+
+/**
+* Compute the number of time-steps each block takes per coarse time-step, from the ratio of the coarsest cell size to the
+* cell size of each block. The counts are nested, i.e. each count divides every larger one.
+*
+* @param num_blocks Number of blocks in the block hierarchy.
+* @param bdata Array of block-structured data for the Euler equations.
+* @param nsub On output, number of time-steps for each block.
+* @return Largest number of time-steps.
+*/
+int euler_block_nsub(int num_blocks, const struct euler_block_data bdata[], int nsub[]);
+
+/**
+* Accumulate the flux corrections at coarse-fine interfaces from a sweep along direction d of the active blocks. Coarse blocks
+* (those with the larger faces and a time-step at least as long, or matching faces and the longer time-step) get the difference
+* between the fine fluxes, summed over the fine faces and time-steps, and their own flux. Interfaces where the block with the larger
+* faces has the shorter time-step are not corrected. Corrections from local fine blocks to remote coarse blocks go into the
+* reflux buffers of decomp.
+*
+* @param btopo Topology/connectivity information for the entire block hierarchy.
+* @param bdata Block-structured data for the Euler equations.
+* @param decomp Block decomposition (NULL if all blocks are local).
+* @param active Flags for blocks that have just been swept.
+* @param d Direction of the sweep.
+* @param dt_blk Time-step of each block.
+*/
+void euler_block_reflux_accumulate(const struct gkyl_block_topo* btopo, const struct euler_block_data bdata[],
+  const struct block_decomp* decomp, const bool active[], int d, const double dt_blk[]);
+
 /**
 * Write block-structured AMR simulation data for the Euler equations onto disk.
 *
@@ -393,17 +546,22 @@ double euler_block_data_max_dt(const struct euler_block_data* bdata);
 void euler_update_block_job_func(void* ctx);
 
 /**
-* Update all blocks in the block AMR hierarchy by using the thread-based job pool for the Euler equations.
+* Update all blocks in the block AMR hierarchy by using the thread-based job pool for the Euler equations. Blocks are subcycled
+* in time: block i takes nsub[i] time-steps of dt/nsub[i] (see euler_block_nsub), with ghost cells from coarser blocks
+* interpolated in time and fluxes at coarse-fine interfaces corrected to keep the update conservative. The updated solution
+* is in f[0]; bdata[i].fdup must hold the solution at t_curr. Only the local blocks are updated; the status is reduced across
+* the ranks of decomp.
 *
 * @param job_pool Job pool for updating block-structured data for the Euler equations using threads.
 * @param btopo Topology/connectivity information for the entire block hierarchy.
 * @param bdata Block-structured data for the Euler equations.
+* @param decomp Block decomposition (NULL if all blocks are local).
 * @param t_curr Current simulation time.
-* @param dt Current stable time-step for the simulation.
-* @return Status of the update (success and suggested time-step).
+* @param dt Current stable (coarse) time-step for the simulation.
+* @return Status of the update (success and suggested coarse time-step).
 */
 struct gkyl_update_status euler_update_all_blocks(const struct gkyl_job_pool* job_pool, const struct gkyl_block_topo* btopo,
-  const struct euler_block_data bdata[], double t_curr, double dt);
+  const struct euler_block_data bdata[], const struct block_decomp* decomp, double t_curr, double dt);
 
 /**
 * Initialize a new job in the thread-based job pool for updating the block-structured AMR simulation data for the Euler equations.
@@ -425,31 +583,182 @@ void copy_job_func(void* ctx);
 * @param job_pool Job pool for updating block-structured data for the Euler equations using threads.
 * @param btopo Topology/connectivity information for the entire block hierarchy.
 * @param bdata Block-structured data for the Euler equations.
+* @param decomp Block decomposition (NULL if all blocks are local).
 * @param t_curr Current simulation time.
 * @param dt0 Initial guess for the maximum stable time-step.
 * @param stats Simulation statistics (allowing for tracking of the number of failed time-steps).
 * @return Status of the update (success, suggested time-step and actual time-step).
 */
 struct gkyl_update_status euler_update_block(const struct gkyl_job_pool* job_pool, const struct gkyl_block_topo* btopo,
-  const struct euler_block_data bdata[], double t_curr, double dt0, struct sim_stats* stats);
+  const struct euler_block_data bdata[], const struct block_decomp* decomp, double t_curr, double dt0, struct sim_stats* stats);
 
 /**
-* Write the complete simulation output for the entire block AMR hierarchy for the Euler equations onto disk.
+* Write the complete simulation output for the entire block AMR hierarchy for the Euler equations onto disk. Each rank writes
+* the blocks it owns.
 *
 * @param fbase Base file name schema to use for the simulation output.
 * @param num_blocks Number of blocks in the block hierarchy.
 * @param bdata Array of block-structured data for the Euler equations.
+* @param decomp Block decomposition (NULL if all blocks are local).
 */
-void euler_write_sol_block(const char* fbase, int num_blocks, const struct euler_block_data bdata[]);
+void euler_write_sol_block(const char* fbase, int num_blocks, const struct euler_block_data bdata[], const struct block_decomp* decomp);
 
 /**
-* Calculate the maximum stable time-step across all blocks in the block AMR hierarchy for the Euler equations.
+* Calculate the maximum stable (coarse) time-step across all blocks in the block AMR hierarchy for the Euler equations, allowing
+* for the subcycling of finer blocks.
 *
 * @param num_blocks Number of blocks in the block hierarchy.
 * @param bdata Array of block-structured data for the Euler equations.
+* @param decomp Block decomposition (NULL if all blocks are local).
 * @return Maximum stable time-step.
 */
-double euler_max_dt_block(int num_blocks, const struct euler_block_data bdata[]);
+double euler_max_dt_block(int num_blocks, const struct euler_block_data bdata[], const struct block_decomp* decomp);
+
+/**
+* Cluster the cells flagged for refinement in the block AMR hierarchy for the Euler equations into boxes, on a lattice of
+* lattice[0] x lattice[1] cells over the domain. Cells are flagged where the relative jump in mass density to a neighboring cell,
+* scaled to the lattice spacing, exceeds thresh. The flags are padded by buffer lattice cells and gathered onto tiles of min_cells
+* x min_cells lattice cells, clamped to at least one tile away from the domain boundary, so that the edges of the boxes are on
+* the lattice and every gap between them, or between them and the boundary, is at least min_cells lattice cells wide. The tiles
+* are then clustered as in Berger and Rigoutsos (1991): starting from the bounding box of the flagged tiles, a box in which the
+* fraction of flagged tiles is below efficiency is split at a hole in its signature (the count of flagged tiles across each slice)
+* or, failing that, at the strongest inflection point of the signature or, failing that, in half along its longer side, and both
+* halves are shrunk to their flagged tiles. Boxes are split, least efficient first, until all of them reach efficiency or there
+* are max_boxes of them. The boxes do not overlap.
+*
+* @param num_blocks Number of blocks in the block hierarchy.
+* @param bdata Array of block-structured data for the Euler equations.
+* @param decomp Block decomposition (NULL if all blocks are local).
+* @param thresh Threshold on the relative jump in mass density across a lattice cell.
+* @param buffer Number of lattice cells by which to pad the flagged cells.
+* @param min_cells Size, in lattice cells, of the tiles (and so the minimum width of the gaps around the boxes).
+* @param efficiency Minimum fraction of flagged tiles in a box (0 for the bounding box of all flagged tiles).
+* @param max_boxes Maximum number of boxes.
+* @param lower Lower corner of the domain.
+* @param upper Upper corner of the domain.
+* @param lattice Number of lattice cells across the domain in each direction.
+* @param boxes On output, the boxes { x1, y1, x2, y2 } (with room for max_boxes of them).
+* @return Number of boxes (0 if no cells were flagged, or the domain is too small for a box min_cells from its boundary).
+*/
+int euler_block_refined_boxes(int num_blocks, const struct euler_block_data bdata[], const struct block_decomp* decomp,
+  double thresh, int buffer, int min_cells, double efficiency, int max_boxes, const double lower[2], const double upper[2],
+  const int lattice[2], double boxes[][4]);
+
+/**
+* Integrate the solution (in f[0]) over all blocks in the block AMR hierarchy for the Euler equations.
+*
+* @param num_blocks Number of blocks in the block hierarchy.
+* @param bdata Array of block-structured data for the Euler equations.
+* @param decomp Block decomposition (NULL if all blocks are local).
+* @param meqn Number of equations.
+* @param tot On output, integral of each component over the domain (on all ranks).
+*/
+void euler_block_integrate(int num_blocks, const struct euler_block_data bdata[], const struct block_decomp* decomp, int meqn,
+  double tot[]);
+
+/**
+* Transfer the solution (in f[0]) between two block hierarchies covering the same domain. Each target cell gets the average of
+* the source cells, weighted by their overlap with it, so the transfer is conservative: it averages finer source cells and
+* injects coarser ones. Ghost cells of the target are not set. Source blocks overlapping target blocks on other ranks are sent
+* to those ranks.
+*
+* @param num_src Number of blocks in the source hierarchy.
+* @param src Array of source block-structured data for the Euler equations.
+* @param src_decomp Decomposition of the source blocks (NULL if all blocks are local).
+* @param num_tar Number of blocks in the target hierarchy.
+* @param tar Array of target block-structured data for the Euler equations.
+* @param tar_decomp Decomposition of the target blocks (NULL if all blocks are local).
+*/
+void euler_block_transfer(int num_src, const struct euler_block_data src[], const struct block_decomp* src_decomp,
+  int num_tar, const struct euler_block_data tar[], const struct block_decomp* tar_decomp);
+
+/**
+* Create a tensor-product block layout from the edges and coarse cell counts of its columns and rows, and the level of refinement
+* of each block.
+*
+* @param num_cuts Number of columns (x-direction) and rows (y-direction) of blocks.
+* @param edges Edges of the columns and rows (num_cuts[d] + 1 in each direction).
+* @param cells Number of coarse cells across each column and row.
+* @param level Level of refinement of the block in column i and row j (at i + num_cuts[0] * j).
+* @return New block layout.
+*/
+struct block_layout* block_layout_new(const int num_cuts[2], const double* edges[2], const int* cells[2], const int level[]);
+
+/**
+* Create the tensor-product block layout of a mesh with nested refinement patches, in which every block has cells[0] x cells[1]
+* coarse cells: 2 * num_levels - 1 columns and rows of blocks, with the blocks inside patch l - 1 (but not inside patch l) at
+* level l.
+*
+* @param num_levels Number of levels of refinement (including the coarsest).
+* @param lower Lower corner of the domain.
+* @param upper Upper corner of the domain.
+* @param patch Nested refinement patches { x1, y1, x2, y2 } of levels 1 to num_levels - 1.
+* @param cells Number of coarse cells across every block.
+* @return New block layout.
+*/
+struct block_layout* block_layout_nested_new(int num_levels, const double lower[2], const double upper[2], const double patch[][4],
+  const int cells[2]);
+
+/**
+* Create the tensor-product block layout of a lattice of lattice[0] x lattice[1] coarse cells over the domain, refined (to level 1)
+* over a set of non-overlapping boxes with edges on the lattice. The columns and rows are cut at the edges of the boxes.
+*
+* @param lower Lower corner of the domain.
+* @param upper Upper corner of the domain.
+* @param lattice Number of lattice cells across the domain in each direction.
+* @param num_boxes Number of refined boxes.
+* @param boxes Refined boxes { x1, y1, x2, y2 }.
+* @return New block layout.
+*/
+struct block_layout* block_layout_from_boxes(const double lower[2], const double upper[2], const int lattice[2], int num_boxes,
+  const double boxes[][4]);
+
+/**
+* Split the columns and rows of a tensor-product block layout, so that its blocks can be distributed evenly across num_ranks ranks.
+* The cost of a block is its number of cells times its number of time-steps per coarse time-step. While some block costs more than
+* an even share of the total across the ranks, the most expensive one is split along its longer side into sub-blocks of equal
+* width, just enough of them for each to cost no more than that share. Cuts are on the coarse cells, and no column or row is made
+* narrower than min_cells coarse cells. Splitting a column or row splits every block across it. Nothing is split on a single rank.
+*
+* @param layout Block layout.
+* @param level_ref Refinement factor of each level with respect to the coarsest (level_ref[0] = 1).
+* @param min_cells Minimum width, in coarse cells, of the columns and rows.
+* @param num_ranks Number of ranks.
+*/
+void block_layout_balance(struct block_layout* layout, const int level_ref[], int min_cells, int num_ranks);
+
+/**
+* Total number of blocks in a tensor-product block layout.
+*
+* @param layout Block layout.
+* @return Number of blocks.
+*/
+int block_layout_num_blocks(const struct block_layout* layout);
+
+/**
+* Initialize the grid of a block in a tensor-product block layout, with level_ref[l] times the coarse cells at level l.
+*
+* @param layout Block layout.
+* @param bid Index of the block.
+* @param level_ref Refinement factor of each level with respect to the coarsest (level_ref[0] = 1).
+* @param grid On output, grid of the block.
+*/
+void block_layout_block_grid(const struct block_layout* layout, int bid, const int level_ref[], struct gkyl_rect_grid* grid);
+
+/**
+* Set up the topology/connectivity information of the blocks in a tensor-product block layout.
+*
+* @param layout Block layout.
+* @return New block topology.
+*/
+struct gkyl_block_topo* block_layout_topo(const struct block_layout* layout);
+
+/**
+* Release a tensor-product block layout.
+*
+* @param layout Block layout to release.
+*/
+void block_layout_release(struct block_layout* layout);
 
 /**
 * Set up the topology/connectivity information for the block AMR hierarchy for a mesh containing a single refinement patch.
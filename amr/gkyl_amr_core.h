@@ -227,6 +227,8 @@ void euler_mixture1d_run_double(int argc, char **argv, struct euler_mixture1d_do
 struct euler2d_single_init {
   int base_Nx;
   int base_Ny;
+  int lattice_Nx; // Cells of the coarse lattice over the whole domain (x-direction), or 0 for base_Nx cells in every block.
+  int lattice_Ny; // Cells of the coarse lattice over the whole domain (y-direction), or 0 for base_Ny cells in every block.
   int ref_factor;
 
   double coarse_x1;
@@ -257,10 +259,22 @@ struct euler2d_single_init {
   int num_frames;
   double dt_failure_tol;
   int num_failures_max;
+
+  int regrid_interval; // Number of coarse time-steps between regrids (0 for static refinement).
+  double regrid_thresh; // Relative jump in mass density across a coarse cell above which cells are flagged for refinement.
+  int regrid_buffer; // Number of coarse cells by which to pad the flagged region.
+  double regrid_efficiency; // Minimum fraction of flagged cells in each refined box (0 for a single box around all flagged cells).
+  bool check_regrid_conservation; // Abort if total mass or energy changes across a regrid (beyond round-off).
 };
 
 /**
-* Run a 2D simulation using the Euler equations, with static, block-structured mesh refinement with a single refinement patch.
+* Run a 2D simulation using the Euler equations, with block-structured mesh refinement with a single refinement patch. Each block
+* has base_Nx x base_Ny cells (base_Nx * ref_factor x base_Ny * ref_factor for the patch), unless lattice_Nx and lattice_Ny are set:
+* the coarse blocks then share a lattice of lattice_Nx x lattice_Ny cells over the whole domain, and the patch (snapped outwards onto
+* that lattice, and kept at least two coarse cells from the domain boundary) is refined by ref_factor. The patch is static unless
+* regrid_interval is set (which requires the lattice), in which case the flagged cells are clustered into up to four refined boxes
+* every regrid_interval coarse time-steps, and the blocks and their topology are rebuilt around them. When run with MPI (-M), the
+* blocks are distributed across the ranks by cost, and redistributed on each regrid.
 *
 * @param argc Number of command line arguments passed to the function.
 * @param argv Array of command line arguments passed to the function.
@@ -33,6 +33,10 @@ struct euler_patch_data {
 
   struct gkyl_wv_apply_bc *lower_bc[1];
   struct gkyl_wv_apply_bc *upper_bc[1];
+
+  struct gkyl_array *bfluct; // fluctuations through the patch boundary, stored by the wave-propagation updater
+  struct gkyl_array *flux_reg; // flux corrections accumulated at coarse-fine interfaces
+  struct gkyl_array *fstart; // solution at the start of the current (subcycled) time-step, for the ghost data of finer neighbors
 };
 
 // Job pool information context for updating patch-structured data for the Euler equations using threads.
@@ -108,6 +112,15 @@ void euler_mixture_patch_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct
 */
 void euler_mixture_nested_patch_bc_updaters_init(const struct gkyl_wv_eqn* eqn, struct euler_patch_data* pdata, const struct gkyl_block_connections* conn);
 
+/**
+* Initialize the arrays used for flux correction (refluxing) at coarse-fine interfaces for the Euler equations, and have the
+* wave-propagation updater store the fluctuations through the patch boundary. Called by the patch AMR boundary condition
+* initializers once the boundary condition buffer is allocated; the arrays are freed by euler_patch_bc_updaters_release.
+*
+* @param pdata Patch-structured data for the Euler equations.
+*/
+void euler_patch_reflux_init(struct euler_patch_data* pdata);
+
 /**
 * Release patch AMR updaters for both physical (outer-patch) and non-physical (inter-patch) boundary conditions for the Euler equations.
 *
@@ -246,6 +259,42 @@ void patch_uu_restriction_op(const int tbid, const int tdir, const int i, const
 */
 void euler_sync_patches(const struct gkyl_block_topo* ptopo, const struct euler_patch_data pdata[], struct gkyl_array* fld[]);
 
+/**
+* Synchronize the patches in the patch AMR hierarchy for the Euler equations, taking the skin data of each patch from src and
+* only filling ghost cells of the target patches.
+*
+* @param ptopo Topology/connectivity information for the entire patch hierarchy.
+* @param pdata Patch-structured data for the Euler equations.
+* @param src Skin data to use for each patch.
+* @param fld Output array.
+* @param is_target Flags for patches whose ghost cells are filled (NULL for all patches).
+*/
+void euler_sync_patches_src(const struct gkyl_block_topo* ptopo, const struct euler_patch_data pdata[], const struct block_sync_src src[],
+  struct gkyl_array* fld[], const bool is_target[]);
+
+/**
+* Compute the number of time-steps each patch takes per coarse time-step, from the ratio of the coarsest cell size to the
+* cell size of each patch. The counts are nested, i.e. each count divides every larger one.
+*
+* @param num_patches Number of patches in the patch hierarchy.
+* @param pdata Array of patch-structured data for the Euler equations.
+* @param nsub On output, number of time-steps for each patch.
+* @return Largest number of time-steps.
+*/
+int euler_patch_nsub(int num_patches, const struct euler_patch_data pdata[], int nsub[]);
+
+/**
+* Accumulate the flux corrections at coarse-fine interfaces from an update of the active patches. Coarse patches get the
+* difference between the fine fluxes, summed over the fine time-steps, and their own flux.
+*
+* @param ptopo Topology/connectivity information for the entire patch hierarchy.
+* @param pdata Patch-structured data for the Euler equations.
+* @param active Flags for patches that have just been updated.
+* @param dt_patch Time-step of each patch.
+*/
+void euler_patch_reflux_accumulate(const struct gkyl_block_topo* ptopo, const struct euler_patch_data pdata[], const bool active[],
+  const double dt_patch[]);
+
 /**
 * Write patch-structured AMR simulation data for the Euler equations onto disk.
 *
@@ -270,14 +319,17 @@ double euler_patch_data_max_dt(const struct euler_patch_data* pdata);
 void euler_update_patch_job_func(void* ctx);
 
 /**
-* Update all patches in the patch AMR hierarchy by using the thread-based job pool for the Euler equations.
+* Update all patches in the patch AMR hierarchy by using the thread-based job pool for the Euler equations. Patches are subcycled
+* in time: patch i takes nsub[i] time-steps of dt/nsub[i] (see euler_patch_nsub), with ghost cells from coarser patches
+* interpolated in time and fluxes at coarse-fine interfaces corrected to keep the update conservative. The updated solution
+* is in f[0]; pdata[i].fdup must hold the solution at t_curr.
 *
 * @param job_pool Job pool for updating patch-structured data for the Euler equations using threads.
 * @param ptopo Topology/connectivity information for the entire patch hierarchy.
 * @param pdata Patch-structured data for the Euler equations.
 * @param t_curr Current simulation time.
-* @param dt Current stable time-step for the simulation.
-* @return Status of the update (success and suggested time-step).
+* @param dt Current stable (coarse) time-step for the simulation.
+* @return Status of the update (success and suggested coarse time-step).
 */
 struct gkyl_update_status euler_update_all_patches(const struct gkyl_job_pool* job_pool, const struct gkyl_block_topo* ptopo,
   const struct euler_patch_data pdata[], double t_curr, double dt);
@@ -313,7 +365,8 @@ struct gkyl_update_status euler_update_patch(const struct gkyl_job_pool* job_poo
 void euler_write_sol_patch(const char* fbase, int num_patches, const struct euler_patch_data pdata[]);
 
 /**
-* Calculate the maximum stable time-step across all patches in the patch AMR hierarchy for the Euler equations.
+* Calculate the maximum stable (coarse) time-step across all patches in the patch AMR hierarchy for the Euler equations, allowing
+* for the subcycling of finer patches.
 *
 * @param num_patches Number of patches in the patch hierarchy.
 * @param pdata Array of patch-structured data for the Euler equations.
@@ -321,6 +374,16 @@ void euler_write_sol_patch(const char* fbase, int num_patches, const struct eule
 */
 double euler_max_dt_patch(int num_patches, const struct euler_patch_data pdata[]);
 
+/**
+* Integrate the solution (in f[0]) over all patches in the patch AMR hierarchy for the Euler equations.
+*
+* @param num_patches Number of patches in the patch hierarchy.
+* @param pdata Array of patch-structured data for the Euler equations.
+* @param meqn Number of equations.
+* @param tot On output, integral of each component over the domain.
+*/
+void euler_patch_integrate(int num_patches, const struct euler_patch_data pdata[], int meqn, double tot[]);
+
 /**
 * Set up the topology/connectivity information for the patch AMR hierarchy for a mesh containing a single refinement patch.
 */
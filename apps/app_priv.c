@@ -1,3 +1,116 @@
 #include <stdarg.h>
+#include <gkyl_alloc.h>
 #include <gkyl_app_priv.h>
 
+#include <mpack.h>
+
+struct gkyl_array_meta*
+gkyl_app_frame_meta_new(struct gkyl_app_frame_meta fm)
+{
+  struct gkyl_array_meta *mt = gkyl_malloc(sizeof(*mt));
+
+  mpack_writer_t writer;
+  mpack_writer_init_growable(&writer, &mt->meta, &mt->meta_sz);
+
+  mpack_start_map(&writer, 2);
+  mpack_write_cstr(&writer, "time");
+  mpack_write_double(&writer, fm.stime);
+  mpack_write_cstr(&writer, "frame");
+  mpack_write_i64(&writer, fm.frame);
+  mpack_finish_map(&writer);
+
+  if (mpack_writer_destroy(&writer) != mpack_ok) {
+    // frame is still written, just without meta-data
+    MPACK_FREE(mt->meta);
+    mt->meta = 0;
+    mt->meta_sz = 0;
+  }
+  return mt;
+}
+
+void
+gkyl_app_frame_meta_release(struct gkyl_array_meta *mt)
+{
+  if (!mt) return;
+  MPACK_FREE(mt->meta);
+  gkyl_free(mt);
+}
+
+int
+gkyl_app_frame_meta_read(const char *fname, struct gkyl_app_frame_meta *fm)
+{
+  FILE *fp = fopen(fname, "r");
+  if (!fp)
+    return GKYL_ARRAY_RIO_FOPEN_FAILED;
+
+  struct gkyl_rect_grid grid;
+  struct gkyl_array_header_info hdr;
+  int status = gkyl_grid_sub_array_header_read_fp(&grid, &hdr, fp);
+  fclose(fp);
+  if (status != GKYL_ARRAY_RIO_SUCCESS)
+    return status;
+
+  // frames without time and frame number can't be restarted from
+  status = GKYL_ARRAY_RIO_DATA_MISMATCH;
+  if (hdr.meta_size > 0) {
+    mpack_tree_t tree;
+    mpack_tree_init_data(&tree, hdr.meta, hdr.meta_size);
+    mpack_tree_parse(&tree);
+    mpack_node_t root = mpack_tree_root(&tree);
+
+    bool found = false;
+    mpack_node_t tm_node = mpack_node_map_cstr_optional(root, "time");
+    mpack_node_t fr_node = mpack_node_map_cstr_optional(root, "frame");
+    if (!mpack_node_is_missing(tm_node) && !mpack_node_is_missing(fr_node)) {
+      fm->stime = mpack_node_double(tm_node);
+      fm->frame = mpack_node_i64(fr_node);
+      found = true;
+    }
+    if ((mpack_tree_destroy(&tree) == mpack_ok) && found)
+      status = GKYL_ARRAY_RIO_SUCCESS;
+  }
+  gkyl_array_header_info_release(&hdr);
+
+  return status;
+}
+
+struct gkyl_app_restart_status
+gkyl_app_array_read(struct gkyl_comm *comm,
+  const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  struct gkyl_array *arr, const char *fname)
+{
+  struct gkyl_app_restart_status rstat = { .frame = 0, .stime = 0.0 };
+  rstat.io_status = gkyl_comm_array_read(comm, grid, range, arr, fname);
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    struct gkyl_app_frame_meta fm;
+    rstat.io_status = gkyl_app_frame_meta_read(fname, &fm);
+    if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+      rstat.frame = fm.frame;
+      rstat.stime = fm.stime;
+    }
+  }
+  return rstat;
+}
+
+void
+gkyl_app_dynvec_restore(gkyl_dynvec vec, const char *fname, double stime)
+{
+  FILE *fp = fopen(fname, "r");
+  if (!fp) return;
+  fclose(fp);
+
+  int ncomp = gkyl_dynvec_read_ncomp(fname);
+  gkyl_dynvec hist = gkyl_dynvec_new(GKYL_DOUBLE, ncomp);
+  gkyl_dynvec_read(hist, fname);
+
+  double data[ncomp];
+  size_t nhist = gkyl_dynvec_size(hist);
+  for (size_t i=0; i<nhist; ++i) {
+    double tm = gkyl_dynvec_get_tm(hist, i);
+    if (tm <= stime) {
+      gkyl_dynvec_get(hist, i, data);
+      gkyl_dynvec_append(vec, tm, data);
+    }
+  }
+  gkyl_dynvec_release(hist);
+}
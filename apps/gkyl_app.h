@@ -1,5 +1,7 @@
 #pragma once
 
+#include <gkyl_array_rio.h>
+
 #include <stdbool.h>
 
 // Update status
@@ -9,6 +11,13 @@ struct gkyl_update_status {
   double dt_suggested; // suggested stable time-step
 };
 
+// Status of restart from a file or frame
+struct gkyl_app_restart_status {
+  enum gkyl_array_rio_status io_status; // status of read
+  int frame; // frame number read
+  double stime; // simulation time of data read
+};
+
 // Boundary conditions on particles
 enum gkyl_species_bc_type {
   GKYL_SPECIES_COPY = 0, // copy BCs
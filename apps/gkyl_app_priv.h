@@ -2,9 +2,12 @@
 // in any public facing header!
 #pragma once
 
+#include <gkyl_app.h>
 #include <gkyl_array.h>
 #include <gkyl_array_ops.h>
+#include <gkyl_array_rio.h>
 #include <gkyl_comm.h>
+#include <gkyl_dynvec.h>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -64,3 +67,77 @@ skin_ghost_ranges_init(struct app_skin_ghost_ranges *sgr,
       d, GKYL_UPPER_EDGE, parent, ghost);
   }
 }
+
+// Combine status of reading part of a restart frame into the status
+// of the full restart: the first failure is kept.
+static inline void
+restart_status_merge(struct gkyl_app_restart_status *rstat,
+  struct gkyl_app_restart_status part)
+{
+  if (rstat->io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    rstat->io_status = part.io_status;
+    rstat->frame = part.frame;
+    rstat->stime = part.stime;
+  }
+}
+
+// Meta-data stored in the header of each output frame, needed to
+// restart from that frame
+struct gkyl_app_frame_meta {
+  double stime; // simulation time of frame
+  int frame; // frame number
+};
+
+/**
+ * Create meta-data object (msgpack encoded) for an output frame. Free
+ * using gkyl_app_frame_meta_release.
+ *
+ * @param fm Frame meta-data
+ * @return New meta-data object
+ */
+struct gkyl_array_meta* gkyl_app_frame_meta_new(struct gkyl_app_frame_meta fm);
+
+/**
+ * Free meta-data object.
+ *
+ * @param mt Meta-data object to free
+ */
+void gkyl_app_frame_meta_release(struct gkyl_array_meta *mt);
+
+/**
+ * Read frame meta-data from header of file.
+ *
+ * @param fname Name of file to read
+ * @param fm On output, frame meta-data
+ * @return Status of read (see enum gkyl_array_rio_status)
+ */
+int gkyl_app_frame_meta_read(const char *fname, struct gkyl_app_frame_meta *fm);
+
+/**
+ * Read array from an output frame file into the local range, along
+ * with the frame number and time stored in its header. The file may
+ * have been written with a different decomposition.
+ *
+ * @param comm Communicator
+ * @param grid Grid on which array is defined
+ * @param range Local range to read into
+ * @param arr Array to read into
+ * @param fname Name of file to read
+ * @return Status of read
+ */
+struct gkyl_app_restart_status gkyl_app_array_read(struct gkyl_comm *comm,
+  const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  struct gkyl_array *arr, const char *fname);
+
+/**
+ * Restore history of an integrated diagnostic from its output file on
+ * restart. Entries in the file with time-stamps up to and including
+ * @a stime are appended to @a vec, so the next (non-appending) write of
+ * @a vec reproduces the history up to the restart time. Nothing is done
+ * if the file does not exist.
+ *
+ * @param vec Dynvec to restore into
+ * @param fname Name of diagnostic file
+ * @param stime Restart time
+ */
+void gkyl_app_dynvec_restore(gkyl_dynvec vec, const char *fname, double stime);
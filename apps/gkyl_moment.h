@@ -54,6 +54,9 @@ struct gkyl_moment_species {
 
   int evolve; // evolve species? 1-yes, 0-no
   bool force_low_order_flux; // should  we force low-order flux?
+  // write per-cell count of positivity fixes, one component per
+  // direction, with each frame (wave-prop only)
+  bool write_fix_count;
 
   void *ctx; // context for initial condition init function (and potentially other functions)
   // pointer to initialization function
@@ -164,6 +167,9 @@ struct gkyl_moment {
   int num_skip_dirs; // number of directions to skip
   int skip_dirs[3]; // directions to skip
 
+  int num_threads; // number of threads for wave-propagation sweeps (default 1)
+  bool skip_dt_predict; // should predictive time-step control be skipped? (failed steps are still redone)
+
   int num_species; // number of species
   struct gkyl_moment_species species[GKYL_MAX_SPECIES]; // species objects
   struct gkyl_moment_field field; // field object
@@ -196,6 +202,9 @@ struct gkyl_moment_stat {
   double field_tm; // time to compute field updates
   double sources_tm; // time to compute source terms
 
+  long ndt_predict; // steps taken with predicted (smaller) time-step
+  double redo_tm; // time spent in steps that were redone
+
   //// stuff for MP-XX/SSP-RK schemes
   long nfeuler; // calls to forward-Euler method
     
@@ -260,6 +269,67 @@ void gkyl_moment_app_apply_ic_field(gkyl_moment_app* app, double t0);
  */
 void gkyl_moment_app_apply_ic_species(gkyl_moment_app* app, int sidx, double t0);
 
+/**
+ * Initialize field from file. The file must be a field frame written
+ * by this app (possibly with a different decomposition).
+ *
+ * @param app App object
+ * @param fname File to read from.
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_moment_app_from_file_field(gkyl_moment_app *app, const char *fname);
+
+/**
+ * Initialize species from file. The file must be a species frame
+ * written by this app (possibly with a different decomposition).
+ *
+ * @param app App object
+ * @param sidx Index of species to initialize
+ * @param fname File to read from.
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_moment_app_from_file_species(gkyl_moment_app *app, int sidx,
+  const char *fname);
+
+/**
+ * Initialize field from given frame.
+ *
+ * @param app App object
+ * @param frame Frame to read from
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_moment_app_from_frame_field(gkyl_moment_app *app, int frame);
+
+/**
+ * Initialize species from given frame.
+ *
+ * @param app App object
+ * @param sidx Index of species to initialize
+ * @param frame Frame to read from
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_moment_app_from_frame_species(gkyl_moment_app *app, int sidx, int frame);
+
+/**
+ * Restart simulation from given frame: this is used in place of
+ * gkyl_moment_app_apply_ic. Field and species are read from the frame
+ * files, the simulation time is set to that of the frame, and the
+ * history of the integrated diagnostics before that time is
+ * restored. The frame may have been written with a different
+ * decomposition than the one used by the app.
+ *
+ * @param app App object
+ * @param frame Frame to restart from
+ * @return Status of restart: io_status is GKYL_ARRAY_RIO_SUCCESS if
+ *   all files were read, and stime/frame are set from the frame
+ */
+struct gkyl_app_restart_status
+gkyl_moment_app_read_from_frame(gkyl_moment_app *app, int frame);
+
 /**
  * Write field and species data to file.
  * 
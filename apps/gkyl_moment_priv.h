@@ -31,6 +31,7 @@
 #include <gkyl_rect_decomp.h>
 #include <gkyl_rect_grid.h>
 #include <gkyl_ten_moment_grad_closure.h>
+#include <gkyl_thread_pool.h>
 #include <gkyl_util.h>
 #include <gkyl_wave_geom.h>
 #include <gkyl_wave_prop.h>
@@ -90,6 +91,7 @@ struct moment_species {
   bool nT_source_is_set; // to be set at run time
 
   struct gkyl_array *bc_buffer; // buffer for periodic BCs
+  struct gkyl_comm_state *sync_state; // state for split-phase halo sync
 
   enum gkyl_eqn_type eqn_type;  // type ID of equation
   int num_equations;            // number of equations in species
@@ -115,6 +117,7 @@ struct moment_species {
     };
   };
   struct gkyl_array *fcurr; // points to current solution (depends on scheme)
+  struct gkyl_array *fix_count; // cumulative count of positivity fixes (NULL if not tracked)
 
   // boundary condition type
   enum gkyl_species_bc_type lower_bct[3], upper_bct[3];
@@ -158,6 +161,7 @@ struct moment_field {
   double volume_R0; // Initial radial distance from expansion/contraction center for volume-based geometrical sources.
 
   struct gkyl_array *bc_buffer; // buffer for periodic BCs
+  struct gkyl_comm_state *sync_state; // state for split-phase halo sync
 
  // scheme to update equations solvers and data to update fluid
  // equations
@@ -244,6 +248,7 @@ struct gkyl_moment_app {
   struct gkyl_range global, global_ext; // global, global-ext ranges
 
   struct gkyl_comm *comm;   // communicator object
+  struct gkyl_job_pool *job_pool; // job pool for threaded sweeps (NULL for serial)
 
   bool has_mapc2p; // flag to indicate if we have mapc2p
   void *c2p_ctx;   // context for mapc2p function
@@ -275,6 +280,11 @@ struct gkyl_moment_app {
   struct mhd_src mhd_source;
 
   struct gkyl_moment_stat stat; // statistics
+  bool skip_dt_predict; // should predictive time-step control be skipped?
+  // CFL-limited time-steps of the wave-prop sweeps of the current step,
+  // and of the last two accepted steps (0 if there are none yet): used
+  // to predict the stable time-step
+  double dt_stable_step, dt_stable_prev[2];
 
   // pointer to function that takes a single-step of simulation
   struct gkyl_update_status (*update_func)(gkyl_moment_app *app, double dt0);
@@ -302,6 +312,15 @@ integ_sq(int nc, const double *qin, double *integ_out)
 }
 
 // function for copy BC
+// true if some ghost cells of the local range along dir are owned by
+// another rank
+static inline bool
+moment_is_cut_dir(const struct gkyl_moment_app *app, int dir)
+{
+  return app->local.lower[dir] != app->global.lower[dir] ||
+    app->local.upper[dir] != app->global.upper[dir];
+}
+
 static inline void
 bc_copy(const struct gkyl_wv_eqn* eqn, double t, int nc, const double *skin,
   double *GKYL_RESTRICT ghost, void *ctx)
@@ -349,6 +368,11 @@ void moment_species_apply_bc(gkyl_moment_app *app, double tcurr,
   const struct moment_species *sp,
   struct gkyl_array *f);
 
+// Apply BCs along direction dir to f[dir] of ns species, i.e. fill
+// only the ghost cells read by the sweep along dir
+void moment_species_apply_bc_dir(gkyl_moment_app *app, double tcurr,
+  int ns, struct moment_species *species, int dir);
+
 // Maximum stable time-step from species
 double moment_species_max_dt(const gkyl_moment_app *app,
   const struct moment_species *sp);
@@ -358,12 +382,19 @@ struct gkyl_update_status moment_species_update(gkyl_moment_app *app,
   struct moment_species *sp,
   double tcurr, double dt);
 
+// Advance solution of ns species by time-step dt to tcurr+dt, sweeping
+// all species together in each direction
+struct gkyl_update_status moment_species_update_all(gkyl_moment_app *app,
+  int ns, struct moment_species *species,
+  double tcurr, double dt);
+
 // Compute RHS of moment equations
 double moment_species_rhs(gkyl_moment_app *app, struct moment_species *species,
   const struct gkyl_array *fin, struct gkyl_array *rhs);
 
 // Free memory allocated by species
-void moment_species_release(const struct moment_species *sp);
+void moment_species_release(const gkyl_moment_app *app,
+  const struct moment_species *sp);
 
 /** moment_field API */
 
@@ -377,6 +408,11 @@ void moment_field_apply_bc(gkyl_moment_app *app, double tcurr,
   const struct moment_field *field,
   struct gkyl_array *f);
 
+// Apply BCs along direction dir to EM field data "f", i.e. fill only
+// the ghost cells read by the sweep along dir
+void moment_field_apply_bc_dir(gkyl_moment_app *app, double tcurr,
+  const struct moment_field *field, int dir, struct gkyl_array *f);
+
 // Maximum stable time-step due to EM fields
 double moment_field_max_dt(const gkyl_moment_app *app,
   const struct moment_field *fld);
@@ -391,7 +427,8 @@ double moment_field_rhs(gkyl_moment_app *app, struct moment_field *fld,
   const struct gkyl_array *fin, struct gkyl_array *rhs);
 
 // Release the EM field object
-void moment_field_release(const struct moment_field *fld);
+void moment_field_release(const gkyl_moment_app *app,
+  const struct moment_field *fld);
 
 /** moment_coupling API */
 
@@ -248,6 +248,66 @@ void gkyl_pkpm_app_apply_ic_field(gkyl_pkpm_app* app, double t0);
  */
 void gkyl_pkpm_app_apply_ic_species(gkyl_pkpm_app* app, int sidx, double t0);
 
+/**
+ * Initialize field from file. The file must be a field frame written
+ * by this app (possibly with a different decomposition).
+ *
+ * @param app App object
+ * @param fname File to read from.
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_pkpm_app_from_file_field(gkyl_pkpm_app *app, const char *fname);
+
+/**
+ * Initialize species from files. The distribution function is read
+ * from the species frame and the fluid momentum from the conserved
+ * fluid variables (the "pkpm_fluid" frame) written by this app.
+ *
+ * @param app App object
+ * @param sidx Index of species to initialize
+ * @param fname File to read distribution function from
+ * @param fname_fluid File to read conserved fluid variables from
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_pkpm_app_from_file_species(gkyl_pkpm_app *app, int sidx,
+  const char *fname, const char *fname_fluid);
+
+/**
+ * Initialize field from given frame.
+ *
+ * @param app App object
+ * @param frame Frame to read from
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_pkpm_app_from_frame_field(gkyl_pkpm_app *app, int frame);
+
+/**
+ * Initialize species from given frame.
+ *
+ * @param app App object
+ * @param sidx Index of species to initialize
+ * @param frame Frame to read from
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_pkpm_app_from_frame_species(gkyl_pkpm_app *app, int sidx, int frame);
+
+/**
+ * Restart simulation from given frame: this is used in place of
+ * gkyl_pkpm_app_apply_ic. The simulation time is set to that of the
+ * frame, and the history of the integrated diagnostics before that
+ * time is restored.
+ *
+ * @param app App object
+ * @param frame Frame to restart from
+ * @return Status of restart
+ */
+struct gkyl_app_restart_status
+gkyl_pkpm_app_read_from_frame(gkyl_pkpm_app *app, int frame);
+
 /**
  * Calculate integrated diagnostic moments.
  *
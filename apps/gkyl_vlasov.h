@@ -67,6 +67,8 @@ struct gkyl_vlasov_collisions {
   double iter_eps; // error tolerance for moment fixes (density is always exact)
   int max_iter; // maximum number of iterations
   bool use_last_converged; // use last iteration value regardless of convergence?
+  bool use_cell_mask; // stop iterating in cells whose moments have converged (CPU only)
+  bool use_anderson; // accelerate the moment fixes cell by cell (CPU only)
 
   // Boolean for using implicit BGK collisions (replaces rk3)   
   bool has_implicit_coll_scheme; 
@@ -177,6 +179,13 @@ struct gkyl_vlasov_species {
   double iter_eps; // error tolerance for moment fixes of f_lte (density is always exact)
   int max_iter; // maximum number of iterations for correction output f_lte
   bool use_last_converged; // use last iteration value regardless of convergence for f_lte?
+  bool use_cell_mask; // stop iterating in cells whose f_lte moments have converged (CPU only)
+  bool use_anderson; // accelerate the f_lte moment fixes cell by cell (CPU only)
+
+  // store f in single precision? Kernels still compute in double
+  // precision; moments and fields are always double. Collisionless
+  // species on the CPU only.
+  bool use_single_precision;
 
   // boundary conditions
   enum gkyl_species_bc_type bcx[2], bcy[2], bcz[2];
@@ -266,6 +275,13 @@ struct gkyl_vm {
   double cfl_frac; // CFL fraction to use (default 1.0)
 
   bool use_gpu; // Flag to indicate if solver should use GPUs
+  int num_threads; // number of threads for CPU DG updates (default 1)
+  // count and time the DG kernels of each species and write a
+  // roofline table with the stats (CPU only)
+  bool use_kernel_stat;
+  // with threads, sum velocity moments in an order that does not
+  // depend on num_threads (slightly slower for small conf-space grids)
+  bool use_deterministic_moms;
 
   int num_periodic_dir; // number of periodic directions
   int periodic_dirs[3]; // list of periodic directions
@@ -319,6 +335,8 @@ struct gkyl_vlasov_stat {
   double species_lte_tm; // time needed to compute the lte equilibrium
 
   long niter_self_bgk_corr[GKYL_MAX_SPECIES]; // number of iterations used to correct self collisions in BGK
+  long ncell_iter_self_bgk_corr[GKYL_MAX_SPECIES]; // sum over cells of the iterations done in each cell
+  long max_cell_iter_self_bgk_corr[GKYL_MAX_SPECIES]; // largest number of iterations done in a cell
 
   double species_bc_tm; // time to compute species BCs
   double fluid_species_bc_tm; // time to compute fluid species BCs
@@ -395,6 +413,92 @@ void gkyl_vlasov_app_apply_ic_species(gkyl_vlasov_app* app, int sidx, double t0)
  */
 void gkyl_vlasov_app_apply_ic_fluid_species(gkyl_vlasov_app* app, int sidx, double t0);
 
+/**
+ * Initialize field from file. The file must be a field frame written
+ * by this app (possibly with a different decomposition).
+ *
+ * @param app App object
+ * @param fname File to read from.
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_file_field(gkyl_vlasov_app *app, const char *fname);
+
+/**
+ * Initialize species from file. The file must be a species frame
+ * written by this app (possibly with a different decomposition).
+ *
+ * @param app App object
+ * @param sidx Index of species to initialize
+ * @param fname File to read from.
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_file_species(gkyl_vlasov_app *app, int sidx,
+  const char *fname);
+
+/**
+ * Initialize fluid species from file. The file must be a fluid species
+ * frame written by this app (possibly with a different
+ * decomposition).
+ *
+ * @param app App object
+ * @param sidx Index of fluid species to initialize
+ * @param fname File to read from.
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_file_fluid_species(gkyl_vlasov_app *app, int sidx,
+  const char *fname);
+
+/**
+ * Initialize field from given frame.
+ *
+ * @param app App object
+ * @param frame Frame to read from
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_frame_field(gkyl_vlasov_app *app, int frame);
+
+/**
+ * Initialize species from given frame.
+ *
+ * @param app App object
+ * @param sidx Index of species to initialize
+ * @param frame Frame to read from
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_frame_species(gkyl_vlasov_app *app, int sidx, int frame);
+
+/**
+ * Initialize fluid species from given frame.
+ *
+ * @param app App object
+ * @param sidx Index of fluid species to initialize
+ * @param frame Frame to read from
+ * @return Status of read
+ */
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_frame_fluid_species(gkyl_vlasov_app *app, int sidx, int frame);
+
+/**
+ * Restart simulation from given frame: this is used in place of
+ * gkyl_vlasov_app_apply_ic. Field, species and fluid species are read
+ * from the frame files, the simulation time is set to that of the
+ * frame, and the history of the integrated diagnostics before that
+ * time is restored. The frame may have been written with a different
+ * decomposition than the one used by the app.
+ *
+ * @param app App object
+ * @param frame Frame to restart from
+ * @return Status of restart: io_status is GKYL_ARRAY_RIO_SUCCESS if
+ *   all files were read, and stime/frame are set from the frame
+ */
+struct gkyl_app_restart_status
+gkyl_vlasov_app_read_from_frame(gkyl_vlasov_app *app, int frame);
+
 /**
  * Calculate diagnostic moments.
  *
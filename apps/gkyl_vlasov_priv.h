@@ -50,6 +50,7 @@
 #include <gkyl_mom_vlasov.h>
 #include <gkyl_mom_vlasov_sr.h>
 #include <gkyl_null_pool.h>
+#include <gkyl_thread_pool.h>
 #include <gkyl_prim_lbo_calc.h>
 #include <gkyl_prim_lbo_cross_calc.h>
 #include <gkyl_prim_lbo_type.h>
@@ -106,6 +107,8 @@ struct correct_all_moms_inp {
   double iter_eps; // error tolerance for moment fixes (density is always exact)
   int max_iter; // maximum number of iterations
   bool use_last_converged; // use last iteration value regardless of convergence?
+  bool use_cell_mask; // stop iterating in cells whose moments have converged
+  bool use_anderson; // accelerate the moment fixes cell by cell
 };
 
 // data for moments
@@ -135,6 +138,7 @@ struct vm_species;
 struct vm_lbo_collisions {  
   struct gkyl_array *boundary_corrections; // LBO boundary corrections
   struct gkyl_mom_calc_bcorr *bcorr_calc; // LBO boundary corrections calculator
+  bool fused_moms; // true if moments and corrections are computed in the Vlasov sweep
   struct gkyl_array *nu_sum, *prim_moms, *nu_prim_moms; // LBO primitive moments
   bool normNu; // Boolean to determine if using Spitzer value
   struct gkyl_array *norm_nu; // Array for normalization factor computed from Spitzer updater n/sqrt(2 vt^2)^3
@@ -177,6 +181,8 @@ struct vm_lte {
   struct gkyl_vlasov_lte_proj_on_basis *proj_lte; 
 
   long niter; // total number of iterations correcting self collisions
+  long ncell_iter; // total over cells of the iterations done in each cell
+  long max_cell_iter; // largest number of iterations done in a single cell
 
   // Correction updater for insuring LTE distribution has desired LTE (n, V_drift, T/m) moments
   bool correct_all_moms; // boolean if we are correcting all the moments
@@ -539,6 +545,8 @@ struct vm_fluid_em_coupling {
 struct gkyl_vlasov_app {
   char name[128]; // name of app
   struct gkyl_job_pool *job_pool; // Job pool
+  bool use_kernel_stat; // should DG kernels be counted and timed?
+  bool use_deterministic_moms; // should moment sums be independent of thread count?
   
   int cdim, vdim; // conf, velocity space dimensions
   int poly_order; // polynomial order
@@ -606,6 +614,21 @@ void vlasov_forward_euler(gkyl_vlasov_app* app, double tcurr, double dt,
   struct gkyl_array *fout[], struct gkyl_array *fluidout[], struct gkyl_array *emout, 
   struct gkyl_update_status *st);
 
+// Take a single forward Euler step as above, but fuse the update of
+// the distribution functions with an SSP-RK stage combination:
+// fout = c0*f0 + c1*(fin + dt_actual*rhs), where the RHS is computed
+// in frhs. fout may be the same array as frhs or fin, avoiding a
+// separate RHS array, and f0 is not used if c0 is 0.0. If
+// reject_reduced_dt is true and dt_actual < dt, fout is not modified
+// (the caller will retake the step). Fluid species and fields are
+// updated as in vlasov_forward_euler.
+void vlasov_forward_euler_combine(gkyl_vlasov_app* app, double tcurr, double dt,
+  double c0, const struct gkyl_array *f0[], double c1, const struct gkyl_array *fin[],
+  const struct gkyl_array *fluidin[], const struct gkyl_array *emin,
+  struct gkyl_array *frhs[], struct gkyl_array *fout[],
+  struct gkyl_array *fluidout[], struct gkyl_array *emout,
+  bool reject_reduced_dt, struct gkyl_update_status *st);
+
 // Calls the vlasov implicit contribution for all vm species
 void vlasov_update_implicit_coll(gkyl_vlasov_app *app,  double dt0);
 
@@ -1018,6 +1041,18 @@ void vm_species_init(struct gkyl_vm *vm, struct gkyl_vlasov_app *app, struct vm_
  */
 void vm_species_apply_ic(gkyl_vlasov_app *app, struct vm_species *species, double t0);
 
+/**
+ * Set up species inputs that are otherwise set up with the initial
+ * conditions, after the distribution function has been read from a
+ * restart file: applied acceleration, sources and fixed-function BCs.
+ * Initial condition functions are evaluated at the restart time.
+ *
+ * @param app Vlasov app object
+ * @param species Species object
+ * @param tm Restart time
+ */
+void vm_species_restart_init(gkyl_vlasov_app *app, struct vm_species *species, double tm);
+
 /**
  * Compute species applied acceleration term
  *
@@ -1028,7 +1063,24 @@ void vm_species_apply_ic(gkyl_vlasov_app *app, struct vm_species *species, doubl
 void vm_species_calc_app_accel(gkyl_vlasov_app *app, struct vm_species *species, double tm);
 
 /**
- * Compute RHS from species distribution function
+ * Compute the collisionless (Vlasov) part of the RHS, overwriting rhs
+ * and cflrate. If the LBO moments are fused with the Vlasov sweep,
+ * they are also computed here.
+ *
+ * @param app Vlasov app object
+ * @param species Pointer to species
+ * @param fin Input distribution function
+ * @param em EM field
+ * @param rhs On output, the collisionless RHS
+ */
+void vm_species_rhs_vlasov(gkyl_vlasov_app *app, struct vm_species *species,
+  const struct gkyl_array *fin, const struct gkyl_array *em, 
+  struct gkyl_array *rhs);
+
+/**
+ * Compute RHS from species distribution function. If the LBO moments
+ * are fused with the Vlasov sweep, vm_species_rhs_vlasov must have
+ * been called on rhs already.
  *
  * @param app Vlasov app object
  * @param species Pointer to species
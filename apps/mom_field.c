@@ -42,6 +42,8 @@ moment_field_init(const struct gkyl_moment *mom, const struct gkyl_moment_field
           .comm = app->comm
         }
       );
+    for (int d=0; d<ndim; ++d)
+      gkyl_wave_prop_set_job_pool(fld->slvr[d], app->job_pool);
 
     // allocate arrays
     fld->fdup = mkarr(false, 8, app->local_ext.volume);
@@ -211,6 +213,7 @@ moment_field_init(const struct gkyl_moment *mom, const struct gkyl_moment_field
     buff_sz = buff_sz > vol ? buff_sz : vol;
   }
   fld->bc_buffer = mkarr(false, 8, buff_sz);
+  fld->sync_state = gkyl_comm_state_new(app->comm);
 
   gkyl_wv_eqn_release(maxwell);
 
@@ -251,6 +254,43 @@ moment_field_apply_bc(gkyl_moment_app *app, double tcurr,
   app->stat.field_bc_tm += gkyl_time_diff_now_sec(wst);  
 }
 
+// apply BCs along direction dir only: the inter-rank halo exchange is
+// posted first and completes after the local BCs are applied
+void
+moment_field_apply_bc_dir(gkyl_moment_app *app, double tcurr,
+  const struct moment_field *field, int dir, struct gkyl_array *f)
+{
+  struct timespec wst = gkyl_wall_clock();
+
+  bool is_periodic = false;
+  for (int d=0; d<app->num_periodic_dir; ++d)
+    if (app->periodic_dirs[d] == dir) is_periodic = true;
+
+  bool is_cut = moment_is_cut_dir(app, dir);
+  if (is_cut)
+    gkyl_comm_array_sync_begin(app->comm, &app->local, &app->local_ext, f, field->sync_state);
+
+  if (is_periodic) {
+    gkyl_comm_array_per_sync(app->comm, &app->local, &app->local_ext, 1,
+      (int[]) { dir }, f);
+  }
+  else {
+    if (field->lower_bct[dir] != GKYL_FIELD_WEDGE)
+      gkyl_wv_apply_bc_advance(field->lower_bc[dir], tcurr, &app->local, f);
+    if (field->upper_bct[dir] != GKYL_FIELD_WEDGE)
+      gkyl_wv_apply_bc_advance(field->upper_bc[dir], tcurr, &app->local, f);
+
+    if (field->lower_bct[dir] == GKYL_FIELD_WEDGE)
+      moment_apply_wedge_bc(app, tcurr, &app->local,
+        field->bc_buffer, dir, field->lower_bc[dir], field->upper_bc[dir], f);
+  }
+
+  if (is_cut)
+    gkyl_comm_array_sync_end(app->comm, field->sync_state);
+
+  app->stat.field_bc_tm += gkyl_time_diff_now_sec(wst);
+}
+
 double
 moment_field_max_dt(const gkyl_moment_app *app, const struct moment_field *fld)
 {
@@ -277,14 +317,19 @@ moment_field_update(gkyl_moment_app *app,
   for (int d=0; d<ndim; ++d) {
     // update solution
     stat = gkyl_wave_prop_advance(fld->slvr[d], tcurr, dt, &app->local, fld->f[d], fld->f[d+1]);
+    app->dt_stable_step = fmin(app->dt_stable_step, stat.dt_stable);
 
     if (!stat.success)
       return (struct gkyl_update_status) {
         .success = false,
         .dt_suggested = stat.dt_suggested
       };
-    // apply BC
-    moment_field_apply_bc(app, tcurr, fld, fld->f[d+1]);
+    // apply BC: intermediate solutions only need ghost cells along
+    // the next sweep direction
+    if (d < ndim-1)
+      moment_field_apply_bc_dir(app, tcurr, fld, d+1, fld->f[d+1]);
+    else
+      moment_field_apply_bc(app, tcurr, fld, fld->f[d+1]);
   }
 
   return (struct gkyl_update_status) {
@@ -317,7 +362,7 @@ moment_field_rhs(gkyl_moment_app *app, struct moment_field *fld,
 
 // free field
 void
-moment_field_release(const struct moment_field *fld)
+moment_field_release(const gkyl_moment_app *app, const struct moment_field *fld)
 {
   gkyl_wv_eqn_release(fld->maxwell);
   
@@ -358,5 +403,6 @@ moment_field_release(const struct moment_field *fld)
 
   gkyl_dynvec_release(fld->integ_energy);
   gkyl_array_release(fld->bc_buffer);
+  gkyl_comm_state_release(app->comm, fld->sync_state);
 }
 
@@ -76,6 +76,7 @@ moment_species_init(const struct gkyl_moment *mom, const struct gkyl_moment_spec
   int ndim = mom->ndim;
   int meqn = sp->num_equations;  
 
+  sp->fix_count = 0;
   if (sp->scheme_type == GKYL_MOMENT_WAVE_PROP) {
     // create updaters for each directional update
     for (int d=0; d<ndim; ++d)
@@ -93,6 +94,14 @@ moment_species_init(const struct gkyl_moment *mom, const struct gkyl_moment_spec
           .comm = app->comm
         }
       );
+    for (int d=0; d<ndim; ++d)
+      gkyl_wave_prop_set_job_pool(sp->slvr[d], app->job_pool);
+
+    if (mom_sp->write_fix_count) {
+      sp->fix_count = mkarr(false, ndim, app->local_ext.volume);
+      for (int d=0; d<ndim; ++d)
+        gkyl_wave_prop_set_fix_count(sp->slvr[d], sp->fix_count);
+    }
       
     sp->fdup = mkarr(false, meqn, app->local_ext.volume);
     // allocate arrays
@@ -283,6 +292,7 @@ moment_species_init(const struct gkyl_moment *mom, const struct gkyl_moment_spec
     buff_sz = buff_sz > vol ? buff_sz : vol;
   }
   sp->bc_buffer = mkarr(false, meqn, buff_sz);
+  sp->sync_state = gkyl_comm_state_new(app->comm);
 
   if (mom_sp->equation->type == GKYL_EQN_EULER)
     sp->integ_q = gkyl_dynvec_new(GKYL_DOUBLE, 6); // KE and PE are stored independently
@@ -328,6 +338,55 @@ moment_species_apply_bc(gkyl_moment_app *app, double tcurr,
   app->stat.species_bc_tm += gkyl_time_diff_now_sec(wst);
 }
 
+// apply BCs along direction dir only to f[dir] of all species: these
+// are the only ghost cells the sweep along dir reads. Inter-rank halo
+// exchanges are posted first and complete after the local BCs are
+// applied. They are not overlapped with the sweep itself: every pencil
+// of the sweep along dir reads the ghost cells at both of its ends, so
+// that would need wave-prop to update pencil interiors on their own
+void
+moment_species_apply_bc_dir(gkyl_moment_app *app, double tcurr,
+  int ns, struct moment_species *species, int dir)
+{
+  struct timespec wst = gkyl_wall_clock();
+
+  bool is_periodic = false;
+  for (int d=0; d<app->num_periodic_dir; ++d)
+    if (app->periodic_dirs[d] == dir) is_periodic = true;
+
+  bool is_cut = moment_is_cut_dir(app, dir);
+  if (is_cut)
+    for (int i=0; i<ns; ++i)
+      gkyl_comm_array_sync_begin(app->comm, &app->local, &app->local_ext,
+        species[i].f[dir], species[i].sync_state);
+
+  for (int i=0; i<ns; ++i) {
+    const struct moment_species *sp = &species[i];
+    struct gkyl_array *f = sp->f[dir];
+    
+    if (is_periodic) {
+      gkyl_comm_array_per_sync(app->comm, &app->local, &app->local_ext, 1,
+        (int[]) { dir }, f);
+    }
+    else {
+      if (sp->lower_bct[dir] != GKYL_SPECIES_WEDGE)
+        gkyl_wv_apply_bc_advance(sp->lower_bc[dir], tcurr, &app->local, f);
+      if (sp->upper_bct[dir] != GKYL_SPECIES_WEDGE)
+        gkyl_wv_apply_bc_advance(sp->upper_bc[dir], tcurr, &app->local, f);
+
+      if (sp->lower_bct[dir] == GKYL_SPECIES_WEDGE)
+        moment_apply_wedge_bc(app, tcurr, &app->local,
+          sp->bc_buffer, dir, sp->lower_bc[dir], sp->upper_bc[dir], f);
+    }
+  }
+
+  if (is_cut)
+    for (int i=0; i<ns; ++i)
+      gkyl_comm_array_sync_end(app->comm, species[i].sync_state);
+
+  app->stat.species_bc_tm += gkyl_time_diff_now_sec(wst);
+}
+
 // maximum stable time-step
 double
 moment_species_max_dt(const gkyl_moment_app *app, const struct moment_species *sp)
@@ -352,32 +411,60 @@ struct gkyl_update_status
 moment_species_update(gkyl_moment_app *app,
   struct moment_species *sp, double tcurr, double dt)
 {
-  int ndim = sp->ndim;
+  return moment_species_update_all(app, 1, sp, tcurr, dt);
+}
+
+// update solution of all species: the species share the grid and
+// geometry, so each direction is swept once for all of them
+struct gkyl_update_status
+moment_species_update_all(gkyl_moment_app *app,
+  int ns, struct moment_species *species, double tcurr, double dt)
+{
+  int ndim = app->ndim;
   double dt_suggested = DBL_MAX;
-  double max_speed = 0.0;
-  struct gkyl_wave_prop_status stat;
+  double max_speed[ns];
+  for (int i=0; i<ns; ++i) max_speed[i] = 0.0;
+
+  gkyl_wave_prop *slvr[ns];
+  const struct gkyl_array *qin[ns];
+  struct gkyl_array *qout[ns];
+  struct gkyl_wave_prop_status stat[ns];
 
   for (int d=0; d<ndim; ++d) {
-    stat = gkyl_wave_prop_advance(sp->slvr[d], tcurr, dt, &app->local, sp->f[d], sp->f[d+1]);
+    for (int i=0; i<ns; ++i) {
+      slvr[i] = species[i].slvr[d];
+      qin[i] = species[i].f[d];
+      qout[i] = species[i].f[d+1];
+    }
+    struct gkyl_wave_prop_status cstat = gkyl_wave_prop_advance_multi(ns, slvr,
+      tcurr, dt, &app->local, qin, qout, stat);
 
-    double my_max_speed = stat.max_speed;
-    max_speed = max_speed > my_max_speed ? max_speed : my_max_speed;
+    for (int i=0; i<ns; ++i)
+      max_speed[i] = max_speed[i] > stat[i].max_speed ? max_speed[i] : stat[i].max_speed;
+    app->dt_stable_step = fmin(app->dt_stable_step, cstat.dt_stable);
 
-    if (!stat.success)
+    if (!cstat.success)
       return (struct gkyl_update_status) {
         .success = false,
-        .dt_suggested = stat.dt_suggested
+        .dt_suggested = cstat.dt_suggested
       };
     
-    dt_suggested = fmin(dt_suggested, stat.dt_suggested);
-    moment_species_apply_bc(app, tcurr, sp, sp->f[d+1]);
+    dt_suggested = fmin(dt_suggested, cstat.dt_suggested);
+    // intermediate solutions are only read by the next sweep, which
+    // needs ghost cells along its own direction; the final one gets
+    // the full set of BCs
+    if (d < ndim-1)
+      moment_species_apply_bc_dir(app, tcurr, ns, species, d+1);
+    else
+      for (int i=0; i<ns; ++i)
+        moment_species_apply_bc(app, tcurr, &species[i], species[i].f[d+1]);
   }
 
-  for (int d=0; d<ndim; ++d) {
-    struct gkyl_wv_eqn *eqn = sp->equation;
+  for (int i=0; i<ns; ++i) {
+    struct gkyl_wv_eqn *eqn = species[i].equation;
     if (eqn->type==GKYL_EQN_MHD) {
-      if (sp->eqn_type==GKYL_MHD_DIVB_GLM) {
-        gkyl_wv_mhd_set_glm_ch(eqn, max_speed);
+      if (species[i].eqn_type==GKYL_MHD_DIVB_GLM) {
+        gkyl_wv_mhd_set_glm_ch(eqn, max_speed[i]);
       }
     }
   }
@@ -420,7 +507,7 @@ moment_species_rhs(gkyl_moment_app *app, struct moment_species *species,
 
 // free species
 void
-moment_species_release(const struct moment_species *sp)
+moment_species_release(const gkyl_moment_app *app, const struct moment_species *sp)
 {
   gkyl_wv_eqn_release(sp->equation);
   
@@ -434,6 +521,8 @@ moment_species_release(const struct moment_species *sp)
   if (sp->scheme_type == GKYL_MOMENT_WAVE_PROP) {
     for (int d=0; d<sp->ndim; ++d)
       gkyl_wave_prop_release(sp->slvr[d]);
+    if (sp->fix_count)
+      gkyl_array_release(sp->fix_count);
     
     gkyl_array_release(sp->fdup);
     for (int d=0; d<sp->ndim+1; ++d)
@@ -462,6 +551,7 @@ moment_species_release(const struct moment_species *sp)
     gkyl_fv_proj_release(sp->proj_nT_source);
 
   gkyl_array_release(sp->bc_buffer);
+  gkyl_comm_state_release(app->comm, sp->sync_state);
 
   gkyl_dynvec_release(sp->integ_q);
 }
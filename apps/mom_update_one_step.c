@@ -1,5 +1,54 @@
 #include <gkyl_moment_priv.h>
 
+// Check the requested time-step before anything is written. The
+// wave-prop updaters reject dt when the CFL number exceeds 1.1 times
+// the target. The CFL-limited time-steps of the last two accepted
+// steps (computed, and reduced over ranks, by their sweeps) give a
+// prediction of the stable time-step, extrapolating its decrease over
+// the last step. Only when dt exceeds that prediction is the stable
+// time-step of the current solution computed, which costs a sweep
+// over the grid and a reduction; the smaller of the two is used in
+// place of dt if dt would be rejected, avoiding a redo of the step.
+static double
+predict_dt(gkyl_moment_app *app, double dt)
+{
+  double dt_last = app->dt_stable_prev[0], dt_last2 = app->dt_stable_prev[1];
+  if (app->skip_dt_predict || dt_last <= 0.0 || dt_last == DBL_MAX)
+    return dt;
+
+  double growth = 1.0;
+  if (dt_last2 > 0.0 && dt_last2 != DBL_MAX)
+    growth = fmin(1.0, dt_last/dt_last2);
+
+  double dt_pred = dt_last*growth;
+  if (dt <= dt_pred)
+    return dt;
+
+  // pre-sweep check on the current solution
+  dt_pred = fmin(dt_pred, gkyl_moment_app_max_dt(app)*growth);
+  if (dt > 1.1*dt_pred) {
+    app->stat.ndt_predict += 1;
+    return dt_pred;
+  }
+  return dt;
+}
+
+static inline void
+swap_arrays(struct gkyl_array **a, struct gkyl_array **b)
+{
+  struct gkyl_array *t = *a; *a = *b; *b = t;
+}
+
+// The directional sweeps read f[0] and write f[1], ..., f[ndim], so
+// f[0] is only modified in place by the first source half-step. The
+// solution is saved for a possible redo only when such a source
+// update is present: otherwise f[0] still holds it when a sweep fails.
+static inline bool
+needs_redo_snapshot(const gkyl_moment_app *app)
+{
+  return app->update_sources || app->update_mhd_source;
+}
+
 // internal function that takes a single time-step using a single-step
 // Strang-split scheme
 struct gkyl_update_status
@@ -22,17 +71,22 @@ moment_update_one_step(gkyl_moment_app* app, double dt0)
     UPDATE_REDO,
   } state = PRE_UPDATE;
 
-  double tcurr = app->tcurr, dt = dt0;
+  double tcurr = app->tcurr, dt = predict_dt(app, dt0);
+  struct timespec step_tm = gkyl_wall_clock();
   while (state != UPDATE_DONE) {
     switch (state) {
       case PRE_UPDATE:
         state = FIRST_COUPLING_UPDATE; // next state
+        step_tm = gkyl_wall_clock();
+        app->dt_stable_step = DBL_MAX;
           
         // copy old solution in case we need to redo this step
-        for (int i=0; i<ns; ++i)
-          gkyl_array_copy(app->species[i].fdup, app->species[i].f[0]);
-        if (app->has_field)
-          gkyl_array_copy(app->field.fdup, app->field.f[0]);
+        if (needs_redo_snapshot(app)) {
+          for (int i=0; i<ns; ++i)
+            gkyl_array_copy(app->species[i].fdup, app->species[i].f[0]);
+          if (app->has_field)
+            gkyl_array_copy(app->field.fdup, app->field.f[0]);
+        }
 
         break;
           
@@ -75,17 +129,19 @@ moment_update_one_step(gkyl_moment_app* app, double dt0)
         state = SECOND_COUPLING_UPDATE; // next state
 
         struct timespec sp_tm = gkyl_wall_clock();
-        for (int i=0; i<ns; ++i) {         
+        if (ns > 0) {
+          // species are swept together in each direction
           struct gkyl_update_status s =
-            moment_species_update(app, &app->species[i], tcurr, dt);
+            moment_species_update_all(app, ns, app->species, tcurr, dt);
 
           if (!s.success) {
             app->stat.nfail += 1;
             dt = s.dt_suggested;
             state = UPDATE_REDO;
-            break;
           }
-          dt_suggested = fmin(dt_suggested, s.dt_suggested);
+          else {
+            dt_suggested = fmin(dt_suggested, s.dt_suggested);
+          }
         }
         app->stat.species_tm += gkyl_time_diff_now_sec(sp_tm);
          
@@ -110,28 +166,39 @@ moment_update_one_step(gkyl_moment_app* app, double dt0)
       case POST_UPDATE:
         state = UPDATE_DONE;
 
-        // copy solution in prep for next time-step
+        app->dt_stable_prev[1] = app->dt_stable_prev[0];
+        app->dt_stable_prev[0] = app->dt_stable_step;
+
+        // rotate buffers in prep for next time-step: the updated
+        // solution becomes f[0] and the old one scratch space
         for (int i=0; i<ns; ++i) {
-          // check for nans before copying
-          if (check_for_nans(app->species[i].f[ndim], app->local))
+          struct moment_species *sp = &app->species[i];
+          // check for nans before swapping
+          if (check_for_nans(sp->f[ndim], app->local))
             have_nans_occured = true;
-          else // only copy in case no nans, so old solution can be written out
-            gkyl_array_copy(app->species[i].f[0], app->species[i].f[ndim]);
+          else // only swap in case no nans, so old solution can be written out
+            swap_arrays(&sp->f[0], &sp->f[ndim]);
+          sp->fcurr = sp->f[0];
         }
         
-        if (app->has_field)
-          gkyl_array_copy(app->field.f[0], app->field.f[ndim]);
+        if (app->has_field) {
+          swap_arrays(&app->field.f[0], &app->field.f[ndim]);
+          app->field.fcurr = app->field.f[0];
+        }
           
         break;
 
       case UPDATE_REDO:
         state = PRE_UPDATE; // start all-over again
+        app->stat.redo_tm += gkyl_time_diff_now_sec(step_tm);
           
         // restore solution and retake step
-        for (int i=0; i<ns; ++i)
-          gkyl_array_copy(app->species[i].f[0], app->species[i].fdup);
-        if (app->has_field)
-          gkyl_array_copy(app->field.f[0], app->field.fdup);
+        if (needs_redo_snapshot(app)) {
+          for (int i=0; i<ns; ++i)
+            swap_arrays(&app->species[i].f[0], &app->species[i].fdup);
+          if (app->has_field)
+            swap_arrays(&app->field.f[0], &app->field.fdup);
+        }
           
         break;
 
@@ -135,16 +135,13 @@ moment_update_ssp_rk3(gkyl_moment_app* app, double dt0)
           app->stat.nstage_2_fail += 1;
         }
         else {
-          for (int i=0; i<app->num_species; ++i) {
-            array_combine(app->species[i].f1,
+          // final combination is done in place: no copy back into f0
+          for (int i=0; i<app->num_species; ++i)
+            array_combine(app->species[i].f0,
               1.0/3.0, app->species[i].f0, 2.0/3.0, app->species[i].fnew, &app->local_ext);
-            gkyl_array_copy_range(app->species[i].f0, app->species[i].f1, &app->local_ext);
-          }
-          if (app->has_field) {
-            array_combine(app->field.f1,
+          if (app->has_field)
+            array_combine(app->field.f0,
               1.0/3.0, app->field.f0, 2.0/3.0, app->field.fnew, &app->local_ext);
-            gkyl_array_copy_range(app->field.f0, app->field.f1, &app->local_ext);
-          }
           
           state = RK_COMPLETE;
         }
@@ -19,6 +19,7 @@ gkyl_moment_app_new(struct gkyl_moment *mom)
   app->tcurr = 0.0; // reset on init
 
   app->scheme_type = mom->scheme_type;
+  app->skip_dt_predict = mom->skip_dt_predict;
   
   app->mp_recon = mom->mp_recon;
   app->use_hybrid_flux_kep = mom->use_hybrid_flux_kep;
@@ -35,6 +36,11 @@ gkyl_moment_app_new(struct gkyl_moment *mom)
     for (int d=0; d<3; ++d) ghost[d] = 3; // 3 for MP scheme and KEP
 
   for (int d=0; d<3; ++d) app->nghost[d] = ghost[d];
+
+  // job pool for threaded wave-propagation sweeps
+  app->job_pool = 0;
+  if (mom->num_threads > 1)
+    app->job_pool = gkyl_thread_pool_new(mom->num_threads);
   
   gkyl_rect_grid_init(&app->grid, ndim, mom->lower, mom->upper, mom->cells);
   gkyl_create_grid_ranges(&app->grid, ghost, &app->global_ext, &app->global);
@@ -96,7 +102,7 @@ gkyl_moment_app_new(struct gkyl_moment *mom)
 
     // write DG projection of mapc2p to file
     cstr fileNm = cstr_from_fmt("%s-mapc2p.gkyl", app->name);
-    gkyl_comm_array_write(app->comm, &app->grid, &app->local, c2p, fileNm.str);
+    gkyl_comm_array_write(app->comm, &app->grid, &app->local, 0, c2p, fileNm.str);
     cstr_drop(&fileNm);
 
     gkyl_array_release(c2p);
@@ -178,6 +184,8 @@ gkyl_moment_app_new(struct gkyl_moment *mom)
   // initialize stat object to all zeros
   app->stat = (struct gkyl_moment_stat) {
   };
+  app->dt_stable_step = DBL_MAX;
+  app->dt_stable_prev[0] = app->dt_stable_prev[1] = 0.0;
 
   return app;
 }
@@ -248,6 +256,101 @@ gkyl_moment_app_apply_ic_species(gkyl_moment_app* app, int sidx, double t0)
   moment_species_apply_bc(app, t0, &app->species[sidx], app->species[sidx].fcurr);
 }
 
+struct gkyl_app_restart_status
+gkyl_moment_app_from_file_field(gkyl_moment_app *app, const char *fname)
+{
+  struct gkyl_app_restart_status rstat = gkyl_app_array_read(app->comm,
+    &app->grid, &app->local, app->field.fcurr, fname);
+
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    // external EM field is not in the frame and must be recomputed
+    if (app->field.proj_ext_em) {
+      gkyl_fv_proj_advance(
+        app->field.proj_ext_em, rstat.stime, &app->local, app->field.ext_em);
+
+      if (app->field.is_ext_em_static)
+        app->field.was_ext_em_computed = true;
+      else
+        app->field.was_ext_em_computed = false;
+    }
+    moment_field_apply_bc(app, rstat.stime, &app->field, app->field.fcurr);
+  }
+
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_moment_app_from_file_species(gkyl_moment_app *app, int sidx,
+  const char *fname)
+{
+  assert(sidx < app->num_species);
+
+  struct gkyl_app_restart_status rstat = gkyl_app_array_read(app->comm,
+    &app->grid, &app->local, app->species[sidx].fcurr, fname);
+
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS)
+    moment_species_apply_bc(app, rstat.stime, &app->species[sidx], app->species[sidx].fcurr);
+
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_moment_app_from_frame_field(gkyl_moment_app *app, int frame)
+{
+  cstr fileNm = cstr_from_fmt("%s-%s_%d.gkyl", app->name, "field", frame);
+  struct gkyl_app_restart_status rstat = gkyl_moment_app_from_file_field(app, fileNm.str);
+  cstr_drop(&fileNm);
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_moment_app_from_frame_species(gkyl_moment_app *app, int sidx, int frame)
+{
+  cstr fileNm = cstr_from_fmt("%s-%s_%d.gkyl", app->name, app->species[sidx].name, frame);
+  struct gkyl_app_restart_status rstat = gkyl_moment_app_from_file_species(app, sidx, fileNm.str);
+  cstr_drop(&fileNm);
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_moment_app_read_from_frame(gkyl_moment_app *app, int frame)
+{
+  struct gkyl_app_restart_status rstat = {
+    .io_status = GKYL_ARRAY_RIO_SUCCESS,
+    .frame = frame,
+    .stime = 0.0
+  };
+
+  if (app->has_field == 1)
+    restart_status_merge(&rstat, gkyl_moment_app_from_frame_field(app, frame));
+  for (int i=0; i<app->num_species; ++i)
+    restart_status_merge(&rstat, gkyl_moment_app_from_frame_species(app, i, frame));
+
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    app->tcurr = rstat.stime;
+
+    // restore history of integrated diagnostics before restart time:
+    // only rank 0 writes these
+    int rank;
+    gkyl_comm_get_rank(app->comm, &rank);
+    if (rank == 0) {
+      if (app->has_field) {
+        cstr fileNm = cstr_from_fmt("%s-field-energy.gkyl", app->name);
+        gkyl_app_dynvec_restore(app->field.integ_energy, fileNm.str, rstat.stime);
+        cstr_drop(&fileNm);
+      }
+      for (int i=0; i<app->num_species; ++i) {
+        cstr fileNm = cstr_from_fmt("%s-%s-%s.gkyl", app->name, app->species[i].name,
+          "imom");
+        gkyl_app_dynvec_restore(app->species[i].integ_q, fileNm.str, rstat.stime);
+        cstr_drop(&fileNm);
+      }
+    }
+  }
+
+  return rstat;
+}
+
 void
 gkyl_moment_app_write(const gkyl_moment_app* app, double tm, int frame)
 {
@@ -261,16 +364,22 @@ gkyl_moment_app_write_field(const gkyl_moment_app* app, double tm, int frame)
 {
   if (app->has_field != 1) return;
 
+  struct gkyl_array_meta *mt = gkyl_app_frame_meta_new(
+    (struct gkyl_app_frame_meta) { .stime = tm, .frame = frame }
+  );
+
   cstr fileNm = cstr_from_fmt("%s-%s_%d.gkyl", app->name, "field", frame);
-  gkyl_comm_array_write(app->comm, &app->grid, &app->local, app->field.fcurr, fileNm.str);
+  gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, app->field.fcurr, fileNm.str);
   cstr_drop(&fileNm);
 
   // write external EM field if it is present
   if (app->field.ext_em) {
     cstr fileNm = cstr_from_fmt("%s-%s_%d.gkyl", app->name, "ext_em_field", frame);
-    gkyl_comm_array_write(app->comm, &app->grid, &app->local, app->field.ext_em, fileNm.str);
+    gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, app->field.ext_em, fileNm.str);
     cstr_drop(&fileNm);
   }
+
+  gkyl_app_frame_meta_release(mt);
 }
 
 void
@@ -325,15 +434,26 @@ gkyl_moment_app_write_integrated_mom(gkyl_moment_app *app)
 void
 gkyl_moment_app_write_species(const gkyl_moment_app* app, int sidx, double tm, int frame)
 {
+  struct gkyl_array_meta *mt = gkyl_app_frame_meta_new(
+    (struct gkyl_app_frame_meta) { .stime = tm, .frame = frame }
+  );
+
   cstr fileNm = cstr_from_fmt("%s-%s_%d.gkyl", app->name, app->species[sidx].name, frame);
-  gkyl_comm_array_write(app->comm, &app->grid, &app->local, app->species[sidx].fcurr, fileNm.str);
+  gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, app->species[sidx].fcurr, fileNm.str);
   cstr_drop(&fileNm);
 
   if (app->scheme_type == GKYL_MOMENT_KEP) {
     cstr fileNm = cstr_from_fmt("%s-%s-alpha_%d.gkyl", app->name, app->species[sidx].name, frame);
-    gkyl_comm_array_write(app->comm, &app->grid, &app->local, app->species[sidx].alpha, fileNm.str);
+    gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, app->species[sidx].alpha, fileNm.str);
     cstr_drop(&fileNm);
   }
+  if (app->species[sidx].fix_count) {
+    cstr fileNm = cstr_from_fmt("%s-%s-fix_count_%d.gkyl", app->name, app->species[sidx].name, frame);
+    gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, app->species[sidx].fix_count, fileNm.str);
+    cstr_drop(&fileNm);
+  }
+
+  gkyl_app_frame_meta_release(mt);
 }
 
 struct gkyl_update_status
@@ -400,10 +520,11 @@ comm_reduce_app_stat(const gkyl_moment_app* app, const struct gkyl_moment_stat *
     return;
   }
 
-  enum { NUP, NFAIL, NFEULER, NSTAGE_2_FAIL, NSTAGE_3_FAIL, L_END };
+  enum { NUP, NFAIL, NDT_PREDICT, NFEULER, NSTAGE_2_FAIL, NSTAGE_3_FAIL, L_END };
   int64_t l_red[] = {
     [NUP] = local->nup,
     [NFAIL] = local->nfail,
+    [NDT_PREDICT] = local->ndt_predict,
     [NFEULER] = local->nfeuler,
     [NSTAGE_2_FAIL] = local->nstage_2_fail,
     [NSTAGE_3_FAIL] = local->nstage_3_fail
@@ -414,11 +535,12 @@ comm_reduce_app_stat(const gkyl_moment_app* app, const struct gkyl_moment_stat *
 
   global->nup = l_red_global[NUP];
   global->nfail = l_red_global[NFAIL];
+  global->ndt_predict = l_red_global[NDT_PREDICT];
   global->nfeuler = l_red_global[NFEULER];
   global->nstage_2_fail = l_red_global[NSTAGE_2_FAIL];
   global->nstage_3_fail = l_red_global[NSTAGE_3_FAIL];
 
-  enum { TOTAL_TM, SPECIES_TM, FIELD_TM, SOURCES_TM, INIT_SPECIES_TM, INIT_FIELD_TM,
+  enum { TOTAL_TM, SPECIES_TM, FIELD_TM, SOURCES_TM, REDO_TM, INIT_SPECIES_TM, INIT_FIELD_TM,
     SPECIES_RHS_TM, FIELD_RHS_TM, SPECIES_BC_TM, FIELD_BC_TM,
     D_END
   };
@@ -428,6 +550,7 @@ comm_reduce_app_stat(const gkyl_moment_app* app, const struct gkyl_moment_stat *
     [SPECIES_TM] = local->species_tm,
     [FIELD_TM] = local->field_tm,
     [SOURCES_TM] = local->sources_tm,
+    [REDO_TM] = local->redo_tm,
     [INIT_SPECIES_TM] = local->init_species_tm,
     [INIT_FIELD_TM] = local->init_field_tm,
     [SPECIES_RHS_TM] = local->species_rhs_tm,
@@ -443,6 +566,7 @@ comm_reduce_app_stat(const gkyl_moment_app* app, const struct gkyl_moment_stat *
   global->species_tm = d_red_global[SPECIES_TM];
   global->field_tm = d_red_global[FIELD_TM];
   global->sources_tm = d_red_global[SOURCES_TM];
+  global->redo_tm = d_red_global[REDO_TM];
   global->init_species_tm = d_red_global[INIT_SPECIES_TM];
   global->init_field_tm = d_red_global[INIT_FIELD_TM];
   global->species_rhs_tm = d_red_global[SPECIES_RHS_TM];
@@ -462,11 +586,12 @@ comm_reduce_wave_prop_stats(const gkyl_moment_app* app, const struct gkyl_wave_p
     return;
   }
 
-  enum { N_CALLS, N_BAD_ADVANCE_CALLS, N_MAX_BAD_CELLS, L_END };
+  enum { N_CALLS, N_BAD_ADVANCE_CALLS, N_MAX_BAD_CELLS, N_FAILED_CALLS, L_END };
   int64_t l_red[] = {
     [N_CALLS] = local->n_calls,
     [N_BAD_ADVANCE_CALLS] = local->n_bad_advance_calls,
-    [N_MAX_BAD_CELLS] = local->n_max_bad_cells
+    [N_MAX_BAD_CELLS] = local->n_max_bad_cells,
+    [N_FAILED_CALLS] = local->n_failed_calls
   };
 
   int64_t l_red_global[L_END];
@@ -475,11 +600,17 @@ comm_reduce_wave_prop_stats(const gkyl_moment_app* app, const struct gkyl_wave_p
   global->n_calls = l_red_global[N_CALLS];
   global->n_bad_advance_calls = l_red_global[N_BAD_ADVANCE_CALLS];
   global->n_max_bad_cells = l_red_global[N_MAX_BAD_CELLS];
+  global->n_failed_calls = l_red_global[N_FAILED_CALLS];
 
-  int64_t n_bad_cells_local = local->n_bad_cells, n_bad_cells = 0;
+  int64_t n_bad_cells_local[2] = { local->n_bad_cells, local->n_failed_bad_cells };
+  int64_t n_bad_cells[2] = { 0 };
   
-  gkyl_comm_all_reduce(app->comm, GKYL_INT_64, GKYL_SUM, 1, &n_bad_cells_local, &n_bad_cells);
-  global->n_bad_cells = n_bad_cells;
+  gkyl_comm_all_reduce(app->comm, GKYL_INT_64, GKYL_SUM, 2, n_bad_cells_local, n_bad_cells);
+  global->n_bad_cells = n_bad_cells[0];
+  global->n_failed_bad_cells = n_bad_cells[1];
+
+  // report timings of slowest rank
+  gkyl_comm_all_reduce(app->comm, GKYL_DOUBLE, GKYL_MAX, GKYL_MAX_DIM, local->sweep_tm, global->sweep_tm);
 }
 
 void
@@ -521,7 +652,10 @@ gkyl_moment_app_stat_write(const gkyl_moment_app* app)
   if (app->scheme_type == GKYL_MOMENT_WAVE_PROP) {
     gkyl_moment_app_cout(app, fp, " species_tm : %lg,\n", stat.species_tm);
     gkyl_moment_app_cout(app, fp, " field_tm : %lg,\n", stat.field_tm);
-    gkyl_moment_app_cout(app, fp, " sources_tm : %lg\n", stat.sources_tm);
+    gkyl_moment_app_cout(app, fp, " sources_tm : %lg,\n", stat.sources_tm);
+    gkyl_moment_app_cout(app, fp, " redo_frac : %lg,\n", stat.nup > 0 ? (double) stat.nfail/stat.nup : 0.0);
+    gkyl_moment_app_cout(app, fp, " redo_tm : %lg,\n", stat.redo_tm);
+    gkyl_moment_app_cout(app, fp, " ndt_predict : %ld,\n", stat.ndt_predict);
   }
   else if (app->scheme_type == GKYL_MOMENT_MP || app->scheme_type == GKYL_MOMENT_KEP) {
     
@@ -563,6 +697,13 @@ gkyl_moment_app_stat_write(const gkyl_moment_app* app)
           app->species[i].name, d, wvs.n_bad_cells);
         gkyl_moment_app_cout(app, fp, " %s_n_max_bad_cells[%d] = %ld\n",
           app->species[i].name, d, wvs.n_max_bad_cells);
+        gkyl_moment_app_cout(app, fp, " %s_sweep_tm[%d] = %lg\n",
+          app->species[i].name, d, wvs.sweep_tm[d]);
+        // fixes in steps that were redone are not in the counts above
+        gkyl_moment_app_cout(app, fp, " %s_n_failed_calls[%d] = %ld\n",
+          app->species[i].name, d, wvs.n_failed_calls);
+        gkyl_moment_app_cout(app, fp, " %s_n_failed_bad_cells[%d] = %ld\n",
+          app->species[i].name, d, wvs.n_failed_bad_cells);
 
         tot_bad_cells += wvs.n_bad_cells;
       }
@@ -604,20 +745,23 @@ gkyl_moment_app_release(gkyl_moment_app* app)
   if (app->update_sources)
     moment_coupling_release(app, &app->sources);
 
-  gkyl_comm_release(app->comm);
-  
   for (int i=0; i<app->num_species; ++i)
-    moment_species_release(&app->species[i]);
+    moment_species_release(app, &app->species[i]);
   gkyl_free(app->species);
 
   if (app->has_field)
-    moment_field_release(&app->field);
+    moment_field_release(app, &app->field);
+
+  gkyl_comm_release(app->comm);
 
   if (app->update_mhd_source)
     mhd_src_release(&app->mhd_source);
 
   gkyl_wave_geom_release(app->geom);
 
+  if (app->job_pool)
+    gkyl_job_pool_release(app->job_pool);
+
   if (app->scheme_type == GKYL_MOMENT_MP || app->scheme_type == GKYL_MOMENT_KEP) {
     gkyl_array_release(app->ql);
     gkyl_array_release(app->qr);
@@ -156,7 +156,7 @@ gkyl_pkpm_app_new(struct gkyl_pkpm *pkpm)
 
     // write DG projection of mapc2p to file
     cstr fileNm = cstr_from_fmt("%s-mapc2p.gkyl", app->name);
-    gkyl_comm_array_write(app->comm, &app->grid, &app->local, c2p, fileNm.str);
+    gkyl_comm_array_write(app->comm, &app->grid, &app->local, 0, c2p, fileNm.str);
     cstr_drop(&fileNm);
 
     gkyl_array_release(c2p);
@@ -275,8 +275,135 @@ gkyl_pkpm_app_apply_ic_species(gkyl_pkpm_app* app, int sidx, double t0)
   pkpm_fluid_species_apply_bc(app, &app->species[sidx], app->species[sidx].fluid);
 }
 
+struct gkyl_app_restart_status
+gkyl_pkpm_app_from_file_field(gkyl_pkpm_app *app, const char *fname)
+{
+  struct timespec wtm = gkyl_wall_clock();
+  struct gkyl_app_restart_status rstat = gkyl_app_array_read(app->comm,
+    &app->grid, &app->local, app->field->em_host, fname);
+
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    if (app->use_gpu)
+      gkyl_array_copy(app->field->em, app->field->em_host);
+    // external EM field and applied current are not in the frame
+    pkpm_field_calc_ext_em(app, app->field, rstat.stime);
+    pkpm_field_calc_app_current(app, app->field, rstat.stime);
+    pkpm_field_apply_bc(app, app->field, app->field->em);
+    pkpm_field_calc_bvar(app, app->field, app->field->em);
+  }
+  app->stat.init_field_tm += gkyl_time_diff_now_sec(wtm);
+
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_pkpm_app_from_file_species(gkyl_pkpm_app *app, int sidx,
+  const char *fname, const char *fname_fluid)
+{
+  assert(sidx < app->num_species);
+  struct pkpm_species *s = &app->species[sidx];
+
+  struct timespec wtm = gkyl_wall_clock();
+  struct gkyl_app_frame_meta fm;
+  struct gkyl_app_restart_status rstat = {
+    .io_status = gkyl_app_frame_meta_read(fname, &fm)
+  };
+  if (rstat.io_status != GKYL_ARRAY_RIO_SUCCESS)
+    return rstat;
+
+  // project ICs first: this fills the buffers needed by fixed-function
+  // BCs and the applied acceleration. Both f and fluid are then
+  // overwritten by the data in the frame
+  pkpm_species_apply_ic(app, s, fm.stime);
+
+  rstat = gkyl_app_array_read(s->comm, &s->grid, &s->local, s->f_host, fname);
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    // fluid state (momentum) is stored in components 1-3 of the
+    // conserved fluid variables written with the moments
+    restart_status_merge(&rstat, gkyl_app_array_read(app->comm,
+        &app->grid, &app->local, s->fluid_io_host, fname_fluid));
+  }
+
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    gkyl_array_set_offset(s->fluid_host, 1.0, s->fluid_io_host, app->confBasis.num_basis);
+    if (app->use_gpu) {
+      gkyl_array_copy(s->f, s->f_host);
+      gkyl_array_copy(s->fluid, s->fluid_host);
+    }
+    pkpm_species_apply_bc(app, s, s->f);
+    pkpm_fluid_species_apply_bc(app, s, s->fluid);
+  }
+  app->stat.init_species_tm += gkyl_time_diff_now_sec(wtm);
+
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_pkpm_app_from_frame_field(gkyl_pkpm_app *app, int frame)
+{
+  cstr fileNm = cstr_from_fmt("%s-field_%d.gkyl", app->name, frame);
+  struct gkyl_app_restart_status rstat = gkyl_pkpm_app_from_file_field(app, fileNm.str);
+  cstr_drop(&fileNm);
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_pkpm_app_from_frame_species(gkyl_pkpm_app *app, int sidx, int frame)
+{
+  const char *nm = app->species[sidx].info.name;
+  cstr fileNm = cstr_from_fmt("%s-%s_%d.gkyl", app->name, nm, frame);
+  cstr fileNm_fluid = cstr_from_fmt("%s-%s_pkpm_fluid_%d.gkyl", app->name, nm, frame);
+  struct gkyl_app_restart_status rstat = gkyl_pkpm_app_from_file_species(app, sidx,
+    fileNm.str, fileNm_fluid.str);
+  cstr_drop(&fileNm);
+  cstr_drop(&fileNm_fluid);
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_pkpm_app_read_from_frame(gkyl_pkpm_app *app, int frame)
+{
+  struct gkyl_app_restart_status rstat = {
+    .io_status = GKYL_ARRAY_RIO_SUCCESS,
+    .frame = frame,
+    .stime = 0.0
+  };
+
+  restart_status_merge(&rstat, gkyl_pkpm_app_from_frame_field(app, frame));
+  for (int i=0; i<app->num_species; ++i)
+    restart_status_merge(&rstat, gkyl_pkpm_app_from_frame_species(app, i, frame));
+
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    app->tcurr = rstat.stime;
+
+    // restore history of integrated diagnostics before restart time:
+    // only rank 0 writes these
+    int rank;
+    gkyl_comm_get_rank(app->comm, &rank);
+    if (rank == 0) {
+      cstr fileNm = cstr_from_fmt("%s-field-energy.gkyl", app->name);
+      gkyl_app_dynvec_restore(app->field->integ_energy, fileNm.str, rstat.stime);
+      cstr_drop(&fileNm);
+
+      for (int i=0; i<app->num_species; ++i) {
+        const char *nm = app->species[i].info.name;
+        cstr fileNm_imom = cstr_from_fmt("%s-%s-%s.gkyl", app->name, nm, "imom");
+        gkyl_app_dynvec_restore(app->species[i].integ_diag, fileNm_imom.str, rstat.stime);
+        cstr_drop(&fileNm_imom);
+
+        cstr fileNm_L2 = cstr_from_fmt("%s-%s-%s.gkyl", app->name, nm, "L2");
+        gkyl_app_dynvec_restore(app->species[i].integ_L2_f, fileNm_L2.str, rstat.stime);
+        cstr_drop(&fileNm_L2);
+      }
+    }
+  }
+
+  return rstat;
+}
+
 void
 gkyl_pkpm_app_calc_integrated_mom(gkyl_pkpm_app* app, double tm)
+
 {
   double avals[9], avals_global[9];
 
@@ -346,6 +473,10 @@ gkyl_pkpm_app_write(gkyl_pkpm_app* app, double tm, int frame)
 void
 gkyl_pkpm_app_write_field(gkyl_pkpm_app* app, double tm, int frame)
 {
+  struct gkyl_array_meta *mt = gkyl_app_frame_meta_new(
+    (struct gkyl_app_frame_meta) { .stime = tm, .frame = frame }
+  );
+
   const char *fmt = "%s-field_%d.gkyl";
   int sz = gkyl_calc_strlen(fmt, app->name, frame);
   char fileNm[sz+1]; // ensures no buffer overflow
@@ -354,10 +485,10 @@ gkyl_pkpm_app_write_field(gkyl_pkpm_app* app, double tm, int frame)
   if (app->use_gpu) {
     // copy data from device to host before writing it out
     gkyl_array_copy(app->field->em_host, app->field->em);
-    gkyl_comm_array_write(app->comm, &app->grid, &app->local, app->field->em_host, fileNm);
+    gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, app->field->em_host, fileNm);
   }
   else {
-    gkyl_comm_array_write(app->comm, &app->grid, &app->local, app->field->em, fileNm);
+    gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, app->field->em, fileNm);
   }
 
   if (app->field->has_ext_em) {
@@ -370,7 +501,7 @@ gkyl_pkpm_app_write_field(gkyl_pkpm_app* app, double tm, int frame)
 
       // External EM field computed with project on basis, so just use host copy 
       pkpm_field_calc_ext_em(app, app->field, tm);
-      gkyl_comm_array_write(app->comm, &app->grid, &app->local, app->field->ext_em_host, fileNm_ext_em);
+      gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, app->field->ext_em_host, fileNm_ext_em);
     }
   }
 
@@ -384,9 +515,11 @@ gkyl_pkpm_app_write_field(gkyl_pkpm_app* app, double tm, int frame)
 
       // Applied currents computed with project on basis, so just use host copy 
       pkpm_field_calc_app_current(app, app->field, tm);
-      gkyl_comm_array_write(app->comm, &app->grid, &app->local, app->field->app_current_host, fileNm_app_current);
+      gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, app->field->app_current_host, fileNm_app_current);
     }
-  }  
+  }
+
+  gkyl_app_frame_meta_release(mt);
 }
 
 void
@@ -397,16 +530,22 @@ gkyl_pkpm_app_write_species(gkyl_pkpm_app* app, int sidx, double tm, int frame)
   char fileNm[sz+1]; // ensures no buffer overflow
   snprintf(fileNm, sizeof fileNm, fmt, app->name, app->species[sidx].info.name, frame);
 
+  struct gkyl_array_meta *mt = gkyl_app_frame_meta_new(
+    (struct gkyl_app_frame_meta) { .stime = tm, .frame = frame }
+  );
+
   if (app->use_gpu) {
     // copy data from device to host before writing it out
     gkyl_array_copy(app->species[sidx].f_host, app->species[sidx].f);
     gkyl_comm_array_write(app->species[sidx].comm, &app->species[sidx].grid, &app->species[sidx].local,
-      app->species[sidx].f_host, fileNm);
+      mt, app->species[sidx].f_host, fileNm);
   }
   else {
     gkyl_comm_array_write(app->species[sidx].comm, &app->species[sidx].grid, &app->species[sidx].local,
-      app->species[sidx].f, fileNm);
+      mt, app->species[sidx].f, fileNm);
   }
+
+  gkyl_app_frame_meta_release(mt);
 }
 
 void
@@ -447,9 +586,15 @@ gkyl_pkpm_app_write_mom(gkyl_pkpm_app* app, int sidx, double tm, int frame)
     gkyl_array_copy(s->pkpm_vars_io_host, s->pkpm_vars_io);
   }
 
-  gkyl_comm_array_write(app->comm, &app->grid, &app->local, s->pkpm_moms_diag.marr_host, fileNm);
-  gkyl_comm_array_write(app->comm, &app->grid, &app->local, s->fluid_io_host, fileNm_fluid);
-  gkyl_comm_array_write(app->comm, &app->grid, &app->local, s->pkpm_vars_io_host, fileNm_pkpm_vars);
+  struct gkyl_array_meta *mt = gkyl_app_frame_meta_new(
+    (struct gkyl_app_frame_meta) { .stime = tm, .frame = frame }
+  );
+
+  gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, s->pkpm_moms_diag.marr_host, fileNm);
+  gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, s->fluid_io_host, fileNm_fluid);
+  gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, s->pkpm_vars_io_host, fileNm_pkpm_vars);
+
+  gkyl_app_frame_meta_release(mt);
 }
 
 void
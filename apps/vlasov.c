@@ -7,6 +7,7 @@
 #include <gkyl_dynvec.h>
 #include <gkyl_null_comm.h>
 
+#include <gkyl_vlasov_kernel_cost.h>
 #include <gkyl_vlasov_priv.h>
 
 gkyl_vlasov_app*
@@ -34,6 +35,13 @@ gkyl_vlasov_app_new(struct gkyl_vm *vm)
   app->use_gpu = false; // can't use GPUs if we don't have them!
 #endif
 
+  // job pool for threaded CPU updates: not created for serial or GPU runs
+  app->job_pool = 0;
+  if (!app->use_gpu && vm->num_threads > 1)
+    app->job_pool = gkyl_thread_pool_new(vm->num_threads);
+  app->use_kernel_stat = !app->use_gpu && vm->use_kernel_stat;
+  app->use_deterministic_moms = vm->use_deterministic_moms;
+
   app->num_periodic_dir = vm->num_periodic_dir;
   for (int d=0; d<cdim; ++d)
     app->periodic_dirs[d] = vm->periodic_dirs[d];
@@ -168,7 +176,7 @@ gkyl_vlasov_app_new(struct gkyl_vm *vm)
 
     // write DG projection of mapc2p to file
     cstr fileNm = cstr_from_fmt("%s-mapc2p.gkyl", app->name);
-    gkyl_comm_array_write(app->comm, &app->grid, &app->local, c2p, fileNm.str);
+    gkyl_comm_array_write(app->comm, &app->grid, &app->local, 0, c2p, fileNm.str);
     cstr_drop(&fileNm);
 
     gkyl_array_release(c2p);
@@ -353,6 +361,163 @@ gkyl_vlasov_app_apply_ic_fluid_species(gkyl_vlasov_app* app, int sidx, double t0
   vm_fluid_species_apply_bc(app, &app->fluid_species[sidx], app->fluid_species[sidx].fluid);
 }
 
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_file_field(gkyl_vlasov_app *app, const char *fname)
+{
+  struct timespec wtm = gkyl_wall_clock();
+  struct gkyl_app_restart_status rstat = gkyl_app_array_read(app->comm,
+    &app->grid, &app->local, app->field->em_host, fname);
+
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    if (app->use_gpu)
+      gkyl_array_copy(app->field->em, app->field->em_host);
+    // time-independent external EM field and applied current are not
+    // in the frame and must be recomputed
+    vm_field_calc_ext_em(app, app->field, rstat.stime);
+    vm_field_calc_app_current(app, app->field, rstat.stime);
+    vm_field_apply_bc(app, app->field, app->field->em);
+  }
+  app->stat.init_field_tm += gkyl_time_diff_now_sec(wtm);
+
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_file_species(gkyl_vlasov_app *app, int sidx,
+  const char *fname)
+{
+  assert(sidx < app->num_species);
+  struct vm_species *vm_s = &app->species[sidx];
+
+  struct timespec wtm = gkyl_wall_clock();
+  struct gkyl_app_restart_status rstat = gkyl_app_array_read(vm_s->comm,
+    &vm_s->grid, &vm_s->local, vm_s->f_host, fname);
+
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    if (app->use_gpu)
+      gkyl_array_copy(vm_s->f, vm_s->f_host);
+    vm_species_restart_init(app, vm_s, rstat.stime);
+    vm_species_apply_bc(app, vm_s, vm_s->f);
+  }
+  app->stat.init_species_tm += gkyl_time_diff_now_sec(wtm);
+
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_file_fluid_species(gkyl_vlasov_app *app, int sidx,
+  const char *fname)
+{
+  assert(sidx < app->num_fluid_species);
+  struct vm_fluid_species *fs = &app->fluid_species[sidx];
+
+  struct timespec wtm = gkyl_wall_clock();
+  struct gkyl_app_restart_status rstat = gkyl_app_array_read(app->comm,
+    &app->grid, &app->local, fs->fluid_host, fname);
+
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    if (app->use_gpu)
+      gkyl_array_copy(fs->fluid, fs->fluid_host);
+    vm_fluid_species_calc_app_accel(app, fs, rstat.stime);
+    vm_fluid_species_source_calc(app, fs, rstat.stime);
+    vm_fluid_species_apply_bc(app, fs, fs->fluid);
+  }
+  app->stat.init_fluid_species_tm += gkyl_time_diff_now_sec(wtm);
+
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_frame_field(gkyl_vlasov_app *app, int frame)
+{
+  cstr fileNm = cstr_from_fmt("%s-field_%d.gkyl", app->name, frame);
+  struct gkyl_app_restart_status rstat = gkyl_vlasov_app_from_file_field(app, fileNm.str);
+  cstr_drop(&fileNm);
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_frame_species(gkyl_vlasov_app *app, int sidx, int frame)
+{
+  cstr fileNm = cstr_from_fmt("%s-%s_%d.gkyl", app->name, app->species[sidx].info.name, frame);
+  struct gkyl_app_restart_status rstat = gkyl_vlasov_app_from_file_species(app, sidx, fileNm.str);
+  cstr_drop(&fileNm);
+  return rstat;
+}
+
+struct gkyl_app_restart_status
+gkyl_vlasov_app_from_frame_fluid_species(gkyl_vlasov_app *app, int sidx, int frame)
+{
+  cstr fileNm = cstr_from_fmt("%s-%s_%d.gkyl", app->name, app->fluid_species[sidx].info.name, frame);
+  struct gkyl_app_restart_status rstat = gkyl_vlasov_app_from_file_fluid_species(app, sidx, fileNm.str);
+  cstr_drop(&fileNm);
+  return rstat;
+}
+
+// Restore history of integrated diagnostics before restart time. Only
+// rank 0 writes these, so only it needs the history.
+static void
+vm_restore_integrated_diag(gkyl_vlasov_app *app, double stime)
+{
+  int rank;
+  gkyl_comm_get_rank(app->comm, &rank);
+  if (rank != 0) return;
+
+  for (int i=0; i<app->num_species; ++i) {
+    struct vm_species *vm_s = &app->species[i];
+
+    cstr fileNm = cstr_from_fmt("%s-%s-%s.gkyl", app->name, vm_s->info.name, "imom");
+    gkyl_app_dynvec_restore(vm_s->integ_diag, fileNm.str, stime);
+    cstr_drop(&fileNm);
+
+    if (vm_s->source_id && vm_s->src.write_source) {
+      fileNm = cstr_from_fmt("%s-%s-source-%s.gkyl", app->name, vm_s->info.name, "imom");
+      gkyl_app_dynvec_restore(vm_s->src.integ_diag, fileNm.str, stime);
+      cstr_drop(&fileNm);
+    }
+
+    fileNm = cstr_from_fmt("%s-%s-%s.gkyl", app->name, vm_s->info.name, "L2");
+    gkyl_app_dynvec_restore(vm_s->integ_L2_f, fileNm.str, stime);
+    cstr_drop(&fileNm);
+
+    if (vm_s->collision_id == GKYL_BGK_COLLISIONS) {
+      fileNm = cstr_from_fmt("%s-%s-%s.gkyl", app->name, vm_s->info.name, "corr-lte-stat");
+      gkyl_app_dynvec_restore(vm_s->bgk.lte.corr_stat, fileNm.str, stime);
+      cstr_drop(&fileNm);
+    }
+  }
+
+  if (app->has_field) {
+    cstr fileNm = cstr_from_fmt("%s-field-energy.gkyl", app->name);
+    gkyl_app_dynvec_restore(app->field->integ_energy, fileNm.str, stime);
+    cstr_drop(&fileNm);
+  }
+}
+
+struct gkyl_app_restart_status
+gkyl_vlasov_app_read_from_frame(gkyl_vlasov_app *app, int frame)
+{
+  struct gkyl_app_restart_status rstat = {
+    .io_status = GKYL_ARRAY_RIO_SUCCESS,
+    .frame = frame,
+    .stime = 0.0
+  };
+
+  if (app->has_field)
+    restart_status_merge(&rstat, gkyl_vlasov_app_from_frame_field(app, frame));
+  for (int i=0; i<app->num_species; ++i)
+    restart_status_merge(&rstat, gkyl_vlasov_app_from_frame_species(app, i, frame));
+  for (int i=0; i<app->num_fluid_species; ++i)
+    restart_status_merge(&rstat, gkyl_vlasov_app_from_frame_fluid_species(app, i, frame));
+
+  if (rstat.io_status == GKYL_ARRAY_RIO_SUCCESS) {
+    app->tcurr = rstat.stime;
+    vm_restore_integrated_diag(app, rstat.stime);
+  }
+
+  return rstat;
+}
+
 void
 gkyl_vlasov_app_calc_mom(gkyl_vlasov_app* app)
 {
@@ -487,14 +652,20 @@ gkyl_vlasov_app_write_field(gkyl_vlasov_app* app, double tm, int frame)
   char fileNm[sz+1]; // ensures no buffer overflow
   snprintf(fileNm, sizeof fileNm, fmt, app->name, frame);
 
+  struct gkyl_array_meta *mt = gkyl_app_frame_meta_new(
+    (struct gkyl_app_frame_meta) { .stime = tm, .frame = frame }
+  );
+
   if (app->use_gpu) {
     // copy data from device to host before writing it out
     gkyl_array_copy(app->field->em_host, app->field->em);
-    gkyl_comm_array_write(app->comm, &app->grid, &app->local, app->field->em_host, fileNm);
+    gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, app->field->em_host, fileNm);
   }
   else {
-    gkyl_comm_array_write(app->comm, &app->grid, &app->local, app->field->em, fileNm);
+    gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, app->field->em, fileNm);
   }
+
+  gkyl_app_frame_meta_release(mt);
 }
 
 void
@@ -507,11 +678,15 @@ gkyl_vlasov_app_write_species(gkyl_vlasov_app* app, int sidx, double tm, int fra
   char fileNm[sz+1]; // ensures no buffer overflow
   snprintf(fileNm, sizeof fileNm, fmt, app->name, vm_s->info.name, frame);
 
+  struct gkyl_array_meta *mt = gkyl_app_frame_meta_new(
+    (struct gkyl_app_frame_meta) { .stime = tm, .frame = frame }
+  );
+
   if (app->use_gpu) {
     // copy data from device to host before writing it out
     gkyl_array_copy(vm_s->f_host, vm_s->f);
   }
-  gkyl_comm_array_write(vm_s->comm, &vm_s->grid, &vm_s->local, 
+  gkyl_comm_array_write(vm_s->comm, &vm_s->grid, &vm_s->local, mt,
     vm_s->f_host, fileNm);  
 
   if (vm_s->source_id) {
@@ -526,10 +701,12 @@ gkyl_vlasov_app_write_species(gkyl_vlasov_app* app, int sidx, double tm, int fra
         gkyl_array_copy(vm_s->src.source_host, vm_s->src.source);
       }
 
-      gkyl_comm_array_write(vm_s->comm, &vm_s->grid, &vm_s->local, 
-        vm_s->src.source_host, fileNm); 
+      gkyl_comm_array_write(vm_s->comm, &vm_s->grid, &vm_s->local, mt,
+        vm_s->src.source_host, fileNm_source); 
     }
   }  
+
+  gkyl_app_frame_meta_release(mt);
 }
 
 void
@@ -543,17 +720,23 @@ gkyl_vlasov_app_write_species_lte(gkyl_vlasov_app* app, int sidx, double tm, int
   if (app->species[sidx].info.output_f_lte) {
     vm_species_lte(app, &app->species[sidx], &app->species[sidx].lte, app->species[sidx].f);
   }
-  
+
+  struct gkyl_array_meta *mt = gkyl_app_frame_meta_new(
+    (struct gkyl_app_frame_meta) { .stime = tm, .frame = frame }
+  );
+
   if (app->use_gpu) {
     // copy data from device to host before writing it out
     gkyl_array_copy(app->species[sidx].f_host, app->species[sidx].lte.f_lte);
     gkyl_comm_array_write(app->species[sidx].comm, &app->species[sidx].grid, &app->species[sidx].local,
-      app->species[sidx].f_host, fileNm);
+      mt, app->species[sidx].f_host, fileNm);
   }
   else {
     gkyl_comm_array_write(app->species[sidx].comm, &app->species[sidx].grid, &app->species[sidx].local,
-      app->species[sidx].lte.f_lte, fileNm);
+      mt, app->species[sidx].lte.f_lte, fileNm);
   }
+
+  gkyl_app_frame_meta_release(mt);
 }
 
 void
@@ -563,17 +746,28 @@ gkyl_vlasov_app_write_fluid_species(gkyl_vlasov_app* app, int sidx, double tm, i
   int sz = gkyl_calc_strlen(fmt, app->name, app->fluid_species[sidx].info.name, frame);
   char fileNm[sz+1]; // ensures no buffer overflow
   snprintf(fileNm, sizeof fileNm, fmt, app->name, app->fluid_species[sidx].info.name, frame);
+
+  struct gkyl_array_meta *mt = gkyl_app_frame_meta_new(
+    (struct gkyl_app_frame_meta) { .stime = tm, .frame = frame }
+  );
+
   // copy data from device to host before writing it out
   if (app->use_gpu) 
     gkyl_array_copy(app->fluid_species[sidx].fluid_host, app->fluid_species[sidx].fluid);
 
-  gkyl_comm_array_write(app->comm, &app->grid, &app->local,
+  gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt,
     app->fluid_species[sidx].fluid_host, fileNm);
+
+  gkyl_app_frame_meta_release(mt);
 }
 
 void
 gkyl_vlasov_app_write_mom(gkyl_vlasov_app* app, double tm, int frame)
 {
+  struct gkyl_array_meta *mt = gkyl_app_frame_meta_new(
+    (struct gkyl_app_frame_meta) { .stime = tm, .frame = frame }
+  );
+
   for (int i=0; i<app->num_species; ++i) {
     struct vm_species *vm_s = &app->species[i];
 
@@ -589,7 +783,7 @@ gkyl_vlasov_app_write_mom(gkyl_vlasov_app* app, double tm, int frame)
       if (app->use_gpu) {
         gkyl_array_copy(vm_s->moms[m].marr_host, vm_s->moms[m].marr);
       }
-      gkyl_comm_array_write(app->comm, &app->grid, &app->local, vm_s->moms[m].marr_host, fileNm);
+      gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, vm_s->moms[m].marr_host, fileNm);
 
       if (vm_s->source_id) {
         if (vm_s->src.write_source) {
@@ -603,11 +797,13 @@ gkyl_vlasov_app_write_mom(gkyl_vlasov_app* app, double tm, int frame)
           if (app->use_gpu) {
             gkyl_array_copy(vm_s->src.moms[m].marr_host, vm_s->src.moms[m].marr);
           }
-          gkyl_comm_array_write(app->comm, &app->grid, &app->local, vm_s->src.moms[m].marr_host, fileNm_source); 
+          gkyl_comm_array_write(app->comm, &app->grid, &app->local, mt, vm_s->src.moms[m].marr_host, fileNm_source); 
         }
       }      
     }
   }
+
+  gkyl_app_frame_meta_release(mt);
 }
 
 void
@@ -639,7 +835,7 @@ gkyl_vlasov_app_write_integrated_mom(gkyl_vlasov_app *app)
         if (vm_s->src.write_source) { 
           // write out integrated diagnostic moments from sources
           const char *fmt_source = "%s-%s-source-%s.gkyl";
-          int sz_source = gkyl_calc_strlen(fmt, app->name, vm_s->info.name,
+          int sz_source = gkyl_calc_strlen(fmt_source, app->name, vm_s->info.name,
             "imom");
           char fileNm_source[sz_source+1]; // ensures no buffer overflow
           snprintf(fileNm_source, sizeof fileNm_source, fmt_source, app->name, vm_s->info.name,
@@ -850,6 +1046,24 @@ comm_reduce_app_stat(const gkyl_vlasov_app* app,
     global->niter_self_bgk_corr[s] = l_red_bgk_corr[s];
   }
 
+  // per-cell iteration counts: total is summed and the largest is maxed over ranks
+  int64_t l_red_cell_iter[2*app->num_species];
+  for (int s=0; s<app->num_species; ++s) {
+    l_red_cell_iter[s] = local->ncell_iter_self_bgk_corr[s];
+    l_red_cell_iter[app->num_species+s] = local->max_cell_iter_self_bgk_corr[s];
+  }
+
+  int64_t l_red_global_cell_iter[2*app->num_species];
+  gkyl_comm_all_reduce(app->comm, GKYL_INT_64, GKYL_SUM, app->num_species, 
+    l_red_cell_iter, l_red_global_cell_iter);
+  gkyl_comm_all_reduce(app->comm, GKYL_INT_64, GKYL_MAX, app->num_species, 
+    l_red_cell_iter+app->num_species, l_red_global_cell_iter+app->num_species);
+
+  for (int s=0; s<app->num_species; ++s) {
+    global->ncell_iter_self_bgk_corr[s] = l_red_global_cell_iter[s];
+    global->max_cell_iter_self_bgk_corr[s] = l_red_global_cell_iter[app->num_species+s];
+  }
+
   enum {
     TOTAL_TM, RK3_TM, FL_EM_TM, 
     INIT_SPECIES_TM, INIT_FLUID_SPECIES_TM, INIT_FIELD_TM, 
@@ -927,6 +1141,96 @@ comm_reduce_app_stat(const gkyl_vlasov_app* app,
     global->species_lbo_coll_diff_tm);
 }
 
+// write one row of the roofline table
+static void
+roofline_row_write(gkyl_vlasov_app* app, FILE *fp, const char *species_nm,
+  const char *kern_nm, double ncall, double tm)
+{
+  gkyl_vlasov_app_cout(app, fp, "%-10s %-48s %12.0f %10.4g %10.4g", species_nm, kern_nm,
+    ncall, tm, 1e9*tm/ncall);
+
+  const struct gkyl_kern_cost *cost = gkyl_vlasov_kernel_cost(kern_nm);
+  if (cost && tm > 0)
+    gkyl_vlasov_app_cout(app, fp, " %10ld %10ld %10.3g %10.4g %10.4g\n",
+      cost->flops, cost->bytes, (double) cost->flops/cost->bytes,
+      1e-9*cost->flops*ncall/tm, 1e-9*cost->bytes*ncall/tm);
+  else
+    gkyl_vlasov_app_cout(app, fp, " %10s %10s %10s %10s %10s\n", "-", "-", "-", "-", "-");
+}
+
+// Write per-kernel call counts and times of the species DG updates,
+// together with the static kernel costs, as a roofline table. Counts
+// and times are summed over ranks and threads, so rates are per
+// thread.
+static void
+roofline_write(gkyl_vlasov_app* app)
+{
+  const char *fmt = "%s-%s";
+  int sz = gkyl_calc_strlen(fmt, app->name, "roofline.txt");
+  char fileNm[sz+1]; // ensures no buffer overflow
+  snprintf(fileNm, sizeof fileNm, fmt, app->name, "roofline.txt");
+
+  int rank;
+  gkyl_comm_get_rank(app->comm, &rank);
+  // append to existing file so we have a history of different runs
+  FILE *fp = 0;
+  if (rank == 0) fp = fopen(fileNm, "a");
+
+  char buff[70];
+  time_t t = time(NULL);
+  struct tm curr_tm = *localtime(&t);
+  if (strftime(buff, sizeof buff, "%c", &curr_tm))
+    gkyl_vlasov_app_cout(app, fp, "# %s\n", buff);
+  gkyl_vlasov_app_cout(app, fp, "%-10s %-48s %12s %10s %10s %10s %10s %10s %10s %10s\n",
+    "# species", "kernel", "calls", "time(s)", "ns/call", "flop/call", "byte/call",
+    "flop/byte", "GFLOP/s", "GB/s");
+
+  for (int s=0; s<app->num_species; ++s) {
+    struct vm_species *species = &app->species[s];
+    struct gkyl_hyper_dg_kernel_stat kst = gkyl_dg_updater_vlasov_get_kernel_stat(species->slvr);
+
+    // reduce counts and times over ranks
+    enum { NVOL, VOL_TM, NSURF, SURF_TM = NSURF+GKYL_MAX_DIM,
+      NBRY = SURF_TM+GKYL_MAX_DIM, BRY_TM = NBRY+GKYL_MAX_DIM, RED_END = BRY_TM+GKYL_MAX_DIM };
+    double red[RED_END], red_global[RED_END];
+    red[NVOL] = kst.nvol; red[VOL_TM] = kst.vol_tm;
+    for (int d=0; d<GKYL_MAX_DIM; ++d) {
+      red[NSURF+d] = kst.nsurf[d]; red[SURF_TM+d] = kst.surf_tm[d];
+      red[NBRY+d] = kst.nboundary_surf[d]; red[BRY_TM+d] = kst.boundary_surf_tm[d];
+    }
+    gkyl_comm_all_reduce(app->comm, GKYL_DOUBLE, GKYL_SUM, RED_END, red, red_global);
+
+    // kernel names are only known for the (non-relativistic) Vlasov equation
+    bool has_names = species->model_id == GKYL_MODEL_DEFAULT || species->model_id == GKYL_MODEL_GEN_GEO;
+    char kern_nm[128] = "vol";
+
+    if (red_global[NVOL] > 0) {
+      if (has_names)
+        gkyl_vlasov_kernel_name(species->eqn_vlasov, GKYL_VLASOV_TERM_VOL, 0, kern_nm, sizeof kern_nm);
+      roofline_row_write(app, fp, species->info.name, kern_nm, red_global[NVOL], red_global[VOL_TM]);
+    }
+    for (int d=0; d<GKYL_MAX_DIM; ++d) {
+      if (red_global[NSURF+d] > 0) {
+        if (has_names)
+          gkyl_vlasov_kernel_name(species->eqn_vlasov, GKYL_VLASOV_TERM_SURF, d, kern_nm, sizeof kern_nm);
+        else
+          snprintf(kern_nm, sizeof kern_nm, "surf[%d]", d);
+        roofline_row_write(app, fp, species->info.name, kern_nm, red_global[NSURF+d], red_global[SURF_TM+d]);
+      }
+      if (red_global[NBRY+d] > 0) {
+        if (has_names)
+          gkyl_vlasov_kernel_name(species->eqn_vlasov, GKYL_VLASOV_TERM_BOUNDARY_SURF, d, kern_nm, sizeof kern_nm);
+        else
+          snprintf(kern_nm, sizeof kern_nm, "boundary_surf[%d]", d);
+        roofline_row_write(app, fp, species->info.name, kern_nm, red_global[NBRY+d], red_global[BRY_TM+d]);
+      }
+    }
+  }
+
+  if (rank == 0)
+    fclose(fp);
+}
+
 void
 gkyl_vlasov_app_stat_write(gkyl_vlasov_app* app)
 {
@@ -993,6 +1297,10 @@ gkyl_vlasov_app_stat_write(gkyl_vlasov_app* app)
       stat.species_lbo_coll_diff_tm[s]);
     gkyl_vlasov_app_cout(app, fp, " niter_self_bgk_corr[%d] : %ld,\n", s, 
       stat.niter_self_bgk_corr[s]);
+    gkyl_vlasov_app_cout(app, fp, " ncell_iter_self_bgk_corr[%d] : %ld,\n", s, 
+      stat.ncell_iter_self_bgk_corr[s]);
+    gkyl_vlasov_app_cout(app, fp, " max_cell_iter_self_bgk_corr[%d] : %ld,\n", s, 
+      stat.max_cell_iter_self_bgk_corr[s]);
   }
 
   gkyl_vlasov_app_cout(app, fp, " species_coll_mom_tm : %lg,\n", stat.species_coll_mom_tm);
@@ -1034,6 +1342,8 @@ gkyl_vlasov_app_stat_write(gkyl_vlasov_app* app)
   if (rank == 0)
     fclose(fp);  
 
+  if (app->use_kernel_stat)
+    roofline_write(app);
 }
 
 // private function to handle variable argument list for printing
@@ -1075,6 +1385,9 @@ gkyl_vlasov_app_release(gkyl_vlasov_app* app)
 
   gkyl_wave_geom_release(app->geom);
 
+  if (app->job_pool)
+    gkyl_job_pool_release(app->job_pool);
+
   if (app->use_gpu) {
     gkyl_cu_free(app->basis_on_dev.basis);
     gkyl_cu_free(app->basis_on_dev.confBasis);
@@ -11,6 +11,20 @@ vlasov_forward_euler(gkyl_vlasov_app* app, double tcurr, double dt,
   const struct gkyl_array *fin[], const struct gkyl_array *fluidin[], const struct gkyl_array *emin,
   struct gkyl_array *fout[], struct gkyl_array *fluidout[], struct gkyl_array *emout, 
   struct gkyl_update_status *st)
+{
+  vlasov_forward_euler_combine(app, tcurr, dt, 0.0, 0, 1.0, fin, fluidin, emin,
+    fout, fout, fluidout, emout, false, st);
+}
+
+// Same as vlasov_forward_euler, except the distribution function
+// update is combined with an SSP-RK stage in a single sweep.
+void
+vlasov_forward_euler_combine(gkyl_vlasov_app* app, double tcurr, double dt,
+  double c0, const struct gkyl_array *f0[], double c1, const struct gkyl_array *fin[],
+  const struct gkyl_array *fluidin[], const struct gkyl_array *emin,
+  struct gkyl_array *frhs[], struct gkyl_array *fout[],
+  struct gkyl_array *fluidout[], struct gkyl_array *emout,
+  bool reject_reduced_dt, struct gkyl_update_status *st)
 {
   app->stat.nfeuler += 1;
 
@@ -37,6 +51,9 @@ vlasov_forward_euler(gkyl_vlasov_app* app, double tcurr, double dt,
   // compute necessary moments and boundary corrections for collisions
   for (int i=0; i<app->num_species; ++i) {
     if (app->species[i].collision_id == GKYL_LBO_COLLISIONS) {
+      // fused moments come from the collisionless update
+      if (app->species[i].lbo.fused_moms)
+        vm_species_rhs_vlasov(app, &app->species[i], fin[i], emin, frhs[i]);
       vm_species_lbo_moms(app, &app->species[i], &app->species[i].lbo, fin[i]);
     }
     else if (app->species[i].collision_id == GKYL_BGK_COLLISIONS && !app->has_implicit_coll_scheme) {
@@ -60,7 +77,7 @@ vlasov_forward_euler(gkyl_vlasov_app* app, double tcurr, double dt,
 
   // compute RHS of Vlasov equations
   for (int i=0; i<app->num_species; ++i) {
-    double dt1 = vm_species_rhs(app, &app->species[i], fin[i], emin, fout[i]);
+    double dt1 = vm_species_rhs(app, &app->species[i], fin[i], emin, frhs[i]);
     dtmin = fmin(dtmin, dt1);
   }
   for (int i=0; i<app->num_fluid_species; ++i) {
@@ -72,7 +89,7 @@ vlasov_forward_euler(gkyl_vlasov_app* app, double tcurr, double dt,
   // bflux calculation of the source species
   for (int i=0; i<app->num_species; ++i) {
     if (app->species[i].source_id) {
-      vm_species_source_rhs(app, &app->species[i], &app->species[i].src, fin, fout);
+      vm_species_source_rhs(app, &app->species[i], &app->species[i].src, fin, frhs);
     }
   }
   for (int i=0; i<app->num_fluid_species; ++i) {
@@ -102,12 +119,6 @@ vlasov_forward_euler(gkyl_vlasov_app* app, double tcurr, double dt,
   double dta = st->dt_actual = dt < dtmin ? dt : dtmin;
   st->dt_suggested = dtmin;
 
-  // complete update of distribution function
-  for (int i=0; i<app->num_species; ++i) {
-    gkyl_array_accumulate(gkyl_array_scale(fout[i], dta), 1.0, fin[i]);
-    vm_species_apply_bc(app, &app->species[i], fout[i]);
-  }
-
   // complete update of fluid species
   for (int i=0; i<app->num_fluid_species; ++i) {
     gkyl_array_accumulate(gkyl_array_scale(fluidout[i], dta), 1.0, fluidin[i]);
@@ -130,4 +141,16 @@ vlasov_forward_euler(gkyl_vlasov_app* app, double tcurr, double dt,
 
     vm_field_apply_bc(app, app->field, emout);
   }
+
+  // complete update of distribution function: fout = c0*f0 +
+  // c1*(fin + dta*rhs) in one sweep. This is done last as fout may be
+  // the same as fin, which is needed for the current above. If the
+  // step will be retaken the outputs are left untouched, so fout may
+  // also be an array (f0) needed to retake the step
+  if (!(reject_reduced_dt && dta < dt)) {
+    for (int i=0; i<app->num_species; ++i) {
+      gkyl_array_rk_combine(fout[i], c0, c0 == 0.0 ? 0 : f0[i], c1, fin[i], dta, frhs[i]);
+      vm_species_apply_bc(app, &app->species[i], fout[i]);
+    }
+  }
 }
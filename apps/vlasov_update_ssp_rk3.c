@@ -3,14 +3,21 @@
 // Take time-step using the RK3 method. Also sets the status object
 // which has the actual and suggested dts used. These can be different
 // from the actual time-step.
+//
+// The stage combinations for the distribution functions are fused
+// into the forward Euler update, so each stage makes a single sweep
+// over the phase-space arrays after the RHS is computed:
+//   f1 = f + dt*L(f)                      (RHS in f1)
+//   f1 = 3/4*f + 1/4*(f1 + dt*L(f1))      (RHS in fnew)
+//   f  = 1/3*f + 2/3*(f1 + dt*L(f1))      (RHS in fnew)
 struct gkyl_update_status
 vlasov_update_ssp_rk3(gkyl_vlasov_app* app, double dt0)
 {
   int ns = app->num_species;  
   int nfs = app->num_fluid_species;  
 
-  const struct gkyl_array *fin[ns];
-  struct gkyl_array *fout[ns];
+  const struct gkyl_array *f0[ns], *fin[ns];
+  struct gkyl_array *frhs[ns], *fout[ns];
   const struct gkyl_array *fluidin[nfs];
   struct gkyl_array *fluidout[nfs];
   struct gkyl_update_status st = { .success = true };
@@ -27,15 +34,16 @@ vlasov_update_ssp_rk3(gkyl_vlasov_app* app, double dt0)
 
           for (int i=0; i<ns; ++i) {
             fin[i] = app->species[i].f;
-            fout[i] = app->species[i].f1;
+            frhs[i] = fout[i] = app->species[i].f1;
           }
           for (int i=0; i<nfs; ++i) {
             fluidin[i] = app->fluid_species[i].fluid;
             fluidout[i] = app->fluid_species[i].fluid1;
           }
-          vlasov_forward_euler(app, tcurr, dt, fin, fluidin, app->has_field ? app->field->em : 0,
-            fout, fluidout, app->has_field ? app->field->em1 : 0,
-            &st
+          vlasov_forward_euler_combine(app, tcurr, dt, 0.0, 0, 1.0, fin,
+            fluidin, app->has_field ? app->field->em : 0,
+            frhs, fout, fluidout, app->has_field ? app->field->em1 : 0,
+            false, &st
           );
           // Limit fluid and EM solutions if desired (done after update as post-hoc fix)
           for (int i=0; i<nfs; ++i) {
@@ -56,16 +64,19 @@ vlasov_update_ssp_rk3(gkyl_vlasov_app* app, double dt0)
           struct timespec rk3_s2_tm = gkyl_wall_clock();
 
           for (int i=0; i<ns; ++i) {
+            f0[i] = app->species[i].f;
             fin[i] = app->species[i].f1;
-            fout[i] = app->species[i].fnew;
+            frhs[i] = app->species[i].fnew;
+            fout[i] = app->species[i].f1;
           }
           for (int i=0; i<nfs; ++i) {
             fluidin[i] = app->fluid_species[i].fluid1;
             fluidout[i] = app->fluid_species[i].fluidnew;
           }
-          vlasov_forward_euler(app, tcurr+dt, dt, fin, fluidin, app->has_field ? app->field->em1 : 0,
-            fout, fluidout, app->has_field ? app->field->emnew : 0,
-            &st
+          vlasov_forward_euler_combine(app, tcurr+dt, dt, 3.0/4.0, f0, 1.0/4.0, fin,
+            fluidin, app->has_field ? app->field->em1 : 0,
+            frhs, fout, fluidout, app->has_field ? app->field->emnew : 0,
+            true, &st
           );
           // Limit fluid and EM solutions if desired (done after update as post-hoc fix)
           for (int i=0; i<nfs; ++i) {
@@ -87,9 +98,7 @@ vlasov_update_ssp_rk3(gkyl_vlasov_app* app, double dt0)
             state = RK_STAGE_1; // restart from stage 1
           } 
           else {
-            for (int i=0; i<ns; ++i)
-              array_combine(app->species[i].f1,
-                3.0/4.0, app->species[i].f, 1.0/4.0, app->species[i].fnew, &app->species[i].local_ext);
+            // (distribution functions were combined in forward Euler)
             for (int i=0; i<nfs; ++i)
               array_combine(app->fluid_species[i].fluid1,
                 3.0/4.0, app->fluid_species[i].fluid, 1.0/4.0, app->fluid_species[i].fluidnew, &app->local_ext);
@@ -109,16 +118,19 @@ vlasov_update_ssp_rk3(gkyl_vlasov_app* app, double dt0)
           struct timespec rk3_s3_tm = gkyl_wall_clock();
 
           for (int i=0; i<ns; ++i) {
+            f0[i] = app->species[i].f;
             fin[i] = app->species[i].f1;
-            fout[i] = app->species[i].fnew;
+            frhs[i] = app->species[i].fnew;
+            fout[i] = app->species[i].f;
           }
           for (int i=0; i<nfs; ++i) {
             fluidin[i] = app->fluid_species[i].fluid1;
             fluidout[i] = app->fluid_species[i].fluidnew;
           }
-          vlasov_forward_euler(app, tcurr+dt/2, dt, fin, fluidin, app->has_field ? app->field->em1 : 0,
-            fout, fluidout, app->has_field ? app->field->emnew : 0,
-            &st
+          vlasov_forward_euler_combine(app, tcurr+dt/2, dt, 1.0/3.0, f0, 2.0/3.0, fin,
+            fluidin, app->has_field ? app->field->em1 : 0,
+            frhs, fout, fluidout, app->has_field ? app->field->emnew : 0,
+            true, &st
           );
           // Limit fluid and EM solutions if desired (done after update as post-hoc fix)
           for (int i=0; i<nfs; ++i) {
@@ -142,21 +154,14 @@ vlasov_update_ssp_rk3(gkyl_vlasov_app* app, double dt0)
             app->stat.nstage_2_fail += 1;
           }
           else {
-            for (int i=0; i<ns; ++i) {
-              array_combine(app->species[i].f1,
-                1.0/3.0, app->species[i].f, 2.0/3.0, app->species[i].fnew, &app->species[i].local_ext);
-              gkyl_array_copy_range(app->species[i].f, app->species[i].f1, &app->species[i].local_ext);
-            }
-            for (int i=0; i<nfs; ++i) {
-              array_combine(app->fluid_species[i].fluid1,
+            // (distribution functions were combined in forward Euler;
+            // fluid and EM fields are combined in place, with no copy)
+            for (int i=0; i<nfs; ++i)
+              array_combine(app->fluid_species[i].fluid,
                 1.0/3.0, app->fluid_species[i].fluid, 2.0/3.0, app->fluid_species[i].fluidnew, &app->local_ext);
-              gkyl_array_copy_range(app->fluid_species[i].fluid, app->fluid_species[i].fluid1, &app->local_ext);
-            }
-            if (app->has_field) {
-              array_combine(app->field->em1,
+            if (app->has_field)
+              array_combine(app->field->em,
                 1.0/3.0, app->field->em, 2.0/3.0, app->field->emnew, &app->local_ext);
-              gkyl_array_copy_range(app->field->em, app->field->em1, &app->local_ext);
-            }
 
             state = RK_COMPLETE;
           }
@@ -114,6 +114,9 @@ vm_fluid_species_init(struct gkyl_vm *vm, struct gkyl_vlasov_app *app, struct vm
       &app->local, f->equation, app->geom, &aux_inp, app->use_gpu);    
   }
 
+  // thread DG update over conf-space (no-op if app has no job pool)
+  gkyl_dg_updater_fluid_set_job_pool(f->advect_slvr, app->job_pool);
+
   f->has_diffusion = false;
   f->diffD = NULL;
   if (f->info.diffusion.Dij) {
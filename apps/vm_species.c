@@ -66,9 +66,26 @@ vm_species_init(struct gkyl_vm *vm, struct gkyl_vlasov_app *app, struct vm_speci
   s->field_id = app->has_field ? app->field->info.field_id : GKYL_FIELD_NULL;
 
   // allocate distribution function arrays
-  s->f = mkarr(app->use_gpu, app->basis.num_basis, s->local_ext.volume);
-  s->f1 = mkarr(app->use_gpu, app->basis.num_basis, s->local_ext.volume);
-  s->fnew = mkarr(app->use_gpu, app->basis.num_basis, s->local_ext.volume);
+  if (s->info.use_single_precision) {
+    // f, f1 and fnew are stored as floats; kernels still compute in
+    // double precision. Only the collisionless Vlasov equation on the
+    // CPU supports this for now.
+    assert(!app->use_gpu);
+    assert(s->model_id == GKYL_MODEL_DEFAULT || s->model_id == GKYL_MODEL_GEN_GEO);
+    assert(s->info.collisions.collision_id == GKYL_NO_COLLISIONS);
+    assert(s->info.radiation.radiation_id == GKYL_NO_RADIATION);
+    assert(s->info.source.source_id == GKYL_NO_SOURCE);
+    assert(!s->info.output_f_lte);
+
+    s->f = gkyl_array_new(GKYL_FLOAT, app->basis.num_basis, s->local_ext.volume);
+    s->f1 = gkyl_array_new(GKYL_FLOAT, app->basis.num_basis, s->local_ext.volume);
+    s->fnew = gkyl_array_new(GKYL_FLOAT, app->basis.num_basis, s->local_ext.volume);
+  }
+  else {
+    s->f = mkarr(app->use_gpu, app->basis.num_basis, s->local_ext.volume);
+    s->f1 = mkarr(app->use_gpu, app->basis.num_basis, s->local_ext.volume);
+    s->fnew = mkarr(app->use_gpu, app->basis.num_basis, s->local_ext.volume);
+  }
 
   s->f_host = s->f;
   if (app->use_gpu)
@@ -210,8 +227,16 @@ vm_species_init(struct gkyl_vm *vm, struct gkyl_vlasov_app *app, struct vm_speci
       &app->local, &s->local_vel, &s->local, is_zero_flux, s->model_id, s->field_id, &aux_inp, app->use_gpu);
   }
 
+  // thread DG update over phase-space (no-op if app has no job pool)
+  s->job_pool = app->job_pool;
+  gkyl_dg_updater_vlasov_set_job_pool(s->slvr, app->job_pool);
+  if (app->use_kernel_stat)
+    gkyl_dg_updater_vlasov_set_kernel_stat(s->slvr, true);
+
   // acquire equation object
   s->eqn_vlasov = gkyl_dg_updater_vlasov_acquire_eqn(s->slvr);
+  if (s->info.use_single_precision)
+    gkyl_vlasov_set_storage_type(s->eqn_vlasov, GKYL_FLOAT);
 
   // allocate data for momentum (for use in current accumulation)
   vm_species_moment_init(app, s, &s->m1i, "M1i");
@@ -280,7 +305,8 @@ vm_species_init(struct gkyl_vm *vm, struct gkyl_vlasov_app *app, struct vm_speci
     // Always have correct moments on for the f_lte output
     struct correct_all_moms_inp corr_inp = { .correct_all_moms = true, 
       .max_iter = s->info.max_iter, .iter_eps = s->info.iter_eps, 
-      .use_last_converged = s->info.use_last_converged };
+      .use_last_converged = s->info.use_last_converged, 
+      .use_cell_mask = s->info.use_cell_mask, .use_anderson = s->info.use_anderson };
     vm_species_lte_init(app, s, &s->lte, corr_inp);
   }
   if (s->collision_id == GKYL_LBO_COLLISIONS) {
@@ -367,17 +393,28 @@ vm_species_init(struct gkyl_vm *vm, struct gkyl_vlasov_app *app, struct vm_speci
 void
 vm_species_apply_ic(gkyl_vlasov_app *app, struct vm_species *species, double t0)
 {
+  // projections are done in double precision: with single-precision
+  // storage project into a temporary and round once into f
+  struct gkyl_array *fic = species->f;
+  if (species->f->type == GKYL_FLOAT)
+    fic = mkarr(false, species->f->ncomp, species->f->size);
+
   if (species->num_init > 1) {
-    gkyl_array_clear(species->f, 0.0); 
+    gkyl_array_clear(fic, 0.0); 
     for (int k=0; k<species->num_init; k++) {
       vm_species_projection_calc(app, species, &species->proj_init[k], species->f_tmp, t0);
-      gkyl_array_accumulate(species->f, 1.0, species->f_tmp);
+      gkyl_array_accumulate(fic, 1.0, species->f_tmp);
     }
     // Free the temporary array now that initial conditions are complete
     gkyl_array_release(species->f_tmp);
   }
   else {
-    vm_species_projection_calc(app, species, &species->proj_init[0], species->f, t0);
+    vm_species_projection_calc(app, species, &species->proj_init[0], fic, t0);
+  }
+
+  if (fic != species->f) {
+    gkyl_array_convert(species->f, fic);
+    gkyl_array_release(fic);
   }
 
   // Pre-compute applied acceleration in case it's time-independent
@@ -392,6 +429,37 @@ vm_species_apply_ic(gkyl_vlasov_app *app, struct vm_species *species, double t0)
   gkyl_bc_basic_buffer_fixed_func(species->bc_up[0], species->bc_buffer_up_fixed, species->f);
 }
 
+void
+vm_species_restart_init(gkyl_vlasov_app *app, struct vm_species *species, double tm)
+{
+  // fixed-function BCs hold the skin values of the initial conditions:
+  // project these into fnew (not used till the first step) to recover
+  // them without touching the restarted f
+  if (species->lower_bc[0] == GKYL_SPECIES_FIXED_FUNC || species->upper_bc[0] == GKYL_SPECIES_FIXED_FUNC) {
+    // with single-precision storage, project in double precision
+    struct gkyl_array *fsum = species->fnew, *fproj = species->f1;
+    if (species->fnew->type == GKYL_FLOAT) {
+      fsum = mkarr(false, species->fnew->ncomp, species->fnew->size);
+      fproj = mkarr(false, species->fnew->ncomp, species->fnew->size);
+    }
+    gkyl_array_clear(fsum, 0.0);
+    for (int k=0; k<species->num_init; k++) {
+      vm_species_projection_calc(app, species, &species->proj_init[k], fproj, tm);
+      gkyl_array_accumulate(fsum, 1.0, fproj);
+    }
+    if (fsum != species->fnew) {
+      gkyl_array_convert(species->fnew, fsum);
+      gkyl_array_release(fsum);
+      gkyl_array_release(fproj);
+    }
+    gkyl_bc_basic_buffer_fixed_func(species->bc_lo[0], species->bc_buffer_lo_fixed, species->fnew);
+    gkyl_bc_basic_buffer_fixed_func(species->bc_up[0], species->bc_buffer_up_fixed, species->fnew);
+  }
+
+  vm_species_calc_app_accel(app, species, tm);
+  vm_species_source_calc(app, species, &species->src, tm);
+}
+
 void
 vm_species_calc_app_accel(gkyl_vlasov_app *app, struct vm_species *species, double tm)
 {
@@ -402,10 +470,9 @@ vm_species_calc_app_accel(gkyl_vlasov_app *app, struct vm_species *species, doub
   }
 }
 
-// Compute the RHS for species update, returning maximum stable
-// time-step.
-double
-vm_species_rhs(gkyl_vlasov_app *app, struct vm_species *species,
+// Compute the collisionless RHS (and fused LBO moments, if any)
+void
+vm_species_rhs_vlasov(gkyl_vlasov_app *app, struct vm_species *species,
   const struct gkyl_array *fin, const struct gkyl_array *em, struct gkyl_array *rhs)
 {
   if (species->field_id  == GKYL_FIELD_E_B) {
@@ -425,8 +492,27 @@ vm_species_rhs(gkyl_vlasov_app *app, struct vm_species *species,
   gkyl_array_clear(species->cflrate, 0.0);
   gkyl_array_clear(rhs, 0.0);
 
+  // fused moments are accumulated by the sweep
+  bool fused_moms = species->collision_id == GKYL_LBO_COLLISIONS && species->lbo.fused_moms;
+  if (fused_moms) {
+    gkyl_array_clear_range(species->lbo.moms.marr, 0.0, &app->local);
+    gkyl_array_clear_range(species->lbo.boundary_corrections, 0.0, &app->local);
+  }
+
   gkyl_dg_updater_vlasov_advance(species->slvr, &species->local, 
     fin, species->cflrate, rhs);
+}
+
+// Compute the RHS for species update, returning maximum stable
+// time-step.
+double
+vm_species_rhs(gkyl_vlasov_app *app, struct vm_species *species,
+  const struct gkyl_array *fin, const struct gkyl_array *em, struct gkyl_array *rhs)
+{
+  // with fused moments the collisionless part was done with the
+  // moment calculation
+  if (!(species->collision_id == GKYL_LBO_COLLISIONS && species->lbo.fused_moms))
+    vm_species_rhs_vlasov(app, species, fin, em, rhs);
 
   if (species->collision_id == GKYL_LBO_COLLISIONS) {
     vm_species_lbo_rhs(app, species, &species->lbo, fin, rhs);
@@ -587,6 +673,8 @@ vm_species_bgk_niter(gkyl_vlasov_app *app)
   for (int i=0; i<app->num_species; ++i) {
     if (app->species[i].collision_id == GKYL_BGK_COLLISIONS) {
       app->stat.niter_self_bgk_corr[i] = app->species[i].bgk.lte.niter;
+      app->stat.ncell_iter_self_bgk_corr[i] = app->species[i].bgk.lte.ncell_iter;
+      app->stat.max_cell_iter_self_bgk_corr[i] = app->species[i].bgk.lte.max_cell_iter;
     }
   }
 }
@@ -46,7 +46,9 @@ vm_species_bgk_init(struct gkyl_vlasov_app *app, struct vm_species *s, struct vm
   // Allocate everything needed to make f_lte
   struct correct_all_moms_inp corr_inp = { .correct_all_moms = s->info.collisions.correct_all_moms, 
     .max_iter = s->info.collisions.max_iter, .iter_eps = s->info.collisions.iter_eps, 
-    .use_last_converged = s->info.collisions.use_last_converged };
+    .use_last_converged = s->info.collisions.use_last_converged, 
+    .use_cell_mask = s->info.collisions.use_cell_mask, 
+    .use_anderson = s->info.collisions.use_anderson };
   vm_species_lte_init(app, s, &bgk->lte, corr_inp);
   
 
@@ -57,16 +57,41 @@ vm_species_lbo_init(struct gkyl_vlasov_app *app, struct vm_species *s, struct vm
   // edge of velocity space corrections to momentum and energy 
   lbo->bcorr_calc = gkyl_mom_calc_bcorr_lbo_vlasov_new(&s->grid, 
     &app->confBasis, &app->basis, v_bounds, app->use_gpu);
+  if (!app->use_gpu)
+    gkyl_mom_calc_bcorr_set_job_pool(lbo->bcorr_calc, app->job_pool);
+
+  // on CPUs, compute the moments and corrections in the same
+  // phase-space sweep as the collisionless update
+  lbo->fused_moms = !app->use_gpu && s->model_id == GKYL_MODEL_DEFAULT;
+  if (lbo->fused_moms) {
+    struct gkyl_mom_type *mtype = gkyl_dg_updater_moment_acquire_type(lbo->moms.mcalc);
+    struct gkyl_mom_type *bctype = gkyl_mom_bcorr_lbo_vlasov_new(&app->confBasis,
+      &app->basis, v_bounds, false);
+    struct gkyl_hyper_dg_fused_moms fmom = {
+      .cdim = cdim,
+      .conf_range = app->local,
+      .num_mom = 2,
+      .momt = { mtype, bctype },
+      .mout = { lbo->moms.marr, lbo->boundary_corrections },
+      .vel_edge = { false, true },
+    };
+    gkyl_dg_updater_vlasov_set_fused_moms(s->slvr, &fmom);
+    gkyl_mom_type_release(mtype);
+    gkyl_mom_type_release(bctype);
+  }
   
   // primitive moment calculator
   lbo->coll_pcalc = gkyl_prim_lbo_vlasov_calc_new(&s->grid, 
     &app->confBasis, &app->basis, &app->local, app->use_gpu);
+  if (!app->use_gpu)
+    gkyl_prim_lbo_calc_set_job_pool(lbo->coll_pcalc, app->job_pool);
 
   // LBO updater
   struct gkyl_dg_lbo_vlasov_drag_auxfields drag_inp = { .nuSum = lbo->nu_sum, .nuPrimMomsSum = lbo->nu_prim_moms };
   struct gkyl_dg_lbo_vlasov_diff_auxfields diff_inp = { .nuSum = lbo->nu_sum, .nuPrimMomsSum = lbo->nu_prim_moms };
   lbo->coll_slvr = gkyl_dg_updater_lbo_vlasov_new(&s->grid, 
     &app->confBasis, &app->basis, &app->local, &drag_inp, &diff_inp, app->use_gpu);
+  gkyl_dg_updater_lbo_vlasov_set_job_pool(lbo->coll_slvr, app->job_pool);
 }
 
 void 
@@ -127,8 +152,9 @@ vm_species_lbo_moms(gkyl_vlasov_app *app, const struct vm_species *species,
 {
   struct timespec wst = gkyl_wall_clock();
 
-  // compute needed moments
-  vm_species_moment_calc(&lbo->moms, species->local, app->local, fin);
+  // compute needed moments (unless fused with the Vlasov sweep)
+  if (!lbo->fused_moms)
+    vm_species_moment_calc(&lbo->moms, species->local, app->local, fin);
   gkyl_array_set_range(lbo->m0, 1.0, lbo->moms.marr, &app->local);
   
   if (app->use_gpu) {
@@ -143,8 +169,9 @@ vm_species_lbo_moms(gkyl_vlasov_app *app, const struct vm_species *species,
   } 
   else {
     // construct boundary corrections
-    gkyl_mom_calc_bcorr_advance(lbo->bcorr_calc,
-      &species->local, &app->local, fin, lbo->boundary_corrections);
+    if (!lbo->fused_moms)
+      gkyl_mom_calc_bcorr_advance(lbo->bcorr_calc,
+        &species->local, &app->local, fin, lbo->boundary_corrections);
 
     // construct primitive moments  
     gkyl_prim_lbo_calc_advance(lbo->coll_pcalc, &app->local, 
@@ -56,8 +56,12 @@ vm_species_lte_init(struct gkyl_vlasov_app *app, struct vm_species *s, struct vm
       .max_iter = max_iter,
       .eps = iter_eps,
       .use_last_converged = use_last_converged, 
+      .use_cell_mask = corr_inp.use_cell_mask,
+      .use_anderson = corr_inp.use_anderson,
     };
     lte->niter = 0;
+    lte->ncell_iter = 0;
+    lte->max_cell_iter = 0;
     lte->corr_lte = gkyl_vlasov_lte_correct_inew( &inp_corr );
 
     lte->corr_stat = gkyl_dynvec_new(GKYL_DOUBLE, app->vdim+4);
@@ -95,6 +99,8 @@ vm_species_lte_from_moms(gkyl_vlasov_app *app, const struct vm_species *species,
     gkyl_dynvec_append(lte->corr_stat, app->tcurr, corr_vec);
 
     lte->niter += status_corr.num_iter;
+    lte->ncell_iter += status_corr.num_cell_iter;
+    lte->max_cell_iter = GKYL_MAX2(lte->max_cell_iter, status_corr.max_cell_iter);
   } 
 
   app->stat.species_lte_tm += gkyl_time_diff_now_sec(wst);   
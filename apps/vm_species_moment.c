@@ -59,6 +59,16 @@ vm_species_moment_init(struct gkyl_vlasov_app *app, struct vm_species *s,
     }
   }
 
+  // thread moments over phase-space (no-op if app has no job pool)
+  if (!app->use_gpu) {
+    if (sm->is_vlasov_lte_moms)
+      gkyl_vlasov_lte_moments_set_job_pool(sm->vlasov_lte_moms, app->job_pool,
+        app->use_deterministic_moms);
+    else
+      gkyl_dg_updater_moment_set_job_pool(sm->mcalc, app->job_pool,
+        app->use_deterministic_moms);
+  }
+
   if (is_integrated) {
     sm->marr = mkarr(app->use_gpu, num_mom, app->local_ext.volume);
     sm->marr_host = sm->marr;
@@ -0,0 +1,309 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <gkyl_array.h>
+#include <gkyl_array_rio.h>
+#include <gkyl_rect_grid.h>
+
+#define ANSI_COLOR_RED "\x1b[31m"
+#define ANSI_COLOR_GREEN "\x1b[32m"
+#define ANSI_COLOR_YELLOW "\x1b[33m"
+#define ANSI_COLOR_BLUE "\x1b[34m"
+#define ANSI_COLOR_MAGENTA "\x1b[35m"
+#define ANSI_COLOR_CYAN "\x1b[36m"
+#define ANSI_COLOR_RESET "\x1b[0m"
+
+// Relative L2 differences between single- and double-precision runs
+// below this are attributed to float round-off; larger ones are flagged.
+#define PRECISION_TOLERANCE pow(10.0, -4.0)
+
+int system(const char *command);
+
+// Precision modes: the double-precision run is the reference, the
+// single-precision run stores distribution functions as floats (-S).
+static const char *mode_names[2] = { "double", "single" };
+static const char *mode_flags[2] = { "", "-S" };
+
+void
+runTest(const char* test_name, const char* test_name_human, const int test_output_count, const char test_outputs[][64])
+{
+  printf("Running %s...\n", test_name_human);
+
+  char command_buffer1[256];
+  snprintf(command_buffer1, 256, "make build/regression/rt_%s > /dev/null 2>&1", test_name);
+  system(command_buffer1);
+
+  for (int m = 0; m < 2; m++) {
+    char command_buffer2[256];
+    snprintf(command_buffer2, 256, "rm -rf ./%s-stat.json", test_name);
+    system(command_buffer2);
+
+    char command_buffer3[256];
+    snprintf(command_buffer3, 256, "./build/regression/rt_%s -m %s > ./ci/output_precision/rt_%s_%s.dat 2>&1",
+      test_name, mode_flags[m], test_name, mode_names[m]);
+    system(command_buffer3);
+
+    for (int i = 0; i < test_output_count; i++) {
+      char file_buffer[128];
+      snprintf(file_buffer, 128, "./%s-%s.gkyl", test_name, test_outputs[i]);
+      FILE *file_ptr = fopen(file_buffer, "r");
+      if (file_ptr == NULL) {
+        printf("*** Something catastrophic happened. Test aborting... ***\n");
+      }
+      else {
+        fclose(file_ptr);
+        char command_buffer4[256];
+        snprintf(command_buffer4, 256, "mv ./%s-%s.gkyl ci/output_precision/%s-%s_%s.gkyl",
+          test_name, test_outputs[i], test_name, test_outputs[i], mode_names[m]);
+        system(command_buffer4);
+      }
+    }
+  }
+
+  printf("Finished %s.\n\n", test_name_human);
+}
+
+// Value of element i of array data, promoted to double.
+static double
+elem_value(const struct gkyl_array *arr, long i)
+{
+  if (arr->type == GKYL_FLOAT)
+    return ((const float*) arr->data)[i];
+  return ((const double*) arr->data)[i];
+}
+
+// Wall-clock time for all updates, as reported by the regression test.
+static double
+totalUpdateTime(const char* test_name, const char* mode_name)
+{
+  char buffer[128];
+  snprintf(buffer, 128, "ci/output_precision/rt_%s_%s.dat", test_name, mode_name);
+
+  FILE *output_ptr = fopen(buffer, "rb");
+  if (output_ptr == NULL) {
+    return -1.0;
+  }
+  fseek(output_ptr, 0, SEEK_END);
+  long file_size = ftell(output_ptr);
+  rewind(output_ptr);
+  char *output = calloc(file_size + 1, (sizeof(char)));
+  fread(output, sizeof(char), file_size, output_ptr);
+  fclose(output_ptr);
+
+  double tm = -1.0;
+  char *full_substring = strstr(output, "Total updates took ");
+  if (full_substring != NULL) {
+    char *end_ptr;
+    tm = strtod(full_substring + strlen("Total updates took "), &end_ptr);
+  }
+  free(output);
+  return tm;
+}
+
+void
+analyzeTestOutput(const char* test_name, const char* test_name_human, const int test_output_count, const char test_outputs[][64])
+{
+  printf("%s:\n\n", test_name_human);
+
+  double tm_double = totalUpdateTime(test_name, mode_names[0]);
+  double tm_single = totalUpdateTime(test_name, mode_names[1]);
+  if (tm_double < 0.0 || tm_single < 0.0) {
+    printf(ANSI_COLOR_RED "Missing run output (run the test first)." ANSI_COLOR_RESET "\n\n");
+    return;
+  }
+  printf("Total update time (double): %g secs\n", tm_double);
+  printf("Total update time (single): %g secs\n", tm_single);
+
+  for (int i = 0; i < test_output_count; i++) {
+    char file_double[128], file_single[128];
+    snprintf(file_double, 128, "ci/output_precision/%s-%s_%s.gkyl", test_name, test_outputs[i], mode_names[0]);
+    snprintf(file_single, 128, "ci/output_precision/%s-%s_%s.gkyl", test_name, test_outputs[i], mode_names[1]);
+
+    struct gkyl_rect_grid grid_double, grid_single;
+    struct gkyl_array *arr_double = gkyl_grid_array_new_from_file(&grid_double, file_double);
+    struct gkyl_array *arr_single = gkyl_grid_array_new_from_file(&grid_single, file_single);
+
+    if (arr_double == NULL || arr_single == NULL) {
+      printf(ANSI_COLOR_RED "%s: unable to read output." ANSI_COLOR_RESET "\n", test_outputs[i]);
+    }
+    else if (arr_double->size*arr_double->ncomp != arr_single->size*arr_single->ncomp) {
+      printf(ANSI_COLOR_RED "%s: outputs have different sizes." ANSI_COLOR_RESET "\n", test_outputs[i]);
+    }
+    else {
+      long nelem = arr_double->size*arr_double->ncomp;
+      double max_abs_diff = 0.0, max_abs = 0.0, diff_sq = 0.0, ref_sq = 0.0;
+      for (long j = 0; j < nelem; j++) {
+        double ref = elem_value(arr_double, j);
+        double diff = elem_value(arr_single, j) - ref;
+        max_abs_diff = fmax(max_abs_diff, fabs(diff));
+        max_abs = fmax(max_abs, fabs(ref));
+        diff_sq += diff*diff;
+        ref_sq += ref*ref;
+      }
+      double rel_l2 = ref_sq > 0.0 ? sqrt(diff_sq/ref_sq) : sqrt(diff_sq);
+      double rel_max = max_abs > 0.0 ? max_abs_diff/max_abs : max_abs_diff;
+
+      printf("%s (stored as %s, %zu bytes per element):\n", test_outputs[i],
+        arr_single->type == GKYL_FLOAT ? "float" : "double", arr_single->elemsz);
+      printf("  Max. absolute difference: %g\n", max_abs_diff);
+      printf("  Max. relative difference: %g\n", rel_max);
+      if (rel_l2 < PRECISION_TOLERANCE) {
+        printf("  Relative L2 difference: " ANSI_COLOR_GREEN "%g" ANSI_COLOR_RESET "\n", rel_l2);
+      }
+      else {
+        printf("  Relative L2 difference: " ANSI_COLOR_RED "%g" ANSI_COLOR_RESET "\n", rel_l2);
+      }
+    }
+
+    if (arr_double != NULL) {
+      gkyl_array_release(arr_double);
+    }
+    if (arr_single != NULL) {
+      gkyl_array_release(arr_single);
+    }
+  }
+  printf("\n");
+}
+
+int
+main(int argc, char **argv)
+{
+  // collisionless tests that support single-precision storage
+  int test_count = 7;
+  char test_names[7][64] = {
+    "vlasov_twostream_p1",
+    "vlasov_twostream_p2",
+    "vlasov_freestream_p1",
+    "vlasov_freestream_p2",
+    "vlasov_weibel_1x2v_p2",
+    "vlasov_weibel_2x2v_p1",
+    "vlasov_weibel_2x2v_p2",
+  };
+  char test_names_human[7][128] = {
+    "1x1v Two-Stream Instability Test with p = 1",
+    "1x1v Two-Stream Instability Test with p = 2",
+    "1x1v Free Streaming Instability Test with p = 1",
+    "1x1v Free Streaming Instability Test with p = 2",
+    "1x2v Weibel Instability Test with p = 2",
+    "2x2v Weibel Instability Test with p = 1",
+    "2x2v Weibel Instability Test with p = 2",
+  };
+  int test_output_count[7] = { 3, 3, 2, 2, 3, 3, 3 };
+  char test_outputs[7][64][64] = {
+    { "elc_1", "elc_M0_1", "field_1" },
+    { "elc_1", "elc_M0_1", "field_1" },
+    { "neut_1", "neut_M0_1" },
+    { "neut_1", "neut_M0_1" },
+    { "elc_1", "elc_M0_1", "field_1" },
+    { "elc_1", "elc_M0_1", "field_1" },
+    { "elc_1", "elc_M0_1", "field_1" },
+  };
+
+  system("clear");
+  system("mkdir -p ci/output_precision");
+
+  printf("** Gkeyll Vlasov Mixed-Precision Regression System **\n\n");
+
+  if (argc > 1) {
+    char *arg_ptr;
+
+    if (strtol(argv[1], &arg_ptr, 10) == 1) {
+      for (int i = 0; i < test_count; i++) {
+        runTest(test_names[i], test_names_human[i], test_output_count[i], test_outputs[i]);
+      }
+    }
+    else if (strtol(argv[1], &arg_ptr, 10) == 2) {
+      for (int i = 0; i < test_count; i++) {
+        analyzeTestOutput(test_names[i], test_names_human[i], test_output_count[i], test_outputs[i]);
+      }
+    }
+    else if (strtol(argv[1], &arg_ptr, 10) == 3) {
+      if (argc > 2) {
+        if (strtol(argv[2], &arg_ptr, 10) >= 1 && strtol(argv[2], &arg_ptr, 10) <= test_count) {
+          runTest(test_names[strtol(argv[2], &arg_ptr, 10) - 1], test_names_human[strtol(argv[2], &arg_ptr, 10) - 1],
+            test_output_count[strtol(argv[2], &arg_ptr, 10) - 1], test_outputs[strtol(argv[2], &arg_ptr, 10) - 1]);
+        }
+        else {
+          printf("Invalid test!\n");
+        }
+      }
+      else {
+        printf("Must specify which test to run!\n");
+      }
+    }
+    else if (strtol(argv[1], &arg_ptr, 10) == 4) {
+      if (argc > 2) {
+        if (strtol(argv[2], &arg_ptr, 10) >= 1 && strtol(argv[2], &arg_ptr, 10) <= test_count) {
+          analyzeTestOutput(test_names[strtol(argv[2], &arg_ptr, 10) - 1], test_names_human[strtol(argv[2], &arg_ptr, 10) - 1],
+            test_output_count[strtol(argv[2], &arg_ptr, 10) - 1], test_outputs[strtol(argv[2], &arg_ptr, 10) - 1]);
+        }
+        else {
+          printf("Invalid test!\n");
+        }
+      }
+      else {
+        printf("Must specify which test results to view!\n");
+      }
+    }
+    else {
+      printf("Invalid option!\n");
+    }
+  }
+  else {
+    while (1) {
+      printf("Please select an option to proceed:\n\n");
+      printf("1 - Run Full Precision Comparison Suite\n");
+      printf("2 - View All Precision Comparison Results\n");
+      printf("3 - Run Specific Precision Comparison\n");
+      printf("4 - View Specific Precision Comparison Result\n");
+      printf("5 - Exit\n");
+
+      int option;
+      scanf("%d", &option);
+      printf("\n");
+
+      if (option == 1) {
+        for (int i = 0; i < test_count; i++) {
+          runTest(test_names[i], test_names_human[i], test_output_count[i], test_outputs[i]);
+        }
+      }
+      else if (option == 2) {
+        for (int i = 0; i < test_count; i++) {
+          analyzeTestOutput(test_names[i], test_names_human[i], test_output_count[i], test_outputs[i]);
+        }
+      }
+      else if (option == 3 || option == 4) {
+        printf("Please select the test:\n\n");
+        for (int i = 0; i < test_count; i++) {
+          printf("%d - %s\n", i + 1, test_names_human[i]);
+        }
+
+        int option2;
+        scanf("%d", &option2);
+        printf("\n");
+
+        if (option2 >= 1 && option2 <= test_count) {
+          if (option == 3) {
+            runTest(test_names[option2 - 1], test_names_human[option2 - 1], test_output_count[option2 - 1], test_outputs[option2 - 1]);
+          }
+          else {
+            analyzeTestOutput(test_names[option2 - 1], test_names_human[option2 - 1], test_output_count[option2 - 1], test_outputs[option2 - 1]);
+          }
+        }
+        else {
+          printf("Invalid test!\n\n");
+        }
+      }
+      else if (option == 5) {
+        break;
+      }
+      else {
+        printf("Invalid selection!\n\n");
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,177 @@
+#!/bin/sh
+
+# Generate batched variants of the Vlasov volume kernels. Run from
+# kernels/vlasov after regenerating the kernels:
+#
+#   ./gen-batch-kernels.sh
+#
+# A batched kernel updates GKYL_VLASOV_BATCH cells that share a
+# configuration-space cell (consecutive cells along the last velocity
+# direction) in one call. Cell data is passed transposed, as
+# f[k][lane], so the body of the scalar kernel becomes a loop over
+# lanes that the compiler vectorizes. Statements that only depend on
+# the cell spacing and the fields are computed once, before the loop.
+# Batched kernels are host-only.
+
+kernel_list=`ls vlasov_vol_*.c vlasov_stream_vol_*.c | sort`
+
+batch_awk='
+function add_ids(s, set,   rest, nm) {
+  rest = s
+  while (match(rest, /[A-Za-z_][A-Za-z_0-9]*/)) {
+    nm = substr(rest, RSTART, RLENGTH)
+    rest = substr(rest, RSTART+RLENGTH)
+    set[nm] = 1
+  }
+}
+
+function refs_varying(s,   rest, nm) {
+  rest = s
+  while (match(rest, /[A-Za-z_][A-Za-z_0-9]*/)) {
+    nm = substr(rest, RSTART, RLENGTH)
+    rest = substr(rest, RSTART+RLENGTH)
+    if (nm in varying) return 1
+  }
+  return 0
+}
+
+# names defined by a statement
+function lhs_names(s, names,   decl, np, p, k, nm) {
+  split("", names)
+  if (s ~ /^[ ]*(const[ ]+)?double[ *]/) {
+    decl = s; sub(/^[ ]*(const[ ]+)?double[ ]*/, "", decl)
+    np = split(decl, p, ",")
+    for (k=1; k<=np; ++k) {
+      nm = p[k]; sub(/^[ *]*/, "", nm)
+      if (match(nm, /^[A-Za-z_][A-Za-z_0-9]*[ ]*(\[[0-9]+\][ ]*)?=/)) {
+        sub(/[ \[=].*/, "", nm); names[nm] = 1
+      }
+    }
+  }
+  else if (match(s, /^[ ]*[A-Za-z_][A-Za-z_0-9]*/)) {
+    nm = substr(s, RSTART, RLENGTH); sub(/^[ ]*/, "", nm)
+    if (nm != "return") names[nm] = 1
+  }
+}
+
+# append the lane index to element references of varying arrays
+function lane_refs(s,   out, rest, tok, nm) {
+  out = ""; rest = s
+  while (match(rest, /[A-Za-z_][A-Za-z_0-9]*\[[0-9]+\]/)) {
+    tok = substr(rest, RSTART, RLENGTH)
+    out = out substr(rest, 1, RSTART-1) tok
+    rest = substr(rest, RSTART+RLENGTH)
+    nm = tok; sub(/\[.*/, "", nm)
+    if (nm in varying) out = out "[l]"
+  }
+  return out rest
+}
+
+{
+  sub(/[ \t\r]+$/, "")
+  line[NR] = $0
+}
+
+END {
+  # header is the line with the kernel name, body runs till the last "}"
+  for (i=1; i<=NR; ++i) if (line[i] ~ /^GKYL_CU_DH/) hdr = i
+  last = NR; while (line[last] !~ /^\}/) last -= 1
+
+  kname = line[hdr]; sub(/\(.*/, "", kname); sub(/.*[ ]/, "", kname)
+  bname = kname; sub(/^vlasov_/, "vlasov_batch_", bname)
+  uses_field = (line[hdr] ~ /field/)
+
+  nst = 0
+  for (i=hdr+2; i<last; ++i) {
+    if (line[i] ~ /^[ ]*\/\//) { ncom += 1; com[ncom] = line[i]; continue }
+    nst += 1; st[nst] = line[i]
+  }
+
+  # lane-varying names, to a fixed point
+  varying["w"] = 1; varying["f"] = 1; varying["out"] = 1
+  changed = 1
+  while (changed) {
+    changed = 0
+    for (i=1; i<=nst; ++i) {
+      if (st[i] ~ /^[ ]*$/) continue
+      if (!refs_varying(st[i])) continue
+      lhs_names(st[i], names)
+      for (nm in names)
+        if (!(nm in varying)) { varying[nm] = 1; changed = 1 }
+    }
+  }
+
+  printf "#include <gkyl_vlasov_batch_kernels.h> \n"
+  printf "void %s(const double w[][GKYL_VLASOV_BATCH], const double *dxv, ", bname
+  if (uses_field) printf "const double *field, "
+  printf "const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) \n"
+  printf "{ \n"
+  printf "  // Batched version of %s: updates GKYL_VLASOV_BATCH cells\n", kname
+  printf "  // in the same configuration-space cell. Cell data is transposed,\n"
+  printf "  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the\n"
+  printf "  // CFL frequency of each cell.\n"
+  for (i=1; i<=ncom; ++i) print com[i]
+
+  # uniform statements
+  for (i=1; i<=nst; ++i)
+    if (st[i] !~ /^[ ]*$/ && !refs_varying(st[i])) print st[i]
+  printf "\n"
+  # varying local arrays get a lane index
+  for (i=1; i<=nst; ++i) {
+    if (st[i] ~ /^[ ]*(const[ ]+)?double[ ]+[A-Za-z_][A-Za-z_0-9]*\[[0-9]+\][ ]*=[ ]*\{/ && refs_varying(st[i])) {
+      decl = st[i]; sub(/\][ ]*=.*/, "][GKYL_VLASOV_BATCH] = {{0.0}};", decl)
+      print decl
+      hoisted[i] = 1; nhoisted += 1
+    }
+  }
+  if (nhoisted) printf "\n"
+  printf "#pragma GCC ivdep\n"
+  printf "  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { \n"
+  prev_blank = 1
+  for (i=1; i<=nst; ++i) {
+    if (i in hoisted) continue
+    if (st[i] ~ /^[ ]*$/) {
+      if (!prev_blank) printf "\n"
+      prev_blank = 1
+      continue
+    }
+    if (!refs_varying(st[i]) && st[i] !~ /^[ ]*return/) continue
+    s = lane_refs(st[i])
+    if (s ~ /^[ ]*return/) { sub(/^[ ]*return[ ]*/, "cfl[l] = ", s); s = "  " s }
+    print "  " s
+    prev_blank = 0
+  }
+  printf "  } \n"
+  printf "} \n"
+}
+'
+
+for kern in $kernel_list
+do
+  bkern=`echo $kern | sed 's/^vlasov_/vlasov_batch_/'`
+  awk "$batch_awk" $kern > $bkern
+done
+
+# declarations
+(
+cat <<EOF
+#pragma once
+#include <math.h>
+#include <gkyl_util.h>
+EXTERN_C_BEG
+
+// Number of cells updated by a batched kernel: one AVX-512 register
+// of doubles, or two AVX2 registers
+#define GKYL_VLASOV_BATCH 8
+
+EOF
+for kern in $kernel_list
+do
+  bkern=`echo $kern | sed 's/^vlasov_/vlasov_batch_/'`
+  head -2 $bkern | tail -1 | sed 's/ *$/; /'
+done
+cat <<EOF
+
+EXTERN_C_END
+EOF
+) > gkyl_vlasov_batch_kernels.h
@@ -0,0 +1,186 @@
+#!/bin/sh
+
+# Generate vlasov_kernel_cost.c: static FLOP and byte counts of the
+# generated Vlasov volume and surface kernels, used by the roofline
+# report. Run from kernels/vlasov after regenerating the kernels:
+#
+#   ./gen-kernel-cost.sh > vlasov_kernel_cost.c
+#
+# FLOPs are the +, -, *, / operators (and fabs, sqrt, ...) executed
+# in one call, including those in the inlined basis helpers. For an
+# if/else only the more expensive branch is counted. Bytes are the
+# compulsory traffic of one call: 8 bytes for each distinct element
+# of an input array that is read and each distinct element of an
+# output array that is written.
+
+kernel_list=`ls vlasov_*vol_*.c vlasov_*surf*.c | grep -v batch | sort`
+
+cost_awk='
+function is_local(nm) { return (nm in local) }
+
+# count operators in a statement, adding the cost of the inlined calls
+function count_ops(ln,   n, i, c, prev, tok, rest, nm, a, na, k, key, nidx, idx, j) {
+  n = 0
+  # calls to helpers and math functions
+  rest = ln
+  while (match(rest, /[A-Za-z_][A-Za-z_0-9]*[ ]*\(/)) {
+    nm = substr(rest, RSTART, RLENGTH-1); sub(/[ ]+$/, "", nm)
+    rest = substr(rest, RSTART+RLENGTH)
+    if (nm in fn_flops) {
+      n += fn_flops[nm]
+      # map the refs of the helper params onto the arguments
+      tok = rest; sub(/\).*/, "", tok)
+      na = split(tok, a, ",")
+      for (k=1; k<=na; ++k) {
+        gsub(/[ &]/, "", a[k])
+        key = nm SUBSEP k
+        if ((key in fn_refs) && !is_local(a[k])) {
+          nidx = split(fn_refs[key], idx, " ")
+          for (j=1; j<=nidx; ++j) refs[a[k] "[" idx[j] "]"] = 1
+        }
+      }
+    }
+    else if (nm == "fabs" || nm == "sqrt" || nm == "fmax" || nm == "fmin" || nm == "exp" || nm == "pow")
+      n += 1
+  }
+
+  gsub(/\[[^]]*\]/, "[]", ln)
+  gsub(/(double|float|int)[ ]*\*/, "", ln)
+  gsub(/[0-9.][eE][-+][0-9]+/, "0", ln)
+  prev = ""
+  for (i=1; i<=length(ln); ++i) {
+    c = substr(ln, i, 1)
+    if (c == " " || c == "\t") continue
+    if (c == "+" || c == "-" || c == "*" || c == "/") {
+      # skip unary signs
+      if (!((c == "-" || c == "+") && (prev == "" || index("=(,*/+-", prev) > 0)))
+        n += 1
+    }
+    prev = c
+  }
+  if (ln ~ /return[ ]*-/) n -= 1
+  return n
+}
+
+# record element references X[n] to non-local arrays
+function record_refs(ln,   rest, tok, nm, id, pi, lhs) {
+  lhs = ln; sub(/[-+*\/]?=.*/, "", lhs)
+  rest = ln
+  while (match(rest, /&?[A-Za-z_][A-Za-z_0-9]*\[[0-9]+\]/)) {
+    tok = substr(rest, RSTART, RLENGTH)
+    rest = substr(rest, RSTART+RLENGTH)
+    if (substr(tok, 1, 1) == "&") continue
+    nm = tok; sub(/\[.*/, "", nm)
+    id = tok; sub(/.*\[/, "", id); sub(/\]/, "", id)
+    if (is_local(nm)) continue
+    if (nm in param) {
+      pi = param[nm]
+      if (!((cur SUBSEP pi SUBSEP id) in seen_param)) {
+        seen_param[cur, pi, id] = 1
+        fn_refs[cur, pi] = fn_refs[cur, pi] " " id
+      }
+    }
+    refs[tok] = 1
+  }
+  if (lhs ~ /^[ ]*[A-Za-z_][A-Za-z_0-9]*\[[0-9]+\][ ]*$/) {
+    gsub(/ /, "", lhs); nm = lhs; sub(/\[.*/, "", nm)
+    if (!is_local(nm)) stores[lhs] = 1
+  }
+}
+
+function start_fn(ln,   nm, plist, np, p, k) {
+  nm = ln; sub(/\(.*/, "", nm); sub(/.*[ *]/, "", nm)
+  cur = nm
+  plist = ln; sub(/^[^(]*\(/, "", plist); sub(/\).*/, "", plist)
+  split("", param); split("", local); split("", refs); split("", stores)
+  np = split(plist, p, ",")
+  for (k=1; k<=np; ++k) {
+    sub(/[ ]+$/, "", p[k]); sub(/.*[ *]/, "", p[k])
+    param[p[k]] = k
+  }
+  sp = 0; total[0] = 0
+  infn = 1
+  inbody = (ln ~ /\{[ ]*$/)
+}
+
+function end_fn(   nb, t) {
+  fn_flops[cur] = total[0]
+  nb = 0
+  for (t in refs) nb += 1
+  for (t in stores) nb += 1
+  fn_bytes[cur] = 8*nb
+  infn = 0
+  if (cur ~ /^vlasov_/) printf "  { \"%s\", %d, %d },\n", cur, fn_flops[cur], fn_bytes[cur]
+}
+
+{
+  sub(/\/\/.*/, "")
+  sub(/[ \t\r]+$/, "")
+}
+
+/^#/ { next }
+
+!infn && /^[A-Za-z_].*[A-Za-z_0-9]+\(/ && $0 !~ /;$/ { start_fn($0); next }
+
+infn && !inbody {
+  if ($0 ~ /^\{/) inbody = 1
+  next
+}
+
+infn {
+  if ($0 ~ /^[ ]*if[ ]*\(.*\{$/) {
+    cond = $0; sub(/^[ ]*if[ ]*/, "", cond); sub(/\{$/, "", cond)
+    record_refs(cond)
+    total[sp] += count_ops(cond)
+    sp += 1; total[sp] = 0; other[sp] = -1
+    next
+  }
+  if ($0 ~ /^[ ]*\}[ ]*else[ ]*\{$/) {
+    other[sp] = total[sp]; total[sp] = 0
+    next
+  }
+  if ($0 ~ /^[ ]*\}$/) {
+    if (sp == 0) { end_fn(); next }
+    t = (other[sp] > total[sp]) ? other[sp] : total[sp]
+    sp -= 1; total[sp] += t
+    next
+  }
+  if ($0 ~ /^[ ]*(const[ ]+)?(double|float|int)[ ]+[A-Za-z_][A-Za-z_0-9]*\[/) {
+    nm = $0; sub(/^[ ]*(const[ ]+)?(double|float|int)[ ]+/, "", nm); sub(/\[.*/, "", nm)
+    local[nm] = 1
+    next
+  }
+  if ($0 ~ /^[ ]*return[ ]+0(\.0)?;$/ || $0 ~ /^[ ]*$/) next
+  record_refs($0)
+  total[sp] += count_ops($0)
+}
+'
+
+cat <<EOF
+// Generated by gen-kernel-cost.sh. Do not edit.
+
+#include <string.h>
+#include <gkyl_vlasov_kernel_cost.h>
+
+static const struct gkyl_kern_cost vlasov_kernel_costs[] = {
+EOF
+
+for kern in $kernel_list
+do
+  headers=`grep "^#include <gkyl_basis_" $kern | sed -e 's/#include <//' -e 's/>.*//' -e 's|^|../basis/|'`
+  awk "$cost_awk" $headers $kern
+done
+
+cat <<EOF
+};
+
+const struct gkyl_kern_cost*
+gkyl_vlasov_kernel_cost(const char *name)
+{
+  int nkern = sizeof(vlasov_kernel_costs)/sizeof(vlasov_kernel_costs[0]);
+  for (int i=0; i<nkern; ++i)
+    if (strcmp(vlasov_kernel_costs[i].name, name) == 0)
+      return &vlasov_kernel_costs[i];
+  return 0;
+}
+EOF
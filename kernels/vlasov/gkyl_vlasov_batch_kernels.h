@@ -0,0 +1,55 @@
+#pragma once
+#include <math.h>
+#include <gkyl_util.h>
+EXTERN_C_BEG
+
+// Number of cells updated by a batched kernel: one AVX-512 register
+// of doubles, or two AVX2 registers
+#define GKYL_VLASOV_BATCH 8
+
+void vlasov_batch_stream_vol_1x1v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_1x1v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_1x1v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_1x1v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_1x2v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_1x2v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_1x2v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_1x2v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_1x3v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_1x3v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_1x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_1x3v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_2x2v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_2x2v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_2x2v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_2x2v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_2x3v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_2x3v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_2x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_2x3v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_3x3v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_stream_vol_3x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x1v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x1v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x1v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x1v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x2v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x2v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x2v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x2v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x3v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x3v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_1x3v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_2x2v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_2x2v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_2x2v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_2x2v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_2x3v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_2x3v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_2x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_2x3v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_3x3v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+void vlasov_batch_vol_3x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl); 
+
+EXTERN_C_END
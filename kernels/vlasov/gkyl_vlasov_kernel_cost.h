@@ -0,0 +1,23 @@
+#pragma once
+
+#include <gkyl_util.h>
+
+EXTERN_C_BEG
+
+// Static cost of one call to a generated kernel
+struct gkyl_kern_cost {
+  const char *name; // kernel name
+  long flops; // floating-point operations per call
+  long bytes; // compulsory memory traffic per call
+};
+
+/**
+ * Look up the static cost of a Vlasov kernel. The table is generated
+ * from the kernel sources by gen-kernel-cost.sh.
+ *
+ * @param name Kernel name, e.g. "vlasov_surfvx_1x2v_ser_p2"
+ * @return Kernel cost, or NULL if kernel is not in the table
+ */
+const struct gkyl_kern_cost* gkyl_vlasov_kernel_cost(const char *name);
+
+EXTERN_C_END
@@ -0,0 +1,27 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_1x1v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_1x1v_tensor_p2: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv1Ddx0 = dxv[1]/dxv[0];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w1Ddx0  = w[1][l]/dxv[0];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w1Ddx0+f[2][l]*dv1Ddx0;
+    out[3][l] += 3.464101615137754*f[2][l]*w1Ddx0+(0.8944271909999159*f[5][l]+f[0][l])*dv1Ddx0;
+    out[4][l] += 7.745966692414834*f[1][l]*w1Ddx0+2.23606797749979*f[3][l]*dv1Ddx0;
+    out[6][l] += 7.745966692414834*f[3][l]*w1Ddx0+(2.0*f[7][l]+2.23606797749979*f[1][l])*dv1Ddx0;
+    out[7][l] += 3.464101615137755*f[5][l]*w1Ddx0+0.8944271909999161*f[2][l]*dv1Ddx0;
+    out[8][l] += 7.745966692414834*f[7][l]*w1Ddx0+2.0*f[3][l]*dv1Ddx0;
+
+    cfl[l] = 5.0*(fabs(w1Ddx0)+0.5*dv1Ddx0);
+  } 
+} 
@@ -0,0 +1,39 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_1x2v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_1x2v_tensor_p2: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv1Ddx0 = dxv[1]/dxv[0];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w1Ddx0  = w[1][l]/dxv[0];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w1Ddx0+f[2][l]*dv1Ddx0;
+    out[4][l] += 3.464101615137754*f[2][l]*w1Ddx0+(0.8944271909999159*f[8][l]+f[0][l])*dv1Ddx0;
+    out[5][l] += 3.464101615137754*f[3][l]*w1Ddx0+f[6][l]*dv1Ddx0;
+    out[7][l] += 7.745966692414834*f[1][l]*w1Ddx0+2.23606797749979*f[4][l]*dv1Ddx0;
+    out[10][l] += 3.464101615137754*f[6][l]*w1Ddx0+(0.8944271909999161*f[14][l]+f[3][l])*dv1Ddx0;
+    out[11][l] += 7.745966692414834*f[4][l]*w1Ddx0+(2.0*f[12][l]+2.23606797749979*f[1][l])*dv1Ddx0;
+    out[12][l] += 3.464101615137755*f[8][l]*w1Ddx0+0.8944271909999161*f[2][l]*dv1Ddx0;
+    out[13][l] += 7.745966692414834*f[5][l]*w1Ddx0+2.23606797749979*f[10][l]*dv1Ddx0;
+    out[15][l] += 3.464101615137755*f[9][l]*w1Ddx0+f[16][l]*dv1Ddx0;
+    out[17][l] += 7.745966692414834*f[10][l]*w1Ddx0+(2.0*f[18][l]+2.23606797749979*f[5][l])*dv1Ddx0;
+    out[18][l] += 3.464101615137755*f[14][l]*w1Ddx0+0.8944271909999159*f[6][l]*dv1Ddx0;
+    out[19][l] += 3.464101615137755*f[16][l]*w1Ddx0+(0.8944271909999159*f[22][l]+f[9][l])*dv1Ddx0;
+    out[20][l] += 7.745966692414834*f[12][l]*w1Ddx0+2.0*f[4][l]*dv1Ddx0;
+    out[21][l] += 7.745966692414834*f[15][l]*w1Ddx0+2.23606797749979*f[19][l]*dv1Ddx0;
+    out[23][l] += 7.745966692414834*f[18][l]*w1Ddx0+2.0*f[10][l]*dv1Ddx0;
+    out[24][l] += 7.745966692414834*f[19][l]*w1Ddx0+(2.0*f[25][l]+2.23606797749979*f[15][l])*dv1Ddx0;
+    out[25][l] += 3.464101615137754*f[22][l]*w1Ddx0+0.8944271909999161*f[16][l]*dv1Ddx0;
+    out[26][l] += 7.745966692414834*f[25][l]*w1Ddx0+2.0*f[19][l]*dv1Ddx0;
+
+    cfl[l] = 5.0*(fabs(w1Ddx0)+0.5*dv1Ddx0);
+  } 
+} 
@@ -0,0 +1,29 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_1x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_1x3v_tensor_p1: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv1Ddx0 = dxv[1]/dxv[0];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w1Ddx0  = w[1][l]/dxv[0];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w1Ddx0+f[2][l]*dv1Ddx0;
+    out[5][l] += 3.464101615137754*f[2][l]*w1Ddx0+f[0][l]*dv1Ddx0;
+    out[6][l] += 3.464101615137754*f[3][l]*w1Ddx0+f[7][l]*dv1Ddx0;
+    out[8][l] += 3.464101615137754*f[4][l]*w1Ddx0+f[9][l]*dv1Ddx0;
+    out[11][l] += 3.464101615137754*f[7][l]*w1Ddx0+f[3][l]*dv1Ddx0;
+    out[12][l] += 3.464101615137754*f[9][l]*w1Ddx0+f[4][l]*dv1Ddx0;
+    out[13][l] += 3.464101615137754*f[10][l]*w1Ddx0+f[14][l]*dv1Ddx0;
+    out[15][l] += 3.464101615137754*f[14][l]*w1Ddx0+f[10][l]*dv1Ddx0;
+
+    cfl[l] = 3.0*(fabs(w1Ddx0)+0.5*dv1Ddx0);
+  } 
+} 
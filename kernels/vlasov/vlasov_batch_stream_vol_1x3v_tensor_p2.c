@@ -0,0 +1,75 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_1x3v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_1x3v_tensor_p2: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv1Ddx0 = dxv[1]/dxv[0];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w1Ddx0  = w[1][l]/dxv[0];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w1Ddx0+f[2][l]*dv1Ddx0;
+    out[5][l] += 3.464101615137754*f[2][l]*w1Ddx0+(0.8944271909999159*f[12][l]+f[0][l])*dv1Ddx0;
+    out[6][l] += 3.464101615137754*f[3][l]*w1Ddx0+f[7][l]*dv1Ddx0;
+    out[8][l] += 3.464101615137754*f[4][l]*w1Ddx0+f[9][l]*dv1Ddx0;
+    out[11][l] += 7.745966692414834*f[1][l]*w1Ddx0+2.23606797749979*f[5][l]*dv1Ddx0;
+    out[15][l] += 3.464101615137754*f[7][l]*w1Ddx0+(0.8944271909999161*f[22][l]+f[3][l])*dv1Ddx0;
+    out[16][l] += 3.464101615137754*f[9][l]*w1Ddx0+(0.8944271909999161*f[26][l]+f[4][l])*dv1Ddx0;
+    out[17][l] += 3.464101615137754*f[10][l]*w1Ddx0+f[18][l]*dv1Ddx0;
+    out[19][l] += 7.745966692414834*f[5][l]*w1Ddx0+(2.0*f[20][l]+2.23606797749979*f[1][l])*dv1Ddx0;
+    out[20][l] += 3.464101615137755*f[12][l]*w1Ddx0+0.8944271909999161*f[2][l]*dv1Ddx0;
+    out[21][l] += 7.745966692414834*f[6][l]*w1Ddx0+2.23606797749979*f[15][l]*dv1Ddx0;
+    out[23][l] += 3.464101615137755*f[13][l]*w1Ddx0+f[24][l]*dv1Ddx0;
+    out[25][l] += 7.745966692414834*f[8][l]*w1Ddx0+2.23606797749979*f[16][l]*dv1Ddx0;
+    out[28][l] += 3.464101615137755*f[14][l]*w1Ddx0+f[29][l]*dv1Ddx0;
+    out[31][l] += 3.464101615137754*f[18][l]*w1Ddx0+(0.8944271909999159*f[38][l]+f[10][l])*dv1Ddx0;
+    out[32][l] += 7.745966692414834*f[15][l]*w1Ddx0+(2.0*f[33][l]+2.23606797749979*f[6][l])*dv1Ddx0;
+    out[33][l] += 3.464101615137755*f[22][l]*w1Ddx0+0.8944271909999159*f[7][l]*dv1Ddx0;
+    out[34][l] += 3.464101615137755*f[24][l]*w1Ddx0+(0.8944271909999159*f[46][l]+f[13][l])*dv1Ddx0;
+    out[35][l] += 7.745966692414834*f[16][l]*w1Ddx0+(2.0*f[36][l]+2.23606797749979*f[8][l])*dv1Ddx0;
+    out[36][l] += 3.464101615137755*f[26][l]*w1Ddx0+0.8944271909999159*f[9][l]*dv1Ddx0;
+    out[37][l] += 7.745966692414834*f[17][l]*w1Ddx0+2.23606797749979*f[31][l]*dv1Ddx0;
+    out[39][l] += 3.464101615137755*f[27][l]*w1Ddx0+f[40][l]*dv1Ddx0;
+    out[41][l] += 3.464101615137755*f[29][l]*w1Ddx0+(0.8944271909999159*f[48][l]+f[14][l])*dv1Ddx0;
+    out[42][l] += 3.464101615137755*f[30][l]*w1Ddx0+f[43][l]*dv1Ddx0;
+    out[44][l] += 7.745966692414834*f[20][l]*w1Ddx0+2.0*f[5][l]*dv1Ddx0;
+    out[45][l] += 7.745966692414834*f[23][l]*w1Ddx0+2.23606797749979*f[34][l]*dv1Ddx0;
+    out[47][l] += 7.745966692414834*f[28][l]*w1Ddx0+2.23606797749979*f[41][l]*dv1Ddx0;
+    out[50][l] += 7.745966692414834*f[31][l]*w1Ddx0+(2.0*f[51][l]+2.23606797749979*f[17][l])*dv1Ddx0;
+    out[51][l] += 3.464101615137755*f[38][l]*w1Ddx0+0.8944271909999161*f[18][l]*dv1Ddx0;
+    out[52][l] += 3.464101615137755*f[40][l]*w1Ddx0+(0.8944271909999161*f[59][l]+f[27][l])*dv1Ddx0;
+    out[53][l] += 3.464101615137755*f[43][l]*w1Ddx0+(0.8944271909999161*f[63][l]+f[30][l])*dv1Ddx0;
+    out[54][l] += 7.745966692414834*f[33][l]*w1Ddx0+2.0*f[15][l]*dv1Ddx0;
+    out[55][l] += 7.745966692414834*f[34][l]*w1Ddx0+(2.0*f[56][l]+2.23606797749979*f[23][l])*dv1Ddx0;
+    out[56][l] += 3.464101615137754*f[46][l]*w1Ddx0+0.8944271909999161*f[24][l]*dv1Ddx0;
+    out[57][l] += 7.745966692414834*f[36][l]*w1Ddx0+2.0*f[16][l]*dv1Ddx0;
+    out[58][l] += 7.745966692414834*f[39][l]*w1Ddx0+2.23606797749979*f[52][l]*dv1Ddx0;
+    out[60][l] += 7.745966692414834*f[41][l]*w1Ddx0+(2.0*f[61][l]+2.23606797749979*f[28][l])*dv1Ddx0;
+    out[61][l] += 3.464101615137754*f[48][l]*w1Ddx0+0.8944271909999161*f[29][l]*dv1Ddx0;
+    out[62][l] += 7.745966692414834*f[42][l]*w1Ddx0+2.23606797749979*f[53][l]*dv1Ddx0;
+    out[64][l] += 3.464101615137754*f[49][l]*w1Ddx0+f[65][l]*dv1Ddx0;
+    out[66][l] += 7.745966692414834*f[51][l]*w1Ddx0+2.0*f[31][l]*dv1Ddx0;
+    out[67][l] += 7.745966692414834*f[52][l]*w1Ddx0+(2.0*f[68][l]+2.23606797749979*f[39][l])*dv1Ddx0;
+    out[68][l] += 3.464101615137754*f[59][l]*w1Ddx0+0.8944271909999159*f[40][l]*dv1Ddx0;
+    out[69][l] += 7.745966692414834*f[53][l]*w1Ddx0+(2.0*f[70][l]+2.23606797749979*f[42][l])*dv1Ddx0;
+    out[70][l] += 3.464101615137754*f[63][l]*w1Ddx0+0.8944271909999159*f[43][l]*dv1Ddx0;
+    out[71][l] += 3.464101615137754*f[65][l]*w1Ddx0+(0.8944271909999159*f[75][l]+f[49][l])*dv1Ddx0;
+    out[72][l] += 7.745966692414834*f[56][l]*w1Ddx0+2.0*f[34][l]*dv1Ddx0;
+    out[73][l] += 7.745966692414834*f[61][l]*w1Ddx0+2.0*f[41][l]*dv1Ddx0;
+    out[74][l] += 7.745966692414834*f[64][l]*w1Ddx0+2.23606797749979*f[71][l]*dv1Ddx0;
+    out[76][l] += 7.745966692414834*f[68][l]*w1Ddx0+2.0*f[52][l]*dv1Ddx0;
+    out[77][l] += 7.745966692414834*f[70][l]*w1Ddx0+2.0*f[53][l]*dv1Ddx0;
+    out[78][l] += 7.745966692414834*f[71][l]*w1Ddx0+(2.0*f[79][l]+2.23606797749979*f[64][l])*dv1Ddx0;
+    out[79][l] += 3.464101615137755*f[75][l]*w1Ddx0+0.8944271909999161*f[65][l]*dv1Ddx0;
+    out[80][l] += 7.745966692414834*f[79][l]*w1Ddx0+2.0*f[71][l]*dv1Ddx0;
+
+    cfl[l] = 5.0*(fabs(w1Ddx0)+0.5*dv1Ddx0);
+  } 
+} 
@@ -0,0 +1,35 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_2x2v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_2x2v_tensor_p1: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv2Ddx0 = dxv[2]/dxv[0];
+  double dv3Ddx1 = dxv[3]/dxv[1];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w2Ddx0  = w[2][l]/dxv[0];
+    double w3Ddx1  = w[3][l]/dxv[1];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w2Ddx0+f[3][l]*dv2Ddx0;
+    out[2][l] += 3.464101615137754*f[0][l]*w3Ddx1+f[4][l]*dv3Ddx1;
+    out[5][l] += 3.464101615137754*f[1][l]*w3Ddx1+3.464101615137754*f[2][l]*w2Ddx0+f[8][l]*dv3Ddx1+f[7][l]*dv2Ddx0;
+    out[6][l] += 3.464101615137754*f[3][l]*w2Ddx0+f[0][l]*dv2Ddx0;
+    out[7][l] += 3.464101615137754*f[3][l]*w3Ddx1+f[10][l]*dv3Ddx1;
+    out[8][l] += 3.464101615137754*f[4][l]*w2Ddx0+f[10][l]*dv2Ddx0;
+    out[9][l] += 3.464101615137754*f[4][l]*w3Ddx1+f[0][l]*dv3Ddx1;
+    out[11][l] += 3.464101615137754*f[6][l]*w3Ddx1+3.464101615137754*f[7][l]*w2Ddx0+f[13][l]*dv3Ddx1+f[2][l]*dv2Ddx0;
+    out[12][l] += 3.464101615137754*f[8][l]*w3Ddx1+3.464101615137754*f[9][l]*w2Ddx0+f[1][l]*dv3Ddx1+f[14][l]*dv2Ddx0;
+    out[13][l] += 3.464101615137754*f[10][l]*w2Ddx0+f[4][l]*dv2Ddx0;
+    out[14][l] += 3.464101615137754*f[10][l]*w3Ddx1+f[3][l]*dv3Ddx1;
+    out[15][l] += 3.464101615137754*f[13][l]*w3Ddx1+3.464101615137754*f[14][l]*w2Ddx0+f[6][l]*dv3Ddx1+f[9][l]*dv2Ddx0;
+
+    cfl[l] = 3.0*(fabs(w2Ddx0)+0.5*dv2Ddx0+fabs(w3Ddx1)+0.5*dv3Ddx1);
+  } 
+} 
@@ -0,0 +1,95 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_2x2v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_2x2v_tensor_p2: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv2Ddx0 = dxv[2]/dxv[0];
+  double dv3Ddx1 = dxv[3]/dxv[1];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w2Ddx0  = w[2][l]/dxv[0];
+    double w3Ddx1  = w[3][l]/dxv[1];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w2Ddx0+f[3][l]*dv2Ddx0;
+    out[2][l] += 3.464101615137754*f[0][l]*w3Ddx1+f[4][l]*dv3Ddx1;
+    out[5][l] += 3.464101615137754*f[1][l]*w3Ddx1+3.464101615137754*f[2][l]*w2Ddx0+f[8][l]*dv3Ddx1+f[7][l]*dv2Ddx0;
+    out[6][l] += 3.464101615137754*f[3][l]*w2Ddx0+(0.8944271909999159*f[13][l]+f[0][l])*dv2Ddx0;
+    out[7][l] += 3.464101615137754*f[3][l]*w3Ddx1+f[10][l]*dv3Ddx1;
+    out[8][l] += 3.464101615137754*f[4][l]*w2Ddx0+f[10][l]*dv2Ddx0;
+    out[9][l] += 3.464101615137754*f[4][l]*w3Ddx1+(0.8944271909999159*f[14][l]+f[0][l])*dv3Ddx1;
+    out[11][l] += 7.745966692414834*f[1][l]*w2Ddx0+2.23606797749979*f[6][l]*dv2Ddx0;
+    out[12][l] += 7.745966692414834*f[2][l]*w3Ddx1+2.23606797749979*f[9][l]*dv3Ddx1;
+    out[15][l] += 3.464101615137754*f[6][l]*w3Ddx1+3.464101615137754*f[7][l]*w2Ddx0+f[17][l]*dv3Ddx1+(0.8944271909999161*f[24][l]+f[2][l])*dv2Ddx0;
+    out[16][l] += 3.464101615137754*f[8][l]*w3Ddx1+3.464101615137754*f[9][l]*w2Ddx0+(0.8944271909999161*f[28][l]+f[1][l])*dv3Ddx1+f[18][l]*dv2Ddx0;
+    out[17][l] += 3.464101615137754*f[10][l]*w2Ddx0+(0.8944271909999161*f[27][l]+f[4][l])*dv2Ddx0;
+    out[18][l] += 3.464101615137754*f[10][l]*w3Ddx1+(0.8944271909999161*f[30][l]+f[3][l])*dv3Ddx1;
+    out[19][l] += 3.464101615137755*f[11][l]*w3Ddx1+7.745966692414834*f[5][l]*w2Ddx0+f[25][l]*dv3Ddx1+2.23606797749979*f[15][l]*dv2Ddx0;
+    out[20][l] += 7.745966692414834*f[5][l]*w3Ddx1+3.464101615137755*f[12][l]*w2Ddx0+2.23606797749979*f[16][l]*dv3Ddx1+f[22][l]*dv2Ddx0;
+    out[21][l] += 7.745966692414834*f[6][l]*w2Ddx0+(2.0*f[23][l]+2.23606797749979*f[1][l])*dv2Ddx0;
+    out[22][l] += 7.745966692414834*f[7][l]*w3Ddx1+2.23606797749979*f[18][l]*dv3Ddx1;
+    out[23][l] += 3.464101615137755*f[13][l]*w2Ddx0+0.8944271909999161*f[3][l]*dv2Ddx0;
+    out[24][l] += 3.464101615137755*f[13][l]*w3Ddx1+f[27][l]*dv3Ddx1;
+    out[25][l] += 7.745966692414834*f[8][l]*w2Ddx0+2.23606797749979*f[17][l]*dv2Ddx0;
+    out[26][l] += 7.745966692414834*f[9][l]*w3Ddx1+(2.0*f[29][l]+2.23606797749979*f[2][l])*dv3Ddx1;
+    out[28][l] += 3.464101615137755*f[14][l]*w2Ddx0+f[30][l]*dv2Ddx0;
+    out[29][l] += 3.464101615137755*f[14][l]*w3Ddx1+0.8944271909999161*f[4][l]*dv3Ddx1;
+    out[31][l] += 3.464101615137754*f[17][l]*w3Ddx1+3.464101615137754*f[18][l]*w2Ddx0+(0.8944271909999159*f[42][l]+f[6][l])*dv3Ddx1+(0.8944271909999159*f[40][l]+f[9][l])*dv2Ddx0;
+    out[32][l] += 3.464101615137755*f[21][l]*w3Ddx1+7.745966692414834*f[15][l]*w2Ddx0+f[37][l]*dv3Ddx1+(2.0*f[34][l]+2.23606797749979*f[5][l])*dv2Ddx0;
+    out[33][l] += 7.745966692414834*f[15][l]*w3Ddx1+3.464101615137755*f[22][l]*w2Ddx0+2.23606797749979*f[31][l]*dv3Ddx1+(0.8944271909999159*f[46][l]+f[12][l])*dv2Ddx0;
+    out[34][l] += 3.464101615137755*f[23][l]*w3Ddx1+3.464101615137755*f[24][l]*w2Ddx0+f[39][l]*dv3Ddx1+0.8944271909999159*f[7][l]*dv2Ddx0;
+    out[35][l] += 3.464101615137755*f[25][l]*w3Ddx1+7.745966692414834*f[16][l]*w2Ddx0+(0.8944271909999159*f[47][l]+f[11][l])*dv3Ddx1+2.23606797749979*f[31][l]*dv2Ddx0;
+    out[36][l] += 7.745966692414834*f[16][l]*w3Ddx1+3.464101615137755*f[26][l]*w2Ddx0+(2.0*f[41][l]+2.23606797749979*f[5][l])*dv3Ddx1+f[38][l]*dv2Ddx0;
+    out[37][l] += 7.745966692414834*f[17][l]*w2Ddx0+(2.0*f[39][l]+2.23606797749979*f[8][l])*dv2Ddx0;
+    out[38][l] += 7.745966692414834*f[18][l]*w3Ddx1+(2.0*f[43][l]+2.23606797749979*f[7][l])*dv3Ddx1;
+    out[39][l] += 3.464101615137755*f[27][l]*w2Ddx0+0.8944271909999159*f[10][l]*dv2Ddx0;
+    out[40][l] += 3.464101615137755*f[27][l]*w3Ddx1+(0.8944271909999159*f[49][l]+f[13][l])*dv3Ddx1;
+    out[41][l] += 3.464101615137755*f[28][l]*w3Ddx1+3.464101615137755*f[29][l]*w2Ddx0+0.8944271909999159*f[8][l]*dv3Ddx1+f[43][l]*dv2Ddx0;
+    out[42][l] += 3.464101615137755*f[30][l]*w2Ddx0+(0.8944271909999159*f[49][l]+f[14][l])*dv2Ddx0;
+    out[43][l] += 3.464101615137755*f[30][l]*w3Ddx1+0.8944271909999159*f[10][l]*dv3Ddx1;
+    out[44][l] += 7.745966692414834*f[19][l]*w3Ddx1+7.745966692414834*f[20][l]*w2Ddx0+2.23606797749979*f[35][l]*dv3Ddx1+2.23606797749979*f[33][l]*dv2Ddx0;
+    out[45][l] += 7.745966692414834*f[23][l]*w2Ddx0+2.0*f[6][l]*dv2Ddx0;
+    out[46][l] += 7.745966692414834*f[24][l]*w3Ddx1+2.23606797749979*f[40][l]*dv3Ddx1;
+    out[47][l] += 7.745966692414834*f[28][l]*w2Ddx0+2.23606797749979*f[42][l]*dv2Ddx0;
+    out[48][l] += 7.745966692414834*f[29][l]*w3Ddx1+2.0*f[9][l]*dv3Ddx1;
+    out[50][l] += 3.464101615137755*f[37][l]*w3Ddx1+7.745966692414834*f[31][l]*w2Ddx0+(0.8944271909999161*f[62][l]+f[21][l])*dv3Ddx1+(2.0*f[52][l]+2.23606797749979*f[16][l])*dv2Ddx0;
+    out[51][l] += 7.745966692414834*f[31][l]*w3Ddx1+3.464101615137755*f[38][l]*w2Ddx0+(2.0*f[53][l]+2.23606797749979*f[15][l])*dv3Ddx1+(0.8944271909999161*f[59][l]+f[26][l])*dv2Ddx0;
+    out[52][l] += 3.464101615137755*f[39][l]*w3Ddx1+3.464101615137755*f[40][l]*w2Ddx0+(0.8944271909999161*f[64][l]+f[23][l])*dv3Ddx1+0.8944271909999161*f[18][l]*dv2Ddx0;
+    out[53][l] += 3.464101615137755*f[42][l]*w3Ddx1+3.464101615137755*f[43][l]*w2Ddx0+0.8944271909999161*f[17][l]*dv3Ddx1+(0.8944271909999161*f[65][l]+f[29][l])*dv2Ddx0;
+    out[54][l] += 7.745966692414834*f[32][l]*w3Ddx1+7.745966692414834*f[33][l]*w2Ddx0+2.23606797749979*f[50][l]*dv3Ddx1+(2.0*f[56][l]+2.23606797749979*f[20][l])*dv2Ddx0;
+    out[55][l] += 3.464101615137754*f[45][l]*w3Ddx1+7.745966692414834*f[34][l]*w2Ddx0+f[58][l]*dv3Ddx1+2.0*f[15][l]*dv2Ddx0;
+    out[56][l] += 7.745966692414834*f[34][l]*w3Ddx1+3.464101615137754*f[46][l]*w2Ddx0+2.23606797749979*f[52][l]*dv3Ddx1+0.8944271909999161*f[22][l]*dv2Ddx0;
+    out[57][l] += 7.745966692414834*f[35][l]*w3Ddx1+7.745966692414834*f[36][l]*w2Ddx0+(2.0*f[60][l]+2.23606797749979*f[19][l])*dv3Ddx1+2.23606797749979*f[51][l]*dv2Ddx0;
+    out[58][l] += 7.745966692414834*f[39][l]*w2Ddx0+2.0*f[17][l]*dv2Ddx0;
+    out[59][l] += 7.745966692414834*f[40][l]*w3Ddx1+(2.0*f[65][l]+2.23606797749979*f[24][l])*dv3Ddx1;
+    out[60][l] += 3.464101615137754*f[47][l]*w3Ddx1+7.745966692414834*f[41][l]*w2Ddx0+0.8944271909999161*f[25][l]*dv3Ddx1+2.23606797749979*f[53][l]*dv2Ddx0;
+    out[61][l] += 7.745966692414834*f[41][l]*w3Ddx1+3.464101615137754*f[48][l]*w2Ddx0+2.0*f[16][l]*dv3Ddx1+f[63][l]*dv2Ddx0;
+    out[62][l] += 7.745966692414834*f[42][l]*w2Ddx0+(2.0*f[64][l]+2.23606797749979*f[28][l])*dv2Ddx0;
+    out[63][l] += 7.745966692414834*f[43][l]*w3Ddx1+2.0*f[18][l]*dv3Ddx1;
+    out[64][l] += 3.464101615137754*f[49][l]*w2Ddx0+0.8944271909999161*f[30][l]*dv2Ddx0;
+    out[65][l] += 3.464101615137754*f[49][l]*w3Ddx1+0.8944271909999161*f[27][l]*dv3Ddx1;
+    out[66][l] += 7.745966692414834*f[50][l]*w3Ddx1+7.745966692414834*f[51][l]*w2Ddx0+(2.0*f[69][l]+2.23606797749979*f[32][l])*dv3Ddx1+(2.0*f[68][l]+2.23606797749979*f[36][l])*dv2Ddx0;
+    out[67][l] += 3.464101615137754*f[58][l]*w3Ddx1+7.745966692414834*f[52][l]*w2Ddx0+(0.8944271909999159*f[74][l]+f[45][l])*dv3Ddx1+2.0*f[31][l]*dv2Ddx0;
+    out[68][l] += 7.745966692414834*f[52][l]*w3Ddx1+3.464101615137754*f[59][l]*w2Ddx0+(2.0*f[71][l]+2.23606797749979*f[34][l])*dv3Ddx1+0.8944271909999159*f[38][l]*dv2Ddx0;
+    out[69][l] += 3.464101615137754*f[62][l]*w3Ddx1+7.745966692414834*f[53][l]*w2Ddx0+0.8944271909999159*f[37][l]*dv3Ddx1+(2.0*f[71][l]+2.23606797749979*f[41][l])*dv2Ddx0;
+    out[70][l] += 7.745966692414834*f[53][l]*w3Ddx1+3.464101615137754*f[63][l]*w2Ddx0+2.0*f[31][l]*dv3Ddx1+(0.8944271909999159*f[75][l]+f[48][l])*dv2Ddx0;
+    out[71][l] += 3.464101615137754*f[64][l]*w3Ddx1+3.464101615137754*f[65][l]*w2Ddx0+0.8944271909999159*f[39][l]*dv3Ddx1+0.8944271909999159*f[43][l]*dv2Ddx0;
+    out[72][l] += 7.745966692414834*f[55][l]*w3Ddx1+7.745966692414834*f[56][l]*w2Ddx0+2.23606797749979*f[67][l]*dv3Ddx1+2.0*f[33][l]*dv2Ddx0;
+    out[73][l] += 7.745966692414834*f[60][l]*w3Ddx1+7.745966692414834*f[61][l]*w2Ddx0+2.0*f[35][l]*dv3Ddx1+2.23606797749979*f[70][l]*dv2Ddx0;
+    out[74][l] += 7.745966692414834*f[64][l]*w2Ddx0+2.0*f[42][l]*dv2Ddx0;
+    out[75][l] += 7.745966692414834*f[65][l]*w3Ddx1+2.0*f[40][l]*dv3Ddx1;
+    out[76][l] += 7.745966692414834*f[67][l]*w3Ddx1+7.745966692414834*f[68][l]*w2Ddx0+(2.0*f[78][l]+2.23606797749979*f[55][l])*dv3Ddx1+2.0*f[51][l]*dv2Ddx0;
+    out[77][l] += 7.745966692414834*f[69][l]*w3Ddx1+7.745966692414834*f[70][l]*w2Ddx0+2.0*f[50][l]*dv3Ddx1+(2.0*f[79][l]+2.23606797749979*f[61][l])*dv2Ddx0;
+    out[78][l] += 3.464101615137755*f[74][l]*w3Ddx1+7.745966692414834*f[71][l]*w2Ddx0+0.8944271909999161*f[58][l]*dv3Ddx1+2.0*f[53][l]*dv2Ddx0;
+    out[79][l] += 7.745966692414834*f[71][l]*w3Ddx1+3.464101615137755*f[75][l]*w2Ddx0+2.0*f[52][l]*dv3Ddx1+0.8944271909999161*f[63][l]*dv2Ddx0;
+    out[80][l] += 7.745966692414834*f[78][l]*w3Ddx1+7.745966692414834*f[79][l]*w2Ddx0+2.0*f[67][l]*dv3Ddx1+2.0*f[70][l]*dv2Ddx0;
+
+    cfl[l] = 5.0*(fabs(w2Ddx0)+0.5*dv2Ddx0+fabs(w3Ddx1)+0.5*dv3Ddx1);
+  } 
+} 
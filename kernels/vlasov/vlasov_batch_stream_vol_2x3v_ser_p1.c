@@ -0,0 +1,83 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_2x3v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_2x3v_ser_p1: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv2Ddx0 = dxv[2]/dxv[0];
+  double dv3Ddx1 = dxv[3]/dxv[1];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w2Ddx0  = w[2][l]/dxv[0];
+    double w3Ddx1  = w[3][l]/dxv[1];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w2Ddx0+f[3][l]*dv2Ddx0;
+    out[2][l] += 3.464101615137754*f[0][l]*w3Ddx1+f[4][l]*dv3Ddx1;
+    out[6][l] += 3.464101615137754*f[1][l]*w3Ddx1+3.464101615137754*f[2][l]*w2Ddx0+f[9][l]*dv3Ddx1+f[8][l]*dv2Ddx0;
+    out[7][l] += 3.464101615137754*f[3][l]*w2Ddx0+(0.8944271909999159*f[32][l]+f[0][l])*dv2Ddx0;
+    out[8][l] += 3.464101615137754*f[3][l]*w3Ddx1+f[11][l]*dv3Ddx1;
+    out[9][l] += 3.464101615137754*f[4][l]*w2Ddx0+f[11][l]*dv2Ddx0;
+    out[10][l] += 3.464101615137754*f[4][l]*w3Ddx1+(0.8944271909999159*f[48][l]+f[0][l])*dv3Ddx1;
+    out[12][l] += 3.464101615137754*f[5][l]*w2Ddx0+f[14][l]*dv2Ddx0;
+    out[13][l] += 3.464101615137754*f[5][l]*w3Ddx1+f[15][l]*dv3Ddx1;
+    out[16][l] += 3.464101615137754*f[7][l]*w3Ddx1+3.464101615137754*f[8][l]*w2Ddx0+f[18][l]*dv3Ddx1+(0.8944271909999161*f[34][l]+f[2][l])*dv2Ddx0;
+    out[17][l] += 3.464101615137754*f[9][l]*w3Ddx1+3.464101615137754*f[10][l]*w2Ddx0+(0.8944271909999161*f[49][l]+f[1][l])*dv3Ddx1+f[19][l]*dv2Ddx0;
+    out[18][l] += 3.464101615137754*f[11][l]*w2Ddx0+(0.8944271909999161*f[35][l]+f[4][l])*dv2Ddx0;
+    out[19][l] += 3.464101615137754*f[11][l]*w3Ddx1+(0.8944271909999161*f[51][l]+f[3][l])*dv3Ddx1;
+    out[20][l] += 3.464101615137754*f[12][l]*w3Ddx1+3.464101615137754*f[13][l]*w2Ddx0+f[23][l]*dv3Ddx1+f[22][l]*dv2Ddx0;
+    out[21][l] += 3.464101615137754*f[14][l]*w2Ddx0+(0.8944271909999161*f[36][l]+f[5][l])*dv2Ddx0;
+    out[22][l] += 3.464101615137754*f[14][l]*w3Ddx1+f[25][l]*dv3Ddx1;
+    out[23][l] += 3.464101615137754*f[15][l]*w2Ddx0+f[25][l]*dv2Ddx0;
+    out[24][l] += 3.464101615137754*f[15][l]*w3Ddx1+(0.8944271909999161*f[52][l]+f[5][l])*dv3Ddx1;
+    out[26][l] += 3.464101615137754*f[18][l]*w3Ddx1+3.464101615137754*f[19][l]*w2Ddx0+(0.8944271909999159*f[54][l]+f[7][l])*dv3Ddx1+(0.8944271909999159*f[39][l]+f[10][l])*dv2Ddx0;
+    out[27][l] += 3.464101615137754*f[21][l]*w3Ddx1+3.464101615137754*f[22][l]*w2Ddx0+f[29][l]*dv3Ddx1+(0.8944271909999159*f[41][l]+f[13][l])*dv2Ddx0;
+    out[28][l] += 3.464101615137754*f[23][l]*w3Ddx1+3.464101615137754*f[24][l]*w2Ddx0+(0.8944271909999159*f[56][l]+f[12][l])*dv3Ddx1+f[30][l]*dv2Ddx0;
+    out[29][l] += 3.464101615137754*f[25][l]*w2Ddx0+(0.8944271909999159*f[42][l]+f[15][l])*dv2Ddx0;
+    out[30][l] += 3.464101615137754*f[25][l]*w3Ddx1+(0.8944271909999159*f[58][l]+f[14][l])*dv3Ddx1;
+    out[31][l] += 3.464101615137754*f[29][l]*w3Ddx1+3.464101615137754*f[30][l]*w2Ddx0+(0.8944271909999161*f[61][l]+f[21][l])*dv3Ddx1+(0.8944271909999161*f[46][l]+f[24][l])*dv2Ddx0;
+    out[33][l] += 3.464101615137755*f[32][l]*w2Ddx0+0.8944271909999161*f[3][l]*dv2Ddx0;
+    out[34][l] += 3.464101615137755*f[32][l]*w3Ddx1+f[35][l]*dv3Ddx1;
+    out[37][l] += 3.464101615137755*f[33][l]*w3Ddx1+3.464101615137755*f[34][l]*w2Ddx0+f[38][l]*dv3Ddx1+0.8944271909999159*f[8][l]*dv2Ddx0;
+    out[38][l] += 3.464101615137755*f[35][l]*w2Ddx0+0.8944271909999159*f[11][l]*dv2Ddx0;
+    out[39][l] += 3.464101615137755*f[35][l]*w3Ddx1+f[32][l]*dv3Ddx1;
+    out[40][l] += 3.464101615137755*f[36][l]*w2Ddx0+0.8944271909999159*f[14][l]*dv2Ddx0;
+    out[41][l] += 3.464101615137755*f[36][l]*w3Ddx1+f[42][l]*dv3Ddx1;
+    out[43][l] += 3.464101615137755*f[38][l]*w3Ddx1+3.464101615137755*f[39][l]*w2Ddx0+f[33][l]*dv3Ddx1+0.8944271909999161*f[19][l]*dv2Ddx0;
+    out[44][l] += 3.464101615137755*f[40][l]*w3Ddx1+3.464101615137755*f[41][l]*w2Ddx0+f[45][l]*dv3Ddx1+0.8944271909999161*f[22][l]*dv2Ddx0;
+    out[45][l] += 3.464101615137755*f[42][l]*w2Ddx0+0.8944271909999161*f[25][l]*dv2Ddx0;
+    out[46][l] += 3.464101615137755*f[42][l]*w3Ddx1+f[36][l]*dv3Ddx1;
+    out[47][l] += 3.464101615137755*f[45][l]*w3Ddx1+3.464101615137755*f[46][l]*w2Ddx0+f[40][l]*dv3Ddx1+0.8944271909999159*f[30][l]*dv2Ddx0;
+    out[49][l] += 3.464101615137755*f[48][l]*w2Ddx0+f[51][l]*dv2Ddx0;
+    out[50][l] += 3.464101615137755*f[48][l]*w3Ddx1+0.8944271909999161*f[4][l]*dv3Ddx1;
+    out[53][l] += 3.464101615137755*f[49][l]*w3Ddx1+3.464101615137755*f[50][l]*w2Ddx0+0.8944271909999159*f[9][l]*dv3Ddx1+f[55][l]*dv2Ddx0;
+    out[54][l] += 3.464101615137755*f[51][l]*w2Ddx0+f[48][l]*dv2Ddx0;
+    out[55][l] += 3.464101615137755*f[51][l]*w3Ddx1+0.8944271909999159*f[11][l]*dv3Ddx1;
+    out[56][l] += 3.464101615137755*f[52][l]*w2Ddx0+f[58][l]*dv2Ddx0;
+    out[57][l] += 3.464101615137755*f[52][l]*w3Ddx1+0.8944271909999159*f[15][l]*dv3Ddx1;
+    out[59][l] += 3.464101615137755*f[54][l]*w3Ddx1+3.464101615137755*f[55][l]*w2Ddx0+0.8944271909999161*f[18][l]*dv3Ddx1+f[50][l]*dv2Ddx0;
+    out[60][l] += 3.464101615137755*f[56][l]*w3Ddx1+3.464101615137755*f[57][l]*w2Ddx0+0.8944271909999161*f[23][l]*dv3Ddx1+f[62][l]*dv2Ddx0;
+    out[61][l] += 3.464101615137755*f[58][l]*w2Ddx0+f[52][l]*dv2Ddx0;
+    out[62][l] += 3.464101615137755*f[58][l]*w3Ddx1+0.8944271909999161*f[25][l]*dv3Ddx1;
+    out[63][l] += 3.464101615137755*f[61][l]*w3Ddx1+3.464101615137755*f[62][l]*w2Ddx0+0.8944271909999159*f[29][l]*dv3Ddx1+f[57][l]*dv2Ddx0;
+    out[65][l] += 3.464101615137755*f[64][l]*w2Ddx0+f[67][l]*dv2Ddx0;
+    out[66][l] += 3.464101615137755*f[64][l]*w3Ddx1+f[68][l]*dv3Ddx1;
+    out[69][l] += 3.464101615137755*f[65][l]*w3Ddx1+3.464101615137755*f[66][l]*w2Ddx0+f[72][l]*dv3Ddx1+f[71][l]*dv2Ddx0;
+    out[70][l] += 3.464101615137755*f[67][l]*w2Ddx0+f[64][l]*dv2Ddx0;
+    out[71][l] += 3.464101615137755*f[67][l]*w3Ddx1+f[74][l]*dv3Ddx1;
+    out[72][l] += 3.464101615137755*f[68][l]*w2Ddx0+f[74][l]*dv2Ddx0;
+    out[73][l] += 3.464101615137755*f[68][l]*w3Ddx1+f[64][l]*dv3Ddx1;
+    out[75][l] += 3.464101615137755*f[70][l]*w3Ddx1+3.464101615137755*f[71][l]*w2Ddx0+f[77][l]*dv3Ddx1+f[66][l]*dv2Ddx0;
+    out[76][l] += 3.464101615137755*f[72][l]*w3Ddx1+3.464101615137755*f[73][l]*w2Ddx0+f[65][l]*dv3Ddx1+f[78][l]*dv2Ddx0;
+    out[77][l] += 3.464101615137755*f[74][l]*w2Ddx0+f[68][l]*dv2Ddx0;
+    out[78][l] += 3.464101615137755*f[74][l]*w3Ddx1+f[67][l]*dv3Ddx1;
+    out[79][l] += 3.464101615137755*f[77][l]*w3Ddx1+3.464101615137755*f[78][l]*w2Ddx0+f[70][l]*dv3Ddx1+f[73][l]*dv2Ddx0;
+
+    cfl[l] = 3.0*(fabs(w2Ddx0)+0.5*dv2Ddx0+fabs(w3Ddx1)+0.5*dv3Ddx1);
+  } 
+} 
@@ -0,0 +1,115 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_2x3v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_2x3v_ser_p2: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv2Ddx0 = dxv[2]/dxv[0];
+  double dv3Ddx1 = dxv[3]/dxv[1];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w2Ddx0  = w[2][l]/dxv[0];
+    double w3Ddx1  = w[3][l]/dxv[1];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w2Ddx0+f[3][l]*dv2Ddx0;
+    out[2][l] += 3.464101615137754*f[0][l]*w3Ddx1+f[4][l]*dv3Ddx1;
+    out[6][l] += 3.464101615137754*f[1][l]*w3Ddx1+3.464101615137754*f[2][l]*w2Ddx0+f[9][l]*dv3Ddx1+f[8][l]*dv2Ddx0;
+    out[7][l] += 3.464101615137754*f[3][l]*w2Ddx0+(0.8944271909999159*f[18][l]+f[0][l])*dv2Ddx0;
+    out[8][l] += 3.464101615137754*f[3][l]*w3Ddx1+f[11][l]*dv3Ddx1;
+    out[9][l] += 3.464101615137754*f[4][l]*w2Ddx0+f[11][l]*dv2Ddx0;
+    out[10][l] += 3.464101615137754*f[4][l]*w3Ddx1+(0.8944271909999159*f[19][l]+f[0][l])*dv3Ddx1;
+    out[12][l] += 3.464101615137754*f[5][l]*w2Ddx0+f[14][l]*dv2Ddx0;
+    out[13][l] += 3.464101615137754*f[5][l]*w3Ddx1+f[15][l]*dv3Ddx1;
+    out[16][l] += 7.745966692414834*f[1][l]*w2Ddx0+2.23606797749979*f[7][l]*dv2Ddx0;
+    out[17][l] += 7.745966692414834*f[2][l]*w3Ddx1+2.23606797749979*f[10][l]*dv3Ddx1;
+    out[21][l] += 3.464101615137754*f[7][l]*w3Ddx1+3.464101615137754*f[8][l]*w2Ddx0+f[23][l]*dv3Ddx1+(0.8944271909999161*f[36][l]+f[2][l])*dv2Ddx0;
+    out[22][l] += 3.464101615137754*f[9][l]*w3Ddx1+3.464101615137754*f[10][l]*w2Ddx0+(0.8944271909999161*f[40][l]+f[1][l])*dv3Ddx1+f[24][l]*dv2Ddx0;
+    out[23][l] += 3.464101615137754*f[11][l]*w2Ddx0+(0.8944271909999161*f[39][l]+f[4][l])*dv2Ddx0;
+    out[24][l] += 3.464101615137754*f[11][l]*w3Ddx1+(0.8944271909999161*f[42][l]+f[3][l])*dv3Ddx1;
+    out[25][l] += 3.464101615137754*f[12][l]*w3Ddx1+3.464101615137754*f[13][l]*w2Ddx0+f[28][l]*dv3Ddx1+f[27][l]*dv2Ddx0;
+    out[26][l] += 3.464101615137754*f[14][l]*w2Ddx0+(0.8944271909999161*f[45][l]+f[5][l])*dv2Ddx0;
+    out[27][l] += 3.464101615137754*f[14][l]*w3Ddx1+f[30][l]*dv3Ddx1;
+    out[28][l] += 3.464101615137754*f[15][l]*w2Ddx0+f[30][l]*dv2Ddx0;
+    out[29][l] += 3.464101615137754*f[15][l]*w3Ddx1+(0.8944271909999161*f[46][l]+f[5][l])*dv3Ddx1;
+    out[31][l] += 3.464101615137755*f[16][l]*w3Ddx1+7.745966692414834*f[6][l]*w2Ddx0+f[37][l]*dv3Ddx1+2.23606797749979*f[21][l]*dv2Ddx0;
+    out[32][l] += 7.745966692414834*f[6][l]*w3Ddx1+3.464101615137755*f[17][l]*w2Ddx0+2.23606797749979*f[22][l]*dv3Ddx1+f[34][l]*dv2Ddx0;
+    out[33][l] += 7.745966692414834*f[7][l]*w2Ddx0+(2.0*f[35][l]+2.23606797749979*f[1][l])*dv2Ddx0;
+    out[34][l] += 7.745966692414834*f[8][l]*w3Ddx1+2.23606797749979*f[24][l]*dv3Ddx1;
+    out[35][l] += 3.464101615137755*f[18][l]*w2Ddx0+0.8944271909999161*f[3][l]*dv2Ddx0;
+    out[36][l] += 3.464101615137755*f[18][l]*w3Ddx1+f[39][l]*dv3Ddx1;
+    out[37][l] += 7.745966692414834*f[9][l]*w2Ddx0+2.23606797749979*f[23][l]*dv2Ddx0;
+    out[38][l] += 7.745966692414834*f[10][l]*w3Ddx1+(2.0*f[41][l]+2.23606797749979*f[2][l])*dv3Ddx1;
+    out[40][l] += 3.464101615137755*f[19][l]*w2Ddx0+f[42][l]*dv2Ddx0;
+    out[41][l] += 3.464101615137755*f[19][l]*w3Ddx1+0.8944271909999161*f[4][l]*dv3Ddx1;
+    out[43][l] += 7.745966692414834*f[12][l]*w2Ddx0+2.23606797749979*f[26][l]*dv2Ddx0;
+    out[44][l] += 7.745966692414834*f[13][l]*w3Ddx1+2.23606797749979*f[29][l]*dv3Ddx1;
+    out[47][l] += 3.464101615137755*f[20][l]*w2Ddx0+f[49][l]*dv2Ddx0;
+    out[48][l] += 3.464101615137755*f[20][l]*w3Ddx1+f[50][l]*dv3Ddx1;
+    out[51][l] += 3.464101615137754*f[23][l]*w3Ddx1+3.464101615137754*f[24][l]*w2Ddx0+(0.8944271909999159*f[66][l]+f[7][l])*dv3Ddx1+(0.8944271909999159*f[64][l]+f[10][l])*dv2Ddx0;
+    out[52][l] += 3.464101615137754*f[26][l]*w3Ddx1+3.464101615137754*f[27][l]*w2Ddx0+f[54][l]*dv3Ddx1+(0.8944271909999159*f[73][l]+f[13][l])*dv2Ddx0;
+    out[53][l] += 3.464101615137754*f[28][l]*w3Ddx1+3.464101615137754*f[29][l]*w2Ddx0+(0.8944271909999159*f[77][l]+f[12][l])*dv3Ddx1+f[55][l]*dv2Ddx0;
+    out[54][l] += 3.464101615137754*f[30][l]*w2Ddx0+(0.8944271909999159*f[76][l]+f[15][l])*dv2Ddx0;
+    out[55][l] += 3.464101615137754*f[30][l]*w3Ddx1+(0.8944271909999159*f[79][l]+f[14][l])*dv3Ddx1;
+    out[56][l] += 3.464101615137755*f[33][l]*w3Ddx1+7.745966692414834*f[21][l]*w2Ddx0+f[61][l]*dv3Ddx1+(2.0*f[58][l]+2.23606797749979*f[6][l])*dv2Ddx0;
+    out[57][l] += 7.745966692414834*f[21][l]*w3Ddx1+3.464101615137755*f[34][l]*w2Ddx0+2.23606797749979*f[51][l]*dv3Ddx1+f[17][l]*dv2Ddx0;
+    out[58][l] += 3.464101615137755*f[35][l]*w3Ddx1+3.464101615137755*f[36][l]*w2Ddx0+f[63][l]*dv3Ddx1+0.8944271909999159*f[8][l]*dv2Ddx0;
+    out[59][l] += 3.464101615137755*f[37][l]*w3Ddx1+7.745966692414834*f[22][l]*w2Ddx0+f[16][l]*dv3Ddx1+2.23606797749979*f[51][l]*dv2Ddx0;
+    out[60][l] += 7.745966692414834*f[22][l]*w3Ddx1+3.464101615137755*f[38][l]*w2Ddx0+(2.0*f[65][l]+2.23606797749979*f[6][l])*dv3Ddx1+f[62][l]*dv2Ddx0;
+    out[61][l] += 7.745966692414834*f[23][l]*w2Ddx0+(2.0*f[63][l]+2.23606797749979*f[9][l])*dv2Ddx0;
+    out[62][l] += 7.745966692414834*f[24][l]*w3Ddx1+(2.0*f[67][l]+2.23606797749979*f[8][l])*dv3Ddx1;
+    out[63][l] += 3.464101615137755*f[39][l]*w2Ddx0+0.8944271909999159*f[11][l]*dv2Ddx0;
+    out[64][l] += 3.464101615137755*f[39][l]*w3Ddx1+f[18][l]*dv3Ddx1;
+    out[65][l] += 3.464101615137755*f[40][l]*w3Ddx1+3.464101615137755*f[41][l]*w2Ddx0+0.8944271909999159*f[9][l]*dv3Ddx1+f[67][l]*dv2Ddx0;
+    out[66][l] += 3.464101615137755*f[42][l]*w2Ddx0+f[19][l]*dv2Ddx0;
+    out[67][l] += 3.464101615137755*f[42][l]*w3Ddx1+0.8944271909999159*f[11][l]*dv3Ddx1;
+    out[68][l] += 3.464101615137755*f[43][l]*w3Ddx1+7.745966692414834*f[25][l]*w2Ddx0+f[74][l]*dv3Ddx1+2.23606797749979*f[52][l]*dv2Ddx0;
+    out[69][l] += 7.745966692414834*f[25][l]*w3Ddx1+3.464101615137755*f[44][l]*w2Ddx0+2.23606797749979*f[53][l]*dv3Ddx1+f[71][l]*dv2Ddx0;
+    out[70][l] += 7.745966692414834*f[26][l]*w2Ddx0+(2.0*f[72][l]+2.23606797749979*f[12][l])*dv2Ddx0;
+    out[71][l] += 7.745966692414834*f[27][l]*w3Ddx1+2.23606797749979*f[55][l]*dv3Ddx1;
+    out[72][l] += 3.464101615137755*f[45][l]*w2Ddx0+0.8944271909999159*f[14][l]*dv2Ddx0;
+    out[73][l] += 3.464101615137755*f[45][l]*w3Ddx1+f[76][l]*dv3Ddx1;
+    out[74][l] += 7.745966692414834*f[28][l]*w2Ddx0+2.23606797749979*f[54][l]*dv2Ddx0;
+    out[75][l] += 7.745966692414834*f[29][l]*w3Ddx1+(2.0*f[78][l]+2.23606797749979*f[13][l])*dv3Ddx1;
+    out[77][l] += 3.464101615137755*f[46][l]*w2Ddx0+f[79][l]*dv2Ddx0;
+    out[78][l] += 3.464101615137755*f[46][l]*w3Ddx1+0.8944271909999159*f[15][l]*dv3Ddx1;
+    out[80][l] += 3.464101615137755*f[47][l]*w3Ddx1+3.464101615137755*f[48][l]*w2Ddx0+f[83][l]*dv3Ddx1+f[82][l]*dv2Ddx0;
+    out[81][l] += 3.464101615137755*f[49][l]*w2Ddx0+f[20][l]*dv2Ddx0;
+    out[82][l] += 3.464101615137755*f[49][l]*w3Ddx1+f[85][l]*dv3Ddx1;
+    out[83][l] += 3.464101615137755*f[50][l]*w2Ddx0+f[85][l]*dv2Ddx0;
+    out[84][l] += 3.464101615137755*f[50][l]*w3Ddx1+f[20][l]*dv3Ddx1;
+    out[86][l] += 3.464101615137754*f[54][l]*w3Ddx1+3.464101615137754*f[55][l]*w2Ddx0+(0.8944271909999161*f[101][l]+f[26][l])*dv3Ddx1+(0.8944271909999161*f[99][l]+f[29][l])*dv2Ddx0;
+    out[87][l] += 3.464101615137755*f[61][l]*w3Ddx1+7.745966692414834*f[51][l]*w2Ddx0+f[33][l]*dv3Ddx1+(2.0*f[89][l]+2.23606797749979*f[22][l])*dv2Ddx0;
+    out[88][l] += 7.745966692414834*f[51][l]*w3Ddx1+3.464101615137755*f[62][l]*w2Ddx0+(2.0*f[90][l]+2.23606797749979*f[21][l])*dv3Ddx1+f[38][l]*dv2Ddx0;
+    out[89][l] += 3.464101615137755*f[63][l]*w3Ddx1+3.464101615137755*f[64][l]*w2Ddx0+f[35][l]*dv3Ddx1+0.8944271909999161*f[24][l]*dv2Ddx0;
+    out[90][l] += 3.464101615137755*f[66][l]*w3Ddx1+3.464101615137755*f[67][l]*w2Ddx0+0.8944271909999161*f[23][l]*dv3Ddx1+f[41][l]*dv2Ddx0;
+    out[91][l] += 3.464101615137755*f[70][l]*w3Ddx1+7.745966692414834*f[52][l]*w2Ddx0+f[96][l]*dv3Ddx1+(2.0*f[93][l]+2.23606797749979*f[25][l])*dv2Ddx0;
+    out[92][l] += 7.745966692414834*f[52][l]*w3Ddx1+3.464101615137755*f[71][l]*w2Ddx0+2.23606797749979*f[86][l]*dv3Ddx1+f[44][l]*dv2Ddx0;
+    out[93][l] += 3.464101615137755*f[72][l]*w3Ddx1+3.464101615137755*f[73][l]*w2Ddx0+f[98][l]*dv3Ddx1+0.8944271909999161*f[27][l]*dv2Ddx0;
+    out[94][l] += 3.464101615137755*f[74][l]*w3Ddx1+7.745966692414834*f[53][l]*w2Ddx0+f[43][l]*dv3Ddx1+2.23606797749979*f[86][l]*dv2Ddx0;
+    out[95][l] += 7.745966692414834*f[53][l]*w3Ddx1+3.464101615137755*f[75][l]*w2Ddx0+(2.0*f[100][l]+2.23606797749979*f[25][l])*dv3Ddx1+f[97][l]*dv2Ddx0;
+    out[96][l] += 7.745966692414834*f[54][l]*w2Ddx0+(2.0*f[98][l]+2.23606797749979*f[28][l])*dv2Ddx0;
+    out[97][l] += 7.745966692414834*f[55][l]*w3Ddx1+(2.0*f[102][l]+2.23606797749979*f[27][l])*dv3Ddx1;
+    out[98][l] += 3.464101615137755*f[76][l]*w2Ddx0+0.8944271909999161*f[30][l]*dv2Ddx0;
+    out[99][l] += 3.464101615137755*f[76][l]*w3Ddx1+f[45][l]*dv3Ddx1;
+    out[100][l] += 3.464101615137755*f[77][l]*w3Ddx1+3.464101615137755*f[78][l]*w2Ddx0+0.8944271909999161*f[28][l]*dv3Ddx1+f[102][l]*dv2Ddx0;
+    out[101][l] += 3.464101615137755*f[79][l]*w2Ddx0+f[46][l]*dv2Ddx0;
+    out[102][l] += 3.464101615137755*f[79][l]*w3Ddx1+0.8944271909999161*f[30][l]*dv3Ddx1;
+    out[103][l] += 3.464101615137755*f[81][l]*w3Ddx1+3.464101615137755*f[82][l]*w2Ddx0+f[105][l]*dv3Ddx1+f[48][l]*dv2Ddx0;
+    out[104][l] += 3.464101615137755*f[83][l]*w3Ddx1+3.464101615137755*f[84][l]*w2Ddx0+f[47][l]*dv3Ddx1+f[106][l]*dv2Ddx0;
+    out[105][l] += 3.464101615137755*f[85][l]*w2Ddx0+f[50][l]*dv2Ddx0;
+    out[106][l] += 3.464101615137755*f[85][l]*w3Ddx1+f[49][l]*dv3Ddx1;
+    out[107][l] += 3.464101615137755*f[96][l]*w3Ddx1+7.745966692414834*f[86][l]*w2Ddx0+f[70][l]*dv3Ddx1+(2.0*f[109][l]+2.23606797749979*f[53][l])*dv2Ddx0;
+    out[108][l] += 7.745966692414834*f[86][l]*w3Ddx1+3.464101615137755*f[97][l]*w2Ddx0+(2.0*f[110][l]+2.23606797749979*f[52][l])*dv3Ddx1+f[75][l]*dv2Ddx0;
+    out[109][l] += 3.464101615137755*f[98][l]*w3Ddx1+3.464101615137755*f[99][l]*w2Ddx0+f[72][l]*dv3Ddx1+0.8944271909999159*f[55][l]*dv2Ddx0;
+    out[110][l] += 3.464101615137755*f[101][l]*w3Ddx1+3.464101615137755*f[102][l]*w2Ddx0+0.8944271909999159*f[54][l]*dv3Ddx1+f[78][l]*dv2Ddx0;
+    out[111][l] += 3.464101615137755*f[105][l]*w3Ddx1+3.464101615137755*f[106][l]*w2Ddx0+f[81][l]*dv3Ddx1+f[84][l]*dv2Ddx0;
+
+    cfl[l] = 5.0*(fabs(w2Ddx0)+0.5*dv2Ddx0+fabs(w3Ddx1)+0.5*dv3Ddx1);
+  } 
+} 
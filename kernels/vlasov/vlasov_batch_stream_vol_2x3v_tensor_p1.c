@@ -0,0 +1,47 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_2x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_2x3v_tensor_p1: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv2Ddx0 = dxv[2]/dxv[0];
+  double dv3Ddx1 = dxv[3]/dxv[1];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w2Ddx0  = w[2][l]/dxv[0];
+    double w3Ddx1  = w[3][l]/dxv[1];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w2Ddx0+f[3][l]*dv2Ddx0;
+    out[2][l] += 3.464101615137754*f[0][l]*w3Ddx1+f[4][l]*dv3Ddx1;
+    out[6][l] += 3.464101615137754*f[1][l]*w3Ddx1+3.464101615137754*f[2][l]*w2Ddx0+f[9][l]*dv3Ddx1+f[8][l]*dv2Ddx0;
+    out[7][l] += 3.464101615137754*f[3][l]*w2Ddx0+f[0][l]*dv2Ddx0;
+    out[8][l] += 3.464101615137754*f[3][l]*w3Ddx1+f[11][l]*dv3Ddx1;
+    out[9][l] += 3.464101615137754*f[4][l]*w2Ddx0+f[11][l]*dv2Ddx0;
+    out[10][l] += 3.464101615137754*f[4][l]*w3Ddx1+f[0][l]*dv3Ddx1;
+    out[12][l] += 3.464101615137754*f[5][l]*w2Ddx0+f[14][l]*dv2Ddx0;
+    out[13][l] += 3.464101615137754*f[5][l]*w3Ddx1+f[15][l]*dv3Ddx1;
+    out[16][l] += 3.464101615137754*f[7][l]*w3Ddx1+3.464101615137754*f[8][l]*w2Ddx0+f[18][l]*dv3Ddx1+f[2][l]*dv2Ddx0;
+    out[17][l] += 3.464101615137754*f[9][l]*w3Ddx1+3.464101615137754*f[10][l]*w2Ddx0+f[1][l]*dv3Ddx1+f[19][l]*dv2Ddx0;
+    out[18][l] += 3.464101615137754*f[11][l]*w2Ddx0+f[4][l]*dv2Ddx0;
+    out[19][l] += 3.464101615137754*f[11][l]*w3Ddx1+f[3][l]*dv3Ddx1;
+    out[20][l] += 3.464101615137754*f[12][l]*w3Ddx1+3.464101615137754*f[13][l]*w2Ddx0+f[23][l]*dv3Ddx1+f[22][l]*dv2Ddx0;
+    out[21][l] += 3.464101615137754*f[14][l]*w2Ddx0+f[5][l]*dv2Ddx0;
+    out[22][l] += 3.464101615137754*f[14][l]*w3Ddx1+f[25][l]*dv3Ddx1;
+    out[23][l] += 3.464101615137754*f[15][l]*w2Ddx0+f[25][l]*dv2Ddx0;
+    out[24][l] += 3.464101615137754*f[15][l]*w3Ddx1+f[5][l]*dv3Ddx1;
+    out[26][l] += 3.464101615137754*f[18][l]*w3Ddx1+3.464101615137754*f[19][l]*w2Ddx0+f[7][l]*dv3Ddx1+f[10][l]*dv2Ddx0;
+    out[27][l] += 3.464101615137754*f[21][l]*w3Ddx1+3.464101615137754*f[22][l]*w2Ddx0+f[29][l]*dv3Ddx1+f[13][l]*dv2Ddx0;
+    out[28][l] += 3.464101615137754*f[23][l]*w3Ddx1+3.464101615137754*f[24][l]*w2Ddx0+f[12][l]*dv3Ddx1+f[30][l]*dv2Ddx0;
+    out[29][l] += 3.464101615137754*f[25][l]*w2Ddx0+f[15][l]*dv2Ddx0;
+    out[30][l] += 3.464101615137754*f[25][l]*w3Ddx1+f[14][l]*dv3Ddx1;
+    out[31][l] += 3.464101615137754*f[29][l]*w3Ddx1+3.464101615137754*f[30][l]*w2Ddx0+f[21][l]*dv3Ddx1+f[24][l]*dv2Ddx0;
+
+    cfl[l] = 3.0*(fabs(w2Ddx0)+0.5*dv2Ddx0+fabs(w3Ddx1)+0.5*dv3Ddx1);
+  } 
+} 
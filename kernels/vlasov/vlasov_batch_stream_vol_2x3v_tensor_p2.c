@@ -0,0 +1,239 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_2x3v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_2x3v_tensor_p2: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv2Ddx0 = dxv[2]/dxv[0];
+  double dv3Ddx1 = dxv[3]/dxv[1];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w2Ddx0  = w[2][l]/dxv[0];
+    double w3Ddx1  = w[3][l]/dxv[1];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w2Ddx0+f[3][l]*dv2Ddx0;
+    out[2][l] += 3.464101615137754*f[0][l]*w3Ddx1+f[4][l]*dv3Ddx1;
+    out[6][l] += 3.464101615137754*f[1][l]*w3Ddx1+3.464101615137754*f[2][l]*w2Ddx0+f[9][l]*dv3Ddx1+f[8][l]*dv2Ddx0;
+    out[7][l] += 3.464101615137754*f[3][l]*w2Ddx0+(0.8944271909999159*f[18][l]+f[0][l])*dv2Ddx0;
+    out[8][l] += 3.464101615137754*f[3][l]*w3Ddx1+f[11][l]*dv3Ddx1;
+    out[9][l] += 3.464101615137754*f[4][l]*w2Ddx0+f[11][l]*dv2Ddx0;
+    out[10][l] += 3.464101615137754*f[4][l]*w3Ddx1+(0.8944271909999159*f[19][l]+f[0][l])*dv3Ddx1;
+    out[12][l] += 3.464101615137754*f[5][l]*w2Ddx0+f[14][l]*dv2Ddx0;
+    out[13][l] += 3.464101615137754*f[5][l]*w3Ddx1+f[15][l]*dv3Ddx1;
+    out[16][l] += 7.745966692414834*f[1][l]*w2Ddx0+2.23606797749979*f[7][l]*dv2Ddx0;
+    out[17][l] += 7.745966692414834*f[2][l]*w3Ddx1+2.23606797749979*f[10][l]*dv3Ddx1;
+    out[21][l] += 3.464101615137754*f[7][l]*w3Ddx1+3.464101615137754*f[8][l]*w2Ddx0+f[23][l]*dv3Ddx1+(0.8944271909999161*f[36][l]+f[2][l])*dv2Ddx0;
+    out[22][l] += 3.464101615137754*f[9][l]*w3Ddx1+3.464101615137754*f[10][l]*w2Ddx0+(0.8944271909999161*f[40][l]+f[1][l])*dv3Ddx1+f[24][l]*dv2Ddx0;
+    out[23][l] += 3.464101615137754*f[11][l]*w2Ddx0+(0.8944271909999161*f[39][l]+f[4][l])*dv2Ddx0;
+    out[24][l] += 3.464101615137754*f[11][l]*w3Ddx1+(0.8944271909999161*f[42][l]+f[3][l])*dv3Ddx1;
+    out[25][l] += 3.464101615137754*f[12][l]*w3Ddx1+3.464101615137754*f[13][l]*w2Ddx0+f[28][l]*dv3Ddx1+f[27][l]*dv2Ddx0;
+    out[26][l] += 3.464101615137754*f[14][l]*w2Ddx0+(0.8944271909999161*f[45][l]+f[5][l])*dv2Ddx0;
+    out[27][l] += 3.464101615137754*f[14][l]*w3Ddx1+f[30][l]*dv3Ddx1;
+    out[28][l] += 3.464101615137754*f[15][l]*w2Ddx0+f[30][l]*dv2Ddx0;
+    out[29][l] += 3.464101615137754*f[15][l]*w3Ddx1+(0.8944271909999161*f[46][l]+f[5][l])*dv3Ddx1;
+    out[31][l] += 3.464101615137755*f[16][l]*w3Ddx1+7.745966692414834*f[6][l]*w2Ddx0+f[37][l]*dv3Ddx1+2.23606797749979*f[21][l]*dv2Ddx0;
+    out[32][l] += 7.745966692414834*f[6][l]*w3Ddx1+3.464101615137755*f[17][l]*w2Ddx0+2.23606797749979*f[22][l]*dv3Ddx1+f[34][l]*dv2Ddx0;
+    out[33][l] += 7.745966692414834*f[7][l]*w2Ddx0+(2.0*f[35][l]+2.23606797749979*f[1][l])*dv2Ddx0;
+    out[34][l] += 7.745966692414834*f[8][l]*w3Ddx1+2.23606797749979*f[24][l]*dv3Ddx1;
+    out[35][l] += 3.464101615137755*f[18][l]*w2Ddx0+0.8944271909999161*f[3][l]*dv2Ddx0;
+    out[36][l] += 3.464101615137755*f[18][l]*w3Ddx1+f[39][l]*dv3Ddx1;
+    out[37][l] += 7.745966692414834*f[9][l]*w2Ddx0+2.23606797749979*f[23][l]*dv2Ddx0;
+    out[38][l] += 7.745966692414834*f[10][l]*w3Ddx1+(2.0*f[41][l]+2.23606797749979*f[2][l])*dv3Ddx1;
+    out[40][l] += 3.464101615137755*f[19][l]*w2Ddx0+f[42][l]*dv2Ddx0;
+    out[41][l] += 3.464101615137755*f[19][l]*w3Ddx1+0.8944271909999161*f[4][l]*dv3Ddx1;
+    out[43][l] += 7.745966692414834*f[12][l]*w2Ddx0+2.23606797749979*f[26][l]*dv2Ddx0;
+    out[44][l] += 7.745966692414834*f[13][l]*w3Ddx1+2.23606797749979*f[29][l]*dv3Ddx1;
+    out[47][l] += 3.464101615137755*f[20][l]*w2Ddx0+f[49][l]*dv2Ddx0;
+    out[48][l] += 3.464101615137755*f[20][l]*w3Ddx1+f[50][l]*dv3Ddx1;
+    out[51][l] += 3.464101615137754*f[23][l]*w3Ddx1+3.464101615137754*f[24][l]*w2Ddx0+(0.8944271909999159*f[66][l]+f[7][l])*dv3Ddx1+(0.8944271909999159*f[64][l]+f[10][l])*dv2Ddx0;
+    out[52][l] += 3.464101615137754*f[26][l]*w3Ddx1+3.464101615137754*f[27][l]*w2Ddx0+f[54][l]*dv3Ddx1+(0.8944271909999159*f[73][l]+f[13][l])*dv2Ddx0;
+    out[53][l] += 3.464101615137754*f[28][l]*w3Ddx1+3.464101615137754*f[29][l]*w2Ddx0+(0.8944271909999159*f[77][l]+f[12][l])*dv3Ddx1+f[55][l]*dv2Ddx0;
+    out[54][l] += 3.464101615137754*f[30][l]*w2Ddx0+(0.8944271909999159*f[76][l]+f[15][l])*dv2Ddx0;
+    out[55][l] += 3.464101615137754*f[30][l]*w3Ddx1+(0.8944271909999159*f[79][l]+f[14][l])*dv3Ddx1;
+    out[56][l] += 3.464101615137755*f[33][l]*w3Ddx1+7.745966692414834*f[21][l]*w2Ddx0+f[61][l]*dv3Ddx1+(2.0*f[58][l]+2.23606797749979*f[6][l])*dv2Ddx0;
+    out[57][l] += 7.745966692414834*f[21][l]*w3Ddx1+3.464101615137755*f[34][l]*w2Ddx0+2.23606797749979*f[51][l]*dv3Ddx1+(0.8944271909999159*f[88][l]+f[17][l])*dv2Ddx0;
+    out[58][l] += 3.464101615137755*f[35][l]*w3Ddx1+3.464101615137755*f[36][l]*w2Ddx0+f[63][l]*dv3Ddx1+0.8944271909999159*f[8][l]*dv2Ddx0;
+    out[59][l] += 3.464101615137755*f[37][l]*w3Ddx1+7.745966692414834*f[22][l]*w2Ddx0+(0.8944271909999159*f[89][l]+f[16][l])*dv3Ddx1+2.23606797749979*f[51][l]*dv2Ddx0;
+    out[60][l] += 7.745966692414834*f[22][l]*w3Ddx1+3.464101615137755*f[38][l]*w2Ddx0+(2.0*f[65][l]+2.23606797749979*f[6][l])*dv3Ddx1+f[62][l]*dv2Ddx0;
+    out[61][l] += 7.745966692414834*f[23][l]*w2Ddx0+(2.0*f[63][l]+2.23606797749979*f[9][l])*dv2Ddx0;
+    out[62][l] += 7.745966692414834*f[24][l]*w3Ddx1+(2.0*f[67][l]+2.23606797749979*f[8][l])*dv3Ddx1;
+    out[63][l] += 3.464101615137755*f[39][l]*w2Ddx0+0.8944271909999159*f[11][l]*dv2Ddx0;
+    out[64][l] += 3.464101615137755*f[39][l]*w3Ddx1+(0.8944271909999159*f[91][l]+f[18][l])*dv3Ddx1;
+    out[65][l] += 3.464101615137755*f[40][l]*w3Ddx1+3.464101615137755*f[41][l]*w2Ddx0+0.8944271909999159*f[9][l]*dv3Ddx1+f[67][l]*dv2Ddx0;
+    out[66][l] += 3.464101615137755*f[42][l]*w2Ddx0+(0.8944271909999159*f[91][l]+f[19][l])*dv2Ddx0;
+    out[67][l] += 3.464101615137755*f[42][l]*w3Ddx1+0.8944271909999159*f[11][l]*dv3Ddx1;
+    out[68][l] += 3.464101615137755*f[43][l]*w3Ddx1+7.745966692414834*f[25][l]*w2Ddx0+f[74][l]*dv3Ddx1+2.23606797749979*f[52][l]*dv2Ddx0;
+    out[69][l] += 7.745966692414834*f[25][l]*w3Ddx1+3.464101615137755*f[44][l]*w2Ddx0+2.23606797749979*f[53][l]*dv3Ddx1+f[71][l]*dv2Ddx0;
+    out[70][l] += 7.745966692414834*f[26][l]*w2Ddx0+(2.0*f[72][l]+2.23606797749979*f[12][l])*dv2Ddx0;
+    out[71][l] += 7.745966692414834*f[27][l]*w3Ddx1+2.23606797749979*f[55][l]*dv3Ddx1;
+    out[72][l] += 3.464101615137755*f[45][l]*w2Ddx0+0.8944271909999159*f[14][l]*dv2Ddx0;
+    out[73][l] += 3.464101615137755*f[45][l]*w3Ddx1+f[76][l]*dv3Ddx1;
+    out[74][l] += 7.745966692414834*f[28][l]*w2Ddx0+2.23606797749979*f[54][l]*dv2Ddx0;
+    out[75][l] += 7.745966692414834*f[29][l]*w3Ddx1+(2.0*f[78][l]+2.23606797749979*f[13][l])*dv3Ddx1;
+    out[77][l] += 3.464101615137755*f[46][l]*w2Ddx0+f[79][l]*dv2Ddx0;
+    out[78][l] += 3.464101615137755*f[46][l]*w3Ddx1+0.8944271909999159*f[15][l]*dv3Ddx1;
+    out[80][l] += 3.464101615137755*f[47][l]*w3Ddx1+3.464101615137755*f[48][l]*w2Ddx0+f[83][l]*dv3Ddx1+f[82][l]*dv2Ddx0;
+    out[81][l] += 3.464101615137755*f[49][l]*w2Ddx0+(0.8944271909999159*f[94][l]+f[20][l])*dv2Ddx0;
+    out[82][l] += 3.464101615137755*f[49][l]*w3Ddx1+f[85][l]*dv3Ddx1;
+    out[83][l] += 3.464101615137755*f[50][l]*w2Ddx0+f[85][l]*dv2Ddx0;
+    out[84][l] += 3.464101615137755*f[50][l]*w3Ddx1+(0.8944271909999159*f[95][l]+f[20][l])*dv3Ddx1;
+    out[86][l] += 7.745966692414834*f[31][l]*w3Ddx1+7.745966692414834*f[32][l]*w2Ddx0+2.23606797749979*f[59][l]*dv3Ddx1+2.23606797749979*f[57][l]*dv2Ddx0;
+    out[87][l] += 7.745966692414834*f[35][l]*w2Ddx0+2.0*f[7][l]*dv2Ddx0;
+    out[88][l] += 7.745966692414834*f[36][l]*w3Ddx1+2.23606797749979*f[64][l]*dv3Ddx1;
+    out[89][l] += 7.745966692414834*f[40][l]*w2Ddx0+2.23606797749979*f[66][l]*dv2Ddx0;
+    out[90][l] += 7.745966692414834*f[41][l]*w3Ddx1+2.0*f[10][l]*dv3Ddx1;
+    out[92][l] += 7.745966692414834*f[47][l]*w2Ddx0+2.23606797749979*f[81][l]*dv2Ddx0;
+    out[93][l] += 7.745966692414834*f[48][l]*w3Ddx1+2.23606797749979*f[84][l]*dv3Ddx1;
+    out[96][l] += 3.464101615137754*f[54][l]*w3Ddx1+3.464101615137754*f[55][l]*w2Ddx0+(0.8944271909999161*f[111][l]+f[26][l])*dv3Ddx1+(0.8944271909999161*f[109][l]+f[29][l])*dv2Ddx0;
+    out[97][l] += 3.464101615137755*f[61][l]*w3Ddx1+7.745966692414834*f[51][l]*w2Ddx0+(0.8944271909999161*f[125][l]+f[33][l])*dv3Ddx1+(2.0*f[99][l]+2.23606797749979*f[22][l])*dv2Ddx0;
+    out[98][l] += 7.745966692414834*f[51][l]*w3Ddx1+3.464101615137755*f[62][l]*w2Ddx0+(2.0*f[100][l]+2.23606797749979*f[21][l])*dv3Ddx1+(0.8944271909999161*f[122][l]+f[38][l])*dv2Ddx0;
+    out[99][l] += 3.464101615137755*f[63][l]*w3Ddx1+3.464101615137755*f[64][l]*w2Ddx0+(0.8944271909999161*f[127][l]+f[35][l])*dv3Ddx1+0.8944271909999161*f[24][l]*dv2Ddx0;
+    out[100][l] += 3.464101615137755*f[66][l]*w3Ddx1+3.464101615137755*f[67][l]*w2Ddx0+0.8944271909999161*f[23][l]*dv3Ddx1+(0.8944271909999161*f[128][l]+f[41][l])*dv2Ddx0;
+    out[101][l] += 3.464101615137755*f[70][l]*w3Ddx1+7.745966692414834*f[52][l]*w2Ddx0+f[106][l]*dv3Ddx1+(2.0*f[103][l]+2.23606797749979*f[25][l])*dv2Ddx0;
+    out[102][l] += 7.745966692414834*f[52][l]*w3Ddx1+3.464101615137755*f[71][l]*w2Ddx0+2.23606797749979*f[96][l]*dv3Ddx1+(0.8944271909999161*f[131][l]+f[44][l])*dv2Ddx0;
+    out[103][l] += 3.464101615137755*f[72][l]*w3Ddx1+3.464101615137755*f[73][l]*w2Ddx0+f[108][l]*dv3Ddx1+0.8944271909999161*f[27][l]*dv2Ddx0;
+    out[104][l] += 3.464101615137755*f[74][l]*w3Ddx1+7.745966692414834*f[53][l]*w2Ddx0+(0.8944271909999161*f[132][l]+f[43][l])*dv3Ddx1+2.23606797749979*f[96][l]*dv2Ddx0;
+    out[105][l] += 7.745966692414834*f[53][l]*w3Ddx1+3.464101615137755*f[75][l]*w2Ddx0+(2.0*f[110][l]+2.23606797749979*f[25][l])*dv3Ddx1+f[107][l]*dv2Ddx0;
+    out[106][l] += 7.745966692414834*f[54][l]*w2Ddx0+(2.0*f[108][l]+2.23606797749979*f[28][l])*dv2Ddx0;
+    out[107][l] += 7.745966692414834*f[55][l]*w3Ddx1+(2.0*f[112][l]+2.23606797749979*f[27][l])*dv3Ddx1;
+    out[108][l] += 3.464101615137755*f[76][l]*w2Ddx0+0.8944271909999161*f[30][l]*dv2Ddx0;
+    out[109][l] += 3.464101615137755*f[76][l]*w3Ddx1+(0.8944271909999161*f[134][l]+f[45][l])*dv3Ddx1;
+    out[110][l] += 3.464101615137755*f[77][l]*w3Ddx1+3.464101615137755*f[78][l]*w2Ddx0+0.8944271909999161*f[28][l]*dv3Ddx1+f[112][l]*dv2Ddx0;
+    out[111][l] += 3.464101615137755*f[79][l]*w2Ddx0+(0.8944271909999161*f[134][l]+f[46][l])*dv2Ddx0;
+    out[112][l] += 3.464101615137755*f[79][l]*w3Ddx1+0.8944271909999161*f[30][l]*dv3Ddx1;
+    out[113][l] += 3.464101615137755*f[81][l]*w3Ddx1+3.464101615137755*f[82][l]*w2Ddx0+f[115][l]*dv3Ddx1+(0.8944271909999161*f[140][l]+f[48][l])*dv2Ddx0;
+    out[114][l] += 3.464101615137755*f[83][l]*w3Ddx1+3.464101615137755*f[84][l]*w2Ddx0+(0.8944271909999161*f[144][l]+f[47][l])*dv3Ddx1+f[116][l]*dv2Ddx0;
+    out[115][l] += 3.464101615137755*f[85][l]*w2Ddx0+(0.8944271909999161*f[143][l]+f[50][l])*dv2Ddx0;
+    out[116][l] += 3.464101615137755*f[85][l]*w3Ddx1+(0.8944271909999161*f[146][l]+f[49][l])*dv3Ddx1;
+    out[117][l] += 7.745966692414834*f[56][l]*w3Ddx1+7.745966692414834*f[57][l]*w2Ddx0+2.23606797749979*f[97][l]*dv3Ddx1+(2.0*f[119][l]+2.23606797749979*f[32][l])*dv2Ddx0;
+    out[118][l] += 3.464101615137754*f[87][l]*w3Ddx1+7.745966692414834*f[58][l]*w2Ddx0+f[121][l]*dv3Ddx1+2.0*f[21][l]*dv2Ddx0;
+    out[119][l] += 7.745966692414834*f[58][l]*w3Ddx1+3.464101615137754*f[88][l]*w2Ddx0+2.23606797749979*f[99][l]*dv3Ddx1+0.8944271909999161*f[34][l]*dv2Ddx0;
+    out[120][l] += 7.745966692414834*f[59][l]*w3Ddx1+7.745966692414834*f[60][l]*w2Ddx0+(2.0*f[123][l]+2.23606797749979*f[31][l])*dv3Ddx1+2.23606797749979*f[98][l]*dv2Ddx0;
+    out[121][l] += 7.745966692414834*f[63][l]*w2Ddx0+2.0*f[23][l]*dv2Ddx0;
+    out[122][l] += 7.745966692414834*f[64][l]*w3Ddx1+(2.0*f[128][l]+2.23606797749979*f[36][l])*dv3Ddx1;
+    out[123][l] += 3.464101615137754*f[89][l]*w3Ddx1+7.745966692414834*f[65][l]*w2Ddx0+0.8944271909999161*f[37][l]*dv3Ddx1+2.23606797749979*f[100][l]*dv2Ddx0;
+    out[124][l] += 7.745966692414834*f[65][l]*w3Ddx1+3.464101615137754*f[90][l]*w2Ddx0+2.0*f[22][l]*dv3Ddx1+f[126][l]*dv2Ddx0;
+    out[125][l] += 7.745966692414834*f[66][l]*w2Ddx0+(2.0*f[127][l]+2.23606797749979*f[40][l])*dv2Ddx0;
+    out[126][l] += 7.745966692414834*f[67][l]*w3Ddx1+2.0*f[24][l]*dv3Ddx1;
+    out[127][l] += 3.464101615137754*f[91][l]*w2Ddx0+0.8944271909999161*f[42][l]*dv2Ddx0;
+    out[128][l] += 3.464101615137754*f[91][l]*w3Ddx1+0.8944271909999161*f[39][l]*dv3Ddx1;
+    out[129][l] += 7.745966692414834*f[68][l]*w3Ddx1+7.745966692414834*f[69][l]*w2Ddx0+2.23606797749979*f[104][l]*dv3Ddx1+2.23606797749979*f[102][l]*dv2Ddx0;
+    out[130][l] += 7.745966692414834*f[72][l]*w2Ddx0+2.0*f[26][l]*dv2Ddx0;
+    out[131][l] += 7.745966692414834*f[73][l]*w3Ddx1+2.23606797749979*f[109][l]*dv3Ddx1;
+    out[132][l] += 7.745966692414834*f[77][l]*w2Ddx0+2.23606797749979*f[111][l]*dv2Ddx0;
+    out[133][l] += 7.745966692414834*f[78][l]*w3Ddx1+2.0*f[29][l]*dv3Ddx1;
+    out[135][l] += 3.464101615137754*f[92][l]*w3Ddx1+7.745966692414834*f[80][l]*w2Ddx0+f[141][l]*dv3Ddx1+2.23606797749979*f[113][l]*dv2Ddx0;
+    out[136][l] += 7.745966692414834*f[80][l]*w3Ddx1+3.464101615137754*f[93][l]*w2Ddx0+2.23606797749979*f[114][l]*dv3Ddx1+f[138][l]*dv2Ddx0;
+    out[137][l] += 7.745966692414834*f[81][l]*w2Ddx0+(2.0*f[139][l]+2.23606797749979*f[47][l])*dv2Ddx0;
+    out[138][l] += 7.745966692414834*f[82][l]*w3Ddx1+2.23606797749979*f[116][l]*dv3Ddx1;
+    out[139][l] += 3.464101615137754*f[94][l]*w2Ddx0+0.8944271909999161*f[49][l]*dv2Ddx0;
+    out[140][l] += 3.464101615137754*f[94][l]*w3Ddx1+f[143][l]*dv3Ddx1;
+    out[141][l] += 7.745966692414834*f[83][l]*w2Ddx0+2.23606797749979*f[115][l]*dv2Ddx0;
+    out[142][l] += 7.745966692414834*f[84][l]*w3Ddx1+(2.0*f[145][l]+2.23606797749979*f[48][l])*dv3Ddx1;
+    out[144][l] += 3.464101615137754*f[95][l]*w2Ddx0+f[146][l]*dv2Ddx0;
+    out[145][l] += 3.464101615137754*f[95][l]*w3Ddx1+0.8944271909999161*f[50][l]*dv3Ddx1;
+    out[147][l] += 3.464101615137755*f[106][l]*w3Ddx1+7.745966692414834*f[96][l]*w2Ddx0+(0.8944271909999159*f[166][l]+f[70][l])*dv3Ddx1+(2.0*f[149][l]+2.23606797749979*f[53][l])*dv2Ddx0;
+    out[148][l] += 7.745966692414834*f[96][l]*w3Ddx1+3.464101615137755*f[107][l]*w2Ddx0+(2.0*f[150][l]+2.23606797749979*f[52][l])*dv3Ddx1+(0.8944271909999159*f[163][l]+f[75][l])*dv2Ddx0;
+    out[149][l] += 3.464101615137755*f[108][l]*w3Ddx1+3.464101615137755*f[109][l]*w2Ddx0+(0.8944271909999159*f[168][l]+f[72][l])*dv3Ddx1+0.8944271909999159*f[55][l]*dv2Ddx0;
+    out[150][l] += 3.464101615137755*f[111][l]*w3Ddx1+3.464101615137755*f[112][l]*w2Ddx0+0.8944271909999159*f[54][l]*dv3Ddx1+(0.8944271909999159*f[169][l]+f[78][l])*dv2Ddx0;
+    out[151][l] += 3.464101615137755*f[115][l]*w3Ddx1+3.464101615137755*f[116][l]*w2Ddx0+(0.8944271909999159*f[180][l]+f[81][l])*dv3Ddx1+(0.8944271909999159*f[178][l]+f[84][l])*dv2Ddx0;
+    out[152][l] += 7.745966692414834*f[97][l]*w3Ddx1+7.745966692414834*f[98][l]*w2Ddx0+(2.0*f[155][l]+2.23606797749979*f[56][l])*dv3Ddx1+(2.0*f[154][l]+2.23606797749979*f[60][l])*dv2Ddx0;
+    out[153][l] += 3.464101615137754*f[121][l]*w3Ddx1+7.745966692414834*f[99][l]*w2Ddx0+(0.8944271909999159*f[184][l]+f[87][l])*dv3Ddx1+2.0*f[51][l]*dv2Ddx0;
+    out[154][l] += 7.745966692414834*f[99][l]*w3Ddx1+3.464101615137754*f[122][l]*w2Ddx0+(2.0*f[157][l]+2.23606797749979*f[58][l])*dv3Ddx1+0.8944271909999159*f[62][l]*dv2Ddx0;
+    out[155][l] += 3.464101615137754*f[125][l]*w3Ddx1+7.745966692414834*f[100][l]*w2Ddx0+0.8944271909999159*f[61][l]*dv3Ddx1+(2.0*f[157][l]+2.23606797749979*f[65][l])*dv2Ddx0;
+    out[156][l] += 7.745966692414834*f[100][l]*w3Ddx1+3.464101615137754*f[126][l]*w2Ddx0+2.0*f[51][l]*dv3Ddx1+(0.8944271909999159*f[185][l]+f[90][l])*dv2Ddx0;
+    out[157][l] += 3.464101615137754*f[127][l]*w3Ddx1+3.464101615137754*f[128][l]*w2Ddx0+0.8944271909999159*f[63][l]*dv3Ddx1+0.8944271909999159*f[67][l]*dv2Ddx0;
+    out[158][l] += 7.745966692414834*f[101][l]*w3Ddx1+7.745966692414834*f[102][l]*w2Ddx0+2.23606797749979*f[147][l]*dv3Ddx1+(2.0*f[160][l]+2.23606797749979*f[69][l])*dv2Ddx0;
+    out[159][l] += 3.464101615137754*f[130][l]*w3Ddx1+7.745966692414834*f[103][l]*w2Ddx0+f[162][l]*dv3Ddx1+2.0*f[52][l]*dv2Ddx0;
+    out[160][l] += 7.745966692414834*f[103][l]*w3Ddx1+3.464101615137754*f[131][l]*w2Ddx0+2.23606797749979*f[149][l]*dv3Ddx1+0.8944271909999159*f[71][l]*dv2Ddx0;
+    out[161][l] += 7.745966692414834*f[104][l]*w3Ddx1+7.745966692414834*f[105][l]*w2Ddx0+(2.0*f[164][l]+2.23606797749979*f[68][l])*dv3Ddx1+2.23606797749979*f[148][l]*dv2Ddx0;
+    out[162][l] += 7.745966692414834*f[108][l]*w2Ddx0+2.0*f[54][l]*dv2Ddx0;
+    out[163][l] += 7.745966692414834*f[109][l]*w3Ddx1+(2.0*f[169][l]+2.23606797749979*f[73][l])*dv3Ddx1;
+    out[164][l] += 3.464101615137754*f[132][l]*w3Ddx1+7.745966692414834*f[110][l]*w2Ddx0+0.8944271909999159*f[74][l]*dv3Ddx1+2.23606797749979*f[150][l]*dv2Ddx0;
+    out[165][l] += 7.745966692414834*f[110][l]*w3Ddx1+3.464101615137754*f[133][l]*w2Ddx0+2.0*f[53][l]*dv3Ddx1+f[167][l]*dv2Ddx0;
+    out[166][l] += 7.745966692414834*f[111][l]*w2Ddx0+(2.0*f[168][l]+2.23606797749979*f[77][l])*dv2Ddx0;
+    out[167][l] += 7.745966692414834*f[112][l]*w3Ddx1+2.0*f[55][l]*dv3Ddx1;
+    out[168][l] += 3.464101615137754*f[134][l]*w2Ddx0+0.8944271909999159*f[79][l]*dv2Ddx0;
+    out[169][l] += 3.464101615137754*f[134][l]*w3Ddx1+0.8944271909999159*f[76][l]*dv3Ddx1;
+    out[170][l] += 3.464101615137754*f[137][l]*w3Ddx1+7.745966692414834*f[113][l]*w2Ddx0+f[175][l]*dv3Ddx1+(2.0*f[172][l]+2.23606797749979*f[80][l])*dv2Ddx0;
+    out[171][l] += 7.745966692414834*f[113][l]*w3Ddx1+3.464101615137754*f[138][l]*w2Ddx0+2.23606797749979*f[151][l]*dv3Ddx1+(0.8944271909999159*f[188][l]+f[93][l])*dv2Ddx0;
+    out[172][l] += 3.464101615137754*f[139][l]*w3Ddx1+3.464101615137754*f[140][l]*w2Ddx0+f[177][l]*dv3Ddx1+0.8944271909999159*f[82][l]*dv2Ddx0;
+    out[173][l] += 3.464101615137754*f[141][l]*w3Ddx1+7.745966692414834*f[114][l]*w2Ddx0+(0.8944271909999159*f[189][l]+f[92][l])*dv3Ddx1+2.23606797749979*f[151][l]*dv2Ddx0;
+    out[174][l] += 7.745966692414834*f[114][l]*w3Ddx1+3.464101615137754*f[142][l]*w2Ddx0+(2.0*f[179][l]+2.23606797749979*f[80][l])*dv3Ddx1+f[176][l]*dv2Ddx0;
+    out[175][l] += 7.745966692414834*f[115][l]*w2Ddx0+(2.0*f[177][l]+2.23606797749979*f[83][l])*dv2Ddx0;
+    out[176][l] += 7.745966692414834*f[116][l]*w3Ddx1+(2.0*f[181][l]+2.23606797749979*f[82][l])*dv3Ddx1;
+    out[177][l] += 3.464101615137754*f[143][l]*w2Ddx0+0.8944271909999159*f[85][l]*dv2Ddx0;
+    out[178][l] += 3.464101615137754*f[143][l]*w3Ddx1+(0.8944271909999159*f[191][l]+f[94][l])*dv3Ddx1;
+    out[179][l] += 3.464101615137754*f[144][l]*w3Ddx1+3.464101615137754*f[145][l]*w2Ddx0+0.8944271909999159*f[83][l]*dv3Ddx1+f[181][l]*dv2Ddx0;
+    out[180][l] += 3.464101615137754*f[146][l]*w2Ddx0+(0.8944271909999159*f[191][l]+f[95][l])*dv2Ddx0;
+    out[181][l] += 3.464101615137754*f[146][l]*w3Ddx1+0.8944271909999159*f[85][l]*dv3Ddx1;
+    out[182][l] += 7.745966692414834*f[118][l]*w3Ddx1+7.745966692414834*f[119][l]*w2Ddx0+2.23606797749979*f[153][l]*dv3Ddx1+2.0*f[57][l]*dv2Ddx0;
+    out[183][l] += 7.745966692414834*f[123][l]*w3Ddx1+7.745966692414834*f[124][l]*w2Ddx0+2.0*f[59][l]*dv3Ddx1+2.23606797749979*f[156][l]*dv2Ddx0;
+    out[184][l] += 7.745966692414834*f[127][l]*w2Ddx0+2.0*f[66][l]*dv2Ddx0;
+    out[185][l] += 7.745966692414834*f[128][l]*w3Ddx1+2.0*f[64][l]*dv3Ddx1;
+    out[186][l] += 7.745966692414834*f[135][l]*w3Ddx1+7.745966692414834*f[136][l]*w2Ddx0+2.23606797749979*f[173][l]*dv3Ddx1+2.23606797749979*f[171][l]*dv2Ddx0;
+    out[187][l] += 7.745966692414834*f[139][l]*w2Ddx0+2.0*f[81][l]*dv2Ddx0;
+    out[188][l] += 7.745966692414834*f[140][l]*w3Ddx1+2.23606797749979*f[178][l]*dv3Ddx1;
+    out[189][l] += 7.745966692414834*f[144][l]*w2Ddx0+2.23606797749979*f[180][l]*dv2Ddx0;
+    out[190][l] += 7.745966692414834*f[145][l]*w3Ddx1+2.0*f[84][l]*dv3Ddx1;
+    out[192][l] += 7.745966692414834*f[147][l]*w3Ddx1+7.745966692414834*f[148][l]*w2Ddx0+(2.0*f[195][l]+2.23606797749979*f[101][l])*dv3Ddx1+(2.0*f[194][l]+2.23606797749979*f[105][l])*dv2Ddx0;
+    out[193][l] += 3.464101615137754*f[162][l]*w3Ddx1+7.745966692414834*f[149][l]*w2Ddx0+(0.8944271909999161*f[208][l]+f[130][l])*dv3Ddx1+2.0*f[96][l]*dv2Ddx0;
+    out[194][l] += 7.745966692414834*f[149][l]*w3Ddx1+3.464101615137754*f[163][l]*w2Ddx0+(2.0*f[197][l]+2.23606797749979*f[103][l])*dv3Ddx1+0.8944271909999161*f[107][l]*dv2Ddx0;
+    out[195][l] += 3.464101615137754*f[166][l]*w3Ddx1+7.745966692414834*f[150][l]*w2Ddx0+0.8944271909999161*f[106][l]*dv3Ddx1+(2.0*f[197][l]+2.23606797749979*f[110][l])*dv2Ddx0;
+    out[196][l] += 7.745966692414834*f[150][l]*w3Ddx1+3.464101615137754*f[167][l]*w2Ddx0+2.0*f[96][l]*dv3Ddx1+(0.8944271909999161*f[209][l]+f[133][l])*dv2Ddx0;
+    out[197][l] += 3.464101615137754*f[168][l]*w3Ddx1+3.464101615137754*f[169][l]*w2Ddx0+0.8944271909999161*f[108][l]*dv3Ddx1+0.8944271909999161*f[112][l]*dv2Ddx0;
+    out[198][l] += 3.464101615137754*f[175][l]*w3Ddx1+7.745966692414834*f[151][l]*w2Ddx0+(0.8944271909999161*f[218][l]+f[137][l])*dv3Ddx1+(2.0*f[200][l]+2.23606797749979*f[114][l])*dv2Ddx0;
+    out[199][l] += 7.745966692414834*f[151][l]*w3Ddx1+3.464101615137754*f[176][l]*w2Ddx0+(2.0*f[201][l]+2.23606797749979*f[113][l])*dv3Ddx1+(0.8944271909999161*f[215][l]+f[142][l])*dv2Ddx0;
+    out[200][l] += 3.464101615137754*f[177][l]*w3Ddx1+3.464101615137754*f[178][l]*w2Ddx0+(0.8944271909999161*f[220][l]+f[139][l])*dv3Ddx1+0.8944271909999161*f[116][l]*dv2Ddx0;
+    out[201][l] += 3.464101615137754*f[180][l]*w3Ddx1+3.464101615137754*f[181][l]*w2Ddx0+0.8944271909999161*f[115][l]*dv3Ddx1+(0.8944271909999161*f[221][l]+f[145][l])*dv2Ddx0;
+    out[202][l] += 7.745966692414834*f[153][l]*w3Ddx1+7.745966692414834*f[154][l]*w2Ddx0+(2.0*f[204][l]+2.23606797749979*f[118][l])*dv3Ddx1+2.0*f[98][l]*dv2Ddx0;
+    out[203][l] += 7.745966692414834*f[155][l]*w3Ddx1+7.745966692414834*f[156][l]*w2Ddx0+2.0*f[97][l]*dv3Ddx1+(2.0*f[205][l]+2.23606797749979*f[124][l])*dv2Ddx0;
+    out[204][l] += 3.464101615137755*f[184][l]*w3Ddx1+7.745966692414834*f[157][l]*w2Ddx0+0.8944271909999161*f[121][l]*dv3Ddx1+2.0*f[100][l]*dv2Ddx0;
+    out[205][l] += 7.745966692414834*f[157][l]*w3Ddx1+3.464101615137755*f[185][l]*w2Ddx0+2.0*f[99][l]*dv3Ddx1+0.8944271909999161*f[126][l]*dv2Ddx0;
+    out[206][l] += 7.745966692414834*f[159][l]*w3Ddx1+7.745966692414834*f[160][l]*w2Ddx0+2.23606797749979*f[193][l]*dv3Ddx1+2.0*f[102][l]*dv2Ddx0;
+    out[207][l] += 7.745966692414834*f[164][l]*w3Ddx1+7.745966692414834*f[165][l]*w2Ddx0+2.0*f[104][l]*dv3Ddx1+2.23606797749979*f[196][l]*dv2Ddx0;
+    out[208][l] += 7.745966692414834*f[168][l]*w2Ddx0+2.0*f[111][l]*dv2Ddx0;
+    out[209][l] += 7.745966692414834*f[169][l]*w3Ddx1+2.0*f[109][l]*dv3Ddx1;
+    out[210][l] += 7.745966692414834*f[170][l]*w3Ddx1+7.745966692414834*f[171][l]*w2Ddx0+2.23606797749979*f[198][l]*dv3Ddx1+(2.0*f[212][l]+2.23606797749979*f[136][l])*dv2Ddx0;
+    out[211][l] += 3.464101615137755*f[187][l]*w3Ddx1+7.745966692414834*f[172][l]*w2Ddx0+f[214][l]*dv3Ddx1+2.0*f[113][l]*dv2Ddx0;
+    out[212][l] += 7.745966692414834*f[172][l]*w3Ddx1+3.464101615137755*f[188][l]*w2Ddx0+2.23606797749979*f[200][l]*dv3Ddx1+0.8944271909999161*f[138][l]*dv2Ddx0;
+    out[213][l] += 7.745966692414834*f[173][l]*w3Ddx1+7.745966692414834*f[174][l]*w2Ddx0+(2.0*f[216][l]+2.23606797749979*f[135][l])*dv3Ddx1+2.23606797749979*f[199][l]*dv2Ddx0;
+    out[214][l] += 7.745966692414834*f[177][l]*w2Ddx0+2.0*f[115][l]*dv2Ddx0;
+    out[215][l] += 7.745966692414834*f[178][l]*w3Ddx1+(2.0*f[221][l]+2.23606797749979*f[140][l])*dv3Ddx1;
+    out[216][l] += 3.464101615137755*f[189][l]*w3Ddx1+7.745966692414834*f[179][l]*w2Ddx0+0.8944271909999161*f[141][l]*dv3Ddx1+2.23606797749979*f[201][l]*dv2Ddx0;
+    out[217][l] += 7.745966692414834*f[179][l]*w3Ddx1+3.464101615137755*f[190][l]*w2Ddx0+2.0*f[114][l]*dv3Ddx1+f[219][l]*dv2Ddx0;
+    out[218][l] += 7.745966692414834*f[180][l]*w2Ddx0+(2.0*f[220][l]+2.23606797749979*f[144][l])*dv2Ddx0;
+    out[219][l] += 7.745966692414834*f[181][l]*w3Ddx1+2.0*f[116][l]*dv3Ddx1;
+    out[220][l] += 3.464101615137755*f[191][l]*w2Ddx0+0.8944271909999161*f[146][l]*dv2Ddx0;
+    out[221][l] += 3.464101615137755*f[191][l]*w3Ddx1+0.8944271909999161*f[143][l]*dv3Ddx1;
+    out[222][l] += 7.745966692414834*f[193][l]*w3Ddx1+7.745966692414834*f[194][l]*w2Ddx0+(2.0*f[224][l]+2.23606797749979*f[159][l])*dv3Ddx1+2.0*f[148][l]*dv2Ddx0;
+    out[223][l] += 7.745966692414834*f[195][l]*w3Ddx1+7.745966692414834*f[196][l]*w2Ddx0+2.0*f[147][l]*dv3Ddx1+(2.0*f[225][l]+2.23606797749979*f[165][l])*dv2Ddx0;
+    out[224][l] += 3.464101615137755*f[208][l]*w3Ddx1+7.745966692414834*f[197][l]*w2Ddx0+0.8944271909999159*f[162][l]*dv3Ddx1+2.0*f[150][l]*dv2Ddx0;
+    out[225][l] += 7.745966692414834*f[197][l]*w3Ddx1+3.464101615137755*f[209][l]*w2Ddx0+2.0*f[149][l]*dv3Ddx1+0.8944271909999159*f[167][l]*dv2Ddx0;
+    out[226][l] += 7.745966692414834*f[198][l]*w3Ddx1+7.745966692414834*f[199][l]*w2Ddx0+(2.0*f[229][l]+2.23606797749979*f[170][l])*dv3Ddx1+(2.0*f[228][l]+2.23606797749979*f[174][l])*dv2Ddx0;
+    out[227][l] += 3.464101615137755*f[214][l]*w3Ddx1+7.745966692414834*f[200][l]*w2Ddx0+(0.8944271909999159*f[235][l]+f[187][l])*dv3Ddx1+2.0*f[151][l]*dv2Ddx0;
+    out[228][l] += 7.745966692414834*f[200][l]*w3Ddx1+3.464101615137755*f[215][l]*w2Ddx0+(2.0*f[231][l]+2.23606797749979*f[172][l])*dv3Ddx1+0.8944271909999159*f[176][l]*dv2Ddx0;
+    out[229][l] += 3.464101615137755*f[218][l]*w3Ddx1+7.745966692414834*f[201][l]*w2Ddx0+0.8944271909999159*f[175][l]*dv3Ddx1+(2.0*f[231][l]+2.23606797749979*f[179][l])*dv2Ddx0;
+    out[230][l] += 7.745966692414834*f[201][l]*w3Ddx1+3.464101615137755*f[219][l]*w2Ddx0+2.0*f[151][l]*dv3Ddx1+(0.8944271909999159*f[236][l]+f[190][l])*dv2Ddx0;
+    out[231][l] += 3.464101615137755*f[220][l]*w3Ddx1+3.464101615137755*f[221][l]*w2Ddx0+0.8944271909999159*f[177][l]*dv3Ddx1+0.8944271909999159*f[181][l]*dv2Ddx0;
+    out[232][l] += 7.745966692414834*f[204][l]*w3Ddx1+7.745966692414834*f[205][l]*w2Ddx0+2.0*f[153][l]*dv3Ddx1+2.0*f[156][l]*dv2Ddx0;
+    out[233][l] += 7.745966692414834*f[211][l]*w3Ddx1+7.745966692414834*f[212][l]*w2Ddx0+2.23606797749979*f[227][l]*dv3Ddx1+2.0*f[171][l]*dv2Ddx0;
+    out[234][l] += 7.745966692414834*f[216][l]*w3Ddx1+7.745966692414834*f[217][l]*w2Ddx0+2.0*f[173][l]*dv3Ddx1+2.23606797749979*f[230][l]*dv2Ddx0;
+    out[235][l] += 7.745966692414834*f[220][l]*w2Ddx0+2.0*f[180][l]*dv2Ddx0;
+    out[236][l] += 7.745966692414834*f[221][l]*w3Ddx1+2.0*f[178][l]*dv3Ddx1;
+    out[237][l] += 7.745966692414834*f[224][l]*w3Ddx1+7.745966692414834*f[225][l]*w2Ddx0+2.0*f[193][l]*dv3Ddx1+2.0*f[196][l]*dv2Ddx0;
+    out[238][l] += 7.745966692414834*f[227][l]*w3Ddx1+7.745966692414834*f[228][l]*w2Ddx0+(2.0*f[240][l]+2.23606797749979*f[211][l])*dv3Ddx1+2.0*f[199][l]*dv2Ddx0;
+    out[239][l] += 7.745966692414834*f[229][l]*w3Ddx1+7.745966692414834*f[230][l]*w2Ddx0+2.0*f[198][l]*dv3Ddx1+(2.0*f[241][l]+2.23606797749979*f[217][l])*dv2Ddx0;
+    out[240][l] += 3.464101615137754*f[235][l]*w3Ddx1+7.745966692414834*f[231][l]*w2Ddx0+0.8944271909999161*f[214][l]*dv3Ddx1+2.0*f[201][l]*dv2Ddx0;
+    out[241][l] += 7.745966692414834*f[231][l]*w3Ddx1+3.464101615137754*f[236][l]*w2Ddx0+2.0*f[200][l]*dv3Ddx1+0.8944271909999161*f[219][l]*dv2Ddx0;
+    out[242][l] += 7.745966692414834*f[240][l]*w3Ddx1+7.745966692414834*f[241][l]*w2Ddx0+2.0*f[227][l]*dv3Ddx1+2.0*f[230][l]*dv2Ddx0;
+
+    cfl[l] = 5.0*(fabs(w2Ddx0)+0.5*dv2Ddx0+fabs(w3Ddx1)+0.5*dv3Ddx1);
+  } 
+} 
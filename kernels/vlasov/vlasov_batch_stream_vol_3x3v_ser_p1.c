@@ -0,0 +1,165 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_3x3v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_3x3v_ser_p1: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv3Ddx0 = dxv[3]/dxv[0];
+  double dv4Ddx1 = dxv[4]/dxv[1];
+  double dv5Ddx2 = dxv[5]/dxv[2];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w3Ddx0  = w[3][l]/dxv[0];
+    double w4Ddx1  = w[4][l]/dxv[1];
+    double w5Ddx2  = w[5][l]/dxv[2];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w3Ddx0+f[4][l]*dv3Ddx0;
+    out[2][l] += 3.464101615137754*f[0][l]*w4Ddx1+f[5][l]*dv4Ddx1;
+    out[3][l] += 3.464101615137754*f[0][l]*w5Ddx2+f[6][l]*dv5Ddx2;
+    out[7][l] += 3.464101615137754*f[1][l]*w4Ddx1+3.464101615137754*f[2][l]*w3Ddx0+f[13][l]*dv4Ddx1+f[11][l]*dv3Ddx0;
+    out[8][l] += 3.464101615137754*f[1][l]*w5Ddx2+3.464101615137754*f[3][l]*w3Ddx0+f[17][l]*dv5Ddx2+f[12][l]*dv3Ddx0;
+    out[9][l] += 3.464101615137754*f[2][l]*w5Ddx2+3.464101615137754*f[3][l]*w4Ddx1+f[18][l]*dv5Ddx2+f[15][l]*dv4Ddx1;
+    out[10][l] += 3.464101615137754*f[4][l]*w3Ddx0+(0.8944271909999159*f[64][l]+f[0][l])*dv3Ddx0;
+    out[11][l] += 3.464101615137754*f[4][l]*w4Ddx1+f[16][l]*dv4Ddx1;
+    out[12][l] += 3.464101615137754*f[4][l]*w5Ddx2+f[20][l]*dv5Ddx2;
+    out[13][l] += 3.464101615137754*f[5][l]*w3Ddx0+f[16][l]*dv3Ddx0;
+    out[14][l] += 3.464101615137754*f[5][l]*w4Ddx1+(0.8944271909999159*f[96][l]+f[0][l])*dv4Ddx1;
+    out[15][l] += 3.464101615137754*f[5][l]*w5Ddx2+f[21][l]*dv5Ddx2;
+    out[17][l] += 3.464101615137754*f[6][l]*w3Ddx0+f[20][l]*dv3Ddx0;
+    out[18][l] += 3.464101615137754*f[6][l]*w4Ddx1+f[21][l]*dv4Ddx1;
+    out[19][l] += 3.464101615137754*f[6][l]*w5Ddx2+(0.8944271909999159*f[128][l]+f[0][l])*dv5Ddx2;
+    out[22][l] += 3.464101615137754*f[7][l]*w5Ddx2+3.464101615137754*f[8][l]*w4Ddx1+3.464101615137754*f[9][l]*w3Ddx0+f[32][l]*dv5Ddx2+f[27][l]*dv4Ddx1+f[25][l]*dv3Ddx0;
+    out[23][l] += 3.464101615137754*f[10][l]*w4Ddx1+3.464101615137754*f[11][l]*w3Ddx0+f[29][l]*dv4Ddx1+(0.8944271909999161*f[66][l]+f[2][l])*dv3Ddx0;
+    out[24][l] += 3.464101615137754*f[10][l]*w5Ddx2+3.464101615137754*f[12][l]*w3Ddx0+f[35][l]*dv5Ddx2+(0.8944271909999161*f[67][l]+f[3][l])*dv3Ddx0;
+    out[25][l] += 3.464101615137754*f[11][l]*w5Ddx2+3.464101615137754*f[12][l]*w4Ddx1+f[36][l]*dv5Ddx2+f[31][l]*dv4Ddx1;
+    out[26][l] += 3.464101615137754*f[13][l]*w4Ddx1+3.464101615137754*f[14][l]*w3Ddx0+(0.8944271909999161*f[97][l]+f[1][l])*dv4Ddx1+f[30][l]*dv3Ddx0;
+    out[27][l] += 3.464101615137754*f[13][l]*w5Ddx2+3.464101615137754*f[15][l]*w3Ddx0+f[38][l]*dv5Ddx2+f[31][l]*dv3Ddx0;
+    out[28][l] += 3.464101615137754*f[14][l]*w5Ddx2+3.464101615137754*f[15][l]*w4Ddx1+f[39][l]*dv5Ddx2+(0.8944271909999161*f[99][l]+f[3][l])*dv4Ddx1;
+    out[29][l] += 3.464101615137754*f[16][l]*w3Ddx0+(0.8944271909999161*f[68][l]+f[5][l])*dv3Ddx0;
+    out[30][l] += 3.464101615137754*f[16][l]*w4Ddx1+(0.8944271909999161*f[100][l]+f[4][l])*dv4Ddx1;
+    out[31][l] += 3.464101615137754*f[16][l]*w5Ddx2+f[41][l]*dv5Ddx2;
+    out[32][l] += 3.464101615137754*f[17][l]*w4Ddx1+3.464101615137754*f[18][l]*w3Ddx0+f[38][l]*dv4Ddx1+f[36][l]*dv3Ddx0;
+    out[33][l] += 3.464101615137754*f[17][l]*w5Ddx2+3.464101615137754*f[19][l]*w3Ddx0+(0.8944271909999161*f[129][l]+f[1][l])*dv5Ddx2+f[37][l]*dv3Ddx0;
+    out[34][l] += 3.464101615137754*f[18][l]*w5Ddx2+3.464101615137754*f[19][l]*w4Ddx1+(0.8944271909999161*f[130][l]+f[2][l])*dv5Ddx2+f[40][l]*dv4Ddx1;
+    out[35][l] += 3.464101615137754*f[20][l]*w3Ddx0+(0.8944271909999161*f[69][l]+f[6][l])*dv3Ddx0;
+    out[36][l] += 3.464101615137754*f[20][l]*w4Ddx1+f[41][l]*dv4Ddx1;
+    out[37][l] += 3.464101615137754*f[20][l]*w5Ddx2+(0.8944271909999161*f[132][l]+f[4][l])*dv5Ddx2;
+    out[38][l] += 3.464101615137754*f[21][l]*w3Ddx0+f[41][l]*dv3Ddx0;
+    out[39][l] += 3.464101615137754*f[21][l]*w4Ddx1+(0.8944271909999161*f[101][l]+f[6][l])*dv4Ddx1;
+    out[40][l] += 3.464101615137754*f[21][l]*w5Ddx2+(0.8944271909999161*f[133][l]+f[5][l])*dv5Ddx2;
+    out[42][l] += 3.464101615137754*f[23][l]*w5Ddx2+3.464101615137754*f[24][l]*w4Ddx1+3.464101615137754*f[25][l]*w3Ddx0+f[48][l]*dv5Ddx2+f[45][l]*dv4Ddx1+(0.8944271909999159*f[72][l]+f[9][l])*dv3Ddx0;
+    out[43][l] += 3.464101615137754*f[26][l]*w5Ddx2+3.464101615137754*f[27][l]*w4Ddx1+3.464101615137754*f[28][l]*w3Ddx0+f[51][l]*dv5Ddx2+(0.8944271909999159*f[103][l]+f[8][l])*dv4Ddx1+f[46][l]*dv3Ddx0;
+    out[44][l] += 3.464101615137754*f[29][l]*w4Ddx1+3.464101615137754*f[30][l]*w3Ddx0+(0.8944271909999159*f[105][l]+f[10][l])*dv4Ddx1+(0.8944271909999159*f[74][l]+f[14][l])*dv3Ddx0;
+    out[45][l] += 3.464101615137754*f[29][l]*w5Ddx2+3.464101615137754*f[31][l]*w3Ddx0+f[54][l]*dv5Ddx2+(0.8944271909999159*f[75][l]+f[15][l])*dv3Ddx0;
+    out[46][l] += 3.464101615137754*f[30][l]*w5Ddx2+3.464101615137754*f[31][l]*w4Ddx1+f[55][l]*dv5Ddx2+(0.8944271909999159*f[107][l]+f[12][l])*dv4Ddx1;
+    out[47][l] += 3.464101615137754*f[32][l]*w5Ddx2+3.464101615137754*f[33][l]*w4Ddx1+3.464101615137754*f[34][l]*w3Ddx0+(0.8944271909999159*f[134][l]+f[7][l])*dv5Ddx2+f[52][l]*dv4Ddx1+f[50][l]*dv3Ddx0;
+    out[48][l] += 3.464101615137754*f[35][l]*w4Ddx1+3.464101615137754*f[36][l]*w3Ddx0+f[54][l]*dv4Ddx1+(0.8944271909999159*f[77][l]+f[18][l])*dv3Ddx0;
+    out[49][l] += 3.464101615137754*f[35][l]*w5Ddx2+3.464101615137754*f[37][l]*w3Ddx0+(0.8944271909999159*f[137][l]+f[10][l])*dv5Ddx2+(0.8944271909999159*f[78][l]+f[19][l])*dv3Ddx0;
+    out[50][l] += 3.464101615137754*f[36][l]*w5Ddx2+3.464101615137754*f[37][l]*w4Ddx1+(0.8944271909999159*f[138][l]+f[11][l])*dv5Ddx2+f[56][l]*dv4Ddx1;
+    out[51][l] += 3.464101615137754*f[38][l]*w4Ddx1+3.464101615137754*f[39][l]*w3Ddx0+(0.8944271909999159*f[108][l]+f[17][l])*dv4Ddx1+f[55][l]*dv3Ddx0;
+    out[52][l] += 3.464101615137754*f[38][l]*w5Ddx2+3.464101615137754*f[40][l]*w3Ddx0+(0.8944271909999159*f[140][l]+f[13][l])*dv5Ddx2+f[56][l]*dv3Ddx0;
+    out[53][l] += 3.464101615137754*f[39][l]*w5Ddx2+3.464101615137754*f[40][l]*w4Ddx1+(0.8944271909999159*f[141][l]+f[14][l])*dv5Ddx2+(0.8944271909999159*f[110][l]+f[19][l])*dv4Ddx1;
+    out[54][l] += 3.464101615137754*f[41][l]*w3Ddx0+(0.8944271909999159*f[79][l]+f[21][l])*dv3Ddx0;
+    out[55][l] += 3.464101615137754*f[41][l]*w4Ddx1+(0.8944271909999159*f[111][l]+f[20][l])*dv4Ddx1;
+    out[56][l] += 3.464101615137754*f[41][l]*w5Ddx2+(0.8944271909999159*f[143][l]+f[16][l])*dv5Ddx2;
+    out[57][l] += 3.464101615137754*f[44][l]*w5Ddx2+3.464101615137754*f[45][l]*w4Ddx1+3.464101615137754*f[46][l]*w3Ddx0+f[60][l]*dv5Ddx2+(0.8944271909999161*f[114][l]+f[24][l])*dv4Ddx1+(0.8944271909999161*f[83][l]+f[28][l])*dv3Ddx0;
+    out[58][l] += 3.464101615137754*f[48][l]*w5Ddx2+3.464101615137754*f[49][l]*w4Ddx1+3.464101615137754*f[50][l]*w3Ddx0+(0.8944271909999161*f[145][l]+f[23][l])*dv5Ddx2+f[61][l]*dv4Ddx1+(0.8944271909999161*f[86][l]+f[34][l])*dv3Ddx0;
+    out[59][l] += 3.464101615137754*f[51][l]*w5Ddx2+3.464101615137754*f[52][l]*w4Ddx1+3.464101615137754*f[53][l]*w3Ddx0+(0.8944271909999161*f[148][l]+f[26][l])*dv5Ddx2+(0.8944271909999161*f[117][l]+f[33][l])*dv4Ddx1+f[62][l]*dv3Ddx0;
+    out[60][l] += 3.464101615137754*f[54][l]*w4Ddx1+3.464101615137754*f[55][l]*w3Ddx0+(0.8944271909999161*f[119][l]+f[35][l])*dv4Ddx1+(0.8944271909999161*f[88][l]+f[39][l])*dv3Ddx0;
+    out[61][l] += 3.464101615137754*f[54][l]*w5Ddx2+3.464101615137754*f[56][l]*w3Ddx0+(0.8944271909999161*f[151][l]+f[29][l])*dv5Ddx2+(0.8944271909999161*f[89][l]+f[40][l])*dv3Ddx0;
+    out[62][l] += 3.464101615137754*f[55][l]*w5Ddx2+3.464101615137754*f[56][l]*w4Ddx1+(0.8944271909999161*f[152][l]+f[30][l])*dv5Ddx2+(0.8944271909999161*f[121][l]+f[37][l])*dv4Ddx1;
+    out[63][l] += 3.464101615137754*f[60][l]*w5Ddx2+3.464101615137754*f[61][l]*w4Ddx1+3.464101615137754*f[62][l]*w3Ddx0+(0.8944271909999159*f[156][l]+f[44][l])*dv5Ddx2+(0.8944271909999159*f[125][l]+f[49][l])*dv4Ddx1+(0.8944271909999159*f[94][l]+f[53][l])*dv3Ddx0;
+    out[65][l] += 3.464101615137755*f[64][l]*w3Ddx0+0.8944271909999161*f[4][l]*dv3Ddx0;
+    out[66][l] += 3.464101615137755*f[64][l]*w4Ddx1+f[68][l]*dv4Ddx1;
+    out[67][l] += 3.464101615137755*f[64][l]*w5Ddx2+f[69][l]*dv5Ddx2;
+    out[70][l] += 3.464101615137755*f[65][l]*w4Ddx1+3.464101615137755*f[66][l]*w3Ddx0+f[73][l]*dv4Ddx1+0.8944271909999159*f[11][l]*dv3Ddx0;
+    out[71][l] += 3.464101615137755*f[65][l]*w5Ddx2+3.464101615137755*f[67][l]*w3Ddx0+f[76][l]*dv5Ddx2+0.8944271909999159*f[12][l]*dv3Ddx0;
+    out[72][l] += 3.464101615137755*f[66][l]*w5Ddx2+3.464101615137755*f[67][l]*w4Ddx1+f[77][l]*dv5Ddx2+f[75][l]*dv4Ddx1;
+    out[73][l] += 3.464101615137755*f[68][l]*w3Ddx0+0.8944271909999159*f[16][l]*dv3Ddx0;
+    out[74][l] += 3.464101615137755*f[68][l]*w4Ddx1+f[64][l]*dv4Ddx1;
+    out[75][l] += 3.464101615137755*f[68][l]*w5Ddx2+f[79][l]*dv5Ddx2;
+    out[76][l] += 3.464101615137755*f[69][l]*w3Ddx0+0.8944271909999159*f[20][l]*dv3Ddx0;
+    out[77][l] += 3.464101615137755*f[69][l]*w4Ddx1+f[79][l]*dv4Ddx1;
+    out[78][l] += 3.464101615137755*f[69][l]*w5Ddx2+f[64][l]*dv5Ddx2;
+    out[80][l] += 3.464101615137755*f[70][l]*w5Ddx2+3.464101615137755*f[71][l]*w4Ddx1+3.464101615137755*f[72][l]*w3Ddx0+f[84][l]*dv5Ddx2+f[82][l]*dv4Ddx1+0.8944271909999161*f[25][l]*dv3Ddx0;
+    out[81][l] += 3.464101615137755*f[73][l]*w4Ddx1+3.464101615137755*f[74][l]*w3Ddx0+f[65][l]*dv4Ddx1+0.8944271909999161*f[30][l]*dv3Ddx0;
+    out[82][l] += 3.464101615137755*f[73][l]*w5Ddx2+3.464101615137755*f[75][l]*w3Ddx0+f[87][l]*dv5Ddx2+0.8944271909999161*f[31][l]*dv3Ddx0;
+    out[83][l] += 3.464101615137755*f[74][l]*w5Ddx2+3.464101615137755*f[75][l]*w4Ddx1+f[88][l]*dv5Ddx2+f[67][l]*dv4Ddx1;
+    out[84][l] += 3.464101615137755*f[76][l]*w4Ddx1+3.464101615137755*f[77][l]*w3Ddx0+f[87][l]*dv4Ddx1+0.8944271909999161*f[36][l]*dv3Ddx0;
+    out[85][l] += 3.464101615137755*f[76][l]*w5Ddx2+3.464101615137755*f[78][l]*w3Ddx0+f[65][l]*dv5Ddx2+0.8944271909999161*f[37][l]*dv3Ddx0;
+    out[86][l] += 3.464101615137755*f[77][l]*w5Ddx2+3.464101615137755*f[78][l]*w4Ddx1+f[66][l]*dv5Ddx2+f[89][l]*dv4Ddx1;
+    out[87][l] += 3.464101615137755*f[79][l]*w3Ddx0+0.8944271909999161*f[41][l]*dv3Ddx0;
+    out[88][l] += 3.464101615137755*f[79][l]*w4Ddx1+f[69][l]*dv4Ddx1;
+    out[89][l] += 3.464101615137755*f[79][l]*w5Ddx2+f[68][l]*dv5Ddx2;
+    out[90][l] += 3.464101615137755*f[81][l]*w5Ddx2+3.464101615137755*f[82][l]*w4Ddx1+3.464101615137755*f[83][l]*w3Ddx0+f[92][l]*dv5Ddx2+f[71][l]*dv4Ddx1+0.8944271909999159*f[46][l]*dv3Ddx0;
+    out[91][l] += 3.464101615137755*f[84][l]*w5Ddx2+3.464101615137755*f[85][l]*w4Ddx1+3.464101615137755*f[86][l]*w3Ddx0+f[70][l]*dv5Ddx2+f[93][l]*dv4Ddx1+0.8944271909999159*f[50][l]*dv3Ddx0;
+    out[92][l] += 3.464101615137755*f[87][l]*w4Ddx1+3.464101615137755*f[88][l]*w3Ddx0+f[76][l]*dv4Ddx1+0.8944271909999159*f[55][l]*dv3Ddx0;
+    out[93][l] += 3.464101615137755*f[87][l]*w5Ddx2+3.464101615137755*f[89][l]*w3Ddx0+f[73][l]*dv5Ddx2+0.8944271909999159*f[56][l]*dv3Ddx0;
+    out[94][l] += 3.464101615137755*f[88][l]*w5Ddx2+3.464101615137755*f[89][l]*w4Ddx1+f[74][l]*dv5Ddx2+f[78][l]*dv4Ddx1;
+    out[95][l] += 3.464101615137755*f[92][l]*w5Ddx2+3.464101615137755*f[93][l]*w4Ddx1+3.464101615137755*f[94][l]*w3Ddx0+f[81][l]*dv5Ddx2+f[85][l]*dv4Ddx1+0.8944271909999161*f[62][l]*dv3Ddx0;
+    out[97][l] += 3.464101615137755*f[96][l]*w3Ddx0+f[100][l]*dv3Ddx0;
+    out[98][l] += 3.464101615137755*f[96][l]*w4Ddx1+0.8944271909999161*f[5][l]*dv4Ddx1;
+    out[99][l] += 3.464101615137755*f[96][l]*w5Ddx2+f[101][l]*dv5Ddx2;
+    out[102][l] += 3.464101615137755*f[97][l]*w4Ddx1+3.464101615137755*f[98][l]*w3Ddx0+0.8944271909999159*f[13][l]*dv4Ddx1+f[106][l]*dv3Ddx0;
+    out[103][l] += 3.464101615137755*f[97][l]*w5Ddx2+3.464101615137755*f[99][l]*w3Ddx0+f[108][l]*dv5Ddx2+f[107][l]*dv3Ddx0;
+    out[104][l] += 3.464101615137755*f[98][l]*w5Ddx2+3.464101615137755*f[99][l]*w4Ddx1+f[109][l]*dv5Ddx2+0.8944271909999159*f[15][l]*dv4Ddx1;
+    out[105][l] += 3.464101615137755*f[100][l]*w3Ddx0+f[96][l]*dv3Ddx0;
+    out[106][l] += 3.464101615137755*f[100][l]*w4Ddx1+0.8944271909999159*f[16][l]*dv4Ddx1;
+    out[107][l] += 3.464101615137755*f[100][l]*w5Ddx2+f[111][l]*dv5Ddx2;
+    out[108][l] += 3.464101615137755*f[101][l]*w3Ddx0+f[111][l]*dv3Ddx0;
+    out[109][l] += 3.464101615137755*f[101][l]*w4Ddx1+0.8944271909999159*f[21][l]*dv4Ddx1;
+    out[110][l] += 3.464101615137755*f[101][l]*w5Ddx2+f[96][l]*dv5Ddx2;
+    out[112][l] += 3.464101615137755*f[102][l]*w5Ddx2+3.464101615137755*f[103][l]*w4Ddx1+3.464101615137755*f[104][l]*w3Ddx0+f[116][l]*dv5Ddx2+0.8944271909999161*f[27][l]*dv4Ddx1+f[115][l]*dv3Ddx0;
+    out[113][l] += 3.464101615137755*f[105][l]*w4Ddx1+3.464101615137755*f[106][l]*w3Ddx0+0.8944271909999161*f[29][l]*dv4Ddx1+f[98][l]*dv3Ddx0;
+    out[114][l] += 3.464101615137755*f[105][l]*w5Ddx2+3.464101615137755*f[107][l]*w3Ddx0+f[119][l]*dv5Ddx2+f[99][l]*dv3Ddx0;
+    out[115][l] += 3.464101615137755*f[106][l]*w5Ddx2+3.464101615137755*f[107][l]*w4Ddx1+f[120][l]*dv5Ddx2+0.8944271909999161*f[31][l]*dv4Ddx1;
+    out[116][l] += 3.464101615137755*f[108][l]*w4Ddx1+3.464101615137755*f[109][l]*w3Ddx0+0.8944271909999161*f[38][l]*dv4Ddx1+f[120][l]*dv3Ddx0;
+    out[117][l] += 3.464101615137755*f[108][l]*w5Ddx2+3.464101615137755*f[110][l]*w3Ddx0+f[97][l]*dv5Ddx2+f[121][l]*dv3Ddx0;
+    out[118][l] += 3.464101615137755*f[109][l]*w5Ddx2+3.464101615137755*f[110][l]*w4Ddx1+f[98][l]*dv5Ddx2+0.8944271909999161*f[40][l]*dv4Ddx1;
+    out[119][l] += 3.464101615137755*f[111][l]*w3Ddx0+f[101][l]*dv3Ddx0;
+    out[120][l] += 3.464101615137755*f[111][l]*w4Ddx1+0.8944271909999161*f[41][l]*dv4Ddx1;
+    out[121][l] += 3.464101615137755*f[111][l]*w5Ddx2+f[100][l]*dv5Ddx2;
+    out[122][l] += 3.464101615137755*f[113][l]*w5Ddx2+3.464101615137755*f[114][l]*w4Ddx1+3.464101615137755*f[115][l]*w3Ddx0+f[124][l]*dv5Ddx2+0.8944271909999159*f[45][l]*dv4Ddx1+f[104][l]*dv3Ddx0;
+    out[123][l] += 3.464101615137755*f[116][l]*w5Ddx2+3.464101615137755*f[117][l]*w4Ddx1+3.464101615137755*f[118][l]*w3Ddx0+f[102][l]*dv5Ddx2+0.8944271909999159*f[52][l]*dv4Ddx1+f[126][l]*dv3Ddx0;
+    out[124][l] += 3.464101615137755*f[119][l]*w4Ddx1+3.464101615137755*f[120][l]*w3Ddx0+0.8944271909999159*f[54][l]*dv4Ddx1+f[109][l]*dv3Ddx0;
+    out[125][l] += 3.464101615137755*f[119][l]*w5Ddx2+3.464101615137755*f[121][l]*w3Ddx0+f[105][l]*dv5Ddx2+f[110][l]*dv3Ddx0;
+    out[126][l] += 3.464101615137755*f[120][l]*w5Ddx2+3.464101615137755*f[121][l]*w4Ddx1+f[106][l]*dv5Ddx2+0.8944271909999159*f[56][l]*dv4Ddx1;
+    out[127][l] += 3.464101615137755*f[124][l]*w5Ddx2+3.464101615137755*f[125][l]*w4Ddx1+3.464101615137755*f[126][l]*w3Ddx0+f[113][l]*dv5Ddx2+0.8944271909999161*f[61][l]*dv4Ddx1+f[118][l]*dv3Ddx0;
+    out[129][l] += 3.464101615137755*f[128][l]*w3Ddx0+f[132][l]*dv3Ddx0;
+    out[130][l] += 3.464101615137755*f[128][l]*w4Ddx1+f[133][l]*dv4Ddx1;
+    out[131][l] += 3.464101615137755*f[128][l]*w5Ddx2+0.8944271909999161*f[6][l]*dv5Ddx2;
+    out[134][l] += 3.464101615137755*f[129][l]*w4Ddx1+3.464101615137755*f[130][l]*w3Ddx0+f[140][l]*dv4Ddx1+f[138][l]*dv3Ddx0;
+    out[135][l] += 3.464101615137755*f[129][l]*w5Ddx2+3.464101615137755*f[131][l]*w3Ddx0+0.8944271909999159*f[17][l]*dv5Ddx2+f[139][l]*dv3Ddx0;
+    out[136][l] += 3.464101615137755*f[130][l]*w5Ddx2+3.464101615137755*f[131][l]*w4Ddx1+0.8944271909999159*f[18][l]*dv5Ddx2+f[142][l]*dv4Ddx1;
+    out[137][l] += 3.464101615137755*f[132][l]*w3Ddx0+f[128][l]*dv3Ddx0;
+    out[138][l] += 3.464101615137755*f[132][l]*w4Ddx1+f[143][l]*dv4Ddx1;
+    out[139][l] += 3.464101615137755*f[132][l]*w5Ddx2+0.8944271909999159*f[20][l]*dv5Ddx2;
+    out[140][l] += 3.464101615137755*f[133][l]*w3Ddx0+f[143][l]*dv3Ddx0;
+    out[141][l] += 3.464101615137755*f[133][l]*w4Ddx1+f[128][l]*dv4Ddx1;
+    out[142][l] += 3.464101615137755*f[133][l]*w5Ddx2+0.8944271909999159*f[21][l]*dv5Ddx2;
+    out[144][l] += 3.464101615137755*f[134][l]*w5Ddx2+3.464101615137755*f[135][l]*w4Ddx1+3.464101615137755*f[136][l]*w3Ddx0+0.8944271909999161*f[32][l]*dv5Ddx2+f[149][l]*dv4Ddx1+f[147][l]*dv3Ddx0;
+    out[145][l] += 3.464101615137755*f[137][l]*w4Ddx1+3.464101615137755*f[138][l]*w3Ddx0+f[151][l]*dv4Ddx1+f[130][l]*dv3Ddx0;
+    out[146][l] += 3.464101615137755*f[137][l]*w5Ddx2+3.464101615137755*f[139][l]*w3Ddx0+0.8944271909999161*f[35][l]*dv5Ddx2+f[131][l]*dv3Ddx0;
+    out[147][l] += 3.464101615137755*f[138][l]*w5Ddx2+3.464101615137755*f[139][l]*w4Ddx1+0.8944271909999161*f[36][l]*dv5Ddx2+f[153][l]*dv4Ddx1;
+    out[148][l] += 3.464101615137755*f[140][l]*w4Ddx1+3.464101615137755*f[141][l]*w3Ddx0+f[129][l]*dv4Ddx1+f[152][l]*dv3Ddx0;
+    out[149][l] += 3.464101615137755*f[140][l]*w5Ddx2+3.464101615137755*f[142][l]*w3Ddx0+0.8944271909999161*f[38][l]*dv5Ddx2+f[153][l]*dv3Ddx0;
+    out[150][l] += 3.464101615137755*f[141][l]*w5Ddx2+3.464101615137755*f[142][l]*w4Ddx1+0.8944271909999161*f[39][l]*dv5Ddx2+f[131][l]*dv4Ddx1;
+    out[151][l] += 3.464101615137755*f[143][l]*w3Ddx0+f[133][l]*dv3Ddx0;
+    out[152][l] += 3.464101615137755*f[143][l]*w4Ddx1+f[132][l]*dv4Ddx1;
+    out[153][l] += 3.464101615137755*f[143][l]*w5Ddx2+0.8944271909999161*f[41][l]*dv5Ddx2;
+    out[154][l] += 3.464101615137755*f[145][l]*w5Ddx2+3.464101615137755*f[146][l]*w4Ddx1+3.464101615137755*f[147][l]*w3Ddx0+0.8944271909999159*f[48][l]*dv5Ddx2+f[157][l]*dv4Ddx1+f[136][l]*dv3Ddx0;
+    out[155][l] += 3.464101615137755*f[148][l]*w5Ddx2+3.464101615137755*f[149][l]*w4Ddx1+3.464101615137755*f[150][l]*w3Ddx0+0.8944271909999159*f[51][l]*dv5Ddx2+f[135][l]*dv4Ddx1+f[158][l]*dv3Ddx0;
+    out[156][l] += 3.464101615137755*f[151][l]*w4Ddx1+3.464101615137755*f[152][l]*w3Ddx0+f[137][l]*dv4Ddx1+f[141][l]*dv3Ddx0;
+    out[157][l] += 3.464101615137755*f[151][l]*w5Ddx2+3.464101615137755*f[153][l]*w3Ddx0+0.8944271909999159*f[54][l]*dv5Ddx2+f[142][l]*dv3Ddx0;
+    out[158][l] += 3.464101615137755*f[152][l]*w5Ddx2+3.464101615137755*f[153][l]*w4Ddx1+0.8944271909999159*f[55][l]*dv5Ddx2+f[139][l]*dv4Ddx1;
+    out[159][l] += 3.464101615137755*f[156][l]*w5Ddx2+3.464101615137755*f[157][l]*w4Ddx1+3.464101615137755*f[158][l]*w3Ddx0+0.8944271909999161*f[60][l]*dv5Ddx2+f[146][l]*dv4Ddx1+f[150][l]*dv3Ddx0;
+
+    cfl[l] = 3.0*(fabs(w3Ddx0)+0.5*dv3Ddx0+fabs(w4Ddx1)+0.5*dv4Ddx1+fabs(w5Ddx2)+0.5*dv5Ddx2);
+  } 
+} 
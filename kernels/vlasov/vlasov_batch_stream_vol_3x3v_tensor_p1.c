@@ -0,0 +1,81 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_stream_vol_3x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_stream_vol_3x3v_tensor_p1: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv3Ddx0 = dxv[3]/dxv[0];
+  double dv4Ddx1 = dxv[4]/dxv[1];
+  double dv5Ddx2 = dxv[5]/dxv[2];
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w3Ddx0  = w[3][l]/dxv[0];
+    double w4Ddx1  = w[4][l]/dxv[1];
+    double w5Ddx2  = w[5][l]/dxv[2];
+
+    out[1][l] += 3.464101615137754*f[0][l]*w3Ddx0+f[4][l]*dv3Ddx0;
+    out[2][l] += 3.464101615137754*f[0][l]*w4Ddx1+f[5][l]*dv4Ddx1;
+    out[3][l] += 3.464101615137754*f[0][l]*w5Ddx2+f[6][l]*dv5Ddx2;
+    out[7][l] += 3.464101615137754*f[1][l]*w4Ddx1+3.464101615137754*f[2][l]*w3Ddx0+f[13][l]*dv4Ddx1+f[11][l]*dv3Ddx0;
+    out[8][l] += 3.464101615137754*f[1][l]*w5Ddx2+3.464101615137754*f[3][l]*w3Ddx0+f[17][l]*dv5Ddx2+f[12][l]*dv3Ddx0;
+    out[9][l] += 3.464101615137754*f[2][l]*w5Ddx2+3.464101615137754*f[3][l]*w4Ddx1+f[18][l]*dv5Ddx2+f[15][l]*dv4Ddx1;
+    out[10][l] += 3.464101615137754*f[4][l]*w3Ddx0+f[0][l]*dv3Ddx0;
+    out[11][l] += 3.464101615137754*f[4][l]*w4Ddx1+f[16][l]*dv4Ddx1;
+    out[12][l] += 3.464101615137754*f[4][l]*w5Ddx2+f[20][l]*dv5Ddx2;
+    out[13][l] += 3.464101615137754*f[5][l]*w3Ddx0+f[16][l]*dv3Ddx0;
+    out[14][l] += 3.464101615137754*f[5][l]*w4Ddx1+f[0][l]*dv4Ddx1;
+    out[15][l] += 3.464101615137754*f[5][l]*w5Ddx2+f[21][l]*dv5Ddx2;
+    out[17][l] += 3.464101615137754*f[6][l]*w3Ddx0+f[20][l]*dv3Ddx0;
+    out[18][l] += 3.464101615137754*f[6][l]*w4Ddx1+f[21][l]*dv4Ddx1;
+    out[19][l] += 3.464101615137754*f[6][l]*w5Ddx2+f[0][l]*dv5Ddx2;
+    out[22][l] += 3.464101615137754*f[7][l]*w5Ddx2+3.464101615137754*f[8][l]*w4Ddx1+3.464101615137754*f[9][l]*w3Ddx0+f[32][l]*dv5Ddx2+f[27][l]*dv4Ddx1+f[25][l]*dv3Ddx0;
+    out[23][l] += 3.464101615137754*f[10][l]*w4Ddx1+3.464101615137754*f[11][l]*w3Ddx0+f[29][l]*dv4Ddx1+f[2][l]*dv3Ddx0;
+    out[24][l] += 3.464101615137754*f[10][l]*w5Ddx2+3.464101615137754*f[12][l]*w3Ddx0+f[35][l]*dv5Ddx2+f[3][l]*dv3Ddx0;
+    out[25][l] += 3.464101615137754*f[11][l]*w5Ddx2+3.464101615137754*f[12][l]*w4Ddx1+f[36][l]*dv5Ddx2+f[31][l]*dv4Ddx1;
+    out[26][l] += 3.464101615137754*f[13][l]*w4Ddx1+3.464101615137754*f[14][l]*w3Ddx0+f[1][l]*dv4Ddx1+f[30][l]*dv3Ddx0;
+    out[27][l] += 3.464101615137754*f[13][l]*w5Ddx2+3.464101615137754*f[15][l]*w3Ddx0+f[38][l]*dv5Ddx2+f[31][l]*dv3Ddx0;
+    out[28][l] += 3.464101615137754*f[14][l]*w5Ddx2+3.464101615137754*f[15][l]*w4Ddx1+f[39][l]*dv5Ddx2+f[3][l]*dv4Ddx1;
+    out[29][l] += 3.464101615137754*f[16][l]*w3Ddx0+f[5][l]*dv3Ddx0;
+    out[30][l] += 3.464101615137754*f[16][l]*w4Ddx1+f[4][l]*dv4Ddx1;
+    out[31][l] += 3.464101615137754*f[16][l]*w5Ddx2+f[41][l]*dv5Ddx2;
+    out[32][l] += 3.464101615137754*f[17][l]*w4Ddx1+3.464101615137754*f[18][l]*w3Ddx0+f[38][l]*dv4Ddx1+f[36][l]*dv3Ddx0;
+    out[33][l] += 3.464101615137754*f[17][l]*w5Ddx2+3.464101615137754*f[19][l]*w3Ddx0+f[1][l]*dv5Ddx2+f[37][l]*dv3Ddx0;
+    out[34][l] += 3.464101615137754*f[18][l]*w5Ddx2+3.464101615137754*f[19][l]*w4Ddx1+f[2][l]*dv5Ddx2+f[40][l]*dv4Ddx1;
+    out[35][l] += 3.464101615137754*f[20][l]*w3Ddx0+f[6][l]*dv3Ddx0;
+    out[36][l] += 3.464101615137754*f[20][l]*w4Ddx1+f[41][l]*dv4Ddx1;
+    out[37][l] += 3.464101615137754*f[20][l]*w5Ddx2+f[4][l]*dv5Ddx2;
+    out[38][l] += 3.464101615137754*f[21][l]*w3Ddx0+f[41][l]*dv3Ddx0;
+    out[39][l] += 3.464101615137754*f[21][l]*w4Ddx1+f[6][l]*dv4Ddx1;
+    out[40][l] += 3.464101615137754*f[21][l]*w5Ddx2+f[5][l]*dv5Ddx2;
+    out[42][l] += 3.464101615137754*f[23][l]*w5Ddx2+3.464101615137754*f[24][l]*w4Ddx1+3.464101615137754*f[25][l]*w3Ddx0+f[48][l]*dv5Ddx2+f[45][l]*dv4Ddx1+f[9][l]*dv3Ddx0;
+    out[43][l] += 3.464101615137754*f[26][l]*w5Ddx2+3.464101615137754*f[27][l]*w4Ddx1+3.464101615137754*f[28][l]*w3Ddx0+f[51][l]*dv5Ddx2+f[8][l]*dv4Ddx1+f[46][l]*dv3Ddx0;
+    out[44][l] += 3.464101615137754*f[29][l]*w4Ddx1+3.464101615137754*f[30][l]*w3Ddx0+f[10][l]*dv4Ddx1+f[14][l]*dv3Ddx0;
+    out[45][l] += 3.464101615137754*f[29][l]*w5Ddx2+3.464101615137754*f[31][l]*w3Ddx0+f[54][l]*dv5Ddx2+f[15][l]*dv3Ddx0;
+    out[46][l] += 3.464101615137754*f[30][l]*w5Ddx2+3.464101615137754*f[31][l]*w4Ddx1+f[55][l]*dv5Ddx2+f[12][l]*dv4Ddx1;
+    out[47][l] += 3.464101615137754*f[32][l]*w5Ddx2+3.464101615137754*f[33][l]*w4Ddx1+3.464101615137754*f[34][l]*w3Ddx0+f[7][l]*dv5Ddx2+f[52][l]*dv4Ddx1+f[50][l]*dv3Ddx0;
+    out[48][l] += 3.464101615137754*f[35][l]*w4Ddx1+3.464101615137754*f[36][l]*w3Ddx0+f[54][l]*dv4Ddx1+f[18][l]*dv3Ddx0;
+    out[49][l] += 3.464101615137754*f[35][l]*w5Ddx2+3.464101615137754*f[37][l]*w3Ddx0+f[10][l]*dv5Ddx2+f[19][l]*dv3Ddx0;
+    out[50][l] += 3.464101615137754*f[36][l]*w5Ddx2+3.464101615137754*f[37][l]*w4Ddx1+f[11][l]*dv5Ddx2+f[56][l]*dv4Ddx1;
+    out[51][l] += 3.464101615137754*f[38][l]*w4Ddx1+3.464101615137754*f[39][l]*w3Ddx0+f[17][l]*dv4Ddx1+f[55][l]*dv3Ddx0;
+    out[52][l] += 3.464101615137754*f[38][l]*w5Ddx2+3.464101615137754*f[40][l]*w3Ddx0+f[13][l]*dv5Ddx2+f[56][l]*dv3Ddx0;
+    out[53][l] += 3.464101615137754*f[39][l]*w5Ddx2+3.464101615137754*f[40][l]*w4Ddx1+f[14][l]*dv5Ddx2+f[19][l]*dv4Ddx1;
+    out[54][l] += 3.464101615137754*f[41][l]*w3Ddx0+f[21][l]*dv3Ddx0;
+    out[55][l] += 3.464101615137754*f[41][l]*w4Ddx1+f[20][l]*dv4Ddx1;
+    out[56][l] += 3.464101615137754*f[41][l]*w5Ddx2+f[16][l]*dv5Ddx2;
+    out[57][l] += 3.464101615137754*f[44][l]*w5Ddx2+3.464101615137754*f[45][l]*w4Ddx1+3.464101615137754*f[46][l]*w3Ddx0+f[60][l]*dv5Ddx2+f[24][l]*dv4Ddx1+f[28][l]*dv3Ddx0;
+    out[58][l] += 3.464101615137754*f[48][l]*w5Ddx2+3.464101615137754*f[49][l]*w4Ddx1+3.464101615137754*f[50][l]*w3Ddx0+f[23][l]*dv5Ddx2+f[61][l]*dv4Ddx1+f[34][l]*dv3Ddx0;
+    out[59][l] += 3.464101615137754*f[51][l]*w5Ddx2+3.464101615137754*f[52][l]*w4Ddx1+3.464101615137754*f[53][l]*w3Ddx0+f[26][l]*dv5Ddx2+f[33][l]*dv4Ddx1+f[62][l]*dv3Ddx0;
+    out[60][l] += 3.464101615137754*f[54][l]*w4Ddx1+3.464101615137754*f[55][l]*w3Ddx0+f[35][l]*dv4Ddx1+f[39][l]*dv3Ddx0;
+    out[61][l] += 3.464101615137754*f[54][l]*w5Ddx2+3.464101615137754*f[56][l]*w3Ddx0+f[29][l]*dv5Ddx2+f[40][l]*dv3Ddx0;
+    out[62][l] += 3.464101615137754*f[55][l]*w5Ddx2+3.464101615137754*f[56][l]*w4Ddx1+f[30][l]*dv5Ddx2+f[37][l]*dv4Ddx1;
+    out[63][l] += 3.464101615137754*f[60][l]*w5Ddx2+3.464101615137754*f[61][l]*w4Ddx1+3.464101615137754*f[62][l]*w3Ddx0+f[44][l]*dv5Ddx2+f[49][l]*dv4Ddx1+f[53][l]*dv3Ddx0;
+
+    cfl[l] = 3.0*(fabs(w3Ddx0)+0.5*dv3Ddx0+fabs(w4Ddx1)+0.5*dv4Ddx1+fabs(w5Ddx2)+0.5*dv5Ddx2);
+  } 
+} 
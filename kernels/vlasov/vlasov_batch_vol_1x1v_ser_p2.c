@@ -0,0 +1,47 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_vol_1x1v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_vol_1x1v_ser_p2: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // field:      q/m*EM fields.
+  // cot_vec:   Only used in gen geo.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv0dx0 = dxv[1]/dxv[0];
+  const double dv10 = 2/dxv[1];
+  const double *E0 = &field[0];
+  double alpha_vdim[8] = {0.0};
+  alpha_vdim[0] = 1.414213562373095*E0[0]*dv10;
+  alpha_vdim[1] = 1.414213562373095*E0[1]*dv10;
+  alpha_vdim[4] = 1.414213562373095*E0[2]*dv10;
+
+  double alpha_cdim[8][GKYL_VLASOV_BATCH] = {{0.0}};
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w0dx0 = w[1][l]/dxv[0];
+    const double dv1 = dxv[1], wv1 = w[1][l];
+
+    double cflFreq_mid = 0.0;
+
+    alpha_cdim[0][l] = 4.0*w0dx0;
+    alpha_cdim[2][l] = 1.154700538379252*dv0dx0;
+    cflFreq_mid += 5.0*(fabs(w0dx0)+0.5*dv0dx0);
+
+    cflFreq_mid += 5.0*fabs(0.25*alpha_vdim[0]-0.2795084971874737*alpha_vdim[4]);
+
+    out[1][l] += 0.8660254037844386*(alpha_cdim[2][l]*f[2][l]+alpha_cdim[0][l]*f[0][l]);
+    out[2][l] += 0.8660254037844386*(alpha_vdim[4]*f[4][l]+alpha_vdim[1]*f[1][l]+alpha_vdim[0]*f[0][l]);
+    out[3][l] += 0.7745966692414833*(alpha_cdim[2][l]*f[5][l]+alpha_vdim[1]*f[4][l]+f[1][l]*alpha_vdim[4])+0.8660254037844386*(alpha_cdim[0][l]*f[2][l]+f[0][l]*alpha_cdim[2][l]+alpha_vdim[0]*f[1][l]+f[0][l]*alpha_vdim[1]);
+    out[4][l] += 1.936491673103709*(alpha_cdim[2][l]*f[3][l]+alpha_cdim[0][l]*f[1][l]);
+    out[5][l] += 1.936491673103709*(alpha_vdim[4]*f[6][l]+alpha_vdim[1]*f[3][l]+alpha_vdim[0]*f[2][l]);
+    out[6][l] += 1.732050807568877*alpha_cdim[2][l]*f[7][l]+0.5532833351724881*alpha_vdim[4]*f[4][l]+0.8660254037844386*(alpha_vdim[0]*f[4][l]+f[0][l]*alpha_vdim[4])+1.936491673103709*alpha_cdim[0][l]*f[3][l]+f[1][l]*(1.936491673103709*alpha_cdim[2][l]+0.7745966692414833*alpha_vdim[1]);
+    out[7][l] += 1.732050807568877*alpha_vdim[1]*f[6][l]+0.8660254037844386*alpha_cdim[0][l]*f[5][l]+f[3][l]*(1.732050807568877*alpha_vdim[4]+1.936491673103709*alpha_vdim[0])+(0.7745966692414833*alpha_cdim[2][l]+1.936491673103709*alpha_vdim[1])*f[2][l];
+
+    cfl[l] = cflFreq_mid;
+  } 
+} 
@@ -0,0 +1,58 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_vol_1x2v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_vol_1x2v_tensor_p1: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // field:      q/m*EM fields.
+  // cot_vec:   Only used in gen geo.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv0dx0 = dxv[1]/dxv[0];
+  const double dv10 = 2/dxv[1];
+  const double *E0 = &field[0];
+  const double dv11 = 2/dxv[2];
+  const double *E1 = &field[2];
+  const double *B2 = &field[10];
+
+  double alpha_cdim[8][GKYL_VLASOV_BATCH] = {{0.0}};
+  double alpha_vdim[16][GKYL_VLASOV_BATCH] = {{0.0}};
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w0dx0 = w[1][l]/dxv[0];
+    const double dv1 = dxv[1], wv1 = w[1][l];
+    const double dv2 = dxv[2], wv2 = w[2][l];
+
+    double cflFreq_mid = 0.0;
+
+    alpha_cdim[0][l] = 5.656854249492382*w0dx0;
+    alpha_cdim[2][l] = 1.632993161855453*dv0dx0;
+    cflFreq_mid += 3.0*(fabs(w0dx0)+0.5*dv0dx0);
+
+    alpha_vdim[0][l] = 2.0*dv10*(B2[0]*wv2+E0[0]);
+    alpha_vdim[1][l] = 2.0*dv10*(B2[1]*wv2+E0[1]);
+    alpha_vdim[3][l] = 0.5773502691896258*B2[0]*dv10*dv2;
+    alpha_vdim[5][l] = 0.5773502691896258*B2[1]*dv10*dv2;
+    cflFreq_mid += 3.0*fabs(0.1767766952966368*alpha_vdim[0][l]);
+
+    alpha_vdim[8][l] = dv11*(2.0*E1[0]-2.0*B2[0]*wv1);
+    alpha_vdim[9][l] = dv11*(2.0*E1[1]-2.0*B2[1]*wv1);
+    alpha_vdim[10][l] = -0.5773502691896258*B2[0]*dv1*dv11;
+    alpha_vdim[12][l] = -0.5773502691896258*B2[1]*dv1*dv11;
+    cflFreq_mid += 3.0*fabs(0.1767766952966368*alpha_vdim[8][l]);
+
+    out[1][l] += 0.6123724356957944*(alpha_cdim[2][l]*f[2][l]+alpha_cdim[0][l]*f[0][l]);
+    out[2][l] += 0.6123724356957944*(alpha_vdim[5][l]*f[5][l]+alpha_vdim[3][l]*f[3][l]+alpha_vdim[1][l]*f[1][l]+alpha_vdim[0][l]*f[0][l]);
+    out[3][l] += 0.6123724356957944*(f[4][l]*alpha_vdim[12][l]+f[2][l]*alpha_vdim[10][l]+f[1][l]*alpha_vdim[9][l]+f[0][l]*alpha_vdim[8][l]);
+    out[4][l] += 0.6123724356957944*(alpha_vdim[3][l]*f[5][l]+f[3][l]*alpha_vdim[5][l]+alpha_cdim[0][l]*f[2][l]+f[0][l]*alpha_cdim[2][l]+alpha_vdim[0][l]*f[1][l]+f[0][l]*alpha_vdim[1][l]);
+    out[5][l] += 0.6123724356957944*(f[2][l]*alpha_vdim[12][l]+f[4][l]*alpha_vdim[10][l]+f[0][l]*alpha_vdim[9][l]+f[1][l]*alpha_vdim[8][l]+alpha_cdim[2][l]*f[6][l]+alpha_cdim[0][l]*f[3][l]);
+    out[6][l] += 0.6123724356957944*(f[1][l]*alpha_vdim[12][l]+f[0][l]*alpha_vdim[10][l]+f[4][l]*alpha_vdim[9][l]+f[2][l]*alpha_vdim[8][l]+alpha_vdim[1][l]*f[5][l]+f[1][l]*alpha_vdim[5][l]+alpha_vdim[0][l]*f[3][l]+f[0][l]*alpha_vdim[3][l]);
+    out[7][l] += 0.6123724356957944*(f[0][l]*alpha_vdim[12][l]+f[1][l]*alpha_vdim[10][l]+f[2][l]*alpha_vdim[9][l]+f[4][l]*alpha_vdim[8][l]+alpha_cdim[0][l]*f[6][l]+alpha_vdim[0][l]*f[5][l]+f[0][l]*alpha_vdim[5][l]+(alpha_cdim[2][l]+alpha_vdim[1][l])*f[3][l]+f[1][l]*alpha_vdim[3][l]);
+
+    cfl[l] = cflFreq_mid;
+  } 
+} 
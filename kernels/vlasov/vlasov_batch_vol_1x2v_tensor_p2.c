@@ -0,0 +1,81 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_vol_1x2v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_vol_1x2v_tensor_p2: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // field:      q/m*EM fields.
+  // cot_vec:   Only used in gen geo.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv0dx0 = dxv[1]/dxv[0];
+  const double dv10 = 2/dxv[1];
+  const double *E0 = &field[0];
+  const double dv11 = 2/dxv[2];
+  const double *E1 = &field[3];
+  const double *B2 = &field[15];
+
+  double alpha_cdim[27][GKYL_VLASOV_BATCH] = {{0.0}};
+  double alpha_vdim[54][GKYL_VLASOV_BATCH] = {{0.0}};
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w0dx0 = w[1][l]/dxv[0];
+    const double dv1 = dxv[1], wv1 = w[1][l];
+    const double dv2 = dxv[2], wv2 = w[2][l];
+
+    double cflFreq_mid = 0.0;
+
+    alpha_cdim[0][l] = 5.656854249492382*w0dx0;
+    alpha_cdim[2][l] = 1.632993161855453*dv0dx0;
+    cflFreq_mid += 5.0*(fabs(w0dx0)+0.5*dv0dx0);
+
+    alpha_vdim[0][l] = 2.0*dv10*(B2[0]*wv2+E0[0]);
+    alpha_vdim[1][l] = 2.0*dv10*(B2[1]*wv2+E0[1]);
+    alpha_vdim[3][l] = 0.5773502691896258*B2[0]*dv10*dv2;
+    alpha_vdim[5][l] = 0.5773502691896258*B2[1]*dv10*dv2;
+    alpha_vdim[7][l] = 2.0*dv10*(B2[2]*wv2+E0[2]);
+    alpha_vdim[13][l] = 0.5773502691896258*B2[2]*dv10*dv2;
+    cflFreq_mid += 5.0*fabs(0.1767766952966368*alpha_vdim[0][l]-0.1976423537605236*alpha_vdim[7][l]);
+
+    alpha_vdim[27][l] = dv11*(2.0*E1[0]-2.0*B2[0]*wv1);
+    alpha_vdim[28][l] = dv11*(2.0*E1[1]-2.0*B2[1]*wv1);
+    alpha_vdim[29][l] = -0.5773502691896258*B2[0]*dv1*dv11;
+    alpha_vdim[31][l] = -0.5773502691896258*B2[1]*dv1*dv11;
+    alpha_vdim[34][l] = dv11*(2.0*E1[2]-2.0*B2[2]*wv1);
+    alpha_vdim[38][l] = -0.5773502691896258*B2[2]*dv1*dv11;
+    cflFreq_mid += 5.0*fabs(0.1767766952966368*alpha_vdim[27][l]-0.1976423537605236*alpha_vdim[34][l]);
+
+    out[1][l] += 0.6123724356957944*(alpha_cdim[2][l]*f[2][l]+alpha_cdim[0][l]*f[0][l]);
+    out[2][l] += 0.6123724356957944*(alpha_vdim[13][l]*f[13][l]+alpha_vdim[7][l]*f[7][l]+alpha_vdim[5][l]*f[5][l]+alpha_vdim[3][l]*f[3][l]+alpha_vdim[1][l]*f[1][l]+alpha_vdim[0][l]*f[0][l]);
+    out[3][l] += 0.6123724356957944*(f[11][l]*alpha_vdim[38][l]+f[7][l]*alpha_vdim[34][l]+f[4][l]*alpha_vdim[31][l]+f[2][l]*alpha_vdim[29][l]+f[1][l]*alpha_vdim[28][l]+f[0][l]*alpha_vdim[27][l]);
+    out[4][l] += 0.5477225575051661*(alpha_vdim[5][l]*f[13][l]+f[5][l]*alpha_vdim[13][l]+alpha_cdim[2][l]*f[8][l]+alpha_vdim[1][l]*f[7][l]+f[1][l]*alpha_vdim[7][l])+0.6123724356957944*(alpha_vdim[3][l]*f[5][l]+f[3][l]*alpha_vdim[5][l]+alpha_cdim[0][l]*f[2][l]+f[0][l]*alpha_cdim[2][l]+alpha_vdim[0][l]*f[1][l]+f[0][l]*alpha_vdim[1][l]);
+    out[5][l] += 0.5477225575051661*(f[4][l]*alpha_vdim[38][l]+f[1][l]*alpha_vdim[34][l]+f[11][l]*alpha_vdim[31][l])+0.6123724356957944*(f[2][l]*alpha_vdim[31][l]+f[4][l]*alpha_vdim[29][l])+0.5477225575051661*f[7][l]*alpha_vdim[28][l]+0.6123724356957944*(f[0][l]*alpha_vdim[28][l]+f[1][l]*alpha_vdim[27][l]+alpha_cdim[2][l]*f[6][l]+alpha_cdim[0][l]*f[3][l]);
+    out[6][l] += 0.5477225575051661*f[20][l]*alpha_vdim[38][l]+0.6123724356957944*(f[7][l]*alpha_vdim[38][l]+f[11][l]*alpha_vdim[34][l])+(0.5477225575051661*f[12][l]+0.6123724356957944*f[1][l])*alpha_vdim[31][l]+0.5477225575051661*f[8][l]*alpha_vdim[29][l]+0.6123724356957944*(f[0][l]*alpha_vdim[29][l]+f[4][l]*alpha_vdim[28][l]+f[2][l]*alpha_vdim[27][l])+0.5477225575051661*(alpha_vdim[13][l]*f[21][l]+alpha_vdim[5][l]*f[15][l])+0.6123724356957944*(alpha_vdim[7][l]*f[13][l]+f[7][l]*alpha_vdim[13][l])+0.5477225575051661*alpha_vdim[3][l]*f[9][l]+0.6123724356957944*(alpha_vdim[1][l]*f[5][l]+f[1][l]*alpha_vdim[5][l]+alpha_vdim[0][l]*f[3][l]+f[0][l]*alpha_vdim[3][l]);
+    out[7][l] += 1.369306393762915*(alpha_cdim[2][l]*f[4][l]+alpha_cdim[0][l]*f[1][l]);
+    out[8][l] += 1.369306393762915*(alpha_vdim[13][l]*f[17][l]+alpha_vdim[7][l]*f[11][l]+alpha_vdim[5][l]*f[10][l]+alpha_vdim[3][l]*f[6][l]+alpha_vdim[1][l]*f[4][l]+alpha_vdim[0][l]*f[2][l]);
+    out[9][l] += 1.369306393762915*(f[17][l]*alpha_vdim[38][l]+f[13][l]*alpha_vdim[34][l]+f[10][l]*alpha_vdim[31][l]+f[6][l]*alpha_vdim[29][l]+f[5][l]*alpha_vdim[28][l]+f[3][l]*alpha_vdim[27][l]);
+    out[10][l] += 0.4898979485566357*f[12][l]*alpha_vdim[38][l]+0.5477225575051661*(f[1][l]*alpha_vdim[38][l]+f[4][l]*alpha_vdim[34][l])+(0.4898979485566357*f[20][l]+0.5477225575051661*(f[8][l]+f[7][l])+0.6123724356957944*f[0][l])*alpha_vdim[31][l]+(0.5477225575051661*f[12][l]+0.6123724356957944*f[1][l])*alpha_vdim[29][l]+0.5477225575051661*f[11][l]*alpha_vdim[28][l]+0.6123724356957944*(f[2][l]*alpha_vdim[28][l]+f[4][l]*alpha_vdim[27][l])+0.4898979485566357*(alpha_vdim[5][l]*f[21][l]+alpha_vdim[13][l]*f[15][l])+0.5477225575051661*(alpha_vdim[3][l]*f[15][l]+alpha_cdim[2][l]*f[14][l]+alpha_vdim[1][l]*f[13][l]+f[1][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*(f[9][l]+f[7][l])+f[5][l]*alpha_vdim[7][l])+0.6123724356957944*(alpha_cdim[0][l]*f[6][l]+alpha_vdim[0][l]*f[5][l]+f[0][l]*alpha_vdim[5][l]+(alpha_cdim[2][l]+alpha_vdim[1][l])*f[3][l]+f[1][l]*alpha_vdim[3][l]);
+    out[11][l] += 0.3912303982179757*alpha_vdim[13][l]*f[13][l]+0.6123724356957944*(alpha_vdim[3][l]*f[13][l]+f[3][l]*alpha_vdim[13][l])+1.224744871391589*alpha_cdim[2][l]*f[12][l]+0.3912303982179757*alpha_vdim[7][l]*f[7][l]+0.6123724356957944*(alpha_vdim[0][l]*f[7][l]+f[0][l]*alpha_vdim[7][l])+0.5477225575051661*alpha_vdim[5][l]*f[5][l]+1.369306393762915*alpha_cdim[0][l]*f[4][l]+f[1][l]*(1.369306393762915*alpha_cdim[2][l]+0.5477225575051661*alpha_vdim[1][l]);
+    out[12][l] += 1.224744871391589*(alpha_vdim[5][l]*f[17][l]+f[10][l]*alpha_vdim[13][l]+alpha_vdim[1][l]*f[11][l])+1.369306393762915*alpha_vdim[3][l]*f[10][l]+0.6123724356957944*alpha_cdim[0][l]*f[8][l]+1.224744871391589*f[4][l]*alpha_vdim[7][l]+1.369306393762915*(alpha_vdim[5][l]*f[6][l]+alpha_vdim[0][l]*f[4][l])+(0.5477225575051661*alpha_cdim[2][l]+1.369306393762915*alpha_vdim[1][l])*f[2][l];
+    out[13][l] += (0.3912303982179757*f[11][l]+0.6123724356957944*f[2][l])*alpha_vdim[38][l]+(0.3912303982179757*f[7][l]+0.6123724356957944*f[0][l])*alpha_vdim[34][l]+0.5477225575051661*f[4][l]*alpha_vdim[31][l]+0.6123724356957944*f[11][l]*alpha_vdim[29][l]+0.5477225575051661*f[1][l]*alpha_vdim[28][l]+0.6123724356957944*f[7][l]*alpha_vdim[27][l]+1.369306393762915*(alpha_cdim[2][l]*f[10][l]+alpha_cdim[0][l]*f[5][l]);
+    out[14][l] += 0.5477225575051661*f[11][l]*alpha_vdim[38][l]+0.6123724356957944*f[20][l]*alpha_vdim[34][l]+0.5477225575051661*(f[4][l]*alpha_vdim[31][l]+f[2][l]*alpha_vdim[29][l])+0.6123724356957944*(f[12][l]*alpha_vdim[28][l]+f[8][l]*alpha_vdim[27][l])+1.224744871391589*(alpha_vdim[13][l]*f[24][l]+alpha_vdim[5][l]*f[19][l])+1.369306393762915*alpha_vdim[7][l]*f[17][l]+1.224744871391589*alpha_vdim[3][l]*f[16][l]+1.369306393762915*(f[11][l]*alpha_vdim[13][l]+alpha_vdim[1][l]*f[10][l]+alpha_vdim[0][l]*f[6][l]+f[4][l]*alpha_vdim[5][l]+f[2][l]*alpha_vdim[3][l]);
+    out[15][l] += 1.224744871391589*(f[10][l]*alpha_vdim[38][l]+f[5][l]*alpha_vdim[34][l]+f[17][l]*alpha_vdim[31][l])+1.369306393762915*(f[6][l]*alpha_vdim[31][l]+f[10][l]*alpha_vdim[29][l])+1.224744871391589*f[13][l]*alpha_vdim[28][l]+1.369306393762915*(f[3][l]*alpha_vdim[28][l]+f[5][l]*alpha_vdim[27][l])+0.6123724356957944*(alpha_cdim[2][l]*f[16][l]+alpha_cdim[0][l]*f[9][l]);
+    out[16][l] += 1.224744871391589*f[23][l]*alpha_vdim[38][l]+1.369306393762915*(f[13][l]*alpha_vdim[38][l]+f[17][l]*alpha_vdim[34][l])+(1.224744871391589*f[18][l]+1.369306393762915*f[5][l])*alpha_vdim[31][l]+1.224744871391589*f[14][l]*alpha_vdim[29][l]+1.369306393762915*(f[3][l]*alpha_vdim[29][l]+f[10][l]*alpha_vdim[28][l]+f[6][l]*alpha_vdim[27][l])+0.6123724356957944*(alpha_vdim[7][l]*f[21][l]+alpha_vdim[1][l]*f[15][l])+0.5477225575051661*alpha_vdim[13][l]*f[13][l]+0.6123724356957944*alpha_vdim[0][l]*f[9][l]+0.5477225575051661*(alpha_vdim[5][l]*f[5][l]+alpha_vdim[3][l]*f[3][l]);
+    out[17][l] += (0.3499271061118826*f[20][l]+0.5477225575051661*f[8][l]+0.3912303982179757*f[7][l]+0.6123724356957944*f[0][l])*alpha_vdim[38][l]+(0.3912303982179757*f[11][l]+0.6123724356957944*f[2][l])*alpha_vdim[34][l]+(0.4898979485566357*f[12][l]+0.5477225575051661*f[1][l])*alpha_vdim[31][l]+(0.5477225575051661*f[20][l]+0.6123724356957944*f[7][l])*alpha_vdim[29][l]+0.5477225575051661*f[4][l]*alpha_vdim[28][l]+0.6123724356957944*f[11][l]*alpha_vdim[27][l]+(0.3499271061118826*alpha_vdim[13][l]+0.5477225575051661*alpha_vdim[3][l])*f[21][l]+1.224744871391589*alpha_cdim[2][l]*f[18][l]+0.4898979485566357*alpha_vdim[5][l]*f[15][l]+(0.3912303982179757*alpha_vdim[7][l]+0.6123724356957944*alpha_vdim[0][l])*f[13][l]+(0.5477225575051661*f[9][l]+0.3912303982179757*f[7][l]+0.6123724356957944*f[0][l])*alpha_vdim[13][l]+1.369306393762915*alpha_cdim[0][l]*f[10][l]+0.6123724356957944*(alpha_vdim[3][l]*f[7][l]+f[3][l]*alpha_vdim[7][l])+1.369306393762915*alpha_cdim[2][l]*f[5][l]+0.5477225575051661*(alpha_vdim[1][l]*f[5][l]+f[1][l]*alpha_vdim[5][l]);
+    out[18][l] += 0.4898979485566357*f[4][l]*alpha_vdim[38][l]+0.5477225575051661*f[12][l]*alpha_vdim[34][l]+0.4898979485566357*f[11][l]*alpha_vdim[31][l]+0.5477225575051661*(f[2][l]*alpha_vdim[31][l]+f[4][l]*alpha_vdim[29][l]+f[20][l]*alpha_vdim[28][l])+0.6123724356957944*(f[8][l]*alpha_vdim[28][l]+f[12][l]*alpha_vdim[27][l])+1.095445115010332*(alpha_vdim[5][l]*f[24][l]+alpha_vdim[13][l]*f[19][l])+1.224744871391589*(alpha_vdim[3][l]*f[19][l]+alpha_vdim[1][l]*f[17][l]+alpha_vdim[5][l]*f[16][l])+0.6123724356957944*alpha_cdim[0][l]*f[14][l]+1.224744871391589*(f[4][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*f[11][l])+(1.224744871391589*alpha_vdim[7][l]+1.369306393762915*alpha_vdim[0][l])*f[10][l]+0.5477225575051661*alpha_cdim[2][l]*f[6][l]+1.369306393762915*(alpha_vdim[1][l]*f[6][l]+f[2][l]*alpha_vdim[5][l]+alpha_vdim[3][l]*f[4][l]);
+    out[19][l] += 1.095445115010332*f[18][l]*alpha_vdim[38][l]+1.224744871391589*(f[5][l]*alpha_vdim[38][l]+f[10][l]*alpha_vdim[34][l])+(1.095445115010332*f[23][l]+1.224744871391589*(f[14][l]+f[13][l])+1.369306393762915*f[3][l])*alpha_vdim[31][l]+(1.224744871391589*f[18][l]+1.369306393762915*f[5][l])*alpha_vdim[29][l]+1.224744871391589*f[17][l]*alpha_vdim[28][l]+1.369306393762915*(f[6][l]*alpha_vdim[28][l]+f[10][l]*alpha_vdim[27][l])+0.5477225575051661*(alpha_cdim[2][l]*f[22][l]+alpha_vdim[1][l]*f[21][l])+0.6123724356957944*alpha_cdim[0][l]*f[16][l]+(0.5477225575051661*alpha_vdim[7][l]+0.6123724356957944*alpha_vdim[0][l])*f[15][l]+0.4898979485566357*(alpha_vdim[5][l]*f[13][l]+f[5][l]*alpha_vdim[13][l])+0.6123724356957944*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[9][l]+0.5477225575051661*(alpha_vdim[3][l]*f[5][l]+f[3][l]*alpha_vdim[5][l]);
+    out[20][l] += 0.8748177652797062*alpha_vdim[13][l]*f[17][l]+1.369306393762915*(alpha_vdim[3][l]*f[17][l]+f[6][l]*alpha_vdim[13][l]+alpha_cdim[0][l]*f[12][l])+(0.8748177652797062*alpha_vdim[7][l]+1.369306393762915*alpha_vdim[0][l])*f[11][l]+1.224744871391589*alpha_vdim[5][l]*f[10][l]+1.369306393762915*f[2][l]*alpha_vdim[7][l]+1.224744871391589*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[4][l];
+    out[21][l] += (0.8748177652797062*f[17][l]+1.369306393762915*f[6][l])*alpha_vdim[38][l]+(0.8748177652797062*f[13][l]+1.369306393762915*f[3][l])*alpha_vdim[34][l]+1.224744871391589*f[10][l]*alpha_vdim[31][l]+1.369306393762915*f[17][l]*alpha_vdim[29][l]+1.224744871391589*f[5][l]*alpha_vdim[28][l]+1.369306393762915*(f[13][l]*alpha_vdim[27][l]+alpha_cdim[2][l]*f[19][l]+alpha_cdim[0][l]*f[15][l]);
+    out[22][l] += 1.224744871391589*f[17][l]*alpha_vdim[38][l]+1.369306393762915*f[23][l]*alpha_vdim[34][l]+1.224744871391589*(f[10][l]*alpha_vdim[31][l]+f[6][l]*alpha_vdim[29][l])+1.369306393762915*(f[18][l]*alpha_vdim[28][l]+f[14][l]*alpha_vdim[27][l]+alpha_vdim[7][l]*f[24][l]+alpha_vdim[1][l]*f[19][l])+1.224744871391589*alpha_vdim[13][l]*f[17][l]+1.369306393762915*alpha_vdim[0][l]*f[16][l]+1.224744871391589*(alpha_vdim[5][l]*f[10][l]+alpha_vdim[3][l]*f[6][l]);
+    out[23][l] += (0.3499271061118826*f[11][l]+0.5477225575051661*f[2][l])*alpha_vdim[38][l]+(0.3912303982179757*f[20][l]+0.6123724356957944*f[8][l])*alpha_vdim[34][l]+0.4898979485566357*f[4][l]*alpha_vdim[31][l]+0.5477225575051661*(f[11][l]*alpha_vdim[29][l]+f[12][l]*alpha_vdim[28][l])+0.6123724356957944*f[20][l]*alpha_vdim[27][l]+(0.7824607964359517*alpha_vdim[13][l]+1.224744871391589*alpha_vdim[3][l])*f[24][l]+1.095445115010332*alpha_vdim[5][l]*f[19][l]+1.369306393762915*alpha_cdim[0][l]*f[18][l]+(0.8748177652797062*alpha_vdim[7][l]+1.369306393762915*alpha_vdim[0][l])*f[17][l]+alpha_vdim[13][l]*(1.224744871391589*f[16][l]+0.8748177652797062*f[11][l])+1.369306393762915*(f[2][l]*alpha_vdim[13][l]+alpha_vdim[3][l]*f[11][l])+1.224744871391589*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[10][l]+1.369306393762915*f[6][l]*alpha_vdim[7][l]+1.224744871391589*f[4][l]*alpha_vdim[5][l];
+    out[24][l] += (0.7824607964359517*f[23][l]+1.224744871391589*f[14][l]+0.8748177652797062*f[13][l]+1.369306393762915*f[3][l])*alpha_vdim[38][l]+(0.8748177652797062*f[17][l]+1.369306393762915*f[6][l])*alpha_vdim[34][l]+(1.095445115010332*f[18][l]+1.224744871391589*f[5][l])*alpha_vdim[31][l]+(1.224744871391589*f[23][l]+1.369306393762915*f[13][l])*alpha_vdim[29][l]+1.224744871391589*f[10][l]*alpha_vdim[28][l]+1.369306393762915*f[17][l]*alpha_vdim[27][l]+1.224744871391589*alpha_cdim[2][l]*f[25][l]+(0.3912303982179757*alpha_vdim[7][l]+0.6123724356957944*alpha_vdim[0][l])*f[21][l]+1.369306393762915*alpha_cdim[0][l]*f[19][l]+(1.369306393762915*alpha_cdim[2][l]+0.5477225575051661*alpha_vdim[1][l])*f[15][l]+0.3499271061118826*alpha_vdim[13][l]*f[13][l]+0.5477225575051661*(alpha_vdim[3][l]*f[13][l]+f[3][l]*alpha_vdim[13][l])+0.6123724356957944*alpha_vdim[7][l]*f[9][l]+0.4898979485566357*alpha_vdim[5][l]*f[5][l];
+    out[25][l] += 1.095445115010332*f[10][l]*alpha_vdim[38][l]+1.224744871391589*f[18][l]*alpha_vdim[34][l]+1.095445115010332*f[17][l]*alpha_vdim[31][l]+1.224744871391589*(f[6][l]*alpha_vdim[31][l]+f[10][l]*alpha_vdim[29][l]+f[23][l]*alpha_vdim[28][l])+1.369306393762915*(f[14][l]*alpha_vdim[28][l]+f[18][l]*alpha_vdim[27][l])+1.224744871391589*alpha_vdim[1][l]*f[24][l]+0.6123724356957944*alpha_cdim[0][l]*f[22][l]+(1.224744871391589*alpha_vdim[7][l]+1.369306393762915*alpha_vdim[0][l])*f[19][l]+1.095445115010332*alpha_vdim[5][l]*f[17][l]+(0.5477225575051661*alpha_cdim[2][l]+1.369306393762915*alpha_vdim[1][l])*f[16][l]+1.095445115010332*f[10][l]*alpha_vdim[13][l]+1.224744871391589*(alpha_vdim[3][l]*f[10][l]+alpha_vdim[5][l]*f[6][l]);
+    out[26][l] += (0.7824607964359517*f[17][l]+1.224744871391589*f[6][l])*alpha_vdim[38][l]+(0.8748177652797062*f[23][l]+1.369306393762915*f[14][l])*alpha_vdim[34][l]+1.095445115010332*f[10][l]*alpha_vdim[31][l]+1.224744871391589*(f[17][l]*alpha_vdim[29][l]+f[18][l]*alpha_vdim[28][l])+1.369306393762915*(f[23][l]*alpha_vdim[27][l]+alpha_cdim[0][l]*f[25][l])+(0.8748177652797062*alpha_vdim[7][l]+1.369306393762915*alpha_vdim[0][l])*f[24][l]+1.224744871391589*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[19][l]+(0.7824607964359517*alpha_vdim[13][l]+1.224744871391589*alpha_vdim[3][l])*f[17][l]+1.369306393762915*alpha_vdim[7][l]*f[16][l]+1.224744871391589*f[6][l]*alpha_vdim[13][l]+1.095445115010332*alpha_vdim[5][l]*f[10][l];
+
+    cfl[l] = cflFreq_mid;
+  } 
+} 
@@ -0,0 +1,83 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_vol_1x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_vol_1x3v_tensor_p1: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // field:      q/m*EM fields.
+  // cot_vec:   Only used in gen geo.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv0dx0 = dxv[1]/dxv[0];
+  const double dv10 = 2/dxv[1];
+  const double *E0 = &field[0];
+  const double dv11 = 2/dxv[2];
+  const double *E1 = &field[2];
+  const double dv12 = 2/dxv[3];
+  const double *E2 = &field[4];
+  const double *B0 = &field[6];
+  const double *B1 = &field[8];
+  const double *B2 = &field[10];
+
+  double alpha_cdim[16][GKYL_VLASOV_BATCH] = {{0.0}};
+  double alpha_vdim[48][GKYL_VLASOV_BATCH] = {{0.0}};
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w0dx0 = w[1][l]/dxv[0];
+    const double dv1 = dxv[1], wv1 = w[1][l];
+    const double dv2 = dxv[2], wv2 = w[2][l];
+    const double dv3 = dxv[3], wv3 = w[3][l];
+
+    double cflFreq_mid = 0.0;
+
+    alpha_cdim[0][l] = 8.0*w0dx0;
+    alpha_cdim[2][l] = 2.309401076758503*dv0dx0;
+    cflFreq_mid += 3.0*(fabs(w0dx0)+0.5*dv0dx0);
+
+    alpha_vdim[0][l] = dv10*(2.828427124746191*(B2[0]*wv2+E0[0])-2.828427124746191*B1[0]*wv3);
+    alpha_vdim[1][l] = dv10*(2.828427124746191*(B2[1]*wv2+E0[1])-2.828427124746191*B1[1]*wv3);
+    alpha_vdim[3][l] = 0.8164965809277261*B2[0]*dv10*dv2;
+    alpha_vdim[4][l] = -0.8164965809277261*B1[0]*dv10*dv3;
+    alpha_vdim[6][l] = 0.8164965809277261*B2[1]*dv10*dv2;
+    alpha_vdim[8][l] = -0.8164965809277261*B1[1]*dv10*dv3;
+    cflFreq_mid += 3.0*fabs(0.125*alpha_vdim[0][l]);
+
+    alpha_vdim[16][l] = dv11*(2.828427124746191*B0[0]*wv3-2.828427124746191*B2[0]*wv1+2.828427124746191*E1[0]);
+    alpha_vdim[17][l] = dv11*(2.828427124746191*B0[1]*wv3-2.828427124746191*B2[1]*wv1+2.828427124746191*E1[1]);
+    alpha_vdim[18][l] = -0.8164965809277261*B2[0]*dv1*dv11;
+    alpha_vdim[20][l] = 0.8164965809277261*B0[0]*dv11*dv3;
+    alpha_vdim[21][l] = -0.8164965809277261*B2[1]*dv1*dv11;
+    alpha_vdim[24][l] = 0.8164965809277261*B0[1]*dv11*dv3;
+    cflFreq_mid += 3.0*fabs(0.125*alpha_vdim[16][l]);
+
+    alpha_vdim[32][l] = dv12*(2.828427124746191*(B1[0]*wv1+E2[0])-2.828427124746191*B0[0]*wv2);
+    alpha_vdim[33][l] = dv12*(2.828427124746191*(B1[1]*wv1+E2[1])-2.828427124746191*B0[1]*wv2);
+    alpha_vdim[34][l] = 0.8164965809277261*B1[0]*dv1*dv12;
+    alpha_vdim[35][l] = -0.8164965809277261*B0[0]*dv12*dv2;
+    alpha_vdim[37][l] = 0.8164965809277261*B1[1]*dv1*dv12;
+    alpha_vdim[38][l] = -0.8164965809277261*B0[1]*dv12*dv2;
+    cflFreq_mid += 3.0*fabs(0.125*alpha_vdim[32][l]);
+
+    out[1][l] += 0.4330127018922193*(alpha_cdim[2][l]*f[2][l]+alpha_cdim[0][l]*f[0][l]);
+    out[2][l] += 0.4330127018922193*(alpha_vdim[8][l]*f[8][l]+alpha_vdim[6][l]*f[6][l]+alpha_vdim[4][l]*f[4][l]+alpha_vdim[3][l]*f[3][l]+alpha_vdim[1][l]*f[1][l]+alpha_vdim[0][l]*f[0][l]);
+    out[3][l] += 0.4330127018922193*(f[8][l]*alpha_vdim[24][l]+f[5][l]*alpha_vdim[21][l]+f[4][l]*alpha_vdim[20][l]+f[2][l]*alpha_vdim[18][l]+f[1][l]*alpha_vdim[17][l]+f[0][l]*alpha_vdim[16][l]);
+    out[4][l] += 0.4330127018922193*(f[6][l]*alpha_vdim[38][l]+f[5][l]*alpha_vdim[37][l]+f[3][l]*alpha_vdim[35][l]+f[2][l]*alpha_vdim[34][l]+f[1][l]*alpha_vdim[33][l]+f[0][l]*alpha_vdim[32][l]);
+    out[5][l] += 0.4330127018922193*(alpha_vdim[4][l]*f[8][l]+f[4][l]*alpha_vdim[8][l]+alpha_vdim[3][l]*f[6][l]+f[3][l]*alpha_vdim[6][l]+alpha_cdim[0][l]*f[2][l]+f[0][l]*alpha_cdim[2][l]+alpha_vdim[0][l]*f[1][l]+f[0][l]*alpha_vdim[1][l]);
+    out[6][l] += 0.4330127018922193*(f[4][l]*alpha_vdim[24][l]+f[2][l]*alpha_vdim[21][l]+f[8][l]*alpha_vdim[20][l]+f[5][l]*alpha_vdim[18][l]+f[0][l]*alpha_vdim[17][l]+f[1][l]*alpha_vdim[16][l]+alpha_cdim[2][l]*f[7][l]+alpha_cdim[0][l]*f[3][l]);
+    out[7][l] += 0.4330127018922193*(f[12][l]*alpha_vdim[24][l]+f[1][l]*alpha_vdim[21][l]+f[9][l]*alpha_vdim[20][l]+f[0][l]*alpha_vdim[18][l]+f[5][l]*alpha_vdim[17][l]+f[2][l]*alpha_vdim[16][l]+alpha_vdim[8][l]*f[13][l]+alpha_vdim[4][l]*f[10][l]+alpha_vdim[1][l]*f[6][l]+f[1][l]*alpha_vdim[6][l]+alpha_vdim[0][l]*f[3][l]+f[0][l]*alpha_vdim[3][l]);
+    out[8][l] += 0.4330127018922193*(f[3][l]*alpha_vdim[38][l]+f[2][l]*alpha_vdim[37][l]+f[6][l]*alpha_vdim[35][l]+f[5][l]*alpha_vdim[34][l]+f[0][l]*alpha_vdim[33][l]+f[1][l]*alpha_vdim[32][l]+alpha_cdim[2][l]*f[9][l]+alpha_cdim[0][l]*f[4][l]);
+    out[9][l] += 0.4330127018922193*(f[11][l]*alpha_vdim[38][l]+f[1][l]*alpha_vdim[37][l]+f[7][l]*alpha_vdim[35][l]+f[0][l]*alpha_vdim[34][l]+f[5][l]*alpha_vdim[33][l]+f[2][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[13][l]+alpha_vdim[3][l]*f[10][l]+alpha_vdim[1][l]*f[8][l]+f[1][l]*alpha_vdim[8][l]+alpha_vdim[0][l]*f[4][l]+f[0][l]*alpha_vdim[4][l]);
+    out[10][l] += 0.4330127018922193*(f[1][l]*alpha_vdim[38][l]+f[11][l]*alpha_vdim[37][l]+f[0][l]*alpha_vdim[35][l]+f[7][l]*alpha_vdim[34][l]+f[6][l]*alpha_vdim[33][l]+f[3][l]*alpha_vdim[32][l]+f[1][l]*alpha_vdim[24][l]+f[12][l]*alpha_vdim[21][l]+f[0][l]*alpha_vdim[20][l]+f[9][l]*alpha_vdim[18][l]+f[8][l]*alpha_vdim[17][l]+f[4][l]*alpha_vdim[16][l]);
+    out[11][l] += 0.4330127018922193*(f[9][l]*alpha_vdim[24][l]+f[0][l]*alpha_vdim[21][l]+f[12][l]*alpha_vdim[20][l]+f[1][l]*alpha_vdim[18][l]+f[2][l]*alpha_vdim[17][l]+f[5][l]*alpha_vdim[16][l]+alpha_vdim[4][l]*f[13][l]+alpha_vdim[8][l]*f[10][l]+alpha_cdim[0][l]*f[7][l]+alpha_vdim[0][l]*f[6][l]+f[0][l]*alpha_vdim[6][l]+(alpha_cdim[2][l]+alpha_vdim[1][l])*f[3][l]+f[1][l]*alpha_vdim[3][l]);
+    out[12][l] += 0.4330127018922193*(f[7][l]*alpha_vdim[38][l]+f[0][l]*alpha_vdim[37][l]+f[11][l]*alpha_vdim[35][l]+f[1][l]*alpha_vdim[34][l]+f[2][l]*alpha_vdim[33][l]+f[5][l]*alpha_vdim[32][l]+alpha_vdim[3][l]*f[13][l]+alpha_vdim[6][l]*f[10][l]+alpha_cdim[0][l]*f[9][l]+alpha_vdim[0][l]*f[8][l]+f[0][l]*alpha_vdim[8][l]+(alpha_cdim[2][l]+alpha_vdim[1][l])*f[4][l]+f[1][l]*alpha_vdim[4][l]);
+    out[13][l] += 0.4330127018922193*(f[0][l]*alpha_vdim[38][l]+f[7][l]*alpha_vdim[37][l]+f[1][l]*alpha_vdim[35][l]+f[11][l]*alpha_vdim[34][l]+f[3][l]*alpha_vdim[33][l]+f[6][l]*alpha_vdim[32][l]+f[0][l]*alpha_vdim[24][l]+f[9][l]*alpha_vdim[21][l]+f[1][l]*alpha_vdim[20][l]+f[12][l]*alpha_vdim[18][l]+f[4][l]*alpha_vdim[17][l]+f[8][l]*alpha_vdim[16][l]+alpha_cdim[2][l]*f[14][l]+alpha_cdim[0][l]*f[10][l]);
+    out[14][l] += 0.4330127018922193*(f[5][l]*alpha_vdim[38][l]+f[6][l]*alpha_vdim[37][l]+f[2][l]*alpha_vdim[35][l]+f[3][l]*alpha_vdim[34][l]+f[11][l]*alpha_vdim[33][l]+f[7][l]*alpha_vdim[32][l]+f[5][l]*alpha_vdim[24][l]+f[8][l]*alpha_vdim[21][l]+f[2][l]*alpha_vdim[20][l]+f[4][l]*alpha_vdim[18][l]+f[12][l]*alpha_vdim[17][l]+f[9][l]*alpha_vdim[16][l]+alpha_vdim[1][l]*f[13][l]+alpha_vdim[0][l]*f[10][l]+alpha_vdim[6][l]*f[8][l]+f[6][l]*alpha_vdim[8][l]+alpha_vdim[3][l]*f[4][l]+f[3][l]*alpha_vdim[4][l]);
+    out[15][l] += 0.4330127018922193*(f[2][l]*alpha_vdim[38][l]+f[3][l]*alpha_vdim[37][l]+f[5][l]*alpha_vdim[35][l]+f[6][l]*alpha_vdim[34][l]+f[7][l]*alpha_vdim[33][l]+f[11][l]*alpha_vdim[32][l]+f[2][l]*alpha_vdim[24][l]+f[4][l]*alpha_vdim[21][l]+f[5][l]*alpha_vdim[20][l]+f[8][l]*alpha_vdim[18][l]+f[9][l]*alpha_vdim[17][l]+f[12][l]*alpha_vdim[16][l]+alpha_cdim[0][l]*f[14][l]+alpha_vdim[0][l]*f[13][l]+(alpha_cdim[2][l]+alpha_vdim[1][l])*f[10][l]+alpha_vdim[3][l]*f[8][l]+f[3][l]*alpha_vdim[8][l]+alpha_vdim[4][l]*f[6][l]+f[4][l]*alpha_vdim[6][l]);
+
+    cfl[l] = cflFreq_mid;
+  } 
+} 
@@ -0,0 +1,157 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_vol_1x3v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_vol_1x3v_tensor_p2: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // field:      q/m*EM fields.
+  // cot_vec:   Only used in gen geo.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv0dx0 = dxv[1]/dxv[0];
+  const double dv10 = 2/dxv[1];
+  const double *E0 = &field[0];
+  const double dv11 = 2/dxv[2];
+  const double *E1 = &field[3];
+  const double dv12 = 2/dxv[3];
+  const double *E2 = &field[6];
+  const double *B0 = &field[9];
+  const double *B1 = &field[12];
+  const double *B2 = &field[15];
+
+  double alpha_cdim[81][GKYL_VLASOV_BATCH] = {{0.0}};
+  double alpha_vdim[243][GKYL_VLASOV_BATCH] = {{0.0}};
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w0dx0 = w[1][l]/dxv[0];
+    const double dv1 = dxv[1], wv1 = w[1][l];
+    const double dv2 = dxv[2], wv2 = w[2][l];
+    const double dv3 = dxv[3], wv3 = w[3][l];
+
+    double cflFreq_mid = 0.0;
+
+    alpha_cdim[0][l] = 8.0*w0dx0;
+    alpha_cdim[2][l] = 2.309401076758503*dv0dx0;
+    cflFreq_mid += 5.0*(fabs(w0dx0)+0.5*dv0dx0);
+
+    alpha_vdim[0][l] = dv10*(2.828427124746191*(B2[0]*wv2+E0[0])-2.828427124746191*B1[0]*wv3);
+    alpha_vdim[1][l] = dv10*(2.828427124746191*(B2[1]*wv2+E0[1])-2.828427124746191*B1[1]*wv3);
+    alpha_vdim[3][l] = 0.8164965809277261*B2[0]*dv10*dv2;
+    alpha_vdim[4][l] = -0.8164965809277261*B1[0]*dv10*dv3;
+    alpha_vdim[6][l] = 0.8164965809277261*B2[1]*dv10*dv2;
+    alpha_vdim[8][l] = -0.8164965809277261*B1[1]*dv10*dv3;
+    alpha_vdim[11][l] = dv10*(2.828427124746191*(B2[2]*wv2+E0[2])-2.828427124746191*B1[2]*wv3);
+    alpha_vdim[21][l] = 0.8164965809277261*B2[2]*dv10*dv2;
+    alpha_vdim[25][l] = -0.8164965809277261*B1[2]*dv10*dv3;
+    cflFreq_mid += 5.0*fabs(0.125*alpha_vdim[0][l]-0.1397542485937369*alpha_vdim[11][l]);
+
+    alpha_vdim[81][l] = dv11*(2.828427124746191*B0[0]*wv3-2.828427124746191*B2[0]*wv1+2.828427124746191*E1[0]);
+    alpha_vdim[82][l] = dv11*(2.828427124746191*B0[1]*wv3-2.828427124746191*B2[1]*wv1+2.828427124746191*E1[1]);
+    alpha_vdim[83][l] = -0.8164965809277261*B2[0]*dv1*dv11;
+    alpha_vdim[85][l] = 0.8164965809277261*B0[0]*dv11*dv3;
+    alpha_vdim[86][l] = -0.8164965809277261*B2[1]*dv1*dv11;
+    alpha_vdim[89][l] = 0.8164965809277261*B0[1]*dv11*dv3;
+    alpha_vdim[92][l] = dv11*(2.828427124746191*B0[2]*wv3-2.828427124746191*B2[2]*wv1+2.828427124746191*E1[2]);
+    alpha_vdim[100][l] = -0.8164965809277261*B2[2]*dv1*dv11;
+    alpha_vdim[106][l] = 0.8164965809277261*B0[2]*dv11*dv3;
+    cflFreq_mid += 5.0*fabs(0.125*alpha_vdim[81][l]-0.1397542485937369*alpha_vdim[92][l]);
+
+    alpha_vdim[162][l] = dv12*(2.828427124746191*(B1[0]*wv1+E2[0])-2.828427124746191*B0[0]*wv2);
+    alpha_vdim[163][l] = dv12*(2.828427124746191*(B1[1]*wv1+E2[1])-2.828427124746191*B0[1]*wv2);
+    alpha_vdim[164][l] = 0.8164965809277261*B1[0]*dv1*dv12;
+    alpha_vdim[165][l] = -0.8164965809277261*B0[0]*dv12*dv2;
+    alpha_vdim[167][l] = 0.8164965809277261*B1[1]*dv1*dv12;
+    alpha_vdim[168][l] = -0.8164965809277261*B0[1]*dv12*dv2;
+    alpha_vdim[173][l] = dv12*(2.828427124746191*(B1[2]*wv1+E2[2])-2.828427124746191*B0[2]*wv2);
+    alpha_vdim[181][l] = 0.8164965809277261*B1[2]*dv1*dv12;
+    alpha_vdim[183][l] = -0.8164965809277261*B0[2]*dv12*dv2;
+    cflFreq_mid += 5.0*fabs(0.125*alpha_vdim[162][l]-0.1397542485937369*alpha_vdim[173][l]);
+
+    out[1][l] += 0.4330127018922193*(alpha_cdim[2][l]*f[2][l]+alpha_cdim[0][l]*f[0][l]);
+    out[2][l] += 0.4330127018922193*(alpha_vdim[25][l]*f[25][l]+alpha_vdim[21][l]*f[21][l]+alpha_vdim[11][l]*f[11][l]+alpha_vdim[8][l]*f[8][l]+alpha_vdim[6][l]*f[6][l]+alpha_vdim[4][l]*f[4][l]+alpha_vdim[3][l]*f[3][l]+alpha_vdim[1][l]*f[1][l]+alpha_vdim[0][l]*f[0][l]);
+    out[3][l] += 0.4330127018922193*(f[25][l]*alpha_vdim[106][l]+f[19][l]*alpha_vdim[100][l]+f[11][l]*alpha_vdim[92][l]+f[8][l]*alpha_vdim[89][l]+f[5][l]*alpha_vdim[86][l]+f[4][l]*alpha_vdim[85][l]+f[2][l]*alpha_vdim[83][l]+f[1][l]*alpha_vdim[82][l]+f[0][l]*alpha_vdim[81][l]);
+    out[4][l] += 0.4330127018922193*(f[21][l]*alpha_vdim[183][l]+f[19][l]*alpha_vdim[181][l]+f[11][l]*alpha_vdim[173][l]+f[6][l]*alpha_vdim[168][l]+f[5][l]*alpha_vdim[167][l]+f[3][l]*alpha_vdim[165][l]+f[2][l]*alpha_vdim[164][l]+f[1][l]*alpha_vdim[163][l]+f[0][l]*alpha_vdim[162][l]);
+    out[5][l] += 0.3872983346207416*(alpha_vdim[8][l]*f[25][l]+f[8][l]*alpha_vdim[25][l]+alpha_vdim[6][l]*f[21][l]+f[6][l]*alpha_vdim[21][l]+alpha_cdim[2][l]*f[12][l]+alpha_vdim[1][l]*f[11][l]+f[1][l]*alpha_vdim[11][l])+0.4330127018922193*(alpha_vdim[4][l]*f[8][l]+f[4][l]*alpha_vdim[8][l]+alpha_vdim[3][l]*f[6][l]+f[3][l]*alpha_vdim[6][l]+alpha_cdim[0][l]*f[2][l]+f[0][l]*alpha_cdim[2][l]+alpha_vdim[0][l]*f[1][l]+f[0][l]*alpha_vdim[1][l]);
+    out[6][l] += 0.3872983346207416*(f[8][l]*alpha_vdim[106][l]+f[5][l]*alpha_vdim[100][l]+f[1][l]*alpha_vdim[92][l])+(0.3872983346207416*f[25][l]+0.4330127018922193*f[4][l])*alpha_vdim[89][l]+0.3872983346207416*f[19][l]*alpha_vdim[86][l]+0.4330127018922193*(f[2][l]*alpha_vdim[86][l]+f[8][l]*alpha_vdim[85][l]+f[5][l]*alpha_vdim[83][l])+0.3872983346207416*f[11][l]*alpha_vdim[82][l]+0.4330127018922193*(f[0][l]*alpha_vdim[82][l]+f[1][l]*alpha_vdim[81][l]+alpha_cdim[2][l]*f[7][l]+alpha_cdim[0][l]*f[3][l]);
+    out[7][l] += 0.4330127018922193*f[35][l]*alpha_vdim[106][l]+0.3872983346207416*f[44][l]*alpha_vdim[100][l]+0.4330127018922193*(f[11][l]*alpha_vdim[100][l]+f[19][l]*alpha_vdim[92][l]+f[16][l]*alpha_vdim[89][l])+0.3872983346207416*f[20][l]*alpha_vdim[86][l]+0.4330127018922193*(f[1][l]*alpha_vdim[86][l]+f[9][l]*alpha_vdim[85][l])+0.3872983346207416*f[12][l]*alpha_vdim[83][l]+0.4330127018922193*(f[0][l]*alpha_vdim[83][l]+f[5][l]*alpha_vdim[82][l]+f[2][l]*alpha_vdim[81][l])+0.3872983346207416*alpha_vdim[21][l]*f[45][l]+0.4330127018922193*alpha_vdim[25][l]*f[37][l]+0.3872983346207416*alpha_vdim[6][l]*f[23][l]+0.4330127018922193*(alpha_vdim[11][l]*f[21][l]+f[11][l]*alpha_vdim[21][l]+alpha_vdim[8][l]*f[17][l])+0.3872983346207416*alpha_vdim[3][l]*f[13][l]+0.4330127018922193*(alpha_vdim[4][l]*f[10][l]+alpha_vdim[1][l]*f[6][l]+f[1][l]*alpha_vdim[6][l]+alpha_vdim[0][l]*f[3][l]+f[0][l]*alpha_vdim[3][l]);
+    out[8][l] += 0.3872983346207416*(f[6][l]*alpha_vdim[183][l]+f[5][l]*alpha_vdim[181][l]+f[1][l]*alpha_vdim[173][l])+(0.3872983346207416*f[21][l]+0.4330127018922193*f[3][l])*alpha_vdim[168][l]+0.3872983346207416*f[19][l]*alpha_vdim[167][l]+0.4330127018922193*(f[2][l]*alpha_vdim[167][l]+f[6][l]*alpha_vdim[165][l]+f[5][l]*alpha_vdim[164][l])+0.3872983346207416*f[11][l]*alpha_vdim[163][l]+0.4330127018922193*(f[0][l]*alpha_vdim[163][l]+f[1][l]*alpha_vdim[162][l]+alpha_cdim[2][l]*f[9][l]+alpha_cdim[0][l]*f[4][l]);
+    out[9][l] += 0.4330127018922193*f[32][l]*alpha_vdim[183][l]+0.3872983346207416*f[44][l]*alpha_vdim[181][l]+0.4330127018922193*(f[11][l]*alpha_vdim[181][l]+f[19][l]*alpha_vdim[173][l]+f[15][l]*alpha_vdim[168][l])+0.3872983346207416*f[20][l]*alpha_vdim[167][l]+0.4330127018922193*(f[1][l]*alpha_vdim[167][l]+f[7][l]*alpha_vdim[165][l])+0.3872983346207416*f[12][l]*alpha_vdim[164][l]+0.4330127018922193*(f[0][l]*alpha_vdim[164][l]+f[5][l]*alpha_vdim[163][l]+f[2][l]*alpha_vdim[162][l])+0.3872983346207416*alpha_vdim[25][l]*f[47][l]+0.4330127018922193*alpha_vdim[21][l]*f[37][l]+0.3872983346207416*alpha_vdim[8][l]*f[28][l]+0.4330127018922193*(alpha_vdim[11][l]*f[25][l]+f[11][l]*alpha_vdim[25][l]+alpha_vdim[6][l]*f[17][l])+0.3872983346207416*alpha_vdim[4][l]*f[14][l]+0.4330127018922193*(alpha_vdim[3][l]*f[10][l]+alpha_vdim[1][l]*f[8][l]+f[1][l]*alpha_vdim[8][l]+alpha_vdim[0][l]*f[4][l]+f[0][l]*alpha_vdim[4][l]);
+    out[10][l] += 0.3872983346207416*f[45][l]*alpha_vdim[183][l]+0.4330127018922193*(f[11][l]*alpha_vdim[183][l]+f[32][l]*alpha_vdim[181][l]+f[21][l]*alpha_vdim[173][l])+0.3872983346207416*f[23][l]*alpha_vdim[168][l]+0.4330127018922193*(f[1][l]*alpha_vdim[168][l]+f[15][l]*alpha_vdim[167][l])+0.3872983346207416*f[13][l]*alpha_vdim[165][l]+0.4330127018922193*(f[0][l]*alpha_vdim[165][l]+f[7][l]*alpha_vdim[164][l]+f[6][l]*alpha_vdim[163][l]+f[3][l]*alpha_vdim[162][l])+0.3872983346207416*f[47][l]*alpha_vdim[106][l]+0.4330127018922193*(f[11][l]*alpha_vdim[106][l]+f[35][l]*alpha_vdim[100][l]+f[25][l]*alpha_vdim[92][l])+0.3872983346207416*f[28][l]*alpha_vdim[89][l]+0.4330127018922193*(f[1][l]*alpha_vdim[89][l]+f[16][l]*alpha_vdim[86][l])+0.3872983346207416*f[14][l]*alpha_vdim[85][l]+0.4330127018922193*(f[0][l]*alpha_vdim[85][l]+f[9][l]*alpha_vdim[83][l]+f[8][l]*alpha_vdim[82][l]+f[4][l]*alpha_vdim[81][l]);
+    out[11][l] += 0.9682458365518543*(alpha_cdim[2][l]*f[5][l]+alpha_cdim[0][l]*f[1][l]);
+    out[12][l] += 0.9682458365518543*(alpha_vdim[25][l]*f[35][l]+alpha_vdim[21][l]*f[32][l]+alpha_vdim[11][l]*f[19][l]+alpha_vdim[8][l]*f[16][l]+alpha_vdim[6][l]*f[15][l]+alpha_vdim[4][l]*f[9][l]+alpha_vdim[3][l]*f[7][l]+alpha_vdim[1][l]*f[5][l]+alpha_vdim[0][l]*f[2][l]);
+    out[13][l] += 0.9682458365518543*(f[37][l]*alpha_vdim[106][l]+f[32][l]*alpha_vdim[100][l]+f[21][l]*alpha_vdim[92][l]+f[17][l]*alpha_vdim[89][l]+f[15][l]*alpha_vdim[86][l]+f[10][l]*alpha_vdim[85][l]+f[7][l]*alpha_vdim[83][l]+f[6][l]*alpha_vdim[82][l]+f[3][l]*alpha_vdim[81][l]);
+    out[14][l] += 0.9682458365518543*(f[37][l]*alpha_vdim[183][l]+f[35][l]*alpha_vdim[181][l]+f[25][l]*alpha_vdim[173][l]+f[17][l]*alpha_vdim[168][l]+f[16][l]*alpha_vdim[167][l]+f[10][l]*alpha_vdim[165][l]+f[9][l]*alpha_vdim[164][l]+f[8][l]*alpha_vdim[163][l]+f[4][l]*alpha_vdim[162][l]);
+    out[15][l] += 0.3872983346207416*f[16][l]*alpha_vdim[106][l]+0.3464101615137755*f[20][l]*alpha_vdim[100][l]+0.3872983346207416*(f[1][l]*alpha_vdim[100][l]+f[5][l]*alpha_vdim[92][l])+(0.3872983346207416*f[35][l]+0.4330127018922193*f[9][l])*alpha_vdim[89][l]+(0.3464101615137755*f[44][l]+0.3872983346207416*(f[12][l]+f[11][l]))*alpha_vdim[86][l]+0.4330127018922193*(f[0][l]*alpha_vdim[86][l]+f[16][l]*alpha_vdim[85][l])+(0.3872983346207416*f[20][l]+0.4330127018922193*f[1][l])*alpha_vdim[83][l]+0.3872983346207416*f[19][l]*alpha_vdim[82][l]+0.4330127018922193*(f[2][l]*alpha_vdim[82][l]+f[5][l]*alpha_vdim[81][l])+0.3464101615137755*alpha_vdim[6][l]*f[45][l]+0.3872983346207416*(alpha_vdim[8][l]*f[37][l]+f[17][l]*alpha_vdim[25][l])+0.3464101615137755*alpha_vdim[21][l]*f[23][l]+0.3872983346207416*(alpha_vdim[3][l]*f[23][l]+alpha_cdim[2][l]*f[22][l]+alpha_vdim[1][l]*f[21][l]+f[1][l]*alpha_vdim[21][l])+0.4330127018922193*alpha_vdim[4][l]*f[17][l]+0.3872983346207416*(alpha_vdim[6][l]*(f[13][l]+f[11][l])+f[6][l]*alpha_vdim[11][l])+0.4330127018922193*(alpha_vdim[8][l]*f[10][l]+alpha_cdim[0][l]*f[7][l]+alpha_vdim[0][l]*f[6][l]+f[0][l]*alpha_vdim[6][l]+(alpha_cdim[2][l]+alpha_vdim[1][l])*f[3][l]+f[1][l]*alpha_vdim[3][l]);
+    out[16][l] += 0.3872983346207416*f[15][l]*alpha_vdim[183][l]+0.3464101615137755*f[20][l]*alpha_vdim[181][l]+0.3872983346207416*(f[1][l]*alpha_vdim[181][l]+f[5][l]*alpha_vdim[173][l])+(0.3872983346207416*f[32][l]+0.4330127018922193*f[7][l])*alpha_vdim[168][l]+(0.3464101615137755*f[44][l]+0.3872983346207416*(f[12][l]+f[11][l]))*alpha_vdim[167][l]+0.4330127018922193*(f[0][l]*alpha_vdim[167][l]+f[15][l]*alpha_vdim[165][l])+(0.3872983346207416*f[20][l]+0.4330127018922193*f[1][l])*alpha_vdim[164][l]+0.3872983346207416*f[19][l]*alpha_vdim[163][l]+0.4330127018922193*(f[2][l]*alpha_vdim[163][l]+f[5][l]*alpha_vdim[162][l])+0.3464101615137755*alpha_vdim[8][l]*f[47][l]+0.3872983346207416*alpha_vdim[6][l]*f[37][l]+0.3464101615137755*alpha_vdim[25][l]*f[28][l]+0.3872983346207416*(alpha_vdim[4][l]*f[28][l]+alpha_cdim[2][l]*f[26][l]+alpha_vdim[1][l]*f[25][l]+f[1][l]*alpha_vdim[25][l])+f[17][l]*(0.3872983346207416*alpha_vdim[21][l]+0.4330127018922193*alpha_vdim[3][l])+0.3872983346207416*(alpha_vdim[8][l]*(f[14][l]+f[11][l])+f[8][l]*alpha_vdim[11][l])+0.4330127018922193*(alpha_vdim[6][l]*f[10][l]+alpha_cdim[0][l]*f[9][l]+alpha_vdim[0][l]*f[8][l]+f[0][l]*alpha_vdim[8][l]+(alpha_cdim[2][l]+alpha_vdim[1][l])*f[4][l]+f[1][l]*alpha_vdim[4][l]);
+    out[17][l] += 0.3464101615137755*f[23][l]*alpha_vdim[183][l]+0.3872983346207416*(f[1][l]*alpha_vdim[183][l]+f[15][l]*alpha_vdim[181][l]+f[6][l]*alpha_vdim[173][l])+(0.3464101615137755*f[45][l]+0.3872983346207416*(f[13][l]+f[11][l])+0.4330127018922193*f[0][l])*alpha_vdim[168][l]+(0.3872983346207416*f[32][l]+0.4330127018922193*f[7][l])*alpha_vdim[167][l]+0.3872983346207416*f[23][l]*alpha_vdim[165][l]+0.4330127018922193*(f[1][l]*alpha_vdim[165][l]+f[15][l]*alpha_vdim[164][l])+0.3872983346207416*f[21][l]*alpha_vdim[163][l]+0.4330127018922193*(f[3][l]*alpha_vdim[163][l]+f[6][l]*alpha_vdim[162][l])+0.3464101615137755*f[28][l]*alpha_vdim[106][l]+0.3872983346207416*(f[1][l]*alpha_vdim[106][l]+f[16][l]*alpha_vdim[100][l]+f[8][l]*alpha_vdim[92][l])+(0.3464101615137755*f[47][l]+0.3872983346207416*(f[14][l]+f[11][l])+0.4330127018922193*f[0][l])*alpha_vdim[89][l]+(0.3872983346207416*f[35][l]+0.4330127018922193*f[9][l])*alpha_vdim[86][l]+0.3872983346207416*f[28][l]*alpha_vdim[85][l]+0.4330127018922193*(f[1][l]*alpha_vdim[85][l]+f[16][l]*alpha_vdim[83][l])+0.3872983346207416*f[25][l]*alpha_vdim[82][l]+0.4330127018922193*(f[4][l]*alpha_vdim[82][l]+f[8][l]*alpha_vdim[81][l]+alpha_cdim[2][l]*f[18][l]+alpha_cdim[0][l]*f[10][l]);
+    out[18][l] += (0.3872983346207416*f[55][l]+0.4330127018922193*f[19][l])*alpha_vdim[183][l]+0.3872983346207416*f[54][l]*alpha_vdim[181][l]+0.4330127018922193*(f[21][l]*alpha_vdim[181][l]+f[32][l]*alpha_vdim[173][l])+(0.3872983346207416*f[34][l]+0.4330127018922193*f[5][l])*alpha_vdim[168][l]+(0.3872983346207416*f[33][l]+0.4330127018922193*f[6][l])*alpha_vdim[167][l]+(0.3872983346207416*f[24][l]+0.4330127018922193*f[2][l])*alpha_vdim[165][l]+0.3872983346207416*f[22][l]*alpha_vdim[164][l]+0.4330127018922193*(f[3][l]*alpha_vdim[164][l]+f[15][l]*alpha_vdim[163][l]+f[7][l]*alpha_vdim[162][l])+(0.3872983346207416*f[60][l]+0.4330127018922193*f[19][l])*alpha_vdim[106][l]+0.3872983346207416*f[57][l]*alpha_vdim[100][l]+0.4330127018922193*(f[25][l]*alpha_vdim[100][l]+f[35][l]*alpha_vdim[92][l])+(0.3872983346207416*f[41][l]+0.4330127018922193*f[5][l])*alpha_vdim[89][l]+(0.3872983346207416*f[36][l]+0.4330127018922193*f[8][l])*alpha_vdim[86][l]+(0.3872983346207416*f[29][l]+0.4330127018922193*f[2][l])*alpha_vdim[85][l]+0.3872983346207416*f[26][l]*alpha_vdim[83][l]+0.4330127018922193*(f[4][l]*alpha_vdim[83][l]+f[16][l]*alpha_vdim[82][l]+f[9][l]*alpha_vdim[81][l])+0.3872983346207416*(alpha_vdim[25][l]*f[62][l]+alpha_vdim[21][l]*f[58][l]+alpha_vdim[8][l]*f[42][l]+alpha_vdim[6][l]*f[39][l])+0.4330127018922193*alpha_vdim[11][l]*f[37][l]+0.3872983346207416*(alpha_vdim[4][l]*f[30][l]+alpha_vdim[3][l]*f[27][l])+0.4330127018922193*(alpha_vdim[21][l]*f[25][l]+f[21][l]*alpha_vdim[25][l]+alpha_vdim[1][l]*f[17][l]+alpha_vdim[0][l]*f[10][l]+alpha_vdim[6][l]*f[8][l]+f[6][l]*alpha_vdim[8][l]+alpha_vdim[3][l]*f[4][l]+f[3][l]*alpha_vdim[4][l]);
+    out[19][l] += 0.276641667586244*alpha_vdim[25][l]*f[25][l]+0.4330127018922193*(alpha_vdim[4][l]*f[25][l]+f[4][l]*alpha_vdim[25][l])+0.276641667586244*alpha_vdim[21][l]*f[21][l]+0.4330127018922193*(alpha_vdim[3][l]*f[21][l]+f[3][l]*alpha_vdim[21][l])+0.8660254037844386*alpha_cdim[2][l]*f[20][l]+0.276641667586244*alpha_vdim[11][l]*f[11][l]+0.4330127018922193*(alpha_vdim[0][l]*f[11][l]+f[0][l]*alpha_vdim[11][l])+0.3872983346207416*(alpha_vdim[8][l]*f[8][l]+alpha_vdim[6][l]*f[6][l])+0.9682458365518543*alpha_cdim[0][l]*f[5][l]+f[1][l]*(0.9682458365518543*alpha_cdim[2][l]+0.3872983346207416*alpha_vdim[1][l]);
+    out[20][l] += 0.8660254037844386*(alpha_vdim[8][l]*f[35][l]+alpha_vdim[6][l]*f[32][l]+f[16][l]*alpha_vdim[25][l]+f[15][l]*alpha_vdim[21][l]+alpha_vdim[1][l]*f[19][l])+0.9682458365518543*(alpha_vdim[4][l]*f[16][l]+alpha_vdim[3][l]*f[15][l])+0.4330127018922193*alpha_cdim[0][l]*f[12][l]+0.8660254037844386*f[5][l]*alpha_vdim[11][l]+0.9682458365518543*(alpha_vdim[8][l]*f[9][l]+alpha_vdim[6][l]*f[7][l]+alpha_vdim[0][l]*f[5][l])+(0.3872983346207416*alpha_cdim[2][l]+0.9682458365518543*alpha_vdim[1][l])*f[2][l];
+    out[21][l] += (0.276641667586244*f[25][l]+0.4330127018922193*f[4][l])*alpha_vdim[106][l]+(0.276641667586244*f[19][l]+0.4330127018922193*f[2][l])*alpha_vdim[100][l]+(0.276641667586244*f[11][l]+0.4330127018922193*f[0][l])*alpha_vdim[92][l]+0.3872983346207416*(f[8][l]*alpha_vdim[89][l]+f[5][l]*alpha_vdim[86][l])+0.4330127018922193*(f[25][l]*alpha_vdim[85][l]+f[19][l]*alpha_vdim[83][l])+0.3872983346207416*f[1][l]*alpha_vdim[82][l]+0.4330127018922193*f[11][l]*alpha_vdim[81][l]+0.9682458365518543*(alpha_cdim[2][l]*f[15][l]+alpha_cdim[0][l]*f[6][l]);
+    out[22][l] += 0.4330127018922193*f[57][l]*alpha_vdim[106][l]+0.3872983346207416*f[19][l]*alpha_vdim[100][l]+0.4330127018922193*(f[44][l]*alpha_vdim[92][l]+f[36][l]*alpha_vdim[89][l])+0.3872983346207416*f[5][l]*alpha_vdim[86][l]+0.4330127018922193*f[26][l]*alpha_vdim[85][l]+0.3872983346207416*f[2][l]*alpha_vdim[83][l]+0.4330127018922193*(f[20][l]*alpha_vdim[82][l]+f[12][l]*alpha_vdim[81][l])+0.8660254037844386*alpha_vdim[21][l]*f[55][l]+0.9682458365518543*alpha_vdim[25][l]*f[50][l]+0.8660254037844386*alpha_vdim[6][l]*f[34][l]+0.9682458365518543*(alpha_vdim[11][l]*f[32][l]+alpha_vdim[8][l]*f[31][l])+0.8660254037844386*alpha_vdim[3][l]*f[24][l]+0.9682458365518543*(f[19][l]*alpha_vdim[21][l]+alpha_vdim[4][l]*f[18][l]+alpha_vdim[1][l]*f[15][l]+alpha_vdim[0][l]*f[7][l]+f[5][l]*alpha_vdim[6][l]+f[2][l]*alpha_vdim[3][l]);
+    out[23][l] += 0.8660254037844386*(f[17][l]*alpha_vdim[106][l]+f[15][l]*alpha_vdim[100][l]+f[6][l]*alpha_vdim[92][l])+(0.8660254037844386*f[37][l]+0.9682458365518543*f[10][l])*alpha_vdim[89][l]+0.8660254037844386*f[32][l]*alpha_vdim[86][l]+0.9682458365518543*(f[7][l]*alpha_vdim[86][l]+f[17][l]*alpha_vdim[85][l]+f[15][l]*alpha_vdim[83][l])+0.8660254037844386*f[21][l]*alpha_vdim[82][l]+0.9682458365518543*(f[3][l]*alpha_vdim[82][l]+f[6][l]*alpha_vdim[81][l])+0.4330127018922193*(alpha_cdim[2][l]*f[24][l]+alpha_cdim[0][l]*f[13][l]);
+    out[24][l] += 0.9682458365518543*f[50][l]*alpha_vdim[106][l]+0.8660254037844386*f[54][l]*alpha_vdim[100][l]+0.9682458365518543*(f[21][l]*alpha_vdim[100][l]+f[32][l]*alpha_vdim[92][l]+f[31][l]*alpha_vdim[89][l])+0.8660254037844386*f[33][l]*alpha_vdim[86][l]+0.9682458365518543*(f[6][l]*alpha_vdim[86][l]+f[18][l]*alpha_vdim[85][l])+0.8660254037844386*f[22][l]*alpha_vdim[83][l]+0.9682458365518543*(f[3][l]*alpha_vdim[83][l]+f[15][l]*alpha_vdim[82][l]+f[7][l]*alpha_vdim[81][l])+0.4330127018922193*(alpha_vdim[25][l]*f[58][l]+alpha_vdim[11][l]*f[45][l]+alpha_vdim[8][l]*f[39][l]+alpha_vdim[4][l]*f[27][l]+alpha_vdim[1][l]*f[23][l])+0.3872983346207416*alpha_vdim[21][l]*f[21][l]+0.4330127018922193*alpha_vdim[0][l]*f[13][l]+0.3872983346207416*(alpha_vdim[6][l]*f[6][l]+alpha_vdim[3][l]*f[3][l]);
+    out[25][l] += (0.276641667586244*f[21][l]+0.4330127018922193*f[3][l])*alpha_vdim[183][l]+(0.276641667586244*f[19][l]+0.4330127018922193*f[2][l])*alpha_vdim[181][l]+(0.276641667586244*f[11][l]+0.4330127018922193*f[0][l])*alpha_vdim[173][l]+0.3872983346207416*(f[6][l]*alpha_vdim[168][l]+f[5][l]*alpha_vdim[167][l])+0.4330127018922193*(f[21][l]*alpha_vdim[165][l]+f[19][l]*alpha_vdim[164][l])+0.3872983346207416*f[1][l]*alpha_vdim[163][l]+0.4330127018922193*f[11][l]*alpha_vdim[162][l]+0.9682458365518543*(alpha_cdim[2][l]*f[16][l]+alpha_cdim[0][l]*f[8][l]);
+    out[26][l] += 0.4330127018922193*f[54][l]*alpha_vdim[183][l]+0.3872983346207416*f[19][l]*alpha_vdim[181][l]+0.4330127018922193*(f[44][l]*alpha_vdim[173][l]+f[33][l]*alpha_vdim[168][l])+0.3872983346207416*f[5][l]*alpha_vdim[167][l]+0.4330127018922193*f[22][l]*alpha_vdim[165][l]+0.3872983346207416*f[2][l]*alpha_vdim[164][l]+0.4330127018922193*(f[20][l]*alpha_vdim[163][l]+f[12][l]*alpha_vdim[162][l])+0.8660254037844386*alpha_vdim[25][l]*f[60][l]+0.9682458365518543*alpha_vdim[21][l]*f[50][l]+0.8660254037844386*alpha_vdim[8][l]*f[41][l]+0.9682458365518543*(alpha_vdim[11][l]*f[35][l]+alpha_vdim[6][l]*f[31][l])+0.8660254037844386*alpha_vdim[4][l]*f[29][l]+0.9682458365518543*(f[19][l]*alpha_vdim[25][l]+alpha_vdim[3][l]*f[18][l]+alpha_vdim[1][l]*f[16][l]+alpha_vdim[0][l]*f[9][l]+f[5][l]*alpha_vdim[8][l]+f[2][l]*alpha_vdim[4][l]);
+    out[27][l] += 0.3872983346207416*f[21][l]*alpha_vdim[183][l]+0.4330127018922193*(f[55][l]*alpha_vdim[181][l]+f[45][l]*alpha_vdim[173][l])+0.3872983346207416*f[6][l]*alpha_vdim[168][l]+0.4330127018922193*f[34][l]*alpha_vdim[167][l]+0.3872983346207416*f[3][l]*alpha_vdim[165][l]+0.4330127018922193*(f[24][l]*alpha_vdim[164][l]+f[23][l]*alpha_vdim[163][l]+f[13][l]*alpha_vdim[162][l])+0.8660254037844386*f[62][l]*alpha_vdim[106][l]+0.9682458365518543*(f[21][l]*alpha_vdim[106][l]+f[50][l]*alpha_vdim[100][l]+f[37][l]*alpha_vdim[92][l])+0.8660254037844386*f[42][l]*alpha_vdim[89][l]+0.9682458365518543*(f[6][l]*alpha_vdim[89][l]+f[31][l]*alpha_vdim[86][l])+0.8660254037844386*f[30][l]*alpha_vdim[85][l]+0.9682458365518543*(f[3][l]*alpha_vdim[85][l]+f[18][l]*alpha_vdim[83][l]+f[17][l]*alpha_vdim[82][l]+f[10][l]*alpha_vdim[81][l]);
+    out[28][l] += 0.8660254037844386*(f[17][l]*alpha_vdim[183][l]+f[16][l]*alpha_vdim[181][l]+f[8][l]*alpha_vdim[173][l])+(0.8660254037844386*f[37][l]+0.9682458365518543*f[10][l])*alpha_vdim[168][l]+0.8660254037844386*f[35][l]*alpha_vdim[167][l]+0.9682458365518543*(f[9][l]*alpha_vdim[167][l]+f[17][l]*alpha_vdim[165][l]+f[16][l]*alpha_vdim[164][l])+0.8660254037844386*f[25][l]*alpha_vdim[163][l]+0.9682458365518543*(f[4][l]*alpha_vdim[163][l]+f[8][l]*alpha_vdim[162][l])+0.4330127018922193*(alpha_cdim[2][l]*f[29][l]+alpha_cdim[0][l]*f[14][l]);
+    out[29][l] += 0.9682458365518543*f[50][l]*alpha_vdim[183][l]+0.8660254037844386*f[57][l]*alpha_vdim[181][l]+0.9682458365518543*(f[25][l]*alpha_vdim[181][l]+f[35][l]*alpha_vdim[173][l]+f[31][l]*alpha_vdim[168][l])+0.8660254037844386*f[36][l]*alpha_vdim[167][l]+0.9682458365518543*(f[8][l]*alpha_vdim[167][l]+f[18][l]*alpha_vdim[165][l])+0.8660254037844386*f[26][l]*alpha_vdim[164][l]+0.9682458365518543*(f[4][l]*alpha_vdim[164][l]+f[16][l]*alpha_vdim[163][l]+f[9][l]*alpha_vdim[162][l])+0.4330127018922193*(alpha_vdim[21][l]*f[62][l]+alpha_vdim[11][l]*f[47][l]+alpha_vdim[6][l]*f[42][l]+alpha_vdim[3][l]*f[30][l]+alpha_vdim[1][l]*f[28][l])+0.3872983346207416*alpha_vdim[25][l]*f[25][l]+0.4330127018922193*alpha_vdim[0][l]*f[14][l]+0.3872983346207416*(alpha_vdim[8][l]*f[8][l]+alpha_vdim[4][l]*f[4][l]);
+    out[30][l] += 0.8660254037844386*f[58][l]*alpha_vdim[183][l]+0.9682458365518543*(f[25][l]*alpha_vdim[183][l]+f[50][l]*alpha_vdim[181][l]+f[37][l]*alpha_vdim[173][l])+0.8660254037844386*f[39][l]*alpha_vdim[168][l]+0.9682458365518543*(f[8][l]*alpha_vdim[168][l]+f[31][l]*alpha_vdim[167][l])+0.8660254037844386*f[27][l]*alpha_vdim[165][l]+0.9682458365518543*(f[4][l]*alpha_vdim[165][l]+f[18][l]*alpha_vdim[164][l]+f[17][l]*alpha_vdim[163][l]+f[10][l]*alpha_vdim[162][l])+0.3872983346207416*f[25][l]*alpha_vdim[106][l]+0.4330127018922193*(f[60][l]*alpha_vdim[100][l]+f[47][l]*alpha_vdim[92][l])+0.3872983346207416*f[8][l]*alpha_vdim[89][l]+0.4330127018922193*f[41][l]*alpha_vdim[86][l]+0.3872983346207416*f[4][l]*alpha_vdim[85][l]+0.4330127018922193*(f[29][l]*alpha_vdim[83][l]+f[28][l]*alpha_vdim[82][l]+f[14][l]*alpha_vdim[81][l]);
+    out[31][l] += (0.3464101615137755*f[34][l]+0.3872983346207416*f[5][l])*alpha_vdim[183][l]+0.3464101615137755*f[33][l]*alpha_vdim[181][l]+0.3872983346207416*(f[6][l]*alpha_vdim[181][l]+f[15][l]*alpha_vdim[173][l])+(0.3464101615137755*f[55][l]+0.3872983346207416*(f[24][l]+f[19][l])+0.4330127018922193*f[2][l])*alpha_vdim[168][l]+(0.3464101615137755*f[54][l]+0.3872983346207416*(f[22][l]+f[21][l])+0.4330127018922193*f[3][l])*alpha_vdim[167][l]+(0.3872983346207416*f[34][l]+0.4330127018922193*f[5][l])*alpha_vdim[165][l]+(0.3872983346207416*f[33][l]+0.4330127018922193*f[6][l])*alpha_vdim[164][l]+0.3872983346207416*f[32][l]*alpha_vdim[163][l]+0.4330127018922193*(f[7][l]*alpha_vdim[163][l]+f[15][l]*alpha_vdim[162][l])+(0.3464101615137755*f[41][l]+0.3872983346207416*f[5][l])*alpha_vdim[106][l]+0.3464101615137755*f[36][l]*alpha_vdim[100][l]+0.3872983346207416*(f[8][l]*alpha_vdim[100][l]+f[16][l]*alpha_vdim[92][l])+(0.3464101615137755*f[60][l]+0.3872983346207416*(f[29][l]+f[19][l])+0.4330127018922193*f[2][l])*alpha_vdim[89][l]+(0.3464101615137755*f[57][l]+0.3872983346207416*(f[26][l]+f[25][l])+0.4330127018922193*f[4][l])*alpha_vdim[86][l]+(0.3872983346207416*f[41][l]+0.4330127018922193*f[5][l])*alpha_vdim[85][l]+(0.3872983346207416*f[36][l]+0.4330127018922193*f[8][l])*alpha_vdim[83][l]+0.3872983346207416*f[35][l]*alpha_vdim[82][l]+0.4330127018922193*(f[9][l]*alpha_vdim[82][l]+f[16][l]*alpha_vdim[81][l])+0.3464101615137755*(alpha_vdim[8][l]*f[62][l]+alpha_vdim[6][l]*f[58][l])+(0.3464101615137755*alpha_vdim[25][l]+0.3872983346207416*alpha_vdim[4][l])*f[42][l]+0.3464101615137755*alpha_vdim[21][l]*f[39][l]+0.3872983346207416*(alpha_vdim[3][l]*f[39][l]+alpha_cdim[2][l]*f[38][l]+alpha_vdim[1][l]*f[37][l]+alpha_vdim[8][l]*f[30][l]+alpha_vdim[6][l]*(f[27][l]+f[25][l])+f[6][l]*alpha_vdim[25][l]+alpha_vdim[8][l]*f[21][l]+f[8][l]*alpha_vdim[21][l])+0.4330127018922193*alpha_cdim[0][l]*f[18][l]+0.3872983346207416*alpha_vdim[11][l]*f[17][l]+0.4330127018922193*(alpha_vdim[0][l]*f[17][l]+(alpha_cdim[2][l]+alpha_vdim[1][l])*f[10][l]+alpha_vdim[3][l]*f[8][l]+f[3][l]*alpha_vdim[8][l]+alpha_vdim[4][l]*f[6][l]+f[4][l]*alpha_vdim[6][l]);
+    out[32][l] += (0.276641667586244*f[35][l]+0.4330127018922193*f[9][l])*alpha_vdim[106][l]+(0.2474358296526967*f[44][l]+0.3872983346207416*f[12][l]+0.276641667586244*f[11][l]+0.4330127018922193*f[0][l])*alpha_vdim[100][l]+(0.276641667586244*f[19][l]+0.4330127018922193*f[2][l])*alpha_vdim[92][l]+0.3872983346207416*f[16][l]*alpha_vdim[89][l]+(0.3464101615137755*f[20][l]+0.3872983346207416*f[1][l])*alpha_vdim[86][l]+0.4330127018922193*f[35][l]*alpha_vdim[85][l]+(0.3872983346207416*f[44][l]+0.4330127018922193*f[11][l])*alpha_vdim[83][l]+0.3872983346207416*f[5][l]*alpha_vdim[82][l]+0.4330127018922193*f[19][l]*alpha_vdim[81][l]+(0.2474358296526967*alpha_vdim[21][l]+0.3872983346207416*alpha_vdim[3][l])*f[45][l]+(0.276641667586244*alpha_vdim[25][l]+0.4330127018922193*alpha_vdim[4][l])*f[37][l]+0.8660254037844386*alpha_cdim[2][l]*f[33][l]+0.4330127018922193*f[10][l]*alpha_vdim[25][l]+0.3464101615137755*alpha_vdim[6][l]*f[23][l]+(0.276641667586244*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[21][l]+(0.3872983346207416*f[13][l]+0.276641667586244*f[11][l]+0.4330127018922193*f[0][l])*alpha_vdim[21][l]+0.3872983346207416*alpha_vdim[8][l]*f[17][l]+0.9682458365518543*alpha_cdim[0][l]*f[15][l]+0.4330127018922193*(alpha_vdim[3][l]*f[11][l]+f[3][l]*alpha_vdim[11][l])+0.9682458365518543*alpha_cdim[2][l]*f[6][l]+0.3872983346207416*(alpha_vdim[1][l]*f[6][l]+f[1][l]*alpha_vdim[6][l]);
+    out[33][l] += 0.3872983346207416*f[36][l]*alpha_vdim[106][l]+0.3464101615137755*f[5][l]*alpha_vdim[100][l]+0.3872983346207416*f[20][l]*alpha_vdim[92][l]+(0.3872983346207416*f[57][l]+0.4330127018922193*f[26][l])*alpha_vdim[89][l]+(0.3464101615137755*f[19][l]+0.3872983346207416*f[2][l])*alpha_vdim[86][l]+0.4330127018922193*f[36][l]*alpha_vdim[85][l]+0.3872983346207416*(f[5][l]*alpha_vdim[83][l]+f[44][l]*alpha_vdim[82][l])+0.4330127018922193*(f[12][l]*alpha_vdim[82][l]+f[20][l]*alpha_vdim[81][l])+0.7745966692414833*alpha_vdim[6][l]*f[55][l]+0.8660254037844386*alpha_vdim[8][l]*f[50][l]+0.7745966692414833*alpha_vdim[21][l]*f[34][l]+0.8660254037844386*(alpha_vdim[3][l]*f[34][l]+alpha_vdim[1][l]*f[32][l])+(0.8660254037844386*alpha_vdim[25][l]+0.9682458365518543*alpha_vdim[4][l])*f[31][l]+0.8660254037844386*alpha_vdim[6][l]*f[24][l]+0.4330127018922193*alpha_cdim[0][l]*f[22][l]+0.8660254037844386*(f[5][l]*alpha_vdim[21][l]+alpha_vdim[6][l]*f[19][l])+0.9682458365518543*alpha_vdim[8][l]*f[18][l]+(0.8660254037844386*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[15][l]+0.3872983346207416*alpha_cdim[2][l]*f[7][l]+0.9682458365518543*(alpha_vdim[1][l]*f[7][l]+f[2][l]*alpha_vdim[6][l]+alpha_vdim[3][l]*f[5][l]);
+    out[34][l] += 0.8660254037844386*f[31][l]*alpha_vdim[106][l]+0.7745966692414833*f[33][l]*alpha_vdim[100][l]+0.8660254037844386*(f[6][l]*alpha_vdim[100][l]+f[15][l]*alpha_vdim[92][l])+(0.8660254037844386*f[50][l]+0.9682458365518543*f[18][l])*alpha_vdim[89][l]+(0.7745966692414833*f[54][l]+0.8660254037844386*(f[22][l]+f[21][l]))*alpha_vdim[86][l]+0.9682458365518543*(f[3][l]*alpha_vdim[86][l]+f[31][l]*alpha_vdim[85][l])+(0.8660254037844386*f[33][l]+0.9682458365518543*f[6][l])*alpha_vdim[83][l]+0.8660254037844386*f[32][l]*alpha_vdim[82][l]+0.9682458365518543*(f[7][l]*alpha_vdim[82][l]+f[15][l]*alpha_vdim[81][l])+0.3872983346207416*(alpha_vdim[8][l]*f[58][l]+alpha_cdim[2][l]*f[46][l]+alpha_vdim[1][l]*f[45][l]+alpha_vdim[25][l]*f[39][l])+0.4330127018922193*(alpha_vdim[4][l]*f[39][l]+alpha_vdim[8][l]*f[27][l]+alpha_cdim[0][l]*f[24][l])+(0.3872983346207416*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[23][l]+0.3464101615137755*(alpha_vdim[6][l]*f[21][l]+f[6][l]*alpha_vdim[21][l])+0.4330127018922193*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[13][l]+0.3872983346207416*(alpha_vdim[3][l]*f[6][l]+f[3][l]*alpha_vdim[6][l]);
+    out[35][l] += (0.276641667586244*f[32][l]+0.4330127018922193*f[7][l])*alpha_vdim[183][l]+(0.2474358296526967*f[44][l]+0.3872983346207416*f[12][l]+0.276641667586244*f[11][l]+0.4330127018922193*f[0][l])*alpha_vdim[181][l]+(0.276641667586244*f[19][l]+0.4330127018922193*f[2][l])*alpha_vdim[173][l]+0.3872983346207416*f[15][l]*alpha_vdim[168][l]+(0.3464101615137755*f[20][l]+0.3872983346207416*f[1][l])*alpha_vdim[167][l]+0.4330127018922193*f[32][l]*alpha_vdim[165][l]+(0.3872983346207416*f[44][l]+0.4330127018922193*f[11][l])*alpha_vdim[164][l]+0.3872983346207416*f[5][l]*alpha_vdim[163][l]+0.4330127018922193*f[19][l]*alpha_vdim[162][l]+(0.2474358296526967*alpha_vdim[25][l]+0.3872983346207416*alpha_vdim[4][l])*f[47][l]+(0.276641667586244*alpha_vdim[21][l]+0.4330127018922193*alpha_vdim[3][l])*f[37][l]+0.8660254037844386*alpha_cdim[2][l]*f[36][l]+0.3464101615137755*alpha_vdim[8][l]*f[28][l]+(0.276641667586244*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[25][l]+(0.3872983346207416*f[14][l]+0.276641667586244*f[11][l])*alpha_vdim[25][l]+0.4330127018922193*(f[0][l]*alpha_vdim[25][l]+f[10][l]*alpha_vdim[21][l])+0.3872983346207416*alpha_vdim[6][l]*f[17][l]+0.9682458365518543*alpha_cdim[0][l]*f[16][l]+0.4330127018922193*(alpha_vdim[4][l]*f[11][l]+f[4][l]*alpha_vdim[11][l])+0.9682458365518543*alpha_cdim[2][l]*f[8][l]+0.3872983346207416*(alpha_vdim[1][l]*f[8][l]+f[1][l]*alpha_vdim[8][l]);
+    out[36][l] += 0.3872983346207416*f[33][l]*alpha_vdim[183][l]+0.3464101615137755*f[5][l]*alpha_vdim[181][l]+0.3872983346207416*f[20][l]*alpha_vdim[173][l]+(0.3872983346207416*f[54][l]+0.4330127018922193*f[22][l])*alpha_vdim[168][l]+(0.3464101615137755*f[19][l]+0.3872983346207416*f[2][l])*alpha_vdim[167][l]+0.4330127018922193*f[33][l]*alpha_vdim[165][l]+0.3872983346207416*(f[5][l]*alpha_vdim[164][l]+f[44][l]*alpha_vdim[163][l])+0.4330127018922193*(f[12][l]*alpha_vdim[163][l]+f[20][l]*alpha_vdim[162][l])+0.7745966692414833*alpha_vdim[8][l]*f[60][l]+0.8660254037844386*alpha_vdim[6][l]*f[50][l]+0.7745966692414833*alpha_vdim[25][l]*f[41][l]+0.8660254037844386*(alpha_vdim[4][l]*f[41][l]+alpha_vdim[1][l]*f[35][l])+(0.8660254037844386*alpha_vdim[21][l]+0.9682458365518543*alpha_vdim[3][l])*f[31][l]+0.8660254037844386*alpha_vdim[8][l]*f[29][l]+0.4330127018922193*alpha_cdim[0][l]*f[26][l]+0.8660254037844386*(f[5][l]*alpha_vdim[25][l]+alpha_vdim[8][l]*f[19][l])+0.9682458365518543*alpha_vdim[6][l]*f[18][l]+(0.8660254037844386*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[16][l]+0.3872983346207416*alpha_cdim[2][l]*f[9][l]+0.9682458365518543*(alpha_vdim[1][l]*f[9][l]+f[2][l]*alpha_vdim[8][l]+alpha_vdim[4][l]*f[5][l]);
+    out[37][l] += (0.2474358296526967*f[45][l]+0.3872983346207416*f[13][l]+0.276641667586244*f[11][l]+0.4330127018922193*f[0][l])*alpha_vdim[183][l]+(0.276641667586244*f[32][l]+0.4330127018922193*f[7][l])*alpha_vdim[181][l]+(0.276641667586244*f[21][l]+0.4330127018922193*f[3][l])*alpha_vdim[173][l]+0.3464101615137755*f[23][l]*alpha_vdim[168][l]+0.3872983346207416*(f[1][l]*alpha_vdim[168][l]+f[15][l]*alpha_vdim[167][l]+f[45][l]*alpha_vdim[165][l])+0.4330127018922193*(f[11][l]*alpha_vdim[165][l]+f[32][l]*alpha_vdim[164][l])+0.3872983346207416*f[6][l]*alpha_vdim[163][l]+0.4330127018922193*f[21][l]*alpha_vdim[162][l]+(0.2474358296526967*f[47][l]+0.3872983346207416*f[14][l]+0.276641667586244*f[11][l]+0.4330127018922193*f[0][l])*alpha_vdim[106][l]+(0.276641667586244*f[35][l]+0.4330127018922193*f[9][l])*alpha_vdim[100][l]+(0.276641667586244*f[25][l]+0.4330127018922193*f[4][l])*alpha_vdim[92][l]+0.3464101615137755*f[28][l]*alpha_vdim[89][l]+0.3872983346207416*(f[1][l]*alpha_vdim[89][l]+f[16][l]*alpha_vdim[86][l]+f[47][l]*alpha_vdim[85][l])+0.4330127018922193*(f[11][l]*alpha_vdim[85][l]+f[35][l]*alpha_vdim[83][l])+0.3872983346207416*f[8][l]*alpha_vdim[82][l]+0.4330127018922193*f[25][l]*alpha_vdim[81][l]+0.9682458365518543*(alpha_cdim[2][l]*f[31][l]+alpha_cdim[0][l]*f[17][l]);
+    out[38][l] += (0.3872983346207416*f[72][l]+0.4330127018922193*f[44][l])*alpha_vdim[183][l]+0.3872983346207416*f[32][l]*alpha_vdim[181][l]+0.4330127018922193*f[54][l]*alpha_vdim[173][l]+(0.3872983346207416*f[56][l]+0.4330127018922193*f[20][l])*alpha_vdim[168][l]+0.3872983346207416*f[15][l]*alpha_vdim[167][l]+(0.3872983346207416*f[46][l]+0.4330127018922193*f[12][l])*alpha_vdim[165][l]+0.3872983346207416*f[7][l]*alpha_vdim[164][l]+0.4330127018922193*(f[33][l]*alpha_vdim[163][l]+f[22][l]*alpha_vdim[162][l])+(0.3872983346207416*f[73][l]+0.4330127018922193*f[44][l])*alpha_vdim[106][l]+0.3872983346207416*f[35][l]*alpha_vdim[100][l]+0.4330127018922193*f[57][l]*alpha_vdim[92][l]+(0.3872983346207416*f[61][l]+0.4330127018922193*f[20][l])*alpha_vdim[89][l]+0.3872983346207416*f[16][l]*alpha_vdim[86][l]+(0.3872983346207416*f[48][l]+0.4330127018922193*f[12][l])*alpha_vdim[85][l]+0.3872983346207416*f[9][l]*alpha_vdim[83][l]+0.4330127018922193*(f[36][l]*alpha_vdim[82][l]+f[26][l]*alpha_vdim[81][l])+0.8660254037844386*(alpha_vdim[25][l]*f[69][l]+alpha_vdim[21][l]*f[67][l]+alpha_vdim[8][l]*f[53][l]+alpha_vdim[6][l]*f[52][l])+0.9682458365518543*alpha_vdim[11][l]*f[50][l]+0.8660254037844386*(alpha_vdim[4][l]*f[43][l]+alpha_vdim[3][l]*f[40][l])+0.9682458365518543*(alpha_vdim[21][l]*f[35][l]+alpha_vdim[25][l]*f[32][l]+alpha_vdim[1][l]*f[31][l]+alpha_vdim[0][l]*f[18][l]+alpha_vdim[6][l]*f[16][l]+alpha_vdim[8][l]*f[15][l]+alpha_vdim[3][l]*f[9][l]+alpha_vdim[4][l]*f[7][l]);
+    out[39][l] += 0.3464101615137755*f[6][l]*alpha_vdim[183][l]+0.3872983346207416*(f[34][l]*alpha_vdim[181][l]+f[23][l]*alpha_vdim[173][l])+(0.3464101615137755*f[21][l]+0.3872983346207416*f[3][l])*alpha_vdim[168][l]+(0.3872983346207416*f[55][l]+0.4330127018922193*f[24][l])*alpha_vdim[167][l]+0.3872983346207416*f[6][l]*alpha_vdim[165][l]+0.4330127018922193*f[34][l]*alpha_vdim[164][l]+0.3872983346207416*f[45][l]*alpha_vdim[163][l]+0.4330127018922193*(f[13][l]*alpha_vdim[163][l]+f[23][l]*alpha_vdim[162][l])+0.7745966692414833*f[42][l]*alpha_vdim[106][l]+0.8660254037844386*(f[6][l]*alpha_vdim[106][l]+f[31][l]*alpha_vdim[100][l]+f[17][l]*alpha_vdim[92][l])+(0.7745966692414833*f[62][l]+0.8660254037844386*(f[30][l]+f[21][l])+0.9682458365518543*f[3][l])*alpha_vdim[89][l]+(0.8660254037844386*f[50][l]+0.9682458365518543*f[18][l])*alpha_vdim[86][l]+0.8660254037844386*f[42][l]*alpha_vdim[85][l]+0.9682458365518543*(f[6][l]*alpha_vdim[85][l]+f[31][l]*alpha_vdim[83][l])+0.8660254037844386*f[37][l]*alpha_vdim[82][l]+0.9682458365518543*(f[10][l]*alpha_vdim[82][l]+f[17][l]*alpha_vdim[81][l])+0.4330127018922193*(alpha_cdim[2][l]*f[40][l]+alpha_cdim[0][l]*f[27][l]);
+    out[40][l] += 0.3872983346207416*(f[32][l]*alpha_vdim[183][l]+f[72][l]*alpha_vdim[181][l])+0.4330127018922193*(f[45][l]*alpha_vdim[181][l]+f[55][l]*alpha_vdim[173][l])+0.3872983346207416*f[15][l]*alpha_vdim[168][l]+(0.3872983346207416*f[56][l]+0.4330127018922193*f[23][l])*alpha_vdim[167][l]+0.3872983346207416*(f[7][l]*alpha_vdim[165][l]+f[46][l]*alpha_vdim[164][l])+0.4330127018922193*(f[13][l]*alpha_vdim[164][l]+f[34][l]*alpha_vdim[163][l]+f[24][l]*alpha_vdim[162][l])+(0.8660254037844386*f[69][l]+0.9682458365518543*f[32][l])*alpha_vdim[106][l]+0.8660254037844386*f[66][l]*alpha_vdim[100][l]+0.9682458365518543*(f[37][l]*alpha_vdim[100][l]+f[50][l]*alpha_vdim[92][l])+(0.8660254037844386*f[53][l]+0.9682458365518543*f[15][l])*alpha_vdim[89][l]+(0.8660254037844386*f[51][l]+0.9682458365518543*f[17][l])*alpha_vdim[86][l]+(0.8660254037844386*f[43][l]+0.9682458365518543*f[7][l])*alpha_vdim[85][l]+0.8660254037844386*f[38][l]*alpha_vdim[83][l]+0.9682458365518543*(f[10][l]*alpha_vdim[83][l]+f[31][l]*alpha_vdim[82][l]+f[18][l]*alpha_vdim[81][l])+0.3872983346207416*(alpha_vdim[25][l]*f[74][l]+alpha_vdim[8][l]*f[64][l])+0.4330127018922193*alpha_vdim[11][l]*f[58][l]+0.3872983346207416*alpha_vdim[4][l]*f[49][l]+0.4330127018922193*(alpha_vdim[25][l]*f[45][l]+alpha_vdim[1][l]*f[39][l])+0.3872983346207416*alpha_vdim[21][l]*f[37][l]+0.4330127018922193*(alpha_vdim[0][l]*f[27][l]+alpha_vdim[8][l]*f[23][l])+0.3872983346207416*alpha_vdim[6][l]*f[17][l]+0.4330127018922193*alpha_vdim[4][l]*f[13][l]+0.3872983346207416*alpha_vdim[3][l]*f[10][l];
+    out[41][l] += 0.8660254037844386*f[31][l]*alpha_vdim[183][l]+0.7745966692414833*f[36][l]*alpha_vdim[181][l]+0.8660254037844386*(f[8][l]*alpha_vdim[181][l]+f[16][l]*alpha_vdim[173][l])+(0.8660254037844386*f[50][l]+0.9682458365518543*f[18][l])*alpha_vdim[168][l]+(0.7745966692414833*f[57][l]+0.8660254037844386*(f[26][l]+f[25][l]))*alpha_vdim[167][l]+0.9682458365518543*(f[4][l]*alpha_vdim[167][l]+f[31][l]*alpha_vdim[165][l])+(0.8660254037844386*f[36][l]+0.9682458365518543*f[8][l])*alpha_vdim[164][l]+0.8660254037844386*f[35][l]*alpha_vdim[163][l]+0.9682458365518543*(f[9][l]*alpha_vdim[163][l]+f[16][l]*alpha_vdim[162][l])+0.3872983346207416*(alpha_vdim[6][l]*f[62][l]+alpha_cdim[2][l]*f[48][l]+alpha_vdim[1][l]*f[47][l]+alpha_vdim[21][l]*f[42][l])+0.4330127018922193*(alpha_vdim[3][l]*f[42][l]+alpha_vdim[6][l]*f[30][l]+alpha_cdim[0][l]*f[29][l])+(0.3872983346207416*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[28][l]+0.3464101615137755*(alpha_vdim[8][l]*f[25][l]+f[8][l]*alpha_vdim[25][l])+0.4330127018922193*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[14][l]+0.3872983346207416*(alpha_vdim[4][l]*f[8][l]+f[4][l]*alpha_vdim[8][l]);
+    out[42][l] += 0.7745966692414833*f[39][l]*alpha_vdim[183][l]+0.8660254037844386*(f[8][l]*alpha_vdim[183][l]+f[31][l]*alpha_vdim[181][l]+f[17][l]*alpha_vdim[173][l])+(0.7745966692414833*f[58][l]+0.8660254037844386*(f[27][l]+f[25][l])+0.9682458365518543*f[4][l])*alpha_vdim[168][l]+(0.8660254037844386*f[50][l]+0.9682458365518543*f[18][l])*alpha_vdim[167][l]+0.8660254037844386*f[39][l]*alpha_vdim[165][l]+0.9682458365518543*(f[8][l]*alpha_vdim[165][l]+f[31][l]*alpha_vdim[164][l])+0.8660254037844386*f[37][l]*alpha_vdim[163][l]+0.9682458365518543*(f[10][l]*alpha_vdim[163][l]+f[17][l]*alpha_vdim[162][l])+0.3464101615137755*f[8][l]*alpha_vdim[106][l]+0.3872983346207416*(f[41][l]*alpha_vdim[100][l]+f[28][l]*alpha_vdim[92][l])+(0.3464101615137755*f[25][l]+0.3872983346207416*f[4][l])*alpha_vdim[89][l]+(0.3872983346207416*f[60][l]+0.4330127018922193*f[29][l])*alpha_vdim[86][l]+0.3872983346207416*f[8][l]*alpha_vdim[85][l]+0.4330127018922193*f[41][l]*alpha_vdim[83][l]+0.3872983346207416*f[47][l]*alpha_vdim[82][l]+0.4330127018922193*(f[14][l]*alpha_vdim[82][l]+f[28][l]*alpha_vdim[81][l]+alpha_cdim[2][l]*f[43][l]+alpha_cdim[0][l]*f[30][l]);
+    out[43][l] += (0.8660254037844386*f[67][l]+0.9682458365518543*f[35][l])*alpha_vdim[183][l]+0.8660254037844386*f[66][l]*alpha_vdim[181][l]+0.9682458365518543*(f[37][l]*alpha_vdim[181][l]+f[50][l]*alpha_vdim[173][l])+(0.8660254037844386*f[52][l]+0.9682458365518543*f[16][l])*alpha_vdim[168][l]+(0.8660254037844386*f[51][l]+0.9682458365518543*f[17][l])*alpha_vdim[167][l]+(0.8660254037844386*f[40][l]+0.9682458365518543*f[9][l])*alpha_vdim[165][l]+0.8660254037844386*f[38][l]*alpha_vdim[164][l]+0.9682458365518543*(f[10][l]*alpha_vdim[164][l]+f[31][l]*alpha_vdim[163][l]+f[18][l]*alpha_vdim[162][l])+0.3872983346207416*(f[35][l]*alpha_vdim[106][l]+f[73][l]*alpha_vdim[100][l])+0.4330127018922193*(f[47][l]*alpha_vdim[100][l]+f[60][l]*alpha_vdim[92][l])+0.3872983346207416*f[16][l]*alpha_vdim[89][l]+(0.3872983346207416*f[61][l]+0.4330127018922193*f[28][l])*alpha_vdim[86][l]+0.3872983346207416*(f[9][l]*alpha_vdim[85][l]+f[48][l]*alpha_vdim[83][l])+0.4330127018922193*(f[14][l]*alpha_vdim[83][l]+f[41][l]*alpha_vdim[82][l]+f[29][l]*alpha_vdim[81][l])+0.3872983346207416*(alpha_vdim[21][l]*f[74][l]+alpha_vdim[6][l]*f[64][l])+0.4330127018922193*alpha_vdim[11][l]*f[62][l]+0.3872983346207416*alpha_vdim[3][l]*f[49][l]+0.4330127018922193*(alpha_vdim[21][l]*f[47][l]+alpha_vdim[1][l]*f[42][l])+0.3872983346207416*alpha_vdim[25][l]*f[37][l]+0.4330127018922193*(alpha_vdim[0][l]*f[30][l]+alpha_vdim[6][l]*f[28][l])+0.3872983346207416*alpha_vdim[8][l]*f[17][l]+0.4330127018922193*alpha_vdim[3][l]*f[14][l]+0.3872983346207416*alpha_vdim[4][l]*f[10][l];
+    out[44][l] += (0.6185895741317419*alpha_vdim[25][l]+0.9682458365518543*alpha_vdim[4][l])*f[35][l]+0.6185895741317419*alpha_vdim[21][l]*f[32][l]+0.9682458365518543*(alpha_vdim[3][l]*f[32][l]+f[9][l]*alpha_vdim[25][l]+f[7][l]*alpha_vdim[21][l]+alpha_cdim[0][l]*f[20][l])+(0.6185895741317419*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[19][l]+0.8660254037844386*(alpha_vdim[8][l]*f[16][l]+alpha_vdim[6][l]*f[15][l])+0.9682458365518543*f[2][l]*alpha_vdim[11][l]+0.8660254037844386*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[5][l];
+    out[45][l] += (0.6185895741317419*f[37][l]+0.9682458365518543*f[10][l])*alpha_vdim[106][l]+(0.6185895741317419*f[32][l]+0.9682458365518543*f[7][l])*alpha_vdim[100][l]+(0.6185895741317419*f[21][l]+0.9682458365518543*f[3][l])*alpha_vdim[92][l]+0.8660254037844386*(f[17][l]*alpha_vdim[89][l]+f[15][l]*alpha_vdim[86][l])+0.9682458365518543*(f[37][l]*alpha_vdim[85][l]+f[32][l]*alpha_vdim[83][l])+0.8660254037844386*f[6][l]*alpha_vdim[82][l]+0.9682458365518543*(f[21][l]*alpha_vdim[81][l]+alpha_cdim[2][l]*f[34][l]+alpha_cdim[0][l]*f[23][l]);
+    out[46][l] += 0.9682458365518543*f[66][l]*alpha_vdim[106][l]+0.8660254037844386*f[32][l]*alpha_vdim[100][l]+0.9682458365518543*(f[54][l]*alpha_vdim[92][l]+f[51][l]*alpha_vdim[89][l])+0.8660254037844386*f[15][l]*alpha_vdim[86][l]+0.9682458365518543*f[38][l]*alpha_vdim[85][l]+0.8660254037844386*f[7][l]*alpha_vdim[83][l]+0.9682458365518543*(f[33][l]*alpha_vdim[82][l]+f[22][l]*alpha_vdim[81][l]+alpha_vdim[25][l]*f[67][l]+alpha_vdim[11][l]*f[55][l]+alpha_vdim[8][l]*f[52][l]+alpha_vdim[4][l]*f[40][l]+alpha_vdim[1][l]*f[34][l])+0.8660254037844386*alpha_vdim[21][l]*f[32][l]+0.9682458365518543*alpha_vdim[0][l]*f[24][l]+0.8660254037844386*(alpha_vdim[6][l]*f[15][l]+alpha_vdim[3][l]*f[7][l]);
+    out[47][l] += (0.6185895741317419*f[37][l]+0.9682458365518543*f[10][l])*alpha_vdim[183][l]+(0.6185895741317419*f[35][l]+0.9682458365518543*f[9][l])*alpha_vdim[181][l]+(0.6185895741317419*f[25][l]+0.9682458365518543*f[4][l])*alpha_vdim[173][l]+0.8660254037844386*(f[17][l]*alpha_vdim[168][l]+f[16][l]*alpha_vdim[167][l])+0.9682458365518543*(f[37][l]*alpha_vdim[165][l]+f[35][l]*alpha_vdim[164][l])+0.8660254037844386*f[8][l]*alpha_vdim[163][l]+0.9682458365518543*(f[25][l]*alpha_vdim[162][l]+alpha_cdim[2][l]*f[41][l]+alpha_cdim[0][l]*f[28][l]);
+    out[48][l] += 0.9682458365518543*f[66][l]*alpha_vdim[183][l]+0.8660254037844386*f[35][l]*alpha_vdim[181][l]+0.9682458365518543*(f[57][l]*alpha_vdim[173][l]+f[51][l]*alpha_vdim[168][l])+0.8660254037844386*f[16][l]*alpha_vdim[167][l]+0.9682458365518543*f[38][l]*alpha_vdim[165][l]+0.8660254037844386*f[9][l]*alpha_vdim[164][l]+0.9682458365518543*(f[36][l]*alpha_vdim[163][l]+f[26][l]*alpha_vdim[162][l]+alpha_vdim[21][l]*f[69][l]+alpha_vdim[11][l]*f[60][l]+alpha_vdim[6][l]*f[53][l]+alpha_vdim[3][l]*f[43][l]+alpha_vdim[1][l]*f[41][l])+0.8660254037844386*alpha_vdim[25][l]*f[35][l]+0.9682458365518543*alpha_vdim[0][l]*f[29][l]+0.8660254037844386*(alpha_vdim[8][l]*f[16][l]+alpha_vdim[4][l]*f[9][l]);
+    out[49][l] += 0.8660254037844386*f[37][l]*alpha_vdim[183][l]+0.9682458365518543*(f[67][l]*alpha_vdim[181][l]+f[58][l]*alpha_vdim[173][l])+0.8660254037844386*f[17][l]*alpha_vdim[168][l]+0.9682458365518543*f[52][l]*alpha_vdim[167][l]+0.8660254037844386*f[10][l]*alpha_vdim[165][l]+0.9682458365518543*(f[40][l]*alpha_vdim[164][l]+f[39][l]*alpha_vdim[163][l]+f[27][l]*alpha_vdim[162][l])+0.8660254037844386*f[37][l]*alpha_vdim[106][l]+0.9682458365518543*(f[69][l]*alpha_vdim[100][l]+f[62][l]*alpha_vdim[92][l])+0.8660254037844386*f[17][l]*alpha_vdim[89][l]+0.9682458365518543*f[53][l]*alpha_vdim[86][l]+0.8660254037844386*f[10][l]*alpha_vdim[85][l]+0.9682458365518543*(f[43][l]*alpha_vdim[83][l]+f[42][l]*alpha_vdim[82][l]+f[30][l]*alpha_vdim[81][l]);
+    out[50][l] += (0.2474358296526967*f[55][l]+0.3872983346207416*f[24][l]+0.276641667586244*f[19][l]+0.4330127018922193*f[2][l])*alpha_vdim[183][l]+(0.2474358296526967*f[54][l]+0.3872983346207416*f[22][l]+0.276641667586244*f[21][l]+0.4330127018922193*f[3][l])*alpha_vdim[181][l]+(0.276641667586244*f[32][l]+0.4330127018922193*f[7][l])*alpha_vdim[173][l]+(0.3464101615137755*f[34][l]+0.3872983346207416*f[5][l])*alpha_vdim[168][l]+(0.3464101615137755*f[33][l]+0.3872983346207416*f[6][l])*alpha_vdim[167][l]+(0.3872983346207416*f[55][l]+0.4330127018922193*f[19][l])*alpha_vdim[165][l]+(0.3872983346207416*f[54][l]+0.4330127018922193*f[21][l])*alpha_vdim[164][l]+0.3872983346207416*f[15][l]*alpha_vdim[163][l]+0.4330127018922193*f[32][l]*alpha_vdim[162][l]+(0.2474358296526967*f[60][l]+0.3872983346207416*f[29][l]+0.276641667586244*f[19][l]+0.4330127018922193*f[2][l])*alpha_vdim[106][l]+(0.2474358296526967*f[57][l]+0.3872983346207416*f[26][l]+0.276641667586244*f[25][l]+0.4330127018922193*f[4][l])*alpha_vdim[100][l]+(0.276641667586244*f[35][l]+0.4330127018922193*f[9][l])*alpha_vdim[92][l]+(0.3464101615137755*f[41][l]+0.3872983346207416*f[5][l])*alpha_vdim[89][l]+(0.3464101615137755*f[36][l]+0.3872983346207416*f[8][l])*alpha_vdim[86][l]+(0.3872983346207416*f[60][l]+0.4330127018922193*f[19][l])*alpha_vdim[85][l]+(0.3872983346207416*f[57][l]+0.4330127018922193*f[25][l])*alpha_vdim[83][l]+0.3872983346207416*f[16][l]*alpha_vdim[82][l]+0.4330127018922193*f[35][l]*alpha_vdim[81][l]+(0.2474358296526967*alpha_vdim[25][l]+0.3872983346207416*alpha_vdim[4][l])*f[62][l]+(0.2474358296526967*alpha_vdim[21][l]+0.3872983346207416*alpha_vdim[3][l])*f[58][l]+0.8660254037844386*alpha_cdim[2][l]*f[51][l]+0.3464101615137755*(alpha_vdim[8][l]*f[42][l]+alpha_vdim[6][l]*f[39][l])+(0.276641667586244*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[37][l]+0.9682458365518543*alpha_cdim[0][l]*f[31][l]+0.3872983346207416*(alpha_vdim[25][l]*f[30][l]+alpha_vdim[21][l]*f[27][l])+(0.276641667586244*alpha_vdim[21][l]+0.4330127018922193*alpha_vdim[3][l])*f[25][l]+0.276641667586244*f[21][l]*alpha_vdim[25][l]+0.4330127018922193*(f[3][l]*alpha_vdim[25][l]+alpha_vdim[4][l]*f[21][l]+f[4][l]*alpha_vdim[21][l])+(0.9682458365518543*alpha_cdim[2][l]+0.3872983346207416*alpha_vdim[1][l])*f[17][l]+0.4330127018922193*f[10][l]*alpha_vdim[11][l]+0.3872983346207416*(alpha_vdim[6][l]*f[8][l]+f[6][l]*alpha_vdim[8][l]);
+    out[51][l] += (0.3464101615137755*f[56][l]+0.3872983346207416*f[20][l])*alpha_vdim[183][l]+0.3464101615137755*f[15][l]*alpha_vdim[181][l]+0.3872983346207416*f[33][l]*alpha_vdim[173][l]+(0.3464101615137755*f[72][l]+0.3872983346207416*(f[46][l]+f[44][l])+0.4330127018922193*f[12][l])*alpha_vdim[168][l]+(0.3464101615137755*f[32][l]+0.3872983346207416*f[7][l])*alpha_vdim[167][l]+(0.3872983346207416*f[56][l]+0.4330127018922193*f[20][l])*alpha_vdim[165][l]+0.3872983346207416*(f[15][l]*alpha_vdim[164][l]+f[54][l]*alpha_vdim[163][l])+0.4330127018922193*(f[22][l]*alpha_vdim[163][l]+f[33][l]*alpha_vdim[162][l])+(0.3464101615137755*f[61][l]+0.3872983346207416*f[20][l])*alpha_vdim[106][l]+0.3464101615137755*f[16][l]*alpha_vdim[100][l]+0.3872983346207416*f[36][l]*alpha_vdim[92][l]+(0.3464101615137755*f[73][l]+0.3872983346207416*(f[48][l]+f[44][l])+0.4330127018922193*f[12][l])*alpha_vdim[89][l]+(0.3464101615137755*f[35][l]+0.3872983346207416*f[9][l])*alpha_vdim[86][l]+(0.3872983346207416*f[61][l]+0.4330127018922193*f[20][l])*alpha_vdim[85][l]+0.3872983346207416*(f[16][l]*alpha_vdim[83][l]+f[57][l]*alpha_vdim[82][l])+0.4330127018922193*(f[26][l]*alpha_vdim[82][l]+f[36][l]*alpha_vdim[81][l])+0.7745966692414833*(alpha_vdim[8][l]*f[69][l]+alpha_vdim[6][l]*f[67][l])+(0.7745966692414833*alpha_vdim[25][l]+0.8660254037844386*alpha_vdim[4][l])*f[53][l]+0.7745966692414833*alpha_vdim[21][l]*f[52][l]+0.8660254037844386*(alpha_vdim[3][l]*f[52][l]+alpha_vdim[1][l]*f[50][l]+alpha_vdim[8][l]*f[43][l]+alpha_vdim[6][l]*f[40][l])+0.4330127018922193*alpha_cdim[0][l]*f[38][l]+0.8660254037844386*(alpha_vdim[6][l]*f[35][l]+alpha_vdim[8][l]*f[32][l])+(0.8660254037844386*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[31][l]+0.8660254037844386*(f[15][l]*alpha_vdim[25][l]+f[16][l]*alpha_vdim[21][l])+0.3872983346207416*alpha_cdim[2][l]*f[18][l]+0.9682458365518543*(alpha_vdim[1][l]*f[18][l]+alpha_vdim[3][l]*f[16][l]+alpha_vdim[4][l]*f[15][l]+alpha_vdim[6][l]*f[9][l]+f[7][l]*alpha_vdim[8][l]);
+    out[52][l] += 0.3464101615137755*(f[15][l]*alpha_vdim[183][l]+f[56][l]*alpha_vdim[181][l])+0.3872983346207416*(f[23][l]*alpha_vdim[181][l]+f[34][l]*alpha_vdim[173][l])+(0.3464101615137755*f[32][l]+0.3872983346207416*f[7][l])*alpha_vdim[168][l]+(0.3464101615137755*f[72][l]+0.3872983346207416*(f[46][l]+f[45][l])+0.4330127018922193*f[13][l])*alpha_vdim[167][l]+0.3872983346207416*f[15][l]*alpha_vdim[165][l]+(0.3872983346207416*f[56][l]+0.4330127018922193*f[23][l])*alpha_vdim[164][l]+0.3872983346207416*f[55][l]*alpha_vdim[163][l]+0.4330127018922193*(f[24][l]*alpha_vdim[163][l]+f[34][l]*alpha_vdim[162][l])+(0.7745966692414833*f[53][l]+0.8660254037844386*f[15][l])*alpha_vdim[106][l]+0.7745966692414833*f[51][l]*alpha_vdim[100][l]+0.8660254037844386*(f[17][l]*alpha_vdim[100][l]+f[31][l]*alpha_vdim[92][l])+(0.7745966692414833*f[69][l]+0.8660254037844386*(f[43][l]+f[32][l])+0.9682458365518543*f[7][l])*alpha_vdim[89][l]+(0.7745966692414833*f[66][l]+0.8660254037844386*(f[38][l]+f[37][l])+0.9682458365518543*f[10][l])*alpha_vdim[86][l]+(0.8660254037844386*f[53][l]+0.9682458365518543*f[15][l])*alpha_vdim[85][l]+(0.8660254037844386*f[51][l]+0.9682458365518543*f[17][l])*alpha_vdim[83][l]+0.8660254037844386*f[50][l]*alpha_vdim[82][l]+0.9682458365518543*(f[18][l]*alpha_vdim[82][l]+f[31][l]*alpha_vdim[81][l])+0.3464101615137755*(alpha_vdim[8][l]*f[74][l]+alpha_vdim[25][l]*f[64][l])+0.3872983346207416*(alpha_vdim[4][l]*f[64][l]+alpha_cdim[2][l]*f[59][l]+alpha_vdim[1][l]*f[58][l]+alpha_vdim[8][l]*(f[49][l]+f[45][l]))+0.4330127018922193*alpha_cdim[0][l]*f[40][l]+(0.3872983346207416*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[39][l]+0.3464101615137755*alpha_vdim[6][l]*f[37][l]+0.4330127018922193*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[27][l]+f[23][l]*(0.3872983346207416*alpha_vdim[25][l]+0.4330127018922193*alpha_vdim[4][l])+f[17][l]*(0.3464101615137755*alpha_vdim[21][l]+0.3872983346207416*alpha_vdim[3][l])+0.4330127018922193*alpha_vdim[8][l]*f[13][l]+0.3872983346207416*alpha_vdim[6][l]*f[10][l];
+    out[53][l] += (0.7745966692414833*f[52][l]+0.8660254037844386*f[16][l])*alpha_vdim[183][l]+0.7745966692414833*f[51][l]*alpha_vdim[181][l]+0.8660254037844386*(f[17][l]*alpha_vdim[181][l]+f[31][l]*alpha_vdim[173][l])+(0.7745966692414833*f[67][l]+0.8660254037844386*(f[40][l]+f[35][l])+0.9682458365518543*f[9][l])*alpha_vdim[168][l]+(0.7745966692414833*f[66][l]+0.8660254037844386*(f[38][l]+f[37][l])+0.9682458365518543*f[10][l])*alpha_vdim[167][l]+(0.8660254037844386*f[52][l]+0.9682458365518543*f[16][l])*alpha_vdim[165][l]+(0.8660254037844386*f[51][l]+0.9682458365518543*f[17][l])*alpha_vdim[164][l]+0.8660254037844386*f[50][l]*alpha_vdim[163][l]+0.9682458365518543*(f[18][l]*alpha_vdim[163][l]+f[31][l]*alpha_vdim[162][l])+0.3464101615137755*(f[16][l]*alpha_vdim[106][l]+f[61][l]*alpha_vdim[100][l])+0.3872983346207416*(f[28][l]*alpha_vdim[100][l]+f[41][l]*alpha_vdim[92][l])+(0.3464101615137755*f[35][l]+0.3872983346207416*f[9][l])*alpha_vdim[89][l]+(0.3464101615137755*f[73][l]+0.3872983346207416*(f[48][l]+f[47][l])+0.4330127018922193*f[14][l])*alpha_vdim[86][l]+0.3872983346207416*f[16][l]*alpha_vdim[85][l]+(0.3872983346207416*f[61][l]+0.4330127018922193*f[28][l])*alpha_vdim[83][l]+0.3872983346207416*f[60][l]*alpha_vdim[82][l]+0.4330127018922193*(f[29][l]*alpha_vdim[82][l]+f[41][l]*alpha_vdim[81][l])+0.3464101615137755*(alpha_vdim[6][l]*f[74][l]+alpha_vdim[21][l]*f[64][l])+0.3872983346207416*(alpha_vdim[3][l]*f[64][l]+alpha_cdim[2][l]*f[63][l]+alpha_vdim[1][l]*f[62][l]+alpha_vdim[6][l]*(f[49][l]+f[47][l]))+0.4330127018922193*alpha_cdim[0][l]*f[43][l]+(0.3872983346207416*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[42][l]+0.3464101615137755*alpha_vdim[8][l]*f[37][l]+0.4330127018922193*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[30][l]+(0.3872983346207416*alpha_vdim[21][l]+0.4330127018922193*alpha_vdim[3][l])*f[28][l]+f[17][l]*(0.3464101615137755*alpha_vdim[25][l]+0.3872983346207416*alpha_vdim[4][l])+0.4330127018922193*alpha_vdim[6][l]*f[14][l]+0.3872983346207416*alpha_vdim[8][l]*f[10][l];
+    out[54][l] += (0.276641667586244*f[57][l]+0.4330127018922193*f[26][l])*alpha_vdim[106][l]+(0.2474358296526967*f[19][l]+0.3872983346207416*f[2][l])*alpha_vdim[100][l]+(0.276641667586244*f[44][l]+0.4330127018922193*f[12][l])*alpha_vdim[92][l]+0.3872983346207416*f[36][l]*alpha_vdim[89][l]+0.3464101615137755*f[5][l]*alpha_vdim[86][l]+0.4330127018922193*f[57][l]*alpha_vdim[85][l]+0.3872983346207416*(f[19][l]*alpha_vdim[83][l]+f[20][l]*alpha_vdim[82][l])+0.4330127018922193*f[44][l]*alpha_vdim[81][l]+(0.5532833351724881*alpha_vdim[21][l]+0.8660254037844386*alpha_vdim[3][l])*f[55][l]+(0.6185895741317419*alpha_vdim[25][l]+0.9682458365518543*alpha_vdim[4][l])*f[50][l]+0.7745966692414833*alpha_vdim[6][l]*f[34][l]+0.9682458365518543*alpha_cdim[0][l]*f[33][l]+(0.6185895741317419*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[32][l]+0.8660254037844386*alpha_vdim[8][l]*f[31][l]+0.9682458365518543*f[18][l]*alpha_vdim[25][l]+alpha_vdim[21][l]*(0.8660254037844386*f[24][l]+0.6185895741317419*f[19][l])+0.9682458365518543*(f[2][l]*alpha_vdim[21][l]+alpha_vdim[3][l]*f[19][l])+0.8660254037844386*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[15][l]+0.9682458365518543*f[7][l]*alpha_vdim[11][l]+0.8660254037844386*f[5][l]*alpha_vdim[6][l];
+    out[55][l] += (0.6185895741317419*f[50][l]+0.9682458365518543*f[18][l])*alpha_vdim[106][l]+(0.5532833351724881*f[54][l]+0.8660254037844386*f[22][l]+0.6185895741317419*f[21][l]+0.9682458365518543*f[3][l])*alpha_vdim[100][l]+(0.6185895741317419*f[32][l]+0.9682458365518543*f[7][l])*alpha_vdim[92][l]+0.8660254037844386*f[31][l]*alpha_vdim[89][l]+(0.7745966692414833*f[33][l]+0.8660254037844386*f[6][l])*alpha_vdim[86][l]+0.9682458365518543*f[50][l]*alpha_vdim[85][l]+(0.8660254037844386*f[54][l]+0.9682458365518543*f[21][l])*alpha_vdim[83][l]+0.8660254037844386*f[15][l]*alpha_vdim[82][l]+0.9682458365518543*f[32][l]*alpha_vdim[81][l]+(0.276641667586244*alpha_vdim[25][l]+0.4330127018922193*alpha_vdim[4][l])*f[58][l]+0.8660254037844386*alpha_cdim[2][l]*f[56][l]+(0.276641667586244*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[45][l]+0.3872983346207416*alpha_vdim[8][l]*f[39][l]+0.9682458365518543*alpha_cdim[0][l]*f[34][l]+0.4330127018922193*alpha_vdim[25][l]*f[27][l]+(0.9682458365518543*alpha_cdim[2][l]+0.3872983346207416*alpha_vdim[1][l])*f[23][l]+0.2474358296526967*alpha_vdim[21][l]*f[21][l]+0.3872983346207416*(alpha_vdim[3][l]*f[21][l]+f[3][l]*alpha_vdim[21][l])+0.4330127018922193*alpha_vdim[11][l]*f[13][l]+0.3464101615137755*alpha_vdim[6][l]*f[6][l];
+    out[56][l] += 0.8660254037844386*f[51][l]*alpha_vdim[106][l]+0.7745966692414833*f[15][l]*alpha_vdim[100][l]+0.8660254037844386*f[33][l]*alpha_vdim[92][l]+(0.8660254037844386*f[66][l]+0.9682458365518543*f[38][l])*alpha_vdim[89][l]+(0.7745966692414833*f[32][l]+0.8660254037844386*f[7][l])*alpha_vdim[86][l]+0.9682458365518543*f[51][l]*alpha_vdim[85][l]+0.8660254037844386*(f[15][l]*alpha_vdim[83][l]+f[54][l]*alpha_vdim[82][l])+0.9682458365518543*(f[22][l]*alpha_vdim[82][l]+f[33][l]*alpha_vdim[81][l])+0.8660254037844386*(alpha_vdim[8][l]*f[67][l]+alpha_vdim[1][l]*f[55][l])+(0.8660254037844386*alpha_vdim[25][l]+0.9682458365518543*alpha_vdim[4][l])*f[52][l]+0.4330127018922193*alpha_cdim[0][l]*f[46][l]+0.9682458365518543*alpha_vdim[8][l]*f[40][l]+(0.8660254037844386*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[34][l]+0.7745966692414833*alpha_vdim[6][l]*f[32][l]+(0.3872983346207416*alpha_cdim[2][l]+0.9682458365518543*alpha_vdim[1][l])*f[24][l]+0.7745966692414833*f[15][l]*alpha_vdim[21][l]+0.8660254037844386*(alpha_vdim[3][l]*f[15][l]+alpha_vdim[6][l]*f[7][l]);
+    out[57][l] += (0.276641667586244*f[54][l]+0.4330127018922193*f[22][l])*alpha_vdim[183][l]+(0.2474358296526967*f[19][l]+0.3872983346207416*f[2][l])*alpha_vdim[181][l]+(0.276641667586244*f[44][l]+0.4330127018922193*f[12][l])*alpha_vdim[173][l]+0.3872983346207416*f[33][l]*alpha_vdim[168][l]+0.3464101615137755*f[5][l]*alpha_vdim[167][l]+0.4330127018922193*f[54][l]*alpha_vdim[165][l]+0.3872983346207416*(f[19][l]*alpha_vdim[164][l]+f[20][l]*alpha_vdim[163][l])+0.4330127018922193*f[44][l]*alpha_vdim[162][l]+(0.5532833351724881*alpha_vdim[25][l]+0.8660254037844386*alpha_vdim[4][l])*f[60][l]+(0.6185895741317419*alpha_vdim[21][l]+0.9682458365518543*alpha_vdim[3][l])*f[50][l]+0.7745966692414833*alpha_vdim[8][l]*f[41][l]+0.9682458365518543*alpha_cdim[0][l]*f[36][l]+(0.6185895741317419*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[35][l]+0.8660254037844386*alpha_vdim[6][l]*f[31][l]+alpha_vdim[25][l]*(0.8660254037844386*f[29][l]+0.6185895741317419*f[19][l])+0.9682458365518543*(f[2][l]*alpha_vdim[25][l]+f[18][l]*alpha_vdim[21][l]+alpha_vdim[4][l]*f[19][l])+0.8660254037844386*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[16][l]+0.9682458365518543*f[9][l]*alpha_vdim[11][l]+0.8660254037844386*f[5][l]*alpha_vdim[8][l];
+    out[58][l] += (0.2474358296526967*f[21][l]+0.3872983346207416*f[3][l])*alpha_vdim[183][l]+(0.276641667586244*f[55][l]+0.4330127018922193*f[24][l])*alpha_vdim[181][l]+(0.276641667586244*f[45][l]+0.4330127018922193*f[13][l])*alpha_vdim[173][l]+0.3464101615137755*f[6][l]*alpha_vdim[168][l]+0.3872983346207416*(f[34][l]*alpha_vdim[167][l]+f[21][l]*alpha_vdim[165][l])+0.4330127018922193*f[55][l]*alpha_vdim[164][l]+0.3872983346207416*f[23][l]*alpha_vdim[163][l]+0.4330127018922193*f[45][l]*alpha_vdim[162][l]+(0.5532833351724881*f[62][l]+0.8660254037844386*f[30][l]+0.6185895741317419*f[21][l]+0.9682458365518543*f[3][l])*alpha_vdim[106][l]+(0.6185895741317419*f[50][l]+0.9682458365518543*f[18][l])*alpha_vdim[100][l]+(0.6185895741317419*f[37][l]+0.9682458365518543*f[10][l])*alpha_vdim[92][l]+0.7745966692414833*f[42][l]*alpha_vdim[89][l]+0.8660254037844386*(f[6][l]*alpha_vdim[89][l]+f[31][l]*alpha_vdim[86][l]+f[62][l]*alpha_vdim[85][l])+0.9682458365518543*(f[21][l]*alpha_vdim[85][l]+f[50][l]*alpha_vdim[83][l])+0.8660254037844386*f[17][l]*alpha_vdim[82][l]+0.9682458365518543*(f[37][l]*alpha_vdim[81][l]+alpha_cdim[2][l]*f[52][l]+alpha_cdim[0][l]*f[39][l]);
+    out[59][l] += 0.3872983346207416*(f[54][l]*alpha_vdim[183][l]+f[55][l]*alpha_vdim[181][l])+0.4330127018922193*f[72][l]*alpha_vdim[173][l]+0.3872983346207416*(f[33][l]*alpha_vdim[168][l]+f[34][l]*alpha_vdim[167][l]+f[22][l]*alpha_vdim[165][l]+f[24][l]*alpha_vdim[164][l])+0.4330127018922193*(f[56][l]*alpha_vdim[163][l]+f[46][l]*alpha_vdim[162][l])+(0.8660254037844386*f[77][l]+0.9682458365518543*f[54][l])*alpha_vdim[106][l]+0.8660254037844386*f[50][l]*alpha_vdim[100][l]+0.9682458365518543*f[66][l]*alpha_vdim[92][l]+(0.8660254037844386*f[70][l]+0.9682458365518543*f[33][l])*alpha_vdim[89][l]+0.8660254037844386*f[31][l]*alpha_vdim[86][l]+(0.8660254037844386*f[63][l]+0.9682458365518543*f[22][l])*alpha_vdim[85][l]+0.8660254037844386*f[18][l]*alpha_vdim[83][l]+0.9682458365518543*(f[51][l]*alpha_vdim[82][l]+f[38][l]*alpha_vdim[81][l])+0.8660254037844386*(alpha_vdim[25][l]*f[78][l]+alpha_vdim[8][l]*f[71][l])+0.9682458365518543*alpha_vdim[11][l]*f[67][l]+0.8660254037844386*alpha_vdim[4][l]*f[65][l]+0.9682458365518543*(alpha_vdim[25][l]*f[55][l]+alpha_vdim[1][l]*f[52][l])+0.8660254037844386*alpha_vdim[21][l]*f[50][l]+0.9682458365518543*(alpha_vdim[0][l]*f[40][l]+alpha_vdim[8][l]*f[34][l])+0.8660254037844386*alpha_vdim[6][l]*f[31][l]+0.9682458365518543*alpha_vdim[4][l]*f[24][l]+0.8660254037844386*alpha_vdim[3][l]*f[18][l];
+    out[60][l] += (0.6185895741317419*f[50][l]+0.9682458365518543*f[18][l])*alpha_vdim[183][l]+(0.5532833351724881*f[57][l]+0.8660254037844386*f[26][l]+0.6185895741317419*f[25][l]+0.9682458365518543*f[4][l])*alpha_vdim[181][l]+(0.6185895741317419*f[35][l]+0.9682458365518543*f[9][l])*alpha_vdim[173][l]+0.8660254037844386*f[31][l]*alpha_vdim[168][l]+(0.7745966692414833*f[36][l]+0.8660254037844386*f[8][l])*alpha_vdim[167][l]+0.9682458365518543*f[50][l]*alpha_vdim[165][l]+(0.8660254037844386*f[57][l]+0.9682458365518543*f[25][l])*alpha_vdim[164][l]+0.8660254037844386*f[16][l]*alpha_vdim[163][l]+0.9682458365518543*f[35][l]*alpha_vdim[162][l]+(0.276641667586244*alpha_vdim[21][l]+0.4330127018922193*alpha_vdim[3][l])*f[62][l]+0.8660254037844386*alpha_cdim[2][l]*f[61][l]+(0.276641667586244*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[47][l]+0.3872983346207416*alpha_vdim[6][l]*f[42][l]+0.9682458365518543*alpha_cdim[0][l]*f[41][l]+0.4330127018922193*alpha_vdim[21][l]*f[30][l]+(0.9682458365518543*alpha_cdim[2][l]+0.3872983346207416*alpha_vdim[1][l])*f[28][l]+0.2474358296526967*alpha_vdim[25][l]*f[25][l]+0.3872983346207416*(alpha_vdim[4][l]*f[25][l]+f[4][l]*alpha_vdim[25][l])+0.4330127018922193*alpha_vdim[11][l]*f[14][l]+0.3464101615137755*alpha_vdim[8][l]*f[8][l];
+    out[61][l] += 0.8660254037844386*f[51][l]*alpha_vdim[183][l]+0.7745966692414833*f[16][l]*alpha_vdim[181][l]+0.8660254037844386*f[36][l]*alpha_vdim[173][l]+(0.8660254037844386*f[66][l]+0.9682458365518543*f[38][l])*alpha_vdim[168][l]+(0.7745966692414833*f[35][l]+0.8660254037844386*f[9][l])*alpha_vdim[167][l]+0.9682458365518543*f[51][l]*alpha_vdim[165][l]+0.8660254037844386*(f[16][l]*alpha_vdim[164][l]+f[57][l]*alpha_vdim[163][l])+0.9682458365518543*(f[26][l]*alpha_vdim[163][l]+f[36][l]*alpha_vdim[162][l])+0.8660254037844386*(alpha_vdim[6][l]*f[69][l]+alpha_vdim[1][l]*f[60][l])+(0.8660254037844386*alpha_vdim[21][l]+0.9682458365518543*alpha_vdim[3][l])*f[53][l]+0.4330127018922193*alpha_cdim[0][l]*f[48][l]+0.9682458365518543*alpha_vdim[6][l]*f[43][l]+(0.8660254037844386*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[41][l]+0.7745966692414833*alpha_vdim[8][l]*f[35][l]+(0.3872983346207416*alpha_cdim[2][l]+0.9682458365518543*alpha_vdim[1][l])*f[29][l]+0.7745966692414833*f[16][l]*alpha_vdim[25][l]+0.8660254037844386*(alpha_vdim[4][l]*f[16][l]+alpha_vdim[8][l]*f[9][l]);
+    out[62][l] += (0.5532833351724881*f[58][l]+0.8660254037844386*f[27][l]+0.6185895741317419*f[25][l]+0.9682458365518543*f[4][l])*alpha_vdim[183][l]+(0.6185895741317419*f[50][l]+0.9682458365518543*f[18][l])*alpha_vdim[181][l]+(0.6185895741317419*f[37][l]+0.9682458365518543*f[10][l])*alpha_vdim[173][l]+0.7745966692414833*f[39][l]*alpha_vdim[168][l]+0.8660254037844386*(f[8][l]*alpha_vdim[168][l]+f[31][l]*alpha_vdim[167][l]+f[58][l]*alpha_vdim[165][l])+0.9682458365518543*(f[25][l]*alpha_vdim[165][l]+f[50][l]*alpha_vdim[164][l])+0.8660254037844386*f[17][l]*alpha_vdim[163][l]+0.9682458365518543*f[37][l]*alpha_vdim[162][l]+(0.2474358296526967*f[25][l]+0.3872983346207416*f[4][l])*alpha_vdim[106][l]+(0.276641667586244*f[60][l]+0.4330127018922193*f[29][l])*alpha_vdim[100][l]+(0.276641667586244*f[47][l]+0.4330127018922193*f[14][l])*alpha_vdim[92][l]+0.3464101615137755*f[8][l]*alpha_vdim[89][l]+0.3872983346207416*(f[41][l]*alpha_vdim[86][l]+f[25][l]*alpha_vdim[85][l])+0.4330127018922193*f[60][l]*alpha_vdim[83][l]+0.3872983346207416*f[28][l]*alpha_vdim[82][l]+0.4330127018922193*f[47][l]*alpha_vdim[81][l]+0.9682458365518543*(alpha_cdim[2][l]*f[53][l]+alpha_cdim[0][l]*f[42][l]);
+    out[63][l] += (0.8660254037844386*f[76][l]+0.9682458365518543*f[57][l])*alpha_vdim[183][l]+0.8660254037844386*f[50][l]*alpha_vdim[181][l]+0.9682458365518543*f[66][l]*alpha_vdim[173][l]+(0.8660254037844386*f[68][l]+0.9682458365518543*f[36][l])*alpha_vdim[168][l]+0.8660254037844386*f[31][l]*alpha_vdim[167][l]+(0.8660254037844386*f[59][l]+0.9682458365518543*f[26][l])*alpha_vdim[165][l]+0.8660254037844386*f[18][l]*alpha_vdim[164][l]+0.9682458365518543*(f[51][l]*alpha_vdim[163][l]+f[38][l]*alpha_vdim[162][l])+0.3872983346207416*(f[57][l]*alpha_vdim[106][l]+f[60][l]*alpha_vdim[100][l])+0.4330127018922193*f[73][l]*alpha_vdim[92][l]+0.3872983346207416*(f[36][l]*alpha_vdim[89][l]+f[41][l]*alpha_vdim[86][l]+f[26][l]*alpha_vdim[85][l]+f[29][l]*alpha_vdim[83][l])+0.4330127018922193*(f[61][l]*alpha_vdim[82][l]+f[48][l]*alpha_vdim[81][l])+0.8660254037844386*(alpha_vdim[21][l]*f[78][l]+alpha_vdim[6][l]*f[71][l])+0.9682458365518543*alpha_vdim[11][l]*f[69][l]+0.8660254037844386*alpha_vdim[3][l]*f[65][l]+0.9682458365518543*(alpha_vdim[21][l]*f[60][l]+alpha_vdim[1][l]*f[53][l])+0.8660254037844386*alpha_vdim[25][l]*f[50][l]+0.9682458365518543*(alpha_vdim[0][l]*f[43][l]+alpha_vdim[6][l]*f[41][l])+0.8660254037844386*alpha_vdim[8][l]*f[31][l]+0.9682458365518543*alpha_vdim[3][l]*f[29][l]+0.8660254037844386*alpha_vdim[4][l]*f[18][l];
+    out[64][l] += 0.7745966692414833*f[17][l]*alpha_vdim[183][l]+0.8660254037844386*(f[52][l]*alpha_vdim[181][l]+f[39][l]*alpha_vdim[173][l])+(0.7745966692414833*f[37][l]+0.8660254037844386*f[10][l])*alpha_vdim[168][l]+(0.8660254037844386*f[67][l]+0.9682458365518543*f[40][l])*alpha_vdim[167][l]+0.8660254037844386*f[17][l]*alpha_vdim[165][l]+0.9682458365518543*f[52][l]*alpha_vdim[164][l]+0.8660254037844386*f[58][l]*alpha_vdim[163][l]+0.9682458365518543*(f[27][l]*alpha_vdim[163][l]+f[39][l]*alpha_vdim[162][l])+0.7745966692414833*f[17][l]*alpha_vdim[106][l]+0.8660254037844386*(f[53][l]*alpha_vdim[100][l]+f[42][l]*alpha_vdim[92][l])+(0.7745966692414833*f[37][l]+0.8660254037844386*f[10][l])*alpha_vdim[89][l]+(0.8660254037844386*f[69][l]+0.9682458365518543*f[43][l])*alpha_vdim[86][l]+0.8660254037844386*f[17][l]*alpha_vdim[85][l]+0.9682458365518543*f[53][l]*alpha_vdim[83][l]+0.8660254037844386*f[62][l]*alpha_vdim[82][l]+0.9682458365518543*(f[30][l]*alpha_vdim[82][l]+f[42][l]*alpha_vdim[81][l])+0.4330127018922193*(alpha_cdim[2][l]*f[65][l]+alpha_cdim[0][l]*f[49][l]);
+    out[65][l] += 0.8660254037844386*(f[50][l]*alpha_vdim[183][l]+f[76][l]*alpha_vdim[181][l])+0.9682458365518543*(f[58][l]*alpha_vdim[181][l]+f[67][l]*alpha_vdim[173][l])+0.8660254037844386*f[31][l]*alpha_vdim[168][l]+(0.8660254037844386*f[68][l]+0.9682458365518543*f[39][l])*alpha_vdim[167][l]+0.8660254037844386*(f[18][l]*alpha_vdim[165][l]+f[59][l]*alpha_vdim[164][l])+0.9682458365518543*(f[27][l]*alpha_vdim[164][l]+f[52][l]*alpha_vdim[163][l]+f[40][l]*alpha_vdim[162][l])+0.8660254037844386*(f[50][l]*alpha_vdim[106][l]+f[77][l]*alpha_vdim[100][l])+0.9682458365518543*(f[62][l]*alpha_vdim[100][l]+f[69][l]*alpha_vdim[92][l])+0.8660254037844386*f[31][l]*alpha_vdim[89][l]+(0.8660254037844386*f[70][l]+0.9682458365518543*f[42][l])*alpha_vdim[86][l]+0.8660254037844386*(f[18][l]*alpha_vdim[85][l]+f[63][l]*alpha_vdim[83][l])+0.9682458365518543*(f[30][l]*alpha_vdim[83][l]+f[53][l]*alpha_vdim[82][l]+f[43][l]*alpha_vdim[81][l])+0.4330127018922193*(alpha_vdim[11][l]*f[74][l]+alpha_vdim[1][l]*f[64][l])+0.3872983346207416*(alpha_vdim[21][l]*f[62][l]+alpha_vdim[25][l]*f[58][l])+0.4330127018922193*alpha_vdim[0][l]*f[49][l]+0.3872983346207416*(alpha_vdim[6][l]*f[42][l]+alpha_vdim[8][l]*f[39][l]+alpha_vdim[3][l]*f[30][l]+alpha_vdim[4][l]*f[27][l]);
+    out[66][l] += (0.2474358296526967*f[72][l]+0.3872983346207416*f[46][l]+0.276641667586244*f[44][l]+0.4330127018922193*f[12][l])*alpha_vdim[183][l]+(0.2474358296526967*f[32][l]+0.3872983346207416*f[7][l])*alpha_vdim[181][l]+(0.276641667586244*f[54][l]+0.4330127018922193*f[22][l])*alpha_vdim[173][l]+(0.3464101615137755*f[56][l]+0.3872983346207416*f[20][l])*alpha_vdim[168][l]+0.3464101615137755*f[15][l]*alpha_vdim[167][l]+(0.3872983346207416*f[72][l]+0.4330127018922193*f[44][l])*alpha_vdim[165][l]+0.3872983346207416*(f[32][l]*alpha_vdim[164][l]+f[33][l]*alpha_vdim[163][l])+0.4330127018922193*f[54][l]*alpha_vdim[162][l]+(0.2474358296526967*f[73][l]+0.3872983346207416*f[48][l]+0.276641667586244*f[44][l]+0.4330127018922193*f[12][l])*alpha_vdim[106][l]+(0.2474358296526967*f[35][l]+0.3872983346207416*f[9][l])*alpha_vdim[100][l]+(0.276641667586244*f[57][l]+0.4330127018922193*f[26][l])*alpha_vdim[92][l]+(0.3464101615137755*f[61][l]+0.3872983346207416*f[20][l])*alpha_vdim[89][l]+0.3464101615137755*f[16][l]*alpha_vdim[86][l]+(0.3872983346207416*f[73][l]+0.4330127018922193*f[44][l])*alpha_vdim[85][l]+0.3872983346207416*(f[35][l]*alpha_vdim[83][l]+f[36][l]*alpha_vdim[82][l])+0.4330127018922193*f[57][l]*alpha_vdim[81][l]+(0.5532833351724881*alpha_vdim[25][l]+0.8660254037844386*alpha_vdim[4][l])*f[69][l]+(0.5532833351724881*alpha_vdim[21][l]+0.8660254037844386*alpha_vdim[3][l])*f[67][l]+0.7745966692414833*(alpha_vdim[8][l]*f[53][l]+alpha_vdim[6][l]*f[52][l])+0.9682458365518543*alpha_cdim[0][l]*f[51][l]+(0.6185895741317419*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[50][l]+0.8660254037844386*(alpha_vdim[25][l]*f[43][l]+alpha_vdim[21][l]*f[40][l])+(0.6185895741317419*alpha_vdim[21][l]+0.9682458365518543*alpha_vdim[3][l])*f[35][l]+(0.6185895741317419*alpha_vdim[25][l]+0.9682458365518543*alpha_vdim[4][l])*f[32][l]+0.8660254037844386*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[31][l]+0.9682458365518543*(f[7][l]*alpha_vdim[25][l]+f[9][l]*alpha_vdim[21][l]+alpha_vdim[11][l]*f[18][l])+0.8660254037844386*(alpha_vdim[6][l]*f[16][l]+alpha_vdim[8][l]*f[15][l]);
+    out[67][l] += (0.2474358296526967*f[32][l]+0.3872983346207416*f[7][l])*alpha_vdim[183][l]+(0.2474358296526967*f[72][l]+0.3872983346207416*f[46][l]+0.276641667586244*f[45][l]+0.4330127018922193*f[13][l])*alpha_vdim[181][l]+(0.276641667586244*f[55][l]+0.4330127018922193*f[24][l])*alpha_vdim[173][l]+0.3464101615137755*(f[15][l]*alpha_vdim[168][l]+f[56][l]*alpha_vdim[167][l])+0.3872983346207416*(f[23][l]*alpha_vdim[167][l]+f[32][l]*alpha_vdim[165][l])+(0.3872983346207416*f[72][l]+0.4330127018922193*f[45][l])*alpha_vdim[164][l]+0.3872983346207416*f[34][l]*alpha_vdim[163][l]+0.4330127018922193*f[55][l]*alpha_vdim[162][l]+(0.5532833351724881*f[69][l]+0.8660254037844386*f[43][l]+0.6185895741317419*f[32][l]+0.9682458365518543*f[7][l])*alpha_vdim[106][l]+(0.5532833351724881*f[66][l]+0.8660254037844386*f[38][l]+0.6185895741317419*f[37][l]+0.9682458365518543*f[10][l])*alpha_vdim[100][l]+(0.6185895741317419*f[50][l]+0.9682458365518543*f[18][l])*alpha_vdim[92][l]+(0.7745966692414833*f[53][l]+0.8660254037844386*f[15][l])*alpha_vdim[89][l]+(0.7745966692414833*f[51][l]+0.8660254037844386*f[17][l])*alpha_vdim[86][l]+(0.8660254037844386*f[69][l]+0.9682458365518543*f[32][l])*alpha_vdim[85][l]+(0.8660254037844386*f[66][l]+0.9682458365518543*f[37][l])*alpha_vdim[83][l]+0.8660254037844386*f[31][l]*alpha_vdim[82][l]+0.9682458365518543*f[50][l]*alpha_vdim[81][l]+(0.2474358296526967*alpha_vdim[25][l]+0.3872983346207416*alpha_vdim[4][l])*f[74][l]+0.8660254037844386*alpha_cdim[2][l]*f[68][l]+0.3464101615137755*alpha_vdim[8][l]*f[64][l]+(0.276641667586244*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[58][l]+0.9682458365518543*alpha_cdim[0][l]*f[52][l]+0.3872983346207416*alpha_vdim[25][l]*f[49][l]+(0.276641667586244*alpha_vdim[25][l]+0.4330127018922193*alpha_vdim[4][l])*f[45][l]+(0.9682458365518543*alpha_cdim[2][l]+0.3872983346207416*alpha_vdim[1][l])*f[39][l]+(0.2474358296526967*alpha_vdim[21][l]+0.3872983346207416*alpha_vdim[3][l])*f[37][l]+0.4330127018922193*(alpha_vdim[11][l]*f[27][l]+f[13][l]*alpha_vdim[25][l])+0.3872983346207416*(alpha_vdim[8][l]*f[23][l]+f[10][l]*alpha_vdim[21][l])+0.3464101615137755*alpha_vdim[6][l]*f[17][l];
+    out[68][l] += 0.3464101615137755*(f[33][l]*alpha_vdim[183][l]+f[34][l]*alpha_vdim[181][l])+0.3872983346207416*f[56][l]*alpha_vdim[173][l]+(0.3464101615137755*f[54][l]+0.3872983346207416*f[22][l])*alpha_vdim[168][l]+0.3464101615137755*f[55][l]*alpha_vdim[167][l]+0.3872983346207416*(f[24][l]*alpha_vdim[167][l]+f[33][l]*alpha_vdim[165][l]+f[34][l]*alpha_vdim[164][l]+f[72][l]*alpha_vdim[163][l])+0.4330127018922193*(f[46][l]*alpha_vdim[163][l]+f[56][l]*alpha_vdim[162][l])+(0.7745966692414833*f[70][l]+0.8660254037844386*f[33][l])*alpha_vdim[106][l]+0.7745966692414833*f[31][l]*alpha_vdim[100][l]+0.8660254037844386*f[51][l]*alpha_vdim[92][l]+(0.7745966692414833*f[77][l]+0.8660254037844386*(f[63][l]+f[54][l])+0.9682458365518543*f[22][l])*alpha_vdim[89][l]+(0.7745966692414833*f[50][l]+0.8660254037844386*f[18][l])*alpha_vdim[86][l]+(0.8660254037844386*f[70][l]+0.9682458365518543*f[33][l])*alpha_vdim[85][l]+0.8660254037844386*(f[31][l]*alpha_vdim[83][l]+f[66][l]*alpha_vdim[82][l])+0.9682458365518543*(f[38][l]*alpha_vdim[82][l]+f[51][l]*alpha_vdim[81][l])+0.7745966692414833*(alpha_vdim[8][l]*f[78][l]+alpha_vdim[25][l]*f[71][l])+0.8660254037844386*(alpha_vdim[4][l]*f[71][l]+alpha_vdim[1][l]*f[67][l]+alpha_vdim[8][l]*f[65][l])+0.4330127018922193*alpha_cdim[0][l]*f[59][l]+0.8660254037844386*alpha_vdim[8][l]*f[55][l]+(0.8660254037844386*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[52][l]+0.7745966692414833*alpha_vdim[6][l]*f[50][l]+(0.3872983346207416*alpha_cdim[2][l]+0.9682458365518543*alpha_vdim[1][l])*f[40][l]+(0.8660254037844386*alpha_vdim[25][l]+0.9682458365518543*alpha_vdim[4][l])*f[34][l]+(0.7745966692414833*alpha_vdim[21][l]+0.8660254037844386*alpha_vdim[3][l])*f[31][l]+0.9682458365518543*alpha_vdim[8][l]*f[24][l]+0.8660254037844386*alpha_vdim[6][l]*f[18][l];
+    out[69][l] += (0.5532833351724881*f[67][l]+0.8660254037844386*f[40][l]+0.6185895741317419*f[35][l]+0.9682458365518543*f[9][l])*alpha_vdim[183][l]+(0.5532833351724881*f[66][l]+0.8660254037844386*f[38][l]+0.6185895741317419*f[37][l]+0.9682458365518543*f[10][l])*alpha_vdim[181][l]+(0.6185895741317419*f[50][l]+0.9682458365518543*f[18][l])*alpha_vdim[173][l]+(0.7745966692414833*f[52][l]+0.8660254037844386*f[16][l])*alpha_vdim[168][l]+(0.7745966692414833*f[51][l]+0.8660254037844386*f[17][l])*alpha_vdim[167][l]+(0.8660254037844386*f[67][l]+0.9682458365518543*f[35][l])*alpha_vdim[165][l]+(0.8660254037844386*f[66][l]+0.9682458365518543*f[37][l])*alpha_vdim[164][l]+0.8660254037844386*f[31][l]*alpha_vdim[163][l]+0.9682458365518543*f[50][l]*alpha_vdim[162][l]+(0.2474358296526967*f[35][l]+0.3872983346207416*f[9][l])*alpha_vdim[106][l]+(0.2474358296526967*f[73][l]+0.3872983346207416*f[48][l]+0.276641667586244*f[47][l]+0.4330127018922193*f[14][l])*alpha_vdim[100][l]+(0.276641667586244*f[60][l]+0.4330127018922193*f[29][l])*alpha_vdim[92][l]+0.3464101615137755*(f[16][l]*alpha_vdim[89][l]+f[61][l]*alpha_vdim[86][l])+0.3872983346207416*(f[28][l]*alpha_vdim[86][l]+f[35][l]*alpha_vdim[85][l])+(0.3872983346207416*f[73][l]+0.4330127018922193*f[47][l])*alpha_vdim[83][l]+0.3872983346207416*f[41][l]*alpha_vdim[82][l]+0.4330127018922193*f[60][l]*alpha_vdim[81][l]+(0.2474358296526967*alpha_vdim[21][l]+0.3872983346207416*alpha_vdim[3][l])*f[74][l]+0.8660254037844386*alpha_cdim[2][l]*f[70][l]+0.3464101615137755*alpha_vdim[6][l]*f[64][l]+(0.276641667586244*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[62][l]+0.9682458365518543*alpha_cdim[0][l]*f[53][l]+0.3872983346207416*alpha_vdim[21][l]*f[49][l]+(0.276641667586244*alpha_vdim[21][l]+0.4330127018922193*alpha_vdim[3][l])*f[47][l]+(0.9682458365518543*alpha_cdim[2][l]+0.3872983346207416*alpha_vdim[1][l])*f[42][l]+(0.2474358296526967*alpha_vdim[25][l]+0.3872983346207416*alpha_vdim[4][l])*f[37][l]+0.4330127018922193*alpha_vdim[11][l]*f[30][l]+0.3872983346207416*(alpha_vdim[6][l]*f[28][l]+f[10][l]*alpha_vdim[25][l])+0.4330127018922193*f[14][l]*alpha_vdim[21][l]+0.3464101615137755*alpha_vdim[8][l]*f[17][l];
+    out[70][l] += (0.7745966692414833*f[68][l]+0.8660254037844386*f[36][l])*alpha_vdim[183][l]+0.7745966692414833*f[31][l]*alpha_vdim[181][l]+0.8660254037844386*f[51][l]*alpha_vdim[173][l]+(0.7745966692414833*f[76][l]+0.8660254037844386*(f[59][l]+f[57][l])+0.9682458365518543*f[26][l])*alpha_vdim[168][l]+(0.7745966692414833*f[50][l]+0.8660254037844386*f[18][l])*alpha_vdim[167][l]+(0.8660254037844386*f[68][l]+0.9682458365518543*f[36][l])*alpha_vdim[165][l]+0.8660254037844386*(f[31][l]*alpha_vdim[164][l]+f[66][l]*alpha_vdim[163][l])+0.9682458365518543*(f[38][l]*alpha_vdim[163][l]+f[51][l]*alpha_vdim[162][l])+0.3464101615137755*(f[36][l]*alpha_vdim[106][l]+f[41][l]*alpha_vdim[100][l])+0.3872983346207416*f[61][l]*alpha_vdim[92][l]+(0.3464101615137755*f[57][l]+0.3872983346207416*f[26][l])*alpha_vdim[89][l]+0.3464101615137755*f[60][l]*alpha_vdim[86][l]+0.3872983346207416*(f[29][l]*alpha_vdim[86][l]+f[36][l]*alpha_vdim[85][l]+f[41][l]*alpha_vdim[83][l]+f[73][l]*alpha_vdim[82][l])+0.4330127018922193*(f[48][l]*alpha_vdim[82][l]+f[61][l]*alpha_vdim[81][l])+0.7745966692414833*(alpha_vdim[6][l]*f[78][l]+alpha_vdim[21][l]*f[71][l])+0.8660254037844386*(alpha_vdim[3][l]*f[71][l]+alpha_vdim[1][l]*f[69][l]+alpha_vdim[6][l]*f[65][l])+0.4330127018922193*alpha_cdim[0][l]*f[63][l]+0.8660254037844386*alpha_vdim[6][l]*f[60][l]+(0.8660254037844386*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[53][l]+0.7745966692414833*alpha_vdim[8][l]*f[50][l]+(0.3872983346207416*alpha_cdim[2][l]+0.9682458365518543*alpha_vdim[1][l])*f[43][l]+(0.8660254037844386*alpha_vdim[21][l]+0.9682458365518543*alpha_vdim[3][l])*f[41][l]+(0.7745966692414833*alpha_vdim[25][l]+0.8660254037844386*alpha_vdim[4][l])*f[31][l]+0.9682458365518543*alpha_vdim[6][l]*f[29][l]+0.8660254037844386*alpha_vdim[8][l]*f[18][l];
+    out[71][l] += 0.7745966692414833*(f[31][l]*alpha_vdim[183][l]+f[68][l]*alpha_vdim[181][l])+0.8660254037844386*(f[39][l]*alpha_vdim[181][l]+f[52][l]*alpha_vdim[173][l])+(0.7745966692414833*f[50][l]+0.8660254037844386*f[18][l])*alpha_vdim[168][l]+(0.7745966692414833*f[76][l]+0.8660254037844386*(f[59][l]+f[58][l])+0.9682458365518543*f[27][l])*alpha_vdim[167][l]+0.8660254037844386*f[31][l]*alpha_vdim[165][l]+(0.8660254037844386*f[68][l]+0.9682458365518543*f[39][l])*alpha_vdim[164][l]+0.8660254037844386*f[67][l]*alpha_vdim[163][l]+0.9682458365518543*(f[40][l]*alpha_vdim[163][l]+f[52][l]*alpha_vdim[162][l])+0.7745966692414833*(f[31][l]*alpha_vdim[106][l]+f[70][l]*alpha_vdim[100][l])+0.8660254037844386*(f[42][l]*alpha_vdim[100][l]+f[53][l]*alpha_vdim[92][l])+(0.7745966692414833*f[50][l]+0.8660254037844386*f[18][l])*alpha_vdim[89][l]+(0.7745966692414833*f[77][l]+0.8660254037844386*(f[63][l]+f[62][l])+0.9682458365518543*f[30][l])*alpha_vdim[86][l]+0.8660254037844386*f[31][l]*alpha_vdim[85][l]+(0.8660254037844386*f[70][l]+0.9682458365518543*f[42][l])*alpha_vdim[83][l]+0.8660254037844386*f[69][l]*alpha_vdim[82][l]+0.9682458365518543*(f[43][l]*alpha_vdim[82][l]+f[53][l]*alpha_vdim[81][l])+0.3872983346207416*(alpha_cdim[2][l]*f[75][l]+alpha_vdim[1][l]*f[74][l])+0.4330127018922193*alpha_cdim[0][l]*f[65][l]+(0.3872983346207416*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[64][l]+0.3464101615137755*(alpha_vdim[6][l]*f[62][l]+alpha_vdim[8][l]*f[58][l])+0.4330127018922193*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[49][l]+(0.3464101615137755*alpha_vdim[21][l]+0.3872983346207416*alpha_vdim[3][l])*f[42][l]+0.3464101615137755*alpha_vdim[25][l]*f[39][l]+0.3872983346207416*(alpha_vdim[4][l]*f[39][l]+alpha_vdim[6][l]*f[30][l]+alpha_vdim[8][l]*f[27][l]);
+    out[72][l] += (0.6185895741317419*f[66][l]+0.9682458365518543*f[38][l])*alpha_vdim[106][l]+(0.5532833351724881*f[32][l]+0.8660254037844386*f[7][l])*alpha_vdim[100][l]+(0.6185895741317419*f[54][l]+0.9682458365518543*f[22][l])*alpha_vdim[92][l]+0.8660254037844386*f[51][l]*alpha_vdim[89][l]+0.7745966692414833*f[15][l]*alpha_vdim[86][l]+0.9682458365518543*f[66][l]*alpha_vdim[85][l]+0.8660254037844386*(f[32][l]*alpha_vdim[83][l]+f[33][l]*alpha_vdim[82][l])+0.9682458365518543*f[54][l]*alpha_vdim[81][l]+0.6185895741317419*alpha_vdim[25][l]*f[67][l]+0.9682458365518543*(alpha_vdim[4][l]*f[67][l]+alpha_cdim[0][l]*f[56][l])+(0.6185895741317419*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[55][l]+0.8660254037844386*alpha_vdim[8][l]*f[52][l]+0.9682458365518543*alpha_vdim[25][l]*f[40][l]+0.8660254037844386*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[34][l]+(0.5532833351724881*alpha_vdim[21][l]+0.8660254037844386*alpha_vdim[3][l])*f[32][l]+0.9682458365518543*alpha_vdim[11][l]*f[24][l]+0.8660254037844386*f[7][l]*alpha_vdim[21][l]+0.7745966692414833*alpha_vdim[6][l]*f[15][l];
+    out[73][l] += (0.6185895741317419*f[66][l]+0.9682458365518543*f[38][l])*alpha_vdim[183][l]+(0.5532833351724881*f[35][l]+0.8660254037844386*f[9][l])*alpha_vdim[181][l]+(0.6185895741317419*f[57][l]+0.9682458365518543*f[26][l])*alpha_vdim[173][l]+0.8660254037844386*f[51][l]*alpha_vdim[168][l]+0.7745966692414833*f[16][l]*alpha_vdim[167][l]+0.9682458365518543*f[66][l]*alpha_vdim[165][l]+0.8660254037844386*(f[35][l]*alpha_vdim[164][l]+f[36][l]*alpha_vdim[163][l])+0.9682458365518543*f[57][l]*alpha_vdim[162][l]+0.6185895741317419*alpha_vdim[21][l]*f[69][l]+0.9682458365518543*(alpha_vdim[3][l]*f[69][l]+alpha_cdim[0][l]*f[61][l])+(0.6185895741317419*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[60][l]+0.8660254037844386*alpha_vdim[6][l]*f[53][l]+0.9682458365518543*alpha_vdim[21][l]*f[43][l]+0.8660254037844386*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[41][l]+(0.5532833351724881*alpha_vdim[25][l]+0.8660254037844386*alpha_vdim[4][l])*f[35][l]+0.9682458365518543*alpha_vdim[11][l]*f[29][l]+0.8660254037844386*f[9][l]*alpha_vdim[25][l]+0.7745966692414833*alpha_vdim[8][l]*f[16][l];
+    out[74][l] += (0.5532833351724881*f[37][l]+0.8660254037844386*f[10][l])*alpha_vdim[183][l]+(0.6185895741317419*f[67][l]+0.9682458365518543*f[40][l])*alpha_vdim[181][l]+(0.6185895741317419*f[58][l]+0.9682458365518543*f[27][l])*alpha_vdim[173][l]+0.7745966692414833*f[17][l]*alpha_vdim[168][l]+0.8660254037844386*(f[52][l]*alpha_vdim[167][l]+f[37][l]*alpha_vdim[165][l])+0.9682458365518543*f[67][l]*alpha_vdim[164][l]+0.8660254037844386*f[39][l]*alpha_vdim[163][l]+0.9682458365518543*f[58][l]*alpha_vdim[162][l]+(0.5532833351724881*f[37][l]+0.8660254037844386*f[10][l])*alpha_vdim[106][l]+(0.6185895741317419*f[69][l]+0.9682458365518543*f[43][l])*alpha_vdim[100][l]+(0.6185895741317419*f[62][l]+0.9682458365518543*f[30][l])*alpha_vdim[92][l]+0.7745966692414833*f[17][l]*alpha_vdim[89][l]+0.8660254037844386*(f[53][l]*alpha_vdim[86][l]+f[37][l]*alpha_vdim[85][l])+0.9682458365518543*f[69][l]*alpha_vdim[83][l]+0.8660254037844386*f[42][l]*alpha_vdim[82][l]+0.9682458365518543*(f[62][l]*alpha_vdim[81][l]+alpha_cdim[2][l]*f[71][l]+alpha_cdim[0][l]*f[64][l]);
+    out[75][l] += 0.8660254037844386*(f[66][l]*alpha_vdim[183][l]+f[67][l]*alpha_vdim[181][l])+0.9682458365518543*f[76][l]*alpha_vdim[173][l]+0.8660254037844386*(f[51][l]*alpha_vdim[168][l]+f[52][l]*alpha_vdim[167][l]+f[38][l]*alpha_vdim[165][l]+f[40][l]*alpha_vdim[164][l])+0.9682458365518543*(f[68][l]*alpha_vdim[163][l]+f[59][l]*alpha_vdim[162][l])+0.8660254037844386*(f[66][l]*alpha_vdim[106][l]+f[69][l]*alpha_vdim[100][l])+0.9682458365518543*f[77][l]*alpha_vdim[92][l]+0.8660254037844386*(f[51][l]*alpha_vdim[89][l]+f[53][l]*alpha_vdim[86][l]+f[38][l]*alpha_vdim[85][l]+f[43][l]*alpha_vdim[83][l])+0.9682458365518543*(f[70][l]*alpha_vdim[82][l]+f[63][l]*alpha_vdim[81][l]+alpha_vdim[11][l]*f[78][l]+alpha_vdim[1][l]*f[71][l])+0.8660254037844386*(alpha_vdim[21][l]*f[69][l]+alpha_vdim[25][l]*f[67][l])+0.9682458365518543*alpha_vdim[0][l]*f[65][l]+0.8660254037844386*(alpha_vdim[6][l]*f[53][l]+alpha_vdim[8][l]*f[52][l]+alpha_vdim[3][l]*f[43][l]+alpha_vdim[4][l]*f[40][l]);
+    out[76][l] += (0.2474358296526967*f[54][l]+0.3872983346207416*f[22][l])*alpha_vdim[183][l]+(0.2474358296526967*f[55][l]+0.3872983346207416*f[24][l])*alpha_vdim[181][l]+(0.276641667586244*f[72][l]+0.4330127018922193*f[46][l])*alpha_vdim[173][l]+0.3464101615137755*(f[33][l]*alpha_vdim[168][l]+f[34][l]*alpha_vdim[167][l])+0.3872983346207416*(f[54][l]*alpha_vdim[165][l]+f[55][l]*alpha_vdim[164][l]+f[56][l]*alpha_vdim[163][l])+0.4330127018922193*f[72][l]*alpha_vdim[162][l]+(0.5532833351724881*f[77][l]+0.8660254037844386*f[63][l]+0.6185895741317419*f[54][l]+0.9682458365518543*f[22][l])*alpha_vdim[106][l]+(0.5532833351724881*f[50][l]+0.8660254037844386*f[18][l])*alpha_vdim[100][l]+(0.6185895741317419*f[66][l]+0.9682458365518543*f[38][l])*alpha_vdim[92][l]+(0.7745966692414833*f[70][l]+0.8660254037844386*f[33][l])*alpha_vdim[89][l]+0.7745966692414833*f[31][l]*alpha_vdim[86][l]+(0.8660254037844386*f[77][l]+0.9682458365518543*f[54][l])*alpha_vdim[85][l]+0.8660254037844386*(f[50][l]*alpha_vdim[83][l]+f[51][l]*alpha_vdim[82][l])+0.9682458365518543*f[66][l]*alpha_vdim[81][l]+(0.5532833351724881*alpha_vdim[25][l]+0.8660254037844386*alpha_vdim[4][l])*f[78][l]+0.7745966692414833*alpha_vdim[8][l]*f[71][l]+0.9682458365518543*alpha_cdim[0][l]*f[68][l]+(0.6185895741317419*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[67][l]+0.8660254037844386*alpha_vdim[25][l]*f[65][l]+(0.6185895741317419*alpha_vdim[25][l]+0.9682458365518543*alpha_vdim[4][l])*f[55][l]+0.8660254037844386*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[52][l]+(0.5532833351724881*alpha_vdim[21][l]+0.8660254037844386*alpha_vdim[3][l])*f[50][l]+0.9682458365518543*alpha_vdim[11][l]*f[40][l]+0.8660254037844386*alpha_vdim[8][l]*f[34][l]+0.7745966692414833*alpha_vdim[6][l]*f[31][l]+0.9682458365518543*f[24][l]*alpha_vdim[25][l]+0.8660254037844386*f[18][l]*alpha_vdim[21][l];
+    out[77][l] += (0.5532833351724881*f[76][l]+0.8660254037844386*f[59][l]+0.6185895741317419*f[57][l]+0.9682458365518543*f[26][l])*alpha_vdim[183][l]+(0.5532833351724881*f[50][l]+0.8660254037844386*f[18][l])*alpha_vdim[181][l]+(0.6185895741317419*f[66][l]+0.9682458365518543*f[38][l])*alpha_vdim[173][l]+(0.7745966692414833*f[68][l]+0.8660254037844386*f[36][l])*alpha_vdim[168][l]+0.7745966692414833*f[31][l]*alpha_vdim[167][l]+(0.8660254037844386*f[76][l]+0.9682458365518543*f[57][l])*alpha_vdim[165][l]+0.8660254037844386*(f[50][l]*alpha_vdim[164][l]+f[51][l]*alpha_vdim[163][l])+0.9682458365518543*f[66][l]*alpha_vdim[162][l]+(0.2474358296526967*f[57][l]+0.3872983346207416*f[26][l])*alpha_vdim[106][l]+(0.2474358296526967*f[60][l]+0.3872983346207416*f[29][l])*alpha_vdim[100][l]+(0.276641667586244*f[73][l]+0.4330127018922193*f[48][l])*alpha_vdim[92][l]+0.3464101615137755*(f[36][l]*alpha_vdim[89][l]+f[41][l]*alpha_vdim[86][l])+0.3872983346207416*(f[57][l]*alpha_vdim[85][l]+f[60][l]*alpha_vdim[83][l]+f[61][l]*alpha_vdim[82][l])+0.4330127018922193*f[73][l]*alpha_vdim[81][l]+(0.5532833351724881*alpha_vdim[21][l]+0.8660254037844386*alpha_vdim[3][l])*f[78][l]+0.7745966692414833*alpha_vdim[6][l]*f[71][l]+0.9682458365518543*alpha_cdim[0][l]*f[70][l]+(0.6185895741317419*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[69][l]+0.8660254037844386*alpha_vdim[21][l]*f[65][l]+(0.6185895741317419*alpha_vdim[21][l]+0.9682458365518543*alpha_vdim[3][l])*f[60][l]+0.8660254037844386*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[53][l]+(0.5532833351724881*alpha_vdim[25][l]+0.8660254037844386*alpha_vdim[4][l])*f[50][l]+0.9682458365518543*alpha_vdim[11][l]*f[43][l]+0.8660254037844386*alpha_vdim[6][l]*f[41][l]+0.7745966692414833*alpha_vdim[8][l]*f[31][l]+0.9682458365518543*alpha_vdim[21][l]*f[29][l]+0.8660254037844386*f[18][l]*alpha_vdim[25][l];
+    out[78][l] += (0.5532833351724881*f[50][l]+0.8660254037844386*f[18][l])*alpha_vdim[183][l]+(0.5532833351724881*f[76][l]+0.8660254037844386*f[59][l]+0.6185895741317419*f[58][l]+0.9682458365518543*f[27][l])*alpha_vdim[181][l]+(0.6185895741317419*f[67][l]+0.9682458365518543*f[40][l])*alpha_vdim[173][l]+0.7745966692414833*(f[31][l]*alpha_vdim[168][l]+f[68][l]*alpha_vdim[167][l])+0.8660254037844386*(f[39][l]*alpha_vdim[167][l]+f[50][l]*alpha_vdim[165][l])+(0.8660254037844386*f[76][l]+0.9682458365518543*f[58][l])*alpha_vdim[164][l]+0.8660254037844386*f[52][l]*alpha_vdim[163][l]+0.9682458365518543*f[67][l]*alpha_vdim[162][l]+(0.5532833351724881*f[50][l]+0.8660254037844386*f[18][l])*alpha_vdim[106][l]+(0.5532833351724881*f[77][l]+0.8660254037844386*f[63][l]+0.6185895741317419*f[62][l]+0.9682458365518543*f[30][l])*alpha_vdim[100][l]+(0.6185895741317419*f[69][l]+0.9682458365518543*f[43][l])*alpha_vdim[92][l]+0.7745966692414833*(f[31][l]*alpha_vdim[89][l]+f[70][l]*alpha_vdim[86][l])+0.8660254037844386*(f[42][l]*alpha_vdim[86][l]+f[50][l]*alpha_vdim[85][l])+(0.8660254037844386*f[77][l]+0.9682458365518543*f[62][l])*alpha_vdim[83][l]+0.8660254037844386*f[53][l]*alpha_vdim[82][l]+0.9682458365518543*f[69][l]*alpha_vdim[81][l]+0.8660254037844386*alpha_cdim[2][l]*f[79][l]+(0.276641667586244*alpha_vdim[11][l]+0.4330127018922193*alpha_vdim[0][l])*f[74][l]+0.9682458365518543*alpha_cdim[0][l]*f[71][l]+(0.9682458365518543*alpha_cdim[2][l]+0.3872983346207416*alpha_vdim[1][l])*f[64][l]+(0.2474358296526967*alpha_vdim[21][l]+0.3872983346207416*alpha_vdim[3][l])*f[62][l]+(0.2474358296526967*alpha_vdim[25][l]+0.3872983346207416*alpha_vdim[4][l])*f[58][l]+0.4330127018922193*alpha_vdim[11][l]*f[49][l]+0.3464101615137755*(alpha_vdim[6][l]*f[42][l]+alpha_vdim[8][l]*f[39][l])+0.3872983346207416*(alpha_vdim[21][l]*f[30][l]+alpha_vdim[25][l]*f[27][l]);
+    out[79][l] += 0.7745966692414833*(f[51][l]*alpha_vdim[183][l]+f[52][l]*alpha_vdim[181][l])+0.8660254037844386*f[68][l]*alpha_vdim[173][l]+(0.7745966692414833*f[66][l]+0.8660254037844386*f[38][l])*alpha_vdim[168][l]+0.7745966692414833*f[67][l]*alpha_vdim[167][l]+0.8660254037844386*(f[40][l]*alpha_vdim[167][l]+f[51][l]*alpha_vdim[165][l]+f[52][l]*alpha_vdim[164][l]+f[76][l]*alpha_vdim[163][l])+0.9682458365518543*(f[59][l]*alpha_vdim[163][l]+f[68][l]*alpha_vdim[162][l])+0.7745966692414833*(f[51][l]*alpha_vdim[106][l]+f[53][l]*alpha_vdim[100][l])+0.8660254037844386*f[70][l]*alpha_vdim[92][l]+(0.7745966692414833*f[66][l]+0.8660254037844386*f[38][l])*alpha_vdim[89][l]+0.7745966692414833*f[69][l]*alpha_vdim[86][l]+0.8660254037844386*(f[43][l]*alpha_vdim[86][l]+f[51][l]*alpha_vdim[85][l]+f[53][l]*alpha_vdim[83][l]+f[77][l]*alpha_vdim[82][l])+0.9682458365518543*(f[63][l]*alpha_vdim[82][l]+f[70][l]*alpha_vdim[81][l])+0.8660254037844386*alpha_vdim[1][l]*f[78][l]+0.4330127018922193*alpha_cdim[0][l]*f[75][l]+(0.8660254037844386*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[71][l]+0.7745966692414833*(alpha_vdim[6][l]*f[69][l]+alpha_vdim[8][l]*f[67][l])+(0.3872983346207416*alpha_cdim[2][l]+0.9682458365518543*alpha_vdim[1][l])*f[65][l]+(0.7745966692414833*alpha_vdim[21][l]+0.8660254037844386*alpha_vdim[3][l])*f[53][l]+0.7745966692414833*alpha_vdim[25][l]*f[52][l]+0.8660254037844386*(alpha_vdim[4][l]*f[52][l]+alpha_vdim[6][l]*f[43][l]+alpha_vdim[8][l]*f[40][l]);
+    out[80][l] += (0.5532833351724881*f[66][l]+0.8660254037844386*f[38][l])*alpha_vdim[183][l]+(0.5532833351724881*f[67][l]+0.8660254037844386*f[40][l])*alpha_vdim[181][l]+(0.6185895741317419*f[76][l]+0.9682458365518543*f[59][l])*alpha_vdim[173][l]+0.7745966692414833*(f[51][l]*alpha_vdim[168][l]+f[52][l]*alpha_vdim[167][l])+0.8660254037844386*(f[66][l]*alpha_vdim[165][l]+f[67][l]*alpha_vdim[164][l]+f[68][l]*alpha_vdim[163][l])+0.9682458365518543*f[76][l]*alpha_vdim[162][l]+(0.5532833351724881*f[66][l]+0.8660254037844386*f[38][l])*alpha_vdim[106][l]+(0.5532833351724881*f[69][l]+0.8660254037844386*f[43][l])*alpha_vdim[100][l]+(0.6185895741317419*f[77][l]+0.9682458365518543*f[63][l])*alpha_vdim[92][l]+0.7745966692414833*(f[51][l]*alpha_vdim[89][l]+f[53][l]*alpha_vdim[86][l])+0.8660254037844386*(f[66][l]*alpha_vdim[85][l]+f[69][l]*alpha_vdim[83][l]+f[70][l]*alpha_vdim[82][l])+0.9682458365518543*(f[77][l]*alpha_vdim[81][l]+alpha_cdim[0][l]*f[79][l])+(0.6185895741317419*alpha_vdim[11][l]+0.9682458365518543*alpha_vdim[0][l])*f[78][l]+0.8660254037844386*(alpha_cdim[2][l]+alpha_vdim[1][l])*f[71][l]+(0.5532833351724881*alpha_vdim[21][l]+0.8660254037844386*alpha_vdim[3][l])*f[69][l]+(0.5532833351724881*alpha_vdim[25][l]+0.8660254037844386*alpha_vdim[4][l])*f[67][l]+0.9682458365518543*alpha_vdim[11][l]*f[65][l]+0.7745966692414833*(alpha_vdim[6][l]*f[53][l]+alpha_vdim[8][l]*f[52][l])+0.8660254037844386*(alpha_vdim[21][l]*f[43][l]+alpha_vdim[25][l]*f[40][l]);
+
+    cfl[l] = cflFreq_mid;
+  } 
+} 
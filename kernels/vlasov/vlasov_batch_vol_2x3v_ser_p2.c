@@ -0,0 +1,239 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_vol_2x3v_ser_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_vol_2x3v_ser_p2: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // field:      q/m*EM fields.
+  // cot_vec:   Only used in gen geo.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv0dx0 = dxv[2]/dxv[0];
+  double dv1dx1 = dxv[3]/dxv[1];
+  const double dv10 = 2/dxv[2];
+  const double *E0 = &field[0];
+  const double dv11 = 2/dxv[3];
+  const double *E1 = &field[8];
+  const double dv12 = 2/dxv[4];
+  const double *E2 = &field[16];
+  const double *B0 = &field[24];
+  const double *B1 = &field[32];
+  const double *B2 = &field[40];
+
+  double alpha_cdim[224][GKYL_VLASOV_BATCH] = {{0.0}};
+  double alpha_vdim[336][GKYL_VLASOV_BATCH] = {{0.0}};
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w0dx0 = w[2][l]/dxv[0];
+    double w1dx1 = w[3][l]/dxv[1];
+    const double dv1 = dxv[2], wv1 = w[2][l];
+    const double dv2 = dxv[3], wv2 = w[3][l];
+    const double dv3 = dxv[4], wv3 = w[4][l];
+
+    double cflFreq_mid = 0.0;
+
+    alpha_cdim[0][l] = 11.31370849898477*w0dx0;
+    alpha_cdim[3][l] = 3.265986323710906*dv0dx0;
+    cflFreq_mid += 5.0*(fabs(w0dx0)+0.5*dv0dx0);
+
+    alpha_cdim[112][l] = 11.31370849898477*w1dx1;
+    alpha_cdim[116][l] = 3.265986323710906*dv1dx1;
+    cflFreq_mid += 5.0*(fabs(w1dx1)+0.5*dv1dx1);
+
+    alpha_vdim[0][l] = dv10*(2.828427124746191*(B2[0]*wv2+E0[0])-2.828427124746191*B1[0]*wv3);
+    alpha_vdim[1][l] = dv10*(2.828427124746191*(B2[1]*wv2+E0[1])-2.828427124746191*B1[1]*wv3);
+    alpha_vdim[2][l] = dv10*(2.828427124746191*(B2[2]*wv2+E0[2])-2.828427124746191*B1[2]*wv3);
+    alpha_vdim[4][l] = 0.8164965809277261*B2[0]*dv10*dv2;
+    alpha_vdim[5][l] = -0.8164965809277261*B1[0]*dv10*dv3;
+    alpha_vdim[6][l] = dv10*(2.828427124746191*(B2[3]*wv2+E0[3])-2.828427124746191*B1[3]*wv3);
+    alpha_vdim[9][l] = 0.8164965809277261*B2[1]*dv10*dv2;
+    alpha_vdim[10][l] = 0.8164965809277261*B2[2]*dv10*dv2;
+    alpha_vdim[12][l] = -0.8164965809277261*B1[1]*dv10*dv3;
+    alpha_vdim[13][l] = -0.8164965809277261*B1[2]*dv10*dv3;
+    alpha_vdim[16][l] = dv10*(2.828427124746191*(B2[4]*wv2+E0[4])-2.828427124746191*B1[4]*wv3);
+    alpha_vdim[17][l] = dv10*(2.828427124746191*(B2[5]*wv2+E0[5])-2.828427124746191*B1[5]*wv3);
+    alpha_vdim[22][l] = 0.8164965809277261*B2[3]*dv10*dv2;
+    alpha_vdim[25][l] = -0.8164965809277261*B1[3]*dv10*dv3;
+    alpha_vdim[31][l] = dv10*(2.828427124746191*(B2[6]*wv2+E0[6])-2.828427124746191*B1[6]*wv3);
+    alpha_vdim[32][l] = dv10*(2.828427124746191*(B2[7]*wv2+E0[7])-2.828427124746191*B1[7]*wv3);
+    alpha_vdim[37][l] = 0.8164965809277261*B2[4]*dv10*dv2;
+    alpha_vdim[38][l] = 0.8164965809277261*B2[5]*dv10*dv2;
+    alpha_vdim[43][l] = -0.8164965809277261*B1[4]*dv10*dv3;
+    alpha_vdim[44][l] = -0.8164965809277261*B1[5]*dv10*dv3;
+    alpha_vdim[59][l] = 0.8164965809277261*B2[6]*dv10*dv2;
+    alpha_vdim[60][l] = 0.8164965809277261*B2[7]*dv10*dv2;
+    alpha_vdim[68][l] = -0.8164965809277261*B1[6]*dv10*dv3;
+    alpha_vdim[69][l] = -0.8164965809277261*B1[7]*dv10*dv3;
+    cflFreq_mid += 5.0*fabs(0.0883883476483184*alpha_vdim[0][l]-0.09882117688026182*(alpha_vdim[17][l]+alpha_vdim[16][l]));
+
+    alpha_vdim[112][l] = dv11*(2.828427124746191*B0[0]*wv3-2.828427124746191*B2[0]*wv1+2.828427124746191*E1[0]);
+    alpha_vdim[113][l] = dv11*(2.828427124746191*B0[1]*wv3-2.828427124746191*B2[1]*wv1+2.828427124746191*E1[1]);
+    alpha_vdim[114][l] = dv11*(2.828427124746191*B0[2]*wv3-2.828427124746191*B2[2]*wv1+2.828427124746191*E1[2]);
+    alpha_vdim[115][l] = -0.8164965809277261*B2[0]*dv1*dv11;
+    alpha_vdim[117][l] = 0.8164965809277261*B0[0]*dv11*dv3;
+    alpha_vdim[118][l] = dv11*(2.828427124746191*B0[3]*wv3-2.828427124746191*B2[3]*wv1+2.828427124746191*E1[3]);
+    alpha_vdim[119][l] = -0.8164965809277261*B2[1]*dv1*dv11;
+    alpha_vdim[120][l] = -0.8164965809277261*B2[2]*dv1*dv11;
+    alpha_vdim[124][l] = 0.8164965809277261*B0[1]*dv11*dv3;
+    alpha_vdim[125][l] = 0.8164965809277261*B0[2]*dv11*dv3;
+    alpha_vdim[128][l] = dv11*(2.828427124746191*B0[4]*wv3-2.828427124746191*B2[4]*wv1+2.828427124746191*E1[4]);
+    alpha_vdim[129][l] = dv11*(2.828427124746191*B0[5]*wv3-2.828427124746191*B2[5]*wv1+2.828427124746191*E1[5]);
+    alpha_vdim[133][l] = -0.8164965809277261*B2[3]*dv1*dv11;
+    alpha_vdim[137][l] = 0.8164965809277261*B0[3]*dv11*dv3;
+    alpha_vdim[143][l] = dv11*(2.828427124746191*B0[6]*wv3-2.828427124746191*B2[6]*wv1+2.828427124746191*E1[6]);
+    alpha_vdim[144][l] = dv11*(2.828427124746191*B0[7]*wv3-2.828427124746191*B2[7]*wv1+2.828427124746191*E1[7]);
+    alpha_vdim[145][l] = -0.8164965809277261*B2[4]*dv1*dv11;
+    alpha_vdim[146][l] = -0.8164965809277261*B2[5]*dv1*dv11;
+    alpha_vdim[155][l] = 0.8164965809277261*B0[4]*dv11*dv3;
+    alpha_vdim[156][l] = 0.8164965809277261*B0[5]*dv11*dv3;
+    alpha_vdim[168][l] = -0.8164965809277261*B2[6]*dv1*dv11;
+    alpha_vdim[169][l] = -0.8164965809277261*B2[7]*dv1*dv11;
+    alpha_vdim[180][l] = 0.8164965809277261*B0[6]*dv11*dv3;
+    alpha_vdim[181][l] = 0.8164965809277261*B0[7]*dv11*dv3;
+    cflFreq_mid += 5.0*fabs(0.0883883476483184*alpha_vdim[112][l]-0.09882117688026182*(alpha_vdim[129][l]+alpha_vdim[128][l]));
+
+    alpha_vdim[224][l] = dv12*(2.828427124746191*(B1[0]*wv1+E2[0])-2.828427124746191*B0[0]*wv2);
+    alpha_vdim[225][l] = dv12*(2.828427124746191*(B1[1]*wv1+E2[1])-2.828427124746191*B0[1]*wv2);
+    alpha_vdim[226][l] = dv12*(2.828427124746191*(B1[2]*wv1+E2[2])-2.828427124746191*B0[2]*wv2);
+    alpha_vdim[227][l] = 0.8164965809277261*B1[0]*dv1*dv12;
+    alpha_vdim[228][l] = -0.8164965809277261*B0[0]*dv12*dv2;
+    alpha_vdim[230][l] = dv12*(2.828427124746191*(B1[3]*wv1+E2[3])-2.828427124746191*B0[3]*wv2);
+    alpha_vdim[231][l] = 0.8164965809277261*B1[1]*dv1*dv12;
+    alpha_vdim[232][l] = 0.8164965809277261*B1[2]*dv1*dv12;
+    alpha_vdim[233][l] = -0.8164965809277261*B0[1]*dv12*dv2;
+    alpha_vdim[234][l] = -0.8164965809277261*B0[2]*dv12*dv2;
+    alpha_vdim[240][l] = dv12*(2.828427124746191*(B1[4]*wv1+E2[4])-2.828427124746191*B0[4]*wv2);
+    alpha_vdim[241][l] = dv12*(2.828427124746191*(B1[5]*wv1+E2[5])-2.828427124746191*B0[5]*wv2);
+    alpha_vdim[245][l] = 0.8164965809277261*B1[3]*dv1*dv12;
+    alpha_vdim[246][l] = -0.8164965809277261*B0[3]*dv12*dv2;
+    alpha_vdim[255][l] = dv12*(2.828427124746191*(B1[6]*wv1+E2[6])-2.828427124746191*B0[6]*wv2);
+    alpha_vdim[256][l] = dv12*(2.828427124746191*(B1[7]*wv1+E2[7])-2.828427124746191*B0[7]*wv2);
+    alpha_vdim[257][l] = 0.8164965809277261*B1[4]*dv1*dv12;
+    alpha_vdim[258][l] = 0.8164965809277261*B1[5]*dv1*dv12;
+    alpha_vdim[261][l] = -0.8164965809277261*B0[4]*dv12*dv2;
+    alpha_vdim[262][l] = -0.8164965809277261*B0[5]*dv12*dv2;
+    alpha_vdim[280][l] = 0.8164965809277261*B1[6]*dv1*dv12;
+    alpha_vdim[281][l] = 0.8164965809277261*B1[7]*dv1*dv12;
+    alpha_vdim[283][l] = -0.8164965809277261*B0[6]*dv12*dv2;
+    alpha_vdim[284][l] = -0.8164965809277261*B0[7]*dv12*dv2;
+    cflFreq_mid += 5.0*fabs(0.0883883476483184*alpha_vdim[224][l]-0.09882117688026182*(alpha_vdim[241][l]+alpha_vdim[240][l]));
+
+    out[1][l] += 0.3061862178478971*(alpha_cdim[3][l]*f[3][l]+alpha_cdim[0][l]*f[0][l]);
+    out[2][l] += 0.3061862178478971*(f[4][l]*alpha_cdim[116][l]+f[0][l]*alpha_cdim[112][l]);
+    out[3][l] += 0.3061862178478971*(alpha_vdim[69][l]*f[69][l]+alpha_vdim[68][l]*f[68][l]+alpha_vdim[60][l]*f[60][l]+alpha_vdim[59][l]*f[59][l]+alpha_vdim[44][l]*f[44][l]+alpha_vdim[43][l]*f[43][l]+alpha_vdim[38][l]*f[38][l]+alpha_vdim[37][l]*f[37][l]+alpha_vdim[32][l]*f[32][l]+alpha_vdim[31][l]*f[31][l]+alpha_vdim[25][l]*f[25][l]+alpha_vdim[22][l]*f[22][l]+alpha_vdim[17][l]*f[17][l]+alpha_vdim[16][l]*f[16][l]+alpha_vdim[13][l]*f[13][l]+alpha_vdim[12][l]*f[12][l]+alpha_vdim[10][l]*f[10][l]+alpha_vdim[9][l]*f[9][l]+alpha_vdim[6][l]*f[6][l]+alpha_vdim[5][l]*f[5][l]+alpha_vdim[4][l]*f[4][l]+alpha_vdim[2][l]*f[2][l]+alpha_vdim[1][l]*f[1][l]+alpha_vdim[0][l]*f[0][l]);
+    out[4][l] += 0.3061862178478971*(f[69][l]*alpha_vdim[181][l]+f[68][l]*alpha_vdim[180][l]+f[57][l]*alpha_vdim[169][l]+f[56][l]*alpha_vdim[168][l]+f[44][l]*alpha_vdim[156][l]+f[43][l]*alpha_vdim[155][l]+f[34][l]*alpha_vdim[146][l]+f[33][l]*alpha_vdim[145][l]+f[32][l]*alpha_vdim[144][l]+f[31][l]*alpha_vdim[143][l]+f[25][l]*alpha_vdim[137][l]+f[21][l]*alpha_vdim[133][l]+f[17][l]*alpha_vdim[129][l]+f[16][l]*alpha_vdim[128][l]+f[13][l]*alpha_vdim[125][l]+f[12][l]*alpha_vdim[124][l]+f[8][l]*alpha_vdim[120][l]+f[7][l]*alpha_vdim[119][l]+f[6][l]*alpha_vdim[118][l]+f[5][l]*alpha_vdim[117][l]+f[3][l]*alpha_vdim[115][l]+f[2][l]*alpha_vdim[114][l]+f[1][l]*alpha_vdim[113][l]+f[0][l]*alpha_vdim[112][l]);
+    out[5][l] += 0.3061862178478971*(f[60][l]*alpha_vdim[284][l]+f[59][l]*alpha_vdim[283][l]+f[57][l]*alpha_vdim[281][l]+f[56][l]*alpha_vdim[280][l]+f[38][l]*alpha_vdim[262][l]+f[37][l]*alpha_vdim[261][l]+f[34][l]*alpha_vdim[258][l]+f[33][l]*alpha_vdim[257][l]+f[32][l]*alpha_vdim[256][l]+f[31][l]*alpha_vdim[255][l]+f[22][l]*alpha_vdim[246][l]+f[21][l]*alpha_vdim[245][l]+f[17][l]*alpha_vdim[241][l]+f[16][l]*alpha_vdim[240][l]+f[10][l]*alpha_vdim[234][l]+f[9][l]*alpha_vdim[233][l]+f[8][l]*alpha_vdim[232][l]+f[7][l]*alpha_vdim[231][l]+f[6][l]*alpha_vdim[230][l]+f[4][l]*alpha_vdim[228][l]+f[3][l]*alpha_vdim[227][l]+f[2][l]*alpha_vdim[226][l]+f[1][l]*alpha_vdim[225][l]+f[0][l]*alpha_vdim[224][l]);
+    out[6][l] += 0.3061862178478971*(f[9][l]*alpha_cdim[116][l]+f[1][l]*alpha_cdim[112][l]+alpha_cdim[3][l]*f[8][l]+alpha_cdim[0][l]*f[2][l]);
+    out[7][l] += 0.3061862178478971*(alpha_vdim[44][l]*f[69][l]+f[44][l]*alpha_vdim[69][l])+0.273861278752583*(alpha_vdim[25][l]*f[68][l]+f[25][l]*alpha_vdim[68][l])+0.3061862178478971*(alpha_vdim[38][l]*f[60][l]+f[38][l]*alpha_vdim[60][l])+0.273861278752583*(alpha_vdim[22][l]*f[59][l]+f[22][l]*alpha_vdim[59][l]+alpha_vdim[12][l]*f[43][l]+f[12][l]*alpha_vdim[43][l]+alpha_vdim[9][l]*f[37][l]+f[9][l]*alpha_vdim[37][l])+0.3061862178478971*(alpha_vdim[17][l]*f[32][l]+f[17][l]*alpha_vdim[32][l])+0.273861278752583*(alpha_vdim[6][l]*f[31][l]+f[6][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[13][l]*f[25][l]+f[13][l]*alpha_vdim[25][l]+alpha_vdim[10][l]*f[22][l]+f[10][l]*alpha_vdim[22][l])+0.273861278752583*(alpha_cdim[3][l]*f[18][l]+alpha_vdim[1][l]*f[16][l]+f[1][l]*alpha_vdim[16][l])+0.3061862178478971*(alpha_vdim[5][l]*f[12][l]+f[5][l]*alpha_vdim[12][l]+alpha_vdim[4][l]*f[9][l]+f[4][l]*alpha_vdim[9][l]+alpha_vdim[2][l]*f[6][l]+f[2][l]*alpha_vdim[6][l]+alpha_cdim[0][l]*f[3][l]+f[0][l]*alpha_cdim[3][l]+alpha_vdim[0][l]*f[1][l]+f[0][l]*alpha_vdim[1][l]);
+    out[8][l] += 0.3061862178478971*(f[11][l]*alpha_cdim[116][l]+f[3][l]*alpha_cdim[112][l])+0.273861278752583*(alpha_vdim[25][l]*f[69][l]+f[25][l]*alpha_vdim[69][l])+0.3061862178478971*(alpha_vdim[43][l]*f[68][l]+f[43][l]*alpha_vdim[68][l])+0.273861278752583*(alpha_vdim[22][l]*f[60][l]+f[22][l]*alpha_vdim[60][l])+0.3061862178478971*(alpha_vdim[37][l]*f[59][l]+f[37][l]*alpha_vdim[59][l])+0.273861278752583*(alpha_vdim[13][l]*f[44][l]+f[13][l]*alpha_vdim[44][l]+alpha_vdim[10][l]*f[38][l]+f[10][l]*alpha_vdim[38][l]+alpha_vdim[6][l]*f[32][l]+f[6][l]*alpha_vdim[32][l])+0.3061862178478971*(alpha_vdim[16][l]*f[31][l]+f[16][l]*alpha_vdim[31][l]+alpha_vdim[12][l]*f[25][l]+f[12][l]*alpha_vdim[25][l]+alpha_vdim[9][l]*f[22][l]+f[9][l]*alpha_vdim[22][l])+0.273861278752583*(alpha_vdim[2][l]*f[17][l]+f[2][l]*alpha_vdim[17][l])+0.3061862178478971*(alpha_vdim[5][l]*f[13][l]+f[5][l]*alpha_vdim[13][l]+alpha_vdim[4][l]*f[10][l]+f[4][l]*alpha_vdim[10][l]+alpha_vdim[1][l]*f[6][l]+f[1][l]*alpha_vdim[6][l]+alpha_vdim[0][l]*f[2][l]+f[0][l]*alpha_vdim[2][l]);
+    out[9][l] += 0.3061862178478971*f[44][l]*alpha_vdim[181][l]+0.273861278752583*f[25][l]*alpha_vdim[180][l]+0.3061862178478971*f[34][l]*alpha_vdim[169][l]+0.273861278752583*f[21][l]*alpha_vdim[168][l]+0.3061862178478971*f[69][l]*alpha_vdim[156][l]+0.273861278752583*f[12][l]*alpha_vdim[155][l]+0.3061862178478971*f[57][l]*alpha_vdim[146][l]+0.273861278752583*f[7][l]*alpha_vdim[145][l]+0.3061862178478971*f[17][l]*alpha_vdim[144][l]+0.273861278752583*f[6][l]*alpha_vdim[143][l]+(0.273861278752583*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[137][l]+0.273861278752583*f[56][l]*alpha_vdim[133][l]+0.3061862178478971*(f[8][l]*alpha_vdim[133][l]+f[32][l]*alpha_vdim[129][l])+0.273861278752583*f[1][l]*alpha_vdim[128][l]+0.3061862178478971*f[25][l]*alpha_vdim[125][l]+0.273861278752583*f[43][l]*alpha_vdim[124][l]+0.3061862178478971*(f[5][l]*alpha_vdim[124][l]+f[21][l]*alpha_vdim[120][l])+(0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[119][l]+0.273861278752583*f[31][l]*alpha_vdim[118][l]+0.3061862178478971*(f[2][l]*alpha_vdim[118][l]+f[12][l]*alpha_vdim[117][l]+f[7][l]*alpha_vdim[115][l]+f[6][l]*alpha_vdim[114][l])+0.273861278752583*f[16][l]*alpha_vdim[113][l]+0.3061862178478971*(f[0][l]*alpha_vdim[113][l]+f[1][l]*alpha_vdim[112][l]+alpha_cdim[3][l]*f[11][l]+alpha_cdim[0][l]*f[4][l]);
+    out[10][l] += 0.273861278752583*f[25][l]*alpha_vdim[181][l]+0.3061862178478971*f[43][l]*alpha_vdim[180][l]+0.273861278752583*f[21][l]*alpha_vdim[169][l]+0.3061862178478971*f[33][l]*alpha_vdim[168][l]+0.273861278752583*f[13][l]*alpha_vdim[156][l]+0.3061862178478971*f[68][l]*alpha_vdim[155][l]+0.273861278752583*f[8][l]*alpha_vdim[146][l]+0.3061862178478971*f[56][l]*alpha_vdim[145][l]+0.273861278752583*f[6][l]*alpha_vdim[144][l]+0.3061862178478971*f[16][l]*alpha_vdim[143][l]+(0.273861278752583*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[137][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[133][l]+0.273861278752583*f[2][l]*alpha_vdim[129][l]+0.3061862178478971*f[31][l]*alpha_vdim[128][l]+0.273861278752583*f[44][l]*alpha_vdim[125][l]+0.3061862178478971*(f[5][l]*alpha_vdim[125][l]+f[25][l]*alpha_vdim[124][l])+0.273861278752583*f[34][l]*alpha_vdim[120][l]+0.3061862178478971*(f[3][l]*alpha_vdim[120][l]+f[21][l]*alpha_vdim[119][l])+0.273861278752583*f[32][l]*alpha_vdim[118][l]+0.3061862178478971*(f[1][l]*alpha_vdim[118][l]+f[13][l]*alpha_vdim[117][l])+0.273861278752583*f[19][l]*alpha_cdim[116][l]+0.3061862178478971*(f[0][l]*alpha_cdim[116][l]+f[8][l]*alpha_vdim[115][l])+0.273861278752583*f[17][l]*alpha_vdim[114][l]+0.3061862178478971*(f[0][l]*alpha_vdim[114][l]+f[6][l]*alpha_vdim[113][l]+f[2][l]*alpha_vdim[112][l]+f[4][l]*alpha_cdim[112][l]);
+    out[11][l] += 0.3061862178478971*(f[92][l]*alpha_vdim[181][l]+f[91][l]*alpha_vdim[180][l]+f[32][l]*alpha_vdim[169][l]+f[31][l]*alpha_vdim[168][l]+f[71][l]*alpha_vdim[156][l]+f[70][l]*alpha_vdim[155][l]+f[17][l]*alpha_vdim[146][l]+f[16][l]*alpha_vdim[145][l]+f[57][l]*alpha_vdim[144][l]+f[56][l]*alpha_vdim[143][l]+f[52][l]*alpha_vdim[137][l])+0.273861278752583*f[58][l]*alpha_vdim[133][l]+0.3061862178478971*(f[6][l]*alpha_vdim[133][l]+f[34][l]*alpha_vdim[129][l]+f[33][l]*alpha_vdim[128][l]+f[27][l]*alpha_vdim[125][l]+f[26][l]*alpha_vdim[124][l])+(0.273861278752583*f[36][l]+0.3061862178478971*f[2][l])*alpha_vdim[120][l]+0.273861278752583*f[35][l]*alpha_vdim[119][l]+0.3061862178478971*(f[1][l]*alpha_vdim[119][l]+f[21][l]*alpha_vdim[118][l]+f[14][l]*alpha_vdim[117][l])+0.273861278752583*f[18][l]*alpha_vdim[115][l]+0.3061862178478971*(f[0][l]*alpha_vdim[115][l]+f[8][l]*alpha_vdim[114][l]+f[7][l]*alpha_vdim[113][l]+f[3][l]*alpha_vdim[112][l]+alpha_vdim[69][l]*f[95][l]+alpha_vdim[68][l]*f[94][l]+alpha_vdim[44][l]*f[75][l]+alpha_vdim[43][l]*f[74][l])+0.273861278752583*alpha_vdim[22][l]*f[65][l]+0.3061862178478971*(alpha_vdim[32][l]*f[60][l]+f[32][l]*alpha_vdim[60][l]+alpha_vdim[31][l]*f[59][l]+f[31][l]*alpha_vdim[59][l]+alpha_vdim[25][l]*f[53][l])+0.273861278752583*(alpha_vdim[10][l]*f[41][l]+alpha_vdim[9][l]*f[40][l])+0.3061862178478971*(alpha_vdim[17][l]*f[38][l]+f[17][l]*alpha_vdim[38][l]+alpha_vdim[16][l]*f[37][l]+f[16][l]*alpha_vdim[37][l]+alpha_vdim[13][l]*f[29][l]+alpha_vdim[12][l]*f[28][l]+alpha_vdim[6][l]*f[22][l]+f[6][l]*alpha_vdim[22][l])+0.273861278752583*alpha_vdim[4][l]*f[19][l]+0.3061862178478971*(alpha_vdim[5][l]*f[15][l]+alpha_vdim[2][l]*f[10][l]+f[2][l]*alpha_vdim[10][l]+alpha_vdim[1][l]*f[9][l]+f[1][l]*alpha_vdim[9][l]+alpha_vdim[0][l]*f[4][l]+f[0][l]*alpha_vdim[4][l]);
+    out[12][l] += 0.3061862178478971*f[38][l]*alpha_vdim[284][l]+0.273861278752583*f[22][l]*alpha_vdim[283][l]+0.3061862178478971*f[34][l]*alpha_vdim[281][l]+0.273861278752583*f[21][l]*alpha_vdim[280][l]+0.3061862178478971*f[60][l]*alpha_vdim[262][l]+0.273861278752583*f[9][l]*alpha_vdim[261][l]+0.3061862178478971*f[57][l]*alpha_vdim[258][l]+0.273861278752583*f[7][l]*alpha_vdim[257][l]+0.3061862178478971*f[17][l]*alpha_vdim[256][l]+0.273861278752583*f[6][l]*alpha_vdim[255][l]+(0.273861278752583*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[246][l]+0.273861278752583*f[56][l]*alpha_vdim[245][l]+0.3061862178478971*(f[8][l]*alpha_vdim[245][l]+f[32][l]*alpha_vdim[241][l])+0.273861278752583*f[1][l]*alpha_vdim[240][l]+0.3061862178478971*f[22][l]*alpha_vdim[234][l]+0.273861278752583*f[37][l]*alpha_vdim[233][l]+0.3061862178478971*(f[4][l]*alpha_vdim[233][l]+f[21][l]*alpha_vdim[232][l])+(0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[231][l]+0.273861278752583*f[31][l]*alpha_vdim[230][l]+0.3061862178478971*(f[2][l]*alpha_vdim[230][l]+f[9][l]*alpha_vdim[228][l]+f[7][l]*alpha_vdim[227][l]+f[6][l]*alpha_vdim[226][l])+0.273861278752583*f[16][l]*alpha_vdim[225][l]+0.3061862178478971*(f[0][l]*alpha_vdim[225][l]+f[1][l]*alpha_vdim[224][l]+alpha_cdim[3][l]*f[14][l]+alpha_cdim[0][l]*f[5][l]);
+    out[13][l] += 0.273861278752583*f[22][l]*alpha_vdim[284][l]+0.3061862178478971*f[37][l]*alpha_vdim[283][l]+0.273861278752583*f[21][l]*alpha_vdim[281][l]+0.3061862178478971*f[33][l]*alpha_vdim[280][l]+0.273861278752583*f[10][l]*alpha_vdim[262][l]+0.3061862178478971*f[59][l]*alpha_vdim[261][l]+0.273861278752583*f[8][l]*alpha_vdim[258][l]+0.3061862178478971*f[56][l]*alpha_vdim[257][l]+0.273861278752583*f[6][l]*alpha_vdim[256][l]+0.3061862178478971*f[16][l]*alpha_vdim[255][l]+(0.273861278752583*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[246][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[245][l]+0.273861278752583*f[2][l]*alpha_vdim[241][l]+0.3061862178478971*f[31][l]*alpha_vdim[240][l]+0.273861278752583*f[38][l]*alpha_vdim[234][l]+0.3061862178478971*(f[4][l]*alpha_vdim[234][l]+f[22][l]*alpha_vdim[233][l])+0.273861278752583*f[34][l]*alpha_vdim[232][l]+0.3061862178478971*(f[3][l]*alpha_vdim[232][l]+f[21][l]*alpha_vdim[231][l])+0.273861278752583*f[32][l]*alpha_vdim[230][l]+0.3061862178478971*(f[1][l]*alpha_vdim[230][l]+f[10][l]*alpha_vdim[228][l]+f[8][l]*alpha_vdim[227][l])+0.273861278752583*f[17][l]*alpha_vdim[226][l]+0.3061862178478971*(f[0][l]*alpha_vdim[226][l]+f[6][l]*alpha_vdim[225][l]+f[2][l]*alpha_vdim[224][l]+f[15][l]*alpha_cdim[116][l]+f[5][l]*alpha_cdim[112][l]);
+    out[14][l] += 0.3061862178478971*(f[88][l]*alpha_vdim[284][l]+f[87][l]*alpha_vdim[283][l]+f[32][l]*alpha_vdim[281][l]+f[31][l]*alpha_vdim[280][l]+f[62][l]*alpha_vdim[262][l]+f[61][l]*alpha_vdim[261][l]+f[17][l]*alpha_vdim[258][l]+f[16][l]*alpha_vdim[257][l]+f[57][l]*alpha_vdim[256][l]+f[56][l]*alpha_vdim[255][l]+f[51][l]*alpha_vdim[246][l])+0.273861278752583*f[58][l]*alpha_vdim[245][l]+0.3061862178478971*(f[6][l]*alpha_vdim[245][l]+f[34][l]*alpha_vdim[241][l]+f[33][l]*alpha_vdim[240][l]+f[24][l]*alpha_vdim[234][l]+f[23][l]*alpha_vdim[233][l])+(0.273861278752583*f[36][l]+0.3061862178478971*f[2][l])*alpha_vdim[232][l]+0.273861278752583*f[35][l]*alpha_vdim[231][l]+0.3061862178478971*(f[1][l]*alpha_vdim[231][l]+f[21][l]*alpha_vdim[230][l]+f[11][l]*alpha_vdim[228][l])+0.273861278752583*f[18][l]*alpha_vdim[227][l]+0.3061862178478971*(f[0][l]*alpha_vdim[227][l]+f[8][l]*alpha_vdim[226][l]+f[7][l]*alpha_vdim[225][l]+f[3][l]*alpha_vdim[224][l]+alpha_vdim[60][l]*f[95][l]+alpha_vdim[59][l]*f[94][l])+0.273861278752583*alpha_vdim[25][l]*f[80][l]+0.3061862178478971*(alpha_vdim[38][l]*f[75][l]+alpha_vdim[37][l]*f[74][l]+alpha_vdim[32][l]*f[69][l]+f[32][l]*alpha_vdim[69][l]+alpha_vdim[31][l]*f[68][l]+f[31][l]*alpha_vdim[68][l]+alpha_vdim[22][l]*f[53][l])+0.273861278752583*(alpha_vdim[13][l]*f[48][l]+alpha_vdim[12][l]*f[47][l])+0.3061862178478971*(alpha_vdim[17][l]*f[44][l]+f[17][l]*alpha_vdim[44][l]+alpha_vdim[16][l]*f[43][l]+f[16][l]*alpha_vdim[43][l]+alpha_vdim[10][l]*f[29][l]+alpha_vdim[9][l]*f[28][l]+alpha_vdim[6][l]*f[25][l]+f[6][l]*alpha_vdim[25][l])+0.273861278752583*alpha_vdim[5][l]*f[20][l]+0.3061862178478971*(alpha_vdim[4][l]*f[15][l]+alpha_vdim[2][l]*f[13][l]+f[2][l]*alpha_vdim[13][l]+alpha_vdim[1][l]*f[12][l]+f[1][l]*alpha_vdim[12][l]+alpha_vdim[0][l]*f[5][l]+f[0][l]*alpha_vdim[5][l]);
+    out[15][l] += 0.3061862178478971*(f[32][l]*alpha_vdim[284][l]+f[31][l]*alpha_vdim[283][l]+f[88][l]*alpha_vdim[281][l]+f[87][l]*alpha_vdim[280][l]+f[17][l]*alpha_vdim[262][l]+f[16][l]*alpha_vdim[261][l]+f[62][l]*alpha_vdim[258][l]+f[61][l]*alpha_vdim[257][l]+f[60][l]*alpha_vdim[256][l]+f[59][l]*alpha_vdim[255][l])+0.273861278752583*f[65][l]*alpha_vdim[246][l]+0.3061862178478971*(f[6][l]*alpha_vdim[246][l]+f[51][l]*alpha_vdim[245][l]+f[38][l]*alpha_vdim[241][l]+f[37][l]*alpha_vdim[240][l])+(0.273861278752583*f[41][l]+0.3061862178478971*f[2][l])*alpha_vdim[234][l]+0.273861278752583*f[40][l]*alpha_vdim[233][l]+0.3061862178478971*(f[1][l]*alpha_vdim[233][l]+f[24][l]*alpha_vdim[232][l]+f[23][l]*alpha_vdim[231][l]+f[22][l]*alpha_vdim[230][l])+0.273861278752583*f[19][l]*alpha_vdim[228][l]+0.3061862178478971*(f[0][l]*alpha_vdim[228][l]+f[11][l]*alpha_vdim[227][l]+f[10][l]*alpha_vdim[226][l]+f[9][l]*alpha_vdim[225][l]+f[4][l]*alpha_vdim[224][l]+f[32][l]*alpha_vdim[181][l]+f[31][l]*alpha_vdim[180][l]+f[92][l]*alpha_vdim[169][l]+f[91][l]*alpha_vdim[168][l]+f[17][l]*alpha_vdim[156][l]+f[16][l]*alpha_vdim[155][l]+f[71][l]*alpha_vdim[146][l]+f[70][l]*alpha_vdim[145][l]+f[69][l]*alpha_vdim[144][l]+f[68][l]*alpha_vdim[143][l])+0.273861278752583*f[80][l]*alpha_vdim[137][l]+0.3061862178478971*(f[6][l]*alpha_vdim[137][l]+f[52][l]*alpha_vdim[133][l]+f[44][l]*alpha_vdim[129][l]+f[43][l]*alpha_vdim[128][l])+(0.273861278752583*f[48][l]+0.3061862178478971*f[2][l])*alpha_vdim[125][l]+0.273861278752583*f[47][l]*alpha_vdim[124][l]+0.3061862178478971*(f[1][l]*alpha_vdim[124][l]+f[27][l]*alpha_vdim[120][l]+f[26][l]*alpha_vdim[119][l]+f[25][l]*alpha_vdim[118][l])+0.273861278752583*f[20][l]*alpha_vdim[117][l]+0.3061862178478971*(f[0][l]*alpha_vdim[117][l]+f[14][l]*alpha_vdim[115][l]+f[13][l]*alpha_vdim[114][l]+f[12][l]*alpha_vdim[113][l]+f[5][l]*alpha_vdim[112][l]);
+    out[16][l] += 0.6846531968814573*(alpha_cdim[3][l]*f[7][l]+alpha_cdim[0][l]*f[1][l]);
+    out[17][l] += 0.6846531968814573*(f[10][l]*alpha_cdim[116][l]+f[2][l]*alpha_cdim[112][l]);
+    out[18][l] += 0.6846531968814573*(alpha_vdim[69][l]*f[92][l]+alpha_vdim[68][l]*f[91][l]+alpha_vdim[60][l]*f[88][l]+alpha_vdim[59][l]*f[87][l]+alpha_vdim[44][l]*f[71][l]+alpha_vdim[43][l]*f[70][l]+alpha_vdim[38][l]*f[62][l]+alpha_vdim[37][l]*f[61][l]+alpha_vdim[32][l]*f[57][l]+alpha_vdim[31][l]*f[56][l]+alpha_vdim[25][l]*f[52][l]+alpha_vdim[22][l]*f[51][l]+alpha_vdim[17][l]*f[34][l]+alpha_vdim[16][l]*f[33][l]+alpha_vdim[13][l]*f[27][l]+alpha_vdim[12][l]*f[26][l]+alpha_vdim[10][l]*f[24][l]+alpha_vdim[9][l]*f[23][l]+alpha_vdim[6][l]*f[21][l]+alpha_vdim[5][l]*f[14][l]+alpha_vdim[4][l]*f[11][l]+alpha_vdim[2][l]*f[8][l]+alpha_vdim[1][l]*f[7][l]+alpha_vdim[0][l]*f[3][l]);
+    out[19][l] += 0.6846531968814573*(f[95][l]*alpha_vdim[181][l]+f[94][l]*alpha_vdim[180][l]+f[88][l]*alpha_vdim[169][l]+f[87][l]*alpha_vdim[168][l]+f[75][l]*alpha_vdim[156][l]+f[74][l]*alpha_vdim[155][l]+f[62][l]*alpha_vdim[146][l]+f[61][l]*alpha_vdim[145][l]+f[60][l]*alpha_vdim[144][l]+f[59][l]*alpha_vdim[143][l]+f[53][l]*alpha_vdim[137][l]+f[51][l]*alpha_vdim[133][l]+f[38][l]*alpha_vdim[129][l]+f[37][l]*alpha_vdim[128][l]+f[29][l]*alpha_vdim[125][l]+f[28][l]*alpha_vdim[124][l]+f[24][l]*alpha_vdim[120][l]+f[23][l]*alpha_vdim[119][l]+f[22][l]*alpha_vdim[118][l]+f[15][l]*alpha_vdim[117][l]+f[11][l]*alpha_vdim[115][l]+f[10][l]*alpha_vdim[114][l]+f[9][l]*alpha_vdim[113][l]+f[4][l]*alpha_vdim[112][l]);
+    out[20][l] += 0.6846531968814573*(f[95][l]*alpha_vdim[284][l]+f[94][l]*alpha_vdim[283][l]+f[92][l]*alpha_vdim[281][l]+f[91][l]*alpha_vdim[280][l]+f[75][l]*alpha_vdim[262][l]+f[74][l]*alpha_vdim[261][l]+f[71][l]*alpha_vdim[258][l]+f[70][l]*alpha_vdim[257][l]+f[69][l]*alpha_vdim[256][l]+f[68][l]*alpha_vdim[255][l]+f[53][l]*alpha_vdim[246][l]+f[52][l]*alpha_vdim[245][l]+f[44][l]*alpha_vdim[241][l]+f[43][l]*alpha_vdim[240][l]+f[29][l]*alpha_vdim[234][l]+f[28][l]*alpha_vdim[233][l]+f[27][l]*alpha_vdim[232][l]+f[26][l]*alpha_vdim[231][l]+f[25][l]*alpha_vdim[230][l]+f[15][l]*alpha_vdim[228][l]+f[14][l]*alpha_vdim[227][l]+f[13][l]*alpha_vdim[226][l]+f[12][l]*alpha_vdim[225][l]+f[5][l]*alpha_vdim[224][l]);
+    out[21][l] += 0.3061862178478971*(f[23][l]*alpha_cdim[116][l]+f[7][l]*alpha_cdim[112][l])+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[69][l]+0.2449489742783178*f[68][l]*alpha_vdim[69][l]+0.273861278752583*(f[13][l]*alpha_vdim[69][l]+alpha_vdim[12][l]*f[68][l]+f[12][l]*alpha_vdim[68][l])+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[60][l]+0.2449489742783178*f[59][l]*alpha_vdim[60][l]+0.273861278752583*(f[10][l]*alpha_vdim[60][l]+alpha_vdim[9][l]*f[59][l]+f[9][l]*alpha_vdim[59][l]+alpha_vdim[25][l]*f[44][l]+f[25][l]*alpha_vdim[44][l]+alpha_vdim[25][l]*f[43][l]+f[25][l]*alpha_vdim[43][l]+alpha_vdim[22][l]*f[38][l]+f[22][l]*alpha_vdim[38][l]+alpha_vdim[22][l]*f[37][l]+f[22][l]*alpha_vdim[37][l]+alpha_cdim[3][l]*f[36][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[32][l]+0.2449489742783178*f[31][l]*alpha_vdim[32][l]+0.273861278752583*(f[2][l]*alpha_vdim[32][l]+alpha_vdim[1][l]*f[31][l]+f[1][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[5][l]*f[25][l]+f[5][l]*alpha_vdim[25][l]+alpha_vdim[4][l]*f[22][l]+f[4][l]*alpha_vdim[22][l])+0.273861278752583*(alpha_vdim[6][l]*f[17][l]+f[6][l]*alpha_vdim[17][l]+alpha_vdim[6][l]*f[16][l]+f[6][l]*alpha_vdim[16][l])+0.3061862178478971*(alpha_vdim[12][l]*f[13][l]+f[12][l]*alpha_vdim[13][l]+alpha_vdim[9][l]*f[10][l]+f[9][l]*alpha_vdim[10][l]+alpha_cdim[0][l]*f[8][l]+alpha_vdim[0][l]*f[6][l]+f[0][l]*alpha_vdim[6][l]+f[2][l]*(alpha_cdim[3][l]+alpha_vdim[1][l])+f[1][l]*alpha_vdim[2][l]);
+    out[22][l] += (0.2449489742783178*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[181][l]+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[180][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[169][l]+0.2449489742783178*f[57][l]*alpha_vdim[168][l]+0.273861278752583*(f[7][l]*alpha_vdim[168][l]+f[25][l]*(alpha_vdim[156][l]+alpha_vdim[155][l])+f[21][l]*(alpha_vdim[146][l]+alpha_vdim[145][l]))+(0.2449489742783178*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[144][l]+(0.2449489742783178*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[143][l]+(0.273861278752583*(f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[137][l]+(0.273861278752583*(f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[133][l]+0.273861278752583*f[6][l]*(alpha_vdim[129][l]+alpha_vdim[128][l])+(0.273861278752583*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[125][l]+(0.273861278752583*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[124][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[120][l]+(0.273861278752583*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[119][l]+0.273861278752583*(f[17][l]+f[16][l])*alpha_vdim[118][l]+0.3061862178478971*(f[0][l]*alpha_vdim[118][l]+f[25][l]*alpha_vdim[117][l])+0.273861278752583*f[40][l]*alpha_cdim[116][l]+0.3061862178478971*(f[1][l]*alpha_cdim[116][l]+f[21][l]*alpha_vdim[115][l])+(0.273861278752583*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[114][l]+0.273861278752583*f[31][l]*alpha_vdim[113][l]+0.3061862178478971*(f[2][l]*alpha_vdim[113][l]+f[6][l]*alpha_vdim[112][l]+f[9][l]*alpha_cdim[112][l]+alpha_cdim[3][l]*f[24][l]+alpha_cdim[0][l]*f[10][l]);
+    out[23][l] += 0.3061862178478971*f[71][l]*alpha_vdim[181][l]+0.273861278752583*f[52][l]*alpha_vdim[180][l]+0.3061862178478971*f[17][l]*alpha_vdim[169][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[168][l]+0.3061862178478971*f[92][l]*alpha_vdim[156][l]+0.273861278752583*f[26][l]*alpha_vdim[155][l]+0.3061862178478971*f[32][l]*alpha_vdim[146][l]+(0.2449489742783178*f[35][l]+0.273861278752583*f[1][l])*alpha_vdim[145][l]+0.3061862178478971*f[34][l]*alpha_vdim[144][l]+0.273861278752583*f[21][l]*alpha_vdim[143][l]+(0.273861278752583*f[91][l]+0.3061862178478971*f[27][l])*alpha_vdim[137][l]+0.273861278752583*(f[36][l]+f[31][l])*alpha_vdim[133][l]+0.3061862178478971*(f[2][l]*alpha_vdim[133][l]+f[57][l]*alpha_vdim[129][l])+0.273861278752583*f[7][l]*alpha_vdim[128][l]+0.3061862178478971*f[52][l]*alpha_vdim[125][l]+(0.273861278752583*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[124][l]+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[120][l]+(0.273861278752583*(f[18][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[119][l]+0.273861278752583*f[56][l]*alpha_vdim[118][l]+0.3061862178478971*(f[8][l]*alpha_vdim[118][l]+f[26][l]*alpha_vdim[117][l])+0.273861278752583*f[35][l]*alpha_vdim[115][l]+0.3061862178478971*(f[1][l]*alpha_vdim[115][l]+f[21][l]*alpha_vdim[114][l])+0.273861278752583*f[33][l]*alpha_vdim[113][l]+0.3061862178478971*(f[3][l]*alpha_vdim[113][l]+f[7][l]*alpha_vdim[112][l]+alpha_vdim[44][l]*f[95][l])+0.273861278752583*alpha_vdim[25][l]*f[94][l]+0.3061862178478971*alpha_vdim[69][l]*f[75][l]+0.273861278752583*(alpha_vdim[12][l]*f[74][l]+f[53][l]*alpha_vdim[68][l])+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[65][l]+0.3061862178478971*(alpha_vdim[17][l]*f[60][l]+f[17][l]*alpha_vdim[60][l])+0.273861278752583*(alpha_vdim[6][l]*f[59][l]+f[6][l]*alpha_vdim[59][l])+0.3061862178478971*alpha_vdim[13][l]*f[53][l]+0.273861278752583*(f[28][l]*alpha_vdim[43][l]+alpha_vdim[22][l]*f[41][l])+0.2449489742783178*alpha_vdim[37][l]*f[40][l]+0.273861278752583*(alpha_vdim[4][l]*f[40][l]+alpha_cdim[3][l]*f[39][l])+0.3061862178478971*(alpha_vdim[32][l]*f[38][l]+f[32][l]*alpha_vdim[38][l])+0.273861278752583*(alpha_vdim[1][l]*f[37][l]+f[1][l]*alpha_vdim[37][l]+alpha_vdim[22][l]*f[31][l]+f[22][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[25][l]*f[29][l]+alpha_vdim[5][l]*f[28][l]+alpha_vdim[2][l]*f[22][l]+f[2][l]*alpha_vdim[22][l])+0.273861278752583*(alpha_vdim[9][l]*(f[19][l]+f[16][l])+f[9][l]*alpha_vdim[16][l])+0.3061862178478971*(alpha_vdim[12][l]*f[15][l]+alpha_cdim[0][l]*f[11][l]+alpha_vdim[6][l]*f[10][l]+f[6][l]*alpha_vdim[10][l]+alpha_vdim[0][l]*f[9][l]+f[0][l]*alpha_vdim[9][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[4][l]+f[1][l]*alpha_vdim[4][l]);
+    out[24][l] += 0.273861278752583*f[52][l]*alpha_vdim[181][l]+0.3061862178478971*f[70][l]*alpha_vdim[180][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[169][l]+0.3061862178478971*f[16][l]*alpha_vdim[168][l]+0.273861278752583*f[27][l]*alpha_vdim[156][l]+0.3061862178478971*f[91][l]*alpha_vdim[155][l]+(0.2449489742783178*f[36][l]+0.273861278752583*f[2][l])*alpha_vdim[146][l]+0.3061862178478971*f[31][l]*alpha_vdim[145][l]+0.273861278752583*f[21][l]*alpha_vdim[144][l]+0.3061862178478971*f[33][l]*alpha_vdim[143][l]+(0.273861278752583*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[137][l]+(0.273861278752583*(f[35][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[133][l]+0.273861278752583*f[8][l]*alpha_vdim[129][l]+0.3061862178478971*f[56][l]*alpha_vdim[128][l]+0.273861278752583*f[71][l]*alpha_vdim[125][l]+0.3061862178478971*(f[14][l]*alpha_vdim[125][l]+f[52][l]*alpha_vdim[124][l])+(0.273861278752583*(f[18][l]+f[17][l])+0.3061862178478971*f[0][l])*alpha_vdim[120][l]+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[119][l]+0.273861278752583*f[57][l]*alpha_vdim[118][l]+0.3061862178478971*(f[7][l]*alpha_vdim[118][l]+f[27][l]*alpha_vdim[117][l])+(0.273861278752583*f[42][l]+0.3061862178478971*f[3][l])*alpha_cdim[116][l]+(0.273861278752583*f[36][l]+0.3061862178478971*f[2][l])*alpha_vdim[115][l]+0.273861278752583*f[34][l]*alpha_vdim[114][l]+0.3061862178478971*(f[3][l]*alpha_vdim[114][l]+f[21][l]*alpha_vdim[113][l]+f[8][l]*alpha_vdim[112][l]+f[11][l]*alpha_cdim[112][l])+0.273861278752583*alpha_vdim[25][l]*f[95][l]+0.3061862178478971*alpha_vdim[43][l]*f[94][l]+0.273861278752583*alpha_vdim[13][l]*f[75][l]+0.3061862178478971*alpha_vdim[68][l]*f[74][l]+0.273861278752583*f[53][l]*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[60][l]*f[65][l]+0.273861278752583*(alpha_vdim[9][l]*f[65][l]+alpha_vdim[6][l]*f[60][l]+f[6][l]*alpha_vdim[60][l])+0.3061862178478971*(alpha_vdim[16][l]*f[59][l]+f[16][l]*alpha_vdim[59][l]+alpha_vdim[12][l]*f[53][l])+0.273861278752583*f[29][l]*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[38][l]*f[41][l]+0.273861278752583*(alpha_vdim[4][l]*f[41][l]+alpha_vdim[22][l]*f[40][l]+alpha_vdim[2][l]*f[38][l]+f[2][l]*alpha_vdim[38][l])+0.3061862178478971*(alpha_vdim[31][l]*f[37][l]+f[31][l]*alpha_vdim[37][l])+0.273861278752583*(alpha_vdim[22][l]*f[32][l]+f[22][l]*alpha_vdim[32][l])+0.3061862178478971*(alpha_vdim[5][l]*f[29][l]+alpha_vdim[25][l]*f[28][l]+alpha_vdim[1][l]*f[22][l]+f[1][l]*alpha_vdim[22][l])+0.273861278752583*(alpha_vdim[10][l]*(f[19][l]+f[17][l])+f[10][l]*alpha_vdim[17][l])+0.3061862178478971*(alpha_vdim[13][l]*f[15][l]+alpha_vdim[0][l]*f[10][l]+f[0][l]*alpha_vdim[10][l]+alpha_vdim[6][l]*f[9][l]+f[6][l]*alpha_vdim[9][l]+alpha_vdim[2][l]*f[4][l]+f[2][l]*alpha_vdim[4][l]);
+    out[25][l] += (0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[284][l]+(0.2449489742783178*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[283][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[281][l]+0.2449489742783178*f[57][l]*alpha_vdim[280][l]+0.273861278752583*(f[7][l]*alpha_vdim[280][l]+f[22][l]*(alpha_vdim[262][l]+alpha_vdim[261][l])+f[21][l]*(alpha_vdim[258][l]+alpha_vdim[257][l]))+(0.2449489742783178*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[256][l]+(0.2449489742783178*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[255][l]+(0.273861278752583*(f[38][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[246][l]+(0.273861278752583*(f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[245][l]+0.273861278752583*f[6][l]*(alpha_vdim[241][l]+alpha_vdim[240][l])+(0.273861278752583*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[234][l]+(0.273861278752583*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[233][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[232][l]+(0.273861278752583*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[231][l]+0.273861278752583*(f[17][l]+f[16][l])*alpha_vdim[230][l]+0.3061862178478971*(f[0][l]*alpha_vdim[230][l]+f[22][l]*alpha_vdim[228][l]+f[21][l]*alpha_vdim[227][l])+(0.273861278752583*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[226][l]+0.273861278752583*f[31][l]*alpha_vdim[225][l]+0.3061862178478971*(f[2][l]*alpha_vdim[225][l]+f[6][l]*alpha_vdim[224][l]+f[28][l]*alpha_cdim[116][l]+f[12][l]*alpha_cdim[112][l]+alpha_cdim[3][l]*f[27][l]+alpha_cdim[0][l]*f[13][l]);
+    out[26][l] += 0.3061862178478971*f[62][l]*alpha_vdim[284][l]+0.273861278752583*f[51][l]*alpha_vdim[283][l]+0.3061862178478971*f[17][l]*alpha_vdim[281][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[280][l]+0.3061862178478971*f[88][l]*alpha_vdim[262][l]+0.273861278752583*f[23][l]*alpha_vdim[261][l]+0.3061862178478971*f[32][l]*alpha_vdim[258][l]+(0.2449489742783178*f[35][l]+0.273861278752583*f[1][l])*alpha_vdim[257][l]+0.3061862178478971*f[34][l]*alpha_vdim[256][l]+0.273861278752583*f[21][l]*alpha_vdim[255][l]+(0.273861278752583*f[87][l]+0.3061862178478971*f[24][l])*alpha_vdim[246][l]+0.273861278752583*(f[36][l]+f[31][l])*alpha_vdim[245][l]+0.3061862178478971*(f[2][l]*alpha_vdim[245][l]+f[57][l]*alpha_vdim[241][l])+0.273861278752583*f[7][l]*alpha_vdim[240][l]+0.3061862178478971*f[51][l]*alpha_vdim[234][l]+(0.273861278752583*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[233][l]+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[232][l]+(0.273861278752583*(f[18][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[231][l]+0.273861278752583*f[56][l]*alpha_vdim[230][l]+0.3061862178478971*(f[8][l]*alpha_vdim[230][l]+f[23][l]*alpha_vdim[228][l])+0.273861278752583*f[35][l]*alpha_vdim[227][l]+0.3061862178478971*(f[1][l]*alpha_vdim[227][l]+f[21][l]*alpha_vdim[226][l])+0.273861278752583*f[33][l]*alpha_vdim[225][l]+0.3061862178478971*(f[3][l]*alpha_vdim[225][l]+f[7][l]*alpha_vdim[224][l]+alpha_vdim[38][l]*f[95][l])+0.273861278752583*alpha_vdim[22][l]*f[94][l]+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[80][l]+0.3061862178478971*alpha_vdim[60][l]*f[75][l]+0.273861278752583*alpha_vdim[9][l]*f[74][l]+0.3061862178478971*(alpha_vdim[17][l]*f[69][l]+f[17][l]*alpha_vdim[69][l])+0.273861278752583*(alpha_vdim[6][l]*f[68][l]+f[6][l]*alpha_vdim[68][l])+f[53][l]*(0.273861278752583*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])+0.273861278752583*alpha_vdim[25][l]*f[48][l]+0.2449489742783178*alpha_vdim[43][l]*f[47][l]+0.273861278752583*(alpha_vdim[5][l]*f[47][l]+alpha_cdim[3][l]*f[45][l])+0.3061862178478971*(alpha_vdim[32][l]*f[44][l]+f[32][l]*alpha_vdim[44][l])+0.273861278752583*(alpha_vdim[1][l]*f[43][l]+f[1][l]*alpha_vdim[43][l]+f[28][l]*alpha_vdim[37][l]+alpha_vdim[25][l]*f[31][l]+f[25][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[22][l]*f[29][l]+alpha_vdim[4][l]*f[28][l]+alpha_vdim[2][l]*f[25][l]+f[2][l]*alpha_vdim[25][l])+0.273861278752583*(alpha_vdim[12][l]*(f[20][l]+f[16][l])+f[12][l]*alpha_vdim[16][l])+0.3061862178478971*(alpha_vdim[9][l]*f[15][l]+alpha_cdim[0][l]*f[14][l]+alpha_vdim[6][l]*f[13][l]+f[6][l]*alpha_vdim[13][l]+alpha_vdim[0][l]*f[12][l]+f[0][l]*alpha_vdim[12][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[5][l]+f[1][l]*alpha_vdim[5][l]);
+    out[27][l] += 0.273861278752583*f[51][l]*alpha_vdim[284][l]+0.3061862178478971*f[61][l]*alpha_vdim[283][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[281][l]+0.3061862178478971*f[16][l]*alpha_vdim[280][l]+0.273861278752583*f[24][l]*alpha_vdim[262][l]+0.3061862178478971*f[87][l]*alpha_vdim[261][l]+(0.2449489742783178*f[36][l]+0.273861278752583*f[2][l])*alpha_vdim[258][l]+0.3061862178478971*f[31][l]*alpha_vdim[257][l]+0.273861278752583*f[21][l]*alpha_vdim[256][l]+0.3061862178478971*f[33][l]*alpha_vdim[255][l]+(0.273861278752583*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[246][l]+(0.273861278752583*(f[35][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[245][l]+0.273861278752583*f[8][l]*alpha_vdim[241][l]+0.3061862178478971*f[56][l]*alpha_vdim[240][l]+0.273861278752583*f[62][l]*alpha_vdim[234][l]+0.3061862178478971*(f[11][l]*alpha_vdim[234][l]+f[51][l]*alpha_vdim[233][l])+(0.273861278752583*(f[18][l]+f[17][l])+0.3061862178478971*f[0][l])*alpha_vdim[232][l]+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[231][l]+0.273861278752583*f[57][l]*alpha_vdim[230][l]+0.3061862178478971*(f[7][l]*alpha_vdim[230][l]+f[24][l]*alpha_vdim[228][l])+(0.273861278752583*f[36][l]+0.3061862178478971*f[2][l])*alpha_vdim[227][l]+0.273861278752583*f[34][l]*alpha_vdim[226][l]+0.3061862178478971*(f[3][l]*alpha_vdim[226][l]+f[21][l]*alpha_vdim[225][l]+f[8][l]*alpha_vdim[224][l]+f[30][l]*alpha_cdim[116][l]+f[14][l]*alpha_cdim[112][l])+0.273861278752583*alpha_vdim[22][l]*f[95][l]+0.3061862178478971*alpha_vdim[37][l]*f[94][l]+0.2449489742783178*alpha_vdim[69][l]*f[80][l]+0.273861278752583*(alpha_vdim[12][l]*f[80][l]+alpha_vdim[10][l]*f[75][l])+0.3061862178478971*alpha_vdim[59][l]*f[74][l]+0.273861278752583*(alpha_vdim[6][l]*f[69][l]+f[6][l]*alpha_vdim[69][l])+0.3061862178478971*(alpha_vdim[16][l]*f[68][l]+f[16][l]*alpha_vdim[68][l])+f[53][l]*(0.273861278752583*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])+0.2449489742783178*alpha_vdim[44][l]*f[48][l]+0.273861278752583*(alpha_vdim[5][l]*f[48][l]+alpha_vdim[25][l]*f[47][l]+alpha_vdim[2][l]*f[44][l]+f[2][l]*alpha_vdim[44][l])+0.3061862178478971*(alpha_vdim[31][l]*f[43][l]+f[31][l]*alpha_vdim[43][l])+0.273861278752583*(f[29][l]*alpha_vdim[38][l]+alpha_vdim[25][l]*f[32][l]+f[25][l]*alpha_vdim[32][l])+0.3061862178478971*(alpha_vdim[4][l]*f[29][l]+alpha_vdim[22][l]*f[28][l]+alpha_vdim[1][l]*f[25][l]+f[1][l]*alpha_vdim[25][l])+0.273861278752583*(alpha_vdim[13][l]*(f[20][l]+f[17][l])+f[13][l]*alpha_vdim[17][l])+0.3061862178478971*(alpha_vdim[10][l]*f[15][l]+alpha_vdim[0][l]*f[13][l]+f[0][l]*alpha_vdim[13][l]+alpha_vdim[6][l]*f[12][l]+f[6][l]*alpha_vdim[12][l]+alpha_vdim[2][l]*f[5][l]+f[2][l]*alpha_vdim[5][l]);
+    out[28][l] += 0.3061862178478971*f[17][l]*alpha_vdim[284][l]+(0.2449489742783178*f[65][l]+0.273861278752583*f[6][l])*alpha_vdim[283][l]+0.3061862178478971*f[62][l]*alpha_vdim[281][l]+0.273861278752583*f[51][l]*alpha_vdim[280][l]+0.3061862178478971*f[32][l]*alpha_vdim[262][l]+(0.2449489742783178*f[40][l]+0.273861278752583*f[1][l])*alpha_vdim[261][l]+0.3061862178478971*f[88][l]*alpha_vdim[258][l]+0.273861278752583*f[23][l]*alpha_vdim[257][l]+0.3061862178478971*f[38][l]*alpha_vdim[256][l]+0.273861278752583*f[22][l]*alpha_vdim[255][l]+(0.273861278752583*(f[41][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[246][l]+0.273861278752583*f[87][l]*alpha_vdim[245][l]+0.3061862178478971*(f[24][l]*alpha_vdim[245][l]+f[60][l]*alpha_vdim[241][l])+0.273861278752583*f[9][l]*alpha_vdim[240][l]+(0.273861278752583*f[65][l]+0.3061862178478971*f[6][l])*alpha_vdim[234][l]+0.273861278752583*(f[19][l]+f[16][l])*alpha_vdim[233][l]+0.3061862178478971*(f[0][l]*alpha_vdim[233][l]+f[51][l]*alpha_vdim[232][l])+(0.273861278752583*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[231][l]+(0.273861278752583*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[230][l]+0.273861278752583*f[40][l]*alpha_vdim[228][l]+0.3061862178478971*(f[1][l]*alpha_vdim[228][l]+f[23][l]*alpha_vdim[227][l]+f[22][l]*alpha_vdim[226][l])+0.273861278752583*f[37][l]*alpha_vdim[225][l]+0.3061862178478971*(f[4][l]*alpha_vdim[225][l]+f[9][l]*alpha_vdim[224][l]+f[17][l]*alpha_vdim[181][l])+(0.2449489742783178*f[80][l]+0.273861278752583*f[6][l])*alpha_vdim[180][l]+0.3061862178478971*f[71][l]*alpha_vdim[169][l]+0.273861278752583*f[52][l]*alpha_vdim[168][l]+0.3061862178478971*f[32][l]*alpha_vdim[156][l]+(0.2449489742783178*f[47][l]+0.273861278752583*f[1][l])*alpha_vdim[155][l]+0.3061862178478971*f[92][l]*alpha_vdim[146][l]+0.273861278752583*f[26][l]*alpha_vdim[145][l]+0.3061862178478971*f[44][l]*alpha_vdim[144][l]+0.273861278752583*f[25][l]*alpha_vdim[143][l]+(0.273861278752583*(f[48][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[137][l]+0.273861278752583*f[91][l]*alpha_vdim[133][l]+0.3061862178478971*(f[27][l]*alpha_vdim[133][l]+f[69][l]*alpha_vdim[129][l])+0.273861278752583*f[12][l]*alpha_vdim[128][l]+(0.273861278752583*f[80][l]+0.3061862178478971*f[6][l])*alpha_vdim[125][l]+0.273861278752583*(f[20][l]+f[16][l])*alpha_vdim[124][l]+0.3061862178478971*(f[0][l]*alpha_vdim[124][l]+f[52][l]*alpha_vdim[120][l])+(0.273861278752583*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[119][l]+(0.273861278752583*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[118][l]+0.273861278752583*f[47][l]*alpha_vdim[117][l]+0.3061862178478971*(f[1][l]*alpha_vdim[117][l]+f[26][l]*alpha_vdim[115][l]+f[25][l]*alpha_vdim[114][l])+0.273861278752583*f[43][l]*alpha_vdim[113][l]+0.3061862178478971*(f[5][l]*alpha_vdim[113][l]+f[12][l]*alpha_vdim[112][l]+alpha_cdim[3][l]*f[30][l]+alpha_cdim[0][l]*f[15][l]);
+    out[29][l] += (0.2449489742783178*f[65][l]+0.273861278752583*f[6][l])*alpha_vdim[284][l]+0.3061862178478971*f[16][l]*alpha_vdim[283][l]+0.273861278752583*f[51][l]*alpha_vdim[281][l]+0.3061862178478971*f[61][l]*alpha_vdim[280][l]+(0.2449489742783178*f[41][l]+0.273861278752583*f[2][l])*alpha_vdim[262][l]+0.3061862178478971*f[31][l]*alpha_vdim[261][l]+0.273861278752583*f[24][l]*alpha_vdim[258][l]+0.3061862178478971*f[87][l]*alpha_vdim[257][l]+0.273861278752583*f[22][l]*alpha_vdim[256][l]+0.3061862178478971*f[37][l]*alpha_vdim[255][l]+(0.273861278752583*(f[40][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[246][l]+(0.273861278752583*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[245][l]+0.273861278752583*f[10][l]*alpha_vdim[241][l]+0.3061862178478971*f[59][l]*alpha_vdim[240][l]+(0.273861278752583*(f[19][l]+f[17][l])+0.3061862178478971*f[0][l])*alpha_vdim[234][l]+(0.273861278752583*f[65][l]+0.3061862178478971*f[6][l])*alpha_vdim[233][l]+0.273861278752583*f[62][l]*alpha_vdim[232][l]+0.3061862178478971*(f[11][l]*alpha_vdim[232][l]+f[51][l]*alpha_vdim[231][l])+(0.273861278752583*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[230][l]+0.273861278752583*f[41][l]*alpha_vdim[228][l]+0.3061862178478971*(f[2][l]*alpha_vdim[228][l]+f[24][l]*alpha_vdim[227][l])+0.273861278752583*f[38][l]*alpha_vdim[226][l]+0.3061862178478971*(f[4][l]*alpha_vdim[226][l]+f[22][l]*alpha_vdim[225][l]+f[10][l]*alpha_vdim[224][l])+(0.2449489742783178*f[80][l]+0.273861278752583*f[6][l])*alpha_vdim[181][l]+0.3061862178478971*f[16][l]*alpha_vdim[180][l]+0.273861278752583*f[52][l]*alpha_vdim[169][l]+0.3061862178478971*f[70][l]*alpha_vdim[168][l]+(0.2449489742783178*f[48][l]+0.273861278752583*f[2][l])*alpha_vdim[156][l]+0.3061862178478971*f[31][l]*alpha_vdim[155][l]+0.273861278752583*f[27][l]*alpha_vdim[146][l]+0.3061862178478971*f[91][l]*alpha_vdim[145][l]+0.273861278752583*f[25][l]*alpha_vdim[144][l]+0.3061862178478971*f[43][l]*alpha_vdim[143][l]+(0.273861278752583*(f[47][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[137][l]+(0.273861278752583*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[133][l]+0.273861278752583*f[13][l]*alpha_vdim[129][l]+0.3061862178478971*f[68][l]*alpha_vdim[128][l]+(0.273861278752583*(f[20][l]+f[17][l])+0.3061862178478971*f[0][l])*alpha_vdim[125][l]+(0.273861278752583*f[80][l]+0.3061862178478971*f[6][l])*alpha_vdim[124][l]+0.273861278752583*f[71][l]*alpha_vdim[120][l]+0.3061862178478971*(f[14][l]*alpha_vdim[120][l]+f[52][l]*alpha_vdim[119][l])+(0.273861278752583*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[118][l]+(0.273861278752583*f[48][l]+0.3061862178478971*f[2][l])*alpha_vdim[117][l]+0.273861278752583*f[46][l]*alpha_cdim[116][l]+0.3061862178478971*(f[5][l]*alpha_cdim[116][l]+f[27][l]*alpha_vdim[115][l])+0.273861278752583*f[44][l]*alpha_vdim[114][l]+0.3061862178478971*(f[5][l]*alpha_vdim[114][l]+f[25][l]*alpha_vdim[113][l]+f[13][l]*alpha_vdim[112][l]+f[15][l]*alpha_cdim[112][l]);
+    out[30][l] += 0.3061862178478971*(f[57][l]*alpha_vdim[284][l]+f[56][l]*alpha_vdim[283][l]+f[60][l]*alpha_vdim[281][l]+f[59][l]*alpha_vdim[280][l]+f[34][l]*alpha_vdim[262][l]+f[33][l]*alpha_vdim[261][l]+f[38][l]*alpha_vdim[258][l]+f[37][l]*alpha_vdim[257][l]+f[88][l]*alpha_vdim[256][l]+f[87][l]*alpha_vdim[255][l])+(0.273861278752583*f[90][l]+0.3061862178478971*f[21][l])*alpha_vdim[246][l]+0.273861278752583*f[89][l]*alpha_vdim[245][l]+0.3061862178478971*(f[22][l]*alpha_vdim[245][l]+f[62][l]*alpha_vdim[241][l]+f[61][l]*alpha_vdim[240][l])+(0.273861278752583*f[67][l]+0.3061862178478971*f[8][l])*alpha_vdim[234][l]+(0.273861278752583*f[66][l]+0.3061862178478971*f[7][l])*alpha_vdim[233][l]+(0.273861278752583*f[64][l]+0.3061862178478971*f[10][l])*alpha_vdim[232][l]+0.273861278752583*f[63][l]*alpha_vdim[231][l]+0.3061862178478971*(f[9][l]*alpha_vdim[231][l]+f[51][l]*alpha_vdim[230][l])+(0.273861278752583*f[42][l]+0.3061862178478971*f[3][l])*alpha_vdim[228][l]+0.273861278752583*f[39][l]*alpha_vdim[227][l]+0.3061862178478971*(f[4][l]*alpha_vdim[227][l]+f[24][l]*alpha_vdim[226][l]+f[23][l]*alpha_vdim[225][l]+f[11][l]*alpha_vdim[224][l]+f[57][l]*alpha_vdim[181][l]+f[56][l]*alpha_vdim[180][l]+f[69][l]*alpha_vdim[169][l]+f[68][l]*alpha_vdim[168][l]+f[34][l]*alpha_vdim[156][l]+f[33][l]*alpha_vdim[155][l]+f[44][l]*alpha_vdim[146][l]+f[43][l]*alpha_vdim[145][l]+f[92][l]*alpha_vdim[144][l]+f[91][l]*alpha_vdim[143][l])+(0.273861278752583*f[103][l]+0.3061862178478971*f[21][l])*alpha_vdim[137][l]+0.273861278752583*f[93][l]*alpha_vdim[133][l]+0.3061862178478971*(f[25][l]*alpha_vdim[133][l]+f[71][l]*alpha_vdim[129][l]+f[70][l]*alpha_vdim[128][l])+(0.273861278752583*f[82][l]+0.3061862178478971*f[8][l])*alpha_vdim[125][l]+(0.273861278752583*f[81][l]+0.3061862178478971*f[7][l])*alpha_vdim[124][l]+(0.273861278752583*f[73][l]+0.3061862178478971*f[13][l])*alpha_vdim[120][l]+0.273861278752583*f[72][l]*alpha_vdim[119][l]+0.3061862178478971*(f[12][l]*alpha_vdim[119][l]+f[52][l]*alpha_vdim[118][l])+(0.273861278752583*f[49][l]+0.3061862178478971*f[3][l])*alpha_vdim[117][l]+0.273861278752583*f[45][l]*alpha_vdim[115][l]+0.3061862178478971*(f[5][l]*alpha_vdim[115][l]+f[27][l]*alpha_vdim[114][l]+f[26][l]*alpha_vdim[113][l]+f[14][l]*alpha_vdim[112][l])+0.273861278752583*(alpha_vdim[25][l]*f[104][l]+alpha_vdim[22][l]*f[100][l])+0.3061862178478971*(alpha_vdim[32][l]*f[95][l]+alpha_vdim[31][l]*f[94][l])+0.273861278752583*(alpha_vdim[13][l]*f[84][l]+alpha_vdim[12][l]*f[83][l]+alpha_vdim[10][l]*f[78][l]+alpha_vdim[9][l]*f[77][l])+0.3061862178478971*(alpha_vdim[17][l]*f[75][l]+alpha_vdim[16][l]*f[74][l]+alpha_vdim[60][l]*f[69][l]+f[60][l]*alpha_vdim[69][l]+alpha_vdim[59][l]*f[68][l]+f[59][l]*alpha_vdim[68][l]+alpha_vdim[6][l]*f[53][l])+0.273861278752583*(alpha_vdim[5][l]*f[50][l]+alpha_vdim[4][l]*f[46][l])+0.3061862178478971*(alpha_vdim[38][l]*f[44][l]+f[38][l]*alpha_vdim[44][l]+alpha_vdim[37][l]*f[43][l]+f[37][l]*alpha_vdim[43][l]+alpha_vdim[2][l]*f[29][l]+alpha_vdim[1][l]*f[28][l]+alpha_vdim[22][l]*f[25][l]+f[22][l]*alpha_vdim[25][l]+alpha_vdim[0][l]*f[15][l]+alpha_vdim[10][l]*f[13][l]+f[10][l]*alpha_vdim[13][l]+alpha_vdim[9][l]*f[12][l]+f[9][l]*alpha_vdim[12][l]+alpha_vdim[4][l]*f[5][l]+f[4][l]*alpha_vdim[5][l]);
+    out[31][l] += 0.3061862178478971*(f[37][l]*alpha_cdim[116][l]+f[16][l]*alpha_cdim[112][l])+0.6846531968814573*(alpha_cdim[3][l]*f[21][l]+alpha_cdim[0][l]*f[6][l]);
+    out[32][l] += 0.6846531968814573*(f[22][l]*alpha_cdim[116][l]+f[6][l]*alpha_cdim[112][l])+0.3061862178478971*(alpha_cdim[3][l]*f[34][l]+alpha_cdim[0][l]*f[17][l]);
+    out[33][l] += 0.273861278752583*alpha_vdim[69][l]*f[69][l]+0.1956151991089878*alpha_vdim[68][l]*f[68][l]+0.3061862178478971*(alpha_vdim[13][l]*f[68][l]+f[13][l]*alpha_vdim[68][l])+0.273861278752583*alpha_vdim[60][l]*f[60][l]+0.1956151991089878*alpha_vdim[59][l]*f[59][l]+0.3061862178478971*(alpha_vdim[10][l]*f[59][l]+f[10][l]*alpha_vdim[59][l])+0.1956151991089878*alpha_vdim[43][l]*f[43][l]+0.3061862178478971*(alpha_vdim[5][l]*f[43][l]+f[5][l]*alpha_vdim[43][l])+0.1956151991089878*alpha_vdim[37][l]*f[37][l]+0.3061862178478971*(alpha_vdim[4][l]*f[37][l]+f[4][l]*alpha_vdim[37][l])+0.6123724356957944*alpha_cdim[3][l]*f[35][l]+0.273861278752583*alpha_vdim[32][l]*f[32][l]+0.1956151991089878*alpha_vdim[31][l]*f[31][l]+0.3061862178478971*(alpha_vdim[2][l]*f[31][l]+f[2][l]*alpha_vdim[31][l])+0.273861278752583*(alpha_vdim[25][l]*f[25][l]+alpha_vdim[22][l]*f[22][l])+0.1956151991089878*alpha_vdim[16][l]*f[16][l]+0.3061862178478971*(alpha_vdim[0][l]*f[16][l]+f[0][l]*alpha_vdim[16][l])+0.273861278752583*(alpha_vdim[12][l]*f[12][l]+alpha_vdim[9][l]*f[9][l])+0.6846531968814573*alpha_cdim[0][l]*f[7][l]+0.273861278752583*alpha_vdim[6][l]*f[6][l]+f[1][l]*(0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l]);
+    out[34][l] += 0.6846531968814573*(f[24][l]*alpha_cdim[116][l]+f[8][l]*alpha_cdim[112][l])+0.1956151991089878*alpha_vdim[69][l]*f[69][l]+0.3061862178478971*(alpha_vdim[12][l]*f[69][l]+f[12][l]*alpha_vdim[69][l])+0.273861278752583*alpha_vdim[68][l]*f[68][l]+0.1956151991089878*alpha_vdim[60][l]*f[60][l]+0.3061862178478971*(alpha_vdim[9][l]*f[60][l]+f[9][l]*alpha_vdim[60][l])+0.273861278752583*alpha_vdim[59][l]*f[59][l]+0.1956151991089878*alpha_vdim[44][l]*f[44][l]+0.3061862178478971*(alpha_vdim[5][l]*f[44][l]+f[5][l]*alpha_vdim[44][l])+0.1956151991089878*alpha_vdim[38][l]*f[38][l]+0.3061862178478971*(alpha_vdim[4][l]*f[38][l]+f[4][l]*alpha_vdim[38][l])+0.1956151991089878*alpha_vdim[32][l]*f[32][l]+0.3061862178478971*(alpha_vdim[1][l]*f[32][l]+f[1][l]*alpha_vdim[32][l])+0.273861278752583*(alpha_vdim[31][l]*f[31][l]+alpha_vdim[25][l]*f[25][l]+alpha_vdim[22][l]*f[22][l])+0.1956151991089878*alpha_vdim[17][l]*f[17][l]+0.3061862178478971*(alpha_vdim[0][l]*f[17][l]+f[0][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[13][l]*f[13][l]+alpha_vdim[10][l]*f[10][l]+alpha_vdim[6][l]*f[6][l]+alpha_vdim[2][l]*f[2][l]);
+    out[35][l] += 0.6846531968814573*alpha_vdim[44][l]*f[92][l]+0.6123724356957944*alpha_vdim[25][l]*f[91][l]+0.6846531968814573*alpha_vdim[38][l]*f[88][l]+0.6123724356957944*alpha_vdim[22][l]*f[87][l]+0.6846531968814573*alpha_vdim[69][l]*f[71][l]+0.6123724356957944*(alpha_vdim[12][l]*f[70][l]+f[52][l]*alpha_vdim[68][l])+0.6846531968814573*alpha_vdim[60][l]*f[62][l]+0.6123724356957944*(alpha_vdim[9][l]*f[61][l]+f[51][l]*alpha_vdim[59][l])+0.6846531968814573*alpha_vdim[17][l]*f[57][l]+0.6123724356957944*alpha_vdim[6][l]*f[56][l]+0.6846531968814573*(alpha_vdim[13][l]*f[52][l]+alpha_vdim[10][l]*f[51][l])+0.6123724356957944*(f[26][l]*alpha_vdim[43][l]+f[23][l]*alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[32][l]*f[34][l]+0.6123724356957944*(alpha_vdim[1][l]*f[33][l]+f[21][l]*alpha_vdim[31][l])+0.6846531968814573*(alpha_vdim[25][l]*f[27][l]+alpha_vdim[5][l]*f[26][l]+alpha_vdim[22][l]*f[24][l]+alpha_vdim[4][l]*f[23][l]+alpha_vdim[2][l]*f[21][l])+0.3061862178478971*alpha_cdim[0][l]*f[18][l]+0.6123724356957944*f[7][l]*alpha_vdim[16][l]+0.6846531968814573*(alpha_vdim[12][l]*f[14][l]+alpha_vdim[9][l]*f[11][l]+alpha_vdim[6][l]*f[8][l]+alpha_vdim[0][l]*f[7][l])+(0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[3][l];
+    out[36][l] += 0.3061862178478971*(f[39][l]*alpha_cdim[116][l]+f[18][l]*alpha_cdim[112][l])+0.6123724356957944*alpha_vdim[25][l]*f[92][l]+0.6846531968814573*alpha_vdim[43][l]*f[91][l]+0.6123724356957944*alpha_vdim[22][l]*f[88][l]+0.6846531968814573*alpha_vdim[37][l]*f[87][l]+0.6123724356957944*alpha_vdim[13][l]*f[71][l]+0.6846531968814573*alpha_vdim[68][l]*f[70][l]+0.6123724356957944*(f[52][l]*alpha_vdim[69][l]+alpha_vdim[10][l]*f[62][l])+0.6846531968814573*alpha_vdim[59][l]*f[61][l]+0.6123724356957944*(f[51][l]*alpha_vdim[60][l]+alpha_vdim[6][l]*f[57][l])+0.6846531968814573*(alpha_vdim[16][l]*f[56][l]+alpha_vdim[12][l]*f[52][l]+alpha_vdim[9][l]*f[51][l])+0.6123724356957944*(f[27][l]*alpha_vdim[44][l]+f[24][l]*alpha_vdim[38][l]+alpha_vdim[2][l]*f[34][l])+0.6846531968814573*alpha_vdim[31][l]*f[33][l]+0.6123724356957944*f[21][l]*alpha_vdim[32][l]+0.6846531968814573*(alpha_vdim[5][l]*f[27][l]+alpha_vdim[25][l]*f[26][l]+alpha_vdim[4][l]*f[24][l]+alpha_vdim[22][l]*f[23][l]+alpha_vdim[1][l]*f[21][l])+0.6123724356957944*f[8][l]*alpha_vdim[17][l]+0.6846531968814573*(alpha_vdim[13][l]*f[14][l]+alpha_vdim[10][l]*f[11][l]+alpha_vdim[0][l]*f[8][l]+alpha_vdim[6][l]*f[7][l]+alpha_vdim[2][l]*f[3][l]);
+    out[37][l] += 0.273861278752583*f[69][l]*alpha_vdim[181][l]+(0.1956151991089878*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[180][l]+0.273861278752583*f[57][l]*alpha_vdim[169][l]+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[168][l]+(0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[155][l]+(0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[145][l]+0.273861278752583*f[32][l]*alpha_vdim[144][l]+(0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[143][l]+0.273861278752583*(f[25][l]*alpha_vdim[137][l]+f[21][l]*alpha_vdim[133][l])+0.1956151991089878*f[16][l]*alpha_vdim[128][l]+0.3061862178478971*(f[0][l]*alpha_vdim[128][l]+f[68][l]*alpha_vdim[125][l])+0.273861278752583*f[12][l]*alpha_vdim[124][l]+0.3061862178478971*f[56][l]*alpha_vdim[120][l]+0.273861278752583*(f[7][l]*alpha_vdim[119][l]+f[6][l]*alpha_vdim[118][l])+0.3061862178478971*(f[43][l]*alpha_vdim[117][l]+f[33][l]*alpha_vdim[115][l]+f[31][l]*alpha_vdim[114][l])+0.273861278752583*f[1][l]*alpha_vdim[113][l]+0.3061862178478971*f[16][l]*alpha_vdim[112][l]+0.6846531968814573*(alpha_cdim[3][l]*f[23][l]+alpha_cdim[0][l]*f[9][l]);
+    out[38][l] += (0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[181][l]+0.273861278752583*f[68][l]*alpha_vdim[180][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[169][l]+0.273861278752583*f[56][l]*alpha_vdim[168][l]+(0.1956151991089878*f[44][l]+0.3061862178478971*f[5][l])*alpha_vdim[156][l]+(0.1956151991089878*f[34][l]+0.3061862178478971*f[3][l])*alpha_vdim[146][l]+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[144][l]+0.273861278752583*(f[31][l]*alpha_vdim[143][l]+f[25][l]*alpha_vdim[137][l]+f[21][l]*alpha_vdim[133][l])+(0.1956151991089878*f[17][l]+0.3061862178478971*f[0][l])*alpha_vdim[129][l]+0.273861278752583*f[13][l]*alpha_vdim[125][l]+0.3061862178478971*f[69][l]*alpha_vdim[124][l]+0.273861278752583*f[8][l]*alpha_vdim[120][l]+0.3061862178478971*f[57][l]*alpha_vdim[119][l]+0.273861278752583*f[6][l]*alpha_vdim[118][l]+0.3061862178478971*f[44][l]*alpha_vdim[117][l]+(0.6123724356957944*f[41][l]+0.6846531968814573*f[2][l])*alpha_cdim[116][l]+0.3061862178478971*f[34][l]*alpha_vdim[115][l]+0.273861278752583*f[2][l]*alpha_vdim[114][l]+0.3061862178478971*(f[32][l]*alpha_vdim[113][l]+f[17][l]*alpha_vdim[112][l])+0.6846531968814573*f[10][l]*alpha_cdim[112][l];
+    out[39][l] += 0.273861278752583*(f[57][l]*alpha_vdim[169][l]+f[56][l]*alpha_vdim[168][l]+f[34][l]*alpha_vdim[146][l]+f[33][l]*alpha_vdim[145][l])+0.3061862178478971*f[93][l]*alpha_vdim[137][l]+0.273861278752583*f[21][l]*alpha_vdim[133][l]+0.3061862178478971*(f[73][l]*alpha_vdim[125][l]+f[72][l]*alpha_vdim[124][l])+0.273861278752583*(f[8][l]*alpha_vdim[120][l]+f[7][l]*alpha_vdim[119][l])+0.3061862178478971*(f[58][l]*alpha_vdim[118][l]+f[45][l]*alpha_vdim[117][l])+0.273861278752583*f[3][l]*alpha_vdim[115][l]+0.3061862178478971*(f[36][l]*alpha_vdim[114][l]+f[35][l]*alpha_vdim[113][l]+f[18][l]*alpha_vdim[112][l])+0.6846531968814573*(alpha_vdim[69][l]*f[108][l]+alpha_vdim[68][l]*f[107][l]+alpha_vdim[44][l]*f[97][l]+alpha_vdim[43][l]*f[96][l])+0.6123724356957944*alpha_vdim[22][l]*f[90][l]+0.6846531968814573*(alpha_vdim[32][l]*f[88][l]+alpha_vdim[31][l]*f[87][l]+alpha_vdim[25][l]*f[86][l])+0.6123724356957944*(alpha_vdim[10][l]*f[67][l]+alpha_vdim[9][l]*f[66][l])+0.6846531968814573*(alpha_vdim[17][l]*f[62][l]+alpha_vdim[16][l]*f[61][l]+f[57][l]*alpha_vdim[60][l]+f[56][l]*alpha_vdim[59][l]+alpha_vdim[13][l]*f[55][l]+alpha_vdim[12][l]*f[54][l]+alpha_vdim[6][l]*f[51][l])+0.6123724356957944*alpha_vdim[4][l]*f[42][l]+0.6846531968814573*(f[34][l]*alpha_vdim[38][l]+f[33][l]*alpha_vdim[37][l]+alpha_vdim[5][l]*f[30][l]+alpha_vdim[2][l]*f[24][l]+alpha_vdim[1][l]*f[23][l]+f[21][l]*alpha_vdim[22][l]+alpha_vdim[0][l]*f[11][l]+f[8][l]*alpha_vdim[10][l]+f[7][l]*alpha_vdim[9][l]+f[3][l]*alpha_vdim[4][l]);
+    out[40][l] += 0.6846531968814573*f[75][l]*alpha_vdim[181][l]+0.6123724356957944*f[53][l]*alpha_vdim[180][l]+0.6846531968814573*f[62][l]*alpha_vdim[169][l]+0.6123724356957944*f[51][l]*alpha_vdim[168][l]+0.6846531968814573*f[95][l]*alpha_vdim[156][l]+0.6123724356957944*f[28][l]*alpha_vdim[155][l]+0.6846531968814573*f[88][l]*alpha_vdim[146][l]+0.6123724356957944*f[23][l]*alpha_vdim[145][l]+0.6846531968814573*f[38][l]*alpha_vdim[144][l]+0.6123724356957944*f[22][l]*alpha_vdim[143][l]+(0.6123724356957944*f[94][l]+0.6846531968814573*f[29][l])*alpha_vdim[137][l]+0.6123724356957944*f[87][l]*alpha_vdim[133][l]+0.6846531968814573*(f[24][l]*alpha_vdim[133][l]+f[60][l]*alpha_vdim[129][l])+0.6123724356957944*f[9][l]*alpha_vdim[128][l]+0.6846531968814573*f[53][l]*alpha_vdim[125][l]+0.6123724356957944*f[74][l]*alpha_vdim[124][l]+0.6846531968814573*(f[15][l]*alpha_vdim[124][l]+f[51][l]*alpha_vdim[120][l])+(0.6123724356957944*f[61][l]+0.6846531968814573*f[11][l])*alpha_vdim[119][l]+0.6123724356957944*f[59][l]*alpha_vdim[118][l]+0.6846531968814573*(f[10][l]*alpha_vdim[118][l]+f[28][l]*alpha_vdim[117][l]+f[23][l]*alpha_vdim[115][l]+f[22][l]*alpha_vdim[114][l])+0.6123724356957944*f[37][l]*alpha_vdim[113][l]+0.6846531968814573*(f[4][l]*alpha_vdim[113][l]+f[9][l]*alpha_vdim[112][l])+0.3061862178478971*(alpha_cdim[3][l]*f[42][l]+alpha_cdim[0][l]*f[19][l]);
+    out[41][l] += 0.6123724356957944*f[53][l]*alpha_vdim[181][l]+0.6846531968814573*f[74][l]*alpha_vdim[180][l]+0.6123724356957944*f[51][l]*alpha_vdim[169][l]+0.6846531968814573*f[61][l]*alpha_vdim[168][l]+0.6123724356957944*f[29][l]*alpha_vdim[156][l]+0.6846531968814573*f[94][l]*alpha_vdim[155][l]+0.6123724356957944*f[24][l]*alpha_vdim[146][l]+0.6846531968814573*f[87][l]*alpha_vdim[145][l]+0.6123724356957944*f[22][l]*alpha_vdim[144][l]+0.6846531968814573*f[37][l]*alpha_vdim[143][l]+(0.6123724356957944*f[95][l]+0.6846531968814573*f[28][l])*alpha_vdim[137][l]+(0.6123724356957944*f[88][l]+0.6846531968814573*f[23][l])*alpha_vdim[133][l]+0.6123724356957944*f[10][l]*alpha_vdim[129][l]+0.6846531968814573*f[59][l]*alpha_vdim[128][l]+0.6123724356957944*f[75][l]*alpha_vdim[125][l]+0.6846531968814573*(f[15][l]*alpha_vdim[125][l]+f[53][l]*alpha_vdim[124][l])+0.6123724356957944*f[62][l]*alpha_vdim[120][l]+0.6846531968814573*(f[11][l]*alpha_vdim[120][l]+f[51][l]*alpha_vdim[119][l])+0.6123724356957944*f[60][l]*alpha_vdim[118][l]+0.6846531968814573*(f[9][l]*alpha_vdim[118][l]+f[29][l]*alpha_vdim[117][l])+0.273861278752583*f[4][l]*alpha_cdim[116][l]+0.6846531968814573*f[24][l]*alpha_vdim[115][l]+0.6123724356957944*f[38][l]*alpha_vdim[114][l]+0.6846531968814573*(f[4][l]*alpha_vdim[114][l]+f[22][l]*alpha_vdim[113][l]+f[10][l]*alpha_vdim[112][l])+0.3061862178478971*f[19][l]*alpha_cdim[112][l];
+    out[42][l] += 0.6846531968814573*(f[108][l]*alpha_vdim[181][l]+f[107][l]*alpha_vdim[180][l]+f[60][l]*alpha_vdim[169][l]+f[59][l]*alpha_vdim[168][l]+f[97][l]*alpha_vdim[156][l]+f[96][l]*alpha_vdim[155][l]+f[38][l]*alpha_vdim[146][l]+f[37][l]*alpha_vdim[145][l]+f[88][l]*alpha_vdim[144][l]+f[87][l]*alpha_vdim[143][l]+f[86][l]*alpha_vdim[137][l])+0.6123724356957944*f[89][l]*alpha_vdim[133][l]+0.6846531968814573*(f[22][l]*alpha_vdim[133][l]+f[62][l]*alpha_vdim[129][l]+f[61][l]*alpha_vdim[128][l]+f[55][l]*alpha_vdim[125][l]+f[54][l]*alpha_vdim[124][l])+(0.6123724356957944*f[64][l]+0.6846531968814573*f[10][l])*alpha_vdim[120][l]+0.6123724356957944*f[63][l]*alpha_vdim[119][l]+0.6846531968814573*(f[9][l]*alpha_vdim[119][l]+f[51][l]*alpha_vdim[118][l]+f[30][l]*alpha_vdim[117][l])+0.6123724356957944*f[39][l]*alpha_vdim[115][l]+0.6846531968814573*(f[4][l]*alpha_vdim[115][l]+f[24][l]*alpha_vdim[114][l]+f[23][l]*alpha_vdim[113][l]+f[11][l]*alpha_vdim[112][l])+0.3061862178478971*(alpha_vdim[25][l]*f[100][l]+alpha_vdim[13][l]*f[78][l]+alpha_vdim[12][l]*f[77][l]+alpha_vdim[6][l]*f[65][l])+0.273861278752583*(alpha_vdim[60][l]*f[60][l]+alpha_vdim[59][l]*f[59][l])+0.3061862178478971*(alpha_vdim[5][l]*f[46][l]+alpha_vdim[2][l]*f[41][l]+alpha_vdim[1][l]*f[40][l])+0.273861278752583*(alpha_vdim[38][l]*f[38][l]+alpha_vdim[37][l]*f[37][l]+alpha_vdim[22][l]*f[22][l])+0.3061862178478971*alpha_vdim[0][l]*f[19][l]+0.273861278752583*(alpha_vdim[10][l]*f[10][l]+alpha_vdim[9][l]*f[9][l]+alpha_vdim[4][l]*f[4][l]);
+    out[43][l] += 0.273861278752583*f[60][l]*alpha_vdim[284][l]+(0.1956151991089878*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[283][l]+0.273861278752583*f[57][l]*alpha_vdim[281][l]+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[280][l]+(0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[261][l]+(0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[257][l]+0.273861278752583*f[32][l]*alpha_vdim[256][l]+(0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[255][l]+0.273861278752583*(f[22][l]*alpha_vdim[246][l]+f[21][l]*alpha_vdim[245][l])+0.1956151991089878*f[16][l]*alpha_vdim[240][l]+0.3061862178478971*(f[0][l]*alpha_vdim[240][l]+f[59][l]*alpha_vdim[234][l])+0.273861278752583*f[9][l]*alpha_vdim[233][l]+0.3061862178478971*f[56][l]*alpha_vdim[232][l]+0.273861278752583*(f[7][l]*alpha_vdim[231][l]+f[6][l]*alpha_vdim[230][l])+0.3061862178478971*(f[37][l]*alpha_vdim[228][l]+f[33][l]*alpha_vdim[227][l]+f[31][l]*alpha_vdim[226][l])+0.273861278752583*f[1][l]*alpha_vdim[225][l]+0.3061862178478971*f[16][l]*alpha_vdim[224][l]+0.6846531968814573*(alpha_cdim[3][l]*f[26][l]+alpha_cdim[0][l]*f[12][l]);
+    out[44][l] += (0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[284][l]+0.273861278752583*f[59][l]*alpha_vdim[283][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[281][l]+0.273861278752583*f[56][l]*alpha_vdim[280][l]+(0.1956151991089878*f[38][l]+0.3061862178478971*f[4][l])*alpha_vdim[262][l]+(0.1956151991089878*f[34][l]+0.3061862178478971*f[3][l])*alpha_vdim[258][l]+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[256][l]+0.273861278752583*(f[31][l]*alpha_vdim[255][l]+f[22][l]*alpha_vdim[246][l]+f[21][l]*alpha_vdim[245][l])+(0.1956151991089878*f[17][l]+0.3061862178478971*f[0][l])*alpha_vdim[241][l]+0.273861278752583*f[10][l]*alpha_vdim[234][l]+0.3061862178478971*f[60][l]*alpha_vdim[233][l]+0.273861278752583*f[8][l]*alpha_vdim[232][l]+0.3061862178478971*f[57][l]*alpha_vdim[231][l]+0.273861278752583*f[6][l]*alpha_vdim[230][l]+0.3061862178478971*(f[38][l]*alpha_vdim[228][l]+f[34][l]*alpha_vdim[227][l])+0.273861278752583*f[2][l]*alpha_vdim[226][l]+0.3061862178478971*(f[32][l]*alpha_vdim[225][l]+f[17][l]*alpha_vdim[224][l])+0.6846531968814573*(f[29][l]*alpha_cdim[116][l]+f[13][l]*alpha_cdim[112][l]);
+    out[45][l] += 0.273861278752583*(f[57][l]*alpha_vdim[281][l]+f[56][l]*alpha_vdim[280][l]+f[34][l]*alpha_vdim[258][l]+f[33][l]*alpha_vdim[257][l])+0.3061862178478971*f[89][l]*alpha_vdim[246][l]+0.273861278752583*f[21][l]*alpha_vdim[245][l]+0.3061862178478971*(f[64][l]*alpha_vdim[234][l]+f[63][l]*alpha_vdim[233][l])+0.273861278752583*(f[8][l]*alpha_vdim[232][l]+f[7][l]*alpha_vdim[231][l])+0.3061862178478971*(f[58][l]*alpha_vdim[230][l]+f[39][l]*alpha_vdim[228][l])+0.273861278752583*f[3][l]*alpha_vdim[227][l]+0.3061862178478971*(f[36][l]*alpha_vdim[226][l]+f[35][l]*alpha_vdim[225][l]+f[18][l]*alpha_vdim[224][l])+0.6846531968814573*(alpha_vdim[60][l]*f[108][l]+alpha_vdim[59][l]*f[107][l])+0.6123724356957944*alpha_vdim[25][l]*f[103][l]+0.6846531968814573*(alpha_vdim[38][l]*f[97][l]+alpha_vdim[37][l]*f[96][l]+alpha_vdim[32][l]*f[92][l]+alpha_vdim[31][l]*f[91][l]+alpha_vdim[22][l]*f[86][l])+0.6123724356957944*(alpha_vdim[13][l]*f[82][l]+alpha_vdim[12][l]*f[81][l])+0.6846531968814573*(alpha_vdim[17][l]*f[71][l]+alpha_vdim[16][l]*f[70][l]+f[57][l]*alpha_vdim[69][l]+f[56][l]*alpha_vdim[68][l]+alpha_vdim[10][l]*f[55][l]+alpha_vdim[9][l]*f[54][l]+alpha_vdim[6][l]*f[52][l])+0.6123724356957944*alpha_vdim[5][l]*f[49][l]+0.6846531968814573*(f[34][l]*alpha_vdim[44][l]+f[33][l]*alpha_vdim[43][l]+alpha_vdim[4][l]*f[30][l]+alpha_vdim[2][l]*f[27][l]+alpha_vdim[1][l]*f[26][l]+f[21][l]*alpha_vdim[25][l]+alpha_vdim[0][l]*f[14][l]+f[8][l]*alpha_vdim[13][l]+f[7][l]*alpha_vdim[12][l]+f[3][l]*alpha_vdim[5][l]);
+    out[46][l] += 0.273861278752583*(f[60][l]*alpha_vdim[284][l]+f[59][l]*alpha_vdim[283][l]+f[38][l]*alpha_vdim[262][l]+f[37][l]*alpha_vdim[261][l]+f[22][l]*alpha_vdim[246][l])+0.3061862178478971*f[90][l]*alpha_vdim[245][l]+0.273861278752583*(f[10][l]*alpha_vdim[234][l]+f[9][l]*alpha_vdim[233][l])+0.3061862178478971*(f[67][l]*alpha_vdim[232][l]+f[66][l]*alpha_vdim[231][l]+f[65][l]*alpha_vdim[230][l])+0.273861278752583*f[4][l]*alpha_vdim[228][l]+0.3061862178478971*(f[42][l]*alpha_vdim[227][l]+f[41][l]*alpha_vdim[226][l]+f[40][l]*alpha_vdim[225][l]+f[19][l]*alpha_vdim[224][l])+0.6846531968814573*(f[60][l]*alpha_vdim[181][l]+f[59][l]*alpha_vdim[180][l]+f[108][l]*alpha_vdim[169][l]+f[107][l]*alpha_vdim[168][l]+f[38][l]*alpha_vdim[156][l]+f[37][l]*alpha_vdim[155][l]+f[97][l]*alpha_vdim[146][l]+f[96][l]*alpha_vdim[145][l]+f[95][l]*alpha_vdim[144][l]+f[94][l]*alpha_vdim[143][l])+0.6123724356957944*f[104][l]*alpha_vdim[137][l]+0.6846531968814573*(f[22][l]*alpha_vdim[137][l]+f[86][l]*alpha_vdim[133][l]+f[75][l]*alpha_vdim[129][l]+f[74][l]*alpha_vdim[128][l])+(0.6123724356957944*f[84][l]+0.6846531968814573*f[10][l])*alpha_vdim[125][l]+0.6123724356957944*f[83][l]*alpha_vdim[124][l]+0.6846531968814573*(f[9][l]*alpha_vdim[124][l]+f[55][l]*alpha_vdim[120][l]+f[54][l]*alpha_vdim[119][l]+f[53][l]*alpha_vdim[118][l])+0.6123724356957944*f[50][l]*alpha_vdim[117][l]+0.6846531968814573*(f[4][l]*alpha_vdim[117][l]+f[30][l]*alpha_vdim[115][l]+f[29][l]*alpha_vdim[114][l]+f[28][l]*alpha_vdim[113][l]+f[15][l]*alpha_vdim[112][l]);
+    out[47][l] += 0.6846531968814573*f[75][l]*alpha_vdim[284][l]+0.6123724356957944*f[53][l]*alpha_vdim[283][l]+0.6846531968814573*f[71][l]*alpha_vdim[281][l]+0.6123724356957944*f[52][l]*alpha_vdim[280][l]+0.6846531968814573*f[95][l]*alpha_vdim[262][l]+0.6123724356957944*f[28][l]*alpha_vdim[261][l]+0.6846531968814573*f[92][l]*alpha_vdim[258][l]+0.6123724356957944*f[26][l]*alpha_vdim[257][l]+0.6846531968814573*f[44][l]*alpha_vdim[256][l]+0.6123724356957944*f[25][l]*alpha_vdim[255][l]+(0.6123724356957944*f[94][l]+0.6846531968814573*f[29][l])*alpha_vdim[246][l]+0.6123724356957944*f[91][l]*alpha_vdim[245][l]+0.6846531968814573*(f[27][l]*alpha_vdim[245][l]+f[69][l]*alpha_vdim[241][l])+0.6123724356957944*f[12][l]*alpha_vdim[240][l]+0.6846531968814573*f[53][l]*alpha_vdim[234][l]+0.6123724356957944*f[74][l]*alpha_vdim[233][l]+0.6846531968814573*(f[15][l]*alpha_vdim[233][l]+f[52][l]*alpha_vdim[232][l])+(0.6123724356957944*f[70][l]+0.6846531968814573*f[14][l])*alpha_vdim[231][l]+0.6123724356957944*f[68][l]*alpha_vdim[230][l]+0.6846531968814573*(f[13][l]*alpha_vdim[230][l]+f[28][l]*alpha_vdim[228][l]+f[26][l]*alpha_vdim[227][l]+f[25][l]*alpha_vdim[226][l])+0.6123724356957944*f[43][l]*alpha_vdim[225][l]+0.6846531968814573*(f[5][l]*alpha_vdim[225][l]+f[12][l]*alpha_vdim[224][l])+0.3061862178478971*(alpha_cdim[3][l]*f[49][l]+alpha_cdim[0][l]*f[20][l]);
+    out[48][l] += 0.6123724356957944*f[53][l]*alpha_vdim[284][l]+0.6846531968814573*f[74][l]*alpha_vdim[283][l]+0.6123724356957944*f[52][l]*alpha_vdim[281][l]+0.6846531968814573*f[70][l]*alpha_vdim[280][l]+0.6123724356957944*f[29][l]*alpha_vdim[262][l]+0.6846531968814573*f[94][l]*alpha_vdim[261][l]+0.6123724356957944*f[27][l]*alpha_vdim[258][l]+0.6846531968814573*f[91][l]*alpha_vdim[257][l]+0.6123724356957944*f[25][l]*alpha_vdim[256][l]+0.6846531968814573*f[43][l]*alpha_vdim[255][l]+(0.6123724356957944*f[95][l]+0.6846531968814573*f[28][l])*alpha_vdim[246][l]+(0.6123724356957944*f[92][l]+0.6846531968814573*f[26][l])*alpha_vdim[245][l]+0.6123724356957944*f[13][l]*alpha_vdim[241][l]+0.6846531968814573*f[68][l]*alpha_vdim[240][l]+0.6123724356957944*f[75][l]*alpha_vdim[234][l]+0.6846531968814573*(f[15][l]*alpha_vdim[234][l]+f[53][l]*alpha_vdim[233][l])+0.6123724356957944*f[71][l]*alpha_vdim[232][l]+0.6846531968814573*(f[14][l]*alpha_vdim[232][l]+f[52][l]*alpha_vdim[231][l])+0.6123724356957944*f[69][l]*alpha_vdim[230][l]+0.6846531968814573*(f[12][l]*alpha_vdim[230][l]+f[29][l]*alpha_vdim[228][l]+f[27][l]*alpha_vdim[227][l])+0.6123724356957944*f[44][l]*alpha_vdim[226][l]+0.6846531968814573*(f[5][l]*alpha_vdim[226][l]+f[25][l]*alpha_vdim[225][l]+f[13][l]*alpha_vdim[224][l])+0.3061862178478971*(f[50][l]*alpha_cdim[116][l]+f[20][l]*alpha_cdim[112][l]);
+    out[49][l] += 0.6846531968814573*(f[108][l]*alpha_vdim[284][l]+f[107][l]*alpha_vdim[283][l]+f[69][l]*alpha_vdim[281][l]+f[68][l]*alpha_vdim[280][l]+f[97][l]*alpha_vdim[262][l]+f[96][l]*alpha_vdim[261][l]+f[44][l]*alpha_vdim[258][l]+f[43][l]*alpha_vdim[257][l]+f[92][l]*alpha_vdim[256][l]+f[91][l]*alpha_vdim[255][l]+f[86][l]*alpha_vdim[246][l])+0.6123724356957944*f[93][l]*alpha_vdim[245][l]+0.6846531968814573*(f[25][l]*alpha_vdim[245][l]+f[71][l]*alpha_vdim[241][l]+f[70][l]*alpha_vdim[240][l]+f[55][l]*alpha_vdim[234][l]+f[54][l]*alpha_vdim[233][l])+(0.6123724356957944*f[73][l]+0.6846531968814573*f[13][l])*alpha_vdim[232][l]+0.6123724356957944*f[72][l]*alpha_vdim[231][l]+0.6846531968814573*(f[12][l]*alpha_vdim[231][l]+f[52][l]*alpha_vdim[230][l]+f[30][l]*alpha_vdim[228][l])+0.6123724356957944*f[45][l]*alpha_vdim[227][l]+0.6846531968814573*(f[5][l]*alpha_vdim[227][l]+f[27][l]*alpha_vdim[226][l]+f[26][l]*alpha_vdim[225][l]+f[14][l]*alpha_vdim[224][l])+0.3061862178478971*(alpha_vdim[22][l]*f[104][l]+alpha_vdim[10][l]*f[84][l]+alpha_vdim[9][l]*f[83][l]+alpha_vdim[6][l]*f[80][l])+0.273861278752583*(alpha_vdim[69][l]*f[69][l]+alpha_vdim[68][l]*f[68][l])+0.3061862178478971*(alpha_vdim[4][l]*f[50][l]+alpha_vdim[2][l]*f[48][l]+alpha_vdim[1][l]*f[47][l])+0.273861278752583*(alpha_vdim[44][l]*f[44][l]+alpha_vdim[43][l]*f[43][l]+alpha_vdim[25][l]*f[25][l])+0.3061862178478971*alpha_vdim[0][l]*f[20][l]+0.273861278752583*(alpha_vdim[13][l]*f[13][l]+alpha_vdim[12][l]*f[12][l]+alpha_vdim[5][l]*f[5][l]);
+    out[50][l] += 0.6846531968814573*(f[69][l]*alpha_vdim[284][l]+f[68][l]*alpha_vdim[283][l]+f[108][l]*alpha_vdim[281][l]+f[107][l]*alpha_vdim[280][l]+f[44][l]*alpha_vdim[262][l]+f[43][l]*alpha_vdim[261][l]+f[97][l]*alpha_vdim[258][l]+f[96][l]*alpha_vdim[257][l]+f[95][l]*alpha_vdim[256][l]+f[94][l]*alpha_vdim[255][l])+0.6123724356957944*f[100][l]*alpha_vdim[246][l]+0.6846531968814573*(f[25][l]*alpha_vdim[246][l]+f[86][l]*alpha_vdim[245][l]+f[75][l]*alpha_vdim[241][l]+f[74][l]*alpha_vdim[240][l])+(0.6123724356957944*f[78][l]+0.6846531968814573*f[13][l])*alpha_vdim[234][l]+0.6123724356957944*f[77][l]*alpha_vdim[233][l]+0.6846531968814573*(f[12][l]*alpha_vdim[233][l]+f[55][l]*alpha_vdim[232][l]+f[54][l]*alpha_vdim[231][l]+f[53][l]*alpha_vdim[230][l])+0.6123724356957944*f[46][l]*alpha_vdim[228][l]+0.6846531968814573*(f[5][l]*alpha_vdim[228][l]+f[30][l]*alpha_vdim[227][l]+f[29][l]*alpha_vdim[226][l]+f[28][l]*alpha_vdim[225][l]+f[15][l]*alpha_vdim[224][l])+0.273861278752583*(f[69][l]*alpha_vdim[181][l]+f[68][l]*alpha_vdim[180][l]+f[44][l]*alpha_vdim[156][l]+f[43][l]*alpha_vdim[155][l]+f[25][l]*alpha_vdim[137][l])+0.3061862178478971*f[103][l]*alpha_vdim[133][l]+0.273861278752583*(f[13][l]*alpha_vdim[125][l]+f[12][l]*alpha_vdim[124][l])+0.3061862178478971*(f[82][l]*alpha_vdim[120][l]+f[81][l]*alpha_vdim[119][l]+f[80][l]*alpha_vdim[118][l])+0.273861278752583*f[5][l]*alpha_vdim[117][l]+0.3061862178478971*(f[49][l]*alpha_vdim[115][l]+f[48][l]*alpha_vdim[114][l]+f[47][l]*alpha_vdim[113][l]+f[20][l]*alpha_vdim[112][l]);
+    out[51][l] += (0.2449489742783178*f[91][l]+0.273861278752583*f[27][l])*alpha_vdim[181][l]+(0.2449489742783178*f[92][l]+0.273861278752583*f[26][l])*alpha_vdim[180][l]+(0.2449489742783178*(f[36][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[169][l]+0.2449489742783178*(f[35][l]+f[32][l])*alpha_vdim[168][l]+0.273861278752583*(f[1][l]*alpha_vdim[168][l]+f[52][l]*(alpha_vdim[156][l]+alpha_vdim[155][l]))+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[146][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[145][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[144][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[143][l]+(0.273861278752583*(f[71][l]+f[70][l])+0.3061862178478971*f[14][l])*alpha_vdim[137][l]+(0.273861278752583*(f[18][l]+f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[133][l]+0.273861278752583*f[21][l]*(alpha_vdim[129][l]+alpha_vdim[128][l])+(0.273861278752583*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[125][l]+(0.273861278752583*f[91][l]+0.3061862178478971*f[27][l])*alpha_vdim[124][l]+(0.273861278752583*(f[35][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[120][l]+(0.273861278752583*(f[36][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[119][l]+0.273861278752583*(f[34][l]+f[33][l])*alpha_vdim[118][l]+0.3061862178478971*(f[3][l]*alpha_vdim[118][l]+f[52][l]*alpha_vdim[117][l])+(0.273861278752583*f[66][l]+0.3061862178478971*f[7][l])*alpha_cdim[116][l]+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[115][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[114][l]+0.273861278752583*f[56][l]*alpha_vdim[113][l]+0.3061862178478971*(f[8][l]*alpha_vdim[113][l]+f[21][l]*alpha_vdim[112][l]+f[23][l]*alpha_cdim[112][l])+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[95][l]+0.2449489742783178*alpha_vdim[69][l]*f[94][l]+0.273861278752583*(alpha_vdim[12][l]*f[94][l]+alpha_vdim[25][l]*(f[75][l]+f[74][l])+f[29][l]*alpha_vdim[69][l]+f[28][l]*alpha_vdim[68][l])+0.2449489742783178*(alpha_vdim[38][l]+alpha_vdim[37][l])*f[65][l]+0.273861278752583*(alpha_vdim[4][l]*f[65][l]+alpha_cdim[3][l]*f[64][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[60][l]+(0.2449489742783178*(f[41][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[60][l]+(0.2449489742783178*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[59][l]+(0.2449489742783178*(f[40][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[59][l]+(0.273861278752583*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[53][l]+0.273861278752583*(alpha_vdim[9][l]*f[41][l]+alpha_vdim[10][l]*f[40][l]+alpha_vdim[6][l]*f[38][l]+f[6][l]*alpha_vdim[38][l]+alpha_vdim[6][l]*f[37][l]+f[6][l]*alpha_vdim[37][l]+alpha_vdim[10][l]*f[32][l]+f[10][l]*alpha_vdim[32][l]+alpha_vdim[9][l]*f[31][l]+f[9][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[12][l]*f[29][l]+alpha_vdim[13][l]*f[28][l]+f[15][l]*alpha_vdim[25][l]+alpha_cdim[0][l]*f[24][l])+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[22][l]+0.273861278752583*(f[19][l]+f[17][l]+f[16][l])*alpha_vdim[22][l]+0.3061862178478971*(f[0][l]*alpha_vdim[22][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[10][l]+f[1][l]*alpha_vdim[10][l]+alpha_vdim[2][l]*f[9][l]+f[2][l]*alpha_vdim[9][l]+alpha_vdim[4][l]*f[6][l]+f[4][l]*alpha_vdim[6][l]);
+    out[52][l] += (0.2449489742783178*f[87][l]+0.273861278752583*f[24][l])*alpha_vdim[284][l]+(0.2449489742783178*f[88][l]+0.273861278752583*f[23][l])*alpha_vdim[283][l]+(0.2449489742783178*(f[36][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[281][l]+0.2449489742783178*(f[35][l]+f[32][l])*alpha_vdim[280][l]+0.273861278752583*(f[1][l]*alpha_vdim[280][l]+f[51][l]*(alpha_vdim[262][l]+alpha_vdim[261][l]))+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[258][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[257][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[256][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[255][l]+(0.273861278752583*(f[62][l]+f[61][l])+0.3061862178478971*f[11][l])*alpha_vdim[246][l]+(0.273861278752583*(f[18][l]+f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[245][l]+0.273861278752583*f[21][l]*(alpha_vdim[241][l]+alpha_vdim[240][l])+(0.273861278752583*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[234][l]+(0.273861278752583*f[87][l]+0.3061862178478971*f[24][l])*alpha_vdim[233][l]+(0.273861278752583*(f[35][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[232][l]+(0.273861278752583*(f[36][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[231][l]+0.273861278752583*(f[34][l]+f[33][l])*alpha_vdim[230][l]+0.3061862178478971*(f[3][l]*alpha_vdim[230][l]+f[51][l]*alpha_vdim[228][l])+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[227][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[226][l]+0.273861278752583*f[56][l]*alpha_vdim[225][l]+0.3061862178478971*(f[8][l]*alpha_vdim[225][l]+f[21][l]*alpha_vdim[224][l]+f[54][l]*alpha_cdim[116][l]+f[26][l]*alpha_cdim[112][l])+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[95][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[94][l]+0.2449489742783178*(alpha_vdim[44][l]+alpha_vdim[43][l])*f[80][l]+0.273861278752583*(alpha_vdim[5][l]*f[80][l]+alpha_vdim[22][l]*(f[75][l]+f[74][l])+alpha_cdim[3][l]*f[73][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[69][l]+(0.2449489742783178*(f[48][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[69][l]+(0.2449489742783178*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[68][l]+0.2449489742783178*(f[47][l]+f[32][l])*alpha_vdim[68][l]+0.273861278752583*(f[1][l]*alpha_vdim[68][l]+f[29][l]*alpha_vdim[60][l]+f[28][l]*alpha_vdim[59][l])+(0.273861278752583*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])*f[53][l]+0.273861278752583*(alpha_vdim[12][l]*f[48][l]+alpha_vdim[13][l]*f[47][l]+alpha_vdim[6][l]*f[44][l]+f[6][l]*alpha_vdim[44][l]+alpha_vdim[6][l]*f[43][l]+f[6][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[32][l]+f[13][l]*alpha_vdim[32][l]+alpha_vdim[12][l]*f[31][l]+f[12][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[9][l]*f[29][l]+alpha_vdim[10][l]*f[28][l]+alpha_cdim[0][l]*f[27][l])+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[25][l]+0.273861278752583*(f[20][l]+f[17][l]+f[16][l])*alpha_vdim[25][l]+0.3061862178478971*(f[0][l]*alpha_vdim[25][l]+f[15][l]*alpha_vdim[22][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[13][l]+f[1][l]*alpha_vdim[13][l]+alpha_vdim[2][l]*f[12][l]+f[2][l]*alpha_vdim[12][l]+alpha_vdim[5][l]*f[6][l]+f[5][l]*alpha_vdim[6][l]);
+    out[53][l] += (0.2449489742783178*(f[41][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[284][l]+(0.2449489742783178*(f[40][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[283][l]+(0.2449489742783178*f[87][l]+0.273861278752583*f[24][l])*alpha_vdim[281][l]+(0.2449489742783178*f[88][l]+0.273861278752583*f[23][l])*alpha_vdim[280][l]+(0.2449489742783178*f[65][l]+0.273861278752583*f[6][l])*alpha_vdim[262][l]+0.2449489742783178*f[65][l]*alpha_vdim[261][l]+0.273861278752583*(f[6][l]*alpha_vdim[261][l]+f[51][l]*(alpha_vdim[258][l]+alpha_vdim[257][l]))+(0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[256][l]+(0.2449489742783178*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[255][l]+(0.273861278752583*(f[19][l]+f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[246][l]+(0.273861278752583*(f[62][l]+f[61][l])+0.3061862178478971*f[11][l])*alpha_vdim[245][l]+0.273861278752583*f[22][l]*(alpha_vdim[241][l]+alpha_vdim[240][l])+(0.273861278752583*(f[40][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[234][l]+(0.273861278752583*(f[41][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[233][l]+(0.273861278752583*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[232][l]+(0.273861278752583*f[87][l]+0.3061862178478971*f[24][l])*alpha_vdim[231][l]+(0.273861278752583*(f[38][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[230][l]+0.273861278752583*f[65][l]*alpha_vdim[228][l]+0.3061862178478971*(f[6][l]*alpha_vdim[228][l]+f[51][l]*alpha_vdim[227][l])+(0.273861278752583*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[226][l]+0.273861278752583*f[59][l]*alpha_vdim[225][l]+0.3061862178478971*(f[10][l]*alpha_vdim[225][l]+f[22][l]*alpha_vdim[224][l])+(0.2449489742783178*(f[48][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[181][l]+(0.2449489742783178*(f[47][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[180][l]+(0.2449489742783178*f[91][l]+0.273861278752583*f[27][l])*alpha_vdim[169][l]+(0.2449489742783178*f[92][l]+0.273861278752583*f[26][l])*alpha_vdim[168][l]+(0.2449489742783178*f[80][l]+0.273861278752583*f[6][l])*alpha_vdim[156][l]+0.2449489742783178*f[80][l]*alpha_vdim[155][l]+0.273861278752583*(f[6][l]*alpha_vdim[155][l]+f[52][l]*(alpha_vdim[146][l]+alpha_vdim[145][l]))+(0.2449489742783178*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[144][l]+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[143][l]+(0.273861278752583*(f[20][l]+f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[137][l]+(0.273861278752583*(f[71][l]+f[70][l])+0.3061862178478971*f[14][l])*alpha_vdim[133][l]+0.273861278752583*f[25][l]*(alpha_vdim[129][l]+alpha_vdim[128][l])+(0.273861278752583*(f[47][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[125][l]+(0.273861278752583*(f[48][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[124][l]+(0.273861278752583*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[120][l]+(0.273861278752583*f[91][l]+0.3061862178478971*f[27][l])*alpha_vdim[119][l]+(0.273861278752583*(f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[118][l]+(0.273861278752583*f[80][l]+0.3061862178478971*f[6][l])*alpha_vdim[117][l]+0.273861278752583*f[77][l]*alpha_cdim[116][l]+0.3061862178478971*(f[12][l]*alpha_cdim[116][l]+f[52][l]*alpha_vdim[115][l])+(0.273861278752583*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[114][l]+0.273861278752583*f[68][l]*alpha_vdim[113][l]+0.3061862178478971*(f[13][l]*alpha_vdim[113][l]+f[25][l]*alpha_vdim[112][l]+f[28][l]*alpha_cdim[112][l]+alpha_cdim[3][l]*f[55][l]+alpha_cdim[0][l]*f[29][l]);
+    out[54][l] += 0.3061862178478971*f[34][l]*alpha_vdim[284][l]+(0.2449489742783178*f[90][l]+0.273861278752583*f[21][l])*alpha_vdim[283][l]+0.3061862178478971*f[38][l]*alpha_vdim[281][l]+(0.2449489742783178*f[89][l]+0.273861278752583*f[22][l])*alpha_vdim[280][l]+0.3061862178478971*f[57][l]*alpha_vdim[262][l]+(0.2449489742783178*f[66][l]+0.273861278752583*f[7][l])*alpha_vdim[261][l]+0.3061862178478971*f[60][l]*alpha_vdim[258][l]+(0.2449489742783178*f[63][l]+0.273861278752583*f[9][l])*alpha_vdim[257][l]+0.3061862178478971*f[62][l]*alpha_vdim[256][l]+0.273861278752583*f[51][l]*alpha_vdim[255][l]+(0.273861278752583*(f[67][l]+f[56][l])+0.3061862178478971*f[8][l])*alpha_vdim[246][l]+0.273861278752583*(f[64][l]+f[59][l])*alpha_vdim[245][l]+0.3061862178478971*(f[10][l]*alpha_vdim[245][l]+f[88][l]*alpha_vdim[241][l])+0.273861278752583*f[23][l]*alpha_vdim[240][l]+(0.273861278752583*f[90][l]+0.3061862178478971*f[21][l])*alpha_vdim[234][l]+(0.273861278752583*(f[42][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[233][l]+(0.273861278752583*f[89][l]+0.3061862178478971*f[22][l])*alpha_vdim[232][l]+(0.273861278752583*(f[39][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[231][l]+(0.273861278752583*f[87][l]+0.3061862178478971*f[24][l])*alpha_vdim[230][l]+(0.273861278752583*f[66][l]+0.3061862178478971*f[7][l])*alpha_vdim[228][l]+0.273861278752583*f[63][l]*alpha_vdim[227][l]+0.3061862178478971*(f[9][l]*alpha_vdim[227][l]+f[51][l]*alpha_vdim[226][l])+0.273861278752583*f[61][l]*alpha_vdim[225][l]+0.3061862178478971*(f[11][l]*alpha_vdim[225][l]+f[23][l]*alpha_vdim[224][l]+f[34][l]*alpha_vdim[181][l])+(0.2449489742783178*f[103][l]+0.273861278752583*f[21][l])*alpha_vdim[180][l]+0.3061862178478971*f[44][l]*alpha_vdim[169][l]+(0.2449489742783178*f[93][l]+0.273861278752583*f[25][l])*alpha_vdim[168][l]+0.3061862178478971*f[57][l]*alpha_vdim[156][l]+(0.2449489742783178*f[81][l]+0.273861278752583*f[7][l])*alpha_vdim[155][l]+0.3061862178478971*f[69][l]*alpha_vdim[146][l]+(0.2449489742783178*f[72][l]+0.273861278752583*f[12][l])*alpha_vdim[145][l]+0.3061862178478971*f[71][l]*alpha_vdim[144][l]+0.273861278752583*f[52][l]*alpha_vdim[143][l]+(0.273861278752583*(f[82][l]+f[56][l])+0.3061862178478971*f[8][l])*alpha_vdim[137][l]+0.273861278752583*(f[73][l]+f[68][l])*alpha_vdim[133][l]+0.3061862178478971*(f[13][l]*alpha_vdim[133][l]+f[92][l]*alpha_vdim[129][l])+0.273861278752583*f[26][l]*alpha_vdim[128][l]+(0.273861278752583*f[103][l]+0.3061862178478971*f[21][l])*alpha_vdim[125][l]+(0.273861278752583*(f[49][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[124][l]+(0.273861278752583*f[93][l]+0.3061862178478971*f[25][l])*alpha_vdim[120][l]+(0.273861278752583*(f[45][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[119][l]+(0.273861278752583*f[91][l]+0.3061862178478971*f[27][l])*alpha_vdim[118][l]+(0.273861278752583*f[81][l]+0.3061862178478971*f[7][l])*alpha_vdim[117][l]+0.273861278752583*f[72][l]*alpha_vdim[115][l]+0.3061862178478971*(f[12][l]*alpha_vdim[115][l]+f[52][l]*alpha_vdim[114][l])+0.273861278752583*f[70][l]*alpha_vdim[113][l]+0.3061862178478971*(f[14][l]*alpha_vdim[113][l]+f[26][l]*alpha_vdim[112][l])+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[104][l]+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[100][l]+0.3061862178478971*alpha_vdim[17][l]*f[95][l]+0.273861278752583*(alpha_vdim[6][l]*f[94][l]+alpha_vdim[25][l]*f[84][l])+0.2449489742783178*alpha_vdim[43][l]*f[83][l]+0.273861278752583*(alpha_vdim[5][l]*f[83][l]+alpha_vdim[22][l]*f[78][l])+0.2449489742783178*alpha_vdim[37][l]*f[77][l]+0.273861278752583*(alpha_vdim[4][l]*f[77][l]+alpha_cdim[3][l]*f[76][l])+0.3061862178478971*alpha_vdim[32][l]*f[75][l]+0.273861278752583*alpha_vdim[1][l]*f[74][l]+0.3061862178478971*(alpha_vdim[38][l]*f[69][l]+f[38][l]*alpha_vdim[69][l])+0.273861278752583*(alpha_vdim[22][l]*f[68][l]+f[22][l]*alpha_vdim[68][l])+0.3061862178478971*(alpha_vdim[44][l]*f[60][l]+f[44][l]*alpha_vdim[60][l])+0.273861278752583*(alpha_vdim[25][l]*f[59][l]+f[25][l]*alpha_vdim[59][l])+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[53][l]+0.273861278752583*(alpha_vdim[12][l]*f[50][l]+alpha_vdim[9][l]*(f[46][l]+f[43][l])+f[9][l]*alpha_vdim[43][l]+alpha_vdim[12][l]*f[37][l]+f[12][l]*alpha_vdim[37][l])+0.3061862178478971*(alpha_cdim[0][l]*f[30][l]+alpha_vdim[6][l]*f[29][l])+0.273861278752583*alpha_vdim[16][l]*f[28][l]+0.3061862178478971*(alpha_vdim[0][l]*f[28][l]+alpha_vdim[10][l]*f[25][l]+f[10][l]*alpha_vdim[25][l]+alpha_vdim[13][l]*f[22][l]+f[13][l]*alpha_vdim[22][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[15][l]+alpha_vdim[4][l]*f[12][l]+f[4][l]*alpha_vdim[12][l]+alpha_vdim[5][l]*f[9][l]+f[5][l]*alpha_vdim[9][l]);
+    out[55][l] += (0.2449489742783178*f[90][l]+0.273861278752583*f[21][l])*alpha_vdim[284][l]+0.3061862178478971*f[33][l]*alpha_vdim[283][l]+(0.2449489742783178*f[89][l]+0.273861278752583*f[22][l])*alpha_vdim[281][l]+0.3061862178478971*f[37][l]*alpha_vdim[280][l]+(0.2449489742783178*f[67][l]+0.273861278752583*f[8][l])*alpha_vdim[262][l]+0.3061862178478971*f[56][l]*alpha_vdim[261][l]+(0.2449489742783178*f[64][l]+0.273861278752583*f[10][l])*alpha_vdim[258][l]+0.3061862178478971*f[59][l]*alpha_vdim[257][l]+0.273861278752583*f[51][l]*alpha_vdim[256][l]+0.3061862178478971*f[61][l]*alpha_vdim[255][l]+(0.273861278752583*(f[66][l]+f[57][l])+0.3061862178478971*f[7][l])*alpha_vdim[246][l]+(0.273861278752583*(f[63][l]+f[60][l])+0.3061862178478971*f[9][l])*alpha_vdim[245][l]+0.273861278752583*f[24][l]*alpha_vdim[241][l]+0.3061862178478971*f[87][l]*alpha_vdim[240][l]+(0.273861278752583*(f[42][l]+f[34][l])+0.3061862178478971*f[3][l])*alpha_vdim[234][l]+(0.273861278752583*f[90][l]+0.3061862178478971*f[21][l])*alpha_vdim[233][l]+(0.273861278752583*(f[39][l]+f[38][l])+0.3061862178478971*f[4][l])*alpha_vdim[232][l]+(0.273861278752583*f[89][l]+0.3061862178478971*f[22][l])*alpha_vdim[231][l]+(0.273861278752583*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[230][l]+(0.273861278752583*f[67][l]+0.3061862178478971*f[8][l])*alpha_vdim[228][l]+(0.273861278752583*f[64][l]+0.3061862178478971*f[10][l])*alpha_vdim[227][l]+0.273861278752583*f[62][l]*alpha_vdim[226][l]+0.3061862178478971*(f[11][l]*alpha_vdim[226][l]+f[51][l]*alpha_vdim[225][l]+f[24][l]*alpha_vdim[224][l])+(0.2449489742783178*f[103][l]+0.273861278752583*f[21][l])*alpha_vdim[181][l]+0.3061862178478971*f[33][l]*alpha_vdim[180][l]+(0.2449489742783178*f[93][l]+0.273861278752583*f[25][l])*alpha_vdim[169][l]+0.3061862178478971*f[43][l]*alpha_vdim[168][l]+(0.2449489742783178*f[82][l]+0.273861278752583*f[8][l])*alpha_vdim[156][l]+0.3061862178478971*f[56][l]*alpha_vdim[155][l]+(0.2449489742783178*f[73][l]+0.273861278752583*f[13][l])*alpha_vdim[146][l]+0.3061862178478971*f[68][l]*alpha_vdim[145][l]+0.273861278752583*f[52][l]*alpha_vdim[144][l]+0.3061862178478971*f[70][l]*alpha_vdim[143][l]+(0.273861278752583*(f[81][l]+f[57][l])+0.3061862178478971*f[7][l])*alpha_vdim[137][l]+(0.273861278752583*(f[72][l]+f[69][l])+0.3061862178478971*f[12][l])*alpha_vdim[133][l]+0.273861278752583*f[27][l]*alpha_vdim[129][l]+0.3061862178478971*f[91][l]*alpha_vdim[128][l]+(0.273861278752583*(f[49][l]+f[34][l])+0.3061862178478971*f[3][l])*alpha_vdim[125][l]+(0.273861278752583*f[103][l]+0.3061862178478971*f[21][l])*alpha_vdim[124][l]+(0.273861278752583*(f[45][l]+f[44][l])+0.3061862178478971*f[5][l])*alpha_vdim[120][l]+(0.273861278752583*f[93][l]+0.3061862178478971*f[25][l])*alpha_vdim[119][l]+(0.273861278752583*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[118][l]+(0.273861278752583*f[82][l]+0.3061862178478971*f[8][l])*alpha_vdim[117][l]+(0.273861278752583*f[79][l]+0.3061862178478971*f[14][l])*alpha_cdim[116][l]+(0.273861278752583*f[73][l]+0.3061862178478971*f[13][l])*alpha_vdim[115][l]+0.273861278752583*f[71][l]*alpha_vdim[114][l]+0.3061862178478971*(f[14][l]*alpha_vdim[114][l]+f[52][l]*alpha_vdim[113][l]+f[27][l]*alpha_vdim[112][l]+f[30][l]*alpha_cdim[112][l])+(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[104][l]+0.2449489742783178*alpha_vdim[60][l]*f[100][l]+0.273861278752583*(alpha_vdim[9][l]*f[100][l]+alpha_vdim[6][l]*f[95][l])+0.3061862178478971*alpha_vdim[16][l]*f[94][l]+0.2449489742783178*alpha_vdim[44][l]*f[84][l]+0.273861278752583*(alpha_vdim[5][l]*f[84][l]+alpha_vdim[25][l]*f[83][l])+0.2449489742783178*alpha_vdim[38][l]*f[78][l]+0.273861278752583*(alpha_vdim[4][l]*f[78][l]+alpha_vdim[22][l]*f[77][l]+alpha_vdim[2][l]*f[75][l])+0.3061862178478971*alpha_vdim[31][l]*f[74][l]+0.273861278752583*(alpha_vdim[22][l]*f[69][l]+f[22][l]*alpha_vdim[69][l])+0.3061862178478971*(alpha_vdim[37][l]*f[68][l]+f[37][l]*alpha_vdim[68][l])+0.273861278752583*(alpha_vdim[25][l]*f[60][l]+f[25][l]*alpha_vdim[60][l])+0.3061862178478971*(alpha_vdim[43][l]*f[59][l]+f[43][l]*alpha_vdim[59][l])+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[53][l]+0.273861278752583*(alpha_vdim[13][l]*f[50][l]+alpha_vdim[10][l]*(f[46][l]+f[44][l])+f[10][l]*alpha_vdim[44][l]+alpha_vdim[13][l]*f[38][l]+f[13][l]*alpha_vdim[38][l]+alpha_vdim[17][l]*f[29][l])+0.3061862178478971*(alpha_vdim[0][l]*f[29][l]+alpha_vdim[6][l]*f[28][l]+alpha_vdim[9][l]*f[25][l]+f[9][l]*alpha_vdim[25][l]+alpha_vdim[12][l]*f[22][l]+f[12][l]*alpha_vdim[22][l]+alpha_vdim[2][l]*f[15][l]+alpha_vdim[4][l]*f[13][l]+f[4][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*f[10][l]+f[5][l]*alpha_vdim[10][l]);
+    out[56][l] += 0.3061862178478971*(f[61][l]*alpha_cdim[116][l]+f[33][l]*alpha_cdim[112][l])+0.2449489742783178*(alpha_vdim[25][l]*f[69][l]+f[25][l]*alpha_vdim[69][l])+(0.273861278752583*alpha_vdim[44][l]+0.1956151991089878*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[68][l]+(0.273861278752583*f[44][l]+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[68][l]+0.2449489742783178*(alpha_vdim[22][l]*f[60][l]+f[22][l]*alpha_vdim[60][l])+(0.273861278752583*alpha_vdim[38][l]+0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[59][l]+(0.273861278752583*f[38][l]+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[59][l]+0.6123724356957944*alpha_cdim[3][l]*f[58][l]+0.3061862178478971*(alpha_vdim[13][l]*f[43][l]+f[13][l]*alpha_vdim[43][l]+alpha_vdim[10][l]*f[37][l]+f[10][l]*alpha_vdim[37][l])+0.2449489742783178*(alpha_vdim[6][l]*f[32][l]+f[6][l]*alpha_vdim[32][l])+(0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[31][l]+(0.273861278752583*f[17][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[31][l]+0.273861278752583*(alpha_vdim[12][l]*f[25][l]+f[12][l]*alpha_vdim[25][l]+alpha_vdim[9][l]*f[22][l]+f[9][l]*alpha_vdim[22][l])+0.6846531968814573*alpha_cdim[0][l]*f[21][l]+0.3061862178478971*(alpha_vdim[2][l]*f[16][l]+f[2][l]*alpha_vdim[16][l])+0.6846531968814573*alpha_cdim[3][l]*f[6][l]+0.273861278752583*(alpha_vdim[1][l]*f[6][l]+f[1][l]*alpha_vdim[6][l]);
+    out[57][l] += 0.6846531968814573*(f[51][l]*alpha_cdim[116][l]+f[21][l]*alpha_cdim[112][l])+(0.1956151991089878*alpha_vdim[44][l]+0.273861278752583*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[69][l]+(0.1956151991089878*f[44][l]+0.273861278752583*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[69][l]+0.2449489742783178*(alpha_vdim[25][l]*f[68][l]+f[25][l]*alpha_vdim[68][l])+(0.1956151991089878*alpha_vdim[38][l]+0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[60][l]+(0.1956151991089878*f[38][l]+0.273861278752583*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[60][l]+0.2449489742783178*(alpha_vdim[22][l]*f[59][l]+f[22][l]*alpha_vdim[59][l])+0.3061862178478971*(alpha_vdim[12][l]*f[44][l]+f[12][l]*alpha_vdim[44][l]+alpha_vdim[9][l]*f[38][l]+f[9][l]*alpha_vdim[38][l]+alpha_cdim[0][l]*f[34][l])+(0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[32][l]+(0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[32][l]+0.2449489742783178*(alpha_vdim[6][l]*f[31][l]+f[6][l]*alpha_vdim[31][l])+0.273861278752583*(alpha_vdim[13][l]*f[25][l]+f[13][l]*alpha_vdim[25][l]+alpha_vdim[10][l]*f[22][l]+f[10][l]*alpha_vdim[22][l])+0.3061862178478971*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[17][l]+f[1][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[2][l]*f[6][l]+f[2][l]*alpha_vdim[6][l]);
+    out[58][l] += 0.3061862178478971*(f[63][l]*alpha_cdim[116][l]+f[35][l]*alpha_cdim[112][l])+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[92][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[91][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[88][l]+0.5477225575051661*alpha_vdim[60][l]*f[87][l]+0.6123724356957944*(alpha_vdim[9][l]*f[87][l]+alpha_vdim[25][l]*(f[71][l]+f[70][l])+f[27][l]*alpha_vdim[69][l]+f[26][l]*alpha_vdim[68][l]+alpha_vdim[22][l]*(f[62][l]+f[61][l])+f[24][l]*alpha_vdim[60][l]+f[23][l]*alpha_vdim[59][l])+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[57][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[56][l]+(0.6123724356957944*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6846531968814573*alpha_vdim[5][l])*f[52][l]+(0.6123724356957944*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[51][l]+0.3061862178478971*alpha_cdim[0][l]*f[36][l]+0.6123724356957944*(alpha_vdim[6][l]*(f[34][l]+f[33][l])+f[8][l]*alpha_vdim[32][l]+f[7][l]*alpha_vdim[31][l])+0.6846531968814573*(alpha_vdim[12][l]*f[27][l]+alpha_vdim[13][l]*f[26][l]+f[14][l]*alpha_vdim[25][l]+alpha_vdim[9][l]*f[24][l]+alpha_vdim[10][l]*f[23][l]+f[11][l]*alpha_vdim[22][l])+(0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[21][l]+0.273861278752583*alpha_cdim[3][l]*f[8][l]+0.6846531968814573*(alpha_vdim[1][l]*f[8][l]+alpha_vdim[2][l]*f[7][l]+f[3][l]*alpha_vdim[6][l]);
+    out[59][l] += 0.2449489742783178*f[25][l]*alpha_vdim[181][l]+(0.273861278752583*f[44][l]+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[180][l]+0.2449489742783178*f[21][l]*alpha_vdim[169][l]+(0.273861278752583*f[34][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[168][l]+0.273861278752583*f[68][l]*alpha_vdim[156][l]+(0.1956151991089878*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[155][l]+0.273861278752583*f[56][l]*alpha_vdim[146][l]+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[145][l]+0.2449489742783178*f[6][l]*alpha_vdim[144][l]+(0.273861278752583*f[17][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[143][l]+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[137][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[133][l]+f[31][l]*(0.273861278752583*alpha_vdim[129][l]+0.1956151991089878*alpha_vdim[128][l])+0.3061862178478971*(f[2][l]*alpha_vdim[128][l]+f[43][l]*alpha_vdim[125][l])+0.273861278752583*f[25][l]*alpha_vdim[124][l]+0.3061862178478971*f[33][l]*alpha_vdim[120][l]+0.273861278752583*f[21][l]*alpha_vdim[119][l]+(0.2449489742783178*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[118][l]+0.3061862178478971*(f[68][l]*alpha_vdim[117][l]+f[16][l]*alpha_cdim[116][l]+f[56][l]*alpha_vdim[115][l]+f[16][l]*alpha_vdim[114][l])+0.273861278752583*f[6][l]*alpha_vdim[113][l]+0.3061862178478971*(f[31][l]*alpha_vdim[112][l]+f[37][l]*alpha_cdim[112][l])+0.6846531968814573*(alpha_cdim[3][l]*f[51][l]+alpha_cdim[0][l]*f[22][l]);
+    out[60][l] += (0.1956151991089878*f[44][l]+0.273861278752583*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[181][l]+0.2449489742783178*f[25][l]*alpha_vdim[180][l]+(0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[169][l]+0.2449489742783178*f[21][l]*alpha_vdim[168][l]+(0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[156][l]+0.273861278752583*f[69][l]*alpha_vdim[155][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[146][l]+0.273861278752583*f[57][l]*alpha_vdim[145][l]+(0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[144][l]+0.2449489742783178*f[6][l]*alpha_vdim[143][l]+(0.2449489742783178*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[137][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[133][l]+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[129][l]+0.273861278752583*(f[32][l]*alpha_vdim[128][l]+f[25][l]*alpha_vdim[125][l])+0.3061862178478971*f[44][l]*alpha_vdim[124][l]+0.273861278752583*f[21][l]*alpha_vdim[120][l]+0.3061862178478971*f[34][l]*alpha_vdim[119][l]+(0.2449489742783178*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[118][l]+0.3061862178478971*f[69][l]*alpha_vdim[117][l]+(0.6123724356957944*f[65][l]+0.6846531968814573*f[6][l])*alpha_cdim[116][l]+0.3061862178478971*f[57][l]*alpha_vdim[115][l]+0.273861278752583*f[6][l]*alpha_vdim[114][l]+0.3061862178478971*(f[17][l]*alpha_vdim[113][l]+f[32][l]*alpha_vdim[112][l])+0.6846531968814573*f[22][l]*alpha_cdim[112][l]+0.3061862178478971*(alpha_cdim[3][l]*f[62][l]+alpha_cdim[0][l]*f[38][l]);
+    out[61][l] += 0.273861278752583*f[92][l]*alpha_vdim[181][l]+(0.1956151991089878*f[91][l]+0.3061862178478971*f[27][l])*alpha_vdim[180][l]+0.273861278752583*f[32][l]*alpha_vdim[169][l]+(0.273861278752583*f[36][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[168][l]+(0.1956151991089878*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[155][l]+(0.273861278752583*f[18][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[145][l]+0.273861278752583*f[57][l]*alpha_vdim[144][l]+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[143][l]+0.273861278752583*f[52][l]*alpha_vdim[137][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[133][l]+0.1956151991089878*f[33][l]*alpha_vdim[128][l]+0.3061862178478971*(f[3][l]*alpha_vdim[128][l]+f[91][l]*alpha_vdim[125][l])+0.273861278752583*f[26][l]*alpha_vdim[124][l]+0.3061862178478971*f[31][l]*alpha_vdim[120][l]+0.2449489742783178*f[35][l]*alpha_vdim[119][l]+0.273861278752583*(f[1][l]*alpha_vdim[119][l]+f[21][l]*alpha_vdim[118][l])+0.3061862178478971*(f[70][l]*alpha_vdim[117][l]+f[16][l]*alpha_vdim[115][l]+f[56][l]*alpha_vdim[114][l])+0.273861278752583*f[7][l]*alpha_vdim[113][l]+0.3061862178478971*f[33][l]*alpha_vdim[112][l]+0.273861278752583*alpha_vdim[69][l]*f[95][l]+(0.1956151991089878*alpha_vdim[68][l]+0.3061862178478971*alpha_vdim[13][l])*f[94][l]+0.1956151991089878*alpha_vdim[43][l]*f[74][l]+0.3061862178478971*(alpha_vdim[5][l]*f[74][l]+f[29][l]*alpha_vdim[68][l])+0.2449489742783178*alpha_vdim[22][l]*f[65][l]+0.6123724356957944*alpha_cdim[3][l]*f[63][l]+0.273861278752583*(alpha_vdim[32][l]*f[60][l]+f[32][l]*alpha_vdim[60][l])+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[59][l]+(0.273861278752583*f[41][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[25][l]*f[53][l]+0.3061862178478971*f[15][l]*alpha_vdim[43][l]+0.2449489742783178*alpha_vdim[9][l]*f[40][l]+(0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[37][l]+(0.273861278752583*f[19][l]+0.1956151991089878*f[16][l])*alpha_vdim[37][l]+0.3061862178478971*(f[0][l]*alpha_vdim[37][l]+alpha_vdim[10][l]*f[31][l]+f[10][l]*alpha_vdim[31][l])+0.273861278752583*alpha_vdim[12][l]*f[28][l]+0.6846531968814573*alpha_cdim[0][l]*f[23][l]+0.273861278752583*(alpha_vdim[6][l]*f[22][l]+f[6][l]*alpha_vdim[22][l])+0.3061862178478971*(alpha_vdim[4][l]*f[16][l]+f[4][l]*alpha_vdim[16][l])+0.6846531968814573*alpha_cdim[3][l]*f[9][l]+0.273861278752583*(alpha_vdim[1][l]*f[9][l]+f[1][l]*alpha_vdim[9][l]);
+    out[62][l] += (0.1956151991089878*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[181][l]+0.273861278752583*f[91][l]*alpha_vdim[180][l]+(0.273861278752583*f[35][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[169][l]+0.273861278752583*f[31][l]*alpha_vdim[168][l]+(0.1956151991089878*f[71][l]+0.3061862178478971*f[14][l])*alpha_vdim[156][l]+(0.273861278752583*f[18][l]+0.1956151991089878*f[17][l]+0.3061862178478971*f[0][l])*alpha_vdim[146][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[144][l]+0.273861278752583*(f[56][l]*alpha_vdim[143][l]+f[52][l]*alpha_vdim[137][l])+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[133][l]+(0.1956151991089878*f[34][l]+0.3061862178478971*f[3][l])*alpha_vdim[129][l]+0.273861278752583*f[27][l]*alpha_vdim[125][l]+0.3061862178478971*f[92][l]*alpha_vdim[124][l]+(0.2449489742783178*f[36][l]+0.273861278752583*f[2][l])*alpha_vdim[120][l]+0.3061862178478971*f[32][l]*alpha_vdim[119][l]+0.273861278752583*f[21][l]*alpha_vdim[118][l]+0.3061862178478971*f[71][l]*alpha_vdim[117][l]+(0.6123724356957944*f[67][l]+0.6846531968814573*f[8][l])*alpha_cdim[116][l]+0.3061862178478971*f[17][l]*alpha_vdim[115][l]+0.273861278752583*f[8][l]*alpha_vdim[114][l]+0.3061862178478971*(f[57][l]*alpha_vdim[113][l]+f[34][l]*alpha_vdim[112][l])+0.6846531968814573*f[24][l]*alpha_cdim[112][l]+(0.1956151991089878*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[95][l]+0.273861278752583*alpha_vdim[68][l]*f[94][l]+0.1956151991089878*alpha_vdim[44][l]*f[75][l]+0.3061862178478971*(alpha_vdim[5][l]*f[75][l]+f[28][l]*alpha_vdim[69][l])+0.2449489742783178*alpha_vdim[22][l]*f[65][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[60][l]+(0.273861278752583*f[40][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[60][l]+0.273861278752583*(alpha_vdim[31][l]*f[59][l]+f[31][l]*alpha_vdim[59][l]+alpha_vdim[25][l]*f[53][l])+0.3061862178478971*f[15][l]*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[10][l]*f[41][l]+(0.1956151991089878*alpha_vdim[17][l]+0.3061862178478971*alpha_vdim[0][l])*f[38][l]+(0.273861278752583*f[19][l]+0.1956151991089878*f[17][l])*alpha_vdim[38][l]+0.3061862178478971*(f[0][l]*alpha_vdim[38][l]+alpha_vdim[9][l]*f[32][l]+f[9][l]*alpha_vdim[32][l])+0.273861278752583*(alpha_vdim[13][l]*f[29][l]+alpha_vdim[6][l]*f[22][l]+f[6][l]*alpha_vdim[22][l])+0.3061862178478971*(alpha_vdim[4][l]*f[17][l]+f[4][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[2][l]*f[10][l]+f[2][l]*alpha_vdim[10][l]);
+    out[63][l] += 0.273861278752583*(f[93][l]*alpha_vdim[180][l]+f[34][l]*alpha_vdim[169][l])+0.2449489742783178*f[21][l]*alpha_vdim[168][l]+0.273861278752583*(f[72][l]*alpha_vdim[155][l]+f[57][l]*alpha_vdim[146][l])+0.2449489742783178*f[7][l]*alpha_vdim[145][l]+0.273861278752583*f[58][l]*alpha_vdim[143][l]+0.3061862178478971*f[73][l]*alpha_vdim[137][l]+0.2449489742783178*f[56][l]*alpha_vdim[133][l]+0.273861278752583*(f[8][l]*alpha_vdim[133][l]+f[35][l]*alpha_vdim[128][l])+0.3061862178478971*(f[93][l]*alpha_vdim[125][l]+f[45][l]*alpha_vdim[124][l])+0.273861278752583*f[21][l]*alpha_vdim[120][l]+(0.2449489742783178*f[33][l]+0.273861278752583*f[3][l])*alpha_vdim[119][l]+0.3061862178478971*(f[36][l]*alpha_vdim[118][l]+f[72][l]*alpha_vdim[117][l])+0.273861278752583*f[7][l]*alpha_vdim[115][l]+0.3061862178478971*(f[58][l]*alpha_vdim[114][l]+f[18][l]*alpha_vdim[113][l]+f[35][l]*alpha_vdim[112][l])+0.6846531968814573*alpha_vdim[44][l]*f[108][l]+0.6123724356957944*alpha_vdim[25][l]*f[107][l]+0.6846531968814573*alpha_vdim[69][l]*f[97][l]+0.6123724356957944*alpha_vdim[12][l]*f[96][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[90][l]+0.6846531968814573*alpha_vdim[17][l]*f[88][l]+0.6123724356957944*alpha_vdim[6][l]*f[87][l]+(0.6123724356957944*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[13][l])*f[86][l]+0.6123724356957944*alpha_vdim[22][l]*f[67][l]+(0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[66][l]+0.6846531968814573*alpha_vdim[32][l]*f[62][l]+0.6123724356957944*alpha_vdim[1][l]*f[61][l]+0.6846531968814573*f[34][l]*alpha_vdim[60][l]+0.6123724356957944*f[21][l]*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[38][l]*f[57][l]+0.6123724356957944*alpha_vdim[22][l]*f[56][l]+0.6846531968814573*alpha_vdim[25][l]*f[55][l]+(0.6123724356957944*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[54][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[51][l]+0.6123724356957944*alpha_vdim[9][l]*f[42][l]+0.3061862178478971*alpha_cdim[0][l]*f[39][l]+0.6123724356957944*(f[7][l]*alpha_vdim[37][l]+alpha_vdim[9][l]*f[33][l])+0.6846531968814573*(alpha_vdim[12][l]*f[30][l]+alpha_vdim[6][l]*f[24][l])+0.6123724356957944*alpha_vdim[16][l]*f[23][l]+0.6846531968814573*(alpha_vdim[0][l]*f[23][l]+f[8][l]*alpha_vdim[22][l]+alpha_vdim[10][l]*f[21][l])+0.273861278752583*alpha_cdim[3][l]*f[11][l]+0.6846531968814573*(alpha_vdim[1][l]*f[11][l]+f[3][l]*alpha_vdim[9][l]+alpha_vdim[4][l]*f[7][l]);
+    out[64][l] += 0.273861278752583*f[93][l]*alpha_vdim[181][l]+0.2449489742783178*f[21][l]*alpha_vdim[169][l]+0.273861278752583*(f[33][l]*alpha_vdim[168][l]+f[73][l]*alpha_vdim[156][l])+0.2449489742783178*f[8][l]*alpha_vdim[146][l]+0.273861278752583*(f[56][l]*alpha_vdim[145][l]+f[58][l]*alpha_vdim[144][l])+0.3061862178478971*f[72][l]*alpha_vdim[137][l]+0.2449489742783178*f[57][l]*alpha_vdim[133][l]+0.273861278752583*(f[7][l]*alpha_vdim[133][l]+f[36][l]*alpha_vdim[129][l])+0.3061862178478971*(f[45][l]*alpha_vdim[125][l]+f[93][l]*alpha_vdim[124][l])+0.2449489742783178*f[34][l]*alpha_vdim[120][l]+0.273861278752583*(f[3][l]*alpha_vdim[120][l]+f[21][l]*alpha_vdim[119][l])+0.3061862178478971*(f[35][l]*alpha_vdim[118][l]+f[73][l]*alpha_vdim[117][l]+f[18][l]*alpha_cdim[116][l])+0.273861278752583*f[8][l]*alpha_vdim[115][l]+0.3061862178478971*(f[18][l]*alpha_vdim[114][l]+f[58][l]*alpha_vdim[113][l]+f[36][l]*alpha_vdim[112][l]+f[39][l]*alpha_cdim[112][l])+0.6123724356957944*alpha_vdim[25][l]*f[108][l]+0.6846531968814573*alpha_vdim[43][l]*f[107][l]+0.6123724356957944*alpha_vdim[13][l]*f[97][l]+0.6846531968814573*alpha_vdim[68][l]*f[96][l]+0.5477225575051661*alpha_vdim[60][l]*f[90][l]+0.6123724356957944*(alpha_vdim[9][l]*f[90][l]+alpha_vdim[6][l]*f[88][l])+0.6846531968814573*alpha_vdim[16][l]*f[87][l]+(0.6123724356957944*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[86][l]+0.5477225575051661*alpha_vdim[38][l]*f[67][l]+0.6123724356957944*(alpha_vdim[4][l]*f[67][l]+alpha_vdim[22][l]*f[66][l]+alpha_vdim[2][l]*f[62][l])+0.6846531968814573*alpha_vdim[31][l]*f[61][l]+0.6123724356957944*f[21][l]*alpha_vdim[60][l]+0.6846531968814573*f[33][l]*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[22][l]*f[57][l]+0.6846531968814573*alpha_vdim[37][l]*f[56][l]+0.6123724356957944*alpha_vdim[44][l]*f[55][l]+0.6846531968814573*(alpha_vdim[5][l]*f[55][l]+alpha_vdim[25][l]*f[54][l])+(0.6123724356957944*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[51][l]+0.6123724356957944*(alpha_vdim[10][l]*f[42][l]+f[8][l]*alpha_vdim[38][l]+alpha_vdim[10][l]*f[34][l])+0.6846531968814573*alpha_vdim[13][l]*f[30][l]+0.6123724356957944*alpha_vdim[17][l]*f[24][l]+0.6846531968814573*(alpha_vdim[0][l]*f[24][l]+alpha_vdim[6][l]*f[23][l]+f[7][l]*alpha_vdim[22][l]+alpha_vdim[9][l]*f[21][l]+alpha_vdim[2][l]*f[11][l]+f[3][l]*alpha_vdim[10][l]+alpha_vdim[4][l]*f[8][l]);
+    out[65][l] += (0.5477225575051661*f[94][l]+0.6123724356957944*f[29][l])*alpha_vdim[181][l]+(0.5477225575051661*f[95][l]+0.6123724356957944*f[28][l])*alpha_vdim[180][l]+(0.5477225575051661*f[87][l]+0.6123724356957944*f[24][l])*alpha_vdim[169][l]+0.5477225575051661*f[88][l]*alpha_vdim[168][l]+0.6123724356957944*(f[23][l]*alpha_vdim[168][l]+f[53][l]*(alpha_vdim[156][l]+alpha_vdim[155][l])+f[51][l]*(alpha_vdim[146][l]+alpha_vdim[145][l]))+(0.5477225575051661*f[59][l]+0.6123724356957944*f[10][l])*alpha_vdim[144][l]+(0.5477225575051661*f[60][l]+0.6123724356957944*f[9][l])*alpha_vdim[143][l]+(0.6123724356957944*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[137][l]+(0.6123724356957944*(f[62][l]+f[61][l])+0.6846531968814573*f[11][l])*alpha_vdim[133][l]+0.6123724356957944*f[22][l]*(alpha_vdim[129][l]+alpha_vdim[128][l])+(0.6123724356957944*f[95][l]+0.6846531968814573*f[28][l])*alpha_vdim[125][l]+(0.6123724356957944*f[94][l]+0.6846531968814573*f[29][l])*alpha_vdim[124][l]+(0.6123724356957944*f[88][l]+0.6846531968814573*f[23][l])*alpha_vdim[120][l]+(0.6123724356957944*f[87][l]+0.6846531968814573*f[24][l])*alpha_vdim[119][l]+0.6123724356957944*(f[38][l]+f[37][l])*alpha_vdim[118][l]+0.6846531968814573*(f[4][l]*alpha_vdim[118][l]+f[53][l]*alpha_vdim[117][l])+0.273861278752583*f[9][l]*alpha_cdim[116][l]+0.6846531968814573*f[51][l]*alpha_vdim[115][l]+(0.6123724356957944*f[60][l]+0.6846531968814573*f[9][l])*alpha_vdim[114][l]+0.6123724356957944*f[59][l]*alpha_vdim[113][l]+0.6846531968814573*(f[10][l]*alpha_vdim[113][l]+f[22][l]*alpha_vdim[112][l])+0.3061862178478971*(f[40][l]*alpha_cdim[112][l]+alpha_cdim[3][l]*f[67][l]+alpha_cdim[0][l]*f[41][l]);
+    out[66][l] += 0.6846531968814573*f[97][l]*alpha_vdim[181][l]+0.6123724356957944*f[86][l]*alpha_vdim[180][l]+0.6846531968814573*f[38][l]*alpha_vdim[169][l]+(0.5477225575051661*f[89][l]+0.6123724356957944*f[22][l])*alpha_vdim[168][l]+0.6846531968814573*f[108][l]*alpha_vdim[156][l]+0.6123724356957944*f[54][l]*alpha_vdim[155][l]+0.6846531968814573*f[60][l]*alpha_vdim[146][l]+(0.5477225575051661*f[63][l]+0.6123724356957944*f[9][l])*alpha_vdim[145][l]+0.6846531968814573*f[62][l]*alpha_vdim[144][l]+0.6123724356957944*f[51][l]*alpha_vdim[143][l]+(0.6123724356957944*f[107][l]+0.6846531968814573*f[55][l])*alpha_vdim[137][l]+0.6123724356957944*(f[64][l]+f[59][l])*alpha_vdim[133][l]+0.6846531968814573*(f[10][l]*alpha_vdim[133][l]+f[88][l]*alpha_vdim[129][l])+0.6123724356957944*f[23][l]*alpha_vdim[128][l]+0.6846531968814573*f[86][l]*alpha_vdim[125][l]+(0.6123724356957944*f[96][l]+0.6846531968814573*f[30][l])*alpha_vdim[124][l]+(0.6123724356957944*f[89][l]+0.6846531968814573*f[22][l])*alpha_vdim[120][l]+(0.6123724356957944*(f[39][l]+f[37][l])+0.6846531968814573*f[4][l])*alpha_vdim[119][l]+0.6123724356957944*f[87][l]*alpha_vdim[118][l]+0.6846531968814573*(f[24][l]*alpha_vdim[118][l]+f[54][l]*alpha_vdim[117][l])+0.6123724356957944*f[63][l]*alpha_vdim[115][l]+0.6846531968814573*(f[9][l]*alpha_vdim[115][l]+f[51][l]*alpha_vdim[114][l])+0.6123724356957944*f[61][l]*alpha_vdim[113][l]+0.6846531968814573*(f[11][l]*alpha_vdim[113][l]+f[23][l]*alpha_vdim[112][l])+0.273861278752583*alpha_vdim[68][l]*f[100][l]+0.3061862178478971*(alpha_vdim[13][l]*f[100][l]+alpha_vdim[25][l]*f[78][l])+(0.273861278752583*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[77][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[65][l]+0.273861278752583*(alpha_vdim[38][l]*f[60][l]+f[38][l]*alpha_vdim[60][l])+0.2449489742783178*(alpha_vdim[22][l]*f[59][l]+f[22][l]*alpha_vdim[59][l])+0.3061862178478971*(alpha_vdim[12][l]*f[46][l]+alpha_cdim[0][l]*f[42][l]+alpha_vdim[6][l]*f[41][l])+(0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[40][l]+0.2449489742783178*(alpha_vdim[9][l]*f[37][l]+f[9][l]*alpha_vdim[37][l])+0.273861278752583*(alpha_vdim[10][l]*f[22][l]+f[10][l]*alpha_vdim[22][l])+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l])*f[19][l]+0.273861278752583*(alpha_vdim[4][l]*f[9][l]+f[4][l]*alpha_vdim[9][l]);
+    out[67][l] += 0.6123724356957944*f[86][l]*alpha_vdim[181][l]+0.6846531968814573*f[96][l]*alpha_vdim[180][l]+(0.5477225575051661*f[89][l]+0.6123724356957944*f[22][l])*alpha_vdim[169][l]+0.6846531968814573*f[37][l]*alpha_vdim[168][l]+0.6123724356957944*f[55][l]*alpha_vdim[156][l]+0.6846531968814573*f[107][l]*alpha_vdim[155][l]+(0.5477225575051661*f[64][l]+0.6123724356957944*f[10][l])*alpha_vdim[146][l]+0.6846531968814573*f[59][l]*alpha_vdim[145][l]+0.6123724356957944*f[51][l]*alpha_vdim[144][l]+0.6846531968814573*f[61][l]*alpha_vdim[143][l]+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[137][l]+(0.6123724356957944*(f[63][l]+f[60][l])+0.6846531968814573*f[9][l])*alpha_vdim[133][l]+0.6123724356957944*f[24][l]*alpha_vdim[129][l]+0.6846531968814573*f[87][l]*alpha_vdim[128][l]+0.6123724356957944*f[97][l]*alpha_vdim[125][l]+0.6846531968814573*(f[30][l]*alpha_vdim[125][l]+f[86][l]*alpha_vdim[124][l])+(0.6123724356957944*(f[39][l]+f[38][l])+0.6846531968814573*f[4][l])*alpha_vdim[120][l]+(0.6123724356957944*f[89][l]+0.6846531968814573*f[22][l])*alpha_vdim[119][l]+0.6123724356957944*f[88][l]*alpha_vdim[118][l]+0.6846531968814573*(f[23][l]*alpha_vdim[118][l]+f[55][l]*alpha_vdim[117][l])+0.273861278752583*f[11][l]*alpha_cdim[116][l]+(0.6123724356957944*f[64][l]+0.6846531968814573*f[10][l])*alpha_vdim[115][l]+0.6123724356957944*f[62][l]*alpha_vdim[114][l]+0.6846531968814573*(f[11][l]*alpha_vdim[114][l]+f[51][l]*alpha_vdim[113][l]+f[24][l]*alpha_vdim[112][l])+0.3061862178478971*f[42][l]*alpha_cdim[112][l]+(0.273861278752583*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[100][l]+0.273861278752583*alpha_vdim[44][l]*f[78][l]+0.3061862178478971*(alpha_vdim[5][l]*f[78][l]+alpha_vdim[25][l]*f[77][l])+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[65][l]+0.2449489742783178*(alpha_vdim[22][l]*f[60][l]+f[22][l]*alpha_vdim[60][l])+0.273861278752583*(alpha_vdim[37][l]*f[59][l]+f[37][l]*alpha_vdim[59][l])+0.3061862178478971*alpha_vdim[13][l]*f[46][l]+0.273861278752583*alpha_vdim[17][l]*f[41][l]+0.3061862178478971*(alpha_vdim[0][l]*f[41][l]+alpha_vdim[6][l]*f[40][l])+0.2449489742783178*(alpha_vdim[10][l]*f[38][l]+f[10][l]*alpha_vdim[38][l])+0.273861278752583*(alpha_vdim[9][l]*f[22][l]+f[9][l]*alpha_vdim[22][l])+0.3061862178478971*alpha_vdim[2][l]*f[19][l]+0.273861278752583*(alpha_vdim[4][l]*f[10][l]+f[4][l]*alpha_vdim[10][l]);
+    out[68][l] += 0.2449489742783178*f[22][l]*alpha_vdim[284][l]+(0.273861278752583*f[38][l]+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[283][l]+0.2449489742783178*f[21][l]*alpha_vdim[281][l]+(0.273861278752583*f[34][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[280][l]+0.273861278752583*f[59][l]*alpha_vdim[262][l]+(0.1956151991089878*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[261][l]+0.273861278752583*f[56][l]*alpha_vdim[258][l]+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[257][l]+0.2449489742783178*f[6][l]*alpha_vdim[256][l]+(0.273861278752583*f[17][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[255][l]+(0.2449489742783178*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[246][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[245][l]+f[31][l]*(0.273861278752583*alpha_vdim[241][l]+0.1956151991089878*alpha_vdim[240][l])+0.3061862178478971*(f[2][l]*alpha_vdim[240][l]+f[37][l]*alpha_vdim[234][l])+0.273861278752583*f[22][l]*alpha_vdim[233][l]+0.3061862178478971*f[33][l]*alpha_vdim[232][l]+0.273861278752583*f[21][l]*alpha_vdim[231][l]+(0.2449489742783178*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[230][l]+0.3061862178478971*(f[59][l]*alpha_vdim[228][l]+f[56][l]*alpha_vdim[227][l]+f[16][l]*alpha_vdim[226][l])+0.273861278752583*f[6][l]*alpha_vdim[225][l]+0.3061862178478971*(f[31][l]*alpha_vdim[224][l]+f[74][l]*alpha_cdim[116][l]+f[43][l]*alpha_cdim[112][l])+0.6846531968814573*(alpha_cdim[3][l]*f[52][l]+alpha_cdim[0][l]*f[25][l]);
+    out[69][l] += (0.1956151991089878*f[38][l]+0.273861278752583*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[284][l]+0.2449489742783178*f[22][l]*alpha_vdim[283][l]+(0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[281][l]+0.2449489742783178*f[21][l]*alpha_vdim[280][l]+(0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[262][l]+0.273861278752583*f[60][l]*alpha_vdim[261][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[258][l]+0.273861278752583*f[57][l]*alpha_vdim[257][l]+(0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[256][l]+0.2449489742783178*f[6][l]*alpha_vdim[255][l]+(0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[246][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[245][l]+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[241][l]+0.273861278752583*(f[32][l]*alpha_vdim[240][l]+f[22][l]*alpha_vdim[234][l])+0.3061862178478971*f[38][l]*alpha_vdim[233][l]+0.273861278752583*f[21][l]*alpha_vdim[232][l]+0.3061862178478971*f[34][l]*alpha_vdim[231][l]+(0.2449489742783178*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[230][l]+0.3061862178478971*(f[60][l]*alpha_vdim[228][l]+f[57][l]*alpha_vdim[227][l])+0.273861278752583*f[6][l]*alpha_vdim[226][l]+0.3061862178478971*(f[17][l]*alpha_vdim[225][l]+f[32][l]*alpha_vdim[224][l])+0.6846531968814573*(f[53][l]*alpha_cdim[116][l]+f[25][l]*alpha_cdim[112][l])+0.3061862178478971*(alpha_cdim[3][l]*f[71][l]+alpha_cdim[0][l]*f[44][l]);
+    out[70][l] += 0.273861278752583*f[88][l]*alpha_vdim[284][l]+(0.1956151991089878*f[87][l]+0.3061862178478971*f[24][l])*alpha_vdim[283][l]+0.273861278752583*f[32][l]*alpha_vdim[281][l]+(0.273861278752583*f[36][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[280][l]+(0.1956151991089878*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[261][l]+(0.273861278752583*f[18][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[257][l]+0.273861278752583*f[57][l]*alpha_vdim[256][l]+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[255][l]+0.273861278752583*f[51][l]*alpha_vdim[246][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[245][l]+0.1956151991089878*f[33][l]*alpha_vdim[240][l]+0.3061862178478971*(f[3][l]*alpha_vdim[240][l]+f[87][l]*alpha_vdim[234][l])+0.273861278752583*f[23][l]*alpha_vdim[233][l]+0.3061862178478971*f[31][l]*alpha_vdim[232][l]+0.2449489742783178*f[35][l]*alpha_vdim[231][l]+0.273861278752583*(f[1][l]*alpha_vdim[231][l]+f[21][l]*alpha_vdim[230][l])+0.3061862178478971*(f[61][l]*alpha_vdim[228][l]+f[16][l]*alpha_vdim[227][l]+f[56][l]*alpha_vdim[226][l])+0.273861278752583*f[7][l]*alpha_vdim[225][l]+0.3061862178478971*f[33][l]*alpha_vdim[224][l]+0.273861278752583*alpha_vdim[60][l]*f[95][l]+(0.1956151991089878*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[94][l]+0.2449489742783178*alpha_vdim[25][l]*f[80][l]+(0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[74][l]+0.6123724356957944*alpha_cdim[3][l]*f[72][l]+0.273861278752583*(alpha_vdim[32][l]*f[69][l]+f[32][l]*alpha_vdim[69][l])+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[68][l]+(0.273861278752583*f[48][l]+0.1956151991089878*f[31][l])*alpha_vdim[68][l]+0.3061862178478971*(f[2][l]*alpha_vdim[68][l]+f[29][l]*alpha_vdim[59][l])+0.273861278752583*alpha_vdim[22][l]*f[53][l]+0.2449489742783178*alpha_vdim[12][l]*f[47][l]+(0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[43][l]+(0.273861278752583*f[20][l]+0.1956151991089878*f[16][l])*alpha_vdim[43][l]+0.3061862178478971*(f[0][l]*alpha_vdim[43][l]+f[15][l]*alpha_vdim[37][l]+alpha_vdim[13][l]*f[31][l]+f[13][l]*alpha_vdim[31][l])+0.273861278752583*alpha_vdim[9][l]*f[28][l]+0.6846531968814573*alpha_cdim[0][l]*f[26][l]+0.273861278752583*(alpha_vdim[6][l]*f[25][l]+f[6][l]*alpha_vdim[25][l])+0.3061862178478971*(alpha_vdim[5][l]*f[16][l]+f[5][l]*alpha_vdim[16][l])+0.6846531968814573*alpha_cdim[3][l]*f[12][l]+0.273861278752583*(alpha_vdim[1][l]*f[12][l]+f[1][l]*alpha_vdim[12][l]);
+    out[71][l] += (0.1956151991089878*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[284][l]+0.273861278752583*f[87][l]*alpha_vdim[283][l]+(0.273861278752583*f[35][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[281][l]+0.273861278752583*f[31][l]*alpha_vdim[280][l]+(0.1956151991089878*f[62][l]+0.3061862178478971*f[11][l])*alpha_vdim[262][l]+(0.273861278752583*f[18][l]+0.1956151991089878*f[17][l]+0.3061862178478971*f[0][l])*alpha_vdim[258][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[256][l]+0.273861278752583*(f[56][l]*alpha_vdim[255][l]+f[51][l]*alpha_vdim[246][l])+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[245][l]+(0.1956151991089878*f[34][l]+0.3061862178478971*f[3][l])*alpha_vdim[241][l]+0.273861278752583*f[24][l]*alpha_vdim[234][l]+0.3061862178478971*f[88][l]*alpha_vdim[233][l]+(0.2449489742783178*f[36][l]+0.273861278752583*f[2][l])*alpha_vdim[232][l]+0.3061862178478971*f[32][l]*alpha_vdim[231][l]+0.273861278752583*f[21][l]*alpha_vdim[230][l]+0.3061862178478971*(f[62][l]*alpha_vdim[228][l]+f[17][l]*alpha_vdim[227][l])+0.273861278752583*f[8][l]*alpha_vdim[226][l]+0.3061862178478971*(f[57][l]*alpha_vdim[225][l]+f[34][l]*alpha_vdim[224][l])+0.6846531968814573*(f[55][l]*alpha_cdim[116][l]+f[27][l]*alpha_cdim[112][l])+(0.1956151991089878*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[95][l]+0.273861278752583*alpha_vdim[59][l]*f[94][l]+0.2449489742783178*alpha_vdim[25][l]*f[80][l]+(0.1956151991089878*alpha_vdim[38][l]+0.3061862178478971*alpha_vdim[4][l])*f[75][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[69][l]+(0.273861278752583*f[47][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[69][l]+0.273861278752583*(alpha_vdim[31][l]*f[68][l]+f[31][l]*alpha_vdim[68][l])+0.3061862178478971*f[28][l]*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[22][l]*f[53][l]+0.2449489742783178*alpha_vdim[13][l]*f[48][l]+(0.1956151991089878*alpha_vdim[17][l]+0.3061862178478971*alpha_vdim[0][l])*f[44][l]+(0.273861278752583*f[20][l]+0.1956151991089878*f[17][l])*alpha_vdim[44][l]+0.3061862178478971*(f[0][l]*alpha_vdim[44][l]+f[15][l]*alpha_vdim[38][l]+alpha_vdim[12][l]*f[32][l]+f[12][l]*alpha_vdim[32][l])+0.273861278752583*(alpha_vdim[10][l]*f[29][l]+alpha_vdim[6][l]*f[25][l]+f[6][l]*alpha_vdim[25][l])+0.3061862178478971*(alpha_vdim[5][l]*f[17][l]+f[5][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[2][l]*f[13][l]+f[2][l]*alpha_vdim[13][l]);
+    out[72][l] += 0.273861278752583*(f[89][l]*alpha_vdim[283][l]+f[34][l]*alpha_vdim[281][l])+0.2449489742783178*f[21][l]*alpha_vdim[280][l]+0.273861278752583*(f[63][l]*alpha_vdim[261][l]+f[57][l]*alpha_vdim[258][l])+0.2449489742783178*f[7][l]*alpha_vdim[257][l]+0.273861278752583*f[58][l]*alpha_vdim[255][l]+0.3061862178478971*f[64][l]*alpha_vdim[246][l]+0.2449489742783178*f[56][l]*alpha_vdim[245][l]+0.273861278752583*(f[8][l]*alpha_vdim[245][l]+f[35][l]*alpha_vdim[240][l])+0.3061862178478971*(f[89][l]*alpha_vdim[234][l]+f[39][l]*alpha_vdim[233][l])+0.273861278752583*f[21][l]*alpha_vdim[232][l]+(0.2449489742783178*f[33][l]+0.273861278752583*f[3][l])*alpha_vdim[231][l]+0.3061862178478971*(f[36][l]*alpha_vdim[230][l]+f[63][l]*alpha_vdim[228][l])+0.273861278752583*f[7][l]*alpha_vdim[227][l]+0.3061862178478971*(f[58][l]*alpha_vdim[226][l]+f[18][l]*alpha_vdim[225][l]+f[35][l]*alpha_vdim[224][l])+0.6846531968814573*alpha_vdim[38][l]*f[108][l]+0.6123724356957944*alpha_vdim[22][l]*f[107][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[103][l]+0.6846531968814573*alpha_vdim[60][l]*f[97][l]+0.6123724356957944*alpha_vdim[9][l]*f[96][l]+0.6846531968814573*alpha_vdim[17][l]*f[92][l]+0.6123724356957944*alpha_vdim[6][l]*f[91][l]+(0.6123724356957944*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[10][l])*f[86][l]+0.6123724356957944*alpha_vdim[25][l]*f[82][l]+(0.5477225575051661*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[81][l]+0.6846531968814573*alpha_vdim[32][l]*f[71][l]+0.6123724356957944*alpha_vdim[1][l]*f[70][l]+0.6846531968814573*f[34][l]*alpha_vdim[69][l]+0.6123724356957944*f[21][l]*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[44][l]*f[57][l]+0.6123724356957944*alpha_vdim[25][l]*f[56][l]+0.6846531968814573*alpha_vdim[22][l]*f[55][l]+(0.6123724356957944*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[54][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[52][l]+0.6123724356957944*alpha_vdim[12][l]*f[49][l]+0.3061862178478971*alpha_cdim[0][l]*f[45][l]+0.6123724356957944*(f[7][l]*alpha_vdim[43][l]+alpha_vdim[12][l]*f[33][l])+0.6846531968814573*(alpha_vdim[9][l]*f[30][l]+alpha_vdim[6][l]*f[27][l])+0.6123724356957944*alpha_vdim[16][l]*f[26][l]+0.6846531968814573*(alpha_vdim[0][l]*f[26][l]+f[8][l]*alpha_vdim[25][l]+alpha_vdim[13][l]*f[21][l])+0.273861278752583*alpha_cdim[3][l]*f[14][l]+0.6846531968814573*(alpha_vdim[1][l]*f[14][l]+f[3][l]*alpha_vdim[12][l]+alpha_vdim[5][l]*f[7][l]);
+    out[73][l] += 0.273861278752583*f[89][l]*alpha_vdim[284][l]+0.2449489742783178*f[21][l]*alpha_vdim[281][l]+0.273861278752583*(f[33][l]*alpha_vdim[280][l]+f[64][l]*alpha_vdim[262][l])+0.2449489742783178*f[8][l]*alpha_vdim[258][l]+0.273861278752583*(f[56][l]*alpha_vdim[257][l]+f[58][l]*alpha_vdim[256][l])+0.3061862178478971*f[63][l]*alpha_vdim[246][l]+0.2449489742783178*f[57][l]*alpha_vdim[245][l]+0.273861278752583*(f[7][l]*alpha_vdim[245][l]+f[36][l]*alpha_vdim[241][l])+0.3061862178478971*(f[39][l]*alpha_vdim[234][l]+f[89][l]*alpha_vdim[233][l])+0.2449489742783178*f[34][l]*alpha_vdim[232][l]+0.273861278752583*(f[3][l]*alpha_vdim[232][l]+f[21][l]*alpha_vdim[231][l])+0.3061862178478971*(f[35][l]*alpha_vdim[230][l]+f[64][l]*alpha_vdim[228][l])+0.273861278752583*f[8][l]*alpha_vdim[227][l]+0.3061862178478971*(f[18][l]*alpha_vdim[226][l]+f[58][l]*alpha_vdim[225][l]+f[36][l]*alpha_vdim[224][l]+f[76][l]*alpha_cdim[116][l]+f[45][l]*alpha_cdim[112][l])+0.6123724356957944*alpha_vdim[22][l]*f[108][l]+0.6846531968814573*alpha_vdim[37][l]*f[107][l]+0.5477225575051661*alpha_vdim[69][l]*f[103][l]+0.6123724356957944*(alpha_vdim[12][l]*f[103][l]+alpha_vdim[10][l]*f[97][l])+0.6846531968814573*alpha_vdim[59][l]*f[96][l]+0.6123724356957944*alpha_vdim[6][l]*f[92][l]+0.6846531968814573*alpha_vdim[16][l]*f[91][l]+(0.6123724356957944*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[86][l]+0.5477225575051661*alpha_vdim[44][l]*f[82][l]+0.6123724356957944*(alpha_vdim[5][l]*f[82][l]+alpha_vdim[25][l]*f[81][l]+alpha_vdim[2][l]*f[71][l])+0.6846531968814573*alpha_vdim[31][l]*f[70][l]+0.6123724356957944*f[21][l]*alpha_vdim[69][l]+0.6846531968814573*f[33][l]*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[25][l]*f[57][l]+0.6846531968814573*alpha_vdim[43][l]*f[56][l]+0.6123724356957944*alpha_vdim[38][l]*f[55][l]+0.6846531968814573*(alpha_vdim[4][l]*f[55][l]+alpha_vdim[22][l]*f[54][l])+(0.6123724356957944*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[52][l]+0.6123724356957944*(alpha_vdim[13][l]*f[49][l]+f[8][l]*alpha_vdim[44][l]+alpha_vdim[13][l]*f[34][l])+0.6846531968814573*alpha_vdim[10][l]*f[30][l]+0.6123724356957944*alpha_vdim[17][l]*f[27][l]+0.6846531968814573*(alpha_vdim[0][l]*f[27][l]+alpha_vdim[6][l]*f[26][l]+f[7][l]*alpha_vdim[25][l]+alpha_vdim[12][l]*f[21][l]+alpha_vdim[2][l]*f[14][l]+f[3][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*f[8][l]);
+    out[74][l] += 0.273861278752583*f[32][l]*alpha_vdim[284][l]+(0.273861278752583*f[41][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[283][l]+0.273861278752583*f[88][l]*alpha_vdim[281][l]+(0.1956151991089878*f[87][l]+0.3061862178478971*f[24][l])*alpha_vdim[280][l]+(0.273861278752583*f[19][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[261][l]+(0.1956151991089878*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[257][l]+0.273861278752583*f[60][l]*alpha_vdim[256][l]+(0.1956151991089878*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[255][l]+0.2449489742783178*f[65][l]*alpha_vdim[246][l]+0.273861278752583*(f[6][l]*alpha_vdim[246][l]+f[51][l]*alpha_vdim[245][l])+0.1956151991089878*f[37][l]*alpha_vdim[240][l]+0.3061862178478971*(f[4][l]*alpha_vdim[240][l]+f[31][l]*alpha_vdim[234][l])+(0.2449489742783178*f[40][l]+0.273861278752583*f[1][l])*alpha_vdim[233][l]+0.3061862178478971*f[87][l]*alpha_vdim[232][l]+0.273861278752583*(f[23][l]*alpha_vdim[231][l]+f[22][l]*alpha_vdim[230][l])+0.3061862178478971*(f[16][l]*alpha_vdim[228][l]+f[61][l]*alpha_vdim[227][l]+f[59][l]*alpha_vdim[226][l])+0.273861278752583*f[9][l]*alpha_vdim[225][l]+0.3061862178478971*f[37][l]*alpha_vdim[224][l]+0.273861278752583*f[32][l]*alpha_vdim[181][l]+(0.273861278752583*f[48][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[180][l]+0.273861278752583*f[92][l]*alpha_vdim[169][l]+(0.1956151991089878*f[91][l]+0.3061862178478971*f[27][l])*alpha_vdim[168][l]+(0.273861278752583*f[20][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[155][l]+(0.1956151991089878*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[145][l]+0.273861278752583*f[69][l]*alpha_vdim[144][l]+(0.1956151991089878*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[143][l]+0.2449489742783178*f[80][l]*alpha_vdim[137][l]+0.273861278752583*(f[6][l]*alpha_vdim[137][l]+f[52][l]*alpha_vdim[133][l])+0.1956151991089878*f[43][l]*alpha_vdim[128][l]+0.3061862178478971*(f[5][l]*alpha_vdim[128][l]+f[31][l]*alpha_vdim[125][l])+(0.2449489742783178*f[47][l]+0.273861278752583*f[1][l])*alpha_vdim[124][l]+0.3061862178478971*f[91][l]*alpha_vdim[120][l]+0.273861278752583*(f[26][l]*alpha_vdim[119][l]+f[25][l]*alpha_vdim[118][l])+0.3061862178478971*(f[16][l]*alpha_vdim[117][l]+f[70][l]*alpha_vdim[115][l]+f[68][l]*alpha_vdim[114][l])+0.273861278752583*f[12][l]*alpha_vdim[113][l]+0.3061862178478971*f[43][l]*alpha_vdim[112][l]+0.6846531968814573*(alpha_cdim[3][l]*f[54][l]+alpha_cdim[0][l]*f[28][l]);
+    out[75][l] += (0.273861278752583*f[40][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[284][l]+0.273861278752583*f[31][l]*alpha_vdim[283][l]+(0.1956151991089878*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[281][l]+0.273861278752583*f[87][l]*alpha_vdim[280][l]+(0.273861278752583*f[19][l]+0.1956151991089878*f[17][l]+0.3061862178478971*f[0][l])*alpha_vdim[262][l]+(0.1956151991089878*f[62][l]+0.3061862178478971*f[11][l])*alpha_vdim[258][l]+(0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[256][l]+0.273861278752583*f[59][l]*alpha_vdim[255][l]+0.2449489742783178*f[65][l]*alpha_vdim[246][l]+0.273861278752583*(f[6][l]*alpha_vdim[246][l]+f[51][l]*alpha_vdim[245][l])+(0.1956151991089878*f[38][l]+0.3061862178478971*f[4][l])*alpha_vdim[241][l]+(0.2449489742783178*f[41][l]+0.273861278752583*f[2][l])*alpha_vdim[234][l]+0.3061862178478971*f[32][l]*alpha_vdim[233][l]+0.273861278752583*f[24][l]*alpha_vdim[232][l]+0.3061862178478971*f[88][l]*alpha_vdim[231][l]+0.273861278752583*f[22][l]*alpha_vdim[230][l]+0.3061862178478971*(f[17][l]*alpha_vdim[228][l]+f[62][l]*alpha_vdim[227][l])+0.273861278752583*f[10][l]*alpha_vdim[226][l]+0.3061862178478971*(f[60][l]*alpha_vdim[225][l]+f[38][l]*alpha_vdim[224][l])+(0.273861278752583*f[47][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[181][l]+0.273861278752583*f[31][l]*alpha_vdim[180][l]+(0.1956151991089878*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[169][l]+0.273861278752583*f[91][l]*alpha_vdim[168][l]+(0.273861278752583*f[20][l]+0.1956151991089878*f[17][l]+0.3061862178478971*f[0][l])*alpha_vdim[156][l]+(0.1956151991089878*f[71][l]+0.3061862178478971*f[14][l])*alpha_vdim[146][l]+(0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[144][l]+0.273861278752583*f[68][l]*alpha_vdim[143][l]+0.2449489742783178*f[80][l]*alpha_vdim[137][l]+0.273861278752583*(f[6][l]*alpha_vdim[137][l]+f[52][l]*alpha_vdim[133][l])+(0.1956151991089878*f[44][l]+0.3061862178478971*f[5][l])*alpha_vdim[129][l]+(0.2449489742783178*f[48][l]+0.273861278752583*f[2][l])*alpha_vdim[125][l]+0.3061862178478971*f[32][l]*alpha_vdim[124][l]+0.273861278752583*f[27][l]*alpha_vdim[120][l]+0.3061862178478971*f[92][l]*alpha_vdim[119][l]+0.273861278752583*f[25][l]*alpha_vdim[118][l]+0.3061862178478971*f[17][l]*alpha_vdim[117][l]+(0.6123724356957944*f[78][l]+0.6846531968814573*f[13][l])*alpha_cdim[116][l]+0.3061862178478971*f[71][l]*alpha_vdim[115][l]+0.273861278752583*f[13][l]*alpha_vdim[114][l]+0.3061862178478971*(f[69][l]*alpha_vdim[113][l]+f[44][l]*alpha_vdim[112][l])+0.6846531968814573*f[29][l]*alpha_cdim[112][l];
+    out[76][l] += 0.273861278752583*(f[88][l]*alpha_vdim[281][l]+f[87][l]*alpha_vdim[280][l]+f[62][l]*alpha_vdim[258][l]+f[61][l]*alpha_vdim[257][l])+0.3061862178478971*f[58][l]*alpha_vdim[246][l]+0.273861278752583*f[51][l]*alpha_vdim[245][l]+0.3061862178478971*(f[36][l]*alpha_vdim[234][l]+f[35][l]*alpha_vdim[233][l])+0.273861278752583*(f[24][l]*alpha_vdim[232][l]+f[23][l]*alpha_vdim[231][l])+0.3061862178478971*(f[89][l]*alpha_vdim[230][l]+f[18][l]*alpha_vdim[228][l])+0.273861278752583*f[11][l]*alpha_vdim[227][l]+0.3061862178478971*(f[64][l]*alpha_vdim[226][l]+f[63][l]*alpha_vdim[225][l]+f[39][l]*alpha_vdim[224][l])+0.273861278752583*(f[92][l]*alpha_vdim[169][l]+f[91][l]*alpha_vdim[168][l]+f[71][l]*alpha_vdim[146][l]+f[70][l]*alpha_vdim[145][l])+0.3061862178478971*f[58][l]*alpha_vdim[137][l]+0.273861278752583*f[52][l]*alpha_vdim[133][l]+0.3061862178478971*(f[36][l]*alpha_vdim[125][l]+f[35][l]*alpha_vdim[124][l])+0.273861278752583*(f[27][l]*alpha_vdim[120][l]+f[26][l]*alpha_vdim[119][l])+0.3061862178478971*(f[93][l]*alpha_vdim[118][l]+f[18][l]*alpha_vdim[117][l])+0.273861278752583*f[14][l]*alpha_vdim[115][l]+0.3061862178478971*(f[73][l]*alpha_vdim[114][l]+f[72][l]*alpha_vdim[113][l]+f[45][l]*alpha_vdim[112][l])+0.6123724356957944*(alpha_vdim[25][l]*f[111][l]+alpha_vdim[22][l]*f[110][l])+0.6846531968814573*(alpha_vdim[32][l]*f[108][l]+alpha_vdim[31][l]*f[107][l])+0.6123724356957944*(alpha_vdim[13][l]*f[106][l]+alpha_vdim[12][l]*f[105][l]+alpha_vdim[10][l]*f[102][l]+alpha_vdim[9][l]*f[101][l])+0.6846531968814573*(alpha_vdim[17][l]*f[97][l]+alpha_vdim[16][l]*f[96][l]+alpha_vdim[60][l]*f[92][l]+alpha_vdim[59][l]*f[91][l]+alpha_vdim[69][l]*f[88][l]+alpha_vdim[68][l]*f[87][l]+alpha_vdim[6][l]*f[86][l])+0.6123724356957944*(alpha_vdim[5][l]*f[85][l]+alpha_vdim[4][l]*f[79][l])+0.6846531968814573*(alpha_vdim[38][l]*f[71][l]+alpha_vdim[37][l]*f[70][l]+alpha_vdim[44][l]*f[62][l]+alpha_vdim[43][l]*f[61][l]+alpha_vdim[2][l]*f[55][l]+alpha_vdim[1][l]*f[54][l]+alpha_vdim[22][l]*f[52][l]+alpha_vdim[25][l]*f[51][l]+alpha_vdim[0][l]*f[30][l]+alpha_vdim[10][l]*f[27][l]+alpha_vdim[9][l]*f[26][l]+alpha_vdim[13][l]*f[24][l]+alpha_vdim[12][l]*f[23][l]+alpha_vdim[4][l]*f[14][l]+alpha_vdim[5][l]*f[11][l]);
+    out[77][l] += 0.273861278752583*f[38][l]*alpha_vdim[284][l]+0.2449489742783178*f[22][l]*alpha_vdim[283][l]+0.273861278752583*(f[90][l]*alpha_vdim[280][l]+f[60][l]*alpha_vdim[262][l])+0.2449489742783178*f[9][l]*alpha_vdim[261][l]+0.273861278752583*(f[66][l]*alpha_vdim[257][l]+f[65][l]*alpha_vdim[255][l])+(0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[246][l]+0.3061862178478971*f[67][l]*alpha_vdim[245][l]+0.273861278752583*(f[40][l]*alpha_vdim[240][l]+f[22][l]*alpha_vdim[234][l])+(0.2449489742783178*f[37][l]+0.273861278752583*f[4][l])*alpha_vdim[233][l]+0.3061862178478971*(f[90][l]*alpha_vdim[232][l]+f[42][l]*alpha_vdim[231][l]+f[41][l]*alpha_vdim[230][l])+0.273861278752583*f[9][l]*alpha_vdim[228][l]+0.3061862178478971*(f[66][l]*alpha_vdim[227][l]+f[65][l]*alpha_vdim[226][l]+f[19][l]*alpha_vdim[225][l]+f[40][l]*alpha_vdim[224][l])+0.6846531968814573*f[38][l]*alpha_vdim[181][l]+(0.5477225575051661*f[104][l]+0.6123724356957944*f[22][l])*alpha_vdim[180][l]+0.6846531968814573*f[97][l]*alpha_vdim[169][l]+0.6123724356957944*f[86][l]*alpha_vdim[168][l]+0.6846531968814573*f[60][l]*alpha_vdim[156][l]+(0.5477225575051661*f[83][l]+0.6123724356957944*f[9][l])*alpha_vdim[155][l]+0.6846531968814573*f[108][l]*alpha_vdim[146][l]+0.6123724356957944*f[54][l]*alpha_vdim[145][l]+0.6846531968814573*f[75][l]*alpha_vdim[144][l]+0.6123724356957944*f[53][l]*alpha_vdim[143][l]+(0.6123724356957944*(f[84][l]+f[59][l])+0.6846531968814573*f[10][l])*alpha_vdim[137][l]+0.6123724356957944*f[107][l]*alpha_vdim[133][l]+0.6846531968814573*(f[55][l]*alpha_vdim[133][l]+f[95][l]*alpha_vdim[129][l])+0.6123724356957944*f[28][l]*alpha_vdim[128][l]+(0.6123724356957944*f[104][l]+0.6846531968814573*f[22][l])*alpha_vdim[125][l]+0.6123724356957944*(f[50][l]+f[37][l])*alpha_vdim[124][l]+0.6846531968814573*(f[4][l]*alpha_vdim[124][l]+f[86][l]*alpha_vdim[120][l])+(0.6123724356957944*f[96][l]+0.6846531968814573*f[30][l])*alpha_vdim[119][l]+(0.6123724356957944*f[94][l]+0.6846531968814573*f[29][l])*alpha_vdim[118][l]+0.6123724356957944*f[83][l]*alpha_vdim[117][l]+0.6846531968814573*(f[9][l]*alpha_vdim[117][l]+f[54][l]*alpha_vdim[115][l]+f[53][l]*alpha_vdim[114][l])+0.6123724356957944*f[74][l]*alpha_vdim[113][l]+0.6846531968814573*(f[15][l]*alpha_vdim[113][l]+f[28][l]*alpha_vdim[112][l])+0.3061862178478971*(alpha_cdim[3][l]*f[79][l]+alpha_cdim[0][l]*f[46][l]);
+    out[78][l] += 0.2449489742783178*f[22][l]*alpha_vdim[284][l]+0.273861278752583*(f[37][l]*alpha_vdim[283][l]+f[90][l]*alpha_vdim[281][l])+0.2449489742783178*f[10][l]*alpha_vdim[262][l]+0.273861278752583*(f[59][l]*alpha_vdim[261][l]+f[67][l]*alpha_vdim[258][l]+f[65][l]*alpha_vdim[256][l])+(0.2449489742783178*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[246][l]+0.3061862178478971*f[66][l]*alpha_vdim[245][l]+0.273861278752583*f[41][l]*alpha_vdim[241][l]+0.2449489742783178*f[38][l]*alpha_vdim[234][l]+0.273861278752583*(f[4][l]*alpha_vdim[234][l]+f[22][l]*alpha_vdim[233][l])+0.3061862178478971*(f[42][l]*alpha_vdim[232][l]+f[90][l]*alpha_vdim[231][l]+f[40][l]*alpha_vdim[230][l])+0.273861278752583*f[10][l]*alpha_vdim[228][l]+0.3061862178478971*(f[67][l]*alpha_vdim[227][l]+f[19][l]*alpha_vdim[226][l]+f[65][l]*alpha_vdim[225][l]+f[41][l]*alpha_vdim[224][l])+(0.5477225575051661*f[104][l]+0.6123724356957944*f[22][l])*alpha_vdim[181][l]+0.6846531968814573*f[37][l]*alpha_vdim[180][l]+0.6123724356957944*f[86][l]*alpha_vdim[169][l]+0.6846531968814573*f[96][l]*alpha_vdim[168][l]+(0.5477225575051661*f[84][l]+0.6123724356957944*f[10][l])*alpha_vdim[156][l]+0.6846531968814573*f[59][l]*alpha_vdim[155][l]+0.6123724356957944*f[55][l]*alpha_vdim[146][l]+0.6846531968814573*f[107][l]*alpha_vdim[145][l]+0.6123724356957944*f[53][l]*alpha_vdim[144][l]+0.6846531968814573*f[74][l]*alpha_vdim[143][l]+(0.6123724356957944*(f[83][l]+f[60][l])+0.6846531968814573*f[9][l])*alpha_vdim[137][l]+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[133][l]+0.6123724356957944*f[29][l]*alpha_vdim[129][l]+0.6846531968814573*f[94][l]*alpha_vdim[128][l]+(0.6123724356957944*(f[50][l]+f[38][l])+0.6846531968814573*f[4][l])*alpha_vdim[125][l]+(0.6123724356957944*f[104][l]+0.6846531968814573*f[22][l])*alpha_vdim[124][l]+0.6123724356957944*f[97][l]*alpha_vdim[120][l]+0.6846531968814573*(f[30][l]*alpha_vdim[120][l]+f[86][l]*alpha_vdim[119][l])+(0.6123724356957944*f[95][l]+0.6846531968814573*f[28][l])*alpha_vdim[118][l]+(0.6123724356957944*f[84][l]+0.6846531968814573*f[10][l])*alpha_vdim[117][l]+0.273861278752583*f[15][l]*alpha_cdim[116][l]+0.6846531968814573*f[55][l]*alpha_vdim[115][l]+0.6123724356957944*f[75][l]*alpha_vdim[114][l]+0.6846531968814573*(f[15][l]*alpha_vdim[114][l]+f[53][l]*alpha_vdim[113][l]+f[29][l]*alpha_vdim[112][l])+0.3061862178478971*f[46][l]*alpha_cdim[112][l];
+    out[79][l] += 0.273861278752583*(f[88][l]*alpha_vdim[284][l]+f[87][l]*alpha_vdim[283][l]+f[62][l]*alpha_vdim[262][l]+f[61][l]*alpha_vdim[261][l]+f[51][l]*alpha_vdim[246][l])+0.3061862178478971*f[65][l]*alpha_vdim[245][l]+0.273861278752583*(f[24][l]*alpha_vdim[234][l]+f[23][l]*alpha_vdim[233][l])+0.3061862178478971*(f[41][l]*alpha_vdim[232][l]+f[40][l]*alpha_vdim[231][l]+f[90][l]*alpha_vdim[230][l])+0.273861278752583*f[11][l]*alpha_vdim[228][l]+0.3061862178478971*(f[19][l]*alpha_vdim[227][l]+f[67][l]*alpha_vdim[226][l]+f[66][l]*alpha_vdim[225][l]+f[42][l]*alpha_vdim[224][l])+0.6846531968814573*(f[88][l]*alpha_vdim[181][l]+f[87][l]*alpha_vdim[180][l]+f[95][l]*alpha_vdim[169][l]+f[94][l]*alpha_vdim[168][l]+f[62][l]*alpha_vdim[156][l]+f[61][l]*alpha_vdim[155][l]+f[75][l]*alpha_vdim[146][l]+f[74][l]*alpha_vdim[145][l]+f[108][l]*alpha_vdim[144][l]+f[107][l]*alpha_vdim[143][l])+(0.6123724356957944*f[111][l]+0.6846531968814573*f[51][l])*alpha_vdim[137][l]+0.6123724356957944*f[109][l]*alpha_vdim[133][l]+0.6846531968814573*(f[53][l]*alpha_vdim[133][l]+f[97][l]*alpha_vdim[129][l]+f[96][l]*alpha_vdim[128][l])+(0.6123724356957944*f[106][l]+0.6846531968814573*f[24][l])*alpha_vdim[125][l]+(0.6123724356957944*f[105][l]+0.6846531968814573*f[23][l])*alpha_vdim[124][l]+(0.6123724356957944*f[99][l]+0.6846531968814573*f[29][l])*alpha_vdim[120][l]+0.6123724356957944*f[98][l]*alpha_vdim[119][l]+0.6846531968814573*(f[28][l]*alpha_vdim[119][l]+f[86][l]*alpha_vdim[118][l])+(0.6123724356957944*f[85][l]+0.6846531968814573*f[11][l])*alpha_vdim[117][l]+0.6123724356957944*f[76][l]*alpha_vdim[115][l]+0.6846531968814573*(f[15][l]*alpha_vdim[115][l]+f[55][l]*alpha_vdim[114][l]+f[54][l]*alpha_vdim[113][l]+f[30][l]*alpha_vdim[112][l])+0.3061862178478971*alpha_vdim[6][l]*f[100][l]+0.273861278752583*(alpha_vdim[60][l]*f[95][l]+alpha_vdim[59][l]*f[94][l])+0.3061862178478971*(alpha_vdim[2][l]*f[78][l]+alpha_vdim[1][l]*f[77][l])+0.273861278752583*(alpha_vdim[38][l]*f[75][l]+alpha_vdim[37][l]*f[74][l])+0.3061862178478971*alpha_vdim[25][l]*f[65][l]+0.273861278752583*alpha_vdim[22][l]*f[53][l]+0.3061862178478971*(alpha_vdim[0][l]*f[46][l]+alpha_vdim[13][l]*f[41][l]+alpha_vdim[12][l]*f[40][l])+0.273861278752583*(alpha_vdim[10][l]*f[29][l]+alpha_vdim[9][l]*f[28][l])+0.3061862178478971*alpha_vdim[5][l]*f[19][l]+0.273861278752583*alpha_vdim[4][l]*f[15][l];
+    out[80][l] += (0.5477225575051661*f[94][l]+0.6123724356957944*f[29][l])*alpha_vdim[284][l]+(0.5477225575051661*f[95][l]+0.6123724356957944*f[28][l])*alpha_vdim[283][l]+(0.5477225575051661*f[91][l]+0.6123724356957944*f[27][l])*alpha_vdim[281][l]+0.5477225575051661*f[92][l]*alpha_vdim[280][l]+0.6123724356957944*(f[26][l]*alpha_vdim[280][l]+f[53][l]*(alpha_vdim[262][l]+alpha_vdim[261][l])+f[52][l]*(alpha_vdim[258][l]+alpha_vdim[257][l]))+(0.5477225575051661*f[68][l]+0.6123724356957944*f[13][l])*alpha_vdim[256][l]+(0.5477225575051661*f[69][l]+0.6123724356957944*f[12][l])*alpha_vdim[255][l]+(0.6123724356957944*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[246][l]+(0.6123724356957944*(f[71][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[245][l]+0.6123724356957944*f[25][l]*(alpha_vdim[241][l]+alpha_vdim[240][l])+(0.6123724356957944*f[95][l]+0.6846531968814573*f[28][l])*alpha_vdim[234][l]+(0.6123724356957944*f[94][l]+0.6846531968814573*f[29][l])*alpha_vdim[233][l]+(0.6123724356957944*f[92][l]+0.6846531968814573*f[26][l])*alpha_vdim[232][l]+(0.6123724356957944*f[91][l]+0.6846531968814573*f[27][l])*alpha_vdim[231][l]+0.6123724356957944*(f[44][l]+f[43][l])*alpha_vdim[230][l]+0.6846531968814573*(f[5][l]*alpha_vdim[230][l]+f[53][l]*alpha_vdim[228][l]+f[52][l]*alpha_vdim[227][l])+(0.6123724356957944*f[69][l]+0.6846531968814573*f[12][l])*alpha_vdim[226][l]+0.6123724356957944*f[68][l]*alpha_vdim[225][l]+0.6846531968814573*(f[13][l]*alpha_vdim[225][l]+f[25][l]*alpha_vdim[224][l])+0.3061862178478971*(f[83][l]*alpha_cdim[116][l]+f[47][l]*alpha_cdim[112][l]+alpha_cdim[3][l]*f[82][l]+alpha_cdim[0][l]*f[48][l]);
+    out[81][l] += 0.6846531968814573*f[97][l]*alpha_vdim[284][l]+0.6123724356957944*f[86][l]*alpha_vdim[283][l]+0.6846531968814573*f[44][l]*alpha_vdim[281][l]+(0.5477225575051661*f[93][l]+0.6123724356957944*f[25][l])*alpha_vdim[280][l]+0.6846531968814573*f[108][l]*alpha_vdim[262][l]+0.6123724356957944*f[54][l]*alpha_vdim[261][l]+0.6846531968814573*f[69][l]*alpha_vdim[258][l]+(0.5477225575051661*f[72][l]+0.6123724356957944*f[12][l])*alpha_vdim[257][l]+0.6846531968814573*f[71][l]*alpha_vdim[256][l]+0.6123724356957944*f[52][l]*alpha_vdim[255][l]+(0.6123724356957944*f[107][l]+0.6846531968814573*f[55][l])*alpha_vdim[246][l]+0.6123724356957944*(f[73][l]+f[68][l])*alpha_vdim[245][l]+0.6846531968814573*(f[13][l]*alpha_vdim[245][l]+f[92][l]*alpha_vdim[241][l])+0.6123724356957944*f[26][l]*alpha_vdim[240][l]+0.6846531968814573*f[86][l]*alpha_vdim[234][l]+(0.6123724356957944*f[96][l]+0.6846531968814573*f[30][l])*alpha_vdim[233][l]+(0.6123724356957944*f[93][l]+0.6846531968814573*f[25][l])*alpha_vdim[232][l]+(0.6123724356957944*(f[45][l]+f[43][l])+0.6846531968814573*f[5][l])*alpha_vdim[231][l]+0.6123724356957944*f[91][l]*alpha_vdim[230][l]+0.6846531968814573*(f[27][l]*alpha_vdim[230][l]+f[54][l]*alpha_vdim[228][l])+0.6123724356957944*f[72][l]*alpha_vdim[227][l]+0.6846531968814573*(f[12][l]*alpha_vdim[227][l]+f[52][l]*alpha_vdim[226][l])+0.6123724356957944*f[70][l]*alpha_vdim[225][l]+0.6846531968814573*(f[14][l]*alpha_vdim[225][l]+f[26][l]*alpha_vdim[224][l])+0.273861278752583*alpha_vdim[59][l]*f[104][l]+0.3061862178478971*(alpha_vdim[10][l]*f[104][l]+alpha_vdim[22][l]*f[84][l])+(0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[83][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[80][l]+0.273861278752583*(alpha_vdim[44][l]*f[69][l]+f[44][l]*alpha_vdim[69][l])+0.2449489742783178*(alpha_vdim[25][l]*f[68][l]+f[25][l]*alpha_vdim[68][l])+0.3061862178478971*(alpha_vdim[9][l]*f[50][l]+alpha_cdim[0][l]*f[49][l]+alpha_vdim[6][l]*f[48][l])+(0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[47][l]+0.2449489742783178*(alpha_vdim[12][l]*f[43][l]+f[12][l]*alpha_vdim[43][l])+0.273861278752583*(alpha_vdim[13][l]*f[25][l]+f[13][l]*alpha_vdim[25][l])+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l])*f[20][l]+0.273861278752583*(alpha_vdim[5][l]*f[12][l]+f[5][l]*alpha_vdim[12][l]);
+    out[82][l] += 0.6123724356957944*f[86][l]*alpha_vdim[284][l]+0.6846531968814573*f[96][l]*alpha_vdim[283][l]+(0.5477225575051661*f[93][l]+0.6123724356957944*f[25][l])*alpha_vdim[281][l]+0.6846531968814573*f[43][l]*alpha_vdim[280][l]+0.6123724356957944*f[55][l]*alpha_vdim[262][l]+0.6846531968814573*f[107][l]*alpha_vdim[261][l]+(0.5477225575051661*f[73][l]+0.6123724356957944*f[13][l])*alpha_vdim[258][l]+0.6846531968814573*f[68][l]*alpha_vdim[257][l]+0.6123724356957944*f[52][l]*alpha_vdim[256][l]+0.6846531968814573*f[70][l]*alpha_vdim[255][l]+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[246][l]+(0.6123724356957944*(f[72][l]+f[69][l])+0.6846531968814573*f[12][l])*alpha_vdim[245][l]+0.6123724356957944*f[27][l]*alpha_vdim[241][l]+0.6846531968814573*f[91][l]*alpha_vdim[240][l]+0.6123724356957944*f[97][l]*alpha_vdim[234][l]+0.6846531968814573*(f[30][l]*alpha_vdim[234][l]+f[86][l]*alpha_vdim[233][l])+(0.6123724356957944*(f[45][l]+f[44][l])+0.6846531968814573*f[5][l])*alpha_vdim[232][l]+(0.6123724356957944*f[93][l]+0.6846531968814573*f[25][l])*alpha_vdim[231][l]+0.6123724356957944*f[92][l]*alpha_vdim[230][l]+0.6846531968814573*(f[26][l]*alpha_vdim[230][l]+f[55][l]*alpha_vdim[228][l])+(0.6123724356957944*f[73][l]+0.6846531968814573*f[13][l])*alpha_vdim[227][l]+0.6123724356957944*f[71][l]*alpha_vdim[226][l]+0.6846531968814573*(f[14][l]*alpha_vdim[226][l]+f[52][l]*alpha_vdim[225][l]+f[27][l]*alpha_vdim[224][l])+0.3061862178478971*(f[85][l]*alpha_cdim[116][l]+f[49][l]*alpha_cdim[112][l])+(0.273861278752583*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[104][l]+0.273861278752583*alpha_vdim[38][l]*f[84][l]+0.3061862178478971*(alpha_vdim[4][l]*f[84][l]+alpha_vdim[22][l]*f[83][l])+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[80][l]+0.2449489742783178*(alpha_vdim[25][l]*f[69][l]+f[25][l]*alpha_vdim[69][l])+0.273861278752583*(alpha_vdim[43][l]*f[68][l]+f[43][l]*alpha_vdim[68][l])+0.3061862178478971*alpha_vdim[10][l]*f[50][l]+0.273861278752583*alpha_vdim[17][l]*f[48][l]+0.3061862178478971*(alpha_vdim[0][l]*f[48][l]+alpha_vdim[6][l]*f[47][l])+0.2449489742783178*(alpha_vdim[13][l]*f[44][l]+f[13][l]*alpha_vdim[44][l])+0.273861278752583*(alpha_vdim[12][l]*f[25][l]+f[12][l]*alpha_vdim[25][l])+0.3061862178478971*alpha_vdim[2][l]*f[20][l]+0.273861278752583*(alpha_vdim[5][l]*f[13][l]+f[5][l]*alpha_vdim[13][l]);
+    out[83][l] += 0.6846531968814573*f[44][l]*alpha_vdim[284][l]+(0.5477225575051661*f[100][l]+0.6123724356957944*f[25][l])*alpha_vdim[283][l]+0.6846531968814573*f[97][l]*alpha_vdim[281][l]+0.6123724356957944*f[86][l]*alpha_vdim[280][l]+0.6846531968814573*f[69][l]*alpha_vdim[262][l]+(0.5477225575051661*f[77][l]+0.6123724356957944*f[12][l])*alpha_vdim[261][l]+0.6846531968814573*f[108][l]*alpha_vdim[258][l]+0.6123724356957944*f[54][l]*alpha_vdim[257][l]+0.6846531968814573*f[75][l]*alpha_vdim[256][l]+0.6123724356957944*f[53][l]*alpha_vdim[255][l]+(0.6123724356957944*(f[78][l]+f[68][l])+0.6846531968814573*f[13][l])*alpha_vdim[246][l]+0.6123724356957944*f[107][l]*alpha_vdim[245][l]+0.6846531968814573*(f[55][l]*alpha_vdim[245][l]+f[95][l]*alpha_vdim[241][l])+0.6123724356957944*f[28][l]*alpha_vdim[240][l]+(0.6123724356957944*f[100][l]+0.6846531968814573*f[25][l])*alpha_vdim[234][l]+0.6123724356957944*(f[46][l]+f[43][l])*alpha_vdim[233][l]+0.6846531968814573*(f[5][l]*alpha_vdim[233][l]+f[86][l]*alpha_vdim[232][l])+(0.6123724356957944*f[96][l]+0.6846531968814573*f[30][l])*alpha_vdim[231][l]+(0.6123724356957944*f[94][l]+0.6846531968814573*f[29][l])*alpha_vdim[230][l]+0.6123724356957944*f[77][l]*alpha_vdim[228][l]+0.6846531968814573*(f[12][l]*alpha_vdim[228][l]+f[54][l]*alpha_vdim[227][l]+f[53][l]*alpha_vdim[226][l])+0.6123724356957944*f[74][l]*alpha_vdim[225][l]+0.6846531968814573*(f[15][l]*alpha_vdim[225][l]+f[28][l]*alpha_vdim[224][l])+0.273861278752583*f[44][l]*alpha_vdim[181][l]+0.2449489742783178*f[25][l]*alpha_vdim[180][l]+0.273861278752583*(f[103][l]*alpha_vdim[168][l]+f[69][l]*alpha_vdim[156][l])+0.2449489742783178*f[12][l]*alpha_vdim[155][l]+0.273861278752583*(f[81][l]*alpha_vdim[145][l]+f[80][l]*alpha_vdim[143][l])+(0.2449489742783178*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[137][l]+0.3061862178478971*f[82][l]*alpha_vdim[133][l]+0.273861278752583*(f[47][l]*alpha_vdim[128][l]+f[25][l]*alpha_vdim[125][l])+(0.2449489742783178*f[43][l]+0.273861278752583*f[5][l])*alpha_vdim[124][l]+0.3061862178478971*(f[103][l]*alpha_vdim[120][l]+f[49][l]*alpha_vdim[119][l]+f[48][l]*alpha_vdim[118][l])+0.273861278752583*f[12][l]*alpha_vdim[117][l]+0.3061862178478971*(f[81][l]*alpha_vdim[115][l]+f[80][l]*alpha_vdim[114][l]+f[20][l]*alpha_vdim[113][l]+f[47][l]*alpha_vdim[112][l]+alpha_cdim[3][l]*f[85][l]+alpha_cdim[0][l]*f[50][l]);
+    out[84][l] += (0.5477225575051661*f[100][l]+0.6123724356957944*f[25][l])*alpha_vdim[284][l]+0.6846531968814573*f[43][l]*alpha_vdim[283][l]+0.6123724356957944*f[86][l]*alpha_vdim[281][l]+0.6846531968814573*f[96][l]*alpha_vdim[280][l]+(0.5477225575051661*f[78][l]+0.6123724356957944*f[13][l])*alpha_vdim[262][l]+0.6846531968814573*f[68][l]*alpha_vdim[261][l]+0.6123724356957944*f[55][l]*alpha_vdim[258][l]+0.6846531968814573*f[107][l]*alpha_vdim[257][l]+0.6123724356957944*f[53][l]*alpha_vdim[256][l]+0.6846531968814573*f[74][l]*alpha_vdim[255][l]+(0.6123724356957944*(f[77][l]+f[69][l])+0.6846531968814573*f[12][l])*alpha_vdim[246][l]+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[245][l]+0.6123724356957944*f[29][l]*alpha_vdim[241][l]+0.6846531968814573*f[94][l]*alpha_vdim[240][l]+(0.6123724356957944*(f[46][l]+f[44][l])+0.6846531968814573*f[5][l])*alpha_vdim[234][l]+(0.6123724356957944*f[100][l]+0.6846531968814573*f[25][l])*alpha_vdim[233][l]+0.6123724356957944*f[97][l]*alpha_vdim[232][l]+0.6846531968814573*(f[30][l]*alpha_vdim[232][l]+f[86][l]*alpha_vdim[231][l])+(0.6123724356957944*f[95][l]+0.6846531968814573*f[28][l])*alpha_vdim[230][l]+0.6123724356957944*f[78][l]*alpha_vdim[228][l]+0.6846531968814573*(f[13][l]*alpha_vdim[228][l]+f[55][l]*alpha_vdim[227][l])+0.6123724356957944*f[75][l]*alpha_vdim[226][l]+0.6846531968814573*(f[15][l]*alpha_vdim[226][l]+f[53][l]*alpha_vdim[225][l]+f[29][l]*alpha_vdim[224][l])+0.2449489742783178*f[25][l]*alpha_vdim[181][l]+0.273861278752583*(f[43][l]*alpha_vdim[180][l]+f[103][l]*alpha_vdim[169][l])+0.2449489742783178*f[13][l]*alpha_vdim[156][l]+0.273861278752583*(f[68][l]*alpha_vdim[155][l]+f[82][l]*alpha_vdim[146][l]+f[80][l]*alpha_vdim[144][l])+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[137][l]+0.3061862178478971*f[81][l]*alpha_vdim[133][l]+0.273861278752583*f[48][l]*alpha_vdim[129][l]+0.2449489742783178*f[44][l]*alpha_vdim[125][l]+0.273861278752583*(f[5][l]*alpha_vdim[125][l]+f[25][l]*alpha_vdim[124][l])+0.3061862178478971*(f[49][l]*alpha_vdim[120][l]+f[103][l]*alpha_vdim[119][l]+f[47][l]*alpha_vdim[118][l])+0.273861278752583*f[13][l]*alpha_vdim[117][l]+0.3061862178478971*(f[20][l]*alpha_cdim[116][l]+f[82][l]*alpha_vdim[115][l]+f[20][l]*alpha_vdim[114][l]+f[80][l]*alpha_vdim[113][l]+f[48][l]*alpha_vdim[112][l]+f[50][l]*alpha_cdim[112][l]);
+    out[85][l] += 0.6846531968814573*(f[92][l]*alpha_vdim[284][l]+f[91][l]*alpha_vdim[283][l]+f[95][l]*alpha_vdim[281][l]+f[94][l]*alpha_vdim[280][l]+f[71][l]*alpha_vdim[262][l]+f[70][l]*alpha_vdim[261][l]+f[75][l]*alpha_vdim[258][l]+f[74][l]*alpha_vdim[257][l]+f[108][l]*alpha_vdim[256][l]+f[107][l]*alpha_vdim[255][l])+(0.6123724356957944*f[110][l]+0.6846531968814573*f[52][l])*alpha_vdim[246][l]+0.6123724356957944*f[109][l]*alpha_vdim[245][l]+0.6846531968814573*(f[53][l]*alpha_vdim[245][l]+f[97][l]*alpha_vdim[241][l]+f[96][l]*alpha_vdim[240][l])+(0.6123724356957944*f[102][l]+0.6846531968814573*f[27][l])*alpha_vdim[234][l]+(0.6123724356957944*f[101][l]+0.6846531968814573*f[26][l])*alpha_vdim[233][l]+(0.6123724356957944*f[99][l]+0.6846531968814573*f[29][l])*alpha_vdim[232][l]+0.6123724356957944*f[98][l]*alpha_vdim[231][l]+0.6846531968814573*(f[28][l]*alpha_vdim[231][l]+f[86][l]*alpha_vdim[230][l])+(0.6123724356957944*f[79][l]+0.6846531968814573*f[14][l])*alpha_vdim[228][l]+0.6123724356957944*f[76][l]*alpha_vdim[227][l]+0.6846531968814573*(f[15][l]*alpha_vdim[227][l]+f[55][l]*alpha_vdim[226][l]+f[54][l]*alpha_vdim[225][l]+f[30][l]*alpha_vdim[224][l])+0.273861278752583*(f[92][l]*alpha_vdim[181][l]+f[91][l]*alpha_vdim[180][l]+f[71][l]*alpha_vdim[156][l]+f[70][l]*alpha_vdim[155][l]+f[52][l]*alpha_vdim[137][l])+0.3061862178478971*f[80][l]*alpha_vdim[133][l]+0.273861278752583*(f[27][l]*alpha_vdim[125][l]+f[26][l]*alpha_vdim[124][l])+0.3061862178478971*(f[48][l]*alpha_vdim[120][l]+f[47][l]*alpha_vdim[119][l]+f[103][l]*alpha_vdim[118][l])+0.273861278752583*f[14][l]*alpha_vdim[117][l]+0.3061862178478971*(f[20][l]*alpha_vdim[115][l]+f[82][l]*alpha_vdim[114][l]+f[81][l]*alpha_vdim[113][l]+f[49][l]*alpha_vdim[112][l]+alpha_vdim[6][l]*f[104][l])+0.273861278752583*(alpha_vdim[69][l]*f[95][l]+alpha_vdim[68][l]*f[94][l])+0.3061862178478971*(alpha_vdim[2][l]*f[84][l]+alpha_vdim[1][l]*f[83][l]+alpha_vdim[22][l]*f[80][l])+0.273861278752583*(alpha_vdim[44][l]*f[75][l]+alpha_vdim[43][l]*f[74][l]+alpha_vdim[25][l]*f[53][l])+0.3061862178478971*(alpha_vdim[0][l]*f[50][l]+alpha_vdim[10][l]*f[48][l]+alpha_vdim[9][l]*f[47][l])+0.273861278752583*(alpha_vdim[13][l]*f[29][l]+alpha_vdim[12][l]*f[28][l])+0.3061862178478971*alpha_vdim[4][l]*f[20][l]+0.273861278752583*alpha_vdim[5][l]*f[15][l];
+    out[86][l] += (0.2449489742783178*(f[67][l]+f[56][l])+0.273861278752583*f[8][l])*alpha_vdim[284][l]+(0.2449489742783178*(f[66][l]+f[57][l])+0.273861278752583*f[7][l])*alpha_vdim[283][l]+(0.2449489742783178*(f[64][l]+f[59][l])+0.273861278752583*f[10][l])*alpha_vdim[281][l]+(0.2449489742783178*(f[63][l]+f[60][l])+0.273861278752583*f[9][l])*alpha_vdim[280][l]+(0.2449489742783178*f[90][l]+0.273861278752583*f[21][l])*alpha_vdim[262][l]+(0.2449489742783178*f[90][l]+0.273861278752583*f[21][l])*alpha_vdim[261][l]+(0.2449489742783178*f[89][l]+0.273861278752583*f[22][l])*alpha_vdim[258][l]+(0.2449489742783178*f[89][l]+0.273861278752583*f[22][l])*alpha_vdim[257][l]+(0.2449489742783178*f[87][l]+0.273861278752583*f[24][l])*alpha_vdim[256][l]+(0.2449489742783178*f[88][l]+0.273861278752583*f[23][l])*alpha_vdim[255][l]+(0.273861278752583*(f[42][l]+f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[246][l]+(0.273861278752583*(f[39][l]+f[38][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[245][l]+0.273861278752583*f[51][l]*(alpha_vdim[241][l]+alpha_vdim[240][l])+(0.273861278752583*(f[66][l]+f[57][l])+0.3061862178478971*f[7][l])*alpha_vdim[234][l]+(0.273861278752583*(f[67][l]+f[56][l])+0.3061862178478971*f[8][l])*alpha_vdim[233][l]+(0.273861278752583*(f[63][l]+f[60][l])+0.3061862178478971*f[9][l])*alpha_vdim[232][l]+(0.273861278752583*(f[64][l]+f[59][l])+0.3061862178478971*f[10][l])*alpha_vdim[231][l]+(0.273861278752583*(f[62][l]+f[61][l])+0.3061862178478971*f[11][l])*alpha_vdim[230][l]+(0.273861278752583*f[90][l]+0.3061862178478971*f[21][l])*alpha_vdim[228][l]+(0.273861278752583*f[89][l]+0.3061862178478971*f[22][l])*alpha_vdim[227][l]+(0.273861278752583*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[226][l]+0.273861278752583*f[87][l]*alpha_vdim[225][l]+0.3061862178478971*(f[24][l]*alpha_vdim[225][l]+f[51][l]*alpha_vdim[224][l])+(0.2449489742783178*(f[82][l]+f[56][l])+0.273861278752583*f[8][l])*alpha_vdim[181][l]+(0.2449489742783178*(f[81][l]+f[57][l])+0.273861278752583*f[7][l])*alpha_vdim[180][l]+(0.2449489742783178*(f[73][l]+f[68][l])+0.273861278752583*f[13][l])*alpha_vdim[169][l]+(0.2449489742783178*(f[72][l]+f[69][l])+0.273861278752583*f[12][l])*alpha_vdim[168][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[21][l])*alpha_vdim[156][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[21][l])*alpha_vdim[155][l]+(0.2449489742783178*f[93][l]+0.273861278752583*f[25][l])*alpha_vdim[146][l]+(0.2449489742783178*f[93][l]+0.273861278752583*f[25][l])*alpha_vdim[145][l]+(0.2449489742783178*f[91][l]+0.273861278752583*f[27][l])*alpha_vdim[144][l]+(0.2449489742783178*f[92][l]+0.273861278752583*f[26][l])*alpha_vdim[143][l]+(0.273861278752583*(f[49][l]+f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[137][l]+(0.273861278752583*(f[45][l]+f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[133][l]+0.273861278752583*f[52][l]*(alpha_vdim[129][l]+alpha_vdim[128][l])+(0.273861278752583*(f[81][l]+f[57][l])+0.3061862178478971*f[7][l])*alpha_vdim[125][l]+(0.273861278752583*(f[82][l]+f[56][l])+0.3061862178478971*f[8][l])*alpha_vdim[124][l]+(0.273861278752583*(f[72][l]+f[69][l])+0.3061862178478971*f[12][l])*alpha_vdim[120][l]+(0.273861278752583*(f[73][l]+f[68][l])+0.3061862178478971*f[13][l])*alpha_vdim[119][l]+(0.273861278752583*(f[71][l]+f[70][l])+0.3061862178478971*f[14][l])*alpha_vdim[118][l]+(0.273861278752583*f[103][l]+0.3061862178478971*f[21][l])*alpha_vdim[117][l]+(0.273861278752583*f[101][l]+0.3061862178478971*f[26][l])*alpha_cdim[116][l]+(0.273861278752583*f[93][l]+0.3061862178478971*f[25][l])*alpha_vdim[115][l]+(0.273861278752583*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[114][l]+0.273861278752583*f[91][l]*alpha_vdim[113][l]+0.3061862178478971*(f[27][l]*alpha_vdim[113][l]+f[52][l]*alpha_vdim[112][l]+f[54][l]*alpha_cdim[112][l])+(0.2449489742783178*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.273861278752583*alpha_vdim[5][l])*f[104][l]+0.2449489742783178*(alpha_vdim[38][l]+alpha_vdim[37][l])*f[100][l]+0.273861278752583*(alpha_vdim[4][l]*f[100][l]+alpha_cdim[3][l]*f[99][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[95][l]+(0.2449489742783178*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[94][l]+(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[84][l]+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[83][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[78][l]+0.2449489742783178*alpha_vdim[59][l]*f[77][l]+0.273861278752583*(alpha_vdim[10][l]*f[77][l]+alpha_vdim[6][l]*(f[75][l]+f[74][l]))+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[69][l]+(0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[69][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[68][l]+0.2449489742783178*f[60][l]*alpha_vdim[68][l]+0.273861278752583*(f[9][l]*alpha_vdim[68][l]+alpha_vdim[13][l]*f[60][l]+f[13][l]*alpha_vdim[60][l]+alpha_vdim[12][l]*f[59][l]+f[12][l]*alpha_vdim[59][l])+0.3061862178478971*alpha_cdim[0][l]*f[55][l]+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[53][l]+0.273861278752583*(alpha_vdim[25][l]*f[50][l]+alpha_vdim[22][l]*(f[46][l]+f[44][l])+f[22][l]*alpha_vdim[44][l]+alpha_vdim[22][l]*f[43][l]+f[22][l]*alpha_vdim[43][l]+alpha_vdim[25][l]*f[38][l]+f[25][l]*alpha_vdim[38][l]+alpha_vdim[25][l]*f[37][l]+f[25][l]*alpha_vdim[37][l]+f[29][l]*alpha_vdim[32][l]+f[28][l]*alpha_vdim[31][l])+0.3061862178478971*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[29][l]+alpha_vdim[2][l]*f[28][l]+alpha_vdim[4][l]*f[25][l]+f[4][l]*alpha_vdim[25][l]+alpha_vdim[5][l]*f[22][l]+f[5][l]*alpha_vdim[22][l]+alpha_vdim[6][l]*f[15][l]+alpha_vdim[9][l]*f[13][l]+f[9][l]*alpha_vdim[13][l]+alpha_vdim[10][l]*f[12][l]+f[10][l]*alpha_vdim[12][l]);
+    out[87][l] += 0.2449489742783178*f[52][l]*alpha_vdim[181][l]+(0.273861278752583*f[71][l]+0.1956151991089878*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[180][l]+(0.2190890230020664*f[58][l]+0.2449489742783178*f[6][l])*alpha_vdim[169][l]+(0.273861278752583*(f[18][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[168][l]+0.273861278752583*f[91][l]*alpha_vdim[156][l]+(0.1956151991089878*f[91][l]+0.3061862178478971*f[27][l])*alpha_vdim[155][l]+0.273861278752583*f[31][l]*alpha_vdim[146][l]+(0.273861278752583*f[36][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[145][l]+0.2449489742783178*f[21][l]*alpha_vdim[144][l]+(0.273861278752583*f[34][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[143][l]+(0.2449489742783178*f[92][l]+0.273861278752583*f[26][l])*alpha_vdim[137][l]+(0.2449489742783178*(f[35][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[133][l]+f[56][l]*(0.273861278752583*alpha_vdim[129][l]+0.1956151991089878*alpha_vdim[128][l])+0.3061862178478971*(f[8][l]*alpha_vdim[128][l]+f[70][l]*alpha_vdim[125][l])+0.273861278752583*f[52][l]*alpha_vdim[124][l]+0.3061862178478971*f[16][l]*alpha_vdim[120][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[119][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[118][l]+0.3061862178478971*(f[91][l]*alpha_vdim[117][l]+f[33][l]*alpha_cdim[116][l]+f[31][l]*alpha_vdim[115][l]+f[33][l]*alpha_vdim[114][l])+0.273861278752583*f[21][l]*alpha_vdim[113][l]+0.3061862178478971*(f[56][l]*alpha_vdim[112][l]+f[61][l]*alpha_cdim[112][l])+0.2449489742783178*alpha_vdim[25][l]*f[95][l]+(0.273861278752583*alpha_vdim[44][l]+0.1956151991089878*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[94][l]+0.6123724356957944*alpha_cdim[3][l]*f[89][l]+0.273861278752583*alpha_vdim[68][l]*f[75][l]+(0.1956151991089878*alpha_vdim[68][l]+0.3061862178478971*alpha_vdim[13][l])*f[74][l]+0.2449489742783178*f[53][l]*alpha_vdim[69][l]+0.3061862178478971*f[15][l]*alpha_vdim[68][l]+0.2190890230020664*alpha_vdim[60][l]*f[65][l]+0.2449489742783178*(alpha_vdim[9][l]*f[65][l]+alpha_vdim[6][l]*f[60][l]+f[6][l]*alpha_vdim[60][l])+(0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[59][l]+(0.273861278752583*(f[19][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[12][l]*f[53][l]+0.6846531968814573*alpha_cdim[0][l]*f[51][l]+0.3061862178478971*f[29][l]*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[37][l]*f[41][l]+0.2449489742783178*alpha_vdim[22][l]*f[40][l]+0.273861278752583*(alpha_vdim[31][l]*f[38][l]+f[31][l]*alpha_vdim[38][l])+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[37][l]+(0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[37][l]+0.2449489742783178*(alpha_vdim[22][l]*f[32][l]+f[22][l]*alpha_vdim[32][l])+0.3061862178478971*(alpha_vdim[4][l]*f[31][l]+f[4][l]*alpha_vdim[31][l])+0.273861278752583*alpha_vdim[25][l]*f[28][l]+0.6846531968814573*alpha_cdim[3][l]*f[22][l]+0.273861278752583*(alpha_vdim[1][l]*f[22][l]+f[1][l]*alpha_vdim[22][l])+0.3061862178478971*(alpha_vdim[10][l]*f[16][l]+f[10][l]*alpha_vdim[16][l])+0.273861278752583*(alpha_vdim[6][l]*f[9][l]+f[6][l]*alpha_vdim[9][l]);
+    out[88][l] += (0.1956151991089878*f[71][l]+0.273861278752583*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[181][l]+0.2449489742783178*f[52][l]*alpha_vdim[180][l]+(0.273861278752583*f[18][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[169][l]+(0.2190890230020664*f[58][l]+0.2449489742783178*f[6][l])*alpha_vdim[168][l]+(0.1956151991089878*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[156][l]+0.273861278752583*f[92][l]*alpha_vdim[155][l]+(0.273861278752583*f[35][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[146][l]+0.273861278752583*f[32][l]*alpha_vdim[145][l]+(0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[144][l]+0.2449489742783178*f[21][l]*alpha_vdim[143][l]+(0.2449489742783178*f[91][l]+0.273861278752583*f[27][l])*alpha_vdim[137][l]+(0.2449489742783178*(f[36][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[133][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[129][l]+0.273861278752583*(f[57][l]*alpha_vdim[128][l]+f[52][l]*alpha_vdim[125][l])+0.3061862178478971*f[71][l]*alpha_vdim[124][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[120][l]+0.3061862178478971*f[17][l]*alpha_vdim[119][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[118][l]+0.3061862178478971*f[92][l]*alpha_vdim[117][l]+(0.6123724356957944*f[90][l]+0.6846531968814573*f[21][l])*alpha_cdim[116][l]+0.3061862178478971*f[32][l]*alpha_vdim[115][l]+0.273861278752583*f[21][l]*alpha_vdim[114][l]+0.3061862178478971*(f[34][l]*alpha_vdim[113][l]+f[57][l]*alpha_vdim[112][l])+0.6846531968814573*f[51][l]*alpha_cdim[112][l]+(0.1956151991089878*alpha_vdim[44][l]+0.273861278752583*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[95][l]+0.2449489742783178*alpha_vdim[25][l]*f[94][l]+(0.1956151991089878*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[75][l]+alpha_vdim[69][l]*(0.273861278752583*f[74][l]+0.3061862178478971*f[15][l])+0.2449489742783178*f[53][l]*alpha_vdim[68][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[65][l]+0.3061862178478971*alpha_cdim[0][l]*f[62][l]+(0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[60][l]+(0.273861278752583*f[19][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[60][l]+0.2449489742783178*(alpha_vdim[6][l]*f[59][l]+f[6][l]*alpha_vdim[59][l])+0.273861278752583*alpha_vdim[13][l]*f[53][l]+0.3061862178478971*f[28][l]*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[22][l]*f[41][l]+0.273861278752583*alpha_vdim[38][l]*f[40][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[38][l]+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[38][l]+0.273861278752583*(alpha_vdim[32][l]*f[37][l]+f[32][l]*alpha_vdim[37][l])+0.3061862178478971*(alpha_vdim[4][l]*f[32][l]+f[4][l]*alpha_vdim[32][l])+0.2449489742783178*(alpha_vdim[22][l]*f[31][l]+f[22][l]*alpha_vdim[31][l])+0.273861278752583*(alpha_vdim[25][l]*f[29][l]+alpha_vdim[2][l]*f[22][l]+f[2][l]*alpha_vdim[22][l])+0.3061862178478971*(alpha_vdim[9][l]*f[17][l]+f[9][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[6][l]*f[10][l]+f[6][l]*alpha_vdim[10][l]);
+    out[89][l] += 0.273861278752583*(f[73][l]*alpha_vdim[181][l]+f[72][l]*alpha_vdim[180][l])+(0.2190890230020664*f[56][l]+0.2449489742783178*f[8][l])*alpha_vdim[169][l]+(0.2190890230020664*f[57][l]+0.2449489742783178*f[7][l])*alpha_vdim[168][l]+0.273861278752583*f[93][l]*(alpha_vdim[156][l]+alpha_vdim[155][l])+0.2449489742783178*f[21][l]*(alpha_vdim[146][l]+alpha_vdim[145][l])+0.273861278752583*(f[36][l]*alpha_vdim[144][l]+f[35][l]*alpha_vdim[143][l])+0.3061862178478971*f[45][l]*alpha_vdim[137][l]+0.2449489742783178*(f[34][l]+f[33][l])*alpha_vdim[133][l]+0.273861278752583*(f[3][l]*alpha_vdim[133][l]+f[58][l]*(alpha_vdim[129][l]+alpha_vdim[128][l]))+0.3061862178478971*(f[72][l]*alpha_vdim[125][l]+f[73][l]*alpha_vdim[124][l])+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[120][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[119][l]+0.3061862178478971*(f[18][l]*alpha_vdim[118][l]+f[93][l]*alpha_vdim[117][l]+f[35][l]*alpha_cdim[116][l])+0.273861278752583*f[21][l]*alpha_vdim[115][l]+0.3061862178478971*(f[35][l]*alpha_vdim[114][l]+f[36][l]*alpha_vdim[113][l]+f[58][l]*alpha_vdim[112][l]+f[63][l]*alpha_cdim[112][l])+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[108][l]+0.5477225575051661*alpha_vdim[69][l]*f[107][l]+0.6123724356957944*(alpha_vdim[12][l]*f[107][l]+alpha_vdim[25][l]*(f[97][l]+f[96][l]))+(0.5477225575051661*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[90][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[88][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[87][l]+(0.6123724356957944*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6846531968814573*alpha_vdim[5][l])*f[86][l]+0.6123724356957944*(f[55][l]*alpha_vdim[69][l]+f[54][l]*alpha_vdim[68][l])+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[67][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[66][l]+0.3061862178478971*alpha_cdim[0][l]*f[64][l]+0.6123724356957944*alpha_vdim[6][l]*(f[62][l]+f[61][l])+(0.5477225575051661*f[56][l]+0.6123724356957944*f[8][l])*alpha_vdim[60][l]+0.5477225575051661*f[57][l]*alpha_vdim[59][l]+0.6123724356957944*(f[7][l]*alpha_vdim[59][l]+alpha_vdim[10][l]*f[57][l]+alpha_vdim[9][l]*f[56][l])+0.6846531968814573*(alpha_vdim[12][l]*f[55][l]+alpha_vdim[13][l]*f[54][l])+(0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[51][l]+0.6123724356957944*(alpha_vdim[22][l]*f[42][l]+f[21][l]*(alpha_vdim[38][l]+alpha_vdim[37][l])+alpha_vdim[22][l]*(f[34][l]+f[33][l])+f[24][l]*alpha_vdim[32][l]+f[23][l]*alpha_vdim[31][l])+0.6846531968814573*alpha_vdim[25][l]*f[30][l]+0.273861278752583*alpha_cdim[3][l]*f[24][l]+0.6846531968814573*(alpha_vdim[1][l]*f[24][l]+alpha_vdim[2][l]*f[23][l]+f[3][l]*alpha_vdim[22][l]+alpha_vdim[4][l]*f[21][l]+alpha_vdim[6][l]*f[11][l]+f[7][l]*alpha_vdim[10][l]+f[8][l]*alpha_vdim[9][l]);
+    out[90][l] += (0.5477225575051661*f[107][l]+0.6123724356957944*f[55][l])*alpha_vdim[181][l]+(0.5477225575051661*f[108][l]+0.6123724356957944*f[54][l])*alpha_vdim[180][l]+(0.5477225575051661*(f[64][l]+f[59][l])+0.6123724356957944*f[10][l])*alpha_vdim[169][l]+0.5477225575051661*(f[63][l]+f[60][l])*alpha_vdim[168][l]+0.6123724356957944*(f[9][l]*alpha_vdim[168][l]+f[86][l]*(alpha_vdim[156][l]+alpha_vdim[155][l]))+(0.5477225575051661*f[89][l]+0.6123724356957944*f[22][l])*alpha_vdim[146][l]+(0.5477225575051661*f[89][l]+0.6123724356957944*f[22][l])*alpha_vdim[145][l]+(0.5477225575051661*f[87][l]+0.6123724356957944*f[24][l])*alpha_vdim[144][l]+(0.5477225575051661*f[88][l]+0.6123724356957944*f[23][l])*alpha_vdim[143][l]+(0.6123724356957944*(f[97][l]+f[96][l])+0.6846531968814573*f[30][l])*alpha_vdim[137][l]+(0.6123724356957944*(f[39][l]+f[38][l]+f[37][l])+0.6846531968814573*f[4][l])*alpha_vdim[133][l]+0.6123724356957944*f[51][l]*(alpha_vdim[129][l]+alpha_vdim[128][l])+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[125][l]+(0.6123724356957944*f[107][l]+0.6846531968814573*f[55][l])*alpha_vdim[124][l]+(0.6123724356957944*(f[63][l]+f[60][l])+0.6846531968814573*f[9][l])*alpha_vdim[120][l]+(0.6123724356957944*(f[64][l]+f[59][l])+0.6846531968814573*f[10][l])*alpha_vdim[119][l]+0.6123724356957944*(f[62][l]+f[61][l])*alpha_vdim[118][l]+0.6846531968814573*(f[11][l]*alpha_vdim[118][l]+f[86][l]*alpha_vdim[117][l])+0.273861278752583*f[23][l]*alpha_cdim[116][l]+(0.6123724356957944*f[89][l]+0.6846531968814573*f[22][l])*alpha_vdim[115][l]+(0.6123724356957944*f[88][l]+0.6846531968814573*f[23][l])*alpha_vdim[114][l]+0.6123724356957944*f[87][l]*alpha_vdim[113][l]+0.6846531968814573*(f[24][l]*alpha_vdim[113][l]+f[51][l]*alpha_vdim[112][l])+0.3061862178478971*f[66][l]*alpha_cdim[112][l]+(0.273861278752583*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[100][l]+(0.273861278752583*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[78][l]+0.273861278752583*alpha_vdim[68][l]*f[77][l]+0.3061862178478971*(alpha_vdim[13][l]*f[77][l]+alpha_cdim[0][l]*f[67][l])+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[65][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[60][l]+0.2190890230020664*f[59][l]*alpha_vdim[60][l]+0.2449489742783178*(f[10][l]*alpha_vdim[60][l]+alpha_vdim[9][l]*f[59][l]+f[9][l]*alpha_vdim[59][l])+0.3061862178478971*alpha_vdim[25][l]*f[46][l]+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[41][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[40][l]+0.2449489742783178*(alpha_vdim[22][l]*f[38][l]+f[22][l]*alpha_vdim[38][l]+alpha_vdim[22][l]*f[37][l]+f[22][l]*alpha_vdim[37][l])+0.273861278752583*(alpha_vdim[4][l]*f[22][l]+f[4][l]*alpha_vdim[22][l])+0.3061862178478971*alpha_vdim[6][l]*f[19][l]+0.273861278752583*(alpha_vdim[9][l]*f[10][l]+f[9][l]*alpha_vdim[10][l]);
+    out[91][l] += 0.2449489742783178*f[51][l]*alpha_vdim[284][l]+(0.273861278752583*f[62][l]+0.1956151991089878*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[283][l]+(0.2190890230020664*f[58][l]+0.2449489742783178*f[6][l])*alpha_vdim[281][l]+(0.273861278752583*(f[18][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[280][l]+0.273861278752583*f[87][l]*alpha_vdim[262][l]+(0.1956151991089878*f[87][l]+0.3061862178478971*f[24][l])*alpha_vdim[261][l]+0.273861278752583*f[31][l]*alpha_vdim[258][l]+(0.273861278752583*f[36][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[257][l]+0.2449489742783178*f[21][l]*alpha_vdim[256][l]+(0.273861278752583*f[34][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[255][l]+(0.2449489742783178*f[88][l]+0.273861278752583*f[23][l])*alpha_vdim[246][l]+(0.2449489742783178*(f[35][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[245][l]+f[56][l]*(0.273861278752583*alpha_vdim[241][l]+0.1956151991089878*alpha_vdim[240][l])+0.3061862178478971*(f[8][l]*alpha_vdim[240][l]+f[61][l]*alpha_vdim[234][l])+0.273861278752583*f[51][l]*alpha_vdim[233][l]+0.3061862178478971*f[16][l]*alpha_vdim[232][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[231][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[230][l]+0.3061862178478971*(f[87][l]*alpha_vdim[228][l]+f[31][l]*alpha_vdim[227][l]+f[33][l]*alpha_vdim[226][l])+0.273861278752583*f[21][l]*alpha_vdim[225][l]+0.3061862178478971*(f[56][l]*alpha_vdim[224][l]+f[96][l]*alpha_cdim[116][l]+f[70][l]*alpha_cdim[112][l])+0.2449489742783178*alpha_vdim[22][l]*f[95][l]+(0.273861278752583*alpha_vdim[38][l]+0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[94][l]+0.6123724356957944*alpha_cdim[3][l]*f[93][l]+(0.2190890230020664*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[80][l]+0.273861278752583*alpha_vdim[59][l]*f[75][l]+(0.1956151991089878*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[74][l]+0.2449489742783178*(alpha_vdim[6][l]*f[69][l]+f[6][l]*alpha_vdim[69][l])+(0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[68][l]+(0.273861278752583*(f[20][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[68][l]+0.2449489742783178*f[53][l]*alpha_vdim[60][l]+0.3061862178478971*f[15][l]*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[9][l]*f[53][l]+0.6846531968814573*alpha_cdim[0][l]*f[52][l]+0.273861278752583*alpha_vdim[43][l]*f[48][l]+0.2449489742783178*alpha_vdim[25][l]*f[47][l]+0.273861278752583*(alpha_vdim[31][l]*f[44][l]+f[31][l]*alpha_vdim[44][l])+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[43][l]+0.1956151991089878*f[31][l]*alpha_vdim[43][l]+0.3061862178478971*(f[2][l]*alpha_vdim[43][l]+f[29][l]*alpha_vdim[37][l])+0.2449489742783178*(alpha_vdim[25][l]*f[32][l]+f[25][l]*alpha_vdim[32][l])+0.3061862178478971*(alpha_vdim[5][l]*f[31][l]+f[5][l]*alpha_vdim[31][l])+0.273861278752583*alpha_vdim[22][l]*f[28][l]+0.6846531968814573*alpha_cdim[3][l]*f[25][l]+0.273861278752583*(alpha_vdim[1][l]*f[25][l]+f[1][l]*alpha_vdim[25][l])+0.3061862178478971*(alpha_vdim[13][l]*f[16][l]+f[13][l]*alpha_vdim[16][l])+0.273861278752583*(alpha_vdim[6][l]*f[12][l]+f[6][l]*alpha_vdim[12][l]);
+    out[92][l] += (0.1956151991089878*f[62][l]+0.273861278752583*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[284][l]+0.2449489742783178*f[51][l]*alpha_vdim[283][l]+(0.273861278752583*f[18][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[281][l]+(0.2190890230020664*f[58][l]+0.2449489742783178*f[6][l])*alpha_vdim[280][l]+(0.1956151991089878*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[262][l]+0.273861278752583*f[88][l]*alpha_vdim[261][l]+(0.273861278752583*f[35][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[258][l]+0.273861278752583*f[32][l]*alpha_vdim[257][l]+(0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[256][l]+0.2449489742783178*f[21][l]*alpha_vdim[255][l]+(0.2449489742783178*f[87][l]+0.273861278752583*f[24][l])*alpha_vdim[246][l]+(0.2449489742783178*(f[36][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[245][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[241][l]+0.273861278752583*(f[57][l]*alpha_vdim[240][l]+f[51][l]*alpha_vdim[234][l])+0.3061862178478971*f[62][l]*alpha_vdim[233][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[232][l]+0.3061862178478971*f[17][l]*alpha_vdim[231][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[230][l]+0.3061862178478971*(f[88][l]*alpha_vdim[228][l]+f[32][l]*alpha_vdim[227][l])+0.273861278752583*f[21][l]*alpha_vdim[226][l]+0.3061862178478971*(f[34][l]*alpha_vdim[225][l]+f[57][l]*alpha_vdim[224][l])+0.6846531968814573*(f[86][l]*alpha_cdim[116][l]+f[52][l]*alpha_cdim[112][l])+(0.1956151991089878*alpha_vdim[38][l]+0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[95][l]+0.2449489742783178*alpha_vdim[22][l]*f[94][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[80][l]+(0.1956151991089878*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[75][l]+0.273861278752583*alpha_vdim[60][l]*f[74][l]+0.3061862178478971*alpha_cdim[0][l]*f[71][l]+(0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[69][l]+(0.273861278752583*f[20][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[69][l]+0.2449489742783178*(alpha_vdim[6][l]*f[68][l]+f[6][l]*alpha_vdim[68][l])+0.3061862178478971*f[15][l]*alpha_vdim[60][l]+f[53][l]*(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])+0.2449489742783178*alpha_vdim[25][l]*f[48][l]+0.273861278752583*alpha_vdim[44][l]*f[47][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[44][l]+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[44][l]+0.273861278752583*(alpha_vdim[32][l]*f[43][l]+f[32][l]*alpha_vdim[43][l])+0.3061862178478971*(f[28][l]*alpha_vdim[38][l]+alpha_vdim[5][l]*f[32][l]+f[5][l]*alpha_vdim[32][l])+0.2449489742783178*(alpha_vdim[25][l]*f[31][l]+f[25][l]*alpha_vdim[31][l])+0.273861278752583*(alpha_vdim[22][l]*f[29][l]+alpha_vdim[2][l]*f[25][l]+f[2][l]*alpha_vdim[25][l])+0.3061862178478971*(alpha_vdim[12][l]*f[17][l]+f[12][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[6][l]*f[13][l]+f[6][l]*alpha_vdim[13][l]);
+    out[93][l] += 0.273861278752583*(f[64][l]*alpha_vdim[284][l]+f[63][l]*alpha_vdim[283][l])+(0.2190890230020664*f[56][l]+0.2449489742783178*f[8][l])*alpha_vdim[281][l]+(0.2190890230020664*f[57][l]+0.2449489742783178*f[7][l])*alpha_vdim[280][l]+0.273861278752583*f[89][l]*(alpha_vdim[262][l]+alpha_vdim[261][l])+0.2449489742783178*f[21][l]*(alpha_vdim[258][l]+alpha_vdim[257][l])+0.273861278752583*(f[36][l]*alpha_vdim[256][l]+f[35][l]*alpha_vdim[255][l])+0.3061862178478971*f[39][l]*alpha_vdim[246][l]+0.2449489742783178*(f[34][l]+f[33][l])*alpha_vdim[245][l]+0.273861278752583*(f[3][l]*alpha_vdim[245][l]+f[58][l]*(alpha_vdim[241][l]+alpha_vdim[240][l]))+0.3061862178478971*(f[63][l]*alpha_vdim[234][l]+f[64][l]*alpha_vdim[233][l])+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[232][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[231][l]+0.3061862178478971*(f[18][l]*alpha_vdim[230][l]+f[89][l]*alpha_vdim[228][l])+0.273861278752583*f[21][l]*alpha_vdim[227][l]+0.3061862178478971*(f[35][l]*alpha_vdim[226][l]+f[36][l]*alpha_vdim[225][l]+f[58][l]*alpha_vdim[224][l]+f[98][l]*alpha_cdim[116][l]+f[72][l]*alpha_cdim[112][l])+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[108][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[107][l]+0.5477225575051661*(alpha_vdim[44][l]+alpha_vdim[43][l])*f[103][l]+0.6123724356957944*(alpha_vdim[5][l]*f[103][l]+alpha_vdim[22][l]*(f[97][l]+f[96][l]))+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[92][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[91][l]+(0.6123724356957944*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[86][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[82][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[81][l]+0.3061862178478971*alpha_cdim[0][l]*f[73][l]+0.6123724356957944*alpha_vdim[6][l]*(f[71][l]+f[70][l])+(0.5477225575051661*f[56][l]+0.6123724356957944*f[8][l])*alpha_vdim[69][l]+0.5477225575051661*f[57][l]*alpha_vdim[68][l]+0.6123724356957944*(f[7][l]*alpha_vdim[68][l]+f[55][l]*alpha_vdim[60][l]+f[54][l]*alpha_vdim[59][l]+alpha_vdim[13][l]*f[57][l]+alpha_vdim[12][l]*f[56][l])+0.6846531968814573*(alpha_vdim[9][l]*f[55][l]+alpha_vdim[10][l]*f[54][l])+(0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[52][l]+0.6123724356957944*(alpha_vdim[25][l]*f[49][l]+f[21][l]*(alpha_vdim[44][l]+alpha_vdim[43][l])+alpha_vdim[25][l]*(f[34][l]+f[33][l])+f[27][l]*alpha_vdim[32][l]+f[26][l]*alpha_vdim[31][l])+0.6846531968814573*alpha_vdim[22][l]*f[30][l]+0.273861278752583*alpha_cdim[3][l]*f[27][l]+0.6846531968814573*(alpha_vdim[1][l]*f[27][l]+alpha_vdim[2][l]*f[26][l]+f[3][l]*alpha_vdim[25][l]+alpha_vdim[5][l]*f[21][l]+alpha_vdim[6][l]*f[14][l]+f[7][l]*alpha_vdim[13][l]+f[8][l]*alpha_vdim[12][l]);
+    out[94][l] += (0.2190890230020664*f[65][l]+0.2449489742783178*f[6][l])*alpha_vdim[284][l]+(0.273861278752583*(f[19][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[283][l]+0.2449489742783178*f[51][l]*alpha_vdim[281][l]+(0.273861278752583*f[62][l]+0.1956151991089878*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[280][l]+0.273861278752583*f[31][l]*alpha_vdim[262][l]+(0.273861278752583*f[41][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[261][l]+0.273861278752583*f[87][l]*alpha_vdim[258][l]+(0.1956151991089878*f[87][l]+0.3061862178478971*f[24][l])*alpha_vdim[257][l]+0.2449489742783178*f[22][l]*alpha_vdim[256][l]+(0.273861278752583*f[38][l]+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[255][l]+(0.2449489742783178*(f[40][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[246][l]+(0.2449489742783178*f[88][l]+0.273861278752583*f[23][l])*alpha_vdim[245][l]+f[59][l]*(0.273861278752583*alpha_vdim[241][l]+0.1956151991089878*alpha_vdim[240][l])+0.3061862178478971*(f[10][l]*alpha_vdim[240][l]+f[16][l]*alpha_vdim[234][l])+(0.2449489742783178*f[65][l]+0.273861278752583*f[6][l])*alpha_vdim[233][l]+0.3061862178478971*f[61][l]*alpha_vdim[232][l]+0.273861278752583*f[51][l]*alpha_vdim[231][l]+(0.2449489742783178*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[230][l]+0.3061862178478971*(f[31][l]*alpha_vdim[228][l]+f[87][l]*alpha_vdim[227][l]+f[37][l]*alpha_vdim[226][l])+0.273861278752583*f[22][l]*alpha_vdim[225][l]+0.3061862178478971*f[59][l]*alpha_vdim[224][l]+(0.2190890230020664*f[80][l]+0.2449489742783178*f[6][l])*alpha_vdim[181][l]+(0.273861278752583*(f[20][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[180][l]+0.2449489742783178*f[52][l]*alpha_vdim[169][l]+(0.273861278752583*f[71][l]+0.1956151991089878*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[168][l]+0.273861278752583*f[31][l]*alpha_vdim[156][l]+(0.273861278752583*f[48][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[155][l]+0.273861278752583*f[91][l]*alpha_vdim[146][l]+(0.1956151991089878*f[91][l]+0.3061862178478971*f[27][l])*alpha_vdim[145][l]+0.2449489742783178*f[25][l]*alpha_vdim[144][l]+(0.273861278752583*f[44][l]+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[143][l]+(0.2449489742783178*(f[47][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[137][l]+(0.2449489742783178*f[92][l]+0.273861278752583*f[26][l])*alpha_vdim[133][l]+f[68][l]*(0.273861278752583*alpha_vdim[129][l]+0.1956151991089878*alpha_vdim[128][l])+0.3061862178478971*(f[13][l]*alpha_vdim[128][l]+f[16][l]*alpha_vdim[125][l])+(0.2449489742783178*f[80][l]+0.273861278752583*f[6][l])*alpha_vdim[124][l]+0.3061862178478971*f[70][l]*alpha_vdim[120][l]+0.273861278752583*f[52][l]*alpha_vdim[119][l]+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[118][l]+0.3061862178478971*(f[31][l]*alpha_vdim[117][l]+f[43][l]*alpha_cdim[116][l]+f[91][l]*alpha_vdim[115][l]+f[43][l]*alpha_vdim[114][l])+0.273861278752583*f[25][l]*alpha_vdim[113][l]+0.3061862178478971*(f[68][l]*alpha_vdim[112][l]+f[74][l]*alpha_cdim[112][l])+0.6846531968814573*(alpha_cdim[3][l]*f[86][l]+alpha_cdim[0][l]*f[53][l]);
+    out[95][l] += (0.273861278752583*f[19][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[284][l]+(0.2190890230020664*f[65][l]+0.2449489742783178*f[6][l])*alpha_vdim[283][l]+(0.1956151991089878*f[62][l]+0.273861278752583*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[281][l]+0.2449489742783178*f[51][l]*alpha_vdim[280][l]+(0.273861278752583*f[40][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[262][l]+0.273861278752583*f[32][l]*alpha_vdim[261][l]+(0.1956151991089878*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[258][l]+0.273861278752583*f[88][l]*alpha_vdim[257][l]+(0.1956151991089878*f[38][l]+0.273861278752583*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[256][l]+0.2449489742783178*f[22][l]*alpha_vdim[255][l]+(0.2449489742783178*(f[41][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[246][l]+(0.2449489742783178*f[87][l]+0.273861278752583*f[24][l])*alpha_vdim[245][l]+(0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[241][l]+0.273861278752583*f[60][l]*alpha_vdim[240][l]+(0.2449489742783178*f[65][l]+0.273861278752583*f[6][l])*alpha_vdim[234][l]+0.3061862178478971*f[17][l]*alpha_vdim[233][l]+0.273861278752583*f[51][l]*alpha_vdim[232][l]+0.3061862178478971*f[62][l]*alpha_vdim[231][l]+(0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[230][l]+0.3061862178478971*(f[32][l]*alpha_vdim[228][l]+f[88][l]*alpha_vdim[227][l])+0.273861278752583*f[22][l]*alpha_vdim[226][l]+0.3061862178478971*(f[38][l]*alpha_vdim[225][l]+f[60][l]*alpha_vdim[224][l])+(0.273861278752583*f[20][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[181][l]+(0.2190890230020664*f[80][l]+0.2449489742783178*f[6][l])*alpha_vdim[180][l]+(0.1956151991089878*f[71][l]+0.273861278752583*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[169][l]+0.2449489742783178*f[52][l]*alpha_vdim[168][l]+(0.273861278752583*f[47][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[156][l]+0.273861278752583*f[32][l]*alpha_vdim[155][l]+(0.1956151991089878*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[146][l]+0.273861278752583*f[92][l]*alpha_vdim[145][l]+(0.1956151991089878*f[44][l]+0.273861278752583*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[144][l]+0.2449489742783178*f[25][l]*alpha_vdim[143][l]+(0.2449489742783178*(f[48][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[137][l]+(0.2449489742783178*f[91][l]+0.273861278752583*f[27][l])*alpha_vdim[133][l]+(0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[129][l]+0.273861278752583*f[69][l]*alpha_vdim[128][l]+(0.2449489742783178*f[80][l]+0.273861278752583*f[6][l])*alpha_vdim[125][l]+0.3061862178478971*f[17][l]*alpha_vdim[124][l]+0.273861278752583*f[52][l]*alpha_vdim[120][l]+0.3061862178478971*f[71][l]*alpha_vdim[119][l]+(0.2449489742783178*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[118][l]+0.3061862178478971*f[32][l]*alpha_vdim[117][l]+(0.6123724356957944*f[100][l]+0.6846531968814573*f[25][l])*alpha_cdim[116][l]+0.3061862178478971*f[92][l]*alpha_vdim[115][l]+0.273861278752583*f[25][l]*alpha_vdim[114][l]+0.3061862178478971*(f[44][l]*alpha_vdim[113][l]+f[69][l]*alpha_vdim[112][l])+0.6846531968814573*f[53][l]*alpha_cdim[112][l]+0.3061862178478971*(alpha_cdim[3][l]*f[97][l]+alpha_cdim[0][l]*f[75][l]);
+    out[96][l] += 0.273861278752583*f[57][l]*alpha_vdim[284][l]+(0.273861278752583*f[67][l]+0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[283][l]+0.273861278752583*f[60][l]*alpha_vdim[281][l]+(0.273861278752583*f[64][l]+0.1956151991089878*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[280][l]+(0.273861278752583*f[42][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[261][l]+(0.273861278752583*f[39][l]+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[257][l]+0.273861278752583*f[88][l]*alpha_vdim[256][l]+(0.1956151991089878*f[87][l]+0.3061862178478971*f[24][l])*alpha_vdim[255][l]+(0.2449489742783178*f[90][l]+0.273861278752583*f[21][l])*alpha_vdim[246][l]+(0.2449489742783178*f[89][l]+0.273861278752583*f[22][l])*alpha_vdim[245][l]+0.1956151991089878*f[61][l]*alpha_vdim[240][l]+0.3061862178478971*(f[11][l]*alpha_vdim[240][l]+f[56][l]*alpha_vdim[234][l])+(0.2449489742783178*f[66][l]+0.273861278752583*f[7][l])*alpha_vdim[233][l]+0.3061862178478971*f[59][l]*alpha_vdim[232][l]+0.2449489742783178*f[63][l]*alpha_vdim[231][l]+0.273861278752583*(f[9][l]*alpha_vdim[231][l]+f[51][l]*alpha_vdim[230][l])+0.3061862178478971*(f[33][l]*alpha_vdim[228][l]+f[37][l]*alpha_vdim[227][l]+f[87][l]*alpha_vdim[226][l])+0.273861278752583*f[23][l]*alpha_vdim[225][l]+0.3061862178478971*f[61][l]*alpha_vdim[224][l]+0.273861278752583*f[57][l]*alpha_vdim[181][l]+(0.273861278752583*f[82][l]+0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[180][l]+0.273861278752583*f[69][l]*alpha_vdim[169][l]+(0.273861278752583*f[73][l]+0.1956151991089878*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[168][l]+(0.273861278752583*f[49][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[155][l]+(0.273861278752583*f[45][l]+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[145][l]+0.273861278752583*f[92][l]*alpha_vdim[144][l]+(0.1956151991089878*f[91][l]+0.3061862178478971*f[27][l])*alpha_vdim[143][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[21][l])*alpha_vdim[137][l]+(0.2449489742783178*f[93][l]+0.273861278752583*f[25][l])*alpha_vdim[133][l]+0.1956151991089878*f[70][l]*alpha_vdim[128][l]+0.3061862178478971*(f[14][l]*alpha_vdim[128][l]+f[56][l]*alpha_vdim[125][l])+(0.2449489742783178*f[81][l]+0.273861278752583*f[7][l])*alpha_vdim[124][l]+0.3061862178478971*f[68][l]*alpha_vdim[120][l]+0.2449489742783178*f[72][l]*alpha_vdim[119][l]+0.273861278752583*(f[12][l]*alpha_vdim[119][l]+f[52][l]*alpha_vdim[118][l])+0.3061862178478971*(f[33][l]*alpha_vdim[117][l]+f[43][l]*alpha_vdim[115][l]+f[91][l]*alpha_vdim[114][l])+0.273861278752583*f[26][l]*alpha_vdim[113][l]+0.3061862178478971*f[70][l]*alpha_vdim[112][l]+0.2449489742783178*(alpha_vdim[25][l]*f[104][l]+alpha_vdim[22][l]*f[100][l])+0.6123724356957944*alpha_cdim[3][l]*f[98][l]+0.273861278752583*alpha_vdim[32][l]*f[95][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[94][l]+0.273861278752583*alpha_vdim[68][l]*f[84][l]+0.2449489742783178*alpha_vdim[12][l]*f[83][l]+0.273861278752583*alpha_vdim[59][l]*f[78][l]+0.2449489742783178*alpha_vdim[9][l]*f[77][l]+(0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[74][l]+0.273861278752583*(alpha_vdim[60][l]*f[69][l]+f[60][l]*alpha_vdim[69][l])+(0.1956151991089878*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[68][l]+0.1956151991089878*f[59][l]*alpha_vdim[68][l]+0.3061862178478971*(f[10][l]*alpha_vdim[68][l]+alpha_vdim[13][l]*f[59][l]+f[13][l]*alpha_vdim[59][l])+0.6846531968814573*alpha_cdim[0][l]*f[54][l]+0.273861278752583*(alpha_vdim[6][l]*f[53][l]+alpha_vdim[43][l]*f[50][l]+alpha_vdim[37][l]*f[46][l])+(0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[43][l]+0.1956151991089878*f[37][l]*alpha_vdim[43][l]+0.3061862178478971*(f[4][l]*alpha_vdim[43][l]+alpha_vdim[5][l]*f[37][l]+f[5][l]*alpha_vdim[37][l]+f[29][l]*alpha_vdim[31][l])+0.6846531968814573*alpha_cdim[3][l]*f[28][l]+0.273861278752583*(alpha_vdim[1][l]*f[28][l]+alpha_vdim[22][l]*f[25][l]+f[22][l]*alpha_vdim[25][l])+0.3061862178478971*f[15][l]*alpha_vdim[16][l]+0.273861278752583*(alpha_vdim[9][l]*f[12][l]+f[9][l]*alpha_vdim[12][l]);
+    out[97][l] += (0.273861278752583*f[66][l]+0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[284][l]+0.273861278752583*f[56][l]*alpha_vdim[283][l]+(0.273861278752583*f[63][l]+0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[281][l]+0.273861278752583*f[59][l]*alpha_vdim[280][l]+(0.273861278752583*f[42][l]+0.1956151991089878*f[34][l]+0.3061862178478971*f[3][l])*alpha_vdim[262][l]+(0.273861278752583*f[39][l]+0.1956151991089878*f[38][l]+0.3061862178478971*f[4][l])*alpha_vdim[258][l]+(0.1956151991089878*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[256][l]+0.273861278752583*f[87][l]*alpha_vdim[255][l]+(0.2449489742783178*f[90][l]+0.273861278752583*f[21][l])*alpha_vdim[246][l]+(0.2449489742783178*f[89][l]+0.273861278752583*f[22][l])*alpha_vdim[245][l]+(0.1956151991089878*f[62][l]+0.3061862178478971*f[11][l])*alpha_vdim[241][l]+(0.2449489742783178*f[67][l]+0.273861278752583*f[8][l])*alpha_vdim[234][l]+0.3061862178478971*f[57][l]*alpha_vdim[233][l]+(0.2449489742783178*f[64][l]+0.273861278752583*f[10][l])*alpha_vdim[232][l]+0.3061862178478971*f[60][l]*alpha_vdim[231][l]+0.273861278752583*f[51][l]*alpha_vdim[230][l]+0.3061862178478971*(f[34][l]*alpha_vdim[228][l]+f[38][l]*alpha_vdim[227][l])+0.273861278752583*f[24][l]*alpha_vdim[226][l]+0.3061862178478971*(f[88][l]*alpha_vdim[225][l]+f[62][l]*alpha_vdim[224][l])+(0.273861278752583*f[81][l]+0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[181][l]+0.273861278752583*f[56][l]*alpha_vdim[180][l]+(0.273861278752583*f[72][l]+0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[169][l]+0.273861278752583*f[68][l]*alpha_vdim[168][l]+(0.273861278752583*f[49][l]+0.1956151991089878*f[34][l]+0.3061862178478971*f[3][l])*alpha_vdim[156][l]+(0.273861278752583*f[45][l]+0.1956151991089878*f[44][l]+0.3061862178478971*f[5][l])*alpha_vdim[146][l]+(0.1956151991089878*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[144][l]+0.273861278752583*f[91][l]*alpha_vdim[143][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[21][l])*alpha_vdim[137][l]+(0.2449489742783178*f[93][l]+0.273861278752583*f[25][l])*alpha_vdim[133][l]+(0.1956151991089878*f[71][l]+0.3061862178478971*f[14][l])*alpha_vdim[129][l]+(0.2449489742783178*f[82][l]+0.273861278752583*f[8][l])*alpha_vdim[125][l]+0.3061862178478971*f[57][l]*alpha_vdim[124][l]+(0.2449489742783178*f[73][l]+0.273861278752583*f[13][l])*alpha_vdim[120][l]+0.3061862178478971*f[69][l]*alpha_vdim[119][l]+0.273861278752583*f[52][l]*alpha_vdim[118][l]+0.3061862178478971*f[34][l]*alpha_vdim[117][l]+(0.6123724356957944*f[102][l]+0.6846531968814573*f[27][l])*alpha_cdim[116][l]+0.3061862178478971*f[44][l]*alpha_vdim[115][l]+0.273861278752583*f[27][l]*alpha_vdim[114][l]+0.3061862178478971*(f[92][l]*alpha_vdim[113][l]+f[71][l]*alpha_vdim[112][l])+0.6846531968814573*f[55][l]*alpha_cdim[112][l]+0.2449489742783178*(alpha_vdim[25][l]*f[104][l]+alpha_vdim[22][l]*f[100][l])+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[95][l]+0.273861278752583*alpha_vdim[31][l]*f[94][l]+0.2449489742783178*alpha_vdim[13][l]*f[84][l]+0.273861278752583*alpha_vdim[69][l]*f[83][l]+0.2449489742783178*alpha_vdim[10][l]*f[78][l]+0.273861278752583*alpha_vdim[60][l]*f[77][l]+(0.1956151991089878*alpha_vdim[17][l]+0.3061862178478971*alpha_vdim[0][l])*f[75][l]+(0.1956151991089878*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[69][l]+(0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[69][l]+0.273861278752583*(alpha_vdim[59][l]*f[68][l]+f[59][l]*alpha_vdim[68][l])+0.3061862178478971*(alpha_vdim[12][l]*f[60][l]+f[12][l]*alpha_vdim[60][l])+0.273861278752583*(alpha_vdim[6][l]*f[53][l]+alpha_vdim[44][l]*f[50][l]+alpha_vdim[38][l]*f[46][l])+(0.1956151991089878*alpha_vdim[38][l]+0.3061862178478971*alpha_vdim[4][l])*f[44][l]+0.1956151991089878*f[38][l]*alpha_vdim[44][l]+0.3061862178478971*(f[4][l]*alpha_vdim[44][l]+alpha_vdim[5][l]*f[38][l]+f[5][l]*alpha_vdim[38][l]+f[28][l]*alpha_vdim[32][l])+0.273861278752583*(alpha_vdim[2][l]*f[29][l]+alpha_vdim[22][l]*f[25][l]+f[22][l]*alpha_vdim[25][l])+0.3061862178478971*f[15][l]*alpha_vdim[17][l]+0.273861278752583*(alpha_vdim[10][l]*f[13][l]+f[10][l]*alpha_vdim[13][l]);
+    out[98][l] += 0.273861278752583*(f[58][l]*alpha_vdim[283][l]+f[62][l]*alpha_vdim[281][l])+0.2449489742783178*f[51][l]*alpha_vdim[280][l]+0.273861278752583*(f[35][l]*alpha_vdim[261][l]+f[88][l]*alpha_vdim[258][l])+0.2449489742783178*f[23][l]*alpha_vdim[257][l]+0.273861278752583*f[89][l]*alpha_vdim[255][l]+0.3061862178478971*f[36][l]*alpha_vdim[246][l]+0.2449489742783178*f[87][l]*alpha_vdim[245][l]+0.273861278752583*(f[24][l]*alpha_vdim[245][l]+f[63][l]*alpha_vdim[240][l])+0.3061862178478971*(f[58][l]*alpha_vdim[234][l]+f[18][l]*alpha_vdim[233][l])+0.273861278752583*f[51][l]*alpha_vdim[232][l]+(0.2449489742783178*f[61][l]+0.273861278752583*f[11][l])*alpha_vdim[231][l]+0.3061862178478971*(f[64][l]*alpha_vdim[230][l]+f[35][l]*alpha_vdim[228][l])+0.273861278752583*f[23][l]*alpha_vdim[227][l]+0.3061862178478971*(f[89][l]*alpha_vdim[226][l]+f[39][l]*alpha_vdim[225][l]+f[63][l]*alpha_vdim[224][l])+0.273861278752583*(f[58][l]*alpha_vdim[180][l]+f[71][l]*alpha_vdim[169][l])+0.2449489742783178*f[52][l]*alpha_vdim[168][l]+0.273861278752583*(f[35][l]*alpha_vdim[155][l]+f[92][l]*alpha_vdim[146][l])+0.2449489742783178*f[26][l]*alpha_vdim[145][l]+0.273861278752583*f[93][l]*alpha_vdim[143][l]+0.3061862178478971*f[36][l]*alpha_vdim[137][l]+0.2449489742783178*f[91][l]*alpha_vdim[133][l]+0.273861278752583*(f[27][l]*alpha_vdim[133][l]+f[72][l]*alpha_vdim[128][l])+0.3061862178478971*(f[58][l]*alpha_vdim[125][l]+f[18][l]*alpha_vdim[124][l])+0.273861278752583*f[52][l]*alpha_vdim[120][l]+(0.2449489742783178*f[70][l]+0.273861278752583*f[14][l])*alpha_vdim[119][l]+0.3061862178478971*(f[73][l]*alpha_vdim[118][l]+f[35][l]*alpha_vdim[117][l])+0.273861278752583*f[26][l]*alpha_vdim[115][l]+0.3061862178478971*(f[93][l]*alpha_vdim[114][l]+f[45][l]*alpha_vdim[113][l]+f[72][l]*alpha_vdim[112][l])+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[111][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[110][l]+0.6846531968814573*alpha_vdim[17][l]*f[108][l]+0.6123724356957944*(alpha_vdim[6][l]*f[107][l]+alpha_vdim[25][l]*f[106][l])+0.5477225575051661*alpha_vdim[43][l]*f[105][l]+0.6123724356957944*(alpha_vdim[5][l]*f[105][l]+alpha_vdim[22][l]*f[102][l])+(0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[101][l]+0.6846531968814573*alpha_vdim[32][l]*f[97][l]+0.6123724356957944*alpha_vdim[1][l]*f[96][l]+0.6846531968814573*alpha_vdim[38][l]*f[92][l]+0.6123724356957944*alpha_vdim[22][l]*f[91][l]+0.6846531968814573*alpha_vdim[44][l]*f[88][l]+0.6123724356957944*alpha_vdim[25][l]*f[87][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[86][l]+0.6123724356957944*(alpha_vdim[12][l]*f[85][l]+alpha_vdim[9][l]*f[79][l])+0.3061862178478971*alpha_cdim[0][l]*f[76][l]+0.6846531968814573*alpha_vdim[60][l]*f[71][l]+0.6123724356957944*alpha_vdim[9][l]*f[70][l]+0.6846531968814573*f[62][l]*alpha_vdim[69][l]+0.6123724356957944*(f[51][l]*alpha_vdim[68][l]+alpha_vdim[12][l]*f[61][l]+f[52][l]*alpha_vdim[59][l])+0.6846531968814573*alpha_vdim[6][l]*f[55][l]+0.6123724356957944*alpha_vdim[16][l]*f[54][l]+0.6846531968814573*(alpha_vdim[0][l]*f[54][l]+alpha_vdim[10][l]*f[52][l]+alpha_vdim[13][l]*f[51][l])+0.6123724356957944*(f[23][l]*alpha_vdim[43][l]+f[26][l]*alpha_vdim[37][l])+0.273861278752583*alpha_cdim[3][l]*f[30][l]+0.6846531968814573*(alpha_vdim[1][l]*f[30][l]+alpha_vdim[22][l]*f[27][l]+alpha_vdim[4][l]*f[26][l]+f[24][l]*alpha_vdim[25][l]+alpha_vdim[5][l]*f[23][l]+alpha_vdim[9][l]*f[14][l]+f[11][l]*alpha_vdim[12][l]);
+    out[99][l] += 0.273861278752583*f[58][l]*alpha_vdim[284][l]+0.2449489742783178*f[51][l]*alpha_vdim[281][l]+0.273861278752583*(f[61][l]*alpha_vdim[280][l]+f[36][l]*alpha_vdim[262][l])+0.2449489742783178*f[24][l]*alpha_vdim[258][l]+0.273861278752583*(f[87][l]*alpha_vdim[257][l]+f[89][l]*alpha_vdim[256][l])+0.3061862178478971*f[35][l]*alpha_vdim[246][l]+0.2449489742783178*f[88][l]*alpha_vdim[245][l]+0.273861278752583*(f[23][l]*alpha_vdim[245][l]+f[64][l]*alpha_vdim[241][l])+0.3061862178478971*(f[18][l]*alpha_vdim[234][l]+f[58][l]*alpha_vdim[233][l])+0.2449489742783178*f[62][l]*alpha_vdim[232][l]+0.273861278752583*(f[11][l]*alpha_vdim[232][l]+f[51][l]*alpha_vdim[231][l])+0.3061862178478971*(f[63][l]*alpha_vdim[230][l]+f[36][l]*alpha_vdim[228][l])+0.273861278752583*f[24][l]*alpha_vdim[227][l]+0.3061862178478971*(f[39][l]*alpha_vdim[226][l]+f[89][l]*alpha_vdim[225][l]+f[64][l]*alpha_vdim[224][l])+0.273861278752583*f[58][l]*alpha_vdim[181][l]+0.2449489742783178*f[52][l]*alpha_vdim[169][l]+0.273861278752583*(f[70][l]*alpha_vdim[168][l]+f[36][l]*alpha_vdim[156][l])+0.2449489742783178*f[27][l]*alpha_vdim[146][l]+0.273861278752583*(f[91][l]*alpha_vdim[145][l]+f[93][l]*alpha_vdim[144][l])+0.3061862178478971*f[35][l]*alpha_vdim[137][l]+0.2449489742783178*f[92][l]*alpha_vdim[133][l]+0.273861278752583*(f[26][l]*alpha_vdim[133][l]+f[73][l]*alpha_vdim[129][l])+0.3061862178478971*(f[18][l]*alpha_vdim[125][l]+f[58][l]*alpha_vdim[124][l])+0.2449489742783178*f[71][l]*alpha_vdim[120][l]+0.273861278752583*(f[14][l]*alpha_vdim[120][l]+f[52][l]*alpha_vdim[119][l])+0.3061862178478971*(f[72][l]*alpha_vdim[118][l]+f[36][l]*alpha_vdim[117][l]+f[45][l]*alpha_cdim[116][l])+0.273861278752583*f[27][l]*alpha_vdim[115][l]+0.3061862178478971*(f[45][l]*alpha_vdim[114][l]+f[93][l]*alpha_vdim[113][l]+f[73][l]*alpha_vdim[112][l]+f[76][l]*alpha_cdim[112][l])+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[111][l]+0.5477225575051661*alpha_vdim[60][l]*f[110][l]+0.6123724356957944*(alpha_vdim[9][l]*f[110][l]+alpha_vdim[6][l]*f[108][l])+0.6846531968814573*alpha_vdim[16][l]*f[107][l]+0.5477225575051661*alpha_vdim[44][l]*f[106][l]+0.6123724356957944*(alpha_vdim[5][l]*f[106][l]+alpha_vdim[25][l]*f[105][l])+0.5477225575051661*alpha_vdim[38][l]*f[102][l]+0.6123724356957944*(alpha_vdim[4][l]*f[102][l]+alpha_vdim[22][l]*f[101][l]+alpha_vdim[2][l]*f[97][l])+0.6846531968814573*alpha_vdim[31][l]*f[96][l]+0.6123724356957944*alpha_vdim[22][l]*f[92][l]+0.6846531968814573*alpha_vdim[37][l]*f[91][l]+0.6123724356957944*alpha_vdim[25][l]*f[88][l]+0.6846531968814573*alpha_vdim[43][l]*f[87][l]+(0.6123724356957944*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[86][l]+0.6123724356957944*(alpha_vdim[13][l]*f[85][l]+alpha_vdim[10][l]*(f[79][l]+f[71][l]))+0.6846531968814573*alpha_vdim[59][l]*f[70][l]+0.6123724356957944*f[51][l]*alpha_vdim[69][l]+0.6846531968814573*f[61][l]*alpha_vdim[68][l]+0.6123724356957944*(alpha_vdim[13][l]*f[62][l]+f[52][l]*alpha_vdim[60][l]+alpha_vdim[17][l]*f[55][l])+0.6846531968814573*(alpha_vdim[0][l]*f[55][l]+alpha_vdim[6][l]*f[54][l]+alpha_vdim[9][l]*f[52][l]+alpha_vdim[12][l]*f[51][l])+0.6123724356957944*(f[24][l]*alpha_vdim[44][l]+f[27][l]*alpha_vdim[38][l])+0.6846531968814573*(alpha_vdim[2][l]*f[30][l]+alpha_vdim[4][l]*f[27][l]+alpha_vdim[22][l]*f[26][l]+f[23][l]*alpha_vdim[25][l]+alpha_vdim[5][l]*f[24][l]+alpha_vdim[10][l]*f[14][l]+f[11][l]*alpha_vdim[13][l]);
+    out[100][l] += (0.2190890230020664*f[59][l]+0.2449489742783178*f[10][l])*alpha_vdim[284][l]+(0.2190890230020664*f[60][l]+0.2449489742783178*f[9][l])*alpha_vdim[283][l]+0.273861278752583*(f[67][l]*alpha_vdim[281][l]+f[66][l]*alpha_vdim[280][l])+0.2449489742783178*f[22][l]*(alpha_vdim[262][l]+alpha_vdim[261][l])+0.273861278752583*(f[90][l]*(alpha_vdim[258][l]+alpha_vdim[257][l])+f[41][l]*alpha_vdim[256][l]+f[40][l]*alpha_vdim[255][l])+(0.2449489742783178*(f[38][l]+f[37][l])+0.273861278752583*f[4][l])*alpha_vdim[246][l]+0.3061862178478971*f[42][l]*alpha_vdim[245][l]+0.273861278752583*f[65][l]*(alpha_vdim[241][l]+alpha_vdim[240][l])+(0.2449489742783178*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[234][l]+(0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[233][l]+0.3061862178478971*(f[66][l]*alpha_vdim[232][l]+f[67][l]*alpha_vdim[231][l]+f[19][l]*alpha_vdim[230][l])+0.273861278752583*f[22][l]*alpha_vdim[228][l]+0.3061862178478971*(f[90][l]*alpha_vdim[227][l]+f[40][l]*alpha_vdim[226][l]+f[41][l]*alpha_vdim[225][l]+f[65][l]*alpha_vdim[224][l])+(0.5477225575051661*(f[84][l]+f[59][l])+0.6123724356957944*f[10][l])*alpha_vdim[181][l]+(0.5477225575051661*(f[83][l]+f[60][l])+0.6123724356957944*f[9][l])*alpha_vdim[180][l]+(0.5477225575051661*f[107][l]+0.6123724356957944*f[55][l])*alpha_vdim[169][l]+(0.5477225575051661*f[108][l]+0.6123724356957944*f[54][l])*alpha_vdim[168][l]+(0.5477225575051661*f[104][l]+0.6123724356957944*f[22][l])*alpha_vdim[156][l]+0.5477225575051661*f[104][l]*alpha_vdim[155][l]+0.6123724356957944*(f[22][l]*alpha_vdim[155][l]+f[86][l]*(alpha_vdim[146][l]+alpha_vdim[145][l]))+(0.5477225575051661*f[94][l]+0.6123724356957944*f[29][l])*alpha_vdim[144][l]+(0.5477225575051661*f[95][l]+0.6123724356957944*f[28][l])*alpha_vdim[143][l]+(0.6123724356957944*(f[50][l]+f[38][l]+f[37][l])+0.6846531968814573*f[4][l])*alpha_vdim[137][l]+(0.6123724356957944*(f[97][l]+f[96][l])+0.6846531968814573*f[30][l])*alpha_vdim[133][l]+0.6123724356957944*f[53][l]*(alpha_vdim[129][l]+alpha_vdim[128][l])+(0.6123724356957944*(f[83][l]+f[60][l])+0.6846531968814573*f[9][l])*alpha_vdim[125][l]+(0.6123724356957944*(f[84][l]+f[59][l])+0.6846531968814573*f[10][l])*alpha_vdim[124][l]+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[120][l]+(0.6123724356957944*f[107][l]+0.6846531968814573*f[55][l])*alpha_vdim[119][l]+(0.6123724356957944*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[118][l]+(0.6123724356957944*f[104][l]+0.6846531968814573*f[22][l])*alpha_vdim[117][l]+0.273861278752583*f[28][l]*alpha_cdim[116][l]+0.6846531968814573*f[86][l]*alpha_vdim[115][l]+(0.6123724356957944*f[95][l]+0.6846531968814573*f[28][l])*alpha_vdim[114][l]+0.6123724356957944*f[94][l]*alpha_vdim[113][l]+0.6846531968814573*(f[29][l]*alpha_vdim[113][l]+f[53][l]*alpha_vdim[112][l])+0.3061862178478971*(f[77][l]*alpha_cdim[112][l]+alpha_cdim[3][l]*f[102][l]+alpha_cdim[0][l]*f[78][l]);
+    out[101][l] += 0.273861278752583*f[62][l]*alpha_vdim[284][l]+0.2449489742783178*f[51][l]*alpha_vdim[283][l]+0.273861278752583*(f[65][l]*alpha_vdim[280][l]+f[88][l]*alpha_vdim[262][l])+0.2449489742783178*f[23][l]*alpha_vdim[261][l]+0.273861278752583*(f[40][l]*alpha_vdim[257][l]+f[90][l]*alpha_vdim[255][l])+(0.2449489742783178*f[87][l]+0.273861278752583*f[24][l])*alpha_vdim[246][l]+0.3061862178478971*f[41][l]*alpha_vdim[245][l]+0.273861278752583*(f[66][l]*alpha_vdim[240][l]+f[51][l]*alpha_vdim[234][l])+(0.2449489742783178*f[61][l]+0.273861278752583*f[11][l])*alpha_vdim[233][l]+0.3061862178478971*(f[65][l]*alpha_vdim[232][l]+f[19][l]*alpha_vdim[231][l]+f[67][l]*alpha_vdim[230][l])+0.273861278752583*f[23][l]*alpha_vdim[228][l]+0.3061862178478971*(f[40][l]*alpha_vdim[227][l]+f[90][l]*alpha_vdim[226][l]+f[42][l]*alpha_vdim[225][l]+f[66][l]*alpha_vdim[224][l])+0.6846531968814573*f[62][l]*alpha_vdim[181][l]+(0.5477225575051661*f[111][l]+0.6123724356957944*f[51][l])*alpha_vdim[180][l]+0.6846531968814573*f[75][l]*alpha_vdim[169][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[53][l])*alpha_vdim[168][l]+0.6846531968814573*f[88][l]*alpha_vdim[156][l]+(0.5477225575051661*f[105][l]+0.6123724356957944*f[23][l])*alpha_vdim[155][l]+0.6846531968814573*f[95][l]*alpha_vdim[146][l]+(0.5477225575051661*f[98][l]+0.6123724356957944*f[28][l])*alpha_vdim[145][l]+0.6846531968814573*f[97][l]*alpha_vdim[144][l]+0.6123724356957944*f[86][l]*alpha_vdim[143][l]+(0.6123724356957944*(f[106][l]+f[87][l])+0.6846531968814573*f[24][l])*alpha_vdim[137][l]+0.6123724356957944*(f[99][l]+f[94][l])*alpha_vdim[133][l]+0.6846531968814573*(f[29][l]*alpha_vdim[133][l]+f[108][l]*alpha_vdim[129][l])+0.6123724356957944*f[54][l]*alpha_vdim[128][l]+(0.6123724356957944*f[111][l]+0.6846531968814573*f[51][l])*alpha_vdim[125][l]+(0.6123724356957944*(f[85][l]+f[61][l])+0.6846531968814573*f[11][l])*alpha_vdim[124][l]+(0.6123724356957944*f[109][l]+0.6846531968814573*f[53][l])*alpha_vdim[120][l]+(0.6123724356957944*(f[76][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[119][l]+(0.6123724356957944*f[107][l]+0.6846531968814573*f[55][l])*alpha_vdim[118][l]+(0.6123724356957944*f[105][l]+0.6846531968814573*f[23][l])*alpha_vdim[117][l]+0.6123724356957944*f[98][l]*alpha_vdim[115][l]+0.6846531968814573*(f[28][l]*alpha_vdim[115][l]+f[86][l]*alpha_vdim[114][l])+0.6123724356957944*f[96][l]*alpha_vdim[113][l]+0.6846531968814573*(f[30][l]*alpha_vdim[113][l]+f[54][l]*alpha_vdim[112][l])+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[100][l]+0.273861278752583*alpha_vdim[38][l]*f[95][l]+0.2449489742783178*alpha_vdim[22][l]*f[94][l]+0.3061862178478971*(alpha_cdim[0][l]*f[79][l]+alpha_vdim[6][l]*f[78][l])+(0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[77][l]+0.273861278752583*alpha_vdim[60][l]*f[75][l]+0.2449489742783178*alpha_vdim[9][l]*f[74][l]+f[65][l]*(0.273861278752583*alpha_vdim[68][l]+0.3061862178478971*alpha_vdim[13][l])+f[53][l]*(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l])*f[46][l]+0.273861278752583*f[40][l]*alpha_vdim[43][l]+0.3061862178478971*(alpha_vdim[25][l]*f[41][l]+alpha_vdim[5][l]*f[40][l])+0.2449489742783178*f[28][l]*alpha_vdim[37][l]+0.273861278752583*(alpha_vdim[22][l]*f[29][l]+alpha_vdim[4][l]*f[28][l])+0.3061862178478971*alpha_vdim[12][l]*f[19][l]+0.273861278752583*alpha_vdim[9][l]*f[15][l];
+    out[102][l] += 0.2449489742783178*f[51][l]*alpha_vdim[284][l]+0.273861278752583*(f[61][l]*alpha_vdim[283][l]+f[65][l]*alpha_vdim[281][l])+0.2449489742783178*f[24][l]*alpha_vdim[262][l]+0.273861278752583*(f[87][l]*alpha_vdim[261][l]+f[41][l]*alpha_vdim[258][l]+f[90][l]*alpha_vdim[256][l])+(0.2449489742783178*f[88][l]+0.273861278752583*f[23][l])*alpha_vdim[246][l]+0.3061862178478971*f[40][l]*alpha_vdim[245][l]+0.273861278752583*f[67][l]*alpha_vdim[241][l]+0.2449489742783178*f[62][l]*alpha_vdim[234][l]+0.273861278752583*(f[11][l]*alpha_vdim[234][l]+f[51][l]*alpha_vdim[233][l])+0.3061862178478971*(f[19][l]*alpha_vdim[232][l]+f[65][l]*alpha_vdim[231][l]+f[66][l]*alpha_vdim[230][l])+0.273861278752583*f[24][l]*alpha_vdim[228][l]+0.3061862178478971*(f[41][l]*alpha_vdim[227][l]+f[42][l]*alpha_vdim[226][l]+f[90][l]*alpha_vdim[225][l]+f[67][l]*alpha_vdim[224][l])+(0.5477225575051661*f[111][l]+0.6123724356957944*f[51][l])*alpha_vdim[181][l]+0.6846531968814573*f[61][l]*alpha_vdim[180][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[53][l])*alpha_vdim[169][l]+0.6846531968814573*f[74][l]*alpha_vdim[168][l]+(0.5477225575051661*f[106][l]+0.6123724356957944*f[24][l])*alpha_vdim[156][l]+0.6846531968814573*f[87][l]*alpha_vdim[155][l]+(0.5477225575051661*f[99][l]+0.6123724356957944*f[29][l])*alpha_vdim[146][l]+0.6846531968814573*f[94][l]*alpha_vdim[145][l]+0.6123724356957944*f[86][l]*alpha_vdim[144][l]+0.6846531968814573*f[96][l]*alpha_vdim[143][l]+(0.6123724356957944*(f[105][l]+f[88][l])+0.6846531968814573*f[23][l])*alpha_vdim[137][l]+(0.6123724356957944*(f[98][l]+f[95][l])+0.6846531968814573*f[28][l])*alpha_vdim[133][l]+0.6123724356957944*f[55][l]*alpha_vdim[129][l]+0.6846531968814573*f[107][l]*alpha_vdim[128][l]+(0.6123724356957944*(f[85][l]+f[62][l])+0.6846531968814573*f[11][l])*alpha_vdim[125][l]+(0.6123724356957944*f[111][l]+0.6846531968814573*f[51][l])*alpha_vdim[124][l]+(0.6123724356957944*(f[76][l]+f[75][l])+0.6846531968814573*f[15][l])*alpha_vdim[120][l]+(0.6123724356957944*f[109][l]+0.6846531968814573*f[53][l])*alpha_vdim[119][l]+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[118][l]+(0.6123724356957944*f[106][l]+0.6846531968814573*f[24][l])*alpha_vdim[117][l]+0.273861278752583*f[30][l]*alpha_cdim[116][l]+(0.6123724356957944*f[99][l]+0.6846531968814573*f[29][l])*alpha_vdim[115][l]+0.6123724356957944*f[97][l]*alpha_vdim[114][l]+0.6846531968814573*(f[30][l]*alpha_vdim[114][l]+f[86][l]*alpha_vdim[113][l]+f[55][l]*alpha_vdim[112][l])+0.3061862178478971*f[79][l]*alpha_cdim[112][l]+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[100][l]+0.2449489742783178*alpha_vdim[22][l]*f[95][l]+0.273861278752583*(alpha_vdim[37][l]*f[94][l]+alpha_vdim[17][l]*f[78][l])+0.3061862178478971*(alpha_vdim[0][l]*f[78][l]+alpha_vdim[6][l]*f[77][l])+0.2449489742783178*alpha_vdim[10][l]*f[75][l]+0.273861278752583*alpha_vdim[59][l]*f[74][l]+f[65][l]*(0.273861278752583*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])+f[53][l]*(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])+0.3061862178478971*alpha_vdim[2][l]*f[46][l]+0.273861278752583*f[41][l]*alpha_vdim[44][l]+0.3061862178478971*(alpha_vdim[5][l]*f[41][l]+alpha_vdim[25][l]*f[40][l])+0.2449489742783178*f[29][l]*alpha_vdim[38][l]+0.273861278752583*(alpha_vdim[4][l]*f[29][l]+alpha_vdim[22][l]*f[28][l])+0.3061862178478971*alpha_vdim[13][l]*f[19][l]+0.273861278752583*alpha_vdim[10][l]*f[15][l];
+    out[103][l] += (0.5477225575051661*f[107][l]+0.6123724356957944*f[55][l])*alpha_vdim[284][l]+(0.5477225575051661*f[108][l]+0.6123724356957944*f[54][l])*alpha_vdim[283][l]+(0.5477225575051661*(f[73][l]+f[68][l])+0.6123724356957944*f[13][l])*alpha_vdim[281][l]+0.5477225575051661*(f[72][l]+f[69][l])*alpha_vdim[280][l]+0.6123724356957944*(f[12][l]*alpha_vdim[280][l]+f[86][l]*(alpha_vdim[262][l]+alpha_vdim[261][l]))+(0.5477225575051661*f[93][l]+0.6123724356957944*f[25][l])*alpha_vdim[258][l]+(0.5477225575051661*f[93][l]+0.6123724356957944*f[25][l])*alpha_vdim[257][l]+(0.5477225575051661*f[91][l]+0.6123724356957944*f[27][l])*alpha_vdim[256][l]+(0.5477225575051661*f[92][l]+0.6123724356957944*f[26][l])*alpha_vdim[255][l]+(0.6123724356957944*(f[97][l]+f[96][l])+0.6846531968814573*f[30][l])*alpha_vdim[246][l]+(0.6123724356957944*(f[45][l]+f[44][l]+f[43][l])+0.6846531968814573*f[5][l])*alpha_vdim[245][l]+0.6123724356957944*f[52][l]*(alpha_vdim[241][l]+alpha_vdim[240][l])+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[234][l]+(0.6123724356957944*f[107][l]+0.6846531968814573*f[55][l])*alpha_vdim[233][l]+(0.6123724356957944*(f[72][l]+f[69][l])+0.6846531968814573*f[12][l])*alpha_vdim[232][l]+(0.6123724356957944*(f[73][l]+f[68][l])+0.6846531968814573*f[13][l])*alpha_vdim[231][l]+0.6123724356957944*(f[71][l]+f[70][l])*alpha_vdim[230][l]+0.6846531968814573*(f[14][l]*alpha_vdim[230][l]+f[86][l]*alpha_vdim[228][l])+(0.6123724356957944*f[93][l]+0.6846531968814573*f[25][l])*alpha_vdim[227][l]+(0.6123724356957944*f[92][l]+0.6846531968814573*f[26][l])*alpha_vdim[226][l]+0.6123724356957944*f[91][l]*alpha_vdim[225][l]+0.6846531968814573*(f[27][l]*alpha_vdim[225][l]+f[52][l]*alpha_vdim[224][l])+0.3061862178478971*(f[105][l]*alpha_cdim[116][l]+f[81][l]*alpha_cdim[112][l])+(0.273861278752583*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])*f[104][l]+(0.273861278752583*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[84][l]+0.273861278752583*alpha_vdim[59][l]*f[83][l]+0.3061862178478971*(alpha_vdim[10][l]*f[83][l]+alpha_cdim[0][l]*f[82][l])+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[80][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[69][l]+0.2190890230020664*f[68][l]*alpha_vdim[69][l]+0.2449489742783178*(f[13][l]*alpha_vdim[69][l]+alpha_vdim[12][l]*f[68][l]+f[12][l]*alpha_vdim[68][l])+0.3061862178478971*alpha_vdim[22][l]*f[50][l]+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[48][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[47][l]+0.2449489742783178*(alpha_vdim[25][l]*f[44][l]+f[25][l]*alpha_vdim[44][l]+alpha_vdim[25][l]*f[43][l]+f[25][l]*alpha_vdim[43][l])+0.273861278752583*(alpha_vdim[5][l]*f[25][l]+f[5][l]*alpha_vdim[25][l])+0.3061862178478971*alpha_vdim[6][l]*f[20][l]+0.273861278752583*(alpha_vdim[12][l]*f[13][l]+f[12][l]*alpha_vdim[13][l]);
+    out[104][l] += (0.5477225575051661*(f[78][l]+f[68][l])+0.6123724356957944*f[13][l])*alpha_vdim[284][l]+(0.5477225575051661*(f[77][l]+f[69][l])+0.6123724356957944*f[12][l])*alpha_vdim[283][l]+(0.5477225575051661*f[107][l]+0.6123724356957944*f[55][l])*alpha_vdim[281][l]+(0.5477225575051661*f[108][l]+0.6123724356957944*f[54][l])*alpha_vdim[280][l]+(0.5477225575051661*f[100][l]+0.6123724356957944*f[25][l])*alpha_vdim[262][l]+0.5477225575051661*f[100][l]*alpha_vdim[261][l]+0.6123724356957944*(f[25][l]*alpha_vdim[261][l]+f[86][l]*(alpha_vdim[258][l]+alpha_vdim[257][l]))+(0.5477225575051661*f[94][l]+0.6123724356957944*f[29][l])*alpha_vdim[256][l]+(0.5477225575051661*f[95][l]+0.6123724356957944*f[28][l])*alpha_vdim[255][l]+(0.6123724356957944*(f[46][l]+f[44][l]+f[43][l])+0.6846531968814573*f[5][l])*alpha_vdim[246][l]+(0.6123724356957944*(f[97][l]+f[96][l])+0.6846531968814573*f[30][l])*alpha_vdim[245][l]+0.6123724356957944*f[53][l]*(alpha_vdim[241][l]+alpha_vdim[240][l])+(0.6123724356957944*(f[77][l]+f[69][l])+0.6846531968814573*f[12][l])*alpha_vdim[234][l]+(0.6123724356957944*(f[78][l]+f[68][l])+0.6846531968814573*f[13][l])*alpha_vdim[233][l]+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[232][l]+(0.6123724356957944*f[107][l]+0.6846531968814573*f[55][l])*alpha_vdim[231][l]+(0.6123724356957944*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[230][l]+0.6123724356957944*f[100][l]*alpha_vdim[228][l]+0.6846531968814573*(f[25][l]*alpha_vdim[228][l]+f[86][l]*alpha_vdim[227][l])+(0.6123724356957944*f[95][l]+0.6846531968814573*f[28][l])*alpha_vdim[226][l]+0.6123724356957944*f[94][l]*alpha_vdim[225][l]+0.6846531968814573*(f[29][l]*alpha_vdim[225][l]+f[53][l]*alpha_vdim[224][l])+(0.2190890230020664*f[68][l]+0.2449489742783178*f[13][l])*alpha_vdim[181][l]+(0.2190890230020664*f[69][l]+0.2449489742783178*f[12][l])*alpha_vdim[180][l]+0.273861278752583*(f[82][l]*alpha_vdim[169][l]+f[81][l]*alpha_vdim[168][l])+0.2449489742783178*f[25][l]*(alpha_vdim[156][l]+alpha_vdim[155][l])+0.273861278752583*(f[103][l]*(alpha_vdim[146][l]+alpha_vdim[145][l])+f[48][l]*alpha_vdim[144][l]+f[47][l]*alpha_vdim[143][l])+(0.2449489742783178*(f[44][l]+f[43][l])+0.273861278752583*f[5][l])*alpha_vdim[137][l]+0.3061862178478971*f[49][l]*alpha_vdim[133][l]+0.273861278752583*f[80][l]*(alpha_vdim[129][l]+alpha_vdim[128][l])+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[125][l]+(0.2449489742783178*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[124][l]+0.3061862178478971*(f[81][l]*alpha_vdim[120][l]+f[82][l]*alpha_vdim[119][l]+f[20][l]*alpha_vdim[118][l])+0.273861278752583*f[25][l]*alpha_vdim[117][l]+0.3061862178478971*(f[47][l]*alpha_cdim[116][l]+f[103][l]*alpha_vdim[115][l]+f[47][l]*alpha_vdim[114][l]+f[48][l]*alpha_vdim[113][l]+f[80][l]*alpha_vdim[112][l]+f[83][l]*alpha_cdim[112][l]+alpha_cdim[3][l]*f[106][l]+alpha_cdim[0][l]*f[84][l]);
+    out[105][l] += 0.6846531968814573*f[71][l]*alpha_vdim[284][l]+(0.5477225575051661*f[110][l]+0.6123724356957944*f[52][l])*alpha_vdim[283][l]+0.6846531968814573*f[75][l]*alpha_vdim[281][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[53][l])*alpha_vdim[280][l]+0.6846531968814573*f[92][l]*alpha_vdim[262][l]+(0.5477225575051661*f[101][l]+0.6123724356957944*f[26][l])*alpha_vdim[261][l]+0.6846531968814573*f[95][l]*alpha_vdim[258][l]+(0.5477225575051661*f[98][l]+0.6123724356957944*f[28][l])*alpha_vdim[257][l]+0.6846531968814573*f[97][l]*alpha_vdim[256][l]+0.6123724356957944*f[86][l]*alpha_vdim[255][l]+(0.6123724356957944*(f[102][l]+f[91][l])+0.6846531968814573*f[27][l])*alpha_vdim[246][l]+0.6123724356957944*(f[99][l]+f[94][l])*alpha_vdim[245][l]+0.6846531968814573*(f[29][l]*alpha_vdim[245][l]+f[108][l]*alpha_vdim[241][l])+0.6123724356957944*f[54][l]*alpha_vdim[240][l]+(0.6123724356957944*f[110][l]+0.6846531968814573*f[52][l])*alpha_vdim[234][l]+(0.6123724356957944*(f[79][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[233][l]+(0.6123724356957944*f[109][l]+0.6846531968814573*f[53][l])*alpha_vdim[232][l]+(0.6123724356957944*(f[76][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[231][l]+(0.6123724356957944*f[107][l]+0.6846531968814573*f[55][l])*alpha_vdim[230][l]+(0.6123724356957944*f[101][l]+0.6846531968814573*f[26][l])*alpha_vdim[228][l]+0.6123724356957944*f[98][l]*alpha_vdim[227][l]+0.6846531968814573*(f[28][l]*alpha_vdim[227][l]+f[86][l]*alpha_vdim[226][l])+0.6123724356957944*f[96][l]*alpha_vdim[225][l]+0.6846531968814573*(f[30][l]*alpha_vdim[225][l]+f[54][l]*alpha_vdim[224][l])+0.273861278752583*f[71][l]*alpha_vdim[181][l]+0.2449489742783178*f[52][l]*alpha_vdim[180][l]+0.273861278752583*(f[80][l]*alpha_vdim[168][l]+f[92][l]*alpha_vdim[156][l])+0.2449489742783178*f[26][l]*alpha_vdim[155][l]+0.273861278752583*(f[47][l]*alpha_vdim[145][l]+f[103][l]*alpha_vdim[143][l])+(0.2449489742783178*f[91][l]+0.273861278752583*f[27][l])*alpha_vdim[137][l]+0.3061862178478971*f[48][l]*alpha_vdim[133][l]+0.273861278752583*(f[81][l]*alpha_vdim[128][l]+f[52][l]*alpha_vdim[125][l])+(0.2449489742783178*f[70][l]+0.273861278752583*f[14][l])*alpha_vdim[124][l]+0.3061862178478971*(f[80][l]*alpha_vdim[120][l]+f[20][l]*alpha_vdim[119][l]+f[82][l]*alpha_vdim[118][l])+0.273861278752583*f[26][l]*alpha_vdim[117][l]+0.3061862178478971*(f[47][l]*alpha_vdim[115][l]+f[103][l]*alpha_vdim[114][l]+f[49][l]*alpha_vdim[113][l]+f[81][l]*alpha_vdim[112][l])+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[104][l]+0.273861278752583*alpha_vdim[44][l]*f[95][l]+0.2449489742783178*alpha_vdim[25][l]*f[94][l]+0.3061862178478971*(alpha_cdim[0][l]*f[85][l]+alpha_vdim[6][l]*f[84][l])+(0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[83][l]+(0.273861278752583*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[80][l]+0.273861278752583*alpha_vdim[69][l]*f[75][l]+0.2449489742783178*alpha_vdim[12][l]*f[74][l]+f[53][l]*(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])+0.3061862178478971*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[50][l]+alpha_vdim[22][l]*f[48][l])+(0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[47][l]+0.2449489742783178*f[28][l]*alpha_vdim[43][l]+0.273861278752583*(alpha_vdim[25][l]*f[29][l]+alpha_vdim[5][l]*f[28][l])+0.3061862178478971*alpha_vdim[9][l]*f[20][l]+0.273861278752583*alpha_vdim[12][l]*f[15][l];
+    out[106][l] += (0.5477225575051661*f[110][l]+0.6123724356957944*f[52][l])*alpha_vdim[284][l]+0.6846531968814573*f[70][l]*alpha_vdim[283][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[53][l])*alpha_vdim[281][l]+0.6846531968814573*f[74][l]*alpha_vdim[280][l]+(0.5477225575051661*f[102][l]+0.6123724356957944*f[27][l])*alpha_vdim[262][l]+0.6846531968814573*f[91][l]*alpha_vdim[261][l]+(0.5477225575051661*f[99][l]+0.6123724356957944*f[29][l])*alpha_vdim[258][l]+0.6846531968814573*f[94][l]*alpha_vdim[257][l]+0.6123724356957944*f[86][l]*alpha_vdim[256][l]+0.6846531968814573*f[96][l]*alpha_vdim[255][l]+(0.6123724356957944*(f[101][l]+f[92][l])+0.6846531968814573*f[26][l])*alpha_vdim[246][l]+(0.6123724356957944*(f[98][l]+f[95][l])+0.6846531968814573*f[28][l])*alpha_vdim[245][l]+0.6123724356957944*f[55][l]*alpha_vdim[241][l]+0.6846531968814573*f[107][l]*alpha_vdim[240][l]+(0.6123724356957944*(f[79][l]+f[71][l])+0.6846531968814573*f[14][l])*alpha_vdim[234][l]+(0.6123724356957944*f[110][l]+0.6846531968814573*f[52][l])*alpha_vdim[233][l]+(0.6123724356957944*(f[76][l]+f[75][l])+0.6846531968814573*f[15][l])*alpha_vdim[232][l]+(0.6123724356957944*f[109][l]+0.6846531968814573*f[53][l])*alpha_vdim[231][l]+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[230][l]+(0.6123724356957944*f[102][l]+0.6846531968814573*f[27][l])*alpha_vdim[228][l]+(0.6123724356957944*f[99][l]+0.6846531968814573*f[29][l])*alpha_vdim[227][l]+0.6123724356957944*f[97][l]*alpha_vdim[226][l]+0.6846531968814573*(f[30][l]*alpha_vdim[226][l]+f[86][l]*alpha_vdim[225][l]+f[55][l]*alpha_vdim[224][l])+0.2449489742783178*f[52][l]*alpha_vdim[181][l]+0.273861278752583*(f[70][l]*alpha_vdim[180][l]+f[80][l]*alpha_vdim[169][l])+0.2449489742783178*f[27][l]*alpha_vdim[156][l]+0.273861278752583*(f[91][l]*alpha_vdim[155][l]+f[48][l]*alpha_vdim[146][l]+f[103][l]*alpha_vdim[144][l])+(0.2449489742783178*f[92][l]+0.273861278752583*f[26][l])*alpha_vdim[137][l]+0.3061862178478971*f[47][l]*alpha_vdim[133][l]+0.273861278752583*f[82][l]*alpha_vdim[129][l]+0.2449489742783178*f[71][l]*alpha_vdim[125][l]+0.273861278752583*(f[14][l]*alpha_vdim[125][l]+f[52][l]*alpha_vdim[124][l])+0.3061862178478971*(f[20][l]*alpha_vdim[120][l]+f[80][l]*alpha_vdim[119][l]+f[81][l]*alpha_vdim[118][l])+0.273861278752583*f[27][l]*alpha_vdim[117][l]+0.3061862178478971*(f[49][l]*alpha_cdim[116][l]+f[48][l]*alpha_vdim[115][l]+f[49][l]*alpha_vdim[114][l]+f[103][l]*alpha_vdim[113][l]+f[82][l]*alpha_vdim[112][l]+f[85][l]*alpha_cdim[112][l])+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[104][l]+0.2449489742783178*alpha_vdim[25][l]*f[95][l]+0.273861278752583*(alpha_vdim[43][l]*f[94][l]+alpha_vdim[17][l]*f[84][l])+0.3061862178478971*(alpha_vdim[0][l]*f[84][l]+alpha_vdim[6][l]*f[83][l])+(0.273861278752583*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[80][l]+0.2449489742783178*alpha_vdim[13][l]*f[75][l]+0.273861278752583*alpha_vdim[68][l]*f[74][l]+f[53][l]*(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])+0.3061862178478971*alpha_vdim[2][l]*f[50][l]+0.273861278752583*alpha_vdim[38][l]*f[48][l]+0.3061862178478971*(alpha_vdim[4][l]*f[48][l]+alpha_vdim[22][l]*f[47][l])+0.2449489742783178*f[29][l]*alpha_vdim[44][l]+0.273861278752583*(alpha_vdim[5][l]*f[29][l]+alpha_vdim[25][l]*f[28][l])+0.3061862178478971*alpha_vdim[10][l]*f[20][l]+0.273861278752583*alpha_vdim[13][l]*f[15][l];
+    out[107][l] += (0.2190890230020664*f[90][l]+0.2449489742783178*f[21][l])*alpha_vdim[284][l]+(0.273861278752583*(f[42][l]+f[34][l])+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[283][l]+(0.2190890230020664*f[89][l]+0.2449489742783178*f[22][l])*alpha_vdim[281][l]+(0.273861278752583*(f[39][l]+f[38][l])+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[280][l]+0.273861278752583*f[56][l]*alpha_vdim[262][l]+(0.273861278752583*f[67][l]+0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[261][l]+0.273861278752583*f[59][l]*alpha_vdim[258][l]+(0.273861278752583*f[64][l]+0.1956151991089878*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[257][l]+0.2449489742783178*f[51][l]*alpha_vdim[256][l]+(0.273861278752583*f[62][l]+0.1956151991089878*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[255][l]+(0.2449489742783178*(f[66][l]+f[57][l])+0.273861278752583*f[7][l])*alpha_vdim[246][l]+(0.2449489742783178*(f[63][l]+f[60][l])+0.273861278752583*f[9][l])*alpha_vdim[245][l]+f[87][l]*(0.273861278752583*alpha_vdim[241][l]+0.1956151991089878*alpha_vdim[240][l])+0.3061862178478971*(f[24][l]*alpha_vdim[240][l]+f[33][l]*alpha_vdim[234][l])+(0.2449489742783178*f[90][l]+0.273861278752583*f[21][l])*alpha_vdim[233][l]+0.3061862178478971*f[37][l]*alpha_vdim[232][l]+(0.2449489742783178*f[89][l]+0.273861278752583*f[22][l])*alpha_vdim[231][l]+(0.2449489742783178*f[88][l]+0.273861278752583*f[23][l])*alpha_vdim[230][l]+0.3061862178478971*(f[56][l]*alpha_vdim[228][l]+f[59][l]*alpha_vdim[227][l]+f[61][l]*alpha_vdim[226][l])+0.273861278752583*f[51][l]*alpha_vdim[225][l]+0.3061862178478971*f[87][l]*alpha_vdim[224][l]+(0.2190890230020664*f[103][l]+0.2449489742783178*f[21][l])*alpha_vdim[181][l]+(0.273861278752583*(f[49][l]+f[34][l])+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[180][l]+(0.2190890230020664*f[93][l]+0.2449489742783178*f[25][l])*alpha_vdim[169][l]+(0.273861278752583*(f[45][l]+f[44][l])+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[168][l]+0.273861278752583*f[56][l]*alpha_vdim[156][l]+(0.273861278752583*f[82][l]+0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[155][l]+0.273861278752583*f[68][l]*alpha_vdim[146][l]+(0.273861278752583*f[73][l]+0.1956151991089878*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[145][l]+0.2449489742783178*f[52][l]*alpha_vdim[144][l]+(0.273861278752583*f[71][l]+0.1956151991089878*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[143][l]+(0.2449489742783178*(f[81][l]+f[57][l])+0.273861278752583*f[7][l])*alpha_vdim[137][l]+(0.2449489742783178*(f[72][l]+f[69][l])+0.273861278752583*f[12][l])*alpha_vdim[133][l]+f[91][l]*(0.273861278752583*alpha_vdim[129][l]+0.1956151991089878*alpha_vdim[128][l])+0.3061862178478971*(f[27][l]*alpha_vdim[128][l]+f[33][l]*alpha_vdim[125][l])+(0.2449489742783178*f[103][l]+0.273861278752583*f[21][l])*alpha_vdim[124][l]+0.3061862178478971*f[43][l]*alpha_vdim[120][l]+(0.2449489742783178*f[93][l]+0.273861278752583*f[25][l])*alpha_vdim[119][l]+(0.2449489742783178*f[92][l]+0.273861278752583*f[26][l])*alpha_vdim[118][l]+0.3061862178478971*(f[56][l]*alpha_vdim[117][l]+f[70][l]*alpha_cdim[116][l]+f[68][l]*alpha_vdim[115][l]+f[70][l]*alpha_vdim[114][l])+0.273861278752583*f[52][l]*alpha_vdim[113][l]+0.3061862178478971*(f[91][l]*alpha_vdim[112][l]+f[96][l]*alpha_cdim[112][l])+0.6123724356957944*alpha_cdim[3][l]*f[109][l]+(0.2190890230020664*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[104][l]+0.2190890230020664*alpha_vdim[60][l]*f[100][l]+0.2449489742783178*(alpha_vdim[9][l]*f[100][l]+alpha_vdim[6][l]*f[95][l])+(0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[94][l]+0.6846531968814573*alpha_cdim[0][l]*f[86][l]+0.273861278752583*alpha_vdim[43][l]*f[84][l]+0.2449489742783178*alpha_vdim[25][l]*f[83][l]+0.273861278752583*alpha_vdim[37][l]*f[78][l]+0.2449489742783178*alpha_vdim[22][l]*f[77][l]+0.273861278752583*alpha_vdim[31][l]*f[75][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[74][l]+0.2449489742783178*(alpha_vdim[22][l]*f[69][l]+f[22][l]*alpha_vdim[69][l])+(0.273861278752583*alpha_vdim[38][l]+0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[68][l]+(0.273861278752583*(f[50][l]+f[38][l])+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[68][l]+0.2449489742783178*(alpha_vdim[25][l]*f[60][l]+f[25][l]*alpha_vdim[60][l])+(0.273861278752583*alpha_vdim[44][l]+0.1956151991089878*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[59][l]+(0.273861278752583*(f[46][l]+f[44][l])+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[59][l]+(0.2449489742783178*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[53][l]+0.3061862178478971*(alpha_vdim[10][l]*f[43][l]+f[10][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[37][l]+f[13][l]*alpha_vdim[37][l]+f[15][l]*alpha_vdim[31][l]+alpha_vdim[16][l]*f[29][l])+0.273861278752583*(alpha_vdim[6][l]*f[28][l]+alpha_vdim[9][l]*f[25][l]+f[9][l]*alpha_vdim[25][l]+alpha_vdim[12][l]*f[22][l]+f[12][l]*alpha_vdim[22][l]);
+    out[108][l] += (0.273861278752583*f[42][l]+0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[284][l]+(0.2190890230020664*f[90][l]+0.2449489742783178*f[21][l])*alpha_vdim[283][l]+(0.273861278752583*f[39][l]+0.1956151991089878*f[38][l]+0.273861278752583*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[281][l]+(0.2190890230020664*f[89][l]+0.2449489742783178*f[22][l])*alpha_vdim[280][l]+(0.273861278752583*f[66][l]+0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[262][l]+0.273861278752583*f[57][l]*alpha_vdim[261][l]+(0.273861278752583*f[63][l]+0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[258][l]+0.273861278752583*f[60][l]*alpha_vdim[257][l]+(0.1956151991089878*f[62][l]+0.273861278752583*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[256][l]+0.2449489742783178*f[51][l]*alpha_vdim[255][l]+(0.2449489742783178*(f[67][l]+f[56][l])+0.273861278752583*f[8][l])*alpha_vdim[246][l]+(0.2449489742783178*(f[64][l]+f[59][l])+0.273861278752583*f[10][l])*alpha_vdim[245][l]+(0.1956151991089878*f[88][l]+0.3061862178478971*f[23][l])*alpha_vdim[241][l]+0.273861278752583*f[88][l]*alpha_vdim[240][l]+(0.2449489742783178*f[90][l]+0.273861278752583*f[21][l])*alpha_vdim[234][l]+0.3061862178478971*f[34][l]*alpha_vdim[233][l]+(0.2449489742783178*f[89][l]+0.273861278752583*f[22][l])*alpha_vdim[232][l]+0.3061862178478971*f[38][l]*alpha_vdim[231][l]+(0.2449489742783178*f[87][l]+0.273861278752583*f[24][l])*alpha_vdim[230][l]+0.3061862178478971*(f[57][l]*alpha_vdim[228][l]+f[60][l]*alpha_vdim[227][l])+0.273861278752583*f[51][l]*alpha_vdim[226][l]+0.3061862178478971*(f[62][l]*alpha_vdim[225][l]+f[88][l]*alpha_vdim[224][l])+(0.273861278752583*f[49][l]+0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[181][l]+(0.2190890230020664*f[103][l]+0.2449489742783178*f[21][l])*alpha_vdim[180][l]+(0.273861278752583*f[45][l]+0.1956151991089878*f[44][l]+0.273861278752583*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[169][l]+(0.2190890230020664*f[93][l]+0.2449489742783178*f[25][l])*alpha_vdim[168][l]+(0.273861278752583*f[81][l]+0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[156][l]+0.273861278752583*f[57][l]*alpha_vdim[155][l]+(0.273861278752583*f[72][l]+0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[146][l]+0.273861278752583*f[69][l]*alpha_vdim[145][l]+(0.1956151991089878*f[71][l]+0.273861278752583*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[144][l]+0.2449489742783178*f[52][l]*alpha_vdim[143][l]+(0.2449489742783178*(f[82][l]+f[56][l])+0.273861278752583*f[8][l])*alpha_vdim[137][l]+(0.2449489742783178*(f[73][l]+f[68][l])+0.273861278752583*f[13][l])*alpha_vdim[133][l]+(0.1956151991089878*f[92][l]+0.3061862178478971*f[26][l])*alpha_vdim[129][l]+0.273861278752583*f[92][l]*alpha_vdim[128][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[21][l])*alpha_vdim[125][l]+0.3061862178478971*f[34][l]*alpha_vdim[124][l]+(0.2449489742783178*f[93][l]+0.273861278752583*f[25][l])*alpha_vdim[120][l]+0.3061862178478971*f[44][l]*alpha_vdim[119][l]+(0.2449489742783178*f[91][l]+0.273861278752583*f[27][l])*alpha_vdim[118][l]+0.3061862178478971*f[57][l]*alpha_vdim[117][l]+(0.6123724356957944*f[110][l]+0.6846531968814573*f[52][l])*alpha_cdim[116][l]+0.3061862178478971*f[69][l]*alpha_vdim[115][l]+0.273861278752583*f[52][l]*alpha_vdim[114][l]+0.3061862178478971*(f[71][l]*alpha_vdim[113][l]+f[92][l]*alpha_vdim[112][l])+0.6846531968814573*f[86][l]*alpha_cdim[112][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[104][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[100][l]+0.3061862178478971*alpha_cdim[0][l]*f[97][l]+(0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[95][l]+0.2449489742783178*(alpha_vdim[6][l]*f[94][l]+alpha_vdim[25][l]*f[84][l])+0.273861278752583*alpha_vdim[44][l]*f[83][l]+0.2449489742783178*alpha_vdim[22][l]*f[78][l]+0.273861278752583*alpha_vdim[38][l]*f[77][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[75][l]+0.273861278752583*alpha_vdim[32][l]*f[74][l]+(0.1956151991089878*alpha_vdim[38][l]+0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[69][l]+(0.273861278752583*f[50][l]+0.1956151991089878*f[38][l]+0.273861278752583*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[69][l]+0.2449489742783178*(alpha_vdim[22][l]*f[68][l]+f[22][l]*alpha_vdim[68][l])+(0.1956151991089878*alpha_vdim[44][l]+0.273861278752583*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[60][l]+(0.273861278752583*f[46][l]+0.1956151991089878*f[44][l]+0.273861278752583*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[60][l]+0.2449489742783178*(alpha_vdim[25][l]*f[59][l]+f[25][l]*alpha_vdim[59][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[53][l]+0.3061862178478971*(alpha_vdim[9][l]*f[44][l]+f[9][l]*alpha_vdim[44][l]+alpha_vdim[12][l]*f[38][l]+f[12][l]*alpha_vdim[38][l]+f[15][l]*alpha_vdim[32][l])+0.273861278752583*alpha_vdim[6][l]*f[29][l]+0.3061862178478971*alpha_vdim[17][l]*f[28][l]+0.273861278752583*(alpha_vdim[10][l]*f[25][l]+f[10][l]*alpha_vdim[25][l]+alpha_vdim[13][l]*f[22][l]+f[13][l]*alpha_vdim[22][l]);
+    out[109][l] += 0.273861278752583*(f[36][l]*alpha_vdim[284][l]+f[35][l]*alpha_vdim[283][l])+(0.2190890230020664*f[87][l]+0.2449489742783178*f[24][l])*alpha_vdim[281][l]+(0.2190890230020664*f[88][l]+0.2449489742783178*f[23][l])*alpha_vdim[280][l]+0.273861278752583*f[58][l]*(alpha_vdim[262][l]+alpha_vdim[261][l])+0.2449489742783178*f[51][l]*(alpha_vdim[258][l]+alpha_vdim[257][l])+0.273861278752583*(f[64][l]*alpha_vdim[256][l]+f[63][l]*alpha_vdim[255][l])+0.3061862178478971*f[18][l]*alpha_vdim[246][l]+0.2449489742783178*(f[62][l]+f[61][l])*alpha_vdim[245][l]+0.273861278752583*(f[11][l]*alpha_vdim[245][l]+f[89][l]*(alpha_vdim[241][l]+alpha_vdim[240][l]))+0.3061862178478971*(f[35][l]*alpha_vdim[234][l]+f[36][l]*alpha_vdim[233][l])+(0.2449489742783178*f[88][l]+0.273861278752583*f[23][l])*alpha_vdim[232][l]+(0.2449489742783178*f[87][l]+0.273861278752583*f[24][l])*alpha_vdim[231][l]+0.3061862178478971*(f[39][l]*alpha_vdim[230][l]+f[58][l]*alpha_vdim[228][l])+0.273861278752583*f[51][l]*alpha_vdim[227][l]+0.3061862178478971*(f[63][l]*alpha_vdim[226][l]+f[64][l]*alpha_vdim[225][l]+f[89][l]*alpha_vdim[224][l])+0.273861278752583*(f[36][l]*alpha_vdim[181][l]+f[35][l]*alpha_vdim[180][l])+(0.2190890230020664*f[91][l]+0.2449489742783178*f[27][l])*alpha_vdim[169][l]+(0.2190890230020664*f[92][l]+0.2449489742783178*f[26][l])*alpha_vdim[168][l]+0.273861278752583*f[58][l]*(alpha_vdim[156][l]+alpha_vdim[155][l])+0.2449489742783178*f[52][l]*(alpha_vdim[146][l]+alpha_vdim[145][l])+0.273861278752583*(f[73][l]*alpha_vdim[144][l]+f[72][l]*alpha_vdim[143][l])+0.3061862178478971*f[18][l]*alpha_vdim[137][l]+0.2449489742783178*(f[71][l]+f[70][l])*alpha_vdim[133][l]+0.273861278752583*(f[14][l]*alpha_vdim[133][l]+f[93][l]*(alpha_vdim[129][l]+alpha_vdim[128][l]))+0.3061862178478971*(f[35][l]*alpha_vdim[125][l]+f[36][l]*alpha_vdim[124][l])+(0.2449489742783178*f[92][l]+0.273861278752583*f[26][l])*alpha_vdim[120][l]+(0.2449489742783178*f[91][l]+0.273861278752583*f[27][l])*alpha_vdim[119][l]+0.3061862178478971*(f[45][l]*alpha_vdim[118][l]+f[58][l]*alpha_vdim[117][l]+f[72][l]*alpha_cdim[116][l])+0.273861278752583*f[52][l]*alpha_vdim[115][l]+0.3061862178478971*(f[72][l]*alpha_vdim[114][l]+f[73][l]*alpha_vdim[113][l]+f[93][l]*alpha_vdim[112][l]+f[98][l]*alpha_cdim[112][l])+(0.5477225575051661*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[111][l]+(0.5477225575051661*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[110][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[108][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[107][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[106][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[105][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[102][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[101][l]+0.3061862178478971*alpha_cdim[0][l]*f[99][l]+0.6123724356957944*alpha_vdim[6][l]*(f[97][l]+f[96][l])+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[92][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[91][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[88][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[87][l]+(0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[86][l]+0.6123724356957944*(alpha_vdim[25][l]*f[85][l]+alpha_vdim[22][l]*(f[79][l]+f[71][l]+f[70][l])+f[24][l]*alpha_vdim[69][l]+f[23][l]*alpha_vdim[68][l]+alpha_vdim[25][l]*(f[62][l]+f[61][l])+f[27][l]*alpha_vdim[60][l]+f[26][l]*alpha_vdim[59][l])+(0.6123724356957944*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[55][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[54][l]+(0.6123724356957944*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[52][l]+0.6123724356957944*(alpha_vdim[44][l]+alpha_vdim[43][l])*f[51][l]+0.6846531968814573*(alpha_vdim[5][l]*f[51][l]+alpha_vdim[6][l]*f[30][l]+alpha_vdim[9][l]*f[27][l]+alpha_vdim[10][l]*f[26][l]+f[11][l]*alpha_vdim[25][l]+alpha_vdim[12][l]*f[24][l]+alpha_vdim[13][l]*f[23][l]+f[14][l]*alpha_vdim[22][l]);
+    out[110][l] += (0.2190890230020664*f[87][l]+0.2449489742783178*f[24][l])*alpha_vdim[284][l]+(0.2190890230020664*f[88][l]+0.2449489742783178*f[23][l])*alpha_vdim[283][l]+0.273861278752583*(f[41][l]*alpha_vdim[281][l]+f[40][l]*alpha_vdim[280][l])+0.2449489742783178*f[51][l]*(alpha_vdim[262][l]+alpha_vdim[261][l])+0.273861278752583*(f[65][l]*(alpha_vdim[258][l]+alpha_vdim[257][l])+f[67][l]*alpha_vdim[256][l]+f[66][l]*alpha_vdim[255][l])+(0.2449489742783178*(f[62][l]+f[61][l])+0.273861278752583*f[11][l])*alpha_vdim[246][l]+0.3061862178478971*f[19][l]*alpha_vdim[245][l]+0.273861278752583*f[90][l]*(alpha_vdim[241][l]+alpha_vdim[240][l])+(0.2449489742783178*f[88][l]+0.273861278752583*f[23][l])*alpha_vdim[234][l]+(0.2449489742783178*f[87][l]+0.273861278752583*f[24][l])*alpha_vdim[233][l]+0.3061862178478971*(f[40][l]*alpha_vdim[232][l]+f[41][l]*alpha_vdim[231][l]+f[42][l]*alpha_vdim[230][l])+0.273861278752583*f[51][l]*alpha_vdim[228][l]+0.3061862178478971*(f[65][l]*alpha_vdim[227][l]+f[66][l]*alpha_vdim[226][l]+f[67][l]*alpha_vdim[225][l]+f[90][l]*alpha_vdim[224][l])+(0.5477225575051661*(f[106][l]+f[87][l])+0.6123724356957944*f[24][l])*alpha_vdim[181][l]+(0.5477225575051661*(f[105][l]+f[88][l])+0.6123724356957944*f[23][l])*alpha_vdim[180][l]+(0.5477225575051661*(f[99][l]+f[94][l])+0.6123724356957944*f[29][l])*alpha_vdim[169][l]+(0.5477225575051661*(f[98][l]+f[95][l])+0.6123724356957944*f[28][l])*alpha_vdim[168][l]+(0.5477225575051661*f[111][l]+0.6123724356957944*f[51][l])*alpha_vdim[156][l]+(0.5477225575051661*f[111][l]+0.6123724356957944*f[51][l])*alpha_vdim[155][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[53][l])*alpha_vdim[146][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[53][l])*alpha_vdim[145][l]+(0.5477225575051661*f[107][l]+0.6123724356957944*f[55][l])*alpha_vdim[144][l]+(0.5477225575051661*f[108][l]+0.6123724356957944*f[54][l])*alpha_vdim[143][l]+(0.6123724356957944*(f[85][l]+f[62][l]+f[61][l])+0.6846531968814573*f[11][l])*alpha_vdim[137][l]+(0.6123724356957944*(f[76][l]+f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[133][l]+0.6123724356957944*f[86][l]*(alpha_vdim[129][l]+alpha_vdim[128][l])+(0.6123724356957944*(f[105][l]+f[88][l])+0.6846531968814573*f[23][l])*alpha_vdim[125][l]+(0.6123724356957944*(f[106][l]+f[87][l])+0.6846531968814573*f[24][l])*alpha_vdim[124][l]+(0.6123724356957944*(f[98][l]+f[95][l])+0.6846531968814573*f[28][l])*alpha_vdim[120][l]+(0.6123724356957944*(f[99][l]+f[94][l])+0.6846531968814573*f[29][l])*alpha_vdim[119][l]+(0.6123724356957944*(f[97][l]+f[96][l])+0.6846531968814573*f[30][l])*alpha_vdim[118][l]+(0.6123724356957944*f[111][l]+0.6846531968814573*f[51][l])*alpha_vdim[117][l]+0.273861278752583*f[54][l]*alpha_cdim[116][l]+(0.6123724356957944*f[109][l]+0.6846531968814573*f[53][l])*alpha_vdim[115][l]+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[114][l]+0.6123724356957944*f[107][l]*alpha_vdim[113][l]+0.6846531968814573*(f[55][l]*alpha_vdim[113][l]+f[86][l]*alpha_vdim[112][l])+0.3061862178478971*(f[101][l]*alpha_cdim[112][l]+alpha_cdim[0][l]*f[102][l])+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[100][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[95][l]+(0.2190890230020664*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[94][l]+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[78][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[77][l]+0.2449489742783178*alpha_vdim[22][l]*(f[75][l]+f[74][l])+0.273861278752583*(f[41][l]*alpha_vdim[69][l]+f[40][l]*alpha_vdim[68][l])+(0.273861278752583*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[65][l]+0.2449489742783178*(f[29][l]*alpha_vdim[60][l]+f[28][l]*alpha_vdim[59][l])+(0.2449489742783178*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.273861278752583*alpha_vdim[4][l])*f[53][l]+0.3061862178478971*(alpha_vdim[6][l]*f[46][l]+alpha_vdim[12][l]*f[41][l]+alpha_vdim[13][l]*f[40][l])+0.273861278752583*(alpha_vdim[9][l]*f[29][l]+alpha_vdim[10][l]*f[28][l])+0.3061862178478971*f[19][l]*alpha_vdim[25][l]+0.273861278752583*f[15][l]*alpha_vdim[22][l];
+    out[111][l] += (0.5477225575051661*(f[102][l]+f[91][l])+0.6123724356957944*f[27][l])*alpha_vdim[284][l]+(0.5477225575051661*(f[101][l]+f[92][l])+0.6123724356957944*f[26][l])*alpha_vdim[283][l]+(0.5477225575051661*(f[99][l]+f[94][l])+0.6123724356957944*f[29][l])*alpha_vdim[281][l]+(0.5477225575051661*(f[98][l]+f[95][l])+0.6123724356957944*f[28][l])*alpha_vdim[280][l]+(0.5477225575051661*f[110][l]+0.6123724356957944*f[52][l])*alpha_vdim[262][l]+(0.5477225575051661*f[110][l]+0.6123724356957944*f[52][l])*alpha_vdim[261][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[53][l])*alpha_vdim[258][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[53][l])*alpha_vdim[257][l]+(0.5477225575051661*f[107][l]+0.6123724356957944*f[55][l])*alpha_vdim[256][l]+(0.5477225575051661*f[108][l]+0.6123724356957944*f[54][l])*alpha_vdim[255][l]+(0.6123724356957944*(f[79][l]+f[71][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[246][l]+(0.6123724356957944*(f[76][l]+f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[245][l]+0.6123724356957944*f[86][l]*(alpha_vdim[241][l]+alpha_vdim[240][l])+(0.6123724356957944*(f[101][l]+f[92][l])+0.6846531968814573*f[26][l])*alpha_vdim[234][l]+(0.6123724356957944*(f[102][l]+f[91][l])+0.6846531968814573*f[27][l])*alpha_vdim[233][l]+(0.6123724356957944*(f[98][l]+f[95][l])+0.6846531968814573*f[28][l])*alpha_vdim[232][l]+(0.6123724356957944*(f[99][l]+f[94][l])+0.6846531968814573*f[29][l])*alpha_vdim[231][l]+(0.6123724356957944*(f[97][l]+f[96][l])+0.6846531968814573*f[30][l])*alpha_vdim[230][l]+(0.6123724356957944*f[110][l]+0.6846531968814573*f[52][l])*alpha_vdim[228][l]+(0.6123724356957944*f[109][l]+0.6846531968814573*f[53][l])*alpha_vdim[227][l]+(0.6123724356957944*f[108][l]+0.6846531968814573*f[54][l])*alpha_vdim[226][l]+0.6123724356957944*f[107][l]*alpha_vdim[225][l]+0.6846531968814573*(f[55][l]*alpha_vdim[225][l]+f[86][l]*alpha_vdim[224][l])+(0.2190890230020664*f[91][l]+0.2449489742783178*f[27][l])*alpha_vdim[181][l]+(0.2190890230020664*f[92][l]+0.2449489742783178*f[26][l])*alpha_vdim[180][l]+0.273861278752583*(f[48][l]*alpha_vdim[169][l]+f[47][l]*alpha_vdim[168][l])+0.2449489742783178*f[52][l]*(alpha_vdim[156][l]+alpha_vdim[155][l])+0.273861278752583*(f[80][l]*(alpha_vdim[146][l]+alpha_vdim[145][l])+f[82][l]*alpha_vdim[144][l]+f[81][l]*alpha_vdim[143][l])+(0.2449489742783178*(f[71][l]+f[70][l])+0.273861278752583*f[14][l])*alpha_vdim[137][l]+0.3061862178478971*f[20][l]*alpha_vdim[133][l]+0.273861278752583*f[103][l]*(alpha_vdim[129][l]+alpha_vdim[128][l])+(0.2449489742783178*f[92][l]+0.273861278752583*f[26][l])*alpha_vdim[125][l]+(0.2449489742783178*f[91][l]+0.273861278752583*f[27][l])*alpha_vdim[124][l]+0.3061862178478971*(f[47][l]*alpha_vdim[120][l]+f[48][l]*alpha_vdim[119][l]+f[49][l]*alpha_vdim[118][l])+0.273861278752583*f[52][l]*alpha_vdim[117][l]+0.3061862178478971*(f[81][l]*alpha_cdim[116][l]+f[80][l]*alpha_vdim[115][l]+f[81][l]*alpha_vdim[114][l]+f[82][l]*alpha_vdim[113][l]+f[103][l]*alpha_vdim[112][l]+f[105][l]*alpha_cdim[112][l]+alpha_cdim[0][l]*f[106][l])+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[104][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[95][l]+(0.2190890230020664*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[94][l]+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[84][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[83][l]+(0.273861278752583*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])*f[80][l]+0.2449489742783178*(alpha_vdim[25][l]*(f[75][l]+f[74][l])+f[29][l]*alpha_vdim[69][l]+f[28][l]*alpha_vdim[68][l])+0.273861278752583*(f[48][l]*alpha_vdim[60][l]+f[47][l]*alpha_vdim[59][l])+(0.2449489742783178*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.273861278752583*alpha_vdim[5][l])*f[53][l]+0.3061862178478971*(alpha_vdim[6][l]*f[50][l]+alpha_vdim[9][l]*f[48][l]+alpha_vdim[10][l]*f[47][l])+0.273861278752583*(alpha_vdim[12][l]*f[29][l]+alpha_vdim[13][l]*f[28][l]+f[15][l]*alpha_vdim[25][l])+0.3061862178478971*f[20][l]*alpha_vdim[22][l];
+
+    cfl[l] = cflFreq_mid;
+  } 
+} 
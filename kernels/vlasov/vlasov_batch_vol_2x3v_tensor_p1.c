@@ -0,0 +1,123 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_vol_2x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_vol_2x3v_tensor_p1: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // field:      q/m*EM fields.
+  // cot_vec:   Only used in gen geo.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv0dx0 = dxv[2]/dxv[0];
+  double dv1dx1 = dxv[3]/dxv[1];
+  const double dv10 = 2/dxv[2];
+  const double *E0 = &field[0];
+  const double dv11 = 2/dxv[3];
+  const double *E1 = &field[4];
+  const double dv12 = 2/dxv[4];
+  const double *E2 = &field[8];
+  const double *B0 = &field[12];
+  const double *B1 = &field[16];
+  const double *B2 = &field[20];
+
+  double alpha_cdim[64][GKYL_VLASOV_BATCH] = {{0.0}};
+  double alpha_vdim[96][GKYL_VLASOV_BATCH] = {{0.0}};
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w0dx0 = w[2][l]/dxv[0];
+    double w1dx1 = w[3][l]/dxv[1];
+    const double dv1 = dxv[2], wv1 = w[2][l];
+    const double dv2 = dxv[3], wv2 = w[3][l];
+    const double dv3 = dxv[4], wv3 = w[4][l];
+
+    double cflFreq_mid = 0.0;
+
+    alpha_cdim[0][l] = 11.31370849898477*w0dx0;
+    alpha_cdim[3][l] = 3.265986323710906*dv0dx0;
+    cflFreq_mid += 3.0*(fabs(w0dx0)+0.5*dv0dx0);
+
+    alpha_cdim[32][l] = 11.31370849898477*w1dx1;
+    alpha_cdim[36][l] = 3.265986323710906*dv1dx1;
+    cflFreq_mid += 3.0*(fabs(w1dx1)+0.5*dv1dx1);
+
+    alpha_vdim[0][l] = dv10*(2.828427124746191*(B2[0]*wv2+E0[0])-2.828427124746191*B1[0]*wv3);
+    alpha_vdim[1][l] = dv10*(2.828427124746191*(B2[1]*wv2+E0[1])-2.828427124746191*B1[1]*wv3);
+    alpha_vdim[2][l] = dv10*(2.828427124746191*(B2[2]*wv2+E0[2])-2.828427124746191*B1[2]*wv3);
+    alpha_vdim[4][l] = 0.8164965809277261*B2[0]*dv10*dv2;
+    alpha_vdim[5][l] = -0.8164965809277261*B1[0]*dv10*dv3;
+    alpha_vdim[6][l] = dv10*(2.828427124746191*(B2[3]*wv2+E0[3])-2.828427124746191*B1[3]*wv3);
+    alpha_vdim[9][l] = 0.8164965809277261*B2[1]*dv10*dv2;
+    alpha_vdim[10][l] = 0.8164965809277261*B2[2]*dv10*dv2;
+    alpha_vdim[12][l] = -0.8164965809277261*B1[1]*dv10*dv3;
+    alpha_vdim[13][l] = -0.8164965809277261*B1[2]*dv10*dv3;
+    alpha_vdim[17][l] = 0.8164965809277261*B2[3]*dv10*dv2;
+    alpha_vdim[20][l] = -0.8164965809277261*B1[3]*dv10*dv3;
+    cflFreq_mid += 3.0*fabs(0.0883883476483184*alpha_vdim[0][l]);
+
+    alpha_vdim[32][l] = dv11*(2.828427124746191*B0[0]*wv3-2.828427124746191*B2[0]*wv1+2.828427124746191*E1[0]);
+    alpha_vdim[33][l] = dv11*(2.828427124746191*B0[1]*wv3-2.828427124746191*B2[1]*wv1+2.828427124746191*E1[1]);
+    alpha_vdim[34][l] = dv11*(2.828427124746191*B0[2]*wv3-2.828427124746191*B2[2]*wv1+2.828427124746191*E1[2]);
+    alpha_vdim[35][l] = -0.8164965809277261*B2[0]*dv1*dv11;
+    alpha_vdim[37][l] = 0.8164965809277261*B0[0]*dv11*dv3;
+    alpha_vdim[38][l] = dv11*(2.828427124746191*B0[3]*wv3-2.828427124746191*B2[3]*wv1+2.828427124746191*E1[3]);
+    alpha_vdim[39][l] = -0.8164965809277261*B2[1]*dv1*dv11;
+    alpha_vdim[40][l] = -0.8164965809277261*B2[2]*dv1*dv11;
+    alpha_vdim[44][l] = 0.8164965809277261*B0[1]*dv11*dv3;
+    alpha_vdim[45][l] = 0.8164965809277261*B0[2]*dv11*dv3;
+    alpha_vdim[48][l] = -0.8164965809277261*B2[3]*dv1*dv11;
+    alpha_vdim[52][l] = 0.8164965809277261*B0[3]*dv11*dv3;
+    cflFreq_mid += 3.0*fabs(0.0883883476483184*alpha_vdim[32][l]);
+
+    alpha_vdim[64][l] = dv12*(2.828427124746191*(B1[0]*wv1+E2[0])-2.828427124746191*B0[0]*wv2);
+    alpha_vdim[65][l] = dv12*(2.828427124746191*(B1[1]*wv1+E2[1])-2.828427124746191*B0[1]*wv2);
+    alpha_vdim[66][l] = dv12*(2.828427124746191*(B1[2]*wv1+E2[2])-2.828427124746191*B0[2]*wv2);
+    alpha_vdim[67][l] = 0.8164965809277261*B1[0]*dv1*dv12;
+    alpha_vdim[68][l] = -0.8164965809277261*B0[0]*dv12*dv2;
+    alpha_vdim[70][l] = dv12*(2.828427124746191*(B1[3]*wv1+E2[3])-2.828427124746191*B0[3]*wv2);
+    alpha_vdim[71][l] = 0.8164965809277261*B1[1]*dv1*dv12;
+    alpha_vdim[72][l] = 0.8164965809277261*B1[2]*dv1*dv12;
+    alpha_vdim[73][l] = -0.8164965809277261*B0[1]*dv12*dv2;
+    alpha_vdim[74][l] = -0.8164965809277261*B0[2]*dv12*dv2;
+    alpha_vdim[80][l] = 0.8164965809277261*B1[3]*dv1*dv12;
+    alpha_vdim[81][l] = -0.8164965809277261*B0[3]*dv12*dv2;
+    cflFreq_mid += 3.0*fabs(0.0883883476483184*alpha_vdim[64][l]);
+
+    out[1][l] += 0.3061862178478971*(alpha_cdim[3][l]*f[3][l]+alpha_cdim[0][l]*f[0][l]);
+    out[2][l] += 0.3061862178478971*(f[4][l]*alpha_cdim[36][l]+f[0][l]*alpha_cdim[32][l]);
+    out[3][l] += 0.3061862178478971*(alpha_vdim[20][l]*f[20][l]+alpha_vdim[17][l]*f[17][l]+alpha_vdim[13][l]*f[13][l]+alpha_vdim[12][l]*f[12][l]+alpha_vdim[10][l]*f[10][l]+alpha_vdim[9][l]*f[9][l]+alpha_vdim[6][l]*f[6][l]+alpha_vdim[5][l]*f[5][l]+alpha_vdim[4][l]*f[4][l]+alpha_vdim[2][l]*f[2][l]+alpha_vdim[1][l]*f[1][l]+alpha_vdim[0][l]*f[0][l]);
+    out[4][l] += 0.3061862178478971*(f[20][l]*alpha_vdim[52][l]+f[16][l]*alpha_vdim[48][l]+f[13][l]*alpha_vdim[45][l]+f[12][l]*alpha_vdim[44][l]+f[8][l]*alpha_vdim[40][l]+f[7][l]*alpha_vdim[39][l]+f[6][l]*alpha_vdim[38][l]+f[5][l]*alpha_vdim[37][l]+f[3][l]*alpha_vdim[35][l]+f[2][l]*alpha_vdim[34][l]+f[1][l]*alpha_vdim[33][l]+f[0][l]*alpha_vdim[32][l]);
+    out[5][l] += 0.3061862178478971*(f[17][l]*alpha_vdim[81][l]+f[16][l]*alpha_vdim[80][l]+f[10][l]*alpha_vdim[74][l]+f[9][l]*alpha_vdim[73][l]+f[8][l]*alpha_vdim[72][l]+f[7][l]*alpha_vdim[71][l]+f[6][l]*alpha_vdim[70][l]+f[4][l]*alpha_vdim[68][l]+f[3][l]*alpha_vdim[67][l]+f[2][l]*alpha_vdim[66][l]+f[1][l]*alpha_vdim[65][l]+f[0][l]*alpha_vdim[64][l]);
+    out[6][l] += 0.3061862178478971*(f[9][l]*alpha_cdim[36][l]+f[1][l]*alpha_cdim[32][l]+alpha_cdim[3][l]*f[8][l]+alpha_cdim[0][l]*f[2][l]);
+    out[7][l] += 0.3061862178478971*(alpha_vdim[13][l]*f[20][l]+f[13][l]*alpha_vdim[20][l]+alpha_vdim[10][l]*f[17][l]+f[10][l]*alpha_vdim[17][l]+alpha_vdim[5][l]*f[12][l]+f[5][l]*alpha_vdim[12][l]+alpha_vdim[4][l]*f[9][l]+f[4][l]*alpha_vdim[9][l]+alpha_vdim[2][l]*f[6][l]+f[2][l]*alpha_vdim[6][l]+alpha_cdim[0][l]*f[3][l]+f[0][l]*alpha_cdim[3][l]+alpha_vdim[0][l]*f[1][l]+f[0][l]*alpha_vdim[1][l]);
+    out[8][l] += 0.3061862178478971*(f[11][l]*alpha_cdim[36][l]+f[3][l]*alpha_cdim[32][l]+alpha_vdim[12][l]*f[20][l]+f[12][l]*alpha_vdim[20][l]+alpha_vdim[9][l]*f[17][l]+f[9][l]*alpha_vdim[17][l]+alpha_vdim[5][l]*f[13][l]+f[5][l]*alpha_vdim[13][l]+alpha_vdim[4][l]*f[10][l]+f[4][l]*alpha_vdim[10][l]+alpha_vdim[1][l]*f[6][l]+f[1][l]*alpha_vdim[6][l]+alpha_vdim[0][l]*f[2][l]+f[0][l]*alpha_vdim[2][l]);
+    out[9][l] += 0.3061862178478971*(f[13][l]*alpha_vdim[52][l]+f[8][l]*alpha_vdim[48][l]+f[20][l]*alpha_vdim[45][l]+f[5][l]*alpha_vdim[44][l]+f[16][l]*alpha_vdim[40][l]+f[3][l]*alpha_vdim[39][l]+f[2][l]*alpha_vdim[38][l]+f[12][l]*alpha_vdim[37][l]+f[7][l]*alpha_vdim[35][l]+f[6][l]*alpha_vdim[34][l]+f[0][l]*alpha_vdim[33][l]+f[1][l]*alpha_vdim[32][l]+alpha_cdim[3][l]*f[11][l]+alpha_cdim[0][l]*f[4][l]);
+    out[10][l] += 0.3061862178478971*(f[12][l]*alpha_vdim[52][l]+f[7][l]*alpha_vdim[48][l]+f[5][l]*alpha_vdim[45][l]+f[20][l]*alpha_vdim[44][l]+f[3][l]*alpha_vdim[40][l]+f[16][l]*alpha_vdim[39][l]+f[1][l]*alpha_vdim[38][l]+f[13][l]*alpha_vdim[37][l]+f[0][l]*alpha_cdim[36][l]+f[8][l]*alpha_vdim[35][l]+f[0][l]*alpha_vdim[34][l]+f[6][l]*alpha_vdim[33][l]+f[2][l]*alpha_vdim[32][l]+f[4][l]*alpha_cdim[32][l]);
+    out[11][l] += 0.3061862178478971*(f[27][l]*alpha_vdim[52][l]+f[6][l]*alpha_vdim[48][l]+f[22][l]*alpha_vdim[45][l]+f[21][l]*alpha_vdim[44][l]+f[2][l]*alpha_vdim[40][l]+f[1][l]*alpha_vdim[39][l]+f[16][l]*alpha_vdim[38][l]+f[14][l]*alpha_vdim[37][l]+f[0][l]*alpha_vdim[35][l]+f[8][l]*alpha_vdim[34][l]+f[7][l]*alpha_vdim[33][l]+f[3][l]*alpha_vdim[32][l]+alpha_vdim[20][l]*f[28][l]+alpha_vdim[13][l]*f[24][l]+alpha_vdim[12][l]*f[23][l]+alpha_vdim[6][l]*f[17][l]+f[6][l]*alpha_vdim[17][l]+alpha_vdim[5][l]*f[15][l]+alpha_vdim[2][l]*f[10][l]+f[2][l]*alpha_vdim[10][l]+alpha_vdim[1][l]*f[9][l]+f[1][l]*alpha_vdim[9][l]+alpha_vdim[0][l]*f[4][l]+f[0][l]*alpha_vdim[4][l]);
+    out[12][l] += 0.3061862178478971*(f[10][l]*alpha_vdim[81][l]+f[8][l]*alpha_vdim[80][l]+f[17][l]*alpha_vdim[74][l]+f[4][l]*alpha_vdim[73][l]+f[16][l]*alpha_vdim[72][l]+f[3][l]*alpha_vdim[71][l]+f[2][l]*alpha_vdim[70][l]+f[9][l]*alpha_vdim[68][l]+f[7][l]*alpha_vdim[67][l]+f[6][l]*alpha_vdim[66][l]+f[0][l]*alpha_vdim[65][l]+f[1][l]*alpha_vdim[64][l]+alpha_cdim[3][l]*f[14][l]+alpha_cdim[0][l]*f[5][l]);
+    out[13][l] += 0.3061862178478971*(f[9][l]*alpha_vdim[81][l]+f[7][l]*alpha_vdim[80][l]+f[4][l]*alpha_vdim[74][l]+f[17][l]*alpha_vdim[73][l]+f[3][l]*alpha_vdim[72][l]+f[16][l]*alpha_vdim[71][l]+f[1][l]*alpha_vdim[70][l]+f[10][l]*alpha_vdim[68][l]+f[8][l]*alpha_vdim[67][l]+f[0][l]*alpha_vdim[66][l]+f[6][l]*alpha_vdim[65][l]+f[2][l]*alpha_vdim[64][l]+f[15][l]*alpha_cdim[36][l]+f[5][l]*alpha_cdim[32][l]);
+    out[14][l] += 0.3061862178478971*(f[26][l]*alpha_vdim[81][l]+f[6][l]*alpha_vdim[80][l]+f[19][l]*alpha_vdim[74][l]+f[18][l]*alpha_vdim[73][l]+f[2][l]*alpha_vdim[72][l]+f[1][l]*alpha_vdim[71][l]+f[16][l]*alpha_vdim[70][l]+f[11][l]*alpha_vdim[68][l]+f[0][l]*alpha_vdim[67][l]+f[8][l]*alpha_vdim[66][l]+f[7][l]*alpha_vdim[65][l]+f[3][l]*alpha_vdim[64][l]+alpha_vdim[17][l]*f[28][l]+alpha_vdim[10][l]*f[24][l]+alpha_vdim[9][l]*f[23][l]+alpha_vdim[6][l]*f[20][l]+f[6][l]*alpha_vdim[20][l]+alpha_vdim[4][l]*f[15][l]+alpha_vdim[2][l]*f[13][l]+f[2][l]*alpha_vdim[13][l]+alpha_vdim[1][l]*f[12][l]+f[1][l]*alpha_vdim[12][l]+alpha_vdim[0][l]*f[5][l]+f[0][l]*alpha_vdim[5][l]);
+    out[15][l] += 0.3061862178478971*(f[6][l]*alpha_vdim[81][l]+f[26][l]*alpha_vdim[80][l]+f[2][l]*alpha_vdim[74][l]+f[1][l]*alpha_vdim[73][l]+f[19][l]*alpha_vdim[72][l]+f[18][l]*alpha_vdim[71][l]+f[17][l]*alpha_vdim[70][l]+f[0][l]*alpha_vdim[68][l]+f[11][l]*alpha_vdim[67][l]+f[10][l]*alpha_vdim[66][l]+f[9][l]*alpha_vdim[65][l]+f[4][l]*alpha_vdim[64][l]+f[6][l]*alpha_vdim[52][l]+f[27][l]*alpha_vdim[48][l]+f[2][l]*alpha_vdim[45][l]+f[1][l]*alpha_vdim[44][l]+f[22][l]*alpha_vdim[40][l]+f[21][l]*alpha_vdim[39][l]+f[20][l]*alpha_vdim[38][l]+f[0][l]*alpha_vdim[37][l]+f[14][l]*alpha_vdim[35][l]+f[13][l]*alpha_vdim[34][l]+f[12][l]*alpha_vdim[33][l]+f[5][l]*alpha_vdim[32][l]);
+    out[16][l] += 0.3061862178478971*(f[18][l]*alpha_cdim[36][l]+f[7][l]*alpha_cdim[32][l]+alpha_vdim[5][l]*f[20][l]+f[5][l]*alpha_vdim[20][l]+alpha_vdim[4][l]*f[17][l]+f[4][l]*alpha_vdim[17][l]+alpha_vdim[12][l]*f[13][l]+f[12][l]*alpha_vdim[13][l]+alpha_vdim[9][l]*f[10][l]+f[9][l]*alpha_vdim[10][l]+alpha_cdim[0][l]*f[8][l]+alpha_vdim[0][l]*f[6][l]+f[0][l]*alpha_vdim[6][l]+f[2][l]*(alpha_cdim[3][l]+alpha_vdim[1][l])+f[1][l]*alpha_vdim[2][l]);
+    out[17][l] += 0.3061862178478971*(f[5][l]*alpha_vdim[52][l]+f[3][l]*alpha_vdim[48][l]+f[12][l]*alpha_vdim[45][l]+f[13][l]*alpha_vdim[44][l]+f[7][l]*alpha_vdim[40][l]+f[8][l]*alpha_vdim[39][l]+f[0][l]*alpha_vdim[38][l]+f[20][l]*alpha_vdim[37][l]+f[1][l]*alpha_cdim[36][l]+f[16][l]*alpha_vdim[35][l]+f[1][l]*alpha_vdim[34][l]+f[2][l]*alpha_vdim[33][l]+f[6][l]*alpha_vdim[32][l]+f[9][l]*alpha_cdim[32][l]+alpha_cdim[3][l]*f[19][l]+alpha_cdim[0][l]*f[10][l]);
+    out[18][l] += 0.3061862178478971*(f[22][l]*alpha_vdim[52][l]+f[2][l]*alpha_vdim[48][l]+f[27][l]*alpha_vdim[45][l]+f[14][l]*alpha_vdim[44][l]+f[6][l]*alpha_vdim[40][l]+f[0][l]*alpha_vdim[39][l]+f[8][l]*alpha_vdim[38][l]+f[21][l]*alpha_vdim[37][l]+f[1][l]*alpha_vdim[35][l]+f[16][l]*alpha_vdim[34][l]+f[3][l]*alpha_vdim[33][l]+f[7][l]*alpha_vdim[32][l]+alpha_vdim[13][l]*f[28][l]+alpha_vdim[20][l]*f[24][l]+alpha_vdim[5][l]*f[23][l]+alpha_vdim[2][l]*f[17][l]+f[2][l]*alpha_vdim[17][l]+alpha_vdim[12][l]*f[15][l]+alpha_cdim[0][l]*f[11][l]+alpha_vdim[6][l]*f[10][l]+f[6][l]*alpha_vdim[10][l]+alpha_vdim[0][l]*f[9][l]+f[0][l]*alpha_vdim[9][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[4][l]+f[1][l]*alpha_vdim[4][l]);
+    out[19][l] += 0.3061862178478971*(f[21][l]*alpha_vdim[52][l]+f[1][l]*alpha_vdim[48][l]+f[14][l]*alpha_vdim[45][l]+f[27][l]*alpha_vdim[44][l]+f[0][l]*alpha_vdim[40][l]+f[6][l]*alpha_vdim[39][l]+f[7][l]*alpha_vdim[38][l]+f[22][l]*alpha_vdim[37][l]+f[3][l]*alpha_cdim[36][l]+f[2][l]*alpha_vdim[35][l]+f[3][l]*alpha_vdim[34][l]+f[16][l]*alpha_vdim[33][l]+f[8][l]*alpha_vdim[32][l]+f[11][l]*alpha_cdim[32][l]+alpha_vdim[12][l]*f[28][l]+alpha_vdim[5][l]*f[24][l]+alpha_vdim[20][l]*f[23][l]+alpha_vdim[1][l]*f[17][l]+f[1][l]*alpha_vdim[17][l]+alpha_vdim[13][l]*f[15][l]+alpha_vdim[0][l]*f[10][l]+f[0][l]*alpha_vdim[10][l]+alpha_vdim[6][l]*f[9][l]+f[6][l]*alpha_vdim[9][l]+alpha_vdim[2][l]*f[4][l]+f[2][l]*alpha_vdim[4][l]);
+    out[20][l] += 0.3061862178478971*(f[4][l]*alpha_vdim[81][l]+f[3][l]*alpha_vdim[80][l]+f[9][l]*alpha_vdim[74][l]+f[10][l]*alpha_vdim[73][l]+f[7][l]*alpha_vdim[72][l]+f[8][l]*alpha_vdim[71][l]+f[0][l]*alpha_vdim[70][l]+f[17][l]*alpha_vdim[68][l]+f[16][l]*alpha_vdim[67][l]+f[1][l]*alpha_vdim[66][l]+f[2][l]*alpha_vdim[65][l]+f[6][l]*alpha_vdim[64][l]+f[23][l]*alpha_cdim[36][l]+f[12][l]*alpha_cdim[32][l]+alpha_cdim[3][l]*f[22][l]+alpha_cdim[0][l]*f[13][l]);
+    out[21][l] += 0.3061862178478971*(f[19][l]*alpha_vdim[81][l]+f[2][l]*alpha_vdim[80][l]+f[26][l]*alpha_vdim[74][l]+f[11][l]*alpha_vdim[73][l]+f[6][l]*alpha_vdim[72][l]+f[0][l]*alpha_vdim[71][l]+f[8][l]*alpha_vdim[70][l]+f[18][l]*alpha_vdim[68][l]+f[1][l]*alpha_vdim[67][l]+f[16][l]*alpha_vdim[66][l]+f[3][l]*alpha_vdim[65][l]+f[7][l]*alpha_vdim[64][l]+alpha_vdim[10][l]*f[28][l]+alpha_vdim[17][l]*f[24][l]+alpha_vdim[4][l]*f[23][l]+alpha_vdim[2][l]*f[20][l]+f[2][l]*alpha_vdim[20][l]+alpha_vdim[9][l]*f[15][l]+alpha_cdim[0][l]*f[14][l]+alpha_vdim[6][l]*f[13][l]+f[6][l]*alpha_vdim[13][l]+alpha_vdim[0][l]*f[12][l]+f[0][l]*alpha_vdim[12][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[5][l]+f[1][l]*alpha_vdim[5][l]);
+    out[22][l] += 0.3061862178478971*(f[18][l]*alpha_vdim[81][l]+f[1][l]*alpha_vdim[80][l]+f[11][l]*alpha_vdim[74][l]+f[26][l]*alpha_vdim[73][l]+f[0][l]*alpha_vdim[72][l]+f[6][l]*alpha_vdim[71][l]+f[7][l]*alpha_vdim[70][l]+f[19][l]*alpha_vdim[68][l]+f[2][l]*alpha_vdim[67][l]+f[3][l]*alpha_vdim[66][l]+f[16][l]*alpha_vdim[65][l]+f[8][l]*alpha_vdim[64][l]+f[25][l]*alpha_cdim[36][l]+f[14][l]*alpha_cdim[32][l]+alpha_vdim[9][l]*f[28][l]+alpha_vdim[4][l]*f[24][l]+alpha_vdim[17][l]*f[23][l]+alpha_vdim[1][l]*f[20][l]+f[1][l]*alpha_vdim[20][l]+alpha_vdim[10][l]*f[15][l]+alpha_vdim[0][l]*f[13][l]+f[0][l]*alpha_vdim[13][l]+alpha_vdim[6][l]*f[12][l]+f[6][l]*alpha_vdim[12][l]+alpha_vdim[2][l]*f[5][l]+f[2][l]*alpha_vdim[5][l]);
+    out[23][l] += 0.3061862178478971*(f[2][l]*alpha_vdim[81][l]+f[19][l]*alpha_vdim[80][l]+f[6][l]*alpha_vdim[74][l]+f[0][l]*alpha_vdim[73][l]+f[26][l]*alpha_vdim[72][l]+f[11][l]*alpha_vdim[71][l]+f[10][l]*alpha_vdim[70][l]+f[1][l]*alpha_vdim[68][l]+f[18][l]*alpha_vdim[67][l]+f[17][l]*alpha_vdim[66][l]+f[4][l]*alpha_vdim[65][l]+f[9][l]*alpha_vdim[64][l]+f[2][l]*alpha_vdim[52][l]+f[22][l]*alpha_vdim[48][l]+f[6][l]*alpha_vdim[45][l]+f[0][l]*alpha_vdim[44][l]+f[27][l]*alpha_vdim[40][l]+f[14][l]*alpha_vdim[39][l]+f[13][l]*alpha_vdim[38][l]+f[1][l]*alpha_vdim[37][l]+f[21][l]*alpha_vdim[35][l]+f[20][l]*alpha_vdim[34][l]+f[5][l]*alpha_vdim[33][l]+f[12][l]*alpha_vdim[32][l]+alpha_cdim[3][l]*f[25][l]+alpha_cdim[0][l]*f[15][l]);
+    out[24][l] += 0.3061862178478971*(f[1][l]*alpha_vdim[81][l]+f[18][l]*alpha_vdim[80][l]+f[0][l]*alpha_vdim[74][l]+f[6][l]*alpha_vdim[73][l]+f[11][l]*alpha_vdim[72][l]+f[26][l]*alpha_vdim[71][l]+f[9][l]*alpha_vdim[70][l]+f[2][l]*alpha_vdim[68][l]+f[19][l]*alpha_vdim[67][l]+f[4][l]*alpha_vdim[66][l]+f[17][l]*alpha_vdim[65][l]+f[10][l]*alpha_vdim[64][l]+f[1][l]*alpha_vdim[52][l]+f[21][l]*alpha_vdim[48][l]+f[0][l]*alpha_vdim[45][l]+f[6][l]*alpha_vdim[44][l]+f[14][l]*alpha_vdim[40][l]+f[27][l]*alpha_vdim[39][l]+f[12][l]*alpha_vdim[38][l]+f[2][l]*alpha_vdim[37][l]+f[5][l]*alpha_cdim[36][l]+f[22][l]*alpha_vdim[35][l]+f[5][l]*alpha_vdim[34][l]+f[20][l]*alpha_vdim[33][l]+f[13][l]*alpha_vdim[32][l]+f[15][l]*alpha_cdim[32][l]);
+    out[25][l] += 0.3061862178478971*(f[16][l]*alpha_vdim[81][l]+f[17][l]*alpha_vdim[80][l]+f[8][l]*alpha_vdim[74][l]+f[7][l]*alpha_vdim[73][l]+f[10][l]*alpha_vdim[72][l]+f[9][l]*alpha_vdim[71][l]+f[26][l]*alpha_vdim[70][l]+f[3][l]*alpha_vdim[68][l]+f[4][l]*alpha_vdim[67][l]+f[19][l]*alpha_vdim[66][l]+f[18][l]*alpha_vdim[65][l]+f[11][l]*alpha_vdim[64][l]+f[16][l]*alpha_vdim[52][l]+f[20][l]*alpha_vdim[48][l]+f[8][l]*alpha_vdim[45][l]+f[7][l]*alpha_vdim[44][l]+f[13][l]*alpha_vdim[40][l]+f[12][l]*alpha_vdim[39][l]+f[27][l]*alpha_vdim[38][l]+f[3][l]*alpha_vdim[37][l]+f[5][l]*alpha_vdim[35][l]+f[22][l]*alpha_vdim[34][l]+f[21][l]*alpha_vdim[33][l]+f[14][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[28][l]+alpha_vdim[2][l]*f[24][l]+alpha_vdim[1][l]*f[23][l]+alpha_vdim[17][l]*f[20][l]+f[17][l]*alpha_vdim[20][l]+alpha_vdim[0][l]*f[15][l]+alpha_vdim[10][l]*f[13][l]+f[10][l]*alpha_vdim[13][l]+alpha_vdim[9][l]*f[12][l]+f[9][l]*alpha_vdim[12][l]+alpha_vdim[4][l]*f[5][l]+f[4][l]*alpha_vdim[5][l]);
+    out[26][l] += 0.3061862178478971*(f[14][l]*alpha_vdim[52][l]+f[0][l]*alpha_vdim[48][l]+f[21][l]*alpha_vdim[45][l]+f[22][l]*alpha_vdim[44][l]+f[1][l]*alpha_vdim[40][l]+f[2][l]*alpha_vdim[39][l]+f[3][l]*alpha_vdim[38][l]+f[27][l]*alpha_vdim[37][l]+f[7][l]*alpha_cdim[36][l]+f[6][l]*alpha_vdim[35][l]+f[7][l]*alpha_vdim[34][l]+f[8][l]*alpha_vdim[33][l]+f[16][l]*alpha_vdim[32][l]+f[18][l]*alpha_cdim[32][l]+alpha_vdim[5][l]*f[28][l]+alpha_vdim[12][l]*f[24][l]+alpha_vdim[13][l]*f[23][l]+f[15][l]*alpha_vdim[20][l]+alpha_cdim[0][l]*f[19][l]+alpha_vdim[0][l]*f[17][l]+f[0][l]*alpha_vdim[17][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[10][l]+f[1][l]*alpha_vdim[10][l]+alpha_vdim[2][l]*f[9][l]+f[2][l]*alpha_vdim[9][l]+alpha_vdim[4][l]*f[6][l]+f[4][l]*alpha_vdim[6][l]);
+    out[27][l] += 0.3061862178478971*(f[11][l]*alpha_vdim[81][l]+f[0][l]*alpha_vdim[80][l]+f[18][l]*alpha_vdim[74][l]+f[19][l]*alpha_vdim[73][l]+f[1][l]*alpha_vdim[72][l]+f[2][l]*alpha_vdim[71][l]+f[3][l]*alpha_vdim[70][l]+f[26][l]*alpha_vdim[68][l]+f[6][l]*alpha_vdim[67][l]+f[7][l]*alpha_vdim[66][l]+f[8][l]*alpha_vdim[65][l]+f[16][l]*alpha_vdim[64][l]+f[29][l]*alpha_cdim[36][l]+f[21][l]*alpha_cdim[32][l]+alpha_vdim[4][l]*f[28][l]+alpha_vdim[9][l]*f[24][l]+alpha_vdim[10][l]*f[23][l]+alpha_cdim[0][l]*f[22][l]+alpha_vdim[0][l]*f[20][l]+f[0][l]*alpha_vdim[20][l]+f[15][l]*alpha_vdim[17][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[13][l]+f[1][l]*alpha_vdim[13][l]+alpha_vdim[2][l]*f[12][l]+f[2][l]*alpha_vdim[12][l]+alpha_vdim[5][l]*f[6][l]+f[5][l]*alpha_vdim[6][l]);
+    out[28][l] += 0.3061862178478971*(f[0][l]*alpha_vdim[81][l]+f[11][l]*alpha_vdim[80][l]+f[1][l]*alpha_vdim[74][l]+f[2][l]*alpha_vdim[73][l]+f[18][l]*alpha_vdim[72][l]+f[19][l]*alpha_vdim[71][l]+f[4][l]*alpha_vdim[70][l]+f[6][l]*alpha_vdim[68][l]+f[26][l]*alpha_vdim[67][l]+f[9][l]*alpha_vdim[66][l]+f[10][l]*alpha_vdim[65][l]+f[17][l]*alpha_vdim[64][l]+f[0][l]*alpha_vdim[52][l]+f[14][l]*alpha_vdim[48][l]+f[1][l]*alpha_vdim[45][l]+f[2][l]*alpha_vdim[44][l]+f[21][l]*alpha_vdim[40][l]+f[22][l]*alpha_vdim[39][l]+f[5][l]*alpha_vdim[38][l]+f[6][l]*alpha_vdim[37][l]+f[12][l]*alpha_cdim[36][l]+f[27][l]*alpha_vdim[35][l]+f[12][l]*alpha_vdim[34][l]+f[13][l]*alpha_vdim[33][l]+f[20][l]*alpha_vdim[32][l]+f[23][l]*alpha_cdim[32][l]+alpha_cdim[3][l]*f[30][l]+alpha_cdim[0][l]*f[24][l]);
+    out[29][l] += 0.3061862178478971*(f[8][l]*alpha_vdim[81][l]+f[10][l]*alpha_vdim[80][l]+f[16][l]*alpha_vdim[74][l]+f[3][l]*alpha_vdim[73][l]+f[17][l]*alpha_vdim[72][l]+f[4][l]*alpha_vdim[71][l]+f[19][l]*alpha_vdim[70][l]+f[7][l]*alpha_vdim[68][l]+f[9][l]*alpha_vdim[67][l]+f[26][l]*alpha_vdim[66][l]+f[11][l]*alpha_vdim[65][l]+f[18][l]*alpha_vdim[64][l]+f[8][l]*alpha_vdim[52][l]+f[13][l]*alpha_vdim[48][l]+f[16][l]*alpha_vdim[45][l]+f[3][l]*alpha_vdim[44][l]+f[20][l]*alpha_vdim[40][l]+f[5][l]*alpha_vdim[39][l]+f[22][l]*alpha_vdim[38][l]+f[7][l]*alpha_vdim[37][l]+f[12][l]*alpha_vdim[35][l]+f[27][l]*alpha_vdim[34][l]+f[14][l]*alpha_vdim[33][l]+f[21][l]*alpha_vdim[32][l]+alpha_vdim[2][l]*f[28][l]+alpha_cdim[0][l]*f[25][l]+alpha_vdim[6][l]*f[24][l]+alpha_vdim[0][l]*f[23][l]+alpha_vdim[10][l]*f[20][l]+f[10][l]*alpha_vdim[20][l]+alpha_vdim[13][l]*f[17][l]+f[13][l]*alpha_vdim[17][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[15][l]+alpha_vdim[4][l]*f[12][l]+f[4][l]*alpha_vdim[12][l]+alpha_vdim[5][l]*f[9][l]+f[5][l]*alpha_vdim[9][l]);
+    out[30][l] += 0.3061862178478971*(f[7][l]*alpha_vdim[81][l]+f[9][l]*alpha_vdim[80][l]+f[3][l]*alpha_vdim[74][l]+f[16][l]*alpha_vdim[73][l]+f[4][l]*alpha_vdim[72][l]+f[17][l]*alpha_vdim[71][l]+f[18][l]*alpha_vdim[70][l]+f[8][l]*alpha_vdim[68][l]+f[10][l]*alpha_vdim[67][l]+f[11][l]*alpha_vdim[66][l]+f[26][l]*alpha_vdim[65][l]+f[19][l]*alpha_vdim[64][l]+f[7][l]*alpha_vdim[52][l]+f[12][l]*alpha_vdim[48][l]+f[3][l]*alpha_vdim[45][l]+f[16][l]*alpha_vdim[44][l]+f[5][l]*alpha_vdim[40][l]+f[20][l]*alpha_vdim[39][l]+f[21][l]*alpha_vdim[38][l]+f[8][l]*alpha_vdim[37][l]+f[14][l]*alpha_cdim[36][l]+f[13][l]*alpha_vdim[35][l]+f[14][l]*alpha_vdim[34][l]+f[27][l]*alpha_vdim[33][l]+f[22][l]*alpha_vdim[32][l]+f[25][l]*alpha_cdim[32][l]+alpha_vdim[1][l]*f[28][l]+alpha_vdim[0][l]*f[24][l]+alpha_vdim[6][l]*f[23][l]+alpha_vdim[9][l]*f[20][l]+f[9][l]*alpha_vdim[20][l]+alpha_vdim[12][l]*f[17][l]+f[12][l]*alpha_vdim[17][l]+alpha_vdim[2][l]*f[15][l]+alpha_vdim[4][l]*f[13][l]+f[4][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*f[10][l]+f[5][l]*alpha_vdim[10][l]);
+    out[31][l] += 0.3061862178478971*(f[3][l]*alpha_vdim[81][l]+f[4][l]*alpha_vdim[80][l]+f[7][l]*alpha_vdim[74][l]+f[8][l]*alpha_vdim[73][l]+f[9][l]*alpha_vdim[72][l]+f[10][l]*alpha_vdim[71][l]+f[11][l]*alpha_vdim[70][l]+f[16][l]*alpha_vdim[68][l]+f[17][l]*alpha_vdim[67][l]+f[18][l]*alpha_vdim[66][l]+f[19][l]*alpha_vdim[65][l]+f[26][l]*alpha_vdim[64][l]+f[3][l]*alpha_vdim[52][l]+f[5][l]*alpha_vdim[48][l]+f[7][l]*alpha_vdim[45][l]+f[8][l]*alpha_vdim[44][l]+f[12][l]*alpha_vdim[40][l]+f[13][l]*alpha_vdim[39][l]+f[14][l]*alpha_vdim[38][l]+f[16][l]*alpha_vdim[37][l]+f[21][l]*alpha_cdim[36][l]+f[20][l]*alpha_vdim[35][l]+f[21][l]*alpha_vdim[34][l]+f[22][l]*alpha_vdim[33][l]+f[27][l]*alpha_vdim[32][l]+f[29][l]*alpha_cdim[32][l]+alpha_cdim[0][l]*f[30][l]+alpha_vdim[0][l]*f[28][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[24][l]+alpha_vdim[2][l]*f[23][l]+alpha_vdim[4][l]*f[20][l]+f[4][l]*alpha_vdim[20][l]+alpha_vdim[5][l]*f[17][l]+f[5][l]*alpha_vdim[17][l]+alpha_vdim[6][l]*f[15][l]+alpha_vdim[9][l]*f[13][l]+f[9][l]*alpha_vdim[13][l]+alpha_vdim[10][l]*f[12][l]+f[10][l]*alpha_vdim[12][l]);
+
+    cfl[l] = cflFreq_mid;
+  } 
+} 
@@ -0,0 +1,379 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_vol_2x3v_tensor_p2(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_vol_2x3v_tensor_p2: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // field:      q/m*EM fields.
+  // cot_vec:   Only used in gen geo.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv0dx0 = dxv[2]/dxv[0];
+  double dv1dx1 = dxv[3]/dxv[1];
+  const double dv10 = 2/dxv[2];
+  const double *E0 = &field[0];
+  const double dv11 = 2/dxv[3];
+  const double *E1 = &field[9];
+  const double dv12 = 2/dxv[4];
+  const double *E2 = &field[18];
+  const double *B0 = &field[27];
+  const double *B1 = &field[36];
+  const double *B2 = &field[45];
+
+  double alpha_cdim[486][GKYL_VLASOV_BATCH] = {{0.0}};
+  double alpha_vdim[729][GKYL_VLASOV_BATCH] = {{0.0}};
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w0dx0 = w[2][l]/dxv[0];
+    double w1dx1 = w[3][l]/dxv[1];
+    const double dv1 = dxv[2], wv1 = w[2][l];
+    const double dv2 = dxv[3], wv2 = w[3][l];
+    const double dv3 = dxv[4], wv3 = w[4][l];
+
+    double cflFreq_mid = 0.0;
+
+    alpha_cdim[0][l] = 11.31370849898477*w0dx0;
+    alpha_cdim[3][l] = 3.265986323710906*dv0dx0;
+    cflFreq_mid += 5.0*(fabs(w0dx0)+0.5*dv0dx0);
+
+    alpha_cdim[243][l] = 11.31370849898477*w1dx1;
+    alpha_cdim[247][l] = 3.265986323710906*dv1dx1;
+    cflFreq_mid += 5.0*(fabs(w1dx1)+0.5*dv1dx1);
+
+    alpha_vdim[0][l] = dv10*(2.828427124746191*(B2[0]*wv2+E0[0])-2.828427124746191*B1[0]*wv3);
+    alpha_vdim[1][l] = dv10*(2.828427124746191*(B2[1]*wv2+E0[1])-2.828427124746191*B1[1]*wv3);
+    alpha_vdim[2][l] = dv10*(2.828427124746191*(B2[2]*wv2+E0[2])-2.828427124746191*B1[2]*wv3);
+    alpha_vdim[4][l] = 0.8164965809277261*B2[0]*dv10*dv2;
+    alpha_vdim[5][l] = -0.8164965809277261*B1[0]*dv10*dv3;
+    alpha_vdim[6][l] = dv10*(2.828427124746191*(B2[3]*wv2+E0[3])-2.828427124746191*B1[3]*wv3);
+    alpha_vdim[9][l] = 0.8164965809277261*B2[1]*dv10*dv2;
+    alpha_vdim[10][l] = 0.8164965809277261*B2[2]*dv10*dv2;
+    alpha_vdim[12][l] = -0.8164965809277261*B1[1]*dv10*dv3;
+    alpha_vdim[13][l] = -0.8164965809277261*B1[2]*dv10*dv3;
+    alpha_vdim[16][l] = dv10*(2.828427124746191*(B2[4]*wv2+E0[4])-2.828427124746191*B1[4]*wv3);
+    alpha_vdim[17][l] = dv10*(2.828427124746191*(B2[5]*wv2+E0[5])-2.828427124746191*B1[5]*wv3);
+    alpha_vdim[22][l] = 0.8164965809277261*B2[3]*dv10*dv2;
+    alpha_vdim[25][l] = -0.8164965809277261*B1[3]*dv10*dv3;
+    alpha_vdim[31][l] = dv10*(2.828427124746191*(B2[6]*wv2+E0[6])-2.828427124746191*B1[6]*wv3);
+    alpha_vdim[32][l] = dv10*(2.828427124746191*(B2[7]*wv2+E0[7])-2.828427124746191*B1[7]*wv3);
+    alpha_vdim[37][l] = 0.8164965809277261*B2[4]*dv10*dv2;
+    alpha_vdim[38][l] = 0.8164965809277261*B2[5]*dv10*dv2;
+    alpha_vdim[43][l] = -0.8164965809277261*B1[4]*dv10*dv3;
+    alpha_vdim[44][l] = -0.8164965809277261*B1[5]*dv10*dv3;
+    alpha_vdim[59][l] = 0.8164965809277261*B2[6]*dv10*dv2;
+    alpha_vdim[60][l] = 0.8164965809277261*B2[7]*dv10*dv2;
+    alpha_vdim[68][l] = -0.8164965809277261*B1[6]*dv10*dv3;
+    alpha_vdim[69][l] = -0.8164965809277261*B1[7]*dv10*dv3;
+    alpha_vdim[86][l] = dv10*(2.828427124746191*(B2[8]*wv2+E0[8])-2.828427124746191*B1[8]*wv3);
+    alpha_vdim[120][l] = 0.8164965809277261*B2[8]*dv10*dv2;
+    alpha_vdim[129][l] = -0.8164965809277261*B1[8]*dv10*dv3;
+    cflFreq_mid += 5.0*fabs(0.110485434560398*alpha_vdim[86][l]-0.09882117688026182*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.0883883476483184*alpha_vdim[0][l]);
+
+    alpha_vdim[243][l] = dv11*(2.828427124746191*B0[0]*wv3-2.828427124746191*B2[0]*wv1+2.828427124746191*E1[0]);
+    alpha_vdim[244][l] = dv11*(2.828427124746191*B0[1]*wv3-2.828427124746191*B2[1]*wv1+2.828427124746191*E1[1]);
+    alpha_vdim[245][l] = dv11*(2.828427124746191*B0[2]*wv3-2.828427124746191*B2[2]*wv1+2.828427124746191*E1[2]);
+    alpha_vdim[246][l] = -0.8164965809277261*B2[0]*dv1*dv11;
+    alpha_vdim[248][l] = 0.8164965809277261*B0[0]*dv11*dv3;
+    alpha_vdim[249][l] = dv11*(2.828427124746191*B0[3]*wv3-2.828427124746191*B2[3]*wv1+2.828427124746191*E1[3]);
+    alpha_vdim[250][l] = -0.8164965809277261*B2[1]*dv1*dv11;
+    alpha_vdim[251][l] = -0.8164965809277261*B2[2]*dv1*dv11;
+    alpha_vdim[255][l] = 0.8164965809277261*B0[1]*dv11*dv3;
+    alpha_vdim[256][l] = 0.8164965809277261*B0[2]*dv11*dv3;
+    alpha_vdim[259][l] = dv11*(2.828427124746191*B0[4]*wv3-2.828427124746191*B2[4]*wv1+2.828427124746191*E1[4]);
+    alpha_vdim[260][l] = dv11*(2.828427124746191*B0[5]*wv3-2.828427124746191*B2[5]*wv1+2.828427124746191*E1[5]);
+    alpha_vdim[264][l] = -0.8164965809277261*B2[3]*dv1*dv11;
+    alpha_vdim[268][l] = 0.8164965809277261*B0[3]*dv11*dv3;
+    alpha_vdim[274][l] = dv11*(2.828427124746191*B0[6]*wv3-2.828427124746191*B2[6]*wv1+2.828427124746191*E1[6]);
+    alpha_vdim[275][l] = dv11*(2.828427124746191*B0[7]*wv3-2.828427124746191*B2[7]*wv1+2.828427124746191*E1[7]);
+    alpha_vdim[276][l] = -0.8164965809277261*B2[4]*dv1*dv11;
+    alpha_vdim[277][l] = -0.8164965809277261*B2[5]*dv1*dv11;
+    alpha_vdim[286][l] = 0.8164965809277261*B0[4]*dv11*dv3;
+    alpha_vdim[287][l] = 0.8164965809277261*B0[5]*dv11*dv3;
+    alpha_vdim[299][l] = -0.8164965809277261*B2[6]*dv1*dv11;
+    alpha_vdim[300][l] = -0.8164965809277261*B2[7]*dv1*dv11;
+    alpha_vdim[311][l] = 0.8164965809277261*B0[6]*dv11*dv3;
+    alpha_vdim[312][l] = 0.8164965809277261*B0[7]*dv11*dv3;
+    alpha_vdim[329][l] = dv11*(2.828427124746191*B0[8]*wv3-2.828427124746191*B2[8]*wv1+2.828427124746191*E1[8]);
+    alpha_vdim[360][l] = -0.8164965809277261*B2[8]*dv1*dv11;
+    alpha_vdim[372][l] = 0.8164965809277261*B0[8]*dv11*dv3;
+    cflFreq_mid += 5.0*fabs(0.110485434560398*alpha_vdim[329][l]-0.09882117688026182*(alpha_vdim[260][l]+alpha_vdim[259][l])+0.0883883476483184*alpha_vdim[243][l]);
+
+    alpha_vdim[486][l] = dv12*(2.828427124746191*(B1[0]*wv1+E2[0])-2.828427124746191*B0[0]*wv2);
+    alpha_vdim[487][l] = dv12*(2.828427124746191*(B1[1]*wv1+E2[1])-2.828427124746191*B0[1]*wv2);
+    alpha_vdim[488][l] = dv12*(2.828427124746191*(B1[2]*wv1+E2[2])-2.828427124746191*B0[2]*wv2);
+    alpha_vdim[489][l] = 0.8164965809277261*B1[0]*dv1*dv12;
+    alpha_vdim[490][l] = -0.8164965809277261*B0[0]*dv12*dv2;
+    alpha_vdim[492][l] = dv12*(2.828427124746191*(B1[3]*wv1+E2[3])-2.828427124746191*B0[3]*wv2);
+    alpha_vdim[493][l] = 0.8164965809277261*B1[1]*dv1*dv12;
+    alpha_vdim[494][l] = 0.8164965809277261*B1[2]*dv1*dv12;
+    alpha_vdim[495][l] = -0.8164965809277261*B0[1]*dv12*dv2;
+    alpha_vdim[496][l] = -0.8164965809277261*B0[2]*dv12*dv2;
+    alpha_vdim[502][l] = dv12*(2.828427124746191*(B1[4]*wv1+E2[4])-2.828427124746191*B0[4]*wv2);
+    alpha_vdim[503][l] = dv12*(2.828427124746191*(B1[5]*wv1+E2[5])-2.828427124746191*B0[5]*wv2);
+    alpha_vdim[507][l] = 0.8164965809277261*B1[3]*dv1*dv12;
+    alpha_vdim[508][l] = -0.8164965809277261*B0[3]*dv12*dv2;
+    alpha_vdim[517][l] = dv12*(2.828427124746191*(B1[6]*wv1+E2[6])-2.828427124746191*B0[6]*wv2);
+    alpha_vdim[518][l] = dv12*(2.828427124746191*(B1[7]*wv1+E2[7])-2.828427124746191*B0[7]*wv2);
+    alpha_vdim[519][l] = 0.8164965809277261*B1[4]*dv1*dv12;
+    alpha_vdim[520][l] = 0.8164965809277261*B1[5]*dv1*dv12;
+    alpha_vdim[523][l] = -0.8164965809277261*B0[4]*dv12*dv2;
+    alpha_vdim[524][l] = -0.8164965809277261*B0[5]*dv12*dv2;
+    alpha_vdim[542][l] = 0.8164965809277261*B1[6]*dv1*dv12;
+    alpha_vdim[543][l] = 0.8164965809277261*B1[7]*dv1*dv12;
+    alpha_vdim[545][l] = -0.8164965809277261*B0[6]*dv12*dv2;
+    alpha_vdim[546][l] = -0.8164965809277261*B0[7]*dv12*dv2;
+    alpha_vdim[572][l] = dv12*(2.828427124746191*(B1[8]*wv1+E2[8])-2.828427124746191*B0[8]*wv2);
+    alpha_vdim[603][l] = 0.8164965809277261*B1[8]*dv1*dv12;
+    alpha_vdim[606][l] = -0.8164965809277261*B0[8]*dv12*dv2;
+    cflFreq_mid += 5.0*fabs(0.110485434560398*alpha_vdim[572][l]-0.09882117688026182*(alpha_vdim[503][l]+alpha_vdim[502][l])+0.0883883476483184*alpha_vdim[486][l]);
+
+    out[1][l] += 0.3061862178478971*(alpha_cdim[3][l]*f[3][l]+alpha_cdim[0][l]*f[0][l]);
+    out[2][l] += 0.3061862178478971*(f[4][l]*alpha_cdim[247][l]+f[0][l]*alpha_cdim[243][l]);
+    out[3][l] += 0.3061862178478971*(alpha_vdim[129][l]*f[129][l]+alpha_vdim[120][l]*f[120][l]+alpha_vdim[86][l]*f[86][l]+alpha_vdim[69][l]*f[69][l]+alpha_vdim[68][l]*f[68][l]+alpha_vdim[60][l]*f[60][l]+alpha_vdim[59][l]*f[59][l]+alpha_vdim[44][l]*f[44][l]+alpha_vdim[43][l]*f[43][l]+alpha_vdim[38][l]*f[38][l]+alpha_vdim[37][l]*f[37][l]+alpha_vdim[32][l]*f[32][l]+alpha_vdim[31][l]*f[31][l]+alpha_vdim[25][l]*f[25][l]+alpha_vdim[22][l]*f[22][l]+alpha_vdim[17][l]*f[17][l]+alpha_vdim[16][l]*f[16][l]+alpha_vdim[13][l]*f[13][l]+alpha_vdim[12][l]*f[12][l]+alpha_vdim[10][l]*f[10][l]+alpha_vdim[9][l]*f[9][l]+alpha_vdim[6][l]*f[6][l]+alpha_vdim[5][l]*f[5][l]+alpha_vdim[4][l]*f[4][l]+alpha_vdim[2][l]*f[2][l]+alpha_vdim[1][l]*f[1][l]+alpha_vdim[0][l]*f[0][l]);
+    out[4][l] += 0.3061862178478971*(f[129][l]*alpha_vdim[372][l]+f[117][l]*alpha_vdim[360][l]+f[86][l]*alpha_vdim[329][l]+f[69][l]*alpha_vdim[312][l]+f[68][l]*alpha_vdim[311][l]+f[57][l]*alpha_vdim[300][l]+f[56][l]*alpha_vdim[299][l]+f[44][l]*alpha_vdim[287][l]+f[43][l]*alpha_vdim[286][l]+f[34][l]*alpha_vdim[277][l]+f[33][l]*alpha_vdim[276][l]+f[32][l]*alpha_vdim[275][l]+f[31][l]*alpha_vdim[274][l]+f[25][l]*alpha_vdim[268][l]+f[21][l]*alpha_vdim[264][l]+f[17][l]*alpha_vdim[260][l]+f[16][l]*alpha_vdim[259][l]+f[13][l]*alpha_vdim[256][l]+f[12][l]*alpha_vdim[255][l]+f[8][l]*alpha_vdim[251][l]+f[7][l]*alpha_vdim[250][l]+f[6][l]*alpha_vdim[249][l]+f[5][l]*alpha_vdim[248][l]+f[3][l]*alpha_vdim[246][l]+f[2][l]*alpha_vdim[245][l]+f[1][l]*alpha_vdim[244][l]+f[0][l]*alpha_vdim[243][l]);
+    out[5][l] += 0.3061862178478971*(f[120][l]*alpha_vdim[606][l]+f[117][l]*alpha_vdim[603][l]+f[86][l]*alpha_vdim[572][l]+f[60][l]*alpha_vdim[546][l]+f[59][l]*alpha_vdim[545][l]+f[57][l]*alpha_vdim[543][l]+f[56][l]*alpha_vdim[542][l]+f[38][l]*alpha_vdim[524][l]+f[37][l]*alpha_vdim[523][l]+f[34][l]*alpha_vdim[520][l]+f[33][l]*alpha_vdim[519][l]+f[32][l]*alpha_vdim[518][l]+f[31][l]*alpha_vdim[517][l]+f[22][l]*alpha_vdim[508][l]+f[21][l]*alpha_vdim[507][l]+f[17][l]*alpha_vdim[503][l]+f[16][l]*alpha_vdim[502][l]+f[10][l]*alpha_vdim[496][l]+f[9][l]*alpha_vdim[495][l]+f[8][l]*alpha_vdim[494][l]+f[7][l]*alpha_vdim[493][l]+f[6][l]*alpha_vdim[492][l]+f[4][l]*alpha_vdim[490][l]+f[3][l]*alpha_vdim[489][l]+f[2][l]*alpha_vdim[488][l]+f[1][l]*alpha_vdim[487][l]+f[0][l]*alpha_vdim[486][l]);
+    out[6][l] += 0.3061862178478971*(f[9][l]*alpha_cdim[247][l]+f[1][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[8][l]+alpha_cdim[0][l]*f[2][l]);
+    out[7][l] += 0.273861278752583*(alpha_vdim[69][l]*f[129][l]+f[69][l]*alpha_vdim[129][l]+alpha_vdim[60][l]*f[120][l]+f[60][l]*alpha_vdim[120][l]+alpha_vdim[32][l]*f[86][l]+f[32][l]*alpha_vdim[86][l])+0.3061862178478971*(alpha_vdim[44][l]*f[69][l]+f[44][l]*alpha_vdim[69][l])+0.273861278752583*(alpha_vdim[25][l]*f[68][l]+f[25][l]*alpha_vdim[68][l])+0.3061862178478971*(alpha_vdim[38][l]*f[60][l]+f[38][l]*alpha_vdim[60][l])+0.273861278752583*(alpha_vdim[22][l]*f[59][l]+f[22][l]*alpha_vdim[59][l]+alpha_vdim[12][l]*f[43][l]+f[12][l]*alpha_vdim[43][l]+alpha_vdim[9][l]*f[37][l]+f[9][l]*alpha_vdim[37][l])+0.3061862178478971*(alpha_vdim[17][l]*f[32][l]+f[17][l]*alpha_vdim[32][l])+0.273861278752583*(alpha_vdim[6][l]*f[31][l]+f[6][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[13][l]*f[25][l]+f[13][l]*alpha_vdim[25][l]+alpha_vdim[10][l]*f[22][l]+f[10][l]*alpha_vdim[22][l])+0.273861278752583*(alpha_cdim[3][l]*f[18][l]+alpha_vdim[1][l]*f[16][l]+f[1][l]*alpha_vdim[16][l])+0.3061862178478971*(alpha_vdim[5][l]*f[12][l]+f[5][l]*alpha_vdim[12][l]+alpha_vdim[4][l]*f[9][l]+f[4][l]*alpha_vdim[9][l]+alpha_vdim[2][l]*f[6][l]+f[2][l]*alpha_vdim[6][l]+alpha_cdim[0][l]*f[3][l]+f[0][l]*alpha_cdim[3][l]+alpha_vdim[0][l]*f[1][l]+f[0][l]*alpha_vdim[1][l]);
+    out[8][l] += 0.3061862178478971*(f[11][l]*alpha_cdim[247][l]+f[3][l]*alpha_cdim[243][l])+0.273861278752583*(alpha_vdim[68][l]*f[129][l]+f[68][l]*alpha_vdim[129][l]+alpha_vdim[59][l]*f[120][l]+f[59][l]*alpha_vdim[120][l]+alpha_vdim[31][l]*f[86][l]+f[31][l]*alpha_vdim[86][l]+alpha_vdim[25][l]*f[69][l]+f[25][l]*alpha_vdim[69][l])+0.3061862178478971*(alpha_vdim[43][l]*f[68][l]+f[43][l]*alpha_vdim[68][l])+0.273861278752583*(alpha_vdim[22][l]*f[60][l]+f[22][l]*alpha_vdim[60][l])+0.3061862178478971*(alpha_vdim[37][l]*f[59][l]+f[37][l]*alpha_vdim[59][l])+0.273861278752583*(alpha_vdim[13][l]*f[44][l]+f[13][l]*alpha_vdim[44][l]+alpha_vdim[10][l]*f[38][l]+f[10][l]*alpha_vdim[38][l]+alpha_vdim[6][l]*f[32][l]+f[6][l]*alpha_vdim[32][l])+0.3061862178478971*(alpha_vdim[16][l]*f[31][l]+f[16][l]*alpha_vdim[31][l]+alpha_vdim[12][l]*f[25][l]+f[12][l]*alpha_vdim[25][l]+alpha_vdim[9][l]*f[22][l]+f[9][l]*alpha_vdim[22][l])+0.273861278752583*(alpha_vdim[2][l]*f[17][l]+f[2][l]*alpha_vdim[17][l])+0.3061862178478971*(alpha_vdim[5][l]*f[13][l]+f[5][l]*alpha_vdim[13][l]+alpha_vdim[4][l]*f[10][l]+f[4][l]*alpha_vdim[10][l]+alpha_vdim[1][l]*f[6][l]+f[1][l]*alpha_vdim[6][l]+alpha_vdim[0][l]*f[2][l]+f[0][l]*alpha_vdim[2][l]);
+    out[9][l] += 0.273861278752583*(f[69][l]*alpha_vdim[372][l]+f[57][l]*alpha_vdim[360][l]+f[32][l]*alpha_vdim[329][l])+(0.273861278752583*f[129][l]+0.3061862178478971*f[44][l])*alpha_vdim[312][l]+0.273861278752583*f[25][l]*alpha_vdim[311][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[300][l]+0.273861278752583*f[21][l]*alpha_vdim[299][l]+0.3061862178478971*f[69][l]*alpha_vdim[287][l]+0.273861278752583*f[12][l]*alpha_vdim[286][l]+0.3061862178478971*f[57][l]*alpha_vdim[277][l]+0.273861278752583*f[7][l]*alpha_vdim[276][l]+(0.273861278752583*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[275][l]+0.273861278752583*f[6][l]*alpha_vdim[274][l]+(0.273861278752583*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[268][l]+0.273861278752583*f[56][l]*alpha_vdim[264][l]+0.3061862178478971*(f[8][l]*alpha_vdim[264][l]+f[32][l]*alpha_vdim[260][l])+0.273861278752583*f[1][l]*alpha_vdim[259][l]+0.3061862178478971*f[25][l]*alpha_vdim[256][l]+0.273861278752583*f[43][l]*alpha_vdim[255][l]+0.3061862178478971*(f[5][l]*alpha_vdim[255][l]+f[21][l]*alpha_vdim[251][l])+(0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[250][l]+0.273861278752583*f[31][l]*alpha_vdim[249][l]+0.3061862178478971*(f[2][l]*alpha_vdim[249][l]+f[12][l]*alpha_vdim[248][l]+f[7][l]*alpha_vdim[246][l]+f[6][l]*alpha_vdim[245][l])+0.273861278752583*f[16][l]*alpha_vdim[244][l]+0.3061862178478971*(f[0][l]*alpha_vdim[244][l]+f[1][l]*alpha_vdim[243][l]+alpha_cdim[3][l]*f[11][l]+alpha_cdim[0][l]*f[4][l]);
+    out[10][l] += 0.273861278752583*(f[68][l]*alpha_vdim[372][l]+f[56][l]*alpha_vdim[360][l]+f[31][l]*alpha_vdim[329][l]+f[25][l]*alpha_vdim[312][l])+(0.273861278752583*f[129][l]+0.3061862178478971*f[43][l])*alpha_vdim[311][l]+0.273861278752583*f[21][l]*alpha_vdim[300][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[299][l]+0.273861278752583*f[13][l]*alpha_vdim[287][l]+0.3061862178478971*f[68][l]*alpha_vdim[286][l]+0.273861278752583*f[8][l]*alpha_vdim[277][l]+0.3061862178478971*f[56][l]*alpha_vdim[276][l]+0.273861278752583*f[6][l]*alpha_vdim[275][l]+(0.273861278752583*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[274][l]+(0.273861278752583*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[268][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[264][l]+0.273861278752583*f[2][l]*alpha_vdim[260][l]+0.3061862178478971*f[31][l]*alpha_vdim[259][l]+0.273861278752583*f[44][l]*alpha_vdim[256][l]+0.3061862178478971*(f[5][l]*alpha_vdim[256][l]+f[25][l]*alpha_vdim[255][l])+0.273861278752583*f[34][l]*alpha_vdim[251][l]+0.3061862178478971*(f[3][l]*alpha_vdim[251][l]+f[21][l]*alpha_vdim[250][l])+0.273861278752583*f[32][l]*alpha_vdim[249][l]+0.3061862178478971*(f[1][l]*alpha_vdim[249][l]+f[13][l]*alpha_vdim[248][l])+0.273861278752583*f[19][l]*alpha_cdim[247][l]+0.3061862178478971*(f[0][l]*alpha_cdim[247][l]+f[8][l]*alpha_vdim[246][l])+0.273861278752583*f[17][l]*alpha_vdim[245][l]+0.3061862178478971*(f[0][l]*alpha_vdim[245][l]+f[6][l]*alpha_vdim[244][l]+f[2][l]*alpha_vdim[243][l]+f[4][l]*alpha_cdim[243][l]);
+    out[11][l] += 0.3061862178478971*f[158][l]*alpha_vdim[372][l]+0.273861278752583*f[182][l]*alpha_vdim[360][l]+0.3061862178478971*(f[86][l]*alpha_vdim[360][l]+f[117][l]*alpha_vdim[329][l]+f[102][l]*alpha_vdim[312][l]+f[101][l]*alpha_vdim[311][l])+(0.273861278752583*f[119][l]+0.3061862178478971*f[32][l])*alpha_vdim[300][l]+0.273861278752583*f[118][l]*alpha_vdim[299][l]+0.3061862178478971*(f[31][l]*alpha_vdim[299][l]+f[71][l]*alpha_vdim[287][l]+f[70][l]*alpha_vdim[286][l])+(0.273861278752583*f[88][l]+0.3061862178478971*f[17][l])*alpha_vdim[277][l]+0.273861278752583*f[87][l]*alpha_vdim[276][l]+0.3061862178478971*(f[16][l]*alpha_vdim[276][l]+f[57][l]*alpha_vdim[275][l]+f[56][l]*alpha_vdim[274][l]+f[52][l]*alpha_vdim[268][l])+0.273861278752583*f[58][l]*alpha_vdim[264][l]+0.3061862178478971*(f[6][l]*alpha_vdim[264][l]+f[34][l]*alpha_vdim[260][l]+f[33][l]*alpha_vdim[259][l]+f[27][l]*alpha_vdim[256][l]+f[26][l]*alpha_vdim[255][l])+(0.273861278752583*f[36][l]+0.3061862178478971*f[2][l])*alpha_vdim[251][l]+0.273861278752583*f[35][l]*alpha_vdim[250][l]+0.3061862178478971*(f[1][l]*alpha_vdim[250][l]+f[21][l]*alpha_vdim[249][l]+f[14][l]*alpha_vdim[248][l])+0.273861278752583*f[18][l]*alpha_vdim[246][l]+0.3061862178478971*(f[0][l]*alpha_vdim[246][l]+f[8][l]*alpha_vdim[245][l]+f[7][l]*alpha_vdim[244][l]+f[3][l]*alpha_vdim[243][l])+0.273861278752583*alpha_vdim[120][l]*f[183][l]+0.3061862178478971*alpha_vdim[129][l]*f[161][l]+0.273861278752583*(alpha_vdim[60][l]*f[124][l]+alpha_vdim[59][l]*f[123][l])+0.3061862178478971*(alpha_vdim[86][l]*f[120][l]+f[86][l]*alpha_vdim[120][l]+alpha_vdim[69][l]*f[105][l]+alpha_vdim[68][l]*f[104][l])+0.273861278752583*(alpha_vdim[38][l]*f[90][l]+alpha_vdim[37][l]*f[89][l])+0.3061862178478971*(alpha_vdim[44][l]*f[75][l]+alpha_vdim[43][l]*f[74][l])+0.273861278752583*alpha_vdim[22][l]*f[65][l]+0.3061862178478971*(alpha_vdim[32][l]*f[60][l]+f[32][l]*alpha_vdim[60][l]+alpha_vdim[31][l]*f[59][l]+f[31][l]*alpha_vdim[59][l]+alpha_vdim[25][l]*f[53][l])+0.273861278752583*(alpha_vdim[10][l]*f[41][l]+alpha_vdim[9][l]*f[40][l])+0.3061862178478971*(alpha_vdim[17][l]*f[38][l]+f[17][l]*alpha_vdim[38][l]+alpha_vdim[16][l]*f[37][l]+f[16][l]*alpha_vdim[37][l]+alpha_vdim[13][l]*f[29][l]+alpha_vdim[12][l]*f[28][l]+alpha_vdim[6][l]*f[22][l]+f[6][l]*alpha_vdim[22][l])+0.273861278752583*alpha_vdim[4][l]*f[19][l]+0.3061862178478971*(alpha_vdim[5][l]*f[15][l]+alpha_vdim[2][l]*f[10][l]+f[2][l]*alpha_vdim[10][l]+alpha_vdim[1][l]*f[9][l]+f[1][l]*alpha_vdim[9][l]+alpha_vdim[0][l]*f[4][l]+f[0][l]*alpha_vdim[4][l]);
+    out[12][l] += 0.273861278752583*(f[60][l]*alpha_vdim[606][l]+f[57][l]*alpha_vdim[603][l]+f[32][l]*alpha_vdim[572][l])+(0.273861278752583*f[120][l]+0.3061862178478971*f[38][l])*alpha_vdim[546][l]+0.273861278752583*f[22][l]*alpha_vdim[545][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[543][l]+0.273861278752583*f[21][l]*alpha_vdim[542][l]+0.3061862178478971*f[60][l]*alpha_vdim[524][l]+0.273861278752583*f[9][l]*alpha_vdim[523][l]+0.3061862178478971*f[57][l]*alpha_vdim[520][l]+0.273861278752583*f[7][l]*alpha_vdim[519][l]+(0.273861278752583*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[518][l]+0.273861278752583*f[6][l]*alpha_vdim[517][l]+(0.273861278752583*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[508][l]+0.273861278752583*f[56][l]*alpha_vdim[507][l]+0.3061862178478971*(f[8][l]*alpha_vdim[507][l]+f[32][l]*alpha_vdim[503][l])+0.273861278752583*f[1][l]*alpha_vdim[502][l]+0.3061862178478971*f[22][l]*alpha_vdim[496][l]+0.273861278752583*f[37][l]*alpha_vdim[495][l]+0.3061862178478971*(f[4][l]*alpha_vdim[495][l]+f[21][l]*alpha_vdim[494][l])+(0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[493][l]+0.273861278752583*f[31][l]*alpha_vdim[492][l]+0.3061862178478971*(f[2][l]*alpha_vdim[492][l]+f[9][l]*alpha_vdim[490][l]+f[7][l]*alpha_vdim[489][l]+f[6][l]*alpha_vdim[488][l])+0.273861278752583*f[16][l]*alpha_vdim[487][l]+0.3061862178478971*(f[0][l]*alpha_vdim[487][l]+f[1][l]*alpha_vdim[486][l]+alpha_cdim[3][l]*f[14][l]+alpha_cdim[0][l]*f[5][l]);
+    out[13][l] += 0.273861278752583*(f[59][l]*alpha_vdim[606][l]+f[56][l]*alpha_vdim[603][l]+f[31][l]*alpha_vdim[572][l]+f[22][l]*alpha_vdim[546][l])+(0.273861278752583*f[120][l]+0.3061862178478971*f[37][l])*alpha_vdim[545][l]+0.273861278752583*f[21][l]*alpha_vdim[543][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[542][l]+0.273861278752583*f[10][l]*alpha_vdim[524][l]+0.3061862178478971*f[59][l]*alpha_vdim[523][l]+0.273861278752583*f[8][l]*alpha_vdim[520][l]+0.3061862178478971*f[56][l]*alpha_vdim[519][l]+0.273861278752583*f[6][l]*alpha_vdim[518][l]+(0.273861278752583*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[517][l]+(0.273861278752583*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[508][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[507][l]+0.273861278752583*f[2][l]*alpha_vdim[503][l]+0.3061862178478971*f[31][l]*alpha_vdim[502][l]+0.273861278752583*f[38][l]*alpha_vdim[496][l]+0.3061862178478971*(f[4][l]*alpha_vdim[496][l]+f[22][l]*alpha_vdim[495][l])+0.273861278752583*f[34][l]*alpha_vdim[494][l]+0.3061862178478971*(f[3][l]*alpha_vdim[494][l]+f[21][l]*alpha_vdim[493][l])+0.273861278752583*f[32][l]*alpha_vdim[492][l]+0.3061862178478971*(f[1][l]*alpha_vdim[492][l]+f[10][l]*alpha_vdim[490][l]+f[8][l]*alpha_vdim[489][l])+0.273861278752583*f[17][l]*alpha_vdim[488][l]+0.3061862178478971*(f[0][l]*alpha_vdim[488][l]+f[6][l]*alpha_vdim[487][l]+f[2][l]*alpha_vdim[486][l]+f[15][l]*alpha_cdim[247][l]+f[5][l]*alpha_cdim[243][l]);
+    out[14][l] += 0.3061862178478971*f[152][l]*alpha_vdim[606][l]+0.273861278752583*f[182][l]*alpha_vdim[603][l]+0.3061862178478971*(f[86][l]*alpha_vdim[603][l]+f[117][l]*alpha_vdim[572][l]+f[98][l]*alpha_vdim[546][l]+f[97][l]*alpha_vdim[545][l])+(0.273861278752583*f[119][l]+0.3061862178478971*f[32][l])*alpha_vdim[543][l]+0.273861278752583*f[118][l]*alpha_vdim[542][l]+0.3061862178478971*(f[31][l]*alpha_vdim[542][l]+f[62][l]*alpha_vdim[524][l]+f[61][l]*alpha_vdim[523][l])+(0.273861278752583*f[88][l]+0.3061862178478971*f[17][l])*alpha_vdim[520][l]+0.273861278752583*f[87][l]*alpha_vdim[519][l]+0.3061862178478971*(f[16][l]*alpha_vdim[519][l]+f[57][l]*alpha_vdim[518][l]+f[56][l]*alpha_vdim[517][l]+f[51][l]*alpha_vdim[508][l])+0.273861278752583*f[58][l]*alpha_vdim[507][l]+0.3061862178478971*(f[6][l]*alpha_vdim[507][l]+f[34][l]*alpha_vdim[503][l]+f[33][l]*alpha_vdim[502][l]+f[24][l]*alpha_vdim[496][l]+f[23][l]*alpha_vdim[495][l])+(0.273861278752583*f[36][l]+0.3061862178478971*f[2][l])*alpha_vdim[494][l]+0.273861278752583*f[35][l]*alpha_vdim[493][l]+0.3061862178478971*(f[1][l]*alpha_vdim[493][l]+f[21][l]*alpha_vdim[492][l]+f[11][l]*alpha_vdim[490][l])+0.273861278752583*f[18][l]*alpha_vdim[489][l]+0.3061862178478971*(f[0][l]*alpha_vdim[489][l]+f[8][l]*alpha_vdim[488][l]+f[7][l]*alpha_vdim[487][l]+f[3][l]*alpha_vdim[486][l])+0.273861278752583*alpha_vdim[129][l]*f[186][l]+0.3061862178478971*alpha_vdim[120][l]*f[161][l]+0.273861278752583*(alpha_vdim[69][l]*f[136][l]+alpha_vdim[68][l]*f[135][l])+0.3061862178478971*(alpha_vdim[86][l]*f[129][l]+f[86][l]*alpha_vdim[129][l]+alpha_vdim[60][l]*f[105][l]+alpha_vdim[59][l]*f[104][l])+0.273861278752583*(alpha_vdim[44][l]*f[93][l]+alpha_vdim[43][l]*f[92][l]+alpha_vdim[25][l]*f[80][l])+0.3061862178478971*(alpha_vdim[38][l]*f[75][l]+alpha_vdim[37][l]*f[74][l]+alpha_vdim[32][l]*f[69][l]+f[32][l]*alpha_vdim[69][l]+alpha_vdim[31][l]*f[68][l]+f[31][l]*alpha_vdim[68][l]+alpha_vdim[22][l]*f[53][l])+0.273861278752583*(alpha_vdim[13][l]*f[48][l]+alpha_vdim[12][l]*f[47][l])+0.3061862178478971*(alpha_vdim[17][l]*f[44][l]+f[17][l]*alpha_vdim[44][l]+alpha_vdim[16][l]*f[43][l]+f[16][l]*alpha_vdim[43][l]+alpha_vdim[10][l]*f[29][l]+alpha_vdim[9][l]*f[28][l]+alpha_vdim[6][l]*f[25][l]+f[6][l]*alpha_vdim[25][l])+0.273861278752583*alpha_vdim[5][l]*f[20][l]+0.3061862178478971*(alpha_vdim[4][l]*f[15][l]+alpha_vdim[2][l]*f[13][l]+f[2][l]*alpha_vdim[13][l]+alpha_vdim[1][l]*f[12][l]+f[1][l]*alpha_vdim[12][l]+alpha_vdim[0][l]*f[5][l]+f[0][l]*alpha_vdim[5][l]);
+    out[15][l] += 0.273861278752583*f[183][l]*alpha_vdim[606][l]+0.3061862178478971*(f[86][l]*alpha_vdim[606][l]+f[152][l]*alpha_vdim[603][l]+f[120][l]*alpha_vdim[572][l])+(0.273861278752583*f[124][l]+0.3061862178478971*f[32][l])*alpha_vdim[546][l]+0.273861278752583*f[123][l]*alpha_vdim[545][l]+0.3061862178478971*(f[31][l]*alpha_vdim[545][l]+f[98][l]*alpha_vdim[543][l]+f[97][l]*alpha_vdim[542][l])+(0.273861278752583*f[90][l]+0.3061862178478971*f[17][l])*alpha_vdim[524][l]+0.273861278752583*f[89][l]*alpha_vdim[523][l]+0.3061862178478971*(f[16][l]*alpha_vdim[523][l]+f[62][l]*alpha_vdim[520][l]+f[61][l]*alpha_vdim[519][l]+f[60][l]*alpha_vdim[518][l]+f[59][l]*alpha_vdim[517][l])+0.273861278752583*f[65][l]*alpha_vdim[508][l]+0.3061862178478971*(f[6][l]*alpha_vdim[508][l]+f[51][l]*alpha_vdim[507][l]+f[38][l]*alpha_vdim[503][l]+f[37][l]*alpha_vdim[502][l])+(0.273861278752583*f[41][l]+0.3061862178478971*f[2][l])*alpha_vdim[496][l]+0.273861278752583*f[40][l]*alpha_vdim[495][l]+0.3061862178478971*(f[1][l]*alpha_vdim[495][l]+f[24][l]*alpha_vdim[494][l]+f[23][l]*alpha_vdim[493][l]+f[22][l]*alpha_vdim[492][l])+0.273861278752583*f[19][l]*alpha_vdim[490][l]+0.3061862178478971*(f[0][l]*alpha_vdim[490][l]+f[11][l]*alpha_vdim[489][l]+f[10][l]*alpha_vdim[488][l]+f[9][l]*alpha_vdim[487][l]+f[4][l]*alpha_vdim[486][l])+0.273861278752583*f[186][l]*alpha_vdim[372][l]+0.3061862178478971*(f[86][l]*alpha_vdim[372][l]+f[158][l]*alpha_vdim[360][l]+f[129][l]*alpha_vdim[329][l])+(0.273861278752583*f[136][l]+0.3061862178478971*f[32][l])*alpha_vdim[312][l]+0.273861278752583*f[135][l]*alpha_vdim[311][l]+0.3061862178478971*(f[31][l]*alpha_vdim[311][l]+f[102][l]*alpha_vdim[300][l]+f[101][l]*alpha_vdim[299][l])+(0.273861278752583*f[93][l]+0.3061862178478971*f[17][l])*alpha_vdim[287][l]+0.273861278752583*f[92][l]*alpha_vdim[286][l]+0.3061862178478971*(f[16][l]*alpha_vdim[286][l]+f[71][l]*alpha_vdim[277][l]+f[70][l]*alpha_vdim[276][l]+f[69][l]*alpha_vdim[275][l]+f[68][l]*alpha_vdim[274][l])+0.273861278752583*f[80][l]*alpha_vdim[268][l]+0.3061862178478971*(f[6][l]*alpha_vdim[268][l]+f[52][l]*alpha_vdim[264][l]+f[44][l]*alpha_vdim[260][l]+f[43][l]*alpha_vdim[259][l])+(0.273861278752583*f[48][l]+0.3061862178478971*f[2][l])*alpha_vdim[256][l]+0.273861278752583*f[47][l]*alpha_vdim[255][l]+0.3061862178478971*(f[1][l]*alpha_vdim[255][l]+f[27][l]*alpha_vdim[251][l]+f[26][l]*alpha_vdim[250][l]+f[25][l]*alpha_vdim[249][l])+0.273861278752583*f[20][l]*alpha_vdim[248][l]+0.3061862178478971*(f[0][l]*alpha_vdim[248][l]+f[14][l]*alpha_vdim[246][l]+f[13][l]*alpha_vdim[245][l]+f[12][l]*alpha_vdim[244][l]+f[5][l]*alpha_vdim[243][l]);
+    out[16][l] += 0.6846531968814573*(alpha_cdim[3][l]*f[7][l]+alpha_cdim[0][l]*f[1][l]);
+    out[17][l] += 0.6846531968814573*(f[10][l]*alpha_cdim[247][l]+f[2][l]*alpha_cdim[243][l]);
+    out[18][l] += 0.6846531968814573*(alpha_vdim[129][l]*f[158][l]+alpha_vdim[120][l]*f[152][l]+alpha_vdim[86][l]*f[117][l]+alpha_vdim[69][l]*f[102][l]+alpha_vdim[68][l]*f[101][l]+alpha_vdim[60][l]*f[98][l]+alpha_vdim[59][l]*f[97][l]+alpha_vdim[44][l]*f[71][l]+alpha_vdim[43][l]*f[70][l]+alpha_vdim[38][l]*f[62][l]+alpha_vdim[37][l]*f[61][l]+alpha_vdim[32][l]*f[57][l]+alpha_vdim[31][l]*f[56][l]+alpha_vdim[25][l]*f[52][l]+alpha_vdim[22][l]*f[51][l]+alpha_vdim[17][l]*f[34][l]+alpha_vdim[16][l]*f[33][l]+alpha_vdim[13][l]*f[27][l]+alpha_vdim[12][l]*f[26][l]+alpha_vdim[10][l]*f[24][l]+alpha_vdim[9][l]*f[23][l]+alpha_vdim[6][l]*f[21][l]+alpha_vdim[5][l]*f[14][l]+alpha_vdim[4][l]*f[11][l]+alpha_vdim[2][l]*f[8][l]+alpha_vdim[1][l]*f[7][l]+alpha_vdim[0][l]*f[3][l]);
+    out[19][l] += 0.6846531968814573*(f[161][l]*alpha_vdim[372][l]+f[152][l]*alpha_vdim[360][l]+f[120][l]*alpha_vdim[329][l]+f[105][l]*alpha_vdim[312][l]+f[104][l]*alpha_vdim[311][l]+f[98][l]*alpha_vdim[300][l]+f[97][l]*alpha_vdim[299][l]+f[75][l]*alpha_vdim[287][l]+f[74][l]*alpha_vdim[286][l]+f[62][l]*alpha_vdim[277][l]+f[61][l]*alpha_vdim[276][l]+f[60][l]*alpha_vdim[275][l]+f[59][l]*alpha_vdim[274][l]+f[53][l]*alpha_vdim[268][l]+f[51][l]*alpha_vdim[264][l]+f[38][l]*alpha_vdim[260][l]+f[37][l]*alpha_vdim[259][l]+f[29][l]*alpha_vdim[256][l]+f[28][l]*alpha_vdim[255][l]+f[24][l]*alpha_vdim[251][l]+f[23][l]*alpha_vdim[250][l]+f[22][l]*alpha_vdim[249][l]+f[15][l]*alpha_vdim[248][l]+f[11][l]*alpha_vdim[246][l]+f[10][l]*alpha_vdim[245][l]+f[9][l]*alpha_vdim[244][l]+f[4][l]*alpha_vdim[243][l]);
+    out[20][l] += 0.6846531968814573*(f[161][l]*alpha_vdim[606][l]+f[158][l]*alpha_vdim[603][l]+f[129][l]*alpha_vdim[572][l]+f[105][l]*alpha_vdim[546][l]+f[104][l]*alpha_vdim[545][l]+f[102][l]*alpha_vdim[543][l]+f[101][l]*alpha_vdim[542][l]+f[75][l]*alpha_vdim[524][l]+f[74][l]*alpha_vdim[523][l]+f[71][l]*alpha_vdim[520][l]+f[70][l]*alpha_vdim[519][l]+f[69][l]*alpha_vdim[518][l]+f[68][l]*alpha_vdim[517][l]+f[53][l]*alpha_vdim[508][l]+f[52][l]*alpha_vdim[507][l]+f[44][l]*alpha_vdim[503][l]+f[43][l]*alpha_vdim[502][l]+f[29][l]*alpha_vdim[496][l]+f[28][l]*alpha_vdim[495][l]+f[27][l]*alpha_vdim[494][l]+f[26][l]*alpha_vdim[493][l]+f[25][l]*alpha_vdim[492][l]+f[15][l]*alpha_vdim[490][l]+f[14][l]*alpha_vdim[489][l]+f[13][l]*alpha_vdim[488][l]+f[12][l]*alpha_vdim[487][l]+f[5][l]*alpha_vdim[486][l]);
+    out[21][l] += 0.3061862178478971*(f[23][l]*alpha_cdim[247][l]+f[7][l]*alpha_cdim[243][l])+0.2449489742783178*(alpha_vdim[25][l]*f[129][l]+f[25][l]*alpha_vdim[129][l]+alpha_vdim[22][l]*f[120][l]+f[22][l]*alpha_vdim[120][l]+alpha_vdim[6][l]*f[86][l]+f[6][l]*alpha_vdim[86][l])+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[69][l]+0.2449489742783178*f[68][l]*alpha_vdim[69][l]+0.273861278752583*(f[13][l]*alpha_vdim[69][l]+alpha_vdim[12][l]*f[68][l]+f[12][l]*alpha_vdim[68][l])+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[60][l]+0.2449489742783178*f[59][l]*alpha_vdim[60][l]+0.273861278752583*(f[10][l]*alpha_vdim[60][l]+alpha_vdim[9][l]*f[59][l]+f[9][l]*alpha_vdim[59][l]+alpha_vdim[25][l]*f[44][l]+f[25][l]*alpha_vdim[44][l]+alpha_vdim[25][l]*f[43][l]+f[25][l]*alpha_vdim[43][l]+alpha_vdim[22][l]*f[38][l]+f[22][l]*alpha_vdim[38][l]+alpha_vdim[22][l]*f[37][l]+f[22][l]*alpha_vdim[37][l]+alpha_cdim[3][l]*f[36][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[32][l]+0.2449489742783178*f[31][l]*alpha_vdim[32][l]+0.273861278752583*(f[2][l]*alpha_vdim[32][l]+alpha_vdim[1][l]*f[31][l]+f[1][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[5][l]*f[25][l]+f[5][l]*alpha_vdim[25][l]+alpha_vdim[4][l]*f[22][l]+f[4][l]*alpha_vdim[22][l])+0.273861278752583*(alpha_vdim[6][l]*f[17][l]+f[6][l]*alpha_vdim[17][l]+alpha_vdim[6][l]*f[16][l]+f[6][l]*alpha_vdim[16][l])+0.3061862178478971*(alpha_vdim[12][l]*f[13][l]+f[12][l]*alpha_vdim[13][l]+alpha_vdim[9][l]*f[10][l]+f[9][l]*alpha_vdim[10][l]+alpha_cdim[0][l]*f[8][l]+alpha_vdim[0][l]*f[6][l]+f[0][l]*alpha_vdim[6][l]+f[2][l]*(alpha_cdim[3][l]+alpha_vdim[1][l])+f[1][l]*alpha_vdim[2][l]);
+    out[22][l] += 0.2449489742783178*(f[25][l]*alpha_vdim[372][l]+f[21][l]*alpha_vdim[360][l]+f[6][l]*alpha_vdim[329][l])+(0.2449489742783178*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[312][l]+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[311][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[300][l]+0.2449489742783178*f[57][l]*alpha_vdim[299][l]+0.273861278752583*(f[7][l]*alpha_vdim[299][l]+f[25][l]*(alpha_vdim[287][l]+alpha_vdim[286][l])+f[21][l]*(alpha_vdim[277][l]+alpha_vdim[276][l]))+(0.2449489742783178*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[275][l]+(0.2449489742783178*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[274][l]+(0.2449489742783178*f[129][l]+0.273861278752583*(f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[268][l]+(0.2449489742783178*f[117][l]+0.273861278752583*(f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[264][l]+0.273861278752583*f[6][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.273861278752583*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[256][l]+(0.273861278752583*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[255][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[251][l]+(0.273861278752583*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[250][l]+(0.2449489742783178*f[86][l]+0.273861278752583*(f[17][l]+f[16][l]))*alpha_vdim[249][l]+0.3061862178478971*(f[0][l]*alpha_vdim[249][l]+f[25][l]*alpha_vdim[248][l])+0.273861278752583*f[40][l]*alpha_cdim[247][l]+0.3061862178478971*(f[1][l]*alpha_cdim[247][l]+f[21][l]*alpha_vdim[246][l])+(0.273861278752583*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[245][l]+0.273861278752583*f[31][l]*alpha_vdim[244][l]+0.3061862178478971*(f[2][l]*alpha_vdim[244][l]+f[6][l]*alpha_vdim[243][l]+f[9][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[24][l]+alpha_cdim[0][l]*f[10][l]);
+    out[23][l] += 0.273861278752583*f[102][l]*alpha_vdim[372][l]+0.2449489742783178*f[119][l]*alpha_vdim[360][l]+0.273861278752583*(f[32][l]*alpha_vdim[360][l]+f[57][l]*alpha_vdim[329][l])+(0.273861278752583*f[158][l]+0.3061862178478971*f[71][l])*alpha_vdim[312][l]+0.273861278752583*f[52][l]*alpha_vdim[311][l]+(0.2449489742783178*f[182][l]+0.273861278752583*(f[88][l]+f[86][l])+0.3061862178478971*f[17][l])*alpha_vdim[300][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[299][l]+0.3061862178478971*f[102][l]*alpha_vdim[287][l]+0.273861278752583*f[26][l]*alpha_vdim[286][l]+(0.273861278752583*f[119][l]+0.3061862178478971*f[32][l])*alpha_vdim[277][l]+(0.2449489742783178*f[35][l]+0.273861278752583*f[1][l])*alpha_vdim[276][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[275][l]+0.273861278752583*f[21][l]*alpha_vdim[274][l]+(0.273861278752583*f[101][l]+0.3061862178478971*f[27][l])*alpha_vdim[268][l]+(0.2449489742783178*f[118][l]+0.273861278752583*(f[36][l]+f[31][l]))*alpha_vdim[264][l]+0.3061862178478971*(f[2][l]*alpha_vdim[264][l]+f[57][l]*alpha_vdim[260][l])+0.273861278752583*f[7][l]*alpha_vdim[259][l]+0.3061862178478971*f[52][l]*alpha_vdim[256][l]+(0.273861278752583*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[255][l]+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[251][l]+(0.2449489742783178*f[87][l]+0.273861278752583*(f[18][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[250][l]+0.273861278752583*f[56][l]*alpha_vdim[249][l]+0.3061862178478971*(f[8][l]*alpha_vdim[249][l]+f[26][l]*alpha_vdim[248][l])+0.273861278752583*f[35][l]*alpha_vdim[246][l]+0.3061862178478971*(f[1][l]*alpha_vdim[246][l]+f[21][l]*alpha_vdim[245][l])+0.273861278752583*f[33][l]*alpha_vdim[244][l]+0.3061862178478971*(f[3][l]*alpha_vdim[244][l]+f[7][l]*alpha_vdim[243][l])+0.2449489742783178*alpha_vdim[60][l]*f[183][l]+0.273861278752583*(alpha_vdim[69][l]*f[161][l]+f[105][l]*alpha_vdim[129][l])+(0.2449489742783178*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[124][l]+0.2449489742783178*alpha_vdim[22][l]*f[123][l]+0.273861278752583*(alpha_vdim[32][l]*f[120][l]+f[32][l]*alpha_vdim[120][l])+0.3061862178478971*alpha_vdim[44][l]*f[105][l]+0.273861278752583*(alpha_vdim[25][l]*f[104][l]+alpha_vdim[60][l]*f[90][l])+0.2449489742783178*alpha_vdim[9][l]*f[89][l]+0.273861278752583*(alpha_vdim[60][l]*f[86][l]+f[60][l]*alpha_vdim[86][l])+0.3061862178478971*alpha_vdim[69][l]*f[75][l]+0.273861278752583*(alpha_vdim[12][l]*f[74][l]+f[53][l]*alpha_vdim[68][l])+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[65][l]+0.3061862178478971*(alpha_vdim[17][l]*f[60][l]+f[17][l]*alpha_vdim[60][l])+0.273861278752583*(alpha_vdim[6][l]*f[59][l]+f[6][l]*alpha_vdim[59][l])+0.3061862178478971*alpha_vdim[13][l]*f[53][l]+0.273861278752583*(f[28][l]*alpha_vdim[43][l]+alpha_vdim[22][l]*f[41][l])+0.2449489742783178*alpha_vdim[37][l]*f[40][l]+0.273861278752583*(alpha_vdim[4][l]*f[40][l]+alpha_cdim[3][l]*f[39][l])+0.3061862178478971*(alpha_vdim[32][l]*f[38][l]+f[32][l]*alpha_vdim[38][l])+0.273861278752583*(alpha_vdim[1][l]*f[37][l]+f[1][l]*alpha_vdim[37][l]+alpha_vdim[22][l]*f[31][l]+f[22][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[25][l]*f[29][l]+alpha_vdim[5][l]*f[28][l]+alpha_vdim[2][l]*f[22][l]+f[2][l]*alpha_vdim[22][l])+0.273861278752583*(alpha_vdim[9][l]*(f[19][l]+f[16][l])+f[9][l]*alpha_vdim[16][l])+0.3061862178478971*(alpha_vdim[12][l]*f[15][l]+alpha_cdim[0][l]*f[11][l]+alpha_vdim[6][l]*f[10][l]+f[6][l]*alpha_vdim[10][l]+alpha_vdim[0][l]*f[9][l]+f[0][l]*alpha_vdim[9][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[4][l]+f[1][l]*alpha_vdim[4][l]);
+    out[24][l] += 0.273861278752583*f[101][l]*alpha_vdim[372][l]+0.2449489742783178*f[118][l]*alpha_vdim[360][l]+0.273861278752583*(f[31][l]*alpha_vdim[360][l]+f[56][l]*alpha_vdim[329][l]+f[52][l]*alpha_vdim[312][l])+(0.273861278752583*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[311][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[300][l]+(0.2449489742783178*f[182][l]+0.273861278752583*(f[87][l]+f[86][l])+0.3061862178478971*f[16][l])*alpha_vdim[299][l]+0.273861278752583*f[27][l]*alpha_vdim[287][l]+0.3061862178478971*f[101][l]*alpha_vdim[286][l]+(0.2449489742783178*f[36][l]+0.273861278752583*f[2][l])*alpha_vdim[277][l]+(0.273861278752583*f[118][l]+0.3061862178478971*f[31][l])*alpha_vdim[276][l]+0.273861278752583*f[21][l]*alpha_vdim[275][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[274][l]+(0.273861278752583*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[268][l]+(0.2449489742783178*f[119][l]+0.273861278752583*(f[35][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[264][l]+0.273861278752583*f[8][l]*alpha_vdim[260][l]+0.3061862178478971*f[56][l]*alpha_vdim[259][l]+0.273861278752583*f[71][l]*alpha_vdim[256][l]+0.3061862178478971*(f[14][l]*alpha_vdim[256][l]+f[52][l]*alpha_vdim[255][l])+(0.2449489742783178*f[88][l]+0.273861278752583*(f[18][l]+f[17][l])+0.3061862178478971*f[0][l])*alpha_vdim[251][l]+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[250][l]+0.273861278752583*f[57][l]*alpha_vdim[249][l]+0.3061862178478971*(f[7][l]*alpha_vdim[249][l]+f[27][l]*alpha_vdim[248][l])+(0.273861278752583*f[42][l]+0.3061862178478971*f[3][l])*alpha_cdim[247][l]+(0.273861278752583*f[36][l]+0.3061862178478971*f[2][l])*alpha_vdim[246][l]+0.273861278752583*f[34][l]*alpha_vdim[245][l]+0.3061862178478971*(f[3][l]*alpha_vdim[245][l]+f[21][l]*alpha_vdim[244][l]+f[8][l]*alpha_vdim[243][l]+f[11][l]*alpha_cdim[243][l])+0.2449489742783178*alpha_vdim[59][l]*f[183][l]+0.273861278752583*(alpha_vdim[68][l]*f[161][l]+f[104][l]*alpha_vdim[129][l])+0.2449489742783178*(alpha_vdim[22][l]*f[124][l]+alpha_vdim[120][l]*f[123][l])+0.273861278752583*(alpha_vdim[37][l]*f[123][l]+alpha_vdim[31][l]*f[120][l]+f[31][l]*alpha_vdim[120][l]+alpha_vdim[25][l]*f[105][l])+0.3061862178478971*alpha_vdim[43][l]*f[104][l]+0.2449489742783178*alpha_vdim[10][l]*f[90][l]+0.273861278752583*(alpha_vdim[59][l]*(f[89][l]+f[86][l])+f[59][l]*alpha_vdim[86][l]+alpha_vdim[13][l]*f[75][l])+0.3061862178478971*alpha_vdim[68][l]*f[74][l]+0.273861278752583*f[53][l]*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[60][l]*f[65][l]+0.273861278752583*(alpha_vdim[9][l]*f[65][l]+alpha_vdim[6][l]*f[60][l]+f[6][l]*alpha_vdim[60][l])+0.3061862178478971*(alpha_vdim[16][l]*f[59][l]+f[16][l]*alpha_vdim[59][l]+alpha_vdim[12][l]*f[53][l])+0.273861278752583*f[29][l]*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[38][l]*f[41][l]+0.273861278752583*(alpha_vdim[4][l]*f[41][l]+alpha_vdim[22][l]*f[40][l]+alpha_vdim[2][l]*f[38][l]+f[2][l]*alpha_vdim[38][l])+0.3061862178478971*(alpha_vdim[31][l]*f[37][l]+f[31][l]*alpha_vdim[37][l])+0.273861278752583*(alpha_vdim[22][l]*f[32][l]+f[22][l]*alpha_vdim[32][l])+0.3061862178478971*(alpha_vdim[5][l]*f[29][l]+alpha_vdim[25][l]*f[28][l]+alpha_vdim[1][l]*f[22][l]+f[1][l]*alpha_vdim[22][l])+0.273861278752583*(alpha_vdim[10][l]*(f[19][l]+f[17][l])+f[10][l]*alpha_vdim[17][l])+0.3061862178478971*(alpha_vdim[13][l]*f[15][l]+alpha_vdim[0][l]*f[10][l]+f[0][l]*alpha_vdim[10][l]+alpha_vdim[6][l]*f[9][l]+f[6][l]*alpha_vdim[9][l]+alpha_vdim[2][l]*f[4][l]+f[2][l]*alpha_vdim[4][l]);
+    out[25][l] += 0.2449489742783178*(f[22][l]*alpha_vdim[606][l]+f[21][l]*alpha_vdim[603][l]+f[6][l]*alpha_vdim[572][l])+(0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[546][l]+(0.2449489742783178*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[545][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[543][l]+0.2449489742783178*f[57][l]*alpha_vdim[542][l]+0.273861278752583*(f[7][l]*alpha_vdim[542][l]+f[22][l]*(alpha_vdim[524][l]+alpha_vdim[523][l])+f[21][l]*(alpha_vdim[520][l]+alpha_vdim[519][l]))+(0.2449489742783178*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[518][l]+(0.2449489742783178*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[517][l]+(0.2449489742783178*f[120][l]+0.273861278752583*(f[38][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[508][l]+(0.2449489742783178*f[117][l]+0.273861278752583*(f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[507][l]+0.273861278752583*f[6][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.273861278752583*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[496][l]+(0.273861278752583*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[495][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[494][l]+(0.273861278752583*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[493][l]+(0.2449489742783178*f[86][l]+0.273861278752583*(f[17][l]+f[16][l]))*alpha_vdim[492][l]+0.3061862178478971*(f[0][l]*alpha_vdim[492][l]+f[22][l]*alpha_vdim[490][l]+f[21][l]*alpha_vdim[489][l])+(0.273861278752583*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[488][l]+0.273861278752583*f[31][l]*alpha_vdim[487][l]+0.3061862178478971*(f[2][l]*alpha_vdim[487][l]+f[6][l]*alpha_vdim[486][l]+f[28][l]*alpha_cdim[247][l]+f[12][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[27][l]+alpha_cdim[0][l]*f[13][l]);
+    out[26][l] += 0.273861278752583*f[98][l]*alpha_vdim[606][l]+0.2449489742783178*f[119][l]*alpha_vdim[603][l]+0.273861278752583*(f[32][l]*alpha_vdim[603][l]+f[57][l]*alpha_vdim[572][l])+(0.273861278752583*f[152][l]+0.3061862178478971*f[62][l])*alpha_vdim[546][l]+0.273861278752583*f[51][l]*alpha_vdim[545][l]+(0.2449489742783178*f[182][l]+0.273861278752583*(f[88][l]+f[86][l])+0.3061862178478971*f[17][l])*alpha_vdim[543][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[542][l]+0.3061862178478971*f[98][l]*alpha_vdim[524][l]+0.273861278752583*f[23][l]*alpha_vdim[523][l]+(0.273861278752583*f[119][l]+0.3061862178478971*f[32][l])*alpha_vdim[520][l]+(0.2449489742783178*f[35][l]+0.273861278752583*f[1][l])*alpha_vdim[519][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[518][l]+0.273861278752583*f[21][l]*alpha_vdim[517][l]+(0.273861278752583*f[97][l]+0.3061862178478971*f[24][l])*alpha_vdim[508][l]+(0.2449489742783178*f[118][l]+0.273861278752583*(f[36][l]+f[31][l]))*alpha_vdim[507][l]+0.3061862178478971*(f[2][l]*alpha_vdim[507][l]+f[57][l]*alpha_vdim[503][l])+0.273861278752583*f[7][l]*alpha_vdim[502][l]+0.3061862178478971*f[51][l]*alpha_vdim[496][l]+(0.273861278752583*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[495][l]+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[494][l]+(0.2449489742783178*f[87][l]+0.273861278752583*(f[18][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[493][l]+0.273861278752583*f[56][l]*alpha_vdim[492][l]+0.3061862178478971*(f[8][l]*alpha_vdim[492][l]+f[23][l]*alpha_vdim[490][l])+0.273861278752583*f[35][l]*alpha_vdim[489][l]+0.3061862178478971*(f[1][l]*alpha_vdim[489][l]+f[21][l]*alpha_vdim[488][l])+0.273861278752583*f[33][l]*alpha_vdim[487][l]+0.3061862178478971*(f[3][l]*alpha_vdim[487][l]+f[7][l]*alpha_vdim[486][l])+0.2449489742783178*alpha_vdim[69][l]*f[186][l]+0.273861278752583*alpha_vdim[60][l]*f[161][l]+(0.2449489742783178*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l])*f[136][l]+0.2449489742783178*alpha_vdim[25][l]*f[135][l]+0.273861278752583*(alpha_vdim[32][l]*f[129][l]+f[32][l]*alpha_vdim[129][l])+f[105][l]*(0.273861278752583*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[38][l])+0.273861278752583*(alpha_vdim[22][l]*f[104][l]+alpha_vdim[69][l]*f[93][l])+0.2449489742783178*alpha_vdim[12][l]*f[92][l]+0.273861278752583*(alpha_vdim[69][l]*f[86][l]+f[69][l]*alpha_vdim[86][l])+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[80][l]+0.3061862178478971*alpha_vdim[60][l]*f[75][l]+0.273861278752583*alpha_vdim[9][l]*f[74][l]+0.3061862178478971*(alpha_vdim[17][l]*f[69][l]+f[17][l]*alpha_vdim[69][l])+0.273861278752583*(alpha_vdim[6][l]*f[68][l]+f[6][l]*alpha_vdim[68][l])+f[53][l]*(0.273861278752583*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])+0.273861278752583*alpha_vdim[25][l]*f[48][l]+0.2449489742783178*alpha_vdim[43][l]*f[47][l]+0.273861278752583*(alpha_vdim[5][l]*f[47][l]+alpha_cdim[3][l]*f[45][l])+0.3061862178478971*(alpha_vdim[32][l]*f[44][l]+f[32][l]*alpha_vdim[44][l])+0.273861278752583*(alpha_vdim[1][l]*f[43][l]+f[1][l]*alpha_vdim[43][l]+f[28][l]*alpha_vdim[37][l]+alpha_vdim[25][l]*f[31][l]+f[25][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[22][l]*f[29][l]+alpha_vdim[4][l]*f[28][l]+alpha_vdim[2][l]*f[25][l]+f[2][l]*alpha_vdim[25][l])+0.273861278752583*(alpha_vdim[12][l]*(f[20][l]+f[16][l])+f[12][l]*alpha_vdim[16][l])+0.3061862178478971*(alpha_vdim[9][l]*f[15][l]+alpha_cdim[0][l]*f[14][l]+alpha_vdim[6][l]*f[13][l]+f[6][l]*alpha_vdim[13][l]+alpha_vdim[0][l]*f[12][l]+f[0][l]*alpha_vdim[12][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[5][l]+f[1][l]*alpha_vdim[5][l]);
+    out[27][l] += 0.273861278752583*f[97][l]*alpha_vdim[606][l]+0.2449489742783178*f[118][l]*alpha_vdim[603][l]+0.273861278752583*(f[31][l]*alpha_vdim[603][l]+f[56][l]*alpha_vdim[572][l]+f[51][l]*alpha_vdim[546][l])+(0.273861278752583*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[545][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[543][l]+(0.2449489742783178*f[182][l]+0.273861278752583*(f[87][l]+f[86][l])+0.3061862178478971*f[16][l])*alpha_vdim[542][l]+0.273861278752583*f[24][l]*alpha_vdim[524][l]+0.3061862178478971*f[97][l]*alpha_vdim[523][l]+(0.2449489742783178*f[36][l]+0.273861278752583*f[2][l])*alpha_vdim[520][l]+(0.273861278752583*f[118][l]+0.3061862178478971*f[31][l])*alpha_vdim[519][l]+0.273861278752583*f[21][l]*alpha_vdim[518][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[517][l]+(0.273861278752583*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[508][l]+(0.2449489742783178*f[119][l]+0.273861278752583*(f[35][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[507][l]+0.273861278752583*f[8][l]*alpha_vdim[503][l]+0.3061862178478971*f[56][l]*alpha_vdim[502][l]+0.273861278752583*f[62][l]*alpha_vdim[496][l]+0.3061862178478971*(f[11][l]*alpha_vdim[496][l]+f[51][l]*alpha_vdim[495][l])+(0.2449489742783178*f[88][l]+0.273861278752583*(f[18][l]+f[17][l])+0.3061862178478971*f[0][l])*alpha_vdim[494][l]+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[493][l]+0.273861278752583*f[57][l]*alpha_vdim[492][l]+0.3061862178478971*(f[7][l]*alpha_vdim[492][l]+f[24][l]*alpha_vdim[490][l])+(0.273861278752583*f[36][l]+0.3061862178478971*f[2][l])*alpha_vdim[489][l]+0.273861278752583*f[34][l]*alpha_vdim[488][l]+0.3061862178478971*(f[3][l]*alpha_vdim[488][l]+f[21][l]*alpha_vdim[487][l]+f[8][l]*alpha_vdim[486][l]+f[30][l]*alpha_cdim[247][l]+f[14][l]*alpha_cdim[243][l])+0.2449489742783178*alpha_vdim[68][l]*f[186][l]+0.273861278752583*alpha_vdim[59][l]*f[161][l]+0.2449489742783178*(alpha_vdim[25][l]*f[136][l]+alpha_vdim[129][l]*f[135][l])+0.273861278752583*(alpha_vdim[43][l]*f[135][l]+alpha_vdim[31][l]*f[129][l]+f[31][l]*alpha_vdim[129][l]+f[104][l]*alpha_vdim[120][l]+alpha_vdim[22][l]*f[105][l])+0.3061862178478971*alpha_vdim[37][l]*f[104][l]+0.2449489742783178*alpha_vdim[13][l]*f[93][l]+0.273861278752583*(alpha_vdim[68][l]*(f[92][l]+f[86][l])+f[68][l]*alpha_vdim[86][l])+0.2449489742783178*alpha_vdim[69][l]*f[80][l]+0.273861278752583*(alpha_vdim[12][l]*f[80][l]+alpha_vdim[10][l]*f[75][l])+0.3061862178478971*alpha_vdim[59][l]*f[74][l]+0.273861278752583*(alpha_vdim[6][l]*f[69][l]+f[6][l]*alpha_vdim[69][l])+0.3061862178478971*(alpha_vdim[16][l]*f[68][l]+f[16][l]*alpha_vdim[68][l])+f[53][l]*(0.273861278752583*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])+0.2449489742783178*alpha_vdim[44][l]*f[48][l]+0.273861278752583*(alpha_vdim[5][l]*f[48][l]+alpha_vdim[25][l]*f[47][l]+alpha_vdim[2][l]*f[44][l]+f[2][l]*alpha_vdim[44][l])+0.3061862178478971*(alpha_vdim[31][l]*f[43][l]+f[31][l]*alpha_vdim[43][l])+0.273861278752583*(f[29][l]*alpha_vdim[38][l]+alpha_vdim[25][l]*f[32][l]+f[25][l]*alpha_vdim[32][l])+0.3061862178478971*(alpha_vdim[4][l]*f[29][l]+alpha_vdim[22][l]*f[28][l]+alpha_vdim[1][l]*f[25][l]+f[1][l]*alpha_vdim[25][l])+0.273861278752583*(alpha_vdim[13][l]*(f[20][l]+f[17][l])+f[13][l]*alpha_vdim[17][l])+0.3061862178478971*(alpha_vdim[10][l]*f[15][l]+alpha_vdim[0][l]*f[13][l]+f[0][l]*alpha_vdim[13][l]+alpha_vdim[6][l]*f[12][l]+f[6][l]*alpha_vdim[12][l]+alpha_vdim[2][l]*f[5][l]+f[2][l]*alpha_vdim[5][l]);
+    out[28][l] += 0.2449489742783178*f[124][l]*alpha_vdim[606][l]+0.273861278752583*(f[32][l]*alpha_vdim[606][l]+f[98][l]*alpha_vdim[603][l]+f[60][l]*alpha_vdim[572][l])+(0.2449489742783178*f[183][l]+0.273861278752583*(f[90][l]+f[86][l])+0.3061862178478971*f[17][l])*alpha_vdim[546][l]+(0.2449489742783178*f[65][l]+0.273861278752583*f[6][l])*alpha_vdim[545][l]+(0.273861278752583*f[152][l]+0.3061862178478971*f[62][l])*alpha_vdim[543][l]+0.273861278752583*f[51][l]*alpha_vdim[542][l]+(0.273861278752583*f[124][l]+0.3061862178478971*f[32][l])*alpha_vdim[524][l]+(0.2449489742783178*f[40][l]+0.273861278752583*f[1][l])*alpha_vdim[523][l]+0.3061862178478971*f[98][l]*alpha_vdim[520][l]+0.273861278752583*f[23][l]*alpha_vdim[519][l]+(0.273861278752583*f[120][l]+0.3061862178478971*f[38][l])*alpha_vdim[518][l]+0.273861278752583*f[22][l]*alpha_vdim[517][l]+(0.2449489742783178*f[123][l]+0.273861278752583*(f[41][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[508][l]+0.273861278752583*f[97][l]*alpha_vdim[507][l]+0.3061862178478971*(f[24][l]*alpha_vdim[507][l]+f[60][l]*alpha_vdim[503][l])+0.273861278752583*f[9][l]*alpha_vdim[502][l]+(0.273861278752583*f[65][l]+0.3061862178478971*f[6][l])*alpha_vdim[496][l]+(0.2449489742783178*f[89][l]+0.273861278752583*(f[19][l]+f[16][l]))*alpha_vdim[495][l]+0.3061862178478971*(f[0][l]*alpha_vdim[495][l]+f[51][l]*alpha_vdim[494][l])+(0.273861278752583*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[493][l]+(0.273861278752583*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[492][l]+0.273861278752583*f[40][l]*alpha_vdim[490][l]+0.3061862178478971*(f[1][l]*alpha_vdim[490][l]+f[23][l]*alpha_vdim[489][l]+f[22][l]*alpha_vdim[488][l])+0.273861278752583*f[37][l]*alpha_vdim[487][l]+0.3061862178478971*(f[4][l]*alpha_vdim[487][l]+f[9][l]*alpha_vdim[486][l])+0.2449489742783178*f[136][l]*alpha_vdim[372][l]+0.273861278752583*(f[32][l]*alpha_vdim[372][l]+f[102][l]*alpha_vdim[360][l]+f[69][l]*alpha_vdim[329][l])+(0.2449489742783178*f[186][l]+0.273861278752583*(f[93][l]+f[86][l])+0.3061862178478971*f[17][l])*alpha_vdim[312][l]+(0.2449489742783178*f[80][l]+0.273861278752583*f[6][l])*alpha_vdim[311][l]+(0.273861278752583*f[158][l]+0.3061862178478971*f[71][l])*alpha_vdim[300][l]+0.273861278752583*f[52][l]*alpha_vdim[299][l]+(0.273861278752583*f[136][l]+0.3061862178478971*f[32][l])*alpha_vdim[287][l]+(0.2449489742783178*f[47][l]+0.273861278752583*f[1][l])*alpha_vdim[286][l]+0.3061862178478971*f[102][l]*alpha_vdim[277][l]+0.273861278752583*f[26][l]*alpha_vdim[276][l]+(0.273861278752583*f[129][l]+0.3061862178478971*f[44][l])*alpha_vdim[275][l]+0.273861278752583*f[25][l]*alpha_vdim[274][l]+(0.2449489742783178*f[135][l]+0.273861278752583*(f[48][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[268][l]+0.273861278752583*f[101][l]*alpha_vdim[264][l]+0.3061862178478971*(f[27][l]*alpha_vdim[264][l]+f[69][l]*alpha_vdim[260][l])+0.273861278752583*f[12][l]*alpha_vdim[259][l]+(0.273861278752583*f[80][l]+0.3061862178478971*f[6][l])*alpha_vdim[256][l]+(0.2449489742783178*f[92][l]+0.273861278752583*(f[20][l]+f[16][l]))*alpha_vdim[255][l]+0.3061862178478971*(f[0][l]*alpha_vdim[255][l]+f[52][l]*alpha_vdim[251][l])+(0.273861278752583*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[250][l]+(0.273861278752583*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[249][l]+0.273861278752583*f[47][l]*alpha_vdim[248][l]+0.3061862178478971*(f[1][l]*alpha_vdim[248][l]+f[26][l]*alpha_vdim[246][l]+f[25][l]*alpha_vdim[245][l])+0.273861278752583*f[43][l]*alpha_vdim[244][l]+0.3061862178478971*(f[5][l]*alpha_vdim[244][l]+f[12][l]*alpha_vdim[243][l]+alpha_cdim[3][l]*f[30][l]+alpha_cdim[0][l]*f[15][l]);
+    out[29][l] += 0.2449489742783178*f[123][l]*alpha_vdim[606][l]+0.273861278752583*(f[31][l]*alpha_vdim[606][l]+f[97][l]*alpha_vdim[603][l]+f[59][l]*alpha_vdim[572][l])+(0.2449489742783178*f[65][l]+0.273861278752583*f[6][l])*alpha_vdim[546][l]+(0.2449489742783178*f[183][l]+0.273861278752583*(f[89][l]+f[86][l])+0.3061862178478971*f[16][l])*alpha_vdim[545][l]+0.273861278752583*f[51][l]*alpha_vdim[543][l]+(0.273861278752583*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[542][l]+(0.2449489742783178*f[41][l]+0.273861278752583*f[2][l])*alpha_vdim[524][l]+(0.273861278752583*f[123][l]+0.3061862178478971*f[31][l])*alpha_vdim[523][l]+0.273861278752583*f[24][l]*alpha_vdim[520][l]+0.3061862178478971*f[97][l]*alpha_vdim[519][l]+0.273861278752583*f[22][l]*alpha_vdim[518][l]+(0.273861278752583*f[120][l]+0.3061862178478971*f[37][l])*alpha_vdim[517][l]+(0.2449489742783178*f[124][l]+0.273861278752583*(f[40][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[508][l]+(0.273861278752583*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[507][l]+0.273861278752583*f[10][l]*alpha_vdim[503][l]+0.3061862178478971*f[59][l]*alpha_vdim[502][l]+(0.2449489742783178*f[90][l]+0.273861278752583*(f[19][l]+f[17][l])+0.3061862178478971*f[0][l])*alpha_vdim[496][l]+(0.273861278752583*f[65][l]+0.3061862178478971*f[6][l])*alpha_vdim[495][l]+0.273861278752583*f[62][l]*alpha_vdim[494][l]+0.3061862178478971*(f[11][l]*alpha_vdim[494][l]+f[51][l]*alpha_vdim[493][l])+(0.273861278752583*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[492][l]+0.273861278752583*f[41][l]*alpha_vdim[490][l]+0.3061862178478971*(f[2][l]*alpha_vdim[490][l]+f[24][l]*alpha_vdim[489][l])+0.273861278752583*f[38][l]*alpha_vdim[488][l]+0.3061862178478971*(f[4][l]*alpha_vdim[488][l]+f[22][l]*alpha_vdim[487][l]+f[10][l]*alpha_vdim[486][l])+0.2449489742783178*f[135][l]*alpha_vdim[372][l]+0.273861278752583*(f[31][l]*alpha_vdim[372][l]+f[101][l]*alpha_vdim[360][l]+f[68][l]*alpha_vdim[329][l])+(0.2449489742783178*f[80][l]+0.273861278752583*f[6][l])*alpha_vdim[312][l]+(0.2449489742783178*f[186][l]+0.273861278752583*(f[92][l]+f[86][l])+0.3061862178478971*f[16][l])*alpha_vdim[311][l]+0.273861278752583*f[52][l]*alpha_vdim[300][l]+(0.273861278752583*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[299][l]+(0.2449489742783178*f[48][l]+0.273861278752583*f[2][l])*alpha_vdim[287][l]+(0.273861278752583*f[135][l]+0.3061862178478971*f[31][l])*alpha_vdim[286][l]+0.273861278752583*f[27][l]*alpha_vdim[277][l]+0.3061862178478971*f[101][l]*alpha_vdim[276][l]+0.273861278752583*f[25][l]*alpha_vdim[275][l]+(0.273861278752583*f[129][l]+0.3061862178478971*f[43][l])*alpha_vdim[274][l]+(0.2449489742783178*f[136][l]+0.273861278752583*(f[47][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[268][l]+(0.273861278752583*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[264][l]+0.273861278752583*f[13][l]*alpha_vdim[260][l]+0.3061862178478971*f[68][l]*alpha_vdim[259][l]+(0.2449489742783178*f[93][l]+0.273861278752583*(f[20][l]+f[17][l])+0.3061862178478971*f[0][l])*alpha_vdim[256][l]+(0.273861278752583*f[80][l]+0.3061862178478971*f[6][l])*alpha_vdim[255][l]+0.273861278752583*f[71][l]*alpha_vdim[251][l]+0.3061862178478971*(f[14][l]*alpha_vdim[251][l]+f[52][l]*alpha_vdim[250][l])+(0.273861278752583*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[249][l]+(0.273861278752583*f[48][l]+0.3061862178478971*f[2][l])*alpha_vdim[248][l]+0.273861278752583*f[46][l]*alpha_cdim[247][l]+0.3061862178478971*(f[5][l]*alpha_cdim[247][l]+f[27][l]*alpha_vdim[246][l])+0.273861278752583*f[44][l]*alpha_vdim[245][l]+0.3061862178478971*(f[5][l]*alpha_vdim[245][l]+f[25][l]*alpha_vdim[244][l]+f[13][l]*alpha_vdim[243][l]+f[15][l]*alpha_cdim[243][l]);
+    out[30][l] += (0.273861278752583*f[203][l]+0.3061862178478971*f[117][l])*alpha_vdim[606][l]+0.273861278752583*f[202][l]*alpha_vdim[603][l]+0.3061862178478971*(f[120][l]*alpha_vdim[603][l]+f[152][l]*alpha_vdim[572][l])+(0.273861278752583*f[156][l]+0.3061862178478971*f[57][l])*alpha_vdim[546][l]+(0.273861278752583*f[155][l]+0.3061862178478971*f[56][l])*alpha_vdim[545][l]+(0.273861278752583*f[154][l]+0.3061862178478971*f[60][l])*alpha_vdim[543][l]+(0.273861278752583*f[153][l]+0.3061862178478971*f[59][l])*alpha_vdim[542][l]+(0.273861278752583*f[126][l]+0.3061862178478971*f[34][l])*alpha_vdim[524][l]+(0.273861278752583*f[125][l]+0.3061862178478971*f[33][l])*alpha_vdim[523][l]+(0.273861278752583*f[122][l]+0.3061862178478971*f[38][l])*alpha_vdim[520][l]+0.273861278752583*f[121][l]*alpha_vdim[519][l]+0.3061862178478971*(f[37][l]*alpha_vdim[519][l]+f[98][l]*alpha_vdim[518][l]+f[97][l]*alpha_vdim[517][l])+(0.273861278752583*f[100][l]+0.3061862178478971*f[21][l])*alpha_vdim[508][l]+0.273861278752583*f[99][l]*alpha_vdim[507][l]+0.3061862178478971*(f[22][l]*alpha_vdim[507][l]+f[62][l]*alpha_vdim[503][l]+f[61][l]*alpha_vdim[502][l])+(0.273861278752583*f[67][l]+0.3061862178478971*f[8][l])*alpha_vdim[496][l]+(0.273861278752583*f[66][l]+0.3061862178478971*f[7][l])*alpha_vdim[495][l]+(0.273861278752583*f[64][l]+0.3061862178478971*f[10][l])*alpha_vdim[494][l]+0.273861278752583*f[63][l]*alpha_vdim[493][l]+0.3061862178478971*(f[9][l]*alpha_vdim[493][l]+f[51][l]*alpha_vdim[492][l])+(0.273861278752583*f[42][l]+0.3061862178478971*f[3][l])*alpha_vdim[490][l]+0.273861278752583*f[39][l]*alpha_vdim[489][l]+0.3061862178478971*(f[4][l]*alpha_vdim[489][l]+f[24][l]*alpha_vdim[488][l]+f[23][l]*alpha_vdim[487][l]+f[11][l]*alpha_vdim[486][l])+(0.273861278752583*f[210][l]+0.3061862178478971*f[117][l])*alpha_vdim[372][l]+0.273861278752583*f[206][l]*alpha_vdim[360][l]+0.3061862178478971*(f[129][l]*alpha_vdim[360][l]+f[158][l]*alpha_vdim[329][l])+(0.273861278752583*f[171][l]+0.3061862178478971*f[57][l])*alpha_vdim[312][l]+(0.273861278752583*f[170][l]+0.3061862178478971*f[56][l])*alpha_vdim[311][l]+(0.273861278752583*f[160][l]+0.3061862178478971*f[69][l])*alpha_vdim[300][l]+(0.273861278752583*f[159][l]+0.3061862178478971*f[68][l])*alpha_vdim[299][l]+(0.273861278752583*f[138][l]+0.3061862178478971*f[34][l])*alpha_vdim[287][l]+(0.273861278752583*f[137][l]+0.3061862178478971*f[33][l])*alpha_vdim[286][l]+(0.273861278752583*f[131][l]+0.3061862178478971*f[44][l])*alpha_vdim[277][l]+0.273861278752583*f[130][l]*alpha_vdim[276][l]+0.3061862178478971*(f[43][l]*alpha_vdim[276][l]+f[102][l]*alpha_vdim[275][l]+f[101][l]*alpha_vdim[274][l])+(0.273861278752583*f[113][l]+0.3061862178478971*f[21][l])*alpha_vdim[268][l]+0.273861278752583*f[103][l]*alpha_vdim[264][l]+0.3061862178478971*(f[25][l]*alpha_vdim[264][l]+f[71][l]*alpha_vdim[260][l]+f[70][l]*alpha_vdim[259][l])+(0.273861278752583*f[82][l]+0.3061862178478971*f[8][l])*alpha_vdim[256][l]+(0.273861278752583*f[81][l]+0.3061862178478971*f[7][l])*alpha_vdim[255][l]+(0.273861278752583*f[73][l]+0.3061862178478971*f[13][l])*alpha_vdim[251][l]+0.273861278752583*f[72][l]*alpha_vdim[250][l]+0.3061862178478971*(f[12][l]*alpha_vdim[250][l]+f[52][l]*alpha_vdim[249][l])+(0.273861278752583*f[49][l]+0.3061862178478971*f[3][l])*alpha_vdim[248][l]+0.273861278752583*f[45][l]*alpha_vdim[246][l]+0.3061862178478971*(f[5][l]*alpha_vdim[246][l]+f[27][l]*alpha_vdim[245][l]+f[26][l]*alpha_vdim[244][l]+f[14][l]*alpha_vdim[243][l])+0.273861278752583*(alpha_vdim[129][l]*f[213][l]+alpha_vdim[120][l]*f[207][l]+alpha_vdim[69][l]*f[174][l]+alpha_vdim[68][l]*f[173][l]+alpha_vdim[60][l]*f[165][l]+alpha_vdim[59][l]*f[164][l])+0.3061862178478971*alpha_vdim[86][l]*f[161][l]+0.273861278752583*(alpha_vdim[44][l]*f[142][l]+alpha_vdim[43][l]*f[141][l]+alpha_vdim[38][l]*f[133][l]+alpha_vdim[37][l]*f[132][l])+0.3061862178478971*(alpha_vdim[120][l]*f[129][l]+f[120][l]*alpha_vdim[129][l])+0.273861278752583*(alpha_vdim[25][l]*f[114][l]+alpha_vdim[22][l]*f[110][l])+0.3061862178478971*(alpha_vdim[32][l]*f[105][l]+alpha_vdim[31][l]*f[104][l])+0.273861278752583*(alpha_vdim[13][l]*f[84][l]+alpha_vdim[12][l]*f[83][l]+alpha_vdim[10][l]*f[78][l]+alpha_vdim[9][l]*f[77][l])+0.3061862178478971*(alpha_vdim[17][l]*f[75][l]+alpha_vdim[16][l]*f[74][l]+alpha_vdim[60][l]*f[69][l]+f[60][l]*alpha_vdim[69][l]+alpha_vdim[59][l]*f[68][l]+f[59][l]*alpha_vdim[68][l]+alpha_vdim[6][l]*f[53][l])+0.273861278752583*(alpha_vdim[5][l]*f[50][l]+alpha_vdim[4][l]*f[46][l])+0.3061862178478971*(alpha_vdim[38][l]*f[44][l]+f[38][l]*alpha_vdim[44][l]+alpha_vdim[37][l]*f[43][l]+f[37][l]*alpha_vdim[43][l]+alpha_vdim[2][l]*f[29][l]+alpha_vdim[1][l]*f[28][l]+alpha_vdim[22][l]*f[25][l]+f[22][l]*alpha_vdim[25][l]+alpha_vdim[0][l]*f[15][l]+alpha_vdim[10][l]*f[13][l]+f[10][l]*alpha_vdim[13][l]+alpha_vdim[9][l]*f[12][l]+f[9][l]*alpha_vdim[12][l]+alpha_vdim[4][l]*f[5][l]+f[4][l]*alpha_vdim[5][l]);
+    out[31][l] += 0.3061862178478971*(f[37][l]*alpha_cdim[247][l]+f[16][l]*alpha_cdim[243][l])+0.6846531968814573*(alpha_cdim[3][l]*f[21][l]+alpha_cdim[0][l]*f[6][l]);
+    out[32][l] += 0.6846531968814573*(f[22][l]*alpha_cdim[247][l]+f[6][l]*alpha_cdim[243][l])+0.3061862178478971*(alpha_cdim[3][l]*f[34][l]+alpha_cdim[0][l]*f[17][l]);
+    out[33][l] += 0.1956151991089878*alpha_vdim[129][l]*f[129][l]+0.3061862178478971*(alpha_vdim[44][l]*f[129][l]+f[44][l]*alpha_vdim[129][l])+0.1956151991089878*alpha_vdim[120][l]*f[120][l]+0.3061862178478971*(alpha_vdim[38][l]*f[120][l]+f[38][l]*alpha_vdim[120][l])+0.1956151991089878*alpha_vdim[86][l]*f[86][l]+0.3061862178478971*(alpha_vdim[17][l]*f[86][l]+f[17][l]*alpha_vdim[86][l])+0.273861278752583*alpha_vdim[69][l]*f[69][l]+0.1956151991089878*alpha_vdim[68][l]*f[68][l]+0.3061862178478971*(alpha_vdim[13][l]*f[68][l]+f[13][l]*alpha_vdim[68][l])+0.273861278752583*alpha_vdim[60][l]*f[60][l]+0.1956151991089878*alpha_vdim[59][l]*f[59][l]+0.3061862178478971*(alpha_vdim[10][l]*f[59][l]+f[10][l]*alpha_vdim[59][l])+0.1956151991089878*alpha_vdim[43][l]*f[43][l]+0.3061862178478971*(alpha_vdim[5][l]*f[43][l]+f[5][l]*alpha_vdim[43][l])+0.1956151991089878*alpha_vdim[37][l]*f[37][l]+0.3061862178478971*(alpha_vdim[4][l]*f[37][l]+f[4][l]*alpha_vdim[37][l])+0.6123724356957944*alpha_cdim[3][l]*f[35][l]+0.273861278752583*alpha_vdim[32][l]*f[32][l]+0.1956151991089878*alpha_vdim[31][l]*f[31][l]+0.3061862178478971*(alpha_vdim[2][l]*f[31][l]+f[2][l]*alpha_vdim[31][l])+0.273861278752583*(alpha_vdim[25][l]*f[25][l]+alpha_vdim[22][l]*f[22][l])+0.1956151991089878*alpha_vdim[16][l]*f[16][l]+0.3061862178478971*(alpha_vdim[0][l]*f[16][l]+f[0][l]*alpha_vdim[16][l])+0.273861278752583*(alpha_vdim[12][l]*f[12][l]+alpha_vdim[9][l]*f[9][l])+0.6846531968814573*alpha_cdim[0][l]*f[7][l]+0.273861278752583*alpha_vdim[6][l]*f[6][l]+f[1][l]*(0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l]);
+    out[34][l] += 0.6846531968814573*(f[24][l]*alpha_cdim[247][l]+f[8][l]*alpha_cdim[243][l])+0.1956151991089878*alpha_vdim[129][l]*f[129][l]+0.3061862178478971*(alpha_vdim[43][l]*f[129][l]+f[43][l]*alpha_vdim[129][l])+0.1956151991089878*alpha_vdim[120][l]*f[120][l]+0.3061862178478971*(alpha_vdim[37][l]*f[120][l]+f[37][l]*alpha_vdim[120][l])+0.1956151991089878*alpha_vdim[86][l]*f[86][l]+0.3061862178478971*(alpha_vdim[16][l]*f[86][l]+f[16][l]*alpha_vdim[86][l])+0.1956151991089878*alpha_vdim[69][l]*f[69][l]+0.3061862178478971*(alpha_vdim[12][l]*f[69][l]+f[12][l]*alpha_vdim[69][l])+0.273861278752583*alpha_vdim[68][l]*f[68][l]+0.1956151991089878*alpha_vdim[60][l]*f[60][l]+0.3061862178478971*(alpha_vdim[9][l]*f[60][l]+f[9][l]*alpha_vdim[60][l])+0.273861278752583*alpha_vdim[59][l]*f[59][l]+0.1956151991089878*alpha_vdim[44][l]*f[44][l]+0.3061862178478971*(alpha_vdim[5][l]*f[44][l]+f[5][l]*alpha_vdim[44][l])+0.1956151991089878*alpha_vdim[38][l]*f[38][l]+0.3061862178478971*(alpha_vdim[4][l]*f[38][l]+f[4][l]*alpha_vdim[38][l])+0.1956151991089878*alpha_vdim[32][l]*f[32][l]+0.3061862178478971*(alpha_vdim[1][l]*f[32][l]+f[1][l]*alpha_vdim[32][l])+0.273861278752583*(alpha_vdim[31][l]*f[31][l]+alpha_vdim[25][l]*f[25][l]+alpha_vdim[22][l]*f[22][l])+0.1956151991089878*alpha_vdim[17][l]*f[17][l]+0.3061862178478971*(alpha_vdim[0][l]*f[17][l]+f[0][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[13][l]*f[13][l]+alpha_vdim[10][l]*f[10][l]+alpha_vdim[6][l]*f[6][l]+alpha_vdim[2][l]*f[2][l]);
+    out[35][l] += 0.6123724356957944*(alpha_vdim[69][l]*f[158][l]+alpha_vdim[60][l]*f[152][l]+f[102][l]*alpha_vdim[129][l]+f[98][l]*alpha_vdim[120][l]+alpha_vdim[32][l]*f[117][l])+0.6846531968814573*alpha_vdim[44][l]*f[102][l]+0.6123724356957944*alpha_vdim[25][l]*f[101][l]+0.6846531968814573*alpha_vdim[38][l]*f[98][l]+0.6123724356957944*(alpha_vdim[22][l]*f[97][l]+f[57][l]*alpha_vdim[86][l])+0.6846531968814573*alpha_vdim[69][l]*f[71][l]+0.6123724356957944*(alpha_vdim[12][l]*f[70][l]+f[52][l]*alpha_vdim[68][l])+0.6846531968814573*alpha_vdim[60][l]*f[62][l]+0.6123724356957944*(alpha_vdim[9][l]*f[61][l]+f[51][l]*alpha_vdim[59][l])+0.6846531968814573*alpha_vdim[17][l]*f[57][l]+0.6123724356957944*alpha_vdim[6][l]*f[56][l]+0.6846531968814573*(alpha_vdim[13][l]*f[52][l]+alpha_vdim[10][l]*f[51][l])+0.6123724356957944*(f[26][l]*alpha_vdim[43][l]+f[23][l]*alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[32][l]*f[34][l]+0.6123724356957944*(alpha_vdim[1][l]*f[33][l]+f[21][l]*alpha_vdim[31][l])+0.6846531968814573*(alpha_vdim[25][l]*f[27][l]+alpha_vdim[5][l]*f[26][l]+alpha_vdim[22][l]*f[24][l]+alpha_vdim[4][l]*f[23][l]+alpha_vdim[2][l]*f[21][l])+0.3061862178478971*alpha_cdim[0][l]*f[18][l]+0.6123724356957944*f[7][l]*alpha_vdim[16][l]+0.6846531968814573*(alpha_vdim[12][l]*f[14][l]+alpha_vdim[9][l]*f[11][l]+alpha_vdim[6][l]*f[8][l]+alpha_vdim[0][l]*f[7][l])+(0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[3][l];
+    out[36][l] += 0.3061862178478971*(f[39][l]*alpha_cdim[247][l]+f[18][l]*alpha_cdim[243][l])+0.6123724356957944*(alpha_vdim[68][l]*f[158][l]+alpha_vdim[59][l]*f[152][l]+f[101][l]*alpha_vdim[129][l]+f[97][l]*alpha_vdim[120][l]+alpha_vdim[31][l]*f[117][l]+alpha_vdim[25][l]*f[102][l])+0.6846531968814573*alpha_vdim[43][l]*f[101][l]+0.6123724356957944*alpha_vdim[22][l]*f[98][l]+0.6846531968814573*alpha_vdim[37][l]*f[97][l]+0.6123724356957944*(f[56][l]*alpha_vdim[86][l]+alpha_vdim[13][l]*f[71][l])+0.6846531968814573*alpha_vdim[68][l]*f[70][l]+0.6123724356957944*(f[52][l]*alpha_vdim[69][l]+alpha_vdim[10][l]*f[62][l])+0.6846531968814573*alpha_vdim[59][l]*f[61][l]+0.6123724356957944*(f[51][l]*alpha_vdim[60][l]+alpha_vdim[6][l]*f[57][l])+0.6846531968814573*(alpha_vdim[16][l]*f[56][l]+alpha_vdim[12][l]*f[52][l]+alpha_vdim[9][l]*f[51][l])+0.6123724356957944*(f[27][l]*alpha_vdim[44][l]+f[24][l]*alpha_vdim[38][l]+alpha_vdim[2][l]*f[34][l])+0.6846531968814573*alpha_vdim[31][l]*f[33][l]+0.6123724356957944*f[21][l]*alpha_vdim[32][l]+0.6846531968814573*(alpha_vdim[5][l]*f[27][l]+alpha_vdim[25][l]*f[26][l]+alpha_vdim[4][l]*f[24][l]+alpha_vdim[22][l]*f[23][l]+alpha_vdim[1][l]*f[21][l])+0.6123724356957944*f[8][l]*alpha_vdim[17][l]+0.6846531968814573*(alpha_vdim[13][l]*f[14][l]+alpha_vdim[10][l]*f[11][l]+alpha_vdim[0][l]*f[8][l]+alpha_vdim[6][l]*f[7][l]+alpha_vdim[2][l]*f[3][l]);
+    out[37][l] += (0.1956151991089878*f[129][l]+0.3061862178478971*f[44][l])*alpha_vdim[372][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[360][l]+(0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[329][l]+0.273861278752583*f[69][l]*alpha_vdim[312][l]+(0.1956151991089878*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[311][l]+0.273861278752583*f[57][l]*alpha_vdim[300][l]+0.1956151991089878*f[56][l]*alpha_vdim[299][l]+0.3061862178478971*(f[8][l]*alpha_vdim[299][l]+f[129][l]*alpha_vdim[287][l])+0.1956151991089878*f[43][l]*alpha_vdim[286][l]+0.3061862178478971*(f[5][l]*alpha_vdim[286][l]+f[117][l]*alpha_vdim[277][l])+(0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[276][l]+0.273861278752583*f[32][l]*alpha_vdim[275][l]+(0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[274][l]+0.273861278752583*(f[25][l]*alpha_vdim[268][l]+f[21][l]*alpha_vdim[264][l])+0.3061862178478971*f[86][l]*alpha_vdim[260][l]+0.1956151991089878*f[16][l]*alpha_vdim[259][l]+0.3061862178478971*(f[0][l]*alpha_vdim[259][l]+f[68][l]*alpha_vdim[256][l])+0.273861278752583*f[12][l]*alpha_vdim[255][l]+0.3061862178478971*f[56][l]*alpha_vdim[251][l]+0.273861278752583*(f[7][l]*alpha_vdim[250][l]+f[6][l]*alpha_vdim[249][l])+0.3061862178478971*(f[43][l]*alpha_vdim[248][l]+f[33][l]*alpha_vdim[246][l]+f[31][l]*alpha_vdim[245][l])+0.273861278752583*f[1][l]*alpha_vdim[244][l]+0.3061862178478971*f[16][l]*alpha_vdim[243][l]+0.6846531968814573*(alpha_cdim[3][l]*f[23][l]+alpha_cdim[0][l]*f[9][l]);
+    out[38][l] += (0.1956151991089878*f[129][l]+0.3061862178478971*f[43][l])*alpha_vdim[372][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[360][l]+(0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[329][l]+(0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[312][l]+0.273861278752583*f[68][l]*alpha_vdim[311][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[300][l]+0.273861278752583*f[56][l]*alpha_vdim[299][l]+0.1956151991089878*f[44][l]*alpha_vdim[287][l]+0.3061862178478971*(f[5][l]*alpha_vdim[287][l]+f[129][l]*alpha_vdim[286][l])+0.1956151991089878*f[34][l]*alpha_vdim[277][l]+0.3061862178478971*(f[3][l]*alpha_vdim[277][l]+f[117][l]*alpha_vdim[276][l])+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[275][l]+0.273861278752583*(f[31][l]*alpha_vdim[274][l]+f[25][l]*alpha_vdim[268][l]+f[21][l]*alpha_vdim[264][l])+0.1956151991089878*f[17][l]*alpha_vdim[260][l]+0.3061862178478971*(f[0][l]*alpha_vdim[260][l]+f[86][l]*alpha_vdim[259][l])+0.273861278752583*f[13][l]*alpha_vdim[256][l]+0.3061862178478971*f[69][l]*alpha_vdim[255][l]+0.273861278752583*f[8][l]*alpha_vdim[251][l]+0.3061862178478971*f[57][l]*alpha_vdim[250][l]+0.273861278752583*f[6][l]*alpha_vdim[249][l]+0.3061862178478971*f[44][l]*alpha_vdim[248][l]+(0.6123724356957944*f[41][l]+0.6846531968814573*f[2][l])*alpha_cdim[247][l]+0.3061862178478971*f[34][l]*alpha_vdim[246][l]+0.273861278752583*f[2][l]*alpha_vdim[245][l]+0.3061862178478971*(f[32][l]*alpha_vdim[244][l]+f[17][l]*alpha_vdim[243][l])+0.6846531968814573*f[10][l]*alpha_cdim[243][l];
+    out[39][l] += 0.3061862178478971*f[206][l]*alpha_vdim[372][l]+0.273861278752583*f[117][l]*alpha_vdim[360][l]+0.3061862178478971*(f[182][l]*alpha_vdim[329][l]+f[160][l]*alpha_vdim[312][l]+f[159][l]*alpha_vdim[311][l])+0.273861278752583*(f[57][l]*alpha_vdim[300][l]+f[56][l]*alpha_vdim[299][l])+0.3061862178478971*(f[131][l]*alpha_vdim[287][l]+f[130][l]*alpha_vdim[286][l])+0.273861278752583*(f[34][l]*alpha_vdim[277][l]+f[33][l]*alpha_vdim[276][l])+0.3061862178478971*(f[119][l]*alpha_vdim[275][l]+f[118][l]*alpha_vdim[274][l]+f[103][l]*alpha_vdim[268][l])+0.273861278752583*f[21][l]*alpha_vdim[264][l]+0.3061862178478971*(f[88][l]*alpha_vdim[260][l]+f[87][l]*alpha_vdim[259][l]+f[73][l]*alpha_vdim[256][l]+f[72][l]*alpha_vdim[255][l])+0.273861278752583*(f[8][l]*alpha_vdim[251][l]+f[7][l]*alpha_vdim[250][l])+0.3061862178478971*(f[58][l]*alpha_vdim[249][l]+f[45][l]*alpha_vdim[248][l])+0.273861278752583*f[3][l]*alpha_vdim[246][l]+0.3061862178478971*(f[36][l]*alpha_vdim[245][l]+f[35][l]*alpha_vdim[244][l]+f[18][l]*alpha_vdim[243][l])+0.6123724356957944*alpha_vdim[120][l]*f[203][l]+0.6846531968814573*alpha_vdim[129][l]*f[192][l]+0.6123724356957944*(alpha_vdim[60][l]*f[156][l]+alpha_vdim[59][l]*f[155][l])+0.6846531968814573*(alpha_vdim[86][l]*f[152][l]+alpha_vdim[69][l]*f[148][l]+alpha_vdim[68][l]*f[147][l])+0.6123724356957944*(alpha_vdim[38][l]*f[126][l]+alpha_vdim[37][l]*f[125][l])+0.6846531968814573*(f[117][l]*alpha_vdim[120][l]+alpha_vdim[44][l]*f[107][l]+alpha_vdim[43][l]*f[106][l])+0.6123724356957944*alpha_vdim[22][l]*f[100][l]+0.6846531968814573*(alpha_vdim[32][l]*f[98][l]+alpha_vdim[31][l]*f[97][l]+alpha_vdim[25][l]*f[96][l])+0.6123724356957944*(alpha_vdim[10][l]*f[67][l]+alpha_vdim[9][l]*f[66][l])+0.6846531968814573*(alpha_vdim[17][l]*f[62][l]+alpha_vdim[16][l]*f[61][l]+f[57][l]*alpha_vdim[60][l]+f[56][l]*alpha_vdim[59][l]+alpha_vdim[13][l]*f[55][l]+alpha_vdim[12][l]*f[54][l]+alpha_vdim[6][l]*f[51][l])+0.6123724356957944*alpha_vdim[4][l]*f[42][l]+0.6846531968814573*(f[34][l]*alpha_vdim[38][l]+f[33][l]*alpha_vdim[37][l]+alpha_vdim[5][l]*f[30][l]+alpha_vdim[2][l]*f[24][l]+alpha_vdim[1][l]*f[23][l]+f[21][l]*alpha_vdim[22][l]+alpha_vdim[0][l]*f[11][l]+f[8][l]*alpha_vdim[10][l]+f[7][l]*alpha_vdim[9][l]+f[3][l]*alpha_vdim[4][l]);
+    out[40][l] += 0.6123724356957944*(f[105][l]*alpha_vdim[372][l]+f[98][l]*alpha_vdim[360][l]+f[60][l]*alpha_vdim[329][l])+(0.6123724356957944*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[312][l]+0.6123724356957944*f[53][l]*alpha_vdim[311][l]+(0.6123724356957944*f[152][l]+0.6846531968814573*f[62][l])*alpha_vdim[300][l]+0.6123724356957944*f[51][l]*alpha_vdim[299][l]+0.6846531968814573*f[105][l]*alpha_vdim[287][l]+0.6123724356957944*f[28][l]*alpha_vdim[286][l]+0.6846531968814573*f[98][l]*alpha_vdim[277][l]+0.6123724356957944*f[23][l]*alpha_vdim[276][l]+(0.6123724356957944*f[120][l]+0.6846531968814573*f[38][l])*alpha_vdim[275][l]+0.6123724356957944*f[22][l]*alpha_vdim[274][l]+(0.6123724356957944*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[268][l]+0.6123724356957944*f[97][l]*alpha_vdim[264][l]+0.6846531968814573*(f[24][l]*alpha_vdim[264][l]+f[60][l]*alpha_vdim[260][l])+0.6123724356957944*f[9][l]*alpha_vdim[259][l]+0.6846531968814573*f[53][l]*alpha_vdim[256][l]+0.6123724356957944*f[74][l]*alpha_vdim[255][l]+0.6846531968814573*(f[15][l]*alpha_vdim[255][l]+f[51][l]*alpha_vdim[251][l])+(0.6123724356957944*f[61][l]+0.6846531968814573*f[11][l])*alpha_vdim[250][l]+0.6123724356957944*f[59][l]*alpha_vdim[249][l]+0.6846531968814573*(f[10][l]*alpha_vdim[249][l]+f[28][l]*alpha_vdim[248][l]+f[23][l]*alpha_vdim[246][l]+f[22][l]*alpha_vdim[245][l])+0.6123724356957944*f[37][l]*alpha_vdim[244][l]+0.6846531968814573*(f[4][l]*alpha_vdim[244][l]+f[9][l]*alpha_vdim[243][l])+0.3061862178478971*(alpha_cdim[3][l]*f[42][l]+alpha_cdim[0][l]*f[19][l]);
+    out[41][l] += 0.6123724356957944*(f[104][l]*alpha_vdim[372][l]+f[97][l]*alpha_vdim[360][l]+f[59][l]*alpha_vdim[329][l]+f[53][l]*alpha_vdim[312][l])+(0.6123724356957944*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[311][l]+0.6123724356957944*f[51][l]*alpha_vdim[300][l]+(0.6123724356957944*f[152][l]+0.6846531968814573*f[61][l])*alpha_vdim[299][l]+0.6123724356957944*f[29][l]*alpha_vdim[287][l]+0.6846531968814573*f[104][l]*alpha_vdim[286][l]+0.6123724356957944*f[24][l]*alpha_vdim[277][l]+0.6846531968814573*f[97][l]*alpha_vdim[276][l]+0.6123724356957944*f[22][l]*alpha_vdim[275][l]+(0.6123724356957944*f[120][l]+0.6846531968814573*f[37][l])*alpha_vdim[274][l]+(0.6123724356957944*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[268][l]+(0.6123724356957944*f[98][l]+0.6846531968814573*f[23][l])*alpha_vdim[264][l]+0.6123724356957944*f[10][l]*alpha_vdim[260][l]+0.6846531968814573*f[59][l]*alpha_vdim[259][l]+0.6123724356957944*f[75][l]*alpha_vdim[256][l]+0.6846531968814573*(f[15][l]*alpha_vdim[256][l]+f[53][l]*alpha_vdim[255][l])+0.6123724356957944*f[62][l]*alpha_vdim[251][l]+0.6846531968814573*(f[11][l]*alpha_vdim[251][l]+f[51][l]*alpha_vdim[250][l])+0.6123724356957944*f[60][l]*alpha_vdim[249][l]+0.6846531968814573*(f[9][l]*alpha_vdim[249][l]+f[29][l]*alpha_vdim[248][l])+0.273861278752583*f[4][l]*alpha_cdim[247][l]+0.6846531968814573*f[24][l]*alpha_vdim[246][l]+0.6123724356957944*f[38][l]*alpha_vdim[245][l]+0.6846531968814573*(f[4][l]*alpha_vdim[245][l]+f[22][l]*alpha_vdim[244][l]+f[10][l]*alpha_vdim[243][l])+0.3061862178478971*f[19][l]*alpha_cdim[243][l];
+    out[42][l] += 0.6846531968814573*f[192][l]*alpha_vdim[372][l]+0.6123724356957944*f[202][l]*alpha_vdim[360][l]+0.6846531968814573*(f[120][l]*alpha_vdim[360][l]+f[152][l]*alpha_vdim[329][l]+f[148][l]*alpha_vdim[312][l]+f[147][l]*alpha_vdim[311][l])+(0.6123724356957944*f[154][l]+0.6846531968814573*f[60][l])*alpha_vdim[300][l]+0.6123724356957944*f[153][l]*alpha_vdim[299][l]+0.6846531968814573*(f[59][l]*alpha_vdim[299][l]+f[107][l]*alpha_vdim[287][l]+f[106][l]*alpha_vdim[286][l])+(0.6123724356957944*f[122][l]+0.6846531968814573*f[38][l])*alpha_vdim[277][l]+0.6123724356957944*f[121][l]*alpha_vdim[276][l]+0.6846531968814573*(f[37][l]*alpha_vdim[276][l]+f[98][l]*alpha_vdim[275][l]+f[97][l]*alpha_vdim[274][l]+f[96][l]*alpha_vdim[268][l])+0.6123724356957944*f[99][l]*alpha_vdim[264][l]+0.6846531968814573*(f[22][l]*alpha_vdim[264][l]+f[62][l]*alpha_vdim[260][l]+f[61][l]*alpha_vdim[259][l]+f[55][l]*alpha_vdim[256][l]+f[54][l]*alpha_vdim[255][l])+(0.6123724356957944*f[64][l]+0.6846531968814573*f[10][l])*alpha_vdim[251][l]+0.6123724356957944*f[63][l]*alpha_vdim[250][l]+0.6846531968814573*(f[9][l]*alpha_vdim[250][l]+f[51][l]*alpha_vdim[249][l]+f[30][l]*alpha_vdim[248][l])+0.6123724356957944*f[39][l]*alpha_vdim[246][l]+0.6846531968814573*(f[4][l]*alpha_vdim[246][l]+f[24][l]*alpha_vdim[245][l]+f[23][l]*alpha_vdim[244][l]+f[11][l]*alpha_vdim[243][l])+0.3061862178478971*(alpha_vdim[129][l]*f[207][l]+alpha_vdim[86][l]*f[183][l]+alpha_vdim[69][l]*f[165][l]+alpha_vdim[68][l]*f[164][l]+alpha_vdim[44][l]*f[133][l]+alpha_vdim[43][l]*f[132][l]+alpha_vdim[32][l]*f[124][l]+alpha_vdim[31][l]*f[123][l])+0.273861278752583*alpha_vdim[120][l]*f[120][l]+0.3061862178478971*(alpha_vdim[25][l]*f[110][l]+alpha_vdim[17][l]*f[90][l]+alpha_vdim[16][l]*f[89][l]+alpha_vdim[13][l]*f[78][l]+alpha_vdim[12][l]*f[77][l]+alpha_vdim[6][l]*f[65][l])+0.273861278752583*(alpha_vdim[60][l]*f[60][l]+alpha_vdim[59][l]*f[59][l])+0.3061862178478971*(alpha_vdim[5][l]*f[46][l]+alpha_vdim[2][l]*f[41][l]+alpha_vdim[1][l]*f[40][l])+0.273861278752583*(alpha_vdim[38][l]*f[38][l]+alpha_vdim[37][l]*f[37][l]+alpha_vdim[22][l]*f[22][l])+0.3061862178478971*alpha_vdim[0][l]*f[19][l]+0.273861278752583*(alpha_vdim[10][l]*f[10][l]+alpha_vdim[9][l]*f[9][l]+alpha_vdim[4][l]*f[4][l]);
+    out[43][l] += (0.1956151991089878*f[120][l]+0.3061862178478971*f[38][l])*alpha_vdim[606][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[603][l]+(0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[572][l]+0.273861278752583*f[60][l]*alpha_vdim[546][l]+(0.1956151991089878*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[545][l]+0.273861278752583*f[57][l]*alpha_vdim[543][l]+0.1956151991089878*f[56][l]*alpha_vdim[542][l]+0.3061862178478971*(f[8][l]*alpha_vdim[542][l]+f[120][l]*alpha_vdim[524][l])+0.1956151991089878*f[37][l]*alpha_vdim[523][l]+0.3061862178478971*(f[4][l]*alpha_vdim[523][l]+f[117][l]*alpha_vdim[520][l])+(0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[519][l]+0.273861278752583*f[32][l]*alpha_vdim[518][l]+(0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[517][l]+0.273861278752583*(f[22][l]*alpha_vdim[508][l]+f[21][l]*alpha_vdim[507][l])+0.3061862178478971*f[86][l]*alpha_vdim[503][l]+0.1956151991089878*f[16][l]*alpha_vdim[502][l]+0.3061862178478971*(f[0][l]*alpha_vdim[502][l]+f[59][l]*alpha_vdim[496][l])+0.273861278752583*f[9][l]*alpha_vdim[495][l]+0.3061862178478971*f[56][l]*alpha_vdim[494][l]+0.273861278752583*(f[7][l]*alpha_vdim[493][l]+f[6][l]*alpha_vdim[492][l])+0.3061862178478971*(f[37][l]*alpha_vdim[490][l]+f[33][l]*alpha_vdim[489][l]+f[31][l]*alpha_vdim[488][l])+0.273861278752583*f[1][l]*alpha_vdim[487][l]+0.3061862178478971*f[16][l]*alpha_vdim[486][l]+0.6846531968814573*(alpha_cdim[3][l]*f[26][l]+alpha_cdim[0][l]*f[12][l]);
+    out[44][l] += (0.1956151991089878*f[120][l]+0.3061862178478971*f[37][l])*alpha_vdim[606][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[603][l]+(0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[572][l]+(0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[546][l]+0.273861278752583*f[59][l]*alpha_vdim[545][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[543][l]+0.273861278752583*f[56][l]*alpha_vdim[542][l]+0.1956151991089878*f[38][l]*alpha_vdim[524][l]+0.3061862178478971*(f[4][l]*alpha_vdim[524][l]+f[120][l]*alpha_vdim[523][l])+0.1956151991089878*f[34][l]*alpha_vdim[520][l]+0.3061862178478971*(f[3][l]*alpha_vdim[520][l]+f[117][l]*alpha_vdim[519][l])+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[518][l]+0.273861278752583*(f[31][l]*alpha_vdim[517][l]+f[22][l]*alpha_vdim[508][l]+f[21][l]*alpha_vdim[507][l])+0.1956151991089878*f[17][l]*alpha_vdim[503][l]+0.3061862178478971*(f[0][l]*alpha_vdim[503][l]+f[86][l]*alpha_vdim[502][l])+0.273861278752583*f[10][l]*alpha_vdim[496][l]+0.3061862178478971*f[60][l]*alpha_vdim[495][l]+0.273861278752583*f[8][l]*alpha_vdim[494][l]+0.3061862178478971*f[57][l]*alpha_vdim[493][l]+0.273861278752583*f[6][l]*alpha_vdim[492][l]+0.3061862178478971*(f[38][l]*alpha_vdim[490][l]+f[34][l]*alpha_vdim[489][l])+0.273861278752583*f[2][l]*alpha_vdim[488][l]+0.3061862178478971*(f[32][l]*alpha_vdim[487][l]+f[17][l]*alpha_vdim[486][l])+0.6846531968814573*(f[29][l]*alpha_cdim[247][l]+f[13][l]*alpha_cdim[243][l]);
+    out[45][l] += 0.3061862178478971*f[202][l]*alpha_vdim[606][l]+0.273861278752583*f[117][l]*alpha_vdim[603][l]+0.3061862178478971*(f[182][l]*alpha_vdim[572][l]+f[154][l]*alpha_vdim[546][l]+f[153][l]*alpha_vdim[545][l])+0.273861278752583*(f[57][l]*alpha_vdim[543][l]+f[56][l]*alpha_vdim[542][l])+0.3061862178478971*(f[122][l]*alpha_vdim[524][l]+f[121][l]*alpha_vdim[523][l])+0.273861278752583*(f[34][l]*alpha_vdim[520][l]+f[33][l]*alpha_vdim[519][l])+0.3061862178478971*(f[119][l]*alpha_vdim[518][l]+f[118][l]*alpha_vdim[517][l]+f[99][l]*alpha_vdim[508][l])+0.273861278752583*f[21][l]*alpha_vdim[507][l]+0.3061862178478971*(f[88][l]*alpha_vdim[503][l]+f[87][l]*alpha_vdim[502][l]+f[64][l]*alpha_vdim[496][l]+f[63][l]*alpha_vdim[495][l])+0.273861278752583*(f[8][l]*alpha_vdim[494][l]+f[7][l]*alpha_vdim[493][l])+0.3061862178478971*(f[58][l]*alpha_vdim[492][l]+f[39][l]*alpha_vdim[490][l])+0.273861278752583*f[3][l]*alpha_vdim[489][l]+0.3061862178478971*(f[36][l]*alpha_vdim[488][l]+f[35][l]*alpha_vdim[487][l]+f[18][l]*alpha_vdim[486][l])+0.6123724356957944*alpha_vdim[129][l]*f[210][l]+0.6846531968814573*alpha_vdim[120][l]*f[192][l]+0.6123724356957944*(alpha_vdim[69][l]*f[171][l]+alpha_vdim[68][l]*f[170][l])+0.6846531968814573*(alpha_vdim[86][l]*f[158][l]+alpha_vdim[60][l]*f[148][l]+alpha_vdim[59][l]*f[147][l])+0.6123724356957944*(alpha_vdim[44][l]*f[138][l]+alpha_vdim[43][l]*f[137][l])+0.6846531968814573*f[117][l]*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[25][l]*f[113][l]+0.6846531968814573*(alpha_vdim[38][l]*f[107][l]+alpha_vdim[37][l]*f[106][l]+alpha_vdim[32][l]*f[102][l]+alpha_vdim[31][l]*f[101][l]+alpha_vdim[22][l]*f[96][l])+0.6123724356957944*(alpha_vdim[13][l]*f[82][l]+alpha_vdim[12][l]*f[81][l])+0.6846531968814573*(alpha_vdim[17][l]*f[71][l]+alpha_vdim[16][l]*f[70][l]+f[57][l]*alpha_vdim[69][l]+f[56][l]*alpha_vdim[68][l]+alpha_vdim[10][l]*f[55][l]+alpha_vdim[9][l]*f[54][l]+alpha_vdim[6][l]*f[52][l])+0.6123724356957944*alpha_vdim[5][l]*f[49][l]+0.6846531968814573*(f[34][l]*alpha_vdim[44][l]+f[33][l]*alpha_vdim[43][l]+alpha_vdim[4][l]*f[30][l]+alpha_vdim[2][l]*f[27][l]+alpha_vdim[1][l]*f[26][l]+f[21][l]*alpha_vdim[25][l]+alpha_vdim[0][l]*f[14][l]+f[8][l]*alpha_vdim[13][l]+f[7][l]*alpha_vdim[12][l]+f[3][l]*alpha_vdim[5][l]);
+    out[46][l] += 0.273861278752583*f[120][l]*alpha_vdim[606][l]+0.3061862178478971*(f[203][l]*alpha_vdim[603][l]+f[183][l]*alpha_vdim[572][l])+0.273861278752583*(f[60][l]*alpha_vdim[546][l]+f[59][l]*alpha_vdim[545][l])+0.3061862178478971*(f[156][l]*alpha_vdim[543][l]+f[155][l]*alpha_vdim[542][l])+0.273861278752583*(f[38][l]*alpha_vdim[524][l]+f[37][l]*alpha_vdim[523][l])+0.3061862178478971*(f[126][l]*alpha_vdim[520][l]+f[125][l]*alpha_vdim[519][l]+f[124][l]*alpha_vdim[518][l]+f[123][l]*alpha_vdim[517][l])+0.273861278752583*f[22][l]*alpha_vdim[508][l]+0.3061862178478971*(f[100][l]*alpha_vdim[507][l]+f[90][l]*alpha_vdim[503][l]+f[89][l]*alpha_vdim[502][l])+0.273861278752583*(f[10][l]*alpha_vdim[496][l]+f[9][l]*alpha_vdim[495][l])+0.3061862178478971*(f[67][l]*alpha_vdim[494][l]+f[66][l]*alpha_vdim[493][l]+f[65][l]*alpha_vdim[492][l])+0.273861278752583*f[4][l]*alpha_vdim[490][l]+0.3061862178478971*(f[42][l]*alpha_vdim[489][l]+f[41][l]*alpha_vdim[488][l]+f[40][l]*alpha_vdim[487][l]+f[19][l]*alpha_vdim[486][l])+0.6123724356957944*f[213][l]*alpha_vdim[372][l]+0.6846531968814573*(f[120][l]*alpha_vdim[372][l]+f[192][l]*alpha_vdim[360][l]+f[161][l]*alpha_vdim[329][l])+(0.6123724356957944*f[174][l]+0.6846531968814573*f[60][l])*alpha_vdim[312][l]+0.6123724356957944*f[173][l]*alpha_vdim[311][l]+0.6846531968814573*(f[59][l]*alpha_vdim[311][l]+f[148][l]*alpha_vdim[300][l]+f[147][l]*alpha_vdim[299][l])+(0.6123724356957944*f[142][l]+0.6846531968814573*f[38][l])*alpha_vdim[287][l]+0.6123724356957944*f[141][l]*alpha_vdim[286][l]+0.6846531968814573*(f[37][l]*alpha_vdim[286][l]+f[107][l]*alpha_vdim[277][l]+f[106][l]*alpha_vdim[276][l]+f[105][l]*alpha_vdim[275][l]+f[104][l]*alpha_vdim[274][l])+0.6123724356957944*f[114][l]*alpha_vdim[268][l]+0.6846531968814573*(f[22][l]*alpha_vdim[268][l]+f[96][l]*alpha_vdim[264][l]+f[75][l]*alpha_vdim[260][l]+f[74][l]*alpha_vdim[259][l])+(0.6123724356957944*f[84][l]+0.6846531968814573*f[10][l])*alpha_vdim[256][l]+0.6123724356957944*f[83][l]*alpha_vdim[255][l]+0.6846531968814573*(f[9][l]*alpha_vdim[255][l]+f[55][l]*alpha_vdim[251][l]+f[54][l]*alpha_vdim[250][l]+f[53][l]*alpha_vdim[249][l])+0.6123724356957944*f[50][l]*alpha_vdim[248][l]+0.6846531968814573*(f[4][l]*alpha_vdim[248][l]+f[30][l]*alpha_vdim[246][l]+f[29][l]*alpha_vdim[245][l]+f[28][l]*alpha_vdim[244][l]+f[15][l]*alpha_vdim[243][l]);
+    out[47][l] += 0.6123724356957944*(f[105][l]*alpha_vdim[606][l]+f[102][l]*alpha_vdim[603][l]+f[69][l]*alpha_vdim[572][l])+(0.6123724356957944*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[546][l]+0.6123724356957944*f[53][l]*alpha_vdim[545][l]+(0.6123724356957944*f[158][l]+0.6846531968814573*f[71][l])*alpha_vdim[543][l]+0.6123724356957944*f[52][l]*alpha_vdim[542][l]+0.6846531968814573*f[105][l]*alpha_vdim[524][l]+0.6123724356957944*f[28][l]*alpha_vdim[523][l]+0.6846531968814573*f[102][l]*alpha_vdim[520][l]+0.6123724356957944*f[26][l]*alpha_vdim[519][l]+(0.6123724356957944*f[129][l]+0.6846531968814573*f[44][l])*alpha_vdim[518][l]+0.6123724356957944*f[25][l]*alpha_vdim[517][l]+(0.6123724356957944*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[508][l]+0.6123724356957944*f[101][l]*alpha_vdim[507][l]+0.6846531968814573*(f[27][l]*alpha_vdim[507][l]+f[69][l]*alpha_vdim[503][l])+0.6123724356957944*f[12][l]*alpha_vdim[502][l]+0.6846531968814573*f[53][l]*alpha_vdim[496][l]+0.6123724356957944*f[74][l]*alpha_vdim[495][l]+0.6846531968814573*(f[15][l]*alpha_vdim[495][l]+f[52][l]*alpha_vdim[494][l])+(0.6123724356957944*f[70][l]+0.6846531968814573*f[14][l])*alpha_vdim[493][l]+0.6123724356957944*f[68][l]*alpha_vdim[492][l]+0.6846531968814573*(f[13][l]*alpha_vdim[492][l]+f[28][l]*alpha_vdim[490][l]+f[26][l]*alpha_vdim[489][l]+f[25][l]*alpha_vdim[488][l])+0.6123724356957944*f[43][l]*alpha_vdim[487][l]+0.6846531968814573*(f[5][l]*alpha_vdim[487][l]+f[12][l]*alpha_vdim[486][l])+0.3061862178478971*(alpha_cdim[3][l]*f[49][l]+alpha_cdim[0][l]*f[20][l]);
+    out[48][l] += 0.6123724356957944*(f[104][l]*alpha_vdim[606][l]+f[101][l]*alpha_vdim[603][l]+f[68][l]*alpha_vdim[572][l]+f[53][l]*alpha_vdim[546][l])+(0.6123724356957944*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[545][l]+0.6123724356957944*f[52][l]*alpha_vdim[543][l]+(0.6123724356957944*f[158][l]+0.6846531968814573*f[70][l])*alpha_vdim[542][l]+0.6123724356957944*f[29][l]*alpha_vdim[524][l]+0.6846531968814573*f[104][l]*alpha_vdim[523][l]+0.6123724356957944*f[27][l]*alpha_vdim[520][l]+0.6846531968814573*f[101][l]*alpha_vdim[519][l]+0.6123724356957944*f[25][l]*alpha_vdim[518][l]+(0.6123724356957944*f[129][l]+0.6846531968814573*f[43][l])*alpha_vdim[517][l]+(0.6123724356957944*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[508][l]+(0.6123724356957944*f[102][l]+0.6846531968814573*f[26][l])*alpha_vdim[507][l]+0.6123724356957944*f[13][l]*alpha_vdim[503][l]+0.6846531968814573*f[68][l]*alpha_vdim[502][l]+0.6123724356957944*f[75][l]*alpha_vdim[496][l]+0.6846531968814573*(f[15][l]*alpha_vdim[496][l]+f[53][l]*alpha_vdim[495][l])+0.6123724356957944*f[71][l]*alpha_vdim[494][l]+0.6846531968814573*(f[14][l]*alpha_vdim[494][l]+f[52][l]*alpha_vdim[493][l])+0.6123724356957944*f[69][l]*alpha_vdim[492][l]+0.6846531968814573*(f[12][l]*alpha_vdim[492][l]+f[29][l]*alpha_vdim[490][l]+f[27][l]*alpha_vdim[489][l])+0.6123724356957944*f[44][l]*alpha_vdim[488][l]+0.6846531968814573*(f[5][l]*alpha_vdim[488][l]+f[25][l]*alpha_vdim[487][l]+f[13][l]*alpha_vdim[486][l])+0.3061862178478971*(f[50][l]*alpha_cdim[247][l]+f[20][l]*alpha_cdim[243][l]);
+    out[49][l] += 0.6846531968814573*f[192][l]*alpha_vdim[606][l]+0.6123724356957944*f[206][l]*alpha_vdim[603][l]+0.6846531968814573*(f[129][l]*alpha_vdim[603][l]+f[158][l]*alpha_vdim[572][l]+f[148][l]*alpha_vdim[546][l]+f[147][l]*alpha_vdim[545][l])+(0.6123724356957944*f[160][l]+0.6846531968814573*f[69][l])*alpha_vdim[543][l]+0.6123724356957944*f[159][l]*alpha_vdim[542][l]+0.6846531968814573*(f[68][l]*alpha_vdim[542][l]+f[107][l]*alpha_vdim[524][l]+f[106][l]*alpha_vdim[523][l])+(0.6123724356957944*f[131][l]+0.6846531968814573*f[44][l])*alpha_vdim[520][l]+0.6123724356957944*f[130][l]*alpha_vdim[519][l]+0.6846531968814573*(f[43][l]*alpha_vdim[519][l]+f[102][l]*alpha_vdim[518][l]+f[101][l]*alpha_vdim[517][l]+f[96][l]*alpha_vdim[508][l])+0.6123724356957944*f[103][l]*alpha_vdim[507][l]+0.6846531968814573*(f[25][l]*alpha_vdim[507][l]+f[71][l]*alpha_vdim[503][l]+f[70][l]*alpha_vdim[502][l]+f[55][l]*alpha_vdim[496][l]+f[54][l]*alpha_vdim[495][l])+(0.6123724356957944*f[73][l]+0.6846531968814573*f[13][l])*alpha_vdim[494][l]+0.6123724356957944*f[72][l]*alpha_vdim[493][l]+0.6846531968814573*(f[12][l]*alpha_vdim[493][l]+f[52][l]*alpha_vdim[492][l]+f[30][l]*alpha_vdim[490][l])+0.6123724356957944*f[45][l]*alpha_vdim[489][l]+0.6846531968814573*(f[5][l]*alpha_vdim[489][l]+f[27][l]*alpha_vdim[488][l]+f[26][l]*alpha_vdim[487][l]+f[14][l]*alpha_vdim[486][l])+0.3061862178478971*(alpha_vdim[120][l]*f[213][l]+alpha_vdim[86][l]*f[186][l]+alpha_vdim[60][l]*f[174][l]+alpha_vdim[59][l]*f[173][l]+alpha_vdim[38][l]*f[142][l]+alpha_vdim[37][l]*f[141][l]+alpha_vdim[32][l]*f[136][l]+alpha_vdim[31][l]*f[135][l])+0.273861278752583*alpha_vdim[129][l]*f[129][l]+0.3061862178478971*(alpha_vdim[22][l]*f[114][l]+alpha_vdim[17][l]*f[93][l]+alpha_vdim[16][l]*f[92][l]+alpha_vdim[10][l]*f[84][l]+alpha_vdim[9][l]*f[83][l]+alpha_vdim[6][l]*f[80][l])+0.273861278752583*(alpha_vdim[69][l]*f[69][l]+alpha_vdim[68][l]*f[68][l])+0.3061862178478971*(alpha_vdim[4][l]*f[50][l]+alpha_vdim[2][l]*f[48][l]+alpha_vdim[1][l]*f[47][l])+0.273861278752583*(alpha_vdim[44][l]*f[44][l]+alpha_vdim[43][l]*f[43][l]+alpha_vdim[25][l]*f[25][l])+0.3061862178478971*alpha_vdim[0][l]*f[20][l]+0.273861278752583*(alpha_vdim[13][l]*f[13][l]+alpha_vdim[12][l]*f[12][l]+alpha_vdim[5][l]*f[5][l]);
+    out[50][l] += 0.6123724356957944*f[207][l]*alpha_vdim[606][l]+0.6846531968814573*(f[129][l]*alpha_vdim[606][l]+f[192][l]*alpha_vdim[603][l]+f[161][l]*alpha_vdim[572][l])+(0.6123724356957944*f[165][l]+0.6846531968814573*f[69][l])*alpha_vdim[546][l]+0.6123724356957944*f[164][l]*alpha_vdim[545][l]+0.6846531968814573*(f[68][l]*alpha_vdim[545][l]+f[148][l]*alpha_vdim[543][l]+f[147][l]*alpha_vdim[542][l])+(0.6123724356957944*f[133][l]+0.6846531968814573*f[44][l])*alpha_vdim[524][l]+0.6123724356957944*f[132][l]*alpha_vdim[523][l]+0.6846531968814573*(f[43][l]*alpha_vdim[523][l]+f[107][l]*alpha_vdim[520][l]+f[106][l]*alpha_vdim[519][l]+f[105][l]*alpha_vdim[518][l]+f[104][l]*alpha_vdim[517][l])+0.6123724356957944*f[110][l]*alpha_vdim[508][l]+0.6846531968814573*(f[25][l]*alpha_vdim[508][l]+f[96][l]*alpha_vdim[507][l]+f[75][l]*alpha_vdim[503][l]+f[74][l]*alpha_vdim[502][l])+(0.6123724356957944*f[78][l]+0.6846531968814573*f[13][l])*alpha_vdim[496][l]+0.6123724356957944*f[77][l]*alpha_vdim[495][l]+0.6846531968814573*(f[12][l]*alpha_vdim[495][l]+f[55][l]*alpha_vdim[494][l]+f[54][l]*alpha_vdim[493][l]+f[53][l]*alpha_vdim[492][l])+0.6123724356957944*f[46][l]*alpha_vdim[490][l]+0.6846531968814573*(f[5][l]*alpha_vdim[490][l]+f[30][l]*alpha_vdim[489][l]+f[29][l]*alpha_vdim[488][l]+f[28][l]*alpha_vdim[487][l]+f[15][l]*alpha_vdim[486][l])+0.273861278752583*f[129][l]*alpha_vdim[372][l]+0.3061862178478971*(f[210][l]*alpha_vdim[360][l]+f[186][l]*alpha_vdim[329][l])+0.273861278752583*(f[69][l]*alpha_vdim[312][l]+f[68][l]*alpha_vdim[311][l])+0.3061862178478971*(f[171][l]*alpha_vdim[300][l]+f[170][l]*alpha_vdim[299][l])+0.273861278752583*(f[44][l]*alpha_vdim[287][l]+f[43][l]*alpha_vdim[286][l])+0.3061862178478971*(f[138][l]*alpha_vdim[277][l]+f[137][l]*alpha_vdim[276][l]+f[136][l]*alpha_vdim[275][l]+f[135][l]*alpha_vdim[274][l])+0.273861278752583*f[25][l]*alpha_vdim[268][l]+0.3061862178478971*(f[113][l]*alpha_vdim[264][l]+f[93][l]*alpha_vdim[260][l]+f[92][l]*alpha_vdim[259][l])+0.273861278752583*(f[13][l]*alpha_vdim[256][l]+f[12][l]*alpha_vdim[255][l])+0.3061862178478971*(f[82][l]*alpha_vdim[251][l]+f[81][l]*alpha_vdim[250][l]+f[80][l]*alpha_vdim[249][l])+0.273861278752583*f[5][l]*alpha_vdim[248][l]+0.3061862178478971*(f[49][l]*alpha_vdim[246][l]+f[48][l]*alpha_vdim[245][l]+f[47][l]*alpha_vdim[244][l]+f[20][l]*alpha_vdim[243][l]);
+    out[51][l] += 0.2449489742783178*f[52][l]*alpha_vdim[372][l]+0.2190890230020664*f[58][l]*alpha_vdim[360][l]+0.2449489742783178*(f[6][l]*alpha_vdim[360][l]+f[21][l]*alpha_vdim[329][l])+(0.2449489742783178*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[312][l]+(0.2449489742783178*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[311][l]+(0.2190890230020664*f[118][l]+0.2449489742783178*(f[36][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[300][l]+(0.2190890230020664*f[119][l]+0.2449489742783178*(f[35][l]+f[32][l]))*alpha_vdim[299][l]+0.273861278752583*(f[1][l]*alpha_vdim[299][l]+f[52][l]*(alpha_vdim[287][l]+alpha_vdim[286][l]))+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[277][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[276][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[275][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[274][l]+(0.2449489742783178*f[158][l]+0.273861278752583*(f[71][l]+f[70][l])+0.3061862178478971*f[14][l])*alpha_vdim[268][l]+(0.2190890230020664*f[182][l]+0.2449489742783178*(f[88][l]+f[87][l]+f[86][l])+0.273861278752583*(f[18][l]+f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[264][l]+0.273861278752583*f[21][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.273861278752583*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[256][l]+(0.273861278752583*f[101][l]+0.3061862178478971*f[27][l])*alpha_vdim[255][l]+(0.2449489742783178*f[119][l]+0.273861278752583*(f[35][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[251][l]+(0.2449489742783178*f[118][l]+0.273861278752583*(f[36][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[250][l]+(0.2449489742783178*f[117][l]+0.273861278752583*(f[34][l]+f[33][l]))*alpha_vdim[249][l]+0.3061862178478971*(f[3][l]*alpha_vdim[249][l]+f[52][l]*alpha_vdim[248][l])+(0.273861278752583*f[66][l]+0.3061862178478971*f[7][l])*alpha_cdim[247][l]+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[246][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[245][l]+0.273861278752583*f[56][l]*alpha_vdim[244][l]+0.3061862178478971*(f[8][l]*alpha_vdim[244][l]+f[21][l]*alpha_vdim[243][l]+f[23][l]*alpha_cdim[243][l])+0.2190890230020664*alpha_vdim[22][l]*f[183][l]+0.2449489742783178*(alpha_vdim[25][l]*f[161][l]+f[53][l]*alpha_vdim[129][l])+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[124][l]+0.2190890230020664*alpha_vdim[60][l]*f[123][l]+0.2449489742783178*(alpha_vdim[9][l]*f[123][l]+alpha_vdim[6][l]*f[120][l])+(0.2190890230020664*f[65][l]+0.2449489742783178*f[6][l])*alpha_vdim[120][l]+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[105][l]+(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[104][l]+0.2449489742783178*(alpha_vdim[22][l]*(f[90][l]+f[89][l]+f[86][l])+f[22][l]*alpha_vdim[86][l])+0.273861278752583*(alpha_vdim[25][l]*(f[75][l]+f[74][l])+f[29][l]*alpha_vdim[69][l]+f[28][l]*alpha_vdim[68][l])+0.2449489742783178*(alpha_vdim[38][l]+alpha_vdim[37][l])*f[65][l]+0.273861278752583*(alpha_vdim[4][l]*f[65][l]+alpha_cdim[3][l]*f[64][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[60][l]+(0.2449489742783178*(f[41][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[60][l]+(0.2449489742783178*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[59][l]+(0.2449489742783178*(f[40][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[59][l]+(0.273861278752583*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[53][l]+0.273861278752583*(alpha_vdim[9][l]*f[41][l]+alpha_vdim[10][l]*f[40][l]+alpha_vdim[6][l]*f[38][l]+f[6][l]*alpha_vdim[38][l]+alpha_vdim[6][l]*f[37][l]+f[6][l]*alpha_vdim[37][l]+alpha_vdim[10][l]*f[32][l]+f[10][l]*alpha_vdim[32][l]+alpha_vdim[9][l]*f[31][l]+f[9][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[12][l]*f[29][l]+alpha_vdim[13][l]*f[28][l]+f[15][l]*alpha_vdim[25][l]+alpha_cdim[0][l]*f[24][l])+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[22][l]+0.273861278752583*(f[19][l]+f[17][l]+f[16][l])*alpha_vdim[22][l]+0.3061862178478971*(f[0][l]*alpha_vdim[22][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[10][l]+f[1][l]*alpha_vdim[10][l]+alpha_vdim[2][l]*f[9][l]+f[2][l]*alpha_vdim[9][l]+alpha_vdim[4][l]*f[6][l]+f[4][l]*alpha_vdim[6][l]);
+    out[52][l] += 0.2449489742783178*f[51][l]*alpha_vdim[606][l]+0.2190890230020664*f[58][l]*alpha_vdim[603][l]+0.2449489742783178*(f[6][l]*alpha_vdim[603][l]+f[21][l]*alpha_vdim[572][l])+(0.2449489742783178*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[546][l]+(0.2449489742783178*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[545][l]+(0.2190890230020664*f[118][l]+0.2449489742783178*(f[36][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[543][l]+(0.2190890230020664*f[119][l]+0.2449489742783178*(f[35][l]+f[32][l]))*alpha_vdim[542][l]+0.273861278752583*(f[1][l]*alpha_vdim[542][l]+f[51][l]*(alpha_vdim[524][l]+alpha_vdim[523][l]))+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[520][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[519][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[518][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[517][l]+(0.2449489742783178*f[152][l]+0.273861278752583*(f[62][l]+f[61][l])+0.3061862178478971*f[11][l])*alpha_vdim[508][l]+(0.2190890230020664*f[182][l]+0.2449489742783178*(f[88][l]+f[87][l]+f[86][l])+0.273861278752583*(f[18][l]+f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[507][l]+0.273861278752583*f[21][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.273861278752583*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[496][l]+(0.273861278752583*f[97][l]+0.3061862178478971*f[24][l])*alpha_vdim[495][l]+(0.2449489742783178*f[119][l]+0.273861278752583*(f[35][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[494][l]+(0.2449489742783178*f[118][l]+0.273861278752583*(f[36][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[493][l]+(0.2449489742783178*f[117][l]+0.273861278752583*(f[34][l]+f[33][l]))*alpha_vdim[492][l]+0.3061862178478971*(f[3][l]*alpha_vdim[492][l]+f[51][l]*alpha_vdim[490][l])+(0.273861278752583*f[58][l]+0.3061862178478971*f[6][l])*alpha_vdim[489][l]+(0.273861278752583*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[488][l]+0.273861278752583*f[56][l]*alpha_vdim[487][l]+0.3061862178478971*(f[8][l]*alpha_vdim[487][l]+f[21][l]*alpha_vdim[486][l]+f[54][l]*alpha_cdim[247][l]+f[26][l]*alpha_cdim[243][l])+0.2190890230020664*alpha_vdim[25][l]*f[186][l]+0.2449489742783178*alpha_vdim[22][l]*f[161][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[136][l]+0.2190890230020664*alpha_vdim[69][l]*f[135][l]+0.2449489742783178*(alpha_vdim[12][l]*f[135][l]+alpha_vdim[6][l]*f[129][l])+0.2190890230020664*f[80][l]*alpha_vdim[129][l]+0.2449489742783178*(f[6][l]*alpha_vdim[129][l]+f[53][l]*alpha_vdim[120][l])+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[105][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[104][l]+0.2449489742783178*(alpha_vdim[25][l]*(f[93][l]+f[92][l]+f[86][l])+f[25][l]*alpha_vdim[86][l]+(alpha_vdim[44][l]+alpha_vdim[43][l])*f[80][l])+0.273861278752583*(alpha_vdim[5][l]*f[80][l]+alpha_vdim[22][l]*(f[75][l]+f[74][l])+alpha_cdim[3][l]*f[73][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[69][l]+(0.2449489742783178*(f[48][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[69][l]+(0.2449489742783178*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[68][l]+0.2449489742783178*(f[47][l]+f[32][l])*alpha_vdim[68][l]+0.273861278752583*(f[1][l]*alpha_vdim[68][l]+f[29][l]*alpha_vdim[60][l]+f[28][l]*alpha_vdim[59][l])+(0.273861278752583*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])*f[53][l]+0.273861278752583*(alpha_vdim[12][l]*f[48][l]+alpha_vdim[13][l]*f[47][l]+alpha_vdim[6][l]*f[44][l]+f[6][l]*alpha_vdim[44][l]+alpha_vdim[6][l]*f[43][l]+f[6][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[32][l]+f[13][l]*alpha_vdim[32][l]+alpha_vdim[12][l]*f[31][l]+f[12][l]*alpha_vdim[31][l])+0.3061862178478971*(alpha_vdim[9][l]*f[29][l]+alpha_vdim[10][l]*f[28][l]+alpha_cdim[0][l]*f[27][l])+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[25][l]+0.273861278752583*(f[20][l]+f[17][l]+f[16][l])*alpha_vdim[25][l]+0.3061862178478971*(f[0][l]*alpha_vdim[25][l]+f[15][l]*alpha_vdim[22][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[13][l]+f[1][l]*alpha_vdim[13][l]+alpha_vdim[2][l]*f[12][l]+f[2][l]*alpha_vdim[12][l]+alpha_vdim[5][l]*f[6][l]+f[5][l]*alpha_vdim[6][l]);
+    out[53][l] += 0.2190890230020664*f[65][l]*alpha_vdim[606][l]+0.2449489742783178*(f[6][l]*alpha_vdim[606][l]+f[51][l]*alpha_vdim[603][l]+f[22][l]*alpha_vdim[572][l])+(0.2190890230020664*f[123][l]+0.2449489742783178*(f[41][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[546][l]+(0.2190890230020664*f[124][l]+0.2449489742783178*(f[40][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[545][l]+(0.2449489742783178*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[543][l]+(0.2449489742783178*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[542][l]+(0.2449489742783178*f[65][l]+0.273861278752583*f[6][l])*alpha_vdim[524][l]+0.2449489742783178*f[65][l]*alpha_vdim[523][l]+0.273861278752583*(f[6][l]*alpha_vdim[523][l]+f[51][l]*(alpha_vdim[520][l]+alpha_vdim[519][l]))+(0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[518][l]+(0.2449489742783178*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[517][l]+(0.2190890230020664*f[183][l]+0.2449489742783178*(f[90][l]+f[89][l]+f[86][l])+0.273861278752583*(f[19][l]+f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[508][l]+(0.2449489742783178*f[152][l]+0.273861278752583*(f[62][l]+f[61][l])+0.3061862178478971*f[11][l])*alpha_vdim[507][l]+0.273861278752583*f[22][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.2449489742783178*f[124][l]+0.273861278752583*(f[40][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[496][l]+(0.2449489742783178*f[123][l]+0.273861278752583*(f[41][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[495][l]+(0.273861278752583*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[494][l]+(0.273861278752583*f[97][l]+0.3061862178478971*f[24][l])*alpha_vdim[493][l]+(0.2449489742783178*f[120][l]+0.273861278752583*(f[38][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[492][l]+0.273861278752583*f[65][l]*alpha_vdim[490][l]+0.3061862178478971*(f[6][l]*alpha_vdim[490][l]+f[51][l]*alpha_vdim[489][l])+(0.273861278752583*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[488][l]+0.273861278752583*f[59][l]*alpha_vdim[487][l]+0.3061862178478971*(f[10][l]*alpha_vdim[487][l]+f[22][l]*alpha_vdim[486][l])+0.2190890230020664*f[80][l]*alpha_vdim[372][l]+0.2449489742783178*(f[6][l]*alpha_vdim[372][l]+f[52][l]*alpha_vdim[360][l]+f[25][l]*alpha_vdim[329][l])+(0.2190890230020664*f[135][l]+0.2449489742783178*(f[48][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[312][l]+(0.2190890230020664*f[136][l]+0.2449489742783178*(f[47][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[311][l]+(0.2449489742783178*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[300][l]+(0.2449489742783178*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[299][l]+(0.2449489742783178*f[80][l]+0.273861278752583*f[6][l])*alpha_vdim[287][l]+0.2449489742783178*f[80][l]*alpha_vdim[286][l]+0.273861278752583*(f[6][l]*alpha_vdim[286][l]+f[52][l]*(alpha_vdim[277][l]+alpha_vdim[276][l]))+(0.2449489742783178*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[275][l]+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[274][l]+(0.2190890230020664*f[186][l]+0.2449489742783178*(f[93][l]+f[92][l]+f[86][l])+0.273861278752583*(f[20][l]+f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[268][l]+(0.2449489742783178*f[158][l]+0.273861278752583*(f[71][l]+f[70][l])+0.3061862178478971*f[14][l])*alpha_vdim[264][l]+0.273861278752583*f[25][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.2449489742783178*f[136][l]+0.273861278752583*(f[47][l]+f[32][l])+0.3061862178478971*f[1][l])*alpha_vdim[256][l]+(0.2449489742783178*f[135][l]+0.273861278752583*(f[48][l]+f[31][l])+0.3061862178478971*f[2][l])*alpha_vdim[255][l]+(0.273861278752583*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[251][l]+(0.273861278752583*f[101][l]+0.3061862178478971*f[27][l])*alpha_vdim[250][l]+(0.2449489742783178*f[129][l]+0.273861278752583*(f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[249][l]+(0.273861278752583*f[80][l]+0.3061862178478971*f[6][l])*alpha_vdim[248][l]+0.273861278752583*f[77][l]*alpha_cdim[247][l]+0.3061862178478971*(f[12][l]*alpha_cdim[247][l]+f[52][l]*alpha_vdim[246][l])+(0.273861278752583*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[245][l]+0.273861278752583*f[68][l]*alpha_vdim[244][l]+0.3061862178478971*(f[13][l]*alpha_vdim[244][l]+f[25][l]*alpha_vdim[243][l]+f[28][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[55][l]+alpha_cdim[0][l]*f[29][l]);
+    out[54][l] += (0.2449489742783178*f[156][l]+0.273861278752583*f[57][l])*alpha_vdim[606][l]+0.2449489742783178*f[154][l]*alpha_vdim[603][l]+0.273861278752583*(f[60][l]*alpha_vdim[603][l]+f[98][l]*alpha_vdim[572][l])+(0.2449489742783178*f[203][l]+0.273861278752583*(f[126][l]+f[117][l])+0.3061862178478971*f[34][l])*alpha_vdim[546][l]+(0.2449489742783178*f[100][l]+0.273861278752583*f[21][l])*alpha_vdim[545][l]+(0.2449489742783178*f[202][l]+0.273861278752583*(f[122][l]+f[120][l])+0.3061862178478971*f[38][l])*alpha_vdim[543][l]+(0.2449489742783178*f[99][l]+0.273861278752583*f[22][l])*alpha_vdim[542][l]+(0.273861278752583*f[156][l]+0.3061862178478971*f[57][l])*alpha_vdim[524][l]+(0.2449489742783178*f[66][l]+0.273861278752583*f[7][l])*alpha_vdim[523][l]+(0.273861278752583*f[154][l]+0.3061862178478971*f[60][l])*alpha_vdim[520][l]+(0.2449489742783178*f[63][l]+0.273861278752583*f[9][l])*alpha_vdim[519][l]+(0.273861278752583*f[152][l]+0.3061862178478971*f[62][l])*alpha_vdim[518][l]+0.273861278752583*f[51][l]*alpha_vdim[517][l]+(0.2449489742783178*f[155][l]+0.273861278752583*(f[67][l]+f[56][l])+0.3061862178478971*f[8][l])*alpha_vdim[508][l]+(0.2449489742783178*f[153][l]+0.273861278752583*(f[64][l]+f[59][l]))*alpha_vdim[507][l]+0.3061862178478971*(f[10][l]*alpha_vdim[507][l]+f[98][l]*alpha_vdim[503][l])+0.273861278752583*f[23][l]*alpha_vdim[502][l]+(0.273861278752583*f[100][l]+0.3061862178478971*f[21][l])*alpha_vdim[496][l]+(0.2449489742783178*f[125][l]+0.273861278752583*(f[42][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[495][l]+(0.273861278752583*f[99][l]+0.3061862178478971*f[22][l])*alpha_vdim[494][l]+(0.2449489742783178*f[121][l]+0.273861278752583*(f[39][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[493][l]+(0.273861278752583*f[97][l]+0.3061862178478971*f[24][l])*alpha_vdim[492][l]+(0.273861278752583*f[66][l]+0.3061862178478971*f[7][l])*alpha_vdim[490][l]+0.273861278752583*f[63][l]*alpha_vdim[489][l]+0.3061862178478971*(f[9][l]*alpha_vdim[489][l]+f[51][l]*alpha_vdim[488][l])+0.273861278752583*f[61][l]*alpha_vdim[487][l]+0.3061862178478971*(f[11][l]*alpha_vdim[487][l]+f[23][l]*alpha_vdim[486][l])+(0.2449489742783178*f[171][l]+0.273861278752583*f[57][l])*alpha_vdim[372][l]+0.2449489742783178*f[160][l]*alpha_vdim[360][l]+0.273861278752583*(f[69][l]*alpha_vdim[360][l]+f[102][l]*alpha_vdim[329][l])+(0.2449489742783178*f[210][l]+0.273861278752583*(f[138][l]+f[117][l])+0.3061862178478971*f[34][l])*alpha_vdim[312][l]+(0.2449489742783178*f[113][l]+0.273861278752583*f[21][l])*alpha_vdim[311][l]+(0.2449489742783178*f[206][l]+0.273861278752583*(f[131][l]+f[129][l])+0.3061862178478971*f[44][l])*alpha_vdim[300][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[25][l])*alpha_vdim[299][l]+(0.273861278752583*f[171][l]+0.3061862178478971*f[57][l])*alpha_vdim[287][l]+(0.2449489742783178*f[81][l]+0.273861278752583*f[7][l])*alpha_vdim[286][l]+(0.273861278752583*f[160][l]+0.3061862178478971*f[69][l])*alpha_vdim[277][l]+(0.2449489742783178*f[72][l]+0.273861278752583*f[12][l])*alpha_vdim[276][l]+(0.273861278752583*f[158][l]+0.3061862178478971*f[71][l])*alpha_vdim[275][l]+0.273861278752583*f[52][l]*alpha_vdim[274][l]+(0.2449489742783178*f[170][l]+0.273861278752583*(f[82][l]+f[56][l])+0.3061862178478971*f[8][l])*alpha_vdim[268][l]+(0.2449489742783178*f[159][l]+0.273861278752583*(f[73][l]+f[68][l]))*alpha_vdim[264][l]+0.3061862178478971*(f[13][l]*alpha_vdim[264][l]+f[102][l]*alpha_vdim[260][l])+0.273861278752583*f[26][l]*alpha_vdim[259][l]+(0.273861278752583*f[113][l]+0.3061862178478971*f[21][l])*alpha_vdim[256][l]+(0.2449489742783178*f[137][l]+0.273861278752583*(f[49][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[255][l]+(0.273861278752583*f[103][l]+0.3061862178478971*f[25][l])*alpha_vdim[251][l]+(0.2449489742783178*f[130][l]+0.273861278752583*(f[45][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[250][l]+(0.273861278752583*f[101][l]+0.3061862178478971*f[27][l])*alpha_vdim[249][l]+(0.273861278752583*f[81][l]+0.3061862178478971*f[7][l])*alpha_vdim[248][l]+0.273861278752583*f[72][l]*alpha_vdim[246][l]+0.3061862178478971*(f[12][l]*alpha_vdim[246][l]+f[52][l]*alpha_vdim[245][l])+0.273861278752583*f[70][l]*alpha_vdim[244][l]+0.3061862178478971*(f[14][l]*alpha_vdim[244][l]+f[26][l]*alpha_vdim[243][l])+0.2449489742783178*(alpha_vdim[69][l]*f[213][l]+alpha_vdim[60][l]*f[207][l])+(0.2449489742783178*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l])*f[174][l]+0.2449489742783178*alpha_vdim[25][l]*f[173][l]+(0.2449489742783178*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[165][l]+0.2449489742783178*alpha_vdim[22][l]*f[164][l]+0.273861278752583*(alpha_vdim[32][l]*f[161][l]+alpha_vdim[69][l]*f[142][l])+0.2449489742783178*alpha_vdim[12][l]*f[141][l]+0.273861278752583*alpha_vdim[60][l]*f[133][l]+0.2449489742783178*alpha_vdim[9][l]*f[132][l]+0.273861278752583*(alpha_vdim[60][l]*f[129][l]+f[60][l]*alpha_vdim[129][l]+alpha_vdim[69][l]*f[120][l]+f[69][l]*alpha_vdim[120][l])+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[114][l]+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[110][l]+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[105][l]+0.273861278752583*(alpha_vdim[6][l]*f[104][l]+alpha_vdim[25][l]*f[84][l])+0.2449489742783178*alpha_vdim[43][l]*f[83][l]+0.273861278752583*(alpha_vdim[5][l]*f[83][l]+alpha_vdim[22][l]*f[78][l])+0.2449489742783178*alpha_vdim[37][l]*f[77][l]+0.273861278752583*(alpha_vdim[4][l]*f[77][l]+alpha_cdim[3][l]*f[76][l])+0.3061862178478971*alpha_vdim[32][l]*f[75][l]+0.273861278752583*alpha_vdim[1][l]*f[74][l]+0.3061862178478971*(alpha_vdim[38][l]*f[69][l]+f[38][l]*alpha_vdim[69][l])+0.273861278752583*(alpha_vdim[22][l]*f[68][l]+f[22][l]*alpha_vdim[68][l])+0.3061862178478971*(alpha_vdim[44][l]*f[60][l]+f[44][l]*alpha_vdim[60][l])+0.273861278752583*(alpha_vdim[25][l]*f[59][l]+f[25][l]*alpha_vdim[59][l])+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[53][l]+0.273861278752583*(alpha_vdim[12][l]*f[50][l]+alpha_vdim[9][l]*(f[46][l]+f[43][l])+f[9][l]*alpha_vdim[43][l]+alpha_vdim[12][l]*f[37][l]+f[12][l]*alpha_vdim[37][l])+0.3061862178478971*(alpha_cdim[0][l]*f[30][l]+alpha_vdim[6][l]*f[29][l])+0.273861278752583*alpha_vdim[16][l]*f[28][l]+0.3061862178478971*(alpha_vdim[0][l]*f[28][l]+alpha_vdim[10][l]*f[25][l]+f[10][l]*alpha_vdim[25][l]+alpha_vdim[13][l]*f[22][l]+f[13][l]*alpha_vdim[22][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[15][l]+alpha_vdim[4][l]*f[12][l]+f[4][l]*alpha_vdim[12][l]+alpha_vdim[5][l]*f[9][l]+f[5][l]*alpha_vdim[9][l]);
+    out[55][l] += (0.2449489742783178*f[155][l]+0.273861278752583*f[56][l])*alpha_vdim[606][l]+0.2449489742783178*f[153][l]*alpha_vdim[603][l]+0.273861278752583*(f[59][l]*alpha_vdim[603][l]+f[97][l]*alpha_vdim[572][l])+(0.2449489742783178*f[100][l]+0.273861278752583*f[21][l])*alpha_vdim[546][l]+(0.2449489742783178*f[203][l]+0.273861278752583*(f[125][l]+f[117][l])+0.3061862178478971*f[33][l])*alpha_vdim[545][l]+(0.2449489742783178*f[99][l]+0.273861278752583*f[22][l])*alpha_vdim[543][l]+(0.2449489742783178*f[202][l]+0.273861278752583*(f[121][l]+f[120][l])+0.3061862178478971*f[37][l])*alpha_vdim[542][l]+(0.2449489742783178*f[67][l]+0.273861278752583*f[8][l])*alpha_vdim[524][l]+(0.273861278752583*f[155][l]+0.3061862178478971*f[56][l])*alpha_vdim[523][l]+(0.2449489742783178*f[64][l]+0.273861278752583*f[10][l])*alpha_vdim[520][l]+(0.273861278752583*f[153][l]+0.3061862178478971*f[59][l])*alpha_vdim[519][l]+0.273861278752583*f[51][l]*alpha_vdim[518][l]+(0.273861278752583*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[517][l]+(0.2449489742783178*f[156][l]+0.273861278752583*(f[66][l]+f[57][l])+0.3061862178478971*f[7][l])*alpha_vdim[508][l]+(0.2449489742783178*f[154][l]+0.273861278752583*(f[63][l]+f[60][l])+0.3061862178478971*f[9][l])*alpha_vdim[507][l]+0.273861278752583*f[24][l]*alpha_vdim[503][l]+0.3061862178478971*f[97][l]*alpha_vdim[502][l]+(0.2449489742783178*f[126][l]+0.273861278752583*(f[42][l]+f[34][l])+0.3061862178478971*f[3][l])*alpha_vdim[496][l]+(0.273861278752583*f[100][l]+0.3061862178478971*f[21][l])*alpha_vdim[495][l]+(0.2449489742783178*f[122][l]+0.273861278752583*(f[39][l]+f[38][l])+0.3061862178478971*f[4][l])*alpha_vdim[494][l]+(0.273861278752583*f[99][l]+0.3061862178478971*f[22][l])*alpha_vdim[493][l]+(0.273861278752583*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[492][l]+(0.273861278752583*f[67][l]+0.3061862178478971*f[8][l])*alpha_vdim[490][l]+(0.273861278752583*f[64][l]+0.3061862178478971*f[10][l])*alpha_vdim[489][l]+0.273861278752583*f[62][l]*alpha_vdim[488][l]+0.3061862178478971*(f[11][l]*alpha_vdim[488][l]+f[51][l]*alpha_vdim[487][l]+f[24][l]*alpha_vdim[486][l])+(0.2449489742783178*f[170][l]+0.273861278752583*f[56][l])*alpha_vdim[372][l]+0.2449489742783178*f[159][l]*alpha_vdim[360][l]+0.273861278752583*(f[68][l]*alpha_vdim[360][l]+f[101][l]*alpha_vdim[329][l])+(0.2449489742783178*f[113][l]+0.273861278752583*f[21][l])*alpha_vdim[312][l]+(0.2449489742783178*f[210][l]+0.273861278752583*(f[137][l]+f[117][l])+0.3061862178478971*f[33][l])*alpha_vdim[311][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[25][l])*alpha_vdim[300][l]+(0.2449489742783178*f[206][l]+0.273861278752583*(f[130][l]+f[129][l])+0.3061862178478971*f[43][l])*alpha_vdim[299][l]+(0.2449489742783178*f[82][l]+0.273861278752583*f[8][l])*alpha_vdim[287][l]+(0.273861278752583*f[170][l]+0.3061862178478971*f[56][l])*alpha_vdim[286][l]+(0.2449489742783178*f[73][l]+0.273861278752583*f[13][l])*alpha_vdim[277][l]+(0.273861278752583*f[159][l]+0.3061862178478971*f[68][l])*alpha_vdim[276][l]+0.273861278752583*f[52][l]*alpha_vdim[275][l]+(0.273861278752583*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[274][l]+(0.2449489742783178*f[171][l]+0.273861278752583*(f[81][l]+f[57][l])+0.3061862178478971*f[7][l])*alpha_vdim[268][l]+(0.2449489742783178*f[160][l]+0.273861278752583*(f[72][l]+f[69][l])+0.3061862178478971*f[12][l])*alpha_vdim[264][l]+0.273861278752583*f[27][l]*alpha_vdim[260][l]+0.3061862178478971*f[101][l]*alpha_vdim[259][l]+(0.2449489742783178*f[138][l]+0.273861278752583*(f[49][l]+f[34][l])+0.3061862178478971*f[3][l])*alpha_vdim[256][l]+(0.273861278752583*f[113][l]+0.3061862178478971*f[21][l])*alpha_vdim[255][l]+(0.2449489742783178*f[131][l]+0.273861278752583*(f[45][l]+f[44][l])+0.3061862178478971*f[5][l])*alpha_vdim[251][l]+(0.273861278752583*f[103][l]+0.3061862178478971*f[25][l])*alpha_vdim[250][l]+(0.273861278752583*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[249][l]+(0.273861278752583*f[82][l]+0.3061862178478971*f[8][l])*alpha_vdim[248][l]+(0.273861278752583*f[79][l]+0.3061862178478971*f[14][l])*alpha_cdim[247][l]+(0.273861278752583*f[73][l]+0.3061862178478971*f[13][l])*alpha_vdim[246][l]+0.273861278752583*f[71][l]*alpha_vdim[245][l]+0.3061862178478971*(f[14][l]*alpha_vdim[245][l]+f[52][l]*alpha_vdim[244][l]+f[27][l]*alpha_vdim[243][l]+f[30][l]*alpha_cdim[243][l])+0.2449489742783178*(alpha_vdim[68][l]*f[213][l]+alpha_vdim[59][l]*f[207][l]+alpha_vdim[25][l]*f[174][l])+(0.2449489742783178*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[43][l])*f[173][l]+0.2449489742783178*(alpha_vdim[22][l]*f[165][l]+alpha_vdim[120][l]*f[164][l])+0.273861278752583*(alpha_vdim[37][l]*f[164][l]+alpha_vdim[31][l]*f[161][l])+0.2449489742783178*alpha_vdim[13][l]*f[142][l]+0.273861278752583*alpha_vdim[68][l]*f[141][l]+0.2449489742783178*alpha_vdim[10][l]*f[133][l]+0.273861278752583*(alpha_vdim[59][l]*(f[132][l]+f[129][l])+f[59][l]*alpha_vdim[129][l]+alpha_vdim[68][l]*f[120][l]+f[68][l]*alpha_vdim[120][l])+(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[114][l]+0.2449489742783178*alpha_vdim[60][l]*f[110][l]+0.273861278752583*(alpha_vdim[9][l]*f[110][l]+alpha_vdim[6][l]*f[105][l])+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[104][l]+0.2449489742783178*alpha_vdim[44][l]*f[84][l]+0.273861278752583*(alpha_vdim[5][l]*f[84][l]+alpha_vdim[25][l]*f[83][l])+0.2449489742783178*alpha_vdim[38][l]*f[78][l]+0.273861278752583*(alpha_vdim[4][l]*f[78][l]+alpha_vdim[22][l]*f[77][l]+alpha_vdim[2][l]*f[75][l])+0.3061862178478971*alpha_vdim[31][l]*f[74][l]+0.273861278752583*(alpha_vdim[22][l]*f[69][l]+f[22][l]*alpha_vdim[69][l])+0.3061862178478971*(alpha_vdim[37][l]*f[68][l]+f[37][l]*alpha_vdim[68][l])+0.273861278752583*(alpha_vdim[25][l]*f[60][l]+f[25][l]*alpha_vdim[60][l])+0.3061862178478971*(alpha_vdim[43][l]*f[59][l]+f[43][l]*alpha_vdim[59][l])+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[53][l]+0.273861278752583*(alpha_vdim[13][l]*f[50][l]+alpha_vdim[10][l]*(f[46][l]+f[44][l])+f[10][l]*alpha_vdim[44][l]+alpha_vdim[13][l]*f[38][l]+f[13][l]*alpha_vdim[38][l]+alpha_vdim[17][l]*f[29][l])+0.3061862178478971*(alpha_vdim[0][l]*f[29][l]+alpha_vdim[6][l]*f[28][l]+alpha_vdim[9][l]*f[25][l]+f[9][l]*alpha_vdim[25][l]+alpha_vdim[12][l]*f[22][l]+f[12][l]*alpha_vdim[22][l]+alpha_vdim[2][l]*f[15][l]+alpha_vdim[4][l]*f[13][l]+f[4][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*f[10][l]+f[5][l]*alpha_vdim[10][l]);
+    out[56][l] += 0.3061862178478971*(f[61][l]*alpha_cdim[247][l]+f[33][l]*alpha_cdim[243][l])+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[129][l]+(0.1749635530559412*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[129][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[120][l]+(0.1749635530559412*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[120][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[86][l]+(0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[86][l]+0.2449489742783178*(alpha_vdim[25][l]*f[69][l]+f[25][l]*alpha_vdim[69][l])+(0.273861278752583*alpha_vdim[44][l]+0.1956151991089878*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[68][l]+(0.273861278752583*f[44][l]+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[68][l]+0.2449489742783178*(alpha_vdim[22][l]*f[60][l]+f[22][l]*alpha_vdim[60][l])+(0.273861278752583*alpha_vdim[38][l]+0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[59][l]+(0.273861278752583*f[38][l]+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[59][l]+0.6123724356957944*alpha_cdim[3][l]*f[58][l]+0.3061862178478971*(alpha_vdim[13][l]*f[43][l]+f[13][l]*alpha_vdim[43][l]+alpha_vdim[10][l]*f[37][l]+f[10][l]*alpha_vdim[37][l])+0.2449489742783178*(alpha_vdim[6][l]*f[32][l]+f[6][l]*alpha_vdim[32][l])+(0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[31][l]+(0.273861278752583*f[17][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[31][l]+0.273861278752583*(alpha_vdim[12][l]*f[25][l]+f[12][l]*alpha_vdim[25][l]+alpha_vdim[9][l]*f[22][l]+f[9][l]*alpha_vdim[22][l])+0.6846531968814573*alpha_cdim[0][l]*f[21][l]+0.3061862178478971*(alpha_vdim[2][l]*f[16][l]+f[2][l]*alpha_vdim[16][l])+0.6846531968814573*alpha_cdim[3][l]*f[6][l]+0.273861278752583*(alpha_vdim[1][l]*f[6][l]+f[1][l]*alpha_vdim[6][l]);
+    out[57][l] += 0.6846531968814573*(f[51][l]*alpha_cdim[247][l]+f[21][l]*alpha_cdim[243][l])+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[129][l]+(0.1749635530559412*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[129][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[120][l]+0.1749635530559412*f[60][l]*alpha_vdim[120][l]+0.273861278752583*(f[9][l]*alpha_vdim[120][l]+alpha_cdim[3][l]*f[88][l])+(0.1749635530559412*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[86][l]+(0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[86][l]+(0.1956151991089878*alpha_vdim[44][l]+0.273861278752583*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[69][l]+(0.1956151991089878*f[44][l]+0.273861278752583*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[69][l]+0.2449489742783178*(alpha_vdim[25][l]*f[68][l]+f[25][l]*alpha_vdim[68][l])+(0.1956151991089878*alpha_vdim[38][l]+0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[60][l]+(0.1956151991089878*f[38][l]+0.273861278752583*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[60][l]+0.2449489742783178*(alpha_vdim[22][l]*f[59][l]+f[22][l]*alpha_vdim[59][l])+0.3061862178478971*(alpha_vdim[12][l]*f[44][l]+f[12][l]*alpha_vdim[44][l]+alpha_vdim[9][l]*f[38][l]+f[9][l]*alpha_vdim[38][l]+alpha_cdim[0][l]*f[34][l])+(0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[32][l]+(0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[32][l]+0.2449489742783178*(alpha_vdim[6][l]*f[31][l]+f[6][l]*alpha_vdim[31][l])+0.273861278752583*(alpha_vdim[13][l]*f[25][l]+f[13][l]*alpha_vdim[25][l]+alpha_vdim[10][l]*f[22][l]+f[10][l]*alpha_vdim[22][l])+0.3061862178478971*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[17][l]+f[1][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[2][l]*f[6][l]+f[2][l]*alpha_vdim[6][l]);
+    out[58][l] += 0.3061862178478971*(f[63][l]*alpha_cdim[247][l]+f[35][l]*alpha_cdim[243][l])+0.5477225575051661*(alpha_vdim[25][l]*f[158][l]+alpha_vdim[22][l]*f[152][l]+f[52][l]*alpha_vdim[129][l]+f[51][l]*alpha_vdim[120][l]+alpha_vdim[6][l]*f[117][l])+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[102][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[101][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[98][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[97][l]+0.5477225575051661*f[21][l]*alpha_vdim[86][l]+0.6123724356957944*(alpha_vdim[25][l]*(f[71][l]+f[70][l])+f[27][l]*alpha_vdim[69][l]+f[26][l]*alpha_vdim[68][l]+alpha_vdim[22][l]*(f[62][l]+f[61][l])+f[24][l]*alpha_vdim[60][l]+f[23][l]*alpha_vdim[59][l])+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[57][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[56][l]+(0.6123724356957944*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6846531968814573*alpha_vdim[5][l])*f[52][l]+(0.6123724356957944*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[51][l]+0.3061862178478971*alpha_cdim[0][l]*f[36][l]+0.6123724356957944*(alpha_vdim[6][l]*(f[34][l]+f[33][l])+f[8][l]*alpha_vdim[32][l]+f[7][l]*alpha_vdim[31][l])+0.6846531968814573*(alpha_vdim[12][l]*f[27][l]+alpha_vdim[13][l]*f[26][l]+f[14][l]*alpha_vdim[25][l]+alpha_vdim[9][l]*f[24][l]+alpha_vdim[10][l]*f[23][l]+f[11][l]*alpha_vdim[22][l])+(0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[21][l]+0.273861278752583*alpha_cdim[3][l]*f[8][l]+0.6846531968814573*(alpha_vdim[1][l]*f[8][l]+alpha_vdim[2][l]*f[7][l]+f[3][l]*alpha_vdim[6][l]);
+    out[59][l] += (0.1749635530559412*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[372][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[360][l]+(0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[329][l]+0.2449489742783178*f[25][l]*alpha_vdim[312][l]+(0.1749635530559412*f[129][l]+0.273861278752583*f[44][l]+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[311][l]+0.2449489742783178*f[21][l]*alpha_vdim[300][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[34][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[299][l]+0.273861278752583*f[68][l]*alpha_vdim[287][l]+(0.1956151991089878*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[286][l]+0.273861278752583*f[56][l]*alpha_vdim[277][l]+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[276][l]+0.2449489742783178*f[6][l]*alpha_vdim[275][l]+(0.1749635530559412*f[86][l]+0.273861278752583*f[17][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[274][l]+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[268][l]+0.2449489742783178*f[57][l]*alpha_vdim[264][l]+0.273861278752583*(f[7][l]*alpha_vdim[264][l]+f[31][l]*alpha_vdim[260][l])+(0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[259][l]+(0.273861278752583*f[129][l]+0.3061862178478971*f[43][l])*alpha_vdim[256][l]+0.273861278752583*f[25][l]*alpha_vdim[255][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[251][l]+0.273861278752583*f[21][l]*alpha_vdim[250][l]+(0.2449489742783178*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[249][l]+0.3061862178478971*f[68][l]*alpha_vdim[248][l]+0.273861278752583*f[89][l]*alpha_cdim[247][l]+0.3061862178478971*(f[16][l]*alpha_cdim[247][l]+f[56][l]*alpha_vdim[246][l])+(0.273861278752583*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[245][l]+0.273861278752583*f[6][l]*alpha_vdim[244][l]+0.3061862178478971*(f[31][l]*alpha_vdim[243][l]+f[37][l]*alpha_cdim[243][l])+0.6846531968814573*(alpha_cdim[3][l]*f[51][l]+alpha_cdim[0][l]*f[22][l]);
+    out[60][l] += (0.1749635530559412*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[372][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[360][l]+(0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[329][l]+(0.1749635530559412*f[129][l]+0.1956151991089878*f[44][l]+0.273861278752583*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[312][l]+0.2449489742783178*f[25][l]*alpha_vdim[311][l]+(0.1749635530559412*f[117][l]+0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[300][l]+0.2449489742783178*f[21][l]*alpha_vdim[299][l]+(0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[287][l]+0.273861278752583*f[69][l]*alpha_vdim[286][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[277][l]+0.273861278752583*f[57][l]*alpha_vdim[276][l]+(0.1749635530559412*f[86][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[275][l]+0.2449489742783178*f[6][l]*alpha_vdim[274][l]+(0.2449489742783178*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[268][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[264][l]+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[260][l]+0.273861278752583*(f[32][l]*alpha_vdim[259][l]+f[25][l]*alpha_vdim[256][l])+(0.273861278752583*f[129][l]+0.3061862178478971*f[44][l])*alpha_vdim[255][l]+0.273861278752583*f[21][l]*alpha_vdim[251][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[250][l]+(0.2449489742783178*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[249][l]+0.3061862178478971*f[69][l]*alpha_vdim[248][l]+(0.6123724356957944*f[65][l]+0.6846531968814573*f[6][l])*alpha_cdim[247][l]+0.3061862178478971*f[57][l]*alpha_vdim[246][l]+0.273861278752583*(f[6][l]*alpha_vdim[245][l]+f[86][l]*alpha_vdim[244][l])+0.3061862178478971*(f[17][l]*alpha_vdim[244][l]+f[32][l]*alpha_vdim[243][l])+0.6846531968814573*f[22][l]*alpha_cdim[243][l]+0.3061862178478971*(alpha_cdim[3][l]*f[62][l]+alpha_cdim[0][l]*f[38][l]);
+    out[61][l] += (0.1956151991089878*f[158][l]+0.3061862178478971*f[71][l])*alpha_vdim[372][l]+(0.1749635530559412*f[182][l]+0.273861278752583*f[88][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[360][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[329][l]+0.273861278752583*f[102][l]*alpha_vdim[312][l]+(0.1956151991089878*f[101][l]+0.3061862178478971*f[27][l])*alpha_vdim[311][l]+(0.2449489742783178*f[119][l]+0.273861278752583*f[32][l])*alpha_vdim[300][l]+(0.1749635530559412*f[118][l]+0.273861278752583*f[36][l]+0.1956151991089878*f[31][l])*alpha_vdim[299][l]+0.3061862178478971*(f[2][l]*alpha_vdim[299][l]+f[158][l]*alpha_vdim[287][l])+(0.1956151991089878*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[286][l]+(0.273861278752583*f[182][l]+0.3061862178478971*f[86][l])*alpha_vdim[277][l]+(0.1749635530559412*f[87][l]+0.273861278752583*f[18][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[276][l]+0.273861278752583*f[57][l]*alpha_vdim[275][l]+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[274][l]+0.273861278752583*f[52][l]*alpha_vdim[268][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[264][l]+0.3061862178478971*f[117][l]*alpha_vdim[260][l]+0.1956151991089878*f[33][l]*alpha_vdim[259][l]+0.3061862178478971*(f[3][l]*alpha_vdim[259][l]+f[101][l]*alpha_vdim[256][l])+0.273861278752583*f[26][l]*alpha_vdim[255][l]+(0.273861278752583*f[118][l]+0.3061862178478971*f[31][l])*alpha_vdim[251][l]+0.2449489742783178*f[35][l]*alpha_vdim[250][l]+0.273861278752583*(f[1][l]*alpha_vdim[250][l]+f[21][l]*alpha_vdim[249][l])+0.3061862178478971*f[70][l]*alpha_vdim[248][l]+0.273861278752583*f[87][l]*alpha_vdim[246][l]+0.3061862178478971*(f[16][l]*alpha_vdim[246][l]+f[56][l]*alpha_vdim[245][l])+0.273861278752583*f[7][l]*alpha_vdim[244][l]+0.3061862178478971*f[33][l]*alpha_vdim[243][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[183][l]+0.1956151991089878*alpha_vdim[129][l]*f[161][l]+0.3061862178478971*(alpha_vdim[44][l]*f[161][l]+f[75][l]*alpha_vdim[129][l])+0.2449489742783178*alpha_vdim[60][l]*f[124][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[123][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[120][l]+(0.273861278752583*f[90][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[69][l]*f[105][l]+(0.1956151991089878*alpha_vdim[68][l]+0.3061862178478971*alpha_vdim[13][l])*f[104][l]+(0.1749635530559412*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[89][l]+0.3061862178478971*(alpha_vdim[38][l]*f[86][l]+f[38][l]*alpha_vdim[86][l])+0.1956151991089878*alpha_vdim[43][l]*f[74][l]+0.3061862178478971*(alpha_vdim[5][l]*f[74][l]+f[29][l]*alpha_vdim[68][l])+0.2449489742783178*alpha_vdim[22][l]*f[65][l]+0.6123724356957944*alpha_cdim[3][l]*f[63][l]+0.273861278752583*(alpha_vdim[32][l]*f[60][l]+f[32][l]*alpha_vdim[60][l])+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[59][l]+(0.273861278752583*f[41][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[25][l]*f[53][l]+0.3061862178478971*f[15][l]*alpha_vdim[43][l]+0.2449489742783178*alpha_vdim[9][l]*f[40][l]+(0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[37][l]+(0.273861278752583*f[19][l]+0.1956151991089878*f[16][l])*alpha_vdim[37][l]+0.3061862178478971*(f[0][l]*alpha_vdim[37][l]+alpha_vdim[10][l]*f[31][l]+f[10][l]*alpha_vdim[31][l])+0.273861278752583*alpha_vdim[12][l]*f[28][l]+0.6846531968814573*alpha_cdim[0][l]*f[23][l]+0.273861278752583*(alpha_vdim[6][l]*f[22][l]+f[6][l]*alpha_vdim[22][l])+0.3061862178478971*(alpha_vdim[4][l]*f[16][l]+f[4][l]*alpha_vdim[16][l])+0.6846531968814573*alpha_cdim[3][l]*f[9][l]+0.273861278752583*(alpha_vdim[1][l]*f[9][l]+f[1][l]*alpha_vdim[9][l]);
+    out[62][l] += (0.1956151991089878*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[372][l]+(0.1749635530559412*f[182][l]+0.273861278752583*f[87][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[360][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[329][l]+(0.1956151991089878*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[312][l]+0.273861278752583*f[101][l]*alpha_vdim[311][l]+(0.1749635530559412*f[119][l]+0.273861278752583*f[35][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[300][l]+(0.2449489742783178*f[118][l]+0.273861278752583*f[31][l])*alpha_vdim[299][l]+0.1956151991089878*f[71][l]*alpha_vdim[287][l]+0.3061862178478971*(f[14][l]*alpha_vdim[287][l]+f[158][l]*alpha_vdim[286][l])+(0.1749635530559412*f[88][l]+0.273861278752583*f[18][l]+0.1956151991089878*f[17][l]+0.3061862178478971*f[0][l])*alpha_vdim[277][l]+(0.273861278752583*f[182][l]+0.3061862178478971*f[86][l])*alpha_vdim[276][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[275][l]+0.273861278752583*(f[56][l]*alpha_vdim[274][l]+f[52][l]*alpha_vdim[268][l])+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[264][l]+0.1956151991089878*f[34][l]*alpha_vdim[260][l]+0.3061862178478971*(f[3][l]*alpha_vdim[260][l]+f[117][l]*alpha_vdim[259][l])+0.273861278752583*f[27][l]*alpha_vdim[256][l]+0.3061862178478971*f[102][l]*alpha_vdim[255][l]+(0.2449489742783178*f[36][l]+0.273861278752583*f[2][l])*alpha_vdim[251][l]+(0.273861278752583*f[119][l]+0.3061862178478971*f[32][l])*alpha_vdim[250][l]+0.273861278752583*f[21][l]*alpha_vdim[249][l]+0.3061862178478971*f[71][l]*alpha_vdim[248][l]+(0.6123724356957944*f[67][l]+0.6846531968814573*f[8][l])*alpha_cdim[247][l]+(0.273861278752583*f[88][l]+0.3061862178478971*f[17][l])*alpha_vdim[246][l]+0.273861278752583*f[8][l]*alpha_vdim[245][l]+0.3061862178478971*(f[57][l]*alpha_vdim[244][l]+f[34][l]*alpha_vdim[243][l])+0.6846531968814573*f[24][l]*alpha_cdim[243][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[37][l])*f[183][l]+0.1956151991089878*alpha_vdim[129][l]*f[161][l]+0.3061862178478971*(alpha_vdim[43][l]*f[161][l]+f[74][l]*alpha_vdim[129][l])+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[124][l]+0.2449489742783178*alpha_vdim[59][l]*f[123][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[120][l]+(0.273861278752583*f[89][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[120][l]+(0.1956151991089878*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[105][l]+0.273861278752583*alpha_vdim[68][l]*f[104][l]+(0.1749635530559412*alpha_vdim[38][l]+0.273861278752583*alpha_vdim[4][l])*f[90][l]+0.3061862178478971*(alpha_vdim[37][l]*f[86][l]+f[37][l]*alpha_vdim[86][l])+0.1956151991089878*alpha_vdim[44][l]*f[75][l]+0.3061862178478971*(alpha_vdim[5][l]*f[75][l]+f[28][l]*alpha_vdim[69][l])+0.2449489742783178*alpha_vdim[22][l]*f[65][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[60][l]+(0.273861278752583*f[40][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[60][l]+0.273861278752583*(alpha_vdim[31][l]*f[59][l]+f[31][l]*alpha_vdim[59][l]+alpha_vdim[25][l]*f[53][l])+0.3061862178478971*f[15][l]*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[10][l]*f[41][l]+(0.1956151991089878*alpha_vdim[17][l]+0.3061862178478971*alpha_vdim[0][l])*f[38][l]+(0.273861278752583*f[19][l]+0.1956151991089878*f[17][l])*alpha_vdim[38][l]+0.3061862178478971*(f[0][l]*alpha_vdim[38][l]+alpha_vdim[9][l]*f[32][l]+f[9][l]*alpha_vdim[32][l])+0.273861278752583*(alpha_vdim[13][l]*f[29][l]+alpha_vdim[6][l]*f[22][l]+f[6][l]*alpha_vdim[22][l])+0.3061862178478971*(alpha_vdim[4][l]*f[17][l]+f[4][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[2][l]*f[10][l]+f[2][l]*alpha_vdim[10][l]);
+    out[63][l] += 0.273861278752583*f[160][l]*alpha_vdim[372][l]+0.2449489742783178*f[57][l]*alpha_vdim[360][l]+0.273861278752583*f[119][l]*alpha_vdim[329][l]+(0.273861278752583*f[206][l]+0.3061862178478971*f[131][l])*alpha_vdim[312][l]+0.273861278752583*f[103][l]*alpha_vdim[311][l]+(0.2449489742783178*f[117][l]+0.273861278752583*f[34][l])*alpha_vdim[300][l]+0.2449489742783178*f[21][l]*alpha_vdim[299][l]+0.3061862178478971*f[160][l]*alpha_vdim[287][l]+0.273861278752583*(f[72][l]*alpha_vdim[286][l]+f[57][l]*alpha_vdim[277][l])+0.2449489742783178*f[7][l]*alpha_vdim[276][l]+(0.273861278752583*f[182][l]+0.3061862178478971*f[88][l])*alpha_vdim[275][l]+0.273861278752583*f[58][l]*alpha_vdim[274][l]+(0.273861278752583*f[159][l]+0.3061862178478971*f[73][l])*alpha_vdim[268][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[264][l]+0.3061862178478971*f[119][l]*alpha_vdim[260][l]+0.273861278752583*f[35][l]*alpha_vdim[259][l]+0.3061862178478971*f[103][l]*alpha_vdim[256][l]+(0.273861278752583*f[130][l]+0.3061862178478971*f[45][l])*alpha_vdim[255][l]+0.273861278752583*f[21][l]*alpha_vdim[251][l]+0.2449489742783178*f[33][l]*alpha_vdim[250][l]+0.273861278752583*(f[3][l]*alpha_vdim[250][l]+f[118][l]*alpha_vdim[249][l])+0.3061862178478971*(f[36][l]*alpha_vdim[249][l]+f[72][l]*alpha_vdim[248][l])+0.273861278752583*f[7][l]*alpha_vdim[246][l]+0.3061862178478971*f[58][l]*alpha_vdim[245][l]+0.273861278752583*f[87][l]*alpha_vdim[244][l]+0.3061862178478971*(f[18][l]*alpha_vdim[244][l]+f[35][l]*alpha_vdim[243][l])+0.5477225575051661*alpha_vdim[60][l]*f[203][l]+0.6123724356957944*alpha_vdim[69][l]*f[192][l]+(0.5477225575051661*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[156][l]+0.5477225575051661*alpha_vdim[22][l]*f[155][l]+0.6123724356957944*alpha_vdim[32][l]*f[152][l]+(0.6123724356957944*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[44][l])*f[148][l]+0.6123724356957944*(alpha_vdim[25][l]*f[147][l]+alpha_vdim[60][l]*f[126][l])+0.5477225575051661*alpha_vdim[9][l]*f[125][l]+0.6123724356957944*(f[57][l]*alpha_vdim[120][l]+alpha_vdim[60][l]*f[117][l])+0.6846531968814573*alpha_vdim[69][l]*f[107][l]+0.6123724356957944*alpha_vdim[12][l]*f[106][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[100][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[98][l]+0.6123724356957944*alpha_vdim[6][l]*f[97][l]+(0.6123724356957944*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[13][l])*f[96][l]+0.6123724356957944*alpha_vdim[22][l]*f[67][l]+(0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[66][l]+0.6846531968814573*alpha_vdim[32][l]*f[62][l]+0.6123724356957944*alpha_vdim[1][l]*f[61][l]+0.6846531968814573*f[34][l]*alpha_vdim[60][l]+0.6123724356957944*f[21][l]*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[38][l]*f[57][l]+0.6123724356957944*alpha_vdim[22][l]*f[56][l]+0.6846531968814573*alpha_vdim[25][l]*f[55][l]+(0.6123724356957944*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[54][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[51][l]+0.6123724356957944*alpha_vdim[9][l]*f[42][l]+0.3061862178478971*alpha_cdim[0][l]*f[39][l]+0.6123724356957944*(f[7][l]*alpha_vdim[37][l]+alpha_vdim[9][l]*f[33][l])+0.6846531968814573*(alpha_vdim[12][l]*f[30][l]+alpha_vdim[6][l]*f[24][l])+0.6123724356957944*alpha_vdim[16][l]*f[23][l]+0.6846531968814573*(alpha_vdim[0][l]*f[23][l]+f[8][l]*alpha_vdim[22][l]+alpha_vdim[10][l]*f[21][l])+0.273861278752583*alpha_cdim[3][l]*f[11][l]+0.6846531968814573*(alpha_vdim[1][l]*f[11][l]+f[3][l]*alpha_vdim[9][l]+alpha_vdim[4][l]*f[7][l]);
+    out[64][l] += 0.273861278752583*f[159][l]*alpha_vdim[372][l]+0.2449489742783178*f[56][l]*alpha_vdim[360][l]+0.273861278752583*(f[118][l]*alpha_vdim[329][l]+f[103][l]*alpha_vdim[312][l])+(0.273861278752583*f[206][l]+0.3061862178478971*f[130][l])*alpha_vdim[311][l]+0.2449489742783178*(f[21][l]*alpha_vdim[300][l]+f[117][l]*alpha_vdim[299][l])+0.273861278752583*(f[33][l]*alpha_vdim[299][l]+f[73][l]*alpha_vdim[287][l])+0.3061862178478971*f[159][l]*alpha_vdim[286][l]+0.2449489742783178*f[8][l]*alpha_vdim[277][l]+0.273861278752583*(f[56][l]*alpha_vdim[276][l]+f[58][l]*alpha_vdim[275][l])+(0.273861278752583*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[274][l]+(0.273861278752583*f[160][l]+0.3061862178478971*f[72][l])*alpha_vdim[268][l]+0.2449489742783178*f[57][l]*alpha_vdim[264][l]+0.273861278752583*(f[7][l]*alpha_vdim[264][l]+f[36][l]*alpha_vdim[260][l])+0.3061862178478971*f[118][l]*alpha_vdim[259][l]+0.273861278752583*f[131][l]*alpha_vdim[256][l]+0.3061862178478971*(f[45][l]*alpha_vdim[256][l]+f[103][l]*alpha_vdim[255][l])+0.2449489742783178*f[34][l]*alpha_vdim[251][l]+0.273861278752583*(f[3][l]*alpha_vdim[251][l]+f[21][l]*alpha_vdim[250][l]+f[119][l]*alpha_vdim[249][l])+0.3061862178478971*(f[35][l]*alpha_vdim[249][l]+f[73][l]*alpha_vdim[248][l])+(0.273861278752583*f[91][l]+0.3061862178478971*f[18][l])*alpha_cdim[247][l]+0.273861278752583*(f[8][l]*alpha_vdim[246][l]+f[88][l]*alpha_vdim[245][l])+0.3061862178478971*(f[18][l]*alpha_vdim[245][l]+f[58][l]*alpha_vdim[244][l]+f[36][l]*alpha_vdim[243][l]+f[39][l]*alpha_cdim[243][l])+0.5477225575051661*alpha_vdim[59][l]*f[203][l]+0.6123724356957944*alpha_vdim[68][l]*f[192][l]+0.5477225575051661*(alpha_vdim[22][l]*f[156][l]+alpha_vdim[120][l]*f[155][l])+0.6123724356957944*(alpha_vdim[37][l]*f[155][l]+alpha_vdim[31][l]*f[152][l]+alpha_vdim[25][l]*f[148][l])+(0.6123724356957944*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[43][l])*f[147][l]+0.5477225575051661*alpha_vdim[10][l]*f[126][l]+0.6123724356957944*(alpha_vdim[59][l]*f[125][l]+f[56][l]*alpha_vdim[120][l]+alpha_vdim[59][l]*f[117][l]+alpha_vdim[13][l]*f[107][l])+0.6846531968814573*alpha_vdim[68][l]*f[106][l]+0.5477225575051661*alpha_vdim[60][l]*f[100][l]+0.6123724356957944*(alpha_vdim[9][l]*f[100][l]+alpha_vdim[6][l]*f[98][l])+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[97][l]+(0.6123724356957944*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[96][l]+0.5477225575051661*alpha_vdim[38][l]*f[67][l]+0.6123724356957944*(alpha_vdim[4][l]*f[67][l]+alpha_vdim[22][l]*f[66][l]+alpha_vdim[2][l]*f[62][l])+0.6846531968814573*alpha_vdim[31][l]*f[61][l]+0.6123724356957944*f[21][l]*alpha_vdim[60][l]+0.6846531968814573*f[33][l]*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[22][l]*f[57][l]+0.6846531968814573*alpha_vdim[37][l]*f[56][l]+0.6123724356957944*alpha_vdim[44][l]*f[55][l]+0.6846531968814573*(alpha_vdim[5][l]*f[55][l]+alpha_vdim[25][l]*f[54][l])+(0.6123724356957944*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[51][l]+0.6123724356957944*(alpha_vdim[10][l]*f[42][l]+f[8][l]*alpha_vdim[38][l]+alpha_vdim[10][l]*f[34][l])+0.6846531968814573*alpha_vdim[13][l]*f[30][l]+0.6123724356957944*alpha_vdim[17][l]*f[24][l]+0.6846531968814573*(alpha_vdim[0][l]*f[24][l]+alpha_vdim[6][l]*f[23][l]+f[7][l]*alpha_vdim[22][l]+alpha_vdim[9][l]*f[21][l]+alpha_vdim[2][l]*f[11][l]+f[3][l]*alpha_vdim[10][l]+alpha_vdim[4][l]*f[8][l]);
+    out[65][l] += 0.5477225575051661*(f[53][l]*alpha_vdim[372][l]+f[51][l]*alpha_vdim[360][l]+f[22][l]*alpha_vdim[329][l])+(0.5477225575051661*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[312][l]+(0.5477225575051661*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[311][l]+(0.5477225575051661*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[300][l]+0.5477225575051661*f[98][l]*alpha_vdim[299][l]+0.6123724356957944*(f[23][l]*alpha_vdim[299][l]+f[53][l]*(alpha_vdim[287][l]+alpha_vdim[286][l])+f[51][l]*(alpha_vdim[277][l]+alpha_vdim[276][l]))+(0.5477225575051661*f[59][l]+0.6123724356957944*f[10][l])*alpha_vdim[275][l]+(0.5477225575051661*f[60][l]+0.6123724356957944*f[9][l])*alpha_vdim[274][l]+(0.5477225575051661*f[161][l]+0.6123724356957944*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[268][l]+(0.5477225575051661*f[152][l]+0.6123724356957944*(f[62][l]+f[61][l])+0.6846531968814573*f[11][l])*alpha_vdim[264][l]+0.6123724356957944*f[22][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.6123724356957944*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[256][l]+(0.6123724356957944*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[255][l]+(0.6123724356957944*f[98][l]+0.6846531968814573*f[23][l])*alpha_vdim[251][l]+(0.6123724356957944*f[97][l]+0.6846531968814573*f[24][l])*alpha_vdim[250][l]+(0.5477225575051661*f[120][l]+0.6123724356957944*(f[38][l]+f[37][l]))*alpha_vdim[249][l]+0.6846531968814573*(f[4][l]*alpha_vdim[249][l]+f[53][l]*alpha_vdim[248][l])+0.273861278752583*f[9][l]*alpha_cdim[247][l]+0.6846531968814573*f[51][l]*alpha_vdim[246][l]+(0.6123724356957944*f[60][l]+0.6846531968814573*f[9][l])*alpha_vdim[245][l]+0.6123724356957944*f[59][l]*alpha_vdim[244][l]+0.6846531968814573*(f[10][l]*alpha_vdim[244][l]+f[22][l]*alpha_vdim[243][l])+0.3061862178478971*(f[40][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[67][l]+alpha_cdim[0][l]*f[41][l]);
+    out[66][l] += 0.6123724356957944*f[148][l]*alpha_vdim[372][l]+0.5477225575051661*f[154][l]*alpha_vdim[360][l]+0.6123724356957944*(f[60][l]*alpha_vdim[360][l]+f[98][l]*alpha_vdim[329][l])+(0.6123724356957944*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[312][l]+0.6123724356957944*f[96][l]*alpha_vdim[311][l]+(0.5477225575051661*f[202][l]+0.6123724356957944*(f[122][l]+f[120][l])+0.6846531968814573*f[38][l])*alpha_vdim[300][l]+(0.5477225575051661*f[99][l]+0.6123724356957944*f[22][l])*alpha_vdim[299][l]+0.6846531968814573*f[148][l]*alpha_vdim[287][l]+0.6123724356957944*f[54][l]*alpha_vdim[286][l]+(0.6123724356957944*f[154][l]+0.6846531968814573*f[60][l])*alpha_vdim[277][l]+(0.5477225575051661*f[63][l]+0.6123724356957944*f[9][l])*alpha_vdim[276][l]+(0.6123724356957944*f[152][l]+0.6846531968814573*f[62][l])*alpha_vdim[275][l]+0.6123724356957944*f[51][l]*alpha_vdim[274][l]+(0.6123724356957944*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[268][l]+(0.5477225575051661*f[153][l]+0.6123724356957944*(f[64][l]+f[59][l]))*alpha_vdim[264][l]+0.6846531968814573*(f[10][l]*alpha_vdim[264][l]+f[98][l]*alpha_vdim[260][l])+0.6123724356957944*f[23][l]*alpha_vdim[259][l]+0.6846531968814573*f[96][l]*alpha_vdim[256][l]+(0.6123724356957944*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[255][l]+(0.6123724356957944*f[99][l]+0.6846531968814573*f[22][l])*alpha_vdim[251][l]+(0.5477225575051661*f[121][l]+0.6123724356957944*(f[39][l]+f[37][l])+0.6846531968814573*f[4][l])*alpha_vdim[250][l]+0.6123724356957944*f[97][l]*alpha_vdim[249][l]+0.6846531968814573*(f[24][l]*alpha_vdim[249][l]+f[54][l]*alpha_vdim[248][l])+0.6123724356957944*f[63][l]*alpha_vdim[246][l]+0.6846531968814573*(f[9][l]*alpha_vdim[246][l]+f[51][l]*alpha_vdim[245][l])+0.6123724356957944*f[61][l]*alpha_vdim[244][l]+0.6846531968814573*(f[11][l]*alpha_vdim[244][l]+f[23][l]*alpha_vdim[243][l])+0.273861278752583*(alpha_vdim[69][l]*f[207][l]+alpha_vdim[32][l]*f[183][l])+(0.273861278752583*alpha_vdim[129][l]+0.3061862178478971*alpha_vdim[44][l])*f[165][l]+0.273861278752583*alpha_vdim[25][l]*f[164][l]+0.3061862178478971*alpha_vdim[69][l]*f[133][l]+0.273861278752583*alpha_vdim[12][l]*f[132][l]+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[124][l]+0.273861278752583*alpha_vdim[6][l]*f[123][l]+0.2449489742783178*(alpha_vdim[60][l]*f[120][l]+f[60][l]*alpha_vdim[120][l])+(0.273861278752583*alpha_vdim[68][l]+0.3061862178478971*alpha_vdim[13][l])*f[110][l]+0.273861278752583*alpha_cdim[3][l]*f[91][l]+0.3061862178478971*alpha_vdim[32][l]*f[90][l]+0.273861278752583*alpha_vdim[1][l]*f[89][l]+0.3061862178478971*alpha_vdim[25][l]*f[78][l]+(0.273861278752583*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[77][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[65][l]+0.273861278752583*(alpha_vdim[38][l]*f[60][l]+f[38][l]*alpha_vdim[60][l])+0.2449489742783178*(alpha_vdim[22][l]*f[59][l]+f[22][l]*alpha_vdim[59][l])+0.3061862178478971*(alpha_vdim[12][l]*f[46][l]+alpha_cdim[0][l]*f[42][l]+alpha_vdim[6][l]*f[41][l])+(0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[40][l]+0.2449489742783178*(alpha_vdim[9][l]*f[37][l]+f[9][l]*alpha_vdim[37][l])+0.273861278752583*(alpha_vdim[10][l]*f[22][l]+f[10][l]*alpha_vdim[22][l])+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l])*f[19][l]+0.273861278752583*(alpha_vdim[4][l]*f[9][l]+f[4][l]*alpha_vdim[9][l]);
+    out[67][l] += 0.6123724356957944*f[147][l]*alpha_vdim[372][l]+0.5477225575051661*f[153][l]*alpha_vdim[360][l]+0.6123724356957944*(f[59][l]*alpha_vdim[360][l]+f[97][l]*alpha_vdim[329][l]+f[96][l]*alpha_vdim[312][l])+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[311][l]+(0.5477225575051661*f[99][l]+0.6123724356957944*f[22][l])*alpha_vdim[300][l]+(0.5477225575051661*f[202][l]+0.6123724356957944*(f[121][l]+f[120][l])+0.6846531968814573*f[37][l])*alpha_vdim[299][l]+0.6123724356957944*f[55][l]*alpha_vdim[287][l]+0.6846531968814573*f[147][l]*alpha_vdim[286][l]+(0.5477225575051661*f[64][l]+0.6123724356957944*f[10][l])*alpha_vdim[277][l]+(0.6123724356957944*f[153][l]+0.6846531968814573*f[59][l])*alpha_vdim[276][l]+0.6123724356957944*f[51][l]*alpha_vdim[275][l]+(0.6123724356957944*f[152][l]+0.6846531968814573*f[61][l])*alpha_vdim[274][l]+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[268][l]+(0.5477225575051661*f[154][l]+0.6123724356957944*(f[63][l]+f[60][l])+0.6846531968814573*f[9][l])*alpha_vdim[264][l]+0.6123724356957944*f[24][l]*alpha_vdim[260][l]+0.6846531968814573*f[97][l]*alpha_vdim[259][l]+0.6123724356957944*f[107][l]*alpha_vdim[256][l]+0.6846531968814573*(f[30][l]*alpha_vdim[256][l]+f[96][l]*alpha_vdim[255][l])+(0.5477225575051661*f[122][l]+0.6123724356957944*(f[39][l]+f[38][l])+0.6846531968814573*f[4][l])*alpha_vdim[251][l]+(0.6123724356957944*f[99][l]+0.6846531968814573*f[22][l])*alpha_vdim[250][l]+0.6123724356957944*f[98][l]*alpha_vdim[249][l]+0.6846531968814573*(f[23][l]*alpha_vdim[249][l]+f[55][l]*alpha_vdim[248][l])+0.273861278752583*f[11][l]*alpha_cdim[247][l]+(0.6123724356957944*f[64][l]+0.6846531968814573*f[10][l])*alpha_vdim[246][l]+0.6123724356957944*f[62][l]*alpha_vdim[245][l]+0.6846531968814573*(f[11][l]*alpha_vdim[245][l]+f[51][l]*alpha_vdim[244][l]+f[24][l]*alpha_vdim[243][l])+0.3061862178478971*f[42][l]*alpha_cdim[243][l]+0.273861278752583*(alpha_vdim[68][l]*f[207][l]+alpha_vdim[31][l]*f[183][l]+alpha_vdim[25][l]*f[165][l])+(0.273861278752583*alpha_vdim[129][l]+0.3061862178478971*alpha_vdim[43][l])*f[164][l]+0.273861278752583*alpha_vdim[13][l]*f[133][l]+0.3061862178478971*alpha_vdim[68][l]*f[132][l]+0.273861278752583*alpha_vdim[6][l]*f[124][l]+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[123][l]+0.2449489742783178*(alpha_vdim[59][l]*f[120][l]+f[59][l]*alpha_vdim[120][l])+(0.273861278752583*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[110][l]+0.273861278752583*alpha_vdim[2][l]*f[90][l]+0.3061862178478971*alpha_vdim[31][l]*f[89][l]+0.273861278752583*alpha_vdim[44][l]*f[78][l]+0.3061862178478971*(alpha_vdim[5][l]*f[78][l]+alpha_vdim[25][l]*f[77][l])+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[65][l]+0.2449489742783178*(alpha_vdim[22][l]*f[60][l]+f[22][l]*alpha_vdim[60][l])+0.273861278752583*(alpha_vdim[37][l]*f[59][l]+f[37][l]*alpha_vdim[59][l])+0.3061862178478971*alpha_vdim[13][l]*f[46][l]+0.273861278752583*alpha_vdim[17][l]*f[41][l]+0.3061862178478971*(alpha_vdim[0][l]*f[41][l]+alpha_vdim[6][l]*f[40][l])+0.2449489742783178*(alpha_vdim[10][l]*f[38][l]+f[10][l]*alpha_vdim[38][l])+0.273861278752583*(alpha_vdim[9][l]*f[22][l]+f[9][l]*alpha_vdim[22][l])+0.3061862178478971*alpha_vdim[2][l]*f[19][l]+0.273861278752583*(alpha_vdim[4][l]*f[10][l]+f[4][l]*alpha_vdim[10][l]);
+    out[68][l] += (0.1749635530559412*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[606][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[603][l]+(0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[572][l]+0.2449489742783178*f[22][l]*alpha_vdim[546][l]+(0.1749635530559412*f[120][l]+0.273861278752583*f[38][l]+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[545][l]+0.2449489742783178*f[21][l]*alpha_vdim[543][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[34][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[542][l]+0.273861278752583*f[59][l]*alpha_vdim[524][l]+(0.1956151991089878*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[523][l]+0.273861278752583*f[56][l]*alpha_vdim[520][l]+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[519][l]+0.2449489742783178*f[6][l]*alpha_vdim[518][l]+(0.1749635530559412*f[86][l]+0.273861278752583*f[17][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[517][l]+(0.2449489742783178*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[508][l]+0.2449489742783178*f[57][l]*alpha_vdim[507][l]+0.273861278752583*(f[7][l]*alpha_vdim[507][l]+f[31][l]*alpha_vdim[503][l])+(0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[502][l]+(0.273861278752583*f[120][l]+0.3061862178478971*f[37][l])*alpha_vdim[496][l]+0.273861278752583*f[22][l]*alpha_vdim[495][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[494][l]+0.273861278752583*f[21][l]*alpha_vdim[493][l]+(0.2449489742783178*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[492][l]+0.3061862178478971*(f[59][l]*alpha_vdim[490][l]+f[56][l]*alpha_vdim[489][l])+(0.273861278752583*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[488][l]+0.273861278752583*f[6][l]*alpha_vdim[487][l]+0.3061862178478971*(f[31][l]*alpha_vdim[486][l]+f[74][l]*alpha_cdim[247][l]+f[43][l]*alpha_cdim[243][l])+0.6846531968814573*(alpha_cdim[3][l]*f[52][l]+alpha_cdim[0][l]*f[25][l]);
+    out[69][l] += (0.1749635530559412*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[606][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[603][l]+(0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[572][l]+(0.1749635530559412*f[120][l]+0.1956151991089878*f[38][l]+0.273861278752583*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[546][l]+0.2449489742783178*f[22][l]*alpha_vdim[545][l]+(0.1749635530559412*f[117][l]+0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[543][l]+0.2449489742783178*f[21][l]*alpha_vdim[542][l]+(0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[524][l]+0.273861278752583*f[60][l]*alpha_vdim[523][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[520][l]+0.273861278752583*f[57][l]*alpha_vdim[519][l]+(0.1749635530559412*f[86][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[518][l]+0.2449489742783178*f[6][l]*alpha_vdim[517][l]+(0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[508][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[507][l]+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[503][l]+0.273861278752583*(f[32][l]*alpha_vdim[502][l]+f[22][l]*alpha_vdim[496][l])+(0.273861278752583*f[120][l]+0.3061862178478971*f[38][l])*alpha_vdim[495][l]+0.273861278752583*f[21][l]*alpha_vdim[494][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[493][l]+(0.2449489742783178*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[492][l]+0.3061862178478971*(f[60][l]*alpha_vdim[490][l]+f[57][l]*alpha_vdim[489][l])+0.273861278752583*(f[6][l]*alpha_vdim[488][l]+f[86][l]*alpha_vdim[487][l])+0.3061862178478971*(f[17][l]*alpha_vdim[487][l]+f[32][l]*alpha_vdim[486][l])+0.6846531968814573*(f[53][l]*alpha_cdim[247][l]+f[25][l]*alpha_cdim[243][l])+0.3061862178478971*(alpha_cdim[3][l]*f[71][l]+alpha_cdim[0][l]*f[44][l]);
+    out[70][l] += (0.1956151991089878*f[152][l]+0.3061862178478971*f[62][l])*alpha_vdim[606][l]+(0.1749635530559412*f[182][l]+0.273861278752583*f[88][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[603][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[572][l]+0.273861278752583*f[98][l]*alpha_vdim[546][l]+(0.1956151991089878*f[97][l]+0.3061862178478971*f[24][l])*alpha_vdim[545][l]+(0.2449489742783178*f[119][l]+0.273861278752583*f[32][l])*alpha_vdim[543][l]+(0.1749635530559412*f[118][l]+0.273861278752583*f[36][l]+0.1956151991089878*f[31][l])*alpha_vdim[542][l]+0.3061862178478971*(f[2][l]*alpha_vdim[542][l]+f[152][l]*alpha_vdim[524][l])+(0.1956151991089878*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[523][l]+(0.273861278752583*f[182][l]+0.3061862178478971*f[86][l])*alpha_vdim[520][l]+(0.1749635530559412*f[87][l]+0.273861278752583*f[18][l]+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[519][l]+0.273861278752583*f[57][l]*alpha_vdim[518][l]+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[517][l]+0.273861278752583*f[51][l]*alpha_vdim[508][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[507][l]+0.3061862178478971*f[117][l]*alpha_vdim[503][l]+0.1956151991089878*f[33][l]*alpha_vdim[502][l]+0.3061862178478971*(f[3][l]*alpha_vdim[502][l]+f[97][l]*alpha_vdim[496][l])+0.273861278752583*f[23][l]*alpha_vdim[495][l]+(0.273861278752583*f[118][l]+0.3061862178478971*f[31][l])*alpha_vdim[494][l]+0.2449489742783178*f[35][l]*alpha_vdim[493][l]+0.273861278752583*(f[1][l]*alpha_vdim[493][l]+f[21][l]*alpha_vdim[492][l])+0.3061862178478971*f[61][l]*alpha_vdim[490][l]+0.273861278752583*f[87][l]*alpha_vdim[489][l]+0.3061862178478971*(f[16][l]*alpha_vdim[489][l]+f[56][l]*alpha_vdim[488][l])+0.273861278752583*f[7][l]*alpha_vdim[487][l]+0.3061862178478971*f[33][l]*alpha_vdim[486][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l])*f[186][l]+(0.1956151991089878*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[38][l])*f[161][l]+0.2449489742783178*alpha_vdim[69][l]*f[136][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[135][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[129][l]+(0.273861278752583*f[93][l]+0.1956151991089878*f[86][l])*alpha_vdim[129][l]+0.3061862178478971*(f[17][l]*alpha_vdim[129][l]+f[75][l]*alpha_vdim[120][l])+0.273861278752583*alpha_vdim[60][l]*f[105][l]+(0.1956151991089878*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[104][l]+(0.1749635530559412*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[92][l]+0.3061862178478971*(alpha_vdim[44][l]*f[86][l]+f[44][l]*alpha_vdim[86][l])+0.2449489742783178*alpha_vdim[25][l]*f[80][l]+(0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[74][l]+0.6123724356957944*alpha_cdim[3][l]*f[72][l]+0.273861278752583*(alpha_vdim[32][l]*f[69][l]+f[32][l]*alpha_vdim[69][l])+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[68][l]+(0.273861278752583*f[48][l]+0.1956151991089878*f[31][l])*alpha_vdim[68][l]+0.3061862178478971*(f[2][l]*alpha_vdim[68][l]+f[29][l]*alpha_vdim[59][l])+0.273861278752583*alpha_vdim[22][l]*f[53][l]+0.2449489742783178*alpha_vdim[12][l]*f[47][l]+(0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[43][l]+(0.273861278752583*f[20][l]+0.1956151991089878*f[16][l])*alpha_vdim[43][l]+0.3061862178478971*(f[0][l]*alpha_vdim[43][l]+f[15][l]*alpha_vdim[37][l]+alpha_vdim[13][l]*f[31][l]+f[13][l]*alpha_vdim[31][l])+0.273861278752583*alpha_vdim[9][l]*f[28][l]+0.6846531968814573*alpha_cdim[0][l]*f[26][l]+0.273861278752583*(alpha_vdim[6][l]*f[25][l]+f[6][l]*alpha_vdim[25][l])+0.3061862178478971*(alpha_vdim[5][l]*f[16][l]+f[5][l]*alpha_vdim[16][l])+0.6846531968814573*alpha_cdim[3][l]*f[12][l]+0.273861278752583*(alpha_vdim[1][l]*f[12][l]+f[1][l]*alpha_vdim[12][l]);
+    out[71][l] += (0.1956151991089878*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[606][l]+(0.1749635530559412*f[182][l]+0.273861278752583*f[87][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[603][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[572][l]+(0.1956151991089878*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[546][l]+0.273861278752583*f[97][l]*alpha_vdim[545][l]+(0.1749635530559412*f[119][l]+0.273861278752583*f[35][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[543][l]+(0.2449489742783178*f[118][l]+0.273861278752583*f[31][l])*alpha_vdim[542][l]+0.1956151991089878*f[62][l]*alpha_vdim[524][l]+0.3061862178478971*(f[11][l]*alpha_vdim[524][l]+f[152][l]*alpha_vdim[523][l])+(0.1749635530559412*f[88][l]+0.273861278752583*f[18][l]+0.1956151991089878*f[17][l]+0.3061862178478971*f[0][l])*alpha_vdim[520][l]+(0.273861278752583*f[182][l]+0.3061862178478971*f[86][l])*alpha_vdim[519][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[518][l]+0.273861278752583*(f[56][l]*alpha_vdim[517][l]+f[51][l]*alpha_vdim[508][l])+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[507][l]+0.1956151991089878*f[34][l]*alpha_vdim[503][l]+0.3061862178478971*(f[3][l]*alpha_vdim[503][l]+f[117][l]*alpha_vdim[502][l])+0.273861278752583*f[24][l]*alpha_vdim[496][l]+0.3061862178478971*f[98][l]*alpha_vdim[495][l]+(0.2449489742783178*f[36][l]+0.273861278752583*f[2][l])*alpha_vdim[494][l]+(0.273861278752583*f[119][l]+0.3061862178478971*f[32][l])*alpha_vdim[493][l]+0.273861278752583*f[21][l]*alpha_vdim[492][l]+0.3061862178478971*f[62][l]*alpha_vdim[490][l]+(0.273861278752583*f[88][l]+0.3061862178478971*f[17][l])*alpha_vdim[489][l]+0.273861278752583*f[8][l]*alpha_vdim[488][l]+0.3061862178478971*(f[57][l]*alpha_vdim[487][l]+f[34][l]*alpha_vdim[486][l])+0.6846531968814573*(f[55][l]*alpha_cdim[247][l]+f[27][l]*alpha_cdim[243][l])+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[43][l])*f[186][l]+(0.1956151991089878*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[37][l])*f[161][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[136][l]+0.2449489742783178*alpha_vdim[68][l]*f[135][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[129][l]+(0.273861278752583*f[92][l]+0.1956151991089878*f[86][l])*alpha_vdim[129][l]+0.3061862178478971*(f[16][l]*alpha_vdim[129][l]+f[74][l]*alpha_vdim[120][l])+(0.1956151991089878*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[105][l]+0.273861278752583*alpha_vdim[59][l]*f[104][l]+(0.1749635530559412*alpha_vdim[44][l]+0.273861278752583*alpha_vdim[5][l])*f[93][l]+0.3061862178478971*(alpha_vdim[43][l]*f[86][l]+f[43][l]*alpha_vdim[86][l])+0.2449489742783178*alpha_vdim[25][l]*f[80][l]+(0.1956151991089878*alpha_vdim[38][l]+0.3061862178478971*alpha_vdim[4][l])*f[75][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[69][l]+(0.273861278752583*f[47][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[69][l]+0.273861278752583*(alpha_vdim[31][l]*f[68][l]+f[31][l]*alpha_vdim[68][l])+0.3061862178478971*f[28][l]*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[22][l]*f[53][l]+0.2449489742783178*alpha_vdim[13][l]*f[48][l]+(0.1956151991089878*alpha_vdim[17][l]+0.3061862178478971*alpha_vdim[0][l])*f[44][l]+(0.273861278752583*f[20][l]+0.1956151991089878*f[17][l])*alpha_vdim[44][l]+0.3061862178478971*(f[0][l]*alpha_vdim[44][l]+f[15][l]*alpha_vdim[38][l]+alpha_vdim[12][l]*f[32][l]+f[12][l]*alpha_vdim[32][l])+0.273861278752583*(alpha_vdim[10][l]*f[29][l]+alpha_vdim[6][l]*f[25][l]+f[6][l]*alpha_vdim[25][l])+0.3061862178478971*(alpha_vdim[5][l]*f[17][l]+f[5][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[2][l]*f[13][l]+f[2][l]*alpha_vdim[13][l]);
+    out[72][l] += 0.273861278752583*f[154][l]*alpha_vdim[606][l]+0.2449489742783178*f[57][l]*alpha_vdim[603][l]+0.273861278752583*f[119][l]*alpha_vdim[572][l]+(0.273861278752583*f[202][l]+0.3061862178478971*f[122][l])*alpha_vdim[546][l]+0.273861278752583*f[99][l]*alpha_vdim[545][l]+(0.2449489742783178*f[117][l]+0.273861278752583*f[34][l])*alpha_vdim[543][l]+0.2449489742783178*f[21][l]*alpha_vdim[542][l]+0.3061862178478971*f[154][l]*alpha_vdim[524][l]+0.273861278752583*(f[63][l]*alpha_vdim[523][l]+f[57][l]*alpha_vdim[520][l])+0.2449489742783178*f[7][l]*alpha_vdim[519][l]+(0.273861278752583*f[182][l]+0.3061862178478971*f[88][l])*alpha_vdim[518][l]+0.273861278752583*f[58][l]*alpha_vdim[517][l]+(0.273861278752583*f[153][l]+0.3061862178478971*f[64][l])*alpha_vdim[508][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[507][l]+0.3061862178478971*f[119][l]*alpha_vdim[503][l]+0.273861278752583*f[35][l]*alpha_vdim[502][l]+0.3061862178478971*f[99][l]*alpha_vdim[496][l]+(0.273861278752583*f[121][l]+0.3061862178478971*f[39][l])*alpha_vdim[495][l]+0.273861278752583*f[21][l]*alpha_vdim[494][l]+0.2449489742783178*f[33][l]*alpha_vdim[493][l]+0.273861278752583*(f[3][l]*alpha_vdim[493][l]+f[118][l]*alpha_vdim[492][l])+0.3061862178478971*(f[36][l]*alpha_vdim[492][l]+f[63][l]*alpha_vdim[490][l])+0.273861278752583*f[7][l]*alpha_vdim[489][l]+0.3061862178478971*f[58][l]*alpha_vdim[488][l]+0.273861278752583*f[87][l]*alpha_vdim[487][l]+0.3061862178478971*(f[18][l]*alpha_vdim[487][l]+f[35][l]*alpha_vdim[486][l])+0.5477225575051661*alpha_vdim[69][l]*f[210][l]+0.6123724356957944*alpha_vdim[60][l]*f[192][l]+(0.5477225575051661*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[171][l]+0.5477225575051661*alpha_vdim[25][l]*f[170][l]+0.6123724356957944*alpha_vdim[32][l]*f[158][l]+(0.6123724356957944*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[38][l])*f[148][l]+0.6123724356957944*(alpha_vdim[22][l]*f[147][l]+alpha_vdim[69][l]*f[138][l])+0.5477225575051661*alpha_vdim[12][l]*f[137][l]+0.6123724356957944*(f[57][l]*alpha_vdim[129][l]+alpha_vdim[69][l]*f[117][l])+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[113][l]+0.6846531968814573*alpha_vdim[60][l]*f[107][l]+0.6123724356957944*alpha_vdim[9][l]*f[106][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[102][l]+0.6123724356957944*alpha_vdim[6][l]*f[101][l]+(0.6123724356957944*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[10][l])*f[96][l]+0.6123724356957944*alpha_vdim[25][l]*f[82][l]+(0.5477225575051661*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[81][l]+0.6846531968814573*alpha_vdim[32][l]*f[71][l]+0.6123724356957944*alpha_vdim[1][l]*f[70][l]+0.6846531968814573*f[34][l]*alpha_vdim[69][l]+0.6123724356957944*f[21][l]*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[44][l]*f[57][l]+0.6123724356957944*alpha_vdim[25][l]*f[56][l]+0.6846531968814573*alpha_vdim[22][l]*f[55][l]+(0.6123724356957944*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[54][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[52][l]+0.6123724356957944*alpha_vdim[12][l]*f[49][l]+0.3061862178478971*alpha_cdim[0][l]*f[45][l]+0.6123724356957944*(f[7][l]*alpha_vdim[43][l]+alpha_vdim[12][l]*f[33][l])+0.6846531968814573*(alpha_vdim[9][l]*f[30][l]+alpha_vdim[6][l]*f[27][l])+0.6123724356957944*alpha_vdim[16][l]*f[26][l]+0.6846531968814573*(alpha_vdim[0][l]*f[26][l]+f[8][l]*alpha_vdim[25][l]+alpha_vdim[13][l]*f[21][l])+0.273861278752583*alpha_cdim[3][l]*f[14][l]+0.6846531968814573*(alpha_vdim[1][l]*f[14][l]+f[3][l]*alpha_vdim[12][l]+alpha_vdim[5][l]*f[7][l]);
+    out[73][l] += 0.273861278752583*f[153][l]*alpha_vdim[606][l]+0.2449489742783178*f[56][l]*alpha_vdim[603][l]+0.273861278752583*(f[118][l]*alpha_vdim[572][l]+f[99][l]*alpha_vdim[546][l])+(0.273861278752583*f[202][l]+0.3061862178478971*f[121][l])*alpha_vdim[545][l]+0.2449489742783178*(f[21][l]*alpha_vdim[543][l]+f[117][l]*alpha_vdim[542][l])+0.273861278752583*(f[33][l]*alpha_vdim[542][l]+f[64][l]*alpha_vdim[524][l])+0.3061862178478971*f[153][l]*alpha_vdim[523][l]+0.2449489742783178*f[8][l]*alpha_vdim[520][l]+0.273861278752583*(f[56][l]*alpha_vdim[519][l]+f[58][l]*alpha_vdim[518][l])+(0.273861278752583*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[517][l]+(0.273861278752583*f[154][l]+0.3061862178478971*f[63][l])*alpha_vdim[508][l]+0.2449489742783178*f[57][l]*alpha_vdim[507][l]+0.273861278752583*(f[7][l]*alpha_vdim[507][l]+f[36][l]*alpha_vdim[503][l])+0.3061862178478971*f[118][l]*alpha_vdim[502][l]+0.273861278752583*f[122][l]*alpha_vdim[496][l]+0.3061862178478971*(f[39][l]*alpha_vdim[496][l]+f[99][l]*alpha_vdim[495][l])+0.2449489742783178*f[34][l]*alpha_vdim[494][l]+0.273861278752583*(f[3][l]*alpha_vdim[494][l]+f[21][l]*alpha_vdim[493][l]+f[119][l]*alpha_vdim[492][l])+0.3061862178478971*(f[35][l]*alpha_vdim[492][l]+f[64][l]*alpha_vdim[490][l])+0.273861278752583*(f[8][l]*alpha_vdim[489][l]+f[88][l]*alpha_vdim[488][l])+0.3061862178478971*(f[18][l]*alpha_vdim[488][l]+f[58][l]*alpha_vdim[487][l]+f[36][l]*alpha_vdim[486][l]+f[76][l]*alpha_cdim[247][l]+f[45][l]*alpha_cdim[243][l])+0.5477225575051661*alpha_vdim[68][l]*f[210][l]+0.6123724356957944*alpha_vdim[59][l]*f[192][l]+0.5477225575051661*(alpha_vdim[25][l]*f[171][l]+alpha_vdim[129][l]*f[170][l])+0.6123724356957944*(alpha_vdim[43][l]*f[170][l]+alpha_vdim[31][l]*f[158][l]+alpha_vdim[22][l]*f[148][l])+(0.6123724356957944*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[37][l])*f[147][l]+0.5477225575051661*alpha_vdim[13][l]*f[138][l]+0.6123724356957944*(alpha_vdim[68][l]*f[137][l]+f[56][l]*alpha_vdim[129][l]+alpha_vdim[68][l]*f[117][l])+0.5477225575051661*alpha_vdim[69][l]*f[113][l]+0.6123724356957944*(alpha_vdim[12][l]*f[113][l]+alpha_vdim[10][l]*f[107][l])+0.6846531968814573*alpha_vdim[59][l]*f[106][l]+0.6123724356957944*alpha_vdim[6][l]*f[102][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[101][l]+(0.6123724356957944*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[96][l]+0.5477225575051661*alpha_vdim[44][l]*f[82][l]+0.6123724356957944*(alpha_vdim[5][l]*f[82][l]+alpha_vdim[25][l]*f[81][l]+alpha_vdim[2][l]*f[71][l])+0.6846531968814573*alpha_vdim[31][l]*f[70][l]+0.6123724356957944*f[21][l]*alpha_vdim[69][l]+0.6846531968814573*f[33][l]*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[25][l]*f[57][l]+0.6846531968814573*alpha_vdim[43][l]*f[56][l]+0.6123724356957944*alpha_vdim[38][l]*f[55][l]+0.6846531968814573*(alpha_vdim[4][l]*f[55][l]+alpha_vdim[22][l]*f[54][l])+(0.6123724356957944*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[52][l]+0.6123724356957944*(alpha_vdim[13][l]*f[49][l]+f[8][l]*alpha_vdim[44][l]+alpha_vdim[13][l]*f[34][l])+0.6846531968814573*alpha_vdim[10][l]*f[30][l]+0.6123724356957944*alpha_vdim[17][l]*f[27][l]+0.6846531968814573*(alpha_vdim[0][l]*f[27][l]+alpha_vdim[6][l]*f[26][l]+f[7][l]*alpha_vdim[25][l]+alpha_vdim[12][l]*f[21][l]+alpha_vdim[2][l]*f[14][l]+f[3][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*f[8][l]);
+    out[74][l] += (0.1749635530559412*f[183][l]+0.273861278752583*f[90][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[606][l]+(0.1956151991089878*f[152][l]+0.3061862178478971*f[62][l])*alpha_vdim[603][l]+(0.1956151991089878*f[120][l]+0.3061862178478971*f[38][l])*alpha_vdim[572][l]+(0.2449489742783178*f[124][l]+0.273861278752583*f[32][l])*alpha_vdim[546][l]+(0.1749635530559412*f[123][l]+0.273861278752583*f[41][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[545][l]+0.273861278752583*f[98][l]*alpha_vdim[543][l]+(0.1956151991089878*f[97][l]+0.3061862178478971*f[24][l])*alpha_vdim[542][l]+(0.273861278752583*f[183][l]+0.3061862178478971*f[86][l])*alpha_vdim[524][l]+(0.1749635530559412*f[89][l]+0.273861278752583*f[19][l]+0.1956151991089878*f[16][l])*alpha_vdim[523][l]+0.3061862178478971*(f[0][l]*alpha_vdim[523][l]+f[152][l]*alpha_vdim[520][l])+(0.1956151991089878*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[519][l]+0.273861278752583*f[60][l]*alpha_vdim[518][l]+(0.1956151991089878*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[517][l]+0.2449489742783178*f[65][l]*alpha_vdim[508][l]+0.273861278752583*(f[6][l]*alpha_vdim[508][l]+f[51][l]*alpha_vdim[507][l])+0.3061862178478971*f[120][l]*alpha_vdim[503][l]+(0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[502][l]+(0.273861278752583*f[123][l]+0.3061862178478971*f[31][l])*alpha_vdim[496][l]+(0.2449489742783178*f[40][l]+0.273861278752583*f[1][l])*alpha_vdim[495][l]+0.3061862178478971*f[97][l]*alpha_vdim[494][l]+0.273861278752583*(f[23][l]*alpha_vdim[493][l]+f[22][l]*alpha_vdim[492][l]+f[89][l]*alpha_vdim[490][l])+0.3061862178478971*(f[16][l]*alpha_vdim[490][l]+f[61][l]*alpha_vdim[489][l]+f[59][l]*alpha_vdim[488][l])+0.273861278752583*f[9][l]*alpha_vdim[487][l]+0.3061862178478971*f[37][l]*alpha_vdim[486][l]+(0.1749635530559412*f[186][l]+0.273861278752583*f[93][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[372][l]+(0.1956151991089878*f[158][l]+0.3061862178478971*f[71][l])*alpha_vdim[360][l]+(0.1956151991089878*f[129][l]+0.3061862178478971*f[44][l])*alpha_vdim[329][l]+(0.2449489742783178*f[136][l]+0.273861278752583*f[32][l])*alpha_vdim[312][l]+(0.1749635530559412*f[135][l]+0.273861278752583*f[48][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[311][l]+0.273861278752583*f[102][l]*alpha_vdim[300][l]+(0.1956151991089878*f[101][l]+0.3061862178478971*f[27][l])*alpha_vdim[299][l]+(0.273861278752583*f[186][l]+0.3061862178478971*f[86][l])*alpha_vdim[287][l]+(0.1749635530559412*f[92][l]+0.273861278752583*f[20][l]+0.1956151991089878*f[16][l])*alpha_vdim[286][l]+0.3061862178478971*(f[0][l]*alpha_vdim[286][l]+f[158][l]*alpha_vdim[277][l])+(0.1956151991089878*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[276][l]+0.273861278752583*f[69][l]*alpha_vdim[275][l]+(0.1956151991089878*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[274][l]+0.2449489742783178*f[80][l]*alpha_vdim[268][l]+0.273861278752583*(f[6][l]*alpha_vdim[268][l]+f[52][l]*alpha_vdim[264][l])+0.3061862178478971*f[129][l]*alpha_vdim[260][l]+(0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[259][l]+(0.273861278752583*f[135][l]+0.3061862178478971*f[31][l])*alpha_vdim[256][l]+(0.2449489742783178*f[47][l]+0.273861278752583*f[1][l])*alpha_vdim[255][l]+0.3061862178478971*f[101][l]*alpha_vdim[251][l]+0.273861278752583*(f[26][l]*alpha_vdim[250][l]+f[25][l]*alpha_vdim[249][l]+f[92][l]*alpha_vdim[248][l])+0.3061862178478971*(f[16][l]*alpha_vdim[248][l]+f[70][l]*alpha_vdim[246][l]+f[68][l]*alpha_vdim[245][l])+0.273861278752583*f[12][l]*alpha_vdim[244][l]+0.3061862178478971*f[43][l]*alpha_vdim[243][l]+0.6846531968814573*(alpha_cdim[3][l]*f[54][l]+alpha_cdim[0][l]*f[28][l]);
+    out[75][l] += (0.1749635530559412*f[183][l]+0.273861278752583*f[89][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[606][l]+(0.1956151991089878*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[603][l]+(0.1956151991089878*f[120][l]+0.3061862178478971*f[37][l])*alpha_vdim[572][l]+(0.1749635530559412*f[124][l]+0.273861278752583*f[40][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[546][l]+(0.2449489742783178*f[123][l]+0.273861278752583*f[31][l])*alpha_vdim[545][l]+(0.1956151991089878*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[543][l]+0.273861278752583*f[97][l]*alpha_vdim[542][l]+(0.1749635530559412*f[90][l]+0.273861278752583*f[19][l]+0.1956151991089878*f[17][l]+0.3061862178478971*f[0][l])*alpha_vdim[524][l]+(0.273861278752583*f[183][l]+0.3061862178478971*f[86][l])*alpha_vdim[523][l]+0.1956151991089878*f[62][l]*alpha_vdim[520][l]+0.3061862178478971*(f[11][l]*alpha_vdim[520][l]+f[152][l]*alpha_vdim[519][l])+(0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[518][l]+0.273861278752583*f[59][l]*alpha_vdim[517][l]+0.2449489742783178*f[65][l]*alpha_vdim[508][l]+0.273861278752583*(f[6][l]*alpha_vdim[508][l]+f[51][l]*alpha_vdim[507][l])+0.1956151991089878*f[38][l]*alpha_vdim[503][l]+0.3061862178478971*(f[4][l]*alpha_vdim[503][l]+f[120][l]*alpha_vdim[502][l])+(0.2449489742783178*f[41][l]+0.273861278752583*f[2][l])*alpha_vdim[496][l]+(0.273861278752583*f[124][l]+0.3061862178478971*f[32][l])*alpha_vdim[495][l]+0.273861278752583*f[24][l]*alpha_vdim[494][l]+0.3061862178478971*f[98][l]*alpha_vdim[493][l]+0.273861278752583*(f[22][l]*alpha_vdim[492][l]+f[90][l]*alpha_vdim[490][l])+0.3061862178478971*(f[17][l]*alpha_vdim[490][l]+f[62][l]*alpha_vdim[489][l])+0.273861278752583*f[10][l]*alpha_vdim[488][l]+0.3061862178478971*(f[60][l]*alpha_vdim[487][l]+f[38][l]*alpha_vdim[486][l])+(0.1749635530559412*f[186][l]+0.273861278752583*f[92][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[372][l]+(0.1956151991089878*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[360][l]+(0.1956151991089878*f[129][l]+0.3061862178478971*f[43][l])*alpha_vdim[329][l]+(0.1749635530559412*f[136][l]+0.273861278752583*f[47][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[312][l]+(0.2449489742783178*f[135][l]+0.273861278752583*f[31][l])*alpha_vdim[311][l]+(0.1956151991089878*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[300][l]+0.273861278752583*f[101][l]*alpha_vdim[299][l]+(0.1749635530559412*f[93][l]+0.273861278752583*f[20][l]+0.1956151991089878*f[17][l]+0.3061862178478971*f[0][l])*alpha_vdim[287][l]+(0.273861278752583*f[186][l]+0.3061862178478971*f[86][l])*alpha_vdim[286][l]+0.1956151991089878*f[71][l]*alpha_vdim[277][l]+0.3061862178478971*(f[14][l]*alpha_vdim[277][l]+f[158][l]*alpha_vdim[276][l])+(0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[275][l]+0.273861278752583*f[68][l]*alpha_vdim[274][l]+0.2449489742783178*f[80][l]*alpha_vdim[268][l]+0.273861278752583*(f[6][l]*alpha_vdim[268][l]+f[52][l]*alpha_vdim[264][l])+0.1956151991089878*f[44][l]*alpha_vdim[260][l]+0.3061862178478971*(f[5][l]*alpha_vdim[260][l]+f[129][l]*alpha_vdim[259][l])+(0.2449489742783178*f[48][l]+0.273861278752583*f[2][l])*alpha_vdim[256][l]+(0.273861278752583*f[136][l]+0.3061862178478971*f[32][l])*alpha_vdim[255][l]+0.273861278752583*f[27][l]*alpha_vdim[251][l]+0.3061862178478971*f[102][l]*alpha_vdim[250][l]+0.273861278752583*f[25][l]*alpha_vdim[249][l]+(0.273861278752583*f[93][l]+0.3061862178478971*f[17][l])*alpha_vdim[248][l]+(0.6123724356957944*f[78][l]+0.6846531968814573*f[13][l])*alpha_cdim[247][l]+0.3061862178478971*f[71][l]*alpha_vdim[246][l]+0.273861278752583*f[13][l]*alpha_vdim[245][l]+0.3061862178478971*(f[69][l]*alpha_vdim[244][l]+f[44][l]*alpha_vdim[243][l])+0.6846531968814573*f[29][l]*alpha_cdim[243][l];
+    out[76][l] += (0.273861278752583*f[232][l]+0.3061862178478971*f[182][l])*alpha_vdim[606][l]+0.273861278752583*f[152][l]*alpha_vdim[603][l]+0.3061862178478971*f[202][l]*alpha_vdim[572][l]+(0.273861278752583*f[205][l]+0.3061862178478971*f[119][l])*alpha_vdim[546][l]+(0.273861278752583*f[204][l]+0.3061862178478971*f[118][l])*alpha_vdim[545][l]+0.273861278752583*(f[98][l]*alpha_vdim[543][l]+f[97][l]*alpha_vdim[542][l])+(0.273861278752583*f[185][l]+0.3061862178478971*f[88][l])*alpha_vdim[524][l]+(0.273861278752583*f[184][l]+0.3061862178478971*f[87][l])*alpha_vdim[523][l]+0.273861278752583*(f[62][l]*alpha_vdim[520][l]+f[61][l]*alpha_vdim[519][l])+0.3061862178478971*(f[154][l]*alpha_vdim[518][l]+f[153][l]*alpha_vdim[517][l])+(0.273861278752583*f[157][l]+0.3061862178478971*f[58][l])*alpha_vdim[508][l]+0.273861278752583*f[51][l]*alpha_vdim[507][l]+0.3061862178478971*(f[122][l]*alpha_vdim[503][l]+f[121][l]*alpha_vdim[502][l])+(0.273861278752583*f[128][l]+0.3061862178478971*f[36][l])*alpha_vdim[496][l]+(0.273861278752583*f[127][l]+0.3061862178478971*f[35][l])*alpha_vdim[495][l]+0.273861278752583*(f[24][l]*alpha_vdim[494][l]+f[23][l]*alpha_vdim[493][l])+0.3061862178478971*f[99][l]*alpha_vdim[492][l]+(0.273861278752583*f[91][l]+0.3061862178478971*f[18][l])*alpha_vdim[490][l]+0.273861278752583*f[11][l]*alpha_vdim[489][l]+0.3061862178478971*(f[64][l]*alpha_vdim[488][l]+f[63][l]*alpha_vdim[487][l]+f[39][l]*alpha_vdim[486][l])+(0.273861278752583*f[233][l]+0.3061862178478971*f[182][l])*alpha_vdim[372][l]+0.273861278752583*f[158][l]*alpha_vdim[360][l]+0.3061862178478971*f[206][l]*alpha_vdim[329][l]+(0.273861278752583*f[212][l]+0.3061862178478971*f[119][l])*alpha_vdim[312][l]+(0.273861278752583*f[211][l]+0.3061862178478971*f[118][l])*alpha_vdim[311][l]+0.273861278752583*(f[102][l]*alpha_vdim[300][l]+f[101][l]*alpha_vdim[299][l])+(0.273861278752583*f[188][l]+0.3061862178478971*f[88][l])*alpha_vdim[287][l]+(0.273861278752583*f[187][l]+0.3061862178478971*f[87][l])*alpha_vdim[286][l]+0.273861278752583*(f[71][l]*alpha_vdim[277][l]+f[70][l]*alpha_vdim[276][l])+0.3061862178478971*(f[160][l]*alpha_vdim[275][l]+f[159][l]*alpha_vdim[274][l])+(0.273861278752583*f[172][l]+0.3061862178478971*f[58][l])*alpha_vdim[268][l]+0.273861278752583*f[52][l]*alpha_vdim[264][l]+0.3061862178478971*(f[131][l]*alpha_vdim[260][l]+f[130][l]*alpha_vdim[259][l])+(0.273861278752583*f[140][l]+0.3061862178478971*f[36][l])*alpha_vdim[256][l]+(0.273861278752583*f[139][l]+0.3061862178478971*f[35][l])*alpha_vdim[255][l]+0.273861278752583*(f[27][l]*alpha_vdim[251][l]+f[26][l]*alpha_vdim[250][l])+0.3061862178478971*f[103][l]*alpha_vdim[249][l]+(0.273861278752583*f[94][l]+0.3061862178478971*f[18][l])*alpha_vdim[248][l]+0.273861278752583*f[14][l]*alpha_vdim[246][l]+0.3061862178478971*(f[73][l]*alpha_vdim[245][l]+f[72][l]*alpha_vdim[244][l]+f[45][l]*alpha_vdim[243][l])+0.6123724356957944*(alpha_vdim[129][l]*f[226][l]+alpha_vdim[120][l]*f[223][l]+alpha_vdim[69][l]*f[199][l]+alpha_vdim[68][l]*f[198][l]+alpha_vdim[60][l]*f[196][l]+alpha_vdim[59][l]*f[195][l])+0.6846531968814573*alpha_vdim[86][l]*f[192][l]+0.6123724356957944*(alpha_vdim[44][l]*f[176][l]+alpha_vdim[43][l]*f[175][l]+alpha_vdim[38][l]*f[167][l]+alpha_vdim[37][l]*f[166][l])+0.6846531968814573*(alpha_vdim[120][l]*f[158][l]+alpha_vdim[129][l]*f[152][l])+0.6123724356957944*(alpha_vdim[25][l]*f[151][l]+alpha_vdim[22][l]*f[150][l])+0.6846531968814573*(alpha_vdim[32][l]*f[148][l]+alpha_vdim[31][l]*f[147][l])+0.6123724356957944*(alpha_vdim[13][l]*f[116][l]+alpha_vdim[12][l]*f[115][l]+alpha_vdim[10][l]*f[112][l]+alpha_vdim[9][l]*f[111][l])+0.6846531968814573*(alpha_vdim[17][l]*f[107][l]+alpha_vdim[16][l]*f[106][l]+alpha_vdim[60][l]*f[102][l]+alpha_vdim[59][l]*f[101][l]+alpha_vdim[69][l]*f[98][l]+alpha_vdim[68][l]*f[97][l]+alpha_vdim[6][l]*f[96][l])+0.6123724356957944*(alpha_vdim[5][l]*f[85][l]+alpha_vdim[4][l]*f[79][l])+0.6846531968814573*(alpha_vdim[38][l]*f[71][l]+alpha_vdim[37][l]*f[70][l]+alpha_vdim[44][l]*f[62][l]+alpha_vdim[43][l]*f[61][l]+alpha_vdim[2][l]*f[55][l]+alpha_vdim[1][l]*f[54][l]+alpha_vdim[22][l]*f[52][l]+alpha_vdim[25][l]*f[51][l]+alpha_vdim[0][l]*f[30][l]+alpha_vdim[10][l]*f[27][l]+alpha_vdim[9][l]*f[26][l]+alpha_vdim[13][l]*f[24][l]+alpha_vdim[12][l]*f[23][l]+alpha_vdim[4][l]*f[14][l]+alpha_vdim[5][l]*f[11][l]);
+    out[77][l] += 0.2449489742783178*f[60][l]*alpha_vdim[606][l]+0.273861278752583*(f[156][l]*alpha_vdim[603][l]+f[124][l]*alpha_vdim[572][l])+(0.2449489742783178*f[120][l]+0.273861278752583*f[38][l])*alpha_vdim[546][l]+0.2449489742783178*f[22][l]*alpha_vdim[545][l]+(0.273861278752583*f[203][l]+0.3061862178478971*f[126][l])*alpha_vdim[543][l]+0.273861278752583*(f[100][l]*alpha_vdim[542][l]+f[60][l]*alpha_vdim[524][l])+0.2449489742783178*f[9][l]*alpha_vdim[523][l]+0.3061862178478971*f[156][l]*alpha_vdim[520][l]+0.273861278752583*f[66][l]*alpha_vdim[519][l]+(0.273861278752583*f[183][l]+0.3061862178478971*f[90][l])*alpha_vdim[518][l]+0.273861278752583*f[65][l]*alpha_vdim[517][l]+0.2449489742783178*f[59][l]*alpha_vdim[508][l]+0.273861278752583*(f[10][l]*alpha_vdim[508][l]+f[155][l]*alpha_vdim[507][l])+0.3061862178478971*(f[67][l]*alpha_vdim[507][l]+f[124][l]*alpha_vdim[503][l])+0.273861278752583*(f[40][l]*alpha_vdim[502][l]+f[22][l]*alpha_vdim[496][l])+(0.2449489742783178*f[37][l]+0.273861278752583*f[4][l])*alpha_vdim[495][l]+0.3061862178478971*f[100][l]*alpha_vdim[494][l]+(0.273861278752583*f[125][l]+0.3061862178478971*f[42][l])*alpha_vdim[493][l]+(0.273861278752583*f[123][l]+0.3061862178478971*f[41][l])*alpha_vdim[492][l]+0.273861278752583*f[9][l]*alpha_vdim[490][l]+0.3061862178478971*(f[66][l]*alpha_vdim[489][l]+f[65][l]*alpha_vdim[488][l])+0.273861278752583*f[89][l]*alpha_vdim[487][l]+0.3061862178478971*(f[19][l]*alpha_vdim[487][l]+f[40][l]*alpha_vdim[486][l])+0.5477225575051661*f[174][l]*alpha_vdim[372][l]+0.6123724356957944*(f[60][l]*alpha_vdim[372][l]+f[148][l]*alpha_vdim[360][l]+f[105][l]*alpha_vdim[329][l])+(0.5477225575051661*f[213][l]+0.6123724356957944*(f[142][l]+f[120][l])+0.6846531968814573*f[38][l])*alpha_vdim[312][l]+(0.5477225575051661*f[114][l]+0.6123724356957944*f[22][l])*alpha_vdim[311][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[300][l]+0.6123724356957944*f[96][l]*alpha_vdim[299][l]+(0.6123724356957944*f[174][l]+0.6846531968814573*f[60][l])*alpha_vdim[287][l]+(0.5477225575051661*f[83][l]+0.6123724356957944*f[9][l])*alpha_vdim[286][l]+0.6846531968814573*f[148][l]*alpha_vdim[277][l]+0.6123724356957944*f[54][l]*alpha_vdim[276][l]+(0.6123724356957944*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[275][l]+0.6123724356957944*f[53][l]*alpha_vdim[274][l]+(0.5477225575051661*f[173][l]+0.6123724356957944*(f[84][l]+f[59][l])+0.6846531968814573*f[10][l])*alpha_vdim[268][l]+0.6123724356957944*f[147][l]*alpha_vdim[264][l]+0.6846531968814573*(f[55][l]*alpha_vdim[264][l]+f[105][l]*alpha_vdim[260][l])+0.6123724356957944*f[28][l]*alpha_vdim[259][l]+(0.6123724356957944*f[114][l]+0.6846531968814573*f[22][l])*alpha_vdim[256][l]+(0.5477225575051661*f[141][l]+0.6123724356957944*(f[50][l]+f[37][l]))*alpha_vdim[255][l]+0.6846531968814573*(f[4][l]*alpha_vdim[255][l]+f[96][l]*alpha_vdim[251][l])+(0.6123724356957944*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[250][l]+(0.6123724356957944*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[249][l]+0.6123724356957944*f[83][l]*alpha_vdim[248][l]+0.6846531968814573*(f[9][l]*alpha_vdim[248][l]+f[54][l]*alpha_vdim[246][l]+f[53][l]*alpha_vdim[245][l])+0.6123724356957944*f[74][l]*alpha_vdim[244][l]+0.6846531968814573*(f[15][l]*alpha_vdim[244][l]+f[28][l]*alpha_vdim[243][l])+0.3061862178478971*(alpha_cdim[3][l]*f[79][l]+alpha_cdim[0][l]*f[46][l]);
+    out[78][l] += 0.2449489742783178*f[59][l]*alpha_vdim[606][l]+0.273861278752583*(f[155][l]*alpha_vdim[603][l]+f[123][l]*alpha_vdim[572][l])+0.2449489742783178*(f[22][l]*alpha_vdim[546][l]+f[120][l]*alpha_vdim[545][l])+0.273861278752583*(f[37][l]*alpha_vdim[545][l]+f[100][l]*alpha_vdim[543][l])+(0.273861278752583*f[203][l]+0.3061862178478971*f[125][l])*alpha_vdim[542][l]+0.2449489742783178*f[10][l]*alpha_vdim[524][l]+0.273861278752583*(f[59][l]*alpha_vdim[523][l]+f[67][l]*alpha_vdim[520][l])+0.3061862178478971*f[155][l]*alpha_vdim[519][l]+0.273861278752583*f[65][l]*alpha_vdim[518][l]+(0.273861278752583*f[183][l]+0.3061862178478971*f[89][l])*alpha_vdim[517][l]+(0.2449489742783178*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[508][l]+(0.273861278752583*f[156][l]+0.3061862178478971*f[66][l])*alpha_vdim[507][l]+0.273861278752583*f[41][l]*alpha_vdim[503][l]+0.3061862178478971*f[123][l]*alpha_vdim[502][l]+0.2449489742783178*f[38][l]*alpha_vdim[496][l]+0.273861278752583*(f[4][l]*alpha_vdim[496][l]+f[22][l]*alpha_vdim[495][l]+f[126][l]*alpha_vdim[494][l])+0.3061862178478971*(f[42][l]*alpha_vdim[494][l]+f[100][l]*alpha_vdim[493][l])+(0.273861278752583*f[124][l]+0.3061862178478971*f[40][l])*alpha_vdim[492][l]+0.273861278752583*f[10][l]*alpha_vdim[490][l]+0.3061862178478971*f[67][l]*alpha_vdim[489][l]+0.273861278752583*f[90][l]*alpha_vdim[488][l]+0.3061862178478971*(f[19][l]*alpha_vdim[488][l]+f[65][l]*alpha_vdim[487][l]+f[41][l]*alpha_vdim[486][l])+0.5477225575051661*f[173][l]*alpha_vdim[372][l]+0.6123724356957944*(f[59][l]*alpha_vdim[372][l]+f[147][l]*alpha_vdim[360][l]+f[104][l]*alpha_vdim[329][l])+(0.5477225575051661*f[114][l]+0.6123724356957944*f[22][l])*alpha_vdim[312][l]+(0.5477225575051661*f[213][l]+0.6123724356957944*(f[141][l]+f[120][l])+0.6846531968814573*f[37][l])*alpha_vdim[311][l]+0.6123724356957944*f[96][l]*alpha_vdim[300][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[299][l]+(0.5477225575051661*f[84][l]+0.6123724356957944*f[10][l])*alpha_vdim[287][l]+(0.6123724356957944*f[173][l]+0.6846531968814573*f[59][l])*alpha_vdim[286][l]+0.6123724356957944*f[55][l]*alpha_vdim[277][l]+0.6846531968814573*f[147][l]*alpha_vdim[276][l]+0.6123724356957944*f[53][l]*alpha_vdim[275][l]+(0.6123724356957944*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[274][l]+(0.5477225575051661*f[174][l]+0.6123724356957944*(f[83][l]+f[60][l])+0.6846531968814573*f[9][l])*alpha_vdim[268][l]+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[264][l]+0.6123724356957944*f[29][l]*alpha_vdim[260][l]+0.6846531968814573*f[104][l]*alpha_vdim[259][l]+(0.5477225575051661*f[142][l]+0.6123724356957944*(f[50][l]+f[38][l])+0.6846531968814573*f[4][l])*alpha_vdim[256][l]+(0.6123724356957944*f[114][l]+0.6846531968814573*f[22][l])*alpha_vdim[255][l]+0.6123724356957944*f[107][l]*alpha_vdim[251][l]+0.6846531968814573*(f[30][l]*alpha_vdim[251][l]+f[96][l]*alpha_vdim[250][l])+(0.6123724356957944*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[249][l]+(0.6123724356957944*f[84][l]+0.6846531968814573*f[10][l])*alpha_vdim[248][l]+0.273861278752583*f[15][l]*alpha_cdim[247][l]+0.6846531968814573*f[55][l]*alpha_vdim[246][l]+0.6123724356957944*f[75][l]*alpha_vdim[245][l]+0.6846531968814573*(f[15][l]*alpha_vdim[245][l]+f[53][l]*alpha_vdim[244][l]+f[29][l]*alpha_vdim[243][l])+0.3061862178478971*f[46][l]*alpha_cdim[243][l];
+    out[79][l] += 0.273861278752583*(f[152][l]*alpha_vdim[606][l]+f[232][l]*alpha_vdim[603][l])+0.3061862178478971*(f[183][l]*alpha_vdim[603][l]+f[203][l]*alpha_vdim[572][l])+0.273861278752583*(f[98][l]*alpha_vdim[546][l]+f[97][l]*alpha_vdim[545][l])+(0.273861278752583*f[205][l]+0.3061862178478971*f[124][l])*alpha_vdim[543][l]+(0.273861278752583*f[204][l]+0.3061862178478971*f[123][l])*alpha_vdim[542][l]+0.273861278752583*(f[62][l]*alpha_vdim[524][l]+f[61][l]*alpha_vdim[523][l])+(0.273861278752583*f[185][l]+0.3061862178478971*f[90][l])*alpha_vdim[520][l]+0.273861278752583*f[184][l]*alpha_vdim[519][l]+0.3061862178478971*(f[89][l]*alpha_vdim[519][l]+f[156][l]*alpha_vdim[518][l]+f[155][l]*alpha_vdim[517][l])+0.273861278752583*(f[51][l]*alpha_vdim[508][l]+f[157][l]*alpha_vdim[507][l])+0.3061862178478971*(f[65][l]*alpha_vdim[507][l]+f[126][l]*alpha_vdim[503][l]+f[125][l]*alpha_vdim[502][l])+0.273861278752583*(f[24][l]*alpha_vdim[496][l]+f[23][l]*alpha_vdim[495][l])+(0.273861278752583*f[128][l]+0.3061862178478971*f[41][l])*alpha_vdim[494][l]+0.273861278752583*f[127][l]*alpha_vdim[493][l]+0.3061862178478971*(f[40][l]*alpha_vdim[493][l]+f[100][l]*alpha_vdim[492][l])+0.273861278752583*(f[11][l]*alpha_vdim[490][l]+f[91][l]*alpha_vdim[489][l])+0.3061862178478971*(f[19][l]*alpha_vdim[489][l]+f[67][l]*alpha_vdim[488][l]+f[66][l]*alpha_vdim[487][l]+f[42][l]*alpha_vdim[486][l])+(0.6123724356957944*f[226][l]+0.6846531968814573*f[152][l])*alpha_vdim[372][l]+0.6123724356957944*f[222][l]*alpha_vdim[360][l]+0.6846531968814573*(f[161][l]*alpha_vdim[360][l]+f[192][l]*alpha_vdim[329][l])+(0.6123724356957944*f[199][l]+0.6846531968814573*f[98][l])*alpha_vdim[312][l]+(0.6123724356957944*f[198][l]+0.6846531968814573*f[97][l])*alpha_vdim[311][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[105][l])*alpha_vdim[300][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[104][l])*alpha_vdim[299][l]+(0.6123724356957944*f[176][l]+0.6846531968814573*f[62][l])*alpha_vdim[287][l]+(0.6123724356957944*f[175][l]+0.6846531968814573*f[61][l])*alpha_vdim[286][l]+(0.6123724356957944*f[163][l]+0.6846531968814573*f[75][l])*alpha_vdim[277][l]+0.6123724356957944*f[162][l]*alpha_vdim[276][l]+0.6846531968814573*(f[74][l]*alpha_vdim[276][l]+f[148][l]*alpha_vdim[275][l]+f[147][l]*alpha_vdim[274][l])+(0.6123724356957944*f[151][l]+0.6846531968814573*f[51][l])*alpha_vdim[268][l]+0.6123724356957944*f[149][l]*alpha_vdim[264][l]+0.6846531968814573*(f[53][l]*alpha_vdim[264][l]+f[107][l]*alpha_vdim[260][l]+f[106][l]*alpha_vdim[259][l])+(0.6123724356957944*f[116][l]+0.6846531968814573*f[24][l])*alpha_vdim[256][l]+(0.6123724356957944*f[115][l]+0.6846531968814573*f[23][l])*alpha_vdim[255][l]+(0.6123724356957944*f[109][l]+0.6846531968814573*f[29][l])*alpha_vdim[251][l]+0.6123724356957944*f[108][l]*alpha_vdim[250][l]+0.6846531968814573*(f[28][l]*alpha_vdim[250][l]+f[96][l]*alpha_vdim[249][l])+(0.6123724356957944*f[85][l]+0.6846531968814573*f[11][l])*alpha_vdim[248][l]+0.6123724356957944*f[76][l]*alpha_vdim[246][l]+0.6846531968814573*(f[15][l]*alpha_vdim[246][l]+f[55][l]*alpha_vdim[245][l]+f[54][l]*alpha_vdim[244][l]+f[30][l]*alpha_vdim[243][l])+0.273861278752583*(alpha_vdim[129][l]*f[234][l]+alpha_vdim[69][l]*f[217][l]+alpha_vdim[68][l]*f[216][l])+0.3061862178478971*alpha_vdim[86][l]*f[207][l]+0.273861278752583*(alpha_vdim[44][l]*f[190][l]+alpha_vdim[43][l]*f[189][l])+0.3061862178478971*alpha_vdim[129][l]*f[183][l]+0.273861278752583*alpha_vdim[25][l]*f[179][l]+0.3061862178478971*(alpha_vdim[32][l]*f[165][l]+alpha_vdim[31][l]*f[164][l])+0.273861278752583*(alpha_vdim[120][l]*f[161][l]+alpha_vdim[13][l]*f[145][l]+alpha_vdim[12][l]*f[144][l])+0.3061862178478971*(alpha_vdim[17][l]*f[133][l]+alpha_vdim[16][l]*f[132][l]+alpha_vdim[69][l]*f[124][l]+alpha_vdim[68][l]*f[123][l]+alpha_vdim[6][l]*f[110][l])+0.273861278752583*(alpha_vdim[60][l]*f[105][l]+alpha_vdim[59][l]*f[104][l]+alpha_vdim[5][l]*f[95][l])+0.3061862178478971*(alpha_vdim[44][l]*f[90][l]+alpha_vdim[43][l]*f[89][l]+alpha_vdim[2][l]*f[78][l]+alpha_vdim[1][l]*f[77][l])+0.273861278752583*(alpha_vdim[38][l]*f[75][l]+alpha_vdim[37][l]*f[74][l])+0.3061862178478971*alpha_vdim[25][l]*f[65][l]+0.273861278752583*alpha_vdim[22][l]*f[53][l]+0.3061862178478971*(alpha_vdim[0][l]*f[46][l]+alpha_vdim[13][l]*f[41][l]+alpha_vdim[12][l]*f[40][l])+0.273861278752583*(alpha_vdim[10][l]*f[29][l]+alpha_vdim[9][l]*f[28][l])+0.3061862178478971*alpha_vdim[5][l]*f[19][l]+0.273861278752583*alpha_vdim[4][l]*f[15][l];
+    out[80][l] += 0.5477225575051661*(f[53][l]*alpha_vdim[606][l]+f[52][l]*alpha_vdim[603][l]+f[25][l]*alpha_vdim[572][l])+(0.5477225575051661*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[546][l]+(0.5477225575051661*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[545][l]+(0.5477225575051661*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[543][l]+0.5477225575051661*f[102][l]*alpha_vdim[542][l]+0.6123724356957944*(f[26][l]*alpha_vdim[542][l]+f[53][l]*(alpha_vdim[524][l]+alpha_vdim[523][l])+f[52][l]*(alpha_vdim[520][l]+alpha_vdim[519][l]))+(0.5477225575051661*f[68][l]+0.6123724356957944*f[13][l])*alpha_vdim[518][l]+(0.5477225575051661*f[69][l]+0.6123724356957944*f[12][l])*alpha_vdim[517][l]+(0.5477225575051661*f[161][l]+0.6123724356957944*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[508][l]+(0.5477225575051661*f[158][l]+0.6123724356957944*(f[71][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[507][l]+0.6123724356957944*f[25][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.6123724356957944*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[496][l]+(0.6123724356957944*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[495][l]+(0.6123724356957944*f[102][l]+0.6846531968814573*f[26][l])*alpha_vdim[494][l]+(0.6123724356957944*f[101][l]+0.6846531968814573*f[27][l])*alpha_vdim[493][l]+(0.5477225575051661*f[129][l]+0.6123724356957944*(f[44][l]+f[43][l]))*alpha_vdim[492][l]+0.6846531968814573*(f[5][l]*alpha_vdim[492][l]+f[53][l]*alpha_vdim[490][l]+f[52][l]*alpha_vdim[489][l])+(0.6123724356957944*f[69][l]+0.6846531968814573*f[12][l])*alpha_vdim[488][l]+0.6123724356957944*f[68][l]*alpha_vdim[487][l]+0.6846531968814573*(f[13][l]*alpha_vdim[487][l]+f[25][l]*alpha_vdim[486][l])+0.3061862178478971*(f[83][l]*alpha_cdim[247][l]+f[47][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[82][l]+alpha_cdim[0][l]*f[48][l]);
+    out[81][l] += 0.6123724356957944*f[148][l]*alpha_vdim[606][l]+0.5477225575051661*f[160][l]*alpha_vdim[603][l]+0.6123724356957944*(f[69][l]*alpha_vdim[603][l]+f[102][l]*alpha_vdim[572][l])+(0.6123724356957944*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[546][l]+0.6123724356957944*f[96][l]*alpha_vdim[545][l]+(0.5477225575051661*f[206][l]+0.6123724356957944*(f[131][l]+f[129][l])+0.6846531968814573*f[44][l])*alpha_vdim[543][l]+(0.5477225575051661*f[103][l]+0.6123724356957944*f[25][l])*alpha_vdim[542][l]+0.6846531968814573*f[148][l]*alpha_vdim[524][l]+0.6123724356957944*f[54][l]*alpha_vdim[523][l]+(0.6123724356957944*f[160][l]+0.6846531968814573*f[69][l])*alpha_vdim[520][l]+(0.5477225575051661*f[72][l]+0.6123724356957944*f[12][l])*alpha_vdim[519][l]+(0.6123724356957944*f[158][l]+0.6846531968814573*f[71][l])*alpha_vdim[518][l]+0.6123724356957944*f[52][l]*alpha_vdim[517][l]+(0.6123724356957944*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[508][l]+(0.5477225575051661*f[159][l]+0.6123724356957944*(f[73][l]+f[68][l]))*alpha_vdim[507][l]+0.6846531968814573*(f[13][l]*alpha_vdim[507][l]+f[102][l]*alpha_vdim[503][l])+0.6123724356957944*f[26][l]*alpha_vdim[502][l]+0.6846531968814573*f[96][l]*alpha_vdim[496][l]+(0.6123724356957944*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[495][l]+(0.6123724356957944*f[103][l]+0.6846531968814573*f[25][l])*alpha_vdim[494][l]+(0.5477225575051661*f[130][l]+0.6123724356957944*(f[45][l]+f[43][l])+0.6846531968814573*f[5][l])*alpha_vdim[493][l]+0.6123724356957944*f[101][l]*alpha_vdim[492][l]+0.6846531968814573*(f[27][l]*alpha_vdim[492][l]+f[54][l]*alpha_vdim[490][l])+0.6123724356957944*f[72][l]*alpha_vdim[489][l]+0.6846531968814573*(f[12][l]*alpha_vdim[489][l]+f[52][l]*alpha_vdim[488][l])+0.6123724356957944*f[70][l]*alpha_vdim[487][l]+0.6846531968814573*(f[14][l]*alpha_vdim[487][l]+f[26][l]*alpha_vdim[486][l])+0.273861278752583*(alpha_vdim[60][l]*f[213][l]+alpha_vdim[32][l]*f[186][l])+(0.273861278752583*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[38][l])*f[174][l]+0.273861278752583*alpha_vdim[22][l]*f[173][l]+0.3061862178478971*alpha_vdim[60][l]*f[142][l]+0.273861278752583*alpha_vdim[9][l]*f[141][l]+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[136][l]+0.273861278752583*alpha_vdim[6][l]*f[135][l]+0.2449489742783178*(alpha_vdim[69][l]*f[129][l]+f[69][l]*alpha_vdim[129][l])+(0.273861278752583*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[114][l]+0.273861278752583*alpha_cdim[3][l]*f[94][l]+0.3061862178478971*alpha_vdim[32][l]*f[93][l]+0.273861278752583*alpha_vdim[1][l]*f[92][l]+0.3061862178478971*alpha_vdim[22][l]*f[84][l]+(0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[83][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[80][l]+0.273861278752583*(alpha_vdim[44][l]*f[69][l]+f[44][l]*alpha_vdim[69][l])+0.2449489742783178*(alpha_vdim[25][l]*f[68][l]+f[25][l]*alpha_vdim[68][l])+0.3061862178478971*(alpha_vdim[9][l]*f[50][l]+alpha_cdim[0][l]*f[49][l]+alpha_vdim[6][l]*f[48][l])+(0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[47][l]+0.2449489742783178*(alpha_vdim[12][l]*f[43][l]+f[12][l]*alpha_vdim[43][l])+0.273861278752583*(alpha_vdim[13][l]*f[25][l]+f[13][l]*alpha_vdim[25][l])+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l])*f[20][l]+0.273861278752583*(alpha_vdim[5][l]*f[12][l]+f[5][l]*alpha_vdim[12][l]);
+    out[82][l] += 0.6123724356957944*f[147][l]*alpha_vdim[606][l]+0.5477225575051661*f[159][l]*alpha_vdim[603][l]+0.6123724356957944*(f[68][l]*alpha_vdim[603][l]+f[101][l]*alpha_vdim[572][l]+f[96][l]*alpha_vdim[546][l])+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[545][l]+(0.5477225575051661*f[103][l]+0.6123724356957944*f[25][l])*alpha_vdim[543][l]+(0.5477225575051661*f[206][l]+0.6123724356957944*(f[130][l]+f[129][l])+0.6846531968814573*f[43][l])*alpha_vdim[542][l]+0.6123724356957944*f[55][l]*alpha_vdim[524][l]+0.6846531968814573*f[147][l]*alpha_vdim[523][l]+(0.5477225575051661*f[73][l]+0.6123724356957944*f[13][l])*alpha_vdim[520][l]+(0.6123724356957944*f[159][l]+0.6846531968814573*f[68][l])*alpha_vdim[519][l]+0.6123724356957944*f[52][l]*alpha_vdim[518][l]+(0.6123724356957944*f[158][l]+0.6846531968814573*f[70][l])*alpha_vdim[517][l]+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[508][l]+(0.5477225575051661*f[160][l]+0.6123724356957944*(f[72][l]+f[69][l])+0.6846531968814573*f[12][l])*alpha_vdim[507][l]+0.6123724356957944*f[27][l]*alpha_vdim[503][l]+0.6846531968814573*f[101][l]*alpha_vdim[502][l]+0.6123724356957944*f[107][l]*alpha_vdim[496][l]+0.6846531968814573*(f[30][l]*alpha_vdim[496][l]+f[96][l]*alpha_vdim[495][l])+(0.5477225575051661*f[131][l]+0.6123724356957944*(f[45][l]+f[44][l])+0.6846531968814573*f[5][l])*alpha_vdim[494][l]+(0.6123724356957944*f[103][l]+0.6846531968814573*f[25][l])*alpha_vdim[493][l]+0.6123724356957944*f[102][l]*alpha_vdim[492][l]+0.6846531968814573*(f[26][l]*alpha_vdim[492][l]+f[55][l]*alpha_vdim[490][l])+(0.6123724356957944*f[73][l]+0.6846531968814573*f[13][l])*alpha_vdim[489][l]+0.6123724356957944*f[71][l]*alpha_vdim[488][l]+0.6846531968814573*(f[14][l]*alpha_vdim[488][l]+f[52][l]*alpha_vdim[487][l]+f[27][l]*alpha_vdim[486][l])+0.3061862178478971*(f[85][l]*alpha_cdim[247][l]+f[49][l]*alpha_cdim[243][l])+0.273861278752583*(alpha_vdim[59][l]*f[213][l]+alpha_vdim[31][l]*f[186][l]+alpha_vdim[22][l]*f[174][l])+(0.273861278752583*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[37][l])*f[173][l]+0.273861278752583*alpha_vdim[10][l]*f[142][l]+0.3061862178478971*alpha_vdim[59][l]*f[141][l]+0.273861278752583*alpha_vdim[6][l]*f[136][l]+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[135][l]+0.2449489742783178*(alpha_vdim[68][l]*f[129][l]+f[68][l]*alpha_vdim[129][l])+(0.273861278752583*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[114][l]+0.273861278752583*alpha_vdim[2][l]*f[93][l]+0.3061862178478971*alpha_vdim[31][l]*f[92][l]+0.273861278752583*alpha_vdim[38][l]*f[84][l]+0.3061862178478971*(alpha_vdim[4][l]*f[84][l]+alpha_vdim[22][l]*f[83][l])+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[80][l]+0.2449489742783178*(alpha_vdim[25][l]*f[69][l]+f[25][l]*alpha_vdim[69][l])+0.273861278752583*(alpha_vdim[43][l]*f[68][l]+f[43][l]*alpha_vdim[68][l])+0.3061862178478971*alpha_vdim[10][l]*f[50][l]+0.273861278752583*alpha_vdim[17][l]*f[48][l]+0.3061862178478971*(alpha_vdim[0][l]*f[48][l]+alpha_vdim[6][l]*f[47][l])+0.2449489742783178*(alpha_vdim[13][l]*f[44][l]+f[13][l]*alpha_vdim[44][l])+0.273861278752583*(alpha_vdim[12][l]*f[25][l]+f[12][l]*alpha_vdim[25][l])+0.3061862178478971*alpha_vdim[2][l]*f[20][l]+0.273861278752583*(alpha_vdim[5][l]*f[13][l]+f[5][l]*alpha_vdim[13][l]);
+    out[83][l] += 0.5477225575051661*f[165][l]*alpha_vdim[606][l]+0.6123724356957944*(f[69][l]*alpha_vdim[606][l]+f[148][l]*alpha_vdim[603][l]+f[105][l]*alpha_vdim[572][l])+(0.5477225575051661*f[207][l]+0.6123724356957944*(f[133][l]+f[129][l])+0.6846531968814573*f[44][l])*alpha_vdim[546][l]+(0.5477225575051661*f[110][l]+0.6123724356957944*f[25][l])*alpha_vdim[545][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[543][l]+0.6123724356957944*f[96][l]*alpha_vdim[542][l]+(0.6123724356957944*f[165][l]+0.6846531968814573*f[69][l])*alpha_vdim[524][l]+(0.5477225575051661*f[77][l]+0.6123724356957944*f[12][l])*alpha_vdim[523][l]+0.6846531968814573*f[148][l]*alpha_vdim[520][l]+0.6123724356957944*f[54][l]*alpha_vdim[519][l]+(0.6123724356957944*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[518][l]+0.6123724356957944*f[53][l]*alpha_vdim[517][l]+(0.5477225575051661*f[164][l]+0.6123724356957944*(f[78][l]+f[68][l])+0.6846531968814573*f[13][l])*alpha_vdim[508][l]+0.6123724356957944*f[147][l]*alpha_vdim[507][l]+0.6846531968814573*(f[55][l]*alpha_vdim[507][l]+f[105][l]*alpha_vdim[503][l])+0.6123724356957944*f[28][l]*alpha_vdim[502][l]+(0.6123724356957944*f[110][l]+0.6846531968814573*f[25][l])*alpha_vdim[496][l]+(0.5477225575051661*f[132][l]+0.6123724356957944*(f[46][l]+f[43][l]))*alpha_vdim[495][l]+0.6846531968814573*(f[5][l]*alpha_vdim[495][l]+f[96][l]*alpha_vdim[494][l])+(0.6123724356957944*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[493][l]+(0.6123724356957944*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[492][l]+0.6123724356957944*f[77][l]*alpha_vdim[490][l]+0.6846531968814573*(f[12][l]*alpha_vdim[490][l]+f[54][l]*alpha_vdim[489][l]+f[53][l]*alpha_vdim[488][l])+0.6123724356957944*f[74][l]*alpha_vdim[487][l]+0.6846531968814573*(f[15][l]*alpha_vdim[487][l]+f[28][l]*alpha_vdim[486][l])+0.2449489742783178*f[69][l]*alpha_vdim[372][l]+0.273861278752583*(f[171][l]*alpha_vdim[360][l]+f[136][l]*alpha_vdim[329][l])+(0.2449489742783178*f[129][l]+0.273861278752583*f[44][l])*alpha_vdim[312][l]+0.2449489742783178*f[25][l]*alpha_vdim[311][l]+(0.273861278752583*f[210][l]+0.3061862178478971*f[138][l])*alpha_vdim[300][l]+0.273861278752583*(f[113][l]*alpha_vdim[299][l]+f[69][l]*alpha_vdim[287][l])+0.2449489742783178*f[12][l]*alpha_vdim[286][l]+0.3061862178478971*f[171][l]*alpha_vdim[277][l]+0.273861278752583*f[81][l]*alpha_vdim[276][l]+(0.273861278752583*f[186][l]+0.3061862178478971*f[93][l])*alpha_vdim[275][l]+0.273861278752583*f[80][l]*alpha_vdim[274][l]+0.2449489742783178*f[68][l]*alpha_vdim[268][l]+0.273861278752583*(f[13][l]*alpha_vdim[268][l]+f[170][l]*alpha_vdim[264][l])+0.3061862178478971*(f[82][l]*alpha_vdim[264][l]+f[136][l]*alpha_vdim[260][l])+0.273861278752583*(f[47][l]*alpha_vdim[259][l]+f[25][l]*alpha_vdim[256][l])+(0.2449489742783178*f[43][l]+0.273861278752583*f[5][l])*alpha_vdim[255][l]+0.3061862178478971*f[113][l]*alpha_vdim[251][l]+(0.273861278752583*f[137][l]+0.3061862178478971*f[49][l])*alpha_vdim[250][l]+(0.273861278752583*f[135][l]+0.3061862178478971*f[48][l])*alpha_vdim[249][l]+0.273861278752583*f[12][l]*alpha_vdim[248][l]+0.3061862178478971*(f[81][l]*alpha_vdim[246][l]+f[80][l]*alpha_vdim[245][l])+0.273861278752583*f[92][l]*alpha_vdim[244][l]+0.3061862178478971*(f[20][l]*alpha_vdim[244][l]+f[47][l]*alpha_vdim[243][l]+alpha_cdim[3][l]*f[85][l]+alpha_cdim[0][l]*f[50][l]);
+    out[84][l] += 0.5477225575051661*f[164][l]*alpha_vdim[606][l]+0.6123724356957944*(f[68][l]*alpha_vdim[606][l]+f[147][l]*alpha_vdim[603][l]+f[104][l]*alpha_vdim[572][l])+(0.5477225575051661*f[110][l]+0.6123724356957944*f[25][l])*alpha_vdim[546][l]+(0.5477225575051661*f[207][l]+0.6123724356957944*(f[132][l]+f[129][l])+0.6846531968814573*f[43][l])*alpha_vdim[545][l]+0.6123724356957944*f[96][l]*alpha_vdim[543][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[542][l]+(0.5477225575051661*f[78][l]+0.6123724356957944*f[13][l])*alpha_vdim[524][l]+(0.6123724356957944*f[164][l]+0.6846531968814573*f[68][l])*alpha_vdim[523][l]+0.6123724356957944*f[55][l]*alpha_vdim[520][l]+0.6846531968814573*f[147][l]*alpha_vdim[519][l]+0.6123724356957944*f[53][l]*alpha_vdim[518][l]+(0.6123724356957944*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[517][l]+(0.5477225575051661*f[165][l]+0.6123724356957944*(f[77][l]+f[69][l])+0.6846531968814573*f[12][l])*alpha_vdim[508][l]+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[507][l]+0.6123724356957944*f[29][l]*alpha_vdim[503][l]+0.6846531968814573*f[104][l]*alpha_vdim[502][l]+(0.5477225575051661*f[133][l]+0.6123724356957944*(f[46][l]+f[44][l])+0.6846531968814573*f[5][l])*alpha_vdim[496][l]+(0.6123724356957944*f[110][l]+0.6846531968814573*f[25][l])*alpha_vdim[495][l]+0.6123724356957944*f[107][l]*alpha_vdim[494][l]+0.6846531968814573*(f[30][l]*alpha_vdim[494][l]+f[96][l]*alpha_vdim[493][l])+(0.6123724356957944*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[492][l]+0.6123724356957944*f[78][l]*alpha_vdim[490][l]+0.6846531968814573*(f[13][l]*alpha_vdim[490][l]+f[55][l]*alpha_vdim[489][l])+0.6123724356957944*f[75][l]*alpha_vdim[488][l]+0.6846531968814573*(f[15][l]*alpha_vdim[488][l]+f[53][l]*alpha_vdim[487][l]+f[29][l]*alpha_vdim[486][l])+0.2449489742783178*f[68][l]*alpha_vdim[372][l]+0.273861278752583*(f[170][l]*alpha_vdim[360][l]+f[135][l]*alpha_vdim[329][l])+0.2449489742783178*(f[25][l]*alpha_vdim[312][l]+f[129][l]*alpha_vdim[311][l])+0.273861278752583*(f[43][l]*alpha_vdim[311][l]+f[113][l]*alpha_vdim[300][l])+(0.273861278752583*f[210][l]+0.3061862178478971*f[137][l])*alpha_vdim[299][l]+0.2449489742783178*f[13][l]*alpha_vdim[287][l]+0.273861278752583*(f[68][l]*alpha_vdim[286][l]+f[82][l]*alpha_vdim[277][l])+0.3061862178478971*f[170][l]*alpha_vdim[276][l]+0.273861278752583*f[80][l]*alpha_vdim[275][l]+(0.273861278752583*f[186][l]+0.3061862178478971*f[92][l])*alpha_vdim[274][l]+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[268][l]+(0.273861278752583*f[171][l]+0.3061862178478971*f[81][l])*alpha_vdim[264][l]+0.273861278752583*f[48][l]*alpha_vdim[260][l]+0.3061862178478971*f[135][l]*alpha_vdim[259][l]+0.2449489742783178*f[44][l]*alpha_vdim[256][l]+0.273861278752583*(f[5][l]*alpha_vdim[256][l]+f[25][l]*alpha_vdim[255][l]+f[138][l]*alpha_vdim[251][l])+0.3061862178478971*(f[49][l]*alpha_vdim[251][l]+f[113][l]*alpha_vdim[250][l])+(0.273861278752583*f[136][l]+0.3061862178478971*f[47][l])*alpha_vdim[249][l]+0.273861278752583*(f[13][l]*alpha_vdim[248][l]+f[95][l]*alpha_cdim[247][l])+0.3061862178478971*(f[20][l]*alpha_cdim[247][l]+f[82][l]*alpha_vdim[246][l])+0.273861278752583*f[93][l]*alpha_vdim[245][l]+0.3061862178478971*(f[20][l]*alpha_vdim[245][l]+f[80][l]*alpha_vdim[244][l]+f[48][l]*alpha_vdim[243][l]+f[50][l]*alpha_cdim[243][l]);
+    out[85][l] += (0.6123724356957944*f[223][l]+0.6846531968814573*f[158][l])*alpha_vdim[606][l]+0.6123724356957944*f[222][l]*alpha_vdim[603][l]+0.6846531968814573*(f[161][l]*alpha_vdim[603][l]+f[192][l]*alpha_vdim[572][l])+(0.6123724356957944*f[196][l]+0.6846531968814573*f[102][l])*alpha_vdim[546][l]+(0.6123724356957944*f[195][l]+0.6846531968814573*f[101][l])*alpha_vdim[545][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[105][l])*alpha_vdim[543][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[104][l])*alpha_vdim[542][l]+(0.6123724356957944*f[167][l]+0.6846531968814573*f[71][l])*alpha_vdim[524][l]+(0.6123724356957944*f[166][l]+0.6846531968814573*f[70][l])*alpha_vdim[523][l]+(0.6123724356957944*f[163][l]+0.6846531968814573*f[75][l])*alpha_vdim[520][l]+0.6123724356957944*f[162][l]*alpha_vdim[519][l]+0.6846531968814573*(f[74][l]*alpha_vdim[519][l]+f[148][l]*alpha_vdim[518][l]+f[147][l]*alpha_vdim[517][l])+(0.6123724356957944*f[150][l]+0.6846531968814573*f[52][l])*alpha_vdim[508][l]+0.6123724356957944*f[149][l]*alpha_vdim[507][l]+0.6846531968814573*(f[53][l]*alpha_vdim[507][l]+f[107][l]*alpha_vdim[503][l]+f[106][l]*alpha_vdim[502][l])+(0.6123724356957944*f[112][l]+0.6846531968814573*f[27][l])*alpha_vdim[496][l]+(0.6123724356957944*f[111][l]+0.6846531968814573*f[26][l])*alpha_vdim[495][l]+(0.6123724356957944*f[109][l]+0.6846531968814573*f[29][l])*alpha_vdim[494][l]+0.6123724356957944*f[108][l]*alpha_vdim[493][l]+0.6846531968814573*(f[28][l]*alpha_vdim[493][l]+f[96][l]*alpha_vdim[492][l])+(0.6123724356957944*f[79][l]+0.6846531968814573*f[14][l])*alpha_vdim[490][l]+0.6123724356957944*f[76][l]*alpha_vdim[489][l]+0.6846531968814573*(f[15][l]*alpha_vdim[489][l]+f[55][l]*alpha_vdim[488][l]+f[54][l]*alpha_vdim[487][l]+f[30][l]*alpha_vdim[486][l])+0.273861278752583*(f[158][l]*alpha_vdim[372][l]+f[233][l]*alpha_vdim[360][l])+0.3061862178478971*(f[186][l]*alpha_vdim[360][l]+f[210][l]*alpha_vdim[329][l])+0.273861278752583*(f[102][l]*alpha_vdim[312][l]+f[101][l]*alpha_vdim[311][l])+(0.273861278752583*f[212][l]+0.3061862178478971*f[136][l])*alpha_vdim[300][l]+(0.273861278752583*f[211][l]+0.3061862178478971*f[135][l])*alpha_vdim[299][l]+0.273861278752583*(f[71][l]*alpha_vdim[287][l]+f[70][l]*alpha_vdim[286][l])+(0.273861278752583*f[188][l]+0.3061862178478971*f[93][l])*alpha_vdim[277][l]+0.273861278752583*f[187][l]*alpha_vdim[276][l]+0.3061862178478971*(f[92][l]*alpha_vdim[276][l]+f[171][l]*alpha_vdim[275][l]+f[170][l]*alpha_vdim[274][l])+0.273861278752583*(f[52][l]*alpha_vdim[268][l]+f[172][l]*alpha_vdim[264][l])+0.3061862178478971*(f[80][l]*alpha_vdim[264][l]+f[138][l]*alpha_vdim[260][l]+f[137][l]*alpha_vdim[259][l])+0.273861278752583*(f[27][l]*alpha_vdim[256][l]+f[26][l]*alpha_vdim[255][l])+(0.273861278752583*f[140][l]+0.3061862178478971*f[48][l])*alpha_vdim[251][l]+0.273861278752583*f[139][l]*alpha_vdim[250][l]+0.3061862178478971*(f[47][l]*alpha_vdim[250][l]+f[113][l]*alpha_vdim[249][l])+0.273861278752583*(f[14][l]*alpha_vdim[248][l]+f[94][l]*alpha_vdim[246][l])+0.3061862178478971*(f[20][l]*alpha_vdim[246][l]+f[82][l]*alpha_vdim[245][l]+f[81][l]*alpha_vdim[244][l]+f[49][l]*alpha_vdim[243][l])+0.273861278752583*(alpha_vdim[120][l]*f[234][l]+alpha_vdim[60][l]*f[217][l]+alpha_vdim[59][l]*f[216][l])+0.3061862178478971*alpha_vdim[86][l]*f[213][l]+0.273861278752583*(alpha_vdim[38][l]*f[190][l]+alpha_vdim[37][l]*f[189][l])+0.3061862178478971*alpha_vdim[120][l]*f[186][l]+0.273861278752583*alpha_vdim[22][l]*f[179][l]+0.3061862178478971*(alpha_vdim[32][l]*f[174][l]+alpha_vdim[31][l]*f[173][l])+0.273861278752583*(alpha_vdim[129][l]*f[161][l]+alpha_vdim[10][l]*f[145][l]+alpha_vdim[9][l]*f[144][l])+0.3061862178478971*(alpha_vdim[17][l]*f[142][l]+alpha_vdim[16][l]*f[141][l]+alpha_vdim[60][l]*f[136][l]+alpha_vdim[59][l]*f[135][l]+alpha_vdim[6][l]*f[114][l])+0.273861278752583*(alpha_vdim[69][l]*f[105][l]+alpha_vdim[68][l]*f[104][l]+alpha_vdim[4][l]*f[95][l])+0.3061862178478971*(alpha_vdim[38][l]*f[93][l]+alpha_vdim[37][l]*f[92][l]+alpha_vdim[2][l]*f[84][l]+alpha_vdim[1][l]*f[83][l]+alpha_vdim[22][l]*f[80][l])+0.273861278752583*(alpha_vdim[44][l]*f[75][l]+alpha_vdim[43][l]*f[74][l]+alpha_vdim[25][l]*f[53][l])+0.3061862178478971*(alpha_vdim[0][l]*f[50][l]+alpha_vdim[10][l]*f[48][l]+alpha_vdim[9][l]*f[47][l])+0.273861278752583*(alpha_vdim[13][l]*f[29][l]+alpha_vdim[12][l]*f[28][l])+0.3061862178478971*alpha_vdim[4][l]*f[20][l]+0.273861278752583*alpha_vdim[5][l]*f[15][l];
+    out[86][l] += 0.6846531968814573*(f[59][l]*alpha_cdim[247][l]+f[31][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[57][l]+alpha_cdim[0][l]*f[32][l]);
+    out[87][l] += (0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[44][l])*f[158][l]+0.4374088826398531*alpha_vdim[120][l]*f[152][l]+0.6846531968814573*(alpha_vdim[38][l]*f[152][l]+f[71][l]*alpha_vdim[129][l]+f[62][l]*alpha_vdim[120][l])+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[117][l]+0.6123724356957944*alpha_vdim[69][l]*f[102][l]+(0.4374088826398531*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[13][l])*f[101][l]+0.6123724356957944*alpha_vdim[60][l]*f[98][l]+0.4374088826398531*alpha_vdim[59][l]*f[97][l]+0.6846531968814573*(alpha_vdim[10][l]*f[97][l]+f[34][l]*alpha_vdim[86][l])+0.4374088826398531*alpha_vdim[43][l]*f[70][l]+0.6846531968814573*(alpha_vdim[5][l]*f[70][l]+f[27][l]*alpha_vdim[68][l])+0.4374088826398531*alpha_vdim[37][l]*f[61][l]+0.6846531968814573*(alpha_vdim[4][l]*f[61][l]+f[24][l]*alpha_vdim[59][l])+0.6123724356957944*alpha_vdim[32][l]*f[57][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[56][l]+0.6123724356957944*(alpha_vdim[25][l]*f[52][l]+alpha_vdim[22][l]*f[51][l])+0.6846531968814573*(f[14][l]*alpha_vdim[43][l]+f[11][l]*alpha_vdim[37][l]+alpha_cdim[0][l]*f[35][l])+0.4374088826398531*alpha_vdim[16][l]*f[33][l]+0.6846531968814573*(alpha_vdim[0][l]*f[33][l]+f[8][l]*alpha_vdim[31][l])+0.6123724356957944*(alpha_vdim[12][l]*f[26][l]+alpha_vdim[9][l]*f[23][l]+alpha_vdim[6][l]*f[21][l])+0.6846531968814573*f[3][l]*alpha_vdim[16][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l])*f[7][l];
+    out[88][l] += 0.6846531968814573*(f[64][l]*alpha_cdim[247][l]+f[36][l]*alpha_cdim[243][l])+(0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[43][l])*f[158][l]+0.4374088826398531*alpha_vdim[120][l]*f[152][l]+0.6846531968814573*(alpha_vdim[37][l]*f[152][l]+f[70][l]*alpha_vdim[129][l]+f[61][l]*alpha_vdim[120][l])+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[117][l]+(0.4374088826398531*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[102][l]+0.6123724356957944*alpha_vdim[68][l]*f[101][l]+(0.4374088826398531*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[98][l]+0.6123724356957944*alpha_vdim[59][l]*f[97][l]+0.6846531968814573*f[33][l]*alpha_vdim[86][l]+0.4374088826398531*alpha_vdim[44][l]*f[71][l]+0.6846531968814573*(alpha_vdim[5][l]*f[71][l]+f[26][l]*alpha_vdim[69][l])+0.4374088826398531*alpha_vdim[38][l]*f[62][l]+0.6846531968814573*(alpha_vdim[4][l]*f[62][l]+f[23][l]*alpha_vdim[60][l])+(0.4374088826398531*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[57][l]+0.6123724356957944*(alpha_vdim[31][l]*f[56][l]+alpha_vdim[25][l]*f[52][l]+alpha_vdim[22][l]*f[51][l])+0.6846531968814573*(f[14][l]*alpha_vdim[44][l]+f[11][l]*alpha_vdim[38][l])+0.4374088826398531*alpha_vdim[17][l]*f[34][l]+0.6846531968814573*(alpha_vdim[0][l]*f[34][l]+f[7][l]*alpha_vdim[32][l])+0.6123724356957944*(alpha_vdim[13][l]*f[27][l]+alpha_vdim[10][l]*f[24][l]+alpha_vdim[6][l]*f[21][l])+0.6846531968814573*f[3][l]*alpha_vdim[17][l]+0.6123724356957944*alpha_vdim[2][l]*f[8][l];
+    out[89][l] += (0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[372][l]+(0.4374088826398531*f[152][l]+0.6846531968814573*f[62][l])*alpha_vdim[360][l]+(0.4374088826398531*f[120][l]+0.6846531968814573*f[38][l])*alpha_vdim[329][l]+0.6123724356957944*f[105][l]*alpha_vdim[312][l]+(0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[311][l]+0.6123724356957944*f[98][l]*alpha_vdim[300][l]+0.4374088826398531*f[97][l]*alpha_vdim[299][l]+0.6846531968814573*(f[24][l]*alpha_vdim[299][l]+f[161][l]*alpha_vdim[287][l])+0.4374088826398531*f[74][l]*alpha_vdim[286][l]+0.6846531968814573*(f[15][l]*alpha_vdim[286][l]+f[152][l]*alpha_vdim[277][l])+(0.4374088826398531*f[61][l]+0.6846531968814573*f[11][l])*alpha_vdim[276][l]+0.6123724356957944*f[60][l]*alpha_vdim[275][l]+(0.4374088826398531*f[59][l]+0.6846531968814573*f[10][l])*alpha_vdim[274][l]+0.6123724356957944*(f[53][l]*alpha_vdim[268][l]+f[51][l]*alpha_vdim[264][l])+0.6846531968814573*f[120][l]*alpha_vdim[260][l]+0.4374088826398531*f[37][l]*alpha_vdim[259][l]+0.6846531968814573*(f[4][l]*alpha_vdim[259][l]+f[104][l]*alpha_vdim[256][l])+0.6123724356957944*f[28][l]*alpha_vdim[255][l]+0.6846531968814573*f[97][l]*alpha_vdim[251][l]+0.6123724356957944*(f[23][l]*alpha_vdim[250][l]+f[22][l]*alpha_vdim[249][l])+0.6846531968814573*(f[74][l]*alpha_vdim[248][l]+f[61][l]*alpha_vdim[246][l]+f[59][l]*alpha_vdim[245][l])+0.6123724356957944*f[9][l]*alpha_vdim[244][l]+0.6846531968814573*(f[37][l]*alpha_vdim[243][l]+alpha_cdim[3][l]*f[66][l]+alpha_cdim[0][l]*f[40][l]);
+    out[90][l] += (0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[372][l]+(0.4374088826398531*f[152][l]+0.6846531968814573*f[61][l])*alpha_vdim[360][l]+(0.4374088826398531*f[120][l]+0.6846531968814573*f[37][l])*alpha_vdim[329][l]+(0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[312][l]+0.6123724356957944*f[104][l]*alpha_vdim[311][l]+(0.4374088826398531*f[98][l]+0.6846531968814573*f[23][l])*alpha_vdim[300][l]+0.6123724356957944*f[97][l]*alpha_vdim[299][l]+0.4374088826398531*f[75][l]*alpha_vdim[287][l]+0.6846531968814573*(f[15][l]*alpha_vdim[287][l]+f[161][l]*alpha_vdim[286][l])+0.4374088826398531*f[62][l]*alpha_vdim[277][l]+0.6846531968814573*(f[11][l]*alpha_vdim[277][l]+f[152][l]*alpha_vdim[276][l])+(0.4374088826398531*f[60][l]+0.6846531968814573*f[9][l])*alpha_vdim[275][l]+0.6123724356957944*(f[59][l]*alpha_vdim[274][l]+f[53][l]*alpha_vdim[268][l]+f[51][l]*alpha_vdim[264][l])+0.4374088826398531*f[38][l]*alpha_vdim[260][l]+0.6846531968814573*(f[4][l]*alpha_vdim[260][l]+f[120][l]*alpha_vdim[259][l])+0.6123724356957944*f[29][l]*alpha_vdim[256][l]+0.6846531968814573*f[105][l]*alpha_vdim[255][l]+0.6123724356957944*f[24][l]*alpha_vdim[251][l]+0.6846531968814573*f[98][l]*alpha_vdim[250][l]+0.6123724356957944*f[22][l]*alpha_vdim[249][l]+0.6846531968814573*f[75][l]*alpha_vdim[248][l]+0.6123724356957944*f[10][l]*alpha_cdim[247][l]+0.6846531968814573*f[62][l]*alpha_vdim[246][l]+0.6123724356957944*f[10][l]*alpha_vdim[245][l]+0.6846531968814573*(f[60][l]*alpha_vdim[244][l]+f[38][l]*alpha_vdim[243][l]+f[41][l]*alpha_cdim[243][l]);
+    out[91][l] += 0.6846531968814573*f[222][l]*alpha_vdim[372][l]+0.6123724356957944*f[152][l]*alpha_vdim[360][l]+0.6846531968814573*(f[202][l]*alpha_vdim[329][l]+f[194][l]*alpha_vdim[312][l]+f[193][l]*alpha_vdim[311][l])+0.6123724356957944*(f[98][l]*alpha_vdim[300][l]+f[97][l]*alpha_vdim[299][l])+0.6846531968814573*(f[163][l]*alpha_vdim[287][l]+f[162][l]*alpha_vdim[286][l])+0.6123724356957944*(f[62][l]*alpha_vdim[277][l]+f[61][l]*alpha_vdim[276][l])+0.6846531968814573*(f[154][l]*alpha_vdim[275][l]+f[153][l]*alpha_vdim[274][l]+f[149][l]*alpha_vdim[268][l])+0.6123724356957944*f[51][l]*alpha_vdim[264][l]+0.6846531968814573*(f[122][l]*alpha_vdim[260][l]+f[121][l]*alpha_vdim[259][l]+f[109][l]*alpha_vdim[256][l]+f[108][l]*alpha_vdim[255][l])+0.6123724356957944*(f[24][l]*alpha_vdim[251][l]+f[23][l]*alpha_vdim[250][l])+0.6846531968814573*(f[99][l]*alpha_vdim[249][l]+f[76][l]*alpha_vdim[248][l])+0.6123724356957944*f[11][l]*alpha_vdim[246][l]+0.6846531968814573*(f[64][l]*alpha_vdim[245][l]+f[63][l]*alpha_vdim[244][l]+f[39][l]*alpha_vdim[243][l]+alpha_vdim[129][l]*f[223][l]+alpha_vdim[86][l]*f[203][l]+alpha_vdim[69][l]*f[196][l]+alpha_vdim[68][l]*f[195][l]+alpha_vdim[44][l]*f[167][l]+alpha_vdim[43][l]*f[166][l]+alpha_vdim[32][l]*f[156][l]+alpha_vdim[31][l]*f[155][l])+0.6123724356957944*alpha_vdim[120][l]*f[152][l]+0.6846531968814573*(alpha_vdim[25][l]*f[150][l]+alpha_vdim[17][l]*f[126][l]+alpha_vdim[16][l]*f[125][l]+alpha_vdim[13][l]*f[112][l]+alpha_vdim[12][l]*f[111][l]+alpha_vdim[6][l]*f[100][l])+0.6123724356957944*(alpha_vdim[60][l]*f[98][l]+alpha_vdim[59][l]*f[97][l])+0.6846531968814573*(alpha_vdim[5][l]*f[79][l]+alpha_vdim[2][l]*f[67][l]+alpha_vdim[1][l]*f[66][l])+0.6123724356957944*(alpha_vdim[38][l]*f[62][l]+alpha_vdim[37][l]*f[61][l]+alpha_vdim[22][l]*f[51][l])+0.6846531968814573*alpha_vdim[0][l]*f[42][l]+0.6123724356957944*(alpha_vdim[10][l]*f[24][l]+alpha_vdim[9][l]*f[23][l]+alpha_vdim[4][l]*f[11][l]);
+    out[92][l] += (0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[606][l]+(0.4374088826398531*f[158][l]+0.6846531968814573*f[71][l])*alpha_vdim[603][l]+(0.4374088826398531*f[129][l]+0.6846531968814573*f[44][l])*alpha_vdim[572][l]+0.6123724356957944*f[105][l]*alpha_vdim[546][l]+(0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[545][l]+0.6123724356957944*f[102][l]*alpha_vdim[543][l]+0.4374088826398531*f[101][l]*alpha_vdim[542][l]+0.6846531968814573*(f[27][l]*alpha_vdim[542][l]+f[161][l]*alpha_vdim[524][l])+0.4374088826398531*f[74][l]*alpha_vdim[523][l]+0.6846531968814573*(f[15][l]*alpha_vdim[523][l]+f[158][l]*alpha_vdim[520][l])+(0.4374088826398531*f[70][l]+0.6846531968814573*f[14][l])*alpha_vdim[519][l]+0.6123724356957944*f[69][l]*alpha_vdim[518][l]+(0.4374088826398531*f[68][l]+0.6846531968814573*f[13][l])*alpha_vdim[517][l]+0.6123724356957944*(f[53][l]*alpha_vdim[508][l]+f[52][l]*alpha_vdim[507][l])+0.6846531968814573*f[129][l]*alpha_vdim[503][l]+0.4374088826398531*f[43][l]*alpha_vdim[502][l]+0.6846531968814573*(f[5][l]*alpha_vdim[502][l]+f[104][l]*alpha_vdim[496][l])+0.6123724356957944*f[28][l]*alpha_vdim[495][l]+0.6846531968814573*f[101][l]*alpha_vdim[494][l]+0.6123724356957944*(f[26][l]*alpha_vdim[493][l]+f[25][l]*alpha_vdim[492][l])+0.6846531968814573*(f[74][l]*alpha_vdim[490][l]+f[70][l]*alpha_vdim[489][l]+f[68][l]*alpha_vdim[488][l])+0.6123724356957944*f[12][l]*alpha_vdim[487][l]+0.6846531968814573*(f[43][l]*alpha_vdim[486][l]+alpha_cdim[3][l]*f[81][l]+alpha_cdim[0][l]*f[47][l]);
+    out[93][l] += (0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[606][l]+(0.4374088826398531*f[158][l]+0.6846531968814573*f[70][l])*alpha_vdim[603][l]+(0.4374088826398531*f[129][l]+0.6846531968814573*f[43][l])*alpha_vdim[572][l]+(0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[546][l]+0.6123724356957944*f[104][l]*alpha_vdim[545][l]+(0.4374088826398531*f[102][l]+0.6846531968814573*f[26][l])*alpha_vdim[543][l]+0.6123724356957944*f[101][l]*alpha_vdim[542][l]+0.4374088826398531*f[75][l]*alpha_vdim[524][l]+0.6846531968814573*(f[15][l]*alpha_vdim[524][l]+f[161][l]*alpha_vdim[523][l])+0.4374088826398531*f[71][l]*alpha_vdim[520][l]+0.6846531968814573*(f[14][l]*alpha_vdim[520][l]+f[158][l]*alpha_vdim[519][l])+(0.4374088826398531*f[69][l]+0.6846531968814573*f[12][l])*alpha_vdim[518][l]+0.6123724356957944*(f[68][l]*alpha_vdim[517][l]+f[53][l]*alpha_vdim[508][l]+f[52][l]*alpha_vdim[507][l])+0.4374088826398531*f[44][l]*alpha_vdim[503][l]+0.6846531968814573*(f[5][l]*alpha_vdim[503][l]+f[129][l]*alpha_vdim[502][l])+0.6123724356957944*f[29][l]*alpha_vdim[496][l]+0.6846531968814573*f[105][l]*alpha_vdim[495][l]+0.6123724356957944*f[27][l]*alpha_vdim[494][l]+0.6846531968814573*f[102][l]*alpha_vdim[493][l]+0.6123724356957944*f[25][l]*alpha_vdim[492][l]+0.6846531968814573*(f[75][l]*alpha_vdim[490][l]+f[71][l]*alpha_vdim[489][l])+0.6123724356957944*f[13][l]*alpha_vdim[488][l]+0.6846531968814573*(f[69][l]*alpha_vdim[487][l]+f[44][l]*alpha_vdim[486][l]+f[84][l]*alpha_cdim[247][l]+f[48][l]*alpha_cdim[243][l]);
+    out[94][l] += 0.6846531968814573*f[222][l]*alpha_vdim[606][l]+0.6123724356957944*f[158][l]*alpha_vdim[603][l]+0.6846531968814573*(f[206][l]*alpha_vdim[572][l]+f[194][l]*alpha_vdim[546][l]+f[193][l]*alpha_vdim[545][l])+0.6123724356957944*(f[102][l]*alpha_vdim[543][l]+f[101][l]*alpha_vdim[542][l])+0.6846531968814573*(f[163][l]*alpha_vdim[524][l]+f[162][l]*alpha_vdim[523][l])+0.6123724356957944*(f[71][l]*alpha_vdim[520][l]+f[70][l]*alpha_vdim[519][l])+0.6846531968814573*(f[160][l]*alpha_vdim[518][l]+f[159][l]*alpha_vdim[517][l]+f[149][l]*alpha_vdim[508][l])+0.6123724356957944*f[52][l]*alpha_vdim[507][l]+0.6846531968814573*(f[131][l]*alpha_vdim[503][l]+f[130][l]*alpha_vdim[502][l]+f[109][l]*alpha_vdim[496][l]+f[108][l]*alpha_vdim[495][l])+0.6123724356957944*(f[27][l]*alpha_vdim[494][l]+f[26][l]*alpha_vdim[493][l])+0.6846531968814573*(f[103][l]*alpha_vdim[492][l]+f[76][l]*alpha_vdim[490][l])+0.6123724356957944*f[14][l]*alpha_vdim[489][l]+0.6846531968814573*(f[73][l]*alpha_vdim[488][l]+f[72][l]*alpha_vdim[487][l]+f[45][l]*alpha_vdim[486][l]+alpha_vdim[120][l]*f[226][l]+alpha_vdim[86][l]*f[210][l]+alpha_vdim[60][l]*f[199][l]+alpha_vdim[59][l]*f[198][l]+alpha_vdim[38][l]*f[176][l]+alpha_vdim[37][l]*f[175][l]+alpha_vdim[32][l]*f[171][l]+alpha_vdim[31][l]*f[170][l])+0.6123724356957944*alpha_vdim[129][l]*f[158][l]+0.6846531968814573*(alpha_vdim[22][l]*f[151][l]+alpha_vdim[17][l]*f[138][l]+alpha_vdim[16][l]*f[137][l]+alpha_vdim[10][l]*f[116][l]+alpha_vdim[9][l]*f[115][l]+alpha_vdim[6][l]*f[113][l])+0.6123724356957944*(alpha_vdim[69][l]*f[102][l]+alpha_vdim[68][l]*f[101][l])+0.6846531968814573*(alpha_vdim[4][l]*f[85][l]+alpha_vdim[2][l]*f[82][l]+alpha_vdim[1][l]*f[81][l])+0.6123724356957944*(alpha_vdim[44][l]*f[71][l]+alpha_vdim[43][l]*f[70][l]+alpha_vdim[25][l]*f[52][l])+0.6846531968814573*alpha_vdim[0][l]*f[49][l]+0.6123724356957944*(alpha_vdim[13][l]*f[27][l]+alpha_vdim[12][l]*f[26][l]+alpha_vdim[5][l]*f[14][l]);
+    out[95][l] += 0.6123724356957944*f[161][l]*alpha_vdim[606][l]+0.6846531968814573*(f[223][l]*alpha_vdim[603][l]+f[207][l]*alpha_vdim[572][l])+0.6123724356957944*(f[105][l]*alpha_vdim[546][l]+f[104][l]*alpha_vdim[545][l])+0.6846531968814573*(f[196][l]*alpha_vdim[543][l]+f[195][l]*alpha_vdim[542][l])+0.6123724356957944*(f[75][l]*alpha_vdim[524][l]+f[74][l]*alpha_vdim[523][l])+0.6846531968814573*(f[167][l]*alpha_vdim[520][l]+f[166][l]*alpha_vdim[519][l]+f[165][l]*alpha_vdim[518][l]+f[164][l]*alpha_vdim[517][l])+0.6123724356957944*f[53][l]*alpha_vdim[508][l]+0.6846531968814573*(f[150][l]*alpha_vdim[507][l]+f[133][l]*alpha_vdim[503][l]+f[132][l]*alpha_vdim[502][l])+0.6123724356957944*(f[29][l]*alpha_vdim[496][l]+f[28][l]*alpha_vdim[495][l])+0.6846531968814573*(f[112][l]*alpha_vdim[494][l]+f[111][l]*alpha_vdim[493][l]+f[110][l]*alpha_vdim[492][l])+0.6123724356957944*f[15][l]*alpha_vdim[490][l]+0.6846531968814573*(f[79][l]*alpha_vdim[489][l]+f[78][l]*alpha_vdim[488][l]+f[77][l]*alpha_vdim[487][l]+f[46][l]*alpha_vdim[486][l])+0.6123724356957944*f[161][l]*alpha_vdim[372][l]+0.6846531968814573*(f[226][l]*alpha_vdim[360][l]+f[213][l]*alpha_vdim[329][l])+0.6123724356957944*(f[105][l]*alpha_vdim[312][l]+f[104][l]*alpha_vdim[311][l])+0.6846531968814573*(f[199][l]*alpha_vdim[300][l]+f[198][l]*alpha_vdim[299][l])+0.6123724356957944*(f[75][l]*alpha_vdim[287][l]+f[74][l]*alpha_vdim[286][l])+0.6846531968814573*(f[176][l]*alpha_vdim[277][l]+f[175][l]*alpha_vdim[276][l]+f[174][l]*alpha_vdim[275][l]+f[173][l]*alpha_vdim[274][l])+0.6123724356957944*f[53][l]*alpha_vdim[268][l]+0.6846531968814573*(f[151][l]*alpha_vdim[264][l]+f[142][l]*alpha_vdim[260][l]+f[141][l]*alpha_vdim[259][l])+0.6123724356957944*(f[29][l]*alpha_vdim[256][l]+f[28][l]*alpha_vdim[255][l])+0.6846531968814573*(f[116][l]*alpha_vdim[251][l]+f[115][l]*alpha_vdim[250][l]+f[114][l]*alpha_vdim[249][l])+0.6123724356957944*f[15][l]*alpha_vdim[248][l]+0.6846531968814573*(f[85][l]*alpha_vdim[246][l]+f[84][l]*alpha_vdim[245][l]+f[83][l]*alpha_vdim[244][l]+f[50][l]*alpha_vdim[243][l]);
+    out[96][l] += (0.2190890230020664*f[100][l]+0.2449489742783178*f[21][l])*alpha_vdim[606][l]+0.2190890230020664*f[99][l]*alpha_vdim[603][l]+0.2449489742783178*(f[22][l]*alpha_vdim[603][l]+f[51][l]*alpha_vdim[572][l])+(0.2190890230020664*f[155][l]+0.2449489742783178*(f[67][l]+f[56][l])+0.273861278752583*f[8][l])*alpha_vdim[546][l]+(0.2190890230020664*f[156][l]+0.2449489742783178*(f[66][l]+f[57][l])+0.273861278752583*f[7][l])*alpha_vdim[545][l]+(0.2190890230020664*f[153][l]+0.2449489742783178*(f[64][l]+f[59][l])+0.273861278752583*f[10][l])*alpha_vdim[543][l]+(0.2190890230020664*f[154][l]+0.2449489742783178*(f[63][l]+f[60][l])+0.273861278752583*f[9][l])*alpha_vdim[542][l]+(0.2449489742783178*f[100][l]+0.273861278752583*f[21][l])*alpha_vdim[524][l]+(0.2449489742783178*f[100][l]+0.273861278752583*f[21][l])*alpha_vdim[523][l]+(0.2449489742783178*f[99][l]+0.273861278752583*f[22][l])*alpha_vdim[520][l]+(0.2449489742783178*f[99][l]+0.273861278752583*f[22][l])*alpha_vdim[519][l]+(0.2449489742783178*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[518][l]+(0.2449489742783178*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[517][l]+(0.2190890230020664*f[203][l]+0.2449489742783178*(f[126][l]+f[125][l]+f[117][l])+0.273861278752583*(f[42][l]+f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[508][l]+(0.2190890230020664*f[202][l]+0.2449489742783178*(f[122][l]+f[121][l]+f[120][l])+0.273861278752583*(f[39][l]+f[38][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[507][l]+0.273861278752583*f[51][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.2449489742783178*f[156][l]+0.273861278752583*(f[66][l]+f[57][l])+0.3061862178478971*f[7][l])*alpha_vdim[496][l]+(0.2449489742783178*f[155][l]+0.273861278752583*(f[67][l]+f[56][l])+0.3061862178478971*f[8][l])*alpha_vdim[495][l]+(0.2449489742783178*f[154][l]+0.273861278752583*(f[63][l]+f[60][l])+0.3061862178478971*f[9][l])*alpha_vdim[494][l]+(0.2449489742783178*f[153][l]+0.273861278752583*(f[64][l]+f[59][l])+0.3061862178478971*f[10][l])*alpha_vdim[493][l]+(0.2449489742783178*f[152][l]+0.273861278752583*(f[62][l]+f[61][l])+0.3061862178478971*f[11][l])*alpha_vdim[492][l]+(0.273861278752583*f[100][l]+0.3061862178478971*f[21][l])*alpha_vdim[490][l]+(0.273861278752583*f[99][l]+0.3061862178478971*f[22][l])*alpha_vdim[489][l]+(0.273861278752583*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[488][l]+0.273861278752583*f[97][l]*alpha_vdim[487][l]+0.3061862178478971*(f[24][l]*alpha_vdim[487][l]+f[51][l]*alpha_vdim[486][l])+(0.2190890230020664*f[113][l]+0.2449489742783178*f[21][l])*alpha_vdim[372][l]+0.2190890230020664*f[103][l]*alpha_vdim[360][l]+0.2449489742783178*(f[25][l]*alpha_vdim[360][l]+f[52][l]*alpha_vdim[329][l])+(0.2190890230020664*f[170][l]+0.2449489742783178*(f[82][l]+f[56][l])+0.273861278752583*f[8][l])*alpha_vdim[312][l]+(0.2190890230020664*f[171][l]+0.2449489742783178*(f[81][l]+f[57][l])+0.273861278752583*f[7][l])*alpha_vdim[311][l]+(0.2190890230020664*f[159][l]+0.2449489742783178*(f[73][l]+f[68][l])+0.273861278752583*f[13][l])*alpha_vdim[300][l]+(0.2190890230020664*f[160][l]+0.2449489742783178*(f[72][l]+f[69][l])+0.273861278752583*f[12][l])*alpha_vdim[299][l]+(0.2449489742783178*f[113][l]+0.273861278752583*f[21][l])*alpha_vdim[287][l]+(0.2449489742783178*f[113][l]+0.273861278752583*f[21][l])*alpha_vdim[286][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[25][l])*alpha_vdim[277][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[25][l])*alpha_vdim[276][l]+(0.2449489742783178*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[275][l]+(0.2449489742783178*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[274][l]+(0.2190890230020664*f[210][l]+0.2449489742783178*(f[138][l]+f[137][l]+f[117][l])+0.273861278752583*(f[49][l]+f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[268][l]+(0.2190890230020664*f[206][l]+0.2449489742783178*(f[131][l]+f[130][l]+f[129][l])+0.273861278752583*(f[45][l]+f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[264][l]+0.273861278752583*f[52][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.2449489742783178*f[171][l]+0.273861278752583*(f[81][l]+f[57][l])+0.3061862178478971*f[7][l])*alpha_vdim[256][l]+(0.2449489742783178*f[170][l]+0.273861278752583*(f[82][l]+f[56][l])+0.3061862178478971*f[8][l])*alpha_vdim[255][l]+(0.2449489742783178*f[160][l]+0.273861278752583*(f[72][l]+f[69][l])+0.3061862178478971*f[12][l])*alpha_vdim[251][l]+(0.2449489742783178*f[159][l]+0.273861278752583*(f[73][l]+f[68][l])+0.3061862178478971*f[13][l])*alpha_vdim[250][l]+(0.2449489742783178*f[158][l]+0.273861278752583*(f[71][l]+f[70][l])+0.3061862178478971*f[14][l])*alpha_vdim[249][l]+(0.273861278752583*f[113][l]+0.3061862178478971*f[21][l])*alpha_vdim[248][l]+(0.273861278752583*f[111][l]+0.3061862178478971*f[26][l])*alpha_cdim[247][l]+(0.273861278752583*f[103][l]+0.3061862178478971*f[25][l])*alpha_vdim[246][l]+(0.273861278752583*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[245][l]+0.273861278752583*f[101][l]*alpha_vdim[244][l]+0.3061862178478971*(f[27][l]*alpha_vdim[244][l]+f[52][l]*alpha_vdim[243][l]+f[54][l]*alpha_cdim[243][l])+0.2190890230020664*(alpha_vdim[25][l]*f[213][l]+alpha_vdim[22][l]*f[207][l])+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[174][l]+(0.2190890230020664*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[173][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[165][l]+0.2190890230020664*alpha_vdim[60][l]*f[164][l]+0.2449489742783178*(alpha_vdim[9][l]*f[164][l]+alpha_vdim[6][l]*f[161][l]+alpha_vdim[25][l]*(f[142][l]+f[141][l])+alpha_vdim[22][l]*(f[133][l]+f[132][l]+f[129][l]))+0.2190890230020664*f[114][l]*alpha_vdim[129][l]+0.2449489742783178*(f[22][l]*alpha_vdim[129][l]+alpha_vdim[25][l]*f[120][l])+(0.2190890230020664*f[110][l]+0.2449489742783178*f[25][l])*alpha_vdim[120][l]+(0.2449489742783178*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.273861278752583*alpha_vdim[5][l])*f[114][l]+0.2449489742783178*(alpha_vdim[38][l]+alpha_vdim[37][l])*f[110][l]+0.273861278752583*(alpha_vdim[4][l]*f[110][l]+alpha_cdim[3][l]*f[109][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[105][l]+(0.2449489742783178*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[104][l]+0.2449489742783178*f[53][l]*alpha_vdim[86][l]+(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[84][l]+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[83][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[78][l]+0.2449489742783178*alpha_vdim[59][l]*f[77][l]+0.273861278752583*(alpha_vdim[10][l]*f[77][l]+alpha_vdim[6][l]*(f[75][l]+f[74][l]))+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[69][l]+(0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[69][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[68][l]+0.2449489742783178*f[60][l]*alpha_vdim[68][l]+0.273861278752583*(f[9][l]*alpha_vdim[68][l]+alpha_vdim[13][l]*f[60][l]+f[13][l]*alpha_vdim[60][l]+alpha_vdim[12][l]*f[59][l]+f[12][l]*alpha_vdim[59][l])+0.3061862178478971*alpha_cdim[0][l]*f[55][l]+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[53][l]+0.273861278752583*(alpha_vdim[25][l]*f[50][l]+alpha_vdim[22][l]*(f[46][l]+f[44][l])+f[22][l]*alpha_vdim[44][l]+alpha_vdim[22][l]*f[43][l]+f[22][l]*alpha_vdim[43][l]+alpha_vdim[25][l]*f[38][l]+f[25][l]*alpha_vdim[38][l]+alpha_vdim[25][l]*f[37][l]+f[25][l]*alpha_vdim[37][l]+f[29][l]*alpha_vdim[32][l]+f[28][l]*alpha_vdim[31][l])+0.3061862178478971*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[29][l]+alpha_vdim[2][l]*f[28][l]+alpha_vdim[4][l]*f[25][l]+f[4][l]*alpha_vdim[25][l]+alpha_vdim[5][l]*f[22][l]+f[5][l]*alpha_vdim[22][l]+alpha_vdim[6][l]*f[15][l]+alpha_vdim[9][l]*f[13][l]+f[9][l]*alpha_vdim[13][l]+alpha_vdim[10][l]*f[12][l]+f[10][l]*alpha_vdim[12][l]);
+    out[97][l] += (0.1749635530559412*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[372][l]+(0.1564921592871903*f[118][l]+0.2449489742783178*f[36][l]+0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[360][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[329][l]+0.2449489742783178*f[52][l]*alpha_vdim[312][l]+(0.1749635530559412*f[158][l]+0.273861278752583*f[71][l]+0.1956151991089878*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[311][l]+(0.2190890230020664*f[58][l]+0.2449489742783178*f[6][l])*alpha_vdim[300][l]+(0.1564921592871903*f[182][l]+0.2449489742783178*f[88][l]+0.1749635530559412*(f[87][l]+f[86][l])+0.273861278752583*(f[18][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[299][l]+0.273861278752583*f[101][l]*alpha_vdim[287][l]+(0.1956151991089878*f[101][l]+0.3061862178478971*f[27][l])*alpha_vdim[286][l]+(0.2449489742783178*f[118][l]+0.273861278752583*f[31][l])*alpha_vdim[277][l]+(0.1749635530559412*f[118][l]+0.273861278752583*f[36][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[276][l]+0.2449489742783178*f[21][l]*alpha_vdim[275][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[34][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[274][l]+(0.2449489742783178*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[268][l]+(0.2190890230020664*f[119][l]+0.2449489742783178*(f[35][l]+f[32][l]))*alpha_vdim[264][l]+0.273861278752583*(f[1][l]*alpha_vdim[264][l]+f[56][l]*alpha_vdim[260][l])+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[259][l]+(0.273861278752583*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[256][l]+0.273861278752583*f[52][l]*alpha_vdim[255][l]+(0.2449489742783178*f[182][l]+0.273861278752583*(f[87][l]+f[86][l])+0.3061862178478971*f[16][l])*alpha_vdim[251][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[250][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[249][l]+0.3061862178478971*f[101][l]*alpha_vdim[248][l]+(0.273861278752583*f[125][l]+0.3061862178478971*f[33][l])*alpha_cdim[247][l]+(0.273861278752583*f[118][l]+0.3061862178478971*f[31][l])*alpha_vdim[246][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[245][l]+0.273861278752583*f[21][l]*alpha_vdim[244][l]+0.3061862178478971*(f[56][l]*alpha_vdim[243][l]+f[61][l]*alpha_cdim[243][l])+(0.1564921592871903*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[183][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[161][l]+(0.1749635530559412*f[104][l]+0.273861278752583*f[29][l])*alpha_vdim[129][l]+0.2190890230020664*alpha_vdim[22][l]*f[124][l]+(0.1564921592871903*alpha_vdim[120][l]+0.2449489742783178*alpha_vdim[38][l]+0.1749635530559412*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[123][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[120][l]+(0.2449489742783178*f[41][l]+0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[120][l]+0.2449489742783178*alpha_vdim[25][l]*f[105][l]+(0.273861278752583*alpha_vdim[44][l]+0.1956151991089878*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[104][l]+0.6123724356957944*alpha_cdim[3][l]*f[99][l]+0.2449489742783178*alpha_vdim[59][l]*f[90][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[89][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[86][l]+0.1749635530559412*f[59][l]*alpha_vdim[86][l]+0.273861278752583*(f[10][l]*alpha_vdim[86][l]+alpha_vdim[68][l]*f[75][l])+(0.1956151991089878*alpha_vdim[68][l]+0.3061862178478971*alpha_vdim[13][l])*f[74][l]+0.2449489742783178*f[53][l]*alpha_vdim[69][l]+0.3061862178478971*f[15][l]*alpha_vdim[68][l]+0.2190890230020664*alpha_vdim[60][l]*f[65][l]+0.2449489742783178*(alpha_vdim[9][l]*f[65][l]+alpha_vdim[6][l]*f[60][l]+f[6][l]*alpha_vdim[60][l])+(0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[59][l]+(0.273861278752583*(f[19][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[12][l]*f[53][l]+0.6846531968814573*alpha_cdim[0][l]*f[51][l]+0.3061862178478971*f[29][l]*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[37][l]*f[41][l]+0.2449489742783178*alpha_vdim[22][l]*f[40][l]+0.273861278752583*(alpha_vdim[31][l]*f[38][l]+f[31][l]*alpha_vdim[38][l])+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[37][l]+(0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[37][l]+0.2449489742783178*(alpha_vdim[22][l]*f[32][l]+f[22][l]*alpha_vdim[32][l])+0.3061862178478971*(alpha_vdim[4][l]*f[31][l]+f[4][l]*alpha_vdim[31][l])+0.273861278752583*alpha_vdim[25][l]*f[28][l]+0.6846531968814573*alpha_cdim[3][l]*f[22][l]+0.273861278752583*(alpha_vdim[1][l]*f[22][l]+f[1][l]*alpha_vdim[22][l])+0.3061862178478971*(alpha_vdim[10][l]*f[16][l]+f[10][l]*alpha_vdim[16][l])+0.273861278752583*(alpha_vdim[6][l]*f[9][l]+f[6][l]*alpha_vdim[9][l]);
+    out[98][l] += (0.1749635530559412*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[372][l]+(0.1564921592871903*f[119][l]+0.2449489742783178*f[35][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[360][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[329][l]+(0.1749635530559412*f[158][l]+0.1956151991089878*f[71][l]+0.273861278752583*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[312][l]+0.2449489742783178*f[52][l]*alpha_vdim[311][l]+(0.1564921592871903*f[182][l]+0.1749635530559412*f[88][l]+0.2449489742783178*f[87][l]+0.1749635530559412*f[86][l]+0.273861278752583*f[18][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[300][l]+(0.2190890230020664*f[58][l]+0.2449489742783178*f[6][l])*alpha_vdim[299][l]+(0.1956151991089878*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[287][l]+0.273861278752583*f[102][l]*alpha_vdim[286][l]+(0.1749635530559412*f[119][l]+0.273861278752583*f[35][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[277][l]+(0.2449489742783178*f[119][l]+0.273861278752583*f[32][l])*alpha_vdim[276][l]+(0.1749635530559412*f[117][l]+0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[275][l]+0.2449489742783178*f[21][l]*alpha_vdim[274][l]+(0.2449489742783178*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[268][l]+(0.2190890230020664*f[118][l]+0.2449489742783178*(f[36][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[264][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[260][l]+0.273861278752583*(f[57][l]*alpha_vdim[259][l]+f[52][l]*alpha_vdim[256][l])+(0.273861278752583*f[158][l]+0.3061862178478971*f[71][l])*alpha_vdim[255][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[251][l]+(0.2449489742783178*f[182][l]+0.273861278752583*(f[88][l]+f[86][l])+0.3061862178478971*f[17][l])*alpha_vdim[250][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[249][l]+0.3061862178478971*f[102][l]*alpha_vdim[248][l]+(0.6123724356957944*f[100][l]+0.6846531968814573*f[21][l])*alpha_cdim[247][l]+(0.273861278752583*f[119][l]+0.3061862178478971*f[32][l])*alpha_vdim[246][l]+0.273861278752583*(f[21][l]*alpha_vdim[245][l]+f[117][l]*alpha_vdim[244][l])+0.3061862178478971*(f[34][l]*alpha_vdim[244][l]+f[57][l]*alpha_vdim[243][l])+0.6846531968814573*f[51][l]*alpha_cdim[243][l]+(0.1564921592871903*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[183][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[161][l]+(0.1749635530559412*f[105][l]+0.273861278752583*f[28][l])*alpha_vdim[129][l]+(0.1564921592871903*alpha_vdim[120][l]+0.1749635530559412*alpha_vdim[38][l]+0.2449489742783178*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[124][l]+0.2190890230020664*alpha_vdim[22][l]*f[123][l]+0.273861278752583*alpha_cdim[3][l]*f[122][l]+(0.1749635530559412*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[120][l]+(0.2449489742783178*f[40][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[120][l]+(0.1956151991089878*alpha_vdim[44][l]+0.273861278752583*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[105][l]+0.2449489742783178*alpha_vdim[25][l]*f[104][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[90][l]+0.2449489742783178*alpha_vdim[60][l]*f[89][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[86][l]+(0.1749635530559412*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[86][l]+(0.1956151991089878*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[75][l]+alpha_vdim[69][l]*(0.273861278752583*f[74][l]+0.3061862178478971*f[15][l])+0.2449489742783178*f[53][l]*alpha_vdim[68][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[65][l]+0.3061862178478971*alpha_cdim[0][l]*f[62][l]+(0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[60][l]+(0.273861278752583*f[19][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[60][l]+0.2449489742783178*(alpha_vdim[6][l]*f[59][l]+f[6][l]*alpha_vdim[59][l])+0.273861278752583*alpha_vdim[13][l]*f[53][l]+0.3061862178478971*f[28][l]*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[22][l]*f[41][l]+0.273861278752583*alpha_vdim[38][l]*f[40][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[38][l]+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[38][l]+0.273861278752583*(alpha_vdim[32][l]*f[37][l]+f[32][l]*alpha_vdim[37][l])+0.3061862178478971*(alpha_vdim[4][l]*f[32][l]+f[4][l]*alpha_vdim[32][l])+0.2449489742783178*(alpha_vdim[22][l]*f[31][l]+f[22][l]*alpha_vdim[31][l])+0.273861278752583*(alpha_vdim[25][l]*f[29][l]+alpha_vdim[2][l]*f[22][l]+f[2][l]*alpha_vdim[22][l])+0.3061862178478971*(alpha_vdim[9][l]*f[17][l]+f[9][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[6][l]*f[10][l]+f[6][l]*alpha_vdim[10][l]);
+    out[99][l] += 0.2449489742783178*f[103][l]*alpha_vdim[372][l]+0.2190890230020664*f[21][l]*alpha_vdim[360][l]+0.2449489742783178*f[58][l]*alpha_vdim[329][l]+(0.2449489742783178*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[312][l]+(0.2449489742783178*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[311][l]+(0.2190890230020664*f[56][l]+0.2449489742783178*f[8][l])*alpha_vdim[300][l]+(0.2190890230020664*f[57][l]+0.2449489742783178*f[7][l])*alpha_vdim[299][l]+0.273861278752583*f[103][l]*(alpha_vdim[287][l]+alpha_vdim[286][l])+0.2449489742783178*f[21][l]*(alpha_vdim[277][l]+alpha_vdim[276][l])+(0.2449489742783178*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[275][l]+(0.2449489742783178*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[274][l]+(0.2449489742783178*f[206][l]+0.273861278752583*(f[131][l]+f[130][l])+0.3061862178478971*f[45][l])*alpha_vdim[268][l]+(0.2190890230020664*f[117][l]+0.2449489742783178*(f[34][l]+f[33][l]))*alpha_vdim[264][l]+0.273861278752583*(f[3][l]*alpha_vdim[264][l]+f[58][l]*(alpha_vdim[260][l]+alpha_vdim[259][l]))+(0.273861278752583*f[160][l]+0.3061862178478971*f[72][l])*alpha_vdim[256][l]+(0.273861278752583*f[159][l]+0.3061862178478971*f[73][l])*alpha_vdim[255][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[251][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[250][l]+(0.2449489742783178*f[182][l]+0.273861278752583*(f[88][l]+f[87][l]))*alpha_vdim[249][l]+0.3061862178478971*(f[18][l]*alpha_vdim[249][l]+f[103][l]*alpha_vdim[248][l])+(0.273861278752583*f[127][l]+0.3061862178478971*f[35][l])*alpha_cdim[247][l]+0.273861278752583*f[21][l]*alpha_vdim[246][l]+(0.273861278752583*f[119][l]+0.3061862178478971*f[35][l])*alpha_vdim[245][l]+0.273861278752583*f[118][l]*alpha_vdim[244][l]+0.3061862178478971*(f[36][l]*alpha_vdim[244][l]+f[58][l]*alpha_vdim[243][l]+f[63][l]*alpha_cdim[243][l])+0.4898979485566357*alpha_vdim[22][l]*f[203][l]+0.5477225575051661*alpha_vdim[25][l]*f[192][l]+(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[156][l]+0.4898979485566357*alpha_vdim[60][l]*f[155][l]+0.5477225575051661*(alpha_vdim[9][l]*f[155][l]+alpha_vdim[6][l]*f[152][l])+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[148][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[147][l]+0.5477225575051661*(f[96][l]*alpha_vdim[129][l]+alpha_vdim[22][l]*(f[126][l]+f[125][l]))+0.4898979485566357*f[100][l]*alpha_vdim[120][l]+0.5477225575051661*(f[21][l]*alpha_vdim[120][l]+alpha_vdim[22][l]*f[117][l])+0.6123724356957944*alpha_vdim[25][l]*(f[107][l]+f[106][l])+(0.5477225575051661*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[100][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[98][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[97][l]+(0.6123724356957944*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6846531968814573*alpha_vdim[5][l])*f[96][l]+0.5477225575051661*f[51][l]*alpha_vdim[86][l]+0.6123724356957944*(f[55][l]*alpha_vdim[69][l]+f[54][l]*alpha_vdim[68][l])+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[67][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[66][l]+0.3061862178478971*alpha_cdim[0][l]*f[64][l]+0.6123724356957944*alpha_vdim[6][l]*(f[62][l]+f[61][l])+(0.5477225575051661*f[56][l]+0.6123724356957944*f[8][l])*alpha_vdim[60][l]+0.5477225575051661*f[57][l]*alpha_vdim[59][l]+0.6123724356957944*(f[7][l]*alpha_vdim[59][l]+alpha_vdim[10][l]*f[57][l]+alpha_vdim[9][l]*f[56][l])+0.6846531968814573*(alpha_vdim[12][l]*f[55][l]+alpha_vdim[13][l]*f[54][l])+(0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[51][l]+0.6123724356957944*(alpha_vdim[22][l]*f[42][l]+f[21][l]*(alpha_vdim[38][l]+alpha_vdim[37][l])+alpha_vdim[22][l]*(f[34][l]+f[33][l])+f[24][l]*alpha_vdim[32][l]+f[23][l]*alpha_vdim[31][l])+0.6846531968814573*alpha_vdim[25][l]*f[30][l]+0.273861278752583*alpha_cdim[3][l]*f[24][l]+0.6846531968814573*(alpha_vdim[1][l]*f[24][l]+alpha_vdim[2][l]*f[23][l]+f[3][l]*alpha_vdim[22][l]+alpha_vdim[4][l]*f[21][l]+alpha_vdim[6][l]*f[11][l]+f[7][l]*alpha_vdim[10][l]+f[8][l]*alpha_vdim[9][l]);
+    out[100][l] += 0.5477225575051661*f[96][l]*alpha_vdim[372][l]+0.4898979485566357*f[99][l]*alpha_vdim[360][l]+0.5477225575051661*(f[22][l]*alpha_vdim[360][l]+f[51][l]*alpha_vdim[329][l])+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[312][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[311][l]+(0.4898979485566357*f[153][l]+0.5477225575051661*(f[64][l]+f[59][l])+0.6123724356957944*f[10][l])*alpha_vdim[300][l]+(0.4898979485566357*f[154][l]+0.5477225575051661*(f[63][l]+f[60][l]))*alpha_vdim[299][l]+0.6123724356957944*(f[9][l]*alpha_vdim[299][l]+f[96][l]*(alpha_vdim[287][l]+alpha_vdim[286][l]))+(0.5477225575051661*f[99][l]+0.6123724356957944*f[22][l])*alpha_vdim[277][l]+(0.5477225575051661*f[99][l]+0.6123724356957944*f[22][l])*alpha_vdim[276][l]+(0.5477225575051661*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[275][l]+(0.5477225575051661*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[274][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[268][l]+(0.4898979485566357*f[202][l]+0.5477225575051661*(f[122][l]+f[121][l]+f[120][l])+0.6123724356957944*(f[39][l]+f[38][l]+f[37][l])+0.6846531968814573*f[4][l])*alpha_vdim[264][l]+0.6123724356957944*f[51][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[256][l]+(0.6123724356957944*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[255][l]+(0.5477225575051661*f[154][l]+0.6123724356957944*(f[63][l]+f[60][l])+0.6846531968814573*f[9][l])*alpha_vdim[251][l]+(0.5477225575051661*f[153][l]+0.6123724356957944*(f[64][l]+f[59][l])+0.6846531968814573*f[10][l])*alpha_vdim[250][l]+(0.5477225575051661*f[152][l]+0.6123724356957944*(f[62][l]+f[61][l]))*alpha_vdim[249][l]+0.6846531968814573*(f[11][l]*alpha_vdim[249][l]+f[96][l]*alpha_vdim[248][l])+0.273861278752583*f[23][l]*alpha_cdim[247][l]+(0.6123724356957944*f[99][l]+0.6846531968814573*f[22][l])*alpha_vdim[246][l]+(0.6123724356957944*f[98][l]+0.6846531968814573*f[23][l])*alpha_vdim[245][l]+0.6123724356957944*f[97][l]*alpha_vdim[244][l]+0.6846531968814573*(f[24][l]*alpha_vdim[244][l]+f[51][l]*alpha_vdim[243][l])+0.3061862178478971*f[66][l]*alpha_cdim[243][l]+0.2449489742783178*(alpha_vdim[25][l]*f[207][l]+alpha_vdim[6][l]*f[183][l])+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[165][l]+0.2449489742783178*alpha_vdim[69][l]*f[164][l]+0.273861278752583*(alpha_vdim[12][l]*f[164][l]+alpha_vdim[25][l]*(f[133][l]+f[132][l]))+0.2449489742783178*f[110][l]*alpha_vdim[129][l]+0.273861278752583*alpha_cdim[3][l]*f[128][l]+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[124][l]+(0.2449489742783178*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[123][l]+0.2190890230020664*(alpha_vdim[22][l]*f[120][l]+f[22][l]*alpha_vdim[120][l])+(0.273861278752583*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[110][l]+0.273861278752583*alpha_vdim[6][l]*(f[90][l]+f[89][l])+0.2449489742783178*f[65][l]*alpha_vdim[86][l]+(0.273861278752583*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[78][l]+0.273861278752583*alpha_vdim[68][l]*f[77][l]+0.3061862178478971*(alpha_vdim[13][l]*f[77][l]+alpha_cdim[0][l]*f[67][l])+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[65][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[60][l]+0.2190890230020664*f[59][l]*alpha_vdim[60][l]+0.2449489742783178*(f[10][l]*alpha_vdim[60][l]+alpha_vdim[9][l]*f[59][l]+f[9][l]*alpha_vdim[59][l])+0.3061862178478971*alpha_vdim[25][l]*f[46][l]+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[41][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[40][l]+0.2449489742783178*(alpha_vdim[22][l]*f[38][l]+f[22][l]*alpha_vdim[38][l]+alpha_vdim[22][l]*f[37][l]+f[22][l]*alpha_vdim[37][l])+0.273861278752583*(alpha_vdim[4][l]*f[22][l]+f[4][l]*alpha_vdim[22][l])+0.3061862178478971*alpha_vdim[6][l]*f[19][l]+0.273861278752583*(alpha_vdim[9][l]*f[10][l]+f[9][l]*alpha_vdim[10][l]);
+    out[101][l] += (0.1749635530559412*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[606][l]+(0.1564921592871903*f[118][l]+0.2449489742783178*f[36][l]+0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[603][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[572][l]+0.2449489742783178*f[51][l]*alpha_vdim[546][l]+(0.1749635530559412*f[152][l]+0.273861278752583*f[62][l]+0.1956151991089878*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[545][l]+(0.2190890230020664*f[58][l]+0.2449489742783178*f[6][l])*alpha_vdim[543][l]+(0.1564921592871903*f[182][l]+0.2449489742783178*f[88][l]+0.1749635530559412*(f[87][l]+f[86][l])+0.273861278752583*(f[18][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[542][l]+0.273861278752583*f[97][l]*alpha_vdim[524][l]+(0.1956151991089878*f[97][l]+0.3061862178478971*f[24][l])*alpha_vdim[523][l]+(0.2449489742783178*f[118][l]+0.273861278752583*f[31][l])*alpha_vdim[520][l]+(0.1749635530559412*f[118][l]+0.273861278752583*f[36][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[519][l]+0.2449489742783178*f[21][l]*alpha_vdim[518][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[34][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[517][l]+(0.2449489742783178*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[508][l]+(0.2190890230020664*f[119][l]+0.2449489742783178*(f[35][l]+f[32][l]))*alpha_vdim[507][l]+0.273861278752583*(f[1][l]*alpha_vdim[507][l]+f[56][l]*alpha_vdim[503][l])+(0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[502][l]+(0.273861278752583*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[496][l]+0.273861278752583*f[51][l]*alpha_vdim[495][l]+(0.2449489742783178*f[182][l]+0.273861278752583*(f[87][l]+f[86][l])+0.3061862178478971*f[16][l])*alpha_vdim[494][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[493][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[492][l]+0.3061862178478971*f[97][l]*alpha_vdim[490][l]+(0.273861278752583*f[118][l]+0.3061862178478971*f[31][l])*alpha_vdim[489][l]+(0.273861278752583*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[488][l]+0.273861278752583*f[21][l]*alpha_vdim[487][l]+0.3061862178478971*(f[56][l]*alpha_vdim[486][l]+f[106][l]*alpha_cdim[247][l]+f[70][l]*alpha_cdim[243][l])+(0.1564921592871903*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[186][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[161][l]+0.2190890230020664*alpha_vdim[25][l]*f[136][l]+(0.1564921592871903*alpha_vdim[129][l]+0.2449489742783178*alpha_vdim[44][l]+0.1749635530559412*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[135][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[129][l]+(0.2449489742783178*f[48][l]+0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[129][l]+(0.1749635530559412*f[104][l]+0.273861278752583*f[29][l])*alpha_vdim[120][l]+0.2449489742783178*alpha_vdim[22][l]*f[105][l]+(0.273861278752583*alpha_vdim[38][l]+0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[104][l]+0.6123724356957944*alpha_cdim[3][l]*f[103][l]+0.2449489742783178*alpha_vdim[68][l]*f[93][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[92][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[86][l]+(0.1749635530559412*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[86][l]+(0.2190890230020664*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[80][l]+0.273861278752583*alpha_vdim[59][l]*f[75][l]+(0.1956151991089878*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[74][l]+0.2449489742783178*(alpha_vdim[6][l]*f[69][l]+f[6][l]*alpha_vdim[69][l])+(0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[68][l]+(0.273861278752583*(f[20][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[68][l]+0.2449489742783178*f[53][l]*alpha_vdim[60][l]+0.3061862178478971*f[15][l]*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[9][l]*f[53][l]+0.6846531968814573*alpha_cdim[0][l]*f[52][l]+0.273861278752583*alpha_vdim[43][l]*f[48][l]+0.2449489742783178*alpha_vdim[25][l]*f[47][l]+0.273861278752583*(alpha_vdim[31][l]*f[44][l]+f[31][l]*alpha_vdim[44][l])+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[43][l]+0.1956151991089878*f[31][l]*alpha_vdim[43][l]+0.3061862178478971*(f[2][l]*alpha_vdim[43][l]+f[29][l]*alpha_vdim[37][l])+0.2449489742783178*(alpha_vdim[25][l]*f[32][l]+f[25][l]*alpha_vdim[32][l])+0.3061862178478971*(alpha_vdim[5][l]*f[31][l]+f[5][l]*alpha_vdim[31][l])+0.273861278752583*alpha_vdim[22][l]*f[28][l]+0.6846531968814573*alpha_cdim[3][l]*f[25][l]+0.273861278752583*(alpha_vdim[1][l]*f[25][l]+f[1][l]*alpha_vdim[25][l])+0.3061862178478971*(alpha_vdim[13][l]*f[16][l]+f[13][l]*alpha_vdim[16][l])+0.273861278752583*(alpha_vdim[6][l]*f[12][l]+f[6][l]*alpha_vdim[12][l]);
+    out[102][l] += (0.1749635530559412*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[606][l]+(0.1564921592871903*f[119][l]+0.2449489742783178*f[35][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[603][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[572][l]+(0.1749635530559412*f[152][l]+0.1956151991089878*f[62][l]+0.273861278752583*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[546][l]+0.2449489742783178*f[51][l]*alpha_vdim[545][l]+(0.1564921592871903*f[182][l]+0.1749635530559412*f[88][l]+0.2449489742783178*f[87][l]+0.1749635530559412*f[86][l]+0.273861278752583*f[18][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[543][l]+(0.2190890230020664*f[58][l]+0.2449489742783178*f[6][l])*alpha_vdim[542][l]+(0.1956151991089878*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[524][l]+0.273861278752583*f[98][l]*alpha_vdim[523][l]+(0.1749635530559412*f[119][l]+0.273861278752583*f[35][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[520][l]+(0.2449489742783178*f[119][l]+0.273861278752583*f[32][l])*alpha_vdim[519][l]+(0.1749635530559412*f[117][l]+0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[518][l]+0.2449489742783178*f[21][l]*alpha_vdim[517][l]+(0.2449489742783178*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[508][l]+(0.2190890230020664*f[118][l]+0.2449489742783178*(f[36][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[507][l]+(0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[503][l]+0.273861278752583*(f[57][l]*alpha_vdim[502][l]+f[51][l]*alpha_vdim[496][l])+(0.273861278752583*f[152][l]+0.3061862178478971*f[62][l])*alpha_vdim[495][l]+(0.2449489742783178*f[58][l]+0.273861278752583*f[6][l])*alpha_vdim[494][l]+(0.2449489742783178*f[182][l]+0.273861278752583*(f[88][l]+f[86][l])+0.3061862178478971*f[17][l])*alpha_vdim[493][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[492][l]+0.3061862178478971*f[98][l]*alpha_vdim[490][l]+(0.273861278752583*f[119][l]+0.3061862178478971*f[32][l])*alpha_vdim[489][l]+0.273861278752583*(f[21][l]*alpha_vdim[488][l]+f[117][l]*alpha_vdim[487][l])+0.3061862178478971*(f[34][l]*alpha_vdim[487][l]+f[57][l]*alpha_vdim[486][l])+0.6846531968814573*(f[96][l]*alpha_cdim[247][l]+f[52][l]*alpha_cdim[243][l])+(0.1564921592871903*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[186][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[161][l]+(0.1564921592871903*alpha_vdim[129][l]+0.1749635530559412*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[136][l]+0.2190890230020664*alpha_vdim[25][l]*f[135][l]+0.273861278752583*alpha_cdim[3][l]*f[131][l]+(0.1749635530559412*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[129][l]+(0.2449489742783178*f[47][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[129][l]+(0.1749635530559412*f[105][l]+0.273861278752583*f[28][l])*alpha_vdim[120][l]+(0.1956151991089878*alpha_vdim[38][l]+0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[105][l]+0.2449489742783178*alpha_vdim[22][l]*f[104][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[93][l]+0.2449489742783178*alpha_vdim[69][l]*f[92][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[86][l]+(0.1749635530559412*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[86][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[80][l]+(0.1956151991089878*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[75][l]+0.273861278752583*alpha_vdim[60][l]*f[74][l]+0.3061862178478971*alpha_cdim[0][l]*f[71][l]+(0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[69][l]+(0.273861278752583*f[20][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[69][l]+0.2449489742783178*(alpha_vdim[6][l]*f[68][l]+f[6][l]*alpha_vdim[68][l])+0.3061862178478971*f[15][l]*alpha_vdim[60][l]+f[53][l]*(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])+0.2449489742783178*alpha_vdim[25][l]*f[48][l]+0.273861278752583*alpha_vdim[44][l]*f[47][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[44][l]+(0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[44][l]+0.273861278752583*(alpha_vdim[32][l]*f[43][l]+f[32][l]*alpha_vdim[43][l])+0.3061862178478971*(f[28][l]*alpha_vdim[38][l]+alpha_vdim[5][l]*f[32][l]+f[5][l]*alpha_vdim[32][l])+0.2449489742783178*(alpha_vdim[25][l]*f[31][l]+f[25][l]*alpha_vdim[31][l])+0.273861278752583*(alpha_vdim[22][l]*f[29][l]+alpha_vdim[2][l]*f[25][l]+f[2][l]*alpha_vdim[25][l])+0.3061862178478971*(alpha_vdim[12][l]*f[17][l]+f[12][l]*alpha_vdim[17][l])+0.273861278752583*(alpha_vdim[6][l]*f[13][l]+f[6][l]*alpha_vdim[13][l]);
+    out[103][l] += 0.2449489742783178*f[99][l]*alpha_vdim[606][l]+0.2190890230020664*f[21][l]*alpha_vdim[603][l]+0.2449489742783178*f[58][l]*alpha_vdim[572][l]+(0.2449489742783178*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[546][l]+(0.2449489742783178*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[545][l]+(0.2190890230020664*f[56][l]+0.2449489742783178*f[8][l])*alpha_vdim[543][l]+(0.2190890230020664*f[57][l]+0.2449489742783178*f[7][l])*alpha_vdim[542][l]+0.273861278752583*f[99][l]*(alpha_vdim[524][l]+alpha_vdim[523][l])+0.2449489742783178*f[21][l]*(alpha_vdim[520][l]+alpha_vdim[519][l])+(0.2449489742783178*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[518][l]+(0.2449489742783178*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[517][l]+(0.2449489742783178*f[202][l]+0.273861278752583*(f[122][l]+f[121][l])+0.3061862178478971*f[39][l])*alpha_vdim[508][l]+(0.2190890230020664*f[117][l]+0.2449489742783178*(f[34][l]+f[33][l]))*alpha_vdim[507][l]+0.273861278752583*(f[3][l]*alpha_vdim[507][l]+f[58][l]*(alpha_vdim[503][l]+alpha_vdim[502][l]))+(0.273861278752583*f[154][l]+0.3061862178478971*f[63][l])*alpha_vdim[496][l]+(0.273861278752583*f[153][l]+0.3061862178478971*f[64][l])*alpha_vdim[495][l]+(0.2449489742783178*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[494][l]+(0.2449489742783178*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[493][l]+(0.2449489742783178*f[182][l]+0.273861278752583*(f[88][l]+f[87][l]))*alpha_vdim[492][l]+0.3061862178478971*(f[18][l]*alpha_vdim[492][l]+f[99][l]*alpha_vdim[490][l])+0.273861278752583*f[21][l]*alpha_vdim[489][l]+(0.273861278752583*f[119][l]+0.3061862178478971*f[35][l])*alpha_vdim[488][l]+0.273861278752583*f[118][l]*alpha_vdim[487][l]+0.3061862178478971*(f[36][l]*alpha_vdim[487][l]+f[58][l]*alpha_vdim[486][l]+f[108][l]*alpha_cdim[247][l]+f[72][l]*alpha_cdim[243][l])+0.4898979485566357*alpha_vdim[25][l]*f[210][l]+0.5477225575051661*alpha_vdim[22][l]*f[192][l]+(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[171][l]+0.4898979485566357*alpha_vdim[69][l]*f[170][l]+0.5477225575051661*(alpha_vdim[12][l]*f[170][l]+alpha_vdim[6][l]*f[158][l])+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[148][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[147][l]+0.5477225575051661*alpha_vdim[25][l]*(f[138][l]+f[137][l])+0.4898979485566357*f[113][l]*alpha_vdim[129][l]+0.5477225575051661*(f[21][l]*alpha_vdim[129][l]+f[96][l]*alpha_vdim[120][l]+alpha_vdim[25][l]*f[117][l]+(alpha_vdim[44][l]+alpha_vdim[43][l])*f[113][l])+0.6123724356957944*(alpha_vdim[5][l]*f[113][l]+alpha_vdim[22][l]*(f[107][l]+f[106][l]))+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[102][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[101][l]+(0.6123724356957944*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[96][l]+0.5477225575051661*f[52][l]*alpha_vdim[86][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[82][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[81][l]+0.3061862178478971*alpha_cdim[0][l]*f[73][l]+0.6123724356957944*alpha_vdim[6][l]*(f[71][l]+f[70][l])+(0.5477225575051661*f[56][l]+0.6123724356957944*f[8][l])*alpha_vdim[69][l]+0.5477225575051661*f[57][l]*alpha_vdim[68][l]+0.6123724356957944*(f[7][l]*alpha_vdim[68][l]+f[55][l]*alpha_vdim[60][l]+f[54][l]*alpha_vdim[59][l]+alpha_vdim[13][l]*f[57][l]+alpha_vdim[12][l]*f[56][l])+0.6846531968814573*(alpha_vdim[9][l]*f[55][l]+alpha_vdim[10][l]*f[54][l])+(0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[52][l]+0.6123724356957944*(alpha_vdim[25][l]*f[49][l]+f[21][l]*(alpha_vdim[44][l]+alpha_vdim[43][l])+alpha_vdim[25][l]*(f[34][l]+f[33][l])+f[27][l]*alpha_vdim[32][l]+f[26][l]*alpha_vdim[31][l])+0.6846531968814573*alpha_vdim[22][l]*f[30][l]+0.273861278752583*alpha_cdim[3][l]*f[27][l]+0.6846531968814573*(alpha_vdim[1][l]*f[27][l]+alpha_vdim[2][l]*f[26][l]+f[3][l]*alpha_vdim[25][l]+alpha_vdim[5][l]*f[21][l]+alpha_vdim[6][l]*f[14][l]+f[7][l]*alpha_vdim[13][l]+f[8][l]*alpha_vdim[12][l]);
+    out[104][l] += (0.1564921592871903*f[123][l]+0.2449489742783178*f[41][l]+0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[606][l]+(0.1749635530559412*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[603][l]+(0.1749635530559412*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[572][l]+(0.2190890230020664*f[65][l]+0.2449489742783178*f[6][l])*alpha_vdim[546][l]+(0.1564921592871903*f[183][l]+0.2449489742783178*f[90][l]+0.1749635530559412*(f[89][l]+f[86][l])+0.273861278752583*(f[19][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[545][l]+0.2449489742783178*f[51][l]*alpha_vdim[543][l]+(0.1749635530559412*f[152][l]+0.273861278752583*f[62][l]+0.1956151991089878*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[542][l]+(0.2449489742783178*f[123][l]+0.273861278752583*f[31][l])*alpha_vdim[524][l]+(0.1749635530559412*f[123][l]+0.273861278752583*f[41][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[523][l]+0.273861278752583*f[97][l]*alpha_vdim[520][l]+(0.1956151991089878*f[97][l]+0.3061862178478971*f[24][l])*alpha_vdim[519][l]+0.2449489742783178*f[22][l]*alpha_vdim[518][l]+(0.1749635530559412*f[120][l]+0.273861278752583*f[38][l]+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[517][l]+(0.2190890230020664*f[124][l]+0.2449489742783178*(f[40][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[508][l]+0.2449489742783178*f[98][l]*alpha_vdim[507][l]+0.273861278752583*(f[23][l]*alpha_vdim[507][l]+f[59][l]*alpha_vdim[503][l])+(0.1956151991089878*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[502][l]+(0.2449489742783178*f[183][l]+0.273861278752583*(f[89][l]+f[86][l])+0.3061862178478971*f[16][l])*alpha_vdim[496][l]+(0.2449489742783178*f[65][l]+0.273861278752583*f[6][l])*alpha_vdim[495][l]+(0.273861278752583*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[494][l]+0.273861278752583*f[51][l]*alpha_vdim[493][l]+0.2449489742783178*f[60][l]*alpha_vdim[492][l]+0.273861278752583*(f[9][l]*alpha_vdim[492][l]+f[123][l]*alpha_vdim[490][l])+0.3061862178478971*(f[31][l]*alpha_vdim[490][l]+f[97][l]*alpha_vdim[489][l])+(0.273861278752583*f[120][l]+0.3061862178478971*f[37][l])*alpha_vdim[488][l]+0.273861278752583*f[22][l]*alpha_vdim[487][l]+0.3061862178478971*f[59][l]*alpha_vdim[486][l]+(0.1564921592871903*f[135][l]+0.2449489742783178*f[48][l]+0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[372][l]+(0.1749635530559412*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[360][l]+(0.1749635530559412*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[329][l]+(0.2190890230020664*f[80][l]+0.2449489742783178*f[6][l])*alpha_vdim[312][l]+(0.1564921592871903*f[186][l]+0.2449489742783178*f[93][l]+0.1749635530559412*(f[92][l]+f[86][l])+0.273861278752583*(f[20][l]+f[17][l])+0.1956151991089878*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[311][l]+0.2449489742783178*f[52][l]*alpha_vdim[300][l]+(0.1749635530559412*f[158][l]+0.273861278752583*f[71][l]+0.1956151991089878*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[299][l]+(0.2449489742783178*f[135][l]+0.273861278752583*f[31][l])*alpha_vdim[287][l]+(0.1749635530559412*f[135][l]+0.273861278752583*f[48][l]+0.1956151991089878*f[31][l]+0.3061862178478971*f[2][l])*alpha_vdim[286][l]+0.273861278752583*f[101][l]*alpha_vdim[277][l]+(0.1956151991089878*f[101][l]+0.3061862178478971*f[27][l])*alpha_vdim[276][l]+0.2449489742783178*f[25][l]*alpha_vdim[275][l]+(0.1749635530559412*f[129][l]+0.273861278752583*f[44][l]+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[274][l]+(0.2190890230020664*f[136][l]+0.2449489742783178*(f[47][l]+f[32][l])+0.273861278752583*f[1][l])*alpha_vdim[268][l]+0.2449489742783178*f[102][l]*alpha_vdim[264][l]+0.273861278752583*(f[26][l]*alpha_vdim[264][l]+f[68][l]*alpha_vdim[260][l])+(0.1956151991089878*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[259][l]+(0.2449489742783178*f[186][l]+0.273861278752583*(f[92][l]+f[86][l])+0.3061862178478971*f[16][l])*alpha_vdim[256][l]+(0.2449489742783178*f[80][l]+0.273861278752583*f[6][l])*alpha_vdim[255][l]+(0.273861278752583*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[251][l]+0.273861278752583*f[52][l]*alpha_vdim[250][l]+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[249][l]+(0.273861278752583*f[135][l]+0.3061862178478971*f[31][l])*alpha_vdim[248][l]+0.273861278752583*f[132][l]*alpha_cdim[247][l]+0.3061862178478971*(f[43][l]*alpha_cdim[247][l]+f[101][l]*alpha_vdim[246][l])+(0.273861278752583*f[129][l]+0.3061862178478971*f[43][l])*alpha_vdim[245][l]+0.273861278752583*f[25][l]*alpha_vdim[244][l]+0.3061862178478971*(f[68][l]*alpha_vdim[243][l]+f[74][l]*alpha_cdim[243][l])+0.6846531968814573*(alpha_cdim[3][l]*f[96][l]+alpha_cdim[0][l]*f[53][l]);
+    out[105][l] += (0.1564921592871903*f[124][l]+0.2449489742783178*f[40][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[606][l]+(0.1749635530559412*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[603][l]+(0.1749635530559412*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[572][l]+(0.1564921592871903*f[183][l]+0.1749635530559412*f[90][l]+0.2449489742783178*f[89][l]+0.1749635530559412*f[86][l]+0.273861278752583*f[19][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[546][l]+(0.2190890230020664*f[65][l]+0.2449489742783178*f[6][l])*alpha_vdim[545][l]+(0.1749635530559412*f[152][l]+0.1956151991089878*f[62][l]+0.273861278752583*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[543][l]+0.2449489742783178*f[51][l]*alpha_vdim[542][l]+(0.1749635530559412*f[124][l]+0.273861278752583*f[40][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[524][l]+(0.2449489742783178*f[124][l]+0.273861278752583*f[32][l])*alpha_vdim[523][l]+(0.1956151991089878*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[520][l]+0.273861278752583*f[98][l]*alpha_vdim[519][l]+(0.1749635530559412*f[120][l]+0.1956151991089878*f[38][l]+0.273861278752583*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[518][l]+0.2449489742783178*f[22][l]*alpha_vdim[517][l]+(0.2190890230020664*f[123][l]+0.2449489742783178*(f[41][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[508][l]+(0.2449489742783178*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[507][l]+(0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[503][l]+0.273861278752583*f[60][l]*alpha_vdim[502][l]+(0.2449489742783178*f[65][l]+0.273861278752583*f[6][l])*alpha_vdim[496][l]+(0.2449489742783178*f[183][l]+0.273861278752583*(f[90][l]+f[86][l])+0.3061862178478971*f[17][l])*alpha_vdim[495][l]+0.273861278752583*f[51][l]*alpha_vdim[494][l]+(0.273861278752583*f[152][l]+0.3061862178478971*f[62][l])*alpha_vdim[493][l]+0.2449489742783178*f[59][l]*alpha_vdim[492][l]+0.273861278752583*(f[10][l]*alpha_vdim[492][l]+f[124][l]*alpha_vdim[490][l])+0.3061862178478971*(f[32][l]*alpha_vdim[490][l]+f[98][l]*alpha_vdim[489][l])+0.273861278752583*(f[22][l]*alpha_vdim[488][l]+f[120][l]*alpha_vdim[487][l])+0.3061862178478971*(f[38][l]*alpha_vdim[487][l]+f[60][l]*alpha_vdim[486][l])+(0.1564921592871903*f[136][l]+0.2449489742783178*f[47][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[372][l]+(0.1749635530559412*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[360][l]+(0.1749635530559412*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[329][l]+(0.1564921592871903*f[186][l]+0.1749635530559412*f[93][l]+0.2449489742783178*f[92][l]+0.1749635530559412*f[86][l]+0.273861278752583*f[20][l]+0.1956151991089878*f[17][l]+0.273861278752583*f[16][l]+0.3061862178478971*f[0][l])*alpha_vdim[312][l]+(0.2190890230020664*f[80][l]+0.2449489742783178*f[6][l])*alpha_vdim[311][l]+(0.1749635530559412*f[158][l]+0.1956151991089878*f[71][l]+0.273861278752583*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[300][l]+0.2449489742783178*f[52][l]*alpha_vdim[299][l]+(0.1749635530559412*f[136][l]+0.273861278752583*f[47][l]+0.1956151991089878*f[32][l]+0.3061862178478971*f[1][l])*alpha_vdim[287][l]+(0.2449489742783178*f[136][l]+0.273861278752583*f[32][l])*alpha_vdim[286][l]+(0.1956151991089878*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[277][l]+0.273861278752583*f[102][l]*alpha_vdim[276][l]+(0.1749635530559412*f[129][l]+0.1956151991089878*f[44][l]+0.273861278752583*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[275][l]+0.2449489742783178*f[25][l]*alpha_vdim[274][l]+(0.2190890230020664*f[135][l]+0.2449489742783178*(f[48][l]+f[31][l])+0.273861278752583*f[2][l])*alpha_vdim[268][l]+(0.2449489742783178*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[264][l]+(0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[260][l]+0.273861278752583*f[69][l]*alpha_vdim[259][l]+(0.2449489742783178*f[80][l]+0.273861278752583*f[6][l])*alpha_vdim[256][l]+(0.2449489742783178*f[186][l]+0.273861278752583*(f[93][l]+f[86][l])+0.3061862178478971*f[17][l])*alpha_vdim[255][l]+0.273861278752583*f[52][l]*alpha_vdim[251][l]+(0.273861278752583*f[158][l]+0.3061862178478971*f[71][l])*alpha_vdim[250][l]+(0.2449489742783178*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[249][l]+(0.273861278752583*f[136][l]+0.3061862178478971*f[32][l])*alpha_vdim[248][l]+(0.6123724356957944*f[110][l]+0.6846531968814573*f[25][l])*alpha_cdim[247][l]+0.3061862178478971*f[102][l]*alpha_vdim[246][l]+0.273861278752583*(f[25][l]*alpha_vdim[245][l]+f[129][l]*alpha_vdim[244][l])+0.3061862178478971*(f[44][l]*alpha_vdim[244][l]+f[69][l]*alpha_vdim[243][l])+0.6846531968814573*f[53][l]*alpha_cdim[243][l]+0.3061862178478971*(alpha_cdim[3][l]*f[107][l]+alpha_cdim[0][l]*f[75][l]);
+    out[106][l] += (0.1749635530559412*f[203][l]+0.273861278752583*f[126][l]+0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[606][l]+(0.1749635530559412*f[202][l]+0.273861278752583*f[122][l]+0.1956151991089878*f[120][l]+0.3061862178478971*f[38][l])*alpha_vdim[603][l]+(0.1956151991089878*f[152][l]+0.3061862178478971*f[62][l])*alpha_vdim[572][l]+(0.2449489742783178*f[156][l]+0.273861278752583*f[57][l])*alpha_vdim[546][l]+(0.1749635530559412*f[155][l]+0.273861278752583*f[67][l]+0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[545][l]+(0.2449489742783178*f[154][l]+0.273861278752583*f[60][l])*alpha_vdim[543][l]+(0.1749635530559412*f[153][l]+0.273861278752583*f[64][l]+0.1956151991089878*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[542][l]+(0.273861278752583*f[203][l]+0.3061862178478971*f[117][l])*alpha_vdim[524][l]+(0.1749635530559412*f[125][l]+0.273861278752583*f[42][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[523][l]+(0.273861278752583*f[202][l]+0.3061862178478971*f[120][l])*alpha_vdim[520][l]+(0.1749635530559412*f[121][l]+0.273861278752583*f[39][l]+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[519][l]+0.273861278752583*f[98][l]*alpha_vdim[518][l]+(0.1956151991089878*f[97][l]+0.3061862178478971*f[24][l])*alpha_vdim[517][l]+(0.2449489742783178*f[100][l]+0.273861278752583*f[21][l])*alpha_vdim[508][l]+(0.2449489742783178*f[99][l]+0.273861278752583*f[22][l])*alpha_vdim[507][l]+0.3061862178478971*f[152][l]*alpha_vdim[503][l]+(0.1956151991089878*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[502][l]+(0.273861278752583*f[155][l]+0.3061862178478971*f[56][l])*alpha_vdim[496][l]+(0.2449489742783178*f[66][l]+0.273861278752583*f[7][l])*alpha_vdim[495][l]+(0.273861278752583*f[153][l]+0.3061862178478971*f[59][l])*alpha_vdim[494][l]+0.2449489742783178*f[63][l]*alpha_vdim[493][l]+0.273861278752583*(f[9][l]*alpha_vdim[493][l]+f[51][l]*alpha_vdim[492][l])+(0.273861278752583*f[125][l]+0.3061862178478971*f[33][l])*alpha_vdim[490][l]+0.273861278752583*f[121][l]*alpha_vdim[489][l]+0.3061862178478971*(f[37][l]*alpha_vdim[489][l]+f[97][l]*alpha_vdim[488][l])+0.273861278752583*f[23][l]*alpha_vdim[487][l]+0.3061862178478971*f[61][l]*alpha_vdim[486][l]+(0.1749635530559412*f[210][l]+0.273861278752583*f[138][l]+0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[372][l]+(0.1749635530559412*f[206][l]+0.273861278752583*f[131][l]+0.1956151991089878*f[129][l]+0.3061862178478971*f[44][l])*alpha_vdim[360][l]+(0.1956151991089878*f[158][l]+0.3061862178478971*f[71][l])*alpha_vdim[329][l]+(0.2449489742783178*f[171][l]+0.273861278752583*f[57][l])*alpha_vdim[312][l]+(0.1749635530559412*f[170][l]+0.273861278752583*f[82][l]+0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[311][l]+(0.2449489742783178*f[160][l]+0.273861278752583*f[69][l])*alpha_vdim[300][l]+(0.1749635530559412*f[159][l]+0.273861278752583*f[73][l]+0.1956151991089878*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[299][l]+(0.273861278752583*f[210][l]+0.3061862178478971*f[117][l])*alpha_vdim[287][l]+(0.1749635530559412*f[137][l]+0.273861278752583*f[49][l]+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[286][l]+(0.273861278752583*f[206][l]+0.3061862178478971*f[129][l])*alpha_vdim[277][l]+(0.1749635530559412*f[130][l]+0.273861278752583*f[45][l]+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[276][l]+0.273861278752583*f[102][l]*alpha_vdim[275][l]+(0.1956151991089878*f[101][l]+0.3061862178478971*f[27][l])*alpha_vdim[274][l]+(0.2449489742783178*f[113][l]+0.273861278752583*f[21][l])*alpha_vdim[268][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[25][l])*alpha_vdim[264][l]+0.3061862178478971*f[158][l]*alpha_vdim[260][l]+(0.1956151991089878*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[259][l]+(0.273861278752583*f[170][l]+0.3061862178478971*f[56][l])*alpha_vdim[256][l]+(0.2449489742783178*f[81][l]+0.273861278752583*f[7][l])*alpha_vdim[255][l]+(0.273861278752583*f[159][l]+0.3061862178478971*f[68][l])*alpha_vdim[251][l]+0.2449489742783178*f[72][l]*alpha_vdim[250][l]+0.273861278752583*(f[12][l]*alpha_vdim[250][l]+f[52][l]*alpha_vdim[249][l])+(0.273861278752583*f[137][l]+0.3061862178478971*f[33][l])*alpha_vdim[248][l]+0.273861278752583*f[130][l]*alpha_vdim[246][l]+0.3061862178478971*(f[43][l]*alpha_vdim[246][l]+f[101][l]*alpha_vdim[245][l])+0.273861278752583*f[26][l]*alpha_vdim[244][l]+0.3061862178478971*f[70][l]*alpha_vdim[243][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l])*f[213][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[207][l]+0.2449489742783178*alpha_vdim[69][l]*f[174][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[173][l]+0.2449489742783178*alpha_vdim[60][l]*f[165][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[164][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[161][l]+0.273861278752583*alpha_vdim[129][l]*f[142][l]+0.1749635530559412*alpha_vdim[43][l]*f[141][l]+0.273861278752583*(alpha_vdim[5][l]*f[141][l]+alpha_vdim[120][l]*f[133][l])+(0.1749635530559412*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[132][l]+(0.1956151991089878*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[38][l])*f[129][l]+0.1956151991089878*f[120][l]*alpha_vdim[129][l]+0.3061862178478971*(f[38][l]*alpha_vdim[129][l]+alpha_vdim[44][l]*f[120][l]+f[44][l]*alpha_vdim[120][l])+0.2449489742783178*(alpha_vdim[25][l]*f[114][l]+alpha_vdim[22][l]*f[110][l])+0.6123724356957944*alpha_cdim[3][l]*f[108][l]+0.273861278752583*alpha_vdim[32][l]*f[105][l]+0.1956151991089878*alpha_vdim[31][l]*f[104][l]+0.3061862178478971*(alpha_vdim[2][l]*f[104][l]+f[75][l]*alpha_vdim[86][l])+0.273861278752583*alpha_vdim[68][l]*f[84][l]+0.2449489742783178*alpha_vdim[12][l]*f[83][l]+0.273861278752583*alpha_vdim[59][l]*f[78][l]+0.2449489742783178*alpha_vdim[9][l]*f[77][l]+(0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[74][l]+0.273861278752583*(alpha_vdim[60][l]*f[69][l]+f[60][l]*alpha_vdim[69][l])+(0.1956151991089878*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[68][l]+0.1956151991089878*f[59][l]*alpha_vdim[68][l]+0.3061862178478971*(f[10][l]*alpha_vdim[68][l]+alpha_vdim[13][l]*f[59][l]+f[13][l]*alpha_vdim[59][l])+0.6846531968814573*alpha_cdim[0][l]*f[54][l]+0.273861278752583*(alpha_vdim[6][l]*f[53][l]+alpha_vdim[43][l]*f[50][l]+alpha_vdim[37][l]*f[46][l])+(0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[43][l]+0.1956151991089878*f[37][l]*alpha_vdim[43][l]+0.3061862178478971*(f[4][l]*alpha_vdim[43][l]+alpha_vdim[5][l]*f[37][l]+f[5][l]*alpha_vdim[37][l]+f[29][l]*alpha_vdim[31][l])+0.6846531968814573*alpha_cdim[3][l]*f[28][l]+0.273861278752583*(alpha_vdim[1][l]*f[28][l]+alpha_vdim[22][l]*f[25][l]+f[22][l]*alpha_vdim[25][l])+0.3061862178478971*f[15][l]*alpha_vdim[16][l]+0.273861278752583*(alpha_vdim[9][l]*f[12][l]+f[9][l]*alpha_vdim[12][l]);
+    out[107][l] += (0.1749635530559412*f[203][l]+0.273861278752583*f[125][l]+0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[606][l]+(0.1749635530559412*f[202][l]+0.273861278752583*f[121][l]+0.1956151991089878*f[120][l]+0.3061862178478971*f[37][l])*alpha_vdim[603][l]+(0.1956151991089878*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[572][l]+(0.1749635530559412*f[156][l]+0.273861278752583*f[66][l]+0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[546][l]+(0.2449489742783178*f[155][l]+0.273861278752583*f[56][l])*alpha_vdim[545][l]+(0.1749635530559412*f[154][l]+0.273861278752583*f[63][l]+0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[543][l]+(0.2449489742783178*f[153][l]+0.273861278752583*f[59][l])*alpha_vdim[542][l]+(0.1749635530559412*f[126][l]+0.273861278752583*f[42][l]+0.1956151991089878*f[34][l]+0.3061862178478971*f[3][l])*alpha_vdim[524][l]+(0.273861278752583*f[203][l]+0.3061862178478971*f[117][l])*alpha_vdim[523][l]+(0.1749635530559412*f[122][l]+0.273861278752583*f[39][l]+0.1956151991089878*f[38][l]+0.3061862178478971*f[4][l])*alpha_vdim[520][l]+(0.273861278752583*f[202][l]+0.3061862178478971*f[120][l])*alpha_vdim[519][l]+(0.1956151991089878*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[518][l]+0.273861278752583*f[97][l]*alpha_vdim[517][l]+(0.2449489742783178*f[100][l]+0.273861278752583*f[21][l])*alpha_vdim[508][l]+(0.2449489742783178*f[99][l]+0.273861278752583*f[22][l])*alpha_vdim[507][l]+0.1956151991089878*f[62][l]*alpha_vdim[503][l]+0.3061862178478971*(f[11][l]*alpha_vdim[503][l]+f[152][l]*alpha_vdim[502][l])+(0.2449489742783178*f[67][l]+0.273861278752583*f[8][l])*alpha_vdim[496][l]+(0.273861278752583*f[156][l]+0.3061862178478971*f[57][l])*alpha_vdim[495][l]+(0.2449489742783178*f[64][l]+0.273861278752583*f[10][l])*alpha_vdim[494][l]+(0.273861278752583*f[154][l]+0.3061862178478971*f[60][l])*alpha_vdim[493][l]+0.273861278752583*f[51][l]*alpha_vdim[492][l]+(0.273861278752583*f[126][l]+0.3061862178478971*f[34][l])*alpha_vdim[490][l]+(0.273861278752583*f[122][l]+0.3061862178478971*f[38][l])*alpha_vdim[489][l]+0.273861278752583*f[24][l]*alpha_vdim[488][l]+0.3061862178478971*(f[98][l]*alpha_vdim[487][l]+f[62][l]*alpha_vdim[486][l])+(0.1749635530559412*f[210][l]+0.273861278752583*f[137][l]+0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[372][l]+(0.1749635530559412*f[206][l]+0.273861278752583*f[130][l]+0.1956151991089878*f[129][l]+0.3061862178478971*f[43][l])*alpha_vdim[360][l]+(0.1956151991089878*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[329][l]+(0.1749635530559412*f[171][l]+0.273861278752583*f[81][l]+0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[312][l]+(0.2449489742783178*f[170][l]+0.273861278752583*f[56][l])*alpha_vdim[311][l]+(0.1749635530559412*f[160][l]+0.273861278752583*f[72][l]+0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[300][l]+(0.2449489742783178*f[159][l]+0.273861278752583*f[68][l])*alpha_vdim[299][l]+(0.1749635530559412*f[138][l]+0.273861278752583*f[49][l]+0.1956151991089878*f[34][l]+0.3061862178478971*f[3][l])*alpha_vdim[287][l]+(0.273861278752583*f[210][l]+0.3061862178478971*f[117][l])*alpha_vdim[286][l]+(0.1749635530559412*f[131][l]+0.273861278752583*f[45][l]+0.1956151991089878*f[44][l]+0.3061862178478971*f[5][l])*alpha_vdim[277][l]+(0.273861278752583*f[206][l]+0.3061862178478971*f[129][l])*alpha_vdim[276][l]+(0.1956151991089878*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[275][l]+0.273861278752583*f[101][l]*alpha_vdim[274][l]+(0.2449489742783178*f[113][l]+0.273861278752583*f[21][l])*alpha_vdim[268][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[25][l])*alpha_vdim[264][l]+0.1956151991089878*f[71][l]*alpha_vdim[260][l]+0.3061862178478971*(f[14][l]*alpha_vdim[260][l]+f[158][l]*alpha_vdim[259][l])+(0.2449489742783178*f[82][l]+0.273861278752583*f[8][l])*alpha_vdim[256][l]+(0.273861278752583*f[171][l]+0.3061862178478971*f[57][l])*alpha_vdim[255][l]+(0.2449489742783178*f[73][l]+0.273861278752583*f[13][l])*alpha_vdim[251][l]+(0.273861278752583*f[160][l]+0.3061862178478971*f[69][l])*alpha_vdim[250][l]+0.273861278752583*f[52][l]*alpha_vdim[249][l]+(0.273861278752583*f[138][l]+0.3061862178478971*f[34][l])*alpha_vdim[248][l]+(0.6123724356957944*f[112][l]+0.6846531968814573*f[27][l])*alpha_cdim[247][l]+(0.273861278752583*f[131][l]+0.3061862178478971*f[44][l])*alpha_vdim[246][l]+0.273861278752583*f[27][l]*alpha_vdim[245][l]+0.3061862178478971*(f[102][l]*alpha_vdim[244][l]+f[71][l]*alpha_vdim[243][l])+0.6846531968814573*f[55][l]*alpha_cdim[243][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[43][l])*f[213][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[37][l])*f[207][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[174][l]+0.2449489742783178*alpha_vdim[68][l]*f[173][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[165][l]+0.2449489742783178*alpha_vdim[59][l]*f[164][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[161][l]+0.1749635530559412*alpha_vdim[44][l]*f[142][l]+0.273861278752583*(alpha_vdim[5][l]*f[142][l]+alpha_vdim[129][l]*f[141][l])+0.1749635530559412*alpha_vdim[38][l]*f[133][l]+0.273861278752583*(alpha_vdim[4][l]*f[133][l]+alpha_vdim[120][l]*f[132][l])+(0.1956151991089878*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[37][l])*f[129][l]+0.1956151991089878*f[120][l]*alpha_vdim[129][l]+0.3061862178478971*(f[37][l]*alpha_vdim[129][l]+alpha_vdim[43][l]*f[120][l]+f[43][l]*alpha_vdim[120][l])+0.2449489742783178*(alpha_vdim[25][l]*f[114][l]+alpha_vdim[22][l]*f[110][l])+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[105][l]+0.273861278752583*alpha_vdim[31][l]*f[104][l]+0.3061862178478971*f[74][l]*alpha_vdim[86][l]+0.2449489742783178*alpha_vdim[13][l]*f[84][l]+0.273861278752583*alpha_vdim[69][l]*f[83][l]+0.2449489742783178*alpha_vdim[10][l]*f[78][l]+0.273861278752583*alpha_vdim[60][l]*f[77][l]+(0.1956151991089878*alpha_vdim[17][l]+0.3061862178478971*alpha_vdim[0][l])*f[75][l]+(0.1956151991089878*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[69][l]+(0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[69][l]+0.273861278752583*(alpha_vdim[59][l]*f[68][l]+f[59][l]*alpha_vdim[68][l])+0.3061862178478971*(alpha_vdim[12][l]*f[60][l]+f[12][l]*alpha_vdim[60][l])+0.273861278752583*(alpha_vdim[6][l]*f[53][l]+alpha_vdim[44][l]*f[50][l]+alpha_vdim[38][l]*f[46][l])+(0.1956151991089878*alpha_vdim[38][l]+0.3061862178478971*alpha_vdim[4][l])*f[44][l]+0.1956151991089878*f[38][l]*alpha_vdim[44][l]+0.3061862178478971*(f[4][l]*alpha_vdim[44][l]+alpha_vdim[5][l]*f[38][l]+f[5][l]*alpha_vdim[38][l]+f[28][l]*alpha_vdim[32][l])+0.273861278752583*(alpha_vdim[2][l]*f[29][l]+alpha_vdim[22][l]*f[25][l]+f[22][l]*alpha_vdim[25][l])+0.3061862178478971*f[15][l]*alpha_vdim[17][l]+0.273861278752583*(alpha_vdim[10][l]*f[13][l]+f[10][l]*alpha_vdim[13][l]);
+    out[108][l] += (0.2449489742783178*f[205][l]+0.273861278752583*f[119][l])*alpha_vdim[606][l]+0.2449489742783178*f[98][l]*alpha_vdim[603][l]+0.273861278752583*f[154][l]*alpha_vdim[572][l]+(0.2449489742783178*f[232][l]+0.273861278752583*(f[185][l]+f[182][l])+0.3061862178478971*f[88][l])*alpha_vdim[546][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[58][l])*alpha_vdim[545][l]+(0.2449489742783178*f[152][l]+0.273861278752583*f[62][l])*alpha_vdim[543][l]+0.2449489742783178*f[51][l]*alpha_vdim[542][l]+(0.273861278752583*f[205][l]+0.3061862178478971*f[119][l])*alpha_vdim[524][l]+0.2449489742783178*f[127][l]*alpha_vdim[523][l]+0.273861278752583*(f[35][l]*alpha_vdim[523][l]+f[98][l]*alpha_vdim[520][l])+0.2449489742783178*f[23][l]*alpha_vdim[519][l]+(0.273861278752583*f[202][l]+0.3061862178478971*f[122][l])*alpha_vdim[518][l]+0.273861278752583*f[99][l]*alpha_vdim[517][l]+(0.2449489742783178*f[204][l]+0.273861278752583*(f[128][l]+f[118][l])+0.3061862178478971*f[36][l])*alpha_vdim[508][l]+(0.2449489742783178*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[507][l]+0.3061862178478971*f[154][l]*alpha_vdim[503][l]+0.273861278752583*f[63][l]*alpha_vdim[502][l]+(0.273861278752583*f[157][l]+0.3061862178478971*f[58][l])*alpha_vdim[496][l]+(0.2449489742783178*f[184][l]+0.273861278752583*(f[91][l]+f[87][l])+0.3061862178478971*f[18][l])*alpha_vdim[495][l]+0.273861278752583*f[51][l]*alpha_vdim[494][l]+(0.2449489742783178*f[61][l]+0.273861278752583*f[11][l])*alpha_vdim[493][l]+(0.273861278752583*f[153][l]+0.3061862178478971*f[64][l])*alpha_vdim[492][l]+(0.273861278752583*f[127][l]+0.3061862178478971*f[35][l])*alpha_vdim[490][l]+0.273861278752583*f[23][l]*alpha_vdim[489][l]+0.3061862178478971*f[99][l]*alpha_vdim[488][l]+0.273861278752583*f[121][l]*alpha_vdim[487][l]+0.3061862178478971*(f[39][l]*alpha_vdim[487][l]+f[63][l]*alpha_vdim[486][l])+(0.2449489742783178*f[212][l]+0.273861278752583*f[119][l])*alpha_vdim[372][l]+0.2449489742783178*f[102][l]*alpha_vdim[360][l]+0.273861278752583*f[160][l]*alpha_vdim[329][l]+(0.2449489742783178*f[233][l]+0.273861278752583*(f[188][l]+f[182][l])+0.3061862178478971*f[88][l])*alpha_vdim[312][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[58][l])*alpha_vdim[311][l]+(0.2449489742783178*f[158][l]+0.273861278752583*f[71][l])*alpha_vdim[300][l]+0.2449489742783178*f[52][l]*alpha_vdim[299][l]+(0.273861278752583*f[212][l]+0.3061862178478971*f[119][l])*alpha_vdim[287][l]+0.2449489742783178*f[139][l]*alpha_vdim[286][l]+0.273861278752583*(f[35][l]*alpha_vdim[286][l]+f[102][l]*alpha_vdim[277][l])+0.2449489742783178*f[26][l]*alpha_vdim[276][l]+(0.273861278752583*f[206][l]+0.3061862178478971*f[131][l])*alpha_vdim[275][l]+0.273861278752583*f[103][l]*alpha_vdim[274][l]+(0.2449489742783178*f[211][l]+0.273861278752583*(f[140][l]+f[118][l])+0.3061862178478971*f[36][l])*alpha_vdim[268][l]+(0.2449489742783178*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[264][l]+0.3061862178478971*f[160][l]*alpha_vdim[260][l]+0.273861278752583*f[72][l]*alpha_vdim[259][l]+(0.273861278752583*f[172][l]+0.3061862178478971*f[58][l])*alpha_vdim[256][l]+(0.2449489742783178*f[187][l]+0.273861278752583*(f[94][l]+f[87][l])+0.3061862178478971*f[18][l])*alpha_vdim[255][l]+0.273861278752583*f[52][l]*alpha_vdim[251][l]+(0.2449489742783178*f[70][l]+0.273861278752583*f[14][l])*alpha_vdim[250][l]+(0.273861278752583*f[159][l]+0.3061862178478971*f[73][l])*alpha_vdim[249][l]+(0.273861278752583*f[139][l]+0.3061862178478971*f[35][l])*alpha_vdim[248][l]+0.273861278752583*f[26][l]*alpha_vdim[246][l]+0.3061862178478971*f[103][l]*alpha_vdim[245][l]+0.273861278752583*f[130][l]*alpha_vdim[244][l]+0.3061862178478971*(f[45][l]*alpha_vdim[244][l]+f[72][l]*alpha_vdim[243][l])+0.5477225575051661*(alpha_vdim[69][l]*f[226][l]+alpha_vdim[60][l]*f[223][l])+(0.5477225575051661*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[199][l]+0.5477225575051661*alpha_vdim[25][l]*f[198][l]+(0.5477225575051661*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[196][l]+0.5477225575051661*alpha_vdim[22][l]*f[195][l]+0.6123724356957944*(alpha_vdim[32][l]*f[192][l]+alpha_vdim[69][l]*f[176][l])+0.5477225575051661*alpha_vdim[12][l]*f[175][l]+0.6123724356957944*alpha_vdim[60][l]*f[167][l]+0.5477225575051661*alpha_vdim[9][l]*f[166][l]+0.6123724356957944*(alpha_vdim[60][l]*f[158][l]+alpha_vdim[69][l]*f[152][l])+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[151][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[150][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[148][l]+0.6123724356957944*(alpha_vdim[6][l]*f[147][l]+f[98][l]*alpha_vdim[129][l]+f[102][l]*alpha_vdim[120][l]+alpha_vdim[25][l]*f[116][l])+0.5477225575051661*alpha_vdim[43][l]*f[115][l]+0.6123724356957944*(alpha_vdim[5][l]*f[115][l]+alpha_vdim[22][l]*f[112][l])+(0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[111][l]+0.6846531968814573*alpha_vdim[32][l]*f[107][l]+0.6123724356957944*alpha_vdim[1][l]*f[106][l]+0.6846531968814573*alpha_vdim[38][l]*f[102][l]+0.6123724356957944*alpha_vdim[22][l]*f[101][l]+0.6846531968814573*alpha_vdim[44][l]*f[98][l]+0.6123724356957944*alpha_vdim[25][l]*f[97][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[96][l]+0.6123724356957944*(alpha_vdim[12][l]*f[85][l]+alpha_vdim[9][l]*f[79][l])+0.3061862178478971*alpha_cdim[0][l]*f[76][l]+0.6846531968814573*alpha_vdim[60][l]*f[71][l]+0.6123724356957944*alpha_vdim[9][l]*f[70][l]+0.6846531968814573*f[62][l]*alpha_vdim[69][l]+0.6123724356957944*(f[51][l]*alpha_vdim[68][l]+alpha_vdim[12][l]*f[61][l]+f[52][l]*alpha_vdim[59][l])+0.6846531968814573*alpha_vdim[6][l]*f[55][l]+0.6123724356957944*alpha_vdim[16][l]*f[54][l]+0.6846531968814573*(alpha_vdim[0][l]*f[54][l]+alpha_vdim[10][l]*f[52][l]+alpha_vdim[13][l]*f[51][l])+0.6123724356957944*(f[23][l]*alpha_vdim[43][l]+f[26][l]*alpha_vdim[37][l])+0.273861278752583*alpha_cdim[3][l]*f[30][l]+0.6846531968814573*(alpha_vdim[1][l]*f[30][l]+alpha_vdim[22][l]*f[27][l]+alpha_vdim[4][l]*f[26][l]+f[24][l]*alpha_vdim[25][l]+alpha_vdim[5][l]*f[23][l]+alpha_vdim[9][l]*f[14][l]+f[11][l]*alpha_vdim[12][l]);
+    out[109][l] += (0.2449489742783178*f[204][l]+0.273861278752583*f[118][l])*alpha_vdim[606][l]+0.2449489742783178*f[97][l]*alpha_vdim[603][l]+0.273861278752583*f[153][l]*alpha_vdim[572][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[58][l])*alpha_vdim[546][l]+(0.2449489742783178*f[232][l]+0.273861278752583*(f[184][l]+f[182][l])+0.3061862178478971*f[87][l])*alpha_vdim[545][l]+0.2449489742783178*f[51][l]*alpha_vdim[543][l]+(0.2449489742783178*f[152][l]+0.273861278752583*f[61][l])*alpha_vdim[542][l]+(0.2449489742783178*f[128][l]+0.273861278752583*f[36][l])*alpha_vdim[524][l]+(0.273861278752583*f[204][l]+0.3061862178478971*f[118][l])*alpha_vdim[523][l]+0.2449489742783178*f[24][l]*alpha_vdim[520][l]+0.273861278752583*(f[97][l]*alpha_vdim[519][l]+f[99][l]*alpha_vdim[518][l])+(0.273861278752583*f[202][l]+0.3061862178478971*f[121][l])*alpha_vdim[517][l]+(0.2449489742783178*f[205][l]+0.273861278752583*(f[127][l]+f[119][l])+0.3061862178478971*f[35][l])*alpha_vdim[508][l]+0.2449489742783178*f[98][l]*alpha_vdim[507][l]+0.273861278752583*(f[23][l]*alpha_vdim[507][l]+f[64][l]*alpha_vdim[503][l])+0.3061862178478971*f[153][l]*alpha_vdim[502][l]+(0.2449489742783178*f[185][l]+0.273861278752583*(f[91][l]+f[88][l])+0.3061862178478971*f[18][l])*alpha_vdim[496][l]+(0.273861278752583*f[157][l]+0.3061862178478971*f[58][l])*alpha_vdim[495][l]+0.2449489742783178*f[62][l]*alpha_vdim[494][l]+0.273861278752583*(f[11][l]*alpha_vdim[494][l]+f[51][l]*alpha_vdim[493][l])+(0.273861278752583*f[154][l]+0.3061862178478971*f[63][l])*alpha_vdim[492][l]+(0.273861278752583*f[128][l]+0.3061862178478971*f[36][l])*alpha_vdim[490][l]+0.273861278752583*(f[24][l]*alpha_vdim[489][l]+f[122][l]*alpha_vdim[488][l])+0.3061862178478971*(f[39][l]*alpha_vdim[488][l]+f[99][l]*alpha_vdim[487][l]+f[64][l]*alpha_vdim[486][l])+(0.2449489742783178*f[211][l]+0.273861278752583*f[118][l])*alpha_vdim[372][l]+0.2449489742783178*f[101][l]*alpha_vdim[360][l]+0.273861278752583*f[159][l]*alpha_vdim[329][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[58][l])*alpha_vdim[312][l]+(0.2449489742783178*f[233][l]+0.273861278752583*(f[187][l]+f[182][l])+0.3061862178478971*f[87][l])*alpha_vdim[311][l]+0.2449489742783178*f[52][l]*alpha_vdim[300][l]+(0.2449489742783178*f[158][l]+0.273861278752583*f[70][l])*alpha_vdim[299][l]+(0.2449489742783178*f[140][l]+0.273861278752583*f[36][l])*alpha_vdim[287][l]+(0.273861278752583*f[211][l]+0.3061862178478971*f[118][l])*alpha_vdim[286][l]+0.2449489742783178*f[27][l]*alpha_vdim[277][l]+0.273861278752583*(f[101][l]*alpha_vdim[276][l]+f[103][l]*alpha_vdim[275][l])+(0.273861278752583*f[206][l]+0.3061862178478971*f[130][l])*alpha_vdim[274][l]+(0.2449489742783178*f[212][l]+0.273861278752583*(f[139][l]+f[119][l])+0.3061862178478971*f[35][l])*alpha_vdim[268][l]+0.2449489742783178*f[102][l]*alpha_vdim[264][l]+0.273861278752583*(f[26][l]*alpha_vdim[264][l]+f[73][l]*alpha_vdim[260][l])+0.3061862178478971*f[159][l]*alpha_vdim[259][l]+(0.2449489742783178*f[188][l]+0.273861278752583*(f[94][l]+f[88][l])+0.3061862178478971*f[18][l])*alpha_vdim[256][l]+(0.273861278752583*f[172][l]+0.3061862178478971*f[58][l])*alpha_vdim[255][l]+0.2449489742783178*f[71][l]*alpha_vdim[251][l]+0.273861278752583*(f[14][l]*alpha_vdim[251][l]+f[52][l]*alpha_vdim[250][l])+(0.273861278752583*f[160][l]+0.3061862178478971*f[72][l])*alpha_vdim[249][l]+(0.273861278752583*f[140][l]+0.3061862178478971*f[36][l])*alpha_vdim[248][l]+(0.273861278752583*f[134][l]+0.3061862178478971*f[45][l])*alpha_cdim[247][l]+0.273861278752583*(f[27][l]*alpha_vdim[246][l]+f[131][l]*alpha_vdim[245][l])+0.3061862178478971*(f[45][l]*alpha_vdim[245][l]+f[103][l]*alpha_vdim[244][l]+f[73][l]*alpha_vdim[243][l]+f[76][l]*alpha_cdim[243][l])+0.5477225575051661*(alpha_vdim[68][l]*f[226][l]+alpha_vdim[59][l]*f[223][l]+alpha_vdim[25][l]*f[199][l])+(0.5477225575051661*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[43][l])*f[198][l]+0.5477225575051661*(alpha_vdim[22][l]*f[196][l]+alpha_vdim[120][l]*f[195][l])+0.6123724356957944*(alpha_vdim[37][l]*f[195][l]+alpha_vdim[31][l]*f[192][l])+0.5477225575051661*alpha_vdim[13][l]*f[176][l]+0.6123724356957944*alpha_vdim[68][l]*f[175][l]+0.5477225575051661*alpha_vdim[10][l]*f[167][l]+0.6123724356957944*(alpha_vdim[59][l]*(f[166][l]+f[158][l])+alpha_vdim[68][l]*f[152][l])+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[151][l]+0.5477225575051661*alpha_vdim[60][l]*f[150][l]+0.6123724356957944*(alpha_vdim[9][l]*f[150][l]+alpha_vdim[6][l]*f[148][l])+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[147][l]+0.6123724356957944*(f[97][l]*alpha_vdim[129][l]+f[101][l]*alpha_vdim[120][l])+0.5477225575051661*alpha_vdim[44][l]*f[116][l]+0.6123724356957944*(alpha_vdim[5][l]*f[116][l]+alpha_vdim[25][l]*f[115][l])+0.5477225575051661*alpha_vdim[38][l]*f[112][l]+0.6123724356957944*(alpha_vdim[4][l]*f[112][l]+alpha_vdim[22][l]*f[111][l]+alpha_vdim[2][l]*f[107][l])+0.6846531968814573*alpha_vdim[31][l]*f[106][l]+0.6123724356957944*alpha_vdim[22][l]*f[102][l]+0.6846531968814573*alpha_vdim[37][l]*f[101][l]+0.6123724356957944*alpha_vdim[25][l]*f[98][l]+0.6846531968814573*alpha_vdim[43][l]*f[97][l]+(0.6123724356957944*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[96][l]+0.6123724356957944*(alpha_vdim[13][l]*f[85][l]+alpha_vdim[10][l]*(f[79][l]+f[71][l]))+0.6846531968814573*alpha_vdim[59][l]*f[70][l]+0.6123724356957944*f[51][l]*alpha_vdim[69][l]+0.6846531968814573*f[61][l]*alpha_vdim[68][l]+0.6123724356957944*(alpha_vdim[13][l]*f[62][l]+f[52][l]*alpha_vdim[60][l]+alpha_vdim[17][l]*f[55][l])+0.6846531968814573*(alpha_vdim[0][l]*f[55][l]+alpha_vdim[6][l]*f[54][l]+alpha_vdim[9][l]*f[52][l]+alpha_vdim[12][l]*f[51][l])+0.6123724356957944*(f[24][l]*alpha_vdim[44][l]+f[27][l]*alpha_vdim[38][l])+0.6846531968814573*(alpha_vdim[2][l]*f[30][l]+alpha_vdim[4][l]*f[27][l]+alpha_vdim[22][l]*f[26][l]+f[23][l]*alpha_vdim[25][l]+alpha_vdim[5][l]*f[24][l]+alpha_vdim[10][l]*f[14][l]+f[11][l]*alpha_vdim[13][l]);
+    out[110][l] += 0.2190890230020664*f[22][l]*alpha_vdim[606][l]+0.2449489742783178*(f[100][l]*alpha_vdim[603][l]+f[65][l]*alpha_vdim[572][l])+(0.2190890230020664*f[59][l]+0.2449489742783178*f[10][l])*alpha_vdim[546][l]+(0.2190890230020664*f[60][l]+0.2449489742783178*f[9][l])*alpha_vdim[545][l]+(0.2449489742783178*f[155][l]+0.273861278752583*f[67][l])*alpha_vdim[543][l]+(0.2449489742783178*f[156][l]+0.273861278752583*f[66][l])*alpha_vdim[542][l]+0.2449489742783178*f[22][l]*(alpha_vdim[524][l]+alpha_vdim[523][l])+0.273861278752583*f[100][l]*(alpha_vdim[520][l]+alpha_vdim[519][l])+(0.2449489742783178*f[123][l]+0.273861278752583*f[41][l])*alpha_vdim[518][l]+(0.2449489742783178*f[124][l]+0.273861278752583*f[40][l])*alpha_vdim[517][l]+(0.2190890230020664*f[120][l]+0.2449489742783178*(f[38][l]+f[37][l])+0.273861278752583*f[4][l])*alpha_vdim[508][l]+(0.2449489742783178*f[203][l]+0.273861278752583*(f[126][l]+f[125][l])+0.3061862178478971*f[42][l])*alpha_vdim[507][l]+0.273861278752583*f[65][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.2449489742783178*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[496][l]+(0.2449489742783178*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[495][l]+(0.273861278752583*f[156][l]+0.3061862178478971*f[66][l])*alpha_vdim[494][l]+(0.273861278752583*f[155][l]+0.3061862178478971*f[67][l])*alpha_vdim[493][l]+(0.2449489742783178*f[183][l]+0.273861278752583*(f[90][l]+f[89][l])+0.3061862178478971*f[19][l])*alpha_vdim[492][l]+0.273861278752583*f[22][l]*alpha_vdim[490][l]+0.3061862178478971*f[100][l]*alpha_vdim[489][l]+(0.273861278752583*f[124][l]+0.3061862178478971*f[40][l])*alpha_vdim[488][l]+0.273861278752583*f[123][l]*alpha_vdim[487][l]+0.3061862178478971*(f[41][l]*alpha_vdim[487][l]+f[65][l]*alpha_vdim[486][l])+0.4898979485566357*f[114][l]*alpha_vdim[372][l]+0.5477225575051661*(f[22][l]*alpha_vdim[372][l]+f[96][l]*alpha_vdim[360][l]+f[53][l]*alpha_vdim[329][l])+(0.4898979485566357*f[173][l]+0.5477225575051661*(f[84][l]+f[59][l])+0.6123724356957944*f[10][l])*alpha_vdim[312][l]+(0.4898979485566357*f[174][l]+0.5477225575051661*(f[83][l]+f[60][l])+0.6123724356957944*f[9][l])*alpha_vdim[311][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[300][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[299][l]+(0.5477225575051661*f[114][l]+0.6123724356957944*f[22][l])*alpha_vdim[287][l]+0.5477225575051661*f[114][l]*alpha_vdim[286][l]+0.6123724356957944*(f[22][l]*alpha_vdim[286][l]+f[96][l]*(alpha_vdim[277][l]+alpha_vdim[276][l]))+(0.5477225575051661*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[275][l]+(0.5477225575051661*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[274][l]+(0.4898979485566357*f[213][l]+0.5477225575051661*(f[142][l]+f[141][l]+f[120][l])+0.6123724356957944*(f[50][l]+f[38][l]+f[37][l])+0.6846531968814573*f[4][l])*alpha_vdim[268][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[264][l]+0.6123724356957944*f[53][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.5477225575051661*f[174][l]+0.6123724356957944*(f[83][l]+f[60][l])+0.6846531968814573*f[9][l])*alpha_vdim[256][l]+(0.5477225575051661*f[173][l]+0.6123724356957944*(f[84][l]+f[59][l])+0.6846531968814573*f[10][l])*alpha_vdim[255][l]+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[251][l]+(0.6123724356957944*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[250][l]+(0.5477225575051661*f[161][l]+0.6123724356957944*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[249][l]+(0.6123724356957944*f[114][l]+0.6846531968814573*f[22][l])*alpha_vdim[248][l]+0.273861278752583*f[28][l]*alpha_cdim[247][l]+0.6846531968814573*f[96][l]*alpha_vdim[246][l]+(0.6123724356957944*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[245][l]+0.6123724356957944*f[104][l]*alpha_vdim[244][l]+0.6846531968814573*(f[29][l]*alpha_vdim[244][l]+f[53][l]*alpha_vdim[243][l])+0.3061862178478971*(f[77][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[112][l]+alpha_cdim[0][l]*f[78][l]);
+    out[111][l] += 0.2449489742783178*(f[98][l]*alpha_vdim[606][l]+f[205][l]*alpha_vdim[603][l])+0.273861278752583*(f[124][l]*alpha_vdim[603][l]+f[156][l]*alpha_vdim[572][l])+(0.2449489742783178*f[152][l]+0.273861278752583*f[62][l])*alpha_vdim[546][l]+0.2449489742783178*f[51][l]*alpha_vdim[545][l]+(0.2449489742783178*f[232][l]+0.273861278752583*(f[185][l]+f[183][l])+0.3061862178478971*f[90][l])*alpha_vdim[543][l]+0.2449489742783178*f[157][l]*alpha_vdim[542][l]+0.273861278752583*(f[65][l]*alpha_vdim[542][l]+f[98][l]*alpha_vdim[524][l])+0.2449489742783178*f[23][l]*alpha_vdim[523][l]+(0.273861278752583*f[205][l]+0.3061862178478971*f[124][l])*alpha_vdim[520][l]+(0.2449489742783178*f[127][l]+0.273861278752583*f[40][l])*alpha_vdim[519][l]+(0.273861278752583*f[203][l]+0.3061862178478971*f[126][l])*alpha_vdim[518][l]+0.273861278752583*f[100][l]*alpha_vdim[517][l]+(0.2449489742783178*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[508][l]+(0.2449489742783178*f[204][l]+0.273861278752583*(f[128][l]+f[123][l]))*alpha_vdim[507][l]+0.3061862178478971*(f[41][l]*alpha_vdim[507][l]+f[156][l]*alpha_vdim[503][l])+0.273861278752583*(f[66][l]*alpha_vdim[502][l]+f[51][l]*alpha_vdim[496][l])+(0.2449489742783178*f[61][l]+0.273861278752583*f[11][l])*alpha_vdim[495][l]+(0.273861278752583*f[157][l]+0.3061862178478971*f[65][l])*alpha_vdim[494][l]+(0.2449489742783178*f[184][l]+0.273861278752583*(f[91][l]+f[89][l])+0.3061862178478971*f[19][l])*alpha_vdim[493][l]+(0.273861278752583*f[155][l]+0.3061862178478971*f[67][l])*alpha_vdim[492][l]+0.273861278752583*(f[23][l]*alpha_vdim[490][l]+f[127][l]*alpha_vdim[489][l])+0.3061862178478971*(f[40][l]*alpha_vdim[489][l]+f[100][l]*alpha_vdim[488][l])+0.273861278752583*f[125][l]*alpha_vdim[487][l]+0.3061862178478971*(f[42][l]*alpha_vdim[487][l]+f[66][l]*alpha_vdim[486][l])+(0.5477225575051661*f[199][l]+0.6123724356957944*f[98][l])*alpha_vdim[372][l]+0.5477225575051661*f[194][l]*alpha_vdim[360][l]+0.6123724356957944*(f[105][l]*alpha_vdim[360][l]+f[148][l]*alpha_vdim[329][l])+(0.5477225575051661*f[226][l]+0.6123724356957944*(f[176][l]+f[152][l])+0.6846531968814573*f[62][l])*alpha_vdim[312][l]+(0.5477225575051661*f[151][l]+0.6123724356957944*f[51][l])*alpha_vdim[311][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[163][l]+f[161][l])+0.6846531968814573*f[75][l])*alpha_vdim[300][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[299][l]+(0.6123724356957944*f[199][l]+0.6846531968814573*f[98][l])*alpha_vdim[287][l]+(0.5477225575051661*f[115][l]+0.6123724356957944*f[23][l])*alpha_vdim[286][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[105][l])*alpha_vdim[277][l]+(0.5477225575051661*f[108][l]+0.6123724356957944*f[28][l])*alpha_vdim[276][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[275][l]+0.6123724356957944*f[96][l]*alpha_vdim[274][l]+(0.5477225575051661*f[198][l]+0.6123724356957944*(f[116][l]+f[97][l])+0.6846531968814573*f[24][l])*alpha_vdim[268][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*(f[109][l]+f[104][l]))*alpha_vdim[264][l]+0.6846531968814573*(f[29][l]*alpha_vdim[264][l]+f[148][l]*alpha_vdim[260][l])+0.6123724356957944*f[54][l]*alpha_vdim[259][l]+(0.6123724356957944*f[151][l]+0.6846531968814573*f[51][l])*alpha_vdim[256][l]+(0.5477225575051661*f[175][l]+0.6123724356957944*(f[85][l]+f[61][l])+0.6846531968814573*f[11][l])*alpha_vdim[255][l]+(0.6123724356957944*f[149][l]+0.6846531968814573*f[53][l])*alpha_vdim[251][l]+(0.5477225575051661*f[162][l]+0.6123724356957944*(f[76][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[250][l]+(0.6123724356957944*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[249][l]+(0.6123724356957944*f[115][l]+0.6846531968814573*f[23][l])*alpha_vdim[248][l]+0.6123724356957944*f[108][l]*alpha_vdim[246][l]+0.6846531968814573*(f[28][l]*alpha_vdim[246][l]+f[96][l]*alpha_vdim[245][l])+0.6123724356957944*f[106][l]*alpha_vdim[244][l]+0.6846531968814573*(f[30][l]*alpha_vdim[244][l]+f[54][l]*alpha_vdim[243][l])+0.2449489742783178*alpha_vdim[69][l]*f[234][l]+(0.2449489742783178*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l])*f[217][l]+0.2449489742783178*alpha_vdim[25][l]*f[216][l]+0.273861278752583*(alpha_vdim[32][l]*f[207][l]+alpha_vdim[69][l]*f[190][l])+0.2449489742783178*alpha_vdim[12][l]*f[189][l]+0.273861278752583*alpha_vdim[69][l]*f[183][l]+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[179][l]+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[165][l]+0.273861278752583*alpha_vdim[6][l]*f[164][l]+0.2449489742783178*alpha_vdim[60][l]*f[161][l]+0.273861278752583*alpha_vdim[25][l]*f[145][l]+0.2449489742783178*alpha_vdim[43][l]*f[144][l]+0.273861278752583*(alpha_vdim[5][l]*f[144][l]+alpha_cdim[3][l]*f[134][l])+0.3061862178478971*alpha_vdim[32][l]*f[133][l]+0.273861278752583*alpha_vdim[1][l]*f[132][l]+f[124][l]*(0.273861278752583*alpha_vdim[129][l]+0.3061862178478971*alpha_vdim[44][l])+0.273861278752583*alpha_vdim[25][l]*f[123][l]+0.2449489742783178*f[105][l]*alpha_vdim[120][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[110][l]+0.273861278752583*alpha_vdim[38][l]*f[105][l]+0.2449489742783178*alpha_vdim[22][l]*f[104][l]+0.273861278752583*alpha_vdim[12][l]*f[95][l]+0.3061862178478971*alpha_vdim[69][l]*f[90][l]+0.273861278752583*alpha_vdim[12][l]*f[89][l]+0.3061862178478971*(alpha_cdim[0][l]*f[79][l]+alpha_vdim[6][l]*f[78][l])+(0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[77][l]+0.273861278752583*alpha_vdim[60][l]*f[75][l]+0.2449489742783178*alpha_vdim[9][l]*f[74][l]+f[65][l]*(0.273861278752583*alpha_vdim[68][l]+0.3061862178478971*alpha_vdim[13][l])+f[53][l]*(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l])*f[46][l]+0.273861278752583*f[40][l]*alpha_vdim[43][l]+0.3061862178478971*(alpha_vdim[25][l]*f[41][l]+alpha_vdim[5][l]*f[40][l])+0.2449489742783178*f[28][l]*alpha_vdim[37][l]+0.273861278752583*(alpha_vdim[22][l]*f[29][l]+alpha_vdim[4][l]*f[28][l])+0.3061862178478971*alpha_vdim[12][l]*f[19][l]+0.273861278752583*alpha_vdim[9][l]*f[15][l];
+    out[112][l] += 0.2449489742783178*(f[97][l]*alpha_vdim[606][l]+f[204][l]*alpha_vdim[603][l])+0.273861278752583*(f[123][l]*alpha_vdim[603][l]+f[155][l]*alpha_vdim[572][l])+0.2449489742783178*f[51][l]*alpha_vdim[546][l]+(0.2449489742783178*f[152][l]+0.273861278752583*f[61][l])*alpha_vdim[545][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[65][l])*alpha_vdim[543][l]+(0.2449489742783178*f[232][l]+0.273861278752583*(f[184][l]+f[183][l])+0.3061862178478971*f[89][l])*alpha_vdim[542][l]+0.2449489742783178*f[24][l]*alpha_vdim[524][l]+0.273861278752583*f[97][l]*alpha_vdim[523][l]+(0.2449489742783178*f[128][l]+0.273861278752583*f[41][l])*alpha_vdim[520][l]+(0.273861278752583*f[204][l]+0.3061862178478971*f[123][l])*alpha_vdim[519][l]+0.273861278752583*f[100][l]*alpha_vdim[518][l]+(0.273861278752583*f[203][l]+0.3061862178478971*f[125][l])*alpha_vdim[517][l]+(0.2449489742783178*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[508][l]+(0.2449489742783178*f[205][l]+0.273861278752583*(f[127][l]+f[124][l])+0.3061862178478971*f[40][l])*alpha_vdim[507][l]+0.273861278752583*f[67][l]*alpha_vdim[503][l]+0.3061862178478971*f[155][l]*alpha_vdim[502][l]+0.2449489742783178*f[62][l]*alpha_vdim[496][l]+0.273861278752583*(f[11][l]*alpha_vdim[496][l]+f[51][l]*alpha_vdim[495][l])+(0.2449489742783178*f[185][l]+0.273861278752583*(f[91][l]+f[90][l])+0.3061862178478971*f[19][l])*alpha_vdim[494][l]+(0.273861278752583*f[157][l]+0.3061862178478971*f[65][l])*alpha_vdim[493][l]+(0.273861278752583*f[156][l]+0.3061862178478971*f[66][l])*alpha_vdim[492][l]+0.273861278752583*f[24][l]*alpha_vdim[490][l]+(0.273861278752583*f[128][l]+0.3061862178478971*f[41][l])*alpha_vdim[489][l]+0.273861278752583*f[126][l]*alpha_vdim[488][l]+0.3061862178478971*(f[42][l]*alpha_vdim[488][l]+f[100][l]*alpha_vdim[487][l]+f[67][l]*alpha_vdim[486][l])+(0.5477225575051661*f[198][l]+0.6123724356957944*f[97][l])*alpha_vdim[372][l]+0.5477225575051661*f[193][l]*alpha_vdim[360][l]+0.6123724356957944*(f[104][l]*alpha_vdim[360][l]+f[147][l]*alpha_vdim[329][l])+(0.5477225575051661*f[151][l]+0.6123724356957944*f[51][l])*alpha_vdim[312][l]+(0.5477225575051661*f[226][l]+0.6123724356957944*(f[175][l]+f[152][l])+0.6846531968814573*f[61][l])*alpha_vdim[311][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[300][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[162][l]+f[161][l])+0.6846531968814573*f[74][l])*alpha_vdim[299][l]+(0.5477225575051661*f[116][l]+0.6123724356957944*f[24][l])*alpha_vdim[287][l]+(0.6123724356957944*f[198][l]+0.6846531968814573*f[97][l])*alpha_vdim[286][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[29][l])*alpha_vdim[277][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[104][l])*alpha_vdim[276][l]+0.6123724356957944*f[96][l]*alpha_vdim[275][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[274][l]+(0.5477225575051661*f[199][l]+0.6123724356957944*(f[115][l]+f[98][l])+0.6846531968814573*f[23][l])*alpha_vdim[268][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*(f[108][l]+f[105][l])+0.6846531968814573*f[28][l])*alpha_vdim[264][l]+0.6123724356957944*f[55][l]*alpha_vdim[260][l]+0.6846531968814573*f[147][l]*alpha_vdim[259][l]+(0.5477225575051661*f[176][l]+0.6123724356957944*(f[85][l]+f[62][l])+0.6846531968814573*f[11][l])*alpha_vdim[256][l]+(0.6123724356957944*f[151][l]+0.6846531968814573*f[51][l])*alpha_vdim[255][l]+(0.5477225575051661*f[163][l]+0.6123724356957944*(f[76][l]+f[75][l])+0.6846531968814573*f[15][l])*alpha_vdim[251][l]+(0.6123724356957944*f[149][l]+0.6846531968814573*f[53][l])*alpha_vdim[250][l]+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[249][l]+(0.6123724356957944*f[116][l]+0.6846531968814573*f[24][l])*alpha_vdim[248][l]+0.273861278752583*f[30][l]*alpha_cdim[247][l]+(0.6123724356957944*f[109][l]+0.6846531968814573*f[29][l])*alpha_vdim[246][l]+0.6123724356957944*f[107][l]*alpha_vdim[245][l]+0.6846531968814573*(f[30][l]*alpha_vdim[245][l]+f[96][l]*alpha_vdim[244][l]+f[55][l]*alpha_vdim[243][l])+0.3061862178478971*f[79][l]*alpha_cdim[243][l]+0.2449489742783178*(alpha_vdim[68][l]*f[234][l]+alpha_vdim[25][l]*f[217][l]+alpha_vdim[129][l]*f[216][l])+0.273861278752583*(alpha_vdim[43][l]*f[216][l]+alpha_vdim[31][l]*f[207][l])+0.2449489742783178*alpha_vdim[13][l]*f[190][l]+0.273861278752583*alpha_vdim[68][l]*(f[189][l]+f[183][l])+0.2449489742783178*alpha_vdim[69][l]*f[179][l]+0.273861278752583*(alpha_vdim[12][l]*f[179][l]+alpha_vdim[6][l]*f[165][l])+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[164][l]+0.2449489742783178*(alpha_vdim[59][l]*f[161][l]+alpha_vdim[44][l]*f[145][l])+0.273861278752583*(alpha_vdim[5][l]*f[145][l]+alpha_vdim[25][l]*f[144][l]+alpha_vdim[2][l]*f[133][l])+0.3061862178478971*alpha_vdim[31][l]*f[132][l]+0.273861278752583*(f[123][l]*alpha_vdim[129][l]+alpha_vdim[25][l]*f[124][l])+0.3061862178478971*alpha_vdim[43][l]*f[123][l]+0.2449489742783178*f[104][l]*alpha_vdim[120][l]+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[110][l]+0.2449489742783178*alpha_vdim[22][l]*f[105][l]+0.273861278752583*(alpha_vdim[37][l]*f[104][l]+alpha_vdim[13][l]*(f[95][l]+f[90][l]))+0.3061862178478971*alpha_vdim[68][l]*f[89][l]+0.273861278752583*alpha_vdim[17][l]*f[78][l]+0.3061862178478971*(alpha_vdim[0][l]*f[78][l]+alpha_vdim[6][l]*f[77][l])+0.2449489742783178*alpha_vdim[10][l]*f[75][l]+0.273861278752583*alpha_vdim[59][l]*f[74][l]+f[65][l]*(0.273861278752583*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])+f[53][l]*(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])+0.3061862178478971*alpha_vdim[2][l]*f[46][l]+0.273861278752583*f[41][l]*alpha_vdim[44][l]+0.3061862178478971*(alpha_vdim[5][l]*f[41][l]+alpha_vdim[25][l]*f[40][l])+0.2449489742783178*f[29][l]*alpha_vdim[38][l]+0.273861278752583*(alpha_vdim[4][l]*f[29][l]+alpha_vdim[22][l]*f[28][l])+0.3061862178478971*alpha_vdim[13][l]*f[19][l]+0.273861278752583*alpha_vdim[10][l]*f[15][l];
+    out[113][l] += 0.5477225575051661*f[96][l]*alpha_vdim[606][l]+0.4898979485566357*f[103][l]*alpha_vdim[603][l]+0.5477225575051661*(f[25][l]*alpha_vdim[603][l]+f[52][l]*alpha_vdim[572][l])+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[546][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[545][l]+(0.4898979485566357*f[159][l]+0.5477225575051661*(f[73][l]+f[68][l])+0.6123724356957944*f[13][l])*alpha_vdim[543][l]+(0.4898979485566357*f[160][l]+0.5477225575051661*(f[72][l]+f[69][l]))*alpha_vdim[542][l]+0.6123724356957944*(f[12][l]*alpha_vdim[542][l]+f[96][l]*(alpha_vdim[524][l]+alpha_vdim[523][l]))+(0.5477225575051661*f[103][l]+0.6123724356957944*f[25][l])*alpha_vdim[520][l]+(0.5477225575051661*f[103][l]+0.6123724356957944*f[25][l])*alpha_vdim[519][l]+(0.5477225575051661*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[518][l]+(0.5477225575051661*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[517][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[508][l]+(0.4898979485566357*f[206][l]+0.5477225575051661*(f[131][l]+f[130][l]+f[129][l])+0.6123724356957944*(f[45][l]+f[44][l]+f[43][l])+0.6846531968814573*f[5][l])*alpha_vdim[507][l]+0.6123724356957944*f[52][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[496][l]+(0.6123724356957944*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[495][l]+(0.5477225575051661*f[160][l]+0.6123724356957944*(f[72][l]+f[69][l])+0.6846531968814573*f[12][l])*alpha_vdim[494][l]+(0.5477225575051661*f[159][l]+0.6123724356957944*(f[73][l]+f[68][l])+0.6846531968814573*f[13][l])*alpha_vdim[493][l]+(0.5477225575051661*f[158][l]+0.6123724356957944*(f[71][l]+f[70][l]))*alpha_vdim[492][l]+0.6846531968814573*(f[14][l]*alpha_vdim[492][l]+f[96][l]*alpha_vdim[490][l])+(0.6123724356957944*f[103][l]+0.6846531968814573*f[25][l])*alpha_vdim[489][l]+(0.6123724356957944*f[102][l]+0.6846531968814573*f[26][l])*alpha_vdim[488][l]+0.6123724356957944*f[101][l]*alpha_vdim[487][l]+0.6846531968814573*(f[27][l]*alpha_vdim[487][l]+f[52][l]*alpha_vdim[486][l])+0.3061862178478971*(f[115][l]*alpha_cdim[247][l]+f[81][l]*alpha_cdim[243][l])+0.2449489742783178*(alpha_vdim[22][l]*f[213][l]+alpha_vdim[6][l]*f[186][l])+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[174][l]+0.2449489742783178*alpha_vdim[60][l]*f[173][l]+0.273861278752583*(alpha_vdim[9][l]*f[173][l]+alpha_vdim[22][l]*(f[142][l]+f[141][l])+alpha_cdim[3][l]*f[140][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[136][l]+(0.2449489742783178*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[135][l]+0.2190890230020664*(alpha_vdim[25][l]*f[129][l]+f[25][l]*alpha_vdim[129][l])+f[114][l]*(0.2449489742783178*alpha_vdim[120][l]+0.273861278752583*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])+0.273861278752583*alpha_vdim[6][l]*(f[93][l]+f[92][l])+0.2449489742783178*f[80][l]*alpha_vdim[86][l]+(0.273861278752583*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[84][l]+0.273861278752583*alpha_vdim[59][l]*f[83][l]+0.3061862178478971*(alpha_vdim[10][l]*f[83][l]+alpha_cdim[0][l]*f[82][l])+(0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[80][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[69][l]+0.2190890230020664*f[68][l]*alpha_vdim[69][l]+0.2449489742783178*(f[13][l]*alpha_vdim[69][l]+alpha_vdim[12][l]*f[68][l]+f[12][l]*alpha_vdim[68][l])+0.3061862178478971*alpha_vdim[22][l]*f[50][l]+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[48][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[47][l]+0.2449489742783178*(alpha_vdim[25][l]*f[44][l]+f[25][l]*alpha_vdim[44][l]+alpha_vdim[25][l]*f[43][l]+f[25][l]*alpha_vdim[43][l])+0.273861278752583*(alpha_vdim[5][l]*f[25][l]+f[5][l]*alpha_vdim[25][l])+0.3061862178478971*alpha_vdim[6][l]*f[20][l]+0.273861278752583*(alpha_vdim[12][l]*f[13][l]+f[12][l]*alpha_vdim[13][l]);
+    out[114][l] += 0.4898979485566357*f[110][l]*alpha_vdim[606][l]+0.5477225575051661*(f[25][l]*alpha_vdim[606][l]+f[96][l]*alpha_vdim[603][l]+f[53][l]*alpha_vdim[572][l])+(0.4898979485566357*f[164][l]+0.5477225575051661*(f[78][l]+f[68][l])+0.6123724356957944*f[13][l])*alpha_vdim[546][l]+(0.4898979485566357*f[165][l]+0.5477225575051661*(f[77][l]+f[69][l])+0.6123724356957944*f[12][l])*alpha_vdim[545][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[543][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[542][l]+(0.5477225575051661*f[110][l]+0.6123724356957944*f[25][l])*alpha_vdim[524][l]+0.5477225575051661*f[110][l]*alpha_vdim[523][l]+0.6123724356957944*(f[25][l]*alpha_vdim[523][l]+f[96][l]*(alpha_vdim[520][l]+alpha_vdim[519][l]))+(0.5477225575051661*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[518][l]+(0.5477225575051661*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[517][l]+(0.4898979485566357*f[207][l]+0.5477225575051661*(f[133][l]+f[132][l]+f[129][l])+0.6123724356957944*(f[46][l]+f[44][l]+f[43][l])+0.6846531968814573*f[5][l])*alpha_vdim[508][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[507][l]+0.6123724356957944*f[53][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.5477225575051661*f[165][l]+0.6123724356957944*(f[77][l]+f[69][l])+0.6846531968814573*f[12][l])*alpha_vdim[496][l]+(0.5477225575051661*f[164][l]+0.6123724356957944*(f[78][l]+f[68][l])+0.6846531968814573*f[13][l])*alpha_vdim[495][l]+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[494][l]+(0.6123724356957944*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[493][l]+(0.5477225575051661*f[161][l]+0.6123724356957944*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[492][l]+0.6123724356957944*f[110][l]*alpha_vdim[490][l]+0.6846531968814573*(f[25][l]*alpha_vdim[490][l]+f[96][l]*alpha_vdim[489][l])+(0.6123724356957944*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[488][l]+0.6123724356957944*f[104][l]*alpha_vdim[487][l]+0.6846531968814573*(f[29][l]*alpha_vdim[487][l]+f[53][l]*alpha_vdim[486][l])+0.2190890230020664*f[25][l]*alpha_vdim[372][l]+0.2449489742783178*(f[113][l]*alpha_vdim[360][l]+f[80][l]*alpha_vdim[329][l])+(0.2190890230020664*f[68][l]+0.2449489742783178*f[13][l])*alpha_vdim[312][l]+(0.2190890230020664*f[69][l]+0.2449489742783178*f[12][l])*alpha_vdim[311][l]+(0.2449489742783178*f[170][l]+0.273861278752583*f[82][l])*alpha_vdim[300][l]+(0.2449489742783178*f[171][l]+0.273861278752583*f[81][l])*alpha_vdim[299][l]+0.2449489742783178*f[25][l]*(alpha_vdim[287][l]+alpha_vdim[286][l])+0.273861278752583*f[113][l]*(alpha_vdim[277][l]+alpha_vdim[276][l])+(0.2449489742783178*f[135][l]+0.273861278752583*f[48][l])*alpha_vdim[275][l]+(0.2449489742783178*f[136][l]+0.273861278752583*f[47][l])*alpha_vdim[274][l]+(0.2190890230020664*f[129][l]+0.2449489742783178*(f[44][l]+f[43][l])+0.273861278752583*f[5][l])*alpha_vdim[268][l]+(0.2449489742783178*f[210][l]+0.273861278752583*(f[138][l]+f[137][l])+0.3061862178478971*f[49][l])*alpha_vdim[264][l]+0.273861278752583*f[80][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.2449489742783178*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[256][l]+(0.2449489742783178*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[255][l]+(0.273861278752583*f[171][l]+0.3061862178478971*f[81][l])*alpha_vdim[251][l]+(0.273861278752583*f[170][l]+0.3061862178478971*f[82][l])*alpha_vdim[250][l]+(0.2449489742783178*f[186][l]+0.273861278752583*(f[93][l]+f[92][l])+0.3061862178478971*f[20][l])*alpha_vdim[249][l]+0.273861278752583*(f[25][l]*alpha_vdim[248][l]+f[144][l]*alpha_cdim[247][l])+0.3061862178478971*(f[47][l]*alpha_cdim[247][l]+f[113][l]*alpha_vdim[246][l])+(0.273861278752583*f[136][l]+0.3061862178478971*f[47][l])*alpha_vdim[245][l]+0.273861278752583*f[135][l]*alpha_vdim[244][l]+0.3061862178478971*(f[48][l]*alpha_vdim[244][l]+f[80][l]*alpha_vdim[243][l]+f[83][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[116][l]+alpha_cdim[0][l]*f[84][l]);
+    out[115][l] += (0.5477225575051661*f[196][l]+0.6123724356957944*f[102][l])*alpha_vdim[606][l]+0.5477225575051661*f[194][l]*alpha_vdim[603][l]+0.6123724356957944*(f[105][l]*alpha_vdim[603][l]+f[148][l]*alpha_vdim[572][l])+(0.5477225575051661*f[223][l]+0.6123724356957944*(f[167][l]+f[158][l])+0.6846531968814573*f[71][l])*alpha_vdim[546][l]+(0.5477225575051661*f[150][l]+0.6123724356957944*f[52][l])*alpha_vdim[545][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[163][l]+f[161][l])+0.6846531968814573*f[75][l])*alpha_vdim[543][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[542][l]+(0.6123724356957944*f[196][l]+0.6846531968814573*f[102][l])*alpha_vdim[524][l]+(0.5477225575051661*f[111][l]+0.6123724356957944*f[26][l])*alpha_vdim[523][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[105][l])*alpha_vdim[520][l]+(0.5477225575051661*f[108][l]+0.6123724356957944*f[28][l])*alpha_vdim[519][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[518][l]+0.6123724356957944*f[96][l]*alpha_vdim[517][l]+(0.5477225575051661*f[195][l]+0.6123724356957944*(f[112][l]+f[101][l])+0.6846531968814573*f[27][l])*alpha_vdim[508][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*(f[109][l]+f[104][l]))*alpha_vdim[507][l]+0.6846531968814573*(f[29][l]*alpha_vdim[507][l]+f[148][l]*alpha_vdim[503][l])+0.6123724356957944*f[54][l]*alpha_vdim[502][l]+(0.6123724356957944*f[150][l]+0.6846531968814573*f[52][l])*alpha_vdim[496][l]+(0.5477225575051661*f[166][l]+0.6123724356957944*(f[79][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[495][l]+(0.6123724356957944*f[149][l]+0.6846531968814573*f[53][l])*alpha_vdim[494][l]+(0.5477225575051661*f[162][l]+0.6123724356957944*(f[76][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[493][l]+(0.6123724356957944*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[492][l]+(0.6123724356957944*f[111][l]+0.6846531968814573*f[26][l])*alpha_vdim[490][l]+0.6123724356957944*f[108][l]*alpha_vdim[489][l]+0.6846531968814573*(f[28][l]*alpha_vdim[489][l]+f[96][l]*alpha_vdim[488][l])+0.6123724356957944*f[106][l]*alpha_vdim[487][l]+0.6846531968814573*(f[30][l]*alpha_vdim[487][l]+f[54][l]*alpha_vdim[486][l])+0.2449489742783178*(f[102][l]*alpha_vdim[372][l]+f[212][l]*alpha_vdim[360][l])+0.273861278752583*(f[136][l]*alpha_vdim[360][l]+f[171][l]*alpha_vdim[329][l])+(0.2449489742783178*f[158][l]+0.273861278752583*f[71][l])*alpha_vdim[312][l]+0.2449489742783178*f[52][l]*alpha_vdim[311][l]+(0.2449489742783178*f[233][l]+0.273861278752583*(f[188][l]+f[186][l])+0.3061862178478971*f[93][l])*alpha_vdim[300][l]+0.2449489742783178*f[172][l]*alpha_vdim[299][l]+0.273861278752583*(f[80][l]*alpha_vdim[299][l]+f[102][l]*alpha_vdim[287][l])+0.2449489742783178*f[26][l]*alpha_vdim[286][l]+(0.273861278752583*f[212][l]+0.3061862178478971*f[136][l])*alpha_vdim[277][l]+(0.2449489742783178*f[139][l]+0.273861278752583*f[47][l])*alpha_vdim[276][l]+(0.273861278752583*f[210][l]+0.3061862178478971*f[138][l])*alpha_vdim[275][l]+0.273861278752583*f[113][l]*alpha_vdim[274][l]+(0.2449489742783178*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[268][l]+(0.2449489742783178*f[211][l]+0.273861278752583*(f[140][l]+f[135][l]))*alpha_vdim[264][l]+0.3061862178478971*(f[48][l]*alpha_vdim[264][l]+f[171][l]*alpha_vdim[260][l])+0.273861278752583*(f[81][l]*alpha_vdim[259][l]+f[52][l]*alpha_vdim[256][l])+(0.2449489742783178*f[70][l]+0.273861278752583*f[14][l])*alpha_vdim[255][l]+(0.273861278752583*f[172][l]+0.3061862178478971*f[80][l])*alpha_vdim[251][l]+(0.2449489742783178*f[187][l]+0.273861278752583*(f[94][l]+f[92][l])+0.3061862178478971*f[20][l])*alpha_vdim[250][l]+(0.273861278752583*f[170][l]+0.3061862178478971*f[82][l])*alpha_vdim[249][l]+0.273861278752583*(f[26][l]*alpha_vdim[248][l]+f[139][l]*alpha_vdim[246][l])+0.3061862178478971*(f[47][l]*alpha_vdim[246][l]+f[113][l]*alpha_vdim[245][l])+0.273861278752583*f[137][l]*alpha_vdim[244][l]+0.3061862178478971*(f[49][l]*alpha_vdim[244][l]+f[81][l]*alpha_vdim[243][l])+0.2449489742783178*alpha_vdim[60][l]*f[234][l]+(0.2449489742783178*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[217][l]+0.2449489742783178*alpha_vdim[22][l]*f[216][l]+0.273861278752583*(alpha_vdim[32][l]*f[213][l]+alpha_vdim[60][l]*f[190][l])+0.2449489742783178*alpha_vdim[9][l]*f[189][l]+0.273861278752583*alpha_vdim[60][l]*f[186][l]+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[179][l]+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[174][l]+0.273861278752583*alpha_vdim[6][l]*f[173][l]+0.2449489742783178*alpha_vdim[69][l]*f[161][l]+0.273861278752583*alpha_vdim[22][l]*f[145][l]+0.2449489742783178*alpha_vdim[37][l]*f[144][l]+0.273861278752583*(alpha_vdim[4][l]*f[144][l]+alpha_cdim[3][l]*f[143][l])+0.3061862178478971*alpha_vdim[32][l]*f[142][l]+0.273861278752583*alpha_vdim[1][l]*f[141][l]+(0.273861278752583*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[38][l])*f[136][l]+0.273861278752583*alpha_vdim[22][l]*f[135][l]+0.2449489742783178*f[105][l]*alpha_vdim[129][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[114][l]+0.273861278752583*alpha_vdim[44][l]*f[105][l]+0.2449489742783178*alpha_vdim[25][l]*f[104][l]+0.273861278752583*alpha_vdim[9][l]*f[95][l]+0.3061862178478971*alpha_vdim[60][l]*f[93][l]+0.273861278752583*alpha_vdim[9][l]*f[92][l]+0.3061862178478971*(alpha_cdim[0][l]*f[85][l]+alpha_vdim[6][l]*f[84][l])+(0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[83][l]+(0.273861278752583*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[80][l]+0.273861278752583*alpha_vdim[69][l]*f[75][l]+0.2449489742783178*alpha_vdim[12][l]*f[74][l]+f[53][l]*(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])+0.3061862178478971*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[50][l]+alpha_vdim[22][l]*f[48][l])+(0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[47][l]+0.2449489742783178*f[28][l]*alpha_vdim[43][l]+0.273861278752583*(alpha_vdim[25][l]*f[29][l]+alpha_vdim[5][l]*f[28][l])+0.3061862178478971*alpha_vdim[9][l]*f[20][l]+0.273861278752583*alpha_vdim[12][l]*f[15][l];
+    out[116][l] += (0.5477225575051661*f[195][l]+0.6123724356957944*f[101][l])*alpha_vdim[606][l]+0.5477225575051661*f[193][l]*alpha_vdim[603][l]+0.6123724356957944*(f[104][l]*alpha_vdim[603][l]+f[147][l]*alpha_vdim[572][l])+(0.5477225575051661*f[150][l]+0.6123724356957944*f[52][l])*alpha_vdim[546][l]+(0.5477225575051661*f[223][l]+0.6123724356957944*(f[166][l]+f[158][l])+0.6846531968814573*f[70][l])*alpha_vdim[545][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[543][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[162][l]+f[161][l])+0.6846531968814573*f[74][l])*alpha_vdim[542][l]+(0.5477225575051661*f[112][l]+0.6123724356957944*f[27][l])*alpha_vdim[524][l]+(0.6123724356957944*f[195][l]+0.6846531968814573*f[101][l])*alpha_vdim[523][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[29][l])*alpha_vdim[520][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[104][l])*alpha_vdim[519][l]+0.6123724356957944*f[96][l]*alpha_vdim[518][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[517][l]+(0.5477225575051661*f[196][l]+0.6123724356957944*(f[111][l]+f[102][l])+0.6846531968814573*f[26][l])*alpha_vdim[508][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*(f[108][l]+f[105][l])+0.6846531968814573*f[28][l])*alpha_vdim[507][l]+0.6123724356957944*f[55][l]*alpha_vdim[503][l]+0.6846531968814573*f[147][l]*alpha_vdim[502][l]+(0.5477225575051661*f[167][l]+0.6123724356957944*(f[79][l]+f[71][l])+0.6846531968814573*f[14][l])*alpha_vdim[496][l]+(0.6123724356957944*f[150][l]+0.6846531968814573*f[52][l])*alpha_vdim[495][l]+(0.5477225575051661*f[163][l]+0.6123724356957944*(f[76][l]+f[75][l])+0.6846531968814573*f[15][l])*alpha_vdim[494][l]+(0.6123724356957944*f[149][l]+0.6846531968814573*f[53][l])*alpha_vdim[493][l]+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[492][l]+(0.6123724356957944*f[112][l]+0.6846531968814573*f[27][l])*alpha_vdim[490][l]+(0.6123724356957944*f[109][l]+0.6846531968814573*f[29][l])*alpha_vdim[489][l]+0.6123724356957944*f[107][l]*alpha_vdim[488][l]+0.6846531968814573*(f[30][l]*alpha_vdim[488][l]+f[96][l]*alpha_vdim[487][l]+f[55][l]*alpha_vdim[486][l])+0.2449489742783178*(f[101][l]*alpha_vdim[372][l]+f[211][l]*alpha_vdim[360][l])+0.273861278752583*(f[135][l]*alpha_vdim[360][l]+f[170][l]*alpha_vdim[329][l])+0.2449489742783178*f[52][l]*alpha_vdim[312][l]+(0.2449489742783178*f[158][l]+0.273861278752583*f[70][l])*alpha_vdim[311][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[80][l])*alpha_vdim[300][l]+(0.2449489742783178*f[233][l]+0.273861278752583*(f[187][l]+f[186][l])+0.3061862178478971*f[92][l])*alpha_vdim[299][l]+0.2449489742783178*f[27][l]*alpha_vdim[287][l]+0.273861278752583*f[101][l]*alpha_vdim[286][l]+(0.2449489742783178*f[140][l]+0.273861278752583*f[48][l])*alpha_vdim[277][l]+(0.273861278752583*f[211][l]+0.3061862178478971*f[135][l])*alpha_vdim[276][l]+0.273861278752583*f[113][l]*alpha_vdim[275][l]+(0.273861278752583*f[210][l]+0.3061862178478971*f[137][l])*alpha_vdim[274][l]+(0.2449489742783178*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[268][l]+(0.2449489742783178*f[212][l]+0.273861278752583*(f[139][l]+f[136][l])+0.3061862178478971*f[47][l])*alpha_vdim[264][l]+0.273861278752583*f[82][l]*alpha_vdim[260][l]+0.3061862178478971*f[170][l]*alpha_vdim[259][l]+0.2449489742783178*f[71][l]*alpha_vdim[256][l]+0.273861278752583*(f[14][l]*alpha_vdim[256][l]+f[52][l]*alpha_vdim[255][l])+(0.2449489742783178*f[188][l]+0.273861278752583*(f[94][l]+f[93][l])+0.3061862178478971*f[20][l])*alpha_vdim[251][l]+(0.273861278752583*f[172][l]+0.3061862178478971*f[80][l])*alpha_vdim[250][l]+(0.273861278752583*f[171][l]+0.3061862178478971*f[81][l])*alpha_vdim[249][l]+0.273861278752583*f[27][l]*alpha_vdim[248][l]+(0.273861278752583*f[146][l]+0.3061862178478971*f[49][l])*alpha_cdim[247][l]+(0.273861278752583*f[140][l]+0.3061862178478971*f[48][l])*alpha_vdim[246][l]+0.273861278752583*f[138][l]*alpha_vdim[245][l]+0.3061862178478971*(f[49][l]*alpha_vdim[245][l]+f[113][l]*alpha_vdim[244][l]+f[82][l]*alpha_vdim[243][l]+f[85][l]*alpha_cdim[243][l])+0.2449489742783178*(alpha_vdim[59][l]*f[234][l]+alpha_vdim[22][l]*f[217][l]+alpha_vdim[120][l]*f[216][l])+0.273861278752583*(alpha_vdim[37][l]*f[216][l]+alpha_vdim[31][l]*f[213][l])+0.2449489742783178*alpha_vdim[10][l]*f[190][l]+0.273861278752583*alpha_vdim[59][l]*(f[189][l]+f[186][l])+0.2449489742783178*alpha_vdim[60][l]*f[179][l]+0.273861278752583*(alpha_vdim[9][l]*f[179][l]+alpha_vdim[6][l]*f[174][l])+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[173][l]+0.2449489742783178*(alpha_vdim[68][l]*f[161][l]+alpha_vdim[38][l]*f[145][l])+0.273861278752583*(alpha_vdim[4][l]*f[145][l]+alpha_vdim[22][l]*f[144][l]+alpha_vdim[2][l]*f[142][l])+0.3061862178478971*alpha_vdim[31][l]*f[141][l]+0.273861278752583*alpha_vdim[22][l]*f[136][l]+(0.273861278752583*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[37][l])*f[135][l]+0.2449489742783178*f[104][l]*alpha_vdim[129][l]+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[114][l]+0.2449489742783178*alpha_vdim[25][l]*f[105][l]+0.273861278752583*(alpha_vdim[43][l]*f[104][l]+alpha_vdim[10][l]*(f[95][l]+f[93][l]))+0.3061862178478971*alpha_vdim[59][l]*f[92][l]+0.273861278752583*alpha_vdim[17][l]*f[84][l]+0.3061862178478971*(alpha_vdim[0][l]*f[84][l]+alpha_vdim[6][l]*f[83][l])+(0.273861278752583*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[80][l]+0.2449489742783178*alpha_vdim[13][l]*f[75][l]+0.273861278752583*alpha_vdim[68][l]*f[74][l]+f[53][l]*(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])+0.3061862178478971*alpha_vdim[2][l]*f[50][l]+0.273861278752583*alpha_vdim[38][l]*f[48][l]+0.3061862178478971*(alpha_vdim[4][l]*f[48][l]+alpha_vdim[22][l]*f[47][l])+0.2449489742783178*f[29][l]*alpha_vdim[44][l]+0.273861278752583*(alpha_vdim[5][l]*f[29][l]+alpha_vdim[25][l]*f[28][l])+0.3061862178478971*alpha_vdim[10][l]*f[20][l]+0.273861278752583*alpha_vdim[13][l]*f[15][l];
+    out[117][l] += 0.6846531968814573*(f[97][l]*alpha_cdim[247][l]+f[56][l]*alpha_cdim[243][l])+(0.1249739664685295*alpha_vdim[129][l]+0.1956151991089878*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[129][l]+(0.1956151991089878*(f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[129][l]+(0.1249739664685295*alpha_vdim[120][l]+0.1956151991089878*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])*f[120][l]+(0.1956151991089878*(f[38][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[120][l]+0.6123724356957944*alpha_cdim[3][l]*f[119][l]+(0.1249739664685295*alpha_vdim[86][l]+0.1956151991089878*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[86][l]+(0.1956151991089878*(f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[86][l]+0.1749635530559412*alpha_vdim[69][l]*f[69][l]+0.273861278752583*(alpha_vdim[12][l]*f[69][l]+f[12][l]*alpha_vdim[69][l])+0.1749635530559412*alpha_vdim[68][l]*f[68][l]+0.273861278752583*(alpha_vdim[13][l]*f[68][l]+f[13][l]*alpha_vdim[68][l])+0.1749635530559412*alpha_vdim[60][l]*f[60][l]+0.273861278752583*(alpha_vdim[9][l]*f[60][l]+f[9][l]*alpha_vdim[60][l])+0.1749635530559412*alpha_vdim[59][l]*f[59][l]+0.273861278752583*(alpha_vdim[10][l]*f[59][l]+f[10][l]*alpha_vdim[59][l])+0.6846531968814573*alpha_cdim[0][l]*f[57][l]+0.3061862178478971*(alpha_vdim[43][l]*f[44][l]+f[43][l]*alpha_vdim[44][l]+alpha_vdim[37][l]*f[38][l]+f[37][l]*alpha_vdim[38][l])+(0.1749635530559412*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l])*f[32][l]+0.273861278752583*(alpha_vdim[1][l]*f[32][l]+f[1][l]*alpha_vdim[32][l])+0.1749635530559412*alpha_vdim[31][l]*f[31][l]+0.273861278752583*(alpha_vdim[2][l]*f[31][l]+f[2][l]*alpha_vdim[31][l])+0.2449489742783178*(alpha_vdim[25][l]*f[25][l]+alpha_vdim[22][l]*f[22][l])+0.3061862178478971*(alpha_vdim[16][l]*f[17][l]+f[16][l]*alpha_vdim[17][l])+0.2449489742783178*alpha_vdim[6][l]*f[6][l];
+    out[118][l] += 0.3061862178478971*(f[121][l]*alpha_cdim[247][l]+f[87][l]*alpha_cdim[243][l])+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[158][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[152][l]+(0.3912303982179757*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[129][l]+(0.3912303982179757*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[120][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[117][l]+0.5477225575051661*alpha_vdim[25][l]*f[102][l]+(0.6123724356957944*alpha_vdim[44][l]+0.4374088826398531*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[101][l]+0.5477225575051661*alpha_vdim[22][l]*f[98][l]+(0.6123724356957944*alpha_vdim[38][l]+0.4374088826398531*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[97][l]+0.3912303982179757*f[56][l]*alpha_vdim[86][l]+0.6123724356957944*(f[8][l]*alpha_vdim[86][l]+alpha_vdim[68][l]*f[71][l])+(0.4374088826398531*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[13][l])*f[70][l]+0.5477225575051661*f[52][l]*alpha_vdim[69][l]+0.6846531968814573*f[14][l]*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[59][l]*f[62][l]+(0.4374088826398531*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[10][l])*f[61][l]+0.5477225575051661*f[51][l]*alpha_vdim[60][l]+0.6846531968814573*(f[11][l]*alpha_vdim[59][l]+alpha_cdim[0][l]*f[58][l])+0.5477225575051661*alpha_vdim[6][l]*f[57][l]+(0.6123724356957944*alpha_vdim[17][l]+0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[56][l]+0.6123724356957944*(alpha_vdim[12][l]*f[52][l]+alpha_vdim[9][l]*f[51][l])+0.6846531968814573*(f[27][l]*alpha_vdim[43][l]+f[24][l]*alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[31][l]*f[34][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[33][l]+0.5477225575051661*f[21][l]*alpha_vdim[32][l]+0.6846531968814573*f[3][l]*alpha_vdim[31][l]+0.6123724356957944*(alpha_vdim[25][l]*f[26][l]+alpha_vdim[22][l]*f[23][l]+(alpha_cdim[3][l]+alpha_vdim[1][l])*f[21][l])+0.6846531968814573*f[8][l]*alpha_vdim[16][l]+0.6123724356957944*alpha_vdim[6][l]*f[7][l];
+    out[119][l] += 0.6846531968814573*(f[99][l]*alpha_cdim[247][l]+f[58][l]*alpha_cdim[243][l])+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[158][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[152][l]+(0.3912303982179757*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[129][l]+(0.3912303982179757*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[120][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[117][l]+(0.4374088826398531*alpha_vdim[44][l]+0.6123724356957944*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[102][l]+0.5477225575051661*alpha_vdim[25][l]*f[101][l]+(0.4374088826398531*alpha_vdim[38][l]+0.6123724356957944*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[98][l]+0.5477225575051661*alpha_vdim[22][l]*f[97][l]+0.3061862178478971*alpha_cdim[0][l]*f[88][l]+(0.3912303982179757*f[57][l]+0.6123724356957944*f[7][l])*alpha_vdim[86][l]+(0.4374088826398531*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[71][l]+alpha_vdim[69][l]*(0.6123724356957944*f[70][l]+0.6846531968814573*f[14][l])+0.5477225575051661*f[52][l]*alpha_vdim[68][l]+(0.4374088826398531*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[62][l]+alpha_vdim[60][l]*(0.6123724356957944*f[61][l]+0.6846531968814573*f[11][l])+0.5477225575051661*f[51][l]*alpha_vdim[59][l]+(0.4374088826398531*alpha_vdim[17][l]+0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[57][l]+0.5477225575051661*alpha_vdim[6][l]*f[56][l]+0.6123724356957944*(alpha_vdim[13][l]*f[52][l]+alpha_vdim[10][l]*f[51][l])+0.6846531968814573*(f[26][l]*alpha_vdim[44][l]+f[23][l]*alpha_vdim[38][l])+(0.4374088826398531*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[34][l]+alpha_vdim[32][l]*(0.6123724356957944*f[33][l]+0.6846531968814573*f[3][l])+0.5477225575051661*f[21][l]*alpha_vdim[31][l]+0.6123724356957944*(alpha_vdim[25][l]*f[27][l]+alpha_vdim[22][l]*f[24][l]+alpha_vdim[2][l]*f[21][l])+0.6846531968814573*f[7][l]*alpha_vdim[17][l]+0.6123724356957944*alpha_vdim[6][l]*f[8][l];
+    out[120][l] += (0.1249739664685295*f[129][l]+0.1956151991089878*(f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[372][l]+(0.1249739664685295*f[117][l]+0.1956151991089878*(f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[360][l]+(0.1249739664685295*f[86][l]+0.1956151991089878*(f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[329][l]+(0.1749635530559412*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[312][l]+(0.1749635530559412*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[311][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[300][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[299][l]+(0.1956151991089878*f[129][l]+0.3061862178478971*f[43][l])*alpha_vdim[287][l]+(0.1956151991089878*f[129][l]+0.3061862178478971*f[44][l])*alpha_vdim[286][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[277][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[276][l]+(0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[275][l]+(0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[274][l]+0.2449489742783178*(f[25][l]*alpha_vdim[268][l]+f[21][l]*alpha_vdim[264][l])+(0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[260][l]+(0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[259][l]+0.273861278752583*(f[68][l]*alpha_vdim[256][l]+f[69][l]*alpha_vdim[255][l]+f[56][l]*alpha_vdim[251][l]+f[57][l]*alpha_vdim[250][l])+0.2449489742783178*f[6][l]*alpha_vdim[249][l]+0.3061862178478971*f[129][l]*alpha_vdim[248][l]+(0.6123724356957944*f[123][l]+0.6846531968814573*f[31][l])*alpha_cdim[247][l]+0.3061862178478971*f[117][l]*alpha_vdim[246][l]+0.273861278752583*(f[31][l]*alpha_vdim[245][l]+f[32][l]*alpha_vdim[244][l])+0.3061862178478971*f[86][l]*alpha_vdim[243][l]+0.6846531968814573*(f[59][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[98][l]+alpha_cdim[0][l]*f[60][l]);
+    out[121][l] += (0.1956151991089878*f[206][l]+0.3061862178478971*f[131][l])*alpha_vdim[372][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[34][l])*alpha_vdim[360][l]+(0.1956151991089878*f[182][l]+0.3061862178478971*f[88][l])*alpha_vdim[329][l]+0.273861278752583*f[160][l]*alpha_vdim[312][l]+(0.1956151991089878*f[159][l]+0.3061862178478971*f[73][l])*alpha_vdim[311][l]+0.2449489742783178*f[57][l]*alpha_vdim[300][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[299][l]+0.3061862178478971*f[206][l]*alpha_vdim[287][l]+(0.1956151991089878*f[130][l]+0.3061862178478971*f[45][l])*alpha_vdim[286][l]+0.273861278752583*f[117][l]*alpha_vdim[277][l]+0.1749635530559412*f[33][l]*alpha_vdim[276][l]+0.273861278752583*(f[3][l]*alpha_vdim[276][l]+f[119][l]*alpha_vdim[275][l])+(0.1956151991089878*f[118][l]+0.3061862178478971*f[36][l])*alpha_vdim[274][l]+0.273861278752583*f[103][l]*alpha_vdim[268][l]+0.2449489742783178*f[21][l]*alpha_vdim[264][l]+0.3061862178478971*f[182][l]*alpha_vdim[260][l]+0.1956151991089878*f[87][l]*alpha_vdim[259][l]+0.3061862178478971*(f[18][l]*alpha_vdim[259][l]+f[159][l]*alpha_vdim[256][l])+0.273861278752583*(f[72][l]*alpha_vdim[255][l]+f[56][l]*alpha_vdim[251][l])+0.2449489742783178*f[7][l]*alpha_vdim[250][l]+0.273861278752583*f[58][l]*alpha_vdim[249][l]+0.3061862178478971*f[130][l]*alpha_vdim[248][l]+0.273861278752583*f[33][l]*alpha_vdim[246][l]+0.3061862178478971*f[118][l]*alpha_vdim[245][l]+0.273861278752583*f[35][l]*alpha_vdim[244][l]+0.3061862178478971*f[87][l]*alpha_vdim[243][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[203][l]+(0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[44][l])*f[192][l]+0.5477225575051661*alpha_vdim[60][l]*f[156][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[155][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[152][l]+0.6123724356957944*alpha_vdim[69][l]*f[148][l]+0.4374088826398531*alpha_vdim[68][l]*f[147][l]+0.6846531968814573*(alpha_vdim[13][l]*f[147][l]+f[107][l]*alpha_vdim[129][l])+0.6123724356957944*alpha_vdim[120][l]*f[126][l]+(0.3912303982179757*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[125][l]+0.4374088826398531*f[117][l]*alpha_vdim[120][l]+0.6846531968814573*(f[34][l]*alpha_vdim[120][l]+alpha_vdim[38][l]*f[117][l])+(0.4374088826398531*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[106][l]+0.5477225575051661*alpha_vdim[22][l]*f[100][l]+0.6123724356957944*alpha_vdim[32][l]*f[98][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[97][l]+0.6123724356957944*alpha_vdim[25][l]*f[96][l]+0.6846531968814573*(f[62][l]*alpha_vdim[86][l]+f[55][l]*alpha_vdim[68][l])+0.6123724356957944*alpha_vdim[59][l]*f[67][l]+0.5477225575051661*alpha_vdim[9][l]*f[66][l]+0.6846531968814573*alpha_cdim[0][l]*f[63][l]+(0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[61][l]+0.6123724356957944*f[57][l]*alpha_vdim[60][l]+0.4374088826398531*f[56][l]*alpha_vdim[59][l]+0.6846531968814573*(f[8][l]*alpha_vdim[59][l]+alpha_vdim[10][l]*f[56][l])+0.6123724356957944*(alpha_vdim[12][l]*f[54][l]+alpha_vdim[6][l]*f[51][l])+0.6846531968814573*f[30][l]*alpha_vdim[43][l]+alpha_vdim[37][l]*(0.6123724356957944*f[42][l]+0.4374088826398531*f[33][l])+0.6846531968814573*(f[3][l]*alpha_vdim[37][l]+alpha_vdim[4][l]*f[33][l]+f[24][l]*alpha_vdim[31][l])+0.6123724356957944*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[23][l]+f[21][l]*alpha_vdim[22][l])+0.6846531968814573*f[11][l]*alpha_vdim[16][l]+0.6123724356957944*f[7][l]*alpha_vdim[9][l];
+    out[122][l] += (0.1956151991089878*f[206][l]+0.3061862178478971*f[130][l])*alpha_vdim[372][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[33][l])*alpha_vdim[360][l]+(0.1956151991089878*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[329][l]+(0.1956151991089878*f[160][l]+0.3061862178478971*f[72][l])*alpha_vdim[312][l]+0.273861278752583*f[159][l]*alpha_vdim[311][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[300][l]+0.2449489742783178*f[56][l]*alpha_vdim[299][l]+0.1956151991089878*f[131][l]*alpha_vdim[287][l]+0.3061862178478971*(f[45][l]*alpha_vdim[287][l]+f[206][l]*alpha_vdim[286][l])+0.1749635530559412*f[34][l]*alpha_vdim[277][l]+0.273861278752583*(f[3][l]*alpha_vdim[277][l]+f[117][l]*alpha_vdim[276][l])+(0.1956151991089878*f[119][l]+0.3061862178478971*f[35][l])*alpha_vdim[275][l]+0.273861278752583*(f[118][l]*alpha_vdim[274][l]+f[103][l]*alpha_vdim[268][l])+0.2449489742783178*f[21][l]*alpha_vdim[264][l]+0.1956151991089878*f[88][l]*alpha_vdim[260][l]+0.3061862178478971*(f[18][l]*alpha_vdim[260][l]+f[182][l]*alpha_vdim[259][l])+0.273861278752583*f[73][l]*alpha_vdim[256][l]+0.3061862178478971*f[160][l]*alpha_vdim[255][l]+0.2449489742783178*f[8][l]*alpha_vdim[251][l]+0.273861278752583*(f[57][l]*alpha_vdim[250][l]+f[58][l]*alpha_vdim[249][l])+0.3061862178478971*f[131][l]*alpha_vdim[248][l]+(0.6123724356957944*f[128][l]+0.6846531968814573*f[36][l])*alpha_cdim[247][l]+0.273861278752583*(f[34][l]*alpha_vdim[246][l]+f[36][l]*alpha_vdim[245][l])+0.3061862178478971*(f[119][l]*alpha_vdim[244][l]+f[88][l]*alpha_vdim[243][l])+0.6846531968814573*f[64][l]*alpha_cdim[243][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])*f[203][l]+(0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[43][l])*f[192][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[156][l]+0.5477225575051661*alpha_vdim[59][l]*f[155][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[152][l]+(0.4374088826398531*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[148][l]+0.6123724356957944*alpha_vdim[68][l]*f[147][l]+0.6846531968814573*f[106][l]*alpha_vdim[129][l]+(0.3912303982179757*alpha_vdim[38][l]+0.6123724356957944*alpha_vdim[4][l])*f[126][l]+alpha_vdim[120][l]*(0.6123724356957944*f[125][l]+0.4374088826398531*f[117][l])+0.6846531968814573*(f[33][l]*alpha_vdim[120][l]+alpha_vdim[37][l]*f[117][l])+(0.4374088826398531*alpha_vdim[44][l]+0.6846531968814573*alpha_vdim[5][l])*f[107][l]+0.5477225575051661*alpha_vdim[22][l]*f[100][l]+(0.4374088826398531*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[98][l]+0.6123724356957944*(alpha_vdim[31][l]*f[97][l]+alpha_vdim[25][l]*f[96][l])+0.6846531968814573*(f[61][l]*alpha_vdim[86][l]+f[54][l]*alpha_vdim[69][l])+0.5477225575051661*alpha_vdim[10][l]*f[67][l]+0.6123724356957944*alpha_vdim[60][l]*f[66][l]+(0.4374088826398531*alpha_vdim[17][l]+0.6846531968814573*alpha_vdim[0][l])*f[62][l]+(0.4374088826398531*f[57][l]+0.6846531968814573*f[7][l])*alpha_vdim[60][l]+0.6123724356957944*f[56][l]*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[9][l]*f[57][l]+0.6123724356957944*(alpha_vdim[13][l]*f[55][l]+alpha_vdim[6][l]*f[51][l])+0.6846531968814573*f[30][l]*alpha_vdim[44][l]+alpha_vdim[38][l]*(0.6123724356957944*f[42][l]+0.4374088826398531*f[34][l])+0.6846531968814573*(f[3][l]*alpha_vdim[38][l]+alpha_vdim[4][l]*f[34][l]+f[23][l]*alpha_vdim[32][l])+0.6123724356957944*(alpha_vdim[2][l]*f[24][l]+f[21][l]*alpha_vdim[22][l])+0.6846531968814573*f[11][l]*alpha_vdim[17][l]+0.6123724356957944*f[8][l]*alpha_vdim[10][l];
+    out[123][l] += (0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[372][l]+(0.3912303982179757*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[360][l]+(0.3912303982179757*f[59][l]+0.6123724356957944*f[10][l])*alpha_vdim[329][l]+0.5477225575051661*f[53][l]*alpha_vdim[312][l]+(0.3912303982179757*f[161][l]+0.6123724356957944*f[75][l]+0.4374088826398531*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[311][l]+0.5477225575051661*f[51][l]*alpha_vdim[300][l]+(0.3912303982179757*f[152][l]+0.6123724356957944*f[62][l]+0.4374088826398531*f[61][l]+0.6846531968814573*f[11][l])*alpha_vdim[299][l]+0.6123724356957944*f[104][l]*alpha_vdim[287][l]+(0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[286][l]+0.6123724356957944*f[97][l]*alpha_vdim[277][l]+(0.4374088826398531*f[97][l]+0.6846531968814573*f[24][l])*alpha_vdim[276][l]+0.5477225575051661*f[22][l]*alpha_vdim[275][l]+(0.3912303982179757*f[120][l]+0.6123724356957944*f[38][l]+0.4374088826398531*f[37][l]+0.6846531968814573*f[4][l])*alpha_vdim[274][l]+(0.5477225575051661*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[268][l]+0.5477225575051661*f[98][l]*alpha_vdim[264][l]+0.6123724356957944*(f[23][l]*alpha_vdim[264][l]+f[59][l]*alpha_vdim[260][l])+(0.4374088826398531*f[59][l]+0.6846531968814573*f[10][l])*alpha_vdim[259][l]+(0.6123724356957944*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[256][l]+0.6123724356957944*f[53][l]*alpha_vdim[255][l]+(0.6123724356957944*f[152][l]+0.6846531968814573*f[61][l])*alpha_vdim[251][l]+0.6123724356957944*f[51][l]*alpha_vdim[250][l]+(0.5477225575051661*f[60][l]+0.6123724356957944*f[9][l])*alpha_vdim[249][l]+0.6846531968814573*f[104][l]*alpha_vdim[248][l]+0.273861278752583*f[37][l]*alpha_cdim[247][l]+0.6846531968814573*f[97][l]*alpha_vdim[246][l]+(0.6123724356957944*f[120][l]+0.6846531968814573*f[37][l])*alpha_vdim[245][l]+0.6123724356957944*f[22][l]*alpha_vdim[244][l]+0.6846531968814573*f[59][l]*alpha_vdim[243][l]+0.3061862178478971*f[89][l]*alpha_cdim[243][l]+0.6846531968814573*(alpha_cdim[3][l]*f[100][l]+alpha_cdim[0][l]*f[65][l]);
+    out[124][l] += (0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[372][l]+(0.3912303982179757*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[360][l]+(0.3912303982179757*f[60][l]+0.6123724356957944*f[9][l])*alpha_vdim[329][l]+(0.3912303982179757*f[161][l]+0.4374088826398531*f[75][l]+0.6123724356957944*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[312][l]+0.5477225575051661*f[53][l]*alpha_vdim[311][l]+(0.3912303982179757*f[152][l]+0.4374088826398531*f[62][l]+0.6123724356957944*f[61][l]+0.6846531968814573*f[11][l])*alpha_vdim[300][l]+0.5477225575051661*f[51][l]*alpha_vdim[299][l]+(0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[287][l]+0.6123724356957944*f[105][l]*alpha_vdim[286][l]+(0.4374088826398531*f[98][l]+0.6846531968814573*f[23][l])*alpha_vdim[277][l]+0.6123724356957944*f[98][l]*alpha_vdim[276][l]+(0.3912303982179757*f[120][l]+0.4374088826398531*f[38][l]+0.6123724356957944*f[37][l]+0.6846531968814573*f[4][l])*alpha_vdim[275][l]+0.5477225575051661*f[22][l]*alpha_vdim[274][l]+(0.5477225575051661*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[268][l]+(0.5477225575051661*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[264][l]+(0.4374088826398531*f[60][l]+0.6846531968814573*f[9][l])*alpha_vdim[260][l]+0.6123724356957944*(f[60][l]*alpha_vdim[259][l]+f[53][l]*alpha_vdim[256][l])+(0.6123724356957944*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[255][l]+0.6123724356957944*f[51][l]*alpha_vdim[251][l]+(0.6123724356957944*f[152][l]+0.6846531968814573*f[62][l])*alpha_vdim[250][l]+(0.5477225575051661*f[59][l]+0.6123724356957944*f[10][l])*alpha_vdim[249][l]+0.6846531968814573*f[105][l]*alpha_vdim[248][l]+0.6123724356957944*f[22][l]*alpha_cdim[247][l]+0.6846531968814573*f[98][l]*alpha_vdim[246][l]+0.6123724356957944*(f[22][l]*alpha_vdim[245][l]+f[120][l]*alpha_vdim[244][l])+0.6846531968814573*(f[38][l]*alpha_vdim[244][l]+f[60][l]*alpha_vdim[243][l]+f[65][l]*alpha_cdim[243][l])+0.3061862178478971*(alpha_cdim[3][l]*f[126][l]+alpha_cdim[0][l]*f[90][l]);
+    out[125][l] += (0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[372][l]+(0.3912303982179757*f[202][l]+0.6123724356957944*f[122][l]+0.4374088826398531*f[120][l]+0.6846531968814573*f[38][l])*alpha_vdim[360][l]+(0.4374088826398531*f[152][l]+0.6846531968814573*f[62][l])*alpha_vdim[329][l]+0.6123724356957944*f[148][l]*alpha_vdim[312][l]+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[311][l]+(0.5477225575051661*f[154][l]+0.6123724356957944*f[60][l])*alpha_vdim[300][l]+(0.3912303982179757*f[153][l]+0.6123724356957944*f[64][l]+0.4374088826398531*f[59][l])*alpha_vdim[299][l]+0.6846531968814573*(f[10][l]*alpha_vdim[299][l]+f[192][l]*alpha_vdim[287][l])+(0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[286][l]+(0.6123724356957944*f[202][l]+0.6846531968814573*f[120][l])*alpha_vdim[277][l]+(0.3912303982179757*f[121][l]+0.6123724356957944*f[39][l]+0.4374088826398531*f[37][l]+0.6846531968814573*f[4][l])*alpha_vdim[276][l]+0.6123724356957944*f[98][l]*alpha_vdim[275][l]+(0.4374088826398531*f[97][l]+0.6846531968814573*f[24][l])*alpha_vdim[274][l]+0.6123724356957944*f[96][l]*alpha_vdim[268][l]+(0.5477225575051661*f[99][l]+0.6123724356957944*f[22][l])*alpha_vdim[264][l]+0.6846531968814573*f[152][l]*alpha_vdim[260][l]+0.4374088826398531*f[61][l]*alpha_vdim[259][l]+0.6846531968814573*(f[11][l]*alpha_vdim[259][l]+f[147][l]*alpha_vdim[256][l])+0.6123724356957944*f[54][l]*alpha_vdim[255][l]+(0.6123724356957944*f[153][l]+0.6846531968814573*f[59][l])*alpha_vdim[251][l]+0.5477225575051661*f[63][l]*alpha_vdim[250][l]+0.6123724356957944*(f[9][l]*alpha_vdim[250][l]+f[51][l]*alpha_vdim[249][l])+0.6846531968814573*f[106][l]*alpha_vdim[248][l]+0.6123724356957944*f[121][l]*alpha_vdim[246][l]+0.6846531968814573*(f[37][l]*alpha_vdim[246][l]+f[97][l]*alpha_vdim[245][l])+0.6123724356957944*f[23][l]*alpha_vdim[244][l]+0.6846531968814573*f[61][l]*alpha_vdim[243][l]+(0.1956151991089878*alpha_vdim[129][l]+0.3061862178478971*alpha_vdim[44][l])*f[207][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[183][l]+0.273861278752583*alpha_vdim[69][l]*f[165][l]+0.1956151991089878*alpha_vdim[68][l]*f[164][l]+0.3061862178478971*(alpha_vdim[13][l]*f[164][l]+alpha_vdim[129][l]*f[133][l])+(0.1956151991089878*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[132][l]+0.6123724356957944*alpha_cdim[3][l]*f[127][l]+0.273861278752583*alpha_vdim[32][l]*f[124][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[123][l]+0.1749635530559412*alpha_vdim[120][l]*f[120][l]+0.273861278752583*(alpha_vdim[38][l]*f[120][l]+f[38][l]*alpha_vdim[120][l]+alpha_vdim[25][l]*f[110][l])+0.3061862178478971*alpha_vdim[86][l]*f[90][l]+0.1956151991089878*alpha_vdim[16][l]*f[89][l]+0.3061862178478971*(alpha_vdim[0][l]*f[89][l]+alpha_vdim[68][l]*f[78][l])+0.273861278752583*alpha_vdim[12][l]*f[77][l]+0.6846531968814573*alpha_cdim[0][l]*f[66][l]+0.273861278752583*alpha_vdim[6][l]*f[65][l]+0.2449489742783178*alpha_vdim[60][l]*f[60][l]+0.1749635530559412*alpha_vdim[59][l]*f[59][l]+0.273861278752583*(alpha_vdim[10][l]*f[59][l]+f[10][l]*alpha_vdim[59][l])+0.3061862178478971*(alpha_vdim[43][l]*f[46][l]+alpha_vdim[31][l]*f[41][l])+(0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[40][l]+0.1749635530559412*alpha_vdim[37][l]*f[37][l]+0.273861278752583*(alpha_vdim[4][l]*f[37][l]+f[4][l]*alpha_vdim[37][l])+0.2449489742783178*alpha_vdim[22][l]*f[22][l]+0.3061862178478971*alpha_vdim[16][l]*f[19][l]+0.2449489742783178*alpha_vdim[9][l]*f[9][l];
+    out[126][l] += (0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[372][l]+(0.3912303982179757*f[202][l]+0.6123724356957944*f[121][l]+0.4374088826398531*f[120][l]+0.6846531968814573*f[37][l])*alpha_vdim[360][l]+(0.4374088826398531*f[152][l]+0.6846531968814573*f[61][l])*alpha_vdim[329][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[312][l]+0.6123724356957944*f[147][l]*alpha_vdim[311][l]+(0.3912303982179757*f[154][l]+0.6123724356957944*f[63][l]+0.4374088826398531*f[60][l]+0.6846531968814573*f[9][l])*alpha_vdim[300][l]+(0.5477225575051661*f[153][l]+0.6123724356957944*f[59][l])*alpha_vdim[299][l]+0.4374088826398531*f[107][l]*alpha_vdim[287][l]+0.6846531968814573*(f[30][l]*alpha_vdim[287][l]+f[192][l]*alpha_vdim[286][l])+(0.3912303982179757*f[122][l]+0.6123724356957944*f[39][l]+0.4374088826398531*f[38][l]+0.6846531968814573*f[4][l])*alpha_vdim[277][l]+(0.6123724356957944*f[202][l]+0.6846531968814573*f[120][l])*alpha_vdim[276][l]+(0.4374088826398531*f[98][l]+0.6846531968814573*f[23][l])*alpha_vdim[275][l]+0.6123724356957944*(f[97][l]*alpha_vdim[274][l]+f[96][l]*alpha_vdim[268][l])+(0.5477225575051661*f[99][l]+0.6123724356957944*f[22][l])*alpha_vdim[264][l]+0.4374088826398531*f[62][l]*alpha_vdim[260][l]+0.6846531968814573*(f[11][l]*alpha_vdim[260][l]+f[152][l]*alpha_vdim[259][l])+0.6123724356957944*f[55][l]*alpha_vdim[256][l]+0.6846531968814573*f[148][l]*alpha_vdim[255][l]+(0.5477225575051661*f[64][l]+0.6123724356957944*f[10][l])*alpha_vdim[251][l]+(0.6123724356957944*f[154][l]+0.6846531968814573*f[60][l])*alpha_vdim[250][l]+0.6123724356957944*f[51][l]*alpha_vdim[249][l]+0.6846531968814573*f[107][l]*alpha_vdim[248][l]+0.6123724356957944*f[24][l]*alpha_cdim[247][l]+(0.6123724356957944*f[122][l]+0.6846531968814573*f[38][l])*alpha_vdim[246][l]+0.6123724356957944*f[24][l]*alpha_vdim[245][l]+0.6846531968814573*(f[98][l]*alpha_vdim[244][l]+f[62][l]*alpha_vdim[243][l]+f[67][l]*alpha_cdim[243][l])+(0.1956151991089878*alpha_vdim[129][l]+0.3061862178478971*alpha_vdim[43][l])*f[207][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[183][l]+(0.1956151991089878*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[165][l]+0.273861278752583*alpha_vdim[68][l]*f[164][l]+0.1956151991089878*alpha_vdim[44][l]*f[133][l]+0.3061862178478971*(alpha_vdim[5][l]*f[133][l]+alpha_vdim[129][l]*f[132][l])+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[124][l]+0.273861278752583*alpha_vdim[31][l]*f[123][l]+0.1749635530559412*alpha_vdim[120][l]*f[120][l]+0.273861278752583*(alpha_vdim[37][l]*f[120][l]+f[37][l]*alpha_vdim[120][l]+alpha_vdim[25][l]*f[110][l])+0.1956151991089878*alpha_vdim[17][l]*f[90][l]+0.3061862178478971*(alpha_vdim[0][l]*f[90][l]+alpha_vdim[86][l]*f[89][l])+0.273861278752583*alpha_vdim[13][l]*f[78][l]+0.3061862178478971*alpha_vdim[69][l]*f[77][l]+0.273861278752583*alpha_vdim[6][l]*f[65][l]+0.1749635530559412*alpha_vdim[60][l]*f[60][l]+0.273861278752583*(alpha_vdim[9][l]*f[60][l]+f[9][l]*alpha_vdim[60][l])+0.2449489742783178*alpha_vdim[59][l]*f[59][l]+0.3061862178478971*alpha_vdim[44][l]*f[46][l]+0.273861278752583*alpha_vdim[2][l]*f[41][l]+0.3061862178478971*alpha_vdim[32][l]*f[40][l]+0.1749635530559412*alpha_vdim[38][l]*f[38][l]+0.273861278752583*(alpha_vdim[4][l]*f[38][l]+f[4][l]*alpha_vdim[38][l])+0.2449489742783178*alpha_vdim[22][l]*f[22][l]+0.3061862178478971*alpha_vdim[17][l]*f[19][l]+0.2449489742783178*alpha_vdim[10][l]*f[10][l];
+    out[127][l] += 0.6123724356957944*f[194][l]*alpha_vdim[372][l]+0.5477225575051661*f[98][l]*alpha_vdim[360][l]+0.6123724356957944*f[154][l]*alpha_vdim[329][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[312][l]+0.6123724356957944*f[149][l]*alpha_vdim[311][l]+(0.5477225575051661*f[152][l]+0.6123724356957944*f[62][l])*alpha_vdim[300][l]+0.5477225575051661*f[51][l]*alpha_vdim[299][l]+0.6846531968814573*f[194][l]*alpha_vdim[287][l]+0.6123724356957944*(f[108][l]*alpha_vdim[286][l]+f[98][l]*alpha_vdim[277][l])+0.5477225575051661*f[23][l]*alpha_vdim[276][l]+(0.6123724356957944*f[202][l]+0.6846531968814573*f[122][l])*alpha_vdim[275][l]+0.6123724356957944*f[99][l]*alpha_vdim[274][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[268][l]+(0.5477225575051661*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[264][l]+0.6846531968814573*f[154][l]*alpha_vdim[260][l]+0.6123724356957944*f[63][l]*alpha_vdim[259][l]+0.6846531968814573*f[149][l]*alpha_vdim[256][l]+(0.6123724356957944*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[255][l]+0.6123724356957944*f[51][l]*alpha_vdim[251][l]+0.5477225575051661*f[61][l]*alpha_vdim[250][l]+0.6123724356957944*(f[11][l]*alpha_vdim[250][l]+f[153][l]*alpha_vdim[249][l])+0.6846531968814573*(f[64][l]*alpha_vdim[249][l]+f[108][l]*alpha_vdim[248][l])+0.6123724356957944*f[23][l]*alpha_vdim[246][l]+0.6846531968814573*f[99][l]*alpha_vdim[245][l]+0.6123724356957944*f[121][l]*alpha_vdim[244][l]+0.6846531968814573*(f[39][l]*alpha_vdim[244][l]+f[63][l]*alpha_vdim[243][l])+0.6123724356957944*(alpha_vdim[69][l]*f[223][l]+alpha_vdim[32][l]*f[203][l])+(0.6123724356957944*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[44][l])*f[196][l]+0.6123724356957944*alpha_vdim[25][l]*f[195][l]+0.6846531968814573*alpha_vdim[69][l]*f[167][l]+0.6123724356957944*alpha_vdim[12][l]*f[166][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[156][l]+0.6123724356957944*alpha_vdim[6][l]*f[155][l]+0.5477225575051661*alpha_vdim[60][l]*f[152][l]+0.6123724356957944*alpha_vdim[68][l]*f[150][l]+0.6846531968814573*(alpha_vdim[13][l]*f[150][l]+alpha_vdim[32][l]*f[126][l])+0.6123724356957944*alpha_vdim[1][l]*f[125][l]+0.5477225575051661*f[98][l]*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[25][l]*f[112][l]+(0.6123724356957944*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[111][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[100][l]+0.6123724356957944*alpha_vdim[38][l]*f[98][l]+0.5477225575051661*alpha_vdim[22][l]*f[97][l]+0.3061862178478971*alpha_cdim[0][l]*f[91][l]+0.6846531968814573*(alpha_vdim[12][l]*f[79][l]+alpha_vdim[6][l]*f[67][l])+(0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[66][l]+0.6123724356957944*alpha_vdim[60][l]*f[62][l]+0.5477225575051661*alpha_vdim[9][l]*f[61][l]+f[51][l]*(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])+(0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[42][l]+0.5477225575051661*f[23][l]*alpha_vdim[37][l]+0.6123724356957944*(alpha_vdim[22][l]*f[24][l]+alpha_vdim[4][l]*f[23][l]+alpha_vdim[9][l]*f[11][l]);
+    out[128][l] += 0.6123724356957944*f[193][l]*alpha_vdim[372][l]+0.5477225575051661*f[97][l]*alpha_vdim[360][l]+0.6123724356957944*(f[153][l]*alpha_vdim[329][l]+f[149][l]*alpha_vdim[312][l])+(0.6123724356957944*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[311][l]+0.5477225575051661*(f[51][l]*alpha_vdim[300][l]+f[152][l]*alpha_vdim[299][l])+0.6123724356957944*(f[61][l]*alpha_vdim[299][l]+f[109][l]*alpha_vdim[287][l])+0.6846531968814573*f[193][l]*alpha_vdim[286][l]+0.5477225575051661*f[24][l]*alpha_vdim[277][l]+0.6123724356957944*(f[97][l]*alpha_vdim[276][l]+f[99][l]*alpha_vdim[275][l])+(0.6123724356957944*f[202][l]+0.6846531968814573*f[121][l])*alpha_vdim[274][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[268][l]+0.5477225575051661*f[98][l]*alpha_vdim[264][l]+0.6123724356957944*(f[23][l]*alpha_vdim[264][l]+f[64][l]*alpha_vdim[260][l])+0.6846531968814573*f[153][l]*alpha_vdim[259][l]+0.6123724356957944*f[163][l]*alpha_vdim[256][l]+0.6846531968814573*(f[76][l]*alpha_vdim[256][l]+f[149][l]*alpha_vdim[255][l])+0.5477225575051661*f[62][l]*alpha_vdim[251][l]+0.6123724356957944*(f[11][l]*alpha_vdim[251][l]+f[51][l]*alpha_vdim[250][l]+f[154][l]*alpha_vdim[249][l])+0.6846531968814573*(f[63][l]*alpha_vdim[249][l]+f[109][l]*alpha_vdim[248][l])+0.273861278752583*f[39][l]*alpha_cdim[247][l]+0.6123724356957944*(f[24][l]*alpha_vdim[246][l]+f[122][l]*alpha_vdim[245][l])+0.6846531968814573*(f[39][l]*alpha_vdim[245][l]+f[99][l]*alpha_vdim[244][l]+f[64][l]*alpha_vdim[243][l])+0.3061862178478971*f[91][l]*alpha_cdim[243][l]+0.6123724356957944*(alpha_vdim[68][l]*f[223][l]+alpha_vdim[31][l]*f[203][l]+alpha_vdim[25][l]*f[196][l])+(0.6123724356957944*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[43][l])*f[195][l]+0.6123724356957944*alpha_vdim[13][l]*f[167][l]+0.6846531968814573*alpha_vdim[68][l]*f[166][l]+0.6123724356957944*alpha_vdim[6][l]*f[156][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[155][l]+0.5477225575051661*alpha_vdim[59][l]*f[152][l]+(0.6123724356957944*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[150][l]+0.6123724356957944*alpha_vdim[2][l]*f[126][l]+0.6846531968814573*alpha_vdim[31][l]*f[125][l]+0.5477225575051661*f[97][l]*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[44][l]*f[112][l]+0.6846531968814573*(alpha_vdim[5][l]*f[112][l]+alpha_vdim[25][l]*f[111][l])+(0.6123724356957944*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[100][l]+0.5477225575051661*alpha_vdim[22][l]*f[98][l]+0.6123724356957944*alpha_vdim[37][l]*f[97][l]+0.6846531968814573*alpha_vdim[13][l]*f[79][l]+0.6123724356957944*alpha_vdim[17][l]*f[67][l]+0.6846531968814573*(alpha_vdim[0][l]*f[67][l]+alpha_vdim[6][l]*f[66][l])+0.5477225575051661*alpha_vdim[10][l]*f[62][l]+0.6123724356957944*alpha_vdim[59][l]*f[61][l]+f[51][l]*(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])+0.6846531968814573*alpha_vdim[2][l]*f[42][l]+0.5477225575051661*f[24][l]*alpha_vdim[38][l]+0.6123724356957944*(alpha_vdim[4][l]*f[24][l]+alpha_vdim[22][l]*f[23][l]+alpha_vdim[10][l]*f[11][l]);
+    out[129][l] += (0.1249739664685295*f[120][l]+0.1956151991089878*(f[38][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[606][l]+(0.1249739664685295*f[117][l]+0.1956151991089878*(f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[603][l]+(0.1249739664685295*f[86][l]+0.1956151991089878*(f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[572][l]+(0.1749635530559412*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[546][l]+(0.1749635530559412*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[545][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[543][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[542][l]+(0.1956151991089878*f[120][l]+0.3061862178478971*f[37][l])*alpha_vdim[524][l]+(0.1956151991089878*f[120][l]+0.3061862178478971*f[38][l])*alpha_vdim[523][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[520][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[519][l]+(0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[518][l]+(0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[517][l]+0.2449489742783178*(f[22][l]*alpha_vdim[508][l]+f[21][l]*alpha_vdim[507][l])+(0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[503][l]+(0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[502][l]+0.273861278752583*(f[59][l]*alpha_vdim[496][l]+f[60][l]*alpha_vdim[495][l]+f[56][l]*alpha_vdim[494][l]+f[57][l]*alpha_vdim[493][l])+0.2449489742783178*f[6][l]*alpha_vdim[492][l]+0.3061862178478971*(f[120][l]*alpha_vdim[490][l]+f[117][l]*alpha_vdim[489][l])+0.273861278752583*(f[31][l]*alpha_vdim[488][l]+f[32][l]*alpha_vdim[487][l])+0.3061862178478971*f[86][l]*alpha_vdim[486][l]+0.6846531968814573*(f[104][l]*alpha_cdim[247][l]+f[68][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[102][l]+alpha_cdim[0][l]*f[69][l]);
+    out[130][l] += (0.1956151991089878*f[202][l]+0.3061862178478971*f[122][l])*alpha_vdim[606][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[34][l])*alpha_vdim[603][l]+(0.1956151991089878*f[182][l]+0.3061862178478971*f[88][l])*alpha_vdim[572][l]+0.273861278752583*f[154][l]*alpha_vdim[546][l]+(0.1956151991089878*f[153][l]+0.3061862178478971*f[64][l])*alpha_vdim[545][l]+0.2449489742783178*f[57][l]*alpha_vdim[543][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[542][l]+0.3061862178478971*f[202][l]*alpha_vdim[524][l]+(0.1956151991089878*f[121][l]+0.3061862178478971*f[39][l])*alpha_vdim[523][l]+0.273861278752583*f[117][l]*alpha_vdim[520][l]+0.1749635530559412*f[33][l]*alpha_vdim[519][l]+0.273861278752583*(f[3][l]*alpha_vdim[519][l]+f[119][l]*alpha_vdim[518][l])+(0.1956151991089878*f[118][l]+0.3061862178478971*f[36][l])*alpha_vdim[517][l]+0.273861278752583*f[99][l]*alpha_vdim[508][l]+0.2449489742783178*f[21][l]*alpha_vdim[507][l]+0.3061862178478971*f[182][l]*alpha_vdim[503][l]+0.1956151991089878*f[87][l]*alpha_vdim[502][l]+0.3061862178478971*(f[18][l]*alpha_vdim[502][l]+f[153][l]*alpha_vdim[496][l])+0.273861278752583*(f[63][l]*alpha_vdim[495][l]+f[56][l]*alpha_vdim[494][l])+0.2449489742783178*f[7][l]*alpha_vdim[493][l]+0.273861278752583*f[58][l]*alpha_vdim[492][l]+0.3061862178478971*f[121][l]*alpha_vdim[490][l]+0.273861278752583*f[33][l]*alpha_vdim[489][l]+0.3061862178478971*f[118][l]*alpha_vdim[488][l]+0.273861278752583*f[35][l]*alpha_vdim[487][l]+0.3061862178478971*f[87][l]*alpha_vdim[486][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[210][l]+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[38][l])*f[192][l]+0.5477225575051661*alpha_vdim[69][l]*f[171][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[170][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[158][l]+0.6123724356957944*alpha_vdim[60][l]*f[148][l]+(0.4374088826398531*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[10][l])*f[147][l]+0.6123724356957944*alpha_vdim[129][l]*f[138][l]+(0.3912303982179757*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[137][l]+0.4374088826398531*f[117][l]*alpha_vdim[129][l]+0.6846531968814573*(f[34][l]*alpha_vdim[129][l]+f[107][l]*alpha_vdim[120][l]+alpha_vdim[44][l]*f[117][l])+0.5477225575051661*alpha_vdim[25][l]*f[113][l]+(0.4374088826398531*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[106][l]+0.6123724356957944*alpha_vdim[32][l]*f[102][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[101][l]+0.6123724356957944*alpha_vdim[22][l]*f[96][l]+0.6846531968814573*f[71][l]*alpha_vdim[86][l]+0.6123724356957944*alpha_vdim[68][l]*f[82][l]+0.5477225575051661*alpha_vdim[12][l]*f[81][l]+0.6846531968814573*alpha_cdim[0][l]*f[72][l]+(0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[70][l]+0.6123724356957944*f[57][l]*alpha_vdim[69][l]+0.4374088826398531*f[56][l]*alpha_vdim[68][l]+0.6846531968814573*(f[8][l]*alpha_vdim[68][l]+f[55][l]*alpha_vdim[59][l]+alpha_vdim[13][l]*f[56][l])+0.6123724356957944*(alpha_vdim[9][l]*f[54][l]+alpha_vdim[6][l]*f[52][l])+alpha_vdim[43][l]*(0.6123724356957944*f[49][l]+0.4374088826398531*f[33][l])+0.6846531968814573*(f[3][l]*alpha_vdim[43][l]+f[30][l]*alpha_vdim[37][l]+alpha_vdim[5][l]*f[33][l]+f[27][l]*alpha_vdim[31][l])+0.6123724356957944*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[26][l]+f[21][l]*alpha_vdim[25][l])+0.6846531968814573*f[14][l]*alpha_vdim[16][l]+0.6123724356957944*f[7][l]*alpha_vdim[12][l];
+    out[131][l] += (0.1956151991089878*f[202][l]+0.3061862178478971*f[121][l])*alpha_vdim[606][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[33][l])*alpha_vdim[603][l]+(0.1956151991089878*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[572][l]+(0.1956151991089878*f[154][l]+0.3061862178478971*f[63][l])*alpha_vdim[546][l]+0.273861278752583*f[153][l]*alpha_vdim[545][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[543][l]+0.2449489742783178*f[56][l]*alpha_vdim[542][l]+0.1956151991089878*f[122][l]*alpha_vdim[524][l]+0.3061862178478971*(f[39][l]*alpha_vdim[524][l]+f[202][l]*alpha_vdim[523][l])+0.1749635530559412*f[34][l]*alpha_vdim[520][l]+0.273861278752583*(f[3][l]*alpha_vdim[520][l]+f[117][l]*alpha_vdim[519][l])+(0.1956151991089878*f[119][l]+0.3061862178478971*f[35][l])*alpha_vdim[518][l]+0.273861278752583*(f[118][l]*alpha_vdim[517][l]+f[99][l]*alpha_vdim[508][l])+0.2449489742783178*f[21][l]*alpha_vdim[507][l]+0.1956151991089878*f[88][l]*alpha_vdim[503][l]+0.3061862178478971*(f[18][l]*alpha_vdim[503][l]+f[182][l]*alpha_vdim[502][l])+0.273861278752583*f[64][l]*alpha_vdim[496][l]+0.3061862178478971*f[154][l]*alpha_vdim[495][l]+0.2449489742783178*f[8][l]*alpha_vdim[494][l]+0.273861278752583*(f[57][l]*alpha_vdim[493][l]+f[58][l]*alpha_vdim[492][l])+0.3061862178478971*f[122][l]*alpha_vdim[490][l]+0.273861278752583*(f[34][l]*alpha_vdim[489][l]+f[36][l]*alpha_vdim[488][l])+0.3061862178478971*(f[119][l]*alpha_vdim[487][l]+f[88][l]*alpha_vdim[486][l])+0.6846531968814573*(f[109][l]*alpha_cdim[247][l]+f[73][l]*alpha_cdim[243][l])+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[43][l])*f[210][l]+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[37][l])*f[192][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[171][l]+0.5477225575051661*alpha_vdim[68][l]*f[170][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[158][l]+(0.4374088826398531*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[148][l]+0.6123724356957944*alpha_vdim[59][l]*f[147][l]+(0.3912303982179757*alpha_vdim[44][l]+0.6123724356957944*alpha_vdim[5][l])*f[138][l]+alpha_vdim[129][l]*(0.6123724356957944*f[137][l]+0.4374088826398531*f[117][l])+0.6846531968814573*(f[33][l]*alpha_vdim[129][l]+f[106][l]*alpha_vdim[120][l]+alpha_vdim[43][l]*f[117][l])+0.5477225575051661*alpha_vdim[25][l]*f[113][l]+(0.4374088826398531*alpha_vdim[38][l]+0.6846531968814573*alpha_vdim[4][l])*f[107][l]+(0.4374088826398531*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[102][l]+0.6123724356957944*(alpha_vdim[31][l]*f[101][l]+alpha_vdim[22][l]*f[96][l])+0.6846531968814573*f[70][l]*alpha_vdim[86][l]+0.5477225575051661*alpha_vdim[13][l]*f[82][l]+0.6123724356957944*alpha_vdim[69][l]*f[81][l]+(0.4374088826398531*alpha_vdim[17][l]+0.6846531968814573*alpha_vdim[0][l])*f[71][l]+(0.4374088826398531*f[57][l]+0.6846531968814573*f[7][l])*alpha_vdim[69][l]+0.6123724356957944*f[56][l]*alpha_vdim[68][l]+0.6846531968814573*(f[54][l]*alpha_vdim[60][l]+alpha_vdim[12][l]*f[57][l])+0.6123724356957944*(alpha_vdim[10][l]*f[55][l]+alpha_vdim[6][l]*f[52][l])+alpha_vdim[44][l]*(0.6123724356957944*f[49][l]+0.4374088826398531*f[34][l])+0.6846531968814573*(f[3][l]*alpha_vdim[44][l]+f[30][l]*alpha_vdim[38][l]+alpha_vdim[5][l]*f[34][l]+f[26][l]*alpha_vdim[32][l])+0.6123724356957944*(alpha_vdim[2][l]*f[27][l]+f[21][l]*alpha_vdim[25][l])+0.6846531968814573*f[14][l]*alpha_vdim[17][l]+0.6123724356957944*f[8][l]*alpha_vdim[13][l];
+    out[132][l] += (0.1749635530559412*f[120][l]+0.273861278752583*f[38][l])*alpha_vdim[606][l]+(0.1956151991089878*f[203][l]+0.3061862178478971*f[126][l])*alpha_vdim[603][l]+(0.1956151991089878*f[183][l]+0.3061862178478971*f[90][l])*alpha_vdim[572][l]+0.2449489742783178*f[60][l]*alpha_vdim[546][l]+0.1749635530559412*f[59][l]*alpha_vdim[545][l]+0.273861278752583*(f[10][l]*alpha_vdim[545][l]+f[156][l]*alpha_vdim[543][l])+(0.1956151991089878*f[155][l]+0.3061862178478971*f[67][l])*alpha_vdim[542][l]+0.273861278752583*f[120][l]*alpha_vdim[524][l]+(0.1749635530559412*f[37][l]+0.273861278752583*f[4][l])*alpha_vdim[523][l]+0.3061862178478971*f[203][l]*alpha_vdim[520][l]+(0.1956151991089878*f[125][l]+0.3061862178478971*f[42][l])*alpha_vdim[519][l]+0.273861278752583*f[124][l]*alpha_vdim[518][l]+(0.1956151991089878*f[123][l]+0.3061862178478971*f[41][l])*alpha_vdim[517][l]+0.2449489742783178*f[22][l]*alpha_vdim[508][l]+0.273861278752583*f[100][l]*alpha_vdim[507][l]+0.3061862178478971*f[183][l]*alpha_vdim[503][l]+(0.1956151991089878*f[89][l]+0.3061862178478971*f[19][l])*alpha_vdim[502][l]+0.273861278752583*f[59][l]*alpha_vdim[496][l]+0.2449489742783178*f[9][l]*alpha_vdim[495][l]+0.3061862178478971*f[155][l]*alpha_vdim[494][l]+0.273861278752583*(f[66][l]*alpha_vdim[493][l]+f[65][l]*alpha_vdim[492][l]+f[37][l]*alpha_vdim[490][l])+0.3061862178478971*(f[125][l]*alpha_vdim[489][l]+f[123][l]*alpha_vdim[488][l])+0.273861278752583*f[40][l]*alpha_vdim[487][l]+0.3061862178478971*f[89][l]*alpha_vdim[486][l]+(0.3912303982179757*f[213][l]+0.6123724356957944*f[142][l]+0.4374088826398531*f[120][l]+0.6846531968814573*f[38][l])*alpha_vdim[372][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[360][l]+(0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[329][l]+(0.5477225575051661*f[174][l]+0.6123724356957944*f[60][l])*alpha_vdim[312][l]+(0.3912303982179757*f[173][l]+0.6123724356957944*f[84][l]+0.4374088826398531*f[59][l]+0.6846531968814573*f[10][l])*alpha_vdim[311][l]+0.6123724356957944*f[148][l]*alpha_vdim[300][l]+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[299][l]+(0.6123724356957944*f[213][l]+0.6846531968814573*f[120][l])*alpha_vdim[287][l]+(0.3912303982179757*f[141][l]+0.6123724356957944*f[50][l]+0.4374088826398531*f[37][l])*alpha_vdim[286][l]+0.6846531968814573*(f[4][l]*alpha_vdim[286][l]+f[192][l]*alpha_vdim[277][l])+(0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[276][l]+0.6123724356957944*f[105][l]*alpha_vdim[275][l]+(0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[274][l]+0.5477225575051661*f[114][l]*alpha_vdim[268][l]+0.6123724356957944*(f[22][l]*alpha_vdim[268][l]+f[96][l]*alpha_vdim[264][l])+0.6846531968814573*f[161][l]*alpha_vdim[260][l]+(0.4374088826398531*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[259][l]+(0.6123724356957944*f[173][l]+0.6846531968814573*f[59][l])*alpha_vdim[256][l]+(0.5477225575051661*f[83][l]+0.6123724356957944*f[9][l])*alpha_vdim[255][l]+0.6846531968814573*f[147][l]*alpha_vdim[251][l]+0.6123724356957944*(f[54][l]*alpha_vdim[250][l]+f[53][l]*alpha_vdim[249][l]+f[141][l]*alpha_vdim[248][l])+0.6846531968814573*(f[37][l]*alpha_vdim[248][l]+f[106][l]*alpha_vdim[246][l]+f[104][l]*alpha_vdim[245][l])+0.6123724356957944*f[28][l]*alpha_vdim[244][l]+0.6846531968814573*(f[74][l]*alpha_vdim[243][l]+alpha_cdim[3][l]*f[111][l]+alpha_cdim[0][l]*f[77][l]);
+    out[133][l] += (0.1749635530559412*f[120][l]+0.273861278752583*f[37][l])*alpha_vdim[606][l]+(0.1956151991089878*f[203][l]+0.3061862178478971*f[125][l])*alpha_vdim[603][l]+(0.1956151991089878*f[183][l]+0.3061862178478971*f[89][l])*alpha_vdim[572][l]+(0.1749635530559412*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[546][l]+0.2449489742783178*f[59][l]*alpha_vdim[545][l]+(0.1956151991089878*f[156][l]+0.3061862178478971*f[66][l])*alpha_vdim[543][l]+0.273861278752583*f[155][l]*alpha_vdim[542][l]+0.1749635530559412*f[38][l]*alpha_vdim[524][l]+0.273861278752583*(f[4][l]*alpha_vdim[524][l]+f[120][l]*alpha_vdim[523][l])+0.1956151991089878*f[126][l]*alpha_vdim[520][l]+0.3061862178478971*(f[42][l]*alpha_vdim[520][l]+f[203][l]*alpha_vdim[519][l])+(0.1956151991089878*f[124][l]+0.3061862178478971*f[40][l])*alpha_vdim[518][l]+0.273861278752583*f[123][l]*alpha_vdim[517][l]+0.2449489742783178*f[22][l]*alpha_vdim[508][l]+0.273861278752583*f[100][l]*alpha_vdim[507][l]+0.1956151991089878*f[90][l]*alpha_vdim[503][l]+0.3061862178478971*(f[19][l]*alpha_vdim[503][l]+f[183][l]*alpha_vdim[502][l])+0.2449489742783178*f[10][l]*alpha_vdim[496][l]+0.273861278752583*(f[60][l]*alpha_vdim[495][l]+f[67][l]*alpha_vdim[494][l])+0.3061862178478971*f[156][l]*alpha_vdim[493][l]+0.273861278752583*(f[65][l]*alpha_vdim[492][l]+f[38][l]*alpha_vdim[490][l])+0.3061862178478971*f[126][l]*alpha_vdim[489][l]+0.273861278752583*f[41][l]*alpha_vdim[488][l]+0.3061862178478971*(f[124][l]*alpha_vdim[487][l]+f[90][l]*alpha_vdim[486][l])+(0.3912303982179757*f[213][l]+0.6123724356957944*f[141][l]+0.4374088826398531*f[120][l]+0.6846531968814573*f[37][l])*alpha_vdim[372][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[360][l]+(0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[329][l]+(0.3912303982179757*f[174][l]+0.6123724356957944*f[83][l]+0.4374088826398531*f[60][l]+0.6846531968814573*f[9][l])*alpha_vdim[312][l]+(0.5477225575051661*f[173][l]+0.6123724356957944*f[59][l])*alpha_vdim[311][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[300][l]+0.6123724356957944*f[147][l]*alpha_vdim[299][l]+(0.3912303982179757*f[142][l]+0.6123724356957944*f[50][l]+0.4374088826398531*f[38][l]+0.6846531968814573*f[4][l])*alpha_vdim[287][l]+(0.6123724356957944*f[213][l]+0.6846531968814573*f[120][l])*alpha_vdim[286][l]+0.4374088826398531*f[107][l]*alpha_vdim[277][l]+0.6846531968814573*(f[30][l]*alpha_vdim[277][l]+f[192][l]*alpha_vdim[276][l])+(0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[275][l]+0.6123724356957944*f[104][l]*alpha_vdim[274][l]+0.5477225575051661*f[114][l]*alpha_vdim[268][l]+0.6123724356957944*(f[22][l]*alpha_vdim[268][l]+f[96][l]*alpha_vdim[264][l])+0.4374088826398531*f[75][l]*alpha_vdim[260][l]+0.6846531968814573*(f[15][l]*alpha_vdim[260][l]+f[161][l]*alpha_vdim[259][l])+(0.5477225575051661*f[84][l]+0.6123724356957944*f[10][l])*alpha_vdim[256][l]+(0.6123724356957944*f[174][l]+0.6846531968814573*f[60][l])*alpha_vdim[255][l]+0.6123724356957944*f[55][l]*alpha_vdim[251][l]+0.6846531968814573*f[148][l]*alpha_vdim[250][l]+0.6123724356957944*f[53][l]*alpha_vdim[249][l]+(0.6123724356957944*f[142][l]+0.6846531968814573*f[38][l])*alpha_vdim[248][l]+0.6123724356957944*f[29][l]*alpha_cdim[247][l]+0.6846531968814573*f[107][l]*alpha_vdim[246][l]+0.6123724356957944*f[29][l]*alpha_vdim[245][l]+0.6846531968814573*(f[105][l]*alpha_vdim[244][l]+f[75][l]*alpha_vdim[243][l]+f[78][l]*alpha_cdim[243][l]);
+    out[134][l] += 0.273861278752583*(f[202][l]*alpha_vdim[606][l]+f[203][l]*alpha_vdim[603][l])+0.3061862178478971*f[232][l]*alpha_vdim[572][l]+0.273861278752583*(f[154][l]*alpha_vdim[546][l]+f[153][l]*alpha_vdim[545][l]+f[156][l]*alpha_vdim[543][l]+f[155][l]*alpha_vdim[542][l]+f[122][l]*alpha_vdim[524][l]+f[121][l]*alpha_vdim[523][l]+f[126][l]*alpha_vdim[520][l]+f[125][l]*alpha_vdim[519][l])+0.3061862178478971*(f[205][l]*alpha_vdim[518][l]+f[204][l]*alpha_vdim[517][l])+0.273861278752583*(f[99][l]*alpha_vdim[508][l]+f[100][l]*alpha_vdim[507][l])+0.3061862178478971*(f[185][l]*alpha_vdim[503][l]+f[184][l]*alpha_vdim[502][l])+0.273861278752583*(f[64][l]*alpha_vdim[496][l]+f[63][l]*alpha_vdim[495][l]+f[67][l]*alpha_vdim[494][l]+f[66][l]*alpha_vdim[493][l])+0.3061862178478971*f[157][l]*alpha_vdim[492][l]+0.273861278752583*(f[39][l]*alpha_vdim[490][l]+f[42][l]*alpha_vdim[489][l])+0.3061862178478971*(f[128][l]*alpha_vdim[488][l]+f[127][l]*alpha_vdim[487][l]+f[91][l]*alpha_vdim[486][l])+(0.6123724356957944*f[238][l]+0.6846531968814573*f[202][l])*alpha_vdim[372][l]+0.6123724356957944*f[192][l]*alpha_vdim[360][l]+0.6846531968814573*f[222][l]*alpha_vdim[329][l]+(0.6123724356957944*f[228][l]+0.6846531968814573*f[154][l])*alpha_vdim[312][l]+(0.6123724356957944*f[227][l]+0.6846531968814573*f[153][l])*alpha_vdim[311][l]+0.6123724356957944*(f[148][l]*alpha_vdim[300][l]+f[147][l]*alpha_vdim[299][l])+(0.6123724356957944*f[215][l]+0.6846531968814573*f[122][l])*alpha_vdim[287][l]+(0.6123724356957944*f[214][l]+0.6846531968814573*f[121][l])*alpha_vdim[286][l]+0.6123724356957944*(f[107][l]*alpha_vdim[277][l]+f[106][l]*alpha_vdim[276][l])+0.6846531968814573*(f[194][l]*alpha_vdim[275][l]+f[193][l]*alpha_vdim[274][l])+(0.6123724356957944*f[200][l]+0.6846531968814573*f[99][l])*alpha_vdim[268][l]+0.6123724356957944*f[96][l]*alpha_vdim[264][l]+0.6846531968814573*(f[163][l]*alpha_vdim[260][l]+f[162][l]*alpha_vdim[259][l])+(0.6123724356957944*f[178][l]+0.6846531968814573*f[64][l])*alpha_vdim[256][l]+(0.6123724356957944*f[177][l]+0.6846531968814573*f[63][l])*alpha_vdim[255][l]+0.6123724356957944*(f[55][l]*alpha_vdim[251][l]+f[54][l]*alpha_vdim[250][l])+0.6846531968814573*f[149][l]*alpha_vdim[249][l]+(0.6123724356957944*f[143][l]+0.6846531968814573*f[39][l])*alpha_vdim[248][l]+0.6123724356957944*f[30][l]*alpha_vdim[246][l]+0.6846531968814573*(f[109][l]*alpha_vdim[245][l]+f[108][l]*alpha_vdim[244][l]+f[76][l]*alpha_vdim[243][l])+0.6123724356957944*(alpha_vdim[129][l]*f[239][l]+alpha_vdim[69][l]*f[230][l]+alpha_vdim[68][l]*f[229][l])+0.6846531968814573*alpha_vdim[86][l]*f[223][l]+0.6123724356957944*(alpha_vdim[44][l]*f[219][l]+alpha_vdim[43][l]*f[218][l])+0.6846531968814573*alpha_vdim[129][l]*f[203][l]+0.6123724356957944*alpha_vdim[25][l]*f[201][l]+0.6846531968814573*(alpha_vdim[32][l]*f[196][l]+alpha_vdim[31][l]*f[195][l])+0.6123724356957944*(alpha_vdim[120][l]*f[192][l]+alpha_vdim[13][l]*f[181][l]+alpha_vdim[12][l]*f[180][l])+0.6846531968814573*(alpha_vdim[17][l]*f[167][l]+alpha_vdim[16][l]*f[166][l]+alpha_vdim[69][l]*f[156][l]+alpha_vdim[68][l]*f[155][l]+alpha_vdim[6][l]*f[150][l])+0.6123724356957944*(alpha_vdim[60][l]*f[148][l]+alpha_vdim[59][l]*f[147][l]+alpha_vdim[5][l]*f[146][l])+0.6846531968814573*(alpha_vdim[44][l]*f[126][l]+alpha_vdim[43][l]*f[125][l]+alpha_vdim[2][l]*f[112][l]+alpha_vdim[1][l]*f[111][l])+0.6123724356957944*(alpha_vdim[38][l]*f[107][l]+alpha_vdim[37][l]*f[106][l])+0.6846531968814573*alpha_vdim[25][l]*f[100][l]+0.6123724356957944*alpha_vdim[22][l]*f[96][l]+0.6846531968814573*(alpha_vdim[0][l]*f[79][l]+alpha_vdim[13][l]*f[67][l]+alpha_vdim[12][l]*f[66][l])+0.6123724356957944*(alpha_vdim[10][l]*f[55][l]+alpha_vdim[9][l]*f[54][l])+0.6846531968814573*alpha_vdim[5][l]*f[42][l]+0.6123724356957944*alpha_vdim[4][l]*f[30][l];
+    out[135][l] += (0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[606][l]+(0.3912303982179757*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[603][l]+(0.3912303982179757*f[68][l]+0.6123724356957944*f[13][l])*alpha_vdim[572][l]+0.5477225575051661*f[53][l]*alpha_vdim[546][l]+(0.3912303982179757*f[161][l]+0.6123724356957944*f[75][l]+0.4374088826398531*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[545][l]+0.5477225575051661*f[52][l]*alpha_vdim[543][l]+(0.3912303982179757*f[158][l]+0.6123724356957944*f[71][l]+0.4374088826398531*f[70][l]+0.6846531968814573*f[14][l])*alpha_vdim[542][l]+0.6123724356957944*f[104][l]*alpha_vdim[524][l]+(0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[523][l]+0.6123724356957944*f[101][l]*alpha_vdim[520][l]+(0.4374088826398531*f[101][l]+0.6846531968814573*f[27][l])*alpha_vdim[519][l]+0.5477225575051661*f[25][l]*alpha_vdim[518][l]+(0.3912303982179757*f[129][l]+0.6123724356957944*f[44][l]+0.4374088826398531*f[43][l]+0.6846531968814573*f[5][l])*alpha_vdim[517][l]+(0.5477225575051661*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[508][l]+0.5477225575051661*f[102][l]*alpha_vdim[507][l]+0.6123724356957944*(f[26][l]*alpha_vdim[507][l]+f[68][l]*alpha_vdim[503][l])+(0.4374088826398531*f[68][l]+0.6846531968814573*f[13][l])*alpha_vdim[502][l]+(0.6123724356957944*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[496][l]+0.6123724356957944*f[53][l]*alpha_vdim[495][l]+(0.6123724356957944*f[158][l]+0.6846531968814573*f[70][l])*alpha_vdim[494][l]+0.6123724356957944*f[52][l]*alpha_vdim[493][l]+(0.5477225575051661*f[69][l]+0.6123724356957944*f[12][l])*alpha_vdim[492][l]+0.6846531968814573*(f[104][l]*alpha_vdim[490][l]+f[101][l]*alpha_vdim[489][l])+(0.6123724356957944*f[129][l]+0.6846531968814573*f[43][l])*alpha_vdim[488][l]+0.6123724356957944*f[25][l]*alpha_vdim[487][l]+0.6846531968814573*f[68][l]*alpha_vdim[486][l]+0.3061862178478971*(f[141][l]*alpha_cdim[247][l]+f[92][l]*alpha_cdim[243][l])+0.6846531968814573*(alpha_cdim[3][l]*f[113][l]+alpha_cdim[0][l]*f[80][l]);
+    out[136][l] += (0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[606][l]+(0.3912303982179757*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[603][l]+(0.3912303982179757*f[69][l]+0.6123724356957944*f[12][l])*alpha_vdim[572][l]+(0.3912303982179757*f[161][l]+0.4374088826398531*f[75][l]+0.6123724356957944*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[546][l]+0.5477225575051661*f[53][l]*alpha_vdim[545][l]+(0.3912303982179757*f[158][l]+0.4374088826398531*f[71][l]+0.6123724356957944*f[70][l]+0.6846531968814573*f[14][l])*alpha_vdim[543][l]+0.5477225575051661*f[52][l]*alpha_vdim[542][l]+(0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[524][l]+0.6123724356957944*f[105][l]*alpha_vdim[523][l]+(0.4374088826398531*f[102][l]+0.6846531968814573*f[26][l])*alpha_vdim[520][l]+0.6123724356957944*f[102][l]*alpha_vdim[519][l]+(0.3912303982179757*f[129][l]+0.4374088826398531*f[44][l]+0.6123724356957944*f[43][l]+0.6846531968814573*f[5][l])*alpha_vdim[518][l]+0.5477225575051661*f[25][l]*alpha_vdim[517][l]+(0.5477225575051661*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[508][l]+(0.5477225575051661*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[507][l]+(0.4374088826398531*f[69][l]+0.6846531968814573*f[12][l])*alpha_vdim[503][l]+0.6123724356957944*(f[69][l]*alpha_vdim[502][l]+f[53][l]*alpha_vdim[496][l])+(0.6123724356957944*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[495][l]+0.6123724356957944*f[52][l]*alpha_vdim[494][l]+(0.6123724356957944*f[158][l]+0.6846531968814573*f[71][l])*alpha_vdim[493][l]+(0.5477225575051661*f[68][l]+0.6123724356957944*f[13][l])*alpha_vdim[492][l]+0.6846531968814573*(f[105][l]*alpha_vdim[490][l]+f[102][l]*alpha_vdim[489][l])+0.6123724356957944*(f[25][l]*alpha_vdim[488][l]+f[129][l]*alpha_vdim[487][l])+0.6846531968814573*(f[44][l]*alpha_vdim[487][l]+f[69][l]*alpha_vdim[486][l]+f[114][l]*alpha_cdim[247][l]+f[80][l]*alpha_cdim[243][l])+0.3061862178478971*(alpha_cdim[3][l]*f[138][l]+alpha_cdim[0][l]*f[93][l]);
+    out[137][l] += (0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[606][l]+(0.3912303982179757*f[206][l]+0.6123724356957944*f[131][l]+0.4374088826398531*f[129][l]+0.6846531968814573*f[44][l])*alpha_vdim[603][l]+(0.4374088826398531*f[158][l]+0.6846531968814573*f[71][l])*alpha_vdim[572][l]+0.6123724356957944*f[148][l]*alpha_vdim[546][l]+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[545][l]+(0.5477225575051661*f[160][l]+0.6123724356957944*f[69][l])*alpha_vdim[543][l]+(0.3912303982179757*f[159][l]+0.6123724356957944*f[73][l]+0.4374088826398531*f[68][l])*alpha_vdim[542][l]+0.6846531968814573*(f[13][l]*alpha_vdim[542][l]+f[192][l]*alpha_vdim[524][l])+(0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[523][l]+(0.6123724356957944*f[206][l]+0.6846531968814573*f[129][l])*alpha_vdim[520][l]+(0.3912303982179757*f[130][l]+0.6123724356957944*f[45][l]+0.4374088826398531*f[43][l]+0.6846531968814573*f[5][l])*alpha_vdim[519][l]+0.6123724356957944*f[102][l]*alpha_vdim[518][l]+(0.4374088826398531*f[101][l]+0.6846531968814573*f[27][l])*alpha_vdim[517][l]+0.6123724356957944*f[96][l]*alpha_vdim[508][l]+(0.5477225575051661*f[103][l]+0.6123724356957944*f[25][l])*alpha_vdim[507][l]+0.6846531968814573*f[158][l]*alpha_vdim[503][l]+0.4374088826398531*f[70][l]*alpha_vdim[502][l]+0.6846531968814573*(f[14][l]*alpha_vdim[502][l]+f[147][l]*alpha_vdim[496][l])+0.6123724356957944*f[54][l]*alpha_vdim[495][l]+(0.6123724356957944*f[159][l]+0.6846531968814573*f[68][l])*alpha_vdim[494][l]+0.5477225575051661*f[72][l]*alpha_vdim[493][l]+0.6123724356957944*(f[12][l]*alpha_vdim[493][l]+f[52][l]*alpha_vdim[492][l])+0.6846531968814573*f[106][l]*alpha_vdim[490][l]+0.6123724356957944*f[130][l]*alpha_vdim[489][l]+0.6846531968814573*(f[43][l]*alpha_vdim[489][l]+f[101][l]*alpha_vdim[488][l])+0.6123724356957944*f[26][l]*alpha_vdim[487][l]+0.6846531968814573*f[70][l]*alpha_vdim[486][l]+(0.1956151991089878*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[38][l])*f[213][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[186][l]+0.273861278752583*alpha_vdim[60][l]*f[174][l]+0.1956151991089878*alpha_vdim[59][l]*f[173][l]+0.3061862178478971*(alpha_vdim[10][l]*f[173][l]+alpha_vdim[120][l]*f[142][l])+(0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[141][l]+0.6123724356957944*alpha_cdim[3][l]*f[139][l]+0.273861278752583*alpha_vdim[32][l]*f[136][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[135][l]+0.1749635530559412*alpha_vdim[129][l]*f[129][l]+0.273861278752583*(alpha_vdim[44][l]*f[129][l]+f[44][l]*alpha_vdim[129][l]+alpha_vdim[22][l]*f[114][l])+0.3061862178478971*alpha_vdim[86][l]*f[93][l]+0.1956151991089878*alpha_vdim[16][l]*f[92][l]+0.3061862178478971*(alpha_vdim[0][l]*f[92][l]+alpha_vdim[59][l]*f[84][l])+0.273861278752583*alpha_vdim[9][l]*f[83][l]+0.6846531968814573*alpha_cdim[0][l]*f[81][l]+0.273861278752583*alpha_vdim[6][l]*f[80][l]+0.2449489742783178*alpha_vdim[69][l]*f[69][l]+0.1749635530559412*alpha_vdim[68][l]*f[68][l]+0.273861278752583*(alpha_vdim[13][l]*f[68][l]+f[13][l]*alpha_vdim[68][l])+0.3061862178478971*(alpha_vdim[37][l]*f[50][l]+alpha_vdim[31][l]*f[48][l])+(0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[47][l]+0.1749635530559412*alpha_vdim[43][l]*f[43][l]+0.273861278752583*(alpha_vdim[5][l]*f[43][l]+f[5][l]*alpha_vdim[43][l])+0.2449489742783178*alpha_vdim[25][l]*f[25][l]+0.3061862178478971*alpha_vdim[16][l]*f[20][l]+0.2449489742783178*alpha_vdim[12][l]*f[12][l];
+    out[138][l] += (0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[606][l]+(0.3912303982179757*f[206][l]+0.6123724356957944*f[130][l]+0.4374088826398531*f[129][l]+0.6846531968814573*f[43][l])*alpha_vdim[603][l]+(0.4374088826398531*f[158][l]+0.6846531968814573*f[70][l])*alpha_vdim[572][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[546][l]+0.6123724356957944*f[147][l]*alpha_vdim[545][l]+(0.3912303982179757*f[160][l]+0.6123724356957944*f[72][l]+0.4374088826398531*f[69][l]+0.6846531968814573*f[12][l])*alpha_vdim[543][l]+(0.5477225575051661*f[159][l]+0.6123724356957944*f[68][l])*alpha_vdim[542][l]+0.4374088826398531*f[107][l]*alpha_vdim[524][l]+0.6846531968814573*(f[30][l]*alpha_vdim[524][l]+f[192][l]*alpha_vdim[523][l])+(0.3912303982179757*f[131][l]+0.6123724356957944*f[45][l]+0.4374088826398531*f[44][l]+0.6846531968814573*f[5][l])*alpha_vdim[520][l]+(0.6123724356957944*f[206][l]+0.6846531968814573*f[129][l])*alpha_vdim[519][l]+(0.4374088826398531*f[102][l]+0.6846531968814573*f[26][l])*alpha_vdim[518][l]+0.6123724356957944*(f[101][l]*alpha_vdim[517][l]+f[96][l]*alpha_vdim[508][l])+(0.5477225575051661*f[103][l]+0.6123724356957944*f[25][l])*alpha_vdim[507][l]+0.4374088826398531*f[71][l]*alpha_vdim[503][l]+0.6846531968814573*(f[14][l]*alpha_vdim[503][l]+f[158][l]*alpha_vdim[502][l])+0.6123724356957944*f[55][l]*alpha_vdim[496][l]+0.6846531968814573*f[148][l]*alpha_vdim[495][l]+(0.5477225575051661*f[73][l]+0.6123724356957944*f[13][l])*alpha_vdim[494][l]+(0.6123724356957944*f[160][l]+0.6846531968814573*f[69][l])*alpha_vdim[493][l]+0.6123724356957944*f[52][l]*alpha_vdim[492][l]+0.6846531968814573*f[107][l]*alpha_vdim[490][l]+(0.6123724356957944*f[131][l]+0.6846531968814573*f[44][l])*alpha_vdim[489][l]+0.6123724356957944*f[27][l]*alpha_vdim[488][l]+0.6846531968814573*(f[102][l]*alpha_vdim[487][l]+f[71][l]*alpha_vdim[486][l]+f[116][l]*alpha_cdim[247][l]+f[82][l]*alpha_cdim[243][l])+(0.1956151991089878*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[37][l])*f[213][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[186][l]+(0.1956151991089878*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[174][l]+0.273861278752583*alpha_vdim[59][l]*f[173][l]+0.1956151991089878*alpha_vdim[38][l]*f[142][l]+0.3061862178478971*(alpha_vdim[4][l]*f[142][l]+alpha_vdim[120][l]*f[141][l])+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[136][l]+0.273861278752583*alpha_vdim[31][l]*f[135][l]+0.1749635530559412*alpha_vdim[129][l]*f[129][l]+0.273861278752583*(alpha_vdim[43][l]*f[129][l]+f[43][l]*alpha_vdim[129][l]+alpha_vdim[22][l]*f[114][l])+0.1956151991089878*alpha_vdim[17][l]*f[93][l]+0.3061862178478971*(alpha_vdim[0][l]*f[93][l]+alpha_vdim[86][l]*f[92][l])+0.273861278752583*alpha_vdim[10][l]*f[84][l]+0.3061862178478971*alpha_vdim[60][l]*f[83][l]+0.273861278752583*alpha_vdim[6][l]*f[80][l]+0.1749635530559412*alpha_vdim[69][l]*f[69][l]+0.273861278752583*(alpha_vdim[12][l]*f[69][l]+f[12][l]*alpha_vdim[69][l])+0.2449489742783178*alpha_vdim[68][l]*f[68][l]+0.3061862178478971*alpha_vdim[38][l]*f[50][l]+0.273861278752583*alpha_vdim[2][l]*f[48][l]+0.3061862178478971*alpha_vdim[32][l]*f[47][l]+0.1749635530559412*alpha_vdim[44][l]*f[44][l]+0.273861278752583*(alpha_vdim[5][l]*f[44][l]+f[5][l]*alpha_vdim[44][l])+0.2449489742783178*alpha_vdim[25][l]*f[25][l]+0.3061862178478971*alpha_vdim[17][l]*f[20][l]+0.2449489742783178*alpha_vdim[13][l]*f[13][l];
+    out[139][l] += 0.6123724356957944*f[194][l]*alpha_vdim[606][l]+0.5477225575051661*f[102][l]*alpha_vdim[603][l]+0.6123724356957944*f[160][l]*alpha_vdim[572][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[546][l]+0.6123724356957944*f[149][l]*alpha_vdim[545][l]+(0.5477225575051661*f[158][l]+0.6123724356957944*f[71][l])*alpha_vdim[543][l]+0.5477225575051661*f[52][l]*alpha_vdim[542][l]+0.6846531968814573*f[194][l]*alpha_vdim[524][l]+0.6123724356957944*(f[108][l]*alpha_vdim[523][l]+f[102][l]*alpha_vdim[520][l])+0.5477225575051661*f[26][l]*alpha_vdim[519][l]+(0.6123724356957944*f[206][l]+0.6846531968814573*f[131][l])*alpha_vdim[518][l]+0.6123724356957944*f[103][l]*alpha_vdim[517][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[508][l]+(0.5477225575051661*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[507][l]+0.6846531968814573*f[160][l]*alpha_vdim[503][l]+0.6123724356957944*f[72][l]*alpha_vdim[502][l]+0.6846531968814573*f[149][l]*alpha_vdim[496][l]+(0.6123724356957944*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[495][l]+0.6123724356957944*f[52][l]*alpha_vdim[494][l]+0.5477225575051661*f[70][l]*alpha_vdim[493][l]+0.6123724356957944*(f[14][l]*alpha_vdim[493][l]+f[159][l]*alpha_vdim[492][l])+0.6846531968814573*(f[73][l]*alpha_vdim[492][l]+f[108][l]*alpha_vdim[490][l])+0.6123724356957944*f[26][l]*alpha_vdim[489][l]+0.6846531968814573*f[103][l]*alpha_vdim[488][l]+0.6123724356957944*f[130][l]*alpha_vdim[487][l]+0.6846531968814573*(f[45][l]*alpha_vdim[487][l]+f[72][l]*alpha_vdim[486][l])+0.6123724356957944*(alpha_vdim[60][l]*f[226][l]+alpha_vdim[32][l]*f[210][l])+(0.6123724356957944*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[38][l])*f[199][l]+0.6123724356957944*alpha_vdim[22][l]*f[198][l]+0.6846531968814573*alpha_vdim[60][l]*f[176][l]+0.6123724356957944*alpha_vdim[9][l]*f[175][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[171][l]+0.6123724356957944*alpha_vdim[6][l]*f[170][l]+0.5477225575051661*alpha_vdim[69][l]*f[158][l]+0.6123724356957944*alpha_vdim[59][l]*f[151][l]+0.6846531968814573*(alpha_vdim[10][l]*f[151][l]+alpha_vdim[32][l]*f[138][l])+0.6123724356957944*alpha_vdim[1][l]*f[137][l]+0.5477225575051661*f[102][l]*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[22][l]*f[116][l]+(0.6123724356957944*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[115][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[113][l]+0.6123724356957944*alpha_vdim[44][l]*f[102][l]+0.5477225575051661*alpha_vdim[25][l]*f[101][l]+0.3061862178478971*alpha_cdim[0][l]*f[94][l]+0.6846531968814573*(alpha_vdim[9][l]*f[85][l]+alpha_vdim[6][l]*f[82][l])+(0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[81][l]+0.6123724356957944*alpha_vdim[69][l]*f[71][l]+0.5477225575051661*alpha_vdim[12][l]*f[70][l]+f[52][l]*(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])+(0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[49][l]+0.5477225575051661*f[26][l]*alpha_vdim[43][l]+0.6123724356957944*(alpha_vdim[25][l]*f[27][l]+alpha_vdim[5][l]*f[26][l]+alpha_vdim[12][l]*f[14][l]);
+    out[140][l] += 0.6123724356957944*f[193][l]*alpha_vdim[606][l]+0.5477225575051661*f[101][l]*alpha_vdim[603][l]+0.6123724356957944*(f[159][l]*alpha_vdim[572][l]+f[149][l]*alpha_vdim[546][l])+(0.6123724356957944*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[545][l]+0.5477225575051661*(f[52][l]*alpha_vdim[543][l]+f[158][l]*alpha_vdim[542][l])+0.6123724356957944*(f[70][l]*alpha_vdim[542][l]+f[109][l]*alpha_vdim[524][l])+0.6846531968814573*f[193][l]*alpha_vdim[523][l]+0.5477225575051661*f[27][l]*alpha_vdim[520][l]+0.6123724356957944*(f[101][l]*alpha_vdim[519][l]+f[103][l]*alpha_vdim[518][l])+(0.6123724356957944*f[206][l]+0.6846531968814573*f[130][l])*alpha_vdim[517][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[508][l]+0.5477225575051661*f[102][l]*alpha_vdim[507][l]+0.6123724356957944*(f[26][l]*alpha_vdim[507][l]+f[73][l]*alpha_vdim[503][l])+0.6846531968814573*f[159][l]*alpha_vdim[502][l]+0.6123724356957944*f[163][l]*alpha_vdim[496][l]+0.6846531968814573*(f[76][l]*alpha_vdim[496][l]+f[149][l]*alpha_vdim[495][l])+0.5477225575051661*f[71][l]*alpha_vdim[494][l]+0.6123724356957944*(f[14][l]*alpha_vdim[494][l]+f[52][l]*alpha_vdim[493][l]+f[160][l]*alpha_vdim[492][l])+0.6846531968814573*(f[72][l]*alpha_vdim[492][l]+f[109][l]*alpha_vdim[490][l])+0.6123724356957944*(f[27][l]*alpha_vdim[489][l]+f[131][l]*alpha_vdim[488][l])+0.6846531968814573*(f[45][l]*alpha_vdim[488][l]+f[103][l]*alpha_vdim[487][l]+f[73][l]*alpha_vdim[486][l])+0.3061862178478971*(f[143][l]*alpha_cdim[247][l]+f[94][l]*alpha_cdim[243][l])+0.6123724356957944*(alpha_vdim[59][l]*f[226][l]+alpha_vdim[31][l]*f[210][l]+alpha_vdim[22][l]*f[199][l])+(0.6123724356957944*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[37][l])*f[198][l]+0.6123724356957944*alpha_vdim[10][l]*f[176][l]+0.6846531968814573*alpha_vdim[59][l]*f[175][l]+0.6123724356957944*alpha_vdim[6][l]*f[171][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[170][l]+0.5477225575051661*alpha_vdim[68][l]*f[158][l]+(0.6123724356957944*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[151][l]+0.6123724356957944*alpha_vdim[2][l]*f[138][l]+0.6846531968814573*alpha_vdim[31][l]*f[137][l]+0.5477225575051661*f[101][l]*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[38][l]*f[116][l]+0.6846531968814573*(alpha_vdim[4][l]*f[116][l]+alpha_vdim[22][l]*f[115][l])+(0.6123724356957944*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[113][l]+0.5477225575051661*alpha_vdim[25][l]*f[102][l]+0.6123724356957944*alpha_vdim[43][l]*f[101][l]+0.6846531968814573*alpha_vdim[10][l]*f[85][l]+0.6123724356957944*alpha_vdim[17][l]*f[82][l]+0.6846531968814573*(alpha_vdim[0][l]*f[82][l]+alpha_vdim[6][l]*f[81][l])+0.5477225575051661*alpha_vdim[13][l]*f[71][l]+0.6123724356957944*alpha_vdim[68][l]*f[70][l]+f[52][l]*(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])+0.6846531968814573*alpha_vdim[2][l]*f[49][l]+0.5477225575051661*f[27][l]*alpha_vdim[44][l]+0.6123724356957944*(alpha_vdim[5][l]*f[27][l]+alpha_vdim[25][l]*f[26][l]+alpha_vdim[13][l]*f[14][l]);
+    out[141][l] += (0.3912303982179757*f[207][l]+0.6123724356957944*f[133][l]+0.4374088826398531*f[129][l]+0.6846531968814573*f[44][l])*alpha_vdim[606][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[603][l]+(0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[572][l]+(0.5477225575051661*f[165][l]+0.6123724356957944*f[69][l])*alpha_vdim[546][l]+(0.3912303982179757*f[164][l]+0.6123724356957944*f[78][l]+0.4374088826398531*f[68][l]+0.6846531968814573*f[13][l])*alpha_vdim[545][l]+0.6123724356957944*f[148][l]*alpha_vdim[543][l]+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[542][l]+(0.6123724356957944*f[207][l]+0.6846531968814573*f[129][l])*alpha_vdim[524][l]+(0.3912303982179757*f[132][l]+0.6123724356957944*f[46][l]+0.4374088826398531*f[43][l])*alpha_vdim[523][l]+0.6846531968814573*(f[5][l]*alpha_vdim[523][l]+f[192][l]*alpha_vdim[520][l])+(0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[519][l]+0.6123724356957944*f[105][l]*alpha_vdim[518][l]+(0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[517][l]+0.5477225575051661*f[110][l]*alpha_vdim[508][l]+0.6123724356957944*(f[25][l]*alpha_vdim[508][l]+f[96][l]*alpha_vdim[507][l])+0.6846531968814573*f[161][l]*alpha_vdim[503][l]+(0.4374088826398531*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[502][l]+(0.6123724356957944*f[164][l]+0.6846531968814573*f[68][l])*alpha_vdim[496][l]+(0.5477225575051661*f[77][l]+0.6123724356957944*f[12][l])*alpha_vdim[495][l]+0.6846531968814573*f[147][l]*alpha_vdim[494][l]+0.6123724356957944*(f[54][l]*alpha_vdim[493][l]+f[53][l]*alpha_vdim[492][l]+f[132][l]*alpha_vdim[490][l])+0.6846531968814573*(f[43][l]*alpha_vdim[490][l]+f[106][l]*alpha_vdim[489][l]+f[104][l]*alpha_vdim[488][l])+0.6123724356957944*f[28][l]*alpha_vdim[487][l]+0.6846531968814573*f[74][l]*alpha_vdim[486][l]+(0.1749635530559412*f[129][l]+0.273861278752583*f[44][l])*alpha_vdim[372][l]+(0.1956151991089878*f[210][l]+0.3061862178478971*f[138][l])*alpha_vdim[360][l]+(0.1956151991089878*f[186][l]+0.3061862178478971*f[93][l])*alpha_vdim[329][l]+0.2449489742783178*f[69][l]*alpha_vdim[312][l]+0.1749635530559412*f[68][l]*alpha_vdim[311][l]+0.273861278752583*(f[13][l]*alpha_vdim[311][l]+f[171][l]*alpha_vdim[300][l])+(0.1956151991089878*f[170][l]+0.3061862178478971*f[82][l])*alpha_vdim[299][l]+0.273861278752583*f[129][l]*alpha_vdim[287][l]+(0.1749635530559412*f[43][l]+0.273861278752583*f[5][l])*alpha_vdim[286][l]+0.3061862178478971*f[210][l]*alpha_vdim[277][l]+(0.1956151991089878*f[137][l]+0.3061862178478971*f[49][l])*alpha_vdim[276][l]+0.273861278752583*f[136][l]*alpha_vdim[275][l]+(0.1956151991089878*f[135][l]+0.3061862178478971*f[48][l])*alpha_vdim[274][l]+0.2449489742783178*f[25][l]*alpha_vdim[268][l]+0.273861278752583*f[113][l]*alpha_vdim[264][l]+0.3061862178478971*f[186][l]*alpha_vdim[260][l]+(0.1956151991089878*f[92][l]+0.3061862178478971*f[20][l])*alpha_vdim[259][l]+0.273861278752583*f[68][l]*alpha_vdim[256][l]+0.2449489742783178*f[12][l]*alpha_vdim[255][l]+0.3061862178478971*f[170][l]*alpha_vdim[251][l]+0.273861278752583*(f[81][l]*alpha_vdim[250][l]+f[80][l]*alpha_vdim[249][l]+f[43][l]*alpha_vdim[248][l])+0.3061862178478971*(f[137][l]*alpha_vdim[246][l]+f[135][l]*alpha_vdim[245][l])+0.273861278752583*f[47][l]*alpha_vdim[244][l]+0.3061862178478971*f[92][l]*alpha_vdim[243][l]+0.6846531968814573*(alpha_cdim[3][l]*f[115][l]+alpha_cdim[0][l]*f[83][l]);
+    out[142][l] += (0.3912303982179757*f[207][l]+0.6123724356957944*f[132][l]+0.4374088826398531*f[129][l]+0.6846531968814573*f[43][l])*alpha_vdim[606][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[603][l]+(0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[572][l]+(0.3912303982179757*f[165][l]+0.6123724356957944*f[77][l]+0.4374088826398531*f[69][l]+0.6846531968814573*f[12][l])*alpha_vdim[546][l]+(0.5477225575051661*f[164][l]+0.6123724356957944*f[68][l])*alpha_vdim[545][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[543][l]+0.6123724356957944*f[147][l]*alpha_vdim[542][l]+(0.3912303982179757*f[133][l]+0.6123724356957944*f[46][l]+0.4374088826398531*f[44][l]+0.6846531968814573*f[5][l])*alpha_vdim[524][l]+(0.6123724356957944*f[207][l]+0.6846531968814573*f[129][l])*alpha_vdim[523][l]+0.4374088826398531*f[107][l]*alpha_vdim[520][l]+0.6846531968814573*(f[30][l]*alpha_vdim[520][l]+f[192][l]*alpha_vdim[519][l])+(0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[518][l]+0.6123724356957944*f[104][l]*alpha_vdim[517][l]+0.5477225575051661*f[110][l]*alpha_vdim[508][l]+0.6123724356957944*(f[25][l]*alpha_vdim[508][l]+f[96][l]*alpha_vdim[507][l])+0.4374088826398531*f[75][l]*alpha_vdim[503][l]+0.6846531968814573*(f[15][l]*alpha_vdim[503][l]+f[161][l]*alpha_vdim[502][l])+(0.5477225575051661*f[78][l]+0.6123724356957944*f[13][l])*alpha_vdim[496][l]+(0.6123724356957944*f[165][l]+0.6846531968814573*f[69][l])*alpha_vdim[495][l]+0.6123724356957944*f[55][l]*alpha_vdim[494][l]+0.6846531968814573*f[148][l]*alpha_vdim[493][l]+0.6123724356957944*(f[53][l]*alpha_vdim[492][l]+f[133][l]*alpha_vdim[490][l])+0.6846531968814573*(f[44][l]*alpha_vdim[490][l]+f[107][l]*alpha_vdim[489][l])+0.6123724356957944*f[29][l]*alpha_vdim[488][l]+0.6846531968814573*(f[105][l]*alpha_vdim[487][l]+f[75][l]*alpha_vdim[486][l])+(0.1749635530559412*f[129][l]+0.273861278752583*f[43][l])*alpha_vdim[372][l]+(0.1956151991089878*f[210][l]+0.3061862178478971*f[137][l])*alpha_vdim[360][l]+(0.1956151991089878*f[186][l]+0.3061862178478971*f[92][l])*alpha_vdim[329][l]+(0.1749635530559412*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[312][l]+0.2449489742783178*f[68][l]*alpha_vdim[311][l]+(0.1956151991089878*f[171][l]+0.3061862178478971*f[81][l])*alpha_vdim[300][l]+0.273861278752583*f[170][l]*alpha_vdim[299][l]+0.1749635530559412*f[44][l]*alpha_vdim[287][l]+0.273861278752583*(f[5][l]*alpha_vdim[287][l]+f[129][l]*alpha_vdim[286][l])+0.1956151991089878*f[138][l]*alpha_vdim[277][l]+0.3061862178478971*(f[49][l]*alpha_vdim[277][l]+f[210][l]*alpha_vdim[276][l])+(0.1956151991089878*f[136][l]+0.3061862178478971*f[47][l])*alpha_vdim[275][l]+0.273861278752583*f[135][l]*alpha_vdim[274][l]+0.2449489742783178*f[25][l]*alpha_vdim[268][l]+0.273861278752583*f[113][l]*alpha_vdim[264][l]+0.1956151991089878*f[93][l]*alpha_vdim[260][l]+0.3061862178478971*(f[20][l]*alpha_vdim[260][l]+f[186][l]*alpha_vdim[259][l])+0.2449489742783178*f[13][l]*alpha_vdim[256][l]+0.273861278752583*(f[69][l]*alpha_vdim[255][l]+f[82][l]*alpha_vdim[251][l])+0.3061862178478971*f[171][l]*alpha_vdim[250][l]+0.273861278752583*(f[80][l]*alpha_vdim[249][l]+f[44][l]*alpha_vdim[248][l])+(0.6123724356957944*f[145][l]+0.6846531968814573*f[48][l])*alpha_cdim[247][l]+0.3061862178478971*f[138][l]*alpha_vdim[246][l]+0.273861278752583*f[48][l]*alpha_vdim[245][l]+0.3061862178478971*(f[136][l]*alpha_vdim[244][l]+f[93][l]*alpha_vdim[243][l])+0.6846531968814573*f[84][l]*alpha_cdim[243][l];
+    out[143][l] += (0.6123724356957944*f[237][l]+0.6846531968814573*f[206][l])*alpha_vdim[606][l]+0.6123724356957944*f[192][l]*alpha_vdim[603][l]+0.6846531968814573*f[222][l]*alpha_vdim[572][l]+(0.6123724356957944*f[225][l]+0.6846531968814573*f[160][l])*alpha_vdim[546][l]+(0.6123724356957944*f[224][l]+0.6846531968814573*f[159][l])*alpha_vdim[545][l]+0.6123724356957944*(f[148][l]*alpha_vdim[543][l]+f[147][l]*alpha_vdim[542][l])+(0.6123724356957944*f[209][l]+0.6846531968814573*f[131][l])*alpha_vdim[524][l]+(0.6123724356957944*f[208][l]+0.6846531968814573*f[130][l])*alpha_vdim[523][l]+0.6123724356957944*(f[107][l]*alpha_vdim[520][l]+f[106][l]*alpha_vdim[519][l])+0.6846531968814573*(f[194][l]*alpha_vdim[518][l]+f[193][l]*alpha_vdim[517][l])+(0.6123724356957944*f[197][l]+0.6846531968814573*f[103][l])*alpha_vdim[508][l]+0.6123724356957944*f[96][l]*alpha_vdim[507][l]+0.6846531968814573*(f[163][l]*alpha_vdim[503][l]+f[162][l]*alpha_vdim[502][l])+(0.6123724356957944*f[169][l]+0.6846531968814573*f[73][l])*alpha_vdim[496][l]+(0.6123724356957944*f[168][l]+0.6846531968814573*f[72][l])*alpha_vdim[495][l]+0.6123724356957944*(f[55][l]*alpha_vdim[494][l]+f[54][l]*alpha_vdim[493][l])+0.6846531968814573*f[149][l]*alpha_vdim[492][l]+(0.6123724356957944*f[134][l]+0.6846531968814573*f[45][l])*alpha_vdim[490][l]+0.6123724356957944*f[30][l]*alpha_vdim[489][l]+0.6846531968814573*(f[109][l]*alpha_vdim[488][l]+f[108][l]*alpha_vdim[487][l]+f[76][l]*alpha_vdim[486][l])+0.273861278752583*(f[206][l]*alpha_vdim[372][l]+f[210][l]*alpha_vdim[360][l])+0.3061862178478971*f[233][l]*alpha_vdim[329][l]+0.273861278752583*(f[160][l]*alpha_vdim[312][l]+f[159][l]*alpha_vdim[311][l]+f[171][l]*alpha_vdim[300][l]+f[170][l]*alpha_vdim[299][l]+f[131][l]*alpha_vdim[287][l]+f[130][l]*alpha_vdim[286][l]+f[138][l]*alpha_vdim[277][l]+f[137][l]*alpha_vdim[276][l])+0.3061862178478971*(f[212][l]*alpha_vdim[275][l]+f[211][l]*alpha_vdim[274][l])+0.273861278752583*(f[103][l]*alpha_vdim[268][l]+f[113][l]*alpha_vdim[264][l])+0.3061862178478971*(f[188][l]*alpha_vdim[260][l]+f[187][l]*alpha_vdim[259][l])+0.273861278752583*(f[73][l]*alpha_vdim[256][l]+f[72][l]*alpha_vdim[255][l]+f[82][l]*alpha_vdim[251][l]+f[81][l]*alpha_vdim[250][l])+0.3061862178478971*f[172][l]*alpha_vdim[249][l]+0.273861278752583*(f[45][l]*alpha_vdim[248][l]+f[49][l]*alpha_vdim[246][l])+0.3061862178478971*(f[140][l]*alpha_vdim[245][l]+f[139][l]*alpha_vdim[244][l]+f[94][l]*alpha_vdim[243][l])+0.6123724356957944*(alpha_vdim[120][l]*f[239][l]+alpha_vdim[60][l]*f[230][l]+alpha_vdim[59][l]*f[229][l])+0.6846531968814573*alpha_vdim[86][l]*f[226][l]+0.6123724356957944*(alpha_vdim[38][l]*f[219][l]+alpha_vdim[37][l]*f[218][l])+0.6846531968814573*alpha_vdim[120][l]*f[210][l]+0.6123724356957944*alpha_vdim[22][l]*f[201][l]+0.6846531968814573*(alpha_vdim[32][l]*f[199][l]+alpha_vdim[31][l]*f[198][l])+0.6123724356957944*(alpha_vdim[129][l]*f[192][l]+alpha_vdim[10][l]*f[181][l]+alpha_vdim[9][l]*f[180][l])+0.6846531968814573*(alpha_vdim[17][l]*f[176][l]+alpha_vdim[16][l]*f[175][l]+alpha_vdim[60][l]*f[171][l]+alpha_vdim[59][l]*f[170][l]+alpha_vdim[6][l]*f[151][l])+0.6123724356957944*(alpha_vdim[69][l]*f[148][l]+alpha_vdim[68][l]*f[147][l]+alpha_vdim[4][l]*f[146][l])+0.6846531968814573*(alpha_vdim[38][l]*f[138][l]+alpha_vdim[37][l]*f[137][l]+alpha_vdim[2][l]*f[116][l]+alpha_vdim[1][l]*f[115][l]+alpha_vdim[22][l]*f[113][l])+0.6123724356957944*(alpha_vdim[44][l]*f[107][l]+alpha_vdim[43][l]*f[106][l]+alpha_vdim[25][l]*f[96][l])+0.6846531968814573*(alpha_vdim[0][l]*f[85][l]+alpha_vdim[10][l]*f[82][l]+alpha_vdim[9][l]*f[81][l])+0.6123724356957944*(alpha_vdim[13][l]*f[55][l]+alpha_vdim[12][l]*f[54][l])+0.6846531968814573*alpha_vdim[4][l]*f[49][l]+0.6123724356957944*alpha_vdim[5][l]*f[30][l];
+    out[144][l] += 0.5477225575051661*f[105][l]*alpha_vdim[606][l]+0.6123724356957944*(f[196][l]*alpha_vdim[603][l]+f[165][l]*alpha_vdim[572][l])+(0.5477225575051661*f[161][l]+0.6123724356957944*f[75][l])*alpha_vdim[546][l]+0.5477225575051661*f[53][l]*alpha_vdim[545][l]+(0.6123724356957944*f[223][l]+0.6846531968814573*f[167][l])*alpha_vdim[543][l]+0.6123724356957944*(f[150][l]*alpha_vdim[542][l]+f[105][l]*alpha_vdim[524][l])+0.5477225575051661*f[28][l]*alpha_vdim[523][l]+0.6846531968814573*f[196][l]*alpha_vdim[520][l]+0.6123724356957944*f[111][l]*alpha_vdim[519][l]+(0.6123724356957944*f[207][l]+0.6846531968814573*f[133][l])*alpha_vdim[518][l]+0.6123724356957944*f[110][l]*alpha_vdim[517][l]+0.5477225575051661*f[104][l]*alpha_vdim[508][l]+0.6123724356957944*(f[29][l]*alpha_vdim[508][l]+f[195][l]*alpha_vdim[507][l])+0.6846531968814573*(f[112][l]*alpha_vdim[507][l]+f[165][l]*alpha_vdim[503][l])+0.6123724356957944*(f[77][l]*alpha_vdim[502][l]+f[53][l]*alpha_vdim[496][l])+(0.5477225575051661*f[74][l]+0.6123724356957944*f[15][l])*alpha_vdim[495][l]+0.6846531968814573*f[150][l]*alpha_vdim[494][l]+(0.6123724356957944*f[166][l]+0.6846531968814573*f[79][l])*alpha_vdim[493][l]+(0.6123724356957944*f[164][l]+0.6846531968814573*f[78][l])*alpha_vdim[492][l]+0.6123724356957944*f[28][l]*alpha_vdim[490][l]+0.6846531968814573*(f[111][l]*alpha_vdim[489][l]+f[110][l]*alpha_vdim[488][l])+0.6123724356957944*f[132][l]*alpha_vdim[487][l]+0.6846531968814573*(f[46][l]*alpha_vdim[487][l]+f[77][l]*alpha_vdim[486][l])+0.5477225575051661*f[105][l]*alpha_vdim[372][l]+0.6123724356957944*(f[199][l]*alpha_vdim[360][l]+f[174][l]*alpha_vdim[329][l])+(0.5477225575051661*f[161][l]+0.6123724356957944*f[75][l])*alpha_vdim[312][l]+0.5477225575051661*f[53][l]*alpha_vdim[311][l]+(0.6123724356957944*f[226][l]+0.6846531968814573*f[176][l])*alpha_vdim[300][l]+0.6123724356957944*(f[151][l]*alpha_vdim[299][l]+f[105][l]*alpha_vdim[287][l])+0.5477225575051661*f[28][l]*alpha_vdim[286][l]+0.6846531968814573*f[199][l]*alpha_vdim[277][l]+0.6123724356957944*f[115][l]*alpha_vdim[276][l]+(0.6123724356957944*f[213][l]+0.6846531968814573*f[142][l])*alpha_vdim[275][l]+0.6123724356957944*f[114][l]*alpha_vdim[274][l]+0.5477225575051661*f[104][l]*alpha_vdim[268][l]+0.6123724356957944*(f[29][l]*alpha_vdim[268][l]+f[198][l]*alpha_vdim[264][l])+0.6846531968814573*(f[116][l]*alpha_vdim[264][l]+f[174][l]*alpha_vdim[260][l])+0.6123724356957944*(f[83][l]*alpha_vdim[259][l]+f[53][l]*alpha_vdim[256][l])+(0.5477225575051661*f[74][l]+0.6123724356957944*f[15][l])*alpha_vdim[255][l]+0.6846531968814573*f[151][l]*alpha_vdim[251][l]+(0.6123724356957944*f[175][l]+0.6846531968814573*f[85][l])*alpha_vdim[250][l]+(0.6123724356957944*f[173][l]+0.6846531968814573*f[84][l])*alpha_vdim[249][l]+0.6123724356957944*f[28][l]*alpha_vdim[248][l]+0.6846531968814573*(f[115][l]*alpha_vdim[246][l]+f[114][l]*alpha_vdim[245][l])+0.6123724356957944*f[141][l]*alpha_vdim[244][l]+0.6846531968814573*(f[50][l]*alpha_vdim[244][l]+f[83][l]*alpha_vdim[243][l])+0.3061862178478971*(alpha_cdim[3][l]*f[146][l]+alpha_cdim[0][l]*f[95][l]);
+    out[145][l] += 0.5477225575051661*f[104][l]*alpha_vdim[606][l]+0.6123724356957944*(f[195][l]*alpha_vdim[603][l]+f[164][l]*alpha_vdim[572][l])+0.5477225575051661*(f[53][l]*alpha_vdim[546][l]+f[161][l]*alpha_vdim[545][l])+0.6123724356957944*(f[74][l]*alpha_vdim[545][l]+f[150][l]*alpha_vdim[543][l])+(0.6123724356957944*f[223][l]+0.6846531968814573*f[166][l])*alpha_vdim[542][l]+0.5477225575051661*f[29][l]*alpha_vdim[524][l]+0.6123724356957944*(f[104][l]*alpha_vdim[523][l]+f[112][l]*alpha_vdim[520][l])+0.6846531968814573*f[195][l]*alpha_vdim[519][l]+0.6123724356957944*f[110][l]*alpha_vdim[518][l]+(0.6123724356957944*f[207][l]+0.6846531968814573*f[132][l])*alpha_vdim[517][l]+(0.5477225575051661*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[508][l]+(0.6123724356957944*f[196][l]+0.6846531968814573*f[111][l])*alpha_vdim[507][l]+0.6123724356957944*f[78][l]*alpha_vdim[503][l]+0.6846531968814573*f[164][l]*alpha_vdim[502][l]+0.5477225575051661*f[75][l]*alpha_vdim[496][l]+0.6123724356957944*(f[15][l]*alpha_vdim[496][l]+f[53][l]*alpha_vdim[495][l]+f[167][l]*alpha_vdim[494][l])+0.6846531968814573*(f[79][l]*alpha_vdim[494][l]+f[150][l]*alpha_vdim[493][l])+(0.6123724356957944*f[165][l]+0.6846531968814573*f[77][l])*alpha_vdim[492][l]+0.6123724356957944*f[29][l]*alpha_vdim[490][l]+0.6846531968814573*f[112][l]*alpha_vdim[489][l]+0.6123724356957944*f[133][l]*alpha_vdim[488][l]+0.6846531968814573*(f[46][l]*alpha_vdim[488][l]+f[110][l]*alpha_vdim[487][l]+f[78][l]*alpha_vdim[486][l])+0.5477225575051661*f[104][l]*alpha_vdim[372][l]+0.6123724356957944*(f[198][l]*alpha_vdim[360][l]+f[173][l]*alpha_vdim[329][l])+0.5477225575051661*(f[53][l]*alpha_vdim[312][l]+f[161][l]*alpha_vdim[311][l])+0.6123724356957944*(f[74][l]*alpha_vdim[311][l]+f[151][l]*alpha_vdim[300][l])+(0.6123724356957944*f[226][l]+0.6846531968814573*f[175][l])*alpha_vdim[299][l]+0.5477225575051661*f[29][l]*alpha_vdim[287][l]+0.6123724356957944*(f[104][l]*alpha_vdim[286][l]+f[116][l]*alpha_vdim[277][l])+0.6846531968814573*f[198][l]*alpha_vdim[276][l]+0.6123724356957944*f[114][l]*alpha_vdim[275][l]+(0.6123724356957944*f[213][l]+0.6846531968814573*f[141][l])*alpha_vdim[274][l]+(0.5477225575051661*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[268][l]+(0.6123724356957944*f[199][l]+0.6846531968814573*f[115][l])*alpha_vdim[264][l]+0.6123724356957944*f[84][l]*alpha_vdim[260][l]+0.6846531968814573*f[173][l]*alpha_vdim[259][l]+0.5477225575051661*f[75][l]*alpha_vdim[256][l]+0.6123724356957944*(f[15][l]*alpha_vdim[256][l]+f[53][l]*alpha_vdim[255][l]+f[176][l]*alpha_vdim[251][l])+0.6846531968814573*(f[85][l]*alpha_vdim[251][l]+f[151][l]*alpha_vdim[250][l])+(0.6123724356957944*f[174][l]+0.6846531968814573*f[83][l])*alpha_vdim[249][l]+0.6123724356957944*f[29][l]*alpha_vdim[248][l]+0.273861278752583*f[50][l]*alpha_cdim[247][l]+0.6846531968814573*f[116][l]*alpha_vdim[246][l]+0.6123724356957944*f[142][l]*alpha_vdim[245][l]+0.6846531968814573*(f[50][l]*alpha_vdim[245][l]+f[114][l]*alpha_vdim[244][l]+f[84][l]*alpha_vdim[243][l])+0.3061862178478971*f[95][l]*alpha_cdim[243][l];
+    out[146][l] += 0.6123724356957944*(f[192][l]*alpha_vdim[606][l]+f[237][l]*alpha_vdim[603][l])+0.6846531968814573*(f[207][l]*alpha_vdim[603][l]+f[223][l]*alpha_vdim[572][l])+0.6123724356957944*(f[148][l]*alpha_vdim[546][l]+f[147][l]*alpha_vdim[545][l])+(0.6123724356957944*f[225][l]+0.6846531968814573*f[165][l])*alpha_vdim[543][l]+(0.6123724356957944*f[224][l]+0.6846531968814573*f[164][l])*alpha_vdim[542][l]+0.6123724356957944*(f[107][l]*alpha_vdim[524][l]+f[106][l]*alpha_vdim[523][l])+(0.6123724356957944*f[209][l]+0.6846531968814573*f[133][l])*alpha_vdim[520][l]+0.6123724356957944*f[208][l]*alpha_vdim[519][l]+0.6846531968814573*(f[132][l]*alpha_vdim[519][l]+f[196][l]*alpha_vdim[518][l]+f[195][l]*alpha_vdim[517][l])+0.6123724356957944*(f[96][l]*alpha_vdim[508][l]+f[197][l]*alpha_vdim[507][l])+0.6846531968814573*(f[110][l]*alpha_vdim[507][l]+f[167][l]*alpha_vdim[503][l]+f[166][l]*alpha_vdim[502][l])+0.6123724356957944*(f[55][l]*alpha_vdim[496][l]+f[54][l]*alpha_vdim[495][l])+(0.6123724356957944*f[169][l]+0.6846531968814573*f[78][l])*alpha_vdim[494][l]+0.6123724356957944*f[168][l]*alpha_vdim[493][l]+0.6846531968814573*(f[77][l]*alpha_vdim[493][l]+f[150][l]*alpha_vdim[492][l])+0.6123724356957944*(f[30][l]*alpha_vdim[490][l]+f[134][l]*alpha_vdim[489][l])+0.6846531968814573*(f[46][l]*alpha_vdim[489][l]+f[112][l]*alpha_vdim[488][l]+f[111][l]*alpha_vdim[487][l]+f[79][l]*alpha_vdim[486][l])+0.6123724356957944*(f[192][l]*alpha_vdim[372][l]+f[238][l]*alpha_vdim[360][l])+0.6846531968814573*(f[213][l]*alpha_vdim[360][l]+f[226][l]*alpha_vdim[329][l])+0.6123724356957944*(f[148][l]*alpha_vdim[312][l]+f[147][l]*alpha_vdim[311][l])+(0.6123724356957944*f[228][l]+0.6846531968814573*f[174][l])*alpha_vdim[300][l]+(0.6123724356957944*f[227][l]+0.6846531968814573*f[173][l])*alpha_vdim[299][l]+0.6123724356957944*(f[107][l]*alpha_vdim[287][l]+f[106][l]*alpha_vdim[286][l])+(0.6123724356957944*f[215][l]+0.6846531968814573*f[142][l])*alpha_vdim[277][l]+0.6123724356957944*f[214][l]*alpha_vdim[276][l]+0.6846531968814573*(f[141][l]*alpha_vdim[276][l]+f[199][l]*alpha_vdim[275][l]+f[198][l]*alpha_vdim[274][l])+0.6123724356957944*(f[96][l]*alpha_vdim[268][l]+f[200][l]*alpha_vdim[264][l])+0.6846531968814573*(f[114][l]*alpha_vdim[264][l]+f[176][l]*alpha_vdim[260][l]+f[175][l]*alpha_vdim[259][l])+0.6123724356957944*(f[55][l]*alpha_vdim[256][l]+f[54][l]*alpha_vdim[255][l])+(0.6123724356957944*f[178][l]+0.6846531968814573*f[84][l])*alpha_vdim[251][l]+0.6123724356957944*f[177][l]*alpha_vdim[250][l]+0.6846531968814573*(f[83][l]*alpha_vdim[250][l]+f[151][l]*alpha_vdim[249][l])+0.6123724356957944*(f[30][l]*alpha_vdim[248][l]+f[143][l]*alpha_vdim[246][l])+0.6846531968814573*(f[50][l]*alpha_vdim[246][l]+f[116][l]*alpha_vdim[245][l]+f[115][l]*alpha_vdim[244][l]+f[85][l]*alpha_vdim[243][l])+0.3061862178478971*(alpha_vdim[86][l]*f[234][l]+alpha_vdim[32][l]*f[217][l]+alpha_vdim[31][l]*f[216][l])+0.273861278752583*(alpha_vdim[120][l]*f[213][l]+alpha_vdim[129][l]*f[207][l])+0.3061862178478971*(alpha_vdim[17][l]*f[190][l]+alpha_vdim[16][l]*f[189][l]+alpha_vdim[6][l]*f[179][l])+0.273861278752583*(alpha_vdim[60][l]*f[174][l]+alpha_vdim[59][l]*f[173][l]+alpha_vdim[69][l]*f[165][l]+alpha_vdim[68][l]*f[164][l])+0.3061862178478971*(alpha_vdim[2][l]*f[145][l]+alpha_vdim[1][l]*f[144][l])+0.273861278752583*(alpha_vdim[38][l]*f[142][l]+alpha_vdim[37][l]*f[141][l]+alpha_vdim[44][l]*f[133][l]+alpha_vdim[43][l]*f[132][l]+alpha_vdim[22][l]*f[114][l]+alpha_vdim[25][l]*f[110][l])+0.3061862178478971*alpha_vdim[0][l]*f[95][l]+0.273861278752583*(alpha_vdim[10][l]*f[84][l]+alpha_vdim[9][l]*f[83][l]+alpha_vdim[13][l]*f[78][l]+alpha_vdim[12][l]*f[77][l]+alpha_vdim[4][l]*f[50][l]+alpha_vdim[5][l]*f[46][l]);
+    out[147][l] += (0.1564921592871903*f[155][l]+0.2449489742783178*f[67][l]+0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[606][l]+(0.1564921592871903*f[153][l]+0.2449489742783178*f[64][l]+0.1749635530559412*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[603][l]+(0.1749635530559412*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[572][l]+(0.2190890230020664*f[100][l]+0.2449489742783178*f[21][l])*alpha_vdim[546][l]+(0.1564921592871903*f[203][l]+0.2449489742783178*f[126][l]+0.1749635530559412*(f[125][l]+f[117][l])+0.273861278752583*(f[42][l]+f[34][l])+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[545][l]+(0.2190890230020664*f[99][l]+0.2449489742783178*f[22][l])*alpha_vdim[543][l]+(0.1564921592871903*f[202][l]+0.2449489742783178*f[122][l]+0.1749635530559412*(f[121][l]+f[120][l])+0.273861278752583*(f[39][l]+f[38][l])+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[542][l]+(0.2449489742783178*f[155][l]+0.273861278752583*f[56][l])*alpha_vdim[524][l]+(0.1749635530559412*f[155][l]+0.273861278752583*f[67][l]+0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[523][l]+(0.2449489742783178*f[153][l]+0.273861278752583*f[59][l])*alpha_vdim[520][l]+(0.1749635530559412*f[153][l]+0.273861278752583*f[64][l]+0.1956151991089878*f[59][l]+0.3061862178478971*f[10][l])*alpha_vdim[519][l]+0.2449489742783178*f[51][l]*alpha_vdim[518][l]+(0.1749635530559412*f[152][l]+0.273861278752583*f[62][l]+0.1956151991089878*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[517][l]+(0.2190890230020664*f[156][l]+0.2449489742783178*(f[66][l]+f[57][l])+0.273861278752583*f[7][l])*alpha_vdim[508][l]+(0.2190890230020664*f[154][l]+0.2449489742783178*(f[63][l]+f[60][l]))*alpha_vdim[507][l]+0.273861278752583*(f[9][l]*alpha_vdim[507][l]+f[97][l]*alpha_vdim[503][l])+(0.1956151991089878*f[97][l]+0.3061862178478971*f[24][l])*alpha_vdim[502][l]+(0.2449489742783178*f[203][l]+0.273861278752583*(f[125][l]+f[117][l])+0.3061862178478971*f[33][l])*alpha_vdim[496][l]+(0.2449489742783178*f[100][l]+0.273861278752583*f[21][l])*alpha_vdim[495][l]+(0.2449489742783178*f[202][l]+0.273861278752583*(f[121][l]+f[120][l])+0.3061862178478971*f[37][l])*alpha_vdim[494][l]+(0.2449489742783178*f[99][l]+0.273861278752583*f[22][l])*alpha_vdim[493][l]+(0.2449489742783178*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[492][l]+(0.273861278752583*f[155][l]+0.3061862178478971*f[56][l])*alpha_vdim[490][l]+(0.273861278752583*f[153][l]+0.3061862178478971*f[59][l])*alpha_vdim[489][l]+(0.273861278752583*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[488][l]+0.273861278752583*f[51][l]*alpha_vdim[487][l]+0.3061862178478971*f[97][l]*alpha_vdim[486][l]+(0.1564921592871903*f[170][l]+0.2449489742783178*f[82][l]+0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[372][l]+(0.1564921592871903*f[159][l]+0.2449489742783178*f[73][l]+0.1749635530559412*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[360][l]+(0.1749635530559412*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[329][l]+(0.2190890230020664*f[113][l]+0.2449489742783178*f[21][l])*alpha_vdim[312][l]+(0.1564921592871903*f[210][l]+0.2449489742783178*f[138][l]+0.1749635530559412*(f[137][l]+f[117][l])+0.273861278752583*(f[49][l]+f[34][l])+0.1956151991089878*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[311][l]+(0.2190890230020664*f[103][l]+0.2449489742783178*f[25][l])*alpha_vdim[300][l]+(0.1564921592871903*f[206][l]+0.2449489742783178*f[131][l]+0.1749635530559412*(f[130][l]+f[129][l])+0.273861278752583*(f[45][l]+f[44][l])+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[299][l]+(0.2449489742783178*f[170][l]+0.273861278752583*f[56][l])*alpha_vdim[287][l]+(0.1749635530559412*f[170][l]+0.273861278752583*f[82][l]+0.1956151991089878*f[56][l]+0.3061862178478971*f[8][l])*alpha_vdim[286][l]+(0.2449489742783178*f[159][l]+0.273861278752583*f[68][l])*alpha_vdim[277][l]+(0.1749635530559412*f[159][l]+0.273861278752583*f[73][l]+0.1956151991089878*f[68][l]+0.3061862178478971*f[13][l])*alpha_vdim[276][l]+0.2449489742783178*f[52][l]*alpha_vdim[275][l]+(0.1749635530559412*f[158][l]+0.273861278752583*f[71][l]+0.1956151991089878*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[274][l]+(0.2190890230020664*f[171][l]+0.2449489742783178*(f[81][l]+f[57][l])+0.273861278752583*f[7][l])*alpha_vdim[268][l]+(0.2190890230020664*f[160][l]+0.2449489742783178*(f[72][l]+f[69][l]))*alpha_vdim[264][l]+0.273861278752583*(f[12][l]*alpha_vdim[264][l]+f[101][l]*alpha_vdim[260][l])+(0.1956151991089878*f[101][l]+0.3061862178478971*f[27][l])*alpha_vdim[259][l]+(0.2449489742783178*f[210][l]+0.273861278752583*(f[137][l]+f[117][l])+0.3061862178478971*f[33][l])*alpha_vdim[256][l]+(0.2449489742783178*f[113][l]+0.273861278752583*f[21][l])*alpha_vdim[255][l]+(0.2449489742783178*f[206][l]+0.273861278752583*(f[130][l]+f[129][l])+0.3061862178478971*f[43][l])*alpha_vdim[251][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[25][l])*alpha_vdim[250][l]+(0.2449489742783178*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[249][l]+(0.273861278752583*f[170][l]+0.3061862178478971*f[56][l])*alpha_vdim[248][l]+(0.273861278752583*f[166][l]+0.3061862178478971*f[70][l])*alpha_cdim[247][l]+(0.273861278752583*f[159][l]+0.3061862178478971*f[68][l])*alpha_vdim[246][l]+(0.273861278752583*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[245][l]+0.273861278752583*f[52][l]*alpha_vdim[244][l]+0.3061862178478971*(f[101][l]*alpha_vdim[243][l]+f[106][l]*alpha_cdim[243][l])+(0.1564921592871903*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[213][l]+(0.1564921592871903*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[207][l]+0.2190890230020664*alpha_vdim[25][l]*f[174][l]+(0.1564921592871903*alpha_vdim[129][l]+0.2449489742783178*alpha_vdim[44][l]+0.1749635530559412*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[173][l]+0.2190890230020664*alpha_vdim[22][l]*f[165][l]+(0.1564921592871903*alpha_vdim[120][l]+0.2449489742783178*alpha_vdim[38][l]+0.1749635530559412*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[164][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[161][l]+0.6123724356957944*alpha_cdim[3][l]*f[149][l]+0.2449489742783178*alpha_vdim[68][l]*f[142][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[141][l]+0.2449489742783178*alpha_vdim[59][l]*f[133][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[132][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[129][l]+(0.2449489742783178*f[84][l]+0.1749635530559412*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[129][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[120][l]+(0.2449489742783178*f[78][l]+0.1749635530559412*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[120][l]+(0.2190890230020664*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[114][l]+0.2190890230020664*alpha_vdim[60][l]*f[110][l]+0.2449489742783178*(alpha_vdim[9][l]*f[110][l]+alpha_vdim[6][l]*f[105][l])+(0.1749635530559412*alpha_vdim[86][l]+0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[104][l]+0.6846531968814573*alpha_cdim[0][l]*f[96][l]+0.273861278752583*(f[29][l]*alpha_vdim[86][l]+alpha_vdim[43][l]*f[84][l])+0.2449489742783178*alpha_vdim[25][l]*f[83][l]+0.273861278752583*alpha_vdim[37][l]*f[78][l]+0.2449489742783178*alpha_vdim[22][l]*f[77][l]+0.273861278752583*alpha_vdim[31][l]*f[75][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[74][l]+0.2449489742783178*(alpha_vdim[22][l]*f[69][l]+f[22][l]*alpha_vdim[69][l])+(0.273861278752583*alpha_vdim[38][l]+0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[68][l]+(0.273861278752583*(f[50][l]+f[38][l])+0.1956151991089878*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[68][l]+0.2449489742783178*(alpha_vdim[25][l]*f[60][l]+f[25][l]*alpha_vdim[60][l])+(0.273861278752583*alpha_vdim[44][l]+0.1956151991089878*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[59][l]+(0.273861278752583*(f[46][l]+f[44][l])+0.1956151991089878*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[59][l]+(0.2449489742783178*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[53][l]+0.3061862178478971*(alpha_vdim[10][l]*f[43][l]+f[10][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[37][l]+f[13][l]*alpha_vdim[37][l]+f[15][l]*alpha_vdim[31][l]+alpha_vdim[16][l]*f[29][l])+0.273861278752583*(alpha_vdim[6][l]*f[28][l]+alpha_vdim[9][l]*f[25][l]+f[9][l]*alpha_vdim[25][l]+alpha_vdim[12][l]*f[22][l]+f[12][l]*alpha_vdim[22][l]);
+    out[148][l] += (0.1564921592871903*f[156][l]+0.2449489742783178*f[66][l]+0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[606][l]+(0.1564921592871903*f[154][l]+0.2449489742783178*f[63][l]+0.1749635530559412*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[603][l]+(0.1749635530559412*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[572][l]+(0.1564921592871903*f[203][l]+0.1749635530559412*f[126][l]+0.2449489742783178*f[125][l]+0.1749635530559412*f[117][l]+0.273861278752583*f[42][l]+0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[546][l]+(0.2190890230020664*f[100][l]+0.2449489742783178*f[21][l])*alpha_vdim[545][l]+(0.1564921592871903*f[202][l]+0.1749635530559412*f[122][l]+0.2449489742783178*f[121][l]+0.1749635530559412*f[120][l]+0.273861278752583*f[39][l]+0.1956151991089878*f[38][l]+0.273861278752583*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[543][l]+(0.2190890230020664*f[99][l]+0.2449489742783178*f[22][l])*alpha_vdim[542][l]+(0.1749635530559412*f[156][l]+0.273861278752583*f[66][l]+0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[524][l]+(0.2449489742783178*f[156][l]+0.273861278752583*f[57][l])*alpha_vdim[523][l]+(0.1749635530559412*f[154][l]+0.273861278752583*f[63][l]+0.1956151991089878*f[60][l]+0.3061862178478971*f[9][l])*alpha_vdim[520][l]+(0.2449489742783178*f[154][l]+0.273861278752583*f[60][l])*alpha_vdim[519][l]+(0.1749635530559412*f[152][l]+0.1956151991089878*f[62][l]+0.273861278752583*f[61][l]+0.3061862178478971*f[11][l])*alpha_vdim[518][l]+0.2449489742783178*f[51][l]*alpha_vdim[517][l]+(0.2190890230020664*f[155][l]+0.2449489742783178*(f[67][l]+f[56][l])+0.273861278752583*f[8][l])*alpha_vdim[508][l]+(0.2190890230020664*f[153][l]+0.2449489742783178*(f[64][l]+f[59][l])+0.273861278752583*f[10][l])*alpha_vdim[507][l]+(0.1956151991089878*f[98][l]+0.3061862178478971*f[23][l])*alpha_vdim[503][l]+0.273861278752583*f[98][l]*alpha_vdim[502][l]+(0.2449489742783178*f[100][l]+0.273861278752583*f[21][l])*alpha_vdim[496][l]+(0.2449489742783178*f[203][l]+0.273861278752583*(f[126][l]+f[117][l])+0.3061862178478971*f[34][l])*alpha_vdim[495][l]+(0.2449489742783178*f[99][l]+0.273861278752583*f[22][l])*alpha_vdim[494][l]+(0.2449489742783178*f[202][l]+0.273861278752583*(f[122][l]+f[120][l])+0.3061862178478971*f[38][l])*alpha_vdim[493][l]+(0.2449489742783178*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[492][l]+(0.273861278752583*f[156][l]+0.3061862178478971*f[57][l])*alpha_vdim[490][l]+(0.273861278752583*f[154][l]+0.3061862178478971*f[60][l])*alpha_vdim[489][l]+0.273861278752583*(f[51][l]*alpha_vdim[488][l]+f[152][l]*alpha_vdim[487][l])+0.3061862178478971*(f[62][l]*alpha_vdim[487][l]+f[98][l]*alpha_vdim[486][l])+(0.1564921592871903*f[171][l]+0.2449489742783178*f[81][l]+0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[372][l]+(0.1564921592871903*f[160][l]+0.2449489742783178*f[72][l]+0.1749635530559412*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[360][l]+(0.1749635530559412*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[329][l]+(0.1564921592871903*f[210][l]+0.1749635530559412*f[138][l]+0.2449489742783178*f[137][l]+0.1749635530559412*f[117][l]+0.273861278752583*f[49][l]+0.1956151991089878*f[34][l]+0.273861278752583*f[33][l]+0.3061862178478971*f[3][l])*alpha_vdim[312][l]+(0.2190890230020664*f[113][l]+0.2449489742783178*f[21][l])*alpha_vdim[311][l]+(0.1564921592871903*f[206][l]+0.1749635530559412*f[131][l]+0.2449489742783178*f[130][l]+0.1749635530559412*f[129][l]+0.273861278752583*f[45][l]+0.1956151991089878*f[44][l]+0.273861278752583*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[300][l]+(0.2190890230020664*f[103][l]+0.2449489742783178*f[25][l])*alpha_vdim[299][l]+(0.1749635530559412*f[171][l]+0.273861278752583*f[81][l]+0.1956151991089878*f[57][l]+0.3061862178478971*f[7][l])*alpha_vdim[287][l]+(0.2449489742783178*f[171][l]+0.273861278752583*f[57][l])*alpha_vdim[286][l]+(0.1749635530559412*f[160][l]+0.273861278752583*f[72][l]+0.1956151991089878*f[69][l]+0.3061862178478971*f[12][l])*alpha_vdim[277][l]+(0.2449489742783178*f[160][l]+0.273861278752583*f[69][l])*alpha_vdim[276][l]+(0.1749635530559412*f[158][l]+0.1956151991089878*f[71][l]+0.273861278752583*f[70][l]+0.3061862178478971*f[14][l])*alpha_vdim[275][l]+0.2449489742783178*f[52][l]*alpha_vdim[274][l]+(0.2190890230020664*f[170][l]+0.2449489742783178*(f[82][l]+f[56][l])+0.273861278752583*f[8][l])*alpha_vdim[268][l]+(0.2190890230020664*f[159][l]+0.2449489742783178*(f[73][l]+f[68][l])+0.273861278752583*f[13][l])*alpha_vdim[264][l]+(0.1956151991089878*f[102][l]+0.3061862178478971*f[26][l])*alpha_vdim[260][l]+0.273861278752583*f[102][l]*alpha_vdim[259][l]+(0.2449489742783178*f[113][l]+0.273861278752583*f[21][l])*alpha_vdim[256][l]+(0.2449489742783178*f[210][l]+0.273861278752583*(f[138][l]+f[117][l])+0.3061862178478971*f[34][l])*alpha_vdim[255][l]+(0.2449489742783178*f[103][l]+0.273861278752583*f[25][l])*alpha_vdim[251][l]+(0.2449489742783178*f[206][l]+0.273861278752583*(f[131][l]+f[129][l])+0.3061862178478971*f[44][l])*alpha_vdim[250][l]+(0.2449489742783178*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[249][l]+(0.273861278752583*f[171][l]+0.3061862178478971*f[57][l])*alpha_vdim[248][l]+(0.6123724356957944*f[150][l]+0.6846531968814573*f[52][l])*alpha_cdim[247][l]+(0.273861278752583*f[160][l]+0.3061862178478971*f[69][l])*alpha_vdim[246][l]+0.273861278752583*(f[52][l]*alpha_vdim[245][l]+f[158][l]*alpha_vdim[244][l])+0.3061862178478971*(f[71][l]*alpha_vdim[244][l]+f[102][l]*alpha_vdim[243][l])+0.6846531968814573*f[96][l]*alpha_cdim[243][l]+(0.1564921592871903*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[213][l]+(0.1564921592871903*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[207][l]+(0.1564921592871903*alpha_vdim[129][l]+0.1749635530559412*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[174][l]+0.2190890230020664*alpha_vdim[25][l]*f[173][l]+(0.1564921592871903*alpha_vdim[120][l]+0.1749635530559412*alpha_vdim[38][l]+0.2449489742783178*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[165][l]+0.2190890230020664*alpha_vdim[22][l]*f[164][l]+0.273861278752583*alpha_cdim[3][l]*f[163][l]+(0.1749635530559412*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[161][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[142][l]+0.2449489742783178*alpha_vdim[69][l]*f[141][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[133][l]+0.2449489742783178*alpha_vdim[60][l]*f[132][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[129][l]+(0.2449489742783178*f[83][l]+0.1749635530559412*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[129][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[120][l]+(0.2449489742783178*f[77][l]+0.1749635530559412*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[120][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[114][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[110][l]+0.3061862178478971*alpha_cdim[0][l]*f[107][l]+(0.1749635530559412*alpha_vdim[86][l]+0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[105][l]+0.2449489742783178*alpha_vdim[6][l]*f[104][l]+0.273861278752583*f[28][l]*alpha_vdim[86][l]+0.2449489742783178*alpha_vdim[25][l]*f[84][l]+0.273861278752583*alpha_vdim[44][l]*f[83][l]+0.2449489742783178*alpha_vdim[22][l]*f[78][l]+0.273861278752583*alpha_vdim[38][l]*f[77][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[75][l]+0.273861278752583*alpha_vdim[32][l]*f[74][l]+(0.1956151991089878*alpha_vdim[38][l]+0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[69][l]+(0.273861278752583*f[50][l]+0.1956151991089878*f[38][l]+0.273861278752583*f[37][l]+0.3061862178478971*f[4][l])*alpha_vdim[69][l]+0.2449489742783178*(alpha_vdim[22][l]*f[68][l]+f[22][l]*alpha_vdim[68][l])+(0.1956151991089878*alpha_vdim[44][l]+0.273861278752583*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[60][l]+(0.273861278752583*f[46][l]+0.1956151991089878*f[44][l]+0.273861278752583*f[43][l]+0.3061862178478971*f[5][l])*alpha_vdim[60][l]+0.2449489742783178*(alpha_vdim[25][l]*f[59][l]+f[25][l]*alpha_vdim[59][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[53][l]+0.3061862178478971*(alpha_vdim[9][l]*f[44][l]+f[9][l]*alpha_vdim[44][l]+alpha_vdim[12][l]*f[38][l]+f[12][l]*alpha_vdim[38][l]+f[15][l]*alpha_vdim[32][l])+0.273861278752583*alpha_vdim[6][l]*f[29][l]+0.3061862178478971*alpha_vdim[17][l]*f[28][l]+0.273861278752583*(alpha_vdim[10][l]*f[25][l]+f[10][l]*alpha_vdim[25][l]+alpha_vdim[13][l]*f[22][l]+f[13][l]*alpha_vdim[22][l]);
+    out[149][l] += (0.2190890230020664*f[157][l]+0.2449489742783178*f[58][l])*alpha_vdim[606][l]+0.2190890230020664*f[51][l]*alpha_vdim[603][l]+0.2449489742783178*f[99][l]*alpha_vdim[572][l]+(0.2190890230020664*f[204][l]+0.2449489742783178*(f[128][l]+f[118][l])+0.273861278752583*f[36][l])*alpha_vdim[546][l]+(0.2190890230020664*f[205][l]+0.2449489742783178*(f[127][l]+f[119][l])+0.273861278752583*f[35][l])*alpha_vdim[545][l]+(0.2190890230020664*f[97][l]+0.2449489742783178*f[24][l])*alpha_vdim[543][l]+(0.2190890230020664*f[98][l]+0.2449489742783178*f[23][l])*alpha_vdim[542][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[58][l])*alpha_vdim[524][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[58][l])*alpha_vdim[523][l]+0.2449489742783178*f[51][l]*(alpha_vdim[520][l]+alpha_vdim[519][l])+(0.2449489742783178*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[518][l]+(0.2449489742783178*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[517][l]+(0.2190890230020664*f[232][l]+0.2449489742783178*(f[185][l]+f[184][l]+f[182][l])+0.273861278752583*(f[91][l]+f[88][l]+f[87][l])+0.3061862178478971*f[18][l])*alpha_vdim[508][l]+(0.2190890230020664*f[152][l]+0.2449489742783178*(f[62][l]+f[61][l]))*alpha_vdim[507][l]+0.273861278752583*(f[11][l]*alpha_vdim[507][l]+f[99][l]*(alpha_vdim[503][l]+alpha_vdim[502][l]))+(0.2449489742783178*f[205][l]+0.273861278752583*(f[127][l]+f[119][l])+0.3061862178478971*f[35][l])*alpha_vdim[496][l]+(0.2449489742783178*f[204][l]+0.273861278752583*(f[128][l]+f[118][l])+0.3061862178478971*f[36][l])*alpha_vdim[495][l]+(0.2449489742783178*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[494][l]+(0.2449489742783178*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[493][l]+(0.2449489742783178*f[202][l]+0.273861278752583*(f[122][l]+f[121][l])+0.3061862178478971*f[39][l])*alpha_vdim[492][l]+(0.273861278752583*f[157][l]+0.3061862178478971*f[58][l])*alpha_vdim[490][l]+0.273861278752583*f[51][l]*alpha_vdim[489][l]+(0.273861278752583*f[154][l]+0.3061862178478971*f[63][l])*alpha_vdim[488][l]+0.273861278752583*f[153][l]*alpha_vdim[487][l]+0.3061862178478971*(f[64][l]*alpha_vdim[487][l]+f[99][l]*alpha_vdim[486][l])+(0.2190890230020664*f[172][l]+0.2449489742783178*f[58][l])*alpha_vdim[372][l]+0.2190890230020664*f[52][l]*alpha_vdim[360][l]+0.2449489742783178*f[103][l]*alpha_vdim[329][l]+(0.2190890230020664*f[211][l]+0.2449489742783178*(f[140][l]+f[118][l])+0.273861278752583*f[36][l])*alpha_vdim[312][l]+(0.2190890230020664*f[212][l]+0.2449489742783178*(f[139][l]+f[119][l])+0.273861278752583*f[35][l])*alpha_vdim[311][l]+(0.2190890230020664*f[101][l]+0.2449489742783178*f[27][l])*alpha_vdim[300][l]+(0.2190890230020664*f[102][l]+0.2449489742783178*f[26][l])*alpha_vdim[299][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[58][l])*alpha_vdim[287][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[58][l])*alpha_vdim[286][l]+0.2449489742783178*f[52][l]*(alpha_vdim[277][l]+alpha_vdim[276][l])+(0.2449489742783178*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[275][l]+(0.2449489742783178*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[274][l]+(0.2190890230020664*f[233][l]+0.2449489742783178*(f[188][l]+f[187][l]+f[182][l])+0.273861278752583*(f[94][l]+f[88][l]+f[87][l])+0.3061862178478971*f[18][l])*alpha_vdim[268][l]+(0.2190890230020664*f[158][l]+0.2449489742783178*(f[71][l]+f[70][l]))*alpha_vdim[264][l]+0.273861278752583*(f[14][l]*alpha_vdim[264][l]+f[103][l]*(alpha_vdim[260][l]+alpha_vdim[259][l]))+(0.2449489742783178*f[212][l]+0.273861278752583*(f[139][l]+f[119][l])+0.3061862178478971*f[35][l])*alpha_vdim[256][l]+(0.2449489742783178*f[211][l]+0.273861278752583*(f[140][l]+f[118][l])+0.3061862178478971*f[36][l])*alpha_vdim[255][l]+(0.2449489742783178*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[251][l]+(0.2449489742783178*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[250][l]+(0.2449489742783178*f[206][l]+0.273861278752583*(f[131][l]+f[130][l])+0.3061862178478971*f[45][l])*alpha_vdim[249][l]+(0.273861278752583*f[172][l]+0.3061862178478971*f[58][l])*alpha_vdim[248][l]+(0.273861278752583*f[168][l]+0.3061862178478971*f[72][l])*alpha_cdim[247][l]+0.273861278752583*f[52][l]*alpha_vdim[246][l]+(0.273861278752583*f[160][l]+0.3061862178478971*f[72][l])*alpha_vdim[245][l]+0.273861278752583*f[159][l]*alpha_vdim[244][l]+0.3061862178478971*(f[73][l]*alpha_vdim[244][l]+f[103][l]*alpha_vdim[243][l]+f[108][l]*alpha_cdim[243][l])+0.4898979485566357*(alpha_vdim[25][l]*f[226][l]+alpha_vdim[22][l]*f[223][l])+(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[199][l]+(0.4898979485566357*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[198][l]+(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[196][l]+0.4898979485566357*alpha_vdim[60][l]*f[195][l]+0.5477225575051661*(alpha_vdim[9][l]*f[195][l]+alpha_vdim[6][l]*f[192][l]+alpha_vdim[25][l]*(f[176][l]+f[175][l])+alpha_vdim[22][l]*(f[167][l]+f[166][l]+f[158][l])+alpha_vdim[25][l]*f[152][l])+(0.4898979485566357*alpha_vdim[129][l]+0.5477225575051661*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[151][l]+(0.4898979485566357*alpha_vdim[120][l]+0.5477225575051661*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[150][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[148][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[147][l]+0.5477225575051661*(f[51][l]*alpha_vdim[129][l]+f[52][l]*alpha_vdim[120][l])+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[116][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[115][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[112][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[111][l]+0.3061862178478971*alpha_cdim[0][l]*f[109][l]+0.6123724356957944*alpha_vdim[6][l]*(f[107][l]+f[106][l])+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[102][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[101][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[98][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[97][l]+(0.5477225575051661*alpha_vdim[86][l]+0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[96][l]+0.6123724356957944*(alpha_vdim[25][l]*f[85][l]+alpha_vdim[22][l]*(f[79][l]+f[71][l]+f[70][l])+f[24][l]*alpha_vdim[69][l]+f[23][l]*alpha_vdim[68][l]+alpha_vdim[25][l]*(f[62][l]+f[61][l])+f[27][l]*alpha_vdim[60][l]+f[26][l]*alpha_vdim[59][l])+(0.6123724356957944*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[55][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[54][l]+(0.6123724356957944*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[52][l]+0.6123724356957944*(alpha_vdim[44][l]+alpha_vdim[43][l])*f[51][l]+0.6846531968814573*(alpha_vdim[5][l]*f[51][l]+alpha_vdim[6][l]*f[30][l]+alpha_vdim[9][l]*f[27][l]+alpha_vdim[10][l]*f[26][l]+f[11][l]*alpha_vdim[25][l]+alpha_vdim[12][l]*f[24][l]+alpha_vdim[13][l]*f[23][l]+f[14][l]*alpha_vdim[22][l]);
+    out[150][l] += 0.2190890230020664*(f[51][l]*alpha_vdim[606][l]+f[157][l]*alpha_vdim[603][l])+0.2449489742783178*(f[65][l]*alpha_vdim[603][l]+f[100][l]*alpha_vdim[572][l])+(0.2190890230020664*f[97][l]+0.2449489742783178*f[24][l])*alpha_vdim[546][l]+(0.2190890230020664*f[98][l]+0.2449489742783178*f[23][l])*alpha_vdim[545][l]+(0.2190890230020664*f[204][l]+0.2449489742783178*(f[128][l]+f[123][l])+0.273861278752583*f[41][l])*alpha_vdim[543][l]+(0.2190890230020664*f[205][l]+0.2449489742783178*(f[127][l]+f[124][l])+0.273861278752583*f[40][l])*alpha_vdim[542][l]+0.2449489742783178*f[51][l]*(alpha_vdim[524][l]+alpha_vdim[523][l])+(0.2449489742783178*f[157][l]+0.273861278752583*f[65][l])*alpha_vdim[520][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[65][l])*alpha_vdim[519][l]+(0.2449489742783178*f[155][l]+0.273861278752583*f[67][l])*alpha_vdim[518][l]+(0.2449489742783178*f[156][l]+0.273861278752583*f[66][l])*alpha_vdim[517][l]+(0.2190890230020664*f[152][l]+0.2449489742783178*(f[62][l]+f[61][l])+0.273861278752583*f[11][l])*alpha_vdim[508][l]+(0.2190890230020664*f[232][l]+0.2449489742783178*(f[185][l]+f[184][l]+f[183][l])+0.273861278752583*(f[91][l]+f[90][l]+f[89][l])+0.3061862178478971*f[19][l])*alpha_vdim[507][l]+0.273861278752583*f[100][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.2449489742783178*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[496][l]+(0.2449489742783178*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[495][l]+(0.2449489742783178*f[205][l]+0.273861278752583*(f[127][l]+f[124][l])+0.3061862178478971*f[40][l])*alpha_vdim[494][l]+(0.2449489742783178*f[204][l]+0.273861278752583*(f[128][l]+f[123][l])+0.3061862178478971*f[41][l])*alpha_vdim[493][l]+(0.2449489742783178*f[203][l]+0.273861278752583*(f[126][l]+f[125][l])+0.3061862178478971*f[42][l])*alpha_vdim[492][l]+0.273861278752583*f[51][l]*alpha_vdim[490][l]+(0.273861278752583*f[157][l]+0.3061862178478971*f[65][l])*alpha_vdim[489][l]+(0.273861278752583*f[156][l]+0.3061862178478971*f[66][l])*alpha_vdim[488][l]+0.273861278752583*f[155][l]*alpha_vdim[487][l]+0.3061862178478971*(f[67][l]*alpha_vdim[487][l]+f[100][l]*alpha_vdim[486][l])+(0.4898979485566357*f[151][l]+0.5477225575051661*f[51][l])*alpha_vdim[372][l]+0.4898979485566357*f[149][l]*alpha_vdim[360][l]+0.5477225575051661*(f[53][l]*alpha_vdim[360][l]+f[96][l]*alpha_vdim[329][l])+(0.4898979485566357*f[198][l]+0.5477225575051661*(f[116][l]+f[97][l])+0.6123724356957944*f[24][l])*alpha_vdim[312][l]+(0.4898979485566357*f[199][l]+0.5477225575051661*(f[115][l]+f[98][l])+0.6123724356957944*f[23][l])*alpha_vdim[311][l]+(0.4898979485566357*f[193][l]+0.5477225575051661*(f[109][l]+f[104][l])+0.6123724356957944*f[29][l])*alpha_vdim[300][l]+(0.4898979485566357*f[194][l]+0.5477225575051661*(f[108][l]+f[105][l])+0.6123724356957944*f[28][l])*alpha_vdim[299][l]+(0.5477225575051661*f[151][l]+0.6123724356957944*f[51][l])*alpha_vdim[287][l]+(0.5477225575051661*f[151][l]+0.6123724356957944*f[51][l])*alpha_vdim[286][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[277][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[276][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[275][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[274][l]+(0.4898979485566357*f[226][l]+0.5477225575051661*(f[176][l]+f[175][l]+f[152][l])+0.6123724356957944*(f[85][l]+f[62][l]+f[61][l])+0.6846531968814573*f[11][l])*alpha_vdim[268][l]+(0.4898979485566357*f[222][l]+0.5477225575051661*(f[163][l]+f[162][l]+f[161][l])+0.6123724356957944*(f[76][l]+f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[264][l]+0.6123724356957944*f[96][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.5477225575051661*f[199][l]+0.6123724356957944*(f[115][l]+f[98][l])+0.6846531968814573*f[23][l])*alpha_vdim[256][l]+(0.5477225575051661*f[198][l]+0.6123724356957944*(f[116][l]+f[97][l])+0.6846531968814573*f[24][l])*alpha_vdim[255][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*(f[108][l]+f[105][l])+0.6846531968814573*f[28][l])*alpha_vdim[251][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*(f[109][l]+f[104][l])+0.6846531968814573*f[29][l])*alpha_vdim[250][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[249][l]+(0.6123724356957944*f[151][l]+0.6846531968814573*f[51][l])*alpha_vdim[248][l]+0.273861278752583*f[54][l]*alpha_cdim[247][l]+(0.6123724356957944*f[149][l]+0.6846531968814573*f[53][l])*alpha_vdim[246][l]+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[245][l]+0.6123724356957944*f[147][l]*alpha_vdim[244][l]+0.6846531968814573*(f[55][l]*alpha_vdim[244][l]+f[96][l]*alpha_vdim[243][l])+0.3061862178478971*f[111][l]*alpha_cdim[243][l]+0.2190890230020664*alpha_vdim[25][l]*f[234][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[217][l]+0.2190890230020664*alpha_vdim[69][l]*f[216][l]+0.2449489742783178*(alpha_vdim[12][l]*f[216][l]+alpha_vdim[6][l]*f[207][l]+alpha_vdim[25][l]*(f[190][l]+f[189][l]+f[183][l]))+(0.2190890230020664*alpha_vdim[129][l]+0.2449489742783178*(alpha_vdim[44][l]+alpha_vdim[43][l]))*f[179][l]+0.273861278752583*(alpha_vdim[5][l]*f[179][l]+alpha_cdim[3][l]*f[169][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[165][l]+(0.2449489742783178*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[164][l]+0.2190890230020664*alpha_vdim[22][l]*f[161][l]+(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[145][l]+0.2449489742783178*alpha_vdim[68][l]*f[144][l]+0.273861278752583*(alpha_vdim[13][l]*f[144][l]+alpha_vdim[6][l]*(f[133][l]+f[132][l]))+0.2449489742783178*f[65][l]*alpha_vdim[129][l]+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[124][l]+(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[123][l]+0.2190890230020664*f[53][l]*alpha_vdim[120][l]+0.3061862178478971*alpha_cdim[0][l]*f[112][l]+(0.2449489742783178*alpha_vdim[86][l]+0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[110][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[105][l]+(0.2190890230020664*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[104][l]+0.273861278752583*alpha_vdim[25][l]*(f[95][l]+f[90][l]+f[89][l])+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[78][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[77][l]+0.2449489742783178*alpha_vdim[22][l]*(f[75][l]+f[74][l])+0.273861278752583*(f[41][l]*alpha_vdim[69][l]+f[40][l]*alpha_vdim[68][l])+(0.273861278752583*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[65][l]+0.2449489742783178*(f[29][l]*alpha_vdim[60][l]+f[28][l]*alpha_vdim[59][l])+(0.2449489742783178*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.273861278752583*alpha_vdim[4][l])*f[53][l]+0.3061862178478971*(alpha_vdim[6][l]*f[46][l]+alpha_vdim[12][l]*f[41][l]+alpha_vdim[13][l]*f[40][l])+0.273861278752583*(alpha_vdim[9][l]*f[29][l]+alpha_vdim[10][l]*f[28][l])+0.3061862178478971*f[19][l]*alpha_vdim[25][l]+0.273861278752583*f[15][l]*alpha_vdim[22][l];
+    out[151][l] += (0.4898979485566357*f[150][l]+0.5477225575051661*f[52][l])*alpha_vdim[606][l]+0.4898979485566357*f[149][l]*alpha_vdim[603][l]+0.5477225575051661*(f[53][l]*alpha_vdim[603][l]+f[96][l]*alpha_vdim[572][l])+(0.4898979485566357*f[195][l]+0.5477225575051661*(f[112][l]+f[101][l])+0.6123724356957944*f[27][l])*alpha_vdim[546][l]+(0.4898979485566357*f[196][l]+0.5477225575051661*(f[111][l]+f[102][l])+0.6123724356957944*f[26][l])*alpha_vdim[545][l]+(0.4898979485566357*f[193][l]+0.5477225575051661*(f[109][l]+f[104][l])+0.6123724356957944*f[29][l])*alpha_vdim[543][l]+(0.4898979485566357*f[194][l]+0.5477225575051661*(f[108][l]+f[105][l])+0.6123724356957944*f[28][l])*alpha_vdim[542][l]+(0.5477225575051661*f[150][l]+0.6123724356957944*f[52][l])*alpha_vdim[524][l]+(0.5477225575051661*f[150][l]+0.6123724356957944*f[52][l])*alpha_vdim[523][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[520][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[519][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[518][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[517][l]+(0.4898979485566357*f[223][l]+0.5477225575051661*(f[167][l]+f[166][l]+f[158][l])+0.6123724356957944*(f[79][l]+f[71][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[508][l]+(0.4898979485566357*f[222][l]+0.5477225575051661*(f[163][l]+f[162][l]+f[161][l])+0.6123724356957944*(f[76][l]+f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[507][l]+0.6123724356957944*f[96][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.5477225575051661*f[196][l]+0.6123724356957944*(f[111][l]+f[102][l])+0.6846531968814573*f[26][l])*alpha_vdim[496][l]+(0.5477225575051661*f[195][l]+0.6123724356957944*(f[112][l]+f[101][l])+0.6846531968814573*f[27][l])*alpha_vdim[495][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*(f[108][l]+f[105][l])+0.6846531968814573*f[28][l])*alpha_vdim[494][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*(f[109][l]+f[104][l])+0.6846531968814573*f[29][l])*alpha_vdim[493][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[492][l]+(0.6123724356957944*f[150][l]+0.6846531968814573*f[52][l])*alpha_vdim[490][l]+(0.6123724356957944*f[149][l]+0.6846531968814573*f[53][l])*alpha_vdim[489][l]+(0.6123724356957944*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[488][l]+0.6123724356957944*f[147][l]*alpha_vdim[487][l]+0.6846531968814573*(f[55][l]*alpha_vdim[487][l]+f[96][l]*alpha_vdim[486][l])+0.2190890230020664*(f[52][l]*alpha_vdim[372][l]+f[172][l]*alpha_vdim[360][l])+0.2449489742783178*(f[80][l]*alpha_vdim[360][l]+f[113][l]*alpha_vdim[329][l])+(0.2190890230020664*f[101][l]+0.2449489742783178*f[27][l])*alpha_vdim[312][l]+(0.2190890230020664*f[102][l]+0.2449489742783178*f[26][l])*alpha_vdim[311][l]+(0.2190890230020664*f[211][l]+0.2449489742783178*(f[140][l]+f[135][l])+0.273861278752583*f[48][l])*alpha_vdim[300][l]+(0.2190890230020664*f[212][l]+0.2449489742783178*(f[139][l]+f[136][l])+0.273861278752583*f[47][l])*alpha_vdim[299][l]+0.2449489742783178*f[52][l]*(alpha_vdim[287][l]+alpha_vdim[286][l])+(0.2449489742783178*f[172][l]+0.273861278752583*f[80][l])*alpha_vdim[277][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[80][l])*alpha_vdim[276][l]+(0.2449489742783178*f[170][l]+0.273861278752583*f[82][l])*alpha_vdim[275][l]+(0.2449489742783178*f[171][l]+0.273861278752583*f[81][l])*alpha_vdim[274][l]+(0.2190890230020664*f[158][l]+0.2449489742783178*(f[71][l]+f[70][l])+0.273861278752583*f[14][l])*alpha_vdim[268][l]+(0.2190890230020664*f[233][l]+0.2449489742783178*(f[188][l]+f[187][l]+f[186][l])+0.273861278752583*(f[94][l]+f[93][l]+f[92][l])+0.3061862178478971*f[20][l])*alpha_vdim[264][l]+0.273861278752583*f[113][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.2449489742783178*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[256][l]+(0.2449489742783178*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[255][l]+(0.2449489742783178*f[212][l]+0.273861278752583*(f[139][l]+f[136][l])+0.3061862178478971*f[47][l])*alpha_vdim[251][l]+(0.2449489742783178*f[211][l]+0.273861278752583*(f[140][l]+f[135][l])+0.3061862178478971*f[48][l])*alpha_vdim[250][l]+(0.2449489742783178*f[210][l]+0.273861278752583*(f[138][l]+f[137][l])+0.3061862178478971*f[49][l])*alpha_vdim[249][l]+0.273861278752583*f[52][l]*alpha_vdim[248][l]+(0.273861278752583*f[180][l]+0.3061862178478971*f[81][l])*alpha_cdim[247][l]+(0.273861278752583*f[172][l]+0.3061862178478971*f[80][l])*alpha_vdim[246][l]+(0.273861278752583*f[171][l]+0.3061862178478971*f[81][l])*alpha_vdim[245][l]+0.273861278752583*f[170][l]*alpha_vdim[244][l]+0.3061862178478971*(f[82][l]*alpha_vdim[244][l]+f[113][l]*alpha_vdim[243][l]+f[115][l]*alpha_cdim[243][l])+0.2190890230020664*alpha_vdim[22][l]*f[234][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[217][l]+0.2190890230020664*alpha_vdim[60][l]*f[216][l]+0.2449489742783178*(alpha_vdim[9][l]*f[216][l]+alpha_vdim[6][l]*f[213][l]+alpha_vdim[22][l]*(f[190][l]+f[189][l]+f[186][l]))+(0.2190890230020664*alpha_vdim[120][l]+0.2449489742783178*(alpha_vdim[38][l]+alpha_vdim[37][l]))*f[179][l]+0.273861278752583*(alpha_vdim[4][l]*f[179][l]+alpha_cdim[3][l]*f[178][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[174][l]+(0.2449489742783178*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[173][l]+0.2190890230020664*alpha_vdim[25][l]*f[161][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[145][l]+0.2449489742783178*alpha_vdim[59][l]*f[144][l]+0.273861278752583*(alpha_vdim[10][l]*f[144][l]+alpha_vdim[6][l]*(f[142][l]+f[141][l]))+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[136][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[135][l]+0.2190890230020664*f[53][l]*alpha_vdim[129][l]+0.2449489742783178*f[80][l]*alpha_vdim[120][l]+0.3061862178478971*alpha_cdim[0][l]*f[116][l]+(0.2449489742783178*alpha_vdim[86][l]+0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[114][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[105][l]+(0.2190890230020664*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[104][l]+0.273861278752583*alpha_vdim[22][l]*(f[95][l]+f[93][l]+f[92][l])+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[84][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[83][l]+(0.273861278752583*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])*f[80][l]+0.2449489742783178*(alpha_vdim[25][l]*(f[75][l]+f[74][l])+f[29][l]*alpha_vdim[69][l]+f[28][l]*alpha_vdim[68][l])+0.273861278752583*(f[48][l]*alpha_vdim[60][l]+f[47][l]*alpha_vdim[59][l])+(0.2449489742783178*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.273861278752583*alpha_vdim[5][l])*f[53][l]+0.3061862178478971*(alpha_vdim[6][l]*f[50][l]+alpha_vdim[9][l]*f[48][l]+alpha_vdim[10][l]*f[47][l])+0.273861278752583*(alpha_vdim[12][l]*f[29][l]+alpha_vdim[13][l]*f[28][l]+f[15][l]*alpha_vdim[25][l])+0.3061862178478971*f[20][l]*alpha_vdim[22][l];
+    out[152][l] += (0.1249739664685295*f[158][l]+0.1956151991089878*(f[71][l]+f[70][l])+0.3061862178478971*f[14][l])*alpha_vdim[372][l]+(0.1117801137765645*f[182][l]+0.1749635530559412*(f[88][l]+f[87][l])+0.1249739664685295*f[86][l]+0.273861278752583*f[18][l]+0.1956151991089878*(f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[360][l]+(0.1249739664685295*f[117][l]+0.1956151991089878*(f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[329][l]+(0.1749635530559412*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[312][l]+(0.1749635530559412*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[311][l]+(0.1564921592871903*f[119][l]+0.2449489742783178*f[35][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[300][l]+(0.1564921592871903*f[118][l]+0.2449489742783178*f[36][l]+0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[299][l]+(0.1956151991089878*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[287][l]+(0.1956151991089878*f[158][l]+0.3061862178478971*f[71][l])*alpha_vdim[286][l]+(0.1749635530559412*f[182][l]+0.273861278752583*f[87][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[277][l]+(0.1749635530559412*f[182][l]+0.273861278752583*f[88][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[276][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[275][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[274][l]+0.2449489742783178*f[52][l]*alpha_vdim[268][l]+(0.2190890230020664*f[58][l]+0.2449489742783178*f[6][l])*alpha_vdim[264][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[260][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[259][l]+0.273861278752583*(f[101][l]*alpha_vdim[256][l]+f[102][l]*alpha_vdim[255][l])+(0.2449489742783178*f[118][l]+0.273861278752583*f[31][l])*alpha_vdim[251][l]+(0.2449489742783178*f[119][l]+0.273861278752583*f[32][l])*alpha_vdim[250][l]+0.2449489742783178*f[21][l]*alpha_vdim[249][l]+0.3061862178478971*f[158][l]*alpha_vdim[248][l]+(0.6123724356957944*f[155][l]+0.6846531968814573*f[56][l])*alpha_cdim[247][l]+(0.273861278752583*f[182][l]+0.3061862178478971*f[86][l])*alpha_vdim[246][l]+0.273861278752583*(f[56][l]*alpha_vdim[245][l]+f[57][l]*alpha_vdim[244][l])+0.3061862178478971*f[117][l]*alpha_vdim[243][l]+0.6846531968814573*f[97][l]*alpha_cdim[243][l]+(0.1117801137765645*alpha_vdim[120][l]+0.1749635530559412*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.273861278752583*alpha_vdim[4][l])*f[183][l]+(0.1249739664685295*alpha_vdim[129][l]+0.1956151991089878*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[161][l]+0.6123724356957944*alpha_cdim[3][l]*f[154][l]+(0.1956151991089878*(f[75][l]+f[74][l])+0.3061862178478971*f[15][l])*alpha_vdim[129][l]+(0.1564921592871903*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[124][l]+(0.1564921592871903*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[123][l]+(0.1249739664685295*alpha_vdim[86][l]+0.1956151991089878*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[120][l]+(0.1749635530559412*(f[90][l]+f[89][l])+0.1249739664685295*f[86][l]+0.273861278752583*f[19][l]+0.1956151991089878*(f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[120][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[105][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[104][l]+0.6846531968814573*alpha_cdim[0][l]*f[98][l]+0.273861278752583*(alpha_vdim[37][l]*f[90][l]+alpha_vdim[38][l]*f[89][l])+(0.1956151991089878*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])*f[86][l]+0.1956151991089878*(f[38][l]+f[37][l])*alpha_vdim[86][l]+0.3061862178478971*(f[4][l]*alpha_vdim[86][l]+alpha_vdim[43][l]*f[75][l]+alpha_vdim[44][l]*f[74][l])+0.273861278752583*(f[28][l]*alpha_vdim[69][l]+f[29][l]*alpha_vdim[68][l])+0.2190890230020664*alpha_vdim[22][l]*f[65][l]+(0.1749635530559412*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[60][l]+(0.2449489742783178*f[40][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[60][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[59][l]+(0.2449489742783178*f[41][l]+0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[25][l]*f[53][l]+0.3061862178478971*(alpha_vdim[16][l]*f[38][l]+f[16][l]*alpha_vdim[38][l]+alpha_vdim[17][l]*f[37][l]+f[17][l]*alpha_vdim[37][l])+0.273861278752583*(alpha_vdim[9][l]*f[32][l]+f[9][l]*alpha_vdim[32][l]+alpha_vdim[10][l]*f[31][l]+f[10][l]*alpha_vdim[31][l])+0.2449489742783178*(alpha_vdim[6][l]*f[22][l]+f[6][l]*alpha_vdim[22][l]);
+    out[153][l] += (0.1749635530559412*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[372][l]+(0.1564921592871903*f[56][l]+0.2449489742783178*f[8][l])*alpha_vdim[360][l]+(0.1749635530559412*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[329][l]+0.2449489742783178*f[103][l]*alpha_vdim[312][l]+(0.1749635530559412*f[206][l]+0.273861278752583*f[131][l]+0.1956151991089878*f[130][l]+0.3061862178478971*f[45][l])*alpha_vdim[311][l]+0.2190890230020664*f[21][l]*alpha_vdim[300][l]+(0.1564921592871903*f[117][l]+0.2449489742783178*f[34][l]+0.1749635530559412*f[33][l])*alpha_vdim[299][l]+0.273861278752583*(f[3][l]*alpha_vdim[299][l]+f[159][l]*alpha_vdim[287][l])+(0.1956151991089878*f[159][l]+0.3061862178478971*f[73][l])*alpha_vdim[286][l]+0.2449489742783178*f[56][l]*alpha_vdim[277][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[276][l]+0.2449489742783178*f[58][l]*alpha_vdim[275][l]+(0.1749635530559412*f[182][l]+0.273861278752583*f[88][l]+0.1956151991089878*f[87][l]+0.3061862178478971*f[18][l])*alpha_vdim[274][l]+(0.2449489742783178*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[268][l]+(0.2190890230020664*f[57][l]+0.2449489742783178*f[7][l])*alpha_vdim[264][l]+0.273861278752583*f[118][l]*alpha_vdim[260][l]+(0.1956151991089878*f[118][l]+0.3061862178478971*f[36][l])*alpha_vdim[259][l]+(0.273861278752583*f[206][l]+0.3061862178478971*f[130][l])*alpha_vdim[256][l]+0.273861278752583*f[103][l]*alpha_vdim[255][l]+(0.2449489742783178*f[117][l]+0.273861278752583*f[33][l])*alpha_vdim[251][l]+0.2449489742783178*f[21][l]*alpha_vdim[250][l]+(0.2449489742783178*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[249][l]+0.3061862178478971*f[159][l]*alpha_vdim[248][l]+(0.273861278752583*f[184][l]+0.3061862178478971*f[87][l])*alpha_cdim[247][l]+0.273861278752583*f[56][l]*alpha_vdim[246][l]+(0.273861278752583*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[245][l]+0.273861278752583*f[58][l]*alpha_vdim[244][l]+0.3061862178478971*(f[118][l]*alpha_vdim[243][l]+f[121][l]*alpha_cdim[243][l])+(0.3499271061118826*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[203][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[192][l]+0.4898979485566357*alpha_vdim[22][l]*f[156][l]+(0.3499271061118826*alpha_vdim[120][l]+0.5477225575051661*alpha_vdim[38][l]+0.3912303982179757*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[155][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[152][l]+0.5477225575051661*alpha_vdim[25][l]*f[148][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l]+0.4374088826398531*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[147][l]+0.6123724356957944*f[55][l]*alpha_vdim[129][l]+0.5477225575051661*alpha_vdim[59][l]*f[126][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[125][l]+(0.5477225575051661*f[67][l]+0.3912303982179757*f[56][l]+0.6123724356957944*f[8][l])*alpha_vdim[120][l]+0.3912303982179757*alpha_vdim[59][l]*f[117][l]+0.6123724356957944*(alpha_vdim[10][l]*f[117][l]+alpha_vdim[68][l]*f[107][l])+(0.4374088826398531*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[13][l])*f[106][l]+(0.4898979485566357*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[100][l]+0.6846531968814573*alpha_cdim[0][l]*f[99][l]+0.5477225575051661*alpha_vdim[6][l]*f[98][l]+(0.3912303982179757*alpha_vdim[86][l]+0.6123724356957944*alpha_vdim[17][l]+0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[97][l]+0.5477225575051661*alpha_vdim[69][l]*f[96][l]+0.6123724356957944*(alpha_vdim[12][l]*f[96][l]+f[24][l]*alpha_vdim[86][l])+0.6846531968814573*f[30][l]*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[37][l]*f[67][l]+0.5477225575051661*alpha_vdim[22][l]*f[66][l]+0.6123724356957944*alpha_vdim[31][l]*f[62][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[61][l]+0.5477225575051661*f[21][l]*alpha_vdim[60][l]+(0.6123724356957944*(f[42][l]+f[34][l])+0.4374088826398531*f[33][l]+0.6846531968814573*f[3][l])*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[22][l]*f[57][l]+(0.6123724356957944*alpha_vdim[38][l]+0.4374088826398531*alpha_vdim[37][l])*f[56][l]+0.6846531968814573*(alpha_vdim[4][l]*f[56][l]+alpha_vdim[43][l]*f[55][l])+0.6123724356957944*alpha_vdim[25][l]*f[54][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[51][l]+0.6846531968814573*(f[8][l]*alpha_vdim[37][l]+alpha_vdim[10][l]*f[33][l]+f[11][l]*alpha_vdim[31][l]+alpha_vdim[16][l]*f[24][l])+0.6123724356957944*(alpha_vdim[6][l]*f[23][l]+f[7][l]*alpha_vdim[22][l]+alpha_vdim[9][l]*f[21][l]);
+    out[154][l] += (0.1749635530559412*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[372][l]+(0.1564921592871903*f[57][l]+0.2449489742783178*f[7][l])*alpha_vdim[360][l]+(0.1749635530559412*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[329][l]+(0.1749635530559412*f[206][l]+0.1956151991089878*f[131][l]+0.273861278752583*f[130][l]+0.3061862178478971*f[45][l])*alpha_vdim[312][l]+0.2449489742783178*f[103][l]*alpha_vdim[311][l]+(0.1564921592871903*f[117][l]+0.1749635530559412*f[34][l]+0.2449489742783178*f[33][l]+0.273861278752583*f[3][l])*alpha_vdim[300][l]+0.2190890230020664*f[21][l]*alpha_vdim[299][l]+(0.1956151991089878*f[160][l]+0.3061862178478971*f[72][l])*alpha_vdim[287][l]+0.273861278752583*f[160][l]*alpha_vdim[286][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[277][l]+0.2449489742783178*f[57][l]*alpha_vdim[276][l]+(0.1749635530559412*f[182][l]+0.1956151991089878*f[88][l]+0.273861278752583*f[87][l]+0.3061862178478971*f[18][l])*alpha_vdim[275][l]+0.2449489742783178*f[58][l]*alpha_vdim[274][l]+(0.2449489742783178*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[268][l]+(0.2190890230020664*f[56][l]+0.2449489742783178*f[8][l])*alpha_vdim[264][l]+(0.1956151991089878*f[119][l]+0.3061862178478971*f[35][l])*alpha_vdim[260][l]+0.273861278752583*(f[119][l]*alpha_vdim[259][l]+f[103][l]*alpha_vdim[256][l])+(0.273861278752583*f[206][l]+0.3061862178478971*f[131][l])*alpha_vdim[255][l]+0.2449489742783178*f[21][l]*alpha_vdim[251][l]+(0.2449489742783178*f[117][l]+0.273861278752583*f[34][l])*alpha_vdim[250][l]+(0.2449489742783178*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[249][l]+0.3061862178478971*f[160][l]*alpha_vdim[248][l]+(0.6123724356957944*f[157][l]+0.6846531968814573*f[58][l])*alpha_cdim[247][l]+0.273861278752583*(f[57][l]*alpha_vdim[246][l]+f[58][l]*alpha_vdim[245][l]+f[182][l]*alpha_vdim[244][l])+0.3061862178478971*(f[88][l]*alpha_vdim[244][l]+f[119][l]*alpha_vdim[243][l])+0.6846531968814573*f[99][l]*alpha_cdim[243][l]+(0.3499271061118826*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[203][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[192][l]+(0.3499271061118826*alpha_vdim[120][l]+0.3912303982179757*alpha_vdim[38][l]+0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[156][l]+0.4898979485566357*alpha_vdim[22][l]*f[155][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[152][l]+(0.3912303982179757*alpha_vdim[129][l]+0.4374088826398531*alpha_vdim[44][l]+0.6123724356957944*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[148][l]+0.5477225575051661*alpha_vdim[25][l]*f[147][l]+0.6123724356957944*f[54][l]*alpha_vdim[129][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[126][l]+0.5477225575051661*alpha_vdim[60][l]*f[125][l]+0.3061862178478971*alpha_cdim[0][l]*f[122][l]+(0.5477225575051661*f[66][l]+0.3912303982179757*f[57][l]+0.6123724356957944*f[7][l])*alpha_vdim[120][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[117][l]+(0.4374088826398531*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[107][l]+0.6123724356957944*alpha_vdim[69][l]*f[106][l]+(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[100][l]+(0.3912303982179757*alpha_vdim[86][l]+0.4374088826398531*alpha_vdim[17][l]+0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[98][l]+0.5477225575051661*(alpha_vdim[6][l]*f[97][l]+alpha_vdim[68][l]*f[96][l])+0.6123724356957944*(alpha_vdim[13][l]*f[96][l]+f[23][l]*alpha_vdim[86][l])+0.6846531968814573*f[30][l]*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[22][l]*f[67][l]+0.6123724356957944*alpha_vdim[38][l]*f[66][l]+(0.4374088826398531*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[62][l]+0.6123724356957944*alpha_vdim[32][l]*f[61][l]+(0.6123724356957944*f[42][l]+0.4374088826398531*f[34][l]+0.6123724356957944*f[33][l]+0.6846531968814573*f[3][l])*alpha_vdim[60][l]+0.5477225575051661*f[21][l]*alpha_vdim[59][l]+(0.4374088826398531*alpha_vdim[38][l]+0.6123724356957944*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[57][l]+0.5477225575051661*alpha_vdim[22][l]*f[56][l]+0.6123724356957944*alpha_vdim[25][l]*f[55][l]+0.6846531968814573*alpha_vdim[44][l]*f[54][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[51][l]+0.6846531968814573*(f[7][l]*alpha_vdim[38][l]+alpha_vdim[9][l]*f[34][l]+f[11][l]*alpha_vdim[32][l])+0.6123724356957944*alpha_vdim[6][l]*f[24][l]+0.6846531968814573*alpha_vdim[17][l]*f[23][l]+0.6123724356957944*(f[8][l]*alpha_vdim[22][l]+alpha_vdim[10][l]*f[21][l]);
+    out[155][l] += (0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[372][l]+(0.3499271061118826*f[153][l]+0.5477225575051661*f[64][l]+0.3912303982179757*f[59][l]+0.6123724356957944*f[10][l])*alpha_vdim[360][l]+(0.3912303982179757*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[329][l]+0.5477225575051661*f[96][l]*alpha_vdim[312][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l]+0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[311][l]+(0.4898979485566357*f[99][l]+0.5477225575051661*f[22][l])*alpha_vdim[300][l]+(0.3499271061118826*f[202][l]+0.5477225575051661*f[122][l]+0.3912303982179757*(f[121][l]+f[120][l])+0.6123724356957944*(f[39][l]+f[38][l])+0.4374088826398531*f[37][l]+0.6846531968814573*f[4][l])*alpha_vdim[299][l]+0.6123724356957944*f[147][l]*alpha_vdim[287][l]+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[286][l]+(0.5477225575051661*f[153][l]+0.6123724356957944*f[59][l])*alpha_vdim[277][l]+(0.3912303982179757*f[153][l]+0.6123724356957944*f[64][l]+0.4374088826398531*f[59][l]+0.6846531968814573*f[10][l])*alpha_vdim[276][l]+0.5477225575051661*f[51][l]*alpha_vdim[275][l]+(0.3912303982179757*f[152][l]+0.6123724356957944*f[62][l]+0.4374088826398531*f[61][l]+0.6846531968814573*f[11][l])*alpha_vdim[274][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[268][l]+(0.4898979485566357*f[154][l]+0.5477225575051661*(f[63][l]+f[60][l]))*alpha_vdim[264][l]+0.6123724356957944*(f[9][l]*alpha_vdim[264][l]+f[97][l]*alpha_vdim[260][l])+(0.4374088826398531*f[97][l]+0.6846531968814573*f[24][l])*alpha_vdim[259][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[256][l]+0.6123724356957944*f[96][l]*alpha_vdim[255][l]+(0.5477225575051661*f[202][l]+0.6123724356957944*(f[121][l]+f[120][l])+0.6846531968814573*f[37][l])*alpha_vdim[251][l]+(0.5477225575051661*f[99][l]+0.6123724356957944*f[22][l])*alpha_vdim[250][l]+(0.5477225575051661*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[249][l]+0.6846531968814573*f[147][l]*alpha_vdim[248][l]+0.273861278752583*f[61][l]*alpha_cdim[247][l]+(0.6123724356957944*f[153][l]+0.6846531968814573*f[59][l])*alpha_vdim[246][l]+(0.6123724356957944*f[152][l]+0.6846531968814573*f[61][l])*alpha_vdim[245][l]+0.6123724356957944*f[51][l]*alpha_vdim[244][l]+0.6846531968814573*f[97][l]*alpha_vdim[243][l]+0.3061862178478971*f[125][l]*alpha_cdim[243][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[207][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[183][l]+0.2449489742783178*alpha_vdim[25][l]*f[165][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l]+0.1956151991089878*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[164][l]+0.6123724356957944*alpha_cdim[3][l]*f[157][l]+0.273861278752583*alpha_vdim[68][l]*f[133][l]+(0.1956151991089878*alpha_vdim[68][l]+0.3061862178478971*alpha_vdim[13][l])*f[132][l]+0.273861278752583*f[78][l]*alpha_vdim[129][l]+0.2449489742783178*alpha_vdim[6][l]*f[124][l]+(0.1749635530559412*alpha_vdim[86][l]+0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[123][l]+(0.1564921592871903*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[120][l]+(0.1564921592871903*f[59][l]+0.2449489742783178*f[10][l])*alpha_vdim[120][l]+(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[110][l]+0.6846531968814573*alpha_cdim[0][l]*f[100][l]+0.273861278752583*alpha_vdim[31][l]*f[90][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[89][l]+0.273861278752583*f[41][l]*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[43][l]*f[78][l]+0.273861278752583*alpha_vdim[25][l]*f[77][l]+0.3061862178478971*f[46][l]*alpha_vdim[68][l]+(0.2449489742783178*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[65][l]+0.2190890230020664*(alpha_vdim[22][l]*f[60][l]+f[22][l]*alpha_vdim[60][l])+(0.2449489742783178*alpha_vdim[38][l]+0.1749635530559412*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[59][l]+(0.2449489742783178*f[38][l]+0.1749635530559412*f[37][l]+0.273861278752583*f[4][l])*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[16][l]*f[41][l]+0.273861278752583*(alpha_vdim[6][l]*f[40][l]+alpha_vdim[10][l]*f[37][l]+f[10][l]*alpha_vdim[37][l])+0.3061862178478971*f[19][l]*alpha_vdim[31][l]+0.2449489742783178*(alpha_vdim[9][l]*f[22][l]+f[9][l]*alpha_vdim[22][l]);
+    out[156][l] += (0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[372][l]+(0.3499271061118826*f[154][l]+0.5477225575051661*f[63][l]+0.3912303982179757*f[60][l]+0.6123724356957944*f[9][l])*alpha_vdim[360][l]+(0.3912303982179757*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[329][l]+(0.3912303982179757*f[192][l]+0.4374088826398531*f[107][l]+0.6123724356957944*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[312][l]+0.5477225575051661*f[96][l]*alpha_vdim[311][l]+(0.3499271061118826*f[202][l]+0.3912303982179757*f[122][l]+0.5477225575051661*f[121][l]+0.3912303982179757*f[120][l]+0.6123724356957944*f[39][l]+0.4374088826398531*f[38][l]+0.6123724356957944*f[37][l]+0.6846531968814573*f[4][l])*alpha_vdim[300][l]+(0.4898979485566357*f[99][l]+0.5477225575051661*f[22][l])*alpha_vdim[299][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[287][l]+0.6123724356957944*f[148][l]*alpha_vdim[286][l]+(0.3912303982179757*f[154][l]+0.6123724356957944*f[63][l]+0.4374088826398531*f[60][l]+0.6846531968814573*f[9][l])*alpha_vdim[277][l]+(0.5477225575051661*f[154][l]+0.6123724356957944*f[60][l])*alpha_vdim[276][l]+(0.3912303982179757*f[152][l]+0.4374088826398531*f[62][l]+0.6123724356957944*f[61][l]+0.6846531968814573*f[11][l])*alpha_vdim[275][l]+0.5477225575051661*f[51][l]*alpha_vdim[274][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[268][l]+(0.4898979485566357*f[153][l]+0.5477225575051661*(f[64][l]+f[59][l])+0.6123724356957944*f[10][l])*alpha_vdim[264][l]+(0.4374088826398531*f[98][l]+0.6846531968814573*f[23][l])*alpha_vdim[260][l]+0.6123724356957944*(f[98][l]*alpha_vdim[259][l]+f[96][l]*alpha_vdim[256][l])+(0.6123724356957944*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[255][l]+(0.5477225575051661*f[99][l]+0.6123724356957944*f[22][l])*alpha_vdim[251][l]+(0.5477225575051661*f[202][l]+0.6123724356957944*(f[122][l]+f[120][l])+0.6846531968814573*f[38][l])*alpha_vdim[250][l]+(0.5477225575051661*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[249][l]+0.6846531968814573*f[148][l]*alpha_vdim[248][l]+0.6123724356957944*f[51][l]*alpha_cdim[247][l]+(0.6123724356957944*f[154][l]+0.6846531968814573*f[60][l])*alpha_vdim[246][l]+0.6123724356957944*(f[51][l]*alpha_vdim[245][l]+f[152][l]*alpha_vdim[244][l])+0.6846531968814573*(f[62][l]*alpha_vdim[244][l]+f[98][l]*alpha_vdim[243][l]+f[100][l]*alpha_cdim[243][l])+0.1749635530559412*alpha_vdim[69][l]*f[207][l]+0.273861278752583*(alpha_vdim[12][l]*f[207][l]+alpha_cdim[3][l]*f[185][l])+(0.1749635530559412*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[183][l]+(0.1749635530559412*alpha_vdim[129][l]+0.1956151991089878*alpha_vdim[44][l]+0.273861278752583*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[165][l]+0.2449489742783178*alpha_vdim[25][l]*f[164][l]+(0.1956151991089878*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[133][l]+0.273861278752583*(alpha_vdim[69][l]*f[132][l]+f[77][l]*alpha_vdim[129][l])+0.3061862178478971*alpha_cdim[0][l]*f[126][l]+(0.1749635530559412*alpha_vdim[86][l]+0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[124][l]+0.2449489742783178*alpha_vdim[6][l]*f[123][l]+(0.1564921592871903*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[120][l]+(0.1564921592871903*f[60][l]+0.2449489742783178*f[9][l])*alpha_vdim[120][l]+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[110][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[90][l]+0.273861278752583*(alpha_vdim[32][l]*f[89][l]+f[40][l]*alpha_vdim[86][l]+alpha_vdim[25][l]*f[78][l])+0.3061862178478971*(alpha_vdim[44][l]*f[77][l]+f[46][l]*alpha_vdim[69][l])+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[65][l]+(0.1749635530559412*alpha_vdim[38][l]+0.2449489742783178*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[60][l]+(0.1749635530559412*f[38][l]+0.2449489742783178*f[37][l]+0.273861278752583*f[4][l])*alpha_vdim[60][l]+0.2190890230020664*(alpha_vdim[22][l]*f[59][l]+f[22][l]*alpha_vdim[59][l])+0.273861278752583*alpha_vdim[6][l]*f[41][l]+0.3061862178478971*alpha_vdim[17][l]*f[40][l]+0.273861278752583*(alpha_vdim[9][l]*f[38][l]+f[9][l]*alpha_vdim[38][l])+0.3061862178478971*f[19][l]*alpha_vdim[32][l]+0.2449489742783178*(alpha_vdim[10][l]*f[22][l]+f[10][l]*alpha_vdim[22][l]);
+    out[157][l] += 0.5477225575051661*f[149][l]*alpha_vdim[372][l]+0.4898979485566357*f[51][l]*alpha_vdim[360][l]+0.5477225575051661*f[99][l]*alpha_vdim[329][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[312][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[311][l]+(0.4898979485566357*f[97][l]+0.5477225575051661*f[24][l])*alpha_vdim[300][l]+(0.4898979485566357*f[98][l]+0.5477225575051661*f[23][l])*alpha_vdim[299][l]+0.6123724356957944*f[149][l]*(alpha_vdim[287][l]+alpha_vdim[286][l])+0.5477225575051661*f[51][l]*(alpha_vdim[277][l]+alpha_vdim[276][l])+(0.5477225575051661*f[153][l]+0.6123724356957944*f[64][l])*alpha_vdim[275][l]+(0.5477225575051661*f[154][l]+0.6123724356957944*f[63][l])*alpha_vdim[274][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[163][l]+f[162][l])+0.6846531968814573*f[76][l])*alpha_vdim[268][l]+(0.4898979485566357*f[152][l]+0.5477225575051661*(f[62][l]+f[61][l]))*alpha_vdim[264][l]+0.6123724356957944*(f[11][l]*alpha_vdim[264][l]+f[99][l]*(alpha_vdim[260][l]+alpha_vdim[259][l]))+(0.6123724356957944*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[256][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[255][l]+(0.5477225575051661*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[251][l]+(0.5477225575051661*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[250][l]+(0.5477225575051661*f[202][l]+0.6123724356957944*(f[122][l]+f[121][l]))*alpha_vdim[249][l]+0.6846531968814573*(f[39][l]*alpha_vdim[249][l]+f[149][l]*alpha_vdim[248][l])+0.273861278752583*f[63][l]*alpha_cdim[247][l]+0.6123724356957944*f[51][l]*alpha_vdim[246][l]+(0.6123724356957944*f[154][l]+0.6846531968814573*f[63][l])*alpha_vdim[245][l]+0.6123724356957944*f[153][l]*alpha_vdim[244][l]+0.6846531968814573*(f[64][l]*alpha_vdim[244][l]+f[99][l]*alpha_vdim[243][l])+0.3061862178478971*f[127][l]*alpha_cdim[243][l]+0.5477225575051661*(alpha_vdim[25][l]*f[223][l]+alpha_vdim[6][l]*f[203][l])+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[196][l]+0.5477225575051661*alpha_vdim[69][l]*f[195][l]+0.6123724356957944*(alpha_vdim[12][l]*f[195][l]+alpha_vdim[25][l]*(f[167][l]+f[166][l]))+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[156][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[155][l]+0.4898979485566357*alpha_vdim[22][l]*f[152][l]+(0.5477225575051661*alpha_vdim[129][l]+0.6123724356957944*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6846531968814573*alpha_vdim[5][l])*f[150][l]+0.3061862178478971*alpha_cdim[0][l]*f[128][l]+0.6123724356957944*alpha_vdim[6][l]*(f[126][l]+f[125][l])+0.4898979485566357*f[51][l]*alpha_vdim[120][l]+(0.6123724356957944*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[112][l]+(0.6123724356957944*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[13][l])*f[111][l]+(0.5477225575051661*alpha_vdim[86][l]+0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[100][l]+(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[98][l]+(0.4898979485566357*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[97][l]+0.6846531968814573*alpha_vdim[25][l]*f[79][l]+(0.6123724356957944*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[67][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[66][l]+0.5477225575051661*(alpha_vdim[22][l]*(f[62][l]+f[61][l])+f[24][l]*alpha_vdim[60][l]+f[23][l]*alpha_vdim[59][l])+(0.5477225575051661*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[51][l]+0.6846531968814573*alpha_vdim[6][l]*f[42][l]+0.6123724356957944*(alpha_vdim[9][l]*f[24][l]+alpha_vdim[10][l]*f[23][l]+f[11][l]*alpha_vdim[22][l]);
+    out[158][l] += (0.1249739664685295*f[152][l]+0.1956151991089878*(f[62][l]+f[61][l])+0.3061862178478971*f[11][l])*alpha_vdim[606][l]+(0.1117801137765645*f[182][l]+0.1749635530559412*(f[88][l]+f[87][l])+0.1249739664685295*f[86][l]+0.273861278752583*f[18][l]+0.1956151991089878*(f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[603][l]+(0.1249739664685295*f[117][l]+0.1956151991089878*(f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[572][l]+(0.1749635530559412*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[546][l]+(0.1749635530559412*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[545][l]+(0.1564921592871903*f[119][l]+0.2449489742783178*f[35][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[543][l]+(0.1564921592871903*f[118][l]+0.2449489742783178*f[36][l]+0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[542][l]+(0.1956151991089878*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[524][l]+(0.1956151991089878*f[152][l]+0.3061862178478971*f[62][l])*alpha_vdim[523][l]+(0.1749635530559412*f[182][l]+0.273861278752583*f[87][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[520][l]+(0.1749635530559412*f[182][l]+0.273861278752583*f[88][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[519][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[518][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[517][l]+0.2449489742783178*f[51][l]*alpha_vdim[508][l]+(0.2190890230020664*f[58][l]+0.2449489742783178*f[6][l])*alpha_vdim[507][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[503][l]+(0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[502][l]+0.273861278752583*(f[97][l]*alpha_vdim[496][l]+f[98][l]*alpha_vdim[495][l])+(0.2449489742783178*f[118][l]+0.273861278752583*f[31][l])*alpha_vdim[494][l]+(0.2449489742783178*f[119][l]+0.273861278752583*f[32][l])*alpha_vdim[493][l]+0.2449489742783178*f[21][l]*alpha_vdim[492][l]+0.3061862178478971*f[152][l]*alpha_vdim[490][l]+(0.273861278752583*f[182][l]+0.3061862178478971*f[86][l])*alpha_vdim[489][l]+0.273861278752583*(f[56][l]*alpha_vdim[488][l]+f[57][l]*alpha_vdim[487][l])+0.3061862178478971*f[117][l]*alpha_vdim[486][l]+0.6846531968814573*(f[147][l]*alpha_cdim[247][l]+f[101][l]*alpha_cdim[243][l])+(0.1117801137765645*alpha_vdim[129][l]+0.1749635530559412*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.273861278752583*alpha_vdim[5][l])*f[186][l]+(0.1249739664685295*alpha_vdim[120][l]+0.1956151991089878*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])*f[161][l]+0.6123724356957944*alpha_cdim[3][l]*f[160][l]+(0.1564921592871903*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[136][l]+(0.1564921592871903*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[135][l]+(0.1249739664685295*alpha_vdim[86][l]+0.1956151991089878*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[129][l]+(0.1749635530559412*(f[93][l]+f[92][l])+0.1249739664685295*f[86][l]+0.273861278752583*f[20][l]+0.1956151991089878*(f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[129][l]+(0.1956151991089878*(f[75][l]+f[74][l])+0.3061862178478971*f[15][l])*alpha_vdim[120][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[105][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[104][l]+0.6846531968814573*alpha_cdim[0][l]*f[102][l]+0.273861278752583*(alpha_vdim[43][l]*f[93][l]+alpha_vdim[44][l]*f[92][l])+(0.1956151991089878*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[86][l]+(0.1956151991089878*(f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[86][l]+0.2190890230020664*alpha_vdim[25][l]*f[80][l]+0.3061862178478971*(alpha_vdim[37][l]*f[75][l]+alpha_vdim[38][l]*f[74][l])+(0.1749635530559412*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[69][l]+(0.2449489742783178*f[47][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[69][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[68][l]+(0.2449489742783178*f[48][l]+0.1749635530559412*f[31][l])*alpha_vdim[68][l]+0.273861278752583*(f[2][l]*alpha_vdim[68][l]+f[28][l]*alpha_vdim[60][l]+f[29][l]*alpha_vdim[59][l])+0.2449489742783178*alpha_vdim[22][l]*f[53][l]+0.3061862178478971*(alpha_vdim[16][l]*f[44][l]+f[16][l]*alpha_vdim[44][l]+alpha_vdim[17][l]*f[43][l]+f[17][l]*alpha_vdim[43][l])+0.273861278752583*(alpha_vdim[12][l]*f[32][l]+f[12][l]*alpha_vdim[32][l]+alpha_vdim[13][l]*f[31][l]+f[13][l]*alpha_vdim[31][l])+0.2449489742783178*(alpha_vdim[6][l]*f[25][l]+f[6][l]*alpha_vdim[25][l]);
+    out[159][l] += (0.1749635530559412*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[606][l]+(0.1564921592871903*f[56][l]+0.2449489742783178*f[8][l])*alpha_vdim[603][l]+(0.1749635530559412*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[572][l]+0.2449489742783178*f[99][l]*alpha_vdim[546][l]+(0.1749635530559412*f[202][l]+0.273861278752583*f[122][l]+0.1956151991089878*f[121][l]+0.3061862178478971*f[39][l])*alpha_vdim[545][l]+0.2190890230020664*f[21][l]*alpha_vdim[543][l]+(0.1564921592871903*f[117][l]+0.2449489742783178*f[34][l]+0.1749635530559412*f[33][l])*alpha_vdim[542][l]+0.273861278752583*(f[3][l]*alpha_vdim[542][l]+f[153][l]*alpha_vdim[524][l])+(0.1956151991089878*f[153][l]+0.3061862178478971*f[64][l])*alpha_vdim[523][l]+0.2449489742783178*f[56][l]*alpha_vdim[520][l]+(0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[519][l]+0.2449489742783178*f[58][l]*alpha_vdim[518][l]+(0.1749635530559412*f[182][l]+0.273861278752583*f[88][l]+0.1956151991089878*f[87][l]+0.3061862178478971*f[18][l])*alpha_vdim[517][l]+(0.2449489742783178*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[508][l]+(0.2190890230020664*f[57][l]+0.2449489742783178*f[7][l])*alpha_vdim[507][l]+0.273861278752583*f[118][l]*alpha_vdim[503][l]+(0.1956151991089878*f[118][l]+0.3061862178478971*f[36][l])*alpha_vdim[502][l]+(0.273861278752583*f[202][l]+0.3061862178478971*f[121][l])*alpha_vdim[496][l]+0.273861278752583*f[99][l]*alpha_vdim[495][l]+(0.2449489742783178*f[117][l]+0.273861278752583*f[33][l])*alpha_vdim[494][l]+0.2449489742783178*f[21][l]*alpha_vdim[493][l]+(0.2449489742783178*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[492][l]+0.3061862178478971*f[153][l]*alpha_vdim[490][l]+0.273861278752583*f[56][l]*alpha_vdim[489][l]+(0.273861278752583*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[488][l]+0.273861278752583*f[58][l]*alpha_vdim[487][l]+0.3061862178478971*(f[118][l]*alpha_vdim[486][l]+f[162][l]*alpha_cdim[247][l]+f[130][l]*alpha_cdim[243][l])+(0.3499271061118826*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[210][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[192][l]+0.4898979485566357*alpha_vdim[25][l]*f[171][l]+(0.3499271061118826*alpha_vdim[129][l]+0.5477225575051661*alpha_vdim[44][l]+0.3912303982179757*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[170][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[158][l]+0.5477225575051661*alpha_vdim[22][l]*f[148][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l]+0.4374088826398531*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[147][l]+0.5477225575051661*alpha_vdim[68][l]*f[138][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[137][l]+(0.5477225575051661*f[82][l]+0.3912303982179757*f[56][l])*alpha_vdim[129][l]+0.6123724356957944*(f[8][l]*alpha_vdim[129][l]+f[55][l]*alpha_vdim[120][l])+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[117][l]+(0.4898979485566357*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[113][l]+alpha_vdim[59][l]*(0.6123724356957944*f[107][l]+0.4374088826398531*f[106][l])+0.6846531968814573*(alpha_vdim[10][l]*f[106][l]+alpha_cdim[0][l]*f[103][l])+0.5477225575051661*alpha_vdim[6][l]*f[102][l]+(0.3912303982179757*alpha_vdim[86][l]+0.6123724356957944*alpha_vdim[17][l]+0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[101][l]+0.5477225575051661*alpha_vdim[60][l]*f[96][l]+0.6123724356957944*(alpha_vdim[9][l]*f[96][l]+f[27][l]*alpha_vdim[86][l]+alpha_vdim[43][l]*f[82][l])+0.5477225575051661*alpha_vdim[25][l]*f[81][l]+0.6123724356957944*alpha_vdim[31][l]*f[71][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[70][l]+0.5477225575051661*f[21][l]*alpha_vdim[69][l]+(0.6123724356957944*(f[49][l]+f[34][l])+0.4374088826398531*f[33][l])*alpha_vdim[68][l]+0.6846531968814573*(f[3][l]*alpha_vdim[68][l]+f[30][l]*alpha_vdim[59][l])+0.5477225575051661*alpha_vdim[25][l]*f[57][l]+(0.6123724356957944*alpha_vdim[44][l]+0.4374088826398531*alpha_vdim[43][l])*f[56][l]+0.6846531968814573*(alpha_vdim[5][l]*f[56][l]+alpha_vdim[37][l]*f[55][l])+0.6123724356957944*alpha_vdim[22][l]*f[54][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[52][l]+0.6846531968814573*(f[8][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[33][l]+f[14][l]*alpha_vdim[31][l]+alpha_vdim[16][l]*f[27][l])+0.6123724356957944*(alpha_vdim[6][l]*f[26][l]+f[7][l]*alpha_vdim[25][l]+alpha_vdim[12][l]*f[21][l]);
+    out[160][l] += (0.1749635530559412*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[606][l]+(0.1564921592871903*f[57][l]+0.2449489742783178*f[7][l])*alpha_vdim[603][l]+(0.1749635530559412*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[572][l]+(0.1749635530559412*f[202][l]+0.1956151991089878*f[122][l]+0.273861278752583*f[121][l]+0.3061862178478971*f[39][l])*alpha_vdim[546][l]+0.2449489742783178*f[99][l]*alpha_vdim[545][l]+(0.1564921592871903*f[117][l]+0.1749635530559412*f[34][l]+0.2449489742783178*f[33][l]+0.273861278752583*f[3][l])*alpha_vdim[543][l]+0.2190890230020664*f[21][l]*alpha_vdim[542][l]+(0.1956151991089878*f[154][l]+0.3061862178478971*f[63][l])*alpha_vdim[524][l]+0.273861278752583*f[154][l]*alpha_vdim[523][l]+(0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[520][l]+0.2449489742783178*f[57][l]*alpha_vdim[519][l]+(0.1749635530559412*f[182][l]+0.1956151991089878*f[88][l]+0.273861278752583*f[87][l]+0.3061862178478971*f[18][l])*alpha_vdim[518][l]+0.2449489742783178*f[58][l]*alpha_vdim[517][l]+(0.2449489742783178*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[508][l]+(0.2190890230020664*f[56][l]+0.2449489742783178*f[8][l])*alpha_vdim[507][l]+(0.1956151991089878*f[119][l]+0.3061862178478971*f[35][l])*alpha_vdim[503][l]+0.273861278752583*(f[119][l]*alpha_vdim[502][l]+f[99][l]*alpha_vdim[496][l])+(0.273861278752583*f[202][l]+0.3061862178478971*f[122][l])*alpha_vdim[495][l]+0.2449489742783178*f[21][l]*alpha_vdim[494][l]+(0.2449489742783178*f[117][l]+0.273861278752583*f[34][l])*alpha_vdim[493][l]+(0.2449489742783178*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[492][l]+0.3061862178478971*f[154][l]*alpha_vdim[490][l]+0.273861278752583*(f[57][l]*alpha_vdim[489][l]+f[58][l]*alpha_vdim[488][l]+f[182][l]*alpha_vdim[487][l])+0.3061862178478971*(f[88][l]*alpha_vdim[487][l]+f[119][l]*alpha_vdim[486][l])+0.6846531968814573*(f[149][l]*alpha_cdim[247][l]+f[103][l]*alpha_cdim[243][l])+(0.3499271061118826*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[210][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[192][l]+(0.3499271061118826*alpha_vdim[129][l]+0.3912303982179757*alpha_vdim[44][l]+0.5477225575051661*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[171][l]+0.4898979485566357*alpha_vdim[25][l]*f[170][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[158][l]+(0.3912303982179757*alpha_vdim[120][l]+0.4374088826398531*alpha_vdim[38][l]+0.6123724356957944*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[148][l]+0.5477225575051661*alpha_vdim[22][l]*f[147][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[138][l]+0.5477225575051661*alpha_vdim[69][l]*f[137][l]+0.3061862178478971*alpha_cdim[0][l]*f[131][l]+(0.5477225575051661*f[81][l]+0.3912303982179757*f[57][l])*alpha_vdim[129][l]+0.6123724356957944*(f[7][l]*alpha_vdim[129][l]+f[54][l]*alpha_vdim[120][l])+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[117][l]+(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[113][l]+(0.4374088826398531*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[107][l]+0.6123724356957944*alpha_vdim[60][l]*f[106][l]+(0.3912303982179757*alpha_vdim[86][l]+0.4374088826398531*alpha_vdim[17][l]+0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[102][l]+0.5477225575051661*(alpha_vdim[6][l]*f[101][l]+alpha_vdim[59][l]*f[96][l])+0.6123724356957944*(alpha_vdim[10][l]*f[96][l]+f[26][l]*alpha_vdim[86][l])+0.5477225575051661*alpha_vdim[25][l]*f[82][l]+0.6123724356957944*alpha_vdim[44][l]*f[81][l]+(0.4374088826398531*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[71][l]+0.6123724356957944*alpha_vdim[32][l]*f[70][l]+(0.6123724356957944*f[49][l]+0.4374088826398531*f[34][l]+0.6123724356957944*f[33][l]+0.6846531968814573*f[3][l])*alpha_vdim[69][l]+0.5477225575051661*f[21][l]*alpha_vdim[68][l]+0.6846531968814573*f[30][l]*alpha_vdim[60][l]+(0.4374088826398531*alpha_vdim[44][l]+0.6123724356957944*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[57][l]+0.5477225575051661*alpha_vdim[25][l]*f[56][l]+0.6123724356957944*alpha_vdim[22][l]*f[55][l]+0.6846531968814573*alpha_vdim[38][l]*f[54][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[52][l]+0.6846531968814573*(f[7][l]*alpha_vdim[44][l]+alpha_vdim[12][l]*f[34][l]+f[14][l]*alpha_vdim[32][l])+0.6123724356957944*alpha_vdim[6][l]*f[27][l]+0.6846531968814573*alpha_vdim[17][l]*f[26][l]+0.6123724356957944*(f[8][l]*alpha_vdim[25][l]+alpha_vdim[13][l]*f[21][l]);
+    out[161][l] += (0.1117801137765645*f[183][l]+0.1749635530559412*(f[90][l]+f[89][l])+0.1249739664685295*f[86][l]+0.273861278752583*f[19][l]+0.1956151991089878*(f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[606][l]+(0.1249739664685295*f[152][l]+0.1956151991089878*(f[62][l]+f[61][l])+0.3061862178478971*f[11][l])*alpha_vdim[603][l]+(0.1249739664685295*f[120][l]+0.1956151991089878*(f[38][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[572][l]+(0.1564921592871903*f[124][l]+0.2449489742783178*f[40][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[546][l]+(0.1564921592871903*f[123][l]+0.2449489742783178*f[41][l]+0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[545][l]+(0.1749635530559412*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[543][l]+(0.1749635530559412*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[542][l]+(0.1749635530559412*f[183][l]+0.273861278752583*f[89][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[524][l]+(0.1749635530559412*f[183][l]+0.273861278752583*f[90][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[523][l]+(0.1956151991089878*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[520][l]+(0.1956151991089878*f[152][l]+0.3061862178478971*f[62][l])*alpha_vdim[519][l]+(0.1749635530559412*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[518][l]+(0.1749635530559412*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[517][l]+0.2190890230020664*f[65][l]*alpha_vdim[508][l]+0.2449489742783178*(f[6][l]*alpha_vdim[508][l]+f[51][l]*alpha_vdim[507][l])+(0.1956151991089878*f[120][l]+0.3061862178478971*f[37][l])*alpha_vdim[503][l]+(0.1956151991089878*f[120][l]+0.3061862178478971*f[38][l])*alpha_vdim[502][l]+(0.2449489742783178*f[123][l]+0.273861278752583*f[31][l])*alpha_vdim[496][l]+0.2449489742783178*f[124][l]*alpha_vdim[495][l]+0.273861278752583*(f[32][l]*alpha_vdim[495][l]+f[97][l]*alpha_vdim[494][l]+f[98][l]*alpha_vdim[493][l])+0.2449489742783178*f[22][l]*alpha_vdim[492][l]+0.273861278752583*f[183][l]*alpha_vdim[490][l]+0.3061862178478971*(f[86][l]*alpha_vdim[490][l]+f[152][l]*alpha_vdim[489][l])+0.273861278752583*(f[59][l]*alpha_vdim[488][l]+f[60][l]*alpha_vdim[487][l])+0.3061862178478971*f[120][l]*alpha_vdim[486][l]+(0.1117801137765645*f[186][l]+0.1749635530559412*(f[93][l]+f[92][l])+0.1249739664685295*f[86][l]+0.273861278752583*f[20][l]+0.1956151991089878*(f[17][l]+f[16][l])+0.3061862178478971*f[0][l])*alpha_vdim[372][l]+(0.1249739664685295*f[158][l]+0.1956151991089878*(f[71][l]+f[70][l])+0.3061862178478971*f[14][l])*alpha_vdim[360][l]+(0.1249739664685295*f[129][l]+0.1956151991089878*(f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[329][l]+(0.1564921592871903*f[136][l]+0.2449489742783178*f[47][l]+0.1749635530559412*f[32][l]+0.273861278752583*f[1][l])*alpha_vdim[312][l]+(0.1564921592871903*f[135][l]+0.2449489742783178*f[48][l]+0.1749635530559412*f[31][l]+0.273861278752583*f[2][l])*alpha_vdim[311][l]+(0.1749635530559412*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[300][l]+(0.1749635530559412*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[299][l]+(0.1749635530559412*f[186][l]+0.273861278752583*f[92][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[16][l])*alpha_vdim[287][l]+(0.1749635530559412*f[186][l]+0.273861278752583*f[93][l]+0.1956151991089878*f[86][l]+0.3061862178478971*f[17][l])*alpha_vdim[286][l]+(0.1956151991089878*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[277][l]+(0.1956151991089878*f[158][l]+0.3061862178478971*f[71][l])*alpha_vdim[276][l]+(0.1749635530559412*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[275][l]+(0.1749635530559412*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[274][l]+0.2190890230020664*f[80][l]*alpha_vdim[268][l]+0.2449489742783178*(f[6][l]*alpha_vdim[268][l]+f[52][l]*alpha_vdim[264][l])+(0.1956151991089878*f[129][l]+0.3061862178478971*f[43][l])*alpha_vdim[260][l]+(0.1956151991089878*f[129][l]+0.3061862178478971*f[44][l])*alpha_vdim[259][l]+(0.2449489742783178*f[135][l]+0.273861278752583*f[31][l])*alpha_vdim[256][l]+0.2449489742783178*f[136][l]*alpha_vdim[255][l]+0.273861278752583*(f[32][l]*alpha_vdim[255][l]+f[101][l]*alpha_vdim[251][l]+f[102][l]*alpha_vdim[250][l])+0.2449489742783178*f[25][l]*alpha_vdim[249][l]+(0.273861278752583*f[186][l]+0.3061862178478971*f[86][l])*alpha_vdim[248][l]+(0.6123724356957944*f[164][l]+0.6846531968814573*f[68][l])*alpha_cdim[247][l]+0.3061862178478971*f[158][l]*alpha_vdim[246][l]+0.273861278752583*(f[68][l]*alpha_vdim[245][l]+f[69][l]*alpha_vdim[244][l])+0.3061862178478971*f[129][l]*alpha_vdim[243][l]+0.6846531968814573*(f[104][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[148][l]+alpha_cdim[0][l]*f[105][l]);
+    out[162][l] += (0.1749635530559412*f[232][l]+0.273861278752583*f[185][l]+0.1956151991089878*f[182][l]+0.3061862178478971*f[88][l])*alpha_vdim[606][l]+(0.1749635530559412*f[152][l]+0.273861278752583*f[62][l])*alpha_vdim[603][l]+(0.1956151991089878*f[202][l]+0.3061862178478971*f[122][l])*alpha_vdim[572][l]+(0.2449489742783178*f[205][l]+0.273861278752583*f[119][l])*alpha_vdim[546][l]+(0.1749635530559412*f[204][l]+0.273861278752583*f[128][l]+0.1956151991089878*f[118][l]+0.3061862178478971*f[36][l])*alpha_vdim[545][l]+0.2449489742783178*f[98][l]*alpha_vdim[543][l]+(0.1749635530559412*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[542][l]+(0.273861278752583*f[232][l]+0.3061862178478971*f[182][l])*alpha_vdim[524][l]+(0.1749635530559412*f[184][l]+0.273861278752583*f[91][l]+0.1956151991089878*f[87][l]+0.3061862178478971*f[18][l])*alpha_vdim[523][l]+0.273861278752583*f[152][l]*alpha_vdim[520][l]+0.1749635530559412*f[61][l]*alpha_vdim[519][l]+0.273861278752583*(f[11][l]*alpha_vdim[519][l]+f[154][l]*alpha_vdim[518][l])+(0.1956151991089878*f[153][l]+0.3061862178478971*f[64][l])*alpha_vdim[517][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[58][l])*alpha_vdim[508][l]+0.2449489742783178*f[51][l]*alpha_vdim[507][l]+0.3061862178478971*f[202][l]*alpha_vdim[503][l]+(0.1956151991089878*f[121][l]+0.3061862178478971*f[39][l])*alpha_vdim[502][l]+(0.273861278752583*f[204][l]+0.3061862178478971*f[118][l])*alpha_vdim[496][l]+0.2449489742783178*f[127][l]*alpha_vdim[495][l]+0.273861278752583*(f[35][l]*alpha_vdim[495][l]+f[97][l]*alpha_vdim[494][l])+0.2449489742783178*f[23][l]*alpha_vdim[493][l]+0.273861278752583*f[99][l]*alpha_vdim[492][l]+(0.273861278752583*f[184][l]+0.3061862178478971*f[87][l])*alpha_vdim[490][l]+0.273861278752583*f[61][l]*alpha_vdim[489][l]+0.3061862178478971*f[153][l]*alpha_vdim[488][l]+0.273861278752583*f[63][l]*alpha_vdim[487][l]+0.3061862178478971*f[121][l]*alpha_vdim[486][l]+(0.1749635530559412*f[233][l]+0.273861278752583*f[188][l]+0.1956151991089878*f[182][l]+0.3061862178478971*f[88][l])*alpha_vdim[372][l]+(0.1749635530559412*f[158][l]+0.273861278752583*f[71][l])*alpha_vdim[360][l]+(0.1956151991089878*f[206][l]+0.3061862178478971*f[131][l])*alpha_vdim[329][l]+(0.2449489742783178*f[212][l]+0.273861278752583*f[119][l])*alpha_vdim[312][l]+(0.1749635530559412*f[211][l]+0.273861278752583*f[140][l]+0.1956151991089878*f[118][l]+0.3061862178478971*f[36][l])*alpha_vdim[311][l]+0.2449489742783178*f[102][l]*alpha_vdim[300][l]+(0.1749635530559412*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[299][l]+(0.273861278752583*f[233][l]+0.3061862178478971*f[182][l])*alpha_vdim[287][l]+(0.1749635530559412*f[187][l]+0.273861278752583*f[94][l]+0.1956151991089878*f[87][l]+0.3061862178478971*f[18][l])*alpha_vdim[286][l]+0.273861278752583*f[158][l]*alpha_vdim[277][l]+0.1749635530559412*f[70][l]*alpha_vdim[276][l]+0.273861278752583*(f[14][l]*alpha_vdim[276][l]+f[160][l]*alpha_vdim[275][l])+(0.1956151991089878*f[159][l]+0.3061862178478971*f[73][l])*alpha_vdim[274][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[58][l])*alpha_vdim[268][l]+0.2449489742783178*f[52][l]*alpha_vdim[264][l]+0.3061862178478971*f[206][l]*alpha_vdim[260][l]+(0.1956151991089878*f[130][l]+0.3061862178478971*f[45][l])*alpha_vdim[259][l]+(0.273861278752583*f[211][l]+0.3061862178478971*f[118][l])*alpha_vdim[256][l]+0.2449489742783178*f[139][l]*alpha_vdim[255][l]+0.273861278752583*(f[35][l]*alpha_vdim[255][l]+f[101][l]*alpha_vdim[251][l])+0.2449489742783178*f[26][l]*alpha_vdim[250][l]+0.273861278752583*f[103][l]*alpha_vdim[249][l]+(0.273861278752583*f[187][l]+0.3061862178478971*f[87][l])*alpha_vdim[248][l]+0.273861278752583*f[70][l]*alpha_vdim[246][l]+0.3061862178478971*f[159][l]*alpha_vdim[245][l]+0.273861278752583*f[72][l]*alpha_vdim[244][l]+0.3061862178478971*f[130][l]*alpha_vdim[243][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[226][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[223][l]+0.5477225575051661*alpha_vdim[69][l]*f[199][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[198][l]+0.5477225575051661*alpha_vdim[60][l]*f[196][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[195][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[192][l]+0.6123724356957944*alpha_vdim[129][l]*f[176][l]+0.3912303982179757*alpha_vdim[43][l]*f[175][l]+0.6123724356957944*(alpha_vdim[5][l]*f[175][l]+alpha_vdim[120][l]*f[167][l])+(0.3912303982179757*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[166][l]+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[38][l])*f[158][l]+(0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[44][l])*f[152][l]+0.5477225575051661*(alpha_vdim[25][l]*f[151][l]+alpha_vdim[22][l]*f[150][l])+0.6123724356957944*alpha_vdim[32][l]*f[148][l]+0.4374088826398531*alpha_vdim[31][l]*f[147][l]+0.6846531968814573*(alpha_vdim[2][l]*f[147][l]+f[62][l]*alpha_vdim[129][l]+f[71][l]*alpha_vdim[120][l])+0.6123724356957944*alpha_vdim[68][l]*f[116][l]+0.5477225575051661*alpha_vdim[12][l]*f[115][l]+0.6123724356957944*alpha_vdim[59][l]*f[112][l]+0.5477225575051661*alpha_vdim[9][l]*f[111][l]+0.6846531968814573*(alpha_cdim[0][l]*f[108][l]+alpha_vdim[86][l]*f[107][l])+(0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[106][l]+0.6123724356957944*alpha_vdim[60][l]*f[102][l]+(0.4374088826398531*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[10][l])*f[101][l]+0.6123724356957944*alpha_vdim[69][l]*f[98][l]+(0.4374088826398531*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[13][l])*f[97][l]+0.6123724356957944*(alpha_vdim[6][l]*f[96][l]+alpha_vdim[43][l]*f[85][l])+alpha_vdim[37][l]*(0.6123724356957944*f[79][l]+0.4374088826398531*f[70][l])+0.6846531968814573*(alpha_vdim[4][l]*f[70][l]+f[24][l]*alpha_vdim[68][l])+0.4374088826398531*alpha_vdim[43][l]*f[61][l]+0.6846531968814573*(alpha_vdim[5][l]*f[61][l]+f[27][l]*alpha_vdim[59][l]+alpha_vdim[31][l]*f[55][l])+0.6123724356957944*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[54][l]+alpha_vdim[22][l]*f[52][l]+alpha_vdim[25][l]*f[51][l])+0.6846531968814573*(f[11][l]*alpha_vdim[43][l]+f[14][l]*alpha_vdim[37][l]+alpha_vdim[16][l]*f[30][l])+0.6123724356957944*(alpha_vdim[9][l]*f[26][l]+alpha_vdim[12][l]*f[23][l]);
+    out[163][l] += (0.1749635530559412*f[232][l]+0.273861278752583*f[184][l]+0.1956151991089878*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[606][l]+(0.1749635530559412*f[152][l]+0.273861278752583*f[61][l])*alpha_vdim[603][l]+(0.1956151991089878*f[202][l]+0.3061862178478971*f[121][l])*alpha_vdim[572][l]+(0.1749635530559412*f[205][l]+0.273861278752583*f[127][l]+0.1956151991089878*f[119][l]+0.3061862178478971*f[35][l])*alpha_vdim[546][l]+(0.2449489742783178*f[204][l]+0.273861278752583*f[118][l])*alpha_vdim[545][l]+(0.1749635530559412*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[543][l]+0.2449489742783178*f[97][l]*alpha_vdim[542][l]+(0.1749635530559412*f[185][l]+0.273861278752583*f[91][l]+0.1956151991089878*f[88][l]+0.3061862178478971*f[18][l])*alpha_vdim[524][l]+(0.273861278752583*f[232][l]+0.3061862178478971*f[182][l])*alpha_vdim[523][l]+0.1749635530559412*f[62][l]*alpha_vdim[520][l]+0.273861278752583*(f[11][l]*alpha_vdim[520][l]+f[152][l]*alpha_vdim[519][l])+(0.1956151991089878*f[154][l]+0.3061862178478971*f[63][l])*alpha_vdim[518][l]+0.273861278752583*f[153][l]*alpha_vdim[517][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[58][l])*alpha_vdim[508][l]+0.2449489742783178*f[51][l]*alpha_vdim[507][l]+0.1956151991089878*f[122][l]*alpha_vdim[503][l]+0.3061862178478971*(f[39][l]*alpha_vdim[503][l]+f[202][l]*alpha_vdim[502][l])+(0.2449489742783178*f[128][l]+0.273861278752583*f[36][l])*alpha_vdim[496][l]+(0.273861278752583*f[205][l]+0.3061862178478971*f[119][l])*alpha_vdim[495][l]+0.2449489742783178*f[24][l]*alpha_vdim[494][l]+0.273861278752583*(f[98][l]*alpha_vdim[493][l]+f[99][l]*alpha_vdim[492][l])+(0.273861278752583*f[185][l]+0.3061862178478971*f[88][l])*alpha_vdim[490][l]+0.273861278752583*(f[62][l]*alpha_vdim[489][l]+f[64][l]*alpha_vdim[488][l])+0.3061862178478971*(f[154][l]*alpha_vdim[487][l]+f[122][l]*alpha_vdim[486][l])+(0.1749635530559412*f[233][l]+0.273861278752583*f[187][l]+0.1956151991089878*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[372][l]+(0.1749635530559412*f[158][l]+0.273861278752583*f[70][l])*alpha_vdim[360][l]+(0.1956151991089878*f[206][l]+0.3061862178478971*f[130][l])*alpha_vdim[329][l]+(0.1749635530559412*f[212][l]+0.273861278752583*f[139][l]+0.1956151991089878*f[119][l]+0.3061862178478971*f[35][l])*alpha_vdim[312][l]+(0.2449489742783178*f[211][l]+0.273861278752583*f[118][l])*alpha_vdim[311][l]+(0.1749635530559412*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[300][l]+0.2449489742783178*f[101][l]*alpha_vdim[299][l]+(0.1749635530559412*f[188][l]+0.273861278752583*f[94][l]+0.1956151991089878*f[88][l]+0.3061862178478971*f[18][l])*alpha_vdim[287][l]+(0.273861278752583*f[233][l]+0.3061862178478971*f[182][l])*alpha_vdim[286][l]+0.1749635530559412*f[71][l]*alpha_vdim[277][l]+0.273861278752583*(f[14][l]*alpha_vdim[277][l]+f[158][l]*alpha_vdim[276][l])+(0.1956151991089878*f[160][l]+0.3061862178478971*f[72][l])*alpha_vdim[275][l]+0.273861278752583*f[159][l]*alpha_vdim[274][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[58][l])*alpha_vdim[268][l]+0.2449489742783178*f[52][l]*alpha_vdim[264][l]+0.1956151991089878*f[131][l]*alpha_vdim[260][l]+0.3061862178478971*(f[45][l]*alpha_vdim[260][l]+f[206][l]*alpha_vdim[259][l])+(0.2449489742783178*f[140][l]+0.273861278752583*f[36][l])*alpha_vdim[256][l]+(0.273861278752583*f[212][l]+0.3061862178478971*f[119][l])*alpha_vdim[255][l]+0.2449489742783178*f[27][l]*alpha_vdim[251][l]+0.273861278752583*(f[102][l]*alpha_vdim[250][l]+f[103][l]*alpha_vdim[249][l])+(0.273861278752583*f[188][l]+0.3061862178478971*f[88][l])*alpha_vdim[248][l]+(0.6123724356957944*f[169][l]+0.6846531968814573*f[73][l])*alpha_cdim[247][l]+0.273861278752583*(f[71][l]*alpha_vdim[246][l]+f[73][l]*alpha_vdim[245][l])+0.3061862178478971*(f[160][l]*alpha_vdim[244][l]+f[131][l]*alpha_vdim[243][l])+0.6846531968814573*f[109][l]*alpha_cdim[243][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[43][l])*f[226][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])*f[223][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[199][l]+0.5477225575051661*alpha_vdim[68][l]*f[198][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[196][l]+0.5477225575051661*alpha_vdim[59][l]*f[195][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[192][l]+0.3912303982179757*alpha_vdim[44][l]*f[176][l]+0.6123724356957944*(alpha_vdim[5][l]*f[176][l]+alpha_vdim[129][l]*f[175][l])+0.3912303982179757*alpha_vdim[38][l]*f[167][l]+0.6123724356957944*(alpha_vdim[4][l]*f[167][l]+alpha_vdim[120][l]*f[166][l])+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[37][l])*f[158][l]+(0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[43][l])*f[152][l]+0.5477225575051661*(alpha_vdim[25][l]*f[151][l]+alpha_vdim[22][l]*f[150][l])+(0.4374088826398531*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[148][l]+0.6123724356957944*alpha_vdim[31][l]*f[147][l]+0.6846531968814573*(f[61][l]*alpha_vdim[129][l]+f[70][l]*alpha_vdim[120][l])+0.5477225575051661*alpha_vdim[13][l]*f[116][l]+0.6123724356957944*alpha_vdim[69][l]*f[115][l]+0.5477225575051661*alpha_vdim[10][l]*f[112][l]+0.6123724356957944*alpha_vdim[60][l]*f[111][l]+0.4374088826398531*alpha_vdim[17][l]*f[107][l]+0.6846531968814573*(alpha_vdim[0][l]*f[107][l]+alpha_vdim[86][l]*f[106][l])+(0.4374088826398531*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[102][l]+0.6123724356957944*alpha_vdim[59][l]*f[101][l]+(0.4374088826398531*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[98][l]+0.6123724356957944*(alpha_vdim[68][l]*f[97][l]+alpha_vdim[6][l]*f[96][l]+alpha_vdim[44][l]*f[85][l])+alpha_vdim[38][l]*(0.6123724356957944*f[79][l]+0.4374088826398531*f[71][l])+0.6846531968814573*(alpha_vdim[4][l]*f[71][l]+f[23][l]*alpha_vdim[69][l])+0.4374088826398531*alpha_vdim[44][l]*f[62][l]+0.6846531968814573*(alpha_vdim[5][l]*f[62][l]+f[26][l]*alpha_vdim[60][l])+0.6123724356957944*alpha_vdim[2][l]*f[55][l]+0.6846531968814573*alpha_vdim[32][l]*f[54][l]+0.6123724356957944*(alpha_vdim[22][l]*f[52][l]+alpha_vdim[25][l]*f[51][l])+0.6846531968814573*(f[11][l]*alpha_vdim[44][l]+f[14][l]*alpha_vdim[38][l]+alpha_vdim[17][l]*f[30][l])+0.6123724356957944*(alpha_vdim[10][l]*f[27][l]+alpha_vdim[13][l]*f[24][l]);
+    out[164][l] += (0.1564921592871903*f[59][l]+0.2449489742783178*f[10][l])*alpha_vdim[606][l]+(0.1749635530559412*f[155][l]+0.273861278752583*f[67][l])*alpha_vdim[603][l]+(0.1749635530559412*f[123][l]+0.273861278752583*f[41][l])*alpha_vdim[572][l]+0.2190890230020664*f[22][l]*alpha_vdim[546][l]+(0.1564921592871903*f[120][l]+0.2449489742783178*f[38][l]+0.1749635530559412*f[37][l]+0.273861278752583*f[4][l])*alpha_vdim[545][l]+0.2449489742783178*f[100][l]*alpha_vdim[543][l]+(0.1749635530559412*f[203][l]+0.273861278752583*f[126][l]+0.1956151991089878*f[125][l]+0.3061862178478971*f[42][l])*alpha_vdim[542][l]+f[59][l]*(0.2449489742783178*alpha_vdim[524][l]+0.1749635530559412*alpha_vdim[523][l])+0.273861278752583*(f[10][l]*alpha_vdim[523][l]+f[155][l]*alpha_vdim[520][l])+(0.1956151991089878*f[155][l]+0.3061862178478971*f[67][l])*alpha_vdim[519][l]+0.2449489742783178*f[65][l]*alpha_vdim[518][l]+(0.1749635530559412*f[183][l]+0.273861278752583*f[90][l]+0.1956151991089878*f[89][l]+0.3061862178478971*f[19][l])*alpha_vdim[517][l]+0.2190890230020664*f[60][l]*alpha_vdim[508][l]+0.2449489742783178*(f[9][l]*alpha_vdim[508][l]+f[156][l]*alpha_vdim[507][l])+0.273861278752583*(f[66][l]*alpha_vdim[507][l]+f[123][l]*alpha_vdim[503][l])+(0.1956151991089878*f[123][l]+0.3061862178478971*f[41][l])*alpha_vdim[502][l]+(0.2449489742783178*f[120][l]+0.273861278752583*f[37][l])*alpha_vdim[496][l]+0.2449489742783178*f[22][l]*alpha_vdim[495][l]+(0.273861278752583*f[203][l]+0.3061862178478971*f[125][l])*alpha_vdim[494][l]+0.273861278752583*f[100][l]*alpha_vdim[493][l]+0.2449489742783178*f[124][l]*alpha_vdim[492][l]+0.273861278752583*(f[40][l]*alpha_vdim[492][l]+f[59][l]*alpha_vdim[490][l])+0.3061862178478971*f[155][l]*alpha_vdim[489][l]+(0.273861278752583*f[183][l]+0.3061862178478971*f[89][l])*alpha_vdim[488][l]+0.273861278752583*f[65][l]*alpha_vdim[487][l]+0.3061862178478971*f[123][l]*alpha_vdim[486][l]+(0.3499271061118826*f[173][l]+0.5477225575051661*f[84][l]+0.3912303982179757*f[59][l]+0.6123724356957944*f[10][l])*alpha_vdim[372][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[360][l]+(0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[329][l]+(0.4898979485566357*f[114][l]+0.5477225575051661*f[22][l])*alpha_vdim[312][l]+(0.3499271061118826*f[213][l]+0.5477225575051661*f[142][l]+0.3912303982179757*(f[141][l]+f[120][l])+0.6123724356957944*(f[50][l]+f[38][l])+0.4374088826398531*f[37][l]+0.6846531968814573*f[4][l])*alpha_vdim[311][l]+0.5477225575051661*f[96][l]*alpha_vdim[300][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l]+0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[299][l]+(0.5477225575051661*f[173][l]+0.6123724356957944*f[59][l])*alpha_vdim[287][l]+(0.3912303982179757*f[173][l]+0.6123724356957944*f[84][l]+0.4374088826398531*f[59][l]+0.6846531968814573*f[10][l])*alpha_vdim[286][l]+0.6123724356957944*f[147][l]*alpha_vdim[277][l]+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[276][l]+0.5477225575051661*f[53][l]*alpha_vdim[275][l]+(0.3912303982179757*f[161][l]+0.6123724356957944*f[75][l]+0.4374088826398531*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[274][l]+(0.4898979485566357*f[174][l]+0.5477225575051661*(f[83][l]+f[60][l])+0.6123724356957944*f[9][l])*alpha_vdim[268][l]+0.5477225575051661*f[148][l]*alpha_vdim[264][l]+0.6123724356957944*(f[54][l]*alpha_vdim[264][l]+f[104][l]*alpha_vdim[260][l])+(0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[259][l]+(0.5477225575051661*f[213][l]+0.6123724356957944*(f[141][l]+f[120][l])+0.6846531968814573*f[37][l])*alpha_vdim[256][l]+(0.5477225575051661*f[114][l]+0.6123724356957944*f[22][l])*alpha_vdim[255][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[251][l]+0.6123724356957944*f[96][l]*alpha_vdim[250][l]+(0.5477225575051661*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[249][l]+(0.6123724356957944*f[173][l]+0.6846531968814573*f[59][l])*alpha_vdim[248][l]+0.273861278752583*f[74][l]*alpha_cdim[247][l]+0.6846531968814573*f[147][l]*alpha_vdim[246][l]+(0.6123724356957944*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[245][l]+0.6123724356957944*f[53][l]*alpha_vdim[244][l]+0.6846531968814573*f[104][l]*alpha_vdim[243][l]+0.3061862178478971*f[132][l]*alpha_cdim[243][l]+0.6846531968814573*(alpha_cdim[3][l]*f[150][l]+alpha_cdim[0][l]*f[110][l]);
+    out[165][l] += (0.1564921592871903*f[60][l]+0.2449489742783178*f[9][l])*alpha_vdim[606][l]+(0.1749635530559412*f[156][l]+0.273861278752583*f[66][l])*alpha_vdim[603][l]+(0.1749635530559412*f[124][l]+0.273861278752583*f[40][l])*alpha_vdim[572][l]+(0.1564921592871903*f[120][l]+0.1749635530559412*f[38][l]+0.2449489742783178*f[37][l]+0.273861278752583*f[4][l])*alpha_vdim[546][l]+0.2190890230020664*f[22][l]*alpha_vdim[545][l]+(0.1749635530559412*f[203][l]+0.1956151991089878*f[126][l]+0.273861278752583*f[125][l]+0.3061862178478971*f[42][l])*alpha_vdim[543][l]+0.2449489742783178*f[100][l]*alpha_vdim[542][l]+(0.1749635530559412*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[524][l]+0.2449489742783178*f[60][l]*alpha_vdim[523][l]+(0.1956151991089878*f[156][l]+0.3061862178478971*f[66][l])*alpha_vdim[520][l]+0.273861278752583*f[156][l]*alpha_vdim[519][l]+(0.1749635530559412*f[183][l]+0.1956151991089878*f[90][l]+0.273861278752583*f[89][l]+0.3061862178478971*f[19][l])*alpha_vdim[518][l]+0.2449489742783178*f[65][l]*alpha_vdim[517][l]+(0.2190890230020664*f[59][l]+0.2449489742783178*f[10][l])*alpha_vdim[508][l]+(0.2449489742783178*f[155][l]+0.273861278752583*f[67][l])*alpha_vdim[507][l]+(0.1956151991089878*f[124][l]+0.3061862178478971*f[40][l])*alpha_vdim[503][l]+0.273861278752583*f[124][l]*alpha_vdim[502][l]+0.2449489742783178*(f[22][l]*alpha_vdim[496][l]+f[120][l]*alpha_vdim[495][l])+0.273861278752583*(f[38][l]*alpha_vdim[495][l]+f[100][l]*alpha_vdim[494][l])+(0.273861278752583*f[203][l]+0.3061862178478971*f[126][l])*alpha_vdim[493][l]+0.2449489742783178*f[123][l]*alpha_vdim[492][l]+0.273861278752583*(f[41][l]*alpha_vdim[492][l]+f[60][l]*alpha_vdim[490][l])+0.3061862178478971*f[156][l]*alpha_vdim[489][l]+0.273861278752583*(f[65][l]*alpha_vdim[488][l]+f[183][l]*alpha_vdim[487][l])+0.3061862178478971*(f[90][l]*alpha_vdim[487][l]+f[124][l]*alpha_vdim[486][l])+(0.3499271061118826*f[174][l]+0.5477225575051661*f[83][l]+0.3912303982179757*f[60][l]+0.6123724356957944*f[9][l])*alpha_vdim[372][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[360][l]+(0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[329][l]+(0.3499271061118826*f[213][l]+0.3912303982179757*f[142][l]+0.5477225575051661*f[141][l]+0.3912303982179757*f[120][l]+0.6123724356957944*f[50][l]+0.4374088826398531*f[38][l]+0.6123724356957944*f[37][l]+0.6846531968814573*f[4][l])*alpha_vdim[312][l]+(0.4898979485566357*f[114][l]+0.5477225575051661*f[22][l])*alpha_vdim[311][l]+(0.3912303982179757*f[192][l]+0.4374088826398531*f[107][l]+0.6123724356957944*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[300][l]+0.5477225575051661*f[96][l]*alpha_vdim[299][l]+(0.3912303982179757*f[174][l]+0.6123724356957944*f[83][l]+0.4374088826398531*f[60][l]+0.6846531968814573*f[9][l])*alpha_vdim[287][l]+(0.5477225575051661*f[174][l]+0.6123724356957944*f[60][l])*alpha_vdim[286][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[277][l]+0.6123724356957944*f[148][l]*alpha_vdim[276][l]+(0.3912303982179757*f[161][l]+0.4374088826398531*f[75][l]+0.6123724356957944*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[275][l]+0.5477225575051661*f[53][l]*alpha_vdim[274][l]+(0.4898979485566357*f[173][l]+0.5477225575051661*(f[84][l]+f[59][l])+0.6123724356957944*f[10][l])*alpha_vdim[268][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[264][l]+(0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[260][l]+0.6123724356957944*f[105][l]*alpha_vdim[259][l]+(0.5477225575051661*f[114][l]+0.6123724356957944*f[22][l])*alpha_vdim[256][l]+(0.5477225575051661*f[213][l]+0.6123724356957944*(f[142][l]+f[120][l])+0.6846531968814573*f[38][l])*alpha_vdim[255][l]+0.6123724356957944*f[96][l]*alpha_vdim[251][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[250][l]+(0.5477225575051661*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[249][l]+(0.6123724356957944*f[174][l]+0.6846531968814573*f[60][l])*alpha_vdim[248][l]+0.6123724356957944*f[53][l]*alpha_cdim[247][l]+0.6846531968814573*f[148][l]*alpha_vdim[246][l]+0.6123724356957944*(f[53][l]*alpha_vdim[245][l]+f[161][l]*alpha_vdim[244][l])+0.6846531968814573*(f[75][l]*alpha_vdim[244][l]+f[105][l]*alpha_vdim[243][l]+f[110][l]*alpha_cdim[243][l])+0.3061862178478971*(alpha_cdim[3][l]*f[167][l]+alpha_cdim[0][l]*f[133][l]);
+    out[166][l] += (0.1749635530559412*f[152][l]+0.273861278752583*f[62][l])*alpha_vdim[606][l]+(0.1749635530559412*f[232][l]+0.273861278752583*f[185][l]+0.1956151991089878*f[183][l]+0.3061862178478971*f[90][l])*alpha_vdim[603][l]+(0.1956151991089878*f[203][l]+0.3061862178478971*f[126][l])*alpha_vdim[572][l]+0.2449489742783178*f[98][l]*alpha_vdim[546][l]+(0.1749635530559412*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[545][l]+(0.2449489742783178*f[205][l]+0.273861278752583*f[124][l])*alpha_vdim[543][l]+(0.1749635530559412*f[204][l]+0.273861278752583*f[128][l]+0.1956151991089878*f[123][l]+0.3061862178478971*f[41][l])*alpha_vdim[542][l]+0.273861278752583*f[152][l]*alpha_vdim[524][l]+(0.1749635530559412*f[61][l]+0.273861278752583*f[11][l])*alpha_vdim[523][l]+(0.273861278752583*f[232][l]+0.3061862178478971*f[183][l])*alpha_vdim[520][l]+(0.1749635530559412*f[184][l]+0.273861278752583*f[91][l]+0.1956151991089878*f[89][l]+0.3061862178478971*f[19][l])*alpha_vdim[519][l]+0.273861278752583*f[156][l]*alpha_vdim[518][l]+(0.1956151991089878*f[155][l]+0.3061862178478971*f[67][l])*alpha_vdim[517][l]+0.2449489742783178*f[51][l]*alpha_vdim[508][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[65][l])*alpha_vdim[507][l]+0.3061862178478971*f[203][l]*alpha_vdim[503][l]+(0.1956151991089878*f[125][l]+0.3061862178478971*f[42][l])*alpha_vdim[502][l]+0.273861278752583*f[97][l]*alpha_vdim[496][l]+0.2449489742783178*f[23][l]*alpha_vdim[495][l]+(0.273861278752583*f[204][l]+0.3061862178478971*f[123][l])*alpha_vdim[494][l]+0.2449489742783178*f[127][l]*alpha_vdim[493][l]+0.273861278752583*(f[40][l]*alpha_vdim[493][l]+f[100][l]*alpha_vdim[492][l]+f[61][l]*alpha_vdim[490][l]+f[184][l]*alpha_vdim[489][l])+0.3061862178478971*(f[89][l]*alpha_vdim[489][l]+f[155][l]*alpha_vdim[488][l])+0.273861278752583*f[66][l]*alpha_vdim[487][l]+0.3061862178478971*f[125][l]*alpha_vdim[486][l]+(0.3912303982179757*f[226][l]+0.6123724356957944*f[176][l]+0.4374088826398531*f[152][l]+0.6846531968814573*f[62][l])*alpha_vdim[372][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l]+0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[360][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[329][l]+(0.5477225575051661*f[199][l]+0.6123724356957944*f[98][l])*alpha_vdim[312][l]+(0.3912303982179757*f[198][l]+0.6123724356957944*f[116][l]+0.4374088826398531*f[97][l]+0.6846531968814573*f[24][l])*alpha_vdim[311][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[105][l])*alpha_vdim[300][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l]+0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[299][l]+(0.6123724356957944*f[226][l]+0.6846531968814573*f[152][l])*alpha_vdim[287][l]+(0.3912303982179757*f[175][l]+0.6123724356957944*f[85][l]+0.4374088826398531*f[61][l]+0.6846531968814573*f[11][l])*alpha_vdim[286][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[161][l])*alpha_vdim[277][l]+(0.3912303982179757*f[162][l]+0.6123724356957944*f[76][l]+0.4374088826398531*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[276][l]+0.6123724356957944*f[148][l]*alpha_vdim[275][l]+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[274][l]+(0.5477225575051661*f[151][l]+0.6123724356957944*f[51][l])*alpha_vdim[268][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[264][l]+0.6846531968814573*f[192][l]*alpha_vdim[260][l]+(0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[259][l]+(0.6123724356957944*f[198][l]+0.6846531968814573*f[97][l])*alpha_vdim[256][l]+(0.5477225575051661*f[115][l]+0.6123724356957944*f[23][l])*alpha_vdim[255][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[104][l])*alpha_vdim[251][l]+0.5477225575051661*f[108][l]*alpha_vdim[250][l]+0.6123724356957944*(f[28][l]*alpha_vdim[250][l]+f[96][l]*alpha_vdim[249][l])+(0.6123724356957944*f[175][l]+0.6846531968814573*f[61][l])*alpha_vdim[248][l]+0.6123724356957944*f[162][l]*alpha_vdim[246][l]+0.6846531968814573*(f[74][l]*alpha_vdim[246][l]+f[147][l]*alpha_vdim[245][l])+0.6123724356957944*f[54][l]*alpha_vdim[244][l]+0.6846531968814573*f[106][l]*alpha_vdim[243][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l])*f[234][l]+0.2449489742783178*alpha_vdim[69][l]*f[217][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[216][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[207][l]+0.273861278752583*alpha_vdim[129][l]*f[190][l]+(0.1749635530559412*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[189][l]+(0.1956151991089878*alpha_vdim[129][l]+0.3061862178478971*alpha_vdim[44][l])*f[183][l]+0.2449489742783178*alpha_vdim[25][l]*f[179][l]+0.6123724356957944*alpha_cdim[3][l]*f[168][l]+0.273861278752583*alpha_vdim[32][l]*f[165][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[164][l]+0.1749635530559412*alpha_vdim[120][l]*f[161][l]+0.273861278752583*(alpha_vdim[38][l]*f[161][l]+alpha_vdim[68][l]*f[145][l])+0.2449489742783178*alpha_vdim[12][l]*f[144][l]+0.3061862178478971*alpha_vdim[86][l]*f[133][l]+0.1956151991089878*alpha_vdim[16][l]*f[132][l]+0.3061862178478971*(alpha_vdim[0][l]*f[132][l]+f[90][l]*alpha_vdim[129][l])+0.273861278752583*alpha_vdim[69][l]*f[124][l]+(0.1956151991089878*alpha_vdim[68][l]+0.3061862178478971*alpha_vdim[13][l])*f[123][l]+0.273861278752583*f[75][l]*alpha_vdim[120][l]+0.6846531968814573*alpha_cdim[0][l]*f[111][l]+0.273861278752583*alpha_vdim[6][l]*f[110][l]+0.2449489742783178*alpha_vdim[60][l]*f[105][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[104][l]+alpha_vdim[43][l]*(0.273861278752583*f[95][l]+0.1956151991089878*f[89][l])+0.3061862178478971*(alpha_vdim[5][l]*f[89][l]+alpha_vdim[31][l]*f[78][l])+(0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[77][l]+(0.1749635530559412*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[74][l]+0.3061862178478971*f[41][l]*alpha_vdim[68][l]+0.273861278752583*(alpha_vdim[25][l]*f[65][l]+f[29][l]*alpha_vdim[59][l])+0.2449489742783178*alpha_vdim[22][l]*f[53][l]+0.3061862178478971*(alpha_vdim[16][l]*f[46][l]+f[19][l]*alpha_vdim[43][l])+0.273861278752583*(alpha_vdim[12][l]*f[40][l]+f[15][l]*alpha_vdim[37][l])+0.2449489742783178*alpha_vdim[9][l]*f[28][l];
+    out[167][l] += (0.1749635530559412*f[152][l]+0.273861278752583*f[61][l])*alpha_vdim[606][l]+(0.1749635530559412*f[232][l]+0.273861278752583*f[184][l]+0.1956151991089878*f[183][l]+0.3061862178478971*f[89][l])*alpha_vdim[603][l]+(0.1956151991089878*f[203][l]+0.3061862178478971*f[125][l])*alpha_vdim[572][l]+(0.1749635530559412*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[546][l]+0.2449489742783178*f[97][l]*alpha_vdim[545][l]+(0.1749635530559412*f[205][l]+0.273861278752583*f[127][l]+0.1956151991089878*f[124][l]+0.3061862178478971*f[40][l])*alpha_vdim[543][l]+(0.2449489742783178*f[204][l]+0.273861278752583*f[123][l])*alpha_vdim[542][l]+0.1749635530559412*f[62][l]*alpha_vdim[524][l]+0.273861278752583*(f[11][l]*alpha_vdim[524][l]+f[152][l]*alpha_vdim[523][l])+(0.1749635530559412*f[185][l]+0.273861278752583*f[91][l]+0.1956151991089878*f[90][l]+0.3061862178478971*f[19][l])*alpha_vdim[520][l]+(0.273861278752583*f[232][l]+0.3061862178478971*f[183][l])*alpha_vdim[519][l]+(0.1956151991089878*f[156][l]+0.3061862178478971*f[66][l])*alpha_vdim[518][l]+0.273861278752583*f[155][l]*alpha_vdim[517][l]+0.2449489742783178*f[51][l]*alpha_vdim[508][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[65][l])*alpha_vdim[507][l]+0.1956151991089878*f[126][l]*alpha_vdim[503][l]+0.3061862178478971*(f[42][l]*alpha_vdim[503][l]+f[203][l]*alpha_vdim[502][l])+0.2449489742783178*f[24][l]*alpha_vdim[496][l]+0.273861278752583*f[98][l]*alpha_vdim[495][l]+(0.2449489742783178*f[128][l]+0.273861278752583*f[41][l])*alpha_vdim[494][l]+(0.273861278752583*f[205][l]+0.3061862178478971*f[124][l])*alpha_vdim[493][l]+0.273861278752583*(f[100][l]*alpha_vdim[492][l]+f[62][l]*alpha_vdim[490][l])+(0.273861278752583*f[185][l]+0.3061862178478971*f[90][l])*alpha_vdim[489][l]+0.273861278752583*f[67][l]*alpha_vdim[488][l]+0.3061862178478971*(f[156][l]*alpha_vdim[487][l]+f[126][l]*alpha_vdim[486][l])+(0.3912303982179757*f[226][l]+0.6123724356957944*f[175][l]+0.4374088826398531*f[152][l]+0.6846531968814573*f[61][l])*alpha_vdim[372][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[162][l]+0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[360][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[329][l]+(0.3912303982179757*f[199][l]+0.6123724356957944*f[115][l]+0.4374088826398531*f[98][l]+0.6846531968814573*f[23][l])*alpha_vdim[312][l]+(0.5477225575051661*f[198][l]+0.6123724356957944*f[97][l])*alpha_vdim[311][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l]+0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[300][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[104][l])*alpha_vdim[299][l]+(0.3912303982179757*f[176][l]+0.6123724356957944*f[85][l]+0.4374088826398531*f[62][l]+0.6846531968814573*f[11][l])*alpha_vdim[287][l]+(0.6123724356957944*f[226][l]+0.6846531968814573*f[152][l])*alpha_vdim[286][l]+(0.3912303982179757*f[163][l]+0.6123724356957944*f[76][l]+0.4374088826398531*f[75][l]+0.6846531968814573*f[15][l])*alpha_vdim[277][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[161][l])*alpha_vdim[276][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[275][l]+0.6123724356957944*f[147][l]*alpha_vdim[274][l]+(0.5477225575051661*f[151][l]+0.6123724356957944*f[51][l])*alpha_vdim[268][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[264][l]+0.4374088826398531*f[107][l]*alpha_vdim[260][l]+0.6846531968814573*(f[30][l]*alpha_vdim[260][l]+f[192][l]*alpha_vdim[259][l])+(0.5477225575051661*f[116][l]+0.6123724356957944*f[24][l])*alpha_vdim[256][l]+(0.6123724356957944*f[199][l]+0.6846531968814573*f[98][l])*alpha_vdim[255][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[29][l])*alpha_vdim[251][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[105][l])*alpha_vdim[250][l]+0.6123724356957944*f[96][l]*alpha_vdim[249][l]+(0.6123724356957944*f[176][l]+0.6846531968814573*f[62][l])*alpha_vdim[248][l]+0.6123724356957944*f[55][l]*alpha_cdim[247][l]+(0.6123724356957944*f[163][l]+0.6846531968814573*f[75][l])*alpha_vdim[246][l]+0.6123724356957944*f[55][l]*alpha_vdim[245][l]+0.6846531968814573*(f[148][l]*alpha_vdim[244][l]+f[107][l]*alpha_vdim[243][l]+f[112][l]*alpha_cdim[243][l])+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[43][l])*f[234][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[217][l]+0.2449489742783178*alpha_vdim[68][l]*f[216][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[207][l]+0.1749635530559412*alpha_vdim[44][l]*f[190][l]+0.273861278752583*(alpha_vdim[5][l]*f[190][l]+alpha_vdim[129][l]*f[189][l])+(0.1956151991089878*alpha_vdim[129][l]+0.3061862178478971*alpha_vdim[43][l])*f[183][l]+0.2449489742783178*alpha_vdim[25][l]*f[179][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[165][l]+0.273861278752583*alpha_vdim[31][l]*f[164][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[37][l])*f[161][l]+0.2449489742783178*alpha_vdim[13][l]*f[145][l]+0.273861278752583*alpha_vdim[69][l]*f[144][l]+0.1956151991089878*alpha_vdim[17][l]*f[133][l]+0.3061862178478971*(alpha_vdim[0][l]*f[133][l]+alpha_vdim[86][l]*f[132][l]+f[89][l]*alpha_vdim[129][l])+(0.1956151991089878*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[124][l]+0.273861278752583*(alpha_vdim[68][l]*f[123][l]+f[74][l]*alpha_vdim[120][l]+alpha_vdim[6][l]*f[110][l])+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[105][l]+0.2449489742783178*alpha_vdim[59][l]*f[104][l]+0.273861278752583*alpha_vdim[44][l]*f[95][l]+(0.1956151991089878*alpha_vdim[44][l]+0.3061862178478971*alpha_vdim[5][l])*f[90][l]+0.273861278752583*alpha_vdim[2][l]*f[78][l]+0.3061862178478971*alpha_vdim[32][l]*f[77][l]+(0.1749635530559412*alpha_vdim[38][l]+0.273861278752583*alpha_vdim[4][l])*f[75][l]+0.3061862178478971*f[40][l]*alpha_vdim[69][l]+0.273861278752583*(alpha_vdim[25][l]*f[65][l]+f[28][l]*alpha_vdim[60][l])+0.2449489742783178*alpha_vdim[22][l]*f[53][l]+0.3061862178478971*(alpha_vdim[17][l]*f[46][l]+f[19][l]*alpha_vdim[44][l])+0.273861278752583*(alpha_vdim[13][l]*f[41][l]+f[15][l]*alpha_vdim[38][l])+0.2449489742783178*alpha_vdim[10][l]*f[29][l];
+    out[168][l] += 0.2449489742783178*(f[154][l]*alpha_vdim[606][l]+f[156][l]*alpha_vdim[603][l])+0.273861278752583*f[205][l]*alpha_vdim[572][l]+(0.2449489742783178*f[202][l]+0.273861278752583*f[122][l])*alpha_vdim[546][l]+0.2449489742783178*f[99][l]*alpha_vdim[545][l]+(0.2449489742783178*f[203][l]+0.273861278752583*f[126][l])*alpha_vdim[543][l]+0.2449489742783178*f[100][l]*alpha_vdim[542][l]+0.273861278752583*f[154][l]*alpha_vdim[524][l]+0.2449489742783178*f[63][l]*alpha_vdim[523][l]+0.273861278752583*f[156][l]*alpha_vdim[520][l]+0.2449489742783178*f[66][l]*alpha_vdim[519][l]+(0.273861278752583*f[232][l]+0.3061862178478971*f[185][l])*alpha_vdim[518][l]+0.273861278752583*f[157][l]*alpha_vdim[517][l]+(0.2449489742783178*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[508][l]+(0.2449489742783178*f[155][l]+0.273861278752583*f[67][l])*alpha_vdim[507][l]+0.3061862178478971*f[205][l]*alpha_vdim[503][l]+0.273861278752583*(f[127][l]*alpha_vdim[502][l]+f[99][l]*alpha_vdim[496][l])+0.2449489742783178*f[121][l]*alpha_vdim[495][l]+0.273861278752583*(f[39][l]*alpha_vdim[495][l]+f[100][l]*alpha_vdim[494][l])+(0.2449489742783178*f[125][l]+0.273861278752583*f[42][l])*alpha_vdim[493][l]+(0.273861278752583*f[204][l]+0.3061862178478971*f[128][l])*alpha_vdim[492][l]+0.273861278752583*(f[63][l]*alpha_vdim[490][l]+f[66][l]*alpha_vdim[489][l])+0.3061862178478971*f[157][l]*alpha_vdim[488][l]+0.273861278752583*f[184][l]*alpha_vdim[487][l]+0.3061862178478971*(f[91][l]*alpha_vdim[487][l]+f[127][l]*alpha_vdim[486][l])+(0.5477225575051661*f[228][l]+0.6123724356957944*f[154][l])*alpha_vdim[372][l]+0.5477225575051661*f[148][l]*alpha_vdim[360][l]+0.6123724356957944*f[194][l]*alpha_vdim[329][l]+(0.5477225575051661*f[238][l]+0.6123724356957944*(f[215][l]+f[202][l])+0.6846531968814573*f[122][l])*alpha_vdim[312][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[99][l])*alpha_vdim[311][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[300][l]+0.5477225575051661*f[96][l]*alpha_vdim[299][l]+(0.6123724356957944*f[228][l]+0.6846531968814573*f[154][l])*alpha_vdim[287][l]+0.5477225575051661*f[177][l]*alpha_vdim[286][l]+0.6123724356957944*(f[63][l]*alpha_vdim[286][l]+f[148][l]*alpha_vdim[277][l])+0.5477225575051661*f[54][l]*alpha_vdim[276][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[275][l]+0.6123724356957944*f[149][l]*alpha_vdim[274][l]+(0.5477225575051661*f[227][l]+0.6123724356957944*(f[178][l]+f[153][l])+0.6846531968814573*f[64][l])*alpha_vdim[268][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[264][l]+0.6846531968814573*f[194][l]*alpha_vdim[260][l]+0.6123724356957944*f[108][l]*alpha_vdim[259][l]+(0.6123724356957944*f[200][l]+0.6846531968814573*f[99][l])*alpha_vdim[256][l]+(0.5477225575051661*f[214][l]+0.6123724356957944*(f[143][l]+f[121][l])+0.6846531968814573*f[39][l])*alpha_vdim[255][l]+0.6123724356957944*f[96][l]*alpha_vdim[251][l]+(0.5477225575051661*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[250][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[249][l]+(0.6123724356957944*f[177][l]+0.6846531968814573*f[63][l])*alpha_vdim[248][l]+0.6123724356957944*f[54][l]*alpha_vdim[246][l]+0.6846531968814573*f[149][l]*alpha_vdim[245][l]+0.6123724356957944*f[162][l]*alpha_vdim[244][l]+0.6846531968814573*(f[76][l]*alpha_vdim[244][l]+f[108][l]*alpha_vdim[243][l])+0.5477225575051661*alpha_vdim[69][l]*f[239][l]+(0.5477225575051661*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[230][l]+0.5477225575051661*alpha_vdim[25][l]*f[229][l]+0.6123724356957944*(alpha_vdim[32][l]*f[223][l]+alpha_vdim[69][l]*f[219][l])+0.5477225575051661*alpha_vdim[12][l]*f[218][l]+0.6123724356957944*alpha_vdim[69][l]*f[203][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[201][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[196][l]+0.6123724356957944*alpha_vdim[6][l]*f[195][l]+0.5477225575051661*alpha_vdim[60][l]*f[192][l]+0.6123724356957944*alpha_vdim[25][l]*f[181][l]+(0.5477225575051661*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[180][l]+0.6846531968814573*alpha_vdim[32][l]*f[167][l]+0.6123724356957944*alpha_vdim[1][l]*f[166][l]+(0.6123724356957944*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[44][l])*f[156][l]+0.6123724356957944*alpha_vdim[25][l]*f[155][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[150][l]+(0.5477225575051661*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[148][l]+0.5477225575051661*alpha_vdim[22][l]*f[147][l]+0.6123724356957944*alpha_vdim[12][l]*f[146][l]+0.3061862178478971*alpha_cdim[0][l]*f[134][l]+0.6846531968814573*alpha_vdim[69][l]*f[126][l]+0.6123724356957944*alpha_vdim[12][l]*f[125][l]+0.6846531968814573*alpha_vdim[6][l]*f[112][l]+(0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[111][l]+0.6123724356957944*alpha_vdim[60][l]*f[107][l]+0.5477225575051661*alpha_vdim[9][l]*f[106][l]+(0.6123724356957944*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[13][l])*f[100][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[96][l]+0.273861278752583*alpha_cdim[3][l]*f[79][l]+0.6846531968814573*(alpha_vdim[1][l]*f[79][l]+alpha_vdim[25][l]*f[67][l])+(0.6123724356957944*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[66][l]+0.6123724356957944*alpha_vdim[22][l]*f[55][l]+(0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[54][l]+0.6846531968814573*alpha_vdim[12][l]*f[42][l]+0.6123724356957944*alpha_vdim[9][l]*f[30][l];
+    out[169][l] += 0.2449489742783178*(f[153][l]*alpha_vdim[606][l]+f[155][l]*alpha_vdim[603][l])+0.273861278752583*f[204][l]*alpha_vdim[572][l]+0.2449489742783178*f[99][l]*alpha_vdim[546][l]+(0.2449489742783178*f[202][l]+0.273861278752583*f[121][l])*alpha_vdim[545][l]+0.2449489742783178*f[100][l]*alpha_vdim[543][l]+(0.2449489742783178*f[203][l]+0.273861278752583*f[125][l])*alpha_vdim[542][l]+0.2449489742783178*f[64][l]*alpha_vdim[524][l]+0.273861278752583*f[153][l]*alpha_vdim[523][l]+0.2449489742783178*f[67][l]*alpha_vdim[520][l]+0.273861278752583*(f[155][l]*alpha_vdim[519][l]+f[157][l]*alpha_vdim[518][l])+(0.273861278752583*f[232][l]+0.3061862178478971*f[184][l])*alpha_vdim[517][l]+(0.2449489742783178*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[508][l]+0.2449489742783178*f[156][l]*alpha_vdim[507][l]+0.273861278752583*(f[66][l]*alpha_vdim[507][l]+f[128][l]*alpha_vdim[503][l])+0.3061862178478971*f[204][l]*alpha_vdim[502][l]+0.2449489742783178*f[122][l]*alpha_vdim[496][l]+0.273861278752583*(f[39][l]*alpha_vdim[496][l]+f[99][l]*alpha_vdim[495][l])+0.2449489742783178*f[126][l]*alpha_vdim[494][l]+0.273861278752583*(f[42][l]*alpha_vdim[494][l]+f[100][l]*alpha_vdim[493][l])+(0.273861278752583*f[205][l]+0.3061862178478971*f[127][l])*alpha_vdim[492][l]+0.273861278752583*(f[64][l]*alpha_vdim[490][l]+f[67][l]*alpha_vdim[489][l]+f[185][l]*alpha_vdim[488][l])+0.3061862178478971*(f[91][l]*alpha_vdim[488][l]+f[157][l]*alpha_vdim[487][l]+f[128][l]*alpha_vdim[486][l])+(0.5477225575051661*f[227][l]+0.6123724356957944*f[153][l])*alpha_vdim[372][l]+0.5477225575051661*f[147][l]*alpha_vdim[360][l]+0.6123724356957944*f[193][l]*alpha_vdim[329][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[99][l])*alpha_vdim[312][l]+(0.5477225575051661*f[238][l]+0.6123724356957944*(f[214][l]+f[202][l])+0.6846531968814573*f[121][l])*alpha_vdim[311][l]+0.5477225575051661*f[96][l]*alpha_vdim[300][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[299][l]+(0.5477225575051661*f[178][l]+0.6123724356957944*f[64][l])*alpha_vdim[287][l]+(0.6123724356957944*f[227][l]+0.6846531968814573*f[153][l])*alpha_vdim[286][l]+0.5477225575051661*f[55][l]*alpha_vdim[277][l]+0.6123724356957944*(f[147][l]*alpha_vdim[276][l]+f[149][l]*alpha_vdim[275][l])+(0.6123724356957944*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[274][l]+(0.5477225575051661*f[228][l]+0.6123724356957944*(f[177][l]+f[154][l])+0.6846531968814573*f[63][l])*alpha_vdim[268][l]+0.5477225575051661*f[148][l]*alpha_vdim[264][l]+0.6123724356957944*(f[54][l]*alpha_vdim[264][l]+f[109][l]*alpha_vdim[260][l])+0.6846531968814573*f[193][l]*alpha_vdim[259][l]+(0.5477225575051661*f[215][l]+0.6123724356957944*(f[143][l]+f[122][l])+0.6846531968814573*f[39][l])*alpha_vdim[256][l]+(0.6123724356957944*f[200][l]+0.6846531968814573*f[99][l])*alpha_vdim[255][l]+0.5477225575051661*f[107][l]*alpha_vdim[251][l]+0.6123724356957944*(f[30][l]*alpha_vdim[251][l]+f[96][l]*alpha_vdim[250][l])+(0.6123724356957944*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[249][l]+(0.6123724356957944*f[178][l]+0.6846531968814573*f[64][l])*alpha_vdim[248][l]+0.273861278752583*f[76][l]*alpha_cdim[247][l]+0.6123724356957944*(f[55][l]*alpha_vdim[246][l]+f[163][l]*alpha_vdim[245][l])+0.6846531968814573*(f[76][l]*alpha_vdim[245][l]+f[149][l]*alpha_vdim[244][l]+f[109][l]*alpha_vdim[243][l])+0.3061862178478971*f[134][l]*alpha_cdim[243][l]+0.5477225575051661*(alpha_vdim[68][l]*f[239][l]+alpha_vdim[25][l]*f[230][l]+alpha_vdim[129][l]*f[229][l])+0.6123724356957944*(alpha_vdim[43][l]*f[229][l]+alpha_vdim[31][l]*f[223][l])+0.5477225575051661*alpha_vdim[13][l]*f[219][l]+0.6123724356957944*alpha_vdim[68][l]*(f[218][l]+f[203][l])+0.5477225575051661*alpha_vdim[69][l]*f[201][l]+0.6123724356957944*(alpha_vdim[12][l]*f[201][l]+alpha_vdim[6][l]*f[196][l])+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[195][l]+0.5477225575051661*(alpha_vdim[59][l]*f[192][l]+alpha_vdim[44][l]*f[181][l])+0.6123724356957944*(alpha_vdim[5][l]*f[181][l]+alpha_vdim[25][l]*f[180][l]+alpha_vdim[2][l]*f[167][l])+0.6846531968814573*alpha_vdim[31][l]*f[166][l]+0.6123724356957944*alpha_vdim[25][l]*f[156][l]+(0.6123724356957944*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[43][l])*f[155][l]+(0.6123724356957944*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[150][l]+0.5477225575051661*(alpha_vdim[22][l]*f[148][l]+alpha_vdim[120][l]*f[147][l])+0.6123724356957944*(alpha_vdim[37][l]*f[147][l]+alpha_vdim[13][l]*(f[146][l]+f[126][l]))+0.6846531968814573*alpha_vdim[68][l]*f[125][l]+0.6123724356957944*alpha_vdim[17][l]*f[112][l]+0.6846531968814573*(alpha_vdim[0][l]*f[112][l]+alpha_vdim[6][l]*f[111][l])+0.5477225575051661*alpha_vdim[10][l]*f[107][l]+0.6123724356957944*alpha_vdim[59][l]*f[106][l]+(0.6123724356957944*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[100][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[96][l]+0.6846531968814573*alpha_vdim[2][l]*f[79][l]+0.6123724356957944*alpha_vdim[44][l]*f[67][l]+0.6846531968814573*(alpha_vdim[5][l]*f[67][l]+alpha_vdim[25][l]*f[66][l])+0.5477225575051661*alpha_vdim[38][l]*f[55][l]+0.6123724356957944*(alpha_vdim[4][l]*f[55][l]+alpha_vdim[22][l]*f[54][l])+0.6846531968814573*alpha_vdim[13][l]*f[42][l]+0.6123724356957944*alpha_vdim[10][l]*f[30][l];
+    out[170][l] += (0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[606][l]+(0.3499271061118826*f[159][l]+0.5477225575051661*f[73][l]+0.3912303982179757*f[68][l]+0.6123724356957944*f[13][l])*alpha_vdim[603][l]+(0.3912303982179757*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[572][l]+0.5477225575051661*f[96][l]*alpha_vdim[546][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l]+0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[545][l]+(0.4898979485566357*f[103][l]+0.5477225575051661*f[25][l])*alpha_vdim[543][l]+(0.3499271061118826*f[206][l]+0.5477225575051661*f[131][l]+0.3912303982179757*(f[130][l]+f[129][l])+0.6123724356957944*(f[45][l]+f[44][l])+0.4374088826398531*f[43][l]+0.6846531968814573*f[5][l])*alpha_vdim[542][l]+0.6123724356957944*f[147][l]*alpha_vdim[524][l]+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[523][l]+(0.5477225575051661*f[159][l]+0.6123724356957944*f[68][l])*alpha_vdim[520][l]+(0.3912303982179757*f[159][l]+0.6123724356957944*f[73][l]+0.4374088826398531*f[68][l]+0.6846531968814573*f[13][l])*alpha_vdim[519][l]+0.5477225575051661*f[52][l]*alpha_vdim[518][l]+(0.3912303982179757*f[158][l]+0.6123724356957944*f[71][l]+0.4374088826398531*f[70][l]+0.6846531968814573*f[14][l])*alpha_vdim[517][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[508][l]+(0.4898979485566357*f[160][l]+0.5477225575051661*(f[72][l]+f[69][l]))*alpha_vdim[507][l]+0.6123724356957944*(f[12][l]*alpha_vdim[507][l]+f[101][l]*alpha_vdim[503][l])+(0.4374088826398531*f[101][l]+0.6846531968814573*f[27][l])*alpha_vdim[502][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[496][l]+0.6123724356957944*f[96][l]*alpha_vdim[495][l]+(0.5477225575051661*f[206][l]+0.6123724356957944*(f[130][l]+f[129][l])+0.6846531968814573*f[43][l])*alpha_vdim[494][l]+(0.5477225575051661*f[103][l]+0.6123724356957944*f[25][l])*alpha_vdim[493][l]+(0.5477225575051661*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[492][l]+0.6846531968814573*f[147][l]*alpha_vdim[490][l]+(0.6123724356957944*f[159][l]+0.6846531968814573*f[68][l])*alpha_vdim[489][l]+(0.6123724356957944*f[158][l]+0.6846531968814573*f[70][l])*alpha_vdim[488][l]+0.6123724356957944*f[52][l]*alpha_vdim[487][l]+0.6846531968814573*f[101][l]*alpha_vdim[486][l]+0.3061862178478971*(f[175][l]*alpha_cdim[247][l]+f[137][l]*alpha_cdim[243][l])+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[213][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[186][l]+0.2449489742783178*alpha_vdim[22][l]*f[174][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l]+0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[173][l]+0.6123724356957944*alpha_cdim[3][l]*f[172][l]+0.273861278752583*alpha_vdim[59][l]*f[142][l]+(0.1956151991089878*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[141][l]+0.2449489742783178*alpha_vdim[6][l]*f[136][l]+(0.1749635530559412*alpha_vdim[86][l]+0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[135][l]+(0.1564921592871903*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[129][l]+(0.1564921592871903*f[68][l]+0.2449489742783178*f[13][l])*alpha_vdim[129][l]+0.273861278752583*f[84][l]*alpha_vdim[120][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[114][l]+0.6846531968814573*alpha_cdim[0][l]*f[113][l]+0.273861278752583*alpha_vdim[31][l]*f[93][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[92][l]+0.273861278752583*f[48][l]*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[37][l]*f[84][l]+0.273861278752583*alpha_vdim[22][l]*f[83][l]+(0.2449489742783178*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[80][l]+0.2190890230020664*(alpha_vdim[25][l]*f[69][l]+f[25][l]*alpha_vdim[69][l])+(0.2449489742783178*alpha_vdim[44][l]+0.1749635530559412*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[68][l]+(0.2449489742783178*f[44][l]+0.1749635530559412*f[43][l]+0.273861278752583*f[5][l])*alpha_vdim[68][l]+0.3061862178478971*(f[50][l]*alpha_vdim[59][l]+alpha_vdim[16][l]*f[48][l])+0.273861278752583*(alpha_vdim[6][l]*f[47][l]+alpha_vdim[13][l]*f[43][l]+f[13][l]*alpha_vdim[43][l])+0.3061862178478971*f[20][l]*alpha_vdim[31][l]+0.2449489742783178*(alpha_vdim[12][l]*f[25][l]+f[12][l]*alpha_vdim[25][l]);
+    out[171][l] += (0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[606][l]+(0.3499271061118826*f[160][l]+0.5477225575051661*f[72][l]+0.3912303982179757*f[69][l]+0.6123724356957944*f[12][l])*alpha_vdim[603][l]+(0.3912303982179757*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[572][l]+(0.3912303982179757*f[192][l]+0.4374088826398531*f[107][l]+0.6123724356957944*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[546][l]+0.5477225575051661*f[96][l]*alpha_vdim[545][l]+(0.3499271061118826*f[206][l]+0.3912303982179757*f[131][l]+0.5477225575051661*f[130][l]+0.3912303982179757*f[129][l]+0.6123724356957944*f[45][l]+0.4374088826398531*f[44][l]+0.6123724356957944*f[43][l]+0.6846531968814573*f[5][l])*alpha_vdim[543][l]+(0.4898979485566357*f[103][l]+0.5477225575051661*f[25][l])*alpha_vdim[542][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[524][l]+0.6123724356957944*f[148][l]*alpha_vdim[523][l]+(0.3912303982179757*f[160][l]+0.6123724356957944*f[72][l]+0.4374088826398531*f[69][l]+0.6846531968814573*f[12][l])*alpha_vdim[520][l]+(0.5477225575051661*f[160][l]+0.6123724356957944*f[69][l])*alpha_vdim[519][l]+(0.3912303982179757*f[158][l]+0.4374088826398531*f[71][l]+0.6123724356957944*f[70][l]+0.6846531968814573*f[14][l])*alpha_vdim[518][l]+0.5477225575051661*f[52][l]*alpha_vdim[517][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[508][l]+(0.4898979485566357*f[159][l]+0.5477225575051661*(f[73][l]+f[68][l])+0.6123724356957944*f[13][l])*alpha_vdim[507][l]+(0.4374088826398531*f[102][l]+0.6846531968814573*f[26][l])*alpha_vdim[503][l]+0.6123724356957944*(f[102][l]*alpha_vdim[502][l]+f[96][l]*alpha_vdim[496][l])+(0.6123724356957944*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[495][l]+(0.5477225575051661*f[103][l]+0.6123724356957944*f[25][l])*alpha_vdim[494][l]+(0.5477225575051661*f[206][l]+0.6123724356957944*(f[131][l]+f[129][l])+0.6846531968814573*f[44][l])*alpha_vdim[493][l]+(0.5477225575051661*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[492][l]+0.6846531968814573*f[148][l]*alpha_vdim[490][l]+(0.6123724356957944*f[160][l]+0.6846531968814573*f[69][l])*alpha_vdim[489][l]+0.6123724356957944*(f[52][l]*alpha_vdim[488][l]+f[158][l]*alpha_vdim[487][l])+0.6846531968814573*(f[71][l]*alpha_vdim[487][l]+f[102][l]*alpha_vdim[486][l]+f[151][l]*alpha_cdim[247][l]+f[113][l]*alpha_cdim[243][l])+0.1749635530559412*alpha_vdim[60][l]*f[213][l]+0.273861278752583*(alpha_vdim[9][l]*f[213][l]+alpha_cdim[3][l]*f[188][l])+(0.1749635530559412*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[186][l]+(0.1749635530559412*alpha_vdim[120][l]+0.1956151991089878*alpha_vdim[38][l]+0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[174][l]+0.2449489742783178*alpha_vdim[22][l]*f[173][l]+(0.1956151991089878*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[142][l]+0.273861278752583*alpha_vdim[60][l]*f[141][l]+0.3061862178478971*alpha_cdim[0][l]*f[138][l]+(0.1749635530559412*alpha_vdim[86][l]+0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[136][l]+0.2449489742783178*alpha_vdim[6][l]*f[135][l]+(0.1564921592871903*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[129][l]+(0.1564921592871903*f[69][l]+0.2449489742783178*f[12][l])*alpha_vdim[129][l]+0.273861278752583*f[83][l]*alpha_vdim[120][l]+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[114][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[93][l]+0.273861278752583*(alpha_vdim[32][l]*f[92][l]+f[47][l]*alpha_vdim[86][l]+alpha_vdim[22][l]*f[84][l])+0.3061862178478971*alpha_vdim[38][l]*f[83][l]+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[80][l]+(0.1749635530559412*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[69][l]+(0.1749635530559412*f[44][l]+0.2449489742783178*f[43][l]+0.273861278752583*f[5][l])*alpha_vdim[69][l]+0.2190890230020664*(alpha_vdim[25][l]*f[68][l]+f[25][l]*alpha_vdim[68][l])+0.3061862178478971*f[50][l]*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[6][l]*f[48][l]+0.3061862178478971*alpha_vdim[17][l]*f[47][l]+0.273861278752583*(alpha_vdim[12][l]*f[44][l]+f[12][l]*alpha_vdim[44][l])+0.3061862178478971*f[20][l]*alpha_vdim[32][l]+0.2449489742783178*(alpha_vdim[13][l]*f[25][l]+f[13][l]*alpha_vdim[25][l]);
+    out[172][l] += 0.5477225575051661*f[149][l]*alpha_vdim[606][l]+0.4898979485566357*f[52][l]*alpha_vdim[603][l]+0.5477225575051661*f[103][l]*alpha_vdim[572][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[546][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[545][l]+(0.4898979485566357*f[101][l]+0.5477225575051661*f[27][l])*alpha_vdim[543][l]+(0.4898979485566357*f[102][l]+0.5477225575051661*f[26][l])*alpha_vdim[542][l]+0.6123724356957944*f[149][l]*(alpha_vdim[524][l]+alpha_vdim[523][l])+0.5477225575051661*f[52][l]*(alpha_vdim[520][l]+alpha_vdim[519][l])+(0.5477225575051661*f[159][l]+0.6123724356957944*f[73][l])*alpha_vdim[518][l]+(0.5477225575051661*f[160][l]+0.6123724356957944*f[72][l])*alpha_vdim[517][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[163][l]+f[162][l])+0.6846531968814573*f[76][l])*alpha_vdim[508][l]+(0.4898979485566357*f[158][l]+0.5477225575051661*(f[71][l]+f[70][l]))*alpha_vdim[507][l]+0.6123724356957944*(f[14][l]*alpha_vdim[507][l]+f[103][l]*(alpha_vdim[503][l]+alpha_vdim[502][l]))+(0.6123724356957944*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[496][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[495][l]+(0.5477225575051661*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[494][l]+(0.5477225575051661*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[493][l]+(0.5477225575051661*f[206][l]+0.6123724356957944*(f[131][l]+f[130][l]))*alpha_vdim[492][l]+0.6846531968814573*(f[45][l]*alpha_vdim[492][l]+f[149][l]*alpha_vdim[490][l])+0.6123724356957944*f[52][l]*alpha_vdim[489][l]+(0.6123724356957944*f[160][l]+0.6846531968814573*f[72][l])*alpha_vdim[488][l]+0.6123724356957944*f[159][l]*alpha_vdim[487][l]+0.6846531968814573*(f[73][l]*alpha_vdim[487][l]+f[103][l]*alpha_vdim[486][l])+0.3061862178478971*(f[177][l]*alpha_cdim[247][l]+f[139][l]*alpha_cdim[243][l])+0.5477225575051661*(alpha_vdim[22][l]*f[226][l]+alpha_vdim[6][l]*f[210][l])+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[199][l]+0.5477225575051661*alpha_vdim[60][l]*f[198][l]+0.6123724356957944*(alpha_vdim[9][l]*f[198][l]+alpha_vdim[22][l]*(f[176][l]+f[175][l]))+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[171][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[170][l]+0.4898979485566357*alpha_vdim[25][l]*f[158][l]+(0.5477225575051661*alpha_vdim[120][l]+0.6123724356957944*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[151][l]+0.3061862178478971*alpha_cdim[0][l]*f[140][l]+0.6123724356957944*alpha_vdim[6][l]*(f[138][l]+f[137][l])+0.4898979485566357*f[52][l]*alpha_vdim[129][l]+(0.6123724356957944*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[116][l]+(0.6123724356957944*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[10][l])*f[115][l]+(0.5477225575051661*alpha_vdim[86][l]+0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[113][l]+(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[102][l]+(0.4898979485566357*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[101][l]+0.6846531968814573*alpha_vdim[22][l]*f[85][l]+(0.6123724356957944*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[82][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[81][l]+0.5477225575051661*(alpha_vdim[25][l]*(f[71][l]+f[70][l])+f[27][l]*alpha_vdim[69][l]+f[26][l]*alpha_vdim[68][l])+(0.5477225575051661*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[52][l]+0.6846531968814573*alpha_vdim[6][l]*f[49][l]+0.6123724356957944*(alpha_vdim[12][l]*f[27][l]+alpha_vdim[13][l]*f[26][l]+f[14][l]*alpha_vdim[25][l]);
+    out[173][l] += (0.3499271061118826*f[164][l]+0.5477225575051661*f[78][l]+0.3912303982179757*f[68][l]+0.6123724356957944*f[13][l])*alpha_vdim[606][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[603][l]+(0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[572][l]+(0.4898979485566357*f[110][l]+0.5477225575051661*f[25][l])*alpha_vdim[546][l]+(0.3499271061118826*f[207][l]+0.5477225575051661*f[133][l]+0.3912303982179757*(f[132][l]+f[129][l])+0.6123724356957944*(f[46][l]+f[44][l])+0.4374088826398531*f[43][l]+0.6846531968814573*f[5][l])*alpha_vdim[545][l]+0.5477225575051661*f[96][l]*alpha_vdim[543][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l]+0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[542][l]+(0.5477225575051661*f[164][l]+0.6123724356957944*f[68][l])*alpha_vdim[524][l]+(0.3912303982179757*f[164][l]+0.6123724356957944*f[78][l]+0.4374088826398531*f[68][l]+0.6846531968814573*f[13][l])*alpha_vdim[523][l]+0.6123724356957944*f[147][l]*alpha_vdim[520][l]+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[519][l]+0.5477225575051661*f[53][l]*alpha_vdim[518][l]+(0.3912303982179757*f[161][l]+0.6123724356957944*f[75][l]+0.4374088826398531*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[517][l]+(0.4898979485566357*f[165][l]+0.5477225575051661*(f[77][l]+f[69][l])+0.6123724356957944*f[12][l])*alpha_vdim[508][l]+0.5477225575051661*f[148][l]*alpha_vdim[507][l]+0.6123724356957944*(f[54][l]*alpha_vdim[507][l]+f[104][l]*alpha_vdim[503][l])+(0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[502][l]+(0.5477225575051661*f[207][l]+0.6123724356957944*(f[132][l]+f[129][l])+0.6846531968814573*f[43][l])*alpha_vdim[496][l]+(0.5477225575051661*f[110][l]+0.6123724356957944*f[25][l])*alpha_vdim[495][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[494][l]+0.6123724356957944*f[96][l]*alpha_vdim[493][l]+0.5477225575051661*f[105][l]*alpha_vdim[492][l]+0.6123724356957944*(f[28][l]*alpha_vdim[492][l]+f[164][l]*alpha_vdim[490][l])+0.6846531968814573*(f[68][l]*alpha_vdim[490][l]+f[147][l]*alpha_vdim[489][l])+(0.6123724356957944*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[488][l]+0.6123724356957944*f[53][l]*alpha_vdim[487][l]+0.6846531968814573*f[104][l]*alpha_vdim[486][l]+(0.1564921592871903*f[68][l]+0.2449489742783178*f[13][l])*alpha_vdim[372][l]+(0.1749635530559412*f[170][l]+0.273861278752583*f[82][l])*alpha_vdim[360][l]+(0.1749635530559412*f[135][l]+0.273861278752583*f[48][l])*alpha_vdim[329][l]+0.2190890230020664*f[25][l]*alpha_vdim[312][l]+(0.1564921592871903*f[129][l]+0.2449489742783178*f[44][l]+0.1749635530559412*f[43][l]+0.273861278752583*f[5][l])*alpha_vdim[311][l]+0.2449489742783178*f[113][l]*alpha_vdim[300][l]+(0.1749635530559412*f[210][l]+0.273861278752583*f[138][l]+0.1956151991089878*f[137][l]+0.3061862178478971*f[49][l])*alpha_vdim[299][l]+f[68][l]*(0.2449489742783178*alpha_vdim[287][l]+0.1749635530559412*alpha_vdim[286][l])+0.273861278752583*(f[13][l]*alpha_vdim[286][l]+f[170][l]*alpha_vdim[277][l])+(0.1956151991089878*f[170][l]+0.3061862178478971*f[82][l])*alpha_vdim[276][l]+0.2449489742783178*f[80][l]*alpha_vdim[275][l]+(0.1749635530559412*f[186][l]+0.273861278752583*f[93][l]+0.1956151991089878*f[92][l]+0.3061862178478971*f[20][l])*alpha_vdim[274][l]+0.2190890230020664*f[69][l]*alpha_vdim[268][l]+0.2449489742783178*(f[12][l]*alpha_vdim[268][l]+f[171][l]*alpha_vdim[264][l])+0.273861278752583*(f[81][l]*alpha_vdim[264][l]+f[135][l]*alpha_vdim[260][l])+(0.1956151991089878*f[135][l]+0.3061862178478971*f[48][l])*alpha_vdim[259][l]+(0.2449489742783178*f[129][l]+0.273861278752583*f[43][l])*alpha_vdim[256][l]+0.2449489742783178*f[25][l]*alpha_vdim[255][l]+(0.273861278752583*f[210][l]+0.3061862178478971*f[137][l])*alpha_vdim[251][l]+0.273861278752583*f[113][l]*alpha_vdim[250][l]+0.2449489742783178*f[136][l]*alpha_vdim[249][l]+0.273861278752583*(f[47][l]*alpha_vdim[249][l]+f[68][l]*alpha_vdim[248][l]+f[189][l]*alpha_cdim[247][l])+0.3061862178478971*(f[92][l]*alpha_cdim[247][l]+f[170][l]*alpha_vdim[246][l])+(0.273861278752583*f[186][l]+0.3061862178478971*f[92][l])*alpha_vdim[245][l]+0.273861278752583*f[80][l]*alpha_vdim[244][l]+0.3061862178478971*(f[135][l]*alpha_vdim[243][l]+f[141][l]*alpha_cdim[243][l])+0.6846531968814573*(alpha_cdim[3][l]*f[151][l]+alpha_cdim[0][l]*f[114][l]);
+    out[174][l] += (0.3499271061118826*f[165][l]+0.5477225575051661*f[77][l]+0.3912303982179757*f[69][l]+0.6123724356957944*f[12][l])*alpha_vdim[606][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[603][l]+(0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[572][l]+(0.3499271061118826*f[207][l]+0.3912303982179757*f[133][l]+0.5477225575051661*f[132][l]+0.3912303982179757*f[129][l]+0.6123724356957944*f[46][l]+0.4374088826398531*f[44][l]+0.6123724356957944*f[43][l]+0.6846531968814573*f[5][l])*alpha_vdim[546][l]+(0.4898979485566357*f[110][l]+0.5477225575051661*f[25][l])*alpha_vdim[545][l]+(0.3912303982179757*f[192][l]+0.4374088826398531*f[107][l]+0.6123724356957944*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[543][l]+0.5477225575051661*f[96][l]*alpha_vdim[542][l]+(0.3912303982179757*f[165][l]+0.6123724356957944*f[77][l]+0.4374088826398531*f[69][l]+0.6846531968814573*f[12][l])*alpha_vdim[524][l]+(0.5477225575051661*f[165][l]+0.6123724356957944*f[69][l])*alpha_vdim[523][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[520][l]+0.6123724356957944*f[148][l]*alpha_vdim[519][l]+(0.3912303982179757*f[161][l]+0.4374088826398531*f[75][l]+0.6123724356957944*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[518][l]+0.5477225575051661*f[53][l]*alpha_vdim[517][l]+(0.4898979485566357*f[164][l]+0.5477225575051661*(f[78][l]+f[68][l])+0.6123724356957944*f[13][l])*alpha_vdim[508][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[507][l]+(0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[503][l]+0.6123724356957944*f[105][l]*alpha_vdim[502][l]+(0.5477225575051661*f[110][l]+0.6123724356957944*f[25][l])*alpha_vdim[496][l]+(0.5477225575051661*f[207][l]+0.6123724356957944*(f[133][l]+f[129][l])+0.6846531968814573*f[44][l])*alpha_vdim[495][l]+0.6123724356957944*f[96][l]*alpha_vdim[494][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[493][l]+0.5477225575051661*f[104][l]*alpha_vdim[492][l]+0.6123724356957944*(f[29][l]*alpha_vdim[492][l]+f[165][l]*alpha_vdim[490][l])+0.6846531968814573*(f[69][l]*alpha_vdim[490][l]+f[148][l]*alpha_vdim[489][l])+0.6123724356957944*(f[53][l]*alpha_vdim[488][l]+f[161][l]*alpha_vdim[487][l])+0.6846531968814573*(f[75][l]*alpha_vdim[487][l]+f[105][l]*alpha_vdim[486][l])+(0.1564921592871903*f[69][l]+0.2449489742783178*f[12][l])*alpha_vdim[372][l]+(0.1749635530559412*f[171][l]+0.273861278752583*f[81][l])*alpha_vdim[360][l]+(0.1749635530559412*f[136][l]+0.273861278752583*f[47][l])*alpha_vdim[329][l]+(0.1564921592871903*f[129][l]+0.1749635530559412*f[44][l]+0.2449489742783178*f[43][l]+0.273861278752583*f[5][l])*alpha_vdim[312][l]+0.2190890230020664*f[25][l]*alpha_vdim[311][l]+(0.1749635530559412*f[210][l]+0.1956151991089878*f[138][l]+0.273861278752583*f[137][l]+0.3061862178478971*f[49][l])*alpha_vdim[300][l]+0.2449489742783178*f[113][l]*alpha_vdim[299][l]+(0.1749635530559412*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[287][l]+0.2449489742783178*f[69][l]*alpha_vdim[286][l]+(0.1956151991089878*f[171][l]+0.3061862178478971*f[81][l])*alpha_vdim[277][l]+0.273861278752583*f[171][l]*alpha_vdim[276][l]+(0.1749635530559412*f[186][l]+0.1956151991089878*f[93][l]+0.273861278752583*f[92][l]+0.3061862178478971*f[20][l])*alpha_vdim[275][l]+0.2449489742783178*f[80][l]*alpha_vdim[274][l]+(0.2190890230020664*f[68][l]+0.2449489742783178*f[13][l])*alpha_vdim[268][l]+(0.2449489742783178*f[170][l]+0.273861278752583*f[82][l])*alpha_vdim[264][l]+(0.1956151991089878*f[136][l]+0.3061862178478971*f[47][l])*alpha_vdim[260][l]+0.273861278752583*f[136][l]*alpha_vdim[259][l]+0.2449489742783178*(f[25][l]*alpha_vdim[256][l]+f[129][l]*alpha_vdim[255][l])+0.273861278752583*(f[44][l]*alpha_vdim[255][l]+f[113][l]*alpha_vdim[251][l])+(0.273861278752583*f[210][l]+0.3061862178478971*f[138][l])*alpha_vdim[250][l]+0.2449489742783178*f[135][l]*alpha_vdim[249][l]+0.273861278752583*(f[48][l]*alpha_vdim[249][l]+f[69][l]*alpha_vdim[248][l])+(0.6123724356957944*f[179][l]+0.6846531968814573*f[80][l])*alpha_cdim[247][l]+0.3061862178478971*f[171][l]*alpha_vdim[246][l]+0.273861278752583*(f[80][l]*alpha_vdim[245][l]+f[186][l]*alpha_vdim[244][l])+0.3061862178478971*(f[93][l]*alpha_vdim[244][l]+f[136][l]*alpha_vdim[243][l])+0.6846531968814573*f[114][l]*alpha_cdim[243][l]+0.3061862178478971*(alpha_cdim[3][l]*f[176][l]+alpha_cdim[0][l]*f[142][l]);
+    out[175][l] += (0.3912303982179757*f[223][l]+0.6123724356957944*f[167][l]+0.4374088826398531*f[158][l]+0.6846531968814573*f[71][l])*alpha_vdim[606][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l]+0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[603][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[572][l]+(0.5477225575051661*f[196][l]+0.6123724356957944*f[102][l])*alpha_vdim[546][l]+(0.3912303982179757*f[195][l]+0.6123724356957944*f[112][l]+0.4374088826398531*f[101][l]+0.6846531968814573*f[27][l])*alpha_vdim[545][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[105][l])*alpha_vdim[543][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l]+0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[542][l]+(0.6123724356957944*f[223][l]+0.6846531968814573*f[158][l])*alpha_vdim[524][l]+(0.3912303982179757*f[166][l]+0.6123724356957944*f[79][l]+0.4374088826398531*f[70][l]+0.6846531968814573*f[14][l])*alpha_vdim[523][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[161][l])*alpha_vdim[520][l]+(0.3912303982179757*f[162][l]+0.6123724356957944*f[76][l]+0.4374088826398531*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[519][l]+0.6123724356957944*f[148][l]*alpha_vdim[518][l]+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[517][l]+(0.5477225575051661*f[150][l]+0.6123724356957944*f[52][l])*alpha_vdim[508][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[507][l]+0.6846531968814573*f[192][l]*alpha_vdim[503][l]+(0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[502][l]+(0.6123724356957944*f[195][l]+0.6846531968814573*f[101][l])*alpha_vdim[496][l]+(0.5477225575051661*f[111][l]+0.6123724356957944*f[26][l])*alpha_vdim[495][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[104][l])*alpha_vdim[494][l]+0.5477225575051661*f[108][l]*alpha_vdim[493][l]+0.6123724356957944*(f[28][l]*alpha_vdim[493][l]+f[96][l]*alpha_vdim[492][l])+(0.6123724356957944*f[166][l]+0.6846531968814573*f[70][l])*alpha_vdim[490][l]+0.6123724356957944*f[162][l]*alpha_vdim[489][l]+0.6846531968814573*(f[74][l]*alpha_vdim[489][l]+f[147][l]*alpha_vdim[488][l])+0.6123724356957944*f[54][l]*alpha_vdim[487][l]+0.6846531968814573*f[106][l]*alpha_vdim[486][l]+(0.1749635530559412*f[158][l]+0.273861278752583*f[71][l])*alpha_vdim[372][l]+(0.1749635530559412*f[233][l]+0.273861278752583*f[188][l]+0.1956151991089878*f[186][l]+0.3061862178478971*f[93][l])*alpha_vdim[360][l]+(0.1956151991089878*f[210][l]+0.3061862178478971*f[138][l])*alpha_vdim[329][l]+0.2449489742783178*f[102][l]*alpha_vdim[312][l]+(0.1749635530559412*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[311][l]+(0.2449489742783178*f[212][l]+0.273861278752583*f[136][l])*alpha_vdim[300][l]+(0.1749635530559412*f[211][l]+0.273861278752583*f[140][l]+0.1956151991089878*f[135][l]+0.3061862178478971*f[48][l])*alpha_vdim[299][l]+0.273861278752583*f[158][l]*alpha_vdim[287][l]+(0.1749635530559412*f[70][l]+0.273861278752583*f[14][l])*alpha_vdim[286][l]+(0.273861278752583*f[233][l]+0.3061862178478971*f[186][l])*alpha_vdim[277][l]+(0.1749635530559412*f[187][l]+0.273861278752583*f[94][l]+0.1956151991089878*f[92][l]+0.3061862178478971*f[20][l])*alpha_vdim[276][l]+0.273861278752583*f[171][l]*alpha_vdim[275][l]+(0.1956151991089878*f[170][l]+0.3061862178478971*f[82][l])*alpha_vdim[274][l]+0.2449489742783178*f[52][l]*alpha_vdim[268][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[80][l])*alpha_vdim[264][l]+0.3061862178478971*f[210][l]*alpha_vdim[260][l]+(0.1956151991089878*f[137][l]+0.3061862178478971*f[49][l])*alpha_vdim[259][l]+0.273861278752583*f[101][l]*alpha_vdim[256][l]+0.2449489742783178*f[26][l]*alpha_vdim[255][l]+(0.273861278752583*f[211][l]+0.3061862178478971*f[135][l])*alpha_vdim[251][l]+0.2449489742783178*f[139][l]*alpha_vdim[250][l]+0.273861278752583*(f[47][l]*alpha_vdim[250][l]+f[113][l]*alpha_vdim[249][l]+f[70][l]*alpha_vdim[248][l]+f[187][l]*alpha_vdim[246][l])+0.3061862178478971*(f[92][l]*alpha_vdim[246][l]+f[170][l]*alpha_vdim[245][l])+0.273861278752583*f[81][l]*alpha_vdim[244][l]+0.3061862178478971*f[137][l]*alpha_vdim[243][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[234][l]+0.2449489742783178*alpha_vdim[60][l]*f[217][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[216][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[213][l]+0.273861278752583*alpha_vdim[120][l]*f[190][l]+(0.1749635530559412*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[189][l]+(0.1956151991089878*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[38][l])*f[186][l]+0.2449489742783178*alpha_vdim[22][l]*f[179][l]+0.6123724356957944*alpha_cdim[3][l]*f[177][l]+0.273861278752583*alpha_vdim[32][l]*f[174][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[173][l]+0.1749635530559412*alpha_vdim[129][l]*f[161][l]+0.273861278752583*(alpha_vdim[44][l]*f[161][l]+alpha_vdim[59][l]*f[145][l])+0.2449489742783178*alpha_vdim[9][l]*f[144][l]+0.3061862178478971*alpha_vdim[86][l]*f[142][l]+(0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[141][l]+0.273861278752583*alpha_vdim[60][l]*f[136][l]+(0.1956151991089878*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[135][l]+0.273861278752583*f[75][l]*alpha_vdim[129][l]+0.3061862178478971*f[93][l]*alpha_vdim[120][l]+0.6846531968814573*alpha_cdim[0][l]*f[115][l]+0.273861278752583*alpha_vdim[6][l]*f[114][l]+0.2449489742783178*alpha_vdim[69][l]*f[105][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[104][l]+alpha_vdim[37][l]*(0.273861278752583*f[95][l]+0.1956151991089878*f[92][l])+0.3061862178478971*(alpha_vdim[4][l]*f[92][l]+alpha_vdim[31][l]*f[84][l])+0.6846531968814573*alpha_cdim[3][l]*f[83][l]+0.273861278752583*(alpha_vdim[1][l]*f[83][l]+alpha_vdim[22][l]*f[80][l])+0.1749635530559412*alpha_vdim[43][l]*f[74][l]+0.273861278752583*(alpha_vdim[5][l]*f[74][l]+f[29][l]*alpha_vdim[68][l])+0.3061862178478971*f[48][l]*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[25][l]*f[53][l]+0.3061862178478971*alpha_vdim[16][l]*f[50][l]+0.273861278752583*(alpha_vdim[9][l]*f[47][l]+f[15][l]*alpha_vdim[43][l])+0.3061862178478971*f[20][l]*alpha_vdim[37][l]+0.2449489742783178*alpha_vdim[12][l]*f[28][l];
+    out[176][l] += (0.3912303982179757*f[223][l]+0.6123724356957944*f[166][l]+0.4374088826398531*f[158][l]+0.6846531968814573*f[70][l])*alpha_vdim[606][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[162][l]+0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[603][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[572][l]+(0.3912303982179757*f[196][l]+0.6123724356957944*f[111][l]+0.4374088826398531*f[102][l]+0.6846531968814573*f[26][l])*alpha_vdim[546][l]+(0.5477225575051661*f[195][l]+0.6123724356957944*f[101][l])*alpha_vdim[545][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l]+0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[543][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[104][l])*alpha_vdim[542][l]+(0.3912303982179757*f[167][l]+0.6123724356957944*f[79][l]+0.4374088826398531*f[71][l]+0.6846531968814573*f[14][l])*alpha_vdim[524][l]+(0.6123724356957944*f[223][l]+0.6846531968814573*f[158][l])*alpha_vdim[523][l]+(0.3912303982179757*f[163][l]+0.6123724356957944*f[76][l]+0.4374088826398531*f[75][l]+0.6846531968814573*f[15][l])*alpha_vdim[520][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[161][l])*alpha_vdim[519][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[518][l]+0.6123724356957944*f[147][l]*alpha_vdim[517][l]+(0.5477225575051661*f[150][l]+0.6123724356957944*f[52][l])*alpha_vdim[508][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[507][l]+0.4374088826398531*f[107][l]*alpha_vdim[503][l]+0.6846531968814573*(f[30][l]*alpha_vdim[503][l]+f[192][l]*alpha_vdim[502][l])+(0.5477225575051661*f[112][l]+0.6123724356957944*f[27][l])*alpha_vdim[496][l]+(0.6123724356957944*f[196][l]+0.6846531968814573*f[102][l])*alpha_vdim[495][l]+(0.5477225575051661*f[109][l]+0.6123724356957944*f[29][l])*alpha_vdim[494][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[105][l])*alpha_vdim[493][l]+0.6123724356957944*f[96][l]*alpha_vdim[492][l]+(0.6123724356957944*f[167][l]+0.6846531968814573*f[71][l])*alpha_vdim[490][l]+(0.6123724356957944*f[163][l]+0.6846531968814573*f[75][l])*alpha_vdim[489][l]+0.6123724356957944*f[55][l]*alpha_vdim[488][l]+0.6846531968814573*(f[148][l]*alpha_vdim[487][l]+f[107][l]*alpha_vdim[486][l])+(0.1749635530559412*f[158][l]+0.273861278752583*f[70][l])*alpha_vdim[372][l]+(0.1749635530559412*f[233][l]+0.273861278752583*f[187][l]+0.1956151991089878*f[186][l]+0.3061862178478971*f[92][l])*alpha_vdim[360][l]+(0.1956151991089878*f[210][l]+0.3061862178478971*f[137][l])*alpha_vdim[329][l]+(0.1749635530559412*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[312][l]+0.2449489742783178*f[101][l]*alpha_vdim[311][l]+(0.1749635530559412*f[212][l]+0.273861278752583*f[139][l]+0.1956151991089878*f[136][l]+0.3061862178478971*f[47][l])*alpha_vdim[300][l]+(0.2449489742783178*f[211][l]+0.273861278752583*f[135][l])*alpha_vdim[299][l]+0.1749635530559412*f[71][l]*alpha_vdim[287][l]+0.273861278752583*(f[14][l]*alpha_vdim[287][l]+f[158][l]*alpha_vdim[286][l])+(0.1749635530559412*f[188][l]+0.273861278752583*f[94][l]+0.1956151991089878*f[93][l]+0.3061862178478971*f[20][l])*alpha_vdim[277][l]+(0.273861278752583*f[233][l]+0.3061862178478971*f[186][l])*alpha_vdim[276][l]+(0.1956151991089878*f[171][l]+0.3061862178478971*f[81][l])*alpha_vdim[275][l]+0.273861278752583*f[170][l]*alpha_vdim[274][l]+0.2449489742783178*f[52][l]*alpha_vdim[268][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[80][l])*alpha_vdim[264][l]+0.1956151991089878*f[138][l]*alpha_vdim[260][l]+0.3061862178478971*(f[49][l]*alpha_vdim[260][l]+f[210][l]*alpha_vdim[259][l])+0.2449489742783178*f[27][l]*alpha_vdim[256][l]+0.273861278752583*f[102][l]*alpha_vdim[255][l]+(0.2449489742783178*f[140][l]+0.273861278752583*f[48][l])*alpha_vdim[251][l]+(0.273861278752583*f[212][l]+0.3061862178478971*f[136][l])*alpha_vdim[250][l]+0.273861278752583*(f[113][l]*alpha_vdim[249][l]+f[71][l]*alpha_vdim[248][l])+(0.6123724356957944*f[181][l]+0.6846531968814573*f[82][l])*alpha_cdim[247][l]+(0.273861278752583*f[188][l]+0.3061862178478971*f[93][l])*alpha_vdim[246][l]+0.273861278752583*f[82][l]*alpha_vdim[245][l]+0.3061862178478971*(f[171][l]*alpha_vdim[244][l]+f[138][l]*alpha_vdim[243][l])+0.6846531968814573*f[116][l]*alpha_cdim[243][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[37][l])*f[234][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[217][l]+0.2449489742783178*alpha_vdim[59][l]*f[216][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[213][l]+0.1749635530559412*alpha_vdim[38][l]*f[190][l]+0.273861278752583*(alpha_vdim[4][l]*f[190][l]+alpha_vdim[120][l]*f[189][l])+(0.1956151991089878*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[37][l])*f[186][l]+0.2449489742783178*alpha_vdim[22][l]*f[179][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[174][l]+0.273861278752583*alpha_vdim[31][l]*f[173][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[43][l])*f[161][l]+0.2449489742783178*alpha_vdim[10][l]*f[145][l]+0.273861278752583*alpha_vdim[60][l]*f[144][l]+0.1956151991089878*alpha_vdim[17][l]*f[142][l]+0.3061862178478971*(alpha_vdim[0][l]*f[142][l]+alpha_vdim[86][l]*f[141][l])+(0.1956151991089878*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[136][l]+0.273861278752583*(alpha_vdim[59][l]*f[135][l]+f[74][l]*alpha_vdim[129][l])+0.3061862178478971*f[92][l]*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[6][l]*f[114][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[105][l]+0.2449489742783178*alpha_vdim[68][l]*f[104][l]+0.273861278752583*alpha_vdim[38][l]*f[95][l]+(0.1956151991089878*alpha_vdim[38][l]+0.3061862178478971*alpha_vdim[4][l])*f[93][l]+0.273861278752583*alpha_vdim[2][l]*f[84][l]+0.3061862178478971*alpha_vdim[32][l]*f[83][l]+0.273861278752583*alpha_vdim[22][l]*f[80][l]+0.1749635530559412*alpha_vdim[44][l]*f[75][l]+0.273861278752583*(alpha_vdim[5][l]*f[75][l]+f[28][l]*alpha_vdim[69][l])+0.3061862178478971*f[47][l]*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[25][l]*f[53][l]+0.3061862178478971*alpha_vdim[17][l]*f[50][l]+0.273861278752583*(alpha_vdim[10][l]*f[48][l]+f[15][l]*alpha_vdim[44][l])+0.3061862178478971*f[20][l]*alpha_vdim[38][l]+0.2449489742783178*alpha_vdim[13][l]*f[29][l];
+    out[177][l] += (0.5477225575051661*f[225][l]+0.6123724356957944*f[160][l])*alpha_vdim[606][l]+0.5477225575051661*f[148][l]*alpha_vdim[603][l]+0.6123724356957944*f[194][l]*alpha_vdim[572][l]+(0.5477225575051661*f[237][l]+0.6123724356957944*(f[209][l]+f[206][l])+0.6846531968814573*f[131][l])*alpha_vdim[546][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[103][l])*alpha_vdim[545][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[543][l]+0.5477225575051661*f[96][l]*alpha_vdim[542][l]+(0.6123724356957944*f[225][l]+0.6846531968814573*f[160][l])*alpha_vdim[524][l]+0.5477225575051661*f[168][l]*alpha_vdim[523][l]+0.6123724356957944*(f[72][l]*alpha_vdim[523][l]+f[148][l]*alpha_vdim[520][l])+0.5477225575051661*f[54][l]*alpha_vdim[519][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[518][l]+0.6123724356957944*f[149][l]*alpha_vdim[517][l]+(0.5477225575051661*f[224][l]+0.6123724356957944*(f[169][l]+f[159][l])+0.6846531968814573*f[73][l])*alpha_vdim[508][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[507][l]+0.6846531968814573*f[194][l]*alpha_vdim[503][l]+0.6123724356957944*f[108][l]*alpha_vdim[502][l]+(0.6123724356957944*f[197][l]+0.6846531968814573*f[103][l])*alpha_vdim[496][l]+(0.5477225575051661*f[208][l]+0.6123724356957944*(f[134][l]+f[130][l])+0.6846531968814573*f[45][l])*alpha_vdim[495][l]+0.6123724356957944*f[96][l]*alpha_vdim[494][l]+(0.5477225575051661*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[493][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[492][l]+(0.6123724356957944*f[168][l]+0.6846531968814573*f[72][l])*alpha_vdim[490][l]+0.6123724356957944*f[54][l]*alpha_vdim[489][l]+0.6846531968814573*f[149][l]*alpha_vdim[488][l]+0.6123724356957944*f[162][l]*alpha_vdim[487][l]+0.6846531968814573*(f[76][l]*alpha_vdim[487][l]+f[108][l]*alpha_vdim[486][l])+0.2449489742783178*(f[160][l]*alpha_vdim[372][l]+f[171][l]*alpha_vdim[360][l])+0.273861278752583*f[212][l]*alpha_vdim[329][l]+(0.2449489742783178*f[206][l]+0.273861278752583*f[131][l])*alpha_vdim[312][l]+0.2449489742783178*f[103][l]*alpha_vdim[311][l]+(0.2449489742783178*f[210][l]+0.273861278752583*f[138][l])*alpha_vdim[300][l]+0.2449489742783178*f[113][l]*alpha_vdim[299][l]+0.273861278752583*f[160][l]*alpha_vdim[287][l]+0.2449489742783178*f[72][l]*alpha_vdim[286][l]+0.273861278752583*f[171][l]*alpha_vdim[277][l]+0.2449489742783178*f[81][l]*alpha_vdim[276][l]+(0.273861278752583*f[233][l]+0.3061862178478971*f[188][l])*alpha_vdim[275][l]+0.273861278752583*f[172][l]*alpha_vdim[274][l]+(0.2449489742783178*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[268][l]+(0.2449489742783178*f[170][l]+0.273861278752583*f[82][l])*alpha_vdim[264][l]+0.3061862178478971*f[212][l]*alpha_vdim[260][l]+0.273861278752583*(f[139][l]*alpha_vdim[259][l]+f[103][l]*alpha_vdim[256][l])+0.2449489742783178*f[130][l]*alpha_vdim[255][l]+0.273861278752583*(f[45][l]*alpha_vdim[255][l]+f[113][l]*alpha_vdim[251][l])+(0.2449489742783178*f[137][l]+0.273861278752583*f[49][l])*alpha_vdim[250][l]+(0.273861278752583*f[211][l]+0.3061862178478971*f[140][l])*alpha_vdim[249][l]+0.273861278752583*(f[72][l]*alpha_vdim[248][l]+f[81][l]*alpha_vdim[246][l])+0.3061862178478971*f[172][l]*alpha_vdim[245][l]+0.273861278752583*f[187][l]*alpha_vdim[244][l]+0.3061862178478971*(f[94][l]*alpha_vdim[244][l]+f[139][l]*alpha_vdim[243][l])+0.5477225575051661*alpha_vdim[60][l]*f[239][l]+(0.5477225575051661*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[230][l]+0.5477225575051661*alpha_vdim[22][l]*f[229][l]+0.6123724356957944*(alpha_vdim[32][l]*f[226][l]+alpha_vdim[60][l]*f[219][l])+0.5477225575051661*alpha_vdim[9][l]*f[218][l]+0.6123724356957944*alpha_vdim[60][l]*f[210][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[201][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[199][l]+0.6123724356957944*alpha_vdim[6][l]*f[198][l]+0.5477225575051661*alpha_vdim[69][l]*f[192][l]+0.6123724356957944*alpha_vdim[22][l]*f[181][l]+(0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[180][l]+0.6846531968814573*alpha_vdim[32][l]*f[176][l]+0.6123724356957944*alpha_vdim[1][l]*f[175][l]+(0.6123724356957944*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[38][l])*f[171][l]+0.6123724356957944*alpha_vdim[22][l]*f[170][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[151][l]+(0.5477225575051661*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[148][l]+0.5477225575051661*alpha_vdim[25][l]*f[147][l]+0.6123724356957944*alpha_vdim[9][l]*f[146][l]+0.3061862178478971*alpha_cdim[0][l]*f[143][l]+0.6846531968814573*alpha_vdim[60][l]*f[138][l]+0.6123724356957944*alpha_vdim[9][l]*f[137][l]+0.6846531968814573*alpha_vdim[6][l]*f[116][l]+(0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[115][l]+(0.6123724356957944*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[10][l])*f[113][l]+0.6123724356957944*alpha_vdim[69][l]*f[107][l]+0.5477225575051661*alpha_vdim[12][l]*f[106][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[96][l]+0.273861278752583*alpha_cdim[3][l]*f[85][l]+0.6846531968814573*(alpha_vdim[1][l]*f[85][l]+alpha_vdim[22][l]*f[82][l])+(0.6123724356957944*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[81][l]+0.6123724356957944*alpha_vdim[25][l]*f[55][l]+(0.5477225575051661*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[54][l]+0.6846531968814573*alpha_vdim[9][l]*f[49][l]+0.6123724356957944*alpha_vdim[12][l]*f[30][l];
+    out[178][l] += (0.5477225575051661*f[224][l]+0.6123724356957944*f[159][l])*alpha_vdim[606][l]+0.5477225575051661*f[147][l]*alpha_vdim[603][l]+0.6123724356957944*f[193][l]*alpha_vdim[572][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[103][l])*alpha_vdim[546][l]+(0.5477225575051661*f[237][l]+0.6123724356957944*(f[208][l]+f[206][l])+0.6846531968814573*f[130][l])*alpha_vdim[545][l]+0.5477225575051661*f[96][l]*alpha_vdim[543][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[542][l]+(0.5477225575051661*f[169][l]+0.6123724356957944*f[73][l])*alpha_vdim[524][l]+(0.6123724356957944*f[224][l]+0.6846531968814573*f[159][l])*alpha_vdim[523][l]+0.5477225575051661*f[55][l]*alpha_vdim[520][l]+0.6123724356957944*(f[147][l]*alpha_vdim[519][l]+f[149][l]*alpha_vdim[518][l])+(0.6123724356957944*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[517][l]+(0.5477225575051661*f[225][l]+0.6123724356957944*(f[168][l]+f[160][l])+0.6846531968814573*f[72][l])*alpha_vdim[508][l]+0.5477225575051661*f[148][l]*alpha_vdim[507][l]+0.6123724356957944*(f[54][l]*alpha_vdim[507][l]+f[109][l]*alpha_vdim[503][l])+0.6846531968814573*f[193][l]*alpha_vdim[502][l]+(0.5477225575051661*f[209][l]+0.6123724356957944*(f[134][l]+f[131][l])+0.6846531968814573*f[45][l])*alpha_vdim[496][l]+(0.6123724356957944*f[197][l]+0.6846531968814573*f[103][l])*alpha_vdim[495][l]+0.5477225575051661*f[107][l]*alpha_vdim[494][l]+0.6123724356957944*(f[30][l]*alpha_vdim[494][l]+f[96][l]*alpha_vdim[493][l])+(0.6123724356957944*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[492][l]+(0.6123724356957944*f[169][l]+0.6846531968814573*f[73][l])*alpha_vdim[490][l]+0.6123724356957944*(f[55][l]*alpha_vdim[489][l]+f[163][l]*alpha_vdim[488][l])+0.6846531968814573*(f[76][l]*alpha_vdim[488][l]+f[149][l]*alpha_vdim[487][l]+f[109][l]*alpha_vdim[486][l])+0.2449489742783178*(f[159][l]*alpha_vdim[372][l]+f[170][l]*alpha_vdim[360][l])+0.273861278752583*f[211][l]*alpha_vdim[329][l]+0.2449489742783178*f[103][l]*alpha_vdim[312][l]+(0.2449489742783178*f[206][l]+0.273861278752583*f[130][l])*alpha_vdim[311][l]+0.2449489742783178*f[113][l]*alpha_vdim[300][l]+(0.2449489742783178*f[210][l]+0.273861278752583*f[137][l])*alpha_vdim[299][l]+0.2449489742783178*f[73][l]*alpha_vdim[287][l]+0.273861278752583*f[159][l]*alpha_vdim[286][l]+0.2449489742783178*f[82][l]*alpha_vdim[277][l]+0.273861278752583*(f[170][l]*alpha_vdim[276][l]+f[172][l]*alpha_vdim[275][l])+(0.273861278752583*f[233][l]+0.3061862178478971*f[187][l])*alpha_vdim[274][l]+(0.2449489742783178*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[268][l]+0.2449489742783178*f[171][l]*alpha_vdim[264][l]+0.273861278752583*(f[81][l]*alpha_vdim[264][l]+f[140][l]*alpha_vdim[260][l])+0.3061862178478971*f[211][l]*alpha_vdim[259][l]+0.2449489742783178*f[131][l]*alpha_vdim[256][l]+0.273861278752583*(f[45][l]*alpha_vdim[256][l]+f[103][l]*alpha_vdim[255][l])+0.2449489742783178*f[138][l]*alpha_vdim[251][l]+0.273861278752583*(f[49][l]*alpha_vdim[251][l]+f[113][l]*alpha_vdim[250][l])+(0.273861278752583*f[212][l]+0.3061862178478971*f[139][l])*alpha_vdim[249][l]+0.273861278752583*f[73][l]*alpha_vdim[248][l]+(0.273861278752583*f[191][l]+0.3061862178478971*f[94][l])*alpha_cdim[247][l]+0.273861278752583*(f[82][l]*alpha_vdim[246][l]+f[188][l]*alpha_vdim[245][l])+0.3061862178478971*(f[94][l]*alpha_vdim[245][l]+f[172][l]*alpha_vdim[244][l]+f[140][l]*alpha_vdim[243][l]+f[143][l]*alpha_cdim[243][l])+0.5477225575051661*(alpha_vdim[59][l]*f[239][l]+alpha_vdim[22][l]*f[230][l]+alpha_vdim[120][l]*f[229][l])+0.6123724356957944*(alpha_vdim[37][l]*f[229][l]+alpha_vdim[31][l]*f[226][l])+0.5477225575051661*alpha_vdim[10][l]*f[219][l]+0.6123724356957944*alpha_vdim[59][l]*(f[218][l]+f[210][l])+0.5477225575051661*alpha_vdim[60][l]*f[201][l]+0.6123724356957944*(alpha_vdim[9][l]*f[201][l]+alpha_vdim[6][l]*f[199][l])+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[198][l]+0.5477225575051661*(alpha_vdim[68][l]*f[192][l]+alpha_vdim[38][l]*f[181][l])+0.6123724356957944*(alpha_vdim[4][l]*f[181][l]+alpha_vdim[22][l]*f[180][l]+alpha_vdim[2][l]*f[176][l])+0.6846531968814573*alpha_vdim[31][l]*f[175][l]+0.6123724356957944*alpha_vdim[22][l]*f[171][l]+(0.6123724356957944*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[37][l])*f[170][l]+(0.6123724356957944*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[151][l]+0.5477225575051661*(alpha_vdim[25][l]*f[148][l]+alpha_vdim[129][l]*f[147][l])+0.6123724356957944*(alpha_vdim[43][l]*f[147][l]+alpha_vdim[10][l]*(f[146][l]+f[138][l]))+0.6846531968814573*alpha_vdim[59][l]*f[137][l]+0.6123724356957944*alpha_vdim[17][l]*f[116][l]+0.6846531968814573*(alpha_vdim[0][l]*f[116][l]+alpha_vdim[6][l]*f[115][l])+(0.6123724356957944*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[113][l]+0.5477225575051661*alpha_vdim[13][l]*f[107][l]+0.6123724356957944*alpha_vdim[68][l]*f[106][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[96][l]+0.6846531968814573*alpha_vdim[2][l]*f[85][l]+0.6123724356957944*alpha_vdim[38][l]*f[82][l]+0.6846531968814573*(alpha_vdim[4][l]*f[82][l]+alpha_vdim[22][l]*f[81][l])+0.5477225575051661*alpha_vdim[44][l]*f[55][l]+0.6123724356957944*(alpha_vdim[5][l]*f[55][l]+alpha_vdim[25][l]*f[54][l])+0.6846531968814573*alpha_vdim[10][l]*f[49][l]+0.6123724356957944*alpha_vdim[13][l]*f[30][l];
+    out[179][l] += 0.4898979485566357*f[53][l]*alpha_vdim[606][l]+0.5477225575051661*(f[150][l]*alpha_vdim[603][l]+f[110][l]*alpha_vdim[572][l])+(0.4898979485566357*f[104][l]+0.5477225575051661*f[29][l])*alpha_vdim[546][l]+(0.4898979485566357*f[105][l]+0.5477225575051661*f[28][l])*alpha_vdim[545][l]+(0.5477225575051661*f[195][l]+0.6123724356957944*f[112][l])*alpha_vdim[543][l]+(0.5477225575051661*f[196][l]+0.6123724356957944*f[111][l])*alpha_vdim[542][l]+0.5477225575051661*f[53][l]*(alpha_vdim[524][l]+alpha_vdim[523][l])+0.6123724356957944*f[150][l]*(alpha_vdim[520][l]+alpha_vdim[519][l])+(0.5477225575051661*f[164][l]+0.6123724356957944*f[78][l])*alpha_vdim[518][l]+(0.5477225575051661*f[165][l]+0.6123724356957944*f[77][l])*alpha_vdim[517][l]+(0.4898979485566357*f[161][l]+0.5477225575051661*(f[75][l]+f[74][l])+0.6123724356957944*f[15][l])*alpha_vdim[508][l]+(0.5477225575051661*f[223][l]+0.6123724356957944*(f[167][l]+f[166][l])+0.6846531968814573*f[79][l])*alpha_vdim[507][l]+0.6123724356957944*f[110][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.5477225575051661*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[496][l]+(0.5477225575051661*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[495][l]+(0.6123724356957944*f[196][l]+0.6846531968814573*f[111][l])*alpha_vdim[494][l]+(0.6123724356957944*f[195][l]+0.6846531968814573*f[112][l])*alpha_vdim[493][l]+(0.5477225575051661*f[207][l]+0.6123724356957944*(f[133][l]+f[132][l])+0.6846531968814573*f[46][l])*alpha_vdim[492][l]+0.6123724356957944*f[53][l]*alpha_vdim[490][l]+0.6846531968814573*f[150][l]*alpha_vdim[489][l]+(0.6123724356957944*f[165][l]+0.6846531968814573*f[77][l])*alpha_vdim[488][l]+0.6123724356957944*f[164][l]*alpha_vdim[487][l]+0.6846531968814573*(f[78][l]*alpha_vdim[487][l]+f[110][l]*alpha_vdim[486][l])+0.4898979485566357*f[53][l]*alpha_vdim[372][l]+0.5477225575051661*(f[151][l]*alpha_vdim[360][l]+f[114][l]*alpha_vdim[329][l])+(0.4898979485566357*f[104][l]+0.5477225575051661*f[29][l])*alpha_vdim[312][l]+(0.4898979485566357*f[105][l]+0.5477225575051661*f[28][l])*alpha_vdim[311][l]+(0.5477225575051661*f[198][l]+0.6123724356957944*f[116][l])*alpha_vdim[300][l]+(0.5477225575051661*f[199][l]+0.6123724356957944*f[115][l])*alpha_vdim[299][l]+0.5477225575051661*f[53][l]*(alpha_vdim[287][l]+alpha_vdim[286][l])+0.6123724356957944*f[151][l]*(alpha_vdim[277][l]+alpha_vdim[276][l])+(0.5477225575051661*f[173][l]+0.6123724356957944*f[84][l])*alpha_vdim[275][l]+(0.5477225575051661*f[174][l]+0.6123724356957944*f[83][l])*alpha_vdim[274][l]+(0.4898979485566357*f[161][l]+0.5477225575051661*(f[75][l]+f[74][l])+0.6123724356957944*f[15][l])*alpha_vdim[268][l]+(0.5477225575051661*f[226][l]+0.6123724356957944*(f[176][l]+f[175][l])+0.6846531968814573*f[85][l])*alpha_vdim[264][l]+0.6123724356957944*f[114][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.5477225575051661*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[256][l]+(0.5477225575051661*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[255][l]+(0.6123724356957944*f[199][l]+0.6846531968814573*f[115][l])*alpha_vdim[251][l]+(0.6123724356957944*f[198][l]+0.6846531968814573*f[116][l])*alpha_vdim[250][l]+(0.5477225575051661*f[213][l]+0.6123724356957944*(f[142][l]+f[141][l])+0.6846531968814573*f[50][l])*alpha_vdim[249][l]+0.6123724356957944*f[53][l]*alpha_vdim[248][l]+0.273861278752583*f[83][l]*alpha_cdim[247][l]+0.6846531968814573*f[151][l]*alpha_vdim[246][l]+(0.6123724356957944*f[174][l]+0.6846531968814573*f[83][l])*alpha_vdim[245][l]+0.6123724356957944*f[173][l]*alpha_vdim[244][l]+0.6846531968814573*(f[84][l]*alpha_vdim[244][l]+f[114][l]*alpha_vdim[243][l])+0.3061862178478971*(f[144][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[181][l]+alpha_cdim[0][l]*f[145][l]);
+    out[180][l] += 0.5477225575051661*(f[148][l]*alpha_vdim[606][l]+f[225][l]*alpha_vdim[603][l])+0.6123724356957944*(f[165][l]*alpha_vdim[603][l]+f[196][l]*alpha_vdim[572][l])+(0.5477225575051661*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[546][l]+0.5477225575051661*f[96][l]*alpha_vdim[545][l]+(0.5477225575051661*f[237][l]+0.6123724356957944*(f[209][l]+f[207][l])+0.6846531968814573*f[133][l])*alpha_vdim[543][l]+0.5477225575051661*f[197][l]*alpha_vdim[542][l]+0.6123724356957944*(f[110][l]*alpha_vdim[542][l]+f[148][l]*alpha_vdim[524][l])+0.5477225575051661*f[54][l]*alpha_vdim[523][l]+(0.6123724356957944*f[225][l]+0.6846531968814573*f[165][l])*alpha_vdim[520][l]+(0.5477225575051661*f[168][l]+0.6123724356957944*f[77][l])*alpha_vdim[519][l]+(0.6123724356957944*f[223][l]+0.6846531968814573*f[167][l])*alpha_vdim[518][l]+0.6123724356957944*f[150][l]*alpha_vdim[517][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[508][l]+(0.5477225575051661*f[224][l]+0.6123724356957944*(f[169][l]+f[164][l]))*alpha_vdim[507][l]+0.6846531968814573*(f[78][l]*alpha_vdim[507][l]+f[196][l]*alpha_vdim[503][l])+0.6123724356957944*(f[111][l]*alpha_vdim[502][l]+f[96][l]*alpha_vdim[496][l])+(0.5477225575051661*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[495][l]+(0.6123724356957944*f[197][l]+0.6846531968814573*f[110][l])*alpha_vdim[494][l]+(0.5477225575051661*f[208][l]+0.6123724356957944*(f[134][l]+f[132][l])+0.6846531968814573*f[46][l])*alpha_vdim[493][l]+(0.6123724356957944*f[195][l]+0.6846531968814573*f[112][l])*alpha_vdim[492][l]+0.6123724356957944*(f[54][l]*alpha_vdim[490][l]+f[168][l]*alpha_vdim[489][l])+0.6846531968814573*(f[77][l]*alpha_vdim[489][l]+f[150][l]*alpha_vdim[488][l])+0.6123724356957944*f[166][l]*alpha_vdim[487][l]+0.6846531968814573*(f[79][l]*alpha_vdim[487][l]+f[111][l]*alpha_vdim[486][l])+0.5477225575051661*(f[148][l]*alpha_vdim[372][l]+f[228][l]*alpha_vdim[360][l])+0.6123724356957944*(f[174][l]*alpha_vdim[360][l]+f[199][l]*alpha_vdim[329][l])+(0.5477225575051661*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[312][l]+0.5477225575051661*f[96][l]*alpha_vdim[311][l]+(0.5477225575051661*f[238][l]+0.6123724356957944*(f[215][l]+f[213][l])+0.6846531968814573*f[142][l])*alpha_vdim[300][l]+0.5477225575051661*f[200][l]*alpha_vdim[299][l]+0.6123724356957944*(f[114][l]*alpha_vdim[299][l]+f[148][l]*alpha_vdim[287][l])+0.5477225575051661*f[54][l]*alpha_vdim[286][l]+(0.6123724356957944*f[228][l]+0.6846531968814573*f[174][l])*alpha_vdim[277][l]+(0.5477225575051661*f[177][l]+0.6123724356957944*f[83][l])*alpha_vdim[276][l]+(0.6123724356957944*f[226][l]+0.6846531968814573*f[176][l])*alpha_vdim[275][l]+0.6123724356957944*f[151][l]*alpha_vdim[274][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[268][l]+(0.5477225575051661*f[227][l]+0.6123724356957944*(f[178][l]+f[173][l]))*alpha_vdim[264][l]+0.6846531968814573*(f[84][l]*alpha_vdim[264][l]+f[199][l]*alpha_vdim[260][l])+0.6123724356957944*(f[115][l]*alpha_vdim[259][l]+f[96][l]*alpha_vdim[256][l])+(0.5477225575051661*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[255][l]+(0.6123724356957944*f[200][l]+0.6846531968814573*f[114][l])*alpha_vdim[251][l]+(0.5477225575051661*f[214][l]+0.6123724356957944*(f[143][l]+f[141][l])+0.6846531968814573*f[50][l])*alpha_vdim[250][l]+(0.6123724356957944*f[198][l]+0.6846531968814573*f[116][l])*alpha_vdim[249][l]+0.6123724356957944*(f[54][l]*alpha_vdim[248][l]+f[177][l]*alpha_vdim[246][l])+0.6846531968814573*(f[83][l]*alpha_vdim[246][l]+f[151][l]*alpha_vdim[245][l])+0.6123724356957944*f[175][l]*alpha_vdim[244][l]+0.6846531968814573*(f[85][l]*alpha_vdim[244][l]+f[115][l]*alpha_vdim[243][l])+0.273861278752583*alpha_vdim[32][l]*f[234][l]+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[217][l]+0.273861278752583*alpha_vdim[6][l]*f[216][l]+0.2449489742783178*(alpha_vdim[60][l]*f[213][l]+alpha_vdim[69][l]*f[207][l])+0.273861278752583*alpha_cdim[3][l]*f[191][l]+0.3061862178478971*alpha_vdim[32][l]*f[190][l]+0.273861278752583*alpha_vdim[1][l]*f[189][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[179][l]+(0.2449489742783178*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[174][l]+0.2449489742783178*alpha_vdim[22][l]*f[173][l]+(0.2449489742783178*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l])*f[165][l]+0.2449489742783178*alpha_vdim[25][l]*f[164][l]+0.3061862178478971*(alpha_cdim[0][l]*f[146][l]+alpha_vdim[6][l]*f[145][l])+(0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[144][l]+0.273861278752583*alpha_vdim[60][l]*f[142][l]+0.2449489742783178*alpha_vdim[9][l]*f[141][l]+0.273861278752583*alpha_vdim[69][l]*f[133][l]+0.2449489742783178*alpha_vdim[12][l]*f[132][l]+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[114][l]+(0.2449489742783178*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[110][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l])*f[95][l]+0.273861278752583*alpha_vdim[22][l]*f[84][l]+0.2449489742783178*alpha_vdim[37][l]*f[83][l]+0.273861278752583*(alpha_vdim[4][l]*f[83][l]+alpha_vdim[25][l]*f[78][l])+0.2449489742783178*alpha_vdim[43][l]*f[77][l]+0.273861278752583*(alpha_vdim[5][l]*f[77][l]+alpha_vdim[9][l]*f[50][l]+alpha_vdim[12][l]*f[46][l]);
+    out[181][l] += 0.5477225575051661*(f[147][l]*alpha_vdim[606][l]+f[224][l]*alpha_vdim[603][l])+0.6123724356957944*(f[164][l]*alpha_vdim[603][l]+f[195][l]*alpha_vdim[572][l])+0.5477225575051661*f[96][l]*alpha_vdim[546][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[545][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[110][l])*alpha_vdim[543][l]+(0.5477225575051661*f[237][l]+0.6123724356957944*(f[208][l]+f[207][l])+0.6846531968814573*f[132][l])*alpha_vdim[542][l]+0.5477225575051661*f[55][l]*alpha_vdim[524][l]+0.6123724356957944*f[147][l]*alpha_vdim[523][l]+(0.5477225575051661*f[169][l]+0.6123724356957944*f[78][l])*alpha_vdim[520][l]+(0.6123724356957944*f[224][l]+0.6846531968814573*f[164][l])*alpha_vdim[519][l]+0.6123724356957944*f[150][l]*alpha_vdim[518][l]+(0.6123724356957944*f[223][l]+0.6846531968814573*f[166][l])*alpha_vdim[517][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[508][l]+(0.5477225575051661*f[225][l]+0.6123724356957944*(f[168][l]+f[165][l])+0.6846531968814573*f[77][l])*alpha_vdim[507][l]+0.6123724356957944*f[112][l]*alpha_vdim[503][l]+0.6846531968814573*f[195][l]*alpha_vdim[502][l]+0.5477225575051661*f[107][l]*alpha_vdim[496][l]+0.6123724356957944*(f[30][l]*alpha_vdim[496][l]+f[96][l]*alpha_vdim[495][l])+(0.5477225575051661*f[209][l]+0.6123724356957944*(f[134][l]+f[133][l])+0.6846531968814573*f[46][l])*alpha_vdim[494][l]+(0.6123724356957944*f[197][l]+0.6846531968814573*f[110][l])*alpha_vdim[493][l]+(0.6123724356957944*f[196][l]+0.6846531968814573*f[111][l])*alpha_vdim[492][l]+0.6123724356957944*f[55][l]*alpha_vdim[490][l]+(0.6123724356957944*f[169][l]+0.6846531968814573*f[78][l])*alpha_vdim[489][l]+0.6123724356957944*f[167][l]*alpha_vdim[488][l]+0.6846531968814573*(f[79][l]*alpha_vdim[488][l]+f[150][l]*alpha_vdim[487][l]+f[112][l]*alpha_vdim[486][l])+0.5477225575051661*(f[147][l]*alpha_vdim[372][l]+f[227][l]*alpha_vdim[360][l])+0.6123724356957944*(f[173][l]*alpha_vdim[360][l]+f[198][l]*alpha_vdim[329][l])+0.5477225575051661*f[96][l]*alpha_vdim[312][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[311][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[114][l])*alpha_vdim[300][l]+(0.5477225575051661*f[238][l]+0.6123724356957944*(f[214][l]+f[213][l])+0.6846531968814573*f[141][l])*alpha_vdim[299][l]+0.5477225575051661*f[55][l]*alpha_vdim[287][l]+0.6123724356957944*f[147][l]*alpha_vdim[286][l]+(0.5477225575051661*f[178][l]+0.6123724356957944*f[84][l])*alpha_vdim[277][l]+(0.6123724356957944*f[227][l]+0.6846531968814573*f[173][l])*alpha_vdim[276][l]+0.6123724356957944*f[151][l]*alpha_vdim[275][l]+(0.6123724356957944*f[226][l]+0.6846531968814573*f[175][l])*alpha_vdim[274][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[268][l]+(0.5477225575051661*f[228][l]+0.6123724356957944*(f[177][l]+f[174][l])+0.6846531968814573*f[83][l])*alpha_vdim[264][l]+0.6123724356957944*f[116][l]*alpha_vdim[260][l]+0.6846531968814573*f[198][l]*alpha_vdim[259][l]+0.5477225575051661*f[107][l]*alpha_vdim[256][l]+0.6123724356957944*(f[30][l]*alpha_vdim[256][l]+f[96][l]*alpha_vdim[255][l])+(0.5477225575051661*f[215][l]+0.6123724356957944*(f[143][l]+f[142][l])+0.6846531968814573*f[50][l])*alpha_vdim[251][l]+(0.6123724356957944*f[200][l]+0.6846531968814573*f[114][l])*alpha_vdim[250][l]+(0.6123724356957944*f[199][l]+0.6846531968814573*f[115][l])*alpha_vdim[249][l]+0.6123724356957944*f[55][l]*alpha_vdim[248][l]+0.273861278752583*f[85][l]*alpha_cdim[247][l]+(0.6123724356957944*f[178][l]+0.6846531968814573*f[84][l])*alpha_vdim[246][l]+0.6123724356957944*f[176][l]*alpha_vdim[245][l]+0.6846531968814573*(f[85][l]*alpha_vdim[245][l]+f[151][l]*alpha_vdim[244][l]+f[116][l]*alpha_vdim[243][l])+0.3061862178478971*f[146][l]*alpha_cdim[243][l]+0.273861278752583*(alpha_vdim[31][l]*f[234][l]+alpha_vdim[6][l]*f[217][l])+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[216][l]+0.2449489742783178*(alpha_vdim[59][l]*f[213][l]+alpha_vdim[68][l]*f[207][l])+0.273861278752583*alpha_vdim[2][l]*f[190][l]+0.3061862178478971*alpha_vdim[31][l]*f[189][l]+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[179][l]+0.2449489742783178*alpha_vdim[22][l]*f[174][l]+(0.2449489742783178*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[37][l])*f[173][l]+0.2449489742783178*(alpha_vdim[25][l]*f[165][l]+alpha_vdim[129][l]*f[164][l])+0.273861278752583*(alpha_vdim[43][l]*f[164][l]+alpha_vdim[17][l]*f[145][l])+0.3061862178478971*(alpha_vdim[0][l]*f[145][l]+alpha_vdim[6][l]*f[144][l])+0.2449489742783178*alpha_vdim[10][l]*f[142][l]+0.273861278752583*alpha_vdim[59][l]*f[141][l]+0.2449489742783178*alpha_vdim[13][l]*f[133][l]+0.273861278752583*alpha_vdim[68][l]*f[132][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[114][l]+(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[110][l]+0.3061862178478971*alpha_vdim[2][l]*f[95][l]+0.2449489742783178*alpha_vdim[38][l]*f[84][l]+0.273861278752583*(alpha_vdim[4][l]*f[84][l]+alpha_vdim[22][l]*f[83][l])+0.2449489742783178*alpha_vdim[44][l]*f[78][l]+0.273861278752583*(alpha_vdim[5][l]*f[78][l]+alpha_vdim[25][l]*f[77][l]+alpha_vdim[10][l]*f[50][l]+alpha_vdim[13][l]*f[46][l]);
+    out[182][l] += 0.6846531968814573*(f[153][l]*alpha_cdim[247][l]+f[118][l]*alpha_cdim[243][l])+(0.2794502844414113*alpha_vdim[129][l]+0.4374088826398531*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6846531968814573*alpha_vdim[5][l])*f[158][l]+(0.2794502844414113*alpha_vdim[120][l]+0.4374088826398531*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[152][l]+(0.4374088826398531*(f[71][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[129][l]+0.4374088826398531*(f[62][l]+f[61][l])*alpha_vdim[120][l]+0.6846531968814573*(f[11][l]*alpha_vdim[120][l]+alpha_cdim[0][l]*f[119][l])+(0.2794502844414113*alpha_vdim[86][l]+0.4374088826398531*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[117][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[102][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[101][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[98][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[97][l]+0.4374088826398531*(f[34][l]+f[33][l])*alpha_vdim[86][l]+0.6846531968814573*(f[3][l]*alpha_vdim[86][l]+alpha_vdim[43][l]*f[71][l]+alpha_vdim[44][l]*f[70][l])+0.6123724356957944*(f[26][l]*alpha_vdim[69][l]+f[27][l]*alpha_vdim[68][l])+0.6846531968814573*(alpha_vdim[37][l]*f[62][l]+alpha_vdim[38][l]*f[61][l])+0.6123724356957944*(f[23][l]*alpha_vdim[60][l]+f[24][l]*alpha_vdim[59][l])+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[57][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[56][l]+0.5477225575051661*(alpha_vdim[25][l]*f[52][l]+alpha_vdim[22][l]*f[51][l])+0.6846531968814573*(alpha_vdim[16][l]*f[34][l]+alpha_vdim[17][l]*f[33][l])+0.6123724356957944*(f[7][l]*alpha_vdim[32][l]+f[8][l]*alpha_vdim[31][l])+0.5477225575051661*alpha_vdim[6][l]*f[21][l];
+    out[183][l] += (0.2794502844414113*f[161][l]+0.4374088826398531*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[372][l]+(0.2794502844414113*f[152][l]+0.4374088826398531*(f[62][l]+f[61][l])+0.6846531968814573*f[11][l])*alpha_vdim[360][l]+(0.2794502844414113*f[120][l]+0.4374088826398531*(f[38][l]+f[37][l])+0.6846531968814573*f[4][l])*alpha_vdim[329][l]+(0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[312][l]+(0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[311][l]+(0.3912303982179757*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[300][l]+(0.3912303982179757*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[299][l]+(0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[287][l]+(0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[286][l]+(0.4374088826398531*f[152][l]+0.6846531968814573*f[61][l])*alpha_vdim[277][l]+(0.4374088826398531*f[152][l]+0.6846531968814573*f[62][l])*alpha_vdim[276][l]+(0.3912303982179757*f[60][l]+0.6123724356957944*f[9][l])*alpha_vdim[275][l]+(0.3912303982179757*f[59][l]+0.6123724356957944*f[10][l])*alpha_vdim[274][l]+0.5477225575051661*(f[53][l]*alpha_vdim[268][l]+f[51][l]*alpha_vdim[264][l])+(0.4374088826398531*f[120][l]+0.6846531968814573*f[37][l])*alpha_vdim[260][l]+(0.4374088826398531*f[120][l]+0.6846531968814573*f[38][l])*alpha_vdim[259][l]+0.6123724356957944*(f[104][l]*alpha_vdim[256][l]+f[105][l]*alpha_vdim[255][l]+f[97][l]*alpha_vdim[251][l]+f[98][l]*alpha_vdim[250][l])+0.5477225575051661*f[22][l]*alpha_vdim[249][l]+0.6846531968814573*f[161][l]*alpha_vdim[248][l]+0.6123724356957944*f[59][l]*alpha_cdim[247][l]+0.6846531968814573*f[152][l]*alpha_vdim[246][l]+0.6123724356957944*(f[59][l]*alpha_vdim[245][l]+f[60][l]*alpha_vdim[244][l])+0.6846531968814573*(f[120][l]*alpha_vdim[243][l]+f[123][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[156][l]+alpha_cdim[0][l]*f[124][l]);
+    out[184][l] += (0.4374088826398531*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[372][l]+(0.3912303982179757*f[152][l]+0.6123724356957944*f[62][l])*alpha_vdim[360][l]+(0.4374088826398531*f[202][l]+0.6846531968814573*f[122][l])*alpha_vdim[329][l]+0.6123724356957944*f[194][l]*alpha_vdim[312][l]+(0.4374088826398531*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[311][l]+0.5477225575051661*f[98][l]*alpha_vdim[300][l]+(0.3912303982179757*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[299][l]+0.6846531968814573*f[222][l]*alpha_vdim[287][l]+(0.4374088826398531*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[286][l]+0.6123724356957944*f[152][l]*alpha_vdim[277][l]+0.3912303982179757*f[61][l]*alpha_vdim[276][l]+0.6123724356957944*(f[11][l]*alpha_vdim[276][l]+f[154][l]*alpha_vdim[275][l])+(0.4374088826398531*f[153][l]+0.6846531968814573*f[64][l])*alpha_vdim[274][l]+0.6123724356957944*f[149][l]*alpha_vdim[268][l]+0.5477225575051661*f[51][l]*alpha_vdim[264][l]+0.6846531968814573*f[202][l]*alpha_vdim[260][l]+0.4374088826398531*f[121][l]*alpha_vdim[259][l]+0.6846531968814573*(f[39][l]*alpha_vdim[259][l]+f[193][l]*alpha_vdim[256][l])+0.6123724356957944*(f[108][l]*alpha_vdim[255][l]+f[97][l]*alpha_vdim[251][l])+0.5477225575051661*f[23][l]*alpha_vdim[250][l]+0.6123724356957944*f[99][l]*alpha_vdim[249][l]+0.6846531968814573*f[162][l]*alpha_vdim[248][l]+0.6123724356957944*f[61][l]*alpha_vdim[246][l]+0.6846531968814573*f[153][l]*alpha_vdim[245][l]+0.6123724356957944*f[63][l]*alpha_vdim[244][l]+0.6846531968814573*f[121][l]*alpha_vdim[243][l]+(0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[44][l])*f[223][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[203][l]+0.6123724356957944*alpha_vdim[69][l]*f[196][l]+0.4374088826398531*alpha_vdim[68][l]*f[195][l]+0.6846531968814573*(alpha_vdim[13][l]*f[195][l]+alpha_vdim[129][l]*f[167][l])+(0.4374088826398531*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[166][l]+0.6123724356957944*alpha_vdim[32][l]*f[156][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[155][l]+0.3912303982179757*alpha_vdim[120][l]*f[152][l]+0.6123724356957944*(alpha_vdim[38][l]*f[152][l]+alpha_vdim[25][l]*f[150][l])+0.6846531968814573*(alpha_cdim[0][l]*f[127][l]+alpha_vdim[86][l]*f[126][l])+(0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[125][l]+0.6123724356957944*f[62][l]*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[68][l]*f[112][l]+0.6123724356957944*(alpha_vdim[12][l]*f[111][l]+alpha_vdim[6][l]*f[100][l])+0.5477225575051661*alpha_vdim[60][l]*f[98][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[97][l]+0.6846531968814573*(alpha_vdim[43][l]*f[79][l]+alpha_vdim[31][l]*f[67][l])+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l])*f[66][l]+0.3912303982179757*alpha_vdim[37][l]*f[61][l]+0.6123724356957944*(alpha_vdim[4][l]*f[61][l]+f[24][l]*alpha_vdim[59][l])+0.5477225575051661*alpha_vdim[22][l]*f[51][l]+0.6846531968814573*alpha_vdim[16][l]*f[42][l]+0.6123724356957944*f[11][l]*alpha_vdim[37][l]+0.5477225575051661*alpha_vdim[9][l]*f[23][l];
+    out[185][l] += (0.4374088826398531*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[372][l]+(0.3912303982179757*f[152][l]+0.6123724356957944*f[61][l])*alpha_vdim[360][l]+(0.4374088826398531*f[202][l]+0.6846531968814573*f[121][l])*alpha_vdim[329][l]+(0.4374088826398531*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[312][l]+0.6123724356957944*f[193][l]*alpha_vdim[311][l]+(0.3912303982179757*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[300][l]+0.5477225575051661*f[97][l]*alpha_vdim[299][l]+0.4374088826398531*f[163][l]*alpha_vdim[287][l]+0.6846531968814573*(f[76][l]*alpha_vdim[287][l]+f[222][l]*alpha_vdim[286][l])+0.3912303982179757*f[62][l]*alpha_vdim[277][l]+0.6123724356957944*(f[11][l]*alpha_vdim[277][l]+f[152][l]*alpha_vdim[276][l])+(0.4374088826398531*f[154][l]+0.6846531968814573*f[63][l])*alpha_vdim[275][l]+0.6123724356957944*(f[153][l]*alpha_vdim[274][l]+f[149][l]*alpha_vdim[268][l])+0.5477225575051661*f[51][l]*alpha_vdim[264][l]+0.4374088826398531*f[122][l]*alpha_vdim[260][l]+0.6846531968814573*(f[39][l]*alpha_vdim[260][l]+f[202][l]*alpha_vdim[259][l])+0.6123724356957944*f[109][l]*alpha_vdim[256][l]+0.6846531968814573*f[194][l]*alpha_vdim[255][l]+0.5477225575051661*f[24][l]*alpha_vdim[251][l]+0.6123724356957944*(f[98][l]*alpha_vdim[250][l]+f[99][l]*alpha_vdim[249][l])+0.6846531968814573*f[163][l]*alpha_vdim[248][l]+0.6123724356957944*(f[64][l]*alpha_cdim[247][l]+f[62][l]*alpha_vdim[246][l]+f[64][l]*alpha_vdim[245][l])+0.6846531968814573*(f[154][l]*alpha_vdim[244][l]+f[122][l]*alpha_vdim[243][l]+f[128][l]*alpha_cdim[243][l])+(0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[43][l])*f[223][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[203][l]+(0.4374088826398531*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[196][l]+0.6123724356957944*alpha_vdim[68][l]*f[195][l]+0.4374088826398531*alpha_vdim[44][l]*f[167][l]+0.6846531968814573*(alpha_vdim[5][l]*f[167][l]+alpha_vdim[129][l]*f[166][l])+(0.4374088826398531*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[156][l]+0.6123724356957944*alpha_vdim[31][l]*f[155][l]+0.3912303982179757*alpha_vdim[120][l]*f[152][l]+0.6123724356957944*(alpha_vdim[37][l]*f[152][l]+alpha_vdim[25][l]*f[150][l])+0.4374088826398531*alpha_vdim[17][l]*f[126][l]+0.6846531968814573*(alpha_vdim[0][l]*f[126][l]+alpha_vdim[86][l]*f[125][l])+0.6123724356957944*(f[61][l]*alpha_vdim[120][l]+alpha_vdim[13][l]*f[112][l])+0.6846531968814573*alpha_vdim[69][l]*f[111][l]+0.6123724356957944*alpha_vdim[6][l]*f[100][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[98][l]+0.5477225575051661*alpha_vdim[59][l]*f[97][l]+0.6846531968814573*alpha_vdim[44][l]*f[79][l]+0.6123724356957944*alpha_vdim[2][l]*f[67][l]+0.6846531968814573*alpha_vdim[32][l]*f[66][l]+0.3912303982179757*alpha_vdim[38][l]*f[62][l]+0.6123724356957944*(alpha_vdim[4][l]*f[62][l]+f[23][l]*alpha_vdim[60][l])+0.5477225575051661*alpha_vdim[22][l]*f[51][l]+0.6846531968814573*alpha_vdim[17][l]*f[42][l]+0.6123724356957944*f[11][l]*alpha_vdim[38][l]+0.5477225575051661*alpha_vdim[10][l]*f[24][l];
+    out[186][l] += (0.2794502844414113*f[161][l]+0.4374088826398531*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[606][l]+(0.2794502844414113*f[158][l]+0.4374088826398531*(f[71][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[603][l]+(0.2794502844414113*f[129][l]+0.4374088826398531*(f[44][l]+f[43][l])+0.6846531968814573*f[5][l])*alpha_vdim[572][l]+(0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[546][l]+(0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[545][l]+(0.3912303982179757*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[543][l]+(0.3912303982179757*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[542][l]+(0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[524][l]+(0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[523][l]+(0.4374088826398531*f[158][l]+0.6846531968814573*f[70][l])*alpha_vdim[520][l]+(0.4374088826398531*f[158][l]+0.6846531968814573*f[71][l])*alpha_vdim[519][l]+(0.3912303982179757*f[69][l]+0.6123724356957944*f[12][l])*alpha_vdim[518][l]+(0.3912303982179757*f[68][l]+0.6123724356957944*f[13][l])*alpha_vdim[517][l]+0.5477225575051661*(f[53][l]*alpha_vdim[508][l]+f[52][l]*alpha_vdim[507][l])+(0.4374088826398531*f[129][l]+0.6846531968814573*f[43][l])*alpha_vdim[503][l]+(0.4374088826398531*f[129][l]+0.6846531968814573*f[44][l])*alpha_vdim[502][l]+0.6123724356957944*(f[104][l]*alpha_vdim[496][l]+f[105][l]*alpha_vdim[495][l]+f[101][l]*alpha_vdim[494][l]+f[102][l]*alpha_vdim[493][l])+0.5477225575051661*f[25][l]*alpha_vdim[492][l]+0.6846531968814573*(f[161][l]*alpha_vdim[490][l]+f[158][l]*alpha_vdim[489][l])+0.6123724356957944*(f[68][l]*alpha_vdim[488][l]+f[69][l]*alpha_vdim[487][l])+0.6846531968814573*(f[129][l]*alpha_vdim[486][l]+f[173][l]*alpha_cdim[247][l]+f[135][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[171][l]+alpha_cdim[0][l]*f[136][l]);
+    out[187][l] += (0.4374088826398531*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[606][l]+(0.3912303982179757*f[158][l]+0.6123724356957944*f[71][l])*alpha_vdim[603][l]+(0.4374088826398531*f[206][l]+0.6846531968814573*f[131][l])*alpha_vdim[572][l]+0.6123724356957944*f[194][l]*alpha_vdim[546][l]+(0.4374088826398531*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[545][l]+0.5477225575051661*f[102][l]*alpha_vdim[543][l]+(0.3912303982179757*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[542][l]+0.6846531968814573*f[222][l]*alpha_vdim[524][l]+(0.4374088826398531*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[523][l]+0.6123724356957944*f[158][l]*alpha_vdim[520][l]+0.3912303982179757*f[70][l]*alpha_vdim[519][l]+0.6123724356957944*(f[14][l]*alpha_vdim[519][l]+f[160][l]*alpha_vdim[518][l])+(0.4374088826398531*f[159][l]+0.6846531968814573*f[73][l])*alpha_vdim[517][l]+0.6123724356957944*f[149][l]*alpha_vdim[508][l]+0.5477225575051661*f[52][l]*alpha_vdim[507][l]+0.6846531968814573*f[206][l]*alpha_vdim[503][l]+0.4374088826398531*f[130][l]*alpha_vdim[502][l]+0.6846531968814573*(f[45][l]*alpha_vdim[502][l]+f[193][l]*alpha_vdim[496][l])+0.6123724356957944*(f[108][l]*alpha_vdim[495][l]+f[101][l]*alpha_vdim[494][l])+0.5477225575051661*f[26][l]*alpha_vdim[493][l]+0.6123724356957944*f[103][l]*alpha_vdim[492][l]+0.6846531968814573*f[162][l]*alpha_vdim[490][l]+0.6123724356957944*f[70][l]*alpha_vdim[489][l]+0.6846531968814573*f[159][l]*alpha_vdim[488][l]+0.6123724356957944*f[72][l]*alpha_vdim[487][l]+0.6846531968814573*f[130][l]*alpha_vdim[486][l]+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[38][l])*f[226][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[210][l]+0.6123724356957944*alpha_vdim[60][l]*f[199][l]+0.4374088826398531*alpha_vdim[59][l]*f[198][l]+0.6846531968814573*(alpha_vdim[10][l]*f[198][l]+alpha_vdim[120][l]*f[176][l])+(0.4374088826398531*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[175][l]+0.6123724356957944*alpha_vdim[32][l]*f[171][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[170][l]+0.3912303982179757*alpha_vdim[129][l]*f[158][l]+0.6123724356957944*(alpha_vdim[44][l]*f[158][l]+alpha_vdim[22][l]*f[151][l])+0.6846531968814573*(alpha_cdim[0][l]*f[139][l]+alpha_vdim[86][l]*f[138][l])+(0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[137][l]+0.6123724356957944*f[71][l]*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[59][l]*f[116][l]+0.6123724356957944*(alpha_vdim[9][l]*f[115][l]+alpha_vdim[6][l]*f[113][l])+0.5477225575051661*alpha_vdim[69][l]*f[102][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[101][l]+0.6846531968814573*(alpha_vdim[37][l]*f[85][l]+alpha_vdim[31][l]*f[82][l])+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l])*f[81][l]+0.3912303982179757*alpha_vdim[43][l]*f[70][l]+0.6123724356957944*(alpha_vdim[5][l]*f[70][l]+f[27][l]*alpha_vdim[68][l])+0.5477225575051661*alpha_vdim[25][l]*f[52][l]+0.6846531968814573*alpha_vdim[16][l]*f[49][l]+0.6123724356957944*f[14][l]*alpha_vdim[43][l]+0.5477225575051661*alpha_vdim[12][l]*f[26][l];
+    out[188][l] += (0.4374088826398531*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[606][l]+(0.3912303982179757*f[158][l]+0.6123724356957944*f[70][l])*alpha_vdim[603][l]+(0.4374088826398531*f[206][l]+0.6846531968814573*f[130][l])*alpha_vdim[572][l]+(0.4374088826398531*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[546][l]+0.6123724356957944*f[193][l]*alpha_vdim[545][l]+(0.3912303982179757*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[543][l]+0.5477225575051661*f[101][l]*alpha_vdim[542][l]+0.4374088826398531*f[163][l]*alpha_vdim[524][l]+0.6846531968814573*(f[76][l]*alpha_vdim[524][l]+f[222][l]*alpha_vdim[523][l])+0.3912303982179757*f[71][l]*alpha_vdim[520][l]+0.6123724356957944*(f[14][l]*alpha_vdim[520][l]+f[158][l]*alpha_vdim[519][l])+(0.4374088826398531*f[160][l]+0.6846531968814573*f[72][l])*alpha_vdim[518][l]+0.6123724356957944*(f[159][l]*alpha_vdim[517][l]+f[149][l]*alpha_vdim[508][l])+0.5477225575051661*f[52][l]*alpha_vdim[507][l]+0.4374088826398531*f[131][l]*alpha_vdim[503][l]+0.6846531968814573*(f[45][l]*alpha_vdim[503][l]+f[206][l]*alpha_vdim[502][l])+0.6123724356957944*f[109][l]*alpha_vdim[496][l]+0.6846531968814573*f[194][l]*alpha_vdim[495][l]+0.5477225575051661*f[27][l]*alpha_vdim[494][l]+0.6123724356957944*(f[102][l]*alpha_vdim[493][l]+f[103][l]*alpha_vdim[492][l])+0.6846531968814573*f[163][l]*alpha_vdim[490][l]+0.6123724356957944*(f[71][l]*alpha_vdim[489][l]+f[73][l]*alpha_vdim[488][l])+0.6846531968814573*(f[160][l]*alpha_vdim[487][l]+f[131][l]*alpha_vdim[486][l]+f[178][l]*alpha_cdim[247][l]+f[140][l]*alpha_cdim[243][l])+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[37][l])*f[226][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[210][l]+(0.4374088826398531*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[199][l]+0.6123724356957944*alpha_vdim[59][l]*f[198][l]+0.4374088826398531*alpha_vdim[38][l]*f[176][l]+0.6846531968814573*(alpha_vdim[4][l]*f[176][l]+alpha_vdim[120][l]*f[175][l])+(0.4374088826398531*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[171][l]+0.6123724356957944*alpha_vdim[31][l]*f[170][l]+0.3912303982179757*alpha_vdim[129][l]*f[158][l]+0.6123724356957944*(alpha_vdim[43][l]*f[158][l]+alpha_vdim[22][l]*f[151][l])+0.4374088826398531*alpha_vdim[17][l]*f[138][l]+0.6846531968814573*(alpha_vdim[0][l]*f[138][l]+alpha_vdim[86][l]*f[137][l])+0.6123724356957944*(f[70][l]*alpha_vdim[129][l]+alpha_vdim[10][l]*f[116][l])+0.6846531968814573*alpha_vdim[60][l]*f[115][l]+0.6123724356957944*alpha_vdim[6][l]*f[113][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[102][l]+0.5477225575051661*alpha_vdim[68][l]*f[101][l]+0.6846531968814573*alpha_vdim[38][l]*f[85][l]+0.6123724356957944*alpha_vdim[2][l]*f[82][l]+0.6846531968814573*alpha_vdim[32][l]*f[81][l]+0.3912303982179757*alpha_vdim[44][l]*f[71][l]+0.6123724356957944*(alpha_vdim[5][l]*f[71][l]+f[26][l]*alpha_vdim[69][l])+0.5477225575051661*alpha_vdim[25][l]*f[52][l]+0.6846531968814573*alpha_vdim[17][l]*f[49][l]+0.6123724356957944*f[14][l]*alpha_vdim[44][l]+0.5477225575051661*alpha_vdim[13][l]*f[27][l];
+    out[189][l] += (0.3912303982179757*f[161][l]+0.6123724356957944*f[75][l])*alpha_vdim[606][l]+(0.4374088826398531*f[223][l]+0.6846531968814573*f[167][l])*alpha_vdim[603][l]+(0.4374088826398531*f[207][l]+0.6846531968814573*f[133][l])*alpha_vdim[572][l]+0.5477225575051661*f[105][l]*alpha_vdim[546][l]+0.3912303982179757*f[104][l]*alpha_vdim[545][l]+0.6123724356957944*(f[29][l]*alpha_vdim[545][l]+f[196][l]*alpha_vdim[543][l])+(0.4374088826398531*f[195][l]+0.6846531968814573*f[112][l])*alpha_vdim[542][l]+0.6123724356957944*f[161][l]*alpha_vdim[524][l]+(0.3912303982179757*f[74][l]+0.6123724356957944*f[15][l])*alpha_vdim[523][l]+0.6846531968814573*f[223][l]*alpha_vdim[520][l]+(0.4374088826398531*f[166][l]+0.6846531968814573*f[79][l])*alpha_vdim[519][l]+0.6123724356957944*f[165][l]*alpha_vdim[518][l]+(0.4374088826398531*f[164][l]+0.6846531968814573*f[78][l])*alpha_vdim[517][l]+0.5477225575051661*f[53][l]*alpha_vdim[508][l]+0.6123724356957944*f[150][l]*alpha_vdim[507][l]+0.6846531968814573*f[207][l]*alpha_vdim[503][l]+(0.4374088826398531*f[132][l]+0.6846531968814573*f[46][l])*alpha_vdim[502][l]+0.6123724356957944*f[104][l]*alpha_vdim[496][l]+0.5477225575051661*f[28][l]*alpha_vdim[495][l]+0.6846531968814573*f[195][l]*alpha_vdim[494][l]+0.6123724356957944*(f[111][l]*alpha_vdim[493][l]+f[110][l]*alpha_vdim[492][l]+f[74][l]*alpha_vdim[490][l])+0.6846531968814573*(f[166][l]*alpha_vdim[489][l]+f[164][l]*alpha_vdim[488][l])+0.6123724356957944*f[77][l]*alpha_vdim[487][l]+0.6846531968814573*f[132][l]*alpha_vdim[486][l]+(0.3912303982179757*f[161][l]+0.6123724356957944*f[75][l])*alpha_vdim[372][l]+(0.4374088826398531*f[226][l]+0.6846531968814573*f[176][l])*alpha_vdim[360][l]+(0.4374088826398531*f[213][l]+0.6846531968814573*f[142][l])*alpha_vdim[329][l]+0.5477225575051661*f[105][l]*alpha_vdim[312][l]+0.3912303982179757*f[104][l]*alpha_vdim[311][l]+0.6123724356957944*(f[29][l]*alpha_vdim[311][l]+f[199][l]*alpha_vdim[300][l])+(0.4374088826398531*f[198][l]+0.6846531968814573*f[116][l])*alpha_vdim[299][l]+0.6123724356957944*f[161][l]*alpha_vdim[287][l]+(0.3912303982179757*f[74][l]+0.6123724356957944*f[15][l])*alpha_vdim[286][l]+0.6846531968814573*f[226][l]*alpha_vdim[277][l]+(0.4374088826398531*f[175][l]+0.6846531968814573*f[85][l])*alpha_vdim[276][l]+0.6123724356957944*f[174][l]*alpha_vdim[275][l]+(0.4374088826398531*f[173][l]+0.6846531968814573*f[84][l])*alpha_vdim[274][l]+0.5477225575051661*f[53][l]*alpha_vdim[268][l]+0.6123724356957944*f[151][l]*alpha_vdim[264][l]+0.6846531968814573*f[213][l]*alpha_vdim[260][l]+(0.4374088826398531*f[141][l]+0.6846531968814573*f[50][l])*alpha_vdim[259][l]+0.6123724356957944*f[104][l]*alpha_vdim[256][l]+0.5477225575051661*f[28][l]*alpha_vdim[255][l]+0.6846531968814573*f[198][l]*alpha_vdim[251][l]+0.6123724356957944*(f[115][l]*alpha_vdim[250][l]+f[114][l]*alpha_vdim[249][l]+f[74][l]*alpha_vdim[248][l])+0.6846531968814573*(f[175][l]*alpha_vdim[246][l]+f[173][l]*alpha_vdim[245][l])+0.6123724356957944*f[83][l]*alpha_vdim[244][l]+0.6846531968814573*(f[141][l]*alpha_vdim[243][l]+alpha_cdim[3][l]*f[180][l]+alpha_cdim[0][l]*f[144][l]);
+    out[190][l] += (0.3912303982179757*f[161][l]+0.6123724356957944*f[74][l])*alpha_vdim[606][l]+(0.4374088826398531*f[223][l]+0.6846531968814573*f[166][l])*alpha_vdim[603][l]+(0.4374088826398531*f[207][l]+0.6846531968814573*f[132][l])*alpha_vdim[572][l]+(0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[546][l]+0.5477225575051661*f[104][l]*alpha_vdim[545][l]+(0.4374088826398531*f[196][l]+0.6846531968814573*f[111][l])*alpha_vdim[543][l]+0.6123724356957944*f[195][l]*alpha_vdim[542][l]+0.3912303982179757*f[75][l]*alpha_vdim[524][l]+0.6123724356957944*(f[15][l]*alpha_vdim[524][l]+f[161][l]*alpha_vdim[523][l])+0.4374088826398531*f[167][l]*alpha_vdim[520][l]+0.6846531968814573*(f[79][l]*alpha_vdim[520][l]+f[223][l]*alpha_vdim[519][l])+(0.4374088826398531*f[165][l]+0.6846531968814573*f[77][l])*alpha_vdim[518][l]+0.6123724356957944*f[164][l]*alpha_vdim[517][l]+0.5477225575051661*f[53][l]*alpha_vdim[508][l]+0.6123724356957944*f[150][l]*alpha_vdim[507][l]+0.4374088826398531*f[133][l]*alpha_vdim[503][l]+0.6846531968814573*(f[46][l]*alpha_vdim[503][l]+f[207][l]*alpha_vdim[502][l])+0.5477225575051661*f[29][l]*alpha_vdim[496][l]+0.6123724356957944*(f[105][l]*alpha_vdim[495][l]+f[112][l]*alpha_vdim[494][l])+0.6846531968814573*f[196][l]*alpha_vdim[493][l]+0.6123724356957944*(f[110][l]*alpha_vdim[492][l]+f[75][l]*alpha_vdim[490][l])+0.6846531968814573*f[167][l]*alpha_vdim[489][l]+0.6123724356957944*f[78][l]*alpha_vdim[488][l]+0.6846531968814573*(f[165][l]*alpha_vdim[487][l]+f[133][l]*alpha_vdim[486][l])+(0.3912303982179757*f[161][l]+0.6123724356957944*f[74][l])*alpha_vdim[372][l]+(0.4374088826398531*f[226][l]+0.6846531968814573*f[175][l])*alpha_vdim[360][l]+(0.4374088826398531*f[213][l]+0.6846531968814573*f[141][l])*alpha_vdim[329][l]+(0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[312][l]+0.5477225575051661*f[104][l]*alpha_vdim[311][l]+(0.4374088826398531*f[199][l]+0.6846531968814573*f[115][l])*alpha_vdim[300][l]+0.6123724356957944*f[198][l]*alpha_vdim[299][l]+0.3912303982179757*f[75][l]*alpha_vdim[287][l]+0.6123724356957944*(f[15][l]*alpha_vdim[287][l]+f[161][l]*alpha_vdim[286][l])+0.4374088826398531*f[176][l]*alpha_vdim[277][l]+0.6846531968814573*(f[85][l]*alpha_vdim[277][l]+f[226][l]*alpha_vdim[276][l])+(0.4374088826398531*f[174][l]+0.6846531968814573*f[83][l])*alpha_vdim[275][l]+0.6123724356957944*f[173][l]*alpha_vdim[274][l]+0.5477225575051661*f[53][l]*alpha_vdim[268][l]+0.6123724356957944*f[151][l]*alpha_vdim[264][l]+0.4374088826398531*f[142][l]*alpha_vdim[260][l]+0.6846531968814573*(f[50][l]*alpha_vdim[260][l]+f[213][l]*alpha_vdim[259][l])+0.5477225575051661*f[29][l]*alpha_vdim[256][l]+0.6123724356957944*(f[105][l]*alpha_vdim[255][l]+f[116][l]*alpha_vdim[251][l])+0.6846531968814573*f[199][l]*alpha_vdim[250][l]+0.6123724356957944*(f[114][l]*alpha_vdim[249][l]+f[75][l]*alpha_vdim[248][l]+f[84][l]*alpha_cdim[247][l])+0.6846531968814573*f[176][l]*alpha_vdim[246][l]+0.6123724356957944*f[84][l]*alpha_vdim[245][l]+0.6846531968814573*(f[174][l]*alpha_vdim[244][l]+f[142][l]*alpha_vdim[243][l]+f[145][l]*alpha_cdim[243][l]);
+    out[191][l] += 0.6123724356957944*(f[222][l]*alpha_vdim[606][l]+f[223][l]*alpha_vdim[603][l])+0.6846531968814573*f[237][l]*alpha_vdim[572][l]+0.6123724356957944*(f[194][l]*alpha_vdim[546][l]+f[193][l]*alpha_vdim[545][l]+f[196][l]*alpha_vdim[543][l]+f[195][l]*alpha_vdim[542][l]+f[163][l]*alpha_vdim[524][l]+f[162][l]*alpha_vdim[523][l]+f[167][l]*alpha_vdim[520][l]+f[166][l]*alpha_vdim[519][l])+0.6846531968814573*(f[225][l]*alpha_vdim[518][l]+f[224][l]*alpha_vdim[517][l])+0.6123724356957944*(f[149][l]*alpha_vdim[508][l]+f[150][l]*alpha_vdim[507][l])+0.6846531968814573*(f[209][l]*alpha_vdim[503][l]+f[208][l]*alpha_vdim[502][l])+0.6123724356957944*(f[109][l]*alpha_vdim[496][l]+f[108][l]*alpha_vdim[495][l]+f[112][l]*alpha_vdim[494][l]+f[111][l]*alpha_vdim[493][l])+0.6846531968814573*f[197][l]*alpha_vdim[492][l]+0.6123724356957944*(f[76][l]*alpha_vdim[490][l]+f[79][l]*alpha_vdim[489][l])+0.6846531968814573*(f[169][l]*alpha_vdim[488][l]+f[168][l]*alpha_vdim[487][l]+f[134][l]*alpha_vdim[486][l])+0.6123724356957944*(f[222][l]*alpha_vdim[372][l]+f[226][l]*alpha_vdim[360][l])+0.6846531968814573*f[238][l]*alpha_vdim[329][l]+0.6123724356957944*(f[194][l]*alpha_vdim[312][l]+f[193][l]*alpha_vdim[311][l]+f[199][l]*alpha_vdim[300][l]+f[198][l]*alpha_vdim[299][l]+f[163][l]*alpha_vdim[287][l]+f[162][l]*alpha_vdim[286][l]+f[176][l]*alpha_vdim[277][l]+f[175][l]*alpha_vdim[276][l])+0.6846531968814573*(f[228][l]*alpha_vdim[275][l]+f[227][l]*alpha_vdim[274][l])+0.6123724356957944*(f[149][l]*alpha_vdim[268][l]+f[151][l]*alpha_vdim[264][l])+0.6846531968814573*(f[215][l]*alpha_vdim[260][l]+f[214][l]*alpha_vdim[259][l])+0.6123724356957944*(f[109][l]*alpha_vdim[256][l]+f[108][l]*alpha_vdim[255][l]+f[116][l]*alpha_vdim[251][l]+f[115][l]*alpha_vdim[250][l])+0.6846531968814573*f[200][l]*alpha_vdim[249][l]+0.6123724356957944*(f[76][l]*alpha_vdim[248][l]+f[85][l]*alpha_vdim[246][l])+0.6846531968814573*(f[178][l]*alpha_vdim[245][l]+f[177][l]*alpha_vdim[244][l]+f[143][l]*alpha_vdim[243][l]+alpha_vdim[86][l]*f[239][l]+alpha_vdim[32][l]*f[230][l]+alpha_vdim[31][l]*f[229][l])+0.6123724356957944*(alpha_vdim[120][l]*f[226][l]+alpha_vdim[129][l]*f[223][l])+0.6846531968814573*(alpha_vdim[17][l]*f[219][l]+alpha_vdim[16][l]*f[218][l]+alpha_vdim[6][l]*f[201][l])+0.6123724356957944*(alpha_vdim[60][l]*f[199][l]+alpha_vdim[59][l]*f[198][l]+alpha_vdim[69][l]*f[196][l]+alpha_vdim[68][l]*f[195][l])+0.6846531968814573*(alpha_vdim[2][l]*f[181][l]+alpha_vdim[1][l]*f[180][l])+0.6123724356957944*(alpha_vdim[38][l]*f[176][l]+alpha_vdim[37][l]*f[175][l]+alpha_vdim[44][l]*f[167][l]+alpha_vdim[43][l]*f[166][l]+alpha_vdim[22][l]*f[151][l]+alpha_vdim[25][l]*f[150][l])+0.6846531968814573*alpha_vdim[0][l]*f[146][l]+0.6123724356957944*(alpha_vdim[10][l]*f[116][l]+alpha_vdim[9][l]*f[115][l]+alpha_vdim[13][l]*f[112][l]+alpha_vdim[12][l]*f[111][l]+alpha_vdim[4][l]*f[85][l]+alpha_vdim[5][l]*f[79][l]);
+    out[192][l] += (0.1117801137765645*f[203][l]+0.1749635530559412*(f[126][l]+f[125][l])+0.1249739664685295*f[117][l]+0.273861278752583*f[42][l]+0.1956151991089878*(f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[606][l]+(0.1117801137765645*f[202][l]+0.1749635530559412*(f[122][l]+f[121][l])+0.1249739664685295*f[120][l]+0.273861278752583*f[39][l]+0.1956151991089878*(f[38][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[603][l]+(0.1249739664685295*f[152][l]+0.1956151991089878*(f[62][l]+f[61][l])+0.3061862178478971*f[11][l])*alpha_vdim[572][l]+(0.1564921592871903*f[156][l]+0.2449489742783178*f[66][l]+0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[546][l]+(0.1564921592871903*f[155][l]+0.2449489742783178*f[67][l]+0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[545][l]+(0.1564921592871903*f[154][l]+0.2449489742783178*f[63][l]+0.1749635530559412*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[543][l]+(0.1564921592871903*f[153][l]+0.2449489742783178*f[64][l]+0.1749635530559412*f[59][l]+0.273861278752583*f[10][l])*alpha_vdim[542][l]+(0.1749635530559412*f[203][l]+0.273861278752583*f[125][l]+0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[524][l]+(0.1749635530559412*f[203][l]+0.273861278752583*f[126][l]+0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[523][l]+(0.1749635530559412*f[202][l]+0.273861278752583*f[121][l]+0.1956151991089878*f[120][l]+0.3061862178478971*f[37][l])*alpha_vdim[520][l]+(0.1749635530559412*f[202][l]+0.273861278752583*f[122][l]+0.1956151991089878*f[120][l]+0.3061862178478971*f[38][l])*alpha_vdim[519][l]+(0.1749635530559412*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[518][l]+(0.1749635530559412*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[517][l]+(0.2190890230020664*f[100][l]+0.2449489742783178*f[21][l])*alpha_vdim[508][l]+(0.2190890230020664*f[99][l]+0.2449489742783178*f[22][l])*alpha_vdim[507][l]+(0.1956151991089878*f[152][l]+0.3061862178478971*f[61][l])*alpha_vdim[503][l]+(0.1956151991089878*f[152][l]+0.3061862178478971*f[62][l])*alpha_vdim[502][l]+(0.2449489742783178*f[155][l]+0.273861278752583*f[56][l])*alpha_vdim[496][l]+(0.2449489742783178*f[156][l]+0.273861278752583*f[57][l])*alpha_vdim[495][l]+(0.2449489742783178*f[153][l]+0.273861278752583*f[59][l])*alpha_vdim[494][l]+(0.2449489742783178*f[154][l]+0.273861278752583*f[60][l])*alpha_vdim[493][l]+0.2449489742783178*f[51][l]*alpha_vdim[492][l]+(0.273861278752583*f[203][l]+0.3061862178478971*f[117][l])*alpha_vdim[490][l]+(0.273861278752583*f[202][l]+0.3061862178478971*f[120][l])*alpha_vdim[489][l]+0.273861278752583*(f[97][l]*alpha_vdim[488][l]+f[98][l]*alpha_vdim[487][l])+0.3061862178478971*f[152][l]*alpha_vdim[486][l]+(0.1117801137765645*f[210][l]+0.1749635530559412*(f[138][l]+f[137][l])+0.1249739664685295*f[117][l]+0.273861278752583*f[49][l]+0.1956151991089878*(f[34][l]+f[33][l])+0.3061862178478971*f[3][l])*alpha_vdim[372][l]+(0.1117801137765645*f[206][l]+0.1749635530559412*(f[131][l]+f[130][l])+0.1249739664685295*f[129][l]+0.273861278752583*f[45][l]+0.1956151991089878*(f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[360][l]+(0.1249739664685295*f[158][l]+0.1956151991089878*(f[71][l]+f[70][l])+0.3061862178478971*f[14][l])*alpha_vdim[329][l]+(0.1564921592871903*f[171][l]+0.2449489742783178*f[81][l]+0.1749635530559412*f[57][l]+0.273861278752583*f[7][l])*alpha_vdim[312][l]+(0.1564921592871903*f[170][l]+0.2449489742783178*f[82][l]+0.1749635530559412*f[56][l]+0.273861278752583*f[8][l])*alpha_vdim[311][l]+(0.1564921592871903*f[160][l]+0.2449489742783178*f[72][l]+0.1749635530559412*f[69][l]+0.273861278752583*f[12][l])*alpha_vdim[300][l]+(0.1564921592871903*f[159][l]+0.2449489742783178*f[73][l]+0.1749635530559412*f[68][l]+0.273861278752583*f[13][l])*alpha_vdim[299][l]+(0.1749635530559412*f[210][l]+0.273861278752583*f[137][l]+0.1956151991089878*f[117][l]+0.3061862178478971*f[33][l])*alpha_vdim[287][l]+(0.1749635530559412*f[210][l]+0.273861278752583*f[138][l]+0.1956151991089878*f[117][l]+0.3061862178478971*f[34][l])*alpha_vdim[286][l]+(0.1749635530559412*f[206][l]+0.273861278752583*f[130][l]+0.1956151991089878*f[129][l]+0.3061862178478971*f[43][l])*alpha_vdim[277][l]+(0.1749635530559412*f[206][l]+0.273861278752583*f[131][l]+0.1956151991089878*f[129][l]+0.3061862178478971*f[44][l])*alpha_vdim[276][l]+(0.1749635530559412*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[275][l]+(0.1749635530559412*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[274][l]+(0.2190890230020664*f[113][l]+0.2449489742783178*f[21][l])*alpha_vdim[268][l]+(0.2190890230020664*f[103][l]+0.2449489742783178*f[25][l])*alpha_vdim[264][l]+(0.1956151991089878*f[158][l]+0.3061862178478971*f[70][l])*alpha_vdim[260][l]+(0.1956151991089878*f[158][l]+0.3061862178478971*f[71][l])*alpha_vdim[259][l]+(0.2449489742783178*f[170][l]+0.273861278752583*f[56][l])*alpha_vdim[256][l]+(0.2449489742783178*f[171][l]+0.273861278752583*f[57][l])*alpha_vdim[255][l]+(0.2449489742783178*f[159][l]+0.273861278752583*f[68][l])*alpha_vdim[251][l]+(0.2449489742783178*f[160][l]+0.273861278752583*f[69][l])*alpha_vdim[250][l]+0.2449489742783178*f[52][l]*alpha_vdim[249][l]+(0.273861278752583*f[210][l]+0.3061862178478971*f[117][l])*alpha_vdim[248][l]+(0.6123724356957944*f[195][l]+0.6846531968814573*f[101][l])*alpha_cdim[247][l]+(0.273861278752583*f[206][l]+0.3061862178478971*f[129][l])*alpha_vdim[246][l]+0.273861278752583*(f[101][l]*alpha_vdim[245][l]+f[102][l]*alpha_vdim[244][l])+0.3061862178478971*f[158][l]*alpha_vdim[243][l]+0.6846531968814573*f[147][l]*alpha_cdim[243][l]+(0.1117801137765645*alpha_vdim[129][l]+0.1749635530559412*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.273861278752583*alpha_vdim[5][l])*f[213][l]+(0.1117801137765645*alpha_vdim[120][l]+0.1749635530559412*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.273861278752583*alpha_vdim[4][l])*f[207][l]+0.6123724356957944*alpha_cdim[3][l]*f[194][l]+(0.1564921592871903*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[174][l]+(0.1564921592871903*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[173][l]+(0.1564921592871903*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[165][l]+(0.1564921592871903*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[164][l]+(0.1249739664685295*alpha_vdim[86][l]+0.1956151991089878*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[161][l]+0.6846531968814573*alpha_cdim[0][l]*f[148][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[43][l])*f[142][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l])*f[141][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[37][l])*f[133][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[132][l]+(0.1249739664685295*alpha_vdim[120][l]+0.1956151991089878*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])*f[129][l]+(0.1249739664685295*f[120][l]+0.273861278752583*f[50][l]+0.1956151991089878*(f[38][l]+f[37][l])+0.3061862178478971*f[4][l])*alpha_vdim[129][l]+(0.1956151991089878*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[120][l]+(0.273861278752583*f[46][l]+0.1956151991089878*(f[44][l]+f[43][l])+0.3061862178478971*f[5][l])*alpha_vdim[120][l]+0.2190890230020664*(alpha_vdim[25][l]*f[114][l]+alpha_vdim[22][l]*f[110][l])+(0.1749635530559412*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[105][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[104][l]+(0.1956151991089878*(f[75][l]+f[74][l])+0.3061862178478971*f[15][l])*alpha_vdim[86][l]+0.2449489742783178*(alpha_vdim[68][l]*f[84][l]+alpha_vdim[69][l]*f[83][l]+alpha_vdim[59][l]*f[78][l]+alpha_vdim[60][l]*f[77][l])+0.3061862178478971*(alpha_vdim[16][l]*f[75][l]+alpha_vdim[17][l]*f[74][l])+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[69][l]+(0.1749635530559412*f[60][l]+0.273861278752583*f[9][l])*alpha_vdim[69][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[68][l]+0.1749635530559412*f[59][l]*alpha_vdim[68][l]+0.273861278752583*(f[10][l]*alpha_vdim[68][l]+alpha_vdim[12][l]*f[60][l]+f[12][l]*alpha_vdim[60][l]+alpha_vdim[13][l]*f[59][l]+f[13][l]*alpha_vdim[59][l])+0.2449489742783178*alpha_vdim[6][l]*f[53][l]+0.3061862178478971*(alpha_vdim[37][l]*f[44][l]+f[37][l]*alpha_vdim[44][l]+alpha_vdim[38][l]*f[43][l]+f[38][l]*alpha_vdim[43][l])+0.273861278752583*(f[28][l]*alpha_vdim[32][l]+f[29][l]*alpha_vdim[31][l])+0.2449489742783178*(alpha_vdim[22][l]*f[25][l]+f[22][l]*alpha_vdim[25][l]);
+    out[193][l] += (0.1564921592871903*f[204][l]+0.2449489742783178*f[128][l]+0.1749635530559412*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[606][l]+(0.1564921592871903*f[97][l]+0.2449489742783178*f[24][l])*alpha_vdim[603][l]+(0.1749635530559412*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[572][l]+(0.2190890230020664*f[157][l]+0.2449489742783178*f[58][l])*alpha_vdim[546][l]+(0.1564921592871903*f[232][l]+0.2449489742783178*f[185][l]+0.1749635530559412*(f[184][l]+f[182][l])+0.273861278752583*(f[91][l]+f[88][l])+0.1956151991089878*f[87][l]+0.3061862178478971*f[18][l])*alpha_vdim[545][l]+0.2190890230020664*f[51][l]*alpha_vdim[543][l]+(0.1564921592871903*f[152][l]+0.2449489742783178*f[62][l]+0.1749635530559412*f[61][l]+0.273861278752583*f[11][l])*alpha_vdim[542][l]+(0.2449489742783178*f[204][l]+0.273861278752583*f[118][l])*alpha_vdim[524][l]+(0.1749635530559412*f[204][l]+0.273861278752583*f[128][l]+0.1956151991089878*f[118][l]+0.3061862178478971*f[36][l])*alpha_vdim[523][l]+0.2449489742783178*f[97][l]*alpha_vdim[520][l]+(0.1749635530559412*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[519][l]+0.2449489742783178*f[99][l]*alpha_vdim[518][l]+(0.1749635530559412*f[202][l]+0.273861278752583*f[122][l]+0.1956151991089878*f[121][l]+0.3061862178478971*f[39][l])*alpha_vdim[517][l]+(0.2190890230020664*f[205][l]+0.2449489742783178*(f[127][l]+f[119][l])+0.273861278752583*f[35][l])*alpha_vdim[508][l]+(0.2190890230020664*f[98][l]+0.2449489742783178*f[23][l])*alpha_vdim[507][l]+0.273861278752583*f[153][l]*alpha_vdim[503][l]+(0.1956151991089878*f[153][l]+0.3061862178478971*f[64][l])*alpha_vdim[502][l]+(0.2449489742783178*f[232][l]+0.273861278752583*(f[184][l]+f[182][l])+0.3061862178478971*f[87][l])*alpha_vdim[496][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[58][l])*alpha_vdim[495][l]+(0.2449489742783178*f[152][l]+0.273861278752583*f[61][l])*alpha_vdim[494][l]+0.2449489742783178*f[51][l]*alpha_vdim[493][l]+(0.2449489742783178*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[492][l]+(0.273861278752583*f[204][l]+0.3061862178478971*f[118][l])*alpha_vdim[490][l]+0.273861278752583*f[97][l]*alpha_vdim[489][l]+(0.273861278752583*f[202][l]+0.3061862178478971*f[121][l])*alpha_vdim[488][l]+0.273861278752583*f[99][l]*alpha_vdim[487][l]+0.3061862178478971*f[153][l]*alpha_vdim[486][l]+(0.1564921592871903*f[211][l]+0.2449489742783178*f[140][l]+0.1749635530559412*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[372][l]+(0.1564921592871903*f[101][l]+0.2449489742783178*f[27][l])*alpha_vdim[360][l]+(0.1749635530559412*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[329][l]+(0.2190890230020664*f[172][l]+0.2449489742783178*f[58][l])*alpha_vdim[312][l]+(0.1564921592871903*f[233][l]+0.2449489742783178*f[188][l]+0.1749635530559412*(f[187][l]+f[182][l])+0.273861278752583*(f[94][l]+f[88][l])+0.1956151991089878*f[87][l]+0.3061862178478971*f[18][l])*alpha_vdim[311][l]+0.2190890230020664*f[52][l]*alpha_vdim[300][l]+(0.1564921592871903*f[158][l]+0.2449489742783178*f[71][l]+0.1749635530559412*f[70][l]+0.273861278752583*f[14][l])*alpha_vdim[299][l]+(0.2449489742783178*f[211][l]+0.273861278752583*f[118][l])*alpha_vdim[287][l]+(0.1749635530559412*f[211][l]+0.273861278752583*f[140][l]+0.1956151991089878*f[118][l]+0.3061862178478971*f[36][l])*alpha_vdim[286][l]+0.2449489742783178*f[101][l]*alpha_vdim[277][l]+(0.1749635530559412*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[276][l]+0.2449489742783178*f[103][l]*alpha_vdim[275][l]+(0.1749635530559412*f[206][l]+0.273861278752583*f[131][l]+0.1956151991089878*f[130][l]+0.3061862178478971*f[45][l])*alpha_vdim[274][l]+(0.2190890230020664*f[212][l]+0.2449489742783178*(f[139][l]+f[119][l])+0.273861278752583*f[35][l])*alpha_vdim[268][l]+(0.2190890230020664*f[102][l]+0.2449489742783178*f[26][l])*alpha_vdim[264][l]+0.273861278752583*f[159][l]*alpha_vdim[260][l]+(0.1956151991089878*f[159][l]+0.3061862178478971*f[73][l])*alpha_vdim[259][l]+(0.2449489742783178*f[233][l]+0.273861278752583*(f[187][l]+f[182][l])+0.3061862178478971*f[87][l])*alpha_vdim[256][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[58][l])*alpha_vdim[255][l]+(0.2449489742783178*f[158][l]+0.273861278752583*f[70][l])*alpha_vdim[251][l]+0.2449489742783178*f[52][l]*alpha_vdim[250][l]+(0.2449489742783178*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[249][l]+(0.273861278752583*f[211][l]+0.3061862178478971*f[118][l])*alpha_vdim[248][l]+(0.273861278752583*f[208][l]+0.3061862178478971*f[130][l])*alpha_cdim[247][l]+0.273861278752583*f[101][l]*alpha_vdim[246][l]+(0.273861278752583*f[206][l]+0.3061862178478971*f[130][l])*alpha_vdim[245][l]+0.273861278752583*f[103][l]*alpha_vdim[244][l]+0.3061862178478971*(f[159][l]*alpha_vdim[243][l]+f[162][l]*alpha_cdim[243][l])+(0.3499271061118826*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[226][l]+(0.3499271061118826*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[223][l]+0.4898979485566357*alpha_vdim[25][l]*f[199][l]+(0.3499271061118826*alpha_vdim[129][l]+0.5477225575051661*alpha_vdim[44][l]+0.3912303982179757*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[198][l]+0.4898979485566357*alpha_vdim[22][l]*f[196][l]+(0.3499271061118826*alpha_vdim[120][l]+0.5477225575051661*alpha_vdim[38][l]+0.3912303982179757*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[195][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[192][l]+0.5477225575051661*alpha_vdim[68][l]*f[176][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[175][l]+0.5477225575051661*alpha_vdim[59][l]*f[167][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[166][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[158][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[152][l]+(0.4898979485566357*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[151][l]+(0.4898979485566357*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[150][l]+0.6846531968814573*alpha_cdim[0][l]*f[149][l]+0.5477225575051661*alpha_vdim[6][l]*f[148][l]+(0.3912303982179757*alpha_vdim[86][l]+0.6123724356957944*alpha_vdim[17][l]+0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[147][l]+(0.5477225575051661*f[116][l]+0.3912303982179757*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[129][l]+(0.5477225575051661*f[112][l]+0.3912303982179757*f[101][l])*alpha_vdim[120][l]+0.6123724356957944*(f[27][l]*alpha_vdim[120][l]+alpha_vdim[43][l]*f[116][l])+0.5477225575051661*alpha_vdim[25][l]*f[115][l]+0.6123724356957944*alpha_vdim[37][l]*f[112][l]+0.5477225575051661*alpha_vdim[22][l]*f[111][l]+0.6123724356957944*alpha_vdim[31][l]*f[107][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[106][l]+0.5477225575051661*alpha_vdim[22][l]*f[102][l]+(0.6123724356957944*alpha_vdim[38][l]+0.4374088826398531*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[101][l]+0.5477225575051661*alpha_vdim[25][l]*f[98][l]+(0.6123724356957944*alpha_vdim[44][l]+0.4374088826398531*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[97][l]+0.5477225575051661*alpha_vdim[32][l]*f[96][l]+0.6123724356957944*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[96][l]+f[55][l]*alpha_vdim[86][l]+alpha_vdim[68][l]*f[85][l]+alpha_vdim[59][l]*(f[79][l]+f[71][l]))+(0.4374088826398531*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[10][l])*f[70][l]+0.5477225575051661*f[51][l]*alpha_vdim[69][l]+(0.6123724356957944*f[62][l]+0.4374088826398531*f[61][l])*alpha_vdim[68][l]+0.6846531968814573*(f[11][l]*alpha_vdim[68][l]+alpha_vdim[13][l]*f[61][l])+0.5477225575051661*f[52][l]*alpha_vdim[60][l]+0.6846531968814573*(f[14][l]*alpha_vdim[59][l]+alpha_vdim[16][l]*f[55][l])+0.6123724356957944*(alpha_vdim[6][l]*f[54][l]+alpha_vdim[9][l]*f[52][l]+alpha_vdim[12][l]*f[51][l])+0.6846531968814573*(f[24][l]*alpha_vdim[43][l]+f[27][l]*alpha_vdim[37][l]+f[30][l]*alpha_vdim[31][l])+0.6123724356957944*(alpha_vdim[22][l]*f[26][l]+f[23][l]*alpha_vdim[25][l]);
+    out[194][l] += (0.1564921592871903*f[205][l]+0.2449489742783178*f[127][l]+0.1749635530559412*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[606][l]+(0.1564921592871903*f[98][l]+0.2449489742783178*f[23][l])*alpha_vdim[603][l]+(0.1749635530559412*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[572][l]+(0.1564921592871903*f[232][l]+0.1749635530559412*f[185][l]+0.2449489742783178*f[184][l]+0.1749635530559412*f[182][l]+0.273861278752583*f[91][l]+0.1956151991089878*f[88][l]+0.273861278752583*f[87][l]+0.3061862178478971*f[18][l])*alpha_vdim[546][l]+(0.2190890230020664*f[157][l]+0.2449489742783178*f[58][l])*alpha_vdim[545][l]+(0.1564921592871903*f[152][l]+0.1749635530559412*f[62][l]+0.2449489742783178*f[61][l]+0.273861278752583*f[11][l])*alpha_vdim[543][l]+0.2190890230020664*f[51][l]*alpha_vdim[542][l]+(0.1749635530559412*f[205][l]+0.273861278752583*f[127][l]+0.1956151991089878*f[119][l]+0.3061862178478971*f[35][l])*alpha_vdim[524][l]+(0.2449489742783178*f[205][l]+0.273861278752583*f[119][l])*alpha_vdim[523][l]+(0.1749635530559412*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[520][l]+0.2449489742783178*f[98][l]*alpha_vdim[519][l]+(0.1749635530559412*f[202][l]+0.1956151991089878*f[122][l]+0.273861278752583*f[121][l]+0.3061862178478971*f[39][l])*alpha_vdim[518][l]+0.2449489742783178*f[99][l]*alpha_vdim[517][l]+(0.2190890230020664*f[204][l]+0.2449489742783178*(f[128][l]+f[118][l])+0.273861278752583*f[36][l])*alpha_vdim[508][l]+(0.2190890230020664*f[97][l]+0.2449489742783178*f[24][l])*alpha_vdim[507][l]+(0.1956151991089878*f[154][l]+0.3061862178478971*f[63][l])*alpha_vdim[503][l]+0.273861278752583*f[154][l]*alpha_vdim[502][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[58][l])*alpha_vdim[496][l]+(0.2449489742783178*f[232][l]+0.273861278752583*(f[185][l]+f[182][l])+0.3061862178478971*f[88][l])*alpha_vdim[495][l]+0.2449489742783178*f[51][l]*alpha_vdim[494][l]+(0.2449489742783178*f[152][l]+0.273861278752583*f[62][l])*alpha_vdim[493][l]+(0.2449489742783178*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[492][l]+(0.273861278752583*f[205][l]+0.3061862178478971*f[119][l])*alpha_vdim[490][l]+0.273861278752583*(f[98][l]*alpha_vdim[489][l]+f[99][l]*alpha_vdim[488][l]+f[202][l]*alpha_vdim[487][l])+0.3061862178478971*(f[122][l]*alpha_vdim[487][l]+f[154][l]*alpha_vdim[486][l])+(0.1564921592871903*f[212][l]+0.2449489742783178*f[139][l]+0.1749635530559412*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[372][l]+(0.1564921592871903*f[102][l]+0.2449489742783178*f[26][l])*alpha_vdim[360][l]+(0.1749635530559412*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[329][l]+(0.1564921592871903*f[233][l]+0.1749635530559412*f[188][l]+0.2449489742783178*f[187][l]+0.1749635530559412*f[182][l]+0.273861278752583*f[94][l]+0.1956151991089878*f[88][l]+0.273861278752583*f[87][l]+0.3061862178478971*f[18][l])*alpha_vdim[312][l]+(0.2190890230020664*f[172][l]+0.2449489742783178*f[58][l])*alpha_vdim[311][l]+(0.1564921592871903*f[158][l]+0.1749635530559412*f[71][l]+0.2449489742783178*f[70][l]+0.273861278752583*f[14][l])*alpha_vdim[300][l]+0.2190890230020664*f[52][l]*alpha_vdim[299][l]+(0.1749635530559412*f[212][l]+0.273861278752583*f[139][l]+0.1956151991089878*f[119][l]+0.3061862178478971*f[35][l])*alpha_vdim[287][l]+(0.2449489742783178*f[212][l]+0.273861278752583*f[119][l])*alpha_vdim[286][l]+(0.1749635530559412*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[277][l]+0.2449489742783178*f[102][l]*alpha_vdim[276][l]+(0.1749635530559412*f[206][l]+0.1956151991089878*f[131][l]+0.273861278752583*f[130][l]+0.3061862178478971*f[45][l])*alpha_vdim[275][l]+0.2449489742783178*f[103][l]*alpha_vdim[274][l]+(0.2190890230020664*f[211][l]+0.2449489742783178*(f[140][l]+f[118][l])+0.273861278752583*f[36][l])*alpha_vdim[268][l]+(0.2190890230020664*f[101][l]+0.2449489742783178*f[27][l])*alpha_vdim[264][l]+(0.1956151991089878*f[160][l]+0.3061862178478971*f[72][l])*alpha_vdim[260][l]+0.273861278752583*f[160][l]*alpha_vdim[259][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[58][l])*alpha_vdim[256][l]+(0.2449489742783178*f[233][l]+0.273861278752583*(f[188][l]+f[182][l])+0.3061862178478971*f[88][l])*alpha_vdim[255][l]+0.2449489742783178*f[52][l]*alpha_vdim[251][l]+(0.2449489742783178*f[158][l]+0.273861278752583*f[71][l])*alpha_vdim[250][l]+(0.2449489742783178*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[249][l]+(0.273861278752583*f[212][l]+0.3061862178478971*f[119][l])*alpha_vdim[248][l]+(0.6123724356957944*f[197][l]+0.6846531968814573*f[103][l])*alpha_cdim[247][l]+0.273861278752583*(f[102][l]*alpha_vdim[246][l]+f[103][l]*alpha_vdim[245][l]+f[206][l]*alpha_vdim[244][l])+0.3061862178478971*(f[131][l]*alpha_vdim[244][l]+f[160][l]*alpha_vdim[243][l])+0.6846531968814573*f[149][l]*alpha_cdim[243][l]+(0.3499271061118826*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[226][l]+(0.3499271061118826*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[223][l]+(0.3499271061118826*alpha_vdim[129][l]+0.3912303982179757*alpha_vdim[44][l]+0.5477225575051661*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[199][l]+0.4898979485566357*alpha_vdim[25][l]*f[198][l]+(0.3499271061118826*alpha_vdim[120][l]+0.3912303982179757*alpha_vdim[38][l]+0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[196][l]+0.4898979485566357*alpha_vdim[22][l]*f[195][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[192][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[176][l]+0.5477225575051661*alpha_vdim[69][l]*f[175][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[167][l]+0.5477225575051661*alpha_vdim[60][l]*f[166][l]+0.3061862178478971*alpha_cdim[0][l]*f[163][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[158][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[152][l]+(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[151][l]+(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[150][l]+(0.3912303982179757*alpha_vdim[86][l]+0.4374088826398531*alpha_vdim[17][l]+0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[148][l]+0.5477225575051661*alpha_vdim[6][l]*f[147][l]+(0.5477225575051661*f[115][l]+0.3912303982179757*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[129][l]+(0.5477225575051661*f[111][l]+0.3912303982179757*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[120][l]+0.5477225575051661*alpha_vdim[25][l]*f[116][l]+0.6123724356957944*alpha_vdim[44][l]*f[115][l]+0.5477225575051661*alpha_vdim[22][l]*f[112][l]+0.6123724356957944*alpha_vdim[38][l]*f[111][l]+(0.4374088826398531*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[107][l]+0.6123724356957944*alpha_vdim[32][l]*f[106][l]+(0.4374088826398531*alpha_vdim[38][l]+0.6123724356957944*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[102][l]+0.5477225575051661*alpha_vdim[22][l]*f[101][l]+(0.4374088826398531*alpha_vdim[44][l]+0.6123724356957944*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[98][l]+0.5477225575051661*(alpha_vdim[25][l]*f[97][l]+alpha_vdim[31][l]*f[96][l])+0.6123724356957944*(alpha_vdim[2][l]*f[96][l]+f[54][l]*alpha_vdim[86][l]+alpha_vdim[69][l]*f[85][l]+alpha_vdim[60][l]*f[79][l])+(0.4374088826398531*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[71][l]+0.6123724356957944*alpha_vdim[60][l]*f[70][l]+(0.4374088826398531*f[62][l]+0.6123724356957944*f[61][l]+0.6846531968814573*f[11][l])*alpha_vdim[69][l]+0.5477225575051661*f[51][l]*alpha_vdim[68][l]+0.6846531968814573*(alpha_vdim[12][l]*f[62][l]+f[14][l]*alpha_vdim[60][l])+0.5477225575051661*f[52][l]*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[6][l]*f[55][l]+0.6846531968814573*alpha_vdim[17][l]*f[54][l]+0.6123724356957944*(alpha_vdim[10][l]*f[52][l]+alpha_vdim[13][l]*f[51][l])+0.6846531968814573*(f[23][l]*alpha_vdim[44][l]+f[26][l]*alpha_vdim[38][l]+f[30][l]*alpha_vdim[32][l])+0.6123724356957944*(alpha_vdim[22][l]*f[27][l]+f[24][l]*alpha_vdim[25][l]);
+    out[195][l] += (0.1564921592871903*f[97][l]+0.2449489742783178*f[24][l])*alpha_vdim[606][l]+(0.1564921592871903*f[204][l]+0.2449489742783178*f[128][l]+0.1749635530559412*f[123][l]+0.273861278752583*f[41][l])*alpha_vdim[603][l]+(0.1749635530559412*f[155][l]+0.273861278752583*f[67][l])*alpha_vdim[572][l]+0.2190890230020664*f[51][l]*alpha_vdim[546][l]+(0.1564921592871903*f[152][l]+0.2449489742783178*f[62][l]+0.1749635530559412*f[61][l]+0.273861278752583*f[11][l])*alpha_vdim[545][l]+(0.2190890230020664*f[157][l]+0.2449489742783178*f[65][l])*alpha_vdim[543][l]+(0.1564921592871903*f[232][l]+0.2449489742783178*f[185][l]+0.1749635530559412*(f[184][l]+f[183][l])+0.273861278752583*(f[91][l]+f[90][l])+0.1956151991089878*f[89][l]+0.3061862178478971*f[19][l])*alpha_vdim[542][l]+0.2449489742783178*f[97][l]*alpha_vdim[524][l]+(0.1749635530559412*f[97][l]+0.273861278752583*f[24][l])*alpha_vdim[523][l]+(0.2449489742783178*f[204][l]+0.273861278752583*f[123][l])*alpha_vdim[520][l]+(0.1749635530559412*f[204][l]+0.273861278752583*f[128][l]+0.1956151991089878*f[123][l]+0.3061862178478971*f[41][l])*alpha_vdim[519][l]+0.2449489742783178*f[100][l]*alpha_vdim[518][l]+(0.1749635530559412*f[203][l]+0.273861278752583*f[126][l]+0.1956151991089878*f[125][l]+0.3061862178478971*f[42][l])*alpha_vdim[517][l]+(0.2190890230020664*f[98][l]+0.2449489742783178*f[23][l])*alpha_vdim[508][l]+(0.2190890230020664*f[205][l]+0.2449489742783178*(f[127][l]+f[124][l]))*alpha_vdim[507][l]+0.273861278752583*(f[40][l]*alpha_vdim[507][l]+f[155][l]*alpha_vdim[503][l])+(0.1956151991089878*f[155][l]+0.3061862178478971*f[67][l])*alpha_vdim[502][l]+(0.2449489742783178*f[152][l]+0.273861278752583*f[61][l])*alpha_vdim[496][l]+0.2449489742783178*f[51][l]*alpha_vdim[495][l]+(0.2449489742783178*f[232][l]+0.273861278752583*(f[184][l]+f[183][l])+0.3061862178478971*f[89][l])*alpha_vdim[494][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[65][l])*alpha_vdim[493][l]+0.2449489742783178*f[156][l]*alpha_vdim[492][l]+0.273861278752583*(f[66][l]*alpha_vdim[492][l]+f[97][l]*alpha_vdim[490][l])+(0.273861278752583*f[204][l]+0.3061862178478971*f[123][l])*alpha_vdim[489][l]+(0.273861278752583*f[203][l]+0.3061862178478971*f[125][l])*alpha_vdim[488][l]+0.273861278752583*f[100][l]*alpha_vdim[487][l]+0.3061862178478971*f[155][l]*alpha_vdim[486][l]+(0.3499271061118826*f[198][l]+0.5477225575051661*f[116][l]+0.3912303982179757*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[372][l]+(0.3499271061118826*f[193][l]+0.5477225575051661*f[109][l]+0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[360][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[329][l]+(0.4898979485566357*f[151][l]+0.5477225575051661*f[51][l])*alpha_vdim[312][l]+(0.3499271061118826*f[226][l]+0.5477225575051661*f[176][l]+0.3912303982179757*(f[175][l]+f[152][l])+0.6123724356957944*(f[85][l]+f[62][l])+0.4374088826398531*f[61][l]+0.6846531968814573*f[11][l])*alpha_vdim[311][l]+(0.4898979485566357*f[149][l]+0.5477225575051661*f[53][l])*alpha_vdim[300][l]+(0.3499271061118826*f[222][l]+0.5477225575051661*f[163][l]+0.3912303982179757*(f[162][l]+f[161][l])+0.6123724356957944*(f[76][l]+f[75][l])+0.4374088826398531*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[299][l]+(0.5477225575051661*f[198][l]+0.6123724356957944*f[97][l])*alpha_vdim[287][l]+(0.3912303982179757*f[198][l]+0.6123724356957944*f[116][l]+0.4374088826398531*f[97][l]+0.6846531968814573*f[24][l])*alpha_vdim[286][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[104][l])*alpha_vdim[277][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l]+0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[276][l]+0.5477225575051661*f[96][l]*alpha_vdim[275][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l]+0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[274][l]+(0.4898979485566357*f[199][l]+0.5477225575051661*(f[115][l]+f[98][l])+0.6123724356957944*f[23][l])*alpha_vdim[268][l]+(0.4898979485566357*f[194][l]+0.5477225575051661*(f[108][l]+f[105][l]))*alpha_vdim[264][l]+0.6123724356957944*(f[28][l]*alpha_vdim[264][l]+f[147][l]*alpha_vdim[260][l])+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[259][l]+(0.5477225575051661*f[226][l]+0.6123724356957944*(f[175][l]+f[152][l])+0.6846531968814573*f[61][l])*alpha_vdim[256][l]+(0.5477225575051661*f[151][l]+0.6123724356957944*f[51][l])*alpha_vdim[255][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[162][l]+f[161][l])+0.6846531968814573*f[74][l])*alpha_vdim[251][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[250][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[249][l]+(0.6123724356957944*f[198][l]+0.6846531968814573*f[97][l])*alpha_vdim[248][l]+0.273861278752583*f[106][l]*alpha_cdim[247][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[104][l])*alpha_vdim[246][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[245][l]+0.6123724356957944*f[96][l]*alpha_vdim[244][l]+0.6846531968814573*f[147][l]*alpha_vdim[243][l]+0.3061862178478971*f[166][l]*alpha_cdim[243][l]+(0.1564921592871903*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[234][l]+0.2190890230020664*alpha_vdim[25][l]*f[217][l]+(0.1564921592871903*alpha_vdim[129][l]+0.2449489742783178*alpha_vdim[44][l]+0.1749635530559412*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[216][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[207][l]+0.6123724356957944*alpha_cdim[3][l]*f[197][l]+0.2449489742783178*alpha_vdim[68][l]*f[190][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[189][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[183][l]+0.2190890230020664*alpha_vdim[69][l]*f[179][l]+0.2449489742783178*(alpha_vdim[12][l]*f[179][l]+alpha_vdim[6][l]*f[165][l])+(0.1749635530559412*alpha_vdim[86][l]+0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[164][l]+(0.1564921592871903*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[161][l]+0.6846531968814573*alpha_cdim[0][l]*f[150][l]+(0.2449489742783178*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[43][l])*f[145][l]+0.2449489742783178*alpha_vdim[25][l]*f[144][l]+0.273861278752583*alpha_vdim[31][l]*f[133][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[132][l]+(0.1749635530559412*f[123][l]+0.273861278752583*f[41][l])*alpha_vdim[129][l]+0.2449489742783178*alpha_vdim[25][l]*f[124][l]+(0.273861278752583*alpha_vdim[44][l]+0.1956151991089878*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[123][l]+(0.1564921592871903*f[104][l]+0.2449489742783178*f[29][l])*alpha_vdim[120][l]+(0.2449489742783178*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[110][l]+0.2190890230020664*alpha_vdim[22][l]*f[105][l]+(0.2449489742783178*alpha_vdim[38][l]+0.1749635530559412*alpha_vdim[37][l])*f[104][l]+0.273861278752583*(alpha_vdim[4][l]*f[104][l]+alpha_vdim[68][l]*(f[95][l]+f[90][l]))+(0.1956151991089878*alpha_vdim[68][l]+0.3061862178478971*alpha_vdim[13][l])*f[89][l]+f[78][l]*(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])+0.273861278752583*alpha_vdim[6][l]*f[77][l]+0.2449489742783178*alpha_vdim[59][l]*f[75][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[74][l]+0.2449489742783178*f[65][l]*alpha_vdim[69][l]+0.3061862178478971*f[19][l]*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[12][l]*f[65][l]+0.2190890230020664*f[53][l]*alpha_vdim[60][l]+0.273861278752583*f[15][l]*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[9][l]*f[53][l]+0.3061862178478971*(alpha_vdim[31][l]*f[46][l]+f[41][l]*alpha_vdim[43][l])+0.273861278752583*(alpha_vdim[25][l]*f[40][l]+f[29][l]*alpha_vdim[37][l])+0.2449489742783178*alpha_vdim[22][l]*f[28][l];
+    out[196][l] += (0.1564921592871903*f[98][l]+0.2449489742783178*f[23][l])*alpha_vdim[606][l]+(0.1564921592871903*f[205][l]+0.2449489742783178*f[127][l]+0.1749635530559412*f[124][l]+0.273861278752583*f[40][l])*alpha_vdim[603][l]+(0.1749635530559412*f[156][l]+0.273861278752583*f[66][l])*alpha_vdim[572][l]+(0.1564921592871903*f[152][l]+0.1749635530559412*f[62][l]+0.2449489742783178*f[61][l]+0.273861278752583*f[11][l])*alpha_vdim[546][l]+0.2190890230020664*f[51][l]*alpha_vdim[545][l]+(0.1564921592871903*f[232][l]+0.1749635530559412*f[185][l]+0.2449489742783178*f[184][l]+0.1749635530559412*f[183][l]+0.273861278752583*f[91][l]+0.1956151991089878*f[90][l]+0.273861278752583*f[89][l]+0.3061862178478971*f[19][l])*alpha_vdim[543][l]+(0.2190890230020664*f[157][l]+0.2449489742783178*f[65][l])*alpha_vdim[542][l]+(0.1749635530559412*f[98][l]+0.273861278752583*f[23][l])*alpha_vdim[524][l]+0.2449489742783178*f[98][l]*alpha_vdim[523][l]+(0.1749635530559412*f[205][l]+0.273861278752583*f[127][l]+0.1956151991089878*f[124][l]+0.3061862178478971*f[40][l])*alpha_vdim[520][l]+(0.2449489742783178*f[205][l]+0.273861278752583*f[124][l])*alpha_vdim[519][l]+(0.1749635530559412*f[203][l]+0.1956151991089878*f[126][l]+0.273861278752583*f[125][l]+0.3061862178478971*f[42][l])*alpha_vdim[518][l]+0.2449489742783178*f[100][l]*alpha_vdim[517][l]+(0.2190890230020664*f[97][l]+0.2449489742783178*f[24][l])*alpha_vdim[508][l]+(0.2190890230020664*f[204][l]+0.2449489742783178*(f[128][l]+f[123][l])+0.273861278752583*f[41][l])*alpha_vdim[507][l]+(0.1956151991089878*f[156][l]+0.3061862178478971*f[66][l])*alpha_vdim[503][l]+0.273861278752583*f[156][l]*alpha_vdim[502][l]+0.2449489742783178*f[51][l]*alpha_vdim[496][l]+(0.2449489742783178*f[152][l]+0.273861278752583*f[62][l])*alpha_vdim[495][l]+(0.2449489742783178*f[157][l]+0.273861278752583*f[65][l])*alpha_vdim[494][l]+(0.2449489742783178*f[232][l]+0.273861278752583*(f[185][l]+f[183][l])+0.3061862178478971*f[90][l])*alpha_vdim[493][l]+0.2449489742783178*f[155][l]*alpha_vdim[492][l]+0.273861278752583*(f[67][l]*alpha_vdim[492][l]+f[98][l]*alpha_vdim[490][l])+(0.273861278752583*f[205][l]+0.3061862178478971*f[124][l])*alpha_vdim[489][l]+0.273861278752583*(f[100][l]*alpha_vdim[488][l]+f[203][l]*alpha_vdim[487][l])+0.3061862178478971*(f[126][l]*alpha_vdim[487][l]+f[156][l]*alpha_vdim[486][l])+(0.3499271061118826*f[199][l]+0.5477225575051661*f[115][l]+0.3912303982179757*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[372][l]+(0.3499271061118826*f[194][l]+0.5477225575051661*f[108][l]+0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[360][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[329][l]+(0.3499271061118826*f[226][l]+0.3912303982179757*f[176][l]+0.5477225575051661*f[175][l]+0.3912303982179757*f[152][l]+0.6123724356957944*f[85][l]+0.4374088826398531*f[62][l]+0.6123724356957944*f[61][l]+0.6846531968814573*f[11][l])*alpha_vdim[312][l]+(0.4898979485566357*f[151][l]+0.5477225575051661*f[51][l])*alpha_vdim[311][l]+(0.3499271061118826*f[222][l]+0.3912303982179757*f[163][l]+0.5477225575051661*f[162][l]+0.3912303982179757*f[161][l]+0.6123724356957944*f[76][l]+0.4374088826398531*f[75][l]+0.6123724356957944*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[300][l]+(0.4898979485566357*f[149][l]+0.5477225575051661*f[53][l])*alpha_vdim[299][l]+(0.3912303982179757*f[199][l]+0.6123724356957944*f[115][l]+0.4374088826398531*f[98][l]+0.6846531968814573*f[23][l])*alpha_vdim[287][l]+(0.5477225575051661*f[199][l]+0.6123724356957944*f[98][l])*alpha_vdim[286][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l]+0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[277][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[105][l])*alpha_vdim[276][l]+(0.3912303982179757*f[192][l]+0.4374088826398531*f[107][l]+0.6123724356957944*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[275][l]+0.5477225575051661*f[96][l]*alpha_vdim[274][l]+(0.4898979485566357*f[198][l]+0.5477225575051661*(f[116][l]+f[97][l])+0.6123724356957944*f[24][l])*alpha_vdim[268][l]+(0.4898979485566357*f[193][l]+0.5477225575051661*(f[109][l]+f[104][l])+0.6123724356957944*f[29][l])*alpha_vdim[264][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[260][l]+0.6123724356957944*f[148][l]*alpha_vdim[259][l]+(0.5477225575051661*f[151][l]+0.6123724356957944*f[51][l])*alpha_vdim[256][l]+(0.5477225575051661*f[226][l]+0.6123724356957944*(f[176][l]+f[152][l])+0.6846531968814573*f[62][l])*alpha_vdim[255][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[251][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[163][l]+f[161][l])+0.6846531968814573*f[75][l])*alpha_vdim[250][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[249][l]+(0.6123724356957944*f[199][l]+0.6846531968814573*f[98][l])*alpha_vdim[248][l]+0.6123724356957944*f[96][l]*alpha_cdim[247][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[105][l])*alpha_vdim[246][l]+0.6123724356957944*(f[96][l]*alpha_vdim[245][l]+f[192][l]*alpha_vdim[244][l])+0.6846531968814573*(f[107][l]*alpha_vdim[244][l]+f[148][l]*alpha_vdim[243][l]+f[150][l]*alpha_cdim[243][l])+(0.1564921592871903*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[234][l]+(0.1564921592871903*alpha_vdim[129][l]+0.1749635530559412*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[217][l]+0.2190890230020664*alpha_vdim[25][l]*f[216][l]+0.273861278752583*alpha_cdim[3][l]*f[209][l]+(0.1749635530559412*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[207][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[190][l]+0.2449489742783178*alpha_vdim[69][l]*f[189][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[183][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[179][l]+0.3061862178478971*alpha_cdim[0][l]*f[167][l]+(0.1749635530559412*alpha_vdim[86][l]+0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[165][l]+0.2449489742783178*alpha_vdim[6][l]*f[164][l]+0.1564921592871903*alpha_vdim[60][l]*f[161][l]+0.2449489742783178*(alpha_vdim[9][l]*f[161][l]+alpha_vdim[25][l]*f[145][l])+(0.2449489742783178*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l])*f[144][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[133][l]+0.273861278752583*alpha_vdim[32][l]*f[132][l]+(0.1749635530559412*f[124][l]+0.273861278752583*f[40][l])*alpha_vdim[129][l]+(0.1956151991089878*alpha_vdim[44][l]+0.273861278752583*alpha_vdim[43][l]+0.3061862178478971*alpha_vdim[5][l])*f[124][l]+0.2449489742783178*alpha_vdim[25][l]*f[123][l]+(0.1564921592871903*f[105][l]+0.2449489742783178*f[28][l])*alpha_vdim[120][l]+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[110][l]+(0.1749635530559412*alpha_vdim[38][l]+0.2449489742783178*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[105][l]+0.2190890230020664*alpha_vdim[22][l]*f[104][l]+0.273861278752583*alpha_vdim[69][l]*f[95][l]+(0.1956151991089878*alpha_vdim[69][l]+0.3061862178478971*alpha_vdim[12][l])*f[90][l]+0.273861278752583*(alpha_vdim[69][l]*f[89][l]+f[77][l]*alpha_vdim[86][l]+alpha_vdim[6][l]*f[78][l])+0.3061862178478971*alpha_vdim[17][l]*f[77][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[75][l]+0.2449489742783178*alpha_vdim[60][l]*f[74][l]+0.3061862178478971*f[19][l]*alpha_vdim[69][l]+0.2449489742783178*f[65][l]*alpha_vdim[68][l]+0.273861278752583*(alpha_vdim[13][l]*f[65][l]+f[15][l]*alpha_vdim[60][l])+f[53][l]*(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])+0.3061862178478971*(alpha_vdim[32][l]*f[46][l]+f[40][l]*alpha_vdim[44][l])+0.273861278752583*(alpha_vdim[25][l]*f[41][l]+f[28][l]*alpha_vdim[38][l])+0.2449489742783178*alpha_vdim[22][l]*f[29][l];
+    out[197][l] += 0.2190890230020664*(f[99][l]*alpha_vdim[606][l]+f[100][l]*alpha_vdim[603][l])+0.2449489742783178*f[157][l]*alpha_vdim[572][l]+(0.2190890230020664*f[153][l]+0.2449489742783178*f[64][l])*alpha_vdim[546][l]+(0.2190890230020664*f[154][l]+0.2449489742783178*f[63][l])*alpha_vdim[545][l]+(0.2190890230020664*f[155][l]+0.2449489742783178*f[67][l])*alpha_vdim[543][l]+0.2190890230020664*f[156][l]*alpha_vdim[542][l]+0.2449489742783178*(f[66][l]*alpha_vdim[542][l]+f[99][l]*(alpha_vdim[524][l]+alpha_vdim[523][l])+f[100][l]*(alpha_vdim[520][l]+alpha_vdim[519][l]))+(0.2449489742783178*f[204][l]+0.273861278752583*f[128][l])*alpha_vdim[518][l]+(0.2449489742783178*f[205][l]+0.273861278752583*f[127][l])*alpha_vdim[517][l]+(0.2190890230020664*f[202][l]+0.2449489742783178*(f[122][l]+f[121][l])+0.273861278752583*f[39][l])*alpha_vdim[508][l]+(0.2190890230020664*f[203][l]+0.2449489742783178*(f[126][l]+f[125][l]))*alpha_vdim[507][l]+0.273861278752583*(f[42][l]*alpha_vdim[507][l]+f[157][l]*(alpha_vdim[503][l]+alpha_vdim[502][l]))+(0.2449489742783178*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[496][l]+(0.2449489742783178*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[495][l]+(0.2449489742783178*f[156][l]+0.273861278752583*f[66][l])*alpha_vdim[494][l]+(0.2449489742783178*f[155][l]+0.273861278752583*f[67][l])*alpha_vdim[493][l]+(0.2449489742783178*f[232][l]+0.273861278752583*(f[185][l]+f[184][l])+0.3061862178478971*f[91][l])*alpha_vdim[492][l]+0.273861278752583*(f[99][l]*alpha_vdim[490][l]+f[100][l]*alpha_vdim[489][l])+(0.273861278752583*f[205][l]+0.3061862178478971*f[127][l])*alpha_vdim[488][l]+0.273861278752583*f[204][l]*alpha_vdim[487][l]+0.3061862178478971*(f[128][l]*alpha_vdim[487][l]+f[157][l]*alpha_vdim[486][l])+(0.4898979485566357*f[200][l]+0.5477225575051661*f[99][l])*alpha_vdim[372][l]+0.4898979485566357*f[96][l]*alpha_vdim[360][l]+0.5477225575051661*f[149][l]*alpha_vdim[329][l]+(0.4898979485566357*f[227][l]+0.5477225575051661*(f[178][l]+f[153][l])+0.6123724356957944*f[64][l])*alpha_vdim[312][l]+(0.4898979485566357*f[228][l]+0.5477225575051661*(f[177][l]+f[154][l])+0.6123724356957944*f[63][l])*alpha_vdim[311][l]+(0.4898979485566357*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[300][l]+(0.4898979485566357*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[299][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[99][l])*alpha_vdim[287][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[99][l])*alpha_vdim[286][l]+0.5477225575051661*f[96][l]*(alpha_vdim[277][l]+alpha_vdim[276][l])+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[275][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[274][l]+(0.4898979485566357*f[238][l]+0.5477225575051661*(f[215][l]+f[214][l]+f[202][l])+0.6123724356957944*(f[143][l]+f[122][l]+f[121][l])+0.6846531968814573*f[39][l])*alpha_vdim[268][l]+(0.4898979485566357*f[192][l]+0.5477225575051661*(f[107][l]+f[106][l]))*alpha_vdim[264][l]+0.6123724356957944*(f[30][l]*alpha_vdim[264][l]+f[149][l]*(alpha_vdim[260][l]+alpha_vdim[259][l]))+(0.5477225575051661*f[228][l]+0.6123724356957944*(f[177][l]+f[154][l])+0.6846531968814573*f[63][l])*alpha_vdim[256][l]+(0.5477225575051661*f[227][l]+0.6123724356957944*(f[178][l]+f[153][l])+0.6846531968814573*f[64][l])*alpha_vdim[255][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[251][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[250][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[163][l]+f[162][l])+0.6846531968814573*f[76][l])*alpha_vdim[249][l]+(0.6123724356957944*f[200][l]+0.6846531968814573*f[99][l])*alpha_vdim[248][l]+0.273861278752583*f[108][l]*alpha_cdim[247][l]+0.6123724356957944*f[96][l]*alpha_vdim[246][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[245][l]+0.6123724356957944*f[193][l]*alpha_vdim[244][l]+0.6846531968814573*(f[109][l]*alpha_vdim[244][l]+f[149][l]*alpha_vdim[243][l])+0.3061862178478971*f[168][l]*alpha_cdim[243][l]+0.4898979485566357*alpha_vdim[25][l]*f[239][l]+(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[230][l]+0.4898979485566357*alpha_vdim[69][l]*f[229][l]+0.5477225575051661*(alpha_vdim[12][l]*f[229][l]+alpha_vdim[6][l]*f[223][l]+alpha_vdim[25][l]*(f[219][l]+f[218][l]+f[203][l]))+(0.4898979485566357*alpha_vdim[129][l]+0.5477225575051661*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[201][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[196][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[195][l]+0.4898979485566357*alpha_vdim[22][l]*f[192][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[181][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[180][l]+0.3061862178478971*alpha_cdim[0][l]*f[169][l]+0.6123724356957944*alpha_vdim[6][l]*(f[167][l]+f[166][l])+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[156][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[155][l]+(0.5477225575051661*alpha_vdim[86][l]+0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[150][l]+(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[148][l]+(0.4898979485566357*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[147][l]+0.6123724356957944*alpha_vdim[25][l]*f[146][l]+0.5477225575051661*f[100][l]*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[25][l]*(f[126][l]+f[125][l])+0.4898979485566357*f[96][l]*alpha_vdim[120][l]+(0.6123724356957944*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[112][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[111][l]+0.5477225575051661*alpha_vdim[22][l]*(f[107][l]+f[106][l])+(0.6123724356957944*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6846531968814573*alpha_vdim[5][l])*f[100][l]+(0.5477225575051661*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[96][l]+0.6846531968814573*alpha_vdim[6][l]*f[79][l]+0.6123724356957944*(f[67][l]*alpha_vdim[69][l]+f[66][l]*alpha_vdim[68][l])+0.6846531968814573*(alpha_vdim[12][l]*f[67][l]+alpha_vdim[13][l]*f[66][l])+0.5477225575051661*(f[55][l]*alpha_vdim[60][l]+f[54][l]*alpha_vdim[59][l])+0.6123724356957944*(alpha_vdim[9][l]*f[55][l]+alpha_vdim[10][l]*f[54][l])+0.6846531968814573*alpha_vdim[25][l]*f[42][l]+0.6123724356957944*alpha_vdim[22][l]*f[30][l];
+    out[198][l] += (0.3499271061118826*f[195][l]+0.5477225575051661*f[112][l]+0.3912303982179757*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[606][l]+(0.3499271061118826*f[193][l]+0.5477225575051661*f[109][l]+0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[603][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[572][l]+(0.4898979485566357*f[150][l]+0.5477225575051661*f[52][l])*alpha_vdim[546][l]+(0.3499271061118826*f[223][l]+0.5477225575051661*f[167][l]+0.3912303982179757*(f[166][l]+f[158][l])+0.6123724356957944*(f[79][l]+f[71][l])+0.4374088826398531*f[70][l]+0.6846531968814573*f[14][l])*alpha_vdim[545][l]+(0.4898979485566357*f[149][l]+0.5477225575051661*f[53][l])*alpha_vdim[543][l]+(0.3499271061118826*f[222][l]+0.5477225575051661*f[163][l]+0.3912303982179757*(f[162][l]+f[161][l])+0.6123724356957944*(f[76][l]+f[75][l])+0.4374088826398531*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[542][l]+(0.5477225575051661*f[195][l]+0.6123724356957944*f[101][l])*alpha_vdim[524][l]+(0.3912303982179757*f[195][l]+0.6123724356957944*f[112][l]+0.4374088826398531*f[101][l]+0.6846531968814573*f[27][l])*alpha_vdim[523][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[104][l])*alpha_vdim[520][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l]+0.4374088826398531*f[104][l]+0.6846531968814573*f[29][l])*alpha_vdim[519][l]+0.5477225575051661*f[96][l]*alpha_vdim[518][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l]+0.4374088826398531*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[517][l]+(0.4898979485566357*f[196][l]+0.5477225575051661*(f[111][l]+f[102][l])+0.6123724356957944*f[26][l])*alpha_vdim[508][l]+(0.4898979485566357*f[194][l]+0.5477225575051661*(f[108][l]+f[105][l]))*alpha_vdim[507][l]+0.6123724356957944*(f[28][l]*alpha_vdim[507][l]+f[147][l]*alpha_vdim[503][l])+(0.4374088826398531*f[147][l]+0.6846531968814573*f[55][l])*alpha_vdim[502][l]+(0.5477225575051661*f[223][l]+0.6123724356957944*(f[166][l]+f[158][l])+0.6846531968814573*f[70][l])*alpha_vdim[496][l]+(0.5477225575051661*f[150][l]+0.6123724356957944*f[52][l])*alpha_vdim[495][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[162][l]+f[161][l])+0.6846531968814573*f[74][l])*alpha_vdim[494][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[493][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[492][l]+(0.6123724356957944*f[195][l]+0.6846531968814573*f[101][l])*alpha_vdim[490][l]+(0.6123724356957944*f[193][l]+0.6846531968814573*f[104][l])*alpha_vdim[489][l]+(0.6123724356957944*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[488][l]+0.6123724356957944*f[96][l]*alpha_vdim[487][l]+0.6846531968814573*f[147][l]*alpha_vdim[486][l]+(0.1564921592871903*f[101][l]+0.2449489742783178*f[27][l])*alpha_vdim[372][l]+(0.1564921592871903*f[211][l]+0.2449489742783178*f[140][l]+0.1749635530559412*f[135][l]+0.273861278752583*f[48][l])*alpha_vdim[360][l]+(0.1749635530559412*f[170][l]+0.273861278752583*f[82][l])*alpha_vdim[329][l]+0.2190890230020664*f[52][l]*alpha_vdim[312][l]+(0.1564921592871903*f[158][l]+0.2449489742783178*f[71][l]+0.1749635530559412*f[70][l]+0.273861278752583*f[14][l])*alpha_vdim[311][l]+(0.2190890230020664*f[172][l]+0.2449489742783178*f[80][l])*alpha_vdim[300][l]+(0.1564921592871903*f[233][l]+0.2449489742783178*f[188][l]+0.1749635530559412*(f[187][l]+f[186][l])+0.273861278752583*(f[94][l]+f[93][l])+0.1956151991089878*f[92][l]+0.3061862178478971*f[20][l])*alpha_vdim[299][l]+0.2449489742783178*f[101][l]*alpha_vdim[287][l]+(0.1749635530559412*f[101][l]+0.273861278752583*f[27][l])*alpha_vdim[286][l]+(0.2449489742783178*f[211][l]+0.273861278752583*f[135][l])*alpha_vdim[277][l]+(0.1749635530559412*f[211][l]+0.273861278752583*f[140][l]+0.1956151991089878*f[135][l]+0.3061862178478971*f[48][l])*alpha_vdim[276][l]+0.2449489742783178*f[113][l]*alpha_vdim[275][l]+(0.1749635530559412*f[210][l]+0.273861278752583*f[138][l]+0.1956151991089878*f[137][l]+0.3061862178478971*f[49][l])*alpha_vdim[274][l]+(0.2190890230020664*f[102][l]+0.2449489742783178*f[26][l])*alpha_vdim[268][l]+(0.2190890230020664*f[212][l]+0.2449489742783178*(f[139][l]+f[136][l]))*alpha_vdim[264][l]+0.273861278752583*(f[47][l]*alpha_vdim[264][l]+f[170][l]*alpha_vdim[260][l])+(0.1956151991089878*f[170][l]+0.3061862178478971*f[82][l])*alpha_vdim[259][l]+(0.2449489742783178*f[158][l]+0.273861278752583*f[70][l])*alpha_vdim[256][l]+0.2449489742783178*f[52][l]*alpha_vdim[255][l]+(0.2449489742783178*f[233][l]+0.273861278752583*(f[187][l]+f[186][l])+0.3061862178478971*f[92][l])*alpha_vdim[251][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[80][l])*alpha_vdim[250][l]+0.2449489742783178*f[171][l]*alpha_vdim[249][l]+0.273861278752583*(f[81][l]*alpha_vdim[249][l]+f[101][l]*alpha_vdim[248][l])+(0.273861278752583*f[218][l]+0.3061862178478971*f[137][l])*alpha_cdim[247][l]+(0.273861278752583*f[211][l]+0.3061862178478971*f[135][l])*alpha_vdim[246][l]+(0.273861278752583*f[210][l]+0.3061862178478971*f[137][l])*alpha_vdim[245][l]+0.273861278752583*f[113][l]*alpha_vdim[244][l]+0.3061862178478971*(f[170][l]*alpha_vdim[243][l]+f[175][l]*alpha_cdim[243][l])+(0.1564921592871903*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[234][l]+0.2190890230020664*alpha_vdim[22][l]*f[217][l]+(0.1564921592871903*alpha_vdim[120][l]+0.2449489742783178*alpha_vdim[38][l]+0.1749635530559412*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[216][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[213][l]+0.6123724356957944*alpha_cdim[3][l]*f[200][l]+0.2449489742783178*alpha_vdim[59][l]*f[190][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[189][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[186][l]+0.2190890230020664*alpha_vdim[60][l]*f[179][l]+0.2449489742783178*(alpha_vdim[9][l]*f[179][l]+alpha_vdim[6][l]*f[174][l])+(0.1749635530559412*alpha_vdim[86][l]+0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[173][l]+(0.1564921592871903*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[161][l]+0.6846531968814573*alpha_cdim[0][l]*f[151][l]+(0.2449489742783178*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[37][l])*f[145][l]+0.2449489742783178*alpha_vdim[22][l]*f[144][l]+0.273861278752583*alpha_vdim[31][l]*f[142][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[141][l]+0.2449489742783178*alpha_vdim[22][l]*f[136][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l]+0.1956151991089878*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[135][l]+(0.1564921592871903*f[104][l]+0.2449489742783178*f[29][l])*alpha_vdim[129][l]+0.273861278752583*f[48][l]*alpha_vdim[120][l]+(0.2449489742783178*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[114][l]+0.2190890230020664*alpha_vdim[25][l]*f[105][l]+(0.2449489742783178*alpha_vdim[44][l]+0.1749635530559412*alpha_vdim[43][l])*f[104][l]+0.273861278752583*(alpha_vdim[5][l]*f[104][l]+alpha_vdim[59][l]*(f[95][l]+f[93][l]))+(0.1956151991089878*alpha_vdim[59][l]+0.3061862178478971*alpha_vdim[10][l])*f[92][l]+f[84][l]*(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])+0.273861278752583*alpha_vdim[6][l]*f[83][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[80][l]+0.2449489742783178*alpha_vdim[68][l]*f[75][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[74][l]+0.2190890230020664*f[53][l]*alpha_vdim[69][l]+0.273861278752583*f[15][l]*alpha_vdim[68][l]+0.3061862178478971*f[20][l]*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[12][l]*f[53][l]+0.3061862178478971*(alpha_vdim[31][l]*f[50][l]+alpha_vdim[37][l]*f[48][l])+0.273861278752583*(alpha_vdim[22][l]*f[47][l]+f[29][l]*alpha_vdim[43][l])+0.2449489742783178*alpha_vdim[25][l]*f[28][l];
+    out[199][l] += (0.3499271061118826*f[196][l]+0.5477225575051661*f[111][l]+0.3912303982179757*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[606][l]+(0.3499271061118826*f[194][l]+0.5477225575051661*f[108][l]+0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[603][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[572][l]+(0.3499271061118826*f[223][l]+0.3912303982179757*f[167][l]+0.5477225575051661*f[166][l]+0.3912303982179757*f[158][l]+0.6123724356957944*f[79][l]+0.4374088826398531*f[71][l]+0.6123724356957944*f[70][l]+0.6846531968814573*f[14][l])*alpha_vdim[546][l]+(0.4898979485566357*f[150][l]+0.5477225575051661*f[52][l])*alpha_vdim[545][l]+(0.3499271061118826*f[222][l]+0.3912303982179757*f[163][l]+0.5477225575051661*f[162][l]+0.3912303982179757*f[161][l]+0.6123724356957944*f[76][l]+0.4374088826398531*f[75][l]+0.6123724356957944*f[74][l]+0.6846531968814573*f[15][l])*alpha_vdim[543][l]+(0.4898979485566357*f[149][l]+0.5477225575051661*f[53][l])*alpha_vdim[542][l]+(0.3912303982179757*f[196][l]+0.6123724356957944*f[111][l]+0.4374088826398531*f[102][l]+0.6846531968814573*f[26][l])*alpha_vdim[524][l]+(0.5477225575051661*f[196][l]+0.6123724356957944*f[102][l])*alpha_vdim[523][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l]+0.4374088826398531*f[105][l]+0.6846531968814573*f[28][l])*alpha_vdim[520][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[105][l])*alpha_vdim[519][l]+(0.3912303982179757*f[192][l]+0.4374088826398531*f[107][l]+0.6123724356957944*f[106][l]+0.6846531968814573*f[30][l])*alpha_vdim[518][l]+0.5477225575051661*f[96][l]*alpha_vdim[517][l]+(0.4898979485566357*f[195][l]+0.5477225575051661*(f[112][l]+f[101][l])+0.6123724356957944*f[27][l])*alpha_vdim[508][l]+(0.4898979485566357*f[193][l]+0.5477225575051661*(f[109][l]+f[104][l])+0.6123724356957944*f[29][l])*alpha_vdim[507][l]+(0.4374088826398531*f[148][l]+0.6846531968814573*f[54][l])*alpha_vdim[503][l]+0.6123724356957944*f[148][l]*alpha_vdim[502][l]+(0.5477225575051661*f[150][l]+0.6123724356957944*f[52][l])*alpha_vdim[496][l]+(0.5477225575051661*f[223][l]+0.6123724356957944*(f[167][l]+f[158][l])+0.6846531968814573*f[71][l])*alpha_vdim[495][l]+(0.5477225575051661*f[149][l]+0.6123724356957944*f[53][l])*alpha_vdim[494][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[163][l]+f[161][l])+0.6846531968814573*f[75][l])*alpha_vdim[493][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[492][l]+(0.6123724356957944*f[196][l]+0.6846531968814573*f[102][l])*alpha_vdim[490][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[105][l])*alpha_vdim[489][l]+0.6123724356957944*(f[96][l]*alpha_vdim[488][l]+f[192][l]*alpha_vdim[487][l])+0.6846531968814573*(f[107][l]*alpha_vdim[487][l]+f[148][l]*alpha_vdim[486][l])+(0.1564921592871903*f[102][l]+0.2449489742783178*f[26][l])*alpha_vdim[372][l]+(0.1564921592871903*f[212][l]+0.2449489742783178*f[139][l]+0.1749635530559412*f[136][l]+0.273861278752583*f[47][l])*alpha_vdim[360][l]+(0.1749635530559412*f[171][l]+0.273861278752583*f[81][l])*alpha_vdim[329][l]+(0.1564921592871903*f[158][l]+0.1749635530559412*f[71][l]+0.2449489742783178*f[70][l]+0.273861278752583*f[14][l])*alpha_vdim[312][l]+0.2190890230020664*f[52][l]*alpha_vdim[311][l]+(0.1564921592871903*f[233][l]+0.1749635530559412*f[188][l]+0.2449489742783178*f[187][l]+0.1749635530559412*f[186][l]+0.273861278752583*f[94][l]+0.1956151991089878*f[93][l]+0.273861278752583*f[92][l]+0.3061862178478971*f[20][l])*alpha_vdim[300][l]+(0.2190890230020664*f[172][l]+0.2449489742783178*f[80][l])*alpha_vdim[299][l]+(0.1749635530559412*f[102][l]+0.273861278752583*f[26][l])*alpha_vdim[287][l]+0.2449489742783178*f[102][l]*alpha_vdim[286][l]+(0.1749635530559412*f[212][l]+0.273861278752583*f[139][l]+0.1956151991089878*f[136][l]+0.3061862178478971*f[47][l])*alpha_vdim[277][l]+(0.2449489742783178*f[212][l]+0.273861278752583*f[136][l])*alpha_vdim[276][l]+(0.1749635530559412*f[210][l]+0.1956151991089878*f[138][l]+0.273861278752583*f[137][l]+0.3061862178478971*f[49][l])*alpha_vdim[275][l]+0.2449489742783178*f[113][l]*alpha_vdim[274][l]+(0.2190890230020664*f[101][l]+0.2449489742783178*f[27][l])*alpha_vdim[268][l]+(0.2190890230020664*f[211][l]+0.2449489742783178*(f[140][l]+f[135][l])+0.273861278752583*f[48][l])*alpha_vdim[264][l]+(0.1956151991089878*f[171][l]+0.3061862178478971*f[81][l])*alpha_vdim[260][l]+0.273861278752583*f[171][l]*alpha_vdim[259][l]+0.2449489742783178*f[52][l]*alpha_vdim[256][l]+(0.2449489742783178*f[158][l]+0.273861278752583*f[71][l])*alpha_vdim[255][l]+(0.2449489742783178*f[172][l]+0.273861278752583*f[80][l])*alpha_vdim[251][l]+(0.2449489742783178*f[233][l]+0.273861278752583*(f[188][l]+f[186][l])+0.3061862178478971*f[93][l])*alpha_vdim[250][l]+0.2449489742783178*f[170][l]*alpha_vdim[249][l]+0.273861278752583*(f[82][l]*alpha_vdim[249][l]+f[102][l]*alpha_vdim[248][l])+(0.6123724356957944*f[201][l]+0.6846531968814573*f[113][l])*alpha_cdim[247][l]+(0.273861278752583*f[212][l]+0.3061862178478971*f[136][l])*alpha_vdim[246][l]+0.273861278752583*(f[113][l]*alpha_vdim[245][l]+f[210][l]*alpha_vdim[244][l])+0.3061862178478971*(f[138][l]*alpha_vdim[244][l]+f[171][l]*alpha_vdim[243][l])+0.6846531968814573*f[151][l]*alpha_cdim[243][l]+(0.1564921592871903*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[234][l]+(0.1564921592871903*alpha_vdim[120][l]+0.1749635530559412*alpha_vdim[38][l]+0.2449489742783178*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[217][l]+0.2190890230020664*alpha_vdim[22][l]*f[216][l]+0.273861278752583*alpha_cdim[3][l]*f[215][l]+(0.1749635530559412*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[213][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[190][l]+0.2449489742783178*alpha_vdim[60][l]*f[189][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[186][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[179][l]+0.3061862178478971*alpha_cdim[0][l]*f[176][l]+(0.1749635530559412*alpha_vdim[86][l]+0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[174][l]+0.2449489742783178*alpha_vdim[6][l]*f[173][l]+0.1564921592871903*alpha_vdim[69][l]*f[161][l]+0.2449489742783178*(alpha_vdim[12][l]*f[161][l]+alpha_vdim[22][l]*f[145][l])+(0.2449489742783178*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[144][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[142][l]+0.273861278752583*alpha_vdim[32][l]*f[141][l]+(0.1749635530559412*alpha_vdim[120][l]+0.1956151991089878*alpha_vdim[38][l]+0.273861278752583*alpha_vdim[37][l]+0.3061862178478971*alpha_vdim[4][l])*f[136][l]+0.2449489742783178*alpha_vdim[22][l]*f[135][l]+(0.1564921592871903*f[105][l]+0.2449489742783178*f[28][l])*alpha_vdim[129][l]+0.273861278752583*f[47][l]*alpha_vdim[120][l]+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[114][l]+(0.1749635530559412*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[105][l]+0.2190890230020664*alpha_vdim[25][l]*f[104][l]+0.273861278752583*alpha_vdim[60][l]*f[95][l]+(0.1956151991089878*alpha_vdim[60][l]+0.3061862178478971*alpha_vdim[9][l])*f[93][l]+0.273861278752583*(alpha_vdim[60][l]*f[92][l]+f[83][l]*alpha_vdim[86][l]+alpha_vdim[6][l]*f[84][l])+0.3061862178478971*alpha_vdim[17][l]*f[83][l]+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[80][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[75][l]+alpha_vdim[69][l]*(0.2449489742783178*f[74][l]+0.273861278752583*f[15][l])+0.2190890230020664*f[53][l]*alpha_vdim[68][l]+0.3061862178478971*f[20][l]*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[13][l]*f[53][l]+0.3061862178478971*alpha_vdim[32][l]*f[50][l]+0.273861278752583*alpha_vdim[22][l]*f[48][l]+0.3061862178478971*alpha_vdim[38][l]*f[47][l]+0.273861278752583*f[28][l]*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[25][l]*f[29][l];
+    out[200][l] += (0.4898979485566357*f[197][l]+0.5477225575051661*f[103][l])*alpha_vdim[606][l]+0.4898979485566357*f[96][l]*alpha_vdim[603][l]+0.5477225575051661*f[149][l]*alpha_vdim[572][l]+(0.4898979485566357*f[224][l]+0.5477225575051661*(f[169][l]+f[159][l])+0.6123724356957944*f[73][l])*alpha_vdim[546][l]+(0.4898979485566357*f[225][l]+0.5477225575051661*(f[168][l]+f[160][l])+0.6123724356957944*f[72][l])*alpha_vdim[545][l]+(0.4898979485566357*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[543][l]+(0.4898979485566357*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[542][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[103][l])*alpha_vdim[524][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[103][l])*alpha_vdim[523][l]+0.5477225575051661*f[96][l]*(alpha_vdim[520][l]+alpha_vdim[519][l])+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[518][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[517][l]+(0.4898979485566357*f[237][l]+0.5477225575051661*(f[209][l]+f[208][l]+f[206][l])+0.6123724356957944*(f[134][l]+f[131][l]+f[130][l])+0.6846531968814573*f[45][l])*alpha_vdim[508][l]+(0.4898979485566357*f[192][l]+0.5477225575051661*(f[107][l]+f[106][l]))*alpha_vdim[507][l]+0.6123724356957944*(f[30][l]*alpha_vdim[507][l]+f[149][l]*(alpha_vdim[503][l]+alpha_vdim[502][l]))+(0.5477225575051661*f[225][l]+0.6123724356957944*(f[168][l]+f[160][l])+0.6846531968814573*f[72][l])*alpha_vdim[496][l]+(0.5477225575051661*f[224][l]+0.6123724356957944*(f[169][l]+f[159][l])+0.6846531968814573*f[73][l])*alpha_vdim[495][l]+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[494][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[493][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*(f[163][l]+f[162][l])+0.6846531968814573*f[76][l])*alpha_vdim[492][l]+(0.6123724356957944*f[197][l]+0.6846531968814573*f[103][l])*alpha_vdim[490][l]+0.6123724356957944*f[96][l]*alpha_vdim[489][l]+(0.6123724356957944*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[488][l]+0.6123724356957944*f[193][l]*alpha_vdim[487][l]+0.6846531968814573*(f[109][l]*alpha_vdim[487][l]+f[149][l]*alpha_vdim[486][l])+0.2190890230020664*(f[103][l]*alpha_vdim[372][l]+f[113][l]*alpha_vdim[360][l])+0.2449489742783178*f[172][l]*alpha_vdim[329][l]+(0.2190890230020664*f[159][l]+0.2449489742783178*f[73][l])*alpha_vdim[312][l]+(0.2190890230020664*f[160][l]+0.2449489742783178*f[72][l])*alpha_vdim[311][l]+(0.2190890230020664*f[170][l]+0.2449489742783178*f[82][l])*alpha_vdim[300][l]+0.2190890230020664*f[171][l]*alpha_vdim[299][l]+0.2449489742783178*(f[81][l]*alpha_vdim[299][l]+f[103][l]*(alpha_vdim[287][l]+alpha_vdim[286][l])+f[113][l]*(alpha_vdim[277][l]+alpha_vdim[276][l]))+(0.2449489742783178*f[211][l]+0.273861278752583*f[140][l])*alpha_vdim[275][l]+(0.2449489742783178*f[212][l]+0.273861278752583*f[139][l])*alpha_vdim[274][l]+(0.2190890230020664*f[206][l]+0.2449489742783178*(f[131][l]+f[130][l])+0.273861278752583*f[45][l])*alpha_vdim[268][l]+(0.2190890230020664*f[210][l]+0.2449489742783178*(f[138][l]+f[137][l]))*alpha_vdim[264][l]+0.273861278752583*(f[49][l]*alpha_vdim[264][l]+f[172][l]*(alpha_vdim[260][l]+alpha_vdim[259][l]))+(0.2449489742783178*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[256][l]+(0.2449489742783178*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[255][l]+(0.2449489742783178*f[171][l]+0.273861278752583*f[81][l])*alpha_vdim[251][l]+(0.2449489742783178*f[170][l]+0.273861278752583*f[82][l])*alpha_vdim[250][l]+(0.2449489742783178*f[233][l]+0.273861278752583*(f[188][l]+f[187][l])+0.3061862178478971*f[94][l])*alpha_vdim[249][l]+0.273861278752583*f[103][l]*alpha_vdim[248][l]+(0.273861278752583*f[220][l]+0.3061862178478971*f[139][l])*alpha_cdim[247][l]+0.273861278752583*f[113][l]*alpha_vdim[246][l]+(0.273861278752583*f[212][l]+0.3061862178478971*f[139][l])*alpha_vdim[245][l]+0.273861278752583*f[211][l]*alpha_vdim[244][l]+0.3061862178478971*(f[140][l]*alpha_vdim[244][l]+f[172][l]*alpha_vdim[243][l]+f[177][l]*alpha_cdim[243][l])+0.4898979485566357*alpha_vdim[22][l]*f[239][l]+(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[230][l]+0.4898979485566357*alpha_vdim[60][l]*f[229][l]+0.5477225575051661*(alpha_vdim[9][l]*f[229][l]+alpha_vdim[6][l]*f[226][l]+alpha_vdim[22][l]*(f[219][l]+f[218][l]+f[210][l]))+(0.4898979485566357*alpha_vdim[120][l]+0.5477225575051661*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[201][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[199][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[198][l]+0.4898979485566357*alpha_vdim[25][l]*f[192][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[181][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[180][l]+0.3061862178478971*alpha_cdim[0][l]*f[178][l]+0.6123724356957944*alpha_vdim[6][l]*(f[176][l]+f[175][l])+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[171][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[170][l]+(0.5477225575051661*alpha_vdim[86][l]+0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[151][l]+(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[148][l]+(0.4898979485566357*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[147][l]+0.6123724356957944*alpha_vdim[22][l]*(f[146][l]+f[138][l]+f[137][l])+0.4898979485566357*f[96][l]*alpha_vdim[129][l]+0.5477225575051661*f[113][l]*alpha_vdim[120][l]+(0.6123724356957944*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[116][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[115][l]+(0.6123724356957944*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[113][l]+0.5477225575051661*alpha_vdim[25][l]*(f[107][l]+f[106][l])+(0.5477225575051661*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[96][l]+0.6846531968814573*alpha_vdim[6][l]*f[85][l]+(0.6123724356957944*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[82][l]+(0.6123724356957944*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[10][l])*f[81][l]+0.5477225575051661*(f[55][l]*alpha_vdim[69][l]+f[54][l]*alpha_vdim[68][l])+0.6123724356957944*(alpha_vdim[12][l]*f[55][l]+alpha_vdim[13][l]*f[54][l])+0.6846531968814573*alpha_vdim[22][l]*f[49][l]+0.6123724356957944*alpha_vdim[25][l]*f[30][l];
+    out[201][l] += 0.4898979485566357*(f[96][l]*alpha_vdim[606][l]+f[197][l]*alpha_vdim[603][l])+0.5477225575051661*(f[110][l]*alpha_vdim[603][l]+f[150][l]*alpha_vdim[572][l])+(0.4898979485566357*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[546][l]+(0.4898979485566357*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[545][l]+(0.4898979485566357*f[224][l]+0.5477225575051661*(f[169][l]+f[164][l])+0.6123724356957944*f[78][l])*alpha_vdim[543][l]+(0.4898979485566357*f[225][l]+0.5477225575051661*(f[168][l]+f[165][l])+0.6123724356957944*f[77][l])*alpha_vdim[542][l]+0.5477225575051661*f[96][l]*(alpha_vdim[524][l]+alpha_vdim[523][l])+(0.5477225575051661*f[197][l]+0.6123724356957944*f[110][l])*alpha_vdim[520][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[110][l])*alpha_vdim[519][l]+(0.5477225575051661*f[195][l]+0.6123724356957944*f[112][l])*alpha_vdim[518][l]+(0.5477225575051661*f[196][l]+0.6123724356957944*f[111][l])*alpha_vdim[517][l]+(0.4898979485566357*f[192][l]+0.5477225575051661*(f[107][l]+f[106][l])+0.6123724356957944*f[30][l])*alpha_vdim[508][l]+(0.4898979485566357*f[237][l]+0.5477225575051661*(f[209][l]+f[208][l]+f[207][l])+0.6123724356957944*(f[134][l]+f[133][l]+f[132][l])+0.6846531968814573*f[46][l])*alpha_vdim[507][l]+0.6123724356957944*f[150][l]*(alpha_vdim[503][l]+alpha_vdim[502][l])+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[496][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[495][l]+(0.5477225575051661*f[225][l]+0.6123724356957944*(f[168][l]+f[165][l])+0.6846531968814573*f[77][l])*alpha_vdim[494][l]+(0.5477225575051661*f[224][l]+0.6123724356957944*(f[169][l]+f[164][l])+0.6846531968814573*f[78][l])*alpha_vdim[493][l]+(0.5477225575051661*f[223][l]+0.6123724356957944*(f[167][l]+f[166][l])+0.6846531968814573*f[79][l])*alpha_vdim[492][l]+0.6123724356957944*f[96][l]*alpha_vdim[490][l]+(0.6123724356957944*f[197][l]+0.6846531968814573*f[110][l])*alpha_vdim[489][l]+(0.6123724356957944*f[196][l]+0.6846531968814573*f[111][l])*alpha_vdim[488][l]+0.6123724356957944*f[195][l]*alpha_vdim[487][l]+0.6846531968814573*(f[112][l]*alpha_vdim[487][l]+f[150][l]*alpha_vdim[486][l])+0.4898979485566357*(f[96][l]*alpha_vdim[372][l]+f[200][l]*alpha_vdim[360][l])+0.5477225575051661*(f[114][l]*alpha_vdim[360][l]+f[151][l]*alpha_vdim[329][l])+(0.4898979485566357*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[312][l]+(0.4898979485566357*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[311][l]+(0.4898979485566357*f[227][l]+0.5477225575051661*(f[178][l]+f[173][l])+0.6123724356957944*f[84][l])*alpha_vdim[300][l]+(0.4898979485566357*f[228][l]+0.5477225575051661*(f[177][l]+f[174][l])+0.6123724356957944*f[83][l])*alpha_vdim[299][l]+0.5477225575051661*f[96][l]*(alpha_vdim[287][l]+alpha_vdim[286][l])+(0.5477225575051661*f[200][l]+0.6123724356957944*f[114][l])*alpha_vdim[277][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[114][l])*alpha_vdim[276][l]+(0.5477225575051661*f[198][l]+0.6123724356957944*f[116][l])*alpha_vdim[275][l]+(0.5477225575051661*f[199][l]+0.6123724356957944*f[115][l])*alpha_vdim[274][l]+(0.4898979485566357*f[192][l]+0.5477225575051661*(f[107][l]+f[106][l])+0.6123724356957944*f[30][l])*alpha_vdim[268][l]+(0.4898979485566357*f[238][l]+0.5477225575051661*(f[215][l]+f[214][l]+f[213][l])+0.6123724356957944*(f[143][l]+f[142][l]+f[141][l])+0.6846531968814573*f[50][l])*alpha_vdim[264][l]+0.6123724356957944*f[151][l]*(alpha_vdim[260][l]+alpha_vdim[259][l])+(0.5477225575051661*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[256][l]+(0.5477225575051661*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[255][l]+(0.5477225575051661*f[228][l]+0.6123724356957944*(f[177][l]+f[174][l])+0.6846531968814573*f[83][l])*alpha_vdim[251][l]+(0.5477225575051661*f[227][l]+0.6123724356957944*(f[178][l]+f[173][l])+0.6846531968814573*f[84][l])*alpha_vdim[250][l]+(0.5477225575051661*f[226][l]+0.6123724356957944*(f[176][l]+f[175][l])+0.6846531968814573*f[85][l])*alpha_vdim[249][l]+0.6123724356957944*f[96][l]*alpha_vdim[248][l]+0.273861278752583*f[115][l]*alpha_cdim[247][l]+(0.6123724356957944*f[200][l]+0.6846531968814573*f[114][l])*alpha_vdim[246][l]+(0.6123724356957944*f[199][l]+0.6846531968814573*f[115][l])*alpha_vdim[245][l]+0.6123724356957944*f[198][l]*alpha_vdim[244][l]+0.6846531968814573*(f[116][l]*alpha_vdim[244][l]+f[151][l]*alpha_vdim[243][l])+0.3061862178478971*f[180][l]*alpha_cdim[243][l]+0.2449489742783178*alpha_vdim[6][l]*f[234][l]+0.273861278752583*alpha_cdim[3][l]*f[221][l]+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[217][l]+(0.2449489742783178*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[216][l]+0.2190890230020664*(alpha_vdim[22][l]*f[213][l]+alpha_vdim[25][l]*f[207][l])+0.273861278752583*alpha_vdim[6][l]*(f[190][l]+f[189][l])+0.3061862178478971*alpha_cdim[0][l]*f[181][l]+(0.2449489742783178*alpha_vdim[86][l]+0.273861278752583*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[179][l]+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[174][l]+(0.2190890230020664*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[173][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[165][l]+(0.2190890230020664*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[164][l]+(0.273861278752583*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[145][l]+(0.273861278752583*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[144][l]+0.2449489742783178*(alpha_vdim[22][l]*(f[142][l]+f[141][l])+alpha_vdim[25][l]*(f[133][l]+f[132][l]))+0.2190890230020664*f[110][l]*alpha_vdim[129][l]+f[114][l]*(0.2190890230020664*alpha_vdim[120][l]+0.2449489742783178*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.273861278752583*alpha_vdim[4][l])+(0.2449489742783178*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.273861278752583*alpha_vdim[5][l])*f[110][l]+0.3061862178478971*alpha_vdim[6][l]*f[95][l]+(0.2449489742783178*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[84][l]+(0.2449489742783178*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[83][l]+(0.2449489742783178*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[78][l]+0.2449489742783178*alpha_vdim[68][l]*f[77][l]+0.273861278752583*(alpha_vdim[13][l]*f[77][l]+alpha_vdim[22][l]*f[50][l]+alpha_vdim[25][l]*f[46][l]);
+    out[202][l] += (0.1249739664685295*f[206][l]+0.1956151991089878*(f[131][l]+f[130][l])+0.3061862178478971*f[45][l])*alpha_vdim[372][l]+(0.1117801137765645*f[117][l]+0.1749635530559412*(f[34][l]+f[33][l])+0.273861278752583*f[3][l])*alpha_vdim[360][l]+(0.1249739664685295*f[182][l]+0.1956151991089878*(f[88][l]+f[87][l])+0.3061862178478971*f[18][l])*alpha_vdim[329][l]+(0.1749635530559412*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[312][l]+(0.1749635530559412*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[311][l]+(0.1564921592871903*f[57][l]+0.2449489742783178*f[7][l])*alpha_vdim[300][l]+(0.1564921592871903*f[56][l]+0.2449489742783178*f[8][l])*alpha_vdim[299][l]+(0.1956151991089878*f[206][l]+0.3061862178478971*f[130][l])*alpha_vdim[287][l]+(0.1956151991089878*f[206][l]+0.3061862178478971*f[131][l])*alpha_vdim[286][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[33][l])*alpha_vdim[277][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[34][l])*alpha_vdim[276][l]+(0.1749635530559412*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[275][l]+(0.1749635530559412*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[274][l]+0.2449489742783178*f[103][l]*alpha_vdim[268][l]+0.2190890230020664*f[21][l]*alpha_vdim[264][l]+(0.1956151991089878*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[260][l]+(0.1956151991089878*f[182][l]+0.3061862178478971*f[88][l])*alpha_vdim[259][l]+0.273861278752583*(f[159][l]*alpha_vdim[256][l]+f[160][l]*alpha_vdim[255][l])+0.2449489742783178*(f[56][l]*alpha_vdim[251][l]+f[57][l]*alpha_vdim[250][l]+f[58][l]*alpha_vdim[249][l])+0.3061862178478971*f[206][l]*alpha_vdim[248][l]+(0.6123724356957944*f[204][l]+0.6846531968814573*f[118][l])*alpha_cdim[247][l]+0.273861278752583*(f[117][l]*alpha_vdim[246][l]+f[118][l]*alpha_vdim[245][l]+f[119][l]*alpha_vdim[244][l])+0.3061862178478971*f[182][l]*alpha_vdim[243][l]+0.6846531968814573*f[153][l]*alpha_cdim[243][l]+(0.249947932937059*alpha_vdim[120][l]+0.3912303982179757*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[203][l]+(0.2794502844414113*alpha_vdim[129][l]+0.4374088826398531*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6846531968814573*alpha_vdim[5][l])*f[192][l]+(0.3499271061118826*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[156][l]+(0.3499271061118826*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[155][l]+0.6846531968814573*alpha_cdim[0][l]*f[154][l]+(0.2794502844414113*alpha_vdim[86][l]+0.4374088826398531*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[152][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[148][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[147][l]+(0.4374088826398531*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[129][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])*f[126][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[125][l]+(0.2794502844414113*f[117][l]+0.6123724356957944*f[42][l]+0.4374088826398531*(f[34][l]+f[33][l])+0.6846531968814573*f[3][l])*alpha_vdim[120][l]+0.4374088826398531*(alpha_vdim[38][l]+alpha_vdim[37][l])*f[117][l]+0.6846531968814573*(alpha_vdim[4][l]*f[117][l]+alpha_vdim[43][l]*f[107][l]+alpha_vdim[44][l]*f[106][l])+0.4898979485566357*alpha_vdim[22][l]*f[100][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[98][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[97][l]+0.5477225575051661*alpha_vdim[25][l]*f[96][l]+(0.4374088826398531*(f[62][l]+f[61][l])+0.6846531968814573*f[11][l])*alpha_vdim[86][l]+0.6123724356957944*(f[54][l]*alpha_vdim[69][l]+f[55][l]*alpha_vdim[68][l])+0.5477225575051661*(alpha_vdim[59][l]*f[67][l]+alpha_vdim[60][l]*f[66][l])+0.6846531968814573*(alpha_vdim[16][l]*f[62][l]+alpha_vdim[17][l]*f[61][l])+(0.3912303982179757*f[57][l]+0.6123724356957944*f[7][l])*alpha_vdim[60][l]+0.3912303982179757*f[56][l]*alpha_vdim[59][l]+0.6123724356957944*(f[8][l]*alpha_vdim[59][l]+alpha_vdim[9][l]*f[57][l]+alpha_vdim[10][l]*f[56][l])+0.5477225575051661*alpha_vdim[6][l]*f[51][l]+0.6846531968814573*(f[33][l]*alpha_vdim[38][l]+f[34][l]*alpha_vdim[37][l])+0.6123724356957944*(f[23][l]*alpha_vdim[32][l]+f[24][l]*alpha_vdim[31][l])+0.5477225575051661*f[21][l]*alpha_vdim[22][l];
+    out[203][l] += (0.2794502844414113*f[192][l]+0.4374088826398531*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[372][l]+(0.249947932937059*f[202][l]+0.3912303982179757*(f[122][l]+f[121][l])+0.2794502844414113*f[120][l]+0.6123724356957944*f[39][l]+0.4374088826398531*(f[38][l]+f[37][l])+0.6846531968814573*f[4][l])*alpha_vdim[360][l]+(0.2794502844414113*f[152][l]+0.4374088826398531*(f[62][l]+f[61][l])+0.6846531968814573*f[11][l])*alpha_vdim[329][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[312][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[311][l]+(0.3499271061118826*f[154][l]+0.5477225575051661*f[63][l]+0.3912303982179757*f[60][l]+0.6123724356957944*f[9][l])*alpha_vdim[300][l]+(0.3499271061118826*f[153][l]+0.5477225575051661*f[64][l]+0.3912303982179757*f[59][l]+0.6123724356957944*f[10][l])*alpha_vdim[299][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[287][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[286][l]+(0.3912303982179757*f[202][l]+0.6123724356957944*f[121][l]+0.4374088826398531*f[120][l]+0.6846531968814573*f[37][l])*alpha_vdim[277][l]+(0.3912303982179757*f[202][l]+0.6123724356957944*f[122][l]+0.4374088826398531*f[120][l]+0.6846531968814573*f[38][l])*alpha_vdim[276][l]+(0.3912303982179757*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[275][l]+(0.3912303982179757*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[274][l]+0.5477225575051661*f[96][l]*alpha_vdim[268][l]+(0.4898979485566357*f[99][l]+0.5477225575051661*f[22][l])*alpha_vdim[264][l]+(0.4374088826398531*f[152][l]+0.6846531968814573*f[61][l])*alpha_vdim[260][l]+(0.4374088826398531*f[152][l]+0.6846531968814573*f[62][l])*alpha_vdim[259][l]+0.6123724356957944*(f[147][l]*alpha_vdim[256][l]+f[148][l]*alpha_vdim[255][l])+(0.5477225575051661*f[153][l]+0.6123724356957944*f[59][l])*alpha_vdim[251][l]+(0.5477225575051661*f[154][l]+0.6123724356957944*f[60][l])*alpha_vdim[250][l]+0.5477225575051661*f[51][l]*alpha_vdim[249][l]+0.6846531968814573*f[192][l]*alpha_vdim[248][l]+0.6123724356957944*f[97][l]*alpha_cdim[247][l]+(0.6123724356957944*f[202][l]+0.6846531968814573*f[120][l])*alpha_vdim[246][l]+0.6123724356957944*(f[97][l]*alpha_vdim[245][l]+f[98][l]*alpha_vdim[244][l])+0.6846531968814573*(f[152][l]*alpha_vdim[243][l]+f[155][l]*alpha_cdim[243][l])+(0.1249739664685295*alpha_vdim[129][l]+0.1956151991089878*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[207][l]+0.6123724356957944*alpha_cdim[3][l]*f[205][l]+(0.1249739664685295*alpha_vdim[86][l]+0.1956151991089878*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[183][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[165][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[164][l]+0.6846531968814573*alpha_cdim[0][l]*f[156][l]+(0.1956151991089878*alpha_vdim[129][l]+0.3061862178478971*alpha_vdim[43][l])*f[133][l]+0.1956151991089878*alpha_vdim[129][l]*f[132][l]+0.3061862178478971*(alpha_vdim[44][l]*f[132][l]+f[46][l]*alpha_vdim[129][l])+(0.1749635530559412*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[124][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[123][l]+(0.1117801137765645*alpha_vdim[120][l]+0.1749635530559412*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.273861278752583*alpha_vdim[4][l])*f[120][l]+(0.1749635530559412*(f[38][l]+f[37][l])+0.273861278752583*f[4][l])*alpha_vdim[120][l]+0.2449489742783178*alpha_vdim[25][l]*f[110][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[90][l]+0.1956151991089878*alpha_vdim[86][l]*f[89][l]+0.3061862178478971*(alpha_vdim[17][l]*f[89][l]+f[19][l]*alpha_vdim[86][l])+0.273861278752583*(alpha_vdim[68][l]*f[78][l]+alpha_vdim[69][l]*f[77][l])+0.2449489742783178*alpha_vdim[6][l]*f[65][l]+0.1564921592871903*alpha_vdim[60][l]*f[60][l]+0.2449489742783178*(alpha_vdim[9][l]*f[60][l]+f[9][l]*alpha_vdim[60][l])+0.1564921592871903*alpha_vdim[59][l]*f[59][l]+0.2449489742783178*(alpha_vdim[10][l]*f[59][l]+f[10][l]*alpha_vdim[59][l])+0.273861278752583*(alpha_vdim[31][l]*f[41][l]+alpha_vdim[32][l]*f[40][l]+alpha_vdim[37][l]*f[38][l]+f[37][l]*alpha_vdim[38][l])+0.2190890230020664*alpha_vdim[22][l]*f[22][l];
+    out[204][l] += (0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[372][l]+(0.3499271061118826*f[97][l]+0.5477225575051661*f[24][l])*alpha_vdim[360][l]+(0.3912303982179757*f[153][l]+0.6123724356957944*f[64][l])*alpha_vdim[329][l]+0.5477225575051661*f[149][l]*alpha_vdim[312][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l]+0.4374088826398531*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[311][l]+0.4898979485566357*f[51][l]*alpha_vdim[300][l]+(0.3499271061118826*f[152][l]+0.5477225575051661*f[62][l]+0.3912303982179757*f[61][l])*alpha_vdim[299][l]+0.6123724356957944*(f[11][l]*alpha_vdim[299][l]+f[193][l]*alpha_vdim[287][l])+(0.4374088826398531*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[286][l]+0.5477225575051661*f[97][l]*alpha_vdim[277][l]+(0.3912303982179757*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[276][l]+0.5477225575051661*f[99][l]*alpha_vdim[275][l]+(0.3912303982179757*f[202][l]+0.6123724356957944*f[122][l]+0.4374088826398531*f[121][l]+0.6846531968814573*f[39][l])*alpha_vdim[274][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[268][l]+(0.4898979485566357*f[98][l]+0.5477225575051661*f[23][l])*alpha_vdim[264][l]+0.6123724356957944*f[153][l]*alpha_vdim[260][l]+(0.4374088826398531*f[153][l]+0.6846531968814573*f[64][l])*alpha_vdim[259][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[256][l]+0.6123724356957944*f[149][l]*alpha_vdim[255][l]+(0.5477225575051661*f[152][l]+0.6123724356957944*f[61][l])*alpha_vdim[251][l]+0.5477225575051661*f[51][l]*alpha_vdim[250][l]+(0.5477225575051661*f[154][l]+0.6123724356957944*f[63][l])*alpha_vdim[249][l]+0.6846531968814573*f[193][l]*alpha_vdim[248][l]+0.273861278752583*f[121][l]*alpha_cdim[247][l]+0.6123724356957944*f[97][l]*alpha_vdim[246][l]+(0.6123724356957944*f[202][l]+0.6846531968814573*f[121][l])*alpha_vdim[245][l]+0.6123724356957944*f[99][l]*alpha_vdim[244][l]+0.6846531968814573*f[153][l]*alpha_vdim[243][l]+0.3061862178478971*f[184][l]*alpha_cdim[243][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[223][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[203][l]+0.5477225575051661*alpha_vdim[25][l]*f[196][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l]+0.4374088826398531*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[195][l]+alpha_vdim[68][l]*(0.6123724356957944*f[167][l]+0.4374088826398531*f[166][l])+0.6846531968814573*(alpha_vdim[13][l]*f[166][l]+alpha_cdim[0][l]*f[157][l])+0.5477225575051661*alpha_vdim[6][l]*f[156][l]+(0.3912303982179757*alpha_vdim[86][l]+0.6123724356957944*alpha_vdim[17][l]+0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[155][l]+0.3499271061118826*alpha_vdim[59][l]*f[152][l]+0.5477225575051661*(alpha_vdim[10][l]*f[152][l]+alpha_vdim[69][l]*f[150][l])+0.6123724356957944*(alpha_vdim[12][l]*f[150][l]+f[112][l]*alpha_vdim[129][l]+alpha_vdim[31][l]*f[126][l])+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[125][l]+(0.3499271061118826*f[97][l]+0.5477225575051661*f[24][l])*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[43][l]*f[112][l]+0.6123724356957944*alpha_vdim[25][l]*f[111][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[100][l]+0.4898979485566357*alpha_vdim[22][l]*f[98][l]+(0.5477225575051661*alpha_vdim[38][l]+0.3912303982179757*alpha_vdim[37][l])*f[97][l]+0.6123724356957944*(alpha_vdim[4][l]*f[97][l]+f[67][l]*alpha_vdim[86][l])+0.6846531968814573*(alpha_vdim[68][l]*f[79][l]+alpha_vdim[16][l]*f[67][l])+0.6123724356957944*alpha_vdim[6][l]*f[66][l]+0.5477225575051661*alpha_vdim[59][l]*f[62][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[61][l]+0.4898979485566357*f[51][l]*alpha_vdim[60][l]+0.6123724356957944*f[11][l]*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[9][l]*f[51][l]+0.6846531968814573*alpha_vdim[31][l]*f[42][l]+0.6123724356957944*f[24][l]*alpha_vdim[37][l]+0.5477225575051661*alpha_vdim[22][l]*f[23][l];
+    out[205][l] += (0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[372][l]+(0.3499271061118826*f[98][l]+0.5477225575051661*f[23][l])*alpha_vdim[360][l]+(0.3912303982179757*f[154][l]+0.6123724356957944*f[63][l])*alpha_vdim[329][l]+(0.3912303982179757*f[222][l]+0.4374088826398531*f[163][l]+0.6123724356957944*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[312][l]+0.5477225575051661*f[149][l]*alpha_vdim[311][l]+(0.3499271061118826*f[152][l]+0.3912303982179757*f[62][l]+0.5477225575051661*f[61][l]+0.6123724356957944*f[11][l])*alpha_vdim[300][l]+0.4898979485566357*f[51][l]*alpha_vdim[299][l]+(0.4374088826398531*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[287][l]+0.6123724356957944*f[194][l]*alpha_vdim[286][l]+(0.3912303982179757*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[277][l]+0.5477225575051661*f[98][l]*alpha_vdim[276][l]+(0.3912303982179757*f[202][l]+0.4374088826398531*f[122][l]+0.6123724356957944*f[121][l]+0.6846531968814573*f[39][l])*alpha_vdim[275][l]+0.5477225575051661*f[99][l]*alpha_vdim[274][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[268][l]+(0.4898979485566357*f[97][l]+0.5477225575051661*f[24][l])*alpha_vdim[264][l]+(0.4374088826398531*f[154][l]+0.6846531968814573*f[63][l])*alpha_vdim[260][l]+0.6123724356957944*(f[154][l]*alpha_vdim[259][l]+f[149][l]*alpha_vdim[256][l])+(0.6123724356957944*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[255][l]+0.5477225575051661*f[51][l]*alpha_vdim[251][l]+(0.5477225575051661*f[152][l]+0.6123724356957944*f[62][l])*alpha_vdim[250][l]+(0.5477225575051661*f[153][l]+0.6123724356957944*f[64][l])*alpha_vdim[249][l]+0.6846531968814573*f[194][l]*alpha_vdim[248][l]+0.6123724356957944*(f[99][l]*alpha_cdim[247][l]+f[98][l]*alpha_vdim[246][l]+f[99][l]*alpha_vdim[245][l]+f[202][l]*alpha_vdim[244][l])+0.6846531968814573*(f[122][l]*alpha_vdim[244][l]+f[154][l]*alpha_vdim[243][l]+f[157][l]*alpha_cdim[243][l])+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[223][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[203][l]+(0.3912303982179757*alpha_vdim[129][l]+0.4374088826398531*alpha_vdim[44][l]+0.6123724356957944*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[196][l]+0.5477225575051661*alpha_vdim[25][l]*f[195][l]+0.3061862178478971*alpha_cdim[0][l]*f[185][l]+(0.4374088826398531*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[167][l]+0.6123724356957944*alpha_vdim[69][l]*f[166][l]+(0.3912303982179757*alpha_vdim[86][l]+0.4374088826398531*alpha_vdim[17][l]+0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[156][l]+0.5477225575051661*alpha_vdim[6][l]*f[155][l]+0.3499271061118826*alpha_vdim[60][l]*f[152][l]+0.5477225575051661*(alpha_vdim[9][l]*f[152][l]+alpha_vdim[68][l]*f[150][l])+0.6123724356957944*(alpha_vdim[13][l]*f[150][l]+f[111][l]*alpha_vdim[129][l])+(0.4374088826398531*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[126][l]+0.6123724356957944*alpha_vdim[32][l]*f[125][l]+(0.3499271061118826*f[98][l]+0.5477225575051661*f[23][l])*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[25][l]*f[112][l]+0.6846531968814573*alpha_vdim[44][l]*f[111][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[100][l]+(0.3912303982179757*alpha_vdim[38][l]+0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[98][l]+0.4898979485566357*alpha_vdim[22][l]*f[97][l]+0.6123724356957944*f[66][l]*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[69][l]*f[79][l]+0.6123724356957944*alpha_vdim[6][l]*f[67][l]+0.6846531968814573*alpha_vdim[17][l]*f[66][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[62][l]+alpha_vdim[60][l]*(0.5477225575051661*f[61][l]+0.6123724356957944*f[11][l])+f[51][l]*(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])+0.6846531968814573*alpha_vdim[32][l]*f[42][l]+0.6123724356957944*f[23][l]*alpha_vdim[38][l]+0.5477225575051661*alpha_vdim[22][l]*f[24][l];
+    out[206][l] += (0.1249739664685295*f[202][l]+0.1956151991089878*(f[122][l]+f[121][l])+0.3061862178478971*f[39][l])*alpha_vdim[606][l]+(0.1117801137765645*f[117][l]+0.1749635530559412*(f[34][l]+f[33][l])+0.273861278752583*f[3][l])*alpha_vdim[603][l]+(0.1249739664685295*f[182][l]+0.1956151991089878*(f[88][l]+f[87][l])+0.3061862178478971*f[18][l])*alpha_vdim[572][l]+(0.1749635530559412*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[546][l]+(0.1749635530559412*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[545][l]+(0.1564921592871903*f[57][l]+0.2449489742783178*f[7][l])*alpha_vdim[543][l]+(0.1564921592871903*f[56][l]+0.2449489742783178*f[8][l])*alpha_vdim[542][l]+(0.1956151991089878*f[202][l]+0.3061862178478971*f[121][l])*alpha_vdim[524][l]+(0.1956151991089878*f[202][l]+0.3061862178478971*f[122][l])*alpha_vdim[523][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[33][l])*alpha_vdim[520][l]+(0.1749635530559412*f[117][l]+0.273861278752583*f[34][l])*alpha_vdim[519][l]+(0.1749635530559412*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[518][l]+(0.1749635530559412*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[517][l]+0.2449489742783178*f[99][l]*alpha_vdim[508][l]+0.2190890230020664*f[21][l]*alpha_vdim[507][l]+(0.1956151991089878*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[503][l]+(0.1956151991089878*f[182][l]+0.3061862178478971*f[88][l])*alpha_vdim[502][l]+0.273861278752583*(f[153][l]*alpha_vdim[496][l]+f[154][l]*alpha_vdim[495][l])+0.2449489742783178*(f[56][l]*alpha_vdim[494][l]+f[57][l]*alpha_vdim[493][l]+f[58][l]*alpha_vdim[492][l])+0.3061862178478971*f[202][l]*alpha_vdim[490][l]+0.273861278752583*(f[117][l]*alpha_vdim[489][l]+f[118][l]*alpha_vdim[488][l]+f[119][l]*alpha_vdim[487][l])+0.3061862178478971*f[182][l]*alpha_vdim[486][l]+0.6846531968814573*(f[193][l]*alpha_cdim[247][l]+f[159][l]*alpha_cdim[243][l])+(0.249947932937059*alpha_vdim[129][l]+0.3912303982179757*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[210][l]+(0.2794502844414113*alpha_vdim[120][l]+0.4374088826398531*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[192][l]+(0.3499271061118826*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[171][l]+(0.3499271061118826*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[170][l]+0.6846531968814573*alpha_cdim[0][l]*f[160][l]+(0.2794502844414113*alpha_vdim[86][l]+0.4374088826398531*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[158][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[148][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[147][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[43][l])*f[138][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[137][l]+(0.2794502844414113*f[117][l]+0.6123724356957944*f[49][l]+0.4374088826398531*(f[34][l]+f[33][l])+0.6846531968814573*f[3][l])*alpha_vdim[129][l]+(0.4374088826398531*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[120][l]+(0.4374088826398531*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6846531968814573*alpha_vdim[5][l])*f[117][l]+0.4898979485566357*alpha_vdim[25][l]*f[113][l]+0.6846531968814573*(alpha_vdim[37][l]*f[107][l]+alpha_vdim[38][l]*f[106][l])+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[102][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[101][l]+0.5477225575051661*alpha_vdim[22][l]*f[96][l]+(0.4374088826398531*(f[71][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[86][l]+0.5477225575051661*(alpha_vdim[68][l]*f[82][l]+alpha_vdim[69][l]*f[81][l])+0.6846531968814573*(alpha_vdim[16][l]*f[71][l]+alpha_vdim[17][l]*f[70][l])+(0.3912303982179757*f[57][l]+0.6123724356957944*f[7][l])*alpha_vdim[69][l]+0.3912303982179757*f[56][l]*alpha_vdim[68][l]+0.6123724356957944*(f[8][l]*alpha_vdim[68][l]+f[54][l]*alpha_vdim[60][l]+f[55][l]*alpha_vdim[59][l]+alpha_vdim[12][l]*f[57][l]+alpha_vdim[13][l]*f[56][l])+0.5477225575051661*alpha_vdim[6][l]*f[52][l]+0.6846531968814573*(f[33][l]*alpha_vdim[44][l]+f[34][l]*alpha_vdim[43][l])+0.6123724356957944*(f[26][l]*alpha_vdim[32][l]+f[27][l]*alpha_vdim[31][l])+0.5477225575051661*f[21][l]*alpha_vdim[25][l];
+    out[207][l] += (0.1117801137765645*f[120][l]+0.1749635530559412*(f[38][l]+f[37][l])+0.273861278752583*f[4][l])*alpha_vdim[606][l]+(0.1249739664685295*f[203][l]+0.1956151991089878*(f[126][l]+f[125][l])+0.3061862178478971*f[42][l])*alpha_vdim[603][l]+(0.1249739664685295*f[183][l]+0.1956151991089878*(f[90][l]+f[89][l])+0.3061862178478971*f[19][l])*alpha_vdim[572][l]+(0.1564921592871903*f[60][l]+0.2449489742783178*f[9][l])*alpha_vdim[546][l]+(0.1564921592871903*f[59][l]+0.2449489742783178*f[10][l])*alpha_vdim[545][l]+(0.1749635530559412*f[156][l]+0.273861278752583*f[66][l])*alpha_vdim[543][l]+(0.1749635530559412*f[155][l]+0.273861278752583*f[67][l])*alpha_vdim[542][l]+(0.1749635530559412*f[120][l]+0.273861278752583*f[37][l])*alpha_vdim[524][l]+(0.1749635530559412*f[120][l]+0.273861278752583*f[38][l])*alpha_vdim[523][l]+(0.1956151991089878*f[203][l]+0.3061862178478971*f[125][l])*alpha_vdim[520][l]+(0.1956151991089878*f[203][l]+0.3061862178478971*f[126][l])*alpha_vdim[519][l]+(0.1749635530559412*f[124][l]+0.273861278752583*f[40][l])*alpha_vdim[518][l]+(0.1749635530559412*f[123][l]+0.273861278752583*f[41][l])*alpha_vdim[517][l]+0.2190890230020664*f[22][l]*alpha_vdim[508][l]+0.2449489742783178*f[100][l]*alpha_vdim[507][l]+(0.1956151991089878*f[183][l]+0.3061862178478971*f[89][l])*alpha_vdim[503][l]+(0.1956151991089878*f[183][l]+0.3061862178478971*f[90][l])*alpha_vdim[502][l]+0.2449489742783178*(f[59][l]*alpha_vdim[496][l]+f[60][l]*alpha_vdim[495][l])+0.273861278752583*(f[155][l]*alpha_vdim[494][l]+f[156][l]*alpha_vdim[493][l])+0.2449489742783178*f[65][l]*alpha_vdim[492][l]+0.273861278752583*f[120][l]*alpha_vdim[490][l]+0.3061862178478971*f[203][l]*alpha_vdim[489][l]+0.273861278752583*(f[123][l]*alpha_vdim[488][l]+f[124][l]*alpha_vdim[487][l])+0.3061862178478971*f[183][l]*alpha_vdim[486][l]+(0.249947932937059*f[213][l]+0.3912303982179757*(f[142][l]+f[141][l])+0.2794502844414113*f[120][l]+0.6123724356957944*f[50][l]+0.4374088826398531*(f[38][l]+f[37][l])+0.6846531968814573*f[4][l])*alpha_vdim[372][l]+(0.2794502844414113*f[192][l]+0.4374088826398531*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[360][l]+(0.2794502844414113*f[161][l]+0.4374088826398531*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[329][l]+(0.3499271061118826*f[174][l]+0.5477225575051661*f[83][l]+0.3912303982179757*f[60][l]+0.6123724356957944*f[9][l])*alpha_vdim[312][l]+(0.3499271061118826*f[173][l]+0.5477225575051661*f[84][l]+0.3912303982179757*f[59][l]+0.6123724356957944*f[10][l])*alpha_vdim[311][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[300][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[299][l]+(0.3912303982179757*f[213][l]+0.6123724356957944*f[141][l]+0.4374088826398531*f[120][l]+0.6846531968814573*f[37][l])*alpha_vdim[287][l]+(0.3912303982179757*f[213][l]+0.6123724356957944*f[142][l]+0.4374088826398531*f[120][l]+0.6846531968814573*f[38][l])*alpha_vdim[286][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[277][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[276][l]+(0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[275][l]+(0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[274][l]+0.4898979485566357*f[114][l]*alpha_vdim[268][l]+0.5477225575051661*(f[22][l]*alpha_vdim[268][l]+f[96][l]*alpha_vdim[264][l])+(0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[260][l]+(0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[259][l]+(0.5477225575051661*f[173][l]+0.6123724356957944*f[59][l])*alpha_vdim[256][l]+0.5477225575051661*f[174][l]*alpha_vdim[255][l]+0.6123724356957944*(f[60][l]*alpha_vdim[255][l]+f[147][l]*alpha_vdim[251][l]+f[148][l]*alpha_vdim[250][l])+0.5477225575051661*f[53][l]*alpha_vdim[249][l]+(0.6123724356957944*f[213][l]+0.6846531968814573*f[120][l])*alpha_vdim[248][l]+0.6123724356957944*f[104][l]*alpha_cdim[247][l]+0.6846531968814573*f[192][l]*alpha_vdim[246][l]+0.6123724356957944*(f[104][l]*alpha_vdim[245][l]+f[105][l]*alpha_vdim[244][l])+0.6846531968814573*(f[161][l]*alpha_vdim[243][l]+f[164][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[196][l]+alpha_cdim[0][l]*f[165][l]);
+    out[208][l] += (0.1749635530559412*f[202][l]+0.273861278752583*f[122][l])*alpha_vdim[606][l]+(0.1749635530559412*f[203][l]+0.273861278752583*f[126][l])*alpha_vdim[603][l]+(0.1956151991089878*f[232][l]+0.3061862178478971*f[185][l])*alpha_vdim[572][l]+0.2449489742783178*f[154][l]*alpha_vdim[546][l]+(0.1749635530559412*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[545][l]+0.2449489742783178*f[156][l]*alpha_vdim[543][l]+0.1749635530559412*f[155][l]*alpha_vdim[542][l]+0.273861278752583*(f[67][l]*alpha_vdim[542][l]+f[202][l]*alpha_vdim[524][l])+0.1749635530559412*f[121][l]*alpha_vdim[523][l]+0.273861278752583*(f[39][l]*alpha_vdim[523][l]+f[203][l]*alpha_vdim[520][l])+0.1749635530559412*f[125][l]*alpha_vdim[519][l]+0.273861278752583*(f[42][l]*alpha_vdim[519][l]+f[205][l]*alpha_vdim[518][l])+(0.1956151991089878*f[204][l]+0.3061862178478971*f[128][l])*alpha_vdim[517][l]+0.2449489742783178*(f[99][l]*alpha_vdim[508][l]+f[100][l]*alpha_vdim[507][l])+0.3061862178478971*f[232][l]*alpha_vdim[503][l]+(0.1956151991089878*f[184][l]+0.3061862178478971*f[91][l])*alpha_vdim[502][l]+0.273861278752583*f[153][l]*alpha_vdim[496][l]+0.2449489742783178*f[63][l]*alpha_vdim[495][l]+0.273861278752583*f[155][l]*alpha_vdim[494][l]+0.2449489742783178*f[66][l]*alpha_vdim[493][l]+0.273861278752583*(f[157][l]*alpha_vdim[492][l]+f[121][l]*alpha_vdim[490][l]+f[125][l]*alpha_vdim[489][l])+0.3061862178478971*f[204][l]*alpha_vdim[488][l]+0.273861278752583*f[127][l]*alpha_vdim[487][l]+0.3061862178478971*f[184][l]*alpha_vdim[486][l]+(0.3912303982179757*f[238][l]+0.6123724356957944*f[215][l]+0.4374088826398531*f[202][l]+0.6846531968814573*f[122][l])*alpha_vdim[372][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[360][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[329][l]+(0.5477225575051661*f[228][l]+0.6123724356957944*f[154][l])*alpha_vdim[312][l]+(0.3912303982179757*f[227][l]+0.6123724356957944*f[178][l]+0.4374088826398531*f[153][l]+0.6846531968814573*f[64][l])*alpha_vdim[311][l]+0.5477225575051661*f[148][l]*alpha_vdim[300][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[299][l]+(0.6123724356957944*f[238][l]+0.6846531968814573*f[202][l])*alpha_vdim[287][l]+(0.3912303982179757*f[214][l]+0.6123724356957944*f[143][l]+0.4374088826398531*f[121][l]+0.6846531968814573*f[39][l])*alpha_vdim[286][l]+0.6123724356957944*f[192][l]*alpha_vdim[277][l]+0.3912303982179757*f[106][l]*alpha_vdim[276][l]+0.6123724356957944*(f[30][l]*alpha_vdim[276][l]+f[194][l]*alpha_vdim[275][l])+(0.4374088826398531*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[274][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[99][l])*alpha_vdim[268][l]+0.5477225575051661*f[96][l]*alpha_vdim[264][l]+0.6846531968814573*f[222][l]*alpha_vdim[260][l]+(0.4374088826398531*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[259][l]+(0.6123724356957944*f[227][l]+0.6846531968814573*f[153][l])*alpha_vdim[256][l]+0.5477225575051661*f[177][l]*alpha_vdim[255][l]+0.6123724356957944*(f[63][l]*alpha_vdim[255][l]+f[147][l]*alpha_vdim[251][l])+0.5477225575051661*f[54][l]*alpha_vdim[250][l]+0.6123724356957944*f[149][l]*alpha_vdim[249][l]+(0.6123724356957944*f[214][l]+0.6846531968814573*f[121][l])*alpha_vdim[248][l]+0.6123724356957944*f[106][l]*alpha_vdim[246][l]+0.6846531968814573*f[193][l]*alpha_vdim[245][l]+0.6123724356957944*f[108][l]*alpha_vdim[244][l]+0.6846531968814573*f[162][l]*alpha_vdim[243][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[239][l]+0.5477225575051661*alpha_vdim[69][l]*f[230][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[229][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[223][l]+0.6123724356957944*alpha_vdim[129][l]*f[219][l]+(0.3912303982179757*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[218][l]+(0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[44][l])*f[203][l]+0.5477225575051661*alpha_vdim[25][l]*f[201][l]+0.6123724356957944*alpha_vdim[32][l]*f[196][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[195][l]+0.3912303982179757*alpha_vdim[120][l]*f[192][l]+0.6123724356957944*(alpha_vdim[38][l]*f[192][l]+alpha_vdim[68][l]*f[181][l])+0.5477225575051661*alpha_vdim[12][l]*f[180][l]+0.6846531968814573*(alpha_cdim[0][l]*f[168][l]+alpha_vdim[86][l]*f[167][l])+(0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[166][l]+0.6123724356957944*alpha_vdim[69][l]*f[156][l]+(0.4374088826398531*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[13][l])*f[155][l]+0.6123724356957944*alpha_vdim[6][l]*f[150][l]+0.5477225575051661*alpha_vdim[60][l]*f[148][l]+0.3912303982179757*alpha_vdim[59][l]*f[147][l]+0.6123724356957944*(alpha_vdim[10][l]*f[147][l]+alpha_vdim[43][l]*f[146][l])+0.6846531968814573*f[126][l]*alpha_vdim[129][l]+(0.4374088826398531*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[125][l]+0.6123724356957944*f[107][l]*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[31][l]*f[112][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l])*f[111][l]+0.3912303982179757*alpha_vdim[37][l]*f[106][l]+0.6123724356957944*(alpha_vdim[4][l]*f[106][l]+alpha_vdim[25][l]*f[100][l])+0.5477225575051661*alpha_vdim[22][l]*f[96][l]+0.6846531968814573*(alpha_vdim[16][l]*f[79][l]+f[67][l]*alpha_vdim[68][l])+0.6123724356957944*(alpha_vdim[12][l]*f[66][l]+f[55][l]*alpha_vdim[59][l])+0.5477225575051661*alpha_vdim[9][l]*f[54][l]+0.6846531968814573*f[42][l]*alpha_vdim[43][l]+0.6123724356957944*f[30][l]*alpha_vdim[37][l];
+    out[209][l] += (0.1749635530559412*f[202][l]+0.273861278752583*f[121][l])*alpha_vdim[606][l]+(0.1749635530559412*f[203][l]+0.273861278752583*f[125][l])*alpha_vdim[603][l]+(0.1956151991089878*f[232][l]+0.3061862178478971*f[184][l])*alpha_vdim[572][l]+(0.1749635530559412*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[546][l]+0.2449489742783178*f[153][l]*alpha_vdim[545][l]+(0.1749635530559412*f[156][l]+0.273861278752583*f[66][l])*alpha_vdim[543][l]+0.2449489742783178*f[155][l]*alpha_vdim[542][l]+0.1749635530559412*f[122][l]*alpha_vdim[524][l]+0.273861278752583*(f[39][l]*alpha_vdim[524][l]+f[202][l]*alpha_vdim[523][l])+0.1749635530559412*f[126][l]*alpha_vdim[520][l]+0.273861278752583*(f[42][l]*alpha_vdim[520][l]+f[203][l]*alpha_vdim[519][l])+(0.1956151991089878*f[205][l]+0.3061862178478971*f[127][l])*alpha_vdim[518][l]+0.273861278752583*f[204][l]*alpha_vdim[517][l]+0.2449489742783178*(f[99][l]*alpha_vdim[508][l]+f[100][l]*alpha_vdim[507][l])+0.1956151991089878*f[185][l]*alpha_vdim[503][l]+0.3061862178478971*(f[91][l]*alpha_vdim[503][l]+f[232][l]*alpha_vdim[502][l])+0.2449489742783178*f[64][l]*alpha_vdim[496][l]+0.273861278752583*f[154][l]*alpha_vdim[495][l]+0.2449489742783178*f[67][l]*alpha_vdim[494][l]+0.273861278752583*(f[156][l]*alpha_vdim[493][l]+f[157][l]*alpha_vdim[492][l]+f[122][l]*alpha_vdim[490][l]+f[126][l]*alpha_vdim[489][l]+f[128][l]*alpha_vdim[488][l])+0.3061862178478971*(f[205][l]*alpha_vdim[487][l]+f[185][l]*alpha_vdim[486][l])+(0.3912303982179757*f[238][l]+0.6123724356957944*f[214][l]+0.4374088826398531*f[202][l]+0.6846531968814573*f[121][l])*alpha_vdim[372][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[360][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[329][l]+(0.3912303982179757*f[228][l]+0.6123724356957944*f[177][l]+0.4374088826398531*f[154][l]+0.6846531968814573*f[63][l])*alpha_vdim[312][l]+(0.5477225575051661*f[227][l]+0.6123724356957944*f[153][l])*alpha_vdim[311][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[300][l]+0.5477225575051661*f[147][l]*alpha_vdim[299][l]+(0.3912303982179757*f[215][l]+0.6123724356957944*f[143][l]+0.4374088826398531*f[122][l]+0.6846531968814573*f[39][l])*alpha_vdim[287][l]+(0.6123724356957944*f[238][l]+0.6846531968814573*f[202][l])*alpha_vdim[286][l]+0.3912303982179757*f[107][l]*alpha_vdim[277][l]+0.6123724356957944*(f[30][l]*alpha_vdim[277][l]+f[192][l]*alpha_vdim[276][l])+(0.4374088826398531*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[275][l]+0.6123724356957944*f[193][l]*alpha_vdim[274][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[99][l])*alpha_vdim[268][l]+0.5477225575051661*f[96][l]*alpha_vdim[264][l]+0.4374088826398531*f[163][l]*alpha_vdim[260][l]+0.6846531968814573*(f[76][l]*alpha_vdim[260][l]+f[222][l]*alpha_vdim[259][l])+(0.5477225575051661*f[178][l]+0.6123724356957944*f[64][l])*alpha_vdim[256][l]+(0.6123724356957944*f[228][l]+0.6846531968814573*f[154][l])*alpha_vdim[255][l]+0.5477225575051661*f[55][l]*alpha_vdim[251][l]+0.6123724356957944*(f[148][l]*alpha_vdim[250][l]+f[149][l]*alpha_vdim[249][l])+(0.6123724356957944*f[215][l]+0.6846531968814573*f[122][l])*alpha_vdim[248][l]+0.6123724356957944*(f[109][l]*alpha_cdim[247][l]+f[107][l]*alpha_vdim[246][l]+f[109][l]*alpha_vdim[245][l])+0.6846531968814573*(f[194][l]*alpha_vdim[244][l]+f[163][l]*alpha_vdim[243][l]+f[169][l]*alpha_cdim[243][l])+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[43][l])*f[239][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[230][l]+0.5477225575051661*alpha_vdim[68][l]*f[229][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[223][l]+0.3912303982179757*alpha_vdim[44][l]*f[219][l]+0.6123724356957944*(alpha_vdim[5][l]*f[219][l]+alpha_vdim[129][l]*f[218][l])+(0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[43][l])*f[203][l]+0.5477225575051661*alpha_vdim[25][l]*f[201][l]+(0.4374088826398531*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[196][l]+0.6123724356957944*alpha_vdim[31][l]*f[195][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])*f[192][l]+0.5477225575051661*alpha_vdim[13][l]*f[181][l]+0.6123724356957944*alpha_vdim[69][l]*f[180][l]+0.4374088826398531*alpha_vdim[17][l]*f[167][l]+0.6846531968814573*(alpha_vdim[0][l]*f[167][l]+alpha_vdim[86][l]*f[166][l])+(0.4374088826398531*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[156][l]+0.6123724356957944*(alpha_vdim[68][l]*f[155][l]+alpha_vdim[6][l]*f[150][l])+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[148][l]+0.5477225575051661*alpha_vdim[59][l]*f[147][l]+0.6123724356957944*alpha_vdim[44][l]*f[146][l]+0.6846531968814573*f[125][l]*alpha_vdim[129][l]+(0.4374088826398531*alpha_vdim[44][l]+0.6846531968814573*alpha_vdim[5][l])*f[126][l]+0.6123724356957944*(f[106][l]*alpha_vdim[120][l]+alpha_vdim[2][l]*f[112][l])+0.6846531968814573*alpha_vdim[32][l]*f[111][l]+0.3912303982179757*alpha_vdim[38][l]*f[107][l]+0.6123724356957944*(alpha_vdim[4][l]*f[107][l]+alpha_vdim[25][l]*f[100][l])+0.5477225575051661*alpha_vdim[22][l]*f[96][l]+0.6846531968814573*(alpha_vdim[17][l]*f[79][l]+f[66][l]*alpha_vdim[69][l])+0.6123724356957944*(alpha_vdim[13][l]*f[67][l]+f[54][l]*alpha_vdim[60][l])+0.5477225575051661*alpha_vdim[10][l]*f[55][l]+0.6846531968814573*f[42][l]*alpha_vdim[44][l]+0.6123724356957944*f[30][l]*alpha_vdim[38][l];
+    out[210][l] += (0.2794502844414113*f[192][l]+0.4374088826398531*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[606][l]+(0.249947932937059*f[206][l]+0.3912303982179757*(f[131][l]+f[130][l])+0.2794502844414113*f[129][l]+0.6123724356957944*f[45][l]+0.4374088826398531*(f[44][l]+f[43][l])+0.6846531968814573*f[5][l])*alpha_vdim[603][l]+(0.2794502844414113*f[158][l]+0.4374088826398531*(f[71][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[572][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[546][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[545][l]+(0.3499271061118826*f[160][l]+0.5477225575051661*f[72][l]+0.3912303982179757*f[69][l]+0.6123724356957944*f[12][l])*alpha_vdim[543][l]+(0.3499271061118826*f[159][l]+0.5477225575051661*f[73][l]+0.3912303982179757*f[68][l]+0.6123724356957944*f[13][l])*alpha_vdim[542][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[524][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[523][l]+(0.3912303982179757*f[206][l]+0.6123724356957944*f[130][l]+0.4374088826398531*f[129][l]+0.6846531968814573*f[43][l])*alpha_vdim[520][l]+(0.3912303982179757*f[206][l]+0.6123724356957944*f[131][l]+0.4374088826398531*f[129][l]+0.6846531968814573*f[44][l])*alpha_vdim[519][l]+(0.3912303982179757*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[518][l]+(0.3912303982179757*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[517][l]+0.5477225575051661*f[96][l]*alpha_vdim[508][l]+(0.4898979485566357*f[103][l]+0.5477225575051661*f[25][l])*alpha_vdim[507][l]+(0.4374088826398531*f[158][l]+0.6846531968814573*f[70][l])*alpha_vdim[503][l]+(0.4374088826398531*f[158][l]+0.6846531968814573*f[71][l])*alpha_vdim[502][l]+0.6123724356957944*(f[147][l]*alpha_vdim[496][l]+f[148][l]*alpha_vdim[495][l])+(0.5477225575051661*f[159][l]+0.6123724356957944*f[68][l])*alpha_vdim[494][l]+(0.5477225575051661*f[160][l]+0.6123724356957944*f[69][l])*alpha_vdim[493][l]+0.5477225575051661*f[52][l]*alpha_vdim[492][l]+0.6846531968814573*f[192][l]*alpha_vdim[490][l]+(0.6123724356957944*f[206][l]+0.6846531968814573*f[129][l])*alpha_vdim[489][l]+0.6123724356957944*(f[101][l]*alpha_vdim[488][l]+f[102][l]*alpha_vdim[487][l])+0.6846531968814573*(f[158][l]*alpha_vdim[486][l]+f[198][l]*alpha_cdim[247][l]+f[170][l]*alpha_cdim[243][l])+(0.1249739664685295*alpha_vdim[120][l]+0.1956151991089878*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])*f[213][l]+0.6123724356957944*alpha_cdim[3][l]*f[212][l]+(0.1249739664685295*alpha_vdim[86][l]+0.1956151991089878*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[186][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[174][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[173][l]+0.6846531968814573*alpha_cdim[0][l]*f[171][l]+(0.1956151991089878*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[37][l])*f[142][l]+(0.1956151991089878*alpha_vdim[120][l]+0.3061862178478971*alpha_vdim[38][l])*f[141][l]+(0.1749635530559412*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[136][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[135][l]+(0.1117801137765645*alpha_vdim[129][l]+0.1749635530559412*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.273861278752583*alpha_vdim[5][l])*f[129][l]+(0.1749635530559412*(f[44][l]+f[43][l])+0.273861278752583*f[5][l])*alpha_vdim[129][l]+0.3061862178478971*f[50][l]*alpha_vdim[120][l]+0.2449489742783178*alpha_vdim[22][l]*f[114][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[93][l]+0.1956151991089878*alpha_vdim[86][l]*f[92][l]+0.3061862178478971*(alpha_vdim[17][l]*f[92][l]+f[20][l]*alpha_vdim[86][l])+0.273861278752583*(alpha_vdim[59][l]*f[84][l]+alpha_vdim[60][l]*f[83][l])+0.2449489742783178*alpha_vdim[6][l]*f[80][l]+0.1564921592871903*alpha_vdim[69][l]*f[69][l]+0.2449489742783178*(alpha_vdim[12][l]*f[69][l]+f[12][l]*alpha_vdim[69][l])+0.1564921592871903*alpha_vdim[68][l]*f[68][l]+0.2449489742783178*(alpha_vdim[13][l]*f[68][l]+f[13][l]*alpha_vdim[68][l])+0.273861278752583*(alpha_vdim[31][l]*f[48][l]+alpha_vdim[32][l]*f[47][l]+alpha_vdim[43][l]*f[44][l]+f[43][l]*alpha_vdim[44][l])+0.2190890230020664*alpha_vdim[25][l]*f[25][l];
+    out[211][l] += (0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[606][l]+(0.3499271061118826*f[101][l]+0.5477225575051661*f[27][l])*alpha_vdim[603][l]+(0.3912303982179757*f[159][l]+0.6123724356957944*f[73][l])*alpha_vdim[572][l]+0.5477225575051661*f[149][l]*alpha_vdim[546][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l]+0.4374088826398531*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[545][l]+0.4898979485566357*f[52][l]*alpha_vdim[543][l]+(0.3499271061118826*f[158][l]+0.5477225575051661*f[71][l]+0.3912303982179757*f[70][l])*alpha_vdim[542][l]+0.6123724356957944*(f[14][l]*alpha_vdim[542][l]+f[193][l]*alpha_vdim[524][l])+(0.4374088826398531*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[523][l]+0.5477225575051661*f[101][l]*alpha_vdim[520][l]+(0.3912303982179757*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[519][l]+0.5477225575051661*f[103][l]*alpha_vdim[518][l]+(0.3912303982179757*f[206][l]+0.6123724356957944*f[131][l]+0.4374088826398531*f[130][l]+0.6846531968814573*f[45][l])*alpha_vdim[517][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[508][l]+(0.4898979485566357*f[102][l]+0.5477225575051661*f[26][l])*alpha_vdim[507][l]+0.6123724356957944*f[159][l]*alpha_vdim[503][l]+(0.4374088826398531*f[159][l]+0.6846531968814573*f[73][l])*alpha_vdim[502][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[496][l]+0.6123724356957944*f[149][l]*alpha_vdim[495][l]+(0.5477225575051661*f[158][l]+0.6123724356957944*f[70][l])*alpha_vdim[494][l]+0.5477225575051661*f[52][l]*alpha_vdim[493][l]+(0.5477225575051661*f[160][l]+0.6123724356957944*f[72][l])*alpha_vdim[492][l]+0.6846531968814573*f[193][l]*alpha_vdim[490][l]+0.6123724356957944*f[101][l]*alpha_vdim[489][l]+(0.6123724356957944*f[206][l]+0.6846531968814573*f[130][l])*alpha_vdim[488][l]+0.6123724356957944*f[103][l]*alpha_vdim[487][l]+0.6846531968814573*f[159][l]*alpha_vdim[486][l]+0.3061862178478971*(f[214][l]*alpha_cdim[247][l]+f[187][l]*alpha_cdim[243][l])+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[226][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[210][l]+0.5477225575051661*alpha_vdim[22][l]*f[199][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l]+0.4374088826398531*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[198][l]+alpha_vdim[59][l]*(0.6123724356957944*f[176][l]+0.4374088826398531*f[175][l])+0.6846531968814573*(alpha_vdim[10][l]*f[175][l]+alpha_cdim[0][l]*f[172][l])+0.5477225575051661*alpha_vdim[6][l]*f[171][l]+(0.3912303982179757*alpha_vdim[86][l]+0.6123724356957944*alpha_vdim[17][l]+0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[170][l]+0.3499271061118826*alpha_vdim[68][l]*f[158][l]+0.5477225575051661*(alpha_vdim[13][l]*f[158][l]+alpha_vdim[60][l]*f[151][l])+0.6123724356957944*(alpha_vdim[9][l]*f[151][l]+alpha_vdim[31][l]*f[138][l])+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[137][l]+(0.3499271061118826*f[101][l]+0.5477225575051661*f[27][l])*alpha_vdim[129][l]+f[116][l]*(0.6123724356957944*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[22][l]*f[115][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[113][l]+0.4898979485566357*alpha_vdim[25][l]*f[102][l]+(0.5477225575051661*alpha_vdim[44][l]+0.3912303982179757*alpha_vdim[43][l])*f[101][l]+0.6123724356957944*(alpha_vdim[5][l]*f[101][l]+f[82][l]*alpha_vdim[86][l])+0.6846531968814573*(alpha_vdim[59][l]*f[85][l]+alpha_vdim[16][l]*f[82][l])+0.6123724356957944*alpha_vdim[6][l]*f[81][l]+0.5477225575051661*alpha_vdim[68][l]*f[71][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[70][l]+0.4898979485566357*f[52][l]*alpha_vdim[69][l]+0.6123724356957944*f[14][l]*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[12][l]*f[52][l]+0.6846531968814573*alpha_vdim[31][l]*f[49][l]+0.6123724356957944*f[27][l]*alpha_vdim[43][l]+0.5477225575051661*alpha_vdim[25][l]*f[26][l];
+    out[212][l] += (0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[606][l]+(0.3499271061118826*f[102][l]+0.5477225575051661*f[26][l])*alpha_vdim[603][l]+(0.3912303982179757*f[160][l]+0.6123724356957944*f[72][l])*alpha_vdim[572][l]+(0.3912303982179757*f[222][l]+0.4374088826398531*f[163][l]+0.6123724356957944*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[546][l]+0.5477225575051661*f[149][l]*alpha_vdim[545][l]+(0.3499271061118826*f[158][l]+0.3912303982179757*f[71][l]+0.5477225575051661*f[70][l]+0.6123724356957944*f[14][l])*alpha_vdim[543][l]+0.4898979485566357*f[52][l]*alpha_vdim[542][l]+(0.4374088826398531*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[524][l]+0.6123724356957944*f[194][l]*alpha_vdim[523][l]+(0.3912303982179757*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[520][l]+0.5477225575051661*f[102][l]*alpha_vdim[519][l]+(0.3912303982179757*f[206][l]+0.4374088826398531*f[131][l]+0.6123724356957944*f[130][l]+0.6846531968814573*f[45][l])*alpha_vdim[518][l]+0.5477225575051661*f[103][l]*alpha_vdim[517][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[508][l]+(0.4898979485566357*f[101][l]+0.5477225575051661*f[27][l])*alpha_vdim[507][l]+(0.4374088826398531*f[160][l]+0.6846531968814573*f[72][l])*alpha_vdim[503][l]+0.6123724356957944*(f[160][l]*alpha_vdim[502][l]+f[149][l]*alpha_vdim[496][l])+(0.6123724356957944*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[495][l]+0.5477225575051661*f[52][l]*alpha_vdim[494][l]+(0.5477225575051661*f[158][l]+0.6123724356957944*f[71][l])*alpha_vdim[493][l]+(0.5477225575051661*f[159][l]+0.6123724356957944*f[73][l])*alpha_vdim[492][l]+0.6846531968814573*f[194][l]*alpha_vdim[490][l]+0.6123724356957944*(f[102][l]*alpha_vdim[489][l]+f[103][l]*alpha_vdim[488][l]+f[206][l]*alpha_vdim[487][l])+0.6846531968814573*(f[131][l]*alpha_vdim[487][l]+f[160][l]*alpha_vdim[486][l]+f[200][l]*alpha_cdim[247][l]+f[172][l]*alpha_cdim[243][l])+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[226][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[210][l]+(0.3912303982179757*alpha_vdim[120][l]+0.4374088826398531*alpha_vdim[38][l]+0.6123724356957944*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[199][l]+0.5477225575051661*alpha_vdim[22][l]*f[198][l]+0.3061862178478971*alpha_cdim[0][l]*f[188][l]+(0.4374088826398531*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[176][l]+0.6123724356957944*alpha_vdim[60][l]*f[175][l]+(0.3912303982179757*alpha_vdim[86][l]+0.4374088826398531*alpha_vdim[17][l]+0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[171][l]+0.5477225575051661*alpha_vdim[6][l]*f[170][l]+(0.3499271061118826*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[158][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[151][l]+(0.4374088826398531*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[138][l]+0.6123724356957944*alpha_vdim[32][l]*f[137][l]+(0.3499271061118826*f[102][l]+0.5477225575051661*f[26][l])*alpha_vdim[129][l]+0.6123724356957944*(f[115][l]*alpha_vdim[120][l]+alpha_vdim[22][l]*f[116][l])+0.6846531968814573*alpha_vdim[38][l]*f[115][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[113][l]+(0.3912303982179757*alpha_vdim[44][l]+0.5477225575051661*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[102][l]+0.4898979485566357*alpha_vdim[25][l]*f[101][l]+0.6123724356957944*f[81][l]*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[60][l]*f[85][l]+0.6123724356957944*alpha_vdim[6][l]*f[82][l]+0.6846531968814573*alpha_vdim[17][l]*f[81][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[71][l]+alpha_vdim[69][l]*(0.5477225575051661*f[70][l]+0.6123724356957944*f[14][l])+f[52][l]*(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])+0.6846531968814573*alpha_vdim[32][l]*f[49][l]+0.6123724356957944*f[26][l]*alpha_vdim[44][l]+0.5477225575051661*alpha_vdim[25][l]*f[27][l];
+    out[213][l] += (0.249947932937059*f[207][l]+0.3912303982179757*(f[133][l]+f[132][l])+0.2794502844414113*f[129][l]+0.6123724356957944*f[46][l]+0.4374088826398531*(f[44][l]+f[43][l])+0.6846531968814573*f[5][l])*alpha_vdim[606][l]+(0.2794502844414113*f[192][l]+0.4374088826398531*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[603][l]+(0.2794502844414113*f[161][l]+0.4374088826398531*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[572][l]+(0.3499271061118826*f[165][l]+0.5477225575051661*f[77][l]+0.3912303982179757*f[69][l]+0.6123724356957944*f[12][l])*alpha_vdim[546][l]+(0.3499271061118826*f[164][l]+0.5477225575051661*f[78][l]+0.3912303982179757*f[68][l]+0.6123724356957944*f[13][l])*alpha_vdim[545][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[543][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[542][l]+(0.3912303982179757*f[207][l]+0.6123724356957944*f[132][l]+0.4374088826398531*f[129][l]+0.6846531968814573*f[43][l])*alpha_vdim[524][l]+(0.3912303982179757*f[207][l]+0.6123724356957944*f[133][l]+0.4374088826398531*f[129][l]+0.6846531968814573*f[44][l])*alpha_vdim[523][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[520][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[519][l]+(0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[518][l]+(0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[517][l]+0.4898979485566357*f[110][l]*alpha_vdim[508][l]+0.5477225575051661*(f[25][l]*alpha_vdim[508][l]+f[96][l]*alpha_vdim[507][l])+(0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[503][l]+(0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[502][l]+(0.5477225575051661*f[164][l]+0.6123724356957944*f[68][l])*alpha_vdim[496][l]+0.5477225575051661*f[165][l]*alpha_vdim[495][l]+0.6123724356957944*(f[69][l]*alpha_vdim[495][l]+f[147][l]*alpha_vdim[494][l]+f[148][l]*alpha_vdim[493][l])+0.5477225575051661*f[53][l]*alpha_vdim[492][l]+0.6123724356957944*f[207][l]*alpha_vdim[490][l]+0.6846531968814573*(f[129][l]*alpha_vdim[490][l]+f[192][l]*alpha_vdim[489][l])+0.6123724356957944*(f[104][l]*alpha_vdim[488][l]+f[105][l]*alpha_vdim[487][l])+0.6846531968814573*f[161][l]*alpha_vdim[486][l]+(0.1117801137765645*f[129][l]+0.1749635530559412*(f[44][l]+f[43][l])+0.273861278752583*f[5][l])*alpha_vdim[372][l]+(0.1249739664685295*f[210][l]+0.1956151991089878*(f[138][l]+f[137][l])+0.3061862178478971*f[49][l])*alpha_vdim[360][l]+(0.1249739664685295*f[186][l]+0.1956151991089878*(f[93][l]+f[92][l])+0.3061862178478971*f[20][l])*alpha_vdim[329][l]+(0.1564921592871903*f[69][l]+0.2449489742783178*f[12][l])*alpha_vdim[312][l]+(0.1564921592871903*f[68][l]+0.2449489742783178*f[13][l])*alpha_vdim[311][l]+(0.1749635530559412*f[171][l]+0.273861278752583*f[81][l])*alpha_vdim[300][l]+(0.1749635530559412*f[170][l]+0.273861278752583*f[82][l])*alpha_vdim[299][l]+(0.1749635530559412*f[129][l]+0.273861278752583*f[43][l])*alpha_vdim[287][l]+(0.1749635530559412*f[129][l]+0.273861278752583*f[44][l])*alpha_vdim[286][l]+(0.1956151991089878*f[210][l]+0.3061862178478971*f[137][l])*alpha_vdim[277][l]+(0.1956151991089878*f[210][l]+0.3061862178478971*f[138][l])*alpha_vdim[276][l]+(0.1749635530559412*f[136][l]+0.273861278752583*f[47][l])*alpha_vdim[275][l]+(0.1749635530559412*f[135][l]+0.273861278752583*f[48][l])*alpha_vdim[274][l]+0.2190890230020664*f[25][l]*alpha_vdim[268][l]+0.2449489742783178*f[113][l]*alpha_vdim[264][l]+(0.1956151991089878*f[186][l]+0.3061862178478971*f[92][l])*alpha_vdim[260][l]+(0.1956151991089878*f[186][l]+0.3061862178478971*f[93][l])*alpha_vdim[259][l]+0.2449489742783178*(f[68][l]*alpha_vdim[256][l]+f[69][l]*alpha_vdim[255][l])+0.273861278752583*(f[170][l]*alpha_vdim[251][l]+f[171][l]*alpha_vdim[250][l])+0.2449489742783178*f[80][l]*alpha_vdim[249][l]+0.273861278752583*f[129][l]*alpha_vdim[248][l]+(0.6123724356957944*f[216][l]+0.6846531968814573*f[135][l])*alpha_cdim[247][l]+0.3061862178478971*f[210][l]*alpha_vdim[246][l]+0.273861278752583*(f[135][l]*alpha_vdim[245][l]+f[136][l]*alpha_vdim[244][l])+0.3061862178478971*f[186][l]*alpha_vdim[243][l]+0.6846531968814573*(f[173][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[199][l]+alpha_cdim[0][l]*f[174][l]);
+    out[214][l] += (0.3912303982179757*f[237][l]+0.6123724356957944*f[209][l]+0.4374088826398531*f[206][l]+0.6846531968814573*f[131][l])*alpha_vdim[606][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[603][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[572][l]+(0.5477225575051661*f[225][l]+0.6123724356957944*f[160][l])*alpha_vdim[546][l]+(0.3912303982179757*f[224][l]+0.6123724356957944*f[169][l]+0.4374088826398531*f[159][l]+0.6846531968814573*f[73][l])*alpha_vdim[545][l]+0.5477225575051661*f[148][l]*alpha_vdim[543][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[542][l]+(0.6123724356957944*f[237][l]+0.6846531968814573*f[206][l])*alpha_vdim[524][l]+(0.3912303982179757*f[208][l]+0.6123724356957944*f[134][l]+0.4374088826398531*f[130][l]+0.6846531968814573*f[45][l])*alpha_vdim[523][l]+0.6123724356957944*f[192][l]*alpha_vdim[520][l]+0.3912303982179757*f[106][l]*alpha_vdim[519][l]+0.6123724356957944*(f[30][l]*alpha_vdim[519][l]+f[194][l]*alpha_vdim[518][l])+(0.4374088826398531*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[517][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[103][l])*alpha_vdim[508][l]+0.5477225575051661*f[96][l]*alpha_vdim[507][l]+0.6846531968814573*f[222][l]*alpha_vdim[503][l]+(0.4374088826398531*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[502][l]+(0.6123724356957944*f[224][l]+0.6846531968814573*f[159][l])*alpha_vdim[496][l]+0.5477225575051661*f[168][l]*alpha_vdim[495][l]+0.6123724356957944*(f[72][l]*alpha_vdim[495][l]+f[147][l]*alpha_vdim[494][l])+0.5477225575051661*f[54][l]*alpha_vdim[493][l]+0.6123724356957944*f[149][l]*alpha_vdim[492][l]+(0.6123724356957944*f[208][l]+0.6846531968814573*f[130][l])*alpha_vdim[490][l]+0.6123724356957944*f[106][l]*alpha_vdim[489][l]+0.6846531968814573*f[193][l]*alpha_vdim[488][l]+0.6123724356957944*f[108][l]*alpha_vdim[487][l]+0.6846531968814573*f[162][l]*alpha_vdim[486][l]+(0.1749635530559412*f[206][l]+0.273861278752583*f[131][l])*alpha_vdim[372][l]+(0.1749635530559412*f[210][l]+0.273861278752583*f[138][l])*alpha_vdim[360][l]+(0.1956151991089878*f[233][l]+0.3061862178478971*f[188][l])*alpha_vdim[329][l]+0.2449489742783178*f[160][l]*alpha_vdim[312][l]+(0.1749635530559412*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[311][l]+0.2449489742783178*f[171][l]*alpha_vdim[300][l]+0.1749635530559412*f[170][l]*alpha_vdim[299][l]+0.273861278752583*(f[82][l]*alpha_vdim[299][l]+f[206][l]*alpha_vdim[287][l])+0.1749635530559412*f[130][l]*alpha_vdim[286][l]+0.273861278752583*(f[45][l]*alpha_vdim[286][l]+f[210][l]*alpha_vdim[277][l])+0.1749635530559412*f[137][l]*alpha_vdim[276][l]+0.273861278752583*(f[49][l]*alpha_vdim[276][l]+f[212][l]*alpha_vdim[275][l])+(0.1956151991089878*f[211][l]+0.3061862178478971*f[140][l])*alpha_vdim[274][l]+0.2449489742783178*(f[103][l]*alpha_vdim[268][l]+f[113][l]*alpha_vdim[264][l])+0.3061862178478971*f[233][l]*alpha_vdim[260][l]+(0.1956151991089878*f[187][l]+0.3061862178478971*f[94][l])*alpha_vdim[259][l]+0.273861278752583*f[159][l]*alpha_vdim[256][l]+0.2449489742783178*f[72][l]*alpha_vdim[255][l]+0.273861278752583*f[170][l]*alpha_vdim[251][l]+0.2449489742783178*f[81][l]*alpha_vdim[250][l]+0.273861278752583*(f[172][l]*alpha_vdim[249][l]+f[130][l]*alpha_vdim[248][l]+f[137][l]*alpha_vdim[246][l])+0.3061862178478971*f[211][l]*alpha_vdim[245][l]+0.273861278752583*f[139][l]*alpha_vdim[244][l]+0.3061862178478971*f[187][l]*alpha_vdim[243][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[239][l]+0.5477225575051661*alpha_vdim[60][l]*f[230][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[229][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[226][l]+0.6123724356957944*alpha_vdim[120][l]*f[219][l]+(0.3912303982179757*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[218][l]+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[38][l])*f[210][l]+0.5477225575051661*alpha_vdim[22][l]*f[201][l]+0.6123724356957944*alpha_vdim[32][l]*f[199][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[198][l]+0.3912303982179757*alpha_vdim[129][l]*f[192][l]+0.6123724356957944*(alpha_vdim[44][l]*f[192][l]+alpha_vdim[59][l]*f[181][l])+0.5477225575051661*alpha_vdim[9][l]*f[180][l]+0.6846531968814573*(alpha_cdim[0][l]*f[177][l]+alpha_vdim[86][l]*f[176][l])+(0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[175][l]+0.6123724356957944*alpha_vdim[60][l]*f[171][l]+(0.4374088826398531*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[10][l])*f[170][l]+0.6123724356957944*alpha_vdim[6][l]*f[151][l]+0.5477225575051661*alpha_vdim[69][l]*f[148][l]+0.3912303982179757*alpha_vdim[68][l]*f[147][l]+0.6123724356957944*(alpha_vdim[13][l]*f[147][l]+alpha_vdim[37][l]*f[146][l])+0.6846531968814573*alpha_vdim[120][l]*f[138][l]+(0.4374088826398531*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[137][l]+0.6123724356957944*f[107][l]*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[31][l]*f[116][l]+0.6123724356957944*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[115][l]+alpha_vdim[22][l]*f[113][l])+(0.3912303982179757*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[106][l]+0.5477225575051661*alpha_vdim[25][l]*f[96][l]+0.6846531968814573*(alpha_vdim[16][l]*f[85][l]+alpha_vdim[59][l]*f[82][l])+0.6123724356957944*(alpha_vdim[9][l]*f[81][l]+f[55][l]*alpha_vdim[68][l])+0.5477225575051661*alpha_vdim[12][l]*f[54][l]+0.6846531968814573*alpha_vdim[37][l]*f[49][l]+0.6123724356957944*f[30][l]*alpha_vdim[43][l];
+    out[215][l] += (0.3912303982179757*f[237][l]+0.6123724356957944*f[208][l]+0.4374088826398531*f[206][l]+0.6846531968814573*f[130][l])*alpha_vdim[606][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[603][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[572][l]+(0.3912303982179757*f[225][l]+0.6123724356957944*f[168][l]+0.4374088826398531*f[160][l]+0.6846531968814573*f[72][l])*alpha_vdim[546][l]+(0.5477225575051661*f[224][l]+0.6123724356957944*f[159][l])*alpha_vdim[545][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[543][l]+0.5477225575051661*f[147][l]*alpha_vdim[542][l]+(0.3912303982179757*f[209][l]+0.6123724356957944*f[134][l]+0.4374088826398531*f[131][l]+0.6846531968814573*f[45][l])*alpha_vdim[524][l]+(0.6123724356957944*f[237][l]+0.6846531968814573*f[206][l])*alpha_vdim[523][l]+0.3912303982179757*f[107][l]*alpha_vdim[520][l]+0.6123724356957944*(f[30][l]*alpha_vdim[520][l]+f[192][l]*alpha_vdim[519][l])+(0.4374088826398531*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[518][l]+0.6123724356957944*f[193][l]*alpha_vdim[517][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[103][l])*alpha_vdim[508][l]+0.5477225575051661*f[96][l]*alpha_vdim[507][l]+0.4374088826398531*f[163][l]*alpha_vdim[503][l]+0.6846531968814573*(f[76][l]*alpha_vdim[503][l]+f[222][l]*alpha_vdim[502][l])+(0.5477225575051661*f[169][l]+0.6123724356957944*f[73][l])*alpha_vdim[496][l]+(0.6123724356957944*f[225][l]+0.6846531968814573*f[160][l])*alpha_vdim[495][l]+0.5477225575051661*f[55][l]*alpha_vdim[494][l]+0.6123724356957944*(f[148][l]*alpha_vdim[493][l]+f[149][l]*alpha_vdim[492][l])+(0.6123724356957944*f[209][l]+0.6846531968814573*f[131][l])*alpha_vdim[490][l]+0.6123724356957944*(f[107][l]*alpha_vdim[489][l]+f[109][l]*alpha_vdim[488][l])+0.6846531968814573*(f[194][l]*alpha_vdim[487][l]+f[163][l]*alpha_vdim[486][l])+(0.1749635530559412*f[206][l]+0.273861278752583*f[130][l])*alpha_vdim[372][l]+(0.1749635530559412*f[210][l]+0.273861278752583*f[137][l])*alpha_vdim[360][l]+(0.1956151991089878*f[233][l]+0.3061862178478971*f[187][l])*alpha_vdim[329][l]+(0.1749635530559412*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[312][l]+0.2449489742783178*f[159][l]*alpha_vdim[311][l]+(0.1749635530559412*f[171][l]+0.273861278752583*f[81][l])*alpha_vdim[300][l]+0.2449489742783178*f[170][l]*alpha_vdim[299][l]+0.1749635530559412*f[131][l]*alpha_vdim[287][l]+0.273861278752583*(f[45][l]*alpha_vdim[287][l]+f[206][l]*alpha_vdim[286][l])+0.1749635530559412*f[138][l]*alpha_vdim[277][l]+0.273861278752583*(f[49][l]*alpha_vdim[277][l]+f[210][l]*alpha_vdim[276][l])+(0.1956151991089878*f[212][l]+0.3061862178478971*f[139][l])*alpha_vdim[275][l]+0.273861278752583*f[211][l]*alpha_vdim[274][l]+0.2449489742783178*(f[103][l]*alpha_vdim[268][l]+f[113][l]*alpha_vdim[264][l])+0.1956151991089878*f[188][l]*alpha_vdim[260][l]+0.3061862178478971*(f[94][l]*alpha_vdim[260][l]+f[233][l]*alpha_vdim[259][l])+0.2449489742783178*f[73][l]*alpha_vdim[256][l]+0.273861278752583*f[160][l]*alpha_vdim[255][l]+0.2449489742783178*f[82][l]*alpha_vdim[251][l]+0.273861278752583*(f[171][l]*alpha_vdim[250][l]+f[172][l]*alpha_vdim[249][l]+f[131][l]*alpha_vdim[248][l])+(0.6123724356957944*f[221][l]+0.6846531968814573*f[140][l])*alpha_cdim[247][l]+0.273861278752583*(f[138][l]*alpha_vdim[246][l]+f[140][l]*alpha_vdim[245][l])+0.3061862178478971*(f[212][l]*alpha_vdim[244][l]+f[188][l]*alpha_vdim[243][l])+0.6846531968814573*f[178][l]*alpha_cdim[243][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])*f[239][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[230][l]+0.5477225575051661*alpha_vdim[59][l]*f[229][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[226][l]+0.3912303982179757*alpha_vdim[38][l]*f[219][l]+0.6123724356957944*(alpha_vdim[4][l]*f[219][l]+alpha_vdim[120][l]*f[218][l])+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[37][l])*f[210][l]+0.5477225575051661*alpha_vdim[22][l]*f[201][l]+(0.4374088826398531*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[199][l]+0.6123724356957944*alpha_vdim[31][l]*f[198][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[43][l])*f[192][l]+0.5477225575051661*alpha_vdim[10][l]*f[181][l]+0.6123724356957944*alpha_vdim[60][l]*f[180][l]+0.4374088826398531*alpha_vdim[17][l]*f[176][l]+0.6846531968814573*(alpha_vdim[0][l]*f[176][l]+alpha_vdim[86][l]*f[175][l])+(0.4374088826398531*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[171][l]+0.6123724356957944*(alpha_vdim[59][l]*f[170][l]+alpha_vdim[6][l]*f[151][l])+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[148][l]+0.5477225575051661*alpha_vdim[68][l]*f[147][l]+alpha_vdim[38][l]*(0.6123724356957944*f[146][l]+0.4374088826398531*f[138][l])+0.6846531968814573*(alpha_vdim[4][l]*f[138][l]+alpha_vdim[120][l]*f[137][l])+0.6123724356957944*(f[106][l]*alpha_vdim[129][l]+alpha_vdim[2][l]*f[116][l])+0.6846531968814573*alpha_vdim[32][l]*f[115][l]+0.6123724356957944*alpha_vdim[22][l]*f[113][l]+(0.3912303982179757*alpha_vdim[44][l]+0.6123724356957944*alpha_vdim[5][l])*f[107][l]+0.5477225575051661*alpha_vdim[25][l]*f[96][l]+0.6846531968814573*alpha_vdim[17][l]*f[85][l]+0.6123724356957944*alpha_vdim[10][l]*f[82][l]+0.6846531968814573*alpha_vdim[60][l]*f[81][l]+0.6123724356957944*f[54][l]*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[13][l]*f[55][l]+0.6846531968814573*alpha_vdim[38][l]*f[49][l]+0.6123724356957944*f[30][l]*alpha_vdim[44][l];
+    out[216][l] += (0.3499271061118826*f[104][l]+0.5477225575051661*f[29][l])*alpha_vdim[606][l]+(0.3912303982179757*f[195][l]+0.6123724356957944*f[112][l])*alpha_vdim[603][l]+(0.3912303982179757*f[164][l]+0.6123724356957944*f[78][l])*alpha_vdim[572][l]+0.4898979485566357*f[53][l]*alpha_vdim[546][l]+(0.3499271061118826*f[161][l]+0.5477225575051661*f[75][l]+0.3912303982179757*f[74][l]+0.6123724356957944*f[15][l])*alpha_vdim[545][l]+0.5477225575051661*f[150][l]*alpha_vdim[543][l]+(0.3912303982179757*f[223][l]+0.6123724356957944*f[167][l]+0.4374088826398531*f[166][l]+0.6846531968814573*f[79][l])*alpha_vdim[542][l]+f[104][l]*(0.5477225575051661*alpha_vdim[524][l]+0.3912303982179757*alpha_vdim[523][l])+0.6123724356957944*(f[29][l]*alpha_vdim[523][l]+f[195][l]*alpha_vdim[520][l])+(0.4374088826398531*f[195][l]+0.6846531968814573*f[112][l])*alpha_vdim[519][l]+0.5477225575051661*f[110][l]*alpha_vdim[518][l]+(0.3912303982179757*f[207][l]+0.6123724356957944*f[133][l]+0.4374088826398531*f[132][l]+0.6846531968814573*f[46][l])*alpha_vdim[517][l]+0.4898979485566357*f[105][l]*alpha_vdim[508][l]+0.5477225575051661*(f[28][l]*alpha_vdim[508][l]+f[196][l]*alpha_vdim[507][l])+0.6123724356957944*(f[111][l]*alpha_vdim[507][l]+f[164][l]*alpha_vdim[503][l])+(0.4374088826398531*f[164][l]+0.6846531968814573*f[78][l])*alpha_vdim[502][l]+(0.5477225575051661*f[161][l]+0.6123724356957944*f[74][l])*alpha_vdim[496][l]+0.5477225575051661*f[53][l]*alpha_vdim[495][l]+(0.6123724356957944*f[223][l]+0.6846531968814573*f[166][l])*alpha_vdim[494][l]+0.6123724356957944*f[150][l]*alpha_vdim[493][l]+0.5477225575051661*f[165][l]*alpha_vdim[492][l]+0.6123724356957944*(f[77][l]*alpha_vdim[492][l]+f[104][l]*alpha_vdim[490][l])+0.6846531968814573*f[195][l]*alpha_vdim[489][l]+(0.6123724356957944*f[207][l]+0.6846531968814573*f[132][l])*alpha_vdim[488][l]+0.6123724356957944*f[110][l]*alpha_vdim[487][l]+0.6846531968814573*f[164][l]*alpha_vdim[486][l]+(0.3499271061118826*f[104][l]+0.5477225575051661*f[29][l])*alpha_vdim[372][l]+(0.3912303982179757*f[198][l]+0.6123724356957944*f[116][l])*alpha_vdim[360][l]+(0.3912303982179757*f[173][l]+0.6123724356957944*f[84][l])*alpha_vdim[329][l]+0.4898979485566357*f[53][l]*alpha_vdim[312][l]+(0.3499271061118826*f[161][l]+0.5477225575051661*f[75][l]+0.3912303982179757*f[74][l]+0.6123724356957944*f[15][l])*alpha_vdim[311][l]+0.5477225575051661*f[151][l]*alpha_vdim[300][l]+(0.3912303982179757*f[226][l]+0.6123724356957944*f[176][l]+0.4374088826398531*f[175][l]+0.6846531968814573*f[85][l])*alpha_vdim[299][l]+f[104][l]*(0.5477225575051661*alpha_vdim[287][l]+0.3912303982179757*alpha_vdim[286][l])+0.6123724356957944*(f[29][l]*alpha_vdim[286][l]+f[198][l]*alpha_vdim[277][l])+(0.4374088826398531*f[198][l]+0.6846531968814573*f[116][l])*alpha_vdim[276][l]+0.5477225575051661*f[114][l]*alpha_vdim[275][l]+(0.3912303982179757*f[213][l]+0.6123724356957944*f[142][l]+0.4374088826398531*f[141][l]+0.6846531968814573*f[50][l])*alpha_vdim[274][l]+0.4898979485566357*f[105][l]*alpha_vdim[268][l]+0.5477225575051661*(f[28][l]*alpha_vdim[268][l]+f[199][l]*alpha_vdim[264][l])+0.6123724356957944*(f[115][l]*alpha_vdim[264][l]+f[173][l]*alpha_vdim[260][l])+(0.4374088826398531*f[173][l]+0.6846531968814573*f[84][l])*alpha_vdim[259][l]+(0.5477225575051661*f[161][l]+0.6123724356957944*f[74][l])*alpha_vdim[256][l]+0.5477225575051661*f[53][l]*alpha_vdim[255][l]+(0.6123724356957944*f[226][l]+0.6846531968814573*f[175][l])*alpha_vdim[251][l]+0.6123724356957944*f[151][l]*alpha_vdim[250][l]+0.5477225575051661*f[174][l]*alpha_vdim[249][l]+0.6123724356957944*(f[83][l]*alpha_vdim[249][l]+f[104][l]*alpha_vdim[248][l])+0.273861278752583*f[141][l]*alpha_cdim[247][l]+0.6846531968814573*f[198][l]*alpha_vdim[246][l]+(0.6123724356957944*f[213][l]+0.6846531968814573*f[141][l])*alpha_vdim[245][l]+0.6123724356957944*f[114][l]*alpha_vdim[244][l]+0.6846531968814573*f[173][l]*alpha_vdim[243][l]+0.3061862178478971*f[189][l]*alpha_cdim[243][l]+0.6846531968814573*(alpha_cdim[3][l]*f[201][l]+alpha_cdim[0][l]*f[179][l]);
+    out[217][l] += (0.3499271061118826*f[105][l]+0.5477225575051661*f[28][l])*alpha_vdim[606][l]+(0.3912303982179757*f[196][l]+0.6123724356957944*f[111][l])*alpha_vdim[603][l]+(0.3912303982179757*f[165][l]+0.6123724356957944*f[77][l])*alpha_vdim[572][l]+(0.3499271061118826*f[161][l]+0.3912303982179757*f[75][l]+0.5477225575051661*f[74][l]+0.6123724356957944*f[15][l])*alpha_vdim[546][l]+0.4898979485566357*f[53][l]*alpha_vdim[545][l]+(0.3912303982179757*f[223][l]+0.4374088826398531*f[167][l]+0.6123724356957944*f[166][l]+0.6846531968814573*f[79][l])*alpha_vdim[543][l]+0.5477225575051661*f[150][l]*alpha_vdim[542][l]+(0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[524][l]+0.5477225575051661*f[105][l]*alpha_vdim[523][l]+(0.4374088826398531*f[196][l]+0.6846531968814573*f[111][l])*alpha_vdim[520][l]+0.6123724356957944*f[196][l]*alpha_vdim[519][l]+(0.3912303982179757*f[207][l]+0.4374088826398531*f[133][l]+0.6123724356957944*f[132][l]+0.6846531968814573*f[46][l])*alpha_vdim[518][l]+0.5477225575051661*f[110][l]*alpha_vdim[517][l]+(0.4898979485566357*f[104][l]+0.5477225575051661*f[29][l])*alpha_vdim[508][l]+(0.5477225575051661*f[195][l]+0.6123724356957944*f[112][l])*alpha_vdim[507][l]+(0.4374088826398531*f[165][l]+0.6846531968814573*f[77][l])*alpha_vdim[503][l]+0.6123724356957944*f[165][l]*alpha_vdim[502][l]+0.5477225575051661*(f[53][l]*alpha_vdim[496][l]+f[161][l]*alpha_vdim[495][l])+0.6123724356957944*(f[75][l]*alpha_vdim[495][l]+f[150][l]*alpha_vdim[494][l])+(0.6123724356957944*f[223][l]+0.6846531968814573*f[167][l])*alpha_vdim[493][l]+0.5477225575051661*f[164][l]*alpha_vdim[492][l]+0.6123724356957944*(f[78][l]*alpha_vdim[492][l]+f[105][l]*alpha_vdim[490][l])+0.6846531968814573*f[196][l]*alpha_vdim[489][l]+0.6123724356957944*(f[110][l]*alpha_vdim[488][l]+f[207][l]*alpha_vdim[487][l])+0.6846531968814573*(f[133][l]*alpha_vdim[487][l]+f[165][l]*alpha_vdim[486][l])+(0.3499271061118826*f[105][l]+0.5477225575051661*f[28][l])*alpha_vdim[372][l]+(0.3912303982179757*f[199][l]+0.6123724356957944*f[115][l])*alpha_vdim[360][l]+(0.3912303982179757*f[174][l]+0.6123724356957944*f[83][l])*alpha_vdim[329][l]+(0.3499271061118826*f[161][l]+0.3912303982179757*f[75][l]+0.5477225575051661*f[74][l]+0.6123724356957944*f[15][l])*alpha_vdim[312][l]+0.4898979485566357*f[53][l]*alpha_vdim[311][l]+(0.3912303982179757*f[226][l]+0.4374088826398531*f[176][l]+0.6123724356957944*f[175][l]+0.6846531968814573*f[85][l])*alpha_vdim[300][l]+0.5477225575051661*f[151][l]*alpha_vdim[299][l]+(0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[287][l]+0.5477225575051661*f[105][l]*alpha_vdim[286][l]+(0.4374088826398531*f[199][l]+0.6846531968814573*f[115][l])*alpha_vdim[277][l]+0.6123724356957944*f[199][l]*alpha_vdim[276][l]+(0.3912303982179757*f[213][l]+0.4374088826398531*f[142][l]+0.6123724356957944*f[141][l]+0.6846531968814573*f[50][l])*alpha_vdim[275][l]+0.5477225575051661*f[114][l]*alpha_vdim[274][l]+(0.4898979485566357*f[104][l]+0.5477225575051661*f[29][l])*alpha_vdim[268][l]+(0.5477225575051661*f[198][l]+0.6123724356957944*f[116][l])*alpha_vdim[264][l]+(0.4374088826398531*f[174][l]+0.6846531968814573*f[83][l])*alpha_vdim[260][l]+0.6123724356957944*f[174][l]*alpha_vdim[259][l]+0.5477225575051661*(f[53][l]*alpha_vdim[256][l]+f[161][l]*alpha_vdim[255][l])+0.6123724356957944*(f[75][l]*alpha_vdim[255][l]+f[151][l]*alpha_vdim[251][l])+(0.6123724356957944*f[226][l]+0.6846531968814573*f[176][l])*alpha_vdim[250][l]+0.5477225575051661*f[173][l]*alpha_vdim[249][l]+0.6123724356957944*(f[84][l]*alpha_vdim[249][l]+f[105][l]*alpha_vdim[248][l]+f[114][l]*alpha_cdim[247][l])+0.6846531968814573*f[199][l]*alpha_vdim[246][l]+0.6123724356957944*(f[114][l]*alpha_vdim[245][l]+f[213][l]*alpha_vdim[244][l])+0.6846531968814573*(f[142][l]*alpha_vdim[244][l]+f[174][l]*alpha_vdim[243][l]+f[179][l]*alpha_cdim[243][l])+0.3061862178478971*(alpha_cdim[3][l]*f[219][l]+alpha_cdim[0][l]*f[190][l]);
+    out[218][l] += (0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[606][l]+(0.3912303982179757*f[237][l]+0.6123724356957944*f[209][l]+0.4374088826398531*f[207][l]+0.6846531968814573*f[133][l])*alpha_vdim[603][l]+(0.4374088826398531*f[223][l]+0.6846531968814573*f[167][l])*alpha_vdim[572][l]+0.5477225575051661*f[148][l]*alpha_vdim[546][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[545][l]+(0.5477225575051661*f[225][l]+0.6123724356957944*f[165][l])*alpha_vdim[543][l]+(0.3912303982179757*f[224][l]+0.6123724356957944*f[169][l]+0.4374088826398531*f[164][l]+0.6846531968814573*f[78][l])*alpha_vdim[542][l]+0.6123724356957944*f[192][l]*alpha_vdim[524][l]+(0.3912303982179757*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[523][l]+(0.6123724356957944*f[237][l]+0.6846531968814573*f[207][l])*alpha_vdim[520][l]+(0.3912303982179757*f[208][l]+0.6123724356957944*f[134][l]+0.4374088826398531*f[132][l]+0.6846531968814573*f[46][l])*alpha_vdim[519][l]+0.6123724356957944*f[196][l]*alpha_vdim[518][l]+(0.4374088826398531*f[195][l]+0.6846531968814573*f[112][l])*alpha_vdim[517][l]+0.5477225575051661*f[96][l]*alpha_vdim[508][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[110][l])*alpha_vdim[507][l]+0.6846531968814573*f[223][l]*alpha_vdim[503][l]+(0.4374088826398531*f[166][l]+0.6846531968814573*f[79][l])*alpha_vdim[502][l]+0.6123724356957944*f[147][l]*alpha_vdim[496][l]+0.5477225575051661*f[54][l]*alpha_vdim[495][l]+(0.6123724356957944*f[224][l]+0.6846531968814573*f[164][l])*alpha_vdim[494][l]+0.5477225575051661*f[168][l]*alpha_vdim[493][l]+0.6123724356957944*(f[77][l]*alpha_vdim[493][l]+f[150][l]*alpha_vdim[492][l]+f[106][l]*alpha_vdim[490][l]+f[208][l]*alpha_vdim[489][l])+0.6846531968814573*(f[132][l]*alpha_vdim[489][l]+f[195][l]*alpha_vdim[488][l])+0.6123724356957944*f[111][l]*alpha_vdim[487][l]+0.6846531968814573*f[166][l]*alpha_vdim[486][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[372][l]+(0.3912303982179757*f[238][l]+0.6123724356957944*f[215][l]+0.4374088826398531*f[213][l]+0.6846531968814573*f[142][l])*alpha_vdim[360][l]+(0.4374088826398531*f[226][l]+0.6846531968814573*f[176][l])*alpha_vdim[329][l]+0.5477225575051661*f[148][l]*alpha_vdim[312][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[311][l]+(0.5477225575051661*f[228][l]+0.6123724356957944*f[174][l])*alpha_vdim[300][l]+(0.3912303982179757*f[227][l]+0.6123724356957944*f[178][l]+0.4374088826398531*f[173][l]+0.6846531968814573*f[84][l])*alpha_vdim[299][l]+0.6123724356957944*f[192][l]*alpha_vdim[287][l]+(0.3912303982179757*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[286][l]+(0.6123724356957944*f[238][l]+0.6846531968814573*f[213][l])*alpha_vdim[277][l]+(0.3912303982179757*f[214][l]+0.6123724356957944*f[143][l]+0.4374088826398531*f[141][l]+0.6846531968814573*f[50][l])*alpha_vdim[276][l]+0.6123724356957944*f[199][l]*alpha_vdim[275][l]+(0.4374088826398531*f[198][l]+0.6846531968814573*f[116][l])*alpha_vdim[274][l]+0.5477225575051661*f[96][l]*alpha_vdim[268][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[114][l])*alpha_vdim[264][l]+0.6846531968814573*f[226][l]*alpha_vdim[260][l]+(0.4374088826398531*f[175][l]+0.6846531968814573*f[85][l])*alpha_vdim[259][l]+0.6123724356957944*f[147][l]*alpha_vdim[256][l]+0.5477225575051661*f[54][l]*alpha_vdim[255][l]+(0.6123724356957944*f[227][l]+0.6846531968814573*f[173][l])*alpha_vdim[251][l]+0.5477225575051661*f[177][l]*alpha_vdim[250][l]+0.6123724356957944*(f[83][l]*alpha_vdim[250][l]+f[151][l]*alpha_vdim[249][l]+f[106][l]*alpha_vdim[248][l]+f[214][l]*alpha_vdim[246][l])+0.6846531968814573*(f[141][l]*alpha_vdim[246][l]+f[198][l]*alpha_vdim[245][l])+0.6123724356957944*f[115][l]*alpha_vdim[244][l]+0.6846531968814573*f[175][l]*alpha_vdim[243][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[234][l]+0.6123724356957944*alpha_cdim[3][l]*f[220][l]+0.273861278752583*alpha_vdim[32][l]*f[217][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[216][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[213][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l])*f[207][l]+0.3061862178478971*alpha_vdim[86][l]*f[190][l]+(0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[189][l]+0.6846531968814573*alpha_cdim[0][l]*f[180][l]+0.273861278752583*alpha_vdim[6][l]*f[179][l]+0.2449489742783178*alpha_vdim[60][l]*f[174][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[173][l]+0.2449489742783178*alpha_vdim[69][l]*f[165][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[164][l]+0.3061862178478971*alpha_vdim[31][l]*f[145][l]+0.6846531968814573*alpha_cdim[3][l]*f[144][l]+0.273861278752583*(alpha_vdim[1][l]*f[144][l]+alpha_vdim[120][l]*f[142][l])+0.1749635530559412*alpha_vdim[37][l]*f[141][l]+0.273861278752583*(alpha_vdim[4][l]*f[141][l]+alpha_vdim[129][l]*f[133][l])+(0.1749635530559412*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[132][l]+0.2449489742783178*(alpha_vdim[22][l]*f[114][l]+alpha_vdim[25][l]*f[110][l])+0.3061862178478971*alpha_vdim[16][l]*f[95][l]+0.273861278752583*alpha_vdim[59][l]*f[84][l]+0.2449489742783178*alpha_vdim[9][l]*f[83][l]+0.273861278752583*alpha_vdim[68][l]*f[78][l]+0.2449489742783178*alpha_vdim[12][l]*f[77][l]+0.273861278752583*(alpha_vdim[37][l]*f[50][l]+alpha_vdim[43][l]*f[46][l]);
+    out[219][l] += (0.3912303982179757*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[606][l]+(0.3912303982179757*f[237][l]+0.6123724356957944*f[208][l]+0.4374088826398531*f[207][l]+0.6846531968814573*f[132][l])*alpha_vdim[603][l]+(0.4374088826398531*f[223][l]+0.6846531968814573*f[166][l])*alpha_vdim[572][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[546][l]+0.5477225575051661*f[147][l]*alpha_vdim[545][l]+(0.3912303982179757*f[225][l]+0.6123724356957944*f[168][l]+0.4374088826398531*f[165][l]+0.6846531968814573*f[77][l])*alpha_vdim[543][l]+(0.5477225575051661*f[224][l]+0.6123724356957944*f[164][l])*alpha_vdim[542][l]+0.3912303982179757*f[107][l]*alpha_vdim[524][l]+0.6123724356957944*(f[30][l]*alpha_vdim[524][l]+f[192][l]*alpha_vdim[523][l])+(0.3912303982179757*f[209][l]+0.6123724356957944*f[134][l]+0.4374088826398531*f[133][l]+0.6846531968814573*f[46][l])*alpha_vdim[520][l]+(0.6123724356957944*f[237][l]+0.6846531968814573*f[207][l])*alpha_vdim[519][l]+(0.4374088826398531*f[196][l]+0.6846531968814573*f[111][l])*alpha_vdim[518][l]+0.6123724356957944*f[195][l]*alpha_vdim[517][l]+0.5477225575051661*f[96][l]*alpha_vdim[508][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[110][l])*alpha_vdim[507][l]+0.4374088826398531*f[167][l]*alpha_vdim[503][l]+0.6846531968814573*(f[79][l]*alpha_vdim[503][l]+f[223][l]*alpha_vdim[502][l])+0.5477225575051661*f[55][l]*alpha_vdim[496][l]+0.6123724356957944*f[148][l]*alpha_vdim[495][l]+(0.5477225575051661*f[169][l]+0.6123724356957944*f[78][l])*alpha_vdim[494][l]+(0.6123724356957944*f[225][l]+0.6846531968814573*f[165][l])*alpha_vdim[493][l]+0.6123724356957944*(f[150][l]*alpha_vdim[492][l]+f[107][l]*alpha_vdim[490][l])+(0.6123724356957944*f[209][l]+0.6846531968814573*f[133][l])*alpha_vdim[489][l]+0.6123724356957944*f[112][l]*alpha_vdim[488][l]+0.6846531968814573*(f[196][l]*alpha_vdim[487][l]+f[167][l]*alpha_vdim[486][l])+(0.3912303982179757*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[372][l]+(0.3912303982179757*f[238][l]+0.6123724356957944*f[214][l]+0.4374088826398531*f[213][l]+0.6846531968814573*f[141][l])*alpha_vdim[360][l]+(0.4374088826398531*f[226][l]+0.6846531968814573*f[175][l])*alpha_vdim[329][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[312][l]+0.5477225575051661*f[147][l]*alpha_vdim[311][l]+(0.3912303982179757*f[228][l]+0.6123724356957944*f[177][l]+0.4374088826398531*f[174][l]+0.6846531968814573*f[83][l])*alpha_vdim[300][l]+(0.5477225575051661*f[227][l]+0.6123724356957944*f[173][l])*alpha_vdim[299][l]+0.3912303982179757*f[107][l]*alpha_vdim[287][l]+0.6123724356957944*(f[30][l]*alpha_vdim[287][l]+f[192][l]*alpha_vdim[286][l])+(0.3912303982179757*f[215][l]+0.6123724356957944*f[143][l]+0.4374088826398531*f[142][l]+0.6846531968814573*f[50][l])*alpha_vdim[277][l]+(0.6123724356957944*f[238][l]+0.6846531968814573*f[213][l])*alpha_vdim[276][l]+(0.4374088826398531*f[199][l]+0.6846531968814573*f[115][l])*alpha_vdim[275][l]+0.6123724356957944*f[198][l]*alpha_vdim[274][l]+0.5477225575051661*f[96][l]*alpha_vdim[268][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[114][l])*alpha_vdim[264][l]+0.4374088826398531*f[176][l]*alpha_vdim[260][l]+0.6846531968814573*(f[85][l]*alpha_vdim[260][l]+f[226][l]*alpha_vdim[259][l])+0.5477225575051661*f[55][l]*alpha_vdim[256][l]+0.6123724356957944*f[148][l]*alpha_vdim[255][l]+(0.5477225575051661*f[178][l]+0.6123724356957944*f[84][l])*alpha_vdim[251][l]+(0.6123724356957944*f[228][l]+0.6846531968814573*f[174][l])*alpha_vdim[250][l]+0.6123724356957944*(f[151][l]*alpha_vdim[249][l]+f[107][l]*alpha_vdim[248][l]+f[116][l]*alpha_cdim[247][l])+(0.6123724356957944*f[215][l]+0.6846531968814573*f[142][l])*alpha_vdim[246][l]+0.6123724356957944*f[116][l]*alpha_vdim[245][l]+0.6846531968814573*(f[199][l]*alpha_vdim[244][l]+f[176][l]*alpha_vdim[243][l]+f[181][l]*alpha_cdim[243][l])+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[234][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*alpha_vdim[1][l])*f[217][l]+0.273861278752583*alpha_vdim[31][l]*f[216][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[37][l])*f[213][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[43][l])*f[207][l]+0.1956151991089878*alpha_vdim[17][l]*f[190][l]+0.3061862178478971*(alpha_vdim[0][l]*f[190][l]+alpha_vdim[86][l]*f[189][l])+0.273861278752583*alpha_vdim[6][l]*f[179][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[174][l]+0.2449489742783178*alpha_vdim[59][l]*f[173][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[165][l]+0.2449489742783178*alpha_vdim[68][l]*f[164][l]+0.273861278752583*alpha_vdim[2][l]*f[145][l]+0.3061862178478971*alpha_vdim[32][l]*f[144][l]+0.1749635530559412*alpha_vdim[38][l]*f[142][l]+0.273861278752583*(alpha_vdim[4][l]*f[142][l]+alpha_vdim[120][l]*f[141][l])+0.1749635530559412*alpha_vdim[44][l]*f[133][l]+0.273861278752583*(alpha_vdim[5][l]*f[133][l]+alpha_vdim[129][l]*f[132][l])+0.2449489742783178*(alpha_vdim[22][l]*f[114][l]+alpha_vdim[25][l]*f[110][l])+0.3061862178478971*alpha_vdim[17][l]*f[95][l]+0.2449489742783178*alpha_vdim[10][l]*f[84][l]+0.273861278752583*alpha_vdim[60][l]*f[83][l]+0.2449489742783178*alpha_vdim[13][l]*f[78][l]+0.273861278752583*(alpha_vdim[69][l]*f[77][l]+alpha_vdim[38][l]*f[50][l]+alpha_vdim[44][l]*f[46][l]);
+    out[220][l] += 0.5477225575051661*(f[194][l]*alpha_vdim[606][l]+f[196][l]*alpha_vdim[603][l])+0.6123724356957944*f[225][l]*alpha_vdim[572][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*f[163][l])*alpha_vdim[546][l]+0.5477225575051661*f[149][l]*alpha_vdim[545][l]+(0.5477225575051661*f[223][l]+0.6123724356957944*f[167][l])*alpha_vdim[543][l]+0.5477225575051661*f[150][l]*alpha_vdim[542][l]+0.6123724356957944*f[194][l]*alpha_vdim[524][l]+0.5477225575051661*f[108][l]*alpha_vdim[523][l]+0.6123724356957944*f[196][l]*alpha_vdim[520][l]+0.5477225575051661*f[111][l]*alpha_vdim[519][l]+(0.6123724356957944*f[237][l]+0.6846531968814573*f[209][l])*alpha_vdim[518][l]+0.6123724356957944*f[197][l]*alpha_vdim[517][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[508][l]+(0.5477225575051661*f[195][l]+0.6123724356957944*f[112][l])*alpha_vdim[507][l]+0.6846531968814573*f[225][l]*alpha_vdim[503][l]+0.6123724356957944*(f[168][l]*alpha_vdim[502][l]+f[149][l]*alpha_vdim[496][l])+0.5477225575051661*f[162][l]*alpha_vdim[495][l]+0.6123724356957944*(f[76][l]*alpha_vdim[495][l]+f[150][l]*alpha_vdim[494][l])+(0.5477225575051661*f[166][l]+0.6123724356957944*f[79][l])*alpha_vdim[493][l]+(0.6123724356957944*f[224][l]+0.6846531968814573*f[169][l])*alpha_vdim[492][l]+0.6123724356957944*(f[108][l]*alpha_vdim[490][l]+f[111][l]*alpha_vdim[489][l])+0.6846531968814573*f[197][l]*alpha_vdim[488][l]+0.6123724356957944*f[208][l]*alpha_vdim[487][l]+0.6846531968814573*(f[134][l]*alpha_vdim[487][l]+f[168][l]*alpha_vdim[486][l])+0.5477225575051661*(f[194][l]*alpha_vdim[372][l]+f[199][l]*alpha_vdim[360][l])+0.6123724356957944*f[228][l]*alpha_vdim[329][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*f[163][l])*alpha_vdim[312][l]+0.5477225575051661*f[149][l]*alpha_vdim[311][l]+(0.5477225575051661*f[226][l]+0.6123724356957944*f[176][l])*alpha_vdim[300][l]+0.5477225575051661*f[151][l]*alpha_vdim[299][l]+0.6123724356957944*f[194][l]*alpha_vdim[287][l]+0.5477225575051661*f[108][l]*alpha_vdim[286][l]+0.6123724356957944*f[199][l]*alpha_vdim[277][l]+0.5477225575051661*f[115][l]*alpha_vdim[276][l]+(0.6123724356957944*f[238][l]+0.6846531968814573*f[215][l])*alpha_vdim[275][l]+0.6123724356957944*f[200][l]*alpha_vdim[274][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[268][l]+(0.5477225575051661*f[198][l]+0.6123724356957944*f[116][l])*alpha_vdim[264][l]+0.6846531968814573*f[228][l]*alpha_vdim[260][l]+0.6123724356957944*(f[177][l]*alpha_vdim[259][l]+f[149][l]*alpha_vdim[256][l])+0.5477225575051661*f[162][l]*alpha_vdim[255][l]+0.6123724356957944*(f[76][l]*alpha_vdim[255][l]+f[151][l]*alpha_vdim[251][l])+(0.5477225575051661*f[175][l]+0.6123724356957944*f[85][l])*alpha_vdim[250][l]+(0.6123724356957944*f[227][l]+0.6846531968814573*f[178][l])*alpha_vdim[249][l]+0.6123724356957944*(f[108][l]*alpha_vdim[248][l]+f[115][l]*alpha_vdim[246][l])+0.6846531968814573*f[200][l]*alpha_vdim[245][l]+0.6123724356957944*f[214][l]*alpha_vdim[244][l]+0.6846531968814573*(f[143][l]*alpha_vdim[244][l]+f[177][l]*alpha_vdim[243][l])+0.6123724356957944*alpha_vdim[32][l]*f[239][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[230][l]+0.6123724356957944*alpha_vdim[6][l]*f[229][l]+0.5477225575051661*(alpha_vdim[60][l]*f[226][l]+alpha_vdim[69][l]*f[223][l])+0.6846531968814573*alpha_vdim[32][l]*f[219][l]+0.6123724356957944*alpha_vdim[1][l]*f[218][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[201][l]+(0.5477225575051661*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[199][l]+0.5477225575051661*alpha_vdim[22][l]*f[198][l]+(0.5477225575051661*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[196][l]+0.5477225575051661*alpha_vdim[25][l]*f[195][l]+0.3061862178478971*alpha_cdim[0][l]*f[191][l]+0.6846531968814573*alpha_vdim[6][l]*f[181][l]+(0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[180][l]+0.6123724356957944*alpha_vdim[60][l]*f[176][l]+0.5477225575051661*alpha_vdim[9][l]*f[175][l]+0.6123724356957944*alpha_vdim[69][l]*f[167][l]+0.5477225575051661*alpha_vdim[12][l]*f[166][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[151][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[150][l]+(0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[146][l]+0.6123724356957944*alpha_vdim[22][l]*f[116][l]+0.5477225575051661*alpha_vdim[37][l]*f[115][l]+0.6123724356957944*(alpha_vdim[4][l]*f[115][l]+alpha_vdim[25][l]*f[112][l])+0.5477225575051661*alpha_vdim[43][l]*f[111][l]+0.6123724356957944*(alpha_vdim[5][l]*f[111][l]+alpha_vdim[9][l]*f[85][l]+alpha_vdim[12][l]*f[79][l]);
+    out[221][l] += 0.5477225575051661*(f[193][l]*alpha_vdim[606][l]+f[195][l]*alpha_vdim[603][l])+0.6123724356957944*f[224][l]*alpha_vdim[572][l]+0.5477225575051661*f[149][l]*alpha_vdim[546][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*f[162][l])*alpha_vdim[545][l]+0.5477225575051661*f[150][l]*alpha_vdim[543][l]+(0.5477225575051661*f[223][l]+0.6123724356957944*f[166][l])*alpha_vdim[542][l]+0.5477225575051661*f[109][l]*alpha_vdim[524][l]+0.6123724356957944*f[193][l]*alpha_vdim[523][l]+0.5477225575051661*f[112][l]*alpha_vdim[520][l]+0.6123724356957944*(f[195][l]*alpha_vdim[519][l]+f[197][l]*alpha_vdim[518][l])+(0.6123724356957944*f[237][l]+0.6846531968814573*f[208][l])*alpha_vdim[517][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[508][l]+0.5477225575051661*f[196][l]*alpha_vdim[507][l]+0.6123724356957944*(f[111][l]*alpha_vdim[507][l]+f[169][l]*alpha_vdim[503][l])+0.6846531968814573*f[224][l]*alpha_vdim[502][l]+0.5477225575051661*f[163][l]*alpha_vdim[496][l]+0.6123724356957944*(f[76][l]*alpha_vdim[496][l]+f[149][l]*alpha_vdim[495][l])+0.5477225575051661*f[167][l]*alpha_vdim[494][l]+0.6123724356957944*(f[79][l]*alpha_vdim[494][l]+f[150][l]*alpha_vdim[493][l])+(0.6123724356957944*f[225][l]+0.6846531968814573*f[168][l])*alpha_vdim[492][l]+0.6123724356957944*(f[109][l]*alpha_vdim[490][l]+f[112][l]*alpha_vdim[489][l]+f[209][l]*alpha_vdim[488][l])+0.6846531968814573*(f[134][l]*alpha_vdim[488][l]+f[197][l]*alpha_vdim[487][l]+f[169][l]*alpha_vdim[486][l])+0.5477225575051661*(f[193][l]*alpha_vdim[372][l]+f[198][l]*alpha_vdim[360][l])+0.6123724356957944*f[227][l]*alpha_vdim[329][l]+0.5477225575051661*f[149][l]*alpha_vdim[312][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*f[162][l])*alpha_vdim[311][l]+0.5477225575051661*f[151][l]*alpha_vdim[300][l]+(0.5477225575051661*f[226][l]+0.6123724356957944*f[175][l])*alpha_vdim[299][l]+0.5477225575051661*f[109][l]*alpha_vdim[287][l]+0.6123724356957944*f[193][l]*alpha_vdim[286][l]+0.5477225575051661*f[116][l]*alpha_vdim[277][l]+0.6123724356957944*(f[198][l]*alpha_vdim[276][l]+f[200][l]*alpha_vdim[275][l])+(0.6123724356957944*f[238][l]+0.6846531968814573*f[214][l])*alpha_vdim[274][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[268][l]+0.5477225575051661*f[199][l]*alpha_vdim[264][l]+0.6123724356957944*(f[115][l]*alpha_vdim[264][l]+f[178][l]*alpha_vdim[260][l])+0.6846531968814573*f[227][l]*alpha_vdim[259][l]+0.5477225575051661*f[163][l]*alpha_vdim[256][l]+0.6123724356957944*(f[76][l]*alpha_vdim[256][l]+f[149][l]*alpha_vdim[255][l])+0.5477225575051661*f[176][l]*alpha_vdim[251][l]+0.6123724356957944*(f[85][l]*alpha_vdim[251][l]+f[151][l]*alpha_vdim[250][l])+(0.6123724356957944*f[228][l]+0.6846531968814573*f[177][l])*alpha_vdim[249][l]+0.6123724356957944*f[109][l]*alpha_vdim[248][l]+0.273861278752583*f[143][l]*alpha_cdim[247][l]+0.6123724356957944*(f[116][l]*alpha_vdim[246][l]+f[215][l]*alpha_vdim[245][l])+0.6846531968814573*(f[143][l]*alpha_vdim[245][l]+f[200][l]*alpha_vdim[244][l]+f[178][l]*alpha_vdim[243][l])+0.3061862178478971*f[191][l]*alpha_cdim[243][l]+0.6123724356957944*(alpha_vdim[31][l]*f[239][l]+alpha_vdim[6][l]*f[230][l])+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[229][l]+0.5477225575051661*(alpha_vdim[59][l]*f[226][l]+alpha_vdim[68][l]*f[223][l])+0.6123724356957944*alpha_vdim[2][l]*f[219][l]+0.6846531968814573*alpha_vdim[31][l]*f[218][l]+(0.6123724356957944*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[201][l]+0.5477225575051661*alpha_vdim[22][l]*f[199][l]+(0.5477225575051661*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])*f[198][l]+0.5477225575051661*(alpha_vdim[25][l]*f[196][l]+alpha_vdim[129][l]*f[195][l])+0.6123724356957944*(alpha_vdim[43][l]*f[195][l]+alpha_vdim[17][l]*f[181][l])+0.6846531968814573*(alpha_vdim[0][l]*f[181][l]+alpha_vdim[6][l]*f[180][l])+0.5477225575051661*alpha_vdim[10][l]*f[176][l]+0.6123724356957944*alpha_vdim[59][l]*f[175][l]+0.5477225575051661*alpha_vdim[13][l]*f[167][l]+0.6123724356957944*alpha_vdim[68][l]*f[166][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[151][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[150][l]+0.6846531968814573*alpha_vdim[2][l]*f[146][l]+0.5477225575051661*alpha_vdim[38][l]*f[116][l]+0.6123724356957944*(alpha_vdim[4][l]*f[116][l]+alpha_vdim[22][l]*f[115][l])+0.5477225575051661*alpha_vdim[44][l]*f[112][l]+0.6123724356957944*(alpha_vdim[5][l]*f[112][l]+alpha_vdim[25][l]*f[111][l]+alpha_vdim[10][l]*f[85][l]+alpha_vdim[13][l]*f[79][l]);
+    out[222][l] += (0.1117801137765645*f[232][l]+0.1749635530559412*(f[185][l]+f[184][l])+0.1249739664685295*f[182][l]+0.273861278752583*f[91][l]+0.1956151991089878*(f[88][l]+f[87][l])+0.3061862178478971*f[18][l])*alpha_vdim[606][l]+(0.1117801137765645*f[152][l]+0.1749635530559412*(f[62][l]+f[61][l])+0.273861278752583*f[11][l])*alpha_vdim[603][l]+(0.1249739664685295*f[202][l]+0.1956151991089878*(f[122][l]+f[121][l])+0.3061862178478971*f[39][l])*alpha_vdim[572][l]+(0.1564921592871903*f[205][l]+0.2449489742783178*f[127][l]+0.1749635530559412*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[546][l]+(0.1564921592871903*f[204][l]+0.2449489742783178*f[128][l]+0.1749635530559412*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[545][l]+(0.1564921592871903*f[98][l]+0.2449489742783178*f[23][l])*alpha_vdim[543][l]+(0.1564921592871903*f[97][l]+0.2449489742783178*f[24][l])*alpha_vdim[542][l]+(0.1749635530559412*f[232][l]+0.273861278752583*f[184][l]+0.1956151991089878*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[524][l]+(0.1749635530559412*f[232][l]+0.273861278752583*f[185][l]+0.1956151991089878*f[182][l]+0.3061862178478971*f[88][l])*alpha_vdim[523][l]+(0.1749635530559412*f[152][l]+0.273861278752583*f[61][l])*alpha_vdim[520][l]+(0.1749635530559412*f[152][l]+0.273861278752583*f[62][l])*alpha_vdim[519][l]+(0.1749635530559412*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[518][l]+(0.1749635530559412*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[517][l]+(0.2190890230020664*f[157][l]+0.2449489742783178*f[58][l])*alpha_vdim[508][l]+0.2190890230020664*f[51][l]*alpha_vdim[507][l]+(0.1956151991089878*f[202][l]+0.3061862178478971*f[121][l])*alpha_vdim[503][l]+(0.1956151991089878*f[202][l]+0.3061862178478971*f[122][l])*alpha_vdim[502][l]+(0.2449489742783178*f[204][l]+0.273861278752583*f[118][l])*alpha_vdim[496][l]+(0.2449489742783178*f[205][l]+0.273861278752583*f[119][l])*alpha_vdim[495][l]+0.2449489742783178*(f[97][l]*alpha_vdim[494][l]+f[98][l]*alpha_vdim[493][l]+f[99][l]*alpha_vdim[492][l])+(0.273861278752583*f[232][l]+0.3061862178478971*f[182][l])*alpha_vdim[490][l]+0.273861278752583*(f[152][l]*alpha_vdim[489][l]+f[153][l]*alpha_vdim[488][l]+f[154][l]*alpha_vdim[487][l])+0.3061862178478971*f[202][l]*alpha_vdim[486][l]+(0.1117801137765645*f[233][l]+0.1749635530559412*(f[188][l]+f[187][l])+0.1249739664685295*f[182][l]+0.273861278752583*f[94][l]+0.1956151991089878*(f[88][l]+f[87][l])+0.3061862178478971*f[18][l])*alpha_vdim[372][l]+(0.1117801137765645*f[158][l]+0.1749635530559412*(f[71][l]+f[70][l])+0.273861278752583*f[14][l])*alpha_vdim[360][l]+(0.1249739664685295*f[206][l]+0.1956151991089878*(f[131][l]+f[130][l])+0.3061862178478971*f[45][l])*alpha_vdim[329][l]+(0.1564921592871903*f[212][l]+0.2449489742783178*f[139][l]+0.1749635530559412*f[119][l]+0.273861278752583*f[35][l])*alpha_vdim[312][l]+(0.1564921592871903*f[211][l]+0.2449489742783178*f[140][l]+0.1749635530559412*f[118][l]+0.273861278752583*f[36][l])*alpha_vdim[311][l]+(0.1564921592871903*f[102][l]+0.2449489742783178*f[26][l])*alpha_vdim[300][l]+(0.1564921592871903*f[101][l]+0.2449489742783178*f[27][l])*alpha_vdim[299][l]+(0.1749635530559412*f[233][l]+0.273861278752583*f[187][l]+0.1956151991089878*f[182][l]+0.3061862178478971*f[87][l])*alpha_vdim[287][l]+(0.1749635530559412*f[233][l]+0.273861278752583*f[188][l]+0.1956151991089878*f[182][l]+0.3061862178478971*f[88][l])*alpha_vdim[286][l]+(0.1749635530559412*f[158][l]+0.273861278752583*f[70][l])*alpha_vdim[277][l]+(0.1749635530559412*f[158][l]+0.273861278752583*f[71][l])*alpha_vdim[276][l]+(0.1749635530559412*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[275][l]+(0.1749635530559412*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[274][l]+(0.2190890230020664*f[172][l]+0.2449489742783178*f[58][l])*alpha_vdim[268][l]+0.2190890230020664*f[52][l]*alpha_vdim[264][l]+(0.1956151991089878*f[206][l]+0.3061862178478971*f[130][l])*alpha_vdim[260][l]+(0.1956151991089878*f[206][l]+0.3061862178478971*f[131][l])*alpha_vdim[259][l]+(0.2449489742783178*f[211][l]+0.273861278752583*f[118][l])*alpha_vdim[256][l]+(0.2449489742783178*f[212][l]+0.273861278752583*f[119][l])*alpha_vdim[255][l]+0.2449489742783178*(f[101][l]*alpha_vdim[251][l]+f[102][l]*alpha_vdim[250][l]+f[103][l]*alpha_vdim[249][l])+(0.273861278752583*f[233][l]+0.3061862178478971*f[182][l])*alpha_vdim[248][l]+(0.6123724356957944*f[224][l]+0.6846531968814573*f[159][l])*alpha_cdim[247][l]+0.273861278752583*(f[158][l]*alpha_vdim[246][l]+f[159][l]*alpha_vdim[245][l]+f[160][l]*alpha_vdim[244][l])+0.3061862178478971*f[206][l]*alpha_vdim[243][l]+0.6846531968814573*f[193][l]*alpha_cdim[243][l]+(0.249947932937059*alpha_vdim[129][l]+0.3912303982179757*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[226][l]+(0.249947932937059*alpha_vdim[120][l]+0.3912303982179757*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[223][l]+(0.3499271061118826*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[199][l]+(0.3499271061118826*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[198][l]+(0.3499271061118826*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[196][l]+(0.3499271061118826*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[195][l]+0.6846531968814573*alpha_cdim[0][l]*f[194][l]+(0.2794502844414113*alpha_vdim[86][l]+0.4374088826398531*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[192][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[43][l])*f[176][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[175][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])*f[167][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[166][l]+(0.2794502844414113*alpha_vdim[120][l]+0.4374088826398531*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[158][l]+(0.2794502844414113*alpha_vdim[129][l]+0.4374088826398531*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6846531968814573*alpha_vdim[5][l])*f[152][l]+0.4898979485566357*(alpha_vdim[25][l]*f[151][l]+alpha_vdim[22][l]*f[150][l])+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[148][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[147][l]+(0.6123724356957944*f[85][l]+0.4374088826398531*(f[62][l]+f[61][l])+0.6846531968814573*f[11][l])*alpha_vdim[129][l]+(0.6123724356957944*f[79][l]+0.4374088826398531*(f[71][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[120][l]+0.5477225575051661*(alpha_vdim[68][l]*f[116][l]+alpha_vdim[69][l]*f[115][l]+alpha_vdim[59][l]*f[112][l]+alpha_vdim[60][l]*f[111][l])+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[107][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[106][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[102][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[101][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[98][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[97][l]+0.5477225575051661*alpha_vdim[6][l]*f[96][l]+0.6846531968814573*(f[30][l]*alpha_vdim[86][l]+alpha_vdim[37][l]*f[71][l]+alpha_vdim[38][l]*f[70][l])+0.6123724356957944*(f[23][l]*alpha_vdim[69][l]+f[24][l]*alpha_vdim[68][l])+0.6846531968814573*(alpha_vdim[43][l]*f[62][l]+alpha_vdim[44][l]*f[61][l])+0.6123724356957944*(f[26][l]*alpha_vdim[60][l]+f[27][l]*alpha_vdim[59][l]+alpha_vdim[31][l]*f[55][l]+alpha_vdim[32][l]*f[54][l])+0.5477225575051661*(alpha_vdim[22][l]*f[52][l]+alpha_vdim[25][l]*f[51][l]);
+    out[223][l] += (0.1117801137765645*f[152][l]+0.1749635530559412*(f[62][l]+f[61][l])+0.273861278752583*f[11][l])*alpha_vdim[606][l]+(0.1117801137765645*f[232][l]+0.1749635530559412*(f[185][l]+f[184][l])+0.1249739664685295*f[183][l]+0.273861278752583*f[91][l]+0.1956151991089878*(f[90][l]+f[89][l])+0.3061862178478971*f[19][l])*alpha_vdim[603][l]+(0.1249739664685295*f[203][l]+0.1956151991089878*(f[126][l]+f[125][l])+0.3061862178478971*f[42][l])*alpha_vdim[572][l]+(0.1564921592871903*f[98][l]+0.2449489742783178*f[23][l])*alpha_vdim[546][l]+(0.1564921592871903*f[97][l]+0.2449489742783178*f[24][l])*alpha_vdim[545][l]+(0.1564921592871903*f[205][l]+0.2449489742783178*f[127][l]+0.1749635530559412*f[124][l]+0.273861278752583*f[40][l])*alpha_vdim[543][l]+(0.1564921592871903*f[204][l]+0.2449489742783178*f[128][l]+0.1749635530559412*f[123][l]+0.273861278752583*f[41][l])*alpha_vdim[542][l]+(0.1749635530559412*f[152][l]+0.273861278752583*f[61][l])*alpha_vdim[524][l]+(0.1749635530559412*f[152][l]+0.273861278752583*f[62][l])*alpha_vdim[523][l]+(0.1749635530559412*f[232][l]+0.273861278752583*f[184][l]+0.1956151991089878*f[183][l]+0.3061862178478971*f[89][l])*alpha_vdim[520][l]+(0.1749635530559412*f[232][l]+0.273861278752583*f[185][l]+0.1956151991089878*f[183][l]+0.3061862178478971*f[90][l])*alpha_vdim[519][l]+(0.1749635530559412*f[156][l]+0.273861278752583*f[66][l])*alpha_vdim[518][l]+(0.1749635530559412*f[155][l]+0.273861278752583*f[67][l])*alpha_vdim[517][l]+0.2190890230020664*f[51][l]*alpha_vdim[508][l]+(0.2190890230020664*f[157][l]+0.2449489742783178*f[65][l])*alpha_vdim[507][l]+(0.1956151991089878*f[203][l]+0.3061862178478971*f[125][l])*alpha_vdim[503][l]+(0.1956151991089878*f[203][l]+0.3061862178478971*f[126][l])*alpha_vdim[502][l]+0.2449489742783178*(f[97][l]*alpha_vdim[496][l]+f[98][l]*alpha_vdim[495][l])+(0.2449489742783178*f[204][l]+0.273861278752583*f[123][l])*alpha_vdim[494][l]+(0.2449489742783178*f[205][l]+0.273861278752583*f[124][l])*alpha_vdim[493][l]+0.2449489742783178*f[100][l]*alpha_vdim[492][l]+0.273861278752583*f[152][l]*alpha_vdim[490][l]+(0.273861278752583*f[232][l]+0.3061862178478971*f[183][l])*alpha_vdim[489][l]+0.273861278752583*(f[155][l]*alpha_vdim[488][l]+f[156][l]*alpha_vdim[487][l])+0.3061862178478971*f[203][l]*alpha_vdim[486][l]+(0.249947932937059*f[226][l]+0.3912303982179757*(f[176][l]+f[175][l])+0.2794502844414113*f[152][l]+0.6123724356957944*f[85][l]+0.4374088826398531*(f[62][l]+f[61][l])+0.6846531968814573*f[11][l])*alpha_vdim[372][l]+(0.249947932937059*f[222][l]+0.3912303982179757*(f[163][l]+f[162][l])+0.2794502844414113*f[161][l]+0.6123724356957944*f[76][l]+0.4374088826398531*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[360][l]+(0.2794502844414113*f[192][l]+0.4374088826398531*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[329][l]+(0.3499271061118826*f[199][l]+0.5477225575051661*f[115][l]+0.3912303982179757*f[98][l]+0.6123724356957944*f[23][l])*alpha_vdim[312][l]+(0.3499271061118826*f[198][l]+0.5477225575051661*f[116][l]+0.3912303982179757*f[97][l]+0.6123724356957944*f[24][l])*alpha_vdim[311][l]+(0.3499271061118826*f[194][l]+0.5477225575051661*f[108][l]+0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[300][l]+(0.3499271061118826*f[193][l]+0.5477225575051661*f[109][l]+0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[299][l]+(0.3912303982179757*f[226][l]+0.6123724356957944*f[175][l]+0.4374088826398531*f[152][l]+0.6846531968814573*f[61][l])*alpha_vdim[287][l]+(0.3912303982179757*f[226][l]+0.6123724356957944*f[176][l]+0.4374088826398531*f[152][l]+0.6846531968814573*f[62][l])*alpha_vdim[286][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[162][l]+0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[277][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l]+0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[276][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[275][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[274][l]+(0.4898979485566357*f[151][l]+0.5477225575051661*f[51][l])*alpha_vdim[268][l]+(0.4898979485566357*f[149][l]+0.5477225575051661*f[53][l])*alpha_vdim[264][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[260][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[259][l]+(0.5477225575051661*f[198][l]+0.6123724356957944*f[97][l])*alpha_vdim[256][l]+(0.5477225575051661*f[199][l]+0.6123724356957944*f[98][l])*alpha_vdim[255][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[104][l])*alpha_vdim[251][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[105][l])*alpha_vdim[250][l]+0.5477225575051661*f[96][l]*alpha_vdim[249][l]+(0.6123724356957944*f[226][l]+0.6846531968814573*f[152][l])*alpha_vdim[248][l]+0.6123724356957944*f[147][l]*alpha_cdim[247][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[161][l])*alpha_vdim[246][l]+0.6123724356957944*(f[147][l]*alpha_vdim[245][l]+f[148][l]*alpha_vdim[244][l])+0.6846531968814573*(f[192][l]*alpha_vdim[243][l]+f[195][l]*alpha_cdim[243][l])+(0.1117801137765645*alpha_vdim[129][l]+0.1749635530559412*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.273861278752583*alpha_vdim[5][l])*f[234][l]+0.6123724356957944*alpha_cdim[3][l]*f[225][l]+(0.1564921592871903*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[217][l]+(0.1564921592871903*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[216][l]+(0.1249739664685295*alpha_vdim[86][l]+0.1956151991089878*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[207][l]+0.6846531968814573*alpha_cdim[0][l]*f[196][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[43][l])*f[190][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[44][l])*f[189][l]+(0.1249739664685295*alpha_vdim[129][l]+0.1956151991089878*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.3061862178478971*alpha_vdim[5][l])*f[183][l]+0.2190890230020664*alpha_vdim[25][l]*f[179][l]+(0.1749635530559412*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[165][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[164][l]+(0.1117801137765645*alpha_vdim[120][l]+0.1749635530559412*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.273861278752583*alpha_vdim[4][l])*f[161][l]+0.2449489742783178*(alpha_vdim[68][l]*f[145][l]+alpha_vdim[69][l]*f[144][l])+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[133][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[132][l]+(0.273861278752583*f[95][l]+0.1956151991089878*(f[90][l]+f[89][l])+0.3061862178478971*f[19][l])*alpha_vdim[129][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[124][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[123][l]+(0.1749635530559412*(f[75][l]+f[74][l])+0.273861278752583*f[15][l])*alpha_vdim[120][l]+0.2449489742783178*alpha_vdim[6][l]*f[110][l]+(0.1564921592871903*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[105][l]+(0.1564921592871903*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[104][l]+0.3061862178478971*(alpha_vdim[43][l]*f[90][l]+alpha_vdim[44][l]*f[89][l]+f[46][l]*alpha_vdim[86][l])+0.273861278752583*(alpha_vdim[31][l]*f[78][l]+alpha_vdim[32][l]*f[77][l]+alpha_vdim[37][l]*f[75][l]+alpha_vdim[38][l]*f[74][l]+f[40][l]*alpha_vdim[69][l]+f[41][l]*alpha_vdim[68][l])+0.2449489742783178*(alpha_vdim[25][l]*f[65][l]+f[28][l]*alpha_vdim[60][l]+f[29][l]*alpha_vdim[59][l])+0.2190890230020664*alpha_vdim[22][l]*f[53][l];
+    out[224][l] += (0.1564921592871903*f[153][l]+0.2449489742783178*f[64][l])*alpha_vdim[606][l]+(0.1564921592871903*f[155][l]+0.2449489742783178*f[67][l])*alpha_vdim[603][l]+(0.1749635530559412*f[204][l]+0.273861278752583*f[128][l])*alpha_vdim[572][l]+0.2190890230020664*f[99][l]*alpha_vdim[546][l]+(0.1564921592871903*f[202][l]+0.2449489742783178*f[122][l]+0.1749635530559412*f[121][l]+0.273861278752583*f[39][l])*alpha_vdim[545][l]+0.2190890230020664*f[100][l]*alpha_vdim[543][l]+(0.1564921592871903*f[203][l]+0.2449489742783178*f[126][l]+0.1749635530559412*f[125][l]+0.273861278752583*f[42][l])*alpha_vdim[542][l]+0.2449489742783178*f[153][l]*alpha_vdim[524][l]+(0.1749635530559412*f[153][l]+0.273861278752583*f[64][l])*alpha_vdim[523][l]+0.2449489742783178*f[155][l]*alpha_vdim[520][l]+(0.1749635530559412*f[155][l]+0.273861278752583*f[67][l])*alpha_vdim[519][l]+0.2449489742783178*f[157][l]*alpha_vdim[518][l]+(0.1749635530559412*f[232][l]+0.273861278752583*f[185][l]+0.1956151991089878*f[184][l]+0.3061862178478971*f[91][l])*alpha_vdim[517][l]+(0.2190890230020664*f[154][l]+0.2449489742783178*f[63][l])*alpha_vdim[508][l]+(0.2190890230020664*f[156][l]+0.2449489742783178*f[66][l])*alpha_vdim[507][l]+0.273861278752583*f[204][l]*alpha_vdim[503][l]+(0.1956151991089878*f[204][l]+0.3061862178478971*f[128][l])*alpha_vdim[502][l]+(0.2449489742783178*f[202][l]+0.273861278752583*f[121][l])*alpha_vdim[496][l]+0.2449489742783178*f[99][l]*alpha_vdim[495][l]+(0.2449489742783178*f[203][l]+0.273861278752583*f[125][l])*alpha_vdim[494][l]+0.2449489742783178*(f[100][l]*alpha_vdim[493][l]+f[205][l]*alpha_vdim[492][l])+0.273861278752583*(f[127][l]*alpha_vdim[492][l]+f[153][l]*alpha_vdim[490][l]+f[155][l]*alpha_vdim[489][l])+(0.273861278752583*f[232][l]+0.3061862178478971*f[184][l])*alpha_vdim[488][l]+0.273861278752583*f[157][l]*alpha_vdim[487][l]+0.3061862178478971*f[204][l]*alpha_vdim[486][l]+(0.3499271061118826*f[227][l]+0.5477225575051661*f[178][l]+0.3912303982179757*f[153][l]+0.6123724356957944*f[64][l])*alpha_vdim[372][l]+(0.3499271061118826*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[360][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[329][l]+(0.4898979485566357*f[200][l]+0.5477225575051661*f[99][l])*alpha_vdim[312][l]+(0.3499271061118826*f[238][l]+0.5477225575051661*f[215][l]+0.3912303982179757*(f[214][l]+f[202][l])+0.6123724356957944*(f[143][l]+f[122][l])+0.4374088826398531*f[121][l]+0.6846531968814573*f[39][l])*alpha_vdim[311][l]+0.4898979485566357*f[96][l]*alpha_vdim[300][l]+(0.3499271061118826*f[192][l]+0.5477225575051661*f[107][l]+0.3912303982179757*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[299][l]+(0.5477225575051661*f[227][l]+0.6123724356957944*f[153][l])*alpha_vdim[287][l]+(0.3912303982179757*f[227][l]+0.6123724356957944*f[178][l]+0.4374088826398531*f[153][l]+0.6846531968814573*f[64][l])*alpha_vdim[286][l]+0.5477225575051661*f[147][l]*alpha_vdim[277][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[276][l]+0.5477225575051661*f[149][l]*alpha_vdim[275][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l]+0.4374088826398531*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[274][l]+(0.4898979485566357*f[228][l]+0.5477225575051661*(f[177][l]+f[154][l])+0.6123724356957944*f[63][l])*alpha_vdim[268][l]+(0.4898979485566357*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[264][l]+0.6123724356957944*f[193][l]*alpha_vdim[260][l]+(0.4374088826398531*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[259][l]+(0.5477225575051661*f[238][l]+0.6123724356957944*(f[214][l]+f[202][l])+0.6846531968814573*f[121][l])*alpha_vdim[256][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[99][l])*alpha_vdim[255][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[251][l]+0.5477225575051661*f[96][l]*alpha_vdim[250][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[249][l]+(0.6123724356957944*f[227][l]+0.6846531968814573*f[153][l])*alpha_vdim[248][l]+0.273861278752583*f[162][l]*alpha_cdim[247][l]+0.6123724356957944*f[147][l]*alpha_vdim[246][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[245][l]+0.6123724356957944*f[149][l]*alpha_vdim[244][l]+0.6846531968814573*f[193][l]*alpha_vdim[243][l]+0.3061862178478971*f[208][l]*alpha_cdim[243][l]+(0.3499271061118826*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[239][l]+0.4898979485566357*alpha_vdim[25][l]*f[230][l]+(0.3499271061118826*alpha_vdim[129][l]+0.5477225575051661*alpha_vdim[44][l]+0.3912303982179757*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[229][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[223][l]+0.5477225575051661*alpha_vdim[68][l]*f[219][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[218][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[203][l]+(0.4898979485566357*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[201][l]+0.6846531968814573*alpha_cdim[0][l]*f[197][l]+0.5477225575051661*alpha_vdim[6][l]*f[196][l]+(0.3912303982179757*alpha_vdim[86][l]+0.6123724356957944*alpha_vdim[17][l]+0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[195][l]+(0.3499271061118826*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[192][l]+(0.5477225575051661*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[43][l])*f[181][l]+0.5477225575051661*alpha_vdim[25][l]*f[180][l]+0.6123724356957944*alpha_vdim[31][l]*f[167][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[166][l]+0.5477225575051661*alpha_vdim[25][l]*f[156][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l]+0.4374088826398531*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[155][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[150][l]+0.4898979485566357*alpha_vdim[22][l]*f[148][l]+(0.3499271061118826*alpha_vdim[120][l]+0.5477225575051661*alpha_vdim[38][l]+0.3912303982179757*alpha_vdim[37][l])*f[147][l]+0.6123724356957944*(alpha_vdim[4][l]*f[147][l]+alpha_vdim[68][l]*f[146][l]+f[67][l]*alpha_vdim[129][l]+alpha_vdim[68][l]*f[126][l])+(0.4374088826398531*alpha_vdim[68][l]+0.6846531968814573*alpha_vdim[13][l])*f[125][l]+0.5477225575051661*f[55][l]*alpha_vdim[120][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[112][l]+0.6123724356957944*alpha_vdim[6][l]*f[111][l]+0.5477225575051661*alpha_vdim[59][l]*f[107][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[106][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[100][l]+(0.4898979485566357*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[96][l]+0.6846531968814573*(alpha_vdim[31][l]*f[79][l]+f[42][l]*alpha_vdim[68][l]+alpha_vdim[43][l]*f[67][l])+0.6123724356957944*(alpha_vdim[25][l]*f[66][l]+f[30][l]*alpha_vdim[59][l]+alpha_vdim[37][l]*f[55][l])+0.5477225575051661*alpha_vdim[22][l]*f[54][l];
+    out[225][l] += (0.1564921592871903*f[154][l]+0.2449489742783178*f[63][l])*alpha_vdim[606][l]+(0.1564921592871903*f[156][l]+0.2449489742783178*f[66][l])*alpha_vdim[603][l]+(0.1749635530559412*f[205][l]+0.273861278752583*f[127][l])*alpha_vdim[572][l]+(0.1564921592871903*f[202][l]+0.1749635530559412*f[122][l]+0.2449489742783178*f[121][l]+0.273861278752583*f[39][l])*alpha_vdim[546][l]+0.2190890230020664*f[99][l]*alpha_vdim[545][l]+(0.1564921592871903*f[203][l]+0.1749635530559412*f[126][l]+0.2449489742783178*f[125][l]+0.273861278752583*f[42][l])*alpha_vdim[543][l]+0.2190890230020664*f[100][l]*alpha_vdim[542][l]+(0.1749635530559412*f[154][l]+0.273861278752583*f[63][l])*alpha_vdim[524][l]+0.2449489742783178*f[154][l]*alpha_vdim[523][l]+(0.1749635530559412*f[156][l]+0.273861278752583*f[66][l])*alpha_vdim[520][l]+0.2449489742783178*f[156][l]*alpha_vdim[519][l]+(0.1749635530559412*f[232][l]+0.1956151991089878*f[185][l]+0.273861278752583*f[184][l]+0.3061862178478971*f[91][l])*alpha_vdim[518][l]+0.2449489742783178*f[157][l]*alpha_vdim[517][l]+(0.2190890230020664*f[153][l]+0.2449489742783178*f[64][l])*alpha_vdim[508][l]+(0.2190890230020664*f[155][l]+0.2449489742783178*f[67][l])*alpha_vdim[507][l]+(0.1956151991089878*f[205][l]+0.3061862178478971*f[127][l])*alpha_vdim[503][l]+0.273861278752583*f[205][l]*alpha_vdim[502][l]+0.2449489742783178*f[99][l]*alpha_vdim[496][l]+(0.2449489742783178*f[202][l]+0.273861278752583*f[122][l])*alpha_vdim[495][l]+0.2449489742783178*f[100][l]*alpha_vdim[494][l]+(0.2449489742783178*f[203][l]+0.273861278752583*f[126][l])*alpha_vdim[493][l]+0.2449489742783178*f[204][l]*alpha_vdim[492][l]+0.273861278752583*(f[128][l]*alpha_vdim[492][l]+f[154][l]*alpha_vdim[490][l]+f[156][l]*alpha_vdim[489][l]+f[157][l]*alpha_vdim[488][l]+f[232][l]*alpha_vdim[487][l])+0.3061862178478971*(f[185][l]*alpha_vdim[487][l]+f[205][l]*alpha_vdim[486][l])+(0.3499271061118826*f[228][l]+0.5477225575051661*f[177][l]+0.3912303982179757*f[154][l]+0.6123724356957944*f[63][l])*alpha_vdim[372][l]+(0.3499271061118826*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[360][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[329][l]+(0.3499271061118826*f[238][l]+0.3912303982179757*f[215][l]+0.5477225575051661*f[214][l]+0.3912303982179757*f[202][l]+0.6123724356957944*f[143][l]+0.4374088826398531*f[122][l]+0.6123724356957944*f[121][l]+0.6846531968814573*f[39][l])*alpha_vdim[312][l]+(0.4898979485566357*f[200][l]+0.5477225575051661*f[99][l])*alpha_vdim[311][l]+(0.3499271061118826*f[192][l]+0.3912303982179757*f[107][l]+0.5477225575051661*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[300][l]+0.4898979485566357*f[96][l]*alpha_vdim[299][l]+(0.3912303982179757*f[228][l]+0.6123724356957944*f[177][l]+0.4374088826398531*f[154][l]+0.6846531968814573*f[63][l])*alpha_vdim[287][l]+(0.5477225575051661*f[228][l]+0.6123724356957944*f[154][l])*alpha_vdim[286][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[277][l]+0.5477225575051661*f[148][l]*alpha_vdim[276][l]+(0.3912303982179757*f[222][l]+0.4374088826398531*f[163][l]+0.6123724356957944*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[275][l]+0.5477225575051661*f[149][l]*alpha_vdim[274][l]+(0.4898979485566357*f[227][l]+0.5477225575051661*(f[178][l]+f[153][l])+0.6123724356957944*f[64][l])*alpha_vdim[268][l]+(0.4898979485566357*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[264][l]+(0.4374088826398531*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[260][l]+0.6123724356957944*f[194][l]*alpha_vdim[259][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[99][l])*alpha_vdim[256][l]+(0.5477225575051661*f[238][l]+0.6123724356957944*(f[215][l]+f[202][l])+0.6846531968814573*f[122][l])*alpha_vdim[255][l]+0.5477225575051661*f[96][l]*alpha_vdim[251][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[250][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[249][l]+(0.6123724356957944*f[228][l]+0.6846531968814573*f[154][l])*alpha_vdim[248][l]+0.6123724356957944*(f[149][l]*alpha_cdim[247][l]+f[148][l]*alpha_vdim[246][l]+f[149][l]*alpha_vdim[245][l]+f[222][l]*alpha_vdim[244][l])+0.6846531968814573*(f[163][l]*alpha_vdim[244][l]+f[194][l]*alpha_vdim[243][l]+f[197][l]*alpha_cdim[243][l])+(0.3499271061118826*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[239][l]+(0.3499271061118826*alpha_vdim[129][l]+0.3912303982179757*alpha_vdim[44][l]+0.5477225575051661*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[230][l]+0.4898979485566357*alpha_vdim[25][l]*f[229][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[223][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[219][l]+0.5477225575051661*alpha_vdim[69][l]*f[218][l]+0.3061862178478971*alpha_cdim[0][l]*f[209][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[203][l]+(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[201][l]+(0.3912303982179757*alpha_vdim[86][l]+0.4374088826398531*alpha_vdim[17][l]+0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[196][l]+0.5477225575051661*alpha_vdim[6][l]*f[195][l]+0.3499271061118826*alpha_vdim[60][l]*f[192][l]+0.5477225575051661*(alpha_vdim[9][l]*f[192][l]+alpha_vdim[25][l]*f[181][l])+(0.5477225575051661*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[180][l]+(0.4374088826398531*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[167][l]+0.6123724356957944*alpha_vdim[32][l]*f[166][l]+(0.3912303982179757*alpha_vdim[129][l]+0.4374088826398531*alpha_vdim[44][l]+0.6123724356957944*alpha_vdim[43][l]+0.6846531968814573*alpha_vdim[5][l])*f[156][l]+0.5477225575051661*alpha_vdim[25][l]*f[155][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[150][l]+(0.3499271061118826*alpha_vdim[120][l]+0.3912303982179757*alpha_vdim[38][l]+0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[148][l]+0.4898979485566357*alpha_vdim[22][l]*f[147][l]+0.6123724356957944*(alpha_vdim[69][l]*f[146][l]+f[66][l]*alpha_vdim[129][l])+(0.4374088826398531*alpha_vdim[69][l]+0.6846531968814573*alpha_vdim[12][l])*f[126][l]+0.6123724356957944*alpha_vdim[69][l]*f[125][l]+0.5477225575051661*f[54][l]*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[6][l]*f[112][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[111][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[107][l]+0.5477225575051661*alpha_vdim[60][l]*f[106][l]+(0.5477225575051661*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[100][l]+(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[96][l]+0.6846531968814573*(alpha_vdim[32][l]*f[79][l]+f[42][l]*alpha_vdim[69][l])+0.6123724356957944*alpha_vdim[25][l]*f[67][l]+0.6846531968814573*alpha_vdim[44][l]*f[66][l]+0.6123724356957944*f[30][l]*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[22][l]*f[55][l]+0.6123724356957944*alpha_vdim[38][l]*f[54][l];
+    out[226][l] += (0.249947932937059*f[223][l]+0.3912303982179757*(f[167][l]+f[166][l])+0.2794502844414113*f[158][l]+0.6123724356957944*f[79][l]+0.4374088826398531*(f[71][l]+f[70][l])+0.6846531968814573*f[14][l])*alpha_vdim[606][l]+(0.249947932937059*f[222][l]+0.3912303982179757*(f[163][l]+f[162][l])+0.2794502844414113*f[161][l]+0.6123724356957944*f[76][l]+0.4374088826398531*(f[75][l]+f[74][l])+0.6846531968814573*f[15][l])*alpha_vdim[603][l]+(0.2794502844414113*f[192][l]+0.4374088826398531*(f[107][l]+f[106][l])+0.6846531968814573*f[30][l])*alpha_vdim[572][l]+(0.3499271061118826*f[196][l]+0.5477225575051661*f[111][l]+0.3912303982179757*f[102][l]+0.6123724356957944*f[26][l])*alpha_vdim[546][l]+(0.3499271061118826*f[195][l]+0.5477225575051661*f[112][l]+0.3912303982179757*f[101][l]+0.6123724356957944*f[27][l])*alpha_vdim[545][l]+(0.3499271061118826*f[194][l]+0.5477225575051661*f[108][l]+0.3912303982179757*f[105][l]+0.6123724356957944*f[28][l])*alpha_vdim[543][l]+(0.3499271061118826*f[193][l]+0.5477225575051661*f[109][l]+0.3912303982179757*f[104][l]+0.6123724356957944*f[29][l])*alpha_vdim[542][l]+(0.3912303982179757*f[223][l]+0.6123724356957944*f[166][l]+0.4374088826398531*f[158][l]+0.6846531968814573*f[70][l])*alpha_vdim[524][l]+(0.3912303982179757*f[223][l]+0.6123724356957944*f[167][l]+0.4374088826398531*f[158][l]+0.6846531968814573*f[71][l])*alpha_vdim[523][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[162][l]+0.4374088826398531*f[161][l]+0.6846531968814573*f[74][l])*alpha_vdim[520][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l]+0.4374088826398531*f[161][l]+0.6846531968814573*f[75][l])*alpha_vdim[519][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[518][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[517][l]+(0.4898979485566357*f[150][l]+0.5477225575051661*f[52][l])*alpha_vdim[508][l]+(0.4898979485566357*f[149][l]+0.5477225575051661*f[53][l])*alpha_vdim[507][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[106][l])*alpha_vdim[503][l]+(0.4374088826398531*f[192][l]+0.6846531968814573*f[107][l])*alpha_vdim[502][l]+(0.5477225575051661*f[195][l]+0.6123724356957944*f[101][l])*alpha_vdim[496][l]+(0.5477225575051661*f[196][l]+0.6123724356957944*f[102][l])*alpha_vdim[495][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[104][l])*alpha_vdim[494][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[105][l])*alpha_vdim[493][l]+0.5477225575051661*f[96][l]*alpha_vdim[492][l]+(0.6123724356957944*f[223][l]+0.6846531968814573*f[158][l])*alpha_vdim[490][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[161][l])*alpha_vdim[489][l]+0.6123724356957944*(f[147][l]*alpha_vdim[488][l]+f[148][l]*alpha_vdim[487][l])+0.6846531968814573*f[192][l]*alpha_vdim[486][l]+(0.1117801137765645*f[158][l]+0.1749635530559412*(f[71][l]+f[70][l])+0.273861278752583*f[14][l])*alpha_vdim[372][l]+(0.1117801137765645*f[233][l]+0.1749635530559412*(f[188][l]+f[187][l])+0.1249739664685295*f[186][l]+0.273861278752583*f[94][l]+0.1956151991089878*(f[93][l]+f[92][l])+0.3061862178478971*f[20][l])*alpha_vdim[360][l]+(0.1249739664685295*f[210][l]+0.1956151991089878*(f[138][l]+f[137][l])+0.3061862178478971*f[49][l])*alpha_vdim[329][l]+(0.1564921592871903*f[102][l]+0.2449489742783178*f[26][l])*alpha_vdim[312][l]+(0.1564921592871903*f[101][l]+0.2449489742783178*f[27][l])*alpha_vdim[311][l]+(0.1564921592871903*f[212][l]+0.2449489742783178*f[139][l]+0.1749635530559412*f[136][l]+0.273861278752583*f[47][l])*alpha_vdim[300][l]+(0.1564921592871903*f[211][l]+0.2449489742783178*f[140][l]+0.1749635530559412*f[135][l]+0.273861278752583*f[48][l])*alpha_vdim[299][l]+(0.1749635530559412*f[158][l]+0.273861278752583*f[70][l])*alpha_vdim[287][l]+(0.1749635530559412*f[158][l]+0.273861278752583*f[71][l])*alpha_vdim[286][l]+(0.1749635530559412*f[233][l]+0.273861278752583*f[187][l]+0.1956151991089878*f[186][l]+0.3061862178478971*f[92][l])*alpha_vdim[277][l]+(0.1749635530559412*f[233][l]+0.273861278752583*f[188][l]+0.1956151991089878*f[186][l]+0.3061862178478971*f[93][l])*alpha_vdim[276][l]+(0.1749635530559412*f[171][l]+0.273861278752583*f[81][l])*alpha_vdim[275][l]+(0.1749635530559412*f[170][l]+0.273861278752583*f[82][l])*alpha_vdim[274][l]+0.2190890230020664*f[52][l]*alpha_vdim[268][l]+(0.2190890230020664*f[172][l]+0.2449489742783178*f[80][l])*alpha_vdim[264][l]+(0.1956151991089878*f[210][l]+0.3061862178478971*f[137][l])*alpha_vdim[260][l]+(0.1956151991089878*f[210][l]+0.3061862178478971*f[138][l])*alpha_vdim[259][l]+0.2449489742783178*(f[101][l]*alpha_vdim[256][l]+f[102][l]*alpha_vdim[255][l])+(0.2449489742783178*f[211][l]+0.273861278752583*f[135][l])*alpha_vdim[251][l]+(0.2449489742783178*f[212][l]+0.273861278752583*f[136][l])*alpha_vdim[250][l]+0.2449489742783178*f[113][l]*alpha_vdim[249][l]+0.273861278752583*f[158][l]*alpha_vdim[248][l]+(0.6123724356957944*f[229][l]+0.6846531968814573*f[170][l])*alpha_cdim[247][l]+(0.273861278752583*f[233][l]+0.3061862178478971*f[186][l])*alpha_vdim[246][l]+0.273861278752583*(f[170][l]*alpha_vdim[245][l]+f[171][l]*alpha_vdim[244][l])+0.3061862178478971*f[210][l]*alpha_vdim[243][l]+0.6846531968814573*f[198][l]*alpha_cdim[243][l]+(0.1117801137765645*alpha_vdim[120][l]+0.1749635530559412*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.273861278752583*alpha_vdim[4][l])*f[234][l]+0.6123724356957944*alpha_cdim[3][l]*f[228][l]+(0.1564921592871903*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[217][l]+(0.1564921592871903*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[216][l]+(0.1249739664685295*alpha_vdim[86][l]+0.1956151991089878*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[213][l]+0.6846531968814573*alpha_cdim[0][l]*f[199][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[37][l])*f[190][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[189][l]+(0.1249739664685295*alpha_vdim[120][l]+0.1956151991089878*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.3061862178478971*alpha_vdim[4][l])*f[186][l]+0.2190890230020664*alpha_vdim[22][l]*f[179][l]+(0.1749635530559412*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[174][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[173][l]+(0.1117801137765645*alpha_vdim[129][l]+0.1749635530559412*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.273861278752583*alpha_vdim[5][l])*f[161][l]+0.2449489742783178*(alpha_vdim[59][l]*f[145][l]+alpha_vdim[60][l]*f[144][l])+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[142][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[141][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[136][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[135][l]+(0.1749635530559412*(f[75][l]+f[74][l])+0.273861278752583*f[15][l])*alpha_vdim[129][l]+(0.273861278752583*f[95][l]+0.1956151991089878*(f[93][l]+f[92][l])+0.3061862178478971*f[20][l])*alpha_vdim[120][l]+0.2449489742783178*alpha_vdim[6][l]*f[114][l]+(0.1564921592871903*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[105][l]+(0.1564921592871903*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[104][l]+0.3061862178478971*(alpha_vdim[37][l]*f[93][l]+alpha_vdim[38][l]*f[92][l]+f[50][l]*alpha_vdim[86][l])+0.273861278752583*(alpha_vdim[31][l]*f[84][l]+alpha_vdim[32][l]*f[83][l])+0.2449489742783178*alpha_vdim[22][l]*f[80][l]+0.273861278752583*(alpha_vdim[43][l]*f[75][l]+alpha_vdim[44][l]*f[74][l])+0.2449489742783178*(f[28][l]*alpha_vdim[69][l]+f[29][l]*alpha_vdim[68][l])+0.273861278752583*(f[47][l]*alpha_vdim[60][l]+f[48][l]*alpha_vdim[59][l])+0.2190890230020664*alpha_vdim[25][l]*f[53][l];
+    out[227][l] += (0.3499271061118826*f[224][l]+0.5477225575051661*f[169][l]+0.3912303982179757*f[159][l]+0.6123724356957944*f[73][l])*alpha_vdim[606][l]+(0.3499271061118826*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[603][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[572][l]+(0.4898979485566357*f[197][l]+0.5477225575051661*f[103][l])*alpha_vdim[546][l]+(0.3499271061118826*f[237][l]+0.5477225575051661*f[209][l]+0.3912303982179757*(f[208][l]+f[206][l])+0.6123724356957944*(f[134][l]+f[131][l])+0.4374088826398531*f[130][l]+0.6846531968814573*f[45][l])*alpha_vdim[545][l]+0.4898979485566357*f[96][l]*alpha_vdim[543][l]+(0.3499271061118826*f[192][l]+0.5477225575051661*f[107][l]+0.3912303982179757*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[542][l]+(0.5477225575051661*f[224][l]+0.6123724356957944*f[159][l])*alpha_vdim[524][l]+(0.3912303982179757*f[224][l]+0.6123724356957944*f[169][l]+0.4374088826398531*f[159][l]+0.6846531968814573*f[73][l])*alpha_vdim[523][l]+0.5477225575051661*f[147][l]*alpha_vdim[520][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[519][l]+0.5477225575051661*f[149][l]*alpha_vdim[518][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l]+0.4374088826398531*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[517][l]+(0.4898979485566357*f[225][l]+0.5477225575051661*(f[168][l]+f[160][l])+0.6123724356957944*f[72][l])*alpha_vdim[508][l]+(0.4898979485566357*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[507][l]+0.6123724356957944*f[193][l]*alpha_vdim[503][l]+(0.4374088826398531*f[193][l]+0.6846531968814573*f[109][l])*alpha_vdim[502][l]+(0.5477225575051661*f[237][l]+0.6123724356957944*(f[208][l]+f[206][l])+0.6846531968814573*f[130][l])*alpha_vdim[496][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[103][l])*alpha_vdim[495][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[494][l]+0.5477225575051661*f[96][l]*alpha_vdim[493][l]+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[492][l]+(0.6123724356957944*f[224][l]+0.6846531968814573*f[159][l])*alpha_vdim[490][l]+0.6123724356957944*f[147][l]*alpha_vdim[489][l]+(0.6123724356957944*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[488][l]+0.6123724356957944*f[149][l]*alpha_vdim[487][l]+0.6846531968814573*f[193][l]*alpha_vdim[486][l]+(0.1564921592871903*f[159][l]+0.2449489742783178*f[73][l])*alpha_vdim[372][l]+(0.1564921592871903*f[170][l]+0.2449489742783178*f[82][l])*alpha_vdim[360][l]+(0.1749635530559412*f[211][l]+0.273861278752583*f[140][l])*alpha_vdim[329][l]+0.2190890230020664*f[103][l]*alpha_vdim[312][l]+(0.1564921592871903*f[206][l]+0.2449489742783178*f[131][l]+0.1749635530559412*f[130][l]+0.273861278752583*f[45][l])*alpha_vdim[311][l]+0.2190890230020664*f[113][l]*alpha_vdim[300][l]+(0.1564921592871903*f[210][l]+0.2449489742783178*f[138][l]+0.1749635530559412*f[137][l]+0.273861278752583*f[49][l])*alpha_vdim[299][l]+0.2449489742783178*f[159][l]*alpha_vdim[287][l]+(0.1749635530559412*f[159][l]+0.273861278752583*f[73][l])*alpha_vdim[286][l]+0.2449489742783178*f[170][l]*alpha_vdim[277][l]+(0.1749635530559412*f[170][l]+0.273861278752583*f[82][l])*alpha_vdim[276][l]+0.2449489742783178*f[172][l]*alpha_vdim[275][l]+(0.1749635530559412*f[233][l]+0.273861278752583*f[188][l]+0.1956151991089878*f[187][l]+0.3061862178478971*f[94][l])*alpha_vdim[274][l]+(0.2190890230020664*f[160][l]+0.2449489742783178*f[72][l])*alpha_vdim[268][l]+(0.2190890230020664*f[171][l]+0.2449489742783178*f[81][l])*alpha_vdim[264][l]+0.273861278752583*f[211][l]*alpha_vdim[260][l]+(0.1956151991089878*f[211][l]+0.3061862178478971*f[140][l])*alpha_vdim[259][l]+(0.2449489742783178*f[206][l]+0.273861278752583*f[130][l])*alpha_vdim[256][l]+0.2449489742783178*f[103][l]*alpha_vdim[255][l]+(0.2449489742783178*f[210][l]+0.273861278752583*f[137][l])*alpha_vdim[251][l]+0.2449489742783178*(f[113][l]*alpha_vdim[250][l]+f[212][l]*alpha_vdim[249][l])+0.273861278752583*(f[139][l]*alpha_vdim[249][l]+f[159][l]*alpha_vdim[248][l])+(0.273861278752583*f[235][l]+0.3061862178478971*f[187][l])*alpha_cdim[247][l]+0.273861278752583*f[170][l]*alpha_vdim[246][l]+(0.273861278752583*f[233][l]+0.3061862178478971*f[187][l])*alpha_vdim[245][l]+0.273861278752583*f[172][l]*alpha_vdim[244][l]+0.3061862178478971*(f[211][l]*alpha_vdim[243][l]+f[214][l]*alpha_cdim[243][l])+(0.3499271061118826*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[239][l]+0.4898979485566357*alpha_vdim[22][l]*f[230][l]+(0.3499271061118826*alpha_vdim[120][l]+0.5477225575051661*alpha_vdim[38][l]+0.3912303982179757*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[229][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[226][l]+0.5477225575051661*alpha_vdim[59][l]*f[219][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[218][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[210][l]+(0.4898979485566357*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[201][l]+0.6846531968814573*alpha_cdim[0][l]*f[200][l]+0.5477225575051661*alpha_vdim[6][l]*f[199][l]+(0.3912303982179757*alpha_vdim[86][l]+0.6123724356957944*alpha_vdim[17][l]+0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[198][l]+(0.3499271061118826*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[192][l]+(0.5477225575051661*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])*f[181][l]+0.5477225575051661*alpha_vdim[22][l]*f[180][l]+0.6123724356957944*alpha_vdim[31][l]*f[176][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[175][l]+0.5477225575051661*alpha_vdim[22][l]*f[171][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l]+0.4374088826398531*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[170][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[151][l]+0.4898979485566357*alpha_vdim[25][l]*f[148][l]+(0.3499271061118826*alpha_vdim[129][l]+0.5477225575051661*alpha_vdim[44][l]+0.3912303982179757*alpha_vdim[43][l])*f[147][l]+0.6123724356957944*(alpha_vdim[5][l]*f[147][l]+alpha_vdim[59][l]*(f[146][l]+f[138][l]))+(0.4374088826398531*alpha_vdim[59][l]+0.6846531968814573*alpha_vdim[10][l])*f[137][l]+0.5477225575051661*f[55][l]*alpha_vdim[129][l]+0.6123724356957944*f[82][l]*alpha_vdim[120][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[116][l]+0.6123724356957944*alpha_vdim[6][l]*f[115][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[113][l]+0.5477225575051661*alpha_vdim[68][l]*f[107][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[106][l]+(0.4898979485566357*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[96][l]+0.6846531968814573*(alpha_vdim[31][l]*f[85][l]+alpha_vdim[37][l]*f[82][l])+0.6123724356957944*(alpha_vdim[22][l]*f[81][l]+f[30][l]*alpha_vdim[68][l])+0.6846531968814573*f[49][l]*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[43][l]*f[55][l]+0.5477225575051661*alpha_vdim[25][l]*f[54][l];
+    out[228][l] += (0.3499271061118826*f[225][l]+0.5477225575051661*f[168][l]+0.3912303982179757*f[160][l]+0.6123724356957944*f[72][l])*alpha_vdim[606][l]+(0.3499271061118826*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[603][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[572][l]+(0.3499271061118826*f[237][l]+0.3912303982179757*f[209][l]+0.5477225575051661*f[208][l]+0.3912303982179757*f[206][l]+0.6123724356957944*f[134][l]+0.4374088826398531*f[131][l]+0.6123724356957944*f[130][l]+0.6846531968814573*f[45][l])*alpha_vdim[546][l]+(0.4898979485566357*f[197][l]+0.5477225575051661*f[103][l])*alpha_vdim[545][l]+(0.3499271061118826*f[192][l]+0.3912303982179757*f[107][l]+0.5477225575051661*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[543][l]+0.4898979485566357*f[96][l]*alpha_vdim[542][l]+(0.3912303982179757*f[225][l]+0.6123724356957944*f[168][l]+0.4374088826398531*f[160][l]+0.6846531968814573*f[72][l])*alpha_vdim[524][l]+(0.5477225575051661*f[225][l]+0.6123724356957944*f[160][l])*alpha_vdim[523][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[520][l]+0.5477225575051661*f[148][l]*alpha_vdim[519][l]+(0.3912303982179757*f[222][l]+0.4374088826398531*f[163][l]+0.6123724356957944*f[162][l]+0.6846531968814573*f[76][l])*alpha_vdim[518][l]+0.5477225575051661*f[149][l]*alpha_vdim[517][l]+(0.4898979485566357*f[224][l]+0.5477225575051661*(f[169][l]+f[159][l])+0.6123724356957944*f[73][l])*alpha_vdim[508][l]+(0.4898979485566357*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[507][l]+(0.4374088826398531*f[194][l]+0.6846531968814573*f[108][l])*alpha_vdim[503][l]+0.6123724356957944*f[194][l]*alpha_vdim[502][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[103][l])*alpha_vdim[496][l]+(0.5477225575051661*f[237][l]+0.6123724356957944*(f[209][l]+f[206][l])+0.6846531968814573*f[131][l])*alpha_vdim[495][l]+0.5477225575051661*f[96][l]*alpha_vdim[494][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[493][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[492][l]+(0.6123724356957944*f[225][l]+0.6846531968814573*f[160][l])*alpha_vdim[490][l]+0.6123724356957944*(f[148][l]*alpha_vdim[489][l]+f[149][l]*alpha_vdim[488][l]+f[222][l]*alpha_vdim[487][l])+0.6846531968814573*(f[163][l]*alpha_vdim[487][l]+f[194][l]*alpha_vdim[486][l])+(0.1564921592871903*f[160][l]+0.2449489742783178*f[72][l])*alpha_vdim[372][l]+(0.1564921592871903*f[171][l]+0.2449489742783178*f[81][l])*alpha_vdim[360][l]+(0.1749635530559412*f[212][l]+0.273861278752583*f[139][l])*alpha_vdim[329][l]+(0.1564921592871903*f[206][l]+0.1749635530559412*f[131][l]+0.2449489742783178*f[130][l]+0.273861278752583*f[45][l])*alpha_vdim[312][l]+0.2190890230020664*f[103][l]*alpha_vdim[311][l]+(0.1564921592871903*f[210][l]+0.1749635530559412*f[138][l]+0.2449489742783178*f[137][l]+0.273861278752583*f[49][l])*alpha_vdim[300][l]+0.2190890230020664*f[113][l]*alpha_vdim[299][l]+(0.1749635530559412*f[160][l]+0.273861278752583*f[72][l])*alpha_vdim[287][l]+0.2449489742783178*f[160][l]*alpha_vdim[286][l]+(0.1749635530559412*f[171][l]+0.273861278752583*f[81][l])*alpha_vdim[277][l]+0.2449489742783178*f[171][l]*alpha_vdim[276][l]+(0.1749635530559412*f[233][l]+0.1956151991089878*f[188][l]+0.273861278752583*f[187][l]+0.3061862178478971*f[94][l])*alpha_vdim[275][l]+0.2449489742783178*f[172][l]*alpha_vdim[274][l]+(0.2190890230020664*f[159][l]+0.2449489742783178*f[73][l])*alpha_vdim[268][l]+(0.2190890230020664*f[170][l]+0.2449489742783178*f[82][l])*alpha_vdim[264][l]+(0.1956151991089878*f[212][l]+0.3061862178478971*f[139][l])*alpha_vdim[260][l]+0.273861278752583*f[212][l]*alpha_vdim[259][l]+0.2449489742783178*f[103][l]*alpha_vdim[256][l]+(0.2449489742783178*f[206][l]+0.273861278752583*f[131][l])*alpha_vdim[255][l]+0.2449489742783178*f[113][l]*alpha_vdim[251][l]+(0.2449489742783178*f[210][l]+0.273861278752583*f[138][l])*alpha_vdim[250][l]+0.2449489742783178*f[211][l]*alpha_vdim[249][l]+0.273861278752583*(f[140][l]*alpha_vdim[249][l]+f[160][l]*alpha_vdim[248][l])+(0.6123724356957944*f[231][l]+0.6846531968814573*f[172][l])*alpha_cdim[247][l]+0.273861278752583*(f[171][l]*alpha_vdim[246][l]+f[172][l]*alpha_vdim[245][l]+f[233][l]*alpha_vdim[244][l])+0.3061862178478971*(f[188][l]*alpha_vdim[244][l]+f[212][l]*alpha_vdim[243][l])+0.6846531968814573*f[200][l]*alpha_cdim[243][l]+(0.3499271061118826*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[239][l]+(0.3499271061118826*alpha_vdim[120][l]+0.3912303982179757*alpha_vdim[38][l]+0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[230][l]+0.4898979485566357*alpha_vdim[22][l]*f[229][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[226][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[219][l]+0.5477225575051661*alpha_vdim[60][l]*f[218][l]+0.3061862178478971*alpha_cdim[0][l]*f[215][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[210][l]+(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[201][l]+(0.3912303982179757*alpha_vdim[86][l]+0.4374088826398531*alpha_vdim[17][l]+0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[199][l]+0.5477225575051661*alpha_vdim[6][l]*f[198][l]+0.3499271061118826*alpha_vdim[69][l]*f[192][l]+0.5477225575051661*(alpha_vdim[12][l]*f[192][l]+alpha_vdim[22][l]*f[181][l])+(0.5477225575051661*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[180][l]+(0.4374088826398531*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[176][l]+0.6123724356957944*alpha_vdim[32][l]*f[175][l]+(0.3912303982179757*alpha_vdim[120][l]+0.4374088826398531*alpha_vdim[38][l]+0.6123724356957944*alpha_vdim[37][l]+0.6846531968814573*alpha_vdim[4][l])*f[171][l]+0.5477225575051661*alpha_vdim[22][l]*f[170][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[151][l]+(0.3499271061118826*alpha_vdim[129][l]+0.3912303982179757*alpha_vdim[44][l]+0.5477225575051661*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[148][l]+0.4898979485566357*alpha_vdim[25][l]*f[147][l]+0.6123724356957944*alpha_vdim[60][l]*f[146][l]+(0.4374088826398531*alpha_vdim[60][l]+0.6846531968814573*alpha_vdim[9][l])*f[138][l]+0.6123724356957944*alpha_vdim[60][l]*f[137][l]+0.5477225575051661*f[54][l]*alpha_vdim[129][l]+0.6123724356957944*(f[81][l]*alpha_vdim[120][l]+alpha_vdim[6][l]*f[116][l])+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[115][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[113][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[107][l]+0.5477225575051661*alpha_vdim[69][l]*f[106][l]+(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[96][l]+0.6846531968814573*alpha_vdim[32][l]*f[85][l]+0.6123724356957944*alpha_vdim[22][l]*f[82][l]+0.6846531968814573*alpha_vdim[38][l]*f[81][l]+0.6123724356957944*f[30][l]*alpha_vdim[69][l]+0.6846531968814573*f[49][l]*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[25][l]*f[55][l]+0.6123724356957944*alpha_vdim[44][l]*f[54][l];
+    out[229][l] += (0.3499271061118826*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[606][l]+(0.3499271061118826*f[224][l]+0.5477225575051661*f[169][l]+0.3912303982179757*f[164][l]+0.6123724356957944*f[78][l])*alpha_vdim[603][l]+(0.3912303982179757*f[195][l]+0.6123724356957944*f[112][l])*alpha_vdim[572][l]+0.4898979485566357*f[96][l]*alpha_vdim[546][l]+(0.3499271061118826*f[192][l]+0.5477225575051661*f[107][l]+0.3912303982179757*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[545][l]+(0.4898979485566357*f[197][l]+0.5477225575051661*f[110][l])*alpha_vdim[543][l]+(0.3499271061118826*f[237][l]+0.5477225575051661*f[209][l]+0.3912303982179757*(f[208][l]+f[207][l])+0.6123724356957944*(f[134][l]+f[133][l])+0.4374088826398531*f[132][l]+0.6846531968814573*f[46][l])*alpha_vdim[542][l]+0.5477225575051661*f[147][l]*alpha_vdim[524][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[523][l]+(0.5477225575051661*f[224][l]+0.6123724356957944*f[164][l])*alpha_vdim[520][l]+(0.3912303982179757*f[224][l]+0.6123724356957944*f[169][l]+0.4374088826398531*f[164][l]+0.6846531968814573*f[78][l])*alpha_vdim[519][l]+0.5477225575051661*f[150][l]*alpha_vdim[518][l]+(0.3912303982179757*f[223][l]+0.6123724356957944*f[167][l]+0.4374088826398531*f[166][l]+0.6846531968814573*f[79][l])*alpha_vdim[517][l]+(0.4898979485566357*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[508][l]+(0.4898979485566357*f[225][l]+0.5477225575051661*(f[168][l]+f[165][l]))*alpha_vdim[507][l]+0.6123724356957944*(f[77][l]*alpha_vdim[507][l]+f[195][l]*alpha_vdim[503][l])+(0.4374088826398531*f[195][l]+0.6846531968814573*f[112][l])*alpha_vdim[502][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[496][l]+0.5477225575051661*f[96][l]*alpha_vdim[495][l]+(0.5477225575051661*f[237][l]+0.6123724356957944*(f[208][l]+f[207][l])+0.6846531968814573*f[132][l])*alpha_vdim[494][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[110][l])*alpha_vdim[493][l]+0.5477225575051661*f[196][l]*alpha_vdim[492][l]+0.6123724356957944*(f[111][l]*alpha_vdim[492][l]+f[147][l]*alpha_vdim[490][l])+(0.6123724356957944*f[224][l]+0.6846531968814573*f[164][l])*alpha_vdim[489][l]+(0.6123724356957944*f[223][l]+0.6846531968814573*f[166][l])*alpha_vdim[488][l]+0.6123724356957944*f[150][l]*alpha_vdim[487][l]+0.6846531968814573*f[195][l]*alpha_vdim[486][l]+(0.3499271061118826*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[372][l]+(0.3499271061118826*f[227][l]+0.5477225575051661*f[178][l]+0.3912303982179757*f[173][l]+0.6123724356957944*f[84][l])*alpha_vdim[360][l]+(0.3912303982179757*f[198][l]+0.6123724356957944*f[116][l])*alpha_vdim[329][l]+0.4898979485566357*f[96][l]*alpha_vdim[312][l]+(0.3499271061118826*f[192][l]+0.5477225575051661*f[107][l]+0.3912303982179757*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[311][l]+(0.4898979485566357*f[200][l]+0.5477225575051661*f[114][l])*alpha_vdim[300][l]+(0.3499271061118826*f[238][l]+0.5477225575051661*f[215][l]+0.3912303982179757*(f[214][l]+f[213][l])+0.6123724356957944*(f[143][l]+f[142][l])+0.4374088826398531*f[141][l]+0.6846531968814573*f[50][l])*alpha_vdim[299][l]+0.5477225575051661*f[147][l]*alpha_vdim[287][l]+(0.3912303982179757*f[147][l]+0.6123724356957944*f[55][l])*alpha_vdim[286][l]+(0.5477225575051661*f[227][l]+0.6123724356957944*f[173][l])*alpha_vdim[277][l]+(0.3912303982179757*f[227][l]+0.6123724356957944*f[178][l]+0.4374088826398531*f[173][l]+0.6846531968814573*f[84][l])*alpha_vdim[276][l]+0.5477225575051661*f[151][l]*alpha_vdim[275][l]+(0.3912303982179757*f[226][l]+0.6123724356957944*f[176][l]+0.4374088826398531*f[175][l]+0.6846531968814573*f[85][l])*alpha_vdim[274][l]+(0.4898979485566357*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[268][l]+(0.4898979485566357*f[228][l]+0.5477225575051661*(f[177][l]+f[174][l]))*alpha_vdim[264][l]+0.6123724356957944*(f[83][l]*alpha_vdim[264][l]+f[198][l]*alpha_vdim[260][l])+(0.4374088826398531*f[198][l]+0.6846531968814573*f[116][l])*alpha_vdim[259][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[256][l]+0.5477225575051661*f[96][l]*alpha_vdim[255][l]+(0.5477225575051661*f[238][l]+0.6123724356957944*(f[214][l]+f[213][l])+0.6846531968814573*f[141][l])*alpha_vdim[251][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[114][l])*alpha_vdim[250][l]+0.5477225575051661*f[199][l]*alpha_vdim[249][l]+0.6123724356957944*(f[115][l]*alpha_vdim[249][l]+f[147][l]*alpha_vdim[248][l])+0.273861278752583*f[175][l]*alpha_cdim[247][l]+(0.6123724356957944*f[227][l]+0.6846531968814573*f[173][l])*alpha_vdim[246][l]+(0.6123724356957944*f[226][l]+0.6846531968814573*f[175][l])*alpha_vdim[245][l]+0.6123724356957944*f[151][l]*alpha_vdim[244][l]+0.6846531968814573*f[198][l]*alpha_vdim[243][l]+0.3061862178478971*f[218][l]*alpha_cdim[243][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[234][l]+0.6123724356957944*alpha_cdim[3][l]*f[231][l]+0.2449489742783178*alpha_vdim[6][l]*f[217][l]+(0.1749635530559412*alpha_vdim[86][l]+0.273861278752583*alpha_vdim[17][l]+0.1956151991089878*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[216][l]+(0.1564921592871903*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[213][l]+(0.1564921592871903*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[207][l]+0.6846531968814573*alpha_cdim[0][l]*f[201][l]+0.273861278752583*alpha_vdim[31][l]*f[190][l]+(0.1956151991089878*alpha_vdim[31][l]+0.3061862178478971*alpha_vdim[2][l])*f[189][l]+(0.2449489742783178*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[179][l]+0.2190890230020664*alpha_vdim[22][l]*f[174][l]+(0.1564921592871903*alpha_vdim[120][l]+0.2449489742783178*alpha_vdim[38][l]+0.1749635530559412*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[173][l]+0.2190890230020664*alpha_vdim[25][l]*f[165][l]+(0.1564921592871903*alpha_vdim[129][l]+0.2449489742783178*alpha_vdim[44][l]+0.1749635530559412*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[164][l]+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[145][l]+0.273861278752583*alpha_vdim[6][l]*f[144][l]+0.2449489742783178*alpha_vdim[59][l]*f[142][l]+(0.1749635530559412*alpha_vdim[59][l]+0.273861278752583*alpha_vdim[10][l])*f[141][l]+0.2449489742783178*alpha_vdim[68][l]*f[133][l]+(0.1749635530559412*alpha_vdim[68][l]+0.273861278752583*alpha_vdim[13][l])*f[132][l]+0.2449489742783178*(f[78][l]*alpha_vdim[129][l]+f[84][l]*alpha_vdim[120][l])+(0.2190890230020664*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[114][l]+(0.2190890230020664*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[110][l]+0.3061862178478971*alpha_vdim[31][l]*f[95][l]+0.273861278752583*alpha_vdim[37][l]*f[84][l]+0.2449489742783178*alpha_vdim[22][l]*f[83][l]+0.273861278752583*alpha_vdim[43][l]*f[78][l]+0.2449489742783178*alpha_vdim[25][l]*f[77][l]+0.273861278752583*(f[46][l]*alpha_vdim[68][l]+f[50][l]*alpha_vdim[59][l]);
+    out[230][l] += (0.3499271061118826*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[606][l]+(0.3499271061118826*f[225][l]+0.5477225575051661*f[168][l]+0.3912303982179757*f[165][l]+0.6123724356957944*f[77][l])*alpha_vdim[603][l]+(0.3912303982179757*f[196][l]+0.6123724356957944*f[111][l])*alpha_vdim[572][l]+(0.3499271061118826*f[192][l]+0.3912303982179757*f[107][l]+0.5477225575051661*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[546][l]+0.4898979485566357*f[96][l]*alpha_vdim[545][l]+(0.3499271061118826*f[237][l]+0.3912303982179757*f[209][l]+0.5477225575051661*f[208][l]+0.3912303982179757*f[207][l]+0.6123724356957944*f[134][l]+0.4374088826398531*f[133][l]+0.6123724356957944*f[132][l]+0.6846531968814573*f[46][l])*alpha_vdim[543][l]+(0.4898979485566357*f[197][l]+0.5477225575051661*f[110][l])*alpha_vdim[542][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[524][l]+0.5477225575051661*f[148][l]*alpha_vdim[523][l]+(0.3912303982179757*f[225][l]+0.6123724356957944*f[168][l]+0.4374088826398531*f[165][l]+0.6846531968814573*f[77][l])*alpha_vdim[520][l]+(0.5477225575051661*f[225][l]+0.6123724356957944*f[165][l])*alpha_vdim[519][l]+(0.3912303982179757*f[223][l]+0.4374088826398531*f[167][l]+0.6123724356957944*f[166][l]+0.6846531968814573*f[79][l])*alpha_vdim[518][l]+0.5477225575051661*f[150][l]*alpha_vdim[517][l]+(0.4898979485566357*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[508][l]+(0.4898979485566357*f[224][l]+0.5477225575051661*(f[169][l]+f[164][l])+0.6123724356957944*f[78][l])*alpha_vdim[507][l]+(0.4374088826398531*f[196][l]+0.6846531968814573*f[111][l])*alpha_vdim[503][l]+0.6123724356957944*f[196][l]*alpha_vdim[502][l]+0.5477225575051661*f[96][l]*alpha_vdim[496][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[495][l]+(0.5477225575051661*f[197][l]+0.6123724356957944*f[110][l])*alpha_vdim[494][l]+(0.5477225575051661*f[237][l]+0.6123724356957944*(f[209][l]+f[207][l])+0.6846531968814573*f[133][l])*alpha_vdim[493][l]+0.5477225575051661*f[195][l]*alpha_vdim[492][l]+0.6123724356957944*(f[112][l]*alpha_vdim[492][l]+f[148][l]*alpha_vdim[490][l])+(0.6123724356957944*f[225][l]+0.6846531968814573*f[165][l])*alpha_vdim[489][l]+0.6123724356957944*(f[150][l]*alpha_vdim[488][l]+f[223][l]*alpha_vdim[487][l])+0.6846531968814573*(f[167][l]*alpha_vdim[487][l]+f[196][l]*alpha_vdim[486][l])+(0.3499271061118826*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[372][l]+(0.3499271061118826*f[228][l]+0.5477225575051661*f[177][l]+0.3912303982179757*f[174][l]+0.6123724356957944*f[83][l])*alpha_vdim[360][l]+(0.3912303982179757*f[199][l]+0.6123724356957944*f[115][l])*alpha_vdim[329][l]+(0.3499271061118826*f[192][l]+0.3912303982179757*f[107][l]+0.5477225575051661*f[106][l]+0.6123724356957944*f[30][l])*alpha_vdim[312][l]+0.4898979485566357*f[96][l]*alpha_vdim[311][l]+(0.3499271061118826*f[238][l]+0.3912303982179757*f[215][l]+0.5477225575051661*f[214][l]+0.3912303982179757*f[213][l]+0.6123724356957944*f[143][l]+0.4374088826398531*f[142][l]+0.6123724356957944*f[141][l]+0.6846531968814573*f[50][l])*alpha_vdim[300][l]+(0.4898979485566357*f[200][l]+0.5477225575051661*f[114][l])*alpha_vdim[299][l]+(0.3912303982179757*f[148][l]+0.6123724356957944*f[54][l])*alpha_vdim[287][l]+0.5477225575051661*f[148][l]*alpha_vdim[286][l]+(0.3912303982179757*f[228][l]+0.6123724356957944*f[177][l]+0.4374088826398531*f[174][l]+0.6846531968814573*f[83][l])*alpha_vdim[277][l]+(0.5477225575051661*f[228][l]+0.6123724356957944*f[174][l])*alpha_vdim[276][l]+(0.3912303982179757*f[226][l]+0.4374088826398531*f[176][l]+0.6123724356957944*f[175][l]+0.6846531968814573*f[85][l])*alpha_vdim[275][l]+0.5477225575051661*f[151][l]*alpha_vdim[274][l]+(0.4898979485566357*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[268][l]+(0.4898979485566357*f[227][l]+0.5477225575051661*(f[178][l]+f[173][l])+0.6123724356957944*f[84][l])*alpha_vdim[264][l]+(0.4374088826398531*f[199][l]+0.6846531968814573*f[115][l])*alpha_vdim[260][l]+0.6123724356957944*f[199][l]*alpha_vdim[259][l]+0.5477225575051661*f[96][l]*alpha_vdim[256][l]+(0.5477225575051661*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[255][l]+(0.5477225575051661*f[200][l]+0.6123724356957944*f[114][l])*alpha_vdim[251][l]+(0.5477225575051661*f[238][l]+0.6123724356957944*(f[215][l]+f[213][l])+0.6846531968814573*f[142][l])*alpha_vdim[250][l]+0.5477225575051661*f[198][l]*alpha_vdim[249][l]+0.6123724356957944*(f[116][l]*alpha_vdim[249][l]+f[148][l]*alpha_vdim[248][l]+f[151][l]*alpha_cdim[247][l])+(0.6123724356957944*f[228][l]+0.6846531968814573*f[174][l])*alpha_vdim[246][l]+0.6123724356957944*(f[151][l]*alpha_vdim[245][l]+f[226][l]*alpha_vdim[244][l])+0.6846531968814573*(f[176][l]*alpha_vdim[244][l]+f[199][l]*alpha_vdim[243][l]+f[201][l]*alpha_cdim[243][l])+0.273861278752583*alpha_cdim[3][l]*f[236][l]+(0.1749635530559412*alpha_vdim[32][l]+0.273861278752583*alpha_vdim[1][l])*f[234][l]+0.3061862178478971*alpha_cdim[0][l]*f[219][l]+(0.1749635530559412*alpha_vdim[86][l]+0.1956151991089878*alpha_vdim[17][l]+0.273861278752583*alpha_vdim[16][l]+0.3061862178478971*alpha_vdim[0][l])*f[217][l]+0.2449489742783178*alpha_vdim[6][l]*f[216][l]+(0.1564921592871903*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[213][l]+(0.1564921592871903*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[207][l]+(0.1956151991089878*alpha_vdim[32][l]+0.3061862178478971*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[190][l]+0.273861278752583*alpha_vdim[32][l]*f[189][l]+(0.2449489742783178*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[179][l]+(0.1564921592871903*alpha_vdim[120][l]+0.1749635530559412*alpha_vdim[38][l]+0.2449489742783178*alpha_vdim[37][l]+0.273861278752583*alpha_vdim[4][l])*f[174][l]+0.2190890230020664*alpha_vdim[22][l]*f[173][l]+(0.1564921592871903*alpha_vdim[129][l]+0.1749635530559412*alpha_vdim[44][l]+0.2449489742783178*alpha_vdim[43][l]+0.273861278752583*alpha_vdim[5][l])*f[165][l]+0.2190890230020664*alpha_vdim[25][l]*f[164][l]+0.273861278752583*alpha_vdim[6][l]*f[145][l]+(0.273861278752583*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[144][l]+(0.1749635530559412*alpha_vdim[60][l]+0.273861278752583*alpha_vdim[9][l])*f[142][l]+0.2449489742783178*alpha_vdim[60][l]*f[141][l]+(0.1749635530559412*alpha_vdim[69][l]+0.273861278752583*alpha_vdim[12][l])*f[133][l]+0.2449489742783178*(alpha_vdim[69][l]*f[132][l]+f[77][l]*alpha_vdim[129][l]+f[83][l]*alpha_vdim[120][l])+(0.2190890230020664*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[114][l]+(0.2190890230020664*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[110][l]+0.3061862178478971*alpha_vdim[32][l]*f[95][l]+0.2449489742783178*alpha_vdim[22][l]*f[84][l]+0.273861278752583*alpha_vdim[38][l]*f[83][l]+0.2449489742783178*alpha_vdim[25][l]*f[78][l]+0.273861278752583*(alpha_vdim[44][l]*f[77][l]+f[46][l]*alpha_vdim[69][l]+f[50][l]*alpha_vdim[60][l]);
+    out[231][l] += 0.4898979485566357*(f[149][l]*alpha_vdim[606][l]+f[150][l]*alpha_vdim[603][l])+0.5477225575051661*f[197][l]*alpha_vdim[572][l]+(0.4898979485566357*f[193][l]+0.5477225575051661*f[109][l])*alpha_vdim[546][l]+(0.4898979485566357*f[194][l]+0.5477225575051661*f[108][l])*alpha_vdim[545][l]+(0.4898979485566357*f[195][l]+0.5477225575051661*f[112][l])*alpha_vdim[543][l]+0.4898979485566357*f[196][l]*alpha_vdim[542][l]+0.5477225575051661*(f[111][l]*alpha_vdim[542][l]+f[149][l]*(alpha_vdim[524][l]+alpha_vdim[523][l])+f[150][l]*(alpha_vdim[520][l]+alpha_vdim[519][l]))+(0.5477225575051661*f[224][l]+0.6123724356957944*f[169][l])*alpha_vdim[518][l]+(0.5477225575051661*f[225][l]+0.6123724356957944*f[168][l])*alpha_vdim[517][l]+(0.4898979485566357*f[222][l]+0.5477225575051661*(f[163][l]+f[162][l])+0.6123724356957944*f[76][l])*alpha_vdim[508][l]+(0.4898979485566357*f[223][l]+0.5477225575051661*(f[167][l]+f[166][l]))*alpha_vdim[507][l]+0.6123724356957944*(f[79][l]*alpha_vdim[507][l]+f[197][l]*(alpha_vdim[503][l]+alpha_vdim[502][l]))+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[496][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[495][l]+(0.5477225575051661*f[196][l]+0.6123724356957944*f[111][l])*alpha_vdim[494][l]+(0.5477225575051661*f[195][l]+0.6123724356957944*f[112][l])*alpha_vdim[493][l]+(0.5477225575051661*f[237][l]+0.6123724356957944*(f[209][l]+f[208][l])+0.6846531968814573*f[134][l])*alpha_vdim[492][l]+0.6123724356957944*(f[149][l]*alpha_vdim[490][l]+f[150][l]*alpha_vdim[489][l])+(0.6123724356957944*f[225][l]+0.6846531968814573*f[168][l])*alpha_vdim[488][l]+0.6123724356957944*f[224][l]*alpha_vdim[487][l]+0.6846531968814573*(f[169][l]*alpha_vdim[487][l]+f[197][l]*alpha_vdim[486][l])+0.4898979485566357*(f[149][l]*alpha_vdim[372][l]+f[151][l]*alpha_vdim[360][l])+0.5477225575051661*f[200][l]*alpha_vdim[329][l]+(0.4898979485566357*f[193][l]+0.5477225575051661*f[109][l])*alpha_vdim[312][l]+(0.4898979485566357*f[194][l]+0.5477225575051661*f[108][l])*alpha_vdim[311][l]+(0.4898979485566357*f[198][l]+0.5477225575051661*f[116][l])*alpha_vdim[300][l]+0.4898979485566357*f[199][l]*alpha_vdim[299][l]+0.5477225575051661*(f[115][l]*alpha_vdim[299][l]+f[149][l]*(alpha_vdim[287][l]+alpha_vdim[286][l])+f[151][l]*(alpha_vdim[277][l]+alpha_vdim[276][l]))+(0.5477225575051661*f[227][l]+0.6123724356957944*f[178][l])*alpha_vdim[275][l]+(0.5477225575051661*f[228][l]+0.6123724356957944*f[177][l])*alpha_vdim[274][l]+(0.4898979485566357*f[222][l]+0.5477225575051661*(f[163][l]+f[162][l])+0.6123724356957944*f[76][l])*alpha_vdim[268][l]+(0.4898979485566357*f[226][l]+0.5477225575051661*(f[176][l]+f[175][l]))*alpha_vdim[264][l]+0.6123724356957944*(f[85][l]*alpha_vdim[264][l]+f[200][l]*(alpha_vdim[260][l]+alpha_vdim[259][l]))+(0.5477225575051661*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[256][l]+(0.5477225575051661*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[255][l]+(0.5477225575051661*f[199][l]+0.6123724356957944*f[115][l])*alpha_vdim[251][l]+(0.5477225575051661*f[198][l]+0.6123724356957944*f[116][l])*alpha_vdim[250][l]+(0.5477225575051661*f[238][l]+0.6123724356957944*(f[215][l]+f[214][l])+0.6846531968814573*f[143][l])*alpha_vdim[249][l]+0.6123724356957944*f[149][l]*alpha_vdim[248][l]+0.273861278752583*f[177][l]*alpha_cdim[247][l]+0.6123724356957944*f[151][l]*alpha_vdim[246][l]+(0.6123724356957944*f[228][l]+0.6846531968814573*f[177][l])*alpha_vdim[245][l]+0.6123724356957944*f[227][l]*alpha_vdim[244][l]+0.6846531968814573*(f[178][l]*alpha_vdim[244][l]+f[200][l]*alpha_vdim[243][l])+0.3061862178478971*f[220][l]*alpha_cdim[243][l]+0.5477225575051661*alpha_vdim[6][l]*f[239][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[230][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[229][l]+0.4898979485566357*(alpha_vdim[22][l]*f[226][l]+alpha_vdim[25][l]*f[223][l])+0.3061862178478971*alpha_cdim[0][l]*f[221][l]+0.6123724356957944*alpha_vdim[6][l]*(f[219][l]+f[218][l])+(0.5477225575051661*alpha_vdim[86][l]+0.6123724356957944*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[201][l]+(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[199][l]+(0.4898979485566357*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[198][l]+(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[196][l]+(0.4898979485566357*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[195][l]+(0.6123724356957944*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[181][l]+(0.6123724356957944*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[180][l]+0.5477225575051661*(alpha_vdim[22][l]*(f[176][l]+f[175][l])+alpha_vdim[25][l]*(f[167][l]+f[166][l]))+(0.4898979485566357*alpha_vdim[120][l]+0.5477225575051661*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[151][l]+(0.4898979485566357*alpha_vdim[129][l]+0.5477225575051661*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[150][l]+0.6846531968814573*alpha_vdim[6][l]*f[146][l]+(0.5477225575051661*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[116][l]+(0.5477225575051661*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[115][l]+(0.5477225575051661*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[112][l]+0.5477225575051661*alpha_vdim[68][l]*f[111][l]+0.6123724356957944*(alpha_vdim[13][l]*f[111][l]+alpha_vdim[22][l]*f[85][l]+alpha_vdim[25][l]*f[79][l]);
+    out[232][l] += (0.2794502844414113*f[222][l]+0.4374088826398531*(f[163][l]+f[162][l])+0.6846531968814573*f[76][l])*alpha_vdim[372][l]+(0.249947932937059*f[152][l]+0.3912303982179757*(f[62][l]+f[61][l])+0.6123724356957944*f[11][l])*alpha_vdim[360][l]+(0.2794502844414113*f[202][l]+0.4374088826398531*(f[122][l]+f[121][l])+0.6846531968814573*f[39][l])*alpha_vdim[329][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[312][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[311][l]+(0.3499271061118826*f[98][l]+0.5477225575051661*f[23][l])*alpha_vdim[300][l]+(0.3499271061118826*f[97][l]+0.5477225575051661*f[24][l])*alpha_vdim[299][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[287][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[286][l]+(0.3912303982179757*f[152][l]+0.6123724356957944*f[61][l])*alpha_vdim[277][l]+(0.3912303982179757*f[152][l]+0.6123724356957944*f[62][l])*alpha_vdim[276][l]+(0.3912303982179757*f[154][l]+0.6123724356957944*f[63][l])*alpha_vdim[275][l]+(0.3912303982179757*f[153][l]+0.6123724356957944*f[64][l])*alpha_vdim[274][l]+0.5477225575051661*f[149][l]*alpha_vdim[268][l]+0.4898979485566357*f[51][l]*alpha_vdim[264][l]+(0.4374088826398531*f[202][l]+0.6846531968814573*f[121][l])*alpha_vdim[260][l]+(0.4374088826398531*f[202][l]+0.6846531968814573*f[122][l])*alpha_vdim[259][l]+0.6123724356957944*(f[193][l]*alpha_vdim[256][l]+f[194][l]*alpha_vdim[255][l])+0.5477225575051661*(f[97][l]*alpha_vdim[251][l]+f[98][l]*alpha_vdim[250][l]+f[99][l]*alpha_vdim[249][l])+0.6846531968814573*f[222][l]*alpha_vdim[248][l]+0.6123724356957944*(f[153][l]*alpha_cdim[247][l]+f[152][l]*alpha_vdim[246][l]+f[153][l]*alpha_vdim[245][l]+f[154][l]*alpha_vdim[244][l])+0.6846531968814573*(f[202][l]*alpha_vdim[243][l]+f[204][l]*alpha_cdim[243][l])+(0.2794502844414113*alpha_vdim[129][l]+0.4374088826398531*(alpha_vdim[44][l]+alpha_vdim[43][l]))*f[223][l]+0.6846531968814573*(alpha_vdim[5][l]*f[223][l]+alpha_cdim[0][l]*f[205][l])+(0.2794502844414113*alpha_vdim[86][l]+0.4374088826398531*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[203][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[196][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[195][l]+(0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[43][l])*f[167][l]+(0.4374088826398531*alpha_vdim[129][l]+0.6846531968814573*alpha_vdim[44][l])*f[166][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[156][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[155][l]+(0.249947932937059*alpha_vdim[120][l]+0.3912303982179757*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[152][l]+0.5477225575051661*alpha_vdim[25][l]*f[150][l]+0.6846531968814573*f[79][l]*alpha_vdim[129][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[126][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[125][l]+0.3912303982179757*(f[62][l]+f[61][l])*alpha_vdim[120][l]+0.6123724356957944*(f[11][l]*alpha_vdim[120][l]+alpha_vdim[68][l]*f[112][l]+alpha_vdim[69][l]*f[111][l])+0.5477225575051661*alpha_vdim[6][l]*f[100][l]+(0.3499271061118826*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[98][l]+(0.3499271061118826*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[97][l]+0.6846531968814573*f[42][l]*alpha_vdim[86][l]+0.6123724356957944*(alpha_vdim[31][l]*f[67][l]+alpha_vdim[32][l]*f[66][l]+alpha_vdim[37][l]*f[62][l]+alpha_vdim[38][l]*f[61][l])+0.5477225575051661*(f[23][l]*alpha_vdim[60][l]+f[24][l]*alpha_vdim[59][l])+0.4898979485566357*alpha_vdim[22][l]*f[51][l];
+    out[233][l] += (0.2794502844414113*f[222][l]+0.4374088826398531*(f[163][l]+f[162][l])+0.6846531968814573*f[76][l])*alpha_vdim[606][l]+(0.249947932937059*f[158][l]+0.3912303982179757*(f[71][l]+f[70][l])+0.6123724356957944*f[14][l])*alpha_vdim[603][l]+(0.2794502844414113*f[206][l]+0.4374088826398531*(f[131][l]+f[130][l])+0.6846531968814573*f[45][l])*alpha_vdim[572][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[546][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[545][l]+(0.3499271061118826*f[102][l]+0.5477225575051661*f[26][l])*alpha_vdim[543][l]+(0.3499271061118826*f[101][l]+0.5477225575051661*f[27][l])*alpha_vdim[542][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[524][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[523][l]+(0.3912303982179757*f[158][l]+0.6123724356957944*f[70][l])*alpha_vdim[520][l]+(0.3912303982179757*f[158][l]+0.6123724356957944*f[71][l])*alpha_vdim[519][l]+(0.3912303982179757*f[160][l]+0.6123724356957944*f[72][l])*alpha_vdim[518][l]+(0.3912303982179757*f[159][l]+0.6123724356957944*f[73][l])*alpha_vdim[517][l]+0.5477225575051661*f[149][l]*alpha_vdim[508][l]+0.4898979485566357*f[52][l]*alpha_vdim[507][l]+(0.4374088826398531*f[206][l]+0.6846531968814573*f[130][l])*alpha_vdim[503][l]+(0.4374088826398531*f[206][l]+0.6846531968814573*f[131][l])*alpha_vdim[502][l]+0.6123724356957944*(f[193][l]*alpha_vdim[496][l]+f[194][l]*alpha_vdim[495][l])+0.5477225575051661*(f[101][l]*alpha_vdim[494][l]+f[102][l]*alpha_vdim[493][l]+f[103][l]*alpha_vdim[492][l])+0.6846531968814573*f[222][l]*alpha_vdim[490][l]+0.6123724356957944*(f[158][l]*alpha_vdim[489][l]+f[159][l]*alpha_vdim[488][l]+f[160][l]*alpha_vdim[487][l])+0.6846531968814573*(f[206][l]*alpha_vdim[486][l]+f[227][l]*alpha_cdim[247][l]+f[211][l]*alpha_cdim[243][l])+(0.2794502844414113*alpha_vdim[120][l]+0.4374088826398531*(alpha_vdim[38][l]+alpha_vdim[37][l]))*f[226][l]+0.6846531968814573*(alpha_vdim[4][l]*f[226][l]+alpha_cdim[0][l]*f[212][l])+(0.2794502844414113*alpha_vdim[86][l]+0.4374088826398531*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[210][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[199][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[198][l]+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[37][l])*f[176][l]+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[38][l])*f[175][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[171][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[170][l]+(0.249947932937059*alpha_vdim[129][l]+0.3912303982179757*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[158][l]+0.5477225575051661*alpha_vdim[22][l]*f[151][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[138][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[137][l]+(0.3912303982179757*(f[71][l]+f[70][l])+0.6123724356957944*f[14][l])*alpha_vdim[129][l]+0.6846531968814573*f[85][l]*alpha_vdim[120][l]+0.6123724356957944*(alpha_vdim[59][l]*f[116][l]+alpha_vdim[60][l]*f[115][l])+0.5477225575051661*alpha_vdim[6][l]*f[113][l]+(0.3499271061118826*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[102][l]+(0.3499271061118826*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[101][l]+0.6846531968814573*f[49][l]*alpha_vdim[86][l]+0.6123724356957944*(alpha_vdim[31][l]*f[82][l]+alpha_vdim[32][l]*f[81][l]+alpha_vdim[43][l]*f[71][l]+alpha_vdim[44][l]*f[70][l])+0.5477225575051661*(f[26][l]*alpha_vdim[69][l]+f[27][l]*alpha_vdim[68][l])+0.4898979485566357*alpha_vdim[25][l]*f[52][l];
+    out[234][l] += (0.249947932937059*f[161][l]+0.3912303982179757*(f[75][l]+f[74][l])+0.6123724356957944*f[15][l])*alpha_vdim[606][l]+(0.2794502844414113*f[223][l]+0.4374088826398531*(f[167][l]+f[166][l])+0.6846531968814573*f[79][l])*alpha_vdim[603][l]+(0.2794502844414113*f[207][l]+0.4374088826398531*(f[133][l]+f[132][l])+0.6846531968814573*f[46][l])*alpha_vdim[572][l]+(0.3499271061118826*f[105][l]+0.5477225575051661*f[28][l])*alpha_vdim[546][l]+(0.3499271061118826*f[104][l]+0.5477225575051661*f[29][l])*alpha_vdim[545][l]+(0.3912303982179757*f[196][l]+0.6123724356957944*f[111][l])*alpha_vdim[543][l]+(0.3912303982179757*f[195][l]+0.6123724356957944*f[112][l])*alpha_vdim[542][l]+(0.3912303982179757*f[161][l]+0.6123724356957944*f[74][l])*alpha_vdim[524][l]+(0.3912303982179757*f[161][l]+0.6123724356957944*f[75][l])*alpha_vdim[523][l]+(0.4374088826398531*f[223][l]+0.6846531968814573*f[166][l])*alpha_vdim[520][l]+(0.4374088826398531*f[223][l]+0.6846531968814573*f[167][l])*alpha_vdim[519][l]+(0.3912303982179757*f[165][l]+0.6123724356957944*f[77][l])*alpha_vdim[518][l]+(0.3912303982179757*f[164][l]+0.6123724356957944*f[78][l])*alpha_vdim[517][l]+0.4898979485566357*f[53][l]*alpha_vdim[508][l]+0.5477225575051661*f[150][l]*alpha_vdim[507][l]+(0.4374088826398531*f[207][l]+0.6846531968814573*f[132][l])*alpha_vdim[503][l]+(0.4374088826398531*f[207][l]+0.6846531968814573*f[133][l])*alpha_vdim[502][l]+0.5477225575051661*(f[104][l]*alpha_vdim[496][l]+f[105][l]*alpha_vdim[495][l])+0.6123724356957944*(f[195][l]*alpha_vdim[494][l]+f[196][l]*alpha_vdim[493][l])+0.5477225575051661*f[110][l]*alpha_vdim[492][l]+0.6123724356957944*f[161][l]*alpha_vdim[490][l]+0.6846531968814573*f[223][l]*alpha_vdim[489][l]+0.6123724356957944*(f[164][l]*alpha_vdim[488][l]+f[165][l]*alpha_vdim[487][l])+0.6846531968814573*f[207][l]*alpha_vdim[486][l]+(0.249947932937059*f[161][l]+0.3912303982179757*(f[75][l]+f[74][l])+0.6123724356957944*f[15][l])*alpha_vdim[372][l]+(0.2794502844414113*f[226][l]+0.4374088826398531*(f[176][l]+f[175][l])+0.6846531968814573*f[85][l])*alpha_vdim[360][l]+(0.2794502844414113*f[213][l]+0.4374088826398531*(f[142][l]+f[141][l])+0.6846531968814573*f[50][l])*alpha_vdim[329][l]+(0.3499271061118826*f[105][l]+0.5477225575051661*f[28][l])*alpha_vdim[312][l]+(0.3499271061118826*f[104][l]+0.5477225575051661*f[29][l])*alpha_vdim[311][l]+(0.3912303982179757*f[199][l]+0.6123724356957944*f[115][l])*alpha_vdim[300][l]+(0.3912303982179757*f[198][l]+0.6123724356957944*f[116][l])*alpha_vdim[299][l]+(0.3912303982179757*f[161][l]+0.6123724356957944*f[74][l])*alpha_vdim[287][l]+(0.3912303982179757*f[161][l]+0.6123724356957944*f[75][l])*alpha_vdim[286][l]+(0.4374088826398531*f[226][l]+0.6846531968814573*f[175][l])*alpha_vdim[277][l]+(0.4374088826398531*f[226][l]+0.6846531968814573*f[176][l])*alpha_vdim[276][l]+(0.3912303982179757*f[174][l]+0.6123724356957944*f[83][l])*alpha_vdim[275][l]+(0.3912303982179757*f[173][l]+0.6123724356957944*f[84][l])*alpha_vdim[274][l]+0.4898979485566357*f[53][l]*alpha_vdim[268][l]+0.5477225575051661*f[151][l]*alpha_vdim[264][l]+(0.4374088826398531*f[213][l]+0.6846531968814573*f[141][l])*alpha_vdim[260][l]+(0.4374088826398531*f[213][l]+0.6846531968814573*f[142][l])*alpha_vdim[259][l]+0.5477225575051661*(f[104][l]*alpha_vdim[256][l]+f[105][l]*alpha_vdim[255][l])+0.6123724356957944*(f[198][l]*alpha_vdim[251][l]+f[199][l]*alpha_vdim[250][l])+0.5477225575051661*f[114][l]*alpha_vdim[249][l]+0.6123724356957944*(f[161][l]*alpha_vdim[248][l]+f[173][l]*alpha_cdim[247][l])+0.6846531968814573*f[226][l]*alpha_vdim[246][l]+0.6123724356957944*(f[173][l]*alpha_vdim[245][l]+f[174][l]*alpha_vdim[244][l])+0.6846531968814573*(f[213][l]*alpha_vdim[243][l]+f[216][l]*alpha_cdim[243][l]+alpha_cdim[3][l]*f[230][l]+alpha_cdim[0][l]*f[217][l]);
+    out[235][l] += (0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l])*alpha_vdim[606][l]+(0.3912303982179757*f[223][l]+0.6123724356957944*f[167][l])*alpha_vdim[603][l]+(0.4374088826398531*f[237][l]+0.6846531968814573*f[209][l])*alpha_vdim[572][l]+0.5477225575051661*f[194][l]*alpha_vdim[546][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[545][l]+0.5477225575051661*f[196][l]*alpha_vdim[543][l]+0.3912303982179757*f[195][l]*alpha_vdim[542][l]+0.6123724356957944*(f[112][l]*alpha_vdim[542][l]+f[222][l]*alpha_vdim[524][l])+0.3912303982179757*f[162][l]*alpha_vdim[523][l]+0.6123724356957944*(f[76][l]*alpha_vdim[523][l]+f[223][l]*alpha_vdim[520][l])+0.3912303982179757*f[166][l]*alpha_vdim[519][l]+0.6123724356957944*(f[79][l]*alpha_vdim[519][l]+f[225][l]*alpha_vdim[518][l])+(0.4374088826398531*f[224][l]+0.6846531968814573*f[169][l])*alpha_vdim[517][l]+0.5477225575051661*(f[149][l]*alpha_vdim[508][l]+f[150][l]*alpha_vdim[507][l])+0.6846531968814573*f[237][l]*alpha_vdim[503][l]+(0.4374088826398531*f[208][l]+0.6846531968814573*f[134][l])*alpha_vdim[502][l]+0.6123724356957944*f[193][l]*alpha_vdim[496][l]+0.5477225575051661*f[108][l]*alpha_vdim[495][l]+0.6123724356957944*f[195][l]*alpha_vdim[494][l]+0.5477225575051661*f[111][l]*alpha_vdim[493][l]+0.6123724356957944*(f[197][l]*alpha_vdim[492][l]+f[162][l]*alpha_vdim[490][l]+f[166][l]*alpha_vdim[489][l])+0.6846531968814573*f[224][l]*alpha_vdim[488][l]+0.6123724356957944*f[168][l]*alpha_vdim[487][l]+0.6846531968814573*f[208][l]*alpha_vdim[486][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l])*alpha_vdim[372][l]+(0.3912303982179757*f[226][l]+0.6123724356957944*f[176][l])*alpha_vdim[360][l]+(0.4374088826398531*f[238][l]+0.6846531968814573*f[215][l])*alpha_vdim[329][l]+0.5477225575051661*f[194][l]*alpha_vdim[312][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[311][l]+0.5477225575051661*f[199][l]*alpha_vdim[300][l]+0.3912303982179757*f[198][l]*alpha_vdim[299][l]+0.6123724356957944*(f[116][l]*alpha_vdim[299][l]+f[222][l]*alpha_vdim[287][l])+0.3912303982179757*f[162][l]*alpha_vdim[286][l]+0.6123724356957944*(f[76][l]*alpha_vdim[286][l]+f[226][l]*alpha_vdim[277][l])+0.3912303982179757*f[175][l]*alpha_vdim[276][l]+0.6123724356957944*(f[85][l]*alpha_vdim[276][l]+f[228][l]*alpha_vdim[275][l])+(0.4374088826398531*f[227][l]+0.6846531968814573*f[178][l])*alpha_vdim[274][l]+0.5477225575051661*(f[149][l]*alpha_vdim[268][l]+f[151][l]*alpha_vdim[264][l])+0.6846531968814573*f[238][l]*alpha_vdim[260][l]+(0.4374088826398531*f[214][l]+0.6846531968814573*f[143][l])*alpha_vdim[259][l]+0.6123724356957944*f[193][l]*alpha_vdim[256][l]+0.5477225575051661*f[108][l]*alpha_vdim[255][l]+0.6123724356957944*f[198][l]*alpha_vdim[251][l]+0.5477225575051661*f[115][l]*alpha_vdim[250][l]+0.6123724356957944*(f[200][l]*alpha_vdim[249][l]+f[162][l]*alpha_vdim[248][l]+f[175][l]*alpha_vdim[246][l])+0.6846531968814573*f[227][l]*alpha_vdim[245][l]+0.6123724356957944*f[177][l]*alpha_vdim[244][l]+0.6846531968814573*f[214][l]*alpha_vdim[243][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[239][l]+0.6123724356957944*alpha_vdim[32][l]*f[230][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[229][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[226][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[223][l]+0.6846531968814573*(alpha_cdim[0][l]*f[220][l]+alpha_vdim[86][l]*f[219][l])+(0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[218][l]+0.6123724356957944*alpha_vdim[6][l]*f[201][l]+0.5477225575051661*alpha_vdim[60][l]*f[199][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[198][l]+0.5477225575051661*alpha_vdim[69][l]*f[196][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[195][l]+0.6846531968814573*alpha_vdim[31][l]*f[181][l]+0.6123724356957944*((alpha_cdim[3][l]+alpha_vdim[1][l])*f[180][l]+alpha_vdim[120][l]*f[176][l])+0.3912303982179757*alpha_vdim[37][l]*f[175][l]+0.6123724356957944*(alpha_vdim[4][l]*f[175][l]+alpha_vdim[129][l]*f[167][l])+(0.3912303982179757*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[166][l]+0.5477225575051661*(alpha_vdim[22][l]*f[151][l]+alpha_vdim[25][l]*f[150][l])+0.6846531968814573*alpha_vdim[16][l]*f[146][l]+0.6123724356957944*alpha_vdim[59][l]*f[116][l]+0.5477225575051661*alpha_vdim[9][l]*f[115][l]+0.6123724356957944*alpha_vdim[68][l]*f[112][l]+0.5477225575051661*alpha_vdim[12][l]*f[111][l]+0.6123724356957944*(alpha_vdim[37][l]*f[85][l]+alpha_vdim[43][l]*f[79][l]);
+    out[236][l] += (0.3912303982179757*f[222][l]+0.6123724356957944*f[162][l])*alpha_vdim[606][l]+(0.3912303982179757*f[223][l]+0.6123724356957944*f[166][l])*alpha_vdim[603][l]+(0.4374088826398531*f[237][l]+0.6846531968814573*f[208][l])*alpha_vdim[572][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[546][l]+0.5477225575051661*f[193][l]*alpha_vdim[545][l]+(0.3912303982179757*f[196][l]+0.6123724356957944*f[111][l])*alpha_vdim[543][l]+0.5477225575051661*f[195][l]*alpha_vdim[542][l]+0.3912303982179757*f[163][l]*alpha_vdim[524][l]+0.6123724356957944*(f[76][l]*alpha_vdim[524][l]+f[222][l]*alpha_vdim[523][l])+0.3912303982179757*f[167][l]*alpha_vdim[520][l]+0.6123724356957944*(f[79][l]*alpha_vdim[520][l]+f[223][l]*alpha_vdim[519][l])+(0.4374088826398531*f[225][l]+0.6846531968814573*f[168][l])*alpha_vdim[518][l]+0.6123724356957944*f[224][l]*alpha_vdim[517][l]+0.5477225575051661*(f[149][l]*alpha_vdim[508][l]+f[150][l]*alpha_vdim[507][l])+0.4374088826398531*f[209][l]*alpha_vdim[503][l]+0.6846531968814573*(f[134][l]*alpha_vdim[503][l]+f[237][l]*alpha_vdim[502][l])+0.5477225575051661*f[109][l]*alpha_vdim[496][l]+0.6123724356957944*f[194][l]*alpha_vdim[495][l]+0.5477225575051661*f[112][l]*alpha_vdim[494][l]+0.6123724356957944*(f[196][l]*alpha_vdim[493][l]+f[197][l]*alpha_vdim[492][l]+f[163][l]*alpha_vdim[490][l]+f[167][l]*alpha_vdim[489][l]+f[169][l]*alpha_vdim[488][l])+0.6846531968814573*(f[225][l]*alpha_vdim[487][l]+f[209][l]*alpha_vdim[486][l])+(0.3912303982179757*f[222][l]+0.6123724356957944*f[162][l])*alpha_vdim[372][l]+(0.3912303982179757*f[226][l]+0.6123724356957944*f[175][l])*alpha_vdim[360][l]+(0.4374088826398531*f[238][l]+0.6846531968814573*f[214][l])*alpha_vdim[329][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[312][l]+0.5477225575051661*f[193][l]*alpha_vdim[311][l]+(0.3912303982179757*f[199][l]+0.6123724356957944*f[115][l])*alpha_vdim[300][l]+0.5477225575051661*f[198][l]*alpha_vdim[299][l]+0.3912303982179757*f[163][l]*alpha_vdim[287][l]+0.6123724356957944*(f[76][l]*alpha_vdim[287][l]+f[222][l]*alpha_vdim[286][l])+0.3912303982179757*f[176][l]*alpha_vdim[277][l]+0.6123724356957944*(f[85][l]*alpha_vdim[277][l]+f[226][l]*alpha_vdim[276][l])+(0.4374088826398531*f[228][l]+0.6846531968814573*f[177][l])*alpha_vdim[275][l]+0.6123724356957944*f[227][l]*alpha_vdim[274][l]+0.5477225575051661*(f[149][l]*alpha_vdim[268][l]+f[151][l]*alpha_vdim[264][l])+0.4374088826398531*f[215][l]*alpha_vdim[260][l]+0.6846531968814573*(f[143][l]*alpha_vdim[260][l]+f[238][l]*alpha_vdim[259][l])+0.5477225575051661*f[109][l]*alpha_vdim[256][l]+0.6123724356957944*f[194][l]*alpha_vdim[255][l]+0.5477225575051661*f[116][l]*alpha_vdim[251][l]+0.6123724356957944*(f[199][l]*alpha_vdim[250][l]+f[200][l]*alpha_vdim[249][l]+f[163][l]*alpha_vdim[248][l]+f[178][l]*alpha_cdim[247][l]+f[176][l]*alpha_vdim[246][l]+f[178][l]*alpha_vdim[245][l])+0.6846531968814573*(f[228][l]*alpha_vdim[244][l]+f[215][l]*alpha_vdim[243][l]+f[221][l]*alpha_cdim[243][l])+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[239][l]+(0.4374088826398531*alpha_vdim[32][l]+0.6846531968814573*alpha_vdim[1][l])*f[230][l]+0.6123724356957944*alpha_vdim[31][l]*f[229][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])*f[226][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[43][l])*f[223][l]+0.4374088826398531*alpha_vdim[17][l]*f[219][l]+0.6846531968814573*(alpha_vdim[0][l]*f[219][l]+alpha_vdim[86][l]*f[218][l])+0.6123724356957944*alpha_vdim[6][l]*f[201][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[199][l]+0.5477225575051661*alpha_vdim[59][l]*f[198][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[196][l]+0.5477225575051661*alpha_vdim[68][l]*f[195][l]+0.6123724356957944*alpha_vdim[2][l]*f[181][l]+0.6846531968814573*alpha_vdim[32][l]*f[180][l]+0.3912303982179757*alpha_vdim[38][l]*f[176][l]+0.6123724356957944*(alpha_vdim[4][l]*f[176][l]+alpha_vdim[120][l]*f[175][l])+0.3912303982179757*alpha_vdim[44][l]*f[167][l]+0.6123724356957944*(alpha_vdim[5][l]*f[167][l]+alpha_vdim[129][l]*f[166][l])+0.5477225575051661*(alpha_vdim[22][l]*f[151][l]+alpha_vdim[25][l]*f[150][l])+0.6846531968814573*alpha_vdim[17][l]*f[146][l]+0.5477225575051661*alpha_vdim[10][l]*f[116][l]+0.6123724356957944*alpha_vdim[60][l]*f[115][l]+0.5477225575051661*alpha_vdim[13][l]*f[112][l]+0.6123724356957944*(alpha_vdim[69][l]*f[111][l]+alpha_vdim[38][l]*f[85][l]+alpha_vdim[44][l]*f[79][l]);
+    out[237][l] += (0.1117801137765645*f[202][l]+0.1749635530559412*(f[122][l]+f[121][l])+0.273861278752583*f[39][l])*alpha_vdim[606][l]+(0.1117801137765645*f[203][l]+0.1749635530559412*(f[126][l]+f[125][l])+0.273861278752583*f[42][l])*alpha_vdim[603][l]+(0.1249739664685295*f[232][l]+0.1956151991089878*(f[185][l]+f[184][l])+0.3061862178478971*f[91][l])*alpha_vdim[572][l]+(0.1564921592871903*f[154][l]+0.2449489742783178*f[63][l])*alpha_vdim[546][l]+(0.1564921592871903*f[153][l]+0.2449489742783178*f[64][l])*alpha_vdim[545][l]+(0.1564921592871903*f[156][l]+0.2449489742783178*f[66][l])*alpha_vdim[543][l]+(0.1564921592871903*f[155][l]+0.2449489742783178*f[67][l])*alpha_vdim[542][l]+(0.1749635530559412*f[202][l]+0.273861278752583*f[121][l])*alpha_vdim[524][l]+(0.1749635530559412*f[202][l]+0.273861278752583*f[122][l])*alpha_vdim[523][l]+(0.1749635530559412*f[203][l]+0.273861278752583*f[125][l])*alpha_vdim[520][l]+(0.1749635530559412*f[203][l]+0.273861278752583*f[126][l])*alpha_vdim[519][l]+(0.1749635530559412*f[205][l]+0.273861278752583*f[127][l])*alpha_vdim[518][l]+(0.1749635530559412*f[204][l]+0.273861278752583*f[128][l])*alpha_vdim[517][l]+0.2190890230020664*(f[99][l]*alpha_vdim[508][l]+f[100][l]*alpha_vdim[507][l])+(0.1956151991089878*f[232][l]+0.3061862178478971*f[184][l])*alpha_vdim[503][l]+(0.1956151991089878*f[232][l]+0.3061862178478971*f[185][l])*alpha_vdim[502][l]+0.2449489742783178*(f[153][l]*alpha_vdim[496][l]+f[154][l]*alpha_vdim[495][l]+f[155][l]*alpha_vdim[494][l]+f[156][l]*alpha_vdim[493][l]+f[157][l]*alpha_vdim[492][l])+0.273861278752583*(f[202][l]*alpha_vdim[490][l]+f[203][l]*alpha_vdim[489][l]+f[204][l]*alpha_vdim[488][l]+f[205][l]*alpha_vdim[487][l])+0.3061862178478971*f[232][l]*alpha_vdim[486][l]+(0.249947932937059*f[238][l]+0.3912303982179757*(f[215][l]+f[214][l])+0.2794502844414113*f[202][l]+0.6123724356957944*f[143][l]+0.4374088826398531*(f[122][l]+f[121][l])+0.6846531968814573*f[39][l])*alpha_vdim[372][l]+(0.249947932937059*f[192][l]+0.3912303982179757*(f[107][l]+f[106][l])+0.6123724356957944*f[30][l])*alpha_vdim[360][l]+(0.2794502844414113*f[222][l]+0.4374088826398531*(f[163][l]+f[162][l])+0.6846531968814573*f[76][l])*alpha_vdim[329][l]+(0.3499271061118826*f[228][l]+0.5477225575051661*f[177][l]+0.3912303982179757*f[154][l]+0.6123724356957944*f[63][l])*alpha_vdim[312][l]+(0.3499271061118826*f[227][l]+0.5477225575051661*f[178][l]+0.3912303982179757*f[153][l]+0.6123724356957944*f[64][l])*alpha_vdim[311][l]+(0.3499271061118826*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[300][l]+(0.3499271061118826*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[299][l]+(0.3912303982179757*f[238][l]+0.6123724356957944*f[214][l]+0.4374088826398531*f[202][l]+0.6846531968814573*f[121][l])*alpha_vdim[287][l]+(0.3912303982179757*f[238][l]+0.6123724356957944*f[215][l]+0.4374088826398531*f[202][l]+0.6846531968814573*f[122][l])*alpha_vdim[286][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[277][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[276][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[275][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[274][l]+(0.4898979485566357*f[200][l]+0.5477225575051661*f[99][l])*alpha_vdim[268][l]+0.4898979485566357*f[96][l]*alpha_vdim[264][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[260][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[259][l]+(0.5477225575051661*f[227][l]+0.6123724356957944*f[153][l])*alpha_vdim[256][l]+(0.5477225575051661*f[228][l]+0.6123724356957944*f[154][l])*alpha_vdim[255][l]+0.5477225575051661*(f[147][l]*alpha_vdim[251][l]+f[148][l]*alpha_vdim[250][l]+f[149][l]*alpha_vdim[249][l])+(0.6123724356957944*f[238][l]+0.6846531968814573*f[202][l])*alpha_vdim[248][l]+0.6123724356957944*(f[193][l]*alpha_cdim[247][l]+f[192][l]*alpha_vdim[246][l]+f[193][l]*alpha_vdim[245][l]+f[194][l]*alpha_vdim[244][l])+0.6846531968814573*(f[222][l]*alpha_vdim[243][l]+f[224][l]*alpha_cdim[243][l])+(0.249947932937059*alpha_vdim[129][l]+0.3912303982179757*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[239][l]+(0.3499271061118826*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[230][l]+(0.3499271061118826*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[229][l]+0.6846531968814573*alpha_cdim[0][l]*f[225][l]+(0.2794502844414113*alpha_vdim[86][l]+0.4374088826398531*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[223][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[43][l])*f[219][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[218][l]+(0.2794502844414113*alpha_vdim[129][l]+0.4374088826398531*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6846531968814573*alpha_vdim[5][l])*f[203][l]+0.4898979485566357*alpha_vdim[25][l]*f[201][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[196][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[195][l]+(0.249947932937059*alpha_vdim[120][l]+0.3912303982179757*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[192][l]+0.5477225575051661*(alpha_vdim[68][l]*f[181][l]+alpha_vdim[69][l]*f[180][l])+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[167][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[166][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[156][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[155][l]+0.5477225575051661*alpha_vdim[6][l]*f[150][l]+(0.3499271061118826*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[148][l]+(0.3499271061118826*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[147][l]+alpha_vdim[129][l]*(0.6123724356957944*f[146][l]+0.4374088826398531*(f[126][l]+f[125][l]))+0.6846531968814573*(f[42][l]*alpha_vdim[129][l]+alpha_vdim[43][l]*f[126][l]+alpha_vdim[44][l]*f[125][l])+0.3912303982179757*(f[107][l]+f[106][l])*alpha_vdim[120][l]+0.6123724356957944*(f[30][l]*alpha_vdim[120][l]+alpha_vdim[31][l]*f[112][l]+alpha_vdim[32][l]*f[111][l]+alpha_vdim[37][l]*f[107][l]+alpha_vdim[38][l]*f[106][l])+0.5477225575051661*alpha_vdim[25][l]*f[100][l]+0.4898979485566357*alpha_vdim[22][l]*f[96][l]+0.6846531968814573*f[79][l]*alpha_vdim[86][l]+0.6123724356957944*(f[66][l]*alpha_vdim[69][l]+f[67][l]*alpha_vdim[68][l])+0.5477225575051661*(f[54][l]*alpha_vdim[60][l]+f[55][l]*alpha_vdim[59][l]);
+    out[238][l] += (0.249947932937059*f[237][l]+0.3912303982179757*(f[209][l]+f[208][l])+0.2794502844414113*f[206][l]+0.6123724356957944*f[134][l]+0.4374088826398531*(f[131][l]+f[130][l])+0.6846531968814573*f[45][l])*alpha_vdim[606][l]+(0.249947932937059*f[192][l]+0.3912303982179757*(f[107][l]+f[106][l])+0.6123724356957944*f[30][l])*alpha_vdim[603][l]+(0.2794502844414113*f[222][l]+0.4374088826398531*(f[163][l]+f[162][l])+0.6846531968814573*f[76][l])*alpha_vdim[572][l]+(0.3499271061118826*f[225][l]+0.5477225575051661*f[168][l]+0.3912303982179757*f[160][l]+0.6123724356957944*f[72][l])*alpha_vdim[546][l]+(0.3499271061118826*f[224][l]+0.5477225575051661*f[169][l]+0.3912303982179757*f[159][l]+0.6123724356957944*f[73][l])*alpha_vdim[545][l]+(0.3499271061118826*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[543][l]+(0.3499271061118826*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[542][l]+(0.3912303982179757*f[237][l]+0.6123724356957944*f[208][l]+0.4374088826398531*f[206][l]+0.6846531968814573*f[130][l])*alpha_vdim[524][l]+(0.3912303982179757*f[237][l]+0.6123724356957944*f[209][l]+0.4374088826398531*f[206][l]+0.6846531968814573*f[131][l])*alpha_vdim[523][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[520][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[519][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[518][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[517][l]+(0.4898979485566357*f[197][l]+0.5477225575051661*f[103][l])*alpha_vdim[508][l]+0.4898979485566357*f[96][l]*alpha_vdim[507][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[162][l])*alpha_vdim[503][l]+(0.4374088826398531*f[222][l]+0.6846531968814573*f[163][l])*alpha_vdim[502][l]+(0.5477225575051661*f[224][l]+0.6123724356957944*f[159][l])*alpha_vdim[496][l]+(0.5477225575051661*f[225][l]+0.6123724356957944*f[160][l])*alpha_vdim[495][l]+0.5477225575051661*(f[147][l]*alpha_vdim[494][l]+f[148][l]*alpha_vdim[493][l]+f[149][l]*alpha_vdim[492][l])+(0.6123724356957944*f[237][l]+0.6846531968814573*f[206][l])*alpha_vdim[490][l]+0.6123724356957944*(f[192][l]*alpha_vdim[489][l]+f[193][l]*alpha_vdim[488][l]+f[194][l]*alpha_vdim[487][l])+0.6846531968814573*f[222][l]*alpha_vdim[486][l]+(0.1117801137765645*f[206][l]+0.1749635530559412*(f[131][l]+f[130][l])+0.273861278752583*f[45][l])*alpha_vdim[372][l]+(0.1117801137765645*f[210][l]+0.1749635530559412*(f[138][l]+f[137][l])+0.273861278752583*f[49][l])*alpha_vdim[360][l]+(0.1249739664685295*f[233][l]+0.1956151991089878*(f[188][l]+f[187][l])+0.3061862178478971*f[94][l])*alpha_vdim[329][l]+(0.1564921592871903*f[160][l]+0.2449489742783178*f[72][l])*alpha_vdim[312][l]+(0.1564921592871903*f[159][l]+0.2449489742783178*f[73][l])*alpha_vdim[311][l]+(0.1564921592871903*f[171][l]+0.2449489742783178*f[81][l])*alpha_vdim[300][l]+(0.1564921592871903*f[170][l]+0.2449489742783178*f[82][l])*alpha_vdim[299][l]+(0.1749635530559412*f[206][l]+0.273861278752583*f[130][l])*alpha_vdim[287][l]+(0.1749635530559412*f[206][l]+0.273861278752583*f[131][l])*alpha_vdim[286][l]+(0.1749635530559412*f[210][l]+0.273861278752583*f[137][l])*alpha_vdim[277][l]+(0.1749635530559412*f[210][l]+0.273861278752583*f[138][l])*alpha_vdim[276][l]+(0.1749635530559412*f[212][l]+0.273861278752583*f[139][l])*alpha_vdim[275][l]+(0.1749635530559412*f[211][l]+0.273861278752583*f[140][l])*alpha_vdim[274][l]+0.2190890230020664*(f[103][l]*alpha_vdim[268][l]+f[113][l]*alpha_vdim[264][l])+(0.1956151991089878*f[233][l]+0.3061862178478971*f[187][l])*alpha_vdim[260][l]+(0.1956151991089878*f[233][l]+0.3061862178478971*f[188][l])*alpha_vdim[259][l]+0.2449489742783178*(f[159][l]*alpha_vdim[256][l]+f[160][l]*alpha_vdim[255][l]+f[170][l]*alpha_vdim[251][l]+f[171][l]*alpha_vdim[250][l]+f[172][l]*alpha_vdim[249][l])+0.273861278752583*f[206][l]*alpha_vdim[248][l]+(0.6123724356957944*f[240][l]+0.6846531968814573*f[211][l])*alpha_cdim[247][l]+0.273861278752583*(f[210][l]*alpha_vdim[246][l]+f[211][l]*alpha_vdim[245][l]+f[212][l]*alpha_vdim[244][l])+0.3061862178478971*f[233][l]*alpha_vdim[243][l]+0.6846531968814573*f[227][l]*alpha_cdim[243][l]+(0.249947932937059*alpha_vdim[120][l]+0.3912303982179757*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[239][l]+(0.3499271061118826*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[230][l]+(0.3499271061118826*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[229][l]+0.6846531968814573*alpha_cdim[0][l]*f[228][l]+(0.2794502844414113*alpha_vdim[86][l]+0.4374088826398531*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[226][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])*f[219][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[218][l]+(0.2794502844414113*alpha_vdim[120][l]+0.4374088826398531*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6846531968814573*alpha_vdim[4][l])*f[210][l]+0.4898979485566357*alpha_vdim[22][l]*f[201][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[199][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[198][l]+(0.249947932937059*alpha_vdim[129][l]+0.3912303982179757*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[192][l]+0.5477225575051661*(alpha_vdim[59][l]*f[181][l]+alpha_vdim[60][l]*f[180][l])+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[176][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[175][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[171][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[170][l]+0.5477225575051661*alpha_vdim[6][l]*f[151][l]+(0.3499271061118826*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[148][l]+(0.3499271061118826*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[147][l]+0.6123724356957944*alpha_vdim[120][l]*f[146][l]+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[37][l])*f[138][l]+(0.4374088826398531*alpha_vdim[120][l]+0.6846531968814573*alpha_vdim[38][l])*f[137][l]+(0.3912303982179757*(f[107][l]+f[106][l])+0.6123724356957944*f[30][l])*alpha_vdim[129][l]+0.6846531968814573*f[49][l]*alpha_vdim[120][l]+0.6123724356957944*(alpha_vdim[31][l]*f[116][l]+alpha_vdim[32][l]*f[115][l])+0.5477225575051661*alpha_vdim[22][l]*f[113][l]+0.6123724356957944*(alpha_vdim[43][l]*f[107][l]+alpha_vdim[44][l]*f[106][l])+0.4898979485566357*alpha_vdim[25][l]*f[96][l]+0.6846531968814573*f[85][l]*alpha_vdim[86][l]+0.6123724356957944*(alpha_vdim[59][l]*f[82][l]+alpha_vdim[60][l]*f[81][l])+0.5477225575051661*(f[54][l]*alpha_vdim[69][l]+f[55][l]*alpha_vdim[68][l]);
+    out[239][l] += (0.249947932937059*f[192][l]+0.3912303982179757*(f[107][l]+f[106][l])+0.6123724356957944*f[30][l])*alpha_vdim[606][l]+(0.249947932937059*f[237][l]+0.3912303982179757*(f[209][l]+f[208][l])+0.2794502844414113*f[207][l]+0.6123724356957944*f[134][l]+0.4374088826398531*(f[133][l]+f[132][l])+0.6846531968814573*f[46][l])*alpha_vdim[603][l]+(0.2794502844414113*f[223][l]+0.4374088826398531*(f[167][l]+f[166][l])+0.6846531968814573*f[79][l])*alpha_vdim[572][l]+(0.3499271061118826*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[546][l]+(0.3499271061118826*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[545][l]+(0.3499271061118826*f[225][l]+0.5477225575051661*f[168][l]+0.3912303982179757*f[165][l]+0.6123724356957944*f[77][l])*alpha_vdim[543][l]+(0.3499271061118826*f[224][l]+0.5477225575051661*f[169][l]+0.3912303982179757*f[164][l]+0.6123724356957944*f[78][l])*alpha_vdim[542][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[524][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[523][l]+(0.3912303982179757*f[237][l]+0.6123724356957944*f[208][l]+0.4374088826398531*f[207][l]+0.6846531968814573*f[132][l])*alpha_vdim[520][l]+(0.3912303982179757*f[237][l]+0.6123724356957944*f[209][l]+0.4374088826398531*f[207][l]+0.6846531968814573*f[133][l])*alpha_vdim[519][l]+(0.3912303982179757*f[196][l]+0.6123724356957944*f[111][l])*alpha_vdim[518][l]+(0.3912303982179757*f[195][l]+0.6123724356957944*f[112][l])*alpha_vdim[517][l]+0.4898979485566357*f[96][l]*alpha_vdim[508][l]+(0.4898979485566357*f[197][l]+0.5477225575051661*f[110][l])*alpha_vdim[507][l]+(0.4374088826398531*f[223][l]+0.6846531968814573*f[166][l])*alpha_vdim[503][l]+(0.4374088826398531*f[223][l]+0.6846531968814573*f[167][l])*alpha_vdim[502][l]+0.5477225575051661*(f[147][l]*alpha_vdim[496][l]+f[148][l]*alpha_vdim[495][l])+(0.5477225575051661*f[224][l]+0.6123724356957944*f[164][l])*alpha_vdim[494][l]+(0.5477225575051661*f[225][l]+0.6123724356957944*f[165][l])*alpha_vdim[493][l]+0.5477225575051661*f[150][l]*alpha_vdim[492][l]+0.6123724356957944*f[192][l]*alpha_vdim[490][l]+(0.6123724356957944*f[237][l]+0.6846531968814573*f[207][l])*alpha_vdim[489][l]+0.6123724356957944*(f[195][l]*alpha_vdim[488][l]+f[196][l]*alpha_vdim[487][l])+0.6846531968814573*f[223][l]*alpha_vdim[486][l]+(0.249947932937059*f[192][l]+0.3912303982179757*(f[107][l]+f[106][l])+0.6123724356957944*f[30][l])*alpha_vdim[372][l]+(0.249947932937059*f[238][l]+0.3912303982179757*(f[215][l]+f[214][l])+0.2794502844414113*f[213][l]+0.6123724356957944*f[143][l]+0.4374088826398531*(f[142][l]+f[141][l])+0.6846531968814573*f[50][l])*alpha_vdim[360][l]+(0.2794502844414113*f[226][l]+0.4374088826398531*(f[176][l]+f[175][l])+0.6846531968814573*f[85][l])*alpha_vdim[329][l]+(0.3499271061118826*f[148][l]+0.5477225575051661*f[54][l])*alpha_vdim[312][l]+(0.3499271061118826*f[147][l]+0.5477225575051661*f[55][l])*alpha_vdim[311][l]+(0.3499271061118826*f[228][l]+0.5477225575051661*f[177][l]+0.3912303982179757*f[174][l]+0.6123724356957944*f[83][l])*alpha_vdim[300][l]+(0.3499271061118826*f[227][l]+0.5477225575051661*f[178][l]+0.3912303982179757*f[173][l]+0.6123724356957944*f[84][l])*alpha_vdim[299][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[106][l])*alpha_vdim[287][l]+(0.3912303982179757*f[192][l]+0.6123724356957944*f[107][l])*alpha_vdim[286][l]+(0.3912303982179757*f[238][l]+0.6123724356957944*f[214][l]+0.4374088826398531*f[213][l]+0.6846531968814573*f[141][l])*alpha_vdim[277][l]+(0.3912303982179757*f[238][l]+0.6123724356957944*f[215][l]+0.4374088826398531*f[213][l]+0.6846531968814573*f[142][l])*alpha_vdim[276][l]+(0.3912303982179757*f[199][l]+0.6123724356957944*f[115][l])*alpha_vdim[275][l]+(0.3912303982179757*f[198][l]+0.6123724356957944*f[116][l])*alpha_vdim[274][l]+0.4898979485566357*f[96][l]*alpha_vdim[268][l]+(0.4898979485566357*f[200][l]+0.5477225575051661*f[114][l])*alpha_vdim[264][l]+(0.4374088826398531*f[226][l]+0.6846531968814573*f[175][l])*alpha_vdim[260][l]+(0.4374088826398531*f[226][l]+0.6846531968814573*f[176][l])*alpha_vdim[259][l]+0.5477225575051661*(f[147][l]*alpha_vdim[256][l]+f[148][l]*alpha_vdim[255][l])+(0.5477225575051661*f[227][l]+0.6123724356957944*f[173][l])*alpha_vdim[251][l]+(0.5477225575051661*f[228][l]+0.6123724356957944*f[174][l])*alpha_vdim[250][l]+0.5477225575051661*f[151][l]*alpha_vdim[249][l]+0.6123724356957944*(f[192][l]*alpha_vdim[248][l]+f[198][l]*alpha_cdim[247][l])+(0.6123724356957944*f[238][l]+0.6846531968814573*f[213][l])*alpha_vdim[246][l]+0.6123724356957944*(f[198][l]*alpha_vdim[245][l]+f[199][l]*alpha_vdim[244][l])+0.6846531968814573*(f[226][l]*alpha_vdim[243][l]+f[229][l]*alpha_cdim[243][l])+0.6123724356957944*alpha_cdim[3][l]*f[241][l]+(0.1249739664685295*alpha_vdim[86][l]+0.1956151991089878*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.3061862178478971*alpha_vdim[0][l])*f[234][l]+0.6846531968814573*alpha_cdim[0][l]*f[230][l]+(0.1749635530559412*alpha_vdim[32][l]+0.6846531968814573*alpha_cdim[3][l]+0.273861278752583*alpha_vdim[1][l])*f[217][l]+(0.1749635530559412*alpha_vdim[31][l]+0.273861278752583*alpha_vdim[2][l])*f[216][l]+(0.1117801137765645*alpha_vdim[120][l]+0.1749635530559412*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.273861278752583*alpha_vdim[4][l])*f[213][l]+(0.1117801137765645*alpha_vdim[129][l]+0.1749635530559412*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.273861278752583*alpha_vdim[5][l])*f[207][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[16][l])*f[190][l]+(0.1956151991089878*alpha_vdim[86][l]+0.3061862178478971*alpha_vdim[17][l])*f[189][l]+0.2449489742783178*alpha_vdim[6][l]*f[179][l]+(0.1564921592871903*alpha_vdim[60][l]+0.2449489742783178*alpha_vdim[9][l])*f[174][l]+(0.1564921592871903*alpha_vdim[59][l]+0.2449489742783178*alpha_vdim[10][l])*f[173][l]+(0.1564921592871903*alpha_vdim[69][l]+0.2449489742783178*alpha_vdim[12][l])*f[165][l]+(0.1564921592871903*alpha_vdim[68][l]+0.2449489742783178*alpha_vdim[13][l])*f[164][l]+0.273861278752583*(alpha_vdim[31][l]*f[145][l]+alpha_vdim[32][l]*f[144][l])+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[37][l])*f[142][l]+(0.1749635530559412*alpha_vdim[120][l]+0.273861278752583*alpha_vdim[38][l])*f[141][l]+(0.1749635530559412*alpha_vdim[129][l]+0.273861278752583*alpha_vdim[43][l])*f[133][l]+0.1749635530559412*alpha_vdim[129][l]*f[132][l]+0.273861278752583*(alpha_vdim[44][l]*f[132][l]+f[46][l]*alpha_vdim[129][l]+f[50][l]*alpha_vdim[120][l])+0.2190890230020664*(alpha_vdim[22][l]*f[114][l]+alpha_vdim[25][l]*f[110][l])+0.3061862178478971*alpha_vdim[86][l]*f[95][l]+0.2449489742783178*(alpha_vdim[59][l]*f[84][l]+alpha_vdim[60][l]*f[83][l]+alpha_vdim[68][l]*f[78][l]+alpha_vdim[69][l]*f[77][l]);
+    out[240][l] += (0.3499271061118826*f[193][l]+0.5477225575051661*f[109][l])*alpha_vdim[606][l]+(0.3499271061118826*f[195][l]+0.5477225575051661*f[112][l])*alpha_vdim[603][l]+(0.3912303982179757*f[224][l]+0.6123724356957944*f[169][l])*alpha_vdim[572][l]+0.4898979485566357*f[149][l]*alpha_vdim[546][l]+(0.3499271061118826*f[222][l]+0.5477225575051661*f[163][l]+0.3912303982179757*f[162][l]+0.6123724356957944*f[76][l])*alpha_vdim[545][l]+0.4898979485566357*f[150][l]*alpha_vdim[543][l]+(0.3499271061118826*f[223][l]+0.5477225575051661*f[167][l]+0.3912303982179757*f[166][l]+0.6123724356957944*f[79][l])*alpha_vdim[542][l]+0.5477225575051661*f[193][l]*alpha_vdim[524][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[523][l]+0.5477225575051661*f[195][l]*alpha_vdim[520][l]+(0.3912303982179757*f[195][l]+0.6123724356957944*f[112][l])*alpha_vdim[519][l]+0.5477225575051661*f[197][l]*alpha_vdim[518][l]+(0.3912303982179757*f[237][l]+0.6123724356957944*f[209][l]+0.4374088826398531*f[208][l]+0.6846531968814573*f[134][l])*alpha_vdim[517][l]+(0.4898979485566357*f[194][l]+0.5477225575051661*f[108][l])*alpha_vdim[508][l]+(0.4898979485566357*f[196][l]+0.5477225575051661*f[111][l])*alpha_vdim[507][l]+0.6123724356957944*f[224][l]*alpha_vdim[503][l]+(0.4374088826398531*f[224][l]+0.6846531968814573*f[169][l])*alpha_vdim[502][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*f[162][l])*alpha_vdim[496][l]+0.5477225575051661*f[149][l]*alpha_vdim[495][l]+(0.5477225575051661*f[223][l]+0.6123724356957944*f[166][l])*alpha_vdim[494][l]+0.5477225575051661*(f[150][l]*alpha_vdim[493][l]+f[225][l]*alpha_vdim[492][l])+0.6123724356957944*(f[168][l]*alpha_vdim[492][l]+f[193][l]*alpha_vdim[490][l]+f[195][l]*alpha_vdim[489][l])+(0.6123724356957944*f[237][l]+0.6846531968814573*f[208][l])*alpha_vdim[488][l]+0.6123724356957944*f[197][l]*alpha_vdim[487][l]+0.6846531968814573*f[224][l]*alpha_vdim[486][l]+(0.3499271061118826*f[193][l]+0.5477225575051661*f[109][l])*alpha_vdim[372][l]+(0.3499271061118826*f[198][l]+0.5477225575051661*f[116][l])*alpha_vdim[360][l]+(0.3912303982179757*f[227][l]+0.6123724356957944*f[178][l])*alpha_vdim[329][l]+0.4898979485566357*f[149][l]*alpha_vdim[312][l]+(0.3499271061118826*f[222][l]+0.5477225575051661*f[163][l]+0.3912303982179757*f[162][l]+0.6123724356957944*f[76][l])*alpha_vdim[311][l]+0.4898979485566357*f[151][l]*alpha_vdim[300][l]+(0.3499271061118826*f[226][l]+0.5477225575051661*f[176][l]+0.3912303982179757*f[175][l]+0.6123724356957944*f[85][l])*alpha_vdim[299][l]+0.5477225575051661*f[193][l]*alpha_vdim[287][l]+(0.3912303982179757*f[193][l]+0.6123724356957944*f[109][l])*alpha_vdim[286][l]+0.5477225575051661*f[198][l]*alpha_vdim[277][l]+(0.3912303982179757*f[198][l]+0.6123724356957944*f[116][l])*alpha_vdim[276][l]+0.5477225575051661*f[200][l]*alpha_vdim[275][l]+(0.3912303982179757*f[238][l]+0.6123724356957944*f[215][l]+0.4374088826398531*f[214][l]+0.6846531968814573*f[143][l])*alpha_vdim[274][l]+(0.4898979485566357*f[194][l]+0.5477225575051661*f[108][l])*alpha_vdim[268][l]+(0.4898979485566357*f[199][l]+0.5477225575051661*f[115][l])*alpha_vdim[264][l]+0.6123724356957944*f[227][l]*alpha_vdim[260][l]+(0.4374088826398531*f[227][l]+0.6846531968814573*f[178][l])*alpha_vdim[259][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*f[162][l])*alpha_vdim[256][l]+0.5477225575051661*f[149][l]*alpha_vdim[255][l]+(0.5477225575051661*f[226][l]+0.6123724356957944*f[175][l])*alpha_vdim[251][l]+0.5477225575051661*(f[151][l]*alpha_vdim[250][l]+f[228][l]*alpha_vdim[249][l])+0.6123724356957944*(f[177][l]*alpha_vdim[249][l]+f[193][l]*alpha_vdim[248][l])+0.273861278752583*f[214][l]*alpha_cdim[247][l]+0.6123724356957944*f[198][l]*alpha_vdim[246][l]+(0.6123724356957944*f[238][l]+0.6846531968814573*f[214][l])*alpha_vdim[245][l]+0.6123724356957944*f[200][l]*alpha_vdim[244][l]+0.6846531968814573*f[227][l]*alpha_vdim[243][l]+0.3061862178478971*f[235][l]*alpha_cdim[243][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[239][l]+0.6846531968814573*alpha_cdim[0][l]*f[231][l]+0.5477225575051661*alpha_vdim[6][l]*f[230][l]+(0.3912303982179757*alpha_vdim[86][l]+0.6123724356957944*alpha_vdim[17][l]+0.4374088826398531*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[229][l]+(0.3499271061118826*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[226][l]+(0.3499271061118826*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[223][l]+0.6123724356957944*alpha_vdim[31][l]*f[219][l]+(0.4374088826398531*alpha_vdim[31][l]+0.6846531968814573*alpha_vdim[2][l])*f[218][l]+(0.5477225575051661*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[201][l]+0.4898979485566357*alpha_vdim[22][l]*f[199][l]+(0.3499271061118826*alpha_vdim[120][l]+0.5477225575051661*alpha_vdim[38][l]+0.3912303982179757*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[198][l]+0.4898979485566357*alpha_vdim[25][l]*f[196][l]+(0.3499271061118826*alpha_vdim[129][l]+0.5477225575051661*alpha_vdim[44][l]+0.3912303982179757*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[195][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[181][l]+0.6123724356957944*alpha_vdim[6][l]*f[180][l]+0.5477225575051661*alpha_vdim[59][l]*f[176][l]+(0.3912303982179757*alpha_vdim[59][l]+0.6123724356957944*alpha_vdim[10][l])*f[175][l]+0.5477225575051661*alpha_vdim[68][l]*f[167][l]+(0.3912303982179757*alpha_vdim[68][l]+0.6123724356957944*alpha_vdim[13][l])*f[166][l]+(0.4898979485566357*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[151][l]+(0.4898979485566357*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[150][l]+0.6846531968814573*alpha_vdim[31][l]*f[146][l]+0.5477225575051661*f[112][l]*alpha_vdim[129][l]+f[116][l]*(0.5477225575051661*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])+0.5477225575051661*alpha_vdim[22][l]*f[115][l]+0.6123724356957944*alpha_vdim[43][l]*f[112][l]+0.5477225575051661*alpha_vdim[25][l]*f[111][l]+0.6123724356957944*(alpha_vdim[59][l]*f[85][l]+alpha_vdim[68][l]*f[79][l]);
+    out[241][l] += (0.3499271061118826*f[194][l]+0.5477225575051661*f[108][l])*alpha_vdim[606][l]+(0.3499271061118826*f[196][l]+0.5477225575051661*f[111][l])*alpha_vdim[603][l]+(0.3912303982179757*f[225][l]+0.6123724356957944*f[168][l])*alpha_vdim[572][l]+(0.3499271061118826*f[222][l]+0.3912303982179757*f[163][l]+0.5477225575051661*f[162][l]+0.6123724356957944*f[76][l])*alpha_vdim[546][l]+0.4898979485566357*f[149][l]*alpha_vdim[545][l]+(0.3499271061118826*f[223][l]+0.3912303982179757*f[167][l]+0.5477225575051661*f[166][l]+0.6123724356957944*f[79][l])*alpha_vdim[543][l]+0.4898979485566357*f[150][l]*alpha_vdim[542][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[524][l]+0.5477225575051661*f[194][l]*alpha_vdim[523][l]+(0.3912303982179757*f[196][l]+0.6123724356957944*f[111][l])*alpha_vdim[520][l]+0.5477225575051661*f[196][l]*alpha_vdim[519][l]+(0.3912303982179757*f[237][l]+0.4374088826398531*f[209][l]+0.6123724356957944*f[208][l]+0.6846531968814573*f[134][l])*alpha_vdim[518][l]+0.5477225575051661*f[197][l]*alpha_vdim[517][l]+(0.4898979485566357*f[193][l]+0.5477225575051661*f[109][l])*alpha_vdim[508][l]+(0.4898979485566357*f[195][l]+0.5477225575051661*f[112][l])*alpha_vdim[507][l]+(0.4374088826398531*f[225][l]+0.6846531968814573*f[168][l])*alpha_vdim[503][l]+0.6123724356957944*f[225][l]*alpha_vdim[502][l]+0.5477225575051661*f[149][l]*alpha_vdim[496][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*f[163][l])*alpha_vdim[495][l]+0.5477225575051661*f[150][l]*alpha_vdim[494][l]+(0.5477225575051661*f[223][l]+0.6123724356957944*f[167][l])*alpha_vdim[493][l]+0.5477225575051661*f[224][l]*alpha_vdim[492][l]+0.6123724356957944*(f[169][l]*alpha_vdim[492][l]+f[194][l]*alpha_vdim[490][l]+f[196][l]*alpha_vdim[489][l]+f[197][l]*alpha_vdim[488][l]+f[237][l]*alpha_vdim[487][l])+0.6846531968814573*(f[209][l]*alpha_vdim[487][l]+f[225][l]*alpha_vdim[486][l])+(0.3499271061118826*f[194][l]+0.5477225575051661*f[108][l])*alpha_vdim[372][l]+(0.3499271061118826*f[199][l]+0.5477225575051661*f[115][l])*alpha_vdim[360][l]+(0.3912303982179757*f[228][l]+0.6123724356957944*f[177][l])*alpha_vdim[329][l]+(0.3499271061118826*f[222][l]+0.3912303982179757*f[163][l]+0.5477225575051661*f[162][l]+0.6123724356957944*f[76][l])*alpha_vdim[312][l]+0.4898979485566357*f[149][l]*alpha_vdim[311][l]+(0.3499271061118826*f[226][l]+0.3912303982179757*f[176][l]+0.5477225575051661*f[175][l]+0.6123724356957944*f[85][l])*alpha_vdim[300][l]+0.4898979485566357*f[151][l]*alpha_vdim[299][l]+(0.3912303982179757*f[194][l]+0.6123724356957944*f[108][l])*alpha_vdim[287][l]+0.5477225575051661*f[194][l]*alpha_vdim[286][l]+(0.3912303982179757*f[199][l]+0.6123724356957944*f[115][l])*alpha_vdim[277][l]+0.5477225575051661*f[199][l]*alpha_vdim[276][l]+(0.3912303982179757*f[238][l]+0.4374088826398531*f[215][l]+0.6123724356957944*f[214][l]+0.6846531968814573*f[143][l])*alpha_vdim[275][l]+0.5477225575051661*f[200][l]*alpha_vdim[274][l]+(0.4898979485566357*f[193][l]+0.5477225575051661*f[109][l])*alpha_vdim[268][l]+(0.4898979485566357*f[198][l]+0.5477225575051661*f[116][l])*alpha_vdim[264][l]+(0.4374088826398531*f[228][l]+0.6846531968814573*f[177][l])*alpha_vdim[260][l]+0.6123724356957944*f[228][l]*alpha_vdim[259][l]+0.5477225575051661*f[149][l]*alpha_vdim[256][l]+(0.5477225575051661*f[222][l]+0.6123724356957944*f[163][l])*alpha_vdim[255][l]+0.5477225575051661*f[151][l]*alpha_vdim[251][l]+(0.5477225575051661*f[226][l]+0.6123724356957944*f[176][l])*alpha_vdim[250][l]+0.5477225575051661*f[227][l]*alpha_vdim[249][l]+0.6123724356957944*(f[178][l]*alpha_vdim[249][l]+f[194][l]*alpha_vdim[248][l]+f[200][l]*alpha_cdim[247][l]+f[199][l]*alpha_vdim[246][l]+f[200][l]*alpha_vdim[245][l]+f[238][l]*alpha_vdim[244][l])+0.6846531968814573*(f[215][l]*alpha_vdim[244][l]+f[228][l]*alpha_vdim[243][l]+f[231][l]*alpha_cdim[243][l])+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*alpha_vdim[1][l])*f[239][l]+0.3061862178478971*alpha_cdim[0][l]*f[236][l]+(0.3912303982179757*alpha_vdim[86][l]+0.4374088826398531*alpha_vdim[17][l]+0.6123724356957944*alpha_vdim[16][l]+0.6846531968814573*alpha_vdim[0][l])*f[230][l]+0.5477225575051661*alpha_vdim[6][l]*f[229][l]+(0.3499271061118826*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[226][l]+(0.3499271061118826*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[223][l]+(0.4374088826398531*alpha_vdim[32][l]+0.273861278752583*alpha_cdim[3][l]+0.6846531968814573*alpha_vdim[1][l])*f[219][l]+0.6123724356957944*alpha_vdim[32][l]*f[218][l]+(0.5477225575051661*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[201][l]+(0.3499271061118826*alpha_vdim[120][l]+0.3912303982179757*alpha_vdim[38][l]+0.5477225575051661*alpha_vdim[37][l]+0.6123724356957944*alpha_vdim[4][l])*f[199][l]+0.4898979485566357*alpha_vdim[22][l]*f[198][l]+(0.3499271061118826*alpha_vdim[129][l]+0.3912303982179757*alpha_vdim[44][l]+0.5477225575051661*alpha_vdim[43][l]+0.6123724356957944*alpha_vdim[5][l])*f[196][l]+0.4898979485566357*alpha_vdim[25][l]*f[195][l]+0.6123724356957944*alpha_vdim[6][l]*f[181][l]+(0.6123724356957944*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[180][l]+(0.3912303982179757*alpha_vdim[60][l]+0.6123724356957944*alpha_vdim[9][l])*f[176][l]+0.5477225575051661*alpha_vdim[60][l]*f[175][l]+(0.3912303982179757*alpha_vdim[69][l]+0.6123724356957944*alpha_vdim[12][l])*f[167][l]+0.5477225575051661*alpha_vdim[69][l]*f[166][l]+(0.4898979485566357*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[151][l]+(0.4898979485566357*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[150][l]+0.6846531968814573*alpha_vdim[32][l]*f[146][l]+0.5477225575051661*(f[111][l]*alpha_vdim[129][l]+f[115][l]*alpha_vdim[120][l]+alpha_vdim[22][l]*f[116][l])+0.6123724356957944*alpha_vdim[38][l]*f[115][l]+0.5477225575051661*alpha_vdim[25][l]*f[112][l]+0.6123724356957944*(alpha_vdim[44][l]*f[111][l]+alpha_vdim[60][l]*f[85][l]+alpha_vdim[69][l]*f[79][l]);
+    out[242][l] += (0.249947932937059*f[222][l]+0.3912303982179757*(f[163][l]+f[162][l])+0.6123724356957944*f[76][l])*alpha_vdim[606][l]+(0.249947932937059*f[223][l]+0.3912303982179757*(f[167][l]+f[166][l])+0.6123724356957944*f[79][l])*alpha_vdim[603][l]+(0.2794502844414113*f[237][l]+0.4374088826398531*(f[209][l]+f[208][l])+0.6846531968814573*f[134][l])*alpha_vdim[572][l]+(0.3499271061118826*f[194][l]+0.5477225575051661*f[108][l])*alpha_vdim[546][l]+(0.3499271061118826*f[193][l]+0.5477225575051661*f[109][l])*alpha_vdim[545][l]+(0.3499271061118826*f[196][l]+0.5477225575051661*f[111][l])*alpha_vdim[543][l]+(0.3499271061118826*f[195][l]+0.5477225575051661*f[112][l])*alpha_vdim[542][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[162][l])*alpha_vdim[524][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l])*alpha_vdim[523][l]+(0.3912303982179757*f[223][l]+0.6123724356957944*f[166][l])*alpha_vdim[520][l]+(0.3912303982179757*f[223][l]+0.6123724356957944*f[167][l])*alpha_vdim[519][l]+(0.3912303982179757*f[225][l]+0.6123724356957944*f[168][l])*alpha_vdim[518][l]+(0.3912303982179757*f[224][l]+0.6123724356957944*f[169][l])*alpha_vdim[517][l]+0.4898979485566357*(f[149][l]*alpha_vdim[508][l]+f[150][l]*alpha_vdim[507][l])+(0.4374088826398531*f[237][l]+0.6846531968814573*f[208][l])*alpha_vdim[503][l]+(0.4374088826398531*f[237][l]+0.6846531968814573*f[209][l])*alpha_vdim[502][l]+0.5477225575051661*(f[193][l]*alpha_vdim[496][l]+f[194][l]*alpha_vdim[495][l]+f[195][l]*alpha_vdim[494][l]+f[196][l]*alpha_vdim[493][l]+f[197][l]*alpha_vdim[492][l])+0.6123724356957944*(f[222][l]*alpha_vdim[490][l]+f[223][l]*alpha_vdim[489][l]+f[224][l]*alpha_vdim[488][l]+f[225][l]*alpha_vdim[487][l])+0.6846531968814573*f[237][l]*alpha_vdim[486][l]+(0.249947932937059*f[222][l]+0.3912303982179757*(f[163][l]+f[162][l])+0.6123724356957944*f[76][l])*alpha_vdim[372][l]+(0.249947932937059*f[226][l]+0.3912303982179757*(f[176][l]+f[175][l])+0.6123724356957944*f[85][l])*alpha_vdim[360][l]+(0.2794502844414113*f[238][l]+0.4374088826398531*(f[215][l]+f[214][l])+0.6846531968814573*f[143][l])*alpha_vdim[329][l]+(0.3499271061118826*f[194][l]+0.5477225575051661*f[108][l])*alpha_vdim[312][l]+(0.3499271061118826*f[193][l]+0.5477225575051661*f[109][l])*alpha_vdim[311][l]+(0.3499271061118826*f[199][l]+0.5477225575051661*f[115][l])*alpha_vdim[300][l]+(0.3499271061118826*f[198][l]+0.5477225575051661*f[116][l])*alpha_vdim[299][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[162][l])*alpha_vdim[287][l]+(0.3912303982179757*f[222][l]+0.6123724356957944*f[163][l])*alpha_vdim[286][l]+(0.3912303982179757*f[226][l]+0.6123724356957944*f[175][l])*alpha_vdim[277][l]+(0.3912303982179757*f[226][l]+0.6123724356957944*f[176][l])*alpha_vdim[276][l]+(0.3912303982179757*f[228][l]+0.6123724356957944*f[177][l])*alpha_vdim[275][l]+(0.3912303982179757*f[227][l]+0.6123724356957944*f[178][l])*alpha_vdim[274][l]+0.4898979485566357*(f[149][l]*alpha_vdim[268][l]+f[151][l]*alpha_vdim[264][l])+(0.4374088826398531*f[238][l]+0.6846531968814573*f[214][l])*alpha_vdim[260][l]+(0.4374088826398531*f[238][l]+0.6846531968814573*f[215][l])*alpha_vdim[259][l]+0.5477225575051661*(f[193][l]*alpha_vdim[256][l]+f[194][l]*alpha_vdim[255][l]+f[198][l]*alpha_vdim[251][l]+f[199][l]*alpha_vdim[250][l]+f[200][l]*alpha_vdim[249][l])+0.6123724356957944*(f[222][l]*alpha_vdim[248][l]+f[227][l]*alpha_cdim[247][l]+f[226][l]*alpha_vdim[246][l]+f[227][l]*alpha_vdim[245][l]+f[228][l]*alpha_vdim[244][l])+0.6846531968814573*(f[238][l]*alpha_vdim[243][l]+f[240][l]*alpha_cdim[243][l]+alpha_cdim[0][l]*f[241][l])+(0.2794502844414113*alpha_vdim[86][l]+0.4374088826398531*(alpha_vdim[17][l]+alpha_vdim[16][l])+0.6846531968814573*alpha_vdim[0][l])*f[239][l]+(0.3912303982179757*alpha_vdim[32][l]+0.6123724356957944*(alpha_cdim[3][l]+alpha_vdim[1][l]))*f[230][l]+(0.3912303982179757*alpha_vdim[31][l]+0.6123724356957944*alpha_vdim[2][l])*f[229][l]+(0.249947932937059*alpha_vdim[120][l]+0.3912303982179757*(alpha_vdim[38][l]+alpha_vdim[37][l])+0.6123724356957944*alpha_vdim[4][l])*f[226][l]+(0.249947932937059*alpha_vdim[129][l]+0.3912303982179757*(alpha_vdim[44][l]+alpha_vdim[43][l])+0.6123724356957944*alpha_vdim[5][l])*f[223][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[16][l])*f[219][l]+(0.4374088826398531*alpha_vdim[86][l]+0.6846531968814573*alpha_vdim[17][l])*f[218][l]+0.5477225575051661*alpha_vdim[6][l]*f[201][l]+(0.3499271061118826*alpha_vdim[60][l]+0.5477225575051661*alpha_vdim[9][l])*f[199][l]+(0.3499271061118826*alpha_vdim[59][l]+0.5477225575051661*alpha_vdim[10][l])*f[198][l]+(0.3499271061118826*alpha_vdim[69][l]+0.5477225575051661*alpha_vdim[12][l])*f[196][l]+(0.3499271061118826*alpha_vdim[68][l]+0.5477225575051661*alpha_vdim[13][l])*f[195][l]+0.6123724356957944*(alpha_vdim[31][l]*f[181][l]+alpha_vdim[32][l]*f[180][l])+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[37][l])*f[176][l]+(0.3912303982179757*alpha_vdim[120][l]+0.6123724356957944*alpha_vdim[38][l])*f[175][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[43][l])*f[167][l]+(0.3912303982179757*alpha_vdim[129][l]+0.6123724356957944*alpha_vdim[44][l])*f[166][l]+0.4898979485566357*(alpha_vdim[22][l]*f[151][l]+alpha_vdim[25][l]*f[150][l])+0.6846531968814573*alpha_vdim[86][l]*f[146][l]+0.6123724356957944*(f[79][l]*alpha_vdim[129][l]+f[85][l]*alpha_vdim[120][l])+0.5477225575051661*(alpha_vdim[59][l]*f[116][l]+alpha_vdim[60][l]*f[115][l]+alpha_vdim[68][l]*f[112][l]+alpha_vdim[69][l]*f[111][l]);
+
+    cfl[l] = cflFreq_mid;
+  } 
+} 
@@ -0,0 +1,293 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_vol_3x3v_ser_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_vol_3x3v_ser_p1: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // field:      q/m*EM fields.
+  // cot_vec:   Only used in gen geo.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv0dx0 = dxv[3]/dxv[0];
+  double dv1dx1 = dxv[4]/dxv[1];
+  double dv2dx2 = dxv[5]/dxv[2];
+  const double dv10 = 2/dxv[3];
+  const double *E0 = &field[0];
+  const double dv11 = 2/dxv[4];
+  const double *E1 = &field[8];
+  const double dv12 = 2/dxv[5];
+  const double *E2 = &field[16];
+  const double *B0 = &field[24];
+  const double *B1 = &field[32];
+  const double *B2 = &field[40];
+
+  double alpha_cdim[480][GKYL_VLASOV_BATCH] = {{0.0}};
+  double alpha_vdim[480][GKYL_VLASOV_BATCH] = {{0.0}};
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w0dx0 = w[3][l]/dxv[0];
+    double w1dx1 = w[4][l]/dxv[1];
+    double w2dx2 = w[5][l]/dxv[2];
+    const double dv1 = dxv[3], wv1 = w[3][l];
+    const double dv2 = dxv[4], wv2 = w[4][l];
+    const double dv3 = dxv[5], wv3 = w[5][l];
+
+    double cflFreq_mid = 0.0;
+
+    alpha_cdim[0][l] = 16.0*w0dx0;
+    alpha_cdim[4][l] = 4.618802153517007*dv0dx0;
+    cflFreq_mid += 3.0*(fabs(w0dx0)+0.5*dv0dx0);
+
+    alpha_cdim[160][l] = 16.0*w1dx1;
+    alpha_cdim[165][l] = 4.618802153517007*dv1dx1;
+    cflFreq_mid += 3.0*(fabs(w1dx1)+0.5*dv1dx1);
+
+    alpha_cdim[320][l] = 16.0*w2dx2;
+    alpha_cdim[326][l] = 4.618802153517007*dv2dx2;
+    cflFreq_mid += 3.0*(fabs(w2dx2)+0.5*dv2dx2);
+
+    alpha_vdim[0][l] = dv10*(2.828427124746191*(B2[0]*wv2+E0[0])-2.828427124746191*B1[0]*wv3);
+    alpha_vdim[1][l] = dv10*(2.828427124746191*(B2[1]*wv2+E0[1])-2.828427124746191*B1[1]*wv3);
+    alpha_vdim[2][l] = dv10*(2.828427124746191*(B2[2]*wv2+E0[2])-2.828427124746191*B1[2]*wv3);
+    alpha_vdim[3][l] = dv10*(2.828427124746191*(B2[3]*wv2+E0[3])-2.828427124746191*B1[3]*wv3);
+    alpha_vdim[5][l] = 0.8164965809277261*B2[0]*dv10*dv2;
+    alpha_vdim[6][l] = -0.8164965809277261*B1[0]*dv10*dv3;
+    alpha_vdim[7][l] = dv10*(2.828427124746191*(B2[4]*wv2+E0[4])-2.828427124746191*B1[4]*wv3);
+    alpha_vdim[8][l] = dv10*(2.828427124746191*(B2[5]*wv2+E0[5])-2.828427124746191*B1[5]*wv3);
+    alpha_vdim[9][l] = dv10*(2.828427124746191*(B2[6]*wv2+E0[6])-2.828427124746191*B1[6]*wv3);
+    alpha_vdim[13][l] = 0.8164965809277261*B2[1]*dv10*dv2;
+    alpha_vdim[14][l] = 0.8164965809277261*B2[2]*dv10*dv2;
+    alpha_vdim[15][l] = 0.8164965809277261*B2[3]*dv10*dv2;
+    alpha_vdim[17][l] = -0.8164965809277261*B1[1]*dv10*dv3;
+    alpha_vdim[18][l] = -0.8164965809277261*B1[2]*dv10*dv3;
+    alpha_vdim[19][l] = -0.8164965809277261*B1[3]*dv10*dv3;
+    alpha_vdim[22][l] = dv10*(2.828427124746191*(B2[7]*wv2+E0[7])-2.828427124746191*B1[7]*wv3);
+    alpha_vdim[26][l] = 0.8164965809277261*B2[4]*dv10*dv2;
+    alpha_vdim[27][l] = 0.8164965809277261*B2[5]*dv10*dv2;
+    alpha_vdim[28][l] = 0.8164965809277261*B2[6]*dv10*dv2;
+    alpha_vdim[32][l] = -0.8164965809277261*B1[4]*dv10*dv3;
+    alpha_vdim[33][l] = -0.8164965809277261*B1[5]*dv10*dv3;
+    alpha_vdim[34][l] = -0.8164965809277261*B1[6]*dv10*dv3;
+    alpha_vdim[43][l] = 0.8164965809277261*B2[7]*dv10*dv2;
+    alpha_vdim[47][l] = -0.8164965809277261*B1[7]*dv10*dv3;
+    cflFreq_mid += 5.0*fabs(0.0625*alpha_vdim[0][l]);
+
+    alpha_vdim[160][l] = dv11*(2.828427124746191*B0[0]*wv3-2.828427124746191*B2[0]*wv1+2.828427124746191*E1[0]);
+    alpha_vdim[161][l] = dv11*(2.828427124746191*B0[1]*wv3-2.828427124746191*B2[1]*wv1+2.828427124746191*E1[1]);
+    alpha_vdim[162][l] = dv11*(2.828427124746191*B0[2]*wv3-2.828427124746191*B2[2]*wv1+2.828427124746191*E1[2]);
+    alpha_vdim[163][l] = dv11*(2.828427124746191*B0[3]*wv3-2.828427124746191*B2[3]*wv1+2.828427124746191*E1[3]);
+    alpha_vdim[164][l] = -0.8164965809277261*B2[0]*dv1*dv11;
+    alpha_vdim[166][l] = 0.8164965809277261*B0[0]*dv11*dv3;
+    alpha_vdim[167][l] = dv11*(2.828427124746191*B0[4]*wv3-2.828427124746191*B2[4]*wv1+2.828427124746191*E1[4]);
+    alpha_vdim[168][l] = dv11*(2.828427124746191*B0[5]*wv3-2.828427124746191*B2[5]*wv1+2.828427124746191*E1[5]);
+    alpha_vdim[169][l] = dv11*(2.828427124746191*B0[6]*wv3-2.828427124746191*B2[6]*wv1+2.828427124746191*E1[6]);
+    alpha_vdim[170][l] = -0.8164965809277261*B2[1]*dv1*dv11;
+    alpha_vdim[171][l] = -0.8164965809277261*B2[2]*dv1*dv11;
+    alpha_vdim[172][l] = -0.8164965809277261*B2[3]*dv1*dv11;
+    alpha_vdim[177][l] = 0.8164965809277261*B0[1]*dv11*dv3;
+    alpha_vdim[178][l] = 0.8164965809277261*B0[2]*dv11*dv3;
+    alpha_vdim[179][l] = 0.8164965809277261*B0[3]*dv11*dv3;
+    alpha_vdim[182][l] = dv11*(2.828427124746191*B0[7]*wv3-2.828427124746191*B2[7]*wv1+2.828427124746191*E1[7]);
+    alpha_vdim[183][l] = -0.8164965809277261*B2[4]*dv1*dv11;
+    alpha_vdim[184][l] = -0.8164965809277261*B2[5]*dv1*dv11;
+    alpha_vdim[185][l] = -0.8164965809277261*B2[6]*dv1*dv11;
+    alpha_vdim[192][l] = 0.8164965809277261*B0[4]*dv11*dv3;
+    alpha_vdim[193][l] = 0.8164965809277261*B0[5]*dv11*dv3;
+    alpha_vdim[194][l] = 0.8164965809277261*B0[6]*dv11*dv3;
+    alpha_vdim[202][l] = -0.8164965809277261*B2[7]*dv1*dv11;
+    alpha_vdim[207][l] = 0.8164965809277261*B0[7]*dv11*dv3;
+    cflFreq_mid += 5.0*fabs(0.0625*alpha_vdim[160][l]);
+
+    alpha_vdim[320][l] = dv12*(2.828427124746191*(B1[0]*wv1+E2[0])-2.828427124746191*B0[0]*wv2);
+    alpha_vdim[321][l] = dv12*(2.828427124746191*(B1[1]*wv1+E2[1])-2.828427124746191*B0[1]*wv2);
+    alpha_vdim[322][l] = dv12*(2.828427124746191*(B1[2]*wv1+E2[2])-2.828427124746191*B0[2]*wv2);
+    alpha_vdim[323][l] = dv12*(2.828427124746191*(B1[3]*wv1+E2[3])-2.828427124746191*B0[3]*wv2);
+    alpha_vdim[324][l] = 0.8164965809277261*B1[0]*dv1*dv12;
+    alpha_vdim[325][l] = -0.8164965809277261*B0[0]*dv12*dv2;
+    alpha_vdim[327][l] = dv12*(2.828427124746191*(B1[4]*wv1+E2[4])-2.828427124746191*B0[4]*wv2);
+    alpha_vdim[328][l] = dv12*(2.828427124746191*(B1[5]*wv1+E2[5])-2.828427124746191*B0[5]*wv2);
+    alpha_vdim[329][l] = dv12*(2.828427124746191*(B1[6]*wv1+E2[6])-2.828427124746191*B0[6]*wv2);
+    alpha_vdim[330][l] = 0.8164965809277261*B1[1]*dv1*dv12;
+    alpha_vdim[331][l] = 0.8164965809277261*B1[2]*dv1*dv12;
+    alpha_vdim[332][l] = 0.8164965809277261*B1[3]*dv1*dv12;
+    alpha_vdim[333][l] = -0.8164965809277261*B0[1]*dv12*dv2;
+    alpha_vdim[334][l] = -0.8164965809277261*B0[2]*dv12*dv2;
+    alpha_vdim[335][l] = -0.8164965809277261*B0[3]*dv12*dv2;
+    alpha_vdim[342][l] = dv12*(2.828427124746191*(B1[7]*wv1+E2[7])-2.828427124746191*B0[7]*wv2);
+    alpha_vdim[343][l] = 0.8164965809277261*B1[4]*dv1*dv12;
+    alpha_vdim[344][l] = 0.8164965809277261*B1[5]*dv1*dv12;
+    alpha_vdim[345][l] = 0.8164965809277261*B1[6]*dv1*dv12;
+    alpha_vdim[346][l] = -0.8164965809277261*B0[4]*dv12*dv2;
+    alpha_vdim[347][l] = -0.8164965809277261*B0[5]*dv12*dv2;
+    alpha_vdim[348][l] = -0.8164965809277261*B0[6]*dv12*dv2;
+    alpha_vdim[362][l] = 0.8164965809277261*B1[7]*dv1*dv12;
+    alpha_vdim[363][l] = -0.8164965809277261*B0[7]*dv12*dv2;
+    cflFreq_mid += 5.0*fabs(0.0625*alpha_vdim[320][l]);
+
+    out[1][l] += 0.2165063509461096*(alpha_cdim[4][l]*f[4][l]+alpha_cdim[0][l]*f[0][l]);
+    out[2][l] += 0.2165063509461096*(f[5][l]*alpha_cdim[165][l]+f[0][l]*alpha_cdim[160][l]);
+    out[3][l] += 0.2165063509461096*(f[6][l]*alpha_cdim[326][l]+f[0][l]*alpha_cdim[320][l]);
+    out[4][l] += 0.2165063509461096*(alpha_vdim[47][l]*f[47][l]+alpha_vdim[43][l]*f[43][l]+alpha_vdim[34][l]*f[34][l]+alpha_vdim[33][l]*f[33][l]+alpha_vdim[32][l]*f[32][l]+alpha_vdim[28][l]*f[28][l]+alpha_vdim[27][l]*f[27][l]+alpha_vdim[26][l]*f[26][l]+alpha_vdim[22][l]*f[22][l]+alpha_vdim[19][l]*f[19][l]+alpha_vdim[18][l]*f[18][l]+alpha_vdim[17][l]*f[17][l]+alpha_vdim[15][l]*f[15][l]+alpha_vdim[14][l]*f[14][l]+alpha_vdim[13][l]*f[13][l]+alpha_vdim[9][l]*f[9][l]+alpha_vdim[8][l]*f[8][l]+alpha_vdim[7][l]*f[7][l]+alpha_vdim[6][l]*f[6][l]+alpha_vdim[5][l]*f[5][l]+alpha_vdim[3][l]*f[3][l]+alpha_vdim[2][l]*f[2][l]+alpha_vdim[1][l]*f[1][l]+alpha_vdim[0][l]*f[0][l]);
+    out[5][l] += 0.2165063509461096*(f[47][l]*alpha_vdim[207][l]+f[42][l]*alpha_vdim[202][l]+f[34][l]*alpha_vdim[194][l]+f[33][l]*alpha_vdim[193][l]+f[32][l]*alpha_vdim[192][l]+f[25][l]*alpha_vdim[185][l]+f[24][l]*alpha_vdim[184][l]+f[23][l]*alpha_vdim[183][l]+f[22][l]*alpha_vdim[182][l]+f[19][l]*alpha_vdim[179][l]+f[18][l]*alpha_vdim[178][l]+f[17][l]*alpha_vdim[177][l]+f[12][l]*alpha_vdim[172][l]+f[11][l]*alpha_vdim[171][l]+f[10][l]*alpha_vdim[170][l]+f[9][l]*alpha_vdim[169][l]+f[8][l]*alpha_vdim[168][l]+f[7][l]*alpha_vdim[167][l]+f[6][l]*alpha_vdim[166][l]+f[4][l]*alpha_vdim[164][l]+f[3][l]*alpha_vdim[163][l]+f[2][l]*alpha_vdim[162][l]+f[1][l]*alpha_vdim[161][l]+f[0][l]*alpha_vdim[160][l]);
+    out[6][l] += 0.2165063509461096*(f[43][l]*alpha_vdim[363][l]+f[42][l]*alpha_vdim[362][l]+f[28][l]*alpha_vdim[348][l]+f[27][l]*alpha_vdim[347][l]+f[26][l]*alpha_vdim[346][l]+f[25][l]*alpha_vdim[345][l]+f[24][l]*alpha_vdim[344][l]+f[23][l]*alpha_vdim[343][l]+f[22][l]*alpha_vdim[342][l]+f[15][l]*alpha_vdim[335][l]+f[14][l]*alpha_vdim[334][l]+f[13][l]*alpha_vdim[333][l]+f[12][l]*alpha_vdim[332][l]+f[11][l]*alpha_vdim[331][l]+f[10][l]*alpha_vdim[330][l]+f[9][l]*alpha_vdim[329][l]+f[8][l]*alpha_vdim[328][l]+f[7][l]*alpha_vdim[327][l]+f[5][l]*alpha_vdim[325][l]+f[4][l]*alpha_vdim[324][l]+f[3][l]*alpha_vdim[323][l]+f[2][l]*alpha_vdim[322][l]+f[1][l]*alpha_vdim[321][l]+f[0][l]*alpha_vdim[320][l]);
+    out[7][l] += 0.2165063509461096*(f[13][l]*alpha_cdim[165][l]+f[1][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[11][l]+alpha_cdim[0][l]*f[2][l]);
+    out[8][l] += 0.2165063509461096*(f[17][l]*alpha_cdim[326][l]+f[1][l]*alpha_cdim[320][l]+alpha_cdim[4][l]*f[12][l]+alpha_cdim[0][l]*f[3][l]);
+    out[9][l] += 0.2165063509461096*(f[18][l]*alpha_cdim[326][l]+f[2][l]*alpha_cdim[320][l]+f[15][l]*alpha_cdim[165][l]+f[3][l]*alpha_cdim[160][l]);
+    out[10][l] += 0.1936491673103708*alpha_cdim[4][l]*f[64][l]+0.2165063509461096*(alpha_vdim[34][l]*f[47][l]+f[34][l]*alpha_vdim[47][l]+alpha_vdim[28][l]*f[43][l]+f[28][l]*alpha_vdim[43][l]+alpha_vdim[19][l]*f[33][l]+f[19][l]*alpha_vdim[33][l]+alpha_vdim[18][l]*f[32][l]+f[18][l]*alpha_vdim[32][l]+alpha_vdim[15][l]*f[27][l]+f[15][l]*alpha_vdim[27][l]+alpha_vdim[14][l]*f[26][l]+f[14][l]*alpha_vdim[26][l]+alpha_vdim[9][l]*f[22][l]+f[9][l]*alpha_vdim[22][l]+alpha_vdim[6][l]*f[17][l]+f[6][l]*alpha_vdim[17][l]+alpha_vdim[5][l]*f[13][l]+f[5][l]*alpha_vdim[13][l]+alpha_vdim[3][l]*f[8][l]+f[3][l]*alpha_vdim[8][l]+alpha_vdim[2][l]*f[7][l]+f[2][l]*alpha_vdim[7][l]+alpha_cdim[0][l]*f[4][l]+f[0][l]*alpha_cdim[4][l]+alpha_vdim[0][l]*f[1][l]+f[0][l]*alpha_vdim[1][l]);
+    out[11][l] += 0.2165063509461096*(f[16][l]*alpha_cdim[165][l]+f[4][l]*alpha_cdim[160][l]+alpha_vdim[33][l]*f[47][l]+f[33][l]*alpha_vdim[47][l]+alpha_vdim[27][l]*f[43][l]+f[27][l]*alpha_vdim[43][l]+alpha_vdim[19][l]*f[34][l]+f[19][l]*alpha_vdim[34][l]+alpha_vdim[17][l]*f[32][l]+f[17][l]*alpha_vdim[32][l]+alpha_vdim[15][l]*f[28][l]+f[15][l]*alpha_vdim[28][l]+alpha_vdim[13][l]*f[26][l]+f[13][l]*alpha_vdim[26][l]+alpha_vdim[8][l]*f[22][l]+f[8][l]*alpha_vdim[22][l]+alpha_vdim[6][l]*f[18][l]+f[6][l]*alpha_vdim[18][l]+alpha_vdim[5][l]*f[14][l]+f[5][l]*alpha_vdim[14][l]+alpha_vdim[3][l]*f[9][l]+f[3][l]*alpha_vdim[9][l]+alpha_vdim[1][l]*f[7][l]+f[1][l]*alpha_vdim[7][l]+alpha_vdim[0][l]*f[2][l]+f[0][l]*alpha_vdim[2][l]);
+    out[12][l] += 0.2165063509461096*(f[20][l]*alpha_cdim[326][l]+f[4][l]*alpha_cdim[320][l]+alpha_vdim[32][l]*f[47][l]+f[32][l]*alpha_vdim[47][l]+alpha_vdim[26][l]*f[43][l]+f[26][l]*alpha_vdim[43][l]+alpha_vdim[18][l]*f[34][l]+f[18][l]*alpha_vdim[34][l]+alpha_vdim[17][l]*f[33][l]+f[17][l]*alpha_vdim[33][l]+alpha_vdim[14][l]*f[28][l]+f[14][l]*alpha_vdim[28][l]+alpha_vdim[13][l]*f[27][l]+f[13][l]*alpha_vdim[27][l]+alpha_vdim[7][l]*f[22][l]+f[7][l]*alpha_vdim[22][l]+alpha_vdim[6][l]*f[19][l]+f[6][l]*alpha_vdim[19][l]+alpha_vdim[5][l]*f[15][l]+f[5][l]*alpha_vdim[15][l]+alpha_vdim[2][l]*f[9][l]+f[2][l]*alpha_vdim[9][l]+alpha_vdim[1][l]*f[8][l]+f[1][l]*alpha_vdim[8][l]+alpha_vdim[0][l]*f[3][l]+f[0][l]*alpha_vdim[3][l]);
+    out[13][l] += 0.2165063509461096*(f[34][l]*alpha_vdim[207][l]+f[25][l]*alpha_vdim[202][l]+f[47][l]*alpha_vdim[194][l]+f[19][l]*alpha_vdim[193][l]+f[18][l]*alpha_vdim[192][l]+f[42][l]*alpha_vdim[185][l]+f[12][l]*alpha_vdim[184][l]+f[11][l]*alpha_vdim[183][l]+f[9][l]*alpha_vdim[182][l]+f[33][l]*alpha_vdim[179][l]+f[32][l]*alpha_vdim[178][l]+f[6][l]*alpha_vdim[177][l]+f[24][l]*alpha_vdim[172][l]+f[23][l]*alpha_vdim[171][l]+f[4][l]*alpha_vdim[170][l]+f[22][l]*alpha_vdim[169][l]+f[3][l]*alpha_vdim[168][l]+f[2][l]*alpha_vdim[167][l]+f[17][l]*alpha_vdim[166][l]+f[10][l]*alpha_vdim[164][l]+f[8][l]*alpha_vdim[163][l]+f[7][l]*alpha_vdim[162][l]+f[0][l]*alpha_vdim[161][l]+f[1][l]*alpha_vdim[160][l]+alpha_cdim[4][l]*f[16][l]+alpha_cdim[0][l]*f[5][l]);
+    out[14][l] += 0.2165063509461096*(f[33][l]*alpha_vdim[207][l]+f[24][l]*alpha_vdim[202][l]+f[19][l]*alpha_vdim[194][l]+f[47][l]*alpha_vdim[193][l]+f[17][l]*alpha_vdim[192][l]+f[12][l]*alpha_vdim[185][l]+f[42][l]*alpha_vdim[184][l]+f[10][l]*alpha_vdim[183][l]+f[8][l]*alpha_vdim[182][l]+f[34][l]*alpha_vdim[179][l]+f[6][l]*alpha_vdim[178][l]+f[32][l]*alpha_vdim[177][l]+f[25][l]*alpha_vdim[172][l]+f[4][l]*alpha_vdim[171][l]+f[23][l]*alpha_vdim[170][l]+f[3][l]*alpha_vdim[169][l]+f[22][l]*alpha_vdim[168][l]+f[1][l]*alpha_vdim[167][l]+f[18][l]*alpha_vdim[166][l])+0.1936491673103708*f[96][l]*alpha_cdim[165][l]+0.2165063509461096*(f[0][l]*alpha_cdim[165][l]+f[11][l]*alpha_vdim[164][l]+f[9][l]*alpha_vdim[163][l]+f[0][l]*alpha_vdim[162][l]+f[7][l]*alpha_vdim[161][l]+f[2][l]*alpha_vdim[160][l]+f[5][l]*alpha_cdim[160][l]);
+    out[15][l] += 0.2165063509461096*(f[21][l]*alpha_cdim[326][l]+f[5][l]*alpha_cdim[320][l]+f[32][l]*alpha_vdim[207][l]+f[23][l]*alpha_vdim[202][l]+f[18][l]*alpha_vdim[194][l]+f[17][l]*alpha_vdim[193][l]+f[47][l]*alpha_vdim[192][l]+f[11][l]*alpha_vdim[185][l]+f[10][l]*alpha_vdim[184][l]+f[42][l]*alpha_vdim[183][l]+f[7][l]*alpha_vdim[182][l]+f[6][l]*alpha_vdim[179][l]+f[34][l]*alpha_vdim[178][l]+f[33][l]*alpha_vdim[177][l]+f[4][l]*alpha_vdim[172][l]+f[25][l]*alpha_vdim[171][l]+f[24][l]*alpha_vdim[170][l]+f[2][l]*alpha_vdim[169][l]+f[1][l]*alpha_vdim[168][l]+f[22][l]*alpha_vdim[167][l]+f[19][l]*alpha_vdim[166][l]+f[12][l]*alpha_vdim[164][l]+f[0][l]*alpha_vdim[163][l]+f[9][l]*alpha_vdim[162][l]+f[8][l]*alpha_vdim[161][l]+f[3][l]*alpha_vdim[160][l]);
+    out[16][l] += 0.2165063509461096*f[58][l]*alpha_vdim[207][l]+0.1936491673103708*f[80][l]*alpha_vdim[202][l]+0.2165063509461096*(f[22][l]*alpha_vdim[202][l]+f[50][l]*alpha_vdim[194][l]+f[49][l]*alpha_vdim[193][l]+f[48][l]*alpha_vdim[192][l])+(0.1936491673103708*f[72][l]+0.2165063509461096*f[9][l])*alpha_vdim[185][l]+(0.1936491673103708*f[71][l]+0.2165063509461096*f[8][l])*alpha_vdim[184][l]+0.1936491673103708*f[70][l]*alpha_vdim[183][l]+0.2165063509461096*(f[7][l]*alpha_vdim[183][l]+f[42][l]*alpha_vdim[182][l]+f[37][l]*alpha_vdim[179][l]+f[36][l]*alpha_vdim[178][l]+f[35][l]*alpha_vdim[177][l])+(0.1936491673103708*f[67][l]+0.2165063509461096*f[3][l])*alpha_vdim[172][l]+(0.1936491673103708*f[66][l]+0.2165063509461096*f[2][l])*alpha_vdim[171][l]+0.1936491673103708*f[65][l]*alpha_vdim[170][l]+0.2165063509461096*(f[1][l]*alpha_vdim[170][l]+f[25][l]*alpha_vdim[169][l]+f[24][l]*alpha_vdim[168][l]+f[23][l]*alpha_vdim[167][l]+f[20][l]*alpha_vdim[166][l])+0.1936491673103708*f[64][l]*alpha_vdim[164][l]+0.2165063509461096*(f[0][l]*alpha_vdim[164][l]+f[12][l]*alpha_vdim[163][l]+f[11][l]*alpha_vdim[162][l]+f[10][l]*alpha_vdim[161][l]+f[4][l]*alpha_vdim[160][l])+0.1936491673103708*(alpha_vdim[43][l]*f[112][l]+alpha_vdim[28][l]*f[104][l]+alpha_vdim[27][l]*f[103][l]+alpha_vdim[26][l]*f[102][l]+alpha_vdim[15][l]*f[99][l]+alpha_vdim[14][l]*f[98][l]+alpha_vdim[13][l]*f[97][l]+alpha_vdim[5][l]*f[96][l])+0.2165063509461096*(alpha_vdim[47][l]*f[59][l]+alpha_vdim[34][l]*f[53][l]+alpha_vdim[33][l]*f[52][l]+alpha_vdim[32][l]*f[51][l]+alpha_vdim[22][l]*f[43][l]+f[22][l]*alpha_vdim[43][l]+alpha_vdim[19][l]*f[40][l]+alpha_vdim[18][l]*f[39][l]+alpha_vdim[17][l]*f[38][l]+alpha_vdim[9][l]*f[28][l]+f[9][l]*alpha_vdim[28][l]+alpha_vdim[8][l]*f[27][l]+f[8][l]*alpha_vdim[27][l]+alpha_vdim[7][l]*f[26][l]+f[7][l]*alpha_vdim[26][l]+alpha_vdim[6][l]*f[21][l]+alpha_vdim[3][l]*f[15][l]+f[3][l]*alpha_vdim[15][l]+alpha_vdim[2][l]*f[14][l]+f[2][l]*alpha_vdim[14][l]+alpha_vdim[1][l]*f[13][l]+f[1][l]*alpha_vdim[13][l]+alpha_vdim[0][l]*f[5][l]+f[0][l]*alpha_vdim[5][l]);
+    out[17][l] += 0.2165063509461096*(f[28][l]*alpha_vdim[363][l]+f[25][l]*alpha_vdim[362][l]+f[43][l]*alpha_vdim[348][l]+f[15][l]*alpha_vdim[347][l]+f[14][l]*alpha_vdim[346][l]+f[42][l]*alpha_vdim[345][l]+f[12][l]*alpha_vdim[344][l]+f[11][l]*alpha_vdim[343][l]+f[9][l]*alpha_vdim[342][l]+f[27][l]*alpha_vdim[335][l]+f[26][l]*alpha_vdim[334][l]+f[5][l]*alpha_vdim[333][l]+f[24][l]*alpha_vdim[332][l]+f[23][l]*alpha_vdim[331][l]+f[4][l]*alpha_vdim[330][l]+f[22][l]*alpha_vdim[329][l]+f[3][l]*alpha_vdim[328][l]+f[2][l]*alpha_vdim[327][l]+f[13][l]*alpha_vdim[325][l]+f[10][l]*alpha_vdim[324][l]+f[8][l]*alpha_vdim[323][l]+f[7][l]*alpha_vdim[322][l]+f[0][l]*alpha_vdim[321][l]+f[1][l]*alpha_vdim[320][l]+alpha_cdim[4][l]*f[20][l]+alpha_cdim[0][l]*f[6][l]);
+    out[18][l] += 0.2165063509461096*(f[27][l]*alpha_vdim[363][l]+f[24][l]*alpha_vdim[362][l]+f[15][l]*alpha_vdim[348][l]+f[43][l]*alpha_vdim[347][l]+f[13][l]*alpha_vdim[346][l]+f[12][l]*alpha_vdim[345][l]+f[42][l]*alpha_vdim[344][l]+f[10][l]*alpha_vdim[343][l]+f[8][l]*alpha_vdim[342][l]+f[28][l]*alpha_vdim[335][l]+f[5][l]*alpha_vdim[334][l]+f[26][l]*alpha_vdim[333][l]+f[25][l]*alpha_vdim[332][l]+f[4][l]*alpha_vdim[331][l]+f[23][l]*alpha_vdim[330][l]+f[3][l]*alpha_vdim[329][l]+f[22][l]*alpha_vdim[328][l]+f[1][l]*alpha_vdim[327][l]+f[14][l]*alpha_vdim[325][l]+f[11][l]*alpha_vdim[324][l]+f[9][l]*alpha_vdim[323][l]+f[0][l]*alpha_vdim[322][l]+f[7][l]*alpha_vdim[321][l]+f[2][l]*alpha_vdim[320][l]+f[21][l]*alpha_cdim[165][l]+f[6][l]*alpha_cdim[160][l]);
+    out[19][l] += 0.2165063509461096*(f[26][l]*alpha_vdim[363][l]+f[23][l]*alpha_vdim[362][l]+f[14][l]*alpha_vdim[348][l]+f[13][l]*alpha_vdim[347][l]+f[43][l]*alpha_vdim[346][l]+f[11][l]*alpha_vdim[345][l]+f[10][l]*alpha_vdim[344][l]+f[42][l]*alpha_vdim[343][l]+f[7][l]*alpha_vdim[342][l]+f[5][l]*alpha_vdim[335][l]+f[28][l]*alpha_vdim[334][l]+f[27][l]*alpha_vdim[333][l]+f[4][l]*alpha_vdim[332][l]+f[25][l]*alpha_vdim[331][l]+f[24][l]*alpha_vdim[330][l]+f[2][l]*alpha_vdim[329][l]+f[1][l]*alpha_vdim[328][l]+f[22][l]*alpha_vdim[327][l])+0.1936491673103708*f[128][l]*alpha_cdim[326][l]+0.2165063509461096*(f[0][l]*alpha_cdim[326][l]+f[15][l]*alpha_vdim[325][l]+f[12][l]*alpha_vdim[324][l]+f[0][l]*alpha_vdim[323][l]+f[9][l]*alpha_vdim[322][l]+f[8][l]*alpha_vdim[321][l]+f[3][l]*alpha_vdim[320][l]+f[6][l]*alpha_cdim[320][l]);
+    out[20][l] += 0.2165063509461096*f[57][l]*alpha_vdim[363][l]+0.1936491673103708*f[80][l]*alpha_vdim[362][l]+0.2165063509461096*(f[22][l]*alpha_vdim[362][l]+f[46][l]*alpha_vdim[348][l]+f[45][l]*alpha_vdim[347][l]+f[44][l]*alpha_vdim[346][l])+(0.1936491673103708*f[72][l]+0.2165063509461096*f[9][l])*alpha_vdim[345][l]+(0.1936491673103708*f[71][l]+0.2165063509461096*f[8][l])*alpha_vdim[344][l]+0.1936491673103708*f[70][l]*alpha_vdim[343][l]+0.2165063509461096*(f[7][l]*alpha_vdim[343][l]+f[42][l]*alpha_vdim[342][l]+f[31][l]*alpha_vdim[335][l]+f[30][l]*alpha_vdim[334][l]+f[29][l]*alpha_vdim[333][l])+(0.1936491673103708*f[67][l]+0.2165063509461096*f[3][l])*alpha_vdim[332][l]+(0.1936491673103708*f[66][l]+0.2165063509461096*f[2][l])*alpha_vdim[331][l]+0.1936491673103708*f[65][l]*alpha_vdim[330][l]+0.2165063509461096*(f[1][l]*alpha_vdim[330][l]+f[25][l]*alpha_vdim[329][l]+f[24][l]*alpha_vdim[328][l]+f[23][l]*alpha_vdim[327][l]+f[16][l]*alpha_vdim[325][l])+0.1936491673103708*f[64][l]*alpha_vdim[324][l]+0.2165063509461096*(f[0][l]*alpha_vdim[324][l]+f[12][l]*alpha_vdim[323][l]+f[11][l]*alpha_vdim[322][l]+f[10][l]*alpha_vdim[321][l]+f[4][l]*alpha_vdim[320][l])+0.1936491673103708*(alpha_vdim[47][l]*f[144][l]+alpha_vdim[34][l]*f[136][l]+alpha_vdim[33][l]*f[135][l]+alpha_vdim[32][l]*f[134][l]+alpha_vdim[19][l]*f[131][l]+alpha_vdim[18][l]*f[130][l]+alpha_vdim[17][l]*f[129][l]+alpha_vdim[6][l]*f[128][l])+0.2165063509461096*(alpha_vdim[43][l]*f[59][l]+alpha_vdim[28][l]*f[53][l]+alpha_vdim[27][l]*f[52][l]+alpha_vdim[26][l]*f[51][l]+alpha_vdim[22][l]*f[47][l]+f[22][l]*alpha_vdim[47][l]+alpha_vdim[15][l]*f[40][l]+alpha_vdim[14][l]*f[39][l]+alpha_vdim[13][l]*f[38][l]+alpha_vdim[9][l]*f[34][l]+f[9][l]*alpha_vdim[34][l]+alpha_vdim[8][l]*f[33][l]+f[8][l]*alpha_vdim[33][l]+alpha_vdim[7][l]*f[32][l]+f[7][l]*alpha_vdim[32][l]+alpha_vdim[5][l]*f[21][l]+alpha_vdim[3][l]*f[19][l]+f[3][l]*alpha_vdim[19][l]+alpha_vdim[2][l]*f[18][l]+f[2][l]*alpha_vdim[18][l]+alpha_vdim[1][l]*f[17][l]+f[1][l]*alpha_vdim[17][l]+alpha_vdim[0][l]*f[6][l]+f[0][l]*alpha_vdim[6][l]);
+    out[21][l] += 0.1936491673103708*f[112][l]*alpha_vdim[363][l]+0.2165063509461096*(f[22][l]*alpha_vdim[363][l]+f[57][l]*alpha_vdim[362][l])+(0.1936491673103708*f[104][l]+0.2165063509461096*f[9][l])*alpha_vdim[348][l]+(0.1936491673103708*f[103][l]+0.2165063509461096*f[8][l])*alpha_vdim[347][l]+0.1936491673103708*f[102][l]*alpha_vdim[346][l]+0.2165063509461096*(f[7][l]*alpha_vdim[346][l]+f[46][l]*alpha_vdim[345][l]+f[45][l]*alpha_vdim[344][l]+f[44][l]*alpha_vdim[343][l]+f[43][l]*alpha_vdim[342][l])+(0.1936491673103708*f[99][l]+0.2165063509461096*f[3][l])*alpha_vdim[335][l]+(0.1936491673103708*f[98][l]+0.2165063509461096*f[2][l])*alpha_vdim[334][l]+0.1936491673103708*f[97][l]*alpha_vdim[333][l]+0.2165063509461096*(f[1][l]*alpha_vdim[333][l]+f[31][l]*alpha_vdim[332][l]+f[30][l]*alpha_vdim[331][l]+f[29][l]*alpha_vdim[330][l]+f[28][l]*alpha_vdim[329][l]+f[27][l]*alpha_vdim[328][l]+f[26][l]*alpha_vdim[327][l])+0.1936491673103708*f[96][l]*alpha_vdim[325][l]+0.2165063509461096*(f[0][l]*alpha_vdim[325][l]+f[16][l]*alpha_vdim[324][l]+f[15][l]*alpha_vdim[323][l]+f[14][l]*alpha_vdim[322][l]+f[13][l]*alpha_vdim[321][l]+f[5][l]*alpha_vdim[320][l])+0.1936491673103708*f[144][l]*alpha_vdim[207][l]+0.2165063509461096*(f[22][l]*alpha_vdim[207][l]+f[58][l]*alpha_vdim[202][l])+(0.1936491673103708*f[136][l]+0.2165063509461096*f[9][l])*alpha_vdim[194][l]+(0.1936491673103708*f[135][l]+0.2165063509461096*f[8][l])*alpha_vdim[193][l]+0.1936491673103708*f[134][l]*alpha_vdim[192][l]+0.2165063509461096*(f[7][l]*alpha_vdim[192][l]+f[50][l]*alpha_vdim[185][l]+f[49][l]*alpha_vdim[184][l]+f[48][l]*alpha_vdim[183][l]+f[47][l]*alpha_vdim[182][l])+(0.1936491673103708*f[131][l]+0.2165063509461096*f[3][l])*alpha_vdim[179][l]+(0.1936491673103708*f[130][l]+0.2165063509461096*f[2][l])*alpha_vdim[178][l]+0.1936491673103708*f[129][l]*alpha_vdim[177][l]+0.2165063509461096*(f[1][l]*alpha_vdim[177][l]+f[37][l]*alpha_vdim[172][l]+f[36][l]*alpha_vdim[171][l]+f[35][l]*alpha_vdim[170][l]+f[34][l]*alpha_vdim[169][l]+f[33][l]*alpha_vdim[168][l]+f[32][l]*alpha_vdim[167][l])+0.1936491673103708*f[128][l]*alpha_vdim[166][l]+0.2165063509461096*(f[0][l]*alpha_vdim[166][l]+f[20][l]*alpha_vdim[164][l]+f[19][l]*alpha_vdim[163][l]+f[18][l]*alpha_vdim[162][l]+f[17][l]*alpha_vdim[161][l]+f[6][l]*alpha_vdim[160][l]);
+    out[22][l] += 0.2165063509461096*(f[32][l]*alpha_cdim[326][l]+f[7][l]*alpha_cdim[320][l]+f[27][l]*alpha_cdim[165][l]+f[8][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[25][l]+alpha_cdim[0][l]*f[9][l]);
+    out[23][l] += 0.2165063509461096*(f[29][l]*alpha_cdim[165][l]+f[10][l]*alpha_cdim[160][l])+0.1936491673103708*alpha_cdim[4][l]*f[66][l]+0.2165063509461096*(alpha_vdim[19][l]*f[47][l]+f[19][l]*alpha_vdim[47][l]+alpha_vdim[15][l]*f[43][l]+f[15][l]*alpha_vdim[43][l]+alpha_vdim[33][l]*f[34][l]+f[33][l]*alpha_vdim[34][l]+alpha_vdim[6][l]*f[32][l]+f[6][l]*alpha_vdim[32][l]+alpha_vdim[27][l]*f[28][l]+f[27][l]*alpha_vdim[28][l]+alpha_vdim[5][l]*f[26][l]+f[5][l]*alpha_vdim[26][l]+alpha_vdim[3][l]*f[22][l]+f[3][l]*alpha_vdim[22][l]+alpha_vdim[17][l]*f[18][l]+f[17][l]*alpha_vdim[18][l]+alpha_vdim[13][l]*f[14][l]+f[13][l]*alpha_vdim[14][l]+alpha_cdim[0][l]*f[11][l]+alpha_vdim[8][l]*f[9][l]+f[8][l]*alpha_vdim[9][l]+alpha_vdim[0][l]*f[7][l]+f[0][l]*alpha_vdim[7][l]+f[2][l]*(alpha_cdim[4][l]+alpha_vdim[1][l])+f[1][l]*alpha_vdim[2][l]);
+    out[24][l] += 0.2165063509461096*(f[35][l]*alpha_cdim[326][l]+f[10][l]*alpha_cdim[320][l])+0.1936491673103708*alpha_cdim[4][l]*f[67][l]+0.2165063509461096*(alpha_vdim[18][l]*f[47][l]+f[18][l]*alpha_vdim[47][l]+alpha_vdim[14][l]*f[43][l]+f[14][l]*alpha_vdim[43][l]+alpha_vdim[32][l]*f[34][l]+f[32][l]*alpha_vdim[34][l]+alpha_vdim[6][l]*f[33][l]+f[6][l]*alpha_vdim[33][l]+alpha_vdim[26][l]*f[28][l]+f[26][l]*alpha_vdim[28][l]+alpha_vdim[5][l]*f[27][l]+f[5][l]*alpha_vdim[27][l]+alpha_vdim[2][l]*f[22][l]+f[2][l]*alpha_vdim[22][l]+alpha_vdim[17][l]*f[19][l]+f[17][l]*alpha_vdim[19][l]+alpha_vdim[13][l]*f[15][l]+f[13][l]*alpha_vdim[15][l]+alpha_cdim[0][l]*f[12][l]+alpha_vdim[7][l]*f[9][l]+f[7][l]*alpha_vdim[9][l]+alpha_vdim[0][l]*f[8][l]+f[0][l]*alpha_vdim[8][l]+f[3][l]*(alpha_cdim[4][l]+alpha_vdim[1][l])+f[1][l]*alpha_vdim[3][l]);
+    out[25][l] += 0.2165063509461096*(f[36][l]*alpha_cdim[326][l]+f[11][l]*alpha_cdim[320][l]+f[31][l]*alpha_cdim[165][l]+f[12][l]*alpha_cdim[160][l]+alpha_vdim[17][l]*f[47][l]+f[17][l]*alpha_vdim[47][l]+alpha_vdim[13][l]*f[43][l]+f[13][l]*alpha_vdim[43][l]+alpha_vdim[6][l]*f[34][l]+f[6][l]*alpha_vdim[34][l]+alpha_vdim[32][l]*f[33][l]+f[32][l]*alpha_vdim[33][l]+alpha_vdim[5][l]*f[28][l]+f[5][l]*alpha_vdim[28][l]+alpha_vdim[26][l]*f[27][l]+f[26][l]*alpha_vdim[27][l]+alpha_vdim[1][l]*f[22][l]+f[1][l]*alpha_vdim[22][l]+alpha_vdim[18][l]*f[19][l]+f[18][l]*alpha_vdim[19][l]+alpha_vdim[14][l]*f[15][l]+f[14][l]*alpha_vdim[15][l]+alpha_vdim[0][l]*f[9][l]+f[0][l]*alpha_vdim[9][l]+alpha_vdim[7][l]*f[8][l]+f[7][l]*alpha_vdim[8][l]+alpha_vdim[2][l]*f[3][l]+f[2][l]*alpha_vdim[3][l]);
+    out[26][l] += 0.2165063509461096*(f[19][l]*alpha_vdim[207][l]+f[12][l]*alpha_vdim[202][l]+f[33][l]*alpha_vdim[194][l]+f[34][l]*alpha_vdim[193][l]+f[6][l]*alpha_vdim[192][l]+f[24][l]*alpha_vdim[185][l]+f[25][l]*alpha_vdim[184][l]+f[4][l]*alpha_vdim[183][l]+f[3][l]*alpha_vdim[182][l]+f[47][l]*alpha_vdim[179][l]+f[17][l]*alpha_vdim[178][l]+f[18][l]*alpha_vdim[177][l]+f[42][l]*alpha_vdim[172][l]+f[10][l]*alpha_vdim[171][l]+f[11][l]*alpha_vdim[170][l]+f[8][l]*alpha_vdim[169][l]+f[9][l]*alpha_vdim[168][l]+f[0][l]*alpha_vdim[167][l]+f[32][l]*alpha_vdim[166][l])+0.1936491673103708*f[97][l]*alpha_cdim[165][l]+0.2165063509461096*(f[1][l]*alpha_cdim[165][l]+f[23][l]*alpha_vdim[164][l]+f[22][l]*alpha_vdim[163][l]+f[1][l]*alpha_vdim[162][l]+f[2][l]*alpha_vdim[161][l]+f[7][l]*alpha_vdim[160][l]+f[13][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[30][l]+alpha_cdim[0][l]*f[14][l]);
+    out[27][l] += 0.2165063509461096*(f[38][l]*alpha_cdim[326][l]+f[13][l]*alpha_cdim[320][l]+f[18][l]*alpha_vdim[207][l]+f[11][l]*alpha_vdim[202][l]+f[32][l]*alpha_vdim[194][l]+f[6][l]*alpha_vdim[193][l]+f[34][l]*alpha_vdim[192][l]+f[23][l]*alpha_vdim[185][l]+f[4][l]*alpha_vdim[184][l]+f[25][l]*alpha_vdim[183][l]+f[2][l]*alpha_vdim[182][l]+f[17][l]*alpha_vdim[179][l]+f[47][l]*alpha_vdim[178][l]+f[19][l]*alpha_vdim[177][l]+f[10][l]*alpha_vdim[172][l]+f[42][l]*alpha_vdim[171][l]+f[12][l]*alpha_vdim[170][l]+f[7][l]*alpha_vdim[169][l]+f[0][l]*alpha_vdim[168][l]+f[9][l]*alpha_vdim[167][l]+f[33][l]*alpha_vdim[166][l]+f[24][l]*alpha_vdim[164][l]+f[1][l]*alpha_vdim[163][l]+f[22][l]*alpha_vdim[162][l]+f[3][l]*alpha_vdim[161][l]+f[8][l]*alpha_vdim[160][l]+alpha_cdim[4][l]*f[31][l]+alpha_cdim[0][l]*f[15][l]);
+    out[28][l] += 0.2165063509461096*(f[39][l]*alpha_cdim[326][l]+f[14][l]*alpha_cdim[320][l]+f[17][l]*alpha_vdim[207][l]+f[10][l]*alpha_vdim[202][l]+f[6][l]*alpha_vdim[194][l]+f[32][l]*alpha_vdim[193][l]+f[33][l]*alpha_vdim[192][l]+f[4][l]*alpha_vdim[185][l]+f[23][l]*alpha_vdim[184][l]+f[24][l]*alpha_vdim[183][l]+f[1][l]*alpha_vdim[182][l]+f[18][l]*alpha_vdim[179][l]+f[19][l]*alpha_vdim[178][l]+f[47][l]*alpha_vdim[177][l]+f[11][l]*alpha_vdim[172][l]+f[12][l]*alpha_vdim[171][l]+f[42][l]*alpha_vdim[170][l]+f[0][l]*alpha_vdim[169][l]+f[7][l]*alpha_vdim[168][l]+f[8][l]*alpha_vdim[167][l]+f[34][l]*alpha_vdim[166][l])+0.1936491673103708*f[99][l]*alpha_cdim[165][l]+0.2165063509461096*(f[3][l]*alpha_cdim[165][l]+f[25][l]*alpha_vdim[164][l]+f[2][l]*alpha_vdim[163][l]+f[3][l]*alpha_vdim[162][l]+f[22][l]*alpha_vdim[161][l]+f[9][l]*alpha_vdim[160][l]+f[15][l]*alpha_cdim[160][l]);
+    out[29][l] += 0.2165063509461096*f[50][l]*alpha_vdim[207][l]+0.1936491673103708*f[72][l]*alpha_vdim[202][l]+0.2165063509461096*(f[9][l]*alpha_vdim[202][l]+f[58][l]*alpha_vdim[194][l]+f[37][l]*alpha_vdim[193][l]+f[36][l]*alpha_vdim[192][l])+(0.1936491673103708*f[80][l]+0.2165063509461096*f[22][l])*alpha_vdim[185][l]+(0.1936491673103708*f[67][l]+0.2165063509461096*f[3][l])*alpha_vdim[184][l]+0.1936491673103708*f[66][l]*alpha_vdim[183][l]+0.2165063509461096*(f[2][l]*alpha_vdim[183][l]+f[25][l]*alpha_vdim[182][l]+f[49][l]*alpha_vdim[179][l]+f[48][l]*alpha_vdim[178][l]+f[20][l]*alpha_vdim[177][l])+(0.1936491673103708*f[71][l]+0.2165063509461096*f[8][l])*alpha_vdim[172][l]+(0.1936491673103708*f[70][l]+0.2165063509461096*f[7][l])*alpha_vdim[171][l]+0.1936491673103708*f[64][l]*alpha_vdim[170][l]+0.2165063509461096*(f[0][l]*alpha_vdim[170][l]+f[42][l]*alpha_vdim[169][l]+f[12][l]*alpha_vdim[168][l]+f[11][l]*alpha_vdim[167][l]+f[35][l]*alpha_vdim[166][l])+0.1936491673103708*f[65][l]*alpha_vdim[164][l]+0.2165063509461096*(f[1][l]*alpha_vdim[164][l]+f[24][l]*alpha_vdim[163][l]+f[23][l]*alpha_vdim[162][l]+f[4][l]*alpha_vdim[161][l]+f[10][l]*alpha_vdim[160][l])+0.1936491673103708*(alpha_vdim[28][l]*f[112][l]+alpha_vdim[43][l]*f[104][l]+alpha_vdim[15][l]*f[103][l]+alpha_vdim[14][l]*f[102][l]+alpha_vdim[27][l]*f[99][l]+alpha_vdim[26][l]*f[98][l]+alpha_vdim[5][l]*f[97][l]+alpha_vdim[13][l]*f[96][l]+alpha_cdim[4][l]*f[68][l])+0.2165063509461096*(alpha_vdim[34][l]*f[59][l]+alpha_vdim[47][l]*f[53][l]+alpha_vdim[19][l]*f[52][l]+alpha_vdim[18][l]*f[51][l]+alpha_vdim[9][l]*f[43][l]+f[9][l]*alpha_vdim[43][l]+alpha_vdim[33][l]*f[40][l]+alpha_vdim[32][l]*f[39][l]+alpha_vdim[6][l]*f[38][l]+alpha_vdim[22][l]*f[28][l]+f[22][l]*alpha_vdim[28][l]+alpha_vdim[3][l]*f[27][l]+f[3][l]*alpha_vdim[27][l]+alpha_vdim[2][l]*f[26][l]+f[2][l]*alpha_vdim[26][l]+alpha_vdim[17][l]*f[21][l]+alpha_cdim[0][l]*f[16][l]+alpha_vdim[8][l]*f[15][l]+f[8][l]*alpha_vdim[15][l]+alpha_vdim[7][l]*f[14][l]+f[7][l]*alpha_vdim[14][l]+alpha_vdim[0][l]*f[13][l]+f[0][l]*alpha_vdim[13][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[5][l]+f[1][l]*alpha_vdim[5][l]);
+    out[30][l] += 0.2165063509461096*f[49][l]*alpha_vdim[207][l]+0.1936491673103708*f[71][l]*alpha_vdim[202][l]+0.2165063509461096*(f[8][l]*alpha_vdim[202][l]+f[37][l]*alpha_vdim[194][l]+f[58][l]*alpha_vdim[193][l]+f[35][l]*alpha_vdim[192][l])+(0.1936491673103708*f[67][l]+0.2165063509461096*f[3][l])*alpha_vdim[185][l]+(0.1936491673103708*f[80][l]+0.2165063509461096*f[22][l])*alpha_vdim[184][l]+0.1936491673103708*f[65][l]*alpha_vdim[183][l]+0.2165063509461096*(f[1][l]*alpha_vdim[183][l]+f[24][l]*alpha_vdim[182][l]+f[50][l]*alpha_vdim[179][l]+f[20][l]*alpha_vdim[178][l]+f[48][l]*alpha_vdim[177][l])+(0.1936491673103708*f[72][l]+0.2165063509461096*f[9][l])*alpha_vdim[172][l]+(0.1936491673103708*f[64][l]+0.2165063509461096*f[0][l])*alpha_vdim[171][l]+0.1936491673103708*f[70][l]*alpha_vdim[170][l]+0.2165063509461096*(f[7][l]*alpha_vdim[170][l]+f[12][l]*alpha_vdim[169][l]+f[42][l]*alpha_vdim[168][l]+f[10][l]*alpha_vdim[167][l]+f[36][l]*alpha_vdim[166][l])+(0.1936491673103708*f[100][l]+0.2165063509461096*f[4][l])*alpha_cdim[165][l]+0.1936491673103708*f[66][l]*alpha_vdim[164][l]+0.2165063509461096*(f[2][l]*alpha_vdim[164][l]+f[25][l]*alpha_vdim[163][l]+f[4][l]*alpha_vdim[162][l]+f[23][l]*alpha_vdim[161][l]+f[11][l]*alpha_vdim[160][l]+f[16][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[27][l]*f[112][l]+alpha_vdim[15][l]*f[104][l]+alpha_vdim[43][l]*f[103][l]+alpha_vdim[13][l]*f[102][l]+alpha_vdim[28][l]*f[99][l]+alpha_vdim[5][l]*f[98][l]+alpha_vdim[26][l]*f[97][l]+alpha_vdim[14][l]*f[96][l])+0.2165063509461096*(alpha_vdim[33][l]*f[59][l]+alpha_vdim[19][l]*f[53][l]+alpha_vdim[47][l]*f[52][l]+alpha_vdim[17][l]*f[51][l]+alpha_vdim[8][l]*f[43][l]+f[8][l]*alpha_vdim[43][l]+alpha_vdim[34][l]*f[40][l]+alpha_vdim[6][l]*f[39][l]+alpha_vdim[32][l]*f[38][l]+alpha_vdim[3][l]*f[28][l]+f[3][l]*alpha_vdim[28][l]+alpha_vdim[22][l]*f[27][l]+f[22][l]*alpha_vdim[27][l]+alpha_vdim[1][l]*f[26][l]+f[1][l]*alpha_vdim[26][l]+alpha_vdim[18][l]*f[21][l]+alpha_vdim[9][l]*f[15][l]+f[9][l]*alpha_vdim[15][l]+alpha_vdim[0][l]*f[14][l]+f[0][l]*alpha_vdim[14][l]+alpha_vdim[7][l]*f[13][l]+f[7][l]*alpha_vdim[13][l]+alpha_vdim[2][l]*f[5][l]+f[2][l]*alpha_vdim[5][l]);
+    out[31][l] += 0.2165063509461096*(f[41][l]*alpha_cdim[326][l]+f[16][l]*alpha_cdim[320][l]+f[48][l]*alpha_vdim[207][l])+0.1936491673103708*f[70][l]*alpha_vdim[202][l]+0.2165063509461096*(f[7][l]*alpha_vdim[202][l]+f[36][l]*alpha_vdim[194][l]+f[35][l]*alpha_vdim[193][l]+f[58][l]*alpha_vdim[192][l])+(0.1936491673103708*f[66][l]+0.2165063509461096*f[2][l])*alpha_vdim[185][l]+(0.1936491673103708*f[65][l]+0.2165063509461096*f[1][l])*alpha_vdim[184][l]+0.1936491673103708*f[80][l]*alpha_vdim[183][l]+0.2165063509461096*(f[22][l]*alpha_vdim[183][l]+f[23][l]*alpha_vdim[182][l]+f[20][l]*alpha_vdim[179][l]+f[50][l]*alpha_vdim[178][l]+f[49][l]*alpha_vdim[177][l])+(0.1936491673103708*f[64][l]+0.2165063509461096*f[0][l])*alpha_vdim[172][l]+(0.1936491673103708*f[72][l]+0.2165063509461096*f[9][l])*alpha_vdim[171][l]+0.1936491673103708*f[71][l]*alpha_vdim[170][l]+0.2165063509461096*(f[8][l]*alpha_vdim[170][l]+f[11][l]*alpha_vdim[169][l]+f[10][l]*alpha_vdim[168][l]+f[42][l]*alpha_vdim[167][l]+f[37][l]*alpha_vdim[166][l])+0.1936491673103708*f[67][l]*alpha_vdim[164][l]+0.2165063509461096*(f[3][l]*alpha_vdim[164][l]+f[4][l]*alpha_vdim[163][l]+f[25][l]*alpha_vdim[162][l]+f[24][l]*alpha_vdim[161][l]+f[12][l]*alpha_vdim[160][l])+0.1936491673103708*(alpha_vdim[26][l]*f[112][l]+alpha_vdim[14][l]*f[104][l]+alpha_vdim[13][l]*f[103][l]+alpha_vdim[43][l]*f[102][l]+alpha_vdim[5][l]*f[99][l]+alpha_vdim[28][l]*f[98][l]+alpha_vdim[27][l]*f[97][l]+alpha_vdim[15][l]*f[96][l])+0.2165063509461096*(alpha_vdim[32][l]*f[59][l]+alpha_vdim[18][l]*f[53][l]+alpha_vdim[17][l]*f[52][l]+alpha_vdim[47][l]*f[51][l]+alpha_vdim[7][l]*f[43][l]+f[7][l]*alpha_vdim[43][l]+alpha_vdim[6][l]*f[40][l]+alpha_vdim[34][l]*f[39][l]+alpha_vdim[33][l]*f[38][l]+alpha_vdim[2][l]*f[28][l]+f[2][l]*alpha_vdim[28][l]+alpha_vdim[1][l]*f[27][l]+f[1][l]*alpha_vdim[27][l]+alpha_vdim[22][l]*f[26][l]+f[22][l]*alpha_vdim[26][l]+alpha_vdim[19][l]*f[21][l]+alpha_vdim[0][l]*f[15][l]+f[0][l]*alpha_vdim[15][l]+alpha_vdim[9][l]*f[14][l]+f[9][l]*alpha_vdim[14][l]+alpha_vdim[8][l]*f[13][l]+f[8][l]*alpha_vdim[13][l]+alpha_vdim[3][l]*f[5][l]+f[3][l]*alpha_vdim[5][l]);
+    out[32][l] += 0.2165063509461096*(f[15][l]*alpha_vdim[363][l]+f[12][l]*alpha_vdim[362][l]+f[27][l]*alpha_vdim[348][l]+f[28][l]*alpha_vdim[347][l]+f[5][l]*alpha_vdim[346][l]+f[24][l]*alpha_vdim[345][l]+f[25][l]*alpha_vdim[344][l]+f[4][l]*alpha_vdim[343][l]+f[3][l]*alpha_vdim[342][l]+f[43][l]*alpha_vdim[335][l]+f[13][l]*alpha_vdim[334][l]+f[14][l]*alpha_vdim[333][l]+f[42][l]*alpha_vdim[332][l]+f[10][l]*alpha_vdim[331][l]+f[11][l]*alpha_vdim[330][l]+f[8][l]*alpha_vdim[329][l]+f[9][l]*alpha_vdim[328][l]+f[0][l]*alpha_vdim[327][l]+f[26][l]*alpha_vdim[325][l]+f[23][l]*alpha_vdim[324][l]+f[22][l]*alpha_vdim[323][l]+f[1][l]*alpha_vdim[322][l]+f[2][l]*alpha_vdim[321][l]+f[7][l]*alpha_vdim[320][l]+f[38][l]*alpha_cdim[165][l]+f[17][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[36][l]+alpha_cdim[0][l]*f[18][l]);
+    out[33][l] += 0.2165063509461096*(f[14][l]*alpha_vdim[363][l]+f[11][l]*alpha_vdim[362][l]+f[26][l]*alpha_vdim[348][l]+f[5][l]*alpha_vdim[347][l]+f[28][l]*alpha_vdim[346][l]+f[23][l]*alpha_vdim[345][l]+f[4][l]*alpha_vdim[344][l]+f[25][l]*alpha_vdim[343][l]+f[2][l]*alpha_vdim[342][l]+f[13][l]*alpha_vdim[335][l]+f[43][l]*alpha_vdim[334][l]+f[15][l]*alpha_vdim[333][l]+f[10][l]*alpha_vdim[332][l]+f[42][l]*alpha_vdim[331][l]+f[12][l]*alpha_vdim[330][l]+f[7][l]*alpha_vdim[329][l]+f[0][l]*alpha_vdim[328][l]+f[9][l]*alpha_vdim[327][l])+0.1936491673103708*f[129][l]*alpha_cdim[326][l]+0.2165063509461096*(f[1][l]*alpha_cdim[326][l]+f[27][l]*alpha_vdim[325][l]+f[24][l]*alpha_vdim[324][l]+f[1][l]*alpha_vdim[323][l]+f[22][l]*alpha_vdim[322][l]+f[3][l]*alpha_vdim[321][l]+f[8][l]*alpha_vdim[320][l]+f[17][l]*alpha_cdim[320][l]+alpha_cdim[4][l]*f[37][l]+alpha_cdim[0][l]*f[19][l]);
+    out[34][l] += 0.2165063509461096*(f[13][l]*alpha_vdim[363][l]+f[10][l]*alpha_vdim[362][l]+f[5][l]*alpha_vdim[348][l]+f[26][l]*alpha_vdim[347][l]+f[27][l]*alpha_vdim[346][l]+f[4][l]*alpha_vdim[345][l]+f[23][l]*alpha_vdim[344][l]+f[24][l]*alpha_vdim[343][l]+f[1][l]*alpha_vdim[342][l]+f[14][l]*alpha_vdim[335][l]+f[15][l]*alpha_vdim[334][l]+f[43][l]*alpha_vdim[333][l]+f[11][l]*alpha_vdim[332][l]+f[12][l]*alpha_vdim[331][l]+f[42][l]*alpha_vdim[330][l]+f[0][l]*alpha_vdim[329][l]+f[7][l]*alpha_vdim[328][l]+f[8][l]*alpha_vdim[327][l])+0.1936491673103708*f[130][l]*alpha_cdim[326][l]+0.2165063509461096*(f[2][l]*alpha_cdim[326][l]+f[28][l]*alpha_vdim[325][l]+f[25][l]*alpha_vdim[324][l]+f[2][l]*alpha_vdim[323][l]+f[3][l]*alpha_vdim[322][l]+f[22][l]*alpha_vdim[321][l]+f[9][l]*alpha_vdim[320][l]+f[18][l]*alpha_cdim[320][l]+f[40][l]*alpha_cdim[165][l]+f[19][l]*alpha_cdim[160][l]);
+    out[35][l] += 0.2165063509461096*f[46][l]*alpha_vdim[363][l]+0.1936491673103708*f[72][l]*alpha_vdim[362][l]+0.2165063509461096*(f[9][l]*alpha_vdim[362][l]+f[57][l]*alpha_vdim[348][l]+f[31][l]*alpha_vdim[347][l]+f[30][l]*alpha_vdim[346][l])+(0.1936491673103708*f[80][l]+0.2165063509461096*f[22][l])*alpha_vdim[345][l]+(0.1936491673103708*f[67][l]+0.2165063509461096*f[3][l])*alpha_vdim[344][l]+0.1936491673103708*f[66][l]*alpha_vdim[343][l]+0.2165063509461096*(f[2][l]*alpha_vdim[343][l]+f[25][l]*alpha_vdim[342][l]+f[45][l]*alpha_vdim[335][l]+f[44][l]*alpha_vdim[334][l]+f[16][l]*alpha_vdim[333][l])+(0.1936491673103708*f[71][l]+0.2165063509461096*f[8][l])*alpha_vdim[332][l]+(0.1936491673103708*f[70][l]+0.2165063509461096*f[7][l])*alpha_vdim[331][l]+0.1936491673103708*f[64][l]*alpha_vdim[330][l]+0.2165063509461096*(f[0][l]*alpha_vdim[330][l]+f[42][l]*alpha_vdim[329][l]+f[12][l]*alpha_vdim[328][l]+f[11][l]*alpha_vdim[327][l]+f[29][l]*alpha_vdim[325][l])+0.1936491673103708*f[65][l]*alpha_vdim[324][l]+0.2165063509461096*(f[1][l]*alpha_vdim[324][l]+f[24][l]*alpha_vdim[323][l]+f[23][l]*alpha_vdim[322][l]+f[4][l]*alpha_vdim[321][l]+f[10][l]*alpha_vdim[320][l])+0.1936491673103708*(alpha_vdim[34][l]*f[144][l]+alpha_vdim[47][l]*f[136][l]+alpha_vdim[19][l]*f[135][l]+alpha_vdim[18][l]*f[134][l]+alpha_vdim[33][l]*f[131][l]+alpha_vdim[32][l]*f[130][l]+alpha_vdim[6][l]*f[129][l]+alpha_vdim[17][l]*f[128][l]+alpha_cdim[4][l]*f[69][l])+0.2165063509461096*(alpha_vdim[28][l]*f[59][l]+alpha_vdim[43][l]*f[53][l]+alpha_vdim[15][l]*f[52][l]+alpha_vdim[14][l]*f[51][l]+alpha_vdim[9][l]*f[47][l]+f[9][l]*alpha_vdim[47][l]+alpha_vdim[27][l]*f[40][l]+alpha_vdim[26][l]*f[39][l]+alpha_vdim[5][l]*f[38][l]+alpha_vdim[22][l]*f[34][l]+f[22][l]*alpha_vdim[34][l]+alpha_vdim[3][l]*f[33][l]+f[3][l]*alpha_vdim[33][l]+alpha_vdim[2][l]*f[32][l]+f[2][l]*alpha_vdim[32][l]+alpha_vdim[13][l]*f[21][l]+alpha_cdim[0][l]*f[20][l]+alpha_vdim[8][l]*f[19][l]+f[8][l]*alpha_vdim[19][l]+alpha_vdim[7][l]*f[18][l]+f[7][l]*alpha_vdim[18][l]+alpha_vdim[0][l]*f[17][l]+f[0][l]*alpha_vdim[17][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[6][l]+f[1][l]*alpha_vdim[6][l]);
+    out[36][l] += 0.2165063509461096*f[45][l]*alpha_vdim[363][l]+0.1936491673103708*f[71][l]*alpha_vdim[362][l]+0.2165063509461096*(f[8][l]*alpha_vdim[362][l]+f[31][l]*alpha_vdim[348][l]+f[57][l]*alpha_vdim[347][l]+f[29][l]*alpha_vdim[346][l])+(0.1936491673103708*f[67][l]+0.2165063509461096*f[3][l])*alpha_vdim[345][l]+(0.1936491673103708*f[80][l]+0.2165063509461096*f[22][l])*alpha_vdim[344][l]+0.1936491673103708*f[65][l]*alpha_vdim[343][l]+0.2165063509461096*(f[1][l]*alpha_vdim[343][l]+f[24][l]*alpha_vdim[342][l]+f[46][l]*alpha_vdim[335][l]+f[16][l]*alpha_vdim[334][l]+f[44][l]*alpha_vdim[333][l])+(0.1936491673103708*f[72][l]+0.2165063509461096*f[9][l])*alpha_vdim[332][l]+(0.1936491673103708*f[64][l]+0.2165063509461096*f[0][l])*alpha_vdim[331][l]+0.1936491673103708*f[70][l]*alpha_vdim[330][l]+0.2165063509461096*(f[7][l]*alpha_vdim[330][l]+f[12][l]*alpha_vdim[329][l]+f[42][l]*alpha_vdim[328][l]+f[10][l]*alpha_vdim[327][l]+f[30][l]*alpha_vdim[325][l])+0.1936491673103708*f[66][l]*alpha_vdim[324][l]+0.2165063509461096*(f[2][l]*alpha_vdim[324][l]+f[25][l]*alpha_vdim[323][l]+f[4][l]*alpha_vdim[322][l]+f[23][l]*alpha_vdim[321][l]+f[11][l]*alpha_vdim[320][l]+f[41][l]*alpha_cdim[165][l]+f[20][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[33][l]*f[144][l]+alpha_vdim[19][l]*f[136][l]+alpha_vdim[47][l]*f[135][l]+alpha_vdim[17][l]*f[134][l]+alpha_vdim[34][l]*f[131][l]+alpha_vdim[6][l]*f[130][l]+alpha_vdim[32][l]*f[129][l]+alpha_vdim[18][l]*f[128][l])+0.2165063509461096*(alpha_vdim[27][l]*f[59][l]+alpha_vdim[15][l]*f[53][l]+alpha_vdim[43][l]*f[52][l]+alpha_vdim[13][l]*f[51][l]+alpha_vdim[8][l]*f[47][l]+f[8][l]*alpha_vdim[47][l]+alpha_vdim[28][l]*f[40][l]+alpha_vdim[5][l]*f[39][l]+alpha_vdim[26][l]*f[38][l]+alpha_vdim[3][l]*f[34][l]+f[3][l]*alpha_vdim[34][l]+alpha_vdim[22][l]*f[33][l]+f[22][l]*alpha_vdim[33][l]+alpha_vdim[1][l]*f[32][l]+f[1][l]*alpha_vdim[32][l]+alpha_vdim[14][l]*f[21][l]+alpha_vdim[9][l]*f[19][l]+f[9][l]*alpha_vdim[19][l]+alpha_vdim[0][l]*f[18][l]+f[0][l]*alpha_vdim[18][l]+alpha_vdim[7][l]*f[17][l]+f[7][l]*alpha_vdim[17][l]+alpha_vdim[2][l]*f[6][l]+f[2][l]*alpha_vdim[6][l]);
+    out[37][l] += 0.2165063509461096*f[44][l]*alpha_vdim[363][l]+0.1936491673103708*f[70][l]*alpha_vdim[362][l]+0.2165063509461096*(f[7][l]*alpha_vdim[362][l]+f[30][l]*alpha_vdim[348][l]+f[29][l]*alpha_vdim[347][l]+f[57][l]*alpha_vdim[346][l])+(0.1936491673103708*f[66][l]+0.2165063509461096*f[2][l])*alpha_vdim[345][l]+(0.1936491673103708*f[65][l]+0.2165063509461096*f[1][l])*alpha_vdim[344][l]+0.1936491673103708*f[80][l]*alpha_vdim[343][l]+0.2165063509461096*(f[22][l]*alpha_vdim[343][l]+f[23][l]*alpha_vdim[342][l]+f[16][l]*alpha_vdim[335][l]+f[46][l]*alpha_vdim[334][l]+f[45][l]*alpha_vdim[333][l])+(0.1936491673103708*f[64][l]+0.2165063509461096*f[0][l])*alpha_vdim[332][l]+(0.1936491673103708*f[72][l]+0.2165063509461096*f[9][l])*alpha_vdim[331][l]+0.1936491673103708*f[71][l]*alpha_vdim[330][l]+0.2165063509461096*(f[8][l]*alpha_vdim[330][l]+f[11][l]*alpha_vdim[329][l]+f[10][l]*alpha_vdim[328][l]+f[42][l]*alpha_vdim[327][l])+0.1936491673103708*f[132][l]*alpha_cdim[326][l]+0.2165063509461096*(f[4][l]*alpha_cdim[326][l]+f[31][l]*alpha_vdim[325][l])+0.1936491673103708*f[67][l]*alpha_vdim[324][l]+0.2165063509461096*(f[3][l]*alpha_vdim[324][l]+f[4][l]*alpha_vdim[323][l]+f[25][l]*alpha_vdim[322][l]+f[24][l]*alpha_vdim[321][l]+f[12][l]*alpha_vdim[320][l]+f[20][l]*alpha_cdim[320][l])+0.1936491673103708*(alpha_vdim[32][l]*f[144][l]+alpha_vdim[18][l]*f[136][l]+alpha_vdim[17][l]*f[135][l]+alpha_vdim[47][l]*f[134][l]+alpha_vdim[6][l]*f[131][l]+alpha_vdim[34][l]*f[130][l]+alpha_vdim[33][l]*f[129][l]+alpha_vdim[19][l]*f[128][l])+0.2165063509461096*(alpha_vdim[26][l]*f[59][l]+alpha_vdim[14][l]*f[53][l]+alpha_vdim[13][l]*f[52][l]+alpha_vdim[43][l]*f[51][l]+alpha_vdim[7][l]*f[47][l]+f[7][l]*alpha_vdim[47][l]+alpha_vdim[5][l]*f[40][l]+alpha_vdim[28][l]*f[39][l]+alpha_vdim[27][l]*f[38][l]+alpha_vdim[2][l]*f[34][l]+f[2][l]*alpha_vdim[34][l]+alpha_vdim[1][l]*f[33][l]+f[1][l]*alpha_vdim[33][l]+alpha_vdim[22][l]*f[32][l]+f[22][l]*alpha_vdim[32][l]+alpha_vdim[15][l]*f[21][l]+alpha_vdim[0][l]*f[19][l]+f[0][l]*alpha_vdim[19][l]+alpha_vdim[9][l]*f[18][l]+f[9][l]*alpha_vdim[18][l]+alpha_vdim[8][l]*f[17][l]+f[8][l]*alpha_vdim[17][l]+alpha_vdim[3][l]*f[6][l]+f[3][l]*alpha_vdim[6][l]);
+    out[38][l] += 0.1936491673103708*f[104][l]*alpha_vdim[363][l]+0.2165063509461096*(f[9][l]*alpha_vdim[363][l]+f[46][l]*alpha_vdim[362][l])+(0.1936491673103708*f[112][l]+0.2165063509461096*f[22][l])*alpha_vdim[348][l]+(0.1936491673103708*f[99][l]+0.2165063509461096*f[3][l])*alpha_vdim[347][l]+0.1936491673103708*f[98][l]*alpha_vdim[346][l]+0.2165063509461096*(f[2][l]*alpha_vdim[346][l]+f[57][l]*alpha_vdim[345][l]+f[31][l]*alpha_vdim[344][l]+f[30][l]*alpha_vdim[343][l]+f[28][l]*alpha_vdim[342][l])+(0.1936491673103708*f[103][l]+0.2165063509461096*f[8][l])*alpha_vdim[335][l]+(0.1936491673103708*f[102][l]+0.2165063509461096*f[7][l])*alpha_vdim[334][l]+0.1936491673103708*f[96][l]*alpha_vdim[333][l]+0.2165063509461096*(f[0][l]*alpha_vdim[333][l]+f[45][l]*alpha_vdim[332][l]+f[44][l]*alpha_vdim[331][l]+f[16][l]*alpha_vdim[330][l]+f[43][l]*alpha_vdim[329][l]+f[15][l]*alpha_vdim[328][l]+f[14][l]*alpha_vdim[327][l])+0.1936491673103708*f[97][l]*alpha_vdim[325][l]+0.2165063509461096*(f[1][l]*alpha_vdim[325][l]+f[29][l]*alpha_vdim[324][l]+f[27][l]*alpha_vdim[323][l]+f[26][l]*alpha_vdim[322][l]+f[5][l]*alpha_vdim[321][l]+f[13][l]*alpha_vdim[320][l])+0.1936491673103708*f[136][l]*alpha_vdim[207][l]+0.2165063509461096*(f[9][l]*alpha_vdim[207][l]+f[50][l]*alpha_vdim[202][l])+(0.1936491673103708*f[144][l]+0.2165063509461096*f[22][l])*alpha_vdim[194][l]+(0.1936491673103708*f[131][l]+0.2165063509461096*f[3][l])*alpha_vdim[193][l]+0.1936491673103708*f[130][l]*alpha_vdim[192][l]+0.2165063509461096*(f[2][l]*alpha_vdim[192][l]+f[58][l]*alpha_vdim[185][l]+f[37][l]*alpha_vdim[184][l]+f[36][l]*alpha_vdim[183][l]+f[34][l]*alpha_vdim[182][l])+(0.1936491673103708*f[135][l]+0.2165063509461096*f[8][l])*alpha_vdim[179][l]+(0.1936491673103708*f[134][l]+0.2165063509461096*f[7][l])*alpha_vdim[178][l]+0.1936491673103708*f[128][l]*alpha_vdim[177][l]+0.2165063509461096*(f[0][l]*alpha_vdim[177][l]+f[49][l]*alpha_vdim[172][l]+f[48][l]*alpha_vdim[171][l]+f[20][l]*alpha_vdim[170][l]+f[47][l]*alpha_vdim[169][l]+f[19][l]*alpha_vdim[168][l]+f[18][l]*alpha_vdim[167][l])+0.1936491673103708*f[129][l]*alpha_vdim[166][l]+0.2165063509461096*(f[1][l]*alpha_vdim[166][l]+f[35][l]*alpha_vdim[164][l]+f[33][l]*alpha_vdim[163][l]+f[32][l]*alpha_vdim[162][l]+f[6][l]*alpha_vdim[161][l]+f[17][l]*alpha_vdim[160][l]+alpha_cdim[4][l]*f[41][l]+alpha_cdim[0][l]*f[21][l]);
+    out[39][l] += 0.1936491673103708*f[103][l]*alpha_vdim[363][l]+0.2165063509461096*(f[8][l]*alpha_vdim[363][l]+f[45][l]*alpha_vdim[362][l])+(0.1936491673103708*f[99][l]+0.2165063509461096*f[3][l])*alpha_vdim[348][l]+(0.1936491673103708*f[112][l]+0.2165063509461096*f[22][l])*alpha_vdim[347][l]+0.1936491673103708*f[97][l]*alpha_vdim[346][l]+0.2165063509461096*(f[1][l]*alpha_vdim[346][l]+f[31][l]*alpha_vdim[345][l]+f[57][l]*alpha_vdim[344][l]+f[29][l]*alpha_vdim[343][l]+f[27][l]*alpha_vdim[342][l])+(0.1936491673103708*f[104][l]+0.2165063509461096*f[9][l])*alpha_vdim[335][l]+(0.1936491673103708*f[96][l]+0.2165063509461096*f[0][l])*alpha_vdim[334][l]+0.1936491673103708*f[102][l]*alpha_vdim[333][l]+0.2165063509461096*(f[7][l]*alpha_vdim[333][l]+f[46][l]*alpha_vdim[332][l]+f[16][l]*alpha_vdim[331][l]+f[44][l]*alpha_vdim[330][l]+f[15][l]*alpha_vdim[329][l]+f[43][l]*alpha_vdim[328][l]+f[13][l]*alpha_vdim[327][l])+0.1936491673103708*f[98][l]*alpha_vdim[325][l]+0.2165063509461096*(f[2][l]*alpha_vdim[325][l]+f[30][l]*alpha_vdim[324][l]+f[28][l]*alpha_vdim[323][l]+f[5][l]*alpha_vdim[322][l]+f[26][l]*alpha_vdim[321][l]+f[14][l]*alpha_vdim[320][l])+0.1936491673103708*f[135][l]*alpha_vdim[207][l]+0.2165063509461096*(f[8][l]*alpha_vdim[207][l]+f[49][l]*alpha_vdim[202][l])+(0.1936491673103708*f[131][l]+0.2165063509461096*f[3][l])*alpha_vdim[194][l]+(0.1936491673103708*f[144][l]+0.2165063509461096*f[22][l])*alpha_vdim[193][l]+0.1936491673103708*f[129][l]*alpha_vdim[192][l]+0.2165063509461096*(f[1][l]*alpha_vdim[192][l]+f[37][l]*alpha_vdim[185][l]+f[58][l]*alpha_vdim[184][l]+f[35][l]*alpha_vdim[183][l]+f[33][l]*alpha_vdim[182][l])+(0.1936491673103708*f[136][l]+0.2165063509461096*f[9][l])*alpha_vdim[179][l]+(0.1936491673103708*f[128][l]+0.2165063509461096*f[0][l])*alpha_vdim[178][l]+0.1936491673103708*f[134][l]*alpha_vdim[177][l]+0.2165063509461096*(f[7][l]*alpha_vdim[177][l]+f[50][l]*alpha_vdim[172][l]+f[20][l]*alpha_vdim[171][l]+f[48][l]*alpha_vdim[170][l]+f[19][l]*alpha_vdim[169][l]+f[47][l]*alpha_vdim[168][l]+f[17][l]*alpha_vdim[167][l])+(0.1936491673103708*f[130][l]+0.2165063509461096*f[2][l])*alpha_vdim[166][l]+0.1936491673103708*f[101][l]*alpha_cdim[165][l]+0.2165063509461096*(f[6][l]*alpha_cdim[165][l]+f[36][l]*alpha_vdim[164][l]+f[34][l]*alpha_vdim[163][l]+f[6][l]*alpha_vdim[162][l]+f[32][l]*alpha_vdim[161][l]+f[18][l]*alpha_vdim[160][l]+f[21][l]*alpha_cdim[160][l]);
+    out[40][l] += 0.1936491673103708*f[102][l]*alpha_vdim[363][l]+0.2165063509461096*(f[7][l]*alpha_vdim[363][l]+f[44][l]*alpha_vdim[362][l])+(0.1936491673103708*f[98][l]+0.2165063509461096*f[2][l])*alpha_vdim[348][l]+(0.1936491673103708*f[97][l]+0.2165063509461096*f[1][l])*alpha_vdim[347][l]+0.1936491673103708*f[112][l]*alpha_vdim[346][l]+0.2165063509461096*(f[22][l]*alpha_vdim[346][l]+f[30][l]*alpha_vdim[345][l]+f[29][l]*alpha_vdim[344][l]+f[57][l]*alpha_vdim[343][l]+f[26][l]*alpha_vdim[342][l])+(0.1936491673103708*f[96][l]+0.2165063509461096*f[0][l])*alpha_vdim[335][l]+(0.1936491673103708*f[104][l]+0.2165063509461096*f[9][l])*alpha_vdim[334][l]+0.1936491673103708*f[103][l]*alpha_vdim[333][l]+0.2165063509461096*(f[8][l]*alpha_vdim[333][l]+f[16][l]*alpha_vdim[332][l]+f[46][l]*alpha_vdim[331][l]+f[45][l]*alpha_vdim[330][l]+f[14][l]*alpha_vdim[329][l]+f[13][l]*alpha_vdim[328][l]+f[43][l]*alpha_vdim[327][l])+(0.1936491673103708*f[133][l]+0.2165063509461096*f[5][l])*alpha_cdim[326][l]+0.1936491673103708*f[99][l]*alpha_vdim[325][l]+0.2165063509461096*(f[3][l]*alpha_vdim[325][l]+f[31][l]*alpha_vdim[324][l]+f[5][l]*alpha_vdim[323][l]+f[28][l]*alpha_vdim[322][l]+f[27][l]*alpha_vdim[321][l]+f[15][l]*alpha_vdim[320][l]+f[21][l]*alpha_cdim[320][l])+0.1936491673103708*f[134][l]*alpha_vdim[207][l]+0.2165063509461096*(f[7][l]*alpha_vdim[207][l]+f[48][l]*alpha_vdim[202][l])+(0.1936491673103708*f[130][l]+0.2165063509461096*f[2][l])*alpha_vdim[194][l]+(0.1936491673103708*f[129][l]+0.2165063509461096*f[1][l])*alpha_vdim[193][l]+0.1936491673103708*f[144][l]*alpha_vdim[192][l]+0.2165063509461096*(f[22][l]*alpha_vdim[192][l]+f[36][l]*alpha_vdim[185][l]+f[35][l]*alpha_vdim[184][l]+f[58][l]*alpha_vdim[183][l]+f[32][l]*alpha_vdim[182][l])+(0.1936491673103708*f[128][l]+0.2165063509461096*f[0][l])*alpha_vdim[179][l]+(0.1936491673103708*f[136][l]+0.2165063509461096*f[9][l])*alpha_vdim[178][l]+0.1936491673103708*f[135][l]*alpha_vdim[177][l]+0.2165063509461096*(f[8][l]*alpha_vdim[177][l]+f[20][l]*alpha_vdim[172][l]+f[50][l]*alpha_vdim[171][l]+f[49][l]*alpha_vdim[170][l]+f[18][l]*alpha_vdim[169][l]+f[17][l]*alpha_vdim[168][l]+f[47][l]*alpha_vdim[167][l])+0.1936491673103708*f[131][l]*alpha_vdim[166][l]+0.2165063509461096*(f[3][l]*alpha_vdim[166][l]+f[37][l]*alpha_vdim[164][l]+f[6][l]*alpha_vdim[163][l]+f[34][l]*alpha_vdim[162][l]+f[33][l]*alpha_vdim[161][l]+f[19][l]*alpha_vdim[160][l]);
+    out[41][l] += (0.1936491673103708*f[122][l]+0.2165063509461096*f[42][l])*alpha_vdim[363][l]+(0.1936491673103708*f[90][l]+0.2165063509461096*f[43][l])*alpha_vdim[362][l]+(0.1936491673103708*f[115][l]+0.2165063509461096*f[25][l])*alpha_vdim[348][l]+(0.1936491673103708*f[114][l]+0.2165063509461096*f[24][l])*alpha_vdim[347][l]+(0.1936491673103708*f[113][l]+0.2165063509461096*f[23][l])*alpha_vdim[346][l]+(0.1936491673103708*f[83][l]+0.2165063509461096*f[28][l])*alpha_vdim[345][l]+(0.1936491673103708*f[82][l]+0.2165063509461096*f[27][l])*alpha_vdim[344][l]+0.1936491673103708*f[81][l]*alpha_vdim[343][l]+0.2165063509461096*(f[26][l]*alpha_vdim[343][l]+f[57][l]*alpha_vdim[342][l])+(0.1936491673103708*f[107][l]+0.2165063509461096*f[12][l])*alpha_vdim[335][l]+(0.1936491673103708*f[106][l]+0.2165063509461096*f[11][l])*alpha_vdim[334][l]+(0.1936491673103708*f[105][l]+0.2165063509461096*f[10][l])*alpha_vdim[333][l]+(0.1936491673103708*f[75][l]+0.2165063509461096*f[15][l])*alpha_vdim[332][l]+(0.1936491673103708*f[74][l]+0.2165063509461096*f[14][l])*alpha_vdim[331][l]+0.1936491673103708*f[73][l]*alpha_vdim[330][l]+0.2165063509461096*(f[13][l]*alpha_vdim[330][l]+f[46][l]*alpha_vdim[329][l]+f[45][l]*alpha_vdim[328][l]+f[44][l]*alpha_vdim[327][l])+(0.1936491673103708*f[100][l]+0.2165063509461096*f[4][l])*alpha_vdim[325][l]+0.1936491673103708*f[68][l]*alpha_vdim[324][l]+0.2165063509461096*(f[5][l]*alpha_vdim[324][l]+f[31][l]*alpha_vdim[323][l]+f[30][l]*alpha_vdim[322][l]+f[29][l]*alpha_vdim[321][l]+f[16][l]*alpha_vdim[320][l])+(0.1936491673103708*f[154][l]+0.2165063509461096*f[42][l])*alpha_vdim[207][l]+(0.1936491673103708*f[91][l]+0.2165063509461096*f[47][l])*alpha_vdim[202][l]+(0.1936491673103708*f[147][l]+0.2165063509461096*f[25][l])*alpha_vdim[194][l]+(0.1936491673103708*f[146][l]+0.2165063509461096*f[24][l])*alpha_vdim[193][l]+(0.1936491673103708*f[145][l]+0.2165063509461096*f[23][l])*alpha_vdim[192][l]+(0.1936491673103708*f[86][l]+0.2165063509461096*f[34][l])*alpha_vdim[185][l]+(0.1936491673103708*f[85][l]+0.2165063509461096*f[33][l])*alpha_vdim[184][l]+0.1936491673103708*f[84][l]*alpha_vdim[183][l]+0.2165063509461096*(f[32][l]*alpha_vdim[183][l]+f[58][l]*alpha_vdim[182][l])+(0.1936491673103708*f[139][l]+0.2165063509461096*f[12][l])*alpha_vdim[179][l]+(0.1936491673103708*f[138][l]+0.2165063509461096*f[11][l])*alpha_vdim[178][l]+(0.1936491673103708*f[137][l]+0.2165063509461096*f[10][l])*alpha_vdim[177][l]+(0.1936491673103708*f[78][l]+0.2165063509461096*f[19][l])*alpha_vdim[172][l]+(0.1936491673103708*f[77][l]+0.2165063509461096*f[18][l])*alpha_vdim[171][l]+0.1936491673103708*f[76][l]*alpha_vdim[170][l]+0.2165063509461096*(f[17][l]*alpha_vdim[170][l]+f[50][l]*alpha_vdim[169][l]+f[49][l]*alpha_vdim[168][l]+f[48][l]*alpha_vdim[167][l])+(0.1936491673103708*f[132][l]+0.2165063509461096*f[4][l])*alpha_vdim[166][l]+0.1936491673103708*f[69][l]*alpha_vdim[164][l]+0.2165063509461096*(f[6][l]*alpha_vdim[164][l]+f[37][l]*alpha_vdim[163][l]+f[36][l]*alpha_vdim[162][l]+f[35][l]*alpha_vdim[161][l]+f[20][l]*alpha_vdim[160][l])+0.1936491673103708*(alpha_vdim[47][l]*f[155][l]+alpha_vdim[34][l]*f[150][l]+alpha_vdim[33][l]*f[149][l]+alpha_vdim[32][l]*f[148][l]+alpha_vdim[19][l]*f[142][l]+alpha_vdim[18][l]*f[141][l]+alpha_vdim[17][l]*f[140][l]+alpha_vdim[6][l]*f[133][l]+alpha_vdim[43][l]*f[123][l]+alpha_vdim[28][l]*f[118][l]+alpha_vdim[27][l]*f[117][l]+alpha_vdim[26][l]*f[116][l]+alpha_vdim[15][l]*f[110][l]+alpha_vdim[14][l]*f[109][l]+alpha_vdim[13][l]*f[108][l]+alpha_vdim[5][l]*f[101][l])+0.2165063509461096*(alpha_vdim[22][l]*f[59][l]+alpha_vdim[9][l]*f[53][l]+alpha_vdim[8][l]*f[52][l]+alpha_vdim[7][l]*f[51][l]+alpha_vdim[43][l]*f[47][l]+f[43][l]*alpha_vdim[47][l]+alpha_vdim[3][l]*f[40][l]+alpha_vdim[2][l]*f[39][l]+alpha_vdim[1][l]*f[38][l]+alpha_vdim[28][l]*f[34][l]+f[28][l]*alpha_vdim[34][l]+alpha_vdim[27][l]*f[33][l]+f[27][l]*alpha_vdim[33][l]+alpha_vdim[26][l]*f[32][l]+f[26][l]*alpha_vdim[32][l]+alpha_vdim[0][l]*f[21][l]+alpha_vdim[15][l]*f[19][l]+f[15][l]*alpha_vdim[19][l]+alpha_vdim[14][l]*f[18][l]+f[14][l]*alpha_vdim[18][l]+alpha_vdim[13][l]*f[17][l]+f[13][l]*alpha_vdim[17][l]+alpha_vdim[5][l]*f[6][l]+f[5][l]*alpha_vdim[6][l]);
+    out[42][l] += 0.2165063509461096*(f[48][l]*alpha_cdim[326][l]+f[23][l]*alpha_cdim[320][l]+f[45][l]*alpha_cdim[165][l]+f[24][l]*alpha_cdim[160][l])+0.1936491673103708*alpha_cdim[4][l]*f[72][l]+0.2165063509461096*(alpha_vdim[6][l]*f[47][l]+f[6][l]*alpha_vdim[47][l]+alpha_vdim[5][l]*f[43][l]+f[5][l]*alpha_vdim[43][l]+alpha_vdim[17][l]*f[34][l]+f[17][l]*alpha_vdim[34][l]+alpha_vdim[18][l]*f[33][l]+f[18][l]*alpha_vdim[33][l]+alpha_vdim[19][l]*f[32][l]+f[19][l]*alpha_vdim[32][l]+alpha_vdim[13][l]*f[28][l]+f[13][l]*alpha_vdim[28][l]+alpha_vdim[14][l]*f[27][l]+f[14][l]*alpha_vdim[27][l]+alpha_vdim[15][l]*f[26][l]+f[15][l]*alpha_vdim[26][l]+alpha_cdim[0][l]*f[25][l]+alpha_vdim[0][l]*f[22][l]+f[0][l]*alpha_vdim[22][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[9][l]+f[1][l]*alpha_vdim[9][l]+alpha_vdim[2][l]*f[8][l]+f[2][l]*alpha_vdim[8][l]+alpha_vdim[3][l]*f[7][l]+f[3][l]*alpha_vdim[7][l]);
+    out[43][l] += 0.2165063509461096*(f[51][l]*alpha_cdim[326][l]+f[26][l]*alpha_cdim[320][l]+f[6][l]*alpha_vdim[207][l]+f[4][l]*alpha_vdim[202][l]+f[17][l]*alpha_vdim[194][l]+f[18][l]*alpha_vdim[193][l]+f[19][l]*alpha_vdim[192][l]+f[10][l]*alpha_vdim[185][l]+f[11][l]*alpha_vdim[184][l]+f[12][l]*alpha_vdim[183][l]+f[0][l]*alpha_vdim[182][l]+f[32][l]*alpha_vdim[179][l]+f[33][l]*alpha_vdim[178][l]+f[34][l]*alpha_vdim[177][l]+f[23][l]*alpha_vdim[172][l]+f[24][l]*alpha_vdim[171][l]+f[25][l]*alpha_vdim[170][l]+f[1][l]*alpha_vdim[169][l]+f[2][l]*alpha_vdim[168][l]+f[3][l]*alpha_vdim[167][l]+f[47][l]*alpha_vdim[166][l])+0.1936491673103708*f[103][l]*alpha_cdim[165][l]+0.2165063509461096*(f[8][l]*alpha_cdim[165][l]+f[42][l]*alpha_vdim[164][l]+f[7][l]*alpha_vdim[163][l]+f[8][l]*alpha_vdim[162][l]+f[9][l]*alpha_vdim[161][l]+f[22][l]*alpha_vdim[160][l]+f[27][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[46][l]+alpha_cdim[0][l]*f[28][l]);
+    out[44][l] += 0.2165063509461096*f[37][l]*alpha_vdim[207][l]+0.1936491673103708*f[67][l]*alpha_vdim[202][l]+0.2165063509461096*(f[3][l]*alpha_vdim[202][l]+f[49][l]*alpha_vdim[194][l]+f[50][l]*alpha_vdim[193][l]+f[20][l]*alpha_vdim[192][l])+(0.1936491673103708*f[71][l]+0.2165063509461096*f[8][l])*alpha_vdim[185][l]+(0.1936491673103708*f[72][l]+0.2165063509461096*f[9][l])*alpha_vdim[184][l]+0.1936491673103708*f[64][l]*alpha_vdim[183][l]+0.2165063509461096*(f[0][l]*alpha_vdim[183][l]+f[12][l]*alpha_vdim[182][l]+f[58][l]*alpha_vdim[179][l]+f[35][l]*alpha_vdim[178][l]+f[36][l]*alpha_vdim[177][l])+(0.1936491673103708*f[80][l]+0.2165063509461096*f[22][l])*alpha_vdim[172][l]+(0.1936491673103708*f[65][l]+0.2165063509461096*f[1][l])*alpha_vdim[171][l]+0.1936491673103708*f[66][l]*alpha_vdim[170][l]+0.2165063509461096*(f[2][l]*alpha_vdim[170][l]+f[24][l]*alpha_vdim[169][l]+f[25][l]*alpha_vdim[168][l]+f[4][l]*alpha_vdim[167][l]+f[48][l]*alpha_vdim[166][l])+(0.1936491673103708*f[105][l]+0.2165063509461096*f[10][l])*alpha_cdim[165][l]+0.1936491673103708*f[70][l]*alpha_vdim[164][l]+0.2165063509461096*(f[7][l]*alpha_vdim[164][l]+f[42][l]*alpha_vdim[163][l]+f[10][l]*alpha_vdim[162][l]+f[11][l]*alpha_vdim[161][l]+f[23][l]*alpha_vdim[160][l]+f[29][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[15][l]*f[112][l]+alpha_vdim[27][l]*f[104][l]+alpha_vdim[28][l]*f[103][l]+alpha_vdim[5][l]*f[102][l]+alpha_vdim[43][l]*f[99][l]+alpha_vdim[13][l]*f[98][l]+alpha_vdim[14][l]*f[97][l]+alpha_vdim[26][l]*f[96][l]+alpha_cdim[4][l]*f[74][l])+0.2165063509461096*(alpha_vdim[19][l]*f[59][l]+alpha_vdim[33][l]*f[53][l]+alpha_vdim[34][l]*f[52][l]+alpha_vdim[6][l]*f[51][l]+f[40][l]*alpha_vdim[47][l]+alpha_vdim[3][l]*f[43][l]+f[3][l]*alpha_vdim[43][l]+alpha_vdim[17][l]*f[39][l]+alpha_vdim[18][l]*f[38][l]+f[21][l]*alpha_vdim[32][l]+alpha_cdim[0][l]*f[30][l]+alpha_vdim[8][l]*f[28][l]+f[8][l]*alpha_vdim[28][l]+alpha_vdim[9][l]*f[27][l]+f[9][l]*alpha_vdim[27][l]+alpha_vdim[0][l]*f[26][l]+f[0][l]*alpha_vdim[26][l]+alpha_vdim[15][l]*f[22][l]+f[15][l]*alpha_vdim[22][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[14][l]+f[1][l]*alpha_vdim[14][l]+alpha_vdim[2][l]*f[13][l]+f[2][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*f[7][l]+f[5][l]*alpha_vdim[7][l]);
+    out[45][l] += 0.2165063509461096*(f[54][l]*alpha_cdim[326][l]+f[29][l]*alpha_cdim[320][l]+f[36][l]*alpha_vdim[207][l])+0.1936491673103708*f[66][l]*alpha_vdim[202][l]+0.2165063509461096*(f[2][l]*alpha_vdim[202][l]+f[48][l]*alpha_vdim[194][l]+f[20][l]*alpha_vdim[193][l]+f[50][l]*alpha_vdim[192][l])+(0.1936491673103708*f[70][l]+0.2165063509461096*f[7][l])*alpha_vdim[185][l]+(0.1936491673103708*f[64][l]+0.2165063509461096*f[0][l])*alpha_vdim[184][l]+0.1936491673103708*f[72][l]*alpha_vdim[183][l]+0.2165063509461096*(f[9][l]*alpha_vdim[183][l]+f[11][l]*alpha_vdim[182][l]+f[35][l]*alpha_vdim[179][l]+f[58][l]*alpha_vdim[178][l]+f[37][l]*alpha_vdim[177][l])+(0.1936491673103708*f[65][l]+0.2165063509461096*f[1][l])*alpha_vdim[172][l]+(0.1936491673103708*f[80][l]+0.2165063509461096*f[22][l])*alpha_vdim[171][l]+0.1936491673103708*f[67][l]*alpha_vdim[170][l]+0.2165063509461096*(f[3][l]*alpha_vdim[170][l]+f[23][l]*alpha_vdim[169][l]+f[4][l]*alpha_vdim[168][l]+f[25][l]*alpha_vdim[167][l]+f[49][l]*alpha_vdim[166][l])+0.1936491673103708*f[71][l]*alpha_vdim[164][l]+0.2165063509461096*(f[8][l]*alpha_vdim[164][l]+f[10][l]*alpha_vdim[163][l]+f[42][l]*alpha_vdim[162][l]+f[12][l]*alpha_vdim[161][l]+f[24][l]*alpha_vdim[160][l])+0.1936491673103708*(alpha_vdim[14][l]*f[112][l]+alpha_vdim[26][l]*f[104][l]+alpha_vdim[5][l]*f[103][l]+alpha_vdim[28][l]*f[102][l]+alpha_vdim[13][l]*f[99][l]+alpha_vdim[43][l]*f[98][l]+alpha_vdim[15][l]*f[97][l]+alpha_vdim[27][l]*f[96][l]+alpha_cdim[4][l]*f[75][l])+0.2165063509461096*(alpha_vdim[18][l]*f[59][l]+alpha_vdim[32][l]*f[53][l]+alpha_vdim[6][l]*f[52][l]+alpha_vdim[34][l]*f[51][l]+f[39][l]*alpha_vdim[47][l]+alpha_vdim[2][l]*f[43][l]+f[2][l]*alpha_vdim[43][l]+alpha_vdim[17][l]*f[40][l]+alpha_vdim[19][l]*f[38][l]+f[21][l]*alpha_vdim[33][l]+alpha_cdim[0][l]*f[31][l]+alpha_vdim[7][l]*f[28][l]+f[7][l]*alpha_vdim[28][l]+alpha_vdim[0][l]*f[27][l]+f[0][l]*alpha_vdim[27][l]+alpha_vdim[9][l]*f[26][l]+f[9][l]*alpha_vdim[26][l]+alpha_vdim[14][l]*f[22][l]+f[14][l]*alpha_vdim[22][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[15][l]+f[1][l]*alpha_vdim[15][l]+alpha_vdim[3][l]*f[13][l]+f[3][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*f[8][l]+f[5][l]*alpha_vdim[8][l]);
+    out[46][l] += 0.2165063509461096*(f[55][l]*alpha_cdim[326][l]+f[30][l]*alpha_cdim[320][l]+f[35][l]*alpha_vdim[207][l])+0.1936491673103708*f[65][l]*alpha_vdim[202][l]+0.2165063509461096*(f[1][l]*alpha_vdim[202][l]+f[20][l]*alpha_vdim[194][l]+f[48][l]*alpha_vdim[193][l]+f[49][l]*alpha_vdim[192][l])+(0.1936491673103708*f[64][l]+0.2165063509461096*f[0][l])*alpha_vdim[185][l]+(0.1936491673103708*f[70][l]+0.2165063509461096*f[7][l])*alpha_vdim[184][l]+0.1936491673103708*f[71][l]*alpha_vdim[183][l]+0.2165063509461096*(f[8][l]*alpha_vdim[183][l]+f[10][l]*alpha_vdim[182][l]+f[36][l]*alpha_vdim[179][l]+f[37][l]*alpha_vdim[178][l]+f[58][l]*alpha_vdim[177][l])+(0.1936491673103708*f[66][l]+0.2165063509461096*f[2][l])*alpha_vdim[172][l]+(0.1936491673103708*f[67][l]+0.2165063509461096*f[3][l])*alpha_vdim[171][l]+0.1936491673103708*f[80][l]*alpha_vdim[170][l]+0.2165063509461096*(f[22][l]*alpha_vdim[170][l]+f[4][l]*alpha_vdim[169][l]+f[23][l]*alpha_vdim[168][l]+f[24][l]*alpha_vdim[167][l]+f[50][l]*alpha_vdim[166][l])+(0.1936491673103708*f[107][l]+0.2165063509461096*f[12][l])*alpha_cdim[165][l]+0.1936491673103708*f[72][l]*alpha_vdim[164][l]+0.2165063509461096*(f[9][l]*alpha_vdim[164][l]+f[11][l]*alpha_vdim[163][l]+f[12][l]*alpha_vdim[162][l]+f[42][l]*alpha_vdim[161][l]+f[25][l]*alpha_vdim[160][l]+f[31][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[13][l]*f[112][l]+alpha_vdim[5][l]*f[104][l]+alpha_vdim[26][l]*f[103][l]+alpha_vdim[27][l]*f[102][l]+alpha_vdim[14][l]*f[99][l]+alpha_vdim[15][l]*f[98][l]+alpha_vdim[43][l]*f[97][l]+alpha_vdim[28][l]*f[96][l])+0.2165063509461096*(alpha_vdim[17][l]*f[59][l]+alpha_vdim[6][l]*f[53][l]+alpha_vdim[32][l]*f[52][l]+alpha_vdim[33][l]*f[51][l]+f[38][l]*alpha_vdim[47][l]+alpha_vdim[1][l]*f[43][l]+f[1][l]*alpha_vdim[43][l]+alpha_vdim[18][l]*f[40][l]+alpha_vdim[19][l]*f[39][l]+f[21][l]*alpha_vdim[34][l]+alpha_vdim[0][l]*f[28][l]+f[0][l]*alpha_vdim[28][l]+alpha_vdim[7][l]*f[27][l]+f[7][l]*alpha_vdim[27][l]+alpha_vdim[8][l]*f[26][l]+f[8][l]*alpha_vdim[26][l]+alpha_vdim[13][l]*f[22][l]+f[13][l]*alpha_vdim[22][l]+alpha_vdim[2][l]*f[15][l]+f[2][l]*alpha_vdim[15][l]+alpha_vdim[3][l]*f[14][l]+f[3][l]*alpha_vdim[14][l]+alpha_vdim[5][l]*f[9][l]+f[5][l]*alpha_vdim[9][l]);
+    out[47][l] += 0.2165063509461096*(f[5][l]*alpha_vdim[363][l]+f[4][l]*alpha_vdim[362][l]+f[13][l]*alpha_vdim[348][l]+f[14][l]*alpha_vdim[347][l]+f[15][l]*alpha_vdim[346][l]+f[10][l]*alpha_vdim[345][l]+f[11][l]*alpha_vdim[344][l]+f[12][l]*alpha_vdim[343][l]+f[0][l]*alpha_vdim[342][l]+f[26][l]*alpha_vdim[335][l]+f[27][l]*alpha_vdim[334][l]+f[28][l]*alpha_vdim[333][l]+f[23][l]*alpha_vdim[332][l]+f[24][l]*alpha_vdim[331][l]+f[25][l]*alpha_vdim[330][l]+f[1][l]*alpha_vdim[329][l]+f[2][l]*alpha_vdim[328][l]+f[3][l]*alpha_vdim[327][l])+0.1936491673103708*f[134][l]*alpha_cdim[326][l]+0.2165063509461096*(f[7][l]*alpha_cdim[326][l]+f[43][l]*alpha_vdim[325][l]+f[42][l]*alpha_vdim[324][l]+f[7][l]*alpha_vdim[323][l]+f[8][l]*alpha_vdim[322][l]+f[9][l]*alpha_vdim[321][l]+f[22][l]*alpha_vdim[320][l]+f[32][l]*alpha_cdim[320][l]+f[52][l]*alpha_cdim[165][l]+f[33][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[50][l]+alpha_cdim[0][l]*f[34][l]);
+    out[48][l] += 0.2165063509461096*f[31][l]*alpha_vdim[363][l]+0.1936491673103708*f[67][l]*alpha_vdim[362][l]+0.2165063509461096*(f[3][l]*alpha_vdim[362][l]+f[45][l]*alpha_vdim[348][l]+f[46][l]*alpha_vdim[347][l]+f[16][l]*alpha_vdim[346][l])+(0.1936491673103708*f[71][l]+0.2165063509461096*f[8][l])*alpha_vdim[345][l]+(0.1936491673103708*f[72][l]+0.2165063509461096*f[9][l])*alpha_vdim[344][l]+0.1936491673103708*f[64][l]*alpha_vdim[343][l]+0.2165063509461096*(f[0][l]*alpha_vdim[343][l]+f[12][l]*alpha_vdim[342][l]+f[57][l]*alpha_vdim[335][l]+f[29][l]*alpha_vdim[334][l]+f[30][l]*alpha_vdim[333][l])+(0.1936491673103708*f[80][l]+0.2165063509461096*f[22][l])*alpha_vdim[332][l]+(0.1936491673103708*f[65][l]+0.2165063509461096*f[1][l])*alpha_vdim[331][l]+0.1936491673103708*f[66][l]*alpha_vdim[330][l]+0.2165063509461096*(f[2][l]*alpha_vdim[330][l]+f[24][l]*alpha_vdim[329][l]+f[25][l]*alpha_vdim[328][l]+f[4][l]*alpha_vdim[327][l]+f[44][l]*alpha_vdim[325][l])+0.1936491673103708*f[70][l]*alpha_vdim[324][l]+0.2165063509461096*(f[7][l]*alpha_vdim[324][l]+f[42][l]*alpha_vdim[323][l]+f[10][l]*alpha_vdim[322][l]+f[11][l]*alpha_vdim[321][l]+f[23][l]*alpha_vdim[320][l]+f[54][l]*alpha_cdim[165][l]+f[35][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[19][l]*f[144][l]+alpha_vdim[33][l]*f[136][l]+alpha_vdim[34][l]*f[135][l]+alpha_vdim[6][l]*f[134][l]+alpha_vdim[47][l]*f[131][l]+alpha_vdim[17][l]*f[130][l]+alpha_vdim[18][l]*f[129][l]+alpha_vdim[32][l]*f[128][l]+alpha_cdim[4][l]*f[77][l])+0.2165063509461096*(alpha_vdim[15][l]*f[59][l]+alpha_vdim[27][l]*f[53][l]+alpha_vdim[28][l]*f[52][l]+alpha_vdim[5][l]*f[51][l]+alpha_vdim[3][l]*f[47][l]+f[3][l]*alpha_vdim[47][l]+f[40][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[39][l]+alpha_vdim[14][l]*f[38][l]+alpha_cdim[0][l]*f[36][l]+alpha_vdim[8][l]*f[34][l]+f[8][l]*alpha_vdim[34][l]+alpha_vdim[9][l]*f[33][l]+f[9][l]*alpha_vdim[33][l]+alpha_vdim[0][l]*f[32][l]+f[0][l]*alpha_vdim[32][l]+f[21][l]*alpha_vdim[26][l]+alpha_vdim[19][l]*f[22][l]+f[19][l]*alpha_vdim[22][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[18][l]+f[1][l]*alpha_vdim[18][l]+alpha_vdim[2][l]*f[17][l]+f[2][l]*alpha_vdim[17][l]+alpha_vdim[6][l]*f[7][l]+f[6][l]*alpha_vdim[7][l]);
+    out[49][l] += 0.2165063509461096*f[30][l]*alpha_vdim[363][l]+0.1936491673103708*f[66][l]*alpha_vdim[362][l]+0.2165063509461096*(f[2][l]*alpha_vdim[362][l]+f[44][l]*alpha_vdim[348][l]+f[16][l]*alpha_vdim[347][l]+f[46][l]*alpha_vdim[346][l])+(0.1936491673103708*f[70][l]+0.2165063509461096*f[7][l])*alpha_vdim[345][l]+(0.1936491673103708*f[64][l]+0.2165063509461096*f[0][l])*alpha_vdim[344][l]+0.1936491673103708*f[72][l]*alpha_vdim[343][l]+0.2165063509461096*(f[9][l]*alpha_vdim[343][l]+f[11][l]*alpha_vdim[342][l]+f[29][l]*alpha_vdim[335][l]+f[57][l]*alpha_vdim[334][l]+f[31][l]*alpha_vdim[333][l])+(0.1936491673103708*f[65][l]+0.2165063509461096*f[1][l])*alpha_vdim[332][l]+(0.1936491673103708*f[80][l]+0.2165063509461096*f[22][l])*alpha_vdim[331][l]+0.1936491673103708*f[67][l]*alpha_vdim[330][l]+0.2165063509461096*(f[3][l]*alpha_vdim[330][l]+f[23][l]*alpha_vdim[329][l]+f[4][l]*alpha_vdim[328][l]+f[25][l]*alpha_vdim[327][l])+0.1936491673103708*f[137][l]*alpha_cdim[326][l]+0.2165063509461096*(f[10][l]*alpha_cdim[326][l]+f[45][l]*alpha_vdim[325][l])+0.1936491673103708*f[71][l]*alpha_vdim[324][l]+0.2165063509461096*(f[8][l]*alpha_vdim[324][l]+f[10][l]*alpha_vdim[323][l]+f[42][l]*alpha_vdim[322][l]+f[12][l]*alpha_vdim[321][l]+f[24][l]*alpha_vdim[320][l]+f[35][l]*alpha_cdim[320][l])+0.1936491673103708*(alpha_vdim[18][l]*f[144][l]+alpha_vdim[32][l]*f[136][l]+alpha_vdim[6][l]*f[135][l]+alpha_vdim[34][l]*f[134][l]+alpha_vdim[17][l]*f[131][l]+alpha_vdim[47][l]*f[130][l]+alpha_vdim[19][l]*f[129][l]+alpha_vdim[33][l]*f[128][l]+alpha_cdim[4][l]*f[78][l])+0.2165063509461096*(alpha_vdim[14][l]*f[59][l]+alpha_vdim[26][l]*f[53][l]+alpha_vdim[5][l]*f[52][l]+alpha_vdim[28][l]*f[51][l]+alpha_vdim[2][l]*f[47][l]+f[2][l]*alpha_vdim[47][l]+f[39][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[40][l]+alpha_vdim[15][l]*f[38][l]+alpha_cdim[0][l]*f[37][l]+alpha_vdim[7][l]*f[34][l]+f[7][l]*alpha_vdim[34][l]+alpha_vdim[0][l]*f[33][l]+f[0][l]*alpha_vdim[33][l]+alpha_vdim[9][l]*f[32][l]+f[9][l]*alpha_vdim[32][l]+f[21][l]*alpha_vdim[27][l]+alpha_vdim[18][l]*f[22][l]+f[18][l]*alpha_vdim[22][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[19][l]+f[1][l]*alpha_vdim[19][l]+alpha_vdim[3][l]*f[17][l]+f[3][l]*alpha_vdim[17][l]+alpha_vdim[6][l]*f[8][l]+f[6][l]*alpha_vdim[8][l]);
+    out[50][l] += 0.2165063509461096*f[29][l]*alpha_vdim[363][l]+0.1936491673103708*f[65][l]*alpha_vdim[362][l]+0.2165063509461096*(f[1][l]*alpha_vdim[362][l]+f[16][l]*alpha_vdim[348][l]+f[44][l]*alpha_vdim[347][l]+f[45][l]*alpha_vdim[346][l])+(0.1936491673103708*f[64][l]+0.2165063509461096*f[0][l])*alpha_vdim[345][l]+(0.1936491673103708*f[70][l]+0.2165063509461096*f[7][l])*alpha_vdim[344][l]+0.1936491673103708*f[71][l]*alpha_vdim[343][l]+0.2165063509461096*(f[8][l]*alpha_vdim[343][l]+f[10][l]*alpha_vdim[342][l]+f[30][l]*alpha_vdim[335][l]+f[31][l]*alpha_vdim[334][l]+f[57][l]*alpha_vdim[333][l])+(0.1936491673103708*f[66][l]+0.2165063509461096*f[2][l])*alpha_vdim[332][l]+(0.1936491673103708*f[67][l]+0.2165063509461096*f[3][l])*alpha_vdim[331][l]+0.1936491673103708*f[80][l]*alpha_vdim[330][l]+0.2165063509461096*(f[22][l]*alpha_vdim[330][l]+f[4][l]*alpha_vdim[329][l]+f[23][l]*alpha_vdim[328][l]+f[24][l]*alpha_vdim[327][l])+0.1936491673103708*f[138][l]*alpha_cdim[326][l]+0.2165063509461096*(f[11][l]*alpha_cdim[326][l]+f[46][l]*alpha_vdim[325][l])+0.1936491673103708*f[72][l]*alpha_vdim[324][l]+0.2165063509461096*(f[9][l]*alpha_vdim[324][l]+f[11][l]*alpha_vdim[323][l]+f[12][l]*alpha_vdim[322][l]+f[42][l]*alpha_vdim[321][l]+f[25][l]*alpha_vdim[320][l]+f[36][l]*alpha_cdim[320][l]+f[56][l]*alpha_cdim[165][l]+f[37][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[17][l]*f[144][l]+alpha_vdim[6][l]*f[136][l]+alpha_vdim[32][l]*f[135][l]+alpha_vdim[33][l]*f[134][l]+alpha_vdim[18][l]*f[131][l]+alpha_vdim[19][l]*f[130][l]+alpha_vdim[47][l]*f[129][l]+alpha_vdim[34][l]*f[128][l])+0.2165063509461096*(alpha_vdim[13][l]*f[59][l]+alpha_vdim[5][l]*f[53][l]+alpha_vdim[26][l]*f[52][l]+alpha_vdim[27][l]*f[51][l]+alpha_vdim[1][l]*f[47][l]+f[1][l]*alpha_vdim[47][l]+f[38][l]*alpha_vdim[43][l]+alpha_vdim[14][l]*f[40][l]+alpha_vdim[15][l]*f[39][l]+alpha_vdim[0][l]*f[34][l]+f[0][l]*alpha_vdim[34][l]+alpha_vdim[7][l]*f[33][l]+f[7][l]*alpha_vdim[33][l]+alpha_vdim[8][l]*f[32][l]+f[8][l]*alpha_vdim[32][l]+f[21][l]*alpha_vdim[28][l]+alpha_vdim[17][l]*f[22][l]+f[17][l]*alpha_vdim[22][l]+alpha_vdim[2][l]*f[19][l]+f[2][l]*alpha_vdim[19][l]+alpha_vdim[3][l]*f[18][l]+f[3][l]*alpha_vdim[18][l]+alpha_vdim[6][l]*f[9][l]+f[6][l]*alpha_vdim[9][l]);
+    out[51][l] += 0.1936491673103708*f[99][l]*alpha_vdim[363][l]+0.2165063509461096*(f[3][l]*alpha_vdim[363][l]+f[31][l]*alpha_vdim[362][l])+(0.1936491673103708*f[103][l]+0.2165063509461096*f[8][l])*alpha_vdim[348][l]+(0.1936491673103708*f[104][l]+0.2165063509461096*f[9][l])*alpha_vdim[347][l]+0.1936491673103708*f[96][l]*alpha_vdim[346][l]+0.2165063509461096*(f[0][l]*alpha_vdim[346][l]+f[45][l]*alpha_vdim[345][l]+f[46][l]*alpha_vdim[344][l]+f[16][l]*alpha_vdim[343][l]+f[15][l]*alpha_vdim[342][l])+(0.1936491673103708*f[112][l]+0.2165063509461096*f[22][l])*alpha_vdim[335][l]+(0.1936491673103708*f[97][l]+0.2165063509461096*f[1][l])*alpha_vdim[334][l]+0.1936491673103708*f[98][l]*alpha_vdim[333][l]+0.2165063509461096*(f[2][l]*alpha_vdim[333][l]+f[57][l]*alpha_vdim[332][l]+f[29][l]*alpha_vdim[331][l]+f[30][l]*alpha_vdim[330][l]+f[27][l]*alpha_vdim[329][l]+f[28][l]*alpha_vdim[328][l]+f[5][l]*alpha_vdim[327][l])+0.1936491673103708*f[102][l]*alpha_vdim[325][l]+0.2165063509461096*(f[7][l]*alpha_vdim[325][l]+f[44][l]*alpha_vdim[324][l]+f[43][l]*alpha_vdim[323][l]+f[13][l]*alpha_vdim[322][l]+f[14][l]*alpha_vdim[321][l]+f[26][l]*alpha_vdim[320][l])+0.1936491673103708*f[131][l]*alpha_vdim[207][l]+0.2165063509461096*(f[3][l]*alpha_vdim[207][l]+f[37][l]*alpha_vdim[202][l])+(0.1936491673103708*f[135][l]+0.2165063509461096*f[8][l])*alpha_vdim[194][l]+(0.1936491673103708*f[136][l]+0.2165063509461096*f[9][l])*alpha_vdim[193][l]+0.1936491673103708*f[128][l]*alpha_vdim[192][l]+0.2165063509461096*(f[0][l]*alpha_vdim[192][l]+f[49][l]*alpha_vdim[185][l]+f[50][l]*alpha_vdim[184][l]+f[20][l]*alpha_vdim[183][l]+f[19][l]*alpha_vdim[182][l])+(0.1936491673103708*f[144][l]+0.2165063509461096*f[22][l])*alpha_vdim[179][l]+(0.1936491673103708*f[129][l]+0.2165063509461096*f[1][l])*alpha_vdim[178][l]+0.1936491673103708*f[130][l]*alpha_vdim[177][l]+0.2165063509461096*(f[2][l]*alpha_vdim[177][l]+f[58][l]*alpha_vdim[172][l]+f[35][l]*alpha_vdim[171][l]+f[36][l]*alpha_vdim[170][l]+f[33][l]*alpha_vdim[169][l]+f[34][l]*alpha_vdim[168][l]+f[6][l]*alpha_vdim[167][l])+(0.1936491673103708*f[134][l]+0.2165063509461096*f[7][l])*alpha_vdim[166][l]+0.1936491673103708*f[108][l]*alpha_cdim[165][l]+0.2165063509461096*(f[17][l]*alpha_cdim[165][l]+f[48][l]*alpha_vdim[164][l]+f[47][l]*alpha_vdim[163][l]+f[17][l]*alpha_vdim[162][l]+f[18][l]*alpha_vdim[161][l]+f[32][l]*alpha_vdim[160][l]+f[38][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[55][l]+alpha_cdim[0][l]*f[39][l]);
+    out[52][l] += 0.1936491673103708*f[98][l]*alpha_vdim[363][l]+0.2165063509461096*(f[2][l]*alpha_vdim[363][l]+f[30][l]*alpha_vdim[362][l])+(0.1936491673103708*f[102][l]+0.2165063509461096*f[7][l])*alpha_vdim[348][l]+(0.1936491673103708*f[96][l]+0.2165063509461096*f[0][l])*alpha_vdim[347][l]+0.1936491673103708*f[104][l]*alpha_vdim[346][l]+0.2165063509461096*(f[9][l]*alpha_vdim[346][l]+f[44][l]*alpha_vdim[345][l]+f[16][l]*alpha_vdim[344][l]+f[46][l]*alpha_vdim[343][l]+f[14][l]*alpha_vdim[342][l])+(0.1936491673103708*f[97][l]+0.2165063509461096*f[1][l])*alpha_vdim[335][l]+(0.1936491673103708*f[112][l]+0.2165063509461096*f[22][l])*alpha_vdim[334][l]+0.1936491673103708*f[99][l]*alpha_vdim[333][l]+0.2165063509461096*(f[3][l]*alpha_vdim[333][l]+f[29][l]*alpha_vdim[332][l]+f[57][l]*alpha_vdim[331][l]+f[31][l]*alpha_vdim[330][l]+f[26][l]*alpha_vdim[329][l]+f[5][l]*alpha_vdim[328][l]+f[28][l]*alpha_vdim[327][l])+(0.1936491673103708*f[140][l]+0.2165063509461096*f[13][l])*alpha_cdim[326][l]+0.1936491673103708*f[103][l]*alpha_vdim[325][l]+0.2165063509461096*(f[8][l]*alpha_vdim[325][l]+f[45][l]*alpha_vdim[324][l]+f[13][l]*alpha_vdim[323][l]+f[43][l]*alpha_vdim[322][l]+f[15][l]*alpha_vdim[321][l]+f[27][l]*alpha_vdim[320][l]+f[38][l]*alpha_cdim[320][l])+0.1936491673103708*f[130][l]*alpha_vdim[207][l]+0.2165063509461096*(f[2][l]*alpha_vdim[207][l]+f[36][l]*alpha_vdim[202][l])+(0.1936491673103708*f[134][l]+0.2165063509461096*f[7][l])*alpha_vdim[194][l]+(0.1936491673103708*f[128][l]+0.2165063509461096*f[0][l])*alpha_vdim[193][l]+0.1936491673103708*f[136][l]*alpha_vdim[192][l]+0.2165063509461096*(f[9][l]*alpha_vdim[192][l]+f[48][l]*alpha_vdim[185][l]+f[20][l]*alpha_vdim[184][l]+f[50][l]*alpha_vdim[183][l]+f[18][l]*alpha_vdim[182][l])+(0.1936491673103708*f[129][l]+0.2165063509461096*f[1][l])*alpha_vdim[179][l]+(0.1936491673103708*f[144][l]+0.2165063509461096*f[22][l])*alpha_vdim[178][l]+0.1936491673103708*f[131][l]*alpha_vdim[177][l]+0.2165063509461096*(f[3][l]*alpha_vdim[177][l]+f[35][l]*alpha_vdim[172][l]+f[58][l]*alpha_vdim[171][l]+f[37][l]*alpha_vdim[170][l]+f[32][l]*alpha_vdim[169][l]+f[6][l]*alpha_vdim[168][l]+f[34][l]*alpha_vdim[167][l])+0.1936491673103708*f[135][l]*alpha_vdim[166][l]+0.2165063509461096*(f[8][l]*alpha_vdim[166][l]+f[49][l]*alpha_vdim[164][l]+f[17][l]*alpha_vdim[163][l]+f[47][l]*alpha_vdim[162][l]+f[19][l]*alpha_vdim[161][l]+f[33][l]*alpha_vdim[160][l]+alpha_cdim[4][l]*f[56][l]+alpha_cdim[0][l]*f[40][l]);
+    out[53][l] += 0.1936491673103708*f[97][l]*alpha_vdim[363][l]+0.2165063509461096*(f[1][l]*alpha_vdim[363][l]+f[29][l]*alpha_vdim[362][l])+(0.1936491673103708*f[96][l]+0.2165063509461096*f[0][l])*alpha_vdim[348][l]+(0.1936491673103708*f[102][l]+0.2165063509461096*f[7][l])*alpha_vdim[347][l]+0.1936491673103708*f[103][l]*alpha_vdim[346][l]+0.2165063509461096*(f[8][l]*alpha_vdim[346][l]+f[16][l]*alpha_vdim[345][l]+f[44][l]*alpha_vdim[344][l]+f[45][l]*alpha_vdim[343][l]+f[13][l]*alpha_vdim[342][l])+(0.1936491673103708*f[98][l]+0.2165063509461096*f[2][l])*alpha_vdim[335][l]+(0.1936491673103708*f[99][l]+0.2165063509461096*f[3][l])*alpha_vdim[334][l]+0.1936491673103708*f[112][l]*alpha_vdim[333][l]+0.2165063509461096*(f[22][l]*alpha_vdim[333][l]+f[30][l]*alpha_vdim[332][l]+f[31][l]*alpha_vdim[331][l]+f[57][l]*alpha_vdim[330][l]+f[5][l]*alpha_vdim[329][l]+f[26][l]*alpha_vdim[328][l]+f[27][l]*alpha_vdim[327][l])+(0.1936491673103708*f[141][l]+0.2165063509461096*f[14][l])*alpha_cdim[326][l]+0.1936491673103708*f[104][l]*alpha_vdim[325][l]+0.2165063509461096*(f[9][l]*alpha_vdim[325][l]+f[46][l]*alpha_vdim[324][l]+f[14][l]*alpha_vdim[323][l]+f[15][l]*alpha_vdim[322][l]+f[43][l]*alpha_vdim[321][l]+f[28][l]*alpha_vdim[320][l]+f[39][l]*alpha_cdim[320][l])+0.1936491673103708*f[129][l]*alpha_vdim[207][l]+0.2165063509461096*(f[1][l]*alpha_vdim[207][l]+f[35][l]*alpha_vdim[202][l])+(0.1936491673103708*f[128][l]+0.2165063509461096*f[0][l])*alpha_vdim[194][l]+(0.1936491673103708*f[134][l]+0.2165063509461096*f[7][l])*alpha_vdim[193][l]+0.1936491673103708*f[135][l]*alpha_vdim[192][l]+0.2165063509461096*(f[8][l]*alpha_vdim[192][l]+f[20][l]*alpha_vdim[185][l]+f[48][l]*alpha_vdim[184][l]+f[49][l]*alpha_vdim[183][l]+f[17][l]*alpha_vdim[182][l])+(0.1936491673103708*f[130][l]+0.2165063509461096*f[2][l])*alpha_vdim[179][l]+(0.1936491673103708*f[131][l]+0.2165063509461096*f[3][l])*alpha_vdim[178][l]+0.1936491673103708*f[144][l]*alpha_vdim[177][l]+0.2165063509461096*(f[22][l]*alpha_vdim[177][l]+f[36][l]*alpha_vdim[172][l]+f[37][l]*alpha_vdim[171][l]+f[58][l]*alpha_vdim[170][l]+f[6][l]*alpha_vdim[169][l]+f[32][l]*alpha_vdim[168][l]+f[33][l]*alpha_vdim[167][l])+(0.1936491673103708*f[136][l]+0.2165063509461096*f[9][l])*alpha_vdim[166][l]+0.1936491673103708*f[110][l]*alpha_cdim[165][l]+0.2165063509461096*(f[19][l]*alpha_cdim[165][l]+f[50][l]*alpha_vdim[164][l]+f[18][l]*alpha_vdim[163][l]+f[19][l]*alpha_vdim[162][l]+f[47][l]*alpha_vdim[161][l]+f[34][l]*alpha_vdim[160][l]+f[40][l]*alpha_cdim[160][l]);
+    out[54][l] += (0.1936491673103708*f[115][l]+0.2165063509461096*f[25][l])*alpha_vdim[363][l]+(0.1936491673103708*f[83][l]+0.2165063509461096*f[28][l])*alpha_vdim[362][l]+(0.1936491673103708*f[122][l]+0.2165063509461096*f[42][l])*alpha_vdim[348][l]+(0.1936491673103708*f[107][l]+0.2165063509461096*f[12][l])*alpha_vdim[347][l]+(0.1936491673103708*f[106][l]+0.2165063509461096*f[11][l])*alpha_vdim[346][l]+(0.1936491673103708*f[90][l]+0.2165063509461096*f[43][l])*alpha_vdim[345][l]+(0.1936491673103708*f[75][l]+0.2165063509461096*f[15][l])*alpha_vdim[344][l]+0.1936491673103708*f[74][l]*alpha_vdim[343][l]+0.2165063509461096*(f[14][l]*alpha_vdim[343][l]+f[46][l]*alpha_vdim[342][l])+(0.1936491673103708*f[114][l]+0.2165063509461096*f[24][l])*alpha_vdim[335][l]+(0.1936491673103708*f[113][l]+0.2165063509461096*f[23][l])*alpha_vdim[334][l]+(0.1936491673103708*f[100][l]+0.2165063509461096*f[4][l])*alpha_vdim[333][l]+(0.1936491673103708*f[82][l]+0.2165063509461096*f[27][l])*alpha_vdim[332][l]+(0.1936491673103708*f[81][l]+0.2165063509461096*f[26][l])*alpha_vdim[331][l]+0.1936491673103708*f[68][l]*alpha_vdim[330][l]+0.2165063509461096*(f[5][l]*alpha_vdim[330][l]+f[57][l]*alpha_vdim[329][l]+f[31][l]*alpha_vdim[328][l]+f[30][l]*alpha_vdim[327][l])+(0.1936491673103708*f[105][l]+0.2165063509461096*f[10][l])*alpha_vdim[325][l]+0.1936491673103708*f[73][l]*alpha_vdim[324][l]+0.2165063509461096*(f[13][l]*alpha_vdim[324][l]+f[45][l]*alpha_vdim[323][l]+f[44][l]*alpha_vdim[322][l]+f[16][l]*alpha_vdim[321][l]+f[29][l]*alpha_vdim[320][l])+(0.1936491673103708*f[147][l]+0.2165063509461096*f[25][l])*alpha_vdim[207][l]+(0.1936491673103708*f[86][l]+0.2165063509461096*f[34][l])*alpha_vdim[202][l]+(0.1936491673103708*f[154][l]+0.2165063509461096*f[42][l])*alpha_vdim[194][l]+(0.1936491673103708*f[139][l]+0.2165063509461096*f[12][l])*alpha_vdim[193][l]+(0.1936491673103708*f[138][l]+0.2165063509461096*f[11][l])*alpha_vdim[192][l]+(0.1936491673103708*f[91][l]+0.2165063509461096*f[47][l])*alpha_vdim[185][l]+(0.1936491673103708*f[78][l]+0.2165063509461096*f[19][l])*alpha_vdim[184][l]+0.1936491673103708*f[77][l]*alpha_vdim[183][l]+0.2165063509461096*(f[18][l]*alpha_vdim[183][l]+f[50][l]*alpha_vdim[182][l])+(0.1936491673103708*f[146][l]+0.2165063509461096*f[24][l])*alpha_vdim[179][l]+(0.1936491673103708*f[145][l]+0.2165063509461096*f[23][l])*alpha_vdim[178][l]+(0.1936491673103708*f[132][l]+0.2165063509461096*f[4][l])*alpha_vdim[177][l]+(0.1936491673103708*f[85][l]+0.2165063509461096*f[33][l])*alpha_vdim[172][l]+(0.1936491673103708*f[84][l]+0.2165063509461096*f[32][l])*alpha_vdim[171][l]+0.1936491673103708*f[69][l]*alpha_vdim[170][l]+0.2165063509461096*(f[6][l]*alpha_vdim[170][l]+f[58][l]*alpha_vdim[169][l]+f[37][l]*alpha_vdim[168][l]+f[36][l]*alpha_vdim[167][l])+(0.1936491673103708*f[137][l]+0.2165063509461096*f[10][l])*alpha_vdim[166][l]+0.1936491673103708*f[76][l]*alpha_vdim[164][l]+0.2165063509461096*(f[17][l]*alpha_vdim[164][l]+f[49][l]*alpha_vdim[163][l]+f[48][l]*alpha_vdim[162][l]+f[20][l]*alpha_vdim[161][l]+f[35][l]*alpha_vdim[160][l])+0.1936491673103708*(alpha_vdim[34][l]*f[155][l]+alpha_vdim[47][l]*f[150][l]+alpha_vdim[19][l]*f[149][l]+alpha_vdim[18][l]*f[148][l]+alpha_vdim[33][l]*f[142][l]+alpha_vdim[32][l]*f[141][l]+alpha_vdim[6][l]*f[140][l]+alpha_vdim[17][l]*f[133][l]+alpha_vdim[28][l]*f[123][l]+alpha_vdim[43][l]*f[118][l]+alpha_vdim[15][l]*f[117][l]+alpha_vdim[14][l]*f[116][l]+alpha_vdim[27][l]*f[110][l]+alpha_vdim[26][l]*f[109][l]+alpha_vdim[5][l]*f[108][l]+alpha_vdim[13][l]*f[101][l]+alpha_cdim[4][l]*f[79][l])+0.2165063509461096*(alpha_vdim[9][l]*f[59][l]+alpha_vdim[22][l]*f[53][l]+alpha_vdim[3][l]*f[52][l]+alpha_vdim[2][l]*f[51][l]+alpha_vdim[28][l]*f[47][l]+f[28][l]*alpha_vdim[47][l]+alpha_vdim[34][l]*f[43][l]+f[34][l]*alpha_vdim[43][l]+alpha_cdim[0][l]*f[41][l]+alpha_vdim[8][l]*f[40][l]+alpha_vdim[7][l]*f[39][l]+alpha_vdim[0][l]*f[38][l]+alpha_vdim[15][l]*f[33][l]+f[15][l]*alpha_vdim[33][l]+alpha_vdim[14][l]*f[32][l]+f[14][l]*alpha_vdim[32][l]+alpha_vdim[19][l]*f[27][l]+f[19][l]*alpha_vdim[27][l]+alpha_vdim[18][l]*f[26][l]+f[18][l]*alpha_vdim[26][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[21][l]+alpha_vdim[5][l]*f[17][l]+f[5][l]*alpha_vdim[17][l]+alpha_vdim[6][l]*f[13][l]+f[6][l]*alpha_vdim[13][l]);
+    out[55][l] += (0.1936491673103708*f[114][l]+0.2165063509461096*f[24][l])*alpha_vdim[363][l]+(0.1936491673103708*f[82][l]+0.2165063509461096*f[27][l])*alpha_vdim[362][l]+(0.1936491673103708*f[107][l]+0.2165063509461096*f[12][l])*alpha_vdim[348][l]+(0.1936491673103708*f[122][l]+0.2165063509461096*f[42][l])*alpha_vdim[347][l]+(0.1936491673103708*f[105][l]+0.2165063509461096*f[10][l])*alpha_vdim[346][l]+(0.1936491673103708*f[75][l]+0.2165063509461096*f[15][l])*alpha_vdim[345][l]+(0.1936491673103708*f[90][l]+0.2165063509461096*f[43][l])*alpha_vdim[344][l]+0.1936491673103708*f[73][l]*alpha_vdim[343][l]+0.2165063509461096*(f[13][l]*alpha_vdim[343][l]+f[45][l]*alpha_vdim[342][l])+(0.1936491673103708*f[115][l]+0.2165063509461096*f[25][l])*alpha_vdim[335][l]+(0.1936491673103708*f[100][l]+0.2165063509461096*f[4][l])*alpha_vdim[334][l]+(0.1936491673103708*f[113][l]+0.2165063509461096*f[23][l])*alpha_vdim[333][l]+(0.1936491673103708*f[83][l]+0.2165063509461096*f[28][l])*alpha_vdim[332][l]+(0.1936491673103708*f[68][l]+0.2165063509461096*f[5][l])*alpha_vdim[331][l]+0.1936491673103708*f[81][l]*alpha_vdim[330][l]+0.2165063509461096*(f[26][l]*alpha_vdim[330][l]+f[31][l]*alpha_vdim[329][l]+f[57][l]*alpha_vdim[328][l]+f[29][l]*alpha_vdim[327][l])+(0.1936491673103708*f[106][l]+0.2165063509461096*f[11][l])*alpha_vdim[325][l]+0.1936491673103708*f[74][l]*alpha_vdim[324][l]+0.2165063509461096*(f[14][l]*alpha_vdim[324][l]+f[46][l]*alpha_vdim[323][l]+f[16][l]*alpha_vdim[322][l]+f[44][l]*alpha_vdim[321][l]+f[30][l]*alpha_vdim[320][l])+(0.1936491673103708*f[146][l]+0.2165063509461096*f[24][l])*alpha_vdim[207][l]+(0.1936491673103708*f[85][l]+0.2165063509461096*f[33][l])*alpha_vdim[202][l]+(0.1936491673103708*f[139][l]+0.2165063509461096*f[12][l])*alpha_vdim[194][l]+(0.1936491673103708*f[154][l]+0.2165063509461096*f[42][l])*alpha_vdim[193][l]+(0.1936491673103708*f[137][l]+0.2165063509461096*f[10][l])*alpha_vdim[192][l]+(0.1936491673103708*f[78][l]+0.2165063509461096*f[19][l])*alpha_vdim[185][l]+(0.1936491673103708*f[91][l]+0.2165063509461096*f[47][l])*alpha_vdim[184][l]+0.1936491673103708*f[76][l]*alpha_vdim[183][l]+0.2165063509461096*(f[17][l]*alpha_vdim[183][l]+f[49][l]*alpha_vdim[182][l])+(0.1936491673103708*f[147][l]+0.2165063509461096*f[25][l])*alpha_vdim[179][l]+(0.1936491673103708*f[132][l]+0.2165063509461096*f[4][l])*alpha_vdim[178][l]+(0.1936491673103708*f[145][l]+0.2165063509461096*f[23][l])*alpha_vdim[177][l]+(0.1936491673103708*f[86][l]+0.2165063509461096*f[34][l])*alpha_vdim[172][l]+(0.1936491673103708*f[69][l]+0.2165063509461096*f[6][l])*alpha_vdim[171][l]+0.1936491673103708*f[84][l]*alpha_vdim[170][l]+0.2165063509461096*(f[32][l]*alpha_vdim[170][l]+f[37][l]*alpha_vdim[169][l]+f[58][l]*alpha_vdim[168][l]+f[35][l]*alpha_vdim[167][l])+(0.1936491673103708*f[138][l]+0.2165063509461096*f[11][l])*alpha_vdim[166][l]+(0.1936491673103708*f[111][l]+0.2165063509461096*f[20][l])*alpha_cdim[165][l]+0.1936491673103708*f[77][l]*alpha_vdim[164][l]+0.2165063509461096*(f[18][l]*alpha_vdim[164][l]+f[50][l]*alpha_vdim[163][l]+f[20][l]*alpha_vdim[162][l]+f[48][l]*alpha_vdim[161][l]+f[36][l]*alpha_vdim[160][l]+f[41][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[33][l]*f[155][l]+alpha_vdim[19][l]*f[150][l]+alpha_vdim[47][l]*f[149][l]+alpha_vdim[17][l]*f[148][l]+alpha_vdim[34][l]*f[142][l]+alpha_vdim[6][l]*f[141][l]+alpha_vdim[32][l]*f[140][l]+alpha_vdim[18][l]*f[133][l]+alpha_vdim[27][l]*f[123][l]+alpha_vdim[15][l]*f[118][l]+alpha_vdim[43][l]*f[117][l]+alpha_vdim[13][l]*f[116][l]+alpha_vdim[28][l]*f[110][l]+alpha_vdim[5][l]*f[109][l]+alpha_vdim[26][l]*f[108][l]+alpha_vdim[14][l]*f[101][l])+0.2165063509461096*(alpha_vdim[8][l]*f[59][l]+alpha_vdim[3][l]*f[53][l]+alpha_vdim[22][l]*f[52][l]+alpha_vdim[1][l]*f[51][l]+alpha_vdim[27][l]*f[47][l]+f[27][l]*alpha_vdim[47][l]+alpha_vdim[33][l]*f[43][l]+f[33][l]*alpha_vdim[43][l]+alpha_vdim[9][l]*f[40][l]+alpha_vdim[0][l]*f[39][l]+alpha_vdim[7][l]*f[38][l]+alpha_vdim[15][l]*f[34][l]+f[15][l]*alpha_vdim[34][l]+alpha_vdim[13][l]*f[32][l]+f[13][l]*alpha_vdim[32][l]+alpha_vdim[19][l]*f[28][l]+f[19][l]*alpha_vdim[28][l]+alpha_vdim[17][l]*f[26][l]+f[17][l]*alpha_vdim[26][l]+alpha_vdim[2][l]*f[21][l]+alpha_vdim[5][l]*f[18][l]+f[5][l]*alpha_vdim[18][l]+alpha_vdim[6][l]*f[14][l]+f[6][l]*alpha_vdim[14][l]);
+    out[56][l] += (0.1936491673103708*f[113][l]+0.2165063509461096*f[23][l])*alpha_vdim[363][l]+(0.1936491673103708*f[81][l]+0.2165063509461096*f[26][l])*alpha_vdim[362][l]+(0.1936491673103708*f[106][l]+0.2165063509461096*f[11][l])*alpha_vdim[348][l]+(0.1936491673103708*f[105][l]+0.2165063509461096*f[10][l])*alpha_vdim[347][l]+(0.1936491673103708*f[122][l]+0.2165063509461096*f[42][l])*alpha_vdim[346][l]+(0.1936491673103708*f[74][l]+0.2165063509461096*f[14][l])*alpha_vdim[345][l]+(0.1936491673103708*f[73][l]+0.2165063509461096*f[13][l])*alpha_vdim[344][l]+0.1936491673103708*f[90][l]*alpha_vdim[343][l]+0.2165063509461096*(f[43][l]*alpha_vdim[343][l]+f[44][l]*alpha_vdim[342][l])+(0.1936491673103708*f[100][l]+0.2165063509461096*f[4][l])*alpha_vdim[335][l]+(0.1936491673103708*f[115][l]+0.2165063509461096*f[25][l])*alpha_vdim[334][l]+(0.1936491673103708*f[114][l]+0.2165063509461096*f[24][l])*alpha_vdim[333][l]+(0.1936491673103708*f[68][l]+0.2165063509461096*f[5][l])*alpha_vdim[332][l]+(0.1936491673103708*f[83][l]+0.2165063509461096*f[28][l])*alpha_vdim[331][l]+0.1936491673103708*f[82][l]*alpha_vdim[330][l]+0.2165063509461096*(f[27][l]*alpha_vdim[330][l]+f[30][l]*alpha_vdim[329][l]+f[29][l]*alpha_vdim[328][l]+f[57][l]*alpha_vdim[327][l])+(0.1936491673103708*f[143][l]+0.2165063509461096*f[16][l])*alpha_cdim[326][l]+(0.1936491673103708*f[107][l]+0.2165063509461096*f[12][l])*alpha_vdim[325][l]+0.1936491673103708*f[75][l]*alpha_vdim[324][l]+0.2165063509461096*(f[15][l]*alpha_vdim[324][l]+f[16][l]*alpha_vdim[323][l]+f[46][l]*alpha_vdim[322][l]+f[45][l]*alpha_vdim[321][l]+f[31][l]*alpha_vdim[320][l]+f[41][l]*alpha_cdim[320][l])+(0.1936491673103708*f[145][l]+0.2165063509461096*f[23][l])*alpha_vdim[207][l]+(0.1936491673103708*f[84][l]+0.2165063509461096*f[32][l])*alpha_vdim[202][l]+(0.1936491673103708*f[138][l]+0.2165063509461096*f[11][l])*alpha_vdim[194][l]+(0.1936491673103708*f[137][l]+0.2165063509461096*f[10][l])*alpha_vdim[193][l]+(0.1936491673103708*f[154][l]+0.2165063509461096*f[42][l])*alpha_vdim[192][l]+(0.1936491673103708*f[77][l]+0.2165063509461096*f[18][l])*alpha_vdim[185][l]+(0.1936491673103708*f[76][l]+0.2165063509461096*f[17][l])*alpha_vdim[184][l]+0.1936491673103708*f[91][l]*alpha_vdim[183][l]+0.2165063509461096*(f[47][l]*alpha_vdim[183][l]+f[48][l]*alpha_vdim[182][l])+(0.1936491673103708*f[132][l]+0.2165063509461096*f[4][l])*alpha_vdim[179][l]+(0.1936491673103708*f[147][l]+0.2165063509461096*f[25][l])*alpha_vdim[178][l]+(0.1936491673103708*f[146][l]+0.2165063509461096*f[24][l])*alpha_vdim[177][l]+(0.1936491673103708*f[69][l]+0.2165063509461096*f[6][l])*alpha_vdim[172][l]+(0.1936491673103708*f[86][l]+0.2165063509461096*f[34][l])*alpha_vdim[171][l]+0.1936491673103708*f[85][l]*alpha_vdim[170][l]+0.2165063509461096*(f[33][l]*alpha_vdim[170][l]+f[36][l]*alpha_vdim[169][l]+f[35][l]*alpha_vdim[168][l]+f[58][l]*alpha_vdim[167][l])+(0.1936491673103708*f[139][l]+0.2165063509461096*f[12][l])*alpha_vdim[166][l]+0.1936491673103708*f[78][l]*alpha_vdim[164][l]+0.2165063509461096*(f[19][l]*alpha_vdim[164][l]+f[20][l]*alpha_vdim[163][l]+f[50][l]*alpha_vdim[162][l]+f[49][l]*alpha_vdim[161][l]+f[37][l]*alpha_vdim[160][l])+0.1936491673103708*(alpha_vdim[32][l]*f[155][l]+alpha_vdim[18][l]*f[150][l]+alpha_vdim[17][l]*f[149][l]+alpha_vdim[47][l]*f[148][l]+alpha_vdim[6][l]*f[142][l]+alpha_vdim[34][l]*f[141][l]+alpha_vdim[33][l]*f[140][l]+alpha_vdim[19][l]*f[133][l]+alpha_vdim[26][l]*f[123][l]+alpha_vdim[14][l]*f[118][l]+alpha_vdim[13][l]*f[117][l]+alpha_vdim[43][l]*f[116][l]+alpha_vdim[5][l]*f[110][l]+alpha_vdim[28][l]*f[109][l]+alpha_vdim[27][l]*f[108][l]+alpha_vdim[15][l]*f[101][l])+0.2165063509461096*(alpha_vdim[7][l]*f[59][l]+alpha_vdim[2][l]*f[53][l]+alpha_vdim[1][l]*f[52][l]+alpha_vdim[22][l]*f[51][l]+alpha_vdim[26][l]*f[47][l]+f[26][l]*alpha_vdim[47][l]+alpha_vdim[32][l]*f[43][l]+f[32][l]*alpha_vdim[43][l]+alpha_vdim[0][l]*f[40][l]+alpha_vdim[9][l]*f[39][l]+alpha_vdim[8][l]*f[38][l]+alpha_vdim[14][l]*f[34][l]+f[14][l]*alpha_vdim[34][l]+alpha_vdim[13][l]*f[33][l]+f[13][l]*alpha_vdim[33][l]+alpha_vdim[18][l]*f[28][l]+f[18][l]*alpha_vdim[28][l]+alpha_vdim[17][l]*f[27][l]+f[17][l]*alpha_vdim[27][l]+alpha_vdim[3][l]*f[21][l]+alpha_vdim[5][l]*f[19][l]+f[5][l]*alpha_vdim[19][l]+alpha_vdim[6][l]*f[15][l]+f[6][l]*alpha_vdim[15][l]);
+    out[57][l] += 0.2165063509461096*(f[60][l]*alpha_cdim[326][l]+f[44][l]*alpha_cdim[320][l]+f[20][l]*alpha_vdim[207][l])+0.1936491673103708*f[64][l]*alpha_vdim[202][l]+0.2165063509461096*(f[0][l]*alpha_vdim[202][l]+f[35][l]*alpha_vdim[194][l]+f[36][l]*alpha_vdim[193][l]+f[37][l]*alpha_vdim[192][l])+(0.1936491673103708*f[65][l]+0.2165063509461096*f[1][l])*alpha_vdim[185][l]+(0.1936491673103708*f[66][l]+0.2165063509461096*f[2][l])*alpha_vdim[184][l]+0.1936491673103708*f[67][l]*alpha_vdim[183][l]+0.2165063509461096*(f[3][l]*alpha_vdim[183][l]+f[4][l]*alpha_vdim[182][l]+f[48][l]*alpha_vdim[179][l]+f[49][l]*alpha_vdim[178][l]+f[50][l]*alpha_vdim[177][l])+(0.1936491673103708*f[70][l]+0.2165063509461096*f[7][l])*alpha_vdim[172][l]+(0.1936491673103708*f[71][l]+0.2165063509461096*f[8][l])*alpha_vdim[171][l]+0.1936491673103708*f[72][l]*alpha_vdim[170][l]+0.2165063509461096*(f[9][l]*alpha_vdim[170][l]+f[10][l]*alpha_vdim[169][l]+f[11][l]*alpha_vdim[168][l]+f[12][l]*alpha_vdim[167][l]+f[58][l]*alpha_vdim[166][l])+(0.1936491673103708*f[114][l]+0.2165063509461096*f[24][l])*alpha_cdim[165][l]+0.1936491673103708*f[80][l]*alpha_vdim[164][l]+0.2165063509461096*(f[22][l]*alpha_vdim[164][l]+f[23][l]*alpha_vdim[163][l]+f[24][l]*alpha_vdim[162][l]+f[25][l]*alpha_vdim[161][l]+f[42][l]*alpha_vdim[160][l]+f[45][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[5][l]*f[112][l]+alpha_vdim[13][l]*f[104][l]+alpha_vdim[14][l]*f[103][l]+alpha_vdim[15][l]*f[102][l]+alpha_vdim[26][l]*f[99][l]+alpha_vdim[27][l]*f[98][l]+alpha_vdim[28][l]*f[97][l]+alpha_vdim[43][l]*f[96][l]+alpha_cdim[4][l]*f[83][l])+0.2165063509461096*(alpha_vdim[6][l]*f[59][l]+alpha_vdim[17][l]*f[53][l]+alpha_vdim[18][l]*f[52][l]+alpha_vdim[19][l]*f[51][l]+f[21][l]*alpha_vdim[47][l]+alpha_cdim[0][l]*f[46][l]+alpha_vdim[0][l]*f[43][l]+f[0][l]*alpha_vdim[43][l]+alpha_vdim[32][l]*f[40][l]+alpha_vdim[33][l]*f[39][l]+alpha_vdim[34][l]*f[38][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[28][l]+f[1][l]*alpha_vdim[28][l]+alpha_vdim[2][l]*f[27][l]+f[2][l]*alpha_vdim[27][l]+alpha_vdim[3][l]*f[26][l]+f[3][l]*alpha_vdim[26][l]+alpha_vdim[5][l]*f[22][l]+f[5][l]*alpha_vdim[22][l]+alpha_vdim[7][l]*f[15][l]+f[7][l]*alpha_vdim[15][l]+alpha_vdim[8][l]*f[14][l]+f[8][l]*alpha_vdim[14][l]+alpha_vdim[9][l]*f[13][l]+f[9][l]*alpha_vdim[13][l]);
+    out[58][l] += 0.2165063509461096*f[16][l]*alpha_vdim[363][l]+0.1936491673103708*f[64][l]*alpha_vdim[362][l]+0.2165063509461096*(f[0][l]*alpha_vdim[362][l]+f[29][l]*alpha_vdim[348][l]+f[30][l]*alpha_vdim[347][l]+f[31][l]*alpha_vdim[346][l])+(0.1936491673103708*f[65][l]+0.2165063509461096*f[1][l])*alpha_vdim[345][l]+(0.1936491673103708*f[66][l]+0.2165063509461096*f[2][l])*alpha_vdim[344][l]+0.1936491673103708*f[67][l]*alpha_vdim[343][l]+0.2165063509461096*(f[3][l]*alpha_vdim[343][l]+f[4][l]*alpha_vdim[342][l]+f[44][l]*alpha_vdim[335][l]+f[45][l]*alpha_vdim[334][l]+f[46][l]*alpha_vdim[333][l])+(0.1936491673103708*f[70][l]+0.2165063509461096*f[7][l])*alpha_vdim[332][l]+(0.1936491673103708*f[71][l]+0.2165063509461096*f[8][l])*alpha_vdim[331][l]+0.1936491673103708*f[72][l]*alpha_vdim[330][l]+0.2165063509461096*(f[9][l]*alpha_vdim[330][l]+f[10][l]*alpha_vdim[329][l]+f[11][l]*alpha_vdim[328][l]+f[12][l]*alpha_vdim[327][l])+0.1936491673103708*f[145][l]*alpha_cdim[326][l]+0.2165063509461096*(f[23][l]*alpha_cdim[326][l]+f[57][l]*alpha_vdim[325][l])+0.1936491673103708*f[80][l]*alpha_vdim[324][l]+0.2165063509461096*(f[22][l]*alpha_vdim[324][l]+f[23][l]*alpha_vdim[323][l]+f[24][l]*alpha_vdim[322][l]+f[25][l]*alpha_vdim[321][l]+f[42][l]*alpha_vdim[320][l]+f[48][l]*alpha_cdim[320][l]+f[61][l]*alpha_cdim[165][l]+f[49][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[6][l]*f[144][l]+alpha_vdim[17][l]*f[136][l]+alpha_vdim[18][l]*f[135][l]+alpha_vdim[19][l]*f[134][l]+alpha_vdim[32][l]*f[131][l]+alpha_vdim[33][l]*f[130][l]+alpha_vdim[34][l]*f[129][l]+alpha_vdim[47][l]*f[128][l]+alpha_cdim[4][l]*f[86][l])+0.2165063509461096*(alpha_vdim[5][l]*f[59][l]+alpha_vdim[13][l]*f[53][l]+alpha_vdim[14][l]*f[52][l]+alpha_vdim[15][l]*f[51][l]+alpha_cdim[0][l]*f[50][l]+alpha_vdim[0][l]*f[47][l]+f[0][l]*alpha_vdim[47][l]+f[21][l]*alpha_vdim[43][l]+alpha_vdim[26][l]*f[40][l]+alpha_vdim[27][l]*f[39][l]+alpha_vdim[28][l]*f[38][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[34][l]+f[1][l]*alpha_vdim[34][l]+alpha_vdim[2][l]*f[33][l]+f[2][l]*alpha_vdim[33][l]+alpha_vdim[3][l]*f[32][l]+f[3][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[22][l]+f[6][l]*alpha_vdim[22][l]+alpha_vdim[7][l]*f[19][l]+f[7][l]*alpha_vdim[19][l]+alpha_vdim[8][l]*f[18][l]+f[8][l]*alpha_vdim[18][l]+alpha_vdim[9][l]*f[17][l]+f[9][l]*alpha_vdim[17][l]);
+    out[59][l] += 0.1936491673103708*f[96][l]*alpha_vdim[363][l]+0.2165063509461096*(f[0][l]*alpha_vdim[363][l]+f[16][l]*alpha_vdim[362][l])+(0.1936491673103708*f[97][l]+0.2165063509461096*f[1][l])*alpha_vdim[348][l]+(0.1936491673103708*f[98][l]+0.2165063509461096*f[2][l])*alpha_vdim[347][l]+0.1936491673103708*f[99][l]*alpha_vdim[346][l]+0.2165063509461096*(f[3][l]*alpha_vdim[346][l]+f[29][l]*alpha_vdim[345][l]+f[30][l]*alpha_vdim[344][l]+f[31][l]*alpha_vdim[343][l]+f[5][l]*alpha_vdim[342][l])+(0.1936491673103708*f[102][l]+0.2165063509461096*f[7][l])*alpha_vdim[335][l]+(0.1936491673103708*f[103][l]+0.2165063509461096*f[8][l])*alpha_vdim[334][l]+0.1936491673103708*f[104][l]*alpha_vdim[333][l]+0.2165063509461096*(f[9][l]*alpha_vdim[333][l]+f[44][l]*alpha_vdim[332][l]+f[45][l]*alpha_vdim[331][l]+f[46][l]*alpha_vdim[330][l]+f[13][l]*alpha_vdim[329][l]+f[14][l]*alpha_vdim[328][l]+f[15][l]*alpha_vdim[327][l])+(0.1936491673103708*f[148][l]+0.2165063509461096*f[26][l])*alpha_cdim[326][l]+0.1936491673103708*f[112][l]*alpha_vdim[325][l]+0.2165063509461096*(f[22][l]*alpha_vdim[325][l]+f[57][l]*alpha_vdim[324][l]+f[26][l]*alpha_vdim[323][l]+f[27][l]*alpha_vdim[322][l]+f[28][l]*alpha_vdim[321][l]+f[43][l]*alpha_vdim[320][l]+f[51][l]*alpha_cdim[320][l])+0.1936491673103708*f[128][l]*alpha_vdim[207][l]+0.2165063509461096*(f[0][l]*alpha_vdim[207][l]+f[20][l]*alpha_vdim[202][l])+(0.1936491673103708*f[129][l]+0.2165063509461096*f[1][l])*alpha_vdim[194][l]+(0.1936491673103708*f[130][l]+0.2165063509461096*f[2][l])*alpha_vdim[193][l]+0.1936491673103708*f[131][l]*alpha_vdim[192][l]+0.2165063509461096*(f[3][l]*alpha_vdim[192][l]+f[35][l]*alpha_vdim[185][l]+f[36][l]*alpha_vdim[184][l]+f[37][l]*alpha_vdim[183][l]+f[6][l]*alpha_vdim[182][l])+(0.1936491673103708*f[134][l]+0.2165063509461096*f[7][l])*alpha_vdim[179][l]+(0.1936491673103708*f[135][l]+0.2165063509461096*f[8][l])*alpha_vdim[178][l]+0.1936491673103708*f[136][l]*alpha_vdim[177][l]+0.2165063509461096*(f[9][l]*alpha_vdim[177][l]+f[48][l]*alpha_vdim[172][l]+f[49][l]*alpha_vdim[171][l]+f[50][l]*alpha_vdim[170][l]+f[17][l]*alpha_vdim[169][l]+f[18][l]*alpha_vdim[168][l]+f[19][l]*alpha_vdim[167][l])+(0.1936491673103708*f[144][l]+0.2165063509461096*f[22][l])*alpha_vdim[166][l]+0.1936491673103708*f[117][l]*alpha_cdim[165][l]+0.2165063509461096*(f[33][l]*alpha_cdim[165][l]+f[58][l]*alpha_vdim[164][l]+f[32][l]*alpha_vdim[163][l]+f[33][l]*alpha_vdim[162][l]+f[34][l]*alpha_vdim[161][l]+f[47][l]*alpha_vdim[160][l]+f[52][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[62][l]+alpha_cdim[0][l]*f[53][l]);
+    out[60][l] += (0.1936491673103708*f[107][l]+0.2165063509461096*f[12][l])*alpha_vdim[363][l]+(0.1936491673103708*f[75][l]+0.2165063509461096*f[15][l])*alpha_vdim[362][l]+(0.1936491673103708*f[114][l]+0.2165063509461096*f[24][l])*alpha_vdim[348][l]+(0.1936491673103708*f[115][l]+0.2165063509461096*f[25][l])*alpha_vdim[347][l]+(0.1936491673103708*f[100][l]+0.2165063509461096*f[4][l])*alpha_vdim[346][l]+(0.1936491673103708*f[82][l]+0.2165063509461096*f[27][l])*alpha_vdim[345][l]+(0.1936491673103708*f[83][l]+0.2165063509461096*f[28][l])*alpha_vdim[344][l]+0.1936491673103708*f[68][l]*alpha_vdim[343][l]+0.2165063509461096*(f[5][l]*alpha_vdim[343][l]+f[31][l]*alpha_vdim[342][l])+(0.1936491673103708*f[122][l]+0.2165063509461096*f[42][l])*alpha_vdim[335][l]+(0.1936491673103708*f[105][l]+0.2165063509461096*f[10][l])*alpha_vdim[334][l]+(0.1936491673103708*f[106][l]+0.2165063509461096*f[11][l])*alpha_vdim[333][l]+(0.1936491673103708*f[90][l]+0.2165063509461096*f[43][l])*alpha_vdim[332][l]+(0.1936491673103708*f[73][l]+0.2165063509461096*f[13][l])*alpha_vdim[331][l]+0.1936491673103708*f[74][l]*alpha_vdim[330][l]+0.2165063509461096*(f[14][l]*alpha_vdim[330][l]+f[45][l]*alpha_vdim[329][l]+f[46][l]*alpha_vdim[328][l]+f[16][l]*alpha_vdim[327][l])+(0.1936491673103708*f[113][l]+0.2165063509461096*f[23][l])*alpha_vdim[325][l]+0.1936491673103708*f[81][l]*alpha_vdim[324][l]+0.2165063509461096*(f[26][l]*alpha_vdim[324][l]+f[57][l]*alpha_vdim[323][l]+f[29][l]*alpha_vdim[322][l]+f[30][l]*alpha_vdim[321][l]+f[44][l]*alpha_vdim[320][l])+(0.1936491673103708*f[139][l]+0.2165063509461096*f[12][l])*alpha_vdim[207][l]+(0.1936491673103708*f[78][l]+0.2165063509461096*f[19][l])*alpha_vdim[202][l]+(0.1936491673103708*f[146][l]+0.2165063509461096*f[24][l])*alpha_vdim[194][l]+(0.1936491673103708*f[147][l]+0.2165063509461096*f[25][l])*alpha_vdim[193][l]+(0.1936491673103708*f[132][l]+0.2165063509461096*f[4][l])*alpha_vdim[192][l]+(0.1936491673103708*f[85][l]+0.2165063509461096*f[33][l])*alpha_vdim[185][l]+(0.1936491673103708*f[86][l]+0.2165063509461096*f[34][l])*alpha_vdim[184][l]+0.1936491673103708*f[69][l]*alpha_vdim[183][l]+0.2165063509461096*(f[6][l]*alpha_vdim[183][l]+f[37][l]*alpha_vdim[182][l])+(0.1936491673103708*f[154][l]+0.2165063509461096*f[42][l])*alpha_vdim[179][l]+(0.1936491673103708*f[137][l]+0.2165063509461096*f[10][l])*alpha_vdim[178][l]+(0.1936491673103708*f[138][l]+0.2165063509461096*f[11][l])*alpha_vdim[177][l]+(0.1936491673103708*f[91][l]+0.2165063509461096*f[47][l])*alpha_vdim[172][l]+(0.1936491673103708*f[76][l]+0.2165063509461096*f[17][l])*alpha_vdim[171][l]+0.1936491673103708*f[77][l]*alpha_vdim[170][l]+0.2165063509461096*(f[18][l]*alpha_vdim[170][l]+f[49][l]*alpha_vdim[169][l]+f[50][l]*alpha_vdim[168][l]+f[20][l]*alpha_vdim[167][l])+(0.1936491673103708*f[145][l]+0.2165063509461096*f[23][l])*alpha_vdim[166][l]+(0.1936491673103708*f[119][l]+0.2165063509461096*f[35][l])*alpha_cdim[165][l]+0.1936491673103708*f[84][l]*alpha_vdim[164][l]+0.2165063509461096*(f[32][l]*alpha_vdim[164][l]+f[58][l]*alpha_vdim[163][l]+f[35][l]*alpha_vdim[162][l]+f[36][l]*alpha_vdim[161][l]+f[48][l]*alpha_vdim[160][l]+f[54][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[19][l]*f[155][l]+alpha_vdim[33][l]*f[150][l]+alpha_vdim[34][l]*f[149][l]+alpha_vdim[6][l]*f[148][l]+alpha_vdim[47][l]*f[142][l]+alpha_vdim[17][l]*f[141][l]+alpha_vdim[18][l]*f[140][l]+alpha_vdim[32][l]*f[133][l]+alpha_vdim[15][l]*f[123][l]+alpha_vdim[27][l]*f[118][l]+alpha_vdim[28][l]*f[117][l]+alpha_vdim[5][l]*f[116][l]+alpha_vdim[43][l]*f[110][l]+alpha_vdim[13][l]*f[109][l]+alpha_vdim[14][l]*f[108][l]+alpha_vdim[26][l]*f[101][l]+alpha_cdim[4][l]*f[88][l])+0.2165063509461096*(alpha_vdim[3][l]*f[59][l]+alpha_cdim[0][l]*f[55][l]+alpha_vdim[8][l]*f[53][l]+alpha_vdim[9][l]*f[52][l]+alpha_vdim[0][l]*f[51][l]+alpha_vdim[15][l]*f[47][l]+f[15][l]*alpha_vdim[47][l]+alpha_vdim[19][l]*f[43][l]+f[19][l]*alpha_vdim[43][l]+alpha_vdim[22][l]*f[40][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[39][l]+alpha_vdim[2][l]*f[38][l]+alpha_vdim[27][l]*f[34][l]+f[27][l]*alpha_vdim[34][l]+alpha_vdim[28][l]*f[33][l]+f[28][l]*alpha_vdim[33][l]+alpha_vdim[5][l]*f[32][l]+f[5][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[26][l]+f[6][l]*alpha_vdim[26][l]+alpha_vdim[7][l]*f[21][l]+alpha_vdim[13][l]*f[18][l]+f[13][l]*alpha_vdim[18][l]+alpha_vdim[14][l]*f[17][l]+f[14][l]*alpha_vdim[17][l]);
+    out[61][l] += (0.1936491673103708*f[106][l]+0.2165063509461096*f[11][l])*alpha_vdim[363][l]+(0.1936491673103708*f[74][l]+0.2165063509461096*f[14][l])*alpha_vdim[362][l]+(0.1936491673103708*f[113][l]+0.2165063509461096*f[23][l])*alpha_vdim[348][l]+(0.1936491673103708*f[100][l]+0.2165063509461096*f[4][l])*alpha_vdim[347][l]+(0.1936491673103708*f[115][l]+0.2165063509461096*f[25][l])*alpha_vdim[346][l]+(0.1936491673103708*f[81][l]+0.2165063509461096*f[26][l])*alpha_vdim[345][l]+(0.1936491673103708*f[68][l]+0.2165063509461096*f[5][l])*alpha_vdim[344][l]+0.1936491673103708*f[83][l]*alpha_vdim[343][l]+0.2165063509461096*(f[28][l]*alpha_vdim[343][l]+f[30][l]*alpha_vdim[342][l])+(0.1936491673103708*f[105][l]+0.2165063509461096*f[10][l])*alpha_vdim[335][l]+(0.1936491673103708*f[122][l]+0.2165063509461096*f[42][l])*alpha_vdim[334][l]+(0.1936491673103708*f[107][l]+0.2165063509461096*f[12][l])*alpha_vdim[333][l]+(0.1936491673103708*f[73][l]+0.2165063509461096*f[13][l])*alpha_vdim[332][l]+(0.1936491673103708*f[90][l]+0.2165063509461096*f[43][l])*alpha_vdim[331][l]+0.1936491673103708*f[75][l]*alpha_vdim[330][l]+0.2165063509461096*(f[15][l]*alpha_vdim[330][l]+f[44][l]*alpha_vdim[329][l]+f[16][l]*alpha_vdim[328][l]+f[46][l]*alpha_vdim[327][l])+(0.1936491673103708*f[151][l]+0.2165063509461096*f[29][l])*alpha_cdim[326][l]+(0.1936491673103708*f[114][l]+0.2165063509461096*f[24][l])*alpha_vdim[325][l]+0.1936491673103708*f[82][l]*alpha_vdim[324][l]+0.2165063509461096*(f[27][l]*alpha_vdim[324][l]+f[29][l]*alpha_vdim[323][l]+f[57][l]*alpha_vdim[322][l]+f[31][l]*alpha_vdim[321][l]+f[45][l]*alpha_vdim[320][l]+f[54][l]*alpha_cdim[320][l])+(0.1936491673103708*f[138][l]+0.2165063509461096*f[11][l])*alpha_vdim[207][l]+(0.1936491673103708*f[77][l]+0.2165063509461096*f[18][l])*alpha_vdim[202][l]+(0.1936491673103708*f[145][l]+0.2165063509461096*f[23][l])*alpha_vdim[194][l]+(0.1936491673103708*f[132][l]+0.2165063509461096*f[4][l])*alpha_vdim[193][l]+(0.1936491673103708*f[147][l]+0.2165063509461096*f[25][l])*alpha_vdim[192][l]+(0.1936491673103708*f[84][l]+0.2165063509461096*f[32][l])*alpha_vdim[185][l]+(0.1936491673103708*f[69][l]+0.2165063509461096*f[6][l])*alpha_vdim[184][l]+0.1936491673103708*f[86][l]*alpha_vdim[183][l]+0.2165063509461096*(f[34][l]*alpha_vdim[183][l]+f[36][l]*alpha_vdim[182][l])+(0.1936491673103708*f[137][l]+0.2165063509461096*f[10][l])*alpha_vdim[179][l]+(0.1936491673103708*f[154][l]+0.2165063509461096*f[42][l])*alpha_vdim[178][l]+(0.1936491673103708*f[139][l]+0.2165063509461096*f[12][l])*alpha_vdim[177][l]+(0.1936491673103708*f[76][l]+0.2165063509461096*f[17][l])*alpha_vdim[172][l]+(0.1936491673103708*f[91][l]+0.2165063509461096*f[47][l])*alpha_vdim[171][l]+0.1936491673103708*f[78][l]*alpha_vdim[170][l]+0.2165063509461096*(f[19][l]*alpha_vdim[170][l]+f[48][l]*alpha_vdim[169][l]+f[20][l]*alpha_vdim[168][l]+f[50][l]*alpha_vdim[167][l])+(0.1936491673103708*f[146][l]+0.2165063509461096*f[24][l])*alpha_vdim[166][l]+0.1936491673103708*f[85][l]*alpha_vdim[164][l]+0.2165063509461096*(f[33][l]*alpha_vdim[164][l]+f[35][l]*alpha_vdim[163][l]+f[58][l]*alpha_vdim[162][l]+f[37][l]*alpha_vdim[161][l]+f[49][l]*alpha_vdim[160][l])+0.1936491673103708*(alpha_vdim[18][l]*f[155][l]+alpha_vdim[32][l]*f[150][l]+alpha_vdim[6][l]*f[149][l]+alpha_vdim[34][l]*f[148][l]+alpha_vdim[17][l]*f[142][l]+alpha_vdim[47][l]*f[141][l]+alpha_vdim[19][l]*f[140][l]+alpha_vdim[33][l]*f[133][l]+alpha_vdim[14][l]*f[123][l]+alpha_vdim[26][l]*f[118][l]+alpha_vdim[5][l]*f[117][l]+alpha_vdim[28][l]*f[116][l]+alpha_vdim[13][l]*f[110][l]+alpha_vdim[43][l]*f[109][l]+alpha_vdim[15][l]*f[108][l]+alpha_vdim[27][l]*f[101][l]+alpha_cdim[4][l]*f[89][l])+0.2165063509461096*(alpha_vdim[2][l]*f[59][l]+alpha_cdim[0][l]*f[56][l]+alpha_vdim[7][l]*f[53][l]+alpha_vdim[0][l]*f[52][l]+alpha_vdim[9][l]*f[51][l]+alpha_vdim[14][l]*f[47][l]+f[14][l]*alpha_vdim[47][l]+alpha_vdim[18][l]*f[43][l]+f[18][l]*alpha_vdim[43][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[40][l]+alpha_vdim[22][l]*f[39][l]+alpha_vdim[3][l]*f[38][l]+alpha_vdim[26][l]*f[34][l]+f[26][l]*alpha_vdim[34][l]+alpha_vdim[5][l]*f[33][l]+f[5][l]*alpha_vdim[33][l]+alpha_vdim[28][l]*f[32][l]+f[28][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[27][l]+f[6][l]*alpha_vdim[27][l]+alpha_vdim[8][l]*f[21][l]+alpha_vdim[13][l]*f[19][l]+f[13][l]*alpha_vdim[19][l]+alpha_vdim[15][l]*f[17][l]+f[15][l]*alpha_vdim[17][l]);
+    out[62][l] += (0.1936491673103708*f[105][l]+0.2165063509461096*f[10][l])*alpha_vdim[363][l]+(0.1936491673103708*f[73][l]+0.2165063509461096*f[13][l])*alpha_vdim[362][l]+(0.1936491673103708*f[100][l]+0.2165063509461096*f[4][l])*alpha_vdim[348][l]+(0.1936491673103708*f[113][l]+0.2165063509461096*f[23][l])*alpha_vdim[347][l]+(0.1936491673103708*f[114][l]+0.2165063509461096*f[24][l])*alpha_vdim[346][l]+(0.1936491673103708*f[68][l]+0.2165063509461096*f[5][l])*alpha_vdim[345][l]+(0.1936491673103708*f[81][l]+0.2165063509461096*f[26][l])*alpha_vdim[344][l]+0.1936491673103708*f[82][l]*alpha_vdim[343][l]+0.2165063509461096*(f[27][l]*alpha_vdim[343][l]+f[29][l]*alpha_vdim[342][l])+(0.1936491673103708*f[106][l]+0.2165063509461096*f[11][l])*alpha_vdim[335][l]+(0.1936491673103708*f[107][l]+0.2165063509461096*f[12][l])*alpha_vdim[334][l]+(0.1936491673103708*f[122][l]+0.2165063509461096*f[42][l])*alpha_vdim[333][l]+(0.1936491673103708*f[74][l]+0.2165063509461096*f[14][l])*alpha_vdim[332][l]+(0.1936491673103708*f[75][l]+0.2165063509461096*f[15][l])*alpha_vdim[331][l]+0.1936491673103708*f[90][l]*alpha_vdim[330][l]+0.2165063509461096*(f[43][l]*alpha_vdim[330][l]+f[16][l]*alpha_vdim[329][l]+f[44][l]*alpha_vdim[328][l]+f[45][l]*alpha_vdim[327][l])+(0.1936491673103708*f[152][l]+0.2165063509461096*f[30][l])*alpha_cdim[326][l]+(0.1936491673103708*f[115][l]+0.2165063509461096*f[25][l])*alpha_vdim[325][l]+0.1936491673103708*f[83][l]*alpha_vdim[324][l]+0.2165063509461096*(f[28][l]*alpha_vdim[324][l]+f[30][l]*alpha_vdim[323][l]+f[31][l]*alpha_vdim[322][l]+f[57][l]*alpha_vdim[321][l]+f[46][l]*alpha_vdim[320][l]+f[55][l]*alpha_cdim[320][l])+(0.1936491673103708*f[137][l]+0.2165063509461096*f[10][l])*alpha_vdim[207][l]+(0.1936491673103708*f[76][l]+0.2165063509461096*f[17][l])*alpha_vdim[202][l]+(0.1936491673103708*f[132][l]+0.2165063509461096*f[4][l])*alpha_vdim[194][l]+(0.1936491673103708*f[145][l]+0.2165063509461096*f[23][l])*alpha_vdim[193][l]+(0.1936491673103708*f[146][l]+0.2165063509461096*f[24][l])*alpha_vdim[192][l]+(0.1936491673103708*f[69][l]+0.2165063509461096*f[6][l])*alpha_vdim[185][l]+(0.1936491673103708*f[84][l]+0.2165063509461096*f[32][l])*alpha_vdim[184][l]+0.1936491673103708*f[85][l]*alpha_vdim[183][l]+0.2165063509461096*(f[33][l]*alpha_vdim[183][l]+f[35][l]*alpha_vdim[182][l])+(0.1936491673103708*f[138][l]+0.2165063509461096*f[11][l])*alpha_vdim[179][l]+(0.1936491673103708*f[139][l]+0.2165063509461096*f[12][l])*alpha_vdim[178][l]+(0.1936491673103708*f[154][l]+0.2165063509461096*f[42][l])*alpha_vdim[177][l]+(0.1936491673103708*f[77][l]+0.2165063509461096*f[18][l])*alpha_vdim[172][l]+(0.1936491673103708*f[78][l]+0.2165063509461096*f[19][l])*alpha_vdim[171][l]+0.1936491673103708*f[91][l]*alpha_vdim[170][l]+0.2165063509461096*(f[47][l]*alpha_vdim[170][l]+f[20][l]*alpha_vdim[169][l]+f[48][l]*alpha_vdim[168][l]+f[49][l]*alpha_vdim[167][l])+(0.1936491673103708*f[147][l]+0.2165063509461096*f[25][l])*alpha_vdim[166][l]+(0.1936491673103708*f[121][l]+0.2165063509461096*f[37][l])*alpha_cdim[165][l]+0.1936491673103708*f[86][l]*alpha_vdim[164][l]+0.2165063509461096*(f[34][l]*alpha_vdim[164][l]+f[36][l]*alpha_vdim[163][l]+f[37][l]*alpha_vdim[162][l]+f[58][l]*alpha_vdim[161][l]+f[50][l]*alpha_vdim[160][l]+f[56][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[17][l]*f[155][l]+alpha_vdim[6][l]*f[150][l]+alpha_vdim[32][l]*f[149][l]+alpha_vdim[33][l]*f[148][l]+alpha_vdim[18][l]*f[142][l]+alpha_vdim[19][l]*f[141][l]+alpha_vdim[47][l]*f[140][l]+alpha_vdim[34][l]*f[133][l]+alpha_vdim[13][l]*f[123][l]+alpha_vdim[5][l]*f[118][l]+alpha_vdim[26][l]*f[117][l]+alpha_vdim[27][l]*f[116][l]+alpha_vdim[14][l]*f[110][l]+alpha_vdim[15][l]*f[109][l]+alpha_vdim[43][l]*f[108][l]+alpha_vdim[28][l]*f[101][l])+0.2165063509461096*(alpha_vdim[1][l]*f[59][l]+alpha_vdim[0][l]*f[53][l]+alpha_vdim[7][l]*f[52][l]+alpha_vdim[8][l]*f[51][l]+alpha_vdim[13][l]*f[47][l]+f[13][l]*alpha_vdim[47][l]+alpha_vdim[17][l]*f[43][l]+f[17][l]*alpha_vdim[43][l]+alpha_vdim[2][l]*f[40][l]+alpha_vdim[3][l]*f[39][l]+alpha_vdim[22][l]*f[38][l]+alpha_vdim[5][l]*f[34][l]+f[5][l]*alpha_vdim[34][l]+alpha_vdim[26][l]*f[33][l]+f[26][l]*alpha_vdim[33][l]+alpha_vdim[27][l]*f[32][l]+f[27][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[28][l]+f[6][l]*alpha_vdim[28][l]+alpha_vdim[9][l]*f[21][l]+alpha_vdim[14][l]*f[19][l]+f[14][l]*alpha_vdim[19][l]+alpha_vdim[15][l]*f[18][l]+f[15][l]*alpha_vdim[18][l]);
+    out[63][l] += (0.1936491673103708*f[100][l]+0.2165063509461096*f[4][l])*alpha_vdim[363][l]+(0.1936491673103708*f[68][l]+0.2165063509461096*f[5][l])*alpha_vdim[362][l]+(0.1936491673103708*f[105][l]+0.2165063509461096*f[10][l])*alpha_vdim[348][l]+(0.1936491673103708*f[106][l]+0.2165063509461096*f[11][l])*alpha_vdim[347][l]+(0.1936491673103708*f[107][l]+0.2165063509461096*f[12][l])*alpha_vdim[346][l]+(0.1936491673103708*f[73][l]+0.2165063509461096*f[13][l])*alpha_vdim[345][l]+(0.1936491673103708*f[74][l]+0.2165063509461096*f[14][l])*alpha_vdim[344][l]+0.1936491673103708*f[75][l]*alpha_vdim[343][l]+0.2165063509461096*(f[15][l]*alpha_vdim[343][l]+f[16][l]*alpha_vdim[342][l])+(0.1936491673103708*f[113][l]+0.2165063509461096*f[23][l])*alpha_vdim[335][l]+(0.1936491673103708*f[114][l]+0.2165063509461096*f[24][l])*alpha_vdim[334][l]+(0.1936491673103708*f[115][l]+0.2165063509461096*f[25][l])*alpha_vdim[333][l]+(0.1936491673103708*f[81][l]+0.2165063509461096*f[26][l])*alpha_vdim[332][l]+(0.1936491673103708*f[82][l]+0.2165063509461096*f[27][l])*alpha_vdim[331][l]+0.1936491673103708*f[83][l]*alpha_vdim[330][l]+0.2165063509461096*(f[28][l]*alpha_vdim[330][l]+f[29][l]*alpha_vdim[329][l]+f[30][l]*alpha_vdim[328][l]+f[31][l]*alpha_vdim[327][l])+(0.1936491673103708*f[156][l]+0.2165063509461096*f[44][l])*alpha_cdim[326][l]+(0.1936491673103708*f[122][l]+0.2165063509461096*f[42][l])*alpha_vdim[325][l]+0.1936491673103708*f[90][l]*alpha_vdim[324][l]+0.2165063509461096*(f[43][l]*alpha_vdim[324][l]+f[44][l]*alpha_vdim[323][l]+f[45][l]*alpha_vdim[322][l]+f[46][l]*alpha_vdim[321][l]+f[57][l]*alpha_vdim[320][l]+f[60][l]*alpha_cdim[320][l])+(0.1936491673103708*f[132][l]+0.2165063509461096*f[4][l])*alpha_vdim[207][l]+(0.1936491673103708*f[69][l]+0.2165063509461096*f[6][l])*alpha_vdim[202][l]+(0.1936491673103708*f[137][l]+0.2165063509461096*f[10][l])*alpha_vdim[194][l]+(0.1936491673103708*f[138][l]+0.2165063509461096*f[11][l])*alpha_vdim[193][l]+(0.1936491673103708*f[139][l]+0.2165063509461096*f[12][l])*alpha_vdim[192][l]+(0.1936491673103708*f[76][l]+0.2165063509461096*f[17][l])*alpha_vdim[185][l]+(0.1936491673103708*f[77][l]+0.2165063509461096*f[18][l])*alpha_vdim[184][l]+0.1936491673103708*f[78][l]*alpha_vdim[183][l]+0.2165063509461096*(f[19][l]*alpha_vdim[183][l]+f[20][l]*alpha_vdim[182][l])+(0.1936491673103708*f[145][l]+0.2165063509461096*f[23][l])*alpha_vdim[179][l]+(0.1936491673103708*f[146][l]+0.2165063509461096*f[24][l])*alpha_vdim[178][l]+(0.1936491673103708*f[147][l]+0.2165063509461096*f[25][l])*alpha_vdim[177][l]+(0.1936491673103708*f[84][l]+0.2165063509461096*f[32][l])*alpha_vdim[172][l]+(0.1936491673103708*f[85][l]+0.2165063509461096*f[33][l])*alpha_vdim[171][l]+0.1936491673103708*f[86][l]*alpha_vdim[170][l]+0.2165063509461096*(f[34][l]*alpha_vdim[170][l]+f[35][l]*alpha_vdim[169][l]+f[36][l]*alpha_vdim[168][l]+f[37][l]*alpha_vdim[167][l])+(0.1936491673103708*f[154][l]+0.2165063509461096*f[42][l])*alpha_vdim[166][l]+(0.1936491673103708*f[125][l]+0.2165063509461096*f[49][l])*alpha_cdim[165][l]+0.1936491673103708*f[91][l]*alpha_vdim[164][l]+0.2165063509461096*(f[47][l]*alpha_vdim[164][l]+f[48][l]*alpha_vdim[163][l]+f[49][l]*alpha_vdim[162][l]+f[50][l]*alpha_vdim[161][l]+f[58][l]*alpha_vdim[160][l]+f[61][l]*alpha_cdim[160][l])+0.1936491673103708*(alpha_vdim[6][l]*f[155][l]+alpha_vdim[17][l]*f[150][l]+alpha_vdim[18][l]*f[149][l]+alpha_vdim[19][l]*f[148][l]+alpha_vdim[32][l]*f[142][l]+alpha_vdim[33][l]*f[141][l]+alpha_vdim[34][l]*f[140][l]+alpha_vdim[47][l]*f[133][l]+alpha_vdim[5][l]*f[123][l]+alpha_vdim[13][l]*f[118][l]+alpha_vdim[14][l]*f[117][l]+alpha_vdim[15][l]*f[116][l]+alpha_vdim[26][l]*f[110][l]+alpha_vdim[27][l]*f[109][l]+alpha_vdim[28][l]*f[108][l]+alpha_vdim[43][l]*f[101][l]+alpha_cdim[4][l]*f[94][l])+0.2165063509461096*(alpha_cdim[0][l]*f[62][l]+alpha_vdim[0][l]*f[59][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[53][l]+alpha_vdim[2][l]*f[52][l]+alpha_vdim[3][l]*f[51][l]+alpha_vdim[5][l]*f[47][l]+f[5][l]*alpha_vdim[47][l]+alpha_vdim[6][l]*f[43][l]+f[6][l]*alpha_vdim[43][l]+alpha_vdim[7][l]*f[40][l]+alpha_vdim[8][l]*f[39][l]+alpha_vdim[9][l]*f[38][l]+alpha_vdim[13][l]*f[34][l]+f[13][l]*alpha_vdim[34][l]+alpha_vdim[14][l]*f[33][l]+f[14][l]*alpha_vdim[33][l]+alpha_vdim[15][l]*f[32][l]+f[15][l]*alpha_vdim[32][l]+alpha_vdim[17][l]*f[28][l]+f[17][l]*alpha_vdim[28][l]+alpha_vdim[18][l]*f[27][l]+f[18][l]*alpha_vdim[27][l]+alpha_vdim[19][l]*f[26][l]+f[19][l]*alpha_vdim[26][l]+f[21][l]*alpha_vdim[22][l]);
+    out[64][l] += 0.4841229182759271*(alpha_vdim[47][l]*f[58][l]+alpha_vdim[43][l]*f[57][l]+alpha_vdim[34][l]*f[50][l]+alpha_vdim[33][l]*f[49][l]+alpha_vdim[32][l]*f[48][l]+alpha_vdim[28][l]*f[46][l]+alpha_vdim[27][l]*f[45][l]+alpha_vdim[26][l]*f[44][l]+alpha_vdim[22][l]*f[42][l]+alpha_vdim[19][l]*f[37][l]+alpha_vdim[18][l]*f[36][l]+alpha_vdim[17][l]*f[35][l]+alpha_vdim[15][l]*f[31][l]+alpha_vdim[14][l]*f[30][l]+alpha_vdim[13][l]*f[29][l]+alpha_vdim[9][l]*f[25][l]+alpha_vdim[8][l]*f[24][l]+alpha_vdim[7][l]*f[23][l]+alpha_vdim[6][l]*f[20][l]+alpha_vdim[5][l]*f[16][l]+alpha_vdim[3][l]*f[12][l]+alpha_vdim[2][l]*f[11][l]+alpha_vdim[1][l]*f[10][l]+alpha_vdim[0][l]*f[4][l]);
+    out[65][l] += 0.2165063509461096*alpha_cdim[0][l]*f[64][l]+0.4841229182759271*(alpha_vdim[34][l]*f[58][l]+alpha_vdim[28][l]*f[57][l]+alpha_vdim[47][l]*f[50][l]+alpha_vdim[19][l]*f[49][l]+alpha_vdim[18][l]*f[48][l]+alpha_vdim[43][l]*f[46][l]+alpha_vdim[15][l]*f[45][l]+alpha_vdim[14][l]*f[44][l]+alpha_vdim[9][l]*f[42][l]+alpha_vdim[33][l]*f[37][l]+alpha_vdim[32][l]*f[36][l]+alpha_vdim[6][l]*f[35][l]+alpha_vdim[27][l]*f[31][l]+alpha_vdim[26][l]*f[30][l]+alpha_vdim[5][l]*f[29][l]+alpha_vdim[22][l]*f[25][l]+alpha_vdim[3][l]*f[24][l]+alpha_vdim[2][l]*f[23][l]+alpha_vdim[17][l]*f[20][l]+alpha_vdim[13][l]*f[16][l]+alpha_vdim[8][l]*f[12][l]+alpha_vdim[7][l]*f[11][l]+alpha_vdim[0][l]*f[10][l])+(0.1936491673103708*alpha_cdim[4][l]+0.4841229182759271*alpha_vdim[1][l])*f[4][l];
+    out[66][l] += 0.2165063509461096*(f[68][l]*alpha_cdim[165][l]+f[64][l]*alpha_cdim[160][l])+0.4841229182759271*(alpha_vdim[33][l]*f[58][l]+alpha_vdim[27][l]*f[57][l]+alpha_vdim[19][l]*f[50][l]+alpha_vdim[47][l]*f[49][l]+alpha_vdim[17][l]*f[48][l]+alpha_vdim[15][l]*f[46][l]+alpha_vdim[43][l]*f[45][l]+alpha_vdim[13][l]*f[44][l]+alpha_vdim[8][l]*f[42][l]+alpha_vdim[34][l]*f[37][l]+alpha_vdim[6][l]*f[36][l]+alpha_vdim[32][l]*f[35][l]+alpha_vdim[28][l]*f[31][l]+alpha_vdim[5][l]*f[30][l]+alpha_vdim[26][l]*f[29][l]+alpha_vdim[3][l]*f[25][l]+alpha_vdim[22][l]*f[24][l]+alpha_vdim[1][l]*f[23][l]+alpha_vdim[18][l]*f[20][l]+alpha_vdim[14][l]*f[16][l]+alpha_vdim[9][l]*f[12][l]+alpha_vdim[0][l]*f[11][l]+alpha_vdim[7][l]*f[10][l]+alpha_vdim[2][l]*f[4][l]);
+    out[67][l] += 0.2165063509461096*(f[69][l]*alpha_cdim[326][l]+f[64][l]*alpha_cdim[320][l])+0.4841229182759271*(alpha_vdim[32][l]*f[58][l]+alpha_vdim[26][l]*f[57][l]+alpha_vdim[18][l]*f[50][l]+alpha_vdim[17][l]*f[49][l]+alpha_vdim[47][l]*f[48][l]+alpha_vdim[14][l]*f[46][l]+alpha_vdim[13][l]*f[45][l]+alpha_vdim[43][l]*f[44][l]+alpha_vdim[7][l]*f[42][l]+alpha_vdim[6][l]*f[37][l]+alpha_vdim[34][l]*f[36][l]+alpha_vdim[33][l]*f[35][l]+alpha_vdim[5][l]*f[31][l]+alpha_vdim[28][l]*f[30][l]+alpha_vdim[27][l]*f[29][l]+alpha_vdim[2][l]*f[25][l]+alpha_vdim[1][l]*f[24][l]+alpha_vdim[22][l]*f[23][l]+alpha_vdim[19][l]*f[20][l]+alpha_vdim[15][l]*f[16][l]+alpha_vdim[0][l]*f[12][l]+alpha_vdim[9][l]*f[11][l]+alpha_vdim[8][l]*f[10][l]+alpha_vdim[3][l]*f[4][l]);
+    out[68][l] += 0.2165063509461096*f[91][l]*alpha_vdim[207][l]+0.1936491673103708*f[42][l]*alpha_vdim[202][l]+0.2165063509461096*(f[86][l]*alpha_vdim[194][l]+f[85][l]*alpha_vdim[193][l]+f[84][l]*alpha_vdim[192][l])+0.1936491673103708*(f[25][l]*alpha_vdim[185][l]+f[24][l]*alpha_vdim[184][l]+f[23][l]*alpha_vdim[183][l])+0.2165063509461096*(f[80][l]*alpha_vdim[182][l]+f[78][l]*alpha_vdim[179][l]+f[77][l]*alpha_vdim[178][l]+f[76][l]*alpha_vdim[177][l])+0.1936491673103708*(f[12][l]*alpha_vdim[172][l]+f[11][l]*alpha_vdim[171][l]+f[10][l]*alpha_vdim[170][l])+0.2165063509461096*(f[72][l]*alpha_vdim[169][l]+f[71][l]*alpha_vdim[168][l]+f[70][l]*alpha_vdim[167][l]+f[69][l]*alpha_vdim[166][l])+0.1936491673103708*f[4][l]*alpha_vdim[164][l]+0.2165063509461096*(f[67][l]*alpha_vdim[163][l]+f[66][l]*alpha_vdim[162][l]+f[65][l]*alpha_vdim[161][l]+f[64][l]*alpha_vdim[160][l])+0.4330127018922193*(alpha_vdim[43][l]*f[122][l]+alpha_vdim[28][l]*f[115][l]+alpha_vdim[27][l]*f[114][l]+alpha_vdim[26][l]*f[113][l]+alpha_vdim[15][l]*f[107][l]+alpha_vdim[14][l]*f[106][l]+alpha_vdim[13][l]*f[105][l]+alpha_vdim[5][l]*f[100][l])+0.4841229182759271*(alpha_vdim[47][l]*f[63][l]+alpha_vdim[34][l]*f[62][l]+alpha_vdim[33][l]*f[61][l]+alpha_vdim[32][l]*f[60][l]+alpha_vdim[22][l]*f[57][l]+alpha_vdim[19][l]*f[56][l]+alpha_vdim[18][l]*f[55][l]+alpha_vdim[17][l]*f[54][l]+alpha_vdim[9][l]*f[46][l]+alpha_vdim[8][l]*f[45][l]+alpha_vdim[7][l]*f[44][l]+f[42][l]*alpha_vdim[43][l]+alpha_vdim[6][l]*f[41][l]+alpha_vdim[3][l]*f[31][l]+alpha_vdim[2][l]*f[30][l]+alpha_vdim[1][l]*f[29][l]+f[25][l]*alpha_vdim[28][l]+f[24][l]*alpha_vdim[27][l]+f[23][l]*alpha_vdim[26][l]+alpha_vdim[0][l]*f[16][l]+f[12][l]*alpha_vdim[15][l]+f[11][l]*alpha_vdim[14][l]+f[10][l]*alpha_vdim[13][l]+f[4][l]*alpha_vdim[5][l]);
+    out[69][l] += 0.2165063509461096*f[90][l]*alpha_vdim[363][l]+0.1936491673103708*f[42][l]*alpha_vdim[362][l]+0.2165063509461096*(f[83][l]*alpha_vdim[348][l]+f[82][l]*alpha_vdim[347][l]+f[81][l]*alpha_vdim[346][l])+0.1936491673103708*(f[25][l]*alpha_vdim[345][l]+f[24][l]*alpha_vdim[344][l]+f[23][l]*alpha_vdim[343][l])+0.2165063509461096*(f[80][l]*alpha_vdim[342][l]+f[75][l]*alpha_vdim[335][l]+f[74][l]*alpha_vdim[334][l]+f[73][l]*alpha_vdim[333][l])+0.1936491673103708*(f[12][l]*alpha_vdim[332][l]+f[11][l]*alpha_vdim[331][l]+f[10][l]*alpha_vdim[330][l])+0.2165063509461096*(f[72][l]*alpha_vdim[329][l]+f[71][l]*alpha_vdim[328][l]+f[70][l]*alpha_vdim[327][l]+f[68][l]*alpha_vdim[325][l])+0.1936491673103708*f[4][l]*alpha_vdim[324][l]+0.2165063509461096*(f[67][l]*alpha_vdim[323][l]+f[66][l]*alpha_vdim[322][l]+f[65][l]*alpha_vdim[321][l]+f[64][l]*alpha_vdim[320][l])+0.4330127018922193*(alpha_vdim[47][l]*f[154][l]+alpha_vdim[34][l]*f[147][l]+alpha_vdim[33][l]*f[146][l]+alpha_vdim[32][l]*f[145][l]+alpha_vdim[19][l]*f[139][l]+alpha_vdim[18][l]*f[138][l]+alpha_vdim[17][l]*f[137][l]+alpha_vdim[6][l]*f[132][l])+0.4841229182759271*(alpha_vdim[43][l]*f[63][l]+alpha_vdim[28][l]*f[62][l]+alpha_vdim[27][l]*f[61][l]+alpha_vdim[26][l]*f[60][l]+alpha_vdim[22][l]*f[58][l]+alpha_vdim[15][l]*f[56][l]+alpha_vdim[14][l]*f[55][l]+alpha_vdim[13][l]*f[54][l]+alpha_vdim[9][l]*f[50][l]+alpha_vdim[8][l]*f[49][l]+alpha_vdim[7][l]*f[48][l]+f[42][l]*alpha_vdim[47][l]+alpha_vdim[5][l]*f[41][l]+alpha_vdim[3][l]*f[37][l]+alpha_vdim[2][l]*f[36][l]+alpha_vdim[1][l]*f[35][l]+f[25][l]*alpha_vdim[34][l]+f[24][l]*alpha_vdim[33][l]+f[23][l]*alpha_vdim[32][l]+alpha_vdim[0][l]*f[20][l]+f[12][l]*alpha_vdim[19][l]+f[11][l]*alpha_vdim[18][l]+f[10][l]*alpha_vdim[17][l]+f[4][l]*alpha_vdim[6][l]);
+    out[70][l] += 0.2165063509461096*(f[73][l]*alpha_cdim[165][l]+f[65][l]*alpha_cdim[160][l]+alpha_cdim[0][l]*f[66][l])+0.4841229182759271*(alpha_vdim[19][l]*f[58][l]+alpha_vdim[15][l]*f[57][l]+alpha_vdim[33][l]*f[50][l]+alpha_vdim[34][l]*f[49][l]+alpha_vdim[6][l]*f[48][l]+f[37][l]*alpha_vdim[47][l]+alpha_vdim[27][l]*f[46][l]+alpha_vdim[28][l]*f[45][l]+alpha_vdim[5][l]*f[44][l]+f[31][l]*alpha_vdim[43][l]+alpha_vdim[3][l]*f[42][l]+alpha_vdim[17][l]*f[36][l]+alpha_vdim[18][l]*f[35][l]+f[20][l]*alpha_vdim[32][l]+alpha_vdim[13][l]*f[30][l]+alpha_vdim[14][l]*f[29][l]+f[16][l]*alpha_vdim[26][l]+alpha_vdim[8][l]*f[25][l]+alpha_vdim[9][l]*f[24][l]+alpha_vdim[0][l]*f[23][l]+f[12][l]*alpha_vdim[22][l])+0.1936491673103708*alpha_cdim[4][l]*f[11][l]+0.4841229182759271*(alpha_vdim[1][l]*f[11][l]+alpha_vdim[2][l]*f[10][l]+f[4][l]*alpha_vdim[7][l]);
+    out[71][l] += 0.2165063509461096*(f[76][l]*alpha_cdim[326][l]+f[65][l]*alpha_cdim[320][l]+alpha_cdim[0][l]*f[67][l])+0.4841229182759271*(alpha_vdim[18][l]*f[58][l]+alpha_vdim[14][l]*f[57][l]+alpha_vdim[32][l]*f[50][l]+alpha_vdim[6][l]*f[49][l]+alpha_vdim[34][l]*f[48][l]+f[36][l]*alpha_vdim[47][l]+alpha_vdim[26][l]*f[46][l]+alpha_vdim[5][l]*f[45][l]+alpha_vdim[28][l]*f[44][l]+f[30][l]*alpha_vdim[43][l]+alpha_vdim[2][l]*f[42][l]+alpha_vdim[17][l]*f[37][l]+alpha_vdim[19][l]*f[35][l]+f[20][l]*alpha_vdim[33][l]+alpha_vdim[13][l]*f[31][l]+alpha_vdim[15][l]*f[29][l]+f[16][l]*alpha_vdim[27][l]+alpha_vdim[7][l]*f[25][l]+alpha_vdim[0][l]*f[24][l]+alpha_vdim[9][l]*f[23][l]+f[11][l]*alpha_vdim[22][l])+0.1936491673103708*alpha_cdim[4][l]*f[12][l]+0.4841229182759271*(alpha_vdim[1][l]*f[12][l]+alpha_vdim[3][l]*f[10][l]+f[4][l]*alpha_vdim[8][l]);
+    out[72][l] += 0.2165063509461096*(f[77][l]*alpha_cdim[326][l]+f[66][l]*alpha_cdim[320][l]+f[75][l]*alpha_cdim[165][l]+f[67][l]*alpha_cdim[160][l])+0.4841229182759271*(alpha_vdim[17][l]*f[58][l]+alpha_vdim[13][l]*f[57][l]+alpha_vdim[6][l]*f[50][l]+alpha_vdim[32][l]*f[49][l]+alpha_vdim[33][l]*f[48][l]+f[35][l]*alpha_vdim[47][l]+alpha_vdim[5][l]*f[46][l]+alpha_vdim[26][l]*f[45][l]+alpha_vdim[27][l]*f[44][l]+f[29][l]*alpha_vdim[43][l]+alpha_vdim[1][l]*f[42][l]+alpha_vdim[18][l]*f[37][l]+alpha_vdim[19][l]*f[36][l]+f[20][l]*alpha_vdim[34][l]+alpha_vdim[14][l]*f[31][l]+alpha_vdim[15][l]*f[30][l]+f[16][l]*alpha_vdim[28][l]+alpha_vdim[0][l]*f[25][l]+alpha_vdim[7][l]*f[24][l]+alpha_vdim[8][l]*f[23][l]+f[10][l]*alpha_vdim[22][l]+alpha_vdim[2][l]*f[12][l]+alpha_vdim[3][l]*f[11][l]+f[4][l]*alpha_vdim[9][l]);
+    out[73][l] += 0.2165063509461096*f[86][l]*alpha_vdim[207][l]+0.1936491673103708*f[25][l]*alpha_vdim[202][l]+0.2165063509461096*(f[91][l]*alpha_vdim[194][l]+f[78][l]*alpha_vdim[193][l]+f[77][l]*alpha_vdim[192][l])+0.1936491673103708*(f[42][l]*alpha_vdim[185][l]+f[12][l]*alpha_vdim[184][l]+f[11][l]*alpha_vdim[183][l])+0.2165063509461096*(f[72][l]*alpha_vdim[182][l]+f[85][l]*alpha_vdim[179][l]+f[84][l]*alpha_vdim[178][l]+f[69][l]*alpha_vdim[177][l])+0.1936491673103708*(f[24][l]*alpha_vdim[172][l]+f[23][l]*alpha_vdim[171][l]+f[4][l]*alpha_vdim[170][l])+0.2165063509461096*(f[80][l]*alpha_vdim[169][l]+f[67][l]*alpha_vdim[168][l]+f[66][l]*alpha_vdim[167][l]+f[76][l]*alpha_vdim[166][l])+0.1936491673103708*f[10][l]*alpha_vdim[164][l]+0.2165063509461096*(f[71][l]*alpha_vdim[163][l]+f[70][l]*alpha_vdim[162][l]+f[64][l]*alpha_vdim[161][l]+f[65][l]*alpha_vdim[160][l])+0.4330127018922193*(alpha_vdim[28][l]*f[122][l]+alpha_vdim[43][l]*f[115][l]+alpha_vdim[15][l]*f[114][l]+alpha_vdim[14][l]*f[113][l]+alpha_vdim[27][l]*f[107][l]+alpha_vdim[26][l]*f[106][l]+alpha_vdim[5][l]*f[105][l]+alpha_vdim[13][l]*f[100][l])+0.2165063509461096*alpha_cdim[0][l]*f[68][l]+0.4841229182759271*(alpha_vdim[34][l]*f[63][l]+alpha_vdim[47][l]*f[62][l]+alpha_vdim[19][l]*f[61][l]+alpha_vdim[18][l]*f[60][l]+alpha_vdim[9][l]*f[57][l]+alpha_vdim[33][l]*f[56][l]+alpha_vdim[32][l]*f[55][l]+alpha_vdim[6][l]*f[54][l]+alpha_vdim[22][l]*f[46][l]+alpha_vdim[3][l]*f[45][l]+alpha_vdim[2][l]*f[44][l]+f[25][l]*alpha_vdim[43][l]+alpha_vdim[28][l]*f[42][l]+alpha_vdim[17][l]*f[41][l]+alpha_vdim[8][l]*f[31][l]+alpha_vdim[7][l]*f[30][l]+alpha_vdim[0][l]*f[29][l]+f[12][l]*alpha_vdim[27][l]+f[11][l]*alpha_vdim[26][l]+alpha_vdim[15][l]*f[24][l]+alpha_vdim[14][l]*f[23][l])+0.1936491673103708*alpha_cdim[4][l]*f[16][l]+0.4841229182759271*(alpha_vdim[1][l]*f[16][l]+f[4][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*f[10][l]);
+    out[74][l] += 0.2165063509461096*f[85][l]*alpha_vdim[207][l]+0.1936491673103708*f[24][l]*alpha_vdim[202][l]+0.2165063509461096*(f[78][l]*alpha_vdim[194][l]+f[91][l]*alpha_vdim[193][l]+f[76][l]*alpha_vdim[192][l])+0.1936491673103708*(f[12][l]*alpha_vdim[185][l]+f[42][l]*alpha_vdim[184][l]+f[10][l]*alpha_vdim[183][l])+0.2165063509461096*(f[71][l]*alpha_vdim[182][l]+f[86][l]*alpha_vdim[179][l]+f[69][l]*alpha_vdim[178][l]+f[84][l]*alpha_vdim[177][l])+0.1936491673103708*(f[25][l]*alpha_vdim[172][l]+f[4][l]*alpha_vdim[171][l]+f[23][l]*alpha_vdim[170][l])+0.2165063509461096*(f[67][l]*alpha_vdim[169][l]+f[80][l]*alpha_vdim[168][l]+f[65][l]*alpha_vdim[167][l]+f[77][l]*alpha_vdim[166][l]+f[64][l]*alpha_cdim[165][l])+0.1936491673103708*f[11][l]*alpha_vdim[164][l]+0.2165063509461096*(f[72][l]*alpha_vdim[163][l]+f[64][l]*alpha_vdim[162][l]+f[70][l]*alpha_vdim[161][l]+f[66][l]*alpha_vdim[160][l]+f[68][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[27][l]*f[122][l]+alpha_vdim[15][l]*f[115][l]+alpha_vdim[43][l]*f[114][l]+alpha_vdim[13][l]*f[113][l]+alpha_vdim[28][l]*f[107][l]+alpha_vdim[5][l]*f[106][l]+alpha_vdim[26][l]*f[105][l]+alpha_vdim[14][l]*f[100][l])+0.4841229182759271*(alpha_vdim[33][l]*f[63][l]+alpha_vdim[19][l]*f[62][l]+alpha_vdim[47][l]*f[61][l]+alpha_vdim[17][l]*f[60][l]+alpha_vdim[8][l]*f[57][l]+alpha_vdim[34][l]*f[56][l]+alpha_vdim[6][l]*f[55][l]+alpha_vdim[32][l]*f[54][l]+alpha_vdim[3][l]*f[46][l]+alpha_vdim[22][l]*f[45][l]+alpha_vdim[1][l]*f[44][l]+f[24][l]*alpha_vdim[43][l]+alpha_vdim[27][l]*f[42][l]+alpha_vdim[18][l]*f[41][l]+alpha_vdim[9][l]*f[31][l]+alpha_vdim[0][l]*f[30][l]+alpha_vdim[7][l]*f[29][l]+f[12][l]*alpha_vdim[28][l]+f[10][l]*alpha_vdim[26][l]+alpha_vdim[15][l]*f[25][l]+alpha_vdim[13][l]*f[23][l]+alpha_vdim[2][l]*f[16][l]+f[4][l]*alpha_vdim[14][l]+alpha_vdim[5][l]*f[11][l]);
+    out[75][l] += 0.2165063509461096*(f[79][l]*alpha_cdim[326][l]+f[68][l]*alpha_cdim[320][l]+f[84][l]*alpha_vdim[207][l])+0.1936491673103708*f[23][l]*alpha_vdim[202][l]+0.2165063509461096*(f[77][l]*alpha_vdim[194][l]+f[76][l]*alpha_vdim[193][l]+f[91][l]*alpha_vdim[192][l])+0.1936491673103708*(f[11][l]*alpha_vdim[185][l]+f[10][l]*alpha_vdim[184][l]+f[42][l]*alpha_vdim[183][l])+0.2165063509461096*(f[70][l]*alpha_vdim[182][l]+f[69][l]*alpha_vdim[179][l]+f[86][l]*alpha_vdim[178][l]+f[85][l]*alpha_vdim[177][l])+0.1936491673103708*(f[4][l]*alpha_vdim[172][l]+f[25][l]*alpha_vdim[171][l]+f[24][l]*alpha_vdim[170][l])+0.2165063509461096*(f[66][l]*alpha_vdim[169][l]+f[65][l]*alpha_vdim[168][l]+f[80][l]*alpha_vdim[167][l]+f[78][l]*alpha_vdim[166][l])+0.1936491673103708*f[12][l]*alpha_vdim[164][l]+0.2165063509461096*(f[64][l]*alpha_vdim[163][l]+f[72][l]*alpha_vdim[162][l]+f[71][l]*alpha_vdim[161][l]+f[67][l]*alpha_vdim[160][l])+0.4330127018922193*(alpha_vdim[26][l]*f[122][l]+alpha_vdim[14][l]*f[115][l]+alpha_vdim[13][l]*f[114][l]+alpha_vdim[43][l]*f[113][l]+alpha_vdim[5][l]*f[107][l]+alpha_vdim[28][l]*f[106][l]+alpha_vdim[27][l]*f[105][l]+alpha_vdim[15][l]*f[100][l])+0.4841229182759271*(alpha_vdim[32][l]*f[63][l]+alpha_vdim[18][l]*f[62][l]+alpha_vdim[17][l]*f[61][l]+alpha_vdim[47][l]*f[60][l]+alpha_vdim[7][l]*f[57][l]+alpha_vdim[6][l]*f[56][l]+alpha_vdim[34][l]*f[55][l]+alpha_vdim[33][l]*f[54][l]+alpha_vdim[2][l]*f[46][l]+alpha_vdim[1][l]*f[45][l]+alpha_vdim[22][l]*f[44][l]+f[23][l]*alpha_vdim[43][l]+alpha_vdim[26][l]*f[42][l]+alpha_vdim[19][l]*f[41][l]+alpha_vdim[0][l]*f[31][l]+alpha_vdim[9][l]*f[30][l]+alpha_vdim[8][l]*f[29][l]+f[11][l]*alpha_vdim[28][l]+f[10][l]*alpha_vdim[27][l]+alpha_vdim[14][l]*f[25][l]+alpha_vdim[13][l]*f[24][l]+alpha_vdim[3][l]*f[16][l]+f[4][l]*alpha_vdim[15][l]+alpha_vdim[5][l]*f[12][l]);
+    out[76][l] += 0.2165063509461096*f[83][l]*alpha_vdim[363][l]+0.1936491673103708*f[25][l]*alpha_vdim[362][l]+0.2165063509461096*(f[90][l]*alpha_vdim[348][l]+f[75][l]*alpha_vdim[347][l]+f[74][l]*alpha_vdim[346][l])+0.1936491673103708*(f[42][l]*alpha_vdim[345][l]+f[12][l]*alpha_vdim[344][l]+f[11][l]*alpha_vdim[343][l])+0.2165063509461096*(f[72][l]*alpha_vdim[342][l]+f[82][l]*alpha_vdim[335][l]+f[81][l]*alpha_vdim[334][l]+f[68][l]*alpha_vdim[333][l])+0.1936491673103708*(f[24][l]*alpha_vdim[332][l]+f[23][l]*alpha_vdim[331][l]+f[4][l]*alpha_vdim[330][l])+0.2165063509461096*(f[80][l]*alpha_vdim[329][l]+f[67][l]*alpha_vdim[328][l]+f[66][l]*alpha_vdim[327][l]+f[73][l]*alpha_vdim[325][l])+0.1936491673103708*f[10][l]*alpha_vdim[324][l]+0.2165063509461096*(f[71][l]*alpha_vdim[323][l]+f[70][l]*alpha_vdim[322][l]+f[64][l]*alpha_vdim[321][l]+f[65][l]*alpha_vdim[320][l])+0.4330127018922193*(alpha_vdim[34][l]*f[154][l]+alpha_vdim[47][l]*f[147][l]+alpha_vdim[19][l]*f[146][l]+alpha_vdim[18][l]*f[145][l]+alpha_vdim[33][l]*f[139][l]+alpha_vdim[32][l]*f[138][l]+alpha_vdim[6][l]*f[137][l]+alpha_vdim[17][l]*f[132][l])+0.2165063509461096*alpha_cdim[0][l]*f[69][l]+0.4841229182759271*(alpha_vdim[28][l]*f[63][l]+alpha_vdim[43][l]*f[62][l]+alpha_vdim[15][l]*f[61][l]+alpha_vdim[14][l]*f[60][l]+alpha_vdim[9][l]*f[58][l]+alpha_vdim[27][l]*f[56][l]+alpha_vdim[26][l]*f[55][l]+alpha_vdim[5][l]*f[54][l]+alpha_vdim[22][l]*f[50][l]+alpha_vdim[3][l]*f[49][l]+alpha_vdim[2][l]*f[48][l]+f[25][l]*alpha_vdim[47][l]+alpha_vdim[34][l]*f[42][l]+alpha_vdim[13][l]*f[41][l]+alpha_vdim[8][l]*f[37][l]+alpha_vdim[7][l]*f[36][l]+alpha_vdim[0][l]*f[35][l]+f[12][l]*alpha_vdim[33][l]+f[11][l]*alpha_vdim[32][l]+alpha_vdim[19][l]*f[24][l]+alpha_vdim[18][l]*f[23][l])+0.1936491673103708*alpha_cdim[4][l]*f[20][l]+0.4841229182759271*(alpha_vdim[1][l]*f[20][l]+f[4][l]*alpha_vdim[17][l]+alpha_vdim[6][l]*f[10][l]);
+    out[77][l] += 0.2165063509461096*f[82][l]*alpha_vdim[363][l]+0.1936491673103708*f[24][l]*alpha_vdim[362][l]+0.2165063509461096*(f[75][l]*alpha_vdim[348][l]+f[90][l]*alpha_vdim[347][l]+f[73][l]*alpha_vdim[346][l])+0.1936491673103708*(f[12][l]*alpha_vdim[345][l]+f[42][l]*alpha_vdim[344][l]+f[10][l]*alpha_vdim[343][l])+0.2165063509461096*(f[71][l]*alpha_vdim[342][l]+f[83][l]*alpha_vdim[335][l]+f[68][l]*alpha_vdim[334][l]+f[81][l]*alpha_vdim[333][l])+0.1936491673103708*(f[25][l]*alpha_vdim[332][l]+f[4][l]*alpha_vdim[331][l]+f[23][l]*alpha_vdim[330][l])+0.2165063509461096*(f[67][l]*alpha_vdim[329][l]+f[80][l]*alpha_vdim[328][l]+f[65][l]*alpha_vdim[327][l]+f[74][l]*alpha_vdim[325][l])+0.1936491673103708*f[11][l]*alpha_vdim[324][l]+0.2165063509461096*(f[72][l]*alpha_vdim[323][l]+f[64][l]*alpha_vdim[322][l]+f[70][l]*alpha_vdim[321][l]+f[66][l]*alpha_vdim[320][l]+f[79][l]*alpha_cdim[165][l]+f[69][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[33][l]*f[154][l]+alpha_vdim[19][l]*f[147][l]+alpha_vdim[47][l]*f[146][l]+alpha_vdim[17][l]*f[145][l]+alpha_vdim[34][l]*f[139][l]+alpha_vdim[6][l]*f[138][l]+alpha_vdim[32][l]*f[137][l]+alpha_vdim[18][l]*f[132][l])+0.4841229182759271*(alpha_vdim[27][l]*f[63][l]+alpha_vdim[15][l]*f[62][l]+alpha_vdim[43][l]*f[61][l]+alpha_vdim[13][l]*f[60][l]+alpha_vdim[8][l]*f[58][l]+alpha_vdim[28][l]*f[56][l]+alpha_vdim[5][l]*f[55][l]+alpha_vdim[26][l]*f[54][l]+alpha_vdim[3][l]*f[50][l]+alpha_vdim[22][l]*f[49][l]+alpha_vdim[1][l]*f[48][l]+f[24][l]*alpha_vdim[47][l]+alpha_vdim[33][l]*f[42][l]+alpha_vdim[14][l]*f[41][l]+alpha_vdim[9][l]*f[37][l]+alpha_vdim[0][l]*f[36][l]+alpha_vdim[7][l]*f[35][l]+f[12][l]*alpha_vdim[34][l]+f[10][l]*alpha_vdim[32][l]+alpha_vdim[19][l]*f[25][l]+alpha_vdim[17][l]*f[23][l]+alpha_vdim[2][l]*f[20][l]+f[4][l]*alpha_vdim[18][l]+alpha_vdim[6][l]*f[11][l]);
+    out[78][l] += 0.2165063509461096*f[81][l]*alpha_vdim[363][l]+0.1936491673103708*f[23][l]*alpha_vdim[362][l]+0.2165063509461096*(f[74][l]*alpha_vdim[348][l]+f[73][l]*alpha_vdim[347][l]+f[90][l]*alpha_vdim[346][l])+0.1936491673103708*(f[11][l]*alpha_vdim[345][l]+f[10][l]*alpha_vdim[344][l]+f[42][l]*alpha_vdim[343][l])+0.2165063509461096*(f[70][l]*alpha_vdim[342][l]+f[68][l]*alpha_vdim[335][l]+f[83][l]*alpha_vdim[334][l]+f[82][l]*alpha_vdim[333][l])+0.1936491673103708*(f[4][l]*alpha_vdim[332][l]+f[25][l]*alpha_vdim[331][l]+f[24][l]*alpha_vdim[330][l])+0.2165063509461096*(f[66][l]*alpha_vdim[329][l]+f[65][l]*alpha_vdim[328][l]+f[80][l]*alpha_vdim[327][l]+f[64][l]*alpha_cdim[326][l]+f[75][l]*alpha_vdim[325][l])+0.1936491673103708*f[12][l]*alpha_vdim[324][l]+0.2165063509461096*(f[64][l]*alpha_vdim[323][l]+f[72][l]*alpha_vdim[322][l]+f[71][l]*alpha_vdim[321][l]+f[67][l]*alpha_vdim[320][l]+f[69][l]*alpha_cdim[320][l])+0.4330127018922193*(alpha_vdim[32][l]*f[154][l]+alpha_vdim[18][l]*f[147][l]+alpha_vdim[17][l]*f[146][l]+alpha_vdim[47][l]*f[145][l]+alpha_vdim[6][l]*f[139][l]+alpha_vdim[34][l]*f[138][l]+alpha_vdim[33][l]*f[137][l]+alpha_vdim[19][l]*f[132][l])+0.4841229182759271*(alpha_vdim[26][l]*f[63][l]+alpha_vdim[14][l]*f[62][l]+alpha_vdim[13][l]*f[61][l]+alpha_vdim[43][l]*f[60][l]+alpha_vdim[7][l]*f[58][l]+alpha_vdim[5][l]*f[56][l]+alpha_vdim[28][l]*f[55][l]+alpha_vdim[27][l]*f[54][l]+alpha_vdim[2][l]*f[50][l]+alpha_vdim[1][l]*f[49][l]+alpha_vdim[22][l]*f[48][l]+f[23][l]*alpha_vdim[47][l]+alpha_vdim[32][l]*f[42][l]+alpha_vdim[15][l]*f[41][l]+alpha_vdim[0][l]*f[37][l]+alpha_vdim[9][l]*f[36][l]+alpha_vdim[8][l]*f[35][l]+f[11][l]*alpha_vdim[34][l]+f[10][l]*alpha_vdim[33][l]+alpha_vdim[18][l]*f[25][l]+alpha_vdim[17][l]*f[24][l]+alpha_vdim[3][l]*f[20][l]+f[4][l]*alpha_vdim[19][l]+alpha_vdim[6][l]*f[12][l]);
+    out[79][l] += 0.2165063509461096*f[80][l]*alpha_vdim[363][l]+0.1936491673103708*f[57][l]*alpha_vdim[362][l]+0.2165063509461096*(f[72][l]*alpha_vdim[348][l]+f[71][l]*alpha_vdim[347][l]+f[70][l]*alpha_vdim[346][l])+0.1936491673103708*(f[46][l]*alpha_vdim[345][l]+f[45][l]*alpha_vdim[344][l]+f[44][l]*alpha_vdim[343][l])+0.2165063509461096*(f[90][l]*alpha_vdim[342][l]+f[67][l]*alpha_vdim[335][l]+f[66][l]*alpha_vdim[334][l]+f[65][l]*alpha_vdim[333][l])+0.1936491673103708*(f[31][l]*alpha_vdim[332][l]+f[30][l]*alpha_vdim[331][l]+f[29][l]*alpha_vdim[330][l])+0.2165063509461096*(f[83][l]*alpha_vdim[329][l]+f[82][l]*alpha_vdim[328][l]+f[81][l]*alpha_vdim[327][l]+f[64][l]*alpha_vdim[325][l])+0.1936491673103708*f[16][l]*alpha_vdim[324][l]+0.2165063509461096*(f[75][l]*alpha_vdim[323][l]+f[74][l]*alpha_vdim[322][l]+f[73][l]*alpha_vdim[321][l]+f[68][l]*alpha_vdim[320][l]+f[80][l]*alpha_vdim[207][l])+0.1936491673103708*f[58][l]*alpha_vdim[202][l]+0.2165063509461096*(f[72][l]*alpha_vdim[194][l]+f[71][l]*alpha_vdim[193][l]+f[70][l]*alpha_vdim[192][l])+0.1936491673103708*(f[50][l]*alpha_vdim[185][l]+f[49][l]*alpha_vdim[184][l]+f[48][l]*alpha_vdim[183][l])+0.2165063509461096*(f[91][l]*alpha_vdim[182][l]+f[67][l]*alpha_vdim[179][l]+f[66][l]*alpha_vdim[178][l]+f[65][l]*alpha_vdim[177][l])+0.1936491673103708*(f[37][l]*alpha_vdim[172][l]+f[36][l]*alpha_vdim[171][l]+f[35][l]*alpha_vdim[170][l])+0.2165063509461096*(f[86][l]*alpha_vdim[169][l]+f[85][l]*alpha_vdim[168][l]+f[84][l]*alpha_vdim[167][l]+f[64][l]*alpha_vdim[166][l])+0.1936491673103708*f[20][l]*alpha_vdim[164][l]+0.2165063509461096*(f[78][l]*alpha_vdim[163][l]+f[77][l]*alpha_vdim[162][l]+f[76][l]*alpha_vdim[161][l]+f[69][l]*alpha_vdim[160][l])+0.4330127018922193*(alpha_vdim[47][l]*f[159][l]+alpha_vdim[34][l]*f[158][l]+alpha_vdim[33][l]*f[157][l]+alpha_vdim[32][l]*f[156][l]+alpha_vdim[19][l]*f[153][l]+alpha_vdim[18][l]*f[152][l]+alpha_vdim[17][l]*f[151][l]+alpha_vdim[6][l]*f[143][l]+alpha_vdim[43][l]*f[127][l]+alpha_vdim[28][l]*f[126][l]+alpha_vdim[27][l]*f[125][l]+alpha_vdim[26][l]*f[124][l]+alpha_vdim[15][l]*f[121][l]+alpha_vdim[14][l]*f[120][l]+alpha_vdim[13][l]*f[119][l]+alpha_vdim[5][l]*f[111][l])+0.4841229182759271*(alpha_vdim[22][l]*f[63][l]+alpha_vdim[9][l]*f[62][l]+alpha_vdim[8][l]*f[61][l]+alpha_vdim[7][l]*f[60][l]+alpha_vdim[43][l]*f[58][l]+alpha_vdim[47][l]*f[57][l]+alpha_vdim[3][l]*f[56][l]+alpha_vdim[2][l]*f[55][l]+alpha_vdim[1][l]*f[54][l]+alpha_vdim[28][l]*f[50][l]+alpha_vdim[27][l]*f[49][l]+alpha_vdim[26][l]*f[48][l]+alpha_vdim[34][l]*f[46][l]+alpha_vdim[33][l]*f[45][l]+alpha_vdim[32][l]*f[44][l]+alpha_vdim[0][l]*f[41][l]+alpha_vdim[15][l]*f[37][l]+alpha_vdim[14][l]*f[36][l]+alpha_vdim[13][l]*f[35][l]+alpha_vdim[19][l]*f[31][l]+alpha_vdim[18][l]*f[30][l]+alpha_vdim[17][l]*f[29][l]+alpha_vdim[5][l]*f[20][l]+alpha_vdim[6][l]*f[16][l]);
+    out[80][l] += 0.2165063509461096*(f[84][l]*alpha_cdim[326][l]+f[70][l]*alpha_cdim[320][l]+f[82][l]*alpha_cdim[165][l]+f[71][l]*alpha_cdim[160][l]+alpha_cdim[0][l]*f[72][l])+0.4841229182759271*(alpha_vdim[6][l]*f[58][l]+alpha_vdim[5][l]*f[57][l]+alpha_vdim[17][l]*f[50][l]+alpha_vdim[18][l]*f[49][l]+alpha_vdim[19][l]*f[48][l]+f[20][l]*alpha_vdim[47][l]+alpha_vdim[13][l]*f[46][l]+alpha_vdim[14][l]*f[45][l]+alpha_vdim[15][l]*f[44][l]+f[16][l]*alpha_vdim[43][l]+alpha_vdim[0][l]*f[42][l]+alpha_vdim[32][l]*f[37][l]+alpha_vdim[33][l]*f[36][l]+alpha_vdim[34][l]*f[35][l]+alpha_vdim[26][l]*f[31][l]+alpha_vdim[27][l]*f[30][l]+alpha_vdim[28][l]*f[29][l])+0.1936491673103708*alpha_cdim[4][l]*f[25][l]+0.4841229182759271*(alpha_vdim[1][l]*f[25][l]+alpha_vdim[2][l]*f[24][l]+alpha_vdim[3][l]*f[23][l]+f[4][l]*alpha_vdim[22][l]+alpha_vdim[7][l]*f[12][l]+alpha_vdim[8][l]*f[11][l]+alpha_vdim[9][l]*f[10][l]);
+    out[81][l] += 0.2165063509461096*f[78][l]*alpha_vdim[207][l]+0.1936491673103708*f[12][l]*alpha_vdim[202][l]+0.2165063509461096*(f[85][l]*alpha_vdim[194][l]+f[86][l]*alpha_vdim[193][l]+f[69][l]*alpha_vdim[192][l])+0.1936491673103708*(f[24][l]*alpha_vdim[185][l]+f[25][l]*alpha_vdim[184][l]+f[4][l]*alpha_vdim[183][l])+0.2165063509461096*(f[67][l]*alpha_vdim[182][l]+f[91][l]*alpha_vdim[179][l]+f[76][l]*alpha_vdim[178][l]+f[77][l]*alpha_vdim[177][l])+0.1936491673103708*(f[42][l]*alpha_vdim[172][l]+f[10][l]*alpha_vdim[171][l]+f[11][l]*alpha_vdim[170][l])+0.2165063509461096*(f[71][l]*alpha_vdim[169][l]+f[72][l]*alpha_vdim[168][l]+f[64][l]*alpha_vdim[167][l]+f[84][l]*alpha_vdim[166][l]+f[65][l]*alpha_cdim[165][l])+0.1936491673103708*f[23][l]*alpha_vdim[164][l]+0.2165063509461096*(f[80][l]*alpha_vdim[163][l]+f[65][l]*alpha_vdim[162][l]+f[66][l]*alpha_vdim[161][l]+f[70][l]*alpha_vdim[160][l]+f[73][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[15][l]*f[122][l]+alpha_vdim[27][l]*f[115][l]+alpha_vdim[28][l]*f[114][l]+alpha_vdim[5][l]*f[113][l]+alpha_vdim[43][l]*f[107][l]+alpha_vdim[13][l]*f[106][l]+alpha_vdim[14][l]*f[105][l]+alpha_vdim[26][l]*f[100][l])+0.2165063509461096*alpha_cdim[0][l]*f[74][l]+0.4841229182759271*(alpha_vdim[19][l]*f[63][l]+alpha_vdim[33][l]*f[62][l]+alpha_vdim[34][l]*f[61][l]+alpha_vdim[6][l]*f[60][l]+alpha_vdim[3][l]*f[57][l]+alpha_vdim[47][l]*f[56][l]+alpha_vdim[17][l]*f[55][l]+alpha_vdim[18][l]*f[54][l]+alpha_vdim[8][l]*f[46][l]+alpha_vdim[9][l]*f[45][l]+alpha_vdim[0][l]*f[44][l]+f[12][l]*alpha_vdim[43][l]+alpha_vdim[15][l]*f[42][l]+alpha_vdim[32][l]*f[41][l]+alpha_vdim[22][l]*f[31][l])+0.1936491673103708*alpha_cdim[4][l]*f[30][l]+0.4841229182759271*(alpha_vdim[1][l]*f[30][l]+alpha_vdim[2][l]*f[29][l]+f[24][l]*alpha_vdim[28][l]+f[25][l]*alpha_vdim[27][l]+f[4][l]*alpha_vdim[26][l]+alpha_vdim[5][l]*f[23][l]+alpha_vdim[7][l]*f[16][l]+f[10][l]*alpha_vdim[14][l]+f[11][l]*alpha_vdim[13][l]);
+    out[82][l] += 0.2165063509461096*(f[87][l]*alpha_cdim[326][l]+f[73][l]*alpha_cdim[320][l]+f[77][l]*alpha_vdim[207][l])+0.1936491673103708*f[11][l]*alpha_vdim[202][l]+0.2165063509461096*(f[84][l]*alpha_vdim[194][l]+f[69][l]*alpha_vdim[193][l]+f[86][l]*alpha_vdim[192][l])+0.1936491673103708*(f[23][l]*alpha_vdim[185][l]+f[4][l]*alpha_vdim[184][l]+f[25][l]*alpha_vdim[183][l])+0.2165063509461096*(f[66][l]*alpha_vdim[182][l]+f[76][l]*alpha_vdim[179][l]+f[91][l]*alpha_vdim[178][l]+f[78][l]*alpha_vdim[177][l])+0.1936491673103708*(f[10][l]*alpha_vdim[172][l]+f[42][l]*alpha_vdim[171][l]+f[12][l]*alpha_vdim[170][l])+0.2165063509461096*(f[70][l]*alpha_vdim[169][l]+f[64][l]*alpha_vdim[168][l]+f[72][l]*alpha_vdim[167][l]+f[85][l]*alpha_vdim[166][l])+0.1936491673103708*f[24][l]*alpha_vdim[164][l]+0.2165063509461096*(f[65][l]*alpha_vdim[163][l]+f[80][l]*alpha_vdim[162][l]+f[67][l]*alpha_vdim[161][l]+f[71][l]*alpha_vdim[160][l])+0.4330127018922193*(alpha_vdim[14][l]*f[122][l]+alpha_vdim[26][l]*f[115][l]+alpha_vdim[5][l]*f[114][l]+alpha_vdim[28][l]*f[113][l]+alpha_vdim[13][l]*f[107][l]+alpha_vdim[43][l]*f[106][l]+alpha_vdim[15][l]*f[105][l]+alpha_vdim[27][l]*f[100][l])+0.2165063509461096*alpha_cdim[0][l]*f[75][l]+0.4841229182759271*(alpha_vdim[18][l]*f[63][l]+alpha_vdim[32][l]*f[62][l]+alpha_vdim[6][l]*f[61][l]+alpha_vdim[34][l]*f[60][l]+alpha_vdim[2][l]*f[57][l]+alpha_vdim[17][l]*f[56][l]+alpha_vdim[47][l]*f[55][l]+alpha_vdim[19][l]*f[54][l]+alpha_vdim[7][l]*f[46][l]+alpha_vdim[0][l]*f[45][l]+alpha_vdim[9][l]*f[44][l]+f[11][l]*alpha_vdim[43][l]+alpha_vdim[14][l]*f[42][l]+alpha_vdim[33][l]*f[41][l])+0.1936491673103708*alpha_cdim[4][l]*f[31][l]+0.4841229182759271*(alpha_vdim[1][l]*f[31][l]+alpha_vdim[22][l]*f[30][l]+alpha_vdim[3][l]*f[29][l]+f[23][l]*alpha_vdim[28][l]+f[4][l]*alpha_vdim[27][l]+f[25][l]*alpha_vdim[26][l]+alpha_vdim[5][l]*f[24][l]+alpha_vdim[8][l]*f[16][l]+f[10][l]*alpha_vdim[15][l]+f[12][l]*alpha_vdim[13][l]);
+    out[83][l] += 0.2165063509461096*(f[88][l]*alpha_cdim[326][l]+f[74][l]*alpha_cdim[320][l]+f[76][l]*alpha_vdim[207][l])+0.1936491673103708*f[10][l]*alpha_vdim[202][l]+0.2165063509461096*(f[69][l]*alpha_vdim[194][l]+f[84][l]*alpha_vdim[193][l]+f[85][l]*alpha_vdim[192][l])+0.1936491673103708*(f[4][l]*alpha_vdim[185][l]+f[23][l]*alpha_vdim[184][l]+f[24][l]*alpha_vdim[183][l])+0.2165063509461096*(f[65][l]*alpha_vdim[182][l]+f[77][l]*alpha_vdim[179][l]+f[78][l]*alpha_vdim[178][l]+f[91][l]*alpha_vdim[177][l])+0.1936491673103708*(f[11][l]*alpha_vdim[172][l]+f[12][l]*alpha_vdim[171][l]+f[42][l]*alpha_vdim[170][l])+0.2165063509461096*(f[64][l]*alpha_vdim[169][l]+f[70][l]*alpha_vdim[168][l]+f[71][l]*alpha_vdim[167][l]+f[86][l]*alpha_vdim[166][l]+f[67][l]*alpha_cdim[165][l])+0.1936491673103708*f[25][l]*alpha_vdim[164][l]+0.2165063509461096*(f[66][l]*alpha_vdim[163][l]+f[67][l]*alpha_vdim[162][l]+f[80][l]*alpha_vdim[161][l]+f[72][l]*alpha_vdim[160][l]+f[75][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[13][l]*f[122][l]+alpha_vdim[5][l]*f[115][l]+alpha_vdim[26][l]*f[114][l]+alpha_vdim[27][l]*f[113][l]+alpha_vdim[14][l]*f[107][l]+alpha_vdim[15][l]*f[106][l]+alpha_vdim[43][l]*f[105][l]+alpha_vdim[28][l]*f[100][l])+0.4841229182759271*(alpha_vdim[17][l]*f[63][l]+alpha_vdim[6][l]*f[62][l]+alpha_vdim[32][l]*f[61][l]+alpha_vdim[33][l]*f[60][l]+alpha_vdim[1][l]*f[57][l]+alpha_vdim[18][l]*f[56][l]+alpha_vdim[19][l]*f[55][l]+alpha_vdim[47][l]*f[54][l]+alpha_vdim[0][l]*f[46][l]+alpha_vdim[7][l]*f[45][l]+alpha_vdim[8][l]*f[44][l]+f[10][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[42][l]+alpha_vdim[34][l]*f[41][l]+alpha_vdim[2][l]*f[31][l]+alpha_vdim[3][l]*f[30][l]+alpha_vdim[22][l]*f[29][l]+f[4][l]*alpha_vdim[28][l]+f[23][l]*alpha_vdim[27][l]+f[24][l]*alpha_vdim[26][l]+alpha_vdim[5][l]*f[25][l]+alpha_vdim[9][l]*f[16][l]+f[11][l]*alpha_vdim[15][l]+f[12][l]*alpha_vdim[14][l]);
+    out[84][l] += 0.2165063509461096*f[75][l]*alpha_vdim[363][l]+0.1936491673103708*f[12][l]*alpha_vdim[362][l]+0.2165063509461096*(f[82][l]*alpha_vdim[348][l]+f[83][l]*alpha_vdim[347][l]+f[68][l]*alpha_vdim[346][l])+0.1936491673103708*(f[24][l]*alpha_vdim[345][l]+f[25][l]*alpha_vdim[344][l]+f[4][l]*alpha_vdim[343][l])+0.2165063509461096*(f[67][l]*alpha_vdim[342][l]+f[90][l]*alpha_vdim[335][l]+f[73][l]*alpha_vdim[334][l]+f[74][l]*alpha_vdim[333][l])+0.1936491673103708*(f[42][l]*alpha_vdim[332][l]+f[10][l]*alpha_vdim[331][l]+f[11][l]*alpha_vdim[330][l])+0.2165063509461096*(f[71][l]*alpha_vdim[329][l]+f[72][l]*alpha_vdim[328][l]+f[64][l]*alpha_vdim[327][l]+f[81][l]*alpha_vdim[325][l])+0.1936491673103708*f[23][l]*alpha_vdim[324][l]+0.2165063509461096*(f[80][l]*alpha_vdim[323][l]+f[65][l]*alpha_vdim[322][l]+f[66][l]*alpha_vdim[321][l]+f[70][l]*alpha_vdim[320][l]+f[87][l]*alpha_cdim[165][l]+f[76][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[19][l]*f[154][l]+alpha_vdim[33][l]*f[147][l]+alpha_vdim[34][l]*f[146][l]+alpha_vdim[6][l]*f[145][l]+alpha_vdim[47][l]*f[139][l]+alpha_vdim[17][l]*f[138][l]+alpha_vdim[18][l]*f[137][l]+alpha_vdim[32][l]*f[132][l])+0.2165063509461096*alpha_cdim[0][l]*f[77][l]+0.4841229182759271*(alpha_vdim[15][l]*f[63][l]+alpha_vdim[27][l]*f[62][l]+alpha_vdim[28][l]*f[61][l]+alpha_vdim[5][l]*f[60][l]+alpha_vdim[3][l]*f[58][l]+alpha_vdim[43][l]*f[56][l]+alpha_vdim[13][l]*f[55][l]+alpha_vdim[14][l]*f[54][l]+alpha_vdim[8][l]*f[50][l]+alpha_vdim[9][l]*f[49][l]+alpha_vdim[0][l]*f[48][l]+f[12][l]*alpha_vdim[47][l]+alpha_vdim[19][l]*f[42][l]+alpha_vdim[26][l]*f[41][l]+alpha_vdim[22][l]*f[37][l])+0.1936491673103708*alpha_cdim[4][l]*f[36][l]+0.4841229182759271*(alpha_vdim[1][l]*f[36][l]+alpha_vdim[2][l]*f[35][l]+f[24][l]*alpha_vdim[34][l]+f[25][l]*alpha_vdim[33][l]+f[4][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[23][l]+alpha_vdim[7][l]*f[20][l]+f[10][l]*alpha_vdim[18][l]+f[11][l]*alpha_vdim[17][l]);
+    out[85][l] += 0.2165063509461096*f[74][l]*alpha_vdim[363][l]+0.1936491673103708*f[11][l]*alpha_vdim[362][l]+0.2165063509461096*(f[81][l]*alpha_vdim[348][l]+f[68][l]*alpha_vdim[347][l]+f[83][l]*alpha_vdim[346][l])+0.1936491673103708*(f[23][l]*alpha_vdim[345][l]+f[4][l]*alpha_vdim[344][l]+f[25][l]*alpha_vdim[343][l])+0.2165063509461096*(f[66][l]*alpha_vdim[342][l]+f[73][l]*alpha_vdim[335][l]+f[90][l]*alpha_vdim[334][l]+f[75][l]*alpha_vdim[333][l])+0.1936491673103708*(f[10][l]*alpha_vdim[332][l]+f[42][l]*alpha_vdim[331][l]+f[12][l]*alpha_vdim[330][l])+0.2165063509461096*(f[70][l]*alpha_vdim[329][l]+f[64][l]*alpha_vdim[328][l]+f[72][l]*alpha_vdim[327][l]+f[65][l]*alpha_cdim[326][l]+f[82][l]*alpha_vdim[325][l])+0.1936491673103708*f[24][l]*alpha_vdim[324][l]+0.2165063509461096*(f[65][l]*alpha_vdim[323][l]+f[80][l]*alpha_vdim[322][l]+f[67][l]*alpha_vdim[321][l]+f[71][l]*alpha_vdim[320][l]+f[76][l]*alpha_cdim[320][l])+0.4330127018922193*(alpha_vdim[18][l]*f[154][l]+alpha_vdim[32][l]*f[147][l]+alpha_vdim[6][l]*f[146][l]+alpha_vdim[34][l]*f[145][l]+alpha_vdim[17][l]*f[139][l]+alpha_vdim[47][l]*f[138][l]+alpha_vdim[19][l]*f[137][l]+alpha_vdim[33][l]*f[132][l])+0.2165063509461096*alpha_cdim[0][l]*f[78][l]+0.4841229182759271*(alpha_vdim[14][l]*f[63][l]+alpha_vdim[26][l]*f[62][l]+alpha_vdim[5][l]*f[61][l]+alpha_vdim[28][l]*f[60][l]+alpha_vdim[2][l]*f[58][l]+alpha_vdim[13][l]*f[56][l]+alpha_vdim[43][l]*f[55][l]+alpha_vdim[15][l]*f[54][l]+alpha_vdim[7][l]*f[50][l]+alpha_vdim[0][l]*f[49][l]+alpha_vdim[9][l]*f[48][l]+f[11][l]*alpha_vdim[47][l]+alpha_vdim[18][l]*f[42][l]+alpha_vdim[27][l]*f[41][l])+0.1936491673103708*alpha_cdim[4][l]*f[37][l]+0.4841229182759271*(alpha_vdim[1][l]*f[37][l]+alpha_vdim[22][l]*f[36][l]+alpha_vdim[3][l]*f[35][l]+f[23][l]*alpha_vdim[34][l]+f[4][l]*alpha_vdim[33][l]+f[25][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[24][l]+alpha_vdim[8][l]*f[20][l]+f[10][l]*alpha_vdim[19][l]+f[12][l]*alpha_vdim[17][l]);
+    out[86][l] += 0.2165063509461096*f[73][l]*alpha_vdim[363][l]+0.1936491673103708*f[10][l]*alpha_vdim[362][l]+0.2165063509461096*(f[68][l]*alpha_vdim[348][l]+f[81][l]*alpha_vdim[347][l]+f[82][l]*alpha_vdim[346][l])+0.1936491673103708*(f[4][l]*alpha_vdim[345][l]+f[23][l]*alpha_vdim[344][l]+f[24][l]*alpha_vdim[343][l])+0.2165063509461096*(f[65][l]*alpha_vdim[342][l]+f[74][l]*alpha_vdim[335][l]+f[75][l]*alpha_vdim[334][l]+f[90][l]*alpha_vdim[333][l])+0.1936491673103708*(f[11][l]*alpha_vdim[332][l]+f[12][l]*alpha_vdim[331][l]+f[42][l]*alpha_vdim[330][l])+0.2165063509461096*(f[64][l]*alpha_vdim[329][l]+f[70][l]*alpha_vdim[328][l]+f[71][l]*alpha_vdim[327][l]+f[66][l]*alpha_cdim[326][l]+f[83][l]*alpha_vdim[325][l])+0.1936491673103708*f[25][l]*alpha_vdim[324][l]+0.2165063509461096*(f[66][l]*alpha_vdim[323][l]+f[67][l]*alpha_vdim[322][l]+f[80][l]*alpha_vdim[321][l]+f[72][l]*alpha_vdim[320][l]+f[77][l]*alpha_cdim[320][l]+f[89][l]*alpha_cdim[165][l]+f[78][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[17][l]*f[154][l]+alpha_vdim[6][l]*f[147][l]+alpha_vdim[32][l]*f[146][l]+alpha_vdim[33][l]*f[145][l]+alpha_vdim[18][l]*f[139][l]+alpha_vdim[19][l]*f[138][l]+alpha_vdim[47][l]*f[137][l]+alpha_vdim[34][l]*f[132][l])+0.4841229182759271*(alpha_vdim[13][l]*f[63][l]+alpha_vdim[5][l]*f[62][l]+alpha_vdim[26][l]*f[61][l]+alpha_vdim[27][l]*f[60][l]+alpha_vdim[1][l]*f[58][l]+alpha_vdim[14][l]*f[56][l]+alpha_vdim[15][l]*f[55][l]+alpha_vdim[43][l]*f[54][l]+alpha_vdim[0][l]*f[50][l]+alpha_vdim[7][l]*f[49][l]+alpha_vdim[8][l]*f[48][l]+f[10][l]*alpha_vdim[47][l]+alpha_vdim[17][l]*f[42][l]+alpha_vdim[28][l]*f[41][l]+alpha_vdim[2][l]*f[37][l]+alpha_vdim[3][l]*f[36][l]+alpha_vdim[22][l]*f[35][l]+f[4][l]*alpha_vdim[34][l]+f[23][l]*alpha_vdim[33][l]+f[24][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[25][l]+alpha_vdim[9][l]*f[20][l]+f[11][l]*alpha_vdim[19][l]+f[12][l]*alpha_vdim[18][l]);
+    out[87][l] += 0.2165063509461096*f[72][l]*alpha_vdim[363][l]+0.1936491673103708*f[46][l]*alpha_vdim[362][l]+0.2165063509461096*(f[80][l]*alpha_vdim[348][l]+f[67][l]*alpha_vdim[347][l]+f[66][l]*alpha_vdim[346][l])+0.1936491673103708*(f[57][l]*alpha_vdim[345][l]+f[31][l]*alpha_vdim[344][l]+f[30][l]*alpha_vdim[343][l])+0.2165063509461096*(f[83][l]*alpha_vdim[342][l]+f[71][l]*alpha_vdim[335][l]+f[70][l]*alpha_vdim[334][l]+f[64][l]*alpha_vdim[333][l])+0.1936491673103708*(f[45][l]*alpha_vdim[332][l]+f[44][l]*alpha_vdim[331][l]+f[16][l]*alpha_vdim[330][l])+0.2165063509461096*(f[90][l]*alpha_vdim[329][l]+f[75][l]*alpha_vdim[328][l]+f[74][l]*alpha_vdim[327][l]+f[65][l]*alpha_vdim[325][l])+0.1936491673103708*f[29][l]*alpha_vdim[324][l]+0.2165063509461096*(f[82][l]*alpha_vdim[323][l]+f[81][l]*alpha_vdim[322][l]+f[68][l]*alpha_vdim[321][l]+f[73][l]*alpha_vdim[320][l]+f[72][l]*alpha_vdim[207][l])+0.1936491673103708*f[50][l]*alpha_vdim[202][l]+0.2165063509461096*(f[80][l]*alpha_vdim[194][l]+f[67][l]*alpha_vdim[193][l]+f[66][l]*alpha_vdim[192][l])+0.1936491673103708*(f[58][l]*alpha_vdim[185][l]+f[37][l]*alpha_vdim[184][l]+f[36][l]*alpha_vdim[183][l])+0.2165063509461096*(f[86][l]*alpha_vdim[182][l]+f[71][l]*alpha_vdim[179][l]+f[70][l]*alpha_vdim[178][l]+f[64][l]*alpha_vdim[177][l])+0.1936491673103708*(f[49][l]*alpha_vdim[172][l]+f[48][l]*alpha_vdim[171][l]+f[20][l]*alpha_vdim[170][l])+0.2165063509461096*(f[91][l]*alpha_vdim[169][l]+f[78][l]*alpha_vdim[168][l]+f[77][l]*alpha_vdim[167][l]+f[65][l]*alpha_vdim[166][l])+0.1936491673103708*f[35][l]*alpha_vdim[164][l]+0.2165063509461096*(f[85][l]*alpha_vdim[163][l]+f[84][l]*alpha_vdim[162][l]+f[69][l]*alpha_vdim[161][l]+f[76][l]*alpha_vdim[160][l])+0.4330127018922193*(alpha_vdim[34][l]*f[159][l]+alpha_vdim[47][l]*f[158][l]+alpha_vdim[19][l]*f[157][l]+alpha_vdim[18][l]*f[156][l]+alpha_vdim[33][l]*f[153][l]+alpha_vdim[32][l]*f[152][l]+alpha_vdim[6][l]*f[151][l]+alpha_vdim[17][l]*f[143][l]+alpha_vdim[28][l]*f[127][l]+alpha_vdim[43][l]*f[126][l]+alpha_vdim[15][l]*f[125][l]+alpha_vdim[14][l]*f[124][l]+alpha_vdim[27][l]*f[121][l]+alpha_vdim[26][l]*f[120][l]+alpha_vdim[5][l]*f[119][l]+alpha_vdim[13][l]*f[111][l])+0.2165063509461096*alpha_cdim[0][l]*f[79][l]+0.4841229182759271*(alpha_vdim[9][l]*f[63][l]+alpha_vdim[22][l]*f[62][l]+alpha_vdim[3][l]*f[61][l]+alpha_vdim[2][l]*f[60][l]+alpha_vdim[28][l]*f[58][l]+alpha_vdim[34][l]*f[57][l]+alpha_vdim[8][l]*f[56][l]+alpha_vdim[7][l]*f[55][l]+alpha_vdim[0][l]*f[54][l]+alpha_vdim[43][l]*f[50][l]+alpha_vdim[15][l]*f[49][l]+alpha_vdim[14][l]*f[48][l]+f[46][l]*alpha_vdim[47][l]+alpha_vdim[19][l]*f[45][l]+alpha_vdim[18][l]*f[44][l])+0.1936491673103708*alpha_cdim[4][l]*f[41][l]+0.4841229182759271*(alpha_vdim[1][l]*f[41][l]+alpha_vdim[27][l]*f[37][l]+alpha_vdim[26][l]*f[36][l]+alpha_vdim[5][l]*f[35][l]+f[31][l]*alpha_vdim[33][l]+f[30][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[29][l]+alpha_vdim[13][l]*f[20][l]+f[16][l]*alpha_vdim[17][l]);
+    out[88][l] += 0.2165063509461096*f[71][l]*alpha_vdim[363][l]+0.1936491673103708*f[45][l]*alpha_vdim[362][l]+0.2165063509461096*(f[67][l]*alpha_vdim[348][l]+f[80][l]*alpha_vdim[347][l]+f[65][l]*alpha_vdim[346][l])+0.1936491673103708*(f[31][l]*alpha_vdim[345][l]+f[57][l]*alpha_vdim[344][l]+f[29][l]*alpha_vdim[343][l])+0.2165063509461096*(f[82][l]*alpha_vdim[342][l]+f[72][l]*alpha_vdim[335][l]+f[64][l]*alpha_vdim[334][l]+f[70][l]*alpha_vdim[333][l])+0.1936491673103708*(f[46][l]*alpha_vdim[332][l]+f[16][l]*alpha_vdim[331][l]+f[44][l]*alpha_vdim[330][l])+0.2165063509461096*(f[75][l]*alpha_vdim[329][l]+f[90][l]*alpha_vdim[328][l]+f[73][l]*alpha_vdim[327][l]+f[66][l]*alpha_vdim[325][l])+0.1936491673103708*f[30][l]*alpha_vdim[324][l]+0.2165063509461096*(f[83][l]*alpha_vdim[323][l]+f[68][l]*alpha_vdim[322][l]+f[81][l]*alpha_vdim[321][l]+f[74][l]*alpha_vdim[320][l]+f[71][l]*alpha_vdim[207][l])+0.1936491673103708*f[49][l]*alpha_vdim[202][l]+0.2165063509461096*(f[67][l]*alpha_vdim[194][l]+f[80][l]*alpha_vdim[193][l]+f[65][l]*alpha_vdim[192][l])+0.1936491673103708*(f[37][l]*alpha_vdim[185][l]+f[58][l]*alpha_vdim[184][l]+f[35][l]*alpha_vdim[183][l])+0.2165063509461096*(f[85][l]*alpha_vdim[182][l]+f[72][l]*alpha_vdim[179][l]+f[64][l]*alpha_vdim[178][l]+f[70][l]*alpha_vdim[177][l])+0.1936491673103708*(f[50][l]*alpha_vdim[172][l]+f[20][l]*alpha_vdim[171][l]+f[48][l]*alpha_vdim[170][l])+0.2165063509461096*(f[78][l]*alpha_vdim[169][l]+f[91][l]*alpha_vdim[168][l]+f[76][l]*alpha_vdim[167][l]+f[66][l]*alpha_vdim[166][l]+f[69][l]*alpha_cdim[165][l])+0.1936491673103708*f[36][l]*alpha_vdim[164][l]+0.2165063509461096*(f[86][l]*alpha_vdim[163][l]+f[69][l]*alpha_vdim[162][l]+f[84][l]*alpha_vdim[161][l]+f[77][l]*alpha_vdim[160][l]+f[79][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[33][l]*f[159][l]+alpha_vdim[19][l]*f[158][l]+alpha_vdim[47][l]*f[157][l]+alpha_vdim[17][l]*f[156][l]+alpha_vdim[34][l]*f[153][l]+alpha_vdim[6][l]*f[152][l]+alpha_vdim[32][l]*f[151][l]+alpha_vdim[18][l]*f[143][l]+alpha_vdim[27][l]*f[127][l]+alpha_vdim[15][l]*f[126][l]+alpha_vdim[43][l]*f[125][l]+alpha_vdim[13][l]*f[124][l]+alpha_vdim[28][l]*f[121][l]+alpha_vdim[5][l]*f[120][l]+alpha_vdim[26][l]*f[119][l]+alpha_vdim[14][l]*f[111][l])+0.4841229182759271*(alpha_vdim[8][l]*f[63][l]+alpha_vdim[3][l]*f[62][l]+alpha_vdim[22][l]*f[61][l]+alpha_vdim[1][l]*f[60][l]+alpha_vdim[27][l]*f[58][l]+alpha_vdim[33][l]*f[57][l]+alpha_vdim[9][l]*f[56][l]+alpha_vdim[0][l]*f[55][l]+alpha_vdim[7][l]*f[54][l]+alpha_vdim[15][l]*f[50][l]+alpha_vdim[43][l]*f[49][l]+alpha_vdim[13][l]*f[48][l]+f[45][l]*alpha_vdim[47][l]+alpha_vdim[19][l]*f[46][l]+alpha_vdim[17][l]*f[44][l]+alpha_vdim[2][l]*f[41][l]+alpha_vdim[28][l]*f[37][l]+alpha_vdim[5][l]*f[36][l]+alpha_vdim[26][l]*f[35][l]+f[31][l]*alpha_vdim[34][l]+f[29][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[30][l]+alpha_vdim[14][l]*f[20][l]+f[16][l]*alpha_vdim[18][l]);
+    out[89][l] += 0.2165063509461096*f[70][l]*alpha_vdim[363][l]+0.1936491673103708*f[44][l]*alpha_vdim[362][l]+0.2165063509461096*(f[66][l]*alpha_vdim[348][l]+f[65][l]*alpha_vdim[347][l]+f[80][l]*alpha_vdim[346][l])+0.1936491673103708*(f[30][l]*alpha_vdim[345][l]+f[29][l]*alpha_vdim[344][l]+f[57][l]*alpha_vdim[343][l])+0.2165063509461096*(f[81][l]*alpha_vdim[342][l]+f[64][l]*alpha_vdim[335][l]+f[72][l]*alpha_vdim[334][l]+f[71][l]*alpha_vdim[333][l])+0.1936491673103708*(f[16][l]*alpha_vdim[332][l]+f[46][l]*alpha_vdim[331][l]+f[45][l]*alpha_vdim[330][l])+0.2165063509461096*(f[74][l]*alpha_vdim[329][l]+f[73][l]*alpha_vdim[328][l]+f[90][l]*alpha_vdim[327][l]+f[68][l]*alpha_cdim[326][l]+f[67][l]*alpha_vdim[325][l])+0.1936491673103708*f[31][l]*alpha_vdim[324][l]+0.2165063509461096*(f[68][l]*alpha_vdim[323][l]+f[83][l]*alpha_vdim[322][l]+f[82][l]*alpha_vdim[321][l]+f[75][l]*alpha_vdim[320][l]+f[79][l]*alpha_cdim[320][l]+f[70][l]*alpha_vdim[207][l])+0.1936491673103708*f[48][l]*alpha_vdim[202][l]+0.2165063509461096*(f[66][l]*alpha_vdim[194][l]+f[65][l]*alpha_vdim[193][l]+f[80][l]*alpha_vdim[192][l])+0.1936491673103708*(f[36][l]*alpha_vdim[185][l]+f[35][l]*alpha_vdim[184][l]+f[58][l]*alpha_vdim[183][l])+0.2165063509461096*(f[84][l]*alpha_vdim[182][l]+f[64][l]*alpha_vdim[179][l]+f[72][l]*alpha_vdim[178][l]+f[71][l]*alpha_vdim[177][l])+0.1936491673103708*(f[20][l]*alpha_vdim[172][l]+f[50][l]*alpha_vdim[171][l]+f[49][l]*alpha_vdim[170][l])+0.2165063509461096*(f[77][l]*alpha_vdim[169][l]+f[76][l]*alpha_vdim[168][l]+f[91][l]*alpha_vdim[167][l]+f[67][l]*alpha_vdim[166][l])+0.1936491673103708*f[37][l]*alpha_vdim[164][l]+0.2165063509461096*(f[69][l]*alpha_vdim[163][l]+f[86][l]*alpha_vdim[162][l]+f[85][l]*alpha_vdim[161][l]+f[78][l]*alpha_vdim[160][l])+0.4330127018922193*(alpha_vdim[32][l]*f[159][l]+alpha_vdim[18][l]*f[158][l]+alpha_vdim[17][l]*f[157][l]+alpha_vdim[47][l]*f[156][l]+alpha_vdim[6][l]*f[153][l]+alpha_vdim[34][l]*f[152][l]+alpha_vdim[33][l]*f[151][l]+alpha_vdim[19][l]*f[143][l]+alpha_vdim[26][l]*f[127][l]+alpha_vdim[14][l]*f[126][l]+alpha_vdim[13][l]*f[125][l]+alpha_vdim[43][l]*f[124][l]+alpha_vdim[5][l]*f[121][l]+alpha_vdim[28][l]*f[120][l]+alpha_vdim[27][l]*f[119][l]+alpha_vdim[15][l]*f[111][l])+0.4841229182759271*(alpha_vdim[7][l]*f[63][l]+alpha_vdim[2][l]*f[62][l]+alpha_vdim[1][l]*f[61][l]+alpha_vdim[22][l]*f[60][l]+alpha_vdim[26][l]*f[58][l]+alpha_vdim[32][l]*f[57][l]+alpha_vdim[0][l]*f[56][l]+alpha_vdim[9][l]*f[55][l]+alpha_vdim[8][l]*f[54][l]+alpha_vdim[14][l]*f[50][l]+alpha_vdim[13][l]*f[49][l]+alpha_vdim[43][l]*f[48][l]+f[44][l]*alpha_vdim[47][l]+alpha_vdim[18][l]*f[46][l]+alpha_vdim[17][l]*f[45][l]+alpha_vdim[3][l]*f[41][l]+alpha_vdim[5][l]*f[37][l]+alpha_vdim[28][l]*f[36][l]+alpha_vdim[27][l]*f[35][l]+f[30][l]*alpha_vdim[34][l]+f[29][l]*alpha_vdim[33][l]+alpha_vdim[6][l]*f[31][l]+alpha_vdim[15][l]*f[20][l]+f[16][l]*alpha_vdim[19][l]);
+    out[90][l] += 0.2165063509461096*(f[92][l]*alpha_cdim[326][l]+f[81][l]*alpha_cdim[320][l]+f[69][l]*alpha_vdim[207][l])+0.1936491673103708*f[4][l]*alpha_vdim[202][l]+0.2165063509461096*(f[76][l]*alpha_vdim[194][l]+f[77][l]*alpha_vdim[193][l]+f[78][l]*alpha_vdim[192][l])+0.1936491673103708*(f[10][l]*alpha_vdim[185][l]+f[11][l]*alpha_vdim[184][l]+f[12][l]*alpha_vdim[183][l])+0.2165063509461096*(f[64][l]*alpha_vdim[182][l]+f[84][l]*alpha_vdim[179][l]+f[85][l]*alpha_vdim[178][l]+f[86][l]*alpha_vdim[177][l])+0.1936491673103708*(f[23][l]*alpha_vdim[172][l]+f[24][l]*alpha_vdim[171][l]+f[25][l]*alpha_vdim[170][l])+0.2165063509461096*(f[65][l]*alpha_vdim[169][l]+f[66][l]*alpha_vdim[168][l]+f[67][l]*alpha_vdim[167][l]+f[91][l]*alpha_vdim[166][l]+f[71][l]*alpha_cdim[165][l])+0.1936491673103708*f[42][l]*alpha_vdim[164][l]+0.2165063509461096*(f[70][l]*alpha_vdim[163][l]+f[71][l]*alpha_vdim[162][l]+f[72][l]*alpha_vdim[161][l]+f[80][l]*alpha_vdim[160][l]+f[82][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[5][l]*f[122][l]+alpha_vdim[13][l]*f[115][l]+alpha_vdim[14][l]*f[114][l]+alpha_vdim[15][l]*f[113][l]+alpha_vdim[26][l]*f[107][l]+alpha_vdim[27][l]*f[106][l]+alpha_vdim[28][l]*f[105][l]+alpha_vdim[43][l]*f[100][l])+0.2165063509461096*alpha_cdim[0][l]*f[83][l]+0.4841229182759271*(alpha_vdim[6][l]*f[63][l]+alpha_vdim[17][l]*f[62][l]+alpha_vdim[18][l]*f[61][l]+alpha_vdim[19][l]*f[60][l]+alpha_vdim[0][l]*f[57][l]+alpha_vdim[32][l]*f[56][l]+alpha_vdim[33][l]*f[55][l]+alpha_vdim[34][l]*f[54][l]+f[41][l]*alpha_vdim[47][l])+0.1936491673103708*alpha_cdim[4][l]*f[46][l]+0.4841229182759271*(alpha_vdim[1][l]*f[46][l]+alpha_vdim[2][l]*f[45][l]+alpha_vdim[3][l]*f[44][l]+f[4][l]*alpha_vdim[43][l]+alpha_vdim[5][l]*f[42][l]+alpha_vdim[7][l]*f[31][l]+alpha_vdim[8][l]*f[30][l]+alpha_vdim[9][l]*f[29][l]+f[10][l]*alpha_vdim[28][l]+f[11][l]*alpha_vdim[27][l]+f[12][l]*alpha_vdim[26][l]+alpha_vdim[13][l]*f[25][l]+alpha_vdim[14][l]*f[24][l]+alpha_vdim[15][l]*f[23][l]+f[16][l]*alpha_vdim[22][l]);
+    out[91][l] += 0.2165063509461096*f[68][l]*alpha_vdim[363][l]+0.1936491673103708*f[4][l]*alpha_vdim[362][l]+0.2165063509461096*(f[73][l]*alpha_vdim[348][l]+f[74][l]*alpha_vdim[347][l]+f[75][l]*alpha_vdim[346][l])+0.1936491673103708*(f[10][l]*alpha_vdim[345][l]+f[11][l]*alpha_vdim[344][l]+f[12][l]*alpha_vdim[343][l])+0.2165063509461096*(f[64][l]*alpha_vdim[342][l]+f[81][l]*alpha_vdim[335][l]+f[82][l]*alpha_vdim[334][l]+f[83][l]*alpha_vdim[333][l])+0.1936491673103708*(f[23][l]*alpha_vdim[332][l]+f[24][l]*alpha_vdim[331][l]+f[25][l]*alpha_vdim[330][l])+0.2165063509461096*(f[65][l]*alpha_vdim[329][l]+f[66][l]*alpha_vdim[328][l]+f[67][l]*alpha_vdim[327][l]+f[70][l]*alpha_cdim[326][l]+f[90][l]*alpha_vdim[325][l])+0.1936491673103708*f[42][l]*alpha_vdim[324][l]+0.2165063509461096*(f[70][l]*alpha_vdim[323][l]+f[71][l]*alpha_vdim[322][l]+f[72][l]*alpha_vdim[321][l]+f[80][l]*alpha_vdim[320][l]+f[84][l]*alpha_cdim[320][l]+f[93][l]*alpha_cdim[165][l]+f[85][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[6][l]*f[154][l]+alpha_vdim[17][l]*f[147][l]+alpha_vdim[18][l]*f[146][l]+alpha_vdim[19][l]*f[145][l]+alpha_vdim[32][l]*f[139][l]+alpha_vdim[33][l]*f[138][l]+alpha_vdim[34][l]*f[137][l]+alpha_vdim[47][l]*f[132][l])+0.2165063509461096*alpha_cdim[0][l]*f[86][l]+0.4841229182759271*(alpha_vdim[5][l]*f[63][l]+alpha_vdim[13][l]*f[62][l]+alpha_vdim[14][l]*f[61][l]+alpha_vdim[15][l]*f[60][l]+alpha_vdim[0][l]*f[58][l]+alpha_vdim[26][l]*f[56][l]+alpha_vdim[27][l]*f[55][l]+alpha_vdim[28][l]*f[54][l])+0.1936491673103708*alpha_cdim[4][l]*f[50][l]+0.4841229182759271*(alpha_vdim[1][l]*f[50][l]+alpha_vdim[2][l]*f[49][l]+alpha_vdim[3][l]*f[48][l]+f[4][l]*alpha_vdim[47][l]+f[41][l]*alpha_vdim[43][l]+alpha_vdim[6][l]*f[42][l]+alpha_vdim[7][l]*f[37][l]+alpha_vdim[8][l]*f[36][l]+alpha_vdim[9][l]*f[35][l]+f[10][l]*alpha_vdim[34][l]+f[11][l]*alpha_vdim[33][l]+f[12][l]*alpha_vdim[32][l]+alpha_vdim[17][l]*f[25][l]+alpha_vdim[18][l]*f[24][l]+alpha_vdim[19][l]*f[23][l]+f[20][l]*alpha_vdim[22][l]);
+    out[92][l] += 0.2165063509461096*f[67][l]*alpha_vdim[363][l]+0.1936491673103708*f[31][l]*alpha_vdim[362][l]+0.2165063509461096*(f[71][l]*alpha_vdim[348][l]+f[72][l]*alpha_vdim[347][l]+f[64][l]*alpha_vdim[346][l])+0.1936491673103708*(f[45][l]*alpha_vdim[345][l]+f[46][l]*alpha_vdim[344][l]+f[16][l]*alpha_vdim[343][l])+0.2165063509461096*(f[75][l]*alpha_vdim[342][l]+f[80][l]*alpha_vdim[335][l]+f[65][l]*alpha_vdim[334][l]+f[66][l]*alpha_vdim[333][l])+0.1936491673103708*(f[57][l]*alpha_vdim[332][l]+f[29][l]*alpha_vdim[331][l]+f[30][l]*alpha_vdim[330][l])+0.2165063509461096*(f[82][l]*alpha_vdim[329][l]+f[83][l]*alpha_vdim[328][l]+f[68][l]*alpha_vdim[327][l]+f[70][l]*alpha_vdim[325][l])+0.1936491673103708*f[44][l]*alpha_vdim[324][l]+0.2165063509461096*(f[90][l]*alpha_vdim[323][l]+f[73][l]*alpha_vdim[322][l]+f[74][l]*alpha_vdim[321][l]+f[81][l]*alpha_vdim[320][l]+f[67][l]*alpha_vdim[207][l])+0.1936491673103708*f[37][l]*alpha_vdim[202][l]+0.2165063509461096*(f[71][l]*alpha_vdim[194][l]+f[72][l]*alpha_vdim[193][l]+f[64][l]*alpha_vdim[192][l])+0.1936491673103708*(f[49][l]*alpha_vdim[185][l]+f[50][l]*alpha_vdim[184][l]+f[20][l]*alpha_vdim[183][l])+0.2165063509461096*(f[78][l]*alpha_vdim[182][l]+f[80][l]*alpha_vdim[179][l]+f[65][l]*alpha_vdim[178][l]+f[66][l]*alpha_vdim[177][l])+0.1936491673103708*(f[58][l]*alpha_vdim[172][l]+f[35][l]*alpha_vdim[171][l]+f[36][l]*alpha_vdim[170][l])+0.2165063509461096*(f[85][l]*alpha_vdim[169][l]+f[86][l]*alpha_vdim[168][l]+f[69][l]*alpha_vdim[167][l]+f[70][l]*alpha_vdim[166][l]+f[76][l]*alpha_cdim[165][l])+0.1936491673103708*f[48][l]*alpha_vdim[164][l]+0.2165063509461096*(f[91][l]*alpha_vdim[163][l]+f[76][l]*alpha_vdim[162][l]+f[77][l]*alpha_vdim[161][l]+f[84][l]*alpha_vdim[160][l]+f[87][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[19][l]*f[159][l]+alpha_vdim[33][l]*f[158][l]+alpha_vdim[34][l]*f[157][l]+alpha_vdim[6][l]*f[156][l]+alpha_vdim[47][l]*f[153][l]+alpha_vdim[17][l]*f[152][l]+alpha_vdim[18][l]*f[151][l]+alpha_vdim[32][l]*f[143][l]+alpha_vdim[15][l]*f[127][l]+alpha_vdim[27][l]*f[126][l]+alpha_vdim[28][l]*f[125][l]+alpha_vdim[5][l]*f[124][l]+alpha_vdim[43][l]*f[121][l]+alpha_vdim[13][l]*f[120][l]+alpha_vdim[14][l]*f[119][l]+alpha_vdim[26][l]*f[111][l])+0.2165063509461096*alpha_cdim[0][l]*f[88][l]+0.4841229182759271*(alpha_vdim[3][l]*f[63][l]+alpha_vdim[8][l]*f[62][l]+alpha_vdim[9][l]*f[61][l]+alpha_vdim[0][l]*f[60][l]+alpha_vdim[15][l]*f[58][l]+alpha_vdim[19][l]*f[57][l]+alpha_vdim[22][l]*f[56][l])+0.1936491673103708*alpha_cdim[4][l]*f[55][l]+0.4841229182759271*(alpha_vdim[1][l]*f[55][l]+alpha_vdim[2][l]*f[54][l]+alpha_vdim[27][l]*f[50][l]+alpha_vdim[28][l]*f[49][l]+alpha_vdim[5][l]*f[48][l]+f[31][l]*alpha_vdim[47][l]+alpha_vdim[33][l]*f[46][l]+alpha_vdim[34][l]*f[45][l]+alpha_vdim[6][l]*f[44][l]+f[37][l]*alpha_vdim[43][l]+alpha_vdim[7][l]*f[41][l]+alpha_vdim[13][l]*f[36][l]+alpha_vdim[14][l]*f[35][l]+f[16][l]*alpha_vdim[32][l]+alpha_vdim[17][l]*f[30][l]+alpha_vdim[18][l]*f[29][l]+f[20][l]*alpha_vdim[26][l]);
+    out[93][l] += 0.2165063509461096*f[66][l]*alpha_vdim[363][l]+0.1936491673103708*f[30][l]*alpha_vdim[362][l]+0.2165063509461096*(f[70][l]*alpha_vdim[348][l]+f[64][l]*alpha_vdim[347][l]+f[72][l]*alpha_vdim[346][l])+0.1936491673103708*(f[44][l]*alpha_vdim[345][l]+f[16][l]*alpha_vdim[344][l]+f[46][l]*alpha_vdim[343][l])+0.2165063509461096*(f[74][l]*alpha_vdim[342][l]+f[65][l]*alpha_vdim[335][l]+f[80][l]*alpha_vdim[334][l]+f[67][l]*alpha_vdim[333][l])+0.1936491673103708*(f[29][l]*alpha_vdim[332][l]+f[57][l]*alpha_vdim[331][l]+f[31][l]*alpha_vdim[330][l])+0.2165063509461096*(f[81][l]*alpha_vdim[329][l]+f[68][l]*alpha_vdim[328][l]+f[83][l]*alpha_vdim[327][l]+f[73][l]*alpha_cdim[326][l]+f[71][l]*alpha_vdim[325][l])+0.1936491673103708*f[45][l]*alpha_vdim[324][l]+0.2165063509461096*(f[73][l]*alpha_vdim[323][l]+f[90][l]*alpha_vdim[322][l]+f[75][l]*alpha_vdim[321][l]+f[82][l]*alpha_vdim[320][l]+f[87][l]*alpha_cdim[320][l]+f[66][l]*alpha_vdim[207][l])+0.1936491673103708*f[36][l]*alpha_vdim[202][l]+0.2165063509461096*(f[70][l]*alpha_vdim[194][l]+f[64][l]*alpha_vdim[193][l]+f[72][l]*alpha_vdim[192][l])+0.1936491673103708*(f[48][l]*alpha_vdim[185][l]+f[20][l]*alpha_vdim[184][l]+f[50][l]*alpha_vdim[183][l])+0.2165063509461096*(f[77][l]*alpha_vdim[182][l]+f[65][l]*alpha_vdim[179][l]+f[80][l]*alpha_vdim[178][l]+f[67][l]*alpha_vdim[177][l])+0.1936491673103708*(f[35][l]*alpha_vdim[172][l]+f[58][l]*alpha_vdim[171][l]+f[37][l]*alpha_vdim[170][l])+0.2165063509461096*(f[84][l]*alpha_vdim[169][l]+f[69][l]*alpha_vdim[168][l]+f[86][l]*alpha_vdim[167][l]+f[71][l]*alpha_vdim[166][l])+0.1936491673103708*f[49][l]*alpha_vdim[164][l]+0.2165063509461096*(f[76][l]*alpha_vdim[163][l]+f[91][l]*alpha_vdim[162][l]+f[78][l]*alpha_vdim[161][l]+f[85][l]*alpha_vdim[160][l])+0.4330127018922193*(alpha_vdim[18][l]*f[159][l]+alpha_vdim[32][l]*f[158][l]+alpha_vdim[6][l]*f[157][l]+alpha_vdim[34][l]*f[156][l]+alpha_vdim[17][l]*f[153][l]+alpha_vdim[47][l]*f[152][l]+alpha_vdim[19][l]*f[151][l]+alpha_vdim[33][l]*f[143][l]+alpha_vdim[14][l]*f[127][l]+alpha_vdim[26][l]*f[126][l]+alpha_vdim[5][l]*f[125][l]+alpha_vdim[28][l]*f[124][l]+alpha_vdim[13][l]*f[121][l]+alpha_vdim[43][l]*f[120][l]+alpha_vdim[15][l]*f[119][l]+alpha_vdim[27][l]*f[111][l])+0.2165063509461096*alpha_cdim[0][l]*f[89][l]+0.4841229182759271*(alpha_vdim[2][l]*f[63][l]+alpha_vdim[7][l]*f[62][l]+alpha_vdim[0][l]*f[61][l]+alpha_vdim[9][l]*f[60][l]+alpha_vdim[14][l]*f[58][l]+alpha_vdim[18][l]*f[57][l])+0.1936491673103708*alpha_cdim[4][l]*f[56][l]+0.4841229182759271*(alpha_vdim[1][l]*f[56][l]+alpha_vdim[22][l]*f[55][l]+alpha_vdim[3][l]*f[54][l]+alpha_vdim[26][l]*f[50][l]+alpha_vdim[5][l]*f[49][l]+alpha_vdim[28][l]*f[48][l]+f[30][l]*alpha_vdim[47][l]+alpha_vdim[32][l]*f[46][l]+alpha_vdim[6][l]*f[45][l]+alpha_vdim[34][l]*f[44][l]+f[36][l]*alpha_vdim[43][l]+alpha_vdim[8][l]*f[41][l]+alpha_vdim[13][l]*f[37][l]+alpha_vdim[15][l]*f[35][l]+f[16][l]*alpha_vdim[33][l]+alpha_vdim[17][l]*f[31][l]+alpha_vdim[19][l]*f[29][l]+f[20][l]*alpha_vdim[27][l]);
+    out[94][l] += 0.2165063509461096*f[65][l]*alpha_vdim[363][l]+0.1936491673103708*f[29][l]*alpha_vdim[362][l]+0.2165063509461096*(f[64][l]*alpha_vdim[348][l]+f[70][l]*alpha_vdim[347][l]+f[71][l]*alpha_vdim[346][l])+0.1936491673103708*(f[16][l]*alpha_vdim[345][l]+f[44][l]*alpha_vdim[344][l]+f[45][l]*alpha_vdim[343][l])+0.2165063509461096*(f[73][l]*alpha_vdim[342][l]+f[66][l]*alpha_vdim[335][l]+f[67][l]*alpha_vdim[334][l]+f[80][l]*alpha_vdim[333][l])+0.1936491673103708*(f[30][l]*alpha_vdim[332][l]+f[31][l]*alpha_vdim[331][l]+f[57][l]*alpha_vdim[330][l])+0.2165063509461096*(f[68][l]*alpha_vdim[329][l]+f[81][l]*alpha_vdim[328][l]+f[82][l]*alpha_vdim[327][l]+f[74][l]*alpha_cdim[326][l]+f[72][l]*alpha_vdim[325][l])+0.1936491673103708*f[46][l]*alpha_vdim[324][l]+0.2165063509461096*(f[74][l]*alpha_vdim[323][l]+f[75][l]*alpha_vdim[322][l]+f[90][l]*alpha_vdim[321][l]+f[83][l]*alpha_vdim[320][l]+f[88][l]*alpha_cdim[320][l]+f[65][l]*alpha_vdim[207][l])+0.1936491673103708*f[35][l]*alpha_vdim[202][l]+0.2165063509461096*(f[64][l]*alpha_vdim[194][l]+f[70][l]*alpha_vdim[193][l]+f[71][l]*alpha_vdim[192][l])+0.1936491673103708*(f[20][l]*alpha_vdim[185][l]+f[48][l]*alpha_vdim[184][l]+f[49][l]*alpha_vdim[183][l])+0.2165063509461096*(f[76][l]*alpha_vdim[182][l]+f[66][l]*alpha_vdim[179][l]+f[67][l]*alpha_vdim[178][l]+f[80][l]*alpha_vdim[177][l])+0.1936491673103708*(f[36][l]*alpha_vdim[172][l]+f[37][l]*alpha_vdim[171][l]+f[58][l]*alpha_vdim[170][l])+0.2165063509461096*(f[69][l]*alpha_vdim[169][l]+f[84][l]*alpha_vdim[168][l]+f[85][l]*alpha_vdim[167][l]+f[72][l]*alpha_vdim[166][l]+f[78][l]*alpha_cdim[165][l])+0.1936491673103708*f[50][l]*alpha_vdim[164][l]+0.2165063509461096*(f[77][l]*alpha_vdim[163][l]+f[78][l]*alpha_vdim[162][l]+f[91][l]*alpha_vdim[161][l]+f[86][l]*alpha_vdim[160][l]+f[89][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[17][l]*f[159][l]+alpha_vdim[6][l]*f[158][l]+alpha_vdim[32][l]*f[157][l]+alpha_vdim[33][l]*f[156][l]+alpha_vdim[18][l]*f[153][l]+alpha_vdim[19][l]*f[152][l]+alpha_vdim[47][l]*f[151][l]+alpha_vdim[34][l]*f[143][l]+alpha_vdim[13][l]*f[127][l]+alpha_vdim[5][l]*f[126][l]+alpha_vdim[26][l]*f[125][l]+alpha_vdim[27][l]*f[124][l]+alpha_vdim[14][l]*f[121][l]+alpha_vdim[15][l]*f[120][l]+alpha_vdim[43][l]*f[119][l]+alpha_vdim[28][l]*f[111][l])+0.4841229182759271*(alpha_vdim[1][l]*f[63][l]+alpha_vdim[0][l]*f[62][l]+alpha_vdim[7][l]*f[61][l]+alpha_vdim[8][l]*f[60][l]+alpha_vdim[13][l]*f[58][l]+alpha_vdim[17][l]*f[57][l]+alpha_vdim[2][l]*f[56][l]+alpha_vdim[3][l]*f[55][l]+alpha_vdim[22][l]*f[54][l]+alpha_vdim[5][l]*f[50][l]+alpha_vdim[26][l]*f[49][l]+alpha_vdim[27][l]*f[48][l]+f[29][l]*alpha_vdim[47][l]+alpha_vdim[6][l]*f[46][l]+alpha_vdim[32][l]*f[45][l]+alpha_vdim[33][l]*f[44][l]+f[35][l]*alpha_vdim[43][l]+alpha_vdim[9][l]*f[41][l]+alpha_vdim[14][l]*f[37][l]+alpha_vdim[15][l]*f[36][l]+f[16][l]*alpha_vdim[34][l]+alpha_vdim[18][l]*f[31][l]+alpha_vdim[19][l]*f[30][l]+f[20][l]*alpha_vdim[28][l]);
+    out[95][l] += 0.2165063509461096*f[64][l]*alpha_vdim[363][l]+0.1936491673103708*f[16][l]*alpha_vdim[362][l]+0.2165063509461096*(f[65][l]*alpha_vdim[348][l]+f[66][l]*alpha_vdim[347][l]+f[67][l]*alpha_vdim[346][l])+0.1936491673103708*(f[29][l]*alpha_vdim[345][l]+f[30][l]*alpha_vdim[344][l]+f[31][l]*alpha_vdim[343][l])+0.2165063509461096*(f[68][l]*alpha_vdim[342][l]+f[70][l]*alpha_vdim[335][l]+f[71][l]*alpha_vdim[334][l]+f[72][l]*alpha_vdim[333][l])+0.1936491673103708*(f[44][l]*alpha_vdim[332][l]+f[45][l]*alpha_vdim[331][l]+f[46][l]*alpha_vdim[330][l])+0.2165063509461096*(f[73][l]*alpha_vdim[329][l]+f[74][l]*alpha_vdim[328][l]+f[75][l]*alpha_vdim[327][l]+f[81][l]*alpha_cdim[326][l]+f[80][l]*alpha_vdim[325][l])+0.1936491673103708*f[57][l]*alpha_vdim[324][l]+0.2165063509461096*(f[81][l]*alpha_vdim[323][l]+f[82][l]*alpha_vdim[322][l]+f[83][l]*alpha_vdim[321][l]+f[90][l]*alpha_vdim[320][l]+f[92][l]*alpha_cdim[320][l]+f[64][l]*alpha_vdim[207][l])+0.1936491673103708*f[20][l]*alpha_vdim[202][l]+0.2165063509461096*(f[65][l]*alpha_vdim[194][l]+f[66][l]*alpha_vdim[193][l]+f[67][l]*alpha_vdim[192][l])+0.1936491673103708*(f[35][l]*alpha_vdim[185][l]+f[36][l]*alpha_vdim[184][l]+f[37][l]*alpha_vdim[183][l])+0.2165063509461096*(f[69][l]*alpha_vdim[182][l]+f[70][l]*alpha_vdim[179][l]+f[71][l]*alpha_vdim[178][l]+f[72][l]*alpha_vdim[177][l])+0.1936491673103708*(f[48][l]*alpha_vdim[172][l]+f[49][l]*alpha_vdim[171][l]+f[50][l]*alpha_vdim[170][l])+0.2165063509461096*(f[76][l]*alpha_vdim[169][l]+f[77][l]*alpha_vdim[168][l]+f[78][l]*alpha_vdim[167][l]+f[80][l]*alpha_vdim[166][l]+f[85][l]*alpha_cdim[165][l])+0.1936491673103708*f[58][l]*alpha_vdim[164][l]+0.2165063509461096*(f[84][l]*alpha_vdim[163][l]+f[85][l]*alpha_vdim[162][l]+f[86][l]*alpha_vdim[161][l]+f[91][l]*alpha_vdim[160][l]+f[93][l]*alpha_cdim[160][l])+0.4330127018922193*(alpha_vdim[6][l]*f[159][l]+alpha_vdim[17][l]*f[158][l]+alpha_vdim[18][l]*f[157][l]+alpha_vdim[19][l]*f[156][l]+alpha_vdim[32][l]*f[153][l]+alpha_vdim[33][l]*f[152][l]+alpha_vdim[34][l]*f[151][l]+alpha_vdim[47][l]*f[143][l]+alpha_vdim[5][l]*f[127][l]+alpha_vdim[13][l]*f[126][l]+alpha_vdim[14][l]*f[125][l]+alpha_vdim[15][l]*f[124][l]+alpha_vdim[26][l]*f[121][l]+alpha_vdim[27][l]*f[120][l]+alpha_vdim[28][l]*f[119][l]+alpha_vdim[43][l]*f[111][l])+0.2165063509461096*alpha_cdim[0][l]*f[94][l]+0.4841229182759271*alpha_vdim[0][l]*f[63][l]+0.1936491673103708*alpha_cdim[4][l]*f[62][l]+0.4841229182759271*(alpha_vdim[1][l]*f[62][l]+alpha_vdim[2][l]*f[61][l]+alpha_vdim[3][l]*f[60][l]+alpha_vdim[5][l]*f[58][l]+alpha_vdim[6][l]*f[57][l]+alpha_vdim[7][l]*f[56][l]+alpha_vdim[8][l]*f[55][l]+alpha_vdim[9][l]*f[54][l]+alpha_vdim[13][l]*f[50][l]+alpha_vdim[14][l]*f[49][l]+alpha_vdim[15][l]*f[48][l]+f[16][l]*alpha_vdim[47][l]+alpha_vdim[17][l]*f[46][l]+alpha_vdim[18][l]*f[45][l]+alpha_vdim[19][l]*f[44][l]+f[20][l]*alpha_vdim[43][l]+alpha_vdim[22][l]*f[41][l]+alpha_vdim[26][l]*f[37][l]+alpha_vdim[27][l]*f[36][l]+alpha_vdim[28][l]*f[35][l]+f[29][l]*alpha_vdim[34][l]+f[30][l]*alpha_vdim[33][l]+f[31][l]*alpha_vdim[32][l]);
+    out[96][l] += 0.4841229182759271*(f[59][l]*alpha_vdim[207][l]+f[57][l]*alpha_vdim[202][l]+f[53][l]*alpha_vdim[194][l]+f[52][l]*alpha_vdim[193][l]+f[51][l]*alpha_vdim[192][l]+f[46][l]*alpha_vdim[185][l]+f[45][l]*alpha_vdim[184][l]+f[44][l]*alpha_vdim[183][l]+f[43][l]*alpha_vdim[182][l]+f[40][l]*alpha_vdim[179][l]+f[39][l]*alpha_vdim[178][l]+f[38][l]*alpha_vdim[177][l]+f[31][l]*alpha_vdim[172][l]+f[30][l]*alpha_vdim[171][l]+f[29][l]*alpha_vdim[170][l]+f[28][l]*alpha_vdim[169][l]+f[27][l]*alpha_vdim[168][l]+f[26][l]*alpha_vdim[167][l]+f[21][l]*alpha_vdim[166][l]+f[16][l]*alpha_vdim[164][l]+f[15][l]*alpha_vdim[163][l]+f[14][l]*alpha_vdim[162][l]+f[13][l]*alpha_vdim[161][l]+f[5][l]*alpha_vdim[160][l]);
+    out[97][l] += 0.4841229182759271*(f[53][l]*alpha_vdim[207][l]+f[46][l]*alpha_vdim[202][l]+f[59][l]*alpha_vdim[194][l]+f[40][l]*alpha_vdim[193][l]+f[39][l]*alpha_vdim[192][l]+f[57][l]*alpha_vdim[185][l]+f[31][l]*alpha_vdim[184][l]+f[30][l]*alpha_vdim[183][l]+f[28][l]*alpha_vdim[182][l]+f[52][l]*alpha_vdim[179][l]+f[51][l]*alpha_vdim[178][l]+f[21][l]*alpha_vdim[177][l]+f[45][l]*alpha_vdim[172][l]+f[44][l]*alpha_vdim[171][l]+f[16][l]*alpha_vdim[170][l]+f[43][l]*alpha_vdim[169][l]+f[15][l]*alpha_vdim[168][l]+f[14][l]*alpha_vdim[167][l]+f[38][l]*alpha_vdim[166][l]+f[29][l]*alpha_vdim[164][l]+f[27][l]*alpha_vdim[163][l]+f[26][l]*alpha_vdim[162][l]+f[5][l]*alpha_vdim[161][l]+f[13][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_cdim[4][l]*f[100][l]+alpha_cdim[0][l]*f[96][l]);
+    out[98][l] += 0.4841229182759271*(f[52][l]*alpha_vdim[207][l]+f[45][l]*alpha_vdim[202][l]+f[40][l]*alpha_vdim[194][l]+f[59][l]*alpha_vdim[193][l]+f[38][l]*alpha_vdim[192][l]+f[31][l]*alpha_vdim[185][l]+f[57][l]*alpha_vdim[184][l]+f[29][l]*alpha_vdim[183][l]+f[27][l]*alpha_vdim[182][l]+f[53][l]*alpha_vdim[179][l]+f[21][l]*alpha_vdim[178][l]+f[51][l]*alpha_vdim[177][l]+f[46][l]*alpha_vdim[172][l]+f[16][l]*alpha_vdim[171][l]+f[44][l]*alpha_vdim[170][l]+f[15][l]*alpha_vdim[169][l]+f[43][l]*alpha_vdim[168][l]+f[13][l]*alpha_vdim[167][l]+f[39][l]*alpha_vdim[166][l])+0.1936491673103708*f[5][l]*alpha_cdim[165][l]+0.4841229182759271*(f[30][l]*alpha_vdim[164][l]+f[28][l]*alpha_vdim[163][l]+f[5][l]*alpha_vdim[162][l]+f[26][l]*alpha_vdim[161][l]+f[14][l]*alpha_vdim[160][l])+0.2165063509461096*f[96][l]*alpha_cdim[160][l];
+    out[99][l] += 0.2165063509461096*(f[101][l]*alpha_cdim[326][l]+f[96][l]*alpha_cdim[320][l])+0.4841229182759271*(f[51][l]*alpha_vdim[207][l]+f[44][l]*alpha_vdim[202][l]+f[39][l]*alpha_vdim[194][l]+f[38][l]*alpha_vdim[193][l]+f[59][l]*alpha_vdim[192][l]+f[30][l]*alpha_vdim[185][l]+f[29][l]*alpha_vdim[184][l]+f[57][l]*alpha_vdim[183][l]+f[26][l]*alpha_vdim[182][l]+f[21][l]*alpha_vdim[179][l]+f[53][l]*alpha_vdim[178][l]+f[52][l]*alpha_vdim[177][l]+f[16][l]*alpha_vdim[172][l]+f[46][l]*alpha_vdim[171][l]+f[45][l]*alpha_vdim[170][l]+f[14][l]*alpha_vdim[169][l]+f[13][l]*alpha_vdim[168][l]+f[43][l]*alpha_vdim[167][l]+f[40][l]*alpha_vdim[166][l]+f[31][l]*alpha_vdim[164][l]+f[5][l]*alpha_vdim[163][l]+f[28][l]*alpha_vdim[162][l]+f[27][l]*alpha_vdim[161][l]+f[15][l]*alpha_vdim[160][l]);
+    out[100][l] += 0.4841229182759271*f[63][l]*alpha_vdim[207][l]+0.4330127018922193*f[90][l]*alpha_vdim[202][l]+0.4841229182759271*(f[43][l]*alpha_vdim[202][l]+f[62][l]*alpha_vdim[194][l]+f[61][l]*alpha_vdim[193][l]+f[60][l]*alpha_vdim[192][l])+(0.4330127018922193*f[83][l]+0.4841229182759271*f[28][l])*alpha_vdim[185][l]+(0.4330127018922193*f[82][l]+0.4841229182759271*f[27][l])*alpha_vdim[184][l]+0.4330127018922193*f[81][l]*alpha_vdim[183][l]+0.4841229182759271*(f[26][l]*alpha_vdim[183][l]+f[57][l]*alpha_vdim[182][l]+f[56][l]*alpha_vdim[179][l]+f[55][l]*alpha_vdim[178][l]+f[54][l]*alpha_vdim[177][l])+(0.4330127018922193*f[75][l]+0.4841229182759271*f[15][l])*alpha_vdim[172][l]+(0.4330127018922193*f[74][l]+0.4841229182759271*f[14][l])*alpha_vdim[171][l]+0.4330127018922193*f[73][l]*alpha_vdim[170][l]+0.4841229182759271*(f[13][l]*alpha_vdim[170][l]+f[46][l]*alpha_vdim[169][l]+f[45][l]*alpha_vdim[168][l]+f[44][l]*alpha_vdim[167][l]+f[41][l]*alpha_vdim[166][l])+0.4330127018922193*f[68][l]*alpha_vdim[164][l]+0.4841229182759271*(f[5][l]*alpha_vdim[164][l]+f[31][l]*alpha_vdim[163][l]+f[30][l]*alpha_vdim[162][l]+f[29][l]*alpha_vdim[161][l]+f[16][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_vdim[47][l]*f[123][l]+alpha_vdim[34][l]*f[118][l]+alpha_vdim[33][l]*f[117][l]+alpha_vdim[32][l]*f[116][l]+alpha_vdim[22][l]*f[112][l]+alpha_vdim[19][l]*f[110][l]+alpha_vdim[18][l]*f[109][l]+alpha_vdim[17][l]*f[108][l]+alpha_vdim[9][l]*f[104][l]+alpha_vdim[8][l]*f[103][l]+alpha_vdim[7][l]*f[102][l]+alpha_vdim[6][l]*f[101][l]+alpha_vdim[3][l]*f[99][l]+alpha_vdim[2][l]*f[98][l]+alpha_vdim[1][l]*f[97][l]+alpha_vdim[0][l]*f[96][l])+0.1936491673103708*(alpha_vdim[43][l]*f[43][l]+alpha_vdim[28][l]*f[28][l]+alpha_vdim[27][l]*f[27][l]+alpha_vdim[26][l]*f[26][l]+alpha_vdim[15][l]*f[15][l]+alpha_vdim[14][l]*f[14][l]+alpha_vdim[13][l]*f[13][l]+alpha_vdim[5][l]*f[5][l]);
+    out[101][l] += 0.1936491673103708*f[43][l]*alpha_vdim[363][l]+0.2165063509461096*f[122][l]*alpha_vdim[362][l]+0.1936491673103708*(f[28][l]*alpha_vdim[348][l]+f[27][l]*alpha_vdim[347][l]+f[26][l]*alpha_vdim[346][l])+0.2165063509461096*(f[115][l]*alpha_vdim[345][l]+f[114][l]*alpha_vdim[344][l]+f[113][l]*alpha_vdim[343][l]+f[112][l]*alpha_vdim[342][l])+0.1936491673103708*(f[15][l]*alpha_vdim[335][l]+f[14][l]*alpha_vdim[334][l]+f[13][l]*alpha_vdim[333][l])+0.2165063509461096*(f[107][l]*alpha_vdim[332][l]+f[106][l]*alpha_vdim[331][l]+f[105][l]*alpha_vdim[330][l]+f[104][l]*alpha_vdim[329][l]+f[103][l]*alpha_vdim[328][l]+f[102][l]*alpha_vdim[327][l])+0.1936491673103708*f[5][l]*alpha_vdim[325][l]+0.2165063509461096*(f[100][l]*alpha_vdim[324][l]+f[99][l]*alpha_vdim[323][l]+f[98][l]*alpha_vdim[322][l]+f[97][l]*alpha_vdim[321][l]+f[96][l]*alpha_vdim[320][l])+0.4330127018922193*f[155][l]*alpha_vdim[207][l]+0.4841229182759271*(f[43][l]*alpha_vdim[207][l]+f[63][l]*alpha_vdim[202][l])+(0.4330127018922193*f[150][l]+0.4841229182759271*f[28][l])*alpha_vdim[194][l]+(0.4330127018922193*f[149][l]+0.4841229182759271*f[27][l])*alpha_vdim[193][l]+0.4330127018922193*f[148][l]*alpha_vdim[192][l]+0.4841229182759271*(f[26][l]*alpha_vdim[192][l]+f[62][l]*alpha_vdim[185][l]+f[61][l]*alpha_vdim[184][l]+f[60][l]*alpha_vdim[183][l]+f[59][l]*alpha_vdim[182][l])+(0.4330127018922193*f[142][l]+0.4841229182759271*f[15][l])*alpha_vdim[179][l]+(0.4330127018922193*f[141][l]+0.4841229182759271*f[14][l])*alpha_vdim[178][l]+0.4330127018922193*f[140][l]*alpha_vdim[177][l]+0.4841229182759271*(f[13][l]*alpha_vdim[177][l]+f[56][l]*alpha_vdim[172][l]+f[55][l]*alpha_vdim[171][l]+f[54][l]*alpha_vdim[170][l]+f[53][l]*alpha_vdim[169][l]+f[52][l]*alpha_vdim[168][l]+f[51][l]*alpha_vdim[167][l])+0.4330127018922193*f[133][l]*alpha_vdim[166][l]+0.4841229182759271*(f[5][l]*alpha_vdim[166][l]+f[41][l]*alpha_vdim[164][l]+f[40][l]*alpha_vdim[163][l]+f[39][l]*alpha_vdim[162][l]+f[38][l]*alpha_vdim[161][l]+f[21][l]*alpha_vdim[160][l]);
+    out[102][l] += 0.4841229182759271*(f[40][l]*alpha_vdim[207][l]+f[31][l]*alpha_vdim[202][l]+f[52][l]*alpha_vdim[194][l]+f[53][l]*alpha_vdim[193][l]+f[21][l]*alpha_vdim[192][l]+f[45][l]*alpha_vdim[185][l]+f[46][l]*alpha_vdim[184][l]+f[16][l]*alpha_vdim[183][l]+f[15][l]*alpha_vdim[182][l]+f[59][l]*alpha_vdim[179][l]+f[38][l]*alpha_vdim[178][l]+f[39][l]*alpha_vdim[177][l]+f[57][l]*alpha_vdim[172][l]+f[29][l]*alpha_vdim[171][l]+f[30][l]*alpha_vdim[170][l]+f[27][l]*alpha_vdim[169][l]+f[28][l]*alpha_vdim[168][l]+f[5][l]*alpha_vdim[167][l]+f[51][l]*alpha_vdim[166][l])+0.1936491673103708*f[13][l]*alpha_cdim[165][l]+0.4841229182759271*(f[44][l]*alpha_vdim[164][l]+f[43][l]*alpha_vdim[163][l]+f[13][l]*alpha_vdim[162][l]+f[14][l]*alpha_vdim[161][l]+f[26][l]*alpha_vdim[160][l])+0.2165063509461096*(f[97][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[106][l]+alpha_cdim[0][l]*f[98][l]);
+    out[103][l] += 0.2165063509461096*(f[108][l]*alpha_cdim[326][l]+f[97][l]*alpha_cdim[320][l])+0.4841229182759271*(f[39][l]*alpha_vdim[207][l]+f[30][l]*alpha_vdim[202][l]+f[51][l]*alpha_vdim[194][l]+f[21][l]*alpha_vdim[193][l]+f[53][l]*alpha_vdim[192][l]+f[44][l]*alpha_vdim[185][l]+f[16][l]*alpha_vdim[184][l]+f[46][l]*alpha_vdim[183][l]+f[14][l]*alpha_vdim[182][l]+f[38][l]*alpha_vdim[179][l]+f[59][l]*alpha_vdim[178][l]+f[40][l]*alpha_vdim[177][l]+f[29][l]*alpha_vdim[172][l]+f[57][l]*alpha_vdim[171][l]+f[31][l]*alpha_vdim[170][l]+f[26][l]*alpha_vdim[169][l]+f[5][l]*alpha_vdim[168][l]+f[28][l]*alpha_vdim[167][l]+f[52][l]*alpha_vdim[166][l]+f[45][l]*alpha_vdim[164][l]+f[13][l]*alpha_vdim[163][l]+f[43][l]*alpha_vdim[162][l]+f[15][l]*alpha_vdim[161][l]+f[27][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_cdim[4][l]*f[107][l]+alpha_cdim[0][l]*f[99][l]);
+    out[104][l] += 0.2165063509461096*(f[109][l]*alpha_cdim[326][l]+f[98][l]*alpha_cdim[320][l])+0.4841229182759271*(f[38][l]*alpha_vdim[207][l]+f[29][l]*alpha_vdim[202][l]+f[21][l]*alpha_vdim[194][l]+f[51][l]*alpha_vdim[193][l]+f[52][l]*alpha_vdim[192][l]+f[16][l]*alpha_vdim[185][l]+f[44][l]*alpha_vdim[184][l]+f[45][l]*alpha_vdim[183][l]+f[13][l]*alpha_vdim[182][l]+f[39][l]*alpha_vdim[179][l]+f[40][l]*alpha_vdim[178][l]+f[59][l]*alpha_vdim[177][l]+f[30][l]*alpha_vdim[172][l]+f[31][l]*alpha_vdim[171][l]+f[57][l]*alpha_vdim[170][l]+f[5][l]*alpha_vdim[169][l]+f[26][l]*alpha_vdim[168][l]+f[27][l]*alpha_vdim[167][l]+f[53][l]*alpha_vdim[166][l])+0.1936491673103708*f[15][l]*alpha_cdim[165][l]+0.4841229182759271*(f[46][l]*alpha_vdim[164][l]+f[14][l]*alpha_vdim[163][l]+f[15][l]*alpha_vdim[162][l]+f[43][l]*alpha_vdim[161][l]+f[28][l]*alpha_vdim[160][l])+0.2165063509461096*f[99][l]*alpha_cdim[160][l];
+    out[105][l] += 0.4841229182759271*f[62][l]*alpha_vdim[207][l]+0.4330127018922193*f[83][l]*alpha_vdim[202][l]+0.4841229182759271*(f[28][l]*alpha_vdim[202][l]+f[63][l]*alpha_vdim[194][l]+f[56][l]*alpha_vdim[193][l]+f[55][l]*alpha_vdim[192][l])+(0.4330127018922193*f[90][l]+0.4841229182759271*f[43][l])*alpha_vdim[185][l]+(0.4330127018922193*f[75][l]+0.4841229182759271*f[15][l])*alpha_vdim[184][l]+0.4330127018922193*f[74][l]*alpha_vdim[183][l]+0.4841229182759271*(f[14][l]*alpha_vdim[183][l]+f[46][l]*alpha_vdim[182][l]+f[61][l]*alpha_vdim[179][l]+f[60][l]*alpha_vdim[178][l]+f[41][l]*alpha_vdim[177][l])+(0.4330127018922193*f[82][l]+0.4841229182759271*f[27][l])*alpha_vdim[172][l]+(0.4330127018922193*f[81][l]+0.4841229182759271*f[26][l])*alpha_vdim[171][l]+0.4330127018922193*f[68][l]*alpha_vdim[170][l]+0.4841229182759271*(f[5][l]*alpha_vdim[170][l]+f[57][l]*alpha_vdim[169][l]+f[31][l]*alpha_vdim[168][l]+f[30][l]*alpha_vdim[167][l]+f[54][l]*alpha_vdim[166][l])+0.4330127018922193*f[73][l]*alpha_vdim[164][l]+0.4841229182759271*(f[13][l]*alpha_vdim[164][l]+f[45][l]*alpha_vdim[163][l]+f[44][l]*alpha_vdim[162][l]+f[16][l]*alpha_vdim[161][l]+f[29][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_vdim[34][l]*f[123][l]+alpha_vdim[47][l]*f[118][l]+alpha_vdim[19][l]*f[117][l]+alpha_vdim[18][l]*f[116][l]+alpha_vdim[9][l]*f[112][l]+alpha_vdim[33][l]*f[110][l]+alpha_vdim[32][l]*f[109][l]+alpha_vdim[6][l]*f[108][l]+alpha_vdim[22][l]*f[104][l]+alpha_vdim[3][l]*f[103][l]+alpha_vdim[2][l]*f[102][l]+alpha_vdim[17][l]*f[101][l]+alpha_cdim[0][l]*f[100][l]+alpha_vdim[8][l]*f[99][l]+alpha_vdim[7][l]*f[98][l]+alpha_vdim[0][l]*f[97][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[96][l])+0.1936491673103708*(alpha_vdim[28][l]*f[43][l]+f[28][l]*alpha_vdim[43][l]+alpha_vdim[15][l]*f[27][l]+f[15][l]*alpha_vdim[27][l]+alpha_vdim[14][l]*f[26][l]+f[14][l]*alpha_vdim[26][l]+alpha_vdim[5][l]*f[13][l]+f[5][l]*alpha_vdim[13][l]);
+    out[106][l] += 0.4841229182759271*f[61][l]*alpha_vdim[207][l]+0.4330127018922193*f[82][l]*alpha_vdim[202][l]+0.4841229182759271*(f[27][l]*alpha_vdim[202][l]+f[56][l]*alpha_vdim[194][l]+f[63][l]*alpha_vdim[193][l]+f[54][l]*alpha_vdim[192][l])+(0.4330127018922193*f[75][l]+0.4841229182759271*f[15][l])*alpha_vdim[185][l]+(0.4330127018922193*f[90][l]+0.4841229182759271*f[43][l])*alpha_vdim[184][l]+0.4330127018922193*f[73][l]*alpha_vdim[183][l]+0.4841229182759271*(f[13][l]*alpha_vdim[183][l]+f[45][l]*alpha_vdim[182][l]+f[62][l]*alpha_vdim[179][l]+f[41][l]*alpha_vdim[178][l]+f[60][l]*alpha_vdim[177][l])+(0.4330127018922193*f[83][l]+0.4841229182759271*f[28][l])*alpha_vdim[172][l]+(0.4330127018922193*f[68][l]+0.4841229182759271*f[5][l])*alpha_vdim[171][l]+0.4330127018922193*f[81][l]*alpha_vdim[170][l]+0.4841229182759271*(f[26][l]*alpha_vdim[170][l]+f[31][l]*alpha_vdim[169][l]+f[57][l]*alpha_vdim[168][l]+f[29][l]*alpha_vdim[167][l]+f[55][l]*alpha_vdim[166][l])+0.1936491673103708*f[16][l]*alpha_cdim[165][l]+0.4330127018922193*f[74][l]*alpha_vdim[164][l]+0.4841229182759271*(f[14][l]*alpha_vdim[164][l]+f[46][l]*alpha_vdim[163][l]+f[16][l]*alpha_vdim[162][l]+f[44][l]*alpha_vdim[161][l]+f[30][l]*alpha_vdim[160][l])+0.2165063509461096*(f[100][l]*alpha_cdim[160][l]+alpha_vdim[33][l]*f[123][l]+alpha_vdim[19][l]*f[118][l]+alpha_vdim[47][l]*f[117][l]+alpha_vdim[17][l]*f[116][l]+alpha_vdim[8][l]*f[112][l]+alpha_vdim[34][l]*f[110][l]+alpha_vdim[6][l]*f[109][l]+alpha_vdim[32][l]*f[108][l]+alpha_vdim[3][l]*f[104][l]+alpha_vdim[22][l]*f[103][l]+alpha_vdim[1][l]*f[102][l]+alpha_vdim[18][l]*f[101][l]+alpha_vdim[9][l]*f[99][l]+alpha_vdim[0][l]*f[98][l]+alpha_vdim[7][l]*f[97][l]+alpha_vdim[2][l]*f[96][l])+0.1936491673103708*(alpha_vdim[27][l]*f[43][l]+f[27][l]*alpha_vdim[43][l]+alpha_vdim[15][l]*f[28][l]+f[15][l]*alpha_vdim[28][l]+alpha_vdim[13][l]*f[26][l]+f[13][l]*alpha_vdim[26][l]+alpha_vdim[5][l]*f[14][l]+f[5][l]*alpha_vdim[14][l]);
+    out[107][l] += 0.2165063509461096*(f[111][l]*alpha_cdim[326][l]+f[100][l]*alpha_cdim[320][l])+0.4841229182759271*f[60][l]*alpha_vdim[207][l]+0.4330127018922193*f[81][l]*alpha_vdim[202][l]+0.4841229182759271*(f[26][l]*alpha_vdim[202][l]+f[55][l]*alpha_vdim[194][l]+f[54][l]*alpha_vdim[193][l]+f[63][l]*alpha_vdim[192][l])+(0.4330127018922193*f[74][l]+0.4841229182759271*f[14][l])*alpha_vdim[185][l]+(0.4330127018922193*f[73][l]+0.4841229182759271*f[13][l])*alpha_vdim[184][l]+0.4330127018922193*f[90][l]*alpha_vdim[183][l]+0.4841229182759271*(f[43][l]*alpha_vdim[183][l]+f[44][l]*alpha_vdim[182][l]+f[41][l]*alpha_vdim[179][l]+f[62][l]*alpha_vdim[178][l]+f[61][l]*alpha_vdim[177][l])+(0.4330127018922193*f[68][l]+0.4841229182759271*f[5][l])*alpha_vdim[172][l]+(0.4330127018922193*f[83][l]+0.4841229182759271*f[28][l])*alpha_vdim[171][l]+0.4330127018922193*f[82][l]*alpha_vdim[170][l]+0.4841229182759271*(f[27][l]*alpha_vdim[170][l]+f[30][l]*alpha_vdim[169][l]+f[29][l]*alpha_vdim[168][l]+f[57][l]*alpha_vdim[167][l]+f[56][l]*alpha_vdim[166][l])+0.4330127018922193*f[75][l]*alpha_vdim[164][l]+0.4841229182759271*(f[15][l]*alpha_vdim[164][l]+f[16][l]*alpha_vdim[163][l]+f[46][l]*alpha_vdim[162][l]+f[45][l]*alpha_vdim[161][l]+f[31][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_vdim[32][l]*f[123][l]+alpha_vdim[18][l]*f[118][l]+alpha_vdim[17][l]*f[117][l]+alpha_vdim[47][l]*f[116][l]+alpha_vdim[7][l]*f[112][l]+alpha_vdim[6][l]*f[110][l]+alpha_vdim[34][l]*f[109][l]+alpha_vdim[33][l]*f[108][l]+alpha_vdim[2][l]*f[104][l]+alpha_vdim[1][l]*f[103][l]+alpha_vdim[22][l]*f[102][l]+alpha_vdim[19][l]*f[101][l]+alpha_vdim[0][l]*f[99][l]+alpha_vdim[9][l]*f[98][l]+alpha_vdim[8][l]*f[97][l]+alpha_vdim[3][l]*f[96][l])+0.1936491673103708*(alpha_vdim[26][l]*f[43][l]+f[26][l]*alpha_vdim[43][l]+alpha_vdim[14][l]*f[28][l]+f[14][l]*alpha_vdim[28][l]+alpha_vdim[13][l]*f[27][l]+f[13][l]*alpha_vdim[27][l]+alpha_vdim[5][l]*f[15][l]+f[5][l]*alpha_vdim[15][l]);
+    out[108][l] += 0.1936491673103708*f[28][l]*alpha_vdim[363][l]+0.2165063509461096*f[115][l]*alpha_vdim[362][l]+0.1936491673103708*(f[43][l]*alpha_vdim[348][l]+f[15][l]*alpha_vdim[347][l]+f[14][l]*alpha_vdim[346][l])+0.2165063509461096*(f[122][l]*alpha_vdim[345][l]+f[107][l]*alpha_vdim[344][l]+f[106][l]*alpha_vdim[343][l]+f[104][l]*alpha_vdim[342][l])+0.1936491673103708*(f[27][l]*alpha_vdim[335][l]+f[26][l]*alpha_vdim[334][l]+f[5][l]*alpha_vdim[333][l])+0.2165063509461096*(f[114][l]*alpha_vdim[332][l]+f[113][l]*alpha_vdim[331][l]+f[100][l]*alpha_vdim[330][l]+f[112][l]*alpha_vdim[329][l]+f[99][l]*alpha_vdim[328][l]+f[98][l]*alpha_vdim[327][l])+0.1936491673103708*f[13][l]*alpha_vdim[325][l]+0.2165063509461096*(f[105][l]*alpha_vdim[324][l]+f[103][l]*alpha_vdim[323][l]+f[102][l]*alpha_vdim[322][l]+f[96][l]*alpha_vdim[321][l]+f[97][l]*alpha_vdim[320][l])+0.4330127018922193*f[150][l]*alpha_vdim[207][l]+0.4841229182759271*(f[28][l]*alpha_vdim[207][l]+f[62][l]*alpha_vdim[202][l])+(0.4330127018922193*f[155][l]+0.4841229182759271*f[43][l])*alpha_vdim[194][l]+(0.4330127018922193*f[142][l]+0.4841229182759271*f[15][l])*alpha_vdim[193][l]+0.4330127018922193*f[141][l]*alpha_vdim[192][l]+0.4841229182759271*(f[14][l]*alpha_vdim[192][l]+f[63][l]*alpha_vdim[185][l]+f[56][l]*alpha_vdim[184][l]+f[55][l]*alpha_vdim[183][l]+f[53][l]*alpha_vdim[182][l])+(0.4330127018922193*f[149][l]+0.4841229182759271*f[27][l])*alpha_vdim[179][l]+(0.4330127018922193*f[148][l]+0.4841229182759271*f[26][l])*alpha_vdim[178][l]+0.4330127018922193*f[133][l]*alpha_vdim[177][l]+0.4841229182759271*(f[5][l]*alpha_vdim[177][l]+f[61][l]*alpha_vdim[172][l]+f[60][l]*alpha_vdim[171][l]+f[41][l]*alpha_vdim[170][l]+f[59][l]*alpha_vdim[169][l]+f[40][l]*alpha_vdim[168][l]+f[39][l]*alpha_vdim[167][l])+0.4330127018922193*f[140][l]*alpha_vdim[166][l]+0.4841229182759271*(f[13][l]*alpha_vdim[166][l]+f[54][l]*alpha_vdim[164][l]+f[52][l]*alpha_vdim[163][l]+f[51][l]*alpha_vdim[162][l]+f[21][l]*alpha_vdim[161][l]+f[38][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_cdim[4][l]*f[111][l]+alpha_cdim[0][l]*f[101][l]);
+    out[109][l] += 0.1936491673103708*f[27][l]*alpha_vdim[363][l]+0.2165063509461096*f[114][l]*alpha_vdim[362][l]+0.1936491673103708*(f[15][l]*alpha_vdim[348][l]+f[43][l]*alpha_vdim[347][l]+f[13][l]*alpha_vdim[346][l])+0.2165063509461096*(f[107][l]*alpha_vdim[345][l]+f[122][l]*alpha_vdim[344][l]+f[105][l]*alpha_vdim[343][l]+f[103][l]*alpha_vdim[342][l])+0.1936491673103708*(f[28][l]*alpha_vdim[335][l]+f[5][l]*alpha_vdim[334][l]+f[26][l]*alpha_vdim[333][l])+0.2165063509461096*(f[115][l]*alpha_vdim[332][l]+f[100][l]*alpha_vdim[331][l]+f[113][l]*alpha_vdim[330][l]+f[99][l]*alpha_vdim[329][l]+f[112][l]*alpha_vdim[328][l]+f[97][l]*alpha_vdim[327][l])+0.1936491673103708*f[14][l]*alpha_vdim[325][l]+0.2165063509461096*(f[106][l]*alpha_vdim[324][l]+f[104][l]*alpha_vdim[323][l]+f[96][l]*alpha_vdim[322][l]+f[102][l]*alpha_vdim[321][l]+f[98][l]*alpha_vdim[320][l])+0.4330127018922193*f[149][l]*alpha_vdim[207][l]+0.4841229182759271*(f[27][l]*alpha_vdim[207][l]+f[61][l]*alpha_vdim[202][l])+(0.4330127018922193*f[142][l]+0.4841229182759271*f[15][l])*alpha_vdim[194][l]+(0.4330127018922193*f[155][l]+0.4841229182759271*f[43][l])*alpha_vdim[193][l]+0.4330127018922193*f[140][l]*alpha_vdim[192][l]+0.4841229182759271*(f[13][l]*alpha_vdim[192][l]+f[56][l]*alpha_vdim[185][l]+f[63][l]*alpha_vdim[184][l]+f[54][l]*alpha_vdim[183][l]+f[52][l]*alpha_vdim[182][l])+(0.4330127018922193*f[150][l]+0.4841229182759271*f[28][l])*alpha_vdim[179][l]+(0.4330127018922193*f[133][l]+0.4841229182759271*f[5][l])*alpha_vdim[178][l]+0.4330127018922193*f[148][l]*alpha_vdim[177][l]+0.4841229182759271*(f[26][l]*alpha_vdim[177][l]+f[62][l]*alpha_vdim[172][l]+f[41][l]*alpha_vdim[171][l]+f[60][l]*alpha_vdim[170][l]+f[40][l]*alpha_vdim[169][l]+f[59][l]*alpha_vdim[168][l]+f[38][l]*alpha_vdim[167][l])+(0.4330127018922193*f[141][l]+0.4841229182759271*f[14][l])*alpha_vdim[166][l]+0.1936491673103708*f[21][l]*alpha_cdim[165][l]+0.4841229182759271*(f[55][l]*alpha_vdim[164][l]+f[53][l]*alpha_vdim[163][l]+f[21][l]*alpha_vdim[162][l]+f[51][l]*alpha_vdim[161][l]+f[39][l]*alpha_vdim[160][l])+0.2165063509461096*f[101][l]*alpha_cdim[160][l];
+    out[110][l] += 0.1936491673103708*f[26][l]*alpha_vdim[363][l]+0.2165063509461096*f[113][l]*alpha_vdim[362][l]+0.1936491673103708*(f[14][l]*alpha_vdim[348][l]+f[13][l]*alpha_vdim[347][l]+f[43][l]*alpha_vdim[346][l])+0.2165063509461096*(f[106][l]*alpha_vdim[345][l]+f[105][l]*alpha_vdim[344][l]+f[122][l]*alpha_vdim[343][l]+f[102][l]*alpha_vdim[342][l])+0.1936491673103708*(f[5][l]*alpha_vdim[335][l]+f[28][l]*alpha_vdim[334][l]+f[27][l]*alpha_vdim[333][l])+0.2165063509461096*(f[100][l]*alpha_vdim[332][l]+f[115][l]*alpha_vdim[331][l]+f[114][l]*alpha_vdim[330][l]+f[98][l]*alpha_vdim[329][l]+f[97][l]*alpha_vdim[328][l]+f[112][l]*alpha_vdim[327][l]+f[96][l]*alpha_cdim[326][l])+0.1936491673103708*f[15][l]*alpha_vdim[325][l]+0.2165063509461096*(f[107][l]*alpha_vdim[324][l]+f[96][l]*alpha_vdim[323][l]+f[104][l]*alpha_vdim[322][l]+f[103][l]*alpha_vdim[321][l]+f[99][l]*alpha_vdim[320][l]+f[101][l]*alpha_cdim[320][l])+0.4330127018922193*f[148][l]*alpha_vdim[207][l]+0.4841229182759271*(f[26][l]*alpha_vdim[207][l]+f[60][l]*alpha_vdim[202][l])+(0.4330127018922193*f[141][l]+0.4841229182759271*f[14][l])*alpha_vdim[194][l]+(0.4330127018922193*f[140][l]+0.4841229182759271*f[13][l])*alpha_vdim[193][l]+0.4330127018922193*f[155][l]*alpha_vdim[192][l]+0.4841229182759271*(f[43][l]*alpha_vdim[192][l]+f[55][l]*alpha_vdim[185][l]+f[54][l]*alpha_vdim[184][l]+f[63][l]*alpha_vdim[183][l]+f[51][l]*alpha_vdim[182][l])+(0.4330127018922193*f[133][l]+0.4841229182759271*f[5][l])*alpha_vdim[179][l]+(0.4330127018922193*f[150][l]+0.4841229182759271*f[28][l])*alpha_vdim[178][l]+0.4330127018922193*f[149][l]*alpha_vdim[177][l]+0.4841229182759271*(f[27][l]*alpha_vdim[177][l]+f[41][l]*alpha_vdim[172][l]+f[62][l]*alpha_vdim[171][l]+f[61][l]*alpha_vdim[170][l]+f[39][l]*alpha_vdim[169][l]+f[38][l]*alpha_vdim[168][l]+f[59][l]*alpha_vdim[167][l])+0.4330127018922193*f[142][l]*alpha_vdim[166][l]+0.4841229182759271*(f[15][l]*alpha_vdim[166][l]+f[56][l]*alpha_vdim[164][l]+f[21][l]*alpha_vdim[163][l]+f[53][l]*alpha_vdim[162][l]+f[52][l]*alpha_vdim[161][l]+f[40][l]*alpha_vdim[160][l]);
+    out[111][l] += 0.1936491673103708*f[57][l]*alpha_vdim[363][l]+0.2165063509461096*f[112][l]*alpha_vdim[362][l]+0.1936491673103708*(f[46][l]*alpha_vdim[348][l]+f[45][l]*alpha_vdim[347][l]+f[44][l]*alpha_vdim[346][l])+0.2165063509461096*(f[104][l]*alpha_vdim[345][l]+f[103][l]*alpha_vdim[344][l]+f[102][l]*alpha_vdim[343][l]+f[122][l]*alpha_vdim[342][l])+0.1936491673103708*(f[31][l]*alpha_vdim[335][l]+f[30][l]*alpha_vdim[334][l]+f[29][l]*alpha_vdim[333][l])+0.2165063509461096*(f[99][l]*alpha_vdim[332][l]+f[98][l]*alpha_vdim[331][l]+f[97][l]*alpha_vdim[330][l]+f[115][l]*alpha_vdim[329][l]+f[114][l]*alpha_vdim[328][l]+f[113][l]*alpha_vdim[327][l])+0.1936491673103708*f[16][l]*alpha_vdim[325][l]+0.2165063509461096*(f[96][l]*alpha_vdim[324][l]+f[107][l]*alpha_vdim[323][l]+f[106][l]*alpha_vdim[322][l]+f[105][l]*alpha_vdim[321][l]+f[100][l]*alpha_vdim[320][l])+(0.4330127018922193*f[159][l]+0.4841229182759271*f[57][l])*alpha_vdim[207][l]+(0.4330127018922193*f[95][l]+0.4841229182759271*f[59][l])*alpha_vdim[202][l]+(0.4330127018922193*f[158][l]+0.4841229182759271*f[46][l])*alpha_vdim[194][l]+(0.4330127018922193*f[157][l]+0.4841229182759271*f[45][l])*alpha_vdim[193][l]+(0.4330127018922193*f[156][l]+0.4841229182759271*f[44][l])*alpha_vdim[192][l]+(0.4330127018922193*f[94][l]+0.4841229182759271*f[53][l])*alpha_vdim[185][l]+(0.4330127018922193*f[93][l]+0.4841229182759271*f[52][l])*alpha_vdim[184][l]+0.4330127018922193*f[92][l]*alpha_vdim[183][l]+0.4841229182759271*(f[51][l]*alpha_vdim[183][l]+f[63][l]*alpha_vdim[182][l])+(0.4330127018922193*f[153][l]+0.4841229182759271*f[31][l])*alpha_vdim[179][l]+(0.4330127018922193*f[152][l]+0.4841229182759271*f[30][l])*alpha_vdim[178][l]+(0.4330127018922193*f[151][l]+0.4841229182759271*f[29][l])*alpha_vdim[177][l]+(0.4330127018922193*f[89][l]+0.4841229182759271*f[40][l])*alpha_vdim[172][l]+(0.4330127018922193*f[88][l]+0.4841229182759271*f[39][l])*alpha_vdim[171][l]+0.4330127018922193*f[87][l]*alpha_vdim[170][l]+0.4841229182759271*(f[38][l]*alpha_vdim[170][l]+f[62][l]*alpha_vdim[169][l]+f[61][l]*alpha_vdim[168][l]+f[60][l]*alpha_vdim[167][l])+(0.4330127018922193*f[143][l]+0.4841229182759271*f[16][l])*alpha_vdim[166][l]+0.4330127018922193*f[79][l]*alpha_vdim[164][l]+0.4841229182759271*(f[21][l]*alpha_vdim[164][l]+f[56][l]*alpha_vdim[163][l]+f[55][l]*alpha_vdim[162][l]+f[54][l]*alpha_vdim[161][l]+f[41][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_vdim[22][l]*f[123][l]+alpha_vdim[9][l]*f[118][l]+alpha_vdim[8][l]*f[117][l]+alpha_vdim[7][l]*f[116][l]+alpha_vdim[47][l]*f[112][l]+alpha_vdim[3][l]*f[110][l]+alpha_vdim[2][l]*f[109][l]+alpha_vdim[1][l]*f[108][l]+alpha_vdim[34][l]*f[104][l]+alpha_vdim[33][l]*f[103][l]+alpha_vdim[32][l]*f[102][l]+alpha_vdim[0][l]*f[101][l]+alpha_vdim[19][l]*f[99][l]+alpha_vdim[18][l]*f[98][l]+alpha_vdim[17][l]*f[97][l]+alpha_vdim[6][l]*f[96][l])+0.1936491673103708*(alpha_vdim[43][l]*f[59][l]+alpha_vdim[28][l]*f[53][l]+alpha_vdim[27][l]*f[52][l]+alpha_vdim[26][l]*f[51][l]+alpha_vdim[15][l]*f[40][l]+alpha_vdim[14][l]*f[39][l]+alpha_vdim[13][l]*f[38][l]+alpha_vdim[5][l]*f[21][l]);
+    out[112][l] += 0.2165063509461096*(f[116][l]*alpha_cdim[326][l]+f[102][l]*alpha_cdim[320][l])+0.4841229182759271*(f[21][l]*alpha_vdim[207][l]+f[16][l]*alpha_vdim[202][l]+f[38][l]*alpha_vdim[194][l]+f[39][l]*alpha_vdim[193][l]+f[40][l]*alpha_vdim[192][l]+f[29][l]*alpha_vdim[185][l]+f[30][l]*alpha_vdim[184][l]+f[31][l]*alpha_vdim[183][l]+f[5][l]*alpha_vdim[182][l]+f[51][l]*alpha_vdim[179][l]+f[52][l]*alpha_vdim[178][l]+f[53][l]*alpha_vdim[177][l]+f[44][l]*alpha_vdim[172][l]+f[45][l]*alpha_vdim[171][l]+f[46][l]*alpha_vdim[170][l]+f[13][l]*alpha_vdim[169][l]+f[14][l]*alpha_vdim[168][l]+f[15][l]*alpha_vdim[167][l]+f[59][l]*alpha_vdim[166][l])+0.1936491673103708*f[27][l]*alpha_cdim[165][l]+0.4841229182759271*(f[57][l]*alpha_vdim[164][l]+f[26][l]*alpha_vdim[163][l]+f[27][l]*alpha_vdim[162][l]+f[28][l]*alpha_vdim[161][l]+f[43][l]*alpha_vdim[160][l])+0.2165063509461096*(f[103][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[115][l]+alpha_cdim[0][l]*f[104][l]);
+    out[113][l] += 0.4841229182759271*f[56][l]*alpha_vdim[207][l]+0.4330127018922193*f[75][l]*alpha_vdim[202][l]+0.4841229182759271*(f[15][l]*alpha_vdim[202][l]+f[61][l]*alpha_vdim[194][l]+f[62][l]*alpha_vdim[193][l]+f[41][l]*alpha_vdim[192][l])+(0.4330127018922193*f[82][l]+0.4841229182759271*f[27][l])*alpha_vdim[185][l]+(0.4330127018922193*f[83][l]+0.4841229182759271*f[28][l])*alpha_vdim[184][l]+0.4330127018922193*f[68][l]*alpha_vdim[183][l]+0.4841229182759271*(f[5][l]*alpha_vdim[183][l]+f[31][l]*alpha_vdim[182][l]+f[63][l]*alpha_vdim[179][l]+f[54][l]*alpha_vdim[178][l]+f[55][l]*alpha_vdim[177][l])+(0.4330127018922193*f[90][l]+0.4841229182759271*f[43][l])*alpha_vdim[172][l]+(0.4330127018922193*f[73][l]+0.4841229182759271*f[13][l])*alpha_vdim[171][l]+0.4330127018922193*f[74][l]*alpha_vdim[170][l]+0.4841229182759271*(f[14][l]*alpha_vdim[170][l]+f[45][l]*alpha_vdim[169][l]+f[46][l]*alpha_vdim[168][l]+f[16][l]*alpha_vdim[167][l]+f[60][l]*alpha_vdim[166][l])+0.1936491673103708*f[29][l]*alpha_cdim[165][l]+0.4330127018922193*f[81][l]*alpha_vdim[164][l]+0.4841229182759271*(f[26][l]*alpha_vdim[164][l]+f[57][l]*alpha_vdim[163][l]+f[29][l]*alpha_vdim[162][l]+f[30][l]*alpha_vdim[161][l]+f[44][l]*alpha_vdim[160][l])+0.2165063509461096*(f[105][l]*alpha_cdim[160][l]+alpha_vdim[19][l]*f[123][l]+alpha_vdim[33][l]*f[118][l]+alpha_vdim[34][l]*f[117][l]+alpha_vdim[6][l]*f[116][l]+alpha_vdim[3][l]*f[112][l]+alpha_vdim[47][l]*f[110][l]+alpha_vdim[17][l]*f[109][l]+alpha_vdim[18][l]*f[108][l]+alpha_cdim[0][l]*f[106][l]+alpha_vdim[8][l]*f[104][l]+alpha_vdim[9][l]*f[103][l]+alpha_vdim[0][l]*f[102][l]+alpha_vdim[32][l]*f[101][l]+alpha_vdim[22][l]*f[99][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[98][l]+alpha_vdim[2][l]*f[97][l]+alpha_vdim[7][l]*f[96][l])+0.1936491673103708*(alpha_vdim[15][l]*f[43][l]+f[15][l]*alpha_vdim[43][l]+alpha_vdim[27][l]*f[28][l]+f[27][l]*alpha_vdim[28][l]+alpha_vdim[5][l]*f[26][l]+f[5][l]*alpha_vdim[26][l]+alpha_vdim[13][l]*f[14][l]+f[13][l]*alpha_vdim[14][l]);
+    out[114][l] += 0.2165063509461096*(f[119][l]*alpha_cdim[326][l]+f[105][l]*alpha_cdim[320][l])+0.4841229182759271*f[55][l]*alpha_vdim[207][l]+0.4330127018922193*f[74][l]*alpha_vdim[202][l]+0.4841229182759271*(f[14][l]*alpha_vdim[202][l]+f[60][l]*alpha_vdim[194][l]+f[41][l]*alpha_vdim[193][l]+f[62][l]*alpha_vdim[192][l])+(0.4330127018922193*f[81][l]+0.4841229182759271*f[26][l])*alpha_vdim[185][l]+(0.4330127018922193*f[68][l]+0.4841229182759271*f[5][l])*alpha_vdim[184][l]+0.4330127018922193*f[83][l]*alpha_vdim[183][l]+0.4841229182759271*(f[28][l]*alpha_vdim[183][l]+f[30][l]*alpha_vdim[182][l]+f[54][l]*alpha_vdim[179][l]+f[63][l]*alpha_vdim[178][l]+f[56][l]*alpha_vdim[177][l])+(0.4330127018922193*f[73][l]+0.4841229182759271*f[13][l])*alpha_vdim[172][l]+(0.4330127018922193*f[90][l]+0.4841229182759271*f[43][l])*alpha_vdim[171][l]+0.4330127018922193*f[75][l]*alpha_vdim[170][l]+0.4841229182759271*(f[15][l]*alpha_vdim[170][l]+f[44][l]*alpha_vdim[169][l]+f[16][l]*alpha_vdim[168][l]+f[46][l]*alpha_vdim[167][l]+f[61][l]*alpha_vdim[166][l])+0.4330127018922193*f[82][l]*alpha_vdim[164][l]+0.4841229182759271*(f[27][l]*alpha_vdim[164][l]+f[29][l]*alpha_vdim[163][l]+f[57][l]*alpha_vdim[162][l]+f[31][l]*alpha_vdim[161][l]+f[45][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_vdim[18][l]*f[123][l]+alpha_vdim[32][l]*f[118][l]+alpha_vdim[6][l]*f[117][l]+alpha_vdim[34][l]*f[116][l]+alpha_vdim[2][l]*f[112][l]+alpha_vdim[17][l]*f[110][l]+alpha_vdim[47][l]*f[109][l]+alpha_vdim[19][l]*f[108][l]+alpha_cdim[0][l]*f[107][l]+alpha_vdim[7][l]*f[104][l]+alpha_vdim[0][l]*f[103][l]+alpha_vdim[9][l]*f[102][l]+alpha_vdim[33][l]*f[101][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[99][l]+alpha_vdim[22][l]*f[98][l]+alpha_vdim[3][l]*f[97][l]+alpha_vdim[8][l]*f[96][l])+0.1936491673103708*(alpha_vdim[14][l]*f[43][l]+f[14][l]*alpha_vdim[43][l]+alpha_vdim[26][l]*f[28][l]+f[26][l]*alpha_vdim[28][l]+alpha_vdim[5][l]*f[27][l]+f[5][l]*alpha_vdim[27][l]+alpha_vdim[13][l]*f[15][l]+f[13][l]*alpha_vdim[15][l]);
+    out[115][l] += 0.2165063509461096*(f[120][l]*alpha_cdim[326][l]+f[106][l]*alpha_cdim[320][l])+0.4841229182759271*f[54][l]*alpha_vdim[207][l]+0.4330127018922193*f[73][l]*alpha_vdim[202][l]+0.4841229182759271*(f[13][l]*alpha_vdim[202][l]+f[41][l]*alpha_vdim[194][l]+f[60][l]*alpha_vdim[193][l]+f[61][l]*alpha_vdim[192][l])+(0.4330127018922193*f[68][l]+0.4841229182759271*f[5][l])*alpha_vdim[185][l]+(0.4330127018922193*f[81][l]+0.4841229182759271*f[26][l])*alpha_vdim[184][l]+0.4330127018922193*f[82][l]*alpha_vdim[183][l]+0.4841229182759271*(f[27][l]*alpha_vdim[183][l]+f[29][l]*alpha_vdim[182][l]+f[55][l]*alpha_vdim[179][l]+f[56][l]*alpha_vdim[178][l]+f[63][l]*alpha_vdim[177][l])+(0.4330127018922193*f[74][l]+0.4841229182759271*f[14][l])*alpha_vdim[172][l]+(0.4330127018922193*f[75][l]+0.4841229182759271*f[15][l])*alpha_vdim[171][l]+0.4330127018922193*f[90][l]*alpha_vdim[170][l]+0.4841229182759271*(f[43][l]*alpha_vdim[170][l]+f[16][l]*alpha_vdim[169][l]+f[44][l]*alpha_vdim[168][l]+f[45][l]*alpha_vdim[167][l]+f[62][l]*alpha_vdim[166][l])+0.1936491673103708*f[31][l]*alpha_cdim[165][l]+0.4330127018922193*f[83][l]*alpha_vdim[164][l]+0.4841229182759271*(f[28][l]*alpha_vdim[164][l]+f[30][l]*alpha_vdim[163][l]+f[31][l]*alpha_vdim[162][l]+f[57][l]*alpha_vdim[161][l]+f[46][l]*alpha_vdim[160][l])+0.2165063509461096*(f[107][l]*alpha_cdim[160][l]+alpha_vdim[17][l]*f[123][l]+alpha_vdim[6][l]*f[118][l]+alpha_vdim[32][l]*f[117][l]+alpha_vdim[33][l]*f[116][l]+alpha_vdim[1][l]*f[112][l]+alpha_vdim[18][l]*f[110][l]+alpha_vdim[19][l]*f[109][l]+alpha_vdim[47][l]*f[108][l]+alpha_vdim[0][l]*f[104][l]+alpha_vdim[7][l]*f[103][l]+alpha_vdim[8][l]*f[102][l]+alpha_vdim[34][l]*f[101][l]+alpha_vdim[2][l]*f[99][l]+alpha_vdim[3][l]*f[98][l]+alpha_vdim[22][l]*f[97][l]+alpha_vdim[9][l]*f[96][l])+0.1936491673103708*(alpha_vdim[13][l]*f[43][l]+f[13][l]*alpha_vdim[43][l]+alpha_vdim[5][l]*f[28][l]+f[5][l]*alpha_vdim[28][l]+alpha_vdim[26][l]*f[27][l]+f[26][l]*alpha_vdim[27][l]+alpha_vdim[14][l]*f[15][l]+f[14][l]*alpha_vdim[15][l]);
+    out[116][l] += 0.1936491673103708*f[15][l]*alpha_vdim[363][l]+0.2165063509461096*f[107][l]*alpha_vdim[362][l]+0.1936491673103708*(f[27][l]*alpha_vdim[348][l]+f[28][l]*alpha_vdim[347][l]+f[5][l]*alpha_vdim[346][l])+0.2165063509461096*(f[114][l]*alpha_vdim[345][l]+f[115][l]*alpha_vdim[344][l]+f[100][l]*alpha_vdim[343][l]+f[99][l]*alpha_vdim[342][l])+0.1936491673103708*(f[43][l]*alpha_vdim[335][l]+f[13][l]*alpha_vdim[334][l]+f[14][l]*alpha_vdim[333][l])+0.2165063509461096*(f[122][l]*alpha_vdim[332][l]+f[105][l]*alpha_vdim[331][l]+f[106][l]*alpha_vdim[330][l]+f[103][l]*alpha_vdim[329][l]+f[104][l]*alpha_vdim[328][l]+f[96][l]*alpha_vdim[327][l])+0.1936491673103708*f[26][l]*alpha_vdim[325][l]+0.2165063509461096*(f[113][l]*alpha_vdim[324][l]+f[112][l]*alpha_vdim[323][l]+f[97][l]*alpha_vdim[322][l]+f[98][l]*alpha_vdim[321][l]+f[102][l]*alpha_vdim[320][l])+0.4330127018922193*f[142][l]*alpha_vdim[207][l]+0.4841229182759271*(f[15][l]*alpha_vdim[207][l]+f[56][l]*alpha_vdim[202][l])+(0.4330127018922193*f[149][l]+0.4841229182759271*f[27][l])*alpha_vdim[194][l]+(0.4330127018922193*f[150][l]+0.4841229182759271*f[28][l])*alpha_vdim[193][l]+0.4330127018922193*f[133][l]*alpha_vdim[192][l]+0.4841229182759271*(f[5][l]*alpha_vdim[192][l]+f[61][l]*alpha_vdim[185][l]+f[62][l]*alpha_vdim[184][l]+f[41][l]*alpha_vdim[183][l]+f[40][l]*alpha_vdim[182][l])+(0.4330127018922193*f[155][l]+0.4841229182759271*f[43][l])*alpha_vdim[179][l]+(0.4330127018922193*f[140][l]+0.4841229182759271*f[13][l])*alpha_vdim[178][l]+0.4330127018922193*f[141][l]*alpha_vdim[177][l]+0.4841229182759271*(f[14][l]*alpha_vdim[177][l]+f[63][l]*alpha_vdim[172][l]+f[54][l]*alpha_vdim[171][l]+f[55][l]*alpha_vdim[170][l]+f[52][l]*alpha_vdim[169][l]+f[53][l]*alpha_vdim[168][l]+f[21][l]*alpha_vdim[167][l])+(0.4330127018922193*f[148][l]+0.4841229182759271*f[26][l])*alpha_vdim[166][l]+0.1936491673103708*f[38][l]*alpha_cdim[165][l]+0.4841229182759271*(f[60][l]*alpha_vdim[164][l]+f[59][l]*alpha_vdim[163][l]+f[38][l]*alpha_vdim[162][l]+f[39][l]*alpha_vdim[161][l]+f[51][l]*alpha_vdim[160][l])+0.2165063509461096*(f[108][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[120][l]+alpha_cdim[0][l]*f[109][l]);
+    out[117][l] += 0.1936491673103708*f[14][l]*alpha_vdim[363][l]+0.2165063509461096*f[106][l]*alpha_vdim[362][l]+0.1936491673103708*(f[26][l]*alpha_vdim[348][l]+f[5][l]*alpha_vdim[347][l]+f[28][l]*alpha_vdim[346][l])+0.2165063509461096*(f[113][l]*alpha_vdim[345][l]+f[100][l]*alpha_vdim[344][l]+f[115][l]*alpha_vdim[343][l]+f[98][l]*alpha_vdim[342][l])+0.1936491673103708*(f[13][l]*alpha_vdim[335][l]+f[43][l]*alpha_vdim[334][l]+f[15][l]*alpha_vdim[333][l])+0.2165063509461096*(f[105][l]*alpha_vdim[332][l]+f[122][l]*alpha_vdim[331][l]+f[107][l]*alpha_vdim[330][l]+f[102][l]*alpha_vdim[329][l]+f[96][l]*alpha_vdim[328][l]+f[104][l]*alpha_vdim[327][l]+f[97][l]*alpha_cdim[326][l])+0.1936491673103708*f[27][l]*alpha_vdim[325][l]+0.2165063509461096*(f[114][l]*alpha_vdim[324][l]+f[97][l]*alpha_vdim[323][l]+f[112][l]*alpha_vdim[322][l]+f[99][l]*alpha_vdim[321][l]+f[103][l]*alpha_vdim[320][l]+f[108][l]*alpha_cdim[320][l])+0.4330127018922193*f[141][l]*alpha_vdim[207][l]+0.4841229182759271*(f[14][l]*alpha_vdim[207][l]+f[55][l]*alpha_vdim[202][l])+(0.4330127018922193*f[148][l]+0.4841229182759271*f[26][l])*alpha_vdim[194][l]+(0.4330127018922193*f[133][l]+0.4841229182759271*f[5][l])*alpha_vdim[193][l]+0.4330127018922193*f[150][l]*alpha_vdim[192][l]+0.4841229182759271*(f[28][l]*alpha_vdim[192][l]+f[60][l]*alpha_vdim[185][l]+f[41][l]*alpha_vdim[184][l]+f[62][l]*alpha_vdim[183][l]+f[39][l]*alpha_vdim[182][l])+(0.4330127018922193*f[140][l]+0.4841229182759271*f[13][l])*alpha_vdim[179][l]+(0.4330127018922193*f[155][l]+0.4841229182759271*f[43][l])*alpha_vdim[178][l]+0.4330127018922193*f[142][l]*alpha_vdim[177][l]+0.4841229182759271*(f[15][l]*alpha_vdim[177][l]+f[54][l]*alpha_vdim[172][l]+f[63][l]*alpha_vdim[171][l]+f[56][l]*alpha_vdim[170][l]+f[51][l]*alpha_vdim[169][l]+f[21][l]*alpha_vdim[168][l]+f[53][l]*alpha_vdim[167][l])+0.4330127018922193*f[149][l]*alpha_vdim[166][l]+0.4841229182759271*(f[27][l]*alpha_vdim[166][l]+f[61][l]*alpha_vdim[164][l]+f[38][l]*alpha_vdim[163][l]+f[59][l]*alpha_vdim[162][l]+f[40][l]*alpha_vdim[161][l]+f[52][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_cdim[4][l]*f[121][l]+alpha_cdim[0][l]*f[110][l]);
+    out[118][l] += 0.1936491673103708*f[13][l]*alpha_vdim[363][l]+0.2165063509461096*f[105][l]*alpha_vdim[362][l]+0.1936491673103708*(f[5][l]*alpha_vdim[348][l]+f[26][l]*alpha_vdim[347][l]+f[27][l]*alpha_vdim[346][l])+0.2165063509461096*(f[100][l]*alpha_vdim[345][l]+f[113][l]*alpha_vdim[344][l]+f[114][l]*alpha_vdim[343][l]+f[97][l]*alpha_vdim[342][l])+0.1936491673103708*(f[14][l]*alpha_vdim[335][l]+f[15][l]*alpha_vdim[334][l]+f[43][l]*alpha_vdim[333][l])+0.2165063509461096*(f[106][l]*alpha_vdim[332][l]+f[107][l]*alpha_vdim[331][l]+f[122][l]*alpha_vdim[330][l]+f[96][l]*alpha_vdim[329][l]+f[102][l]*alpha_vdim[328][l]+f[103][l]*alpha_vdim[327][l]+f[98][l]*alpha_cdim[326][l])+0.1936491673103708*f[28][l]*alpha_vdim[325][l]+0.2165063509461096*(f[115][l]*alpha_vdim[324][l]+f[98][l]*alpha_vdim[323][l]+f[99][l]*alpha_vdim[322][l]+f[112][l]*alpha_vdim[321][l]+f[104][l]*alpha_vdim[320][l]+f[109][l]*alpha_cdim[320][l])+0.4330127018922193*f[140][l]*alpha_vdim[207][l]+0.4841229182759271*(f[13][l]*alpha_vdim[207][l]+f[54][l]*alpha_vdim[202][l])+(0.4330127018922193*f[133][l]+0.4841229182759271*f[5][l])*alpha_vdim[194][l]+(0.4330127018922193*f[148][l]+0.4841229182759271*f[26][l])*alpha_vdim[193][l]+0.4330127018922193*f[149][l]*alpha_vdim[192][l]+0.4841229182759271*(f[27][l]*alpha_vdim[192][l]+f[41][l]*alpha_vdim[185][l]+f[60][l]*alpha_vdim[184][l]+f[61][l]*alpha_vdim[183][l]+f[38][l]*alpha_vdim[182][l])+(0.4330127018922193*f[141][l]+0.4841229182759271*f[14][l])*alpha_vdim[179][l]+(0.4330127018922193*f[142][l]+0.4841229182759271*f[15][l])*alpha_vdim[178][l]+0.4330127018922193*f[155][l]*alpha_vdim[177][l]+0.4841229182759271*(f[43][l]*alpha_vdim[177][l]+f[55][l]*alpha_vdim[172][l]+f[56][l]*alpha_vdim[171][l]+f[63][l]*alpha_vdim[170][l]+f[21][l]*alpha_vdim[169][l]+f[51][l]*alpha_vdim[168][l]+f[52][l]*alpha_vdim[167][l])+(0.4330127018922193*f[150][l]+0.4841229182759271*f[28][l])*alpha_vdim[166][l]+0.1936491673103708*f[40][l]*alpha_cdim[165][l]+0.4841229182759271*(f[62][l]*alpha_vdim[164][l]+f[39][l]*alpha_vdim[163][l]+f[40][l]*alpha_vdim[162][l]+f[59][l]*alpha_vdim[161][l]+f[53][l]*alpha_vdim[160][l])+0.2165063509461096*f[110][l]*alpha_cdim[160][l];
+    out[119][l] += 0.1936491673103708*f[46][l]*alpha_vdim[363][l]+0.2165063509461096*f[104][l]*alpha_vdim[362][l]+0.1936491673103708*(f[57][l]*alpha_vdim[348][l]+f[31][l]*alpha_vdim[347][l]+f[30][l]*alpha_vdim[346][l])+0.2165063509461096*(f[112][l]*alpha_vdim[345][l]+f[99][l]*alpha_vdim[344][l]+f[98][l]*alpha_vdim[343][l]+f[115][l]*alpha_vdim[342][l])+0.1936491673103708*(f[45][l]*alpha_vdim[335][l]+f[44][l]*alpha_vdim[334][l]+f[16][l]*alpha_vdim[333][l])+0.2165063509461096*(f[103][l]*alpha_vdim[332][l]+f[102][l]*alpha_vdim[331][l]+f[96][l]*alpha_vdim[330][l]+f[122][l]*alpha_vdim[329][l]+f[107][l]*alpha_vdim[328][l]+f[106][l]*alpha_vdim[327][l])+0.1936491673103708*f[29][l]*alpha_vdim[325][l]+0.2165063509461096*(f[97][l]*alpha_vdim[324][l]+f[114][l]*alpha_vdim[323][l]+f[113][l]*alpha_vdim[322][l]+f[100][l]*alpha_vdim[321][l]+f[105][l]*alpha_vdim[320][l])+(0.4330127018922193*f[158][l]+0.4841229182759271*f[46][l])*alpha_vdim[207][l]+(0.4330127018922193*f[94][l]+0.4841229182759271*f[53][l])*alpha_vdim[202][l]+(0.4330127018922193*f[159][l]+0.4841229182759271*f[57][l])*alpha_vdim[194][l]+(0.4330127018922193*f[153][l]+0.4841229182759271*f[31][l])*alpha_vdim[193][l]+(0.4330127018922193*f[152][l]+0.4841229182759271*f[30][l])*alpha_vdim[192][l]+(0.4330127018922193*f[95][l]+0.4841229182759271*f[59][l])*alpha_vdim[185][l]+(0.4330127018922193*f[89][l]+0.4841229182759271*f[40][l])*alpha_vdim[184][l]+0.4330127018922193*f[88][l]*alpha_vdim[183][l]+0.4841229182759271*(f[39][l]*alpha_vdim[183][l]+f[62][l]*alpha_vdim[182][l])+(0.4330127018922193*f[157][l]+0.4841229182759271*f[45][l])*alpha_vdim[179][l]+(0.4330127018922193*f[156][l]+0.4841229182759271*f[44][l])*alpha_vdim[178][l]+(0.4330127018922193*f[143][l]+0.4841229182759271*f[16][l])*alpha_vdim[177][l]+(0.4330127018922193*f[93][l]+0.4841229182759271*f[52][l])*alpha_vdim[172][l]+(0.4330127018922193*f[92][l]+0.4841229182759271*f[51][l])*alpha_vdim[171][l]+0.4330127018922193*f[79][l]*alpha_vdim[170][l]+0.4841229182759271*(f[21][l]*alpha_vdim[170][l]+f[63][l]*alpha_vdim[169][l]+f[56][l]*alpha_vdim[168][l]+f[55][l]*alpha_vdim[167][l])+(0.4330127018922193*f[151][l]+0.4841229182759271*f[29][l])*alpha_vdim[166][l]+0.4330127018922193*f[87][l]*alpha_vdim[164][l]+0.4841229182759271*(f[38][l]*alpha_vdim[164][l]+f[61][l]*alpha_vdim[163][l]+f[60][l]*alpha_vdim[162][l]+f[41][l]*alpha_vdim[161][l]+f[54][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_vdim[9][l]*f[123][l]+alpha_vdim[22][l]*f[118][l]+alpha_vdim[3][l]*f[117][l]+alpha_vdim[2][l]*f[116][l]+alpha_vdim[34][l]*f[112][l]+alpha_cdim[0][l]*f[111][l]+alpha_vdim[8][l]*f[110][l]+alpha_vdim[7][l]*f[109][l]+alpha_vdim[0][l]*f[108][l]+alpha_vdim[47][l]*f[104][l]+alpha_vdim[19][l]*f[103][l]+alpha_vdim[18][l]*f[102][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[101][l]+alpha_vdim[33][l]*f[99][l]+alpha_vdim[32][l]*f[98][l]+alpha_vdim[6][l]*f[97][l]+alpha_vdim[17][l]*f[96][l])+0.1936491673103708*(alpha_vdim[28][l]*f[59][l]+alpha_vdim[43][l]*f[53][l]+alpha_vdim[15][l]*f[52][l]+alpha_vdim[14][l]*f[51][l]+alpha_vdim[27][l]*f[40][l]+alpha_vdim[26][l]*f[39][l]+alpha_vdim[5][l]*f[38][l]+alpha_vdim[13][l]*f[21][l]);
+    out[120][l] += 0.1936491673103708*f[45][l]*alpha_vdim[363][l]+0.2165063509461096*f[103][l]*alpha_vdim[362][l]+0.1936491673103708*(f[31][l]*alpha_vdim[348][l]+f[57][l]*alpha_vdim[347][l]+f[29][l]*alpha_vdim[346][l])+0.2165063509461096*(f[99][l]*alpha_vdim[345][l]+f[112][l]*alpha_vdim[344][l]+f[97][l]*alpha_vdim[343][l]+f[114][l]*alpha_vdim[342][l])+0.1936491673103708*(f[46][l]*alpha_vdim[335][l]+f[16][l]*alpha_vdim[334][l]+f[44][l]*alpha_vdim[333][l])+0.2165063509461096*(f[104][l]*alpha_vdim[332][l]+f[96][l]*alpha_vdim[331][l]+f[102][l]*alpha_vdim[330][l]+f[107][l]*alpha_vdim[329][l]+f[122][l]*alpha_vdim[328][l]+f[105][l]*alpha_vdim[327][l])+0.1936491673103708*f[30][l]*alpha_vdim[325][l]+0.2165063509461096*(f[98][l]*alpha_vdim[324][l]+f[115][l]*alpha_vdim[323][l]+f[100][l]*alpha_vdim[322][l]+f[113][l]*alpha_vdim[321][l]+f[106][l]*alpha_vdim[320][l])+(0.4330127018922193*f[157][l]+0.4841229182759271*f[45][l])*alpha_vdim[207][l]+(0.4330127018922193*f[93][l]+0.4841229182759271*f[52][l])*alpha_vdim[202][l]+(0.4330127018922193*f[153][l]+0.4841229182759271*f[31][l])*alpha_vdim[194][l]+(0.4330127018922193*f[159][l]+0.4841229182759271*f[57][l])*alpha_vdim[193][l]+(0.4330127018922193*f[151][l]+0.4841229182759271*f[29][l])*alpha_vdim[192][l]+(0.4330127018922193*f[89][l]+0.4841229182759271*f[40][l])*alpha_vdim[185][l]+(0.4330127018922193*f[95][l]+0.4841229182759271*f[59][l])*alpha_vdim[184][l]+0.4330127018922193*f[87][l]*alpha_vdim[183][l]+0.4841229182759271*(f[38][l]*alpha_vdim[183][l]+f[61][l]*alpha_vdim[182][l])+(0.4330127018922193*f[158][l]+0.4841229182759271*f[46][l])*alpha_vdim[179][l]+(0.4330127018922193*f[143][l]+0.4841229182759271*f[16][l])*alpha_vdim[178][l]+(0.4330127018922193*f[156][l]+0.4841229182759271*f[44][l])*alpha_vdim[177][l]+(0.4330127018922193*f[94][l]+0.4841229182759271*f[53][l])*alpha_vdim[172][l]+(0.4330127018922193*f[79][l]+0.4841229182759271*f[21][l])*alpha_vdim[171][l]+0.4330127018922193*f[92][l]*alpha_vdim[170][l]+0.4841229182759271*(f[51][l]*alpha_vdim[170][l]+f[56][l]*alpha_vdim[169][l]+f[63][l]*alpha_vdim[168][l]+f[54][l]*alpha_vdim[167][l])+(0.4330127018922193*f[152][l]+0.4841229182759271*f[30][l])*alpha_vdim[166][l]+0.1936491673103708*f[41][l]*alpha_cdim[165][l]+0.4330127018922193*f[88][l]*alpha_vdim[164][l]+0.4841229182759271*(f[39][l]*alpha_vdim[164][l]+f[62][l]*alpha_vdim[163][l]+f[41][l]*alpha_vdim[162][l]+f[60][l]*alpha_vdim[161][l]+f[55][l]*alpha_vdim[160][l])+0.2165063509461096*(f[111][l]*alpha_cdim[160][l]+alpha_vdim[8][l]*f[123][l]+alpha_vdim[3][l]*f[118][l]+alpha_vdim[22][l]*f[117][l]+alpha_vdim[1][l]*f[116][l]+alpha_vdim[33][l]*f[112][l]+alpha_vdim[9][l]*f[110][l]+alpha_vdim[0][l]*f[109][l]+alpha_vdim[7][l]*f[108][l]+alpha_vdim[19][l]*f[104][l]+alpha_vdim[47][l]*f[103][l]+alpha_vdim[17][l]*f[102][l]+alpha_vdim[2][l]*f[101][l]+alpha_vdim[34][l]*f[99][l]+alpha_vdim[6][l]*f[98][l]+alpha_vdim[32][l]*f[97][l]+alpha_vdim[18][l]*f[96][l])+0.1936491673103708*(alpha_vdim[27][l]*f[59][l]+alpha_vdim[15][l]*f[53][l]+alpha_vdim[43][l]*f[52][l]+alpha_vdim[13][l]*f[51][l]+alpha_vdim[28][l]*f[40][l]+alpha_vdim[5][l]*f[39][l]+alpha_vdim[26][l]*f[38][l]+alpha_vdim[14][l]*f[21][l]);
+    out[121][l] += 0.1936491673103708*f[44][l]*alpha_vdim[363][l]+0.2165063509461096*f[102][l]*alpha_vdim[362][l]+0.1936491673103708*(f[30][l]*alpha_vdim[348][l]+f[29][l]*alpha_vdim[347][l]+f[57][l]*alpha_vdim[346][l])+0.2165063509461096*(f[98][l]*alpha_vdim[345][l]+f[97][l]*alpha_vdim[344][l]+f[112][l]*alpha_vdim[343][l]+f[113][l]*alpha_vdim[342][l])+0.1936491673103708*(f[16][l]*alpha_vdim[335][l]+f[46][l]*alpha_vdim[334][l]+f[45][l]*alpha_vdim[333][l])+0.2165063509461096*(f[96][l]*alpha_vdim[332][l]+f[104][l]*alpha_vdim[331][l]+f[103][l]*alpha_vdim[330][l]+f[106][l]*alpha_vdim[329][l]+f[105][l]*alpha_vdim[328][l]+f[122][l]*alpha_vdim[327][l]+f[100][l]*alpha_cdim[326][l])+0.1936491673103708*f[31][l]*alpha_vdim[325][l]+0.2165063509461096*(f[99][l]*alpha_vdim[324][l]+f[100][l]*alpha_vdim[323][l]+f[115][l]*alpha_vdim[322][l]+f[114][l]*alpha_vdim[321][l]+f[107][l]*alpha_vdim[320][l]+f[111][l]*alpha_cdim[320][l])+(0.4330127018922193*f[156][l]+0.4841229182759271*f[44][l])*alpha_vdim[207][l]+(0.4330127018922193*f[92][l]+0.4841229182759271*f[51][l])*alpha_vdim[202][l]+(0.4330127018922193*f[152][l]+0.4841229182759271*f[30][l])*alpha_vdim[194][l]+(0.4330127018922193*f[151][l]+0.4841229182759271*f[29][l])*alpha_vdim[193][l]+(0.4330127018922193*f[159][l]+0.4841229182759271*f[57][l])*alpha_vdim[192][l]+(0.4330127018922193*f[88][l]+0.4841229182759271*f[39][l])*alpha_vdim[185][l]+(0.4330127018922193*f[87][l]+0.4841229182759271*f[38][l])*alpha_vdim[184][l]+0.4330127018922193*f[95][l]*alpha_vdim[183][l]+0.4841229182759271*(f[59][l]*alpha_vdim[183][l]+f[60][l]*alpha_vdim[182][l])+(0.4330127018922193*f[143][l]+0.4841229182759271*f[16][l])*alpha_vdim[179][l]+(0.4330127018922193*f[158][l]+0.4841229182759271*f[46][l])*alpha_vdim[178][l]+(0.4330127018922193*f[157][l]+0.4841229182759271*f[45][l])*alpha_vdim[177][l]+(0.4330127018922193*f[79][l]+0.4841229182759271*f[21][l])*alpha_vdim[172][l]+(0.4330127018922193*f[94][l]+0.4841229182759271*f[53][l])*alpha_vdim[171][l]+0.4330127018922193*f[93][l]*alpha_vdim[170][l]+0.4841229182759271*(f[52][l]*alpha_vdim[170][l]+f[55][l]*alpha_vdim[169][l]+f[54][l]*alpha_vdim[168][l]+f[63][l]*alpha_vdim[167][l])+(0.4330127018922193*f[153][l]+0.4841229182759271*f[31][l])*alpha_vdim[166][l]+0.4330127018922193*f[89][l]*alpha_vdim[164][l]+0.4841229182759271*(f[40][l]*alpha_vdim[164][l]+f[41][l]*alpha_vdim[163][l]+f[62][l]*alpha_vdim[162][l]+f[61][l]*alpha_vdim[161][l]+f[56][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_vdim[7][l]*f[123][l]+alpha_vdim[2][l]*f[118][l]+alpha_vdim[1][l]*f[117][l]+alpha_vdim[22][l]*f[116][l]+alpha_vdim[32][l]*f[112][l]+alpha_vdim[0][l]*f[110][l]+alpha_vdim[9][l]*f[109][l]+alpha_vdim[8][l]*f[108][l]+alpha_vdim[18][l]*f[104][l]+alpha_vdim[17][l]*f[103][l]+alpha_vdim[47][l]*f[102][l]+alpha_vdim[3][l]*f[101][l]+alpha_vdim[6][l]*f[99][l]+alpha_vdim[34][l]*f[98][l]+alpha_vdim[33][l]*f[97][l]+alpha_vdim[19][l]*f[96][l])+0.1936491673103708*(alpha_vdim[26][l]*f[59][l]+alpha_vdim[14][l]*f[53][l]+alpha_vdim[13][l]*f[52][l]+alpha_vdim[43][l]*f[51][l]+alpha_vdim[5][l]*f[40][l]+alpha_vdim[28][l]*f[39][l]+alpha_vdim[27][l]*f[38][l]+alpha_vdim[15][l]*f[21][l]);
+    out[122][l] += 0.2165063509461096*(f[124][l]*alpha_cdim[326][l]+f[113][l]*alpha_cdim[320][l])+0.4841229182759271*f[41][l]*alpha_vdim[207][l]+0.4330127018922193*f[68][l]*alpha_vdim[202][l]+0.4841229182759271*(f[5][l]*alpha_vdim[202][l]+f[54][l]*alpha_vdim[194][l]+f[55][l]*alpha_vdim[193][l]+f[56][l]*alpha_vdim[192][l])+(0.4330127018922193*f[73][l]+0.4841229182759271*f[13][l])*alpha_vdim[185][l]+(0.4330127018922193*f[74][l]+0.4841229182759271*f[14][l])*alpha_vdim[184][l]+0.4330127018922193*f[75][l]*alpha_vdim[183][l]+0.4841229182759271*(f[15][l]*alpha_vdim[183][l]+f[16][l]*alpha_vdim[182][l]+f[60][l]*alpha_vdim[179][l]+f[61][l]*alpha_vdim[178][l]+f[62][l]*alpha_vdim[177][l])+(0.4330127018922193*f[81][l]+0.4841229182759271*f[26][l])*alpha_vdim[172][l]+(0.4330127018922193*f[82][l]+0.4841229182759271*f[27][l])*alpha_vdim[171][l]+0.4330127018922193*f[83][l]*alpha_vdim[170][l]+0.4841229182759271*(f[28][l]*alpha_vdim[170][l]+f[29][l]*alpha_vdim[169][l]+f[30][l]*alpha_vdim[168][l]+f[31][l]*alpha_vdim[167][l]+f[63][l]*alpha_vdim[166][l])+0.1936491673103708*f[45][l]*alpha_cdim[165][l]+0.4330127018922193*f[90][l]*alpha_vdim[164][l]+0.4841229182759271*(f[43][l]*alpha_vdim[164][l]+f[44][l]*alpha_vdim[163][l]+f[45][l]*alpha_vdim[162][l]+f[46][l]*alpha_vdim[161][l]+f[57][l]*alpha_vdim[160][l])+0.2165063509461096*(f[114][l]*alpha_cdim[160][l]+alpha_vdim[6][l]*f[123][l]+alpha_vdim[17][l]*f[118][l]+alpha_vdim[18][l]*f[117][l]+alpha_vdim[19][l]*f[116][l]+alpha_cdim[0][l]*f[115][l]+alpha_vdim[0][l]*f[112][l]+alpha_vdim[32][l]*f[110][l]+alpha_vdim[33][l]*f[109][l]+alpha_vdim[34][l]*f[108][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[104][l]+alpha_vdim[2][l]*f[103][l]+alpha_vdim[3][l]*f[102][l]+alpha_vdim[47][l]*f[101][l]+alpha_vdim[7][l]*f[99][l]+alpha_vdim[8][l]*f[98][l]+alpha_vdim[9][l]*f[97][l]+alpha_vdim[22][l]*f[96][l])+0.1936491673103708*(alpha_vdim[5][l]*f[43][l]+f[5][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[28][l]+f[13][l]*alpha_vdim[28][l]+alpha_vdim[14][l]*f[27][l]+f[14][l]*alpha_vdim[27][l]+alpha_vdim[15][l]*f[26][l]+f[15][l]*alpha_vdim[26][l]);
+    out[123][l] += 0.1936491673103708*f[5][l]*alpha_vdim[363][l]+0.2165063509461096*f[100][l]*alpha_vdim[362][l]+0.1936491673103708*(f[13][l]*alpha_vdim[348][l]+f[14][l]*alpha_vdim[347][l]+f[15][l]*alpha_vdim[346][l])+0.2165063509461096*(f[105][l]*alpha_vdim[345][l]+f[106][l]*alpha_vdim[344][l]+f[107][l]*alpha_vdim[343][l]+f[96][l]*alpha_vdim[342][l])+0.1936491673103708*(f[26][l]*alpha_vdim[335][l]+f[27][l]*alpha_vdim[334][l]+f[28][l]*alpha_vdim[333][l])+0.2165063509461096*(f[113][l]*alpha_vdim[332][l]+f[114][l]*alpha_vdim[331][l]+f[115][l]*alpha_vdim[330][l]+f[97][l]*alpha_vdim[329][l]+f[98][l]*alpha_vdim[328][l]+f[99][l]*alpha_vdim[327][l]+f[102][l]*alpha_cdim[326][l])+0.1936491673103708*f[43][l]*alpha_vdim[325][l]+0.2165063509461096*(f[122][l]*alpha_vdim[324][l]+f[102][l]*alpha_vdim[323][l]+f[103][l]*alpha_vdim[322][l]+f[104][l]*alpha_vdim[321][l]+f[112][l]*alpha_vdim[320][l]+f[116][l]*alpha_cdim[320][l])+0.4330127018922193*f[133][l]*alpha_vdim[207][l]+0.4841229182759271*(f[5][l]*alpha_vdim[207][l]+f[41][l]*alpha_vdim[202][l])+(0.4330127018922193*f[140][l]+0.4841229182759271*f[13][l])*alpha_vdim[194][l]+(0.4330127018922193*f[141][l]+0.4841229182759271*f[14][l])*alpha_vdim[193][l]+0.4330127018922193*f[142][l]*alpha_vdim[192][l]+0.4841229182759271*(f[15][l]*alpha_vdim[192][l]+f[54][l]*alpha_vdim[185][l]+f[55][l]*alpha_vdim[184][l]+f[56][l]*alpha_vdim[183][l]+f[21][l]*alpha_vdim[182][l])+(0.4330127018922193*f[148][l]+0.4841229182759271*f[26][l])*alpha_vdim[179][l]+(0.4330127018922193*f[149][l]+0.4841229182759271*f[27][l])*alpha_vdim[178][l]+0.4330127018922193*f[150][l]*alpha_vdim[177][l]+0.4841229182759271*(f[28][l]*alpha_vdim[177][l]+f[60][l]*alpha_vdim[172][l]+f[61][l]*alpha_vdim[171][l]+f[62][l]*alpha_vdim[170][l]+f[38][l]*alpha_vdim[169][l]+f[39][l]*alpha_vdim[168][l]+f[40][l]*alpha_vdim[167][l])+(0.4330127018922193*f[155][l]+0.4841229182759271*f[43][l])*alpha_vdim[166][l]+0.1936491673103708*f[52][l]*alpha_cdim[165][l]+0.4841229182759271*(f[63][l]*alpha_vdim[164][l]+f[51][l]*alpha_vdim[163][l]+f[52][l]*alpha_vdim[162][l]+f[53][l]*alpha_vdim[161][l]+f[59][l]*alpha_vdim[160][l])+0.2165063509461096*(f[117][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[126][l]+alpha_cdim[0][l]*f[118][l]);
+    out[124][l] += 0.1936491673103708*f[31][l]*alpha_vdim[363][l]+0.2165063509461096*f[99][l]*alpha_vdim[362][l]+0.1936491673103708*(f[45][l]*alpha_vdim[348][l]+f[46][l]*alpha_vdim[347][l]+f[16][l]*alpha_vdim[346][l])+0.2165063509461096*(f[103][l]*alpha_vdim[345][l]+f[104][l]*alpha_vdim[344][l]+f[96][l]*alpha_vdim[343][l]+f[107][l]*alpha_vdim[342][l])+0.1936491673103708*(f[57][l]*alpha_vdim[335][l]+f[29][l]*alpha_vdim[334][l]+f[30][l]*alpha_vdim[333][l])+0.2165063509461096*(f[112][l]*alpha_vdim[332][l]+f[97][l]*alpha_vdim[331][l]+f[98][l]*alpha_vdim[330][l]+f[114][l]*alpha_vdim[329][l]+f[115][l]*alpha_vdim[328][l]+f[100][l]*alpha_vdim[327][l])+0.1936491673103708*f[44][l]*alpha_vdim[325][l]+0.2165063509461096*(f[102][l]*alpha_vdim[324][l]+f[122][l]*alpha_vdim[323][l]+f[105][l]*alpha_vdim[322][l]+f[106][l]*alpha_vdim[321][l]+f[113][l]*alpha_vdim[320][l])+(0.4330127018922193*f[153][l]+0.4841229182759271*f[31][l])*alpha_vdim[207][l]+(0.4330127018922193*f[89][l]+0.4841229182759271*f[40][l])*alpha_vdim[202][l]+(0.4330127018922193*f[157][l]+0.4841229182759271*f[45][l])*alpha_vdim[194][l]+(0.4330127018922193*f[158][l]+0.4841229182759271*f[46][l])*alpha_vdim[193][l]+(0.4330127018922193*f[143][l]+0.4841229182759271*f[16][l])*alpha_vdim[192][l]+(0.4330127018922193*f[93][l]+0.4841229182759271*f[52][l])*alpha_vdim[185][l]+(0.4330127018922193*f[94][l]+0.4841229182759271*f[53][l])*alpha_vdim[184][l]+0.4330127018922193*f[79][l]*alpha_vdim[183][l]+0.4841229182759271*(f[21][l]*alpha_vdim[183][l]+f[56][l]*alpha_vdim[182][l])+(0.4330127018922193*f[159][l]+0.4841229182759271*f[57][l])*alpha_vdim[179][l]+(0.4330127018922193*f[151][l]+0.4841229182759271*f[29][l])*alpha_vdim[178][l]+(0.4330127018922193*f[152][l]+0.4841229182759271*f[30][l])*alpha_vdim[177][l]+(0.4330127018922193*f[95][l]+0.4841229182759271*f[59][l])*alpha_vdim[172][l]+(0.4330127018922193*f[87][l]+0.4841229182759271*f[38][l])*alpha_vdim[171][l]+0.4330127018922193*f[88][l]*alpha_vdim[170][l]+0.4841229182759271*(f[39][l]*alpha_vdim[170][l]+f[61][l]*alpha_vdim[169][l]+f[62][l]*alpha_vdim[168][l]+f[41][l]*alpha_vdim[167][l])+(0.4330127018922193*f[156][l]+0.4841229182759271*f[44][l])*alpha_vdim[166][l]+0.1936491673103708*f[54][l]*alpha_cdim[165][l]+0.4330127018922193*f[92][l]*alpha_vdim[164][l]+0.4841229182759271*(f[51][l]*alpha_vdim[164][l]+f[63][l]*alpha_vdim[163][l]+f[54][l]*alpha_vdim[162][l]+f[55][l]*alpha_vdim[161][l]+f[60][l]*alpha_vdim[160][l])+0.2165063509461096*(f[119][l]*alpha_cdim[160][l]+alpha_vdim[3][l]*f[123][l]+alpha_cdim[0][l]*f[120][l]+alpha_vdim[8][l]*f[118][l]+alpha_vdim[9][l]*f[117][l]+alpha_vdim[0][l]*f[116][l]+alpha_vdim[19][l]*f[112][l]+alpha_vdim[22][l]*f[110][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[109][l]+alpha_vdim[2][l]*f[108][l]+alpha_vdim[33][l]*f[104][l]+alpha_vdim[34][l]*f[103][l]+alpha_vdim[6][l]*f[102][l]+alpha_vdim[7][l]*f[101][l]+alpha_vdim[47][l]*f[99][l]+alpha_vdim[17][l]*f[98][l]+alpha_vdim[18][l]*f[97][l]+alpha_vdim[32][l]*f[96][l])+0.1936491673103708*(alpha_vdim[15][l]*f[59][l]+alpha_vdim[27][l]*f[53][l]+alpha_vdim[28][l]*f[52][l]+alpha_vdim[5][l]*f[51][l]+f[40][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[39][l]+alpha_vdim[14][l]*f[38][l]+f[21][l]*alpha_vdim[26][l]);
+    out[125][l] += 0.1936491673103708*f[30][l]*alpha_vdim[363][l]+0.2165063509461096*f[98][l]*alpha_vdim[362][l]+0.1936491673103708*(f[44][l]*alpha_vdim[348][l]+f[16][l]*alpha_vdim[347][l]+f[46][l]*alpha_vdim[346][l])+0.2165063509461096*(f[102][l]*alpha_vdim[345][l]+f[96][l]*alpha_vdim[344][l]+f[104][l]*alpha_vdim[343][l]+f[106][l]*alpha_vdim[342][l])+0.1936491673103708*(f[29][l]*alpha_vdim[335][l]+f[57][l]*alpha_vdim[334][l]+f[31][l]*alpha_vdim[333][l])+0.2165063509461096*(f[97][l]*alpha_vdim[332][l]+f[112][l]*alpha_vdim[331][l]+f[99][l]*alpha_vdim[330][l]+f[113][l]*alpha_vdim[329][l]+f[100][l]*alpha_vdim[328][l]+f[115][l]*alpha_vdim[327][l]+f[105][l]*alpha_cdim[326][l])+0.1936491673103708*f[45][l]*alpha_vdim[325][l]+0.2165063509461096*(f[103][l]*alpha_vdim[324][l]+f[105][l]*alpha_vdim[323][l]+f[122][l]*alpha_vdim[322][l]+f[107][l]*alpha_vdim[321][l]+f[114][l]*alpha_vdim[320][l]+f[119][l]*alpha_cdim[320][l])+(0.4330127018922193*f[152][l]+0.4841229182759271*f[30][l])*alpha_vdim[207][l]+(0.4330127018922193*f[88][l]+0.4841229182759271*f[39][l])*alpha_vdim[202][l]+(0.4330127018922193*f[156][l]+0.4841229182759271*f[44][l])*alpha_vdim[194][l]+(0.4330127018922193*f[143][l]+0.4841229182759271*f[16][l])*alpha_vdim[193][l]+(0.4330127018922193*f[158][l]+0.4841229182759271*f[46][l])*alpha_vdim[192][l]+(0.4330127018922193*f[92][l]+0.4841229182759271*f[51][l])*alpha_vdim[185][l]+(0.4330127018922193*f[79][l]+0.4841229182759271*f[21][l])*alpha_vdim[184][l]+0.4330127018922193*f[94][l]*alpha_vdim[183][l]+0.4841229182759271*(f[53][l]*alpha_vdim[183][l]+f[55][l]*alpha_vdim[182][l])+(0.4330127018922193*f[151][l]+0.4841229182759271*f[29][l])*alpha_vdim[179][l]+(0.4330127018922193*f[159][l]+0.4841229182759271*f[57][l])*alpha_vdim[178][l]+(0.4330127018922193*f[153][l]+0.4841229182759271*f[31][l])*alpha_vdim[177][l]+(0.4330127018922193*f[87][l]+0.4841229182759271*f[38][l])*alpha_vdim[172][l]+(0.4330127018922193*f[95][l]+0.4841229182759271*f[59][l])*alpha_vdim[171][l]+0.4330127018922193*f[89][l]*alpha_vdim[170][l]+0.4841229182759271*(f[40][l]*alpha_vdim[170][l]+f[60][l]*alpha_vdim[169][l]+f[41][l]*alpha_vdim[168][l]+f[62][l]*alpha_vdim[167][l])+(0.4330127018922193*f[157][l]+0.4841229182759271*f[45][l])*alpha_vdim[166][l]+0.4330127018922193*f[93][l]*alpha_vdim[164][l]+0.4841229182759271*(f[52][l]*alpha_vdim[164][l]+f[54][l]*alpha_vdim[163][l]+f[63][l]*alpha_vdim[162][l]+f[56][l]*alpha_vdim[161][l]+f[61][l]*alpha_vdim[160][l])+0.2165063509461096*(alpha_vdim[2][l]*f[123][l]+alpha_cdim[0][l]*f[121][l]+alpha_vdim[7][l]*f[118][l]+alpha_vdim[0][l]*f[117][l]+alpha_vdim[9][l]*f[116][l]+alpha_vdim[18][l]*f[112][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[110][l]+alpha_vdim[22][l]*f[109][l]+alpha_vdim[3][l]*f[108][l]+alpha_vdim[32][l]*f[104][l]+alpha_vdim[6][l]*f[103][l]+alpha_vdim[34][l]*f[102][l]+alpha_vdim[8][l]*f[101][l]+alpha_vdim[17][l]*f[99][l]+alpha_vdim[47][l]*f[98][l]+alpha_vdim[19][l]*f[97][l]+alpha_vdim[33][l]*f[96][l])+0.1936491673103708*(alpha_vdim[14][l]*f[59][l]+alpha_vdim[26][l]*f[53][l]+alpha_vdim[5][l]*f[52][l]+alpha_vdim[28][l]*f[51][l]+f[39][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[40][l]+alpha_vdim[15][l]*f[38][l]+f[21][l]*alpha_vdim[27][l]);
+    out[126][l] += 0.1936491673103708*f[29][l]*alpha_vdim[363][l]+0.2165063509461096*f[97][l]*alpha_vdim[362][l]+0.1936491673103708*(f[16][l]*alpha_vdim[348][l]+f[44][l]*alpha_vdim[347][l]+f[45][l]*alpha_vdim[346][l])+0.2165063509461096*(f[96][l]*alpha_vdim[345][l]+f[102][l]*alpha_vdim[344][l]+f[103][l]*alpha_vdim[343][l]+f[105][l]*alpha_vdim[342][l])+0.1936491673103708*(f[30][l]*alpha_vdim[335][l]+f[31][l]*alpha_vdim[334][l]+f[57][l]*alpha_vdim[333][l])+0.2165063509461096*(f[98][l]*alpha_vdim[332][l]+f[99][l]*alpha_vdim[331][l]+f[112][l]*alpha_vdim[330][l]+f[100][l]*alpha_vdim[329][l]+f[113][l]*alpha_vdim[328][l]+f[114][l]*alpha_vdim[327][l]+f[106][l]*alpha_cdim[326][l])+0.1936491673103708*f[46][l]*alpha_vdim[325][l]+0.2165063509461096*(f[104][l]*alpha_vdim[324][l]+f[106][l]*alpha_vdim[323][l]+f[107][l]*alpha_vdim[322][l]+f[122][l]*alpha_vdim[321][l]+f[115][l]*alpha_vdim[320][l]+f[120][l]*alpha_cdim[320][l])+(0.4330127018922193*f[151][l]+0.4841229182759271*f[29][l])*alpha_vdim[207][l]+(0.4330127018922193*f[87][l]+0.4841229182759271*f[38][l])*alpha_vdim[202][l]+(0.4330127018922193*f[143][l]+0.4841229182759271*f[16][l])*alpha_vdim[194][l]+(0.4330127018922193*f[156][l]+0.4841229182759271*f[44][l])*alpha_vdim[193][l]+(0.4330127018922193*f[157][l]+0.4841229182759271*f[45][l])*alpha_vdim[192][l]+(0.4330127018922193*f[79][l]+0.4841229182759271*f[21][l])*alpha_vdim[185][l]+(0.4330127018922193*f[92][l]+0.4841229182759271*f[51][l])*alpha_vdim[184][l]+0.4330127018922193*f[93][l]*alpha_vdim[183][l]+0.4841229182759271*(f[52][l]*alpha_vdim[183][l]+f[54][l]*alpha_vdim[182][l])+(0.4330127018922193*f[152][l]+0.4841229182759271*f[30][l])*alpha_vdim[179][l]+(0.4330127018922193*f[153][l]+0.4841229182759271*f[31][l])*alpha_vdim[178][l]+(0.4330127018922193*f[159][l]+0.4841229182759271*f[57][l])*alpha_vdim[177][l]+(0.4330127018922193*f[88][l]+0.4841229182759271*f[39][l])*alpha_vdim[172][l]+(0.4330127018922193*f[89][l]+0.4841229182759271*f[40][l])*alpha_vdim[171][l]+0.4330127018922193*f[95][l]*alpha_vdim[170][l]+0.4841229182759271*(f[59][l]*alpha_vdim[170][l]+f[41][l]*alpha_vdim[169][l]+f[60][l]*alpha_vdim[168][l]+f[61][l]*alpha_vdim[167][l])+(0.4330127018922193*f[158][l]+0.4841229182759271*f[46][l])*alpha_vdim[166][l]+0.1936491673103708*f[56][l]*alpha_cdim[165][l]+0.4330127018922193*f[94][l]*alpha_vdim[164][l]+0.4841229182759271*(f[53][l]*alpha_vdim[164][l]+f[55][l]*alpha_vdim[163][l]+f[56][l]*alpha_vdim[162][l]+f[63][l]*alpha_vdim[161][l]+f[62][l]*alpha_vdim[160][l])+0.2165063509461096*(f[121][l]*alpha_cdim[160][l]+alpha_vdim[1][l]*f[123][l]+alpha_vdim[0][l]*f[118][l]+alpha_vdim[7][l]*f[117][l]+alpha_vdim[8][l]*f[116][l]+alpha_vdim[17][l]*f[112][l]+alpha_vdim[2][l]*f[110][l]+alpha_vdim[3][l]*f[109][l]+alpha_vdim[22][l]*f[108][l]+alpha_vdim[6][l]*f[104][l]+alpha_vdim[32][l]*f[103][l]+alpha_vdim[33][l]*f[102][l]+alpha_vdim[9][l]*f[101][l]+alpha_vdim[18][l]*f[99][l]+alpha_vdim[19][l]*f[98][l]+alpha_vdim[47][l]*f[97][l]+alpha_vdim[34][l]*f[96][l])+0.1936491673103708*(alpha_vdim[13][l]*f[59][l]+alpha_vdim[5][l]*f[53][l]+alpha_vdim[26][l]*f[52][l]+alpha_vdim[27][l]*f[51][l]+f[38][l]*alpha_vdim[43][l]+alpha_vdim[14][l]*f[40][l]+alpha_vdim[15][l]*f[39][l]+f[21][l]*alpha_vdim[28][l]);
+    out[127][l] += 0.1936491673103708*f[16][l]*alpha_vdim[363][l]+0.2165063509461096*f[96][l]*alpha_vdim[362][l]+0.1936491673103708*(f[29][l]*alpha_vdim[348][l]+f[30][l]*alpha_vdim[347][l]+f[31][l]*alpha_vdim[346][l])+0.2165063509461096*(f[97][l]*alpha_vdim[345][l]+f[98][l]*alpha_vdim[344][l]+f[99][l]*alpha_vdim[343][l]+f[100][l]*alpha_vdim[342][l])+0.1936491673103708*(f[44][l]*alpha_vdim[335][l]+f[45][l]*alpha_vdim[334][l]+f[46][l]*alpha_vdim[333][l])+0.2165063509461096*(f[102][l]*alpha_vdim[332][l]+f[103][l]*alpha_vdim[331][l]+f[104][l]*alpha_vdim[330][l]+f[105][l]*alpha_vdim[329][l]+f[106][l]*alpha_vdim[328][l]+f[107][l]*alpha_vdim[327][l]+f[113][l]*alpha_cdim[326][l])+0.1936491673103708*f[57][l]*alpha_vdim[325][l]+0.2165063509461096*(f[112][l]*alpha_vdim[324][l]+f[113][l]*alpha_vdim[323][l]+f[114][l]*alpha_vdim[322][l]+f[115][l]*alpha_vdim[321][l]+f[122][l]*alpha_vdim[320][l]+f[124][l]*alpha_cdim[320][l])+(0.4330127018922193*f[143][l]+0.4841229182759271*f[16][l])*alpha_vdim[207][l]+(0.4330127018922193*f[79][l]+0.4841229182759271*f[21][l])*alpha_vdim[202][l]+(0.4330127018922193*f[151][l]+0.4841229182759271*f[29][l])*alpha_vdim[194][l]+(0.4330127018922193*f[152][l]+0.4841229182759271*f[30][l])*alpha_vdim[193][l]+(0.4330127018922193*f[153][l]+0.4841229182759271*f[31][l])*alpha_vdim[192][l]+(0.4330127018922193*f[87][l]+0.4841229182759271*f[38][l])*alpha_vdim[185][l]+(0.4330127018922193*f[88][l]+0.4841229182759271*f[39][l])*alpha_vdim[184][l]+0.4330127018922193*f[89][l]*alpha_vdim[183][l]+0.4841229182759271*(f[40][l]*alpha_vdim[183][l]+f[41][l]*alpha_vdim[182][l])+(0.4330127018922193*f[156][l]+0.4841229182759271*f[44][l])*alpha_vdim[179][l]+(0.4330127018922193*f[157][l]+0.4841229182759271*f[45][l])*alpha_vdim[178][l]+(0.4330127018922193*f[158][l]+0.4841229182759271*f[46][l])*alpha_vdim[177][l]+(0.4330127018922193*f[92][l]+0.4841229182759271*f[51][l])*alpha_vdim[172][l]+(0.4330127018922193*f[93][l]+0.4841229182759271*f[52][l])*alpha_vdim[171][l]+0.4330127018922193*f[94][l]*alpha_vdim[170][l]+0.4841229182759271*(f[53][l]*alpha_vdim[170][l]+f[54][l]*alpha_vdim[169][l]+f[55][l]*alpha_vdim[168][l]+f[56][l]*alpha_vdim[167][l])+(0.4330127018922193*f[159][l]+0.4841229182759271*f[57][l])*alpha_vdim[166][l]+0.1936491673103708*f[61][l]*alpha_cdim[165][l]+0.4330127018922193*f[95][l]*alpha_vdim[164][l]+0.4841229182759271*(f[59][l]*alpha_vdim[164][l]+f[60][l]*alpha_vdim[163][l]+f[61][l]*alpha_vdim[162][l]+f[62][l]*alpha_vdim[161][l]+f[63][l]*alpha_vdim[160][l])+0.2165063509461096*(f[125][l]*alpha_cdim[160][l]+alpha_cdim[0][l]*f[126][l]+alpha_vdim[0][l]*f[123][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[118][l]+alpha_vdim[2][l]*f[117][l]+alpha_vdim[3][l]*f[116][l]+alpha_vdim[6][l]*f[112][l]+alpha_vdim[7][l]*f[110][l]+alpha_vdim[8][l]*f[109][l]+alpha_vdim[9][l]*f[108][l]+alpha_vdim[17][l]*f[104][l]+alpha_vdim[18][l]*f[103][l]+alpha_vdim[19][l]*f[102][l]+alpha_vdim[22][l]*f[101][l]+alpha_vdim[32][l]*f[99][l]+alpha_vdim[33][l]*f[98][l]+alpha_vdim[34][l]*f[97][l]+alpha_vdim[47][l]*f[96][l])+0.1936491673103708*(alpha_vdim[5][l]*f[59][l]+alpha_vdim[13][l]*f[53][l]+alpha_vdim[14][l]*f[52][l]+alpha_vdim[15][l]*f[51][l]+f[21][l]*alpha_vdim[43][l]+alpha_vdim[26][l]*f[40][l]+alpha_vdim[27][l]*f[39][l]+alpha_vdim[28][l]*f[38][l]);
+    out[128][l] += 0.4841229182759271*(f[59][l]*alpha_vdim[363][l]+f[58][l]*alpha_vdim[362][l]+f[53][l]*alpha_vdim[348][l]+f[52][l]*alpha_vdim[347][l]+f[51][l]*alpha_vdim[346][l]+f[50][l]*alpha_vdim[345][l]+f[49][l]*alpha_vdim[344][l]+f[48][l]*alpha_vdim[343][l]+f[47][l]*alpha_vdim[342][l]+f[40][l]*alpha_vdim[335][l]+f[39][l]*alpha_vdim[334][l]+f[38][l]*alpha_vdim[333][l]+f[37][l]*alpha_vdim[332][l]+f[36][l]*alpha_vdim[331][l]+f[35][l]*alpha_vdim[330][l]+f[34][l]*alpha_vdim[329][l]+f[33][l]*alpha_vdim[328][l]+f[32][l]*alpha_vdim[327][l]+f[21][l]*alpha_vdim[325][l]+f[20][l]*alpha_vdim[324][l]+f[19][l]*alpha_vdim[323][l]+f[18][l]*alpha_vdim[322][l]+f[17][l]*alpha_vdim[321][l]+f[6][l]*alpha_vdim[320][l]);
+    out[129][l] += 0.4841229182759271*(f[53][l]*alpha_vdim[363][l]+f[50][l]*alpha_vdim[362][l]+f[59][l]*alpha_vdim[348][l]+f[40][l]*alpha_vdim[347][l]+f[39][l]*alpha_vdim[346][l]+f[58][l]*alpha_vdim[345][l]+f[37][l]*alpha_vdim[344][l]+f[36][l]*alpha_vdim[343][l]+f[34][l]*alpha_vdim[342][l]+f[52][l]*alpha_vdim[335][l]+f[51][l]*alpha_vdim[334][l]+f[21][l]*alpha_vdim[333][l]+f[49][l]*alpha_vdim[332][l]+f[48][l]*alpha_vdim[331][l]+f[20][l]*alpha_vdim[330][l]+f[47][l]*alpha_vdim[329][l]+f[19][l]*alpha_vdim[328][l]+f[18][l]*alpha_vdim[327][l]+f[38][l]*alpha_vdim[325][l]+f[35][l]*alpha_vdim[324][l]+f[33][l]*alpha_vdim[323][l]+f[32][l]*alpha_vdim[322][l]+f[6][l]*alpha_vdim[321][l]+f[17][l]*alpha_vdim[320][l])+0.2165063509461096*(alpha_cdim[4][l]*f[132][l]+alpha_cdim[0][l]*f[128][l]);
+    out[130][l] += 0.4841229182759271*(f[52][l]*alpha_vdim[363][l]+f[49][l]*alpha_vdim[362][l]+f[40][l]*alpha_vdim[348][l]+f[59][l]*alpha_vdim[347][l]+f[38][l]*alpha_vdim[346][l]+f[37][l]*alpha_vdim[345][l]+f[58][l]*alpha_vdim[344][l]+f[35][l]*alpha_vdim[343][l]+f[33][l]*alpha_vdim[342][l]+f[53][l]*alpha_vdim[335][l]+f[21][l]*alpha_vdim[334][l]+f[51][l]*alpha_vdim[333][l]+f[50][l]*alpha_vdim[332][l]+f[20][l]*alpha_vdim[331][l]+f[48][l]*alpha_vdim[330][l]+f[19][l]*alpha_vdim[329][l]+f[47][l]*alpha_vdim[328][l]+f[17][l]*alpha_vdim[327][l]+f[39][l]*alpha_vdim[325][l]+f[36][l]*alpha_vdim[324][l]+f[34][l]*alpha_vdim[323][l]+f[6][l]*alpha_vdim[322][l]+f[32][l]*alpha_vdim[321][l]+f[18][l]*alpha_vdim[320][l])+0.2165063509461096*(f[133][l]*alpha_cdim[165][l]+f[128][l]*alpha_cdim[160][l]);
+    out[131][l] += 0.4841229182759271*(f[51][l]*alpha_vdim[363][l]+f[48][l]*alpha_vdim[362][l]+f[39][l]*alpha_vdim[348][l]+f[38][l]*alpha_vdim[347][l]+f[59][l]*alpha_vdim[346][l]+f[36][l]*alpha_vdim[345][l]+f[35][l]*alpha_vdim[344][l]+f[58][l]*alpha_vdim[343][l]+f[32][l]*alpha_vdim[342][l]+f[21][l]*alpha_vdim[335][l]+f[53][l]*alpha_vdim[334][l]+f[52][l]*alpha_vdim[333][l]+f[20][l]*alpha_vdim[332][l]+f[50][l]*alpha_vdim[331][l]+f[49][l]*alpha_vdim[330][l]+f[18][l]*alpha_vdim[329][l]+f[17][l]*alpha_vdim[328][l]+f[47][l]*alpha_vdim[327][l])+0.1936491673103708*f[6][l]*alpha_cdim[326][l]+0.4841229182759271*(f[40][l]*alpha_vdim[325][l]+f[37][l]*alpha_vdim[324][l]+f[6][l]*alpha_vdim[323][l]+f[34][l]*alpha_vdim[322][l]+f[33][l]*alpha_vdim[321][l]+f[19][l]*alpha_vdim[320][l])+0.2165063509461096*f[128][l]*alpha_cdim[320][l];
+    out[132][l] += 0.4841229182759271*f[63][l]*alpha_vdim[363][l]+0.4330127018922193*f[91][l]*alpha_vdim[362][l]+0.4841229182759271*(f[47][l]*alpha_vdim[362][l]+f[62][l]*alpha_vdim[348][l]+f[61][l]*alpha_vdim[347][l]+f[60][l]*alpha_vdim[346][l])+(0.4330127018922193*f[86][l]+0.4841229182759271*f[34][l])*alpha_vdim[345][l]+(0.4330127018922193*f[85][l]+0.4841229182759271*f[33][l])*alpha_vdim[344][l]+0.4330127018922193*f[84][l]*alpha_vdim[343][l]+0.4841229182759271*(f[32][l]*alpha_vdim[343][l]+f[58][l]*alpha_vdim[342][l]+f[56][l]*alpha_vdim[335][l]+f[55][l]*alpha_vdim[334][l]+f[54][l]*alpha_vdim[333][l])+(0.4330127018922193*f[78][l]+0.4841229182759271*f[19][l])*alpha_vdim[332][l]+(0.4330127018922193*f[77][l]+0.4841229182759271*f[18][l])*alpha_vdim[331][l]+0.4330127018922193*f[76][l]*alpha_vdim[330][l]+0.4841229182759271*(f[17][l]*alpha_vdim[330][l]+f[50][l]*alpha_vdim[329][l]+f[49][l]*alpha_vdim[328][l]+f[48][l]*alpha_vdim[327][l]+f[41][l]*alpha_vdim[325][l])+0.4330127018922193*f[69][l]*alpha_vdim[324][l]+0.4841229182759271*(f[6][l]*alpha_vdim[324][l]+f[37][l]*alpha_vdim[323][l]+f[36][l]*alpha_vdim[322][l]+f[35][l]*alpha_vdim[321][l]+f[20][l]*alpha_vdim[320][l])+0.2165063509461096*(alpha_vdim[43][l]*f[155][l]+alpha_vdim[28][l]*f[150][l]+alpha_vdim[27][l]*f[149][l]+alpha_vdim[26][l]*f[148][l]+alpha_vdim[22][l]*f[144][l]+alpha_vdim[15][l]*f[142][l]+alpha_vdim[14][l]*f[141][l]+alpha_vdim[13][l]*f[140][l]+alpha_vdim[9][l]*f[136][l]+alpha_vdim[8][l]*f[135][l]+alpha_vdim[7][l]*f[134][l]+alpha_vdim[5][l]*f[133][l]+alpha_vdim[3][l]*f[131][l]+alpha_vdim[2][l]*f[130][l]+alpha_vdim[1][l]*f[129][l]+alpha_vdim[0][l]*f[128][l])+0.1936491673103708*(alpha_vdim[47][l]*f[47][l]+alpha_vdim[34][l]*f[34][l]+alpha_vdim[33][l]*f[33][l]+alpha_vdim[32][l]*f[32][l]+alpha_vdim[19][l]*f[19][l]+alpha_vdim[18][l]*f[18][l]+alpha_vdim[17][l]*f[17][l]+alpha_vdim[6][l]*f[6][l]);
+    out[133][l] += 0.4330127018922193*f[123][l]*alpha_vdim[363][l]+0.4841229182759271*(f[47][l]*alpha_vdim[363][l]+f[63][l]*alpha_vdim[362][l])+(0.4330127018922193*f[118][l]+0.4841229182759271*f[34][l])*alpha_vdim[348][l]+(0.4330127018922193*f[117][l]+0.4841229182759271*f[33][l])*alpha_vdim[347][l]+0.4330127018922193*f[116][l]*alpha_vdim[346][l]+0.4841229182759271*(f[32][l]*alpha_vdim[346][l]+f[62][l]*alpha_vdim[345][l]+f[61][l]*alpha_vdim[344][l]+f[60][l]*alpha_vdim[343][l]+f[59][l]*alpha_vdim[342][l])+(0.4330127018922193*f[110][l]+0.4841229182759271*f[19][l])*alpha_vdim[335][l]+(0.4330127018922193*f[109][l]+0.4841229182759271*f[18][l])*alpha_vdim[334][l]+0.4330127018922193*f[108][l]*alpha_vdim[333][l]+0.4841229182759271*(f[17][l]*alpha_vdim[333][l]+f[56][l]*alpha_vdim[332][l]+f[55][l]*alpha_vdim[331][l]+f[54][l]*alpha_vdim[330][l]+f[53][l]*alpha_vdim[329][l]+f[52][l]*alpha_vdim[328][l]+f[51][l]*alpha_vdim[327][l])+0.4330127018922193*f[101][l]*alpha_vdim[325][l]+0.4841229182759271*(f[6][l]*alpha_vdim[325][l]+f[41][l]*alpha_vdim[324][l]+f[40][l]*alpha_vdim[323][l]+f[39][l]*alpha_vdim[322][l]+f[38][l]*alpha_vdim[321][l]+f[21][l]*alpha_vdim[320][l])+0.1936491673103708*f[47][l]*alpha_vdim[207][l]+0.2165063509461096*f[154][l]*alpha_vdim[202][l]+0.1936491673103708*(f[34][l]*alpha_vdim[194][l]+f[33][l]*alpha_vdim[193][l]+f[32][l]*alpha_vdim[192][l])+0.2165063509461096*(f[147][l]*alpha_vdim[185][l]+f[146][l]*alpha_vdim[184][l]+f[145][l]*alpha_vdim[183][l]+f[144][l]*alpha_vdim[182][l])+0.1936491673103708*(f[19][l]*alpha_vdim[179][l]+f[18][l]*alpha_vdim[178][l]+f[17][l]*alpha_vdim[177][l])+0.2165063509461096*(f[139][l]*alpha_vdim[172][l]+f[138][l]*alpha_vdim[171][l]+f[137][l]*alpha_vdim[170][l]+f[136][l]*alpha_vdim[169][l]+f[135][l]*alpha_vdim[168][l]+f[134][l]*alpha_vdim[167][l])+0.1936491673103708*f[6][l]*alpha_vdim[166][l]+0.2165063509461096*(f[132][l]*alpha_vdim[164][l]+f[131][l]*alpha_vdim[163][l]+f[130][l]*alpha_vdim[162][l]+f[129][l]*alpha_vdim[161][l]+f[128][l]*alpha_vdim[160][l]);
+    out[134][l] += 0.4841229182759271*(f[40][l]*alpha_vdim[363][l]+f[37][l]*alpha_vdim[362][l]+f[52][l]*alpha_vdim[348][l]+f[53][l]*alpha_vdim[347][l]+f[21][l]*alpha_vdim[346][l]+f[49][l]*alpha_vdim[345][l]+f[50][l]*alpha_vdim[344][l]+f[20][l]*alpha_vdim[343][l]+f[19][l]*alpha_vdim[342][l]+f[59][l]*alpha_vdim[335][l]+f[38][l]*alpha_vdim[334][l]+f[39][l]*alpha_vdim[333][l]+f[58][l]*alpha_vdim[332][l]+f[35][l]*alpha_vdim[331][l]+f[36][l]*alpha_vdim[330][l]+f[33][l]*alpha_vdim[329][l]+f[34][l]*alpha_vdim[328][l]+f[6][l]*alpha_vdim[327][l]+f[51][l]*alpha_vdim[325][l]+f[48][l]*alpha_vdim[324][l]+f[47][l]*alpha_vdim[323][l]+f[17][l]*alpha_vdim[322][l]+f[18][l]*alpha_vdim[321][l]+f[32][l]*alpha_vdim[320][l])+0.2165063509461096*(f[140][l]*alpha_cdim[165][l]+f[129][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[138][l]+alpha_cdim[0][l]*f[130][l]);
+    out[135][l] += 0.4841229182759271*(f[39][l]*alpha_vdim[363][l]+f[36][l]*alpha_vdim[362][l]+f[51][l]*alpha_vdim[348][l]+f[21][l]*alpha_vdim[347][l]+f[53][l]*alpha_vdim[346][l]+f[48][l]*alpha_vdim[345][l]+f[20][l]*alpha_vdim[344][l]+f[50][l]*alpha_vdim[343][l]+f[18][l]*alpha_vdim[342][l]+f[38][l]*alpha_vdim[335][l]+f[59][l]*alpha_vdim[334][l]+f[40][l]*alpha_vdim[333][l]+f[35][l]*alpha_vdim[332][l]+f[58][l]*alpha_vdim[331][l]+f[37][l]*alpha_vdim[330][l]+f[32][l]*alpha_vdim[329][l]+f[6][l]*alpha_vdim[328][l]+f[34][l]*alpha_vdim[327][l])+0.1936491673103708*f[17][l]*alpha_cdim[326][l]+0.4841229182759271*(f[52][l]*alpha_vdim[325][l]+f[49][l]*alpha_vdim[324][l]+f[17][l]*alpha_vdim[323][l]+f[47][l]*alpha_vdim[322][l]+f[19][l]*alpha_vdim[321][l]+f[33][l]*alpha_vdim[320][l])+0.2165063509461096*(f[129][l]*alpha_cdim[320][l]+alpha_cdim[4][l]*f[139][l]+alpha_cdim[0][l]*f[131][l]);
+    out[136][l] += 0.4841229182759271*(f[38][l]*alpha_vdim[363][l]+f[35][l]*alpha_vdim[362][l]+f[21][l]*alpha_vdim[348][l]+f[51][l]*alpha_vdim[347][l]+f[52][l]*alpha_vdim[346][l]+f[20][l]*alpha_vdim[345][l]+f[48][l]*alpha_vdim[344][l]+f[49][l]*alpha_vdim[343][l]+f[17][l]*alpha_vdim[342][l]+f[39][l]*alpha_vdim[335][l]+f[40][l]*alpha_vdim[334][l]+f[59][l]*alpha_vdim[333][l]+f[36][l]*alpha_vdim[332][l]+f[37][l]*alpha_vdim[331][l]+f[58][l]*alpha_vdim[330][l]+f[6][l]*alpha_vdim[329][l]+f[32][l]*alpha_vdim[328][l]+f[33][l]*alpha_vdim[327][l])+0.1936491673103708*f[18][l]*alpha_cdim[326][l]+0.4841229182759271*(f[53][l]*alpha_vdim[325][l]+f[50][l]*alpha_vdim[324][l]+f[18][l]*alpha_vdim[323][l]+f[19][l]*alpha_vdim[322][l]+f[47][l]*alpha_vdim[321][l]+f[34][l]*alpha_vdim[320][l])+0.2165063509461096*(f[130][l]*alpha_cdim[320][l]+f[142][l]*alpha_cdim[165][l]+f[131][l]*alpha_cdim[160][l]);
+    out[137][l] += 0.4841229182759271*f[62][l]*alpha_vdim[363][l]+0.4330127018922193*f[86][l]*alpha_vdim[362][l]+0.4841229182759271*(f[34][l]*alpha_vdim[362][l]+f[63][l]*alpha_vdim[348][l]+f[56][l]*alpha_vdim[347][l]+f[55][l]*alpha_vdim[346][l])+(0.4330127018922193*f[91][l]+0.4841229182759271*f[47][l])*alpha_vdim[345][l]+(0.4330127018922193*f[78][l]+0.4841229182759271*f[19][l])*alpha_vdim[344][l]+0.4330127018922193*f[77][l]*alpha_vdim[343][l]+0.4841229182759271*(f[18][l]*alpha_vdim[343][l]+f[50][l]*alpha_vdim[342][l]+f[61][l]*alpha_vdim[335][l]+f[60][l]*alpha_vdim[334][l]+f[41][l]*alpha_vdim[333][l])+(0.4330127018922193*f[85][l]+0.4841229182759271*f[33][l])*alpha_vdim[332][l]+(0.4330127018922193*f[84][l]+0.4841229182759271*f[32][l])*alpha_vdim[331][l]+0.4330127018922193*f[69][l]*alpha_vdim[330][l]+0.4841229182759271*(f[6][l]*alpha_vdim[330][l]+f[58][l]*alpha_vdim[329][l]+f[37][l]*alpha_vdim[328][l]+f[36][l]*alpha_vdim[327][l]+f[54][l]*alpha_vdim[325][l])+0.4330127018922193*f[76][l]*alpha_vdim[324][l]+0.4841229182759271*(f[17][l]*alpha_vdim[324][l]+f[49][l]*alpha_vdim[323][l]+f[48][l]*alpha_vdim[322][l]+f[20][l]*alpha_vdim[321][l]+f[35][l]*alpha_vdim[320][l])+0.2165063509461096*(alpha_vdim[28][l]*f[155][l]+alpha_vdim[43][l]*f[150][l]+alpha_vdim[15][l]*f[149][l]+alpha_vdim[14][l]*f[148][l]+alpha_vdim[9][l]*f[144][l]+alpha_vdim[27][l]*f[142][l]+alpha_vdim[26][l]*f[141][l]+alpha_vdim[5][l]*f[140][l]+alpha_vdim[22][l]*f[136][l]+alpha_vdim[3][l]*f[135][l]+alpha_vdim[2][l]*f[134][l]+alpha_vdim[13][l]*f[133][l]+alpha_cdim[0][l]*f[132][l]+alpha_vdim[8][l]*f[131][l]+alpha_vdim[7][l]*f[130][l]+alpha_vdim[0][l]*f[129][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[128][l])+0.1936491673103708*(alpha_vdim[34][l]*f[47][l]+f[34][l]*alpha_vdim[47][l]+alpha_vdim[19][l]*f[33][l]+f[19][l]*alpha_vdim[33][l]+alpha_vdim[18][l]*f[32][l]+f[18][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[17][l]+f[6][l]*alpha_vdim[17][l]);
+    out[138][l] += 0.4841229182759271*f[61][l]*alpha_vdim[363][l]+0.4330127018922193*f[85][l]*alpha_vdim[362][l]+0.4841229182759271*(f[33][l]*alpha_vdim[362][l]+f[56][l]*alpha_vdim[348][l]+f[63][l]*alpha_vdim[347][l]+f[54][l]*alpha_vdim[346][l])+(0.4330127018922193*f[78][l]+0.4841229182759271*f[19][l])*alpha_vdim[345][l]+(0.4330127018922193*f[91][l]+0.4841229182759271*f[47][l])*alpha_vdim[344][l]+0.4330127018922193*f[76][l]*alpha_vdim[343][l]+0.4841229182759271*(f[17][l]*alpha_vdim[343][l]+f[49][l]*alpha_vdim[342][l]+f[62][l]*alpha_vdim[335][l]+f[41][l]*alpha_vdim[334][l]+f[60][l]*alpha_vdim[333][l])+(0.4330127018922193*f[86][l]+0.4841229182759271*f[34][l])*alpha_vdim[332][l]+(0.4330127018922193*f[69][l]+0.4841229182759271*f[6][l])*alpha_vdim[331][l]+0.4330127018922193*f[84][l]*alpha_vdim[330][l]+0.4841229182759271*(f[32][l]*alpha_vdim[330][l]+f[37][l]*alpha_vdim[329][l]+f[58][l]*alpha_vdim[328][l]+f[35][l]*alpha_vdim[327][l]+f[55][l]*alpha_vdim[325][l])+0.4330127018922193*f[77][l]*alpha_vdim[324][l]+0.4841229182759271*(f[18][l]*alpha_vdim[324][l]+f[50][l]*alpha_vdim[323][l]+f[20][l]*alpha_vdim[322][l]+f[48][l]*alpha_vdim[321][l]+f[36][l]*alpha_vdim[320][l])+0.2165063509461096*(f[143][l]*alpha_cdim[165][l]+f[132][l]*alpha_cdim[160][l]+alpha_vdim[27][l]*f[155][l]+alpha_vdim[15][l]*f[150][l]+alpha_vdim[43][l]*f[149][l]+alpha_vdim[13][l]*f[148][l]+alpha_vdim[8][l]*f[144][l]+alpha_vdim[28][l]*f[142][l]+alpha_vdim[5][l]*f[141][l]+alpha_vdim[26][l]*f[140][l]+alpha_vdim[3][l]*f[136][l]+alpha_vdim[22][l]*f[135][l]+alpha_vdim[1][l]*f[134][l]+alpha_vdim[14][l]*f[133][l]+alpha_vdim[9][l]*f[131][l]+alpha_vdim[0][l]*f[130][l]+alpha_vdim[7][l]*f[129][l]+alpha_vdim[2][l]*f[128][l])+0.1936491673103708*(alpha_vdim[33][l]*f[47][l]+f[33][l]*alpha_vdim[47][l]+alpha_vdim[19][l]*f[34][l]+f[19][l]*alpha_vdim[34][l]+alpha_vdim[17][l]*f[32][l]+f[17][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[18][l]+f[6][l]*alpha_vdim[18][l]);
+    out[139][l] += 0.4841229182759271*f[60][l]*alpha_vdim[363][l]+0.4330127018922193*f[84][l]*alpha_vdim[362][l]+0.4841229182759271*(f[32][l]*alpha_vdim[362][l]+f[55][l]*alpha_vdim[348][l]+f[54][l]*alpha_vdim[347][l]+f[63][l]*alpha_vdim[346][l])+(0.4330127018922193*f[77][l]+0.4841229182759271*f[18][l])*alpha_vdim[345][l]+(0.4330127018922193*f[76][l]+0.4841229182759271*f[17][l])*alpha_vdim[344][l]+0.4330127018922193*f[91][l]*alpha_vdim[343][l]+0.4841229182759271*(f[47][l]*alpha_vdim[343][l]+f[48][l]*alpha_vdim[342][l]+f[41][l]*alpha_vdim[335][l]+f[62][l]*alpha_vdim[334][l]+f[61][l]*alpha_vdim[333][l])+(0.4330127018922193*f[69][l]+0.4841229182759271*f[6][l])*alpha_vdim[332][l]+(0.4330127018922193*f[86][l]+0.4841229182759271*f[34][l])*alpha_vdim[331][l]+0.4330127018922193*f[85][l]*alpha_vdim[330][l]+0.4841229182759271*(f[33][l]*alpha_vdim[330][l]+f[36][l]*alpha_vdim[329][l]+f[35][l]*alpha_vdim[328][l]+f[58][l]*alpha_vdim[327][l])+0.1936491673103708*f[20][l]*alpha_cdim[326][l]+0.4841229182759271*f[56][l]*alpha_vdim[325][l]+0.4330127018922193*f[78][l]*alpha_vdim[324][l]+0.4841229182759271*(f[19][l]*alpha_vdim[324][l]+f[20][l]*alpha_vdim[323][l]+f[50][l]*alpha_vdim[322][l]+f[49][l]*alpha_vdim[321][l]+f[37][l]*alpha_vdim[320][l])+0.2165063509461096*(f[132][l]*alpha_cdim[320][l]+alpha_vdim[26][l]*f[155][l]+alpha_vdim[14][l]*f[150][l]+alpha_vdim[13][l]*f[149][l]+alpha_vdim[43][l]*f[148][l]+alpha_vdim[7][l]*f[144][l]+alpha_vdim[5][l]*f[142][l]+alpha_vdim[28][l]*f[141][l]+alpha_vdim[27][l]*f[140][l]+alpha_vdim[2][l]*f[136][l]+alpha_vdim[1][l]*f[135][l]+alpha_vdim[22][l]*f[134][l]+alpha_vdim[15][l]*f[133][l]+alpha_vdim[0][l]*f[131][l]+alpha_vdim[9][l]*f[130][l]+alpha_vdim[8][l]*f[129][l]+alpha_vdim[3][l]*f[128][l])+0.1936491673103708*(alpha_vdim[32][l]*f[47][l]+f[32][l]*alpha_vdim[47][l]+alpha_vdim[18][l]*f[34][l]+f[18][l]*alpha_vdim[34][l]+alpha_vdim[17][l]*f[33][l]+f[17][l]*alpha_vdim[33][l]+alpha_vdim[6][l]*f[19][l]+f[6][l]*alpha_vdim[19][l]);
+    out[140][l] += 0.4330127018922193*f[118][l]*alpha_vdim[363][l]+0.4841229182759271*(f[34][l]*alpha_vdim[363][l]+f[62][l]*alpha_vdim[362][l])+(0.4330127018922193*f[123][l]+0.4841229182759271*f[47][l])*alpha_vdim[348][l]+(0.4330127018922193*f[110][l]+0.4841229182759271*f[19][l])*alpha_vdim[347][l]+0.4330127018922193*f[109][l]*alpha_vdim[346][l]+0.4841229182759271*(f[18][l]*alpha_vdim[346][l]+f[63][l]*alpha_vdim[345][l]+f[56][l]*alpha_vdim[344][l]+f[55][l]*alpha_vdim[343][l]+f[53][l]*alpha_vdim[342][l])+(0.4330127018922193*f[117][l]+0.4841229182759271*f[33][l])*alpha_vdim[335][l]+(0.4330127018922193*f[116][l]+0.4841229182759271*f[32][l])*alpha_vdim[334][l]+0.4330127018922193*f[101][l]*alpha_vdim[333][l]+0.4841229182759271*(f[6][l]*alpha_vdim[333][l]+f[61][l]*alpha_vdim[332][l]+f[60][l]*alpha_vdim[331][l]+f[41][l]*alpha_vdim[330][l]+f[59][l]*alpha_vdim[329][l]+f[40][l]*alpha_vdim[328][l]+f[39][l]*alpha_vdim[327][l])+0.4330127018922193*f[108][l]*alpha_vdim[325][l]+0.4841229182759271*(f[17][l]*alpha_vdim[325][l]+f[54][l]*alpha_vdim[324][l]+f[52][l]*alpha_vdim[323][l]+f[51][l]*alpha_vdim[322][l]+f[21][l]*alpha_vdim[321][l]+f[38][l]*alpha_vdim[320][l])+0.1936491673103708*f[34][l]*alpha_vdim[207][l]+0.2165063509461096*f[147][l]*alpha_vdim[202][l]+0.1936491673103708*(f[47][l]*alpha_vdim[194][l]+f[19][l]*alpha_vdim[193][l]+f[18][l]*alpha_vdim[192][l])+0.2165063509461096*(f[154][l]*alpha_vdim[185][l]+f[139][l]*alpha_vdim[184][l]+f[138][l]*alpha_vdim[183][l]+f[136][l]*alpha_vdim[182][l])+0.1936491673103708*(f[33][l]*alpha_vdim[179][l]+f[32][l]*alpha_vdim[178][l]+f[6][l]*alpha_vdim[177][l])+0.2165063509461096*(f[146][l]*alpha_vdim[172][l]+f[145][l]*alpha_vdim[171][l]+f[132][l]*alpha_vdim[170][l]+f[144][l]*alpha_vdim[169][l]+f[131][l]*alpha_vdim[168][l]+f[130][l]*alpha_vdim[167][l])+0.1936491673103708*f[17][l]*alpha_vdim[166][l]+0.2165063509461096*(f[137][l]*alpha_vdim[164][l]+f[135][l]*alpha_vdim[163][l]+f[134][l]*alpha_vdim[162][l]+f[128][l]*alpha_vdim[161][l]+f[129][l]*alpha_vdim[160][l]+alpha_cdim[4][l]*f[143][l]+alpha_cdim[0][l]*f[133][l]);
+    out[141][l] += 0.4330127018922193*f[117][l]*alpha_vdim[363][l]+0.4841229182759271*(f[33][l]*alpha_vdim[363][l]+f[61][l]*alpha_vdim[362][l])+(0.4330127018922193*f[110][l]+0.4841229182759271*f[19][l])*alpha_vdim[348][l]+(0.4330127018922193*f[123][l]+0.4841229182759271*f[47][l])*alpha_vdim[347][l]+0.4330127018922193*f[108][l]*alpha_vdim[346][l]+0.4841229182759271*(f[17][l]*alpha_vdim[346][l]+f[56][l]*alpha_vdim[345][l]+f[63][l]*alpha_vdim[344][l]+f[54][l]*alpha_vdim[343][l]+f[52][l]*alpha_vdim[342][l])+(0.4330127018922193*f[118][l]+0.4841229182759271*f[34][l])*alpha_vdim[335][l]+(0.4330127018922193*f[101][l]+0.4841229182759271*f[6][l])*alpha_vdim[334][l]+0.4330127018922193*f[116][l]*alpha_vdim[333][l]+0.4841229182759271*(f[32][l]*alpha_vdim[333][l]+f[62][l]*alpha_vdim[332][l]+f[41][l]*alpha_vdim[331][l]+f[60][l]*alpha_vdim[330][l]+f[40][l]*alpha_vdim[329][l]+f[59][l]*alpha_vdim[328][l]+f[38][l]*alpha_vdim[327][l])+0.4330127018922193*f[109][l]*alpha_vdim[325][l]+0.4841229182759271*(f[18][l]*alpha_vdim[325][l]+f[55][l]*alpha_vdim[324][l]+f[53][l]*alpha_vdim[323][l]+f[21][l]*alpha_vdim[322][l]+f[51][l]*alpha_vdim[321][l]+f[39][l]*alpha_vdim[320][l])+0.1936491673103708*f[33][l]*alpha_vdim[207][l]+0.2165063509461096*f[146][l]*alpha_vdim[202][l]+0.1936491673103708*(f[19][l]*alpha_vdim[194][l]+f[47][l]*alpha_vdim[193][l]+f[17][l]*alpha_vdim[192][l])+0.2165063509461096*(f[139][l]*alpha_vdim[185][l]+f[154][l]*alpha_vdim[184][l]+f[137][l]*alpha_vdim[183][l]+f[135][l]*alpha_vdim[182][l])+0.1936491673103708*(f[34][l]*alpha_vdim[179][l]+f[6][l]*alpha_vdim[178][l]+f[32][l]*alpha_vdim[177][l])+0.2165063509461096*(f[147][l]*alpha_vdim[172][l]+f[132][l]*alpha_vdim[171][l]+f[145][l]*alpha_vdim[170][l]+f[131][l]*alpha_vdim[169][l]+f[144][l]*alpha_vdim[168][l]+f[129][l]*alpha_vdim[167][l])+0.1936491673103708*f[18][l]*alpha_vdim[166][l]+0.2165063509461096*(f[128][l]*alpha_cdim[165][l]+f[138][l]*alpha_vdim[164][l]+f[136][l]*alpha_vdim[163][l]+f[128][l]*alpha_vdim[162][l]+f[134][l]*alpha_vdim[161][l]+f[130][l]*alpha_vdim[160][l]+f[133][l]*alpha_cdim[160][l]);
+    out[142][l] += 0.4330127018922193*f[116][l]*alpha_vdim[363][l]+0.4841229182759271*(f[32][l]*alpha_vdim[363][l]+f[60][l]*alpha_vdim[362][l])+(0.4330127018922193*f[109][l]+0.4841229182759271*f[18][l])*alpha_vdim[348][l]+(0.4330127018922193*f[108][l]+0.4841229182759271*f[17][l])*alpha_vdim[347][l]+0.4330127018922193*f[123][l]*alpha_vdim[346][l]+0.4841229182759271*(f[47][l]*alpha_vdim[346][l]+f[55][l]*alpha_vdim[345][l]+f[54][l]*alpha_vdim[344][l]+f[63][l]*alpha_vdim[343][l]+f[51][l]*alpha_vdim[342][l])+(0.4330127018922193*f[101][l]+0.4841229182759271*f[6][l])*alpha_vdim[335][l]+(0.4330127018922193*f[118][l]+0.4841229182759271*f[34][l])*alpha_vdim[334][l]+0.4330127018922193*f[117][l]*alpha_vdim[333][l]+0.4841229182759271*(f[33][l]*alpha_vdim[333][l]+f[41][l]*alpha_vdim[332][l]+f[62][l]*alpha_vdim[331][l]+f[61][l]*alpha_vdim[330][l]+f[39][l]*alpha_vdim[329][l]+f[38][l]*alpha_vdim[328][l]+f[59][l]*alpha_vdim[327][l])+0.1936491673103708*f[21][l]*alpha_cdim[326][l]+0.4330127018922193*f[110][l]*alpha_vdim[325][l]+0.4841229182759271*(f[19][l]*alpha_vdim[325][l]+f[56][l]*alpha_vdim[324][l]+f[21][l]*alpha_vdim[323][l]+f[53][l]*alpha_vdim[322][l]+f[52][l]*alpha_vdim[321][l]+f[40][l]*alpha_vdim[320][l])+0.2165063509461096*f[133][l]*alpha_cdim[320][l]+0.1936491673103708*f[32][l]*alpha_vdim[207][l]+0.2165063509461096*f[145][l]*alpha_vdim[202][l]+0.1936491673103708*(f[18][l]*alpha_vdim[194][l]+f[17][l]*alpha_vdim[193][l]+f[47][l]*alpha_vdim[192][l])+0.2165063509461096*(f[138][l]*alpha_vdim[185][l]+f[137][l]*alpha_vdim[184][l]+f[154][l]*alpha_vdim[183][l]+f[134][l]*alpha_vdim[182][l])+0.1936491673103708*(f[6][l]*alpha_vdim[179][l]+f[34][l]*alpha_vdim[178][l]+f[33][l]*alpha_vdim[177][l])+0.2165063509461096*(f[132][l]*alpha_vdim[172][l]+f[147][l]*alpha_vdim[171][l]+f[146][l]*alpha_vdim[170][l]+f[130][l]*alpha_vdim[169][l]+f[129][l]*alpha_vdim[168][l]+f[144][l]*alpha_vdim[167][l])+0.1936491673103708*f[19][l]*alpha_vdim[166][l]+0.2165063509461096*(f[139][l]*alpha_vdim[164][l]+f[128][l]*alpha_vdim[163][l]+f[136][l]*alpha_vdim[162][l]+f[135][l]*alpha_vdim[161][l]+f[131][l]*alpha_vdim[160][l]);
+    out[143][l] += (0.4330127018922193*f[127][l]+0.4841229182759271*f[58][l])*alpha_vdim[363][l]+(0.4330127018922193*f[95][l]+0.4841229182759271*f[59][l])*alpha_vdim[362][l]+(0.4330127018922193*f[126][l]+0.4841229182759271*f[50][l])*alpha_vdim[348][l]+(0.4330127018922193*f[125][l]+0.4841229182759271*f[49][l])*alpha_vdim[347][l]+(0.4330127018922193*f[124][l]+0.4841229182759271*f[48][l])*alpha_vdim[346][l]+(0.4330127018922193*f[94][l]+0.4841229182759271*f[53][l])*alpha_vdim[345][l]+(0.4330127018922193*f[93][l]+0.4841229182759271*f[52][l])*alpha_vdim[344][l]+0.4330127018922193*f[92][l]*alpha_vdim[343][l]+0.4841229182759271*(f[51][l]*alpha_vdim[343][l]+f[63][l]*alpha_vdim[342][l])+(0.4330127018922193*f[121][l]+0.4841229182759271*f[37][l])*alpha_vdim[335][l]+(0.4330127018922193*f[120][l]+0.4841229182759271*f[36][l])*alpha_vdim[334][l]+(0.4330127018922193*f[119][l]+0.4841229182759271*f[35][l])*alpha_vdim[333][l]+(0.4330127018922193*f[89][l]+0.4841229182759271*f[40][l])*alpha_vdim[332][l]+(0.4330127018922193*f[88][l]+0.4841229182759271*f[39][l])*alpha_vdim[331][l]+0.4330127018922193*f[87][l]*alpha_vdim[330][l]+0.4841229182759271*(f[38][l]*alpha_vdim[330][l]+f[62][l]*alpha_vdim[329][l]+f[61][l]*alpha_vdim[328][l]+f[60][l]*alpha_vdim[327][l])+(0.4330127018922193*f[111][l]+0.4841229182759271*f[20][l])*alpha_vdim[325][l]+0.4330127018922193*f[79][l]*alpha_vdim[324][l]+0.4841229182759271*(f[21][l]*alpha_vdim[324][l]+f[56][l]*alpha_vdim[323][l]+f[55][l]*alpha_vdim[322][l]+f[54][l]*alpha_vdim[321][l]+f[41][l]*alpha_vdim[320][l])+0.1936491673103708*f[58][l]*alpha_vdim[207][l]+0.2165063509461096*f[144][l]*alpha_vdim[202][l]+0.1936491673103708*(f[50][l]*alpha_vdim[194][l]+f[49][l]*alpha_vdim[193][l]+f[48][l]*alpha_vdim[192][l])+0.2165063509461096*(f[136][l]*alpha_vdim[185][l]+f[135][l]*alpha_vdim[184][l]+f[134][l]*alpha_vdim[183][l]+f[154][l]*alpha_vdim[182][l])+0.1936491673103708*(f[37][l]*alpha_vdim[179][l]+f[36][l]*alpha_vdim[178][l]+f[35][l]*alpha_vdim[177][l])+0.2165063509461096*(f[131][l]*alpha_vdim[172][l]+f[130][l]*alpha_vdim[171][l]+f[129][l]*alpha_vdim[170][l]+f[147][l]*alpha_vdim[169][l]+f[146][l]*alpha_vdim[168][l]+f[145][l]*alpha_vdim[167][l])+0.1936491673103708*f[20][l]*alpha_vdim[166][l]+0.2165063509461096*(f[128][l]*alpha_vdim[164][l]+f[139][l]*alpha_vdim[163][l]+f[138][l]*alpha_vdim[162][l]+f[137][l]*alpha_vdim[161][l]+f[132][l]*alpha_vdim[160][l]+alpha_vdim[22][l]*f[155][l]+alpha_vdim[9][l]*f[150][l]+alpha_vdim[8][l]*f[149][l]+alpha_vdim[7][l]*f[148][l]+alpha_vdim[43][l]*f[144][l]+alpha_vdim[3][l]*f[142][l]+alpha_vdim[2][l]*f[141][l]+alpha_vdim[1][l]*f[140][l]+alpha_vdim[28][l]*f[136][l]+alpha_vdim[27][l]*f[135][l]+alpha_vdim[26][l]*f[134][l]+alpha_vdim[0][l]*f[133][l]+alpha_vdim[15][l]*f[131][l]+alpha_vdim[14][l]*f[130][l]+alpha_vdim[13][l]*f[129][l]+alpha_vdim[5][l]*f[128][l])+0.1936491673103708*(alpha_vdim[47][l]*f[59][l]+alpha_vdim[34][l]*f[53][l]+alpha_vdim[33][l]*f[52][l]+alpha_vdim[32][l]*f[51][l]+alpha_vdim[19][l]*f[40][l]+alpha_vdim[18][l]*f[39][l]+alpha_vdim[17][l]*f[38][l]+alpha_vdim[6][l]*f[21][l]);
+    out[144][l] += 0.4841229182759271*(f[21][l]*alpha_vdim[363][l]+f[20][l]*alpha_vdim[362][l]+f[38][l]*alpha_vdim[348][l]+f[39][l]*alpha_vdim[347][l]+f[40][l]*alpha_vdim[346][l]+f[35][l]*alpha_vdim[345][l]+f[36][l]*alpha_vdim[344][l]+f[37][l]*alpha_vdim[343][l]+f[6][l]*alpha_vdim[342][l]+f[51][l]*alpha_vdim[335][l]+f[52][l]*alpha_vdim[334][l]+f[53][l]*alpha_vdim[333][l]+f[48][l]*alpha_vdim[332][l]+f[49][l]*alpha_vdim[331][l]+f[50][l]*alpha_vdim[330][l]+f[17][l]*alpha_vdim[329][l]+f[18][l]*alpha_vdim[328][l]+f[19][l]*alpha_vdim[327][l])+0.1936491673103708*f[32][l]*alpha_cdim[326][l]+0.4841229182759271*(f[59][l]*alpha_vdim[325][l]+f[58][l]*alpha_vdim[324][l]+f[32][l]*alpha_vdim[323][l]+f[33][l]*alpha_vdim[322][l]+f[34][l]*alpha_vdim[321][l]+f[47][l]*alpha_vdim[320][l])+0.2165063509461096*(f[134][l]*alpha_cdim[320][l]+f[149][l]*alpha_cdim[165][l]+f[135][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[147][l]+alpha_cdim[0][l]*f[136][l]);
+    out[145][l] += 0.4841229182759271*f[56][l]*alpha_vdim[363][l]+0.4330127018922193*f[78][l]*alpha_vdim[362][l]+0.4841229182759271*(f[19][l]*alpha_vdim[362][l]+f[61][l]*alpha_vdim[348][l]+f[62][l]*alpha_vdim[347][l]+f[41][l]*alpha_vdim[346][l])+(0.4330127018922193*f[85][l]+0.4841229182759271*f[33][l])*alpha_vdim[345][l]+(0.4330127018922193*f[86][l]+0.4841229182759271*f[34][l])*alpha_vdim[344][l]+0.4330127018922193*f[69][l]*alpha_vdim[343][l]+0.4841229182759271*(f[6][l]*alpha_vdim[343][l]+f[37][l]*alpha_vdim[342][l]+f[63][l]*alpha_vdim[335][l]+f[54][l]*alpha_vdim[334][l]+f[55][l]*alpha_vdim[333][l])+(0.4330127018922193*f[91][l]+0.4841229182759271*f[47][l])*alpha_vdim[332][l]+(0.4330127018922193*f[76][l]+0.4841229182759271*f[17][l])*alpha_vdim[331][l]+0.4330127018922193*f[77][l]*alpha_vdim[330][l]+0.4841229182759271*(f[18][l]*alpha_vdim[330][l]+f[49][l]*alpha_vdim[329][l]+f[50][l]*alpha_vdim[328][l]+f[20][l]*alpha_vdim[327][l]+f[60][l]*alpha_vdim[325][l])+0.4330127018922193*f[84][l]*alpha_vdim[324][l]+0.4841229182759271*(f[32][l]*alpha_vdim[324][l]+f[58][l]*alpha_vdim[323][l]+f[35][l]*alpha_vdim[322][l]+f[36][l]*alpha_vdim[321][l]+f[48][l]*alpha_vdim[320][l])+0.2165063509461096*(f[151][l]*alpha_cdim[165][l]+f[137][l]*alpha_cdim[160][l]+alpha_vdim[15][l]*f[155][l]+alpha_vdim[27][l]*f[150][l]+alpha_vdim[28][l]*f[149][l]+alpha_vdim[5][l]*f[148][l]+alpha_vdim[3][l]*f[144][l]+alpha_vdim[43][l]*f[142][l]+alpha_vdim[13][l]*f[141][l]+alpha_vdim[14][l]*f[140][l]+alpha_cdim[0][l]*f[138][l]+alpha_vdim[8][l]*f[136][l]+alpha_vdim[9][l]*f[135][l]+alpha_vdim[0][l]*f[134][l]+alpha_vdim[26][l]*f[133][l]+alpha_vdim[22][l]*f[131][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[130][l]+alpha_vdim[2][l]*f[129][l]+alpha_vdim[7][l]*f[128][l])+0.1936491673103708*(alpha_vdim[19][l]*f[47][l]+f[19][l]*alpha_vdim[47][l]+alpha_vdim[33][l]*f[34][l]+f[33][l]*alpha_vdim[34][l]+alpha_vdim[6][l]*f[32][l]+f[6][l]*alpha_vdim[32][l]+alpha_vdim[17][l]*f[18][l]+f[17][l]*alpha_vdim[18][l]);
+    out[146][l] += 0.4841229182759271*f[55][l]*alpha_vdim[363][l]+0.4330127018922193*f[77][l]*alpha_vdim[362][l]+0.4841229182759271*(f[18][l]*alpha_vdim[362][l]+f[60][l]*alpha_vdim[348][l]+f[41][l]*alpha_vdim[347][l]+f[62][l]*alpha_vdim[346][l])+(0.4330127018922193*f[84][l]+0.4841229182759271*f[32][l])*alpha_vdim[345][l]+(0.4330127018922193*f[69][l]+0.4841229182759271*f[6][l])*alpha_vdim[344][l]+0.4330127018922193*f[86][l]*alpha_vdim[343][l]+0.4841229182759271*(f[34][l]*alpha_vdim[343][l]+f[36][l]*alpha_vdim[342][l]+f[54][l]*alpha_vdim[335][l]+f[63][l]*alpha_vdim[334][l]+f[56][l]*alpha_vdim[333][l])+(0.4330127018922193*f[76][l]+0.4841229182759271*f[17][l])*alpha_vdim[332][l]+(0.4330127018922193*f[91][l]+0.4841229182759271*f[47][l])*alpha_vdim[331][l]+0.4330127018922193*f[78][l]*alpha_vdim[330][l]+0.4841229182759271*(f[19][l]*alpha_vdim[330][l]+f[48][l]*alpha_vdim[329][l]+f[20][l]*alpha_vdim[328][l]+f[50][l]*alpha_vdim[327][l])+0.1936491673103708*f[35][l]*alpha_cdim[326][l]+0.4841229182759271*f[61][l]*alpha_vdim[325][l]+0.4330127018922193*f[85][l]*alpha_vdim[324][l]+0.4841229182759271*(f[33][l]*alpha_vdim[324][l]+f[35][l]*alpha_vdim[323][l]+f[58][l]*alpha_vdim[322][l]+f[37][l]*alpha_vdim[321][l]+f[49][l]*alpha_vdim[320][l])+0.2165063509461096*(f[137][l]*alpha_cdim[320][l]+alpha_vdim[14][l]*f[155][l]+alpha_vdim[26][l]*f[150][l]+alpha_vdim[5][l]*f[149][l]+alpha_vdim[28][l]*f[148][l]+alpha_vdim[2][l]*f[144][l]+alpha_vdim[13][l]*f[142][l]+alpha_vdim[43][l]*f[141][l]+alpha_vdim[15][l]*f[140][l]+alpha_cdim[0][l]*f[139][l]+alpha_vdim[7][l]*f[136][l]+alpha_vdim[0][l]*f[135][l]+alpha_vdim[9][l]*f[134][l]+alpha_vdim[27][l]*f[133][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[131][l]+alpha_vdim[22][l]*f[130][l]+alpha_vdim[3][l]*f[129][l]+alpha_vdim[8][l]*f[128][l])+0.1936491673103708*(alpha_vdim[18][l]*f[47][l]+f[18][l]*alpha_vdim[47][l]+alpha_vdim[32][l]*f[34][l]+f[32][l]*alpha_vdim[34][l]+alpha_vdim[6][l]*f[33][l]+f[6][l]*alpha_vdim[33][l]+alpha_vdim[17][l]*f[19][l]+f[17][l]*alpha_vdim[19][l]);
+    out[147][l] += 0.4841229182759271*f[54][l]*alpha_vdim[363][l]+0.4330127018922193*f[76][l]*alpha_vdim[362][l]+0.4841229182759271*(f[17][l]*alpha_vdim[362][l]+f[41][l]*alpha_vdim[348][l]+f[60][l]*alpha_vdim[347][l]+f[61][l]*alpha_vdim[346][l])+(0.4330127018922193*f[69][l]+0.4841229182759271*f[6][l])*alpha_vdim[345][l]+(0.4330127018922193*f[84][l]+0.4841229182759271*f[32][l])*alpha_vdim[344][l]+0.4330127018922193*f[85][l]*alpha_vdim[343][l]+0.4841229182759271*(f[33][l]*alpha_vdim[343][l]+f[35][l]*alpha_vdim[342][l]+f[55][l]*alpha_vdim[335][l]+f[56][l]*alpha_vdim[334][l]+f[63][l]*alpha_vdim[333][l])+(0.4330127018922193*f[77][l]+0.4841229182759271*f[18][l])*alpha_vdim[332][l]+(0.4330127018922193*f[78][l]+0.4841229182759271*f[19][l])*alpha_vdim[331][l]+0.4330127018922193*f[91][l]*alpha_vdim[330][l]+0.4841229182759271*(f[47][l]*alpha_vdim[330][l]+f[20][l]*alpha_vdim[329][l]+f[48][l]*alpha_vdim[328][l]+f[49][l]*alpha_vdim[327][l])+0.1936491673103708*f[36][l]*alpha_cdim[326][l]+0.4841229182759271*f[62][l]*alpha_vdim[325][l]+0.4330127018922193*f[86][l]*alpha_vdim[324][l]+0.4841229182759271*(f[34][l]*alpha_vdim[324][l]+f[36][l]*alpha_vdim[323][l]+f[37][l]*alpha_vdim[322][l]+f[58][l]*alpha_vdim[321][l]+f[50][l]*alpha_vdim[320][l])+0.2165063509461096*(f[138][l]*alpha_cdim[320][l]+f[153][l]*alpha_cdim[165][l]+f[139][l]*alpha_cdim[160][l]+alpha_vdim[13][l]*f[155][l]+alpha_vdim[5][l]*f[150][l]+alpha_vdim[26][l]*f[149][l]+alpha_vdim[27][l]*f[148][l]+alpha_vdim[1][l]*f[144][l]+alpha_vdim[14][l]*f[142][l]+alpha_vdim[15][l]*f[141][l]+alpha_vdim[43][l]*f[140][l]+alpha_vdim[0][l]*f[136][l]+alpha_vdim[7][l]*f[135][l]+alpha_vdim[8][l]*f[134][l]+alpha_vdim[28][l]*f[133][l]+alpha_vdim[2][l]*f[131][l]+alpha_vdim[3][l]*f[130][l]+alpha_vdim[22][l]*f[129][l]+alpha_vdim[9][l]*f[128][l])+0.1936491673103708*(alpha_vdim[17][l]*f[47][l]+f[17][l]*alpha_vdim[47][l]+alpha_vdim[6][l]*f[34][l]+f[6][l]*alpha_vdim[34][l]+alpha_vdim[32][l]*f[33][l]+f[32][l]*alpha_vdim[33][l]+alpha_vdim[18][l]*f[19][l]+f[18][l]*alpha_vdim[19][l]);
+    out[148][l] += 0.4330127018922193*f[110][l]*alpha_vdim[363][l]+0.4841229182759271*(f[19][l]*alpha_vdim[363][l]+f[56][l]*alpha_vdim[362][l])+(0.4330127018922193*f[117][l]+0.4841229182759271*f[33][l])*alpha_vdim[348][l]+(0.4330127018922193*f[118][l]+0.4841229182759271*f[34][l])*alpha_vdim[347][l]+0.4330127018922193*f[101][l]*alpha_vdim[346][l]+0.4841229182759271*(f[6][l]*alpha_vdim[346][l]+f[61][l]*alpha_vdim[345][l]+f[62][l]*alpha_vdim[344][l]+f[41][l]*alpha_vdim[343][l]+f[40][l]*alpha_vdim[342][l])+(0.4330127018922193*f[123][l]+0.4841229182759271*f[47][l])*alpha_vdim[335][l]+(0.4330127018922193*f[108][l]+0.4841229182759271*f[17][l])*alpha_vdim[334][l]+0.4330127018922193*f[109][l]*alpha_vdim[333][l]+0.4841229182759271*(f[18][l]*alpha_vdim[333][l]+f[63][l]*alpha_vdim[332][l]+f[54][l]*alpha_vdim[331][l]+f[55][l]*alpha_vdim[330][l]+f[52][l]*alpha_vdim[329][l]+f[53][l]*alpha_vdim[328][l]+f[21][l]*alpha_vdim[327][l])+0.4330127018922193*f[116][l]*alpha_vdim[325][l]+0.4841229182759271*(f[32][l]*alpha_vdim[325][l]+f[60][l]*alpha_vdim[324][l]+f[59][l]*alpha_vdim[323][l]+f[38][l]*alpha_vdim[322][l]+f[39][l]*alpha_vdim[321][l]+f[51][l]*alpha_vdim[320][l])+0.1936491673103708*f[19][l]*alpha_vdim[207][l]+0.2165063509461096*f[139][l]*alpha_vdim[202][l]+0.1936491673103708*(f[33][l]*alpha_vdim[194][l]+f[34][l]*alpha_vdim[193][l]+f[6][l]*alpha_vdim[192][l])+0.2165063509461096*(f[146][l]*alpha_vdim[185][l]+f[147][l]*alpha_vdim[184][l]+f[132][l]*alpha_vdim[183][l]+f[131][l]*alpha_vdim[182][l])+0.1936491673103708*(f[47][l]*alpha_vdim[179][l]+f[17][l]*alpha_vdim[178][l]+f[18][l]*alpha_vdim[177][l])+0.2165063509461096*(f[154][l]*alpha_vdim[172][l]+f[137][l]*alpha_vdim[171][l]+f[138][l]*alpha_vdim[170][l]+f[135][l]*alpha_vdim[169][l]+f[136][l]*alpha_vdim[168][l]+f[128][l]*alpha_vdim[167][l])+0.1936491673103708*f[32][l]*alpha_vdim[166][l]+0.2165063509461096*(f[129][l]*alpha_cdim[165][l]+f[145][l]*alpha_vdim[164][l]+f[144][l]*alpha_vdim[163][l]+f[129][l]*alpha_vdim[162][l]+f[130][l]*alpha_vdim[161][l]+f[134][l]*alpha_vdim[160][l]+f[140][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[152][l]+alpha_cdim[0][l]*f[141][l]);
+    out[149][l] += 0.4330127018922193*f[109][l]*alpha_vdim[363][l]+0.4841229182759271*(f[18][l]*alpha_vdim[363][l]+f[55][l]*alpha_vdim[362][l])+(0.4330127018922193*f[116][l]+0.4841229182759271*f[32][l])*alpha_vdim[348][l]+(0.4330127018922193*f[101][l]+0.4841229182759271*f[6][l])*alpha_vdim[347][l]+0.4330127018922193*f[118][l]*alpha_vdim[346][l]+0.4841229182759271*(f[34][l]*alpha_vdim[346][l]+f[60][l]*alpha_vdim[345][l]+f[41][l]*alpha_vdim[344][l]+f[62][l]*alpha_vdim[343][l]+f[39][l]*alpha_vdim[342][l])+(0.4330127018922193*f[108][l]+0.4841229182759271*f[17][l])*alpha_vdim[335][l]+(0.4330127018922193*f[123][l]+0.4841229182759271*f[47][l])*alpha_vdim[334][l]+0.4330127018922193*f[110][l]*alpha_vdim[333][l]+0.4841229182759271*(f[19][l]*alpha_vdim[333][l]+f[54][l]*alpha_vdim[332][l]+f[63][l]*alpha_vdim[331][l]+f[56][l]*alpha_vdim[330][l]+f[51][l]*alpha_vdim[329][l]+f[21][l]*alpha_vdim[328][l]+f[53][l]*alpha_vdim[327][l])+0.1936491673103708*f[38][l]*alpha_cdim[326][l]+0.4330127018922193*f[117][l]*alpha_vdim[325][l]+0.4841229182759271*(f[33][l]*alpha_vdim[325][l]+f[61][l]*alpha_vdim[324][l]+f[38][l]*alpha_vdim[323][l]+f[59][l]*alpha_vdim[322][l]+f[40][l]*alpha_vdim[321][l]+f[52][l]*alpha_vdim[320][l])+0.2165063509461096*f[140][l]*alpha_cdim[320][l]+0.1936491673103708*f[18][l]*alpha_vdim[207][l]+0.2165063509461096*f[138][l]*alpha_vdim[202][l]+0.1936491673103708*(f[32][l]*alpha_vdim[194][l]+f[6][l]*alpha_vdim[193][l]+f[34][l]*alpha_vdim[192][l])+0.2165063509461096*(f[145][l]*alpha_vdim[185][l]+f[132][l]*alpha_vdim[184][l]+f[147][l]*alpha_vdim[183][l]+f[130][l]*alpha_vdim[182][l])+0.1936491673103708*(f[17][l]*alpha_vdim[179][l]+f[47][l]*alpha_vdim[178][l]+f[19][l]*alpha_vdim[177][l])+0.2165063509461096*(f[137][l]*alpha_vdim[172][l]+f[154][l]*alpha_vdim[171][l]+f[139][l]*alpha_vdim[170][l]+f[134][l]*alpha_vdim[169][l]+f[128][l]*alpha_vdim[168][l]+f[136][l]*alpha_vdim[167][l])+0.1936491673103708*f[33][l]*alpha_vdim[166][l]+0.2165063509461096*(f[146][l]*alpha_vdim[164][l]+f[129][l]*alpha_vdim[163][l]+f[144][l]*alpha_vdim[162][l]+f[131][l]*alpha_vdim[161][l]+f[135][l]*alpha_vdim[160][l]+alpha_cdim[4][l]*f[153][l]+alpha_cdim[0][l]*f[142][l]);
+    out[150][l] += 0.4330127018922193*f[108][l]*alpha_vdim[363][l]+0.4841229182759271*(f[17][l]*alpha_vdim[363][l]+f[54][l]*alpha_vdim[362][l])+(0.4330127018922193*f[101][l]+0.4841229182759271*f[6][l])*alpha_vdim[348][l]+(0.4330127018922193*f[116][l]+0.4841229182759271*f[32][l])*alpha_vdim[347][l]+0.4330127018922193*f[117][l]*alpha_vdim[346][l]+0.4841229182759271*(f[33][l]*alpha_vdim[346][l]+f[41][l]*alpha_vdim[345][l]+f[60][l]*alpha_vdim[344][l]+f[61][l]*alpha_vdim[343][l]+f[38][l]*alpha_vdim[342][l])+(0.4330127018922193*f[109][l]+0.4841229182759271*f[18][l])*alpha_vdim[335][l]+(0.4330127018922193*f[110][l]+0.4841229182759271*f[19][l])*alpha_vdim[334][l]+0.4330127018922193*f[123][l]*alpha_vdim[333][l]+0.4841229182759271*(f[47][l]*alpha_vdim[333][l]+f[55][l]*alpha_vdim[332][l]+f[56][l]*alpha_vdim[331][l]+f[63][l]*alpha_vdim[330][l]+f[21][l]*alpha_vdim[329][l]+f[51][l]*alpha_vdim[328][l]+f[52][l]*alpha_vdim[327][l])+0.1936491673103708*f[39][l]*alpha_cdim[326][l]+0.4330127018922193*f[118][l]*alpha_vdim[325][l]+0.4841229182759271*(f[34][l]*alpha_vdim[325][l]+f[62][l]*alpha_vdim[324][l]+f[39][l]*alpha_vdim[323][l]+f[40][l]*alpha_vdim[322][l]+f[59][l]*alpha_vdim[321][l]+f[53][l]*alpha_vdim[320][l])+0.2165063509461096*f[141][l]*alpha_cdim[320][l]+0.1936491673103708*f[17][l]*alpha_vdim[207][l]+0.2165063509461096*f[137][l]*alpha_vdim[202][l]+0.1936491673103708*(f[6][l]*alpha_vdim[194][l]+f[32][l]*alpha_vdim[193][l]+f[33][l]*alpha_vdim[192][l])+0.2165063509461096*(f[132][l]*alpha_vdim[185][l]+f[145][l]*alpha_vdim[184][l]+f[146][l]*alpha_vdim[183][l]+f[129][l]*alpha_vdim[182][l])+0.1936491673103708*(f[18][l]*alpha_vdim[179][l]+f[19][l]*alpha_vdim[178][l]+f[47][l]*alpha_vdim[177][l])+0.2165063509461096*(f[138][l]*alpha_vdim[172][l]+f[139][l]*alpha_vdim[171][l]+f[154][l]*alpha_vdim[170][l]+f[128][l]*alpha_vdim[169][l]+f[134][l]*alpha_vdim[168][l]+f[135][l]*alpha_vdim[167][l])+0.1936491673103708*f[34][l]*alpha_vdim[166][l]+0.2165063509461096*(f[131][l]*alpha_cdim[165][l]+f[147][l]*alpha_vdim[164][l]+f[130][l]*alpha_vdim[163][l]+f[131][l]*alpha_vdim[162][l]+f[144][l]*alpha_vdim[161][l]+f[136][l]*alpha_vdim[160][l]+f[142][l]*alpha_cdim[160][l]);
+    out[151][l] += (0.4330127018922193*f[126][l]+0.4841229182759271*f[50][l])*alpha_vdim[363][l]+(0.4330127018922193*f[94][l]+0.4841229182759271*f[53][l])*alpha_vdim[362][l]+(0.4330127018922193*f[127][l]+0.4841229182759271*f[58][l])*alpha_vdim[348][l]+(0.4330127018922193*f[121][l]+0.4841229182759271*f[37][l])*alpha_vdim[347][l]+(0.4330127018922193*f[120][l]+0.4841229182759271*f[36][l])*alpha_vdim[346][l]+(0.4330127018922193*f[95][l]+0.4841229182759271*f[59][l])*alpha_vdim[345][l]+(0.4330127018922193*f[89][l]+0.4841229182759271*f[40][l])*alpha_vdim[344][l]+0.4330127018922193*f[88][l]*alpha_vdim[343][l]+0.4841229182759271*(f[39][l]*alpha_vdim[343][l]+f[62][l]*alpha_vdim[342][l])+(0.4330127018922193*f[125][l]+0.4841229182759271*f[49][l])*alpha_vdim[335][l]+(0.4330127018922193*f[124][l]+0.4841229182759271*f[48][l])*alpha_vdim[334][l]+(0.4330127018922193*f[111][l]+0.4841229182759271*f[20][l])*alpha_vdim[333][l]+(0.4330127018922193*f[93][l]+0.4841229182759271*f[52][l])*alpha_vdim[332][l]+(0.4330127018922193*f[92][l]+0.4841229182759271*f[51][l])*alpha_vdim[331][l]+0.4330127018922193*f[79][l]*alpha_vdim[330][l]+0.4841229182759271*(f[21][l]*alpha_vdim[330][l]+f[63][l]*alpha_vdim[329][l]+f[56][l]*alpha_vdim[328][l]+f[55][l]*alpha_vdim[327][l])+(0.4330127018922193*f[119][l]+0.4841229182759271*f[35][l])*alpha_vdim[325][l]+0.4330127018922193*f[87][l]*alpha_vdim[324][l]+0.4841229182759271*(f[38][l]*alpha_vdim[324][l]+f[61][l]*alpha_vdim[323][l]+f[60][l]*alpha_vdim[322][l]+f[41][l]*alpha_vdim[321][l]+f[54][l]*alpha_vdim[320][l])+0.1936491673103708*f[50][l]*alpha_vdim[207][l]+0.2165063509461096*f[136][l]*alpha_vdim[202][l]+0.1936491673103708*(f[58][l]*alpha_vdim[194][l]+f[37][l]*alpha_vdim[193][l]+f[36][l]*alpha_vdim[192][l])+0.2165063509461096*(f[144][l]*alpha_vdim[185][l]+f[131][l]*alpha_vdim[184][l]+f[130][l]*alpha_vdim[183][l]+f[147][l]*alpha_vdim[182][l])+0.1936491673103708*(f[49][l]*alpha_vdim[179][l]+f[48][l]*alpha_vdim[178][l]+f[20][l]*alpha_vdim[177][l])+0.2165063509461096*(f[135][l]*alpha_vdim[172][l]+f[134][l]*alpha_vdim[171][l]+f[128][l]*alpha_vdim[170][l]+f[154][l]*alpha_vdim[169][l]+f[139][l]*alpha_vdim[168][l]+f[138][l]*alpha_vdim[167][l])+0.1936491673103708*f[35][l]*alpha_vdim[166][l]+0.2165063509461096*(f[129][l]*alpha_vdim[164][l]+f[146][l]*alpha_vdim[163][l]+f[145][l]*alpha_vdim[162][l]+f[132][l]*alpha_vdim[161][l]+f[137][l]*alpha_vdim[160][l]+alpha_vdim[9][l]*f[155][l]+alpha_vdim[22][l]*f[150][l]+alpha_vdim[3][l]*f[149][l]+alpha_vdim[2][l]*f[148][l]+alpha_vdim[28][l]*f[144][l]+alpha_cdim[0][l]*f[143][l]+alpha_vdim[8][l]*f[142][l]+alpha_vdim[7][l]*f[141][l]+alpha_vdim[0][l]*f[140][l]+alpha_vdim[43][l]*f[136][l]+alpha_vdim[15][l]*f[135][l]+alpha_vdim[14][l]*f[134][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[133][l]+alpha_vdim[27][l]*f[131][l]+alpha_vdim[26][l]*f[130][l]+alpha_vdim[5][l]*f[129][l]+alpha_vdim[13][l]*f[128][l])+0.1936491673103708*(alpha_vdim[34][l]*f[59][l]+alpha_vdim[47][l]*f[53][l]+alpha_vdim[19][l]*f[52][l]+alpha_vdim[18][l]*f[51][l]+alpha_vdim[33][l]*f[40][l]+alpha_vdim[32][l]*f[39][l]+alpha_vdim[6][l]*f[38][l]+alpha_vdim[17][l]*f[21][l]);
+    out[152][l] += (0.4330127018922193*f[125][l]+0.4841229182759271*f[49][l])*alpha_vdim[363][l]+(0.4330127018922193*f[93][l]+0.4841229182759271*f[52][l])*alpha_vdim[362][l]+(0.4330127018922193*f[121][l]+0.4841229182759271*f[37][l])*alpha_vdim[348][l]+(0.4330127018922193*f[127][l]+0.4841229182759271*f[58][l])*alpha_vdim[347][l]+(0.4330127018922193*f[119][l]+0.4841229182759271*f[35][l])*alpha_vdim[346][l]+(0.4330127018922193*f[89][l]+0.4841229182759271*f[40][l])*alpha_vdim[345][l]+(0.4330127018922193*f[95][l]+0.4841229182759271*f[59][l])*alpha_vdim[344][l]+0.4330127018922193*f[87][l]*alpha_vdim[343][l]+0.4841229182759271*(f[38][l]*alpha_vdim[343][l]+f[61][l]*alpha_vdim[342][l])+(0.4330127018922193*f[126][l]+0.4841229182759271*f[50][l])*alpha_vdim[335][l]+(0.4330127018922193*f[111][l]+0.4841229182759271*f[20][l])*alpha_vdim[334][l]+(0.4330127018922193*f[124][l]+0.4841229182759271*f[48][l])*alpha_vdim[333][l]+(0.4330127018922193*f[94][l]+0.4841229182759271*f[53][l])*alpha_vdim[332][l]+(0.4330127018922193*f[79][l]+0.4841229182759271*f[21][l])*alpha_vdim[331][l]+0.4330127018922193*f[92][l]*alpha_vdim[330][l]+0.4841229182759271*(f[51][l]*alpha_vdim[330][l]+f[56][l]*alpha_vdim[329][l]+f[63][l]*alpha_vdim[328][l]+f[54][l]*alpha_vdim[327][l])+(0.4330127018922193*f[120][l]+0.4841229182759271*f[36][l])*alpha_vdim[325][l]+0.4330127018922193*f[88][l]*alpha_vdim[324][l]+0.4841229182759271*(f[39][l]*alpha_vdim[324][l]+f[62][l]*alpha_vdim[323][l]+f[41][l]*alpha_vdim[322][l]+f[60][l]*alpha_vdim[321][l]+f[55][l]*alpha_vdim[320][l])+0.1936491673103708*f[49][l]*alpha_vdim[207][l]+0.2165063509461096*f[135][l]*alpha_vdim[202][l]+0.1936491673103708*(f[37][l]*alpha_vdim[194][l]+f[58][l]*alpha_vdim[193][l]+f[35][l]*alpha_vdim[192][l])+0.2165063509461096*(f[131][l]*alpha_vdim[185][l]+f[144][l]*alpha_vdim[184][l]+f[129][l]*alpha_vdim[183][l]+f[146][l]*alpha_vdim[182][l])+0.1936491673103708*(f[50][l]*alpha_vdim[179][l]+f[20][l]*alpha_vdim[178][l]+f[48][l]*alpha_vdim[177][l])+0.2165063509461096*(f[136][l]*alpha_vdim[172][l]+f[128][l]*alpha_vdim[171][l]+f[134][l]*alpha_vdim[170][l]+f[139][l]*alpha_vdim[169][l]+f[154][l]*alpha_vdim[168][l]+f[137][l]*alpha_vdim[167][l])+0.1936491673103708*f[36][l]*alpha_vdim[166][l]+0.2165063509461096*(f[132][l]*alpha_cdim[165][l]+f[130][l]*alpha_vdim[164][l]+f[147][l]*alpha_vdim[163][l]+f[132][l]*alpha_vdim[162][l]+f[145][l]*alpha_vdim[161][l]+f[138][l]*alpha_vdim[160][l]+f[143][l]*alpha_cdim[160][l]+alpha_vdim[8][l]*f[155][l]+alpha_vdim[3][l]*f[150][l]+alpha_vdim[22][l]*f[149][l]+alpha_vdim[1][l]*f[148][l]+alpha_vdim[27][l]*f[144][l]+alpha_vdim[9][l]*f[142][l]+alpha_vdim[0][l]*f[141][l]+alpha_vdim[7][l]*f[140][l]+alpha_vdim[15][l]*f[136][l]+alpha_vdim[43][l]*f[135][l]+alpha_vdim[13][l]*f[134][l]+alpha_vdim[2][l]*f[133][l]+alpha_vdim[28][l]*f[131][l]+alpha_vdim[5][l]*f[130][l]+alpha_vdim[26][l]*f[129][l]+alpha_vdim[14][l]*f[128][l])+0.1936491673103708*(alpha_vdim[33][l]*f[59][l]+alpha_vdim[19][l]*f[53][l]+alpha_vdim[47][l]*f[52][l]+alpha_vdim[17][l]*f[51][l]+alpha_vdim[34][l]*f[40][l]+alpha_vdim[6][l]*f[39][l]+alpha_vdim[32][l]*f[38][l]+alpha_vdim[18][l]*f[21][l]);
+    out[153][l] += (0.4330127018922193*f[124][l]+0.4841229182759271*f[48][l])*alpha_vdim[363][l]+(0.4330127018922193*f[92][l]+0.4841229182759271*f[51][l])*alpha_vdim[362][l]+(0.4330127018922193*f[120][l]+0.4841229182759271*f[36][l])*alpha_vdim[348][l]+(0.4330127018922193*f[119][l]+0.4841229182759271*f[35][l])*alpha_vdim[347][l]+(0.4330127018922193*f[127][l]+0.4841229182759271*f[58][l])*alpha_vdim[346][l]+(0.4330127018922193*f[88][l]+0.4841229182759271*f[39][l])*alpha_vdim[345][l]+(0.4330127018922193*f[87][l]+0.4841229182759271*f[38][l])*alpha_vdim[344][l]+0.4330127018922193*f[95][l]*alpha_vdim[343][l]+0.4841229182759271*(f[59][l]*alpha_vdim[343][l]+f[60][l]*alpha_vdim[342][l])+(0.4330127018922193*f[111][l]+0.4841229182759271*f[20][l])*alpha_vdim[335][l]+(0.4330127018922193*f[126][l]+0.4841229182759271*f[50][l])*alpha_vdim[334][l]+(0.4330127018922193*f[125][l]+0.4841229182759271*f[49][l])*alpha_vdim[333][l]+(0.4330127018922193*f[79][l]+0.4841229182759271*f[21][l])*alpha_vdim[332][l]+(0.4330127018922193*f[94][l]+0.4841229182759271*f[53][l])*alpha_vdim[331][l]+0.4330127018922193*f[93][l]*alpha_vdim[330][l]+0.4841229182759271*(f[52][l]*alpha_vdim[330][l]+f[55][l]*alpha_vdim[329][l]+f[54][l]*alpha_vdim[328][l]+f[63][l]*alpha_vdim[327][l])+0.1936491673103708*f[41][l]*alpha_cdim[326][l]+(0.4330127018922193*f[121][l]+0.4841229182759271*f[37][l])*alpha_vdim[325][l]+0.4330127018922193*f[89][l]*alpha_vdim[324][l]+0.4841229182759271*(f[40][l]*alpha_vdim[324][l]+f[41][l]*alpha_vdim[323][l]+f[62][l]*alpha_vdim[322][l]+f[61][l]*alpha_vdim[321][l]+f[56][l]*alpha_vdim[320][l])+0.2165063509461096*f[143][l]*alpha_cdim[320][l]+0.1936491673103708*f[48][l]*alpha_vdim[207][l]+0.2165063509461096*f[134][l]*alpha_vdim[202][l]+0.1936491673103708*(f[36][l]*alpha_vdim[194][l]+f[35][l]*alpha_vdim[193][l]+f[58][l]*alpha_vdim[192][l])+0.2165063509461096*(f[130][l]*alpha_vdim[185][l]+f[129][l]*alpha_vdim[184][l]+f[144][l]*alpha_vdim[183][l]+f[145][l]*alpha_vdim[182][l])+0.1936491673103708*(f[20][l]*alpha_vdim[179][l]+f[50][l]*alpha_vdim[178][l]+f[49][l]*alpha_vdim[177][l])+0.2165063509461096*(f[128][l]*alpha_vdim[172][l]+f[136][l]*alpha_vdim[171][l]+f[135][l]*alpha_vdim[170][l]+f[138][l]*alpha_vdim[169][l]+f[137][l]*alpha_vdim[168][l]+f[154][l]*alpha_vdim[167][l])+0.1936491673103708*f[37][l]*alpha_vdim[166][l]+0.2165063509461096*(f[131][l]*alpha_vdim[164][l]+f[132][l]*alpha_vdim[163][l]+f[147][l]*alpha_vdim[162][l]+f[146][l]*alpha_vdim[161][l]+f[139][l]*alpha_vdim[160][l]+alpha_vdim[7][l]*f[155][l]+alpha_vdim[2][l]*f[150][l]+alpha_vdim[1][l]*f[149][l]+alpha_vdim[22][l]*f[148][l]+alpha_vdim[26][l]*f[144][l]+alpha_vdim[0][l]*f[142][l]+alpha_vdim[9][l]*f[141][l]+alpha_vdim[8][l]*f[140][l]+alpha_vdim[14][l]*f[136][l]+alpha_vdim[13][l]*f[135][l]+alpha_vdim[43][l]*f[134][l]+alpha_vdim[3][l]*f[133][l]+alpha_vdim[5][l]*f[131][l]+alpha_vdim[28][l]*f[130][l]+alpha_vdim[27][l]*f[129][l]+alpha_vdim[15][l]*f[128][l])+0.1936491673103708*(alpha_vdim[32][l]*f[59][l]+alpha_vdim[18][l]*f[53][l]+alpha_vdim[17][l]*f[52][l]+alpha_vdim[47][l]*f[51][l]+alpha_vdim[6][l]*f[40][l]+alpha_vdim[34][l]*f[39][l]+alpha_vdim[33][l]*f[38][l]+alpha_vdim[19][l]*f[21][l]);
+    out[154][l] += 0.4841229182759271*f[41][l]*alpha_vdim[363][l]+0.4330127018922193*f[69][l]*alpha_vdim[362][l]+0.4841229182759271*(f[6][l]*alpha_vdim[362][l]+f[54][l]*alpha_vdim[348][l]+f[55][l]*alpha_vdim[347][l]+f[56][l]*alpha_vdim[346][l])+(0.4330127018922193*f[76][l]+0.4841229182759271*f[17][l])*alpha_vdim[345][l]+(0.4330127018922193*f[77][l]+0.4841229182759271*f[18][l])*alpha_vdim[344][l]+0.4330127018922193*f[78][l]*alpha_vdim[343][l]+0.4841229182759271*(f[19][l]*alpha_vdim[343][l]+f[20][l]*alpha_vdim[342][l]+f[60][l]*alpha_vdim[335][l]+f[61][l]*alpha_vdim[334][l]+f[62][l]*alpha_vdim[333][l])+(0.4330127018922193*f[84][l]+0.4841229182759271*f[32][l])*alpha_vdim[332][l]+(0.4330127018922193*f[85][l]+0.4841229182759271*f[33][l])*alpha_vdim[331][l]+0.4330127018922193*f[86][l]*alpha_vdim[330][l]+0.4841229182759271*(f[34][l]*alpha_vdim[330][l]+f[35][l]*alpha_vdim[329][l]+f[36][l]*alpha_vdim[328][l]+f[37][l]*alpha_vdim[327][l])+0.1936491673103708*f[48][l]*alpha_cdim[326][l]+0.4841229182759271*f[63][l]*alpha_vdim[325][l]+0.4330127018922193*f[91][l]*alpha_vdim[324][l]+0.4841229182759271*(f[47][l]*alpha_vdim[324][l]+f[48][l]*alpha_vdim[323][l]+f[49][l]*alpha_vdim[322][l]+f[50][l]*alpha_vdim[321][l]+f[58][l]*alpha_vdim[320][l])+0.2165063509461096*(f[145][l]*alpha_cdim[320][l]+f[157][l]*alpha_cdim[165][l]+f[146][l]*alpha_cdim[160][l]+alpha_vdim[5][l]*f[155][l]+alpha_vdim[13][l]*f[150][l]+alpha_vdim[14][l]*f[149][l]+alpha_vdim[15][l]*f[148][l]+alpha_cdim[0][l]*f[147][l]+alpha_vdim[0][l]*f[144][l]+alpha_vdim[26][l]*f[142][l]+alpha_vdim[27][l]*f[141][l]+alpha_vdim[28][l]*f[140][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[136][l]+alpha_vdim[2][l]*f[135][l]+alpha_vdim[3][l]*f[134][l]+alpha_vdim[43][l]*f[133][l]+alpha_vdim[7][l]*f[131][l]+alpha_vdim[8][l]*f[130][l]+alpha_vdim[9][l]*f[129][l]+alpha_vdim[22][l]*f[128][l])+0.1936491673103708*(alpha_vdim[6][l]*f[47][l]+f[6][l]*alpha_vdim[47][l]+alpha_vdim[17][l]*f[34][l]+f[17][l]*alpha_vdim[34][l]+alpha_vdim[18][l]*f[33][l]+f[18][l]*alpha_vdim[33][l]+alpha_vdim[19][l]*f[32][l]+f[19][l]*alpha_vdim[32][l]);
+    out[155][l] += 0.4330127018922193*f[101][l]*alpha_vdim[363][l]+0.4841229182759271*(f[6][l]*alpha_vdim[363][l]+f[41][l]*alpha_vdim[362][l])+(0.4330127018922193*f[108][l]+0.4841229182759271*f[17][l])*alpha_vdim[348][l]+(0.4330127018922193*f[109][l]+0.4841229182759271*f[18][l])*alpha_vdim[347][l]+0.4330127018922193*f[110][l]*alpha_vdim[346][l]+0.4841229182759271*(f[19][l]*alpha_vdim[346][l]+f[54][l]*alpha_vdim[345][l]+f[55][l]*alpha_vdim[344][l]+f[56][l]*alpha_vdim[343][l]+f[21][l]*alpha_vdim[342][l])+(0.4330127018922193*f[116][l]+0.4841229182759271*f[32][l])*alpha_vdim[335][l]+(0.4330127018922193*f[117][l]+0.4841229182759271*f[33][l])*alpha_vdim[334][l]+0.4330127018922193*f[118][l]*alpha_vdim[333][l]+0.4841229182759271*(f[34][l]*alpha_vdim[333][l]+f[60][l]*alpha_vdim[332][l]+f[61][l]*alpha_vdim[331][l]+f[62][l]*alpha_vdim[330][l]+f[38][l]*alpha_vdim[329][l]+f[39][l]*alpha_vdim[328][l]+f[40][l]*alpha_vdim[327][l])+0.1936491673103708*f[51][l]*alpha_cdim[326][l]+0.4330127018922193*f[123][l]*alpha_vdim[325][l]+0.4841229182759271*(f[47][l]*alpha_vdim[325][l]+f[63][l]*alpha_vdim[324][l]+f[51][l]*alpha_vdim[323][l]+f[52][l]*alpha_vdim[322][l]+f[53][l]*alpha_vdim[321][l]+f[59][l]*alpha_vdim[320][l])+0.2165063509461096*f[148][l]*alpha_cdim[320][l]+0.1936491673103708*f[6][l]*alpha_vdim[207][l]+0.2165063509461096*f[132][l]*alpha_vdim[202][l]+0.1936491673103708*(f[17][l]*alpha_vdim[194][l]+f[18][l]*alpha_vdim[193][l]+f[19][l]*alpha_vdim[192][l])+0.2165063509461096*(f[137][l]*alpha_vdim[185][l]+f[138][l]*alpha_vdim[184][l]+f[139][l]*alpha_vdim[183][l]+f[128][l]*alpha_vdim[182][l])+0.1936491673103708*(f[32][l]*alpha_vdim[179][l]+f[33][l]*alpha_vdim[178][l]+f[34][l]*alpha_vdim[177][l])+0.2165063509461096*(f[145][l]*alpha_vdim[172][l]+f[146][l]*alpha_vdim[171][l]+f[147][l]*alpha_vdim[170][l]+f[129][l]*alpha_vdim[169][l]+f[130][l]*alpha_vdim[168][l]+f[131][l]*alpha_vdim[167][l])+0.1936491673103708*f[47][l]*alpha_vdim[166][l]+0.2165063509461096*(f[135][l]*alpha_cdim[165][l]+f[154][l]*alpha_vdim[164][l]+f[134][l]*alpha_vdim[163][l]+f[135][l]*alpha_vdim[162][l]+f[136][l]*alpha_vdim[161][l]+f[144][l]*alpha_vdim[160][l]+f[149][l]*alpha_cdim[160][l]+alpha_cdim[4][l]*f[158][l]+alpha_cdim[0][l]*f[150][l]);
+    out[156][l] += (0.4330127018922193*f[121][l]+0.4841229182759271*f[37][l])*alpha_vdim[363][l]+(0.4330127018922193*f[89][l]+0.4841229182759271*f[40][l])*alpha_vdim[362][l]+(0.4330127018922193*f[125][l]+0.4841229182759271*f[49][l])*alpha_vdim[348][l]+(0.4330127018922193*f[126][l]+0.4841229182759271*f[50][l])*alpha_vdim[347][l]+(0.4330127018922193*f[111][l]+0.4841229182759271*f[20][l])*alpha_vdim[346][l]+(0.4330127018922193*f[93][l]+0.4841229182759271*f[52][l])*alpha_vdim[345][l]+(0.4330127018922193*f[94][l]+0.4841229182759271*f[53][l])*alpha_vdim[344][l]+0.4330127018922193*f[79][l]*alpha_vdim[343][l]+0.4841229182759271*(f[21][l]*alpha_vdim[343][l]+f[56][l]*alpha_vdim[342][l])+(0.4330127018922193*f[127][l]+0.4841229182759271*f[58][l])*alpha_vdim[335][l]+(0.4330127018922193*f[119][l]+0.4841229182759271*f[35][l])*alpha_vdim[334][l]+(0.4330127018922193*f[120][l]+0.4841229182759271*f[36][l])*alpha_vdim[333][l]+(0.4330127018922193*f[95][l]+0.4841229182759271*f[59][l])*alpha_vdim[332][l]+(0.4330127018922193*f[87][l]+0.4841229182759271*f[38][l])*alpha_vdim[331][l]+0.4330127018922193*f[88][l]*alpha_vdim[330][l]+0.4841229182759271*(f[39][l]*alpha_vdim[330][l]+f[61][l]*alpha_vdim[329][l]+f[62][l]*alpha_vdim[328][l]+f[41][l]*alpha_vdim[327][l])+(0.4330127018922193*f[124][l]+0.4841229182759271*f[48][l])*alpha_vdim[325][l]+0.4330127018922193*f[92][l]*alpha_vdim[324][l]+0.4841229182759271*(f[51][l]*alpha_vdim[324][l]+f[63][l]*alpha_vdim[323][l]+f[54][l]*alpha_vdim[322][l]+f[55][l]*alpha_vdim[321][l]+f[60][l]*alpha_vdim[320][l])+0.1936491673103708*f[37][l]*alpha_vdim[207][l]+0.2165063509461096*f[131][l]*alpha_vdim[202][l]+0.1936491673103708*(f[49][l]*alpha_vdim[194][l]+f[50][l]*alpha_vdim[193][l]+f[20][l]*alpha_vdim[192][l])+0.2165063509461096*(f[135][l]*alpha_vdim[185][l]+f[136][l]*alpha_vdim[184][l]+f[128][l]*alpha_vdim[183][l]+f[139][l]*alpha_vdim[182][l])+0.1936491673103708*(f[58][l]*alpha_vdim[179][l]+f[35][l]*alpha_vdim[178][l]+f[36][l]*alpha_vdim[177][l])+0.2165063509461096*(f[144][l]*alpha_vdim[172][l]+f[129][l]*alpha_vdim[171][l]+f[130][l]*alpha_vdim[170][l]+f[146][l]*alpha_vdim[169][l]+f[147][l]*alpha_vdim[168][l]+f[132][l]*alpha_vdim[167][l])+0.1936491673103708*f[48][l]*alpha_vdim[166][l]+0.2165063509461096*(f[137][l]*alpha_cdim[165][l]+f[134][l]*alpha_vdim[164][l]+f[154][l]*alpha_vdim[163][l]+f[137][l]*alpha_vdim[162][l]+f[138][l]*alpha_vdim[161][l]+f[145][l]*alpha_vdim[160][l]+f[151][l]*alpha_cdim[160][l]+alpha_vdim[3][l]*f[155][l]+alpha_cdim[0][l]*f[152][l]+alpha_vdim[8][l]*f[150][l]+alpha_vdim[9][l]*f[149][l]+alpha_vdim[0][l]*f[148][l]+alpha_vdim[15][l]*f[144][l]+alpha_vdim[22][l]*f[142][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[141][l]+alpha_vdim[2][l]*f[140][l]+alpha_vdim[27][l]*f[136][l]+alpha_vdim[28][l]*f[135][l]+alpha_vdim[5][l]*f[134][l]+alpha_vdim[7][l]*f[133][l]+alpha_vdim[43][l]*f[131][l]+alpha_vdim[13][l]*f[130][l]+alpha_vdim[14][l]*f[129][l]+alpha_vdim[26][l]*f[128][l])+0.1936491673103708*(alpha_vdim[19][l]*f[59][l]+alpha_vdim[33][l]*f[53][l]+alpha_vdim[34][l]*f[52][l]+alpha_vdim[6][l]*f[51][l]+f[40][l]*alpha_vdim[47][l]+alpha_vdim[17][l]*f[39][l]+alpha_vdim[18][l]*f[38][l]+f[21][l]*alpha_vdim[32][l]);
+    out[157][l] += (0.4330127018922193*f[120][l]+0.4841229182759271*f[36][l])*alpha_vdim[363][l]+(0.4330127018922193*f[88][l]+0.4841229182759271*f[39][l])*alpha_vdim[362][l]+(0.4330127018922193*f[124][l]+0.4841229182759271*f[48][l])*alpha_vdim[348][l]+(0.4330127018922193*f[111][l]+0.4841229182759271*f[20][l])*alpha_vdim[347][l]+(0.4330127018922193*f[126][l]+0.4841229182759271*f[50][l])*alpha_vdim[346][l]+(0.4330127018922193*f[92][l]+0.4841229182759271*f[51][l])*alpha_vdim[345][l]+(0.4330127018922193*f[79][l]+0.4841229182759271*f[21][l])*alpha_vdim[344][l]+0.4330127018922193*f[94][l]*alpha_vdim[343][l]+0.4841229182759271*(f[53][l]*alpha_vdim[343][l]+f[55][l]*alpha_vdim[342][l])+(0.4330127018922193*f[119][l]+0.4841229182759271*f[35][l])*alpha_vdim[335][l]+(0.4330127018922193*f[127][l]+0.4841229182759271*f[58][l])*alpha_vdim[334][l]+(0.4330127018922193*f[121][l]+0.4841229182759271*f[37][l])*alpha_vdim[333][l]+(0.4330127018922193*f[87][l]+0.4841229182759271*f[38][l])*alpha_vdim[332][l]+(0.4330127018922193*f[95][l]+0.4841229182759271*f[59][l])*alpha_vdim[331][l]+0.4330127018922193*f[89][l]*alpha_vdim[330][l]+0.4841229182759271*(f[40][l]*alpha_vdim[330][l]+f[60][l]*alpha_vdim[329][l]+f[41][l]*alpha_vdim[328][l]+f[62][l]*alpha_vdim[327][l])+0.1936491673103708*f[54][l]*alpha_cdim[326][l]+(0.4330127018922193*f[125][l]+0.4841229182759271*f[49][l])*alpha_vdim[325][l]+0.4330127018922193*f[93][l]*alpha_vdim[324][l]+0.4841229182759271*(f[52][l]*alpha_vdim[324][l]+f[54][l]*alpha_vdim[323][l]+f[63][l]*alpha_vdim[322][l]+f[56][l]*alpha_vdim[321][l]+f[61][l]*alpha_vdim[320][l])+0.2165063509461096*f[151][l]*alpha_cdim[320][l]+0.1936491673103708*f[36][l]*alpha_vdim[207][l]+0.2165063509461096*f[130][l]*alpha_vdim[202][l]+0.1936491673103708*(f[48][l]*alpha_vdim[194][l]+f[20][l]*alpha_vdim[193][l]+f[50][l]*alpha_vdim[192][l])+0.2165063509461096*(f[134][l]*alpha_vdim[185][l]+f[128][l]*alpha_vdim[184][l]+f[136][l]*alpha_vdim[183][l]+f[138][l]*alpha_vdim[182][l])+0.1936491673103708*(f[35][l]*alpha_vdim[179][l]+f[58][l]*alpha_vdim[178][l]+f[37][l]*alpha_vdim[177][l])+0.2165063509461096*(f[129][l]*alpha_vdim[172][l]+f[144][l]*alpha_vdim[171][l]+f[131][l]*alpha_vdim[170][l]+f[145][l]*alpha_vdim[169][l]+f[132][l]*alpha_vdim[168][l]+f[147][l]*alpha_vdim[167][l])+0.1936491673103708*f[49][l]*alpha_vdim[166][l]+0.2165063509461096*(f[135][l]*alpha_vdim[164][l]+f[137][l]*alpha_vdim[163][l]+f[154][l]*alpha_vdim[162][l]+f[139][l]*alpha_vdim[161][l]+f[146][l]*alpha_vdim[160][l]+alpha_vdim[2][l]*f[155][l]+alpha_cdim[0][l]*f[153][l]+alpha_vdim[7][l]*f[150][l]+alpha_vdim[0][l]*f[149][l]+alpha_vdim[9][l]*f[148][l]+alpha_vdim[14][l]*f[144][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[142][l]+alpha_vdim[22][l]*f[141][l]+alpha_vdim[3][l]*f[140][l]+alpha_vdim[26][l]*f[136][l]+alpha_vdim[5][l]*f[135][l]+alpha_vdim[28][l]*f[134][l]+alpha_vdim[8][l]*f[133][l]+alpha_vdim[13][l]*f[131][l]+alpha_vdim[43][l]*f[130][l]+alpha_vdim[15][l]*f[129][l]+alpha_vdim[27][l]*f[128][l])+0.1936491673103708*(alpha_vdim[18][l]*f[59][l]+alpha_vdim[32][l]*f[53][l]+alpha_vdim[6][l]*f[52][l]+alpha_vdim[34][l]*f[51][l]+f[39][l]*alpha_vdim[47][l]+alpha_vdim[17][l]*f[40][l]+alpha_vdim[19][l]*f[38][l]+f[21][l]*alpha_vdim[33][l]);
+    out[158][l] += (0.4330127018922193*f[119][l]+0.4841229182759271*f[35][l])*alpha_vdim[363][l]+(0.4330127018922193*f[87][l]+0.4841229182759271*f[38][l])*alpha_vdim[362][l]+(0.4330127018922193*f[111][l]+0.4841229182759271*f[20][l])*alpha_vdim[348][l]+(0.4330127018922193*f[124][l]+0.4841229182759271*f[48][l])*alpha_vdim[347][l]+(0.4330127018922193*f[125][l]+0.4841229182759271*f[49][l])*alpha_vdim[346][l]+(0.4330127018922193*f[79][l]+0.4841229182759271*f[21][l])*alpha_vdim[345][l]+(0.4330127018922193*f[92][l]+0.4841229182759271*f[51][l])*alpha_vdim[344][l]+0.4330127018922193*f[93][l]*alpha_vdim[343][l]+0.4841229182759271*(f[52][l]*alpha_vdim[343][l]+f[54][l]*alpha_vdim[342][l])+(0.4330127018922193*f[120][l]+0.4841229182759271*f[36][l])*alpha_vdim[335][l]+(0.4330127018922193*f[121][l]+0.4841229182759271*f[37][l])*alpha_vdim[334][l]+(0.4330127018922193*f[127][l]+0.4841229182759271*f[58][l])*alpha_vdim[333][l]+(0.4330127018922193*f[88][l]+0.4841229182759271*f[39][l])*alpha_vdim[332][l]+(0.4330127018922193*f[89][l]+0.4841229182759271*f[40][l])*alpha_vdim[331][l]+0.4330127018922193*f[95][l]*alpha_vdim[330][l]+0.4841229182759271*(f[59][l]*alpha_vdim[330][l]+f[41][l]*alpha_vdim[329][l]+f[60][l]*alpha_vdim[328][l]+f[61][l]*alpha_vdim[327][l])+0.1936491673103708*f[55][l]*alpha_cdim[326][l]+(0.4330127018922193*f[126][l]+0.4841229182759271*f[50][l])*alpha_vdim[325][l]+0.4330127018922193*f[94][l]*alpha_vdim[324][l]+0.4841229182759271*(f[53][l]*alpha_vdim[324][l]+f[55][l]*alpha_vdim[323][l]+f[56][l]*alpha_vdim[322][l]+f[63][l]*alpha_vdim[321][l]+f[62][l]*alpha_vdim[320][l])+0.2165063509461096*f[152][l]*alpha_cdim[320][l]+0.1936491673103708*f[35][l]*alpha_vdim[207][l]+0.2165063509461096*f[129][l]*alpha_vdim[202][l]+0.1936491673103708*(f[20][l]*alpha_vdim[194][l]+f[48][l]*alpha_vdim[193][l]+f[49][l]*alpha_vdim[192][l])+0.2165063509461096*(f[128][l]*alpha_vdim[185][l]+f[134][l]*alpha_vdim[184][l]+f[135][l]*alpha_vdim[183][l]+f[137][l]*alpha_vdim[182][l])+0.1936491673103708*(f[36][l]*alpha_vdim[179][l]+f[37][l]*alpha_vdim[178][l]+f[58][l]*alpha_vdim[177][l])+0.2165063509461096*(f[130][l]*alpha_vdim[172][l]+f[131][l]*alpha_vdim[171][l]+f[144][l]*alpha_vdim[170][l]+f[132][l]*alpha_vdim[169][l]+f[145][l]*alpha_vdim[168][l]+f[146][l]*alpha_vdim[167][l])+0.1936491673103708*f[50][l]*alpha_vdim[166][l]+0.2165063509461096*(f[139][l]*alpha_cdim[165][l]+f[136][l]*alpha_vdim[164][l]+f[138][l]*alpha_vdim[163][l]+f[139][l]*alpha_vdim[162][l]+f[154][l]*alpha_vdim[161][l]+f[147][l]*alpha_vdim[160][l]+f[153][l]*alpha_cdim[160][l]+alpha_vdim[1][l]*f[155][l]+alpha_vdim[0][l]*f[150][l]+alpha_vdim[7][l]*f[149][l]+alpha_vdim[8][l]*f[148][l]+alpha_vdim[13][l]*f[144][l]+alpha_vdim[2][l]*f[142][l]+alpha_vdim[3][l]*f[141][l]+alpha_vdim[22][l]*f[140][l]+alpha_vdim[5][l]*f[136][l]+alpha_vdim[26][l]*f[135][l]+alpha_vdim[27][l]*f[134][l]+alpha_vdim[9][l]*f[133][l]+alpha_vdim[14][l]*f[131][l]+alpha_vdim[15][l]*f[130][l]+alpha_vdim[43][l]*f[129][l]+alpha_vdim[28][l]*f[128][l])+0.1936491673103708*(alpha_vdim[17][l]*f[59][l]+alpha_vdim[6][l]*f[53][l]+alpha_vdim[32][l]*f[52][l]+alpha_vdim[33][l]*f[51][l]+f[38][l]*alpha_vdim[47][l]+alpha_vdim[18][l]*f[40][l]+alpha_vdim[19][l]*f[39][l]+f[21][l]*alpha_vdim[34][l]);
+    out[159][l] += (0.4330127018922193*f[111][l]+0.4841229182759271*f[20][l])*alpha_vdim[363][l]+(0.4330127018922193*f[79][l]+0.4841229182759271*f[21][l])*alpha_vdim[362][l]+(0.4330127018922193*f[119][l]+0.4841229182759271*f[35][l])*alpha_vdim[348][l]+(0.4330127018922193*f[120][l]+0.4841229182759271*f[36][l])*alpha_vdim[347][l]+(0.4330127018922193*f[121][l]+0.4841229182759271*f[37][l])*alpha_vdim[346][l]+(0.4330127018922193*f[87][l]+0.4841229182759271*f[38][l])*alpha_vdim[345][l]+(0.4330127018922193*f[88][l]+0.4841229182759271*f[39][l])*alpha_vdim[344][l]+0.4330127018922193*f[89][l]*alpha_vdim[343][l]+0.4841229182759271*(f[40][l]*alpha_vdim[343][l]+f[41][l]*alpha_vdim[342][l])+(0.4330127018922193*f[124][l]+0.4841229182759271*f[48][l])*alpha_vdim[335][l]+(0.4330127018922193*f[125][l]+0.4841229182759271*f[49][l])*alpha_vdim[334][l]+(0.4330127018922193*f[126][l]+0.4841229182759271*f[50][l])*alpha_vdim[333][l]+(0.4330127018922193*f[92][l]+0.4841229182759271*f[51][l])*alpha_vdim[332][l]+(0.4330127018922193*f[93][l]+0.4841229182759271*f[52][l])*alpha_vdim[331][l]+0.4330127018922193*f[94][l]*alpha_vdim[330][l]+0.4841229182759271*(f[53][l]*alpha_vdim[330][l]+f[54][l]*alpha_vdim[329][l]+f[55][l]*alpha_vdim[328][l]+f[56][l]*alpha_vdim[327][l])+0.1936491673103708*f[60][l]*alpha_cdim[326][l]+(0.4330127018922193*f[127][l]+0.4841229182759271*f[58][l])*alpha_vdim[325][l]+0.4330127018922193*f[95][l]*alpha_vdim[324][l]+0.4841229182759271*(f[59][l]*alpha_vdim[324][l]+f[60][l]*alpha_vdim[323][l]+f[61][l]*alpha_vdim[322][l]+f[62][l]*alpha_vdim[321][l]+f[63][l]*alpha_vdim[320][l])+0.2165063509461096*f[156][l]*alpha_cdim[320][l]+0.1936491673103708*f[20][l]*alpha_vdim[207][l]+0.2165063509461096*f[128][l]*alpha_vdim[202][l]+0.1936491673103708*(f[35][l]*alpha_vdim[194][l]+f[36][l]*alpha_vdim[193][l]+f[37][l]*alpha_vdim[192][l])+0.2165063509461096*(f[129][l]*alpha_vdim[185][l]+f[130][l]*alpha_vdim[184][l]+f[131][l]*alpha_vdim[183][l]+f[132][l]*alpha_vdim[182][l])+0.1936491673103708*(f[48][l]*alpha_vdim[179][l]+f[49][l]*alpha_vdim[178][l]+f[50][l]*alpha_vdim[177][l])+0.2165063509461096*(f[134][l]*alpha_vdim[172][l]+f[135][l]*alpha_vdim[171][l]+f[136][l]*alpha_vdim[170][l]+f[137][l]*alpha_vdim[169][l]+f[138][l]*alpha_vdim[168][l]+f[139][l]*alpha_vdim[167][l])+0.1936491673103708*f[58][l]*alpha_vdim[166][l]+0.2165063509461096*(f[146][l]*alpha_cdim[165][l]+f[144][l]*alpha_vdim[164][l]+f[145][l]*alpha_vdim[163][l]+f[146][l]*alpha_vdim[162][l]+f[147][l]*alpha_vdim[161][l]+f[154][l]*alpha_vdim[160][l]+f[157][l]*alpha_cdim[160][l]+alpha_cdim[0][l]*f[158][l]+alpha_vdim[0][l]*f[155][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[150][l]+alpha_vdim[2][l]*f[149][l]+alpha_vdim[3][l]*f[148][l]+alpha_vdim[5][l]*f[144][l]+alpha_vdim[7][l]*f[142][l]+alpha_vdim[8][l]*f[141][l]+alpha_vdim[9][l]*f[140][l]+alpha_vdim[13][l]*f[136][l]+alpha_vdim[14][l]*f[135][l]+alpha_vdim[15][l]*f[134][l]+alpha_vdim[22][l]*f[133][l]+alpha_vdim[26][l]*f[131][l]+alpha_vdim[27][l]*f[130][l]+alpha_vdim[28][l]*f[129][l]+alpha_vdim[43][l]*f[128][l])+0.1936491673103708*(alpha_vdim[6][l]*f[59][l]+alpha_vdim[17][l]*f[53][l]+alpha_vdim[18][l]*f[52][l]+alpha_vdim[19][l]*f[51][l]+f[21][l]*alpha_vdim[47][l]+alpha_vdim[32][l]*f[40][l]+alpha_vdim[33][l]*f[39][l]+alpha_vdim[34][l]*f[38][l]);
+
+    cfl[l] = cflFreq_mid;
+  } 
+} 
@@ -0,0 +1,197 @@
+#include <gkyl_vlasov_batch_kernels.h> 
+void vlasov_batch_vol_3x3v_tensor_p1(const double w[][GKYL_VLASOV_BATCH], const double *dxv, const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH], double* GKYL_RESTRICT cfl) 
+{ 
+  // Batched version of vlasov_vol_3x3v_tensor_p1: updates GKYL_VLASOV_BATCH cells
+  // in the same configuration-space cell. Cell data is transposed,
+  // w[d][lane], f[k][lane] and out[k][lane]; cfl[lane] is the
+  // CFL frequency of each cell.
+  // w[NDIM]:   Cell-center coordinates.
+  // dxv[NDIM]: Cell spacing.
+  // field:      q/m*EM fields.
+  // cot_vec:   Only used in gen geo.
+  // f:         Input distribution function.
+  // out:       Incremented output.
+  double dv0dx0 = dxv[3]/dxv[0];
+  double dv1dx1 = dxv[4]/dxv[1];
+  double dv2dx2 = dxv[5]/dxv[2];
+  const double dv10 = 2/dxv[3];
+  const double *E0 = &field[0];
+  const double dv11 = 2/dxv[4];
+  const double *E1 = &field[8];
+  const double dv12 = 2/dxv[5];
+  const double *E2 = &field[16];
+  const double *B0 = &field[24];
+  const double *B1 = &field[32];
+  const double *B2 = &field[40];
+
+  double alpha_cdim[192][GKYL_VLASOV_BATCH] = {{0.0}};
+  double alpha_vdim[192][GKYL_VLASOV_BATCH] = {{0.0}};
+
+#pragma GCC ivdep
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) { 
+    double w0dx0 = w[3][l]/dxv[0];
+    double w1dx1 = w[4][l]/dxv[1];
+    double w2dx2 = w[5][l]/dxv[2];
+    const double dv1 = dxv[3], wv1 = w[3][l];
+    const double dv2 = dxv[4], wv2 = w[4][l];
+    const double dv3 = dxv[5], wv3 = w[5][l];
+
+    double cflFreq_mid = 0.0;
+
+    alpha_cdim[0][l] = 16.0*w0dx0;
+    alpha_cdim[4][l] = 4.618802153517007*dv0dx0;
+    cflFreq_mid += 3.0*(fabs(w0dx0)+0.5*dv0dx0);
+
+    alpha_cdim[64][l] = 16.0*w1dx1;
+    alpha_cdim[69][l] = 4.618802153517007*dv1dx1;
+    cflFreq_mid += 3.0*(fabs(w1dx1)+0.5*dv1dx1);
+
+    alpha_cdim[128][l] = 16.0*w2dx2;
+    alpha_cdim[134][l] = 4.618802153517007*dv2dx2;
+    cflFreq_mid += 3.0*(fabs(w2dx2)+0.5*dv2dx2);
+
+    alpha_vdim[0][l] = dv10*(2.828427124746191*(B2[0]*wv2+E0[0])-2.828427124746191*B1[0]*wv3);
+    alpha_vdim[1][l] = dv10*(2.828427124746191*(B2[1]*wv2+E0[1])-2.828427124746191*B1[1]*wv3);
+    alpha_vdim[2][l] = dv10*(2.828427124746191*(B2[2]*wv2+E0[2])-2.828427124746191*B1[2]*wv3);
+    alpha_vdim[3][l] = dv10*(2.828427124746191*(B2[3]*wv2+E0[3])-2.828427124746191*B1[3]*wv3);
+    alpha_vdim[5][l] = 0.8164965809277261*B2[0]*dv10*dv2;
+    alpha_vdim[6][l] = -0.8164965809277261*B1[0]*dv10*dv3;
+    alpha_vdim[7][l] = dv10*(2.828427124746191*(B2[4]*wv2+E0[4])-2.828427124746191*B1[4]*wv3);
+    alpha_vdim[8][l] = dv10*(2.828427124746191*(B2[5]*wv2+E0[5])-2.828427124746191*B1[5]*wv3);
+    alpha_vdim[9][l] = dv10*(2.828427124746191*(B2[6]*wv2+E0[6])-2.828427124746191*B1[6]*wv3);
+    alpha_vdim[13][l] = 0.8164965809277261*B2[1]*dv10*dv2;
+    alpha_vdim[14][l] = 0.8164965809277261*B2[2]*dv10*dv2;
+    alpha_vdim[15][l] = 0.8164965809277261*B2[3]*dv10*dv2;
+    alpha_vdim[17][l] = -0.8164965809277261*B1[1]*dv10*dv3;
+    alpha_vdim[18][l] = -0.8164965809277261*B1[2]*dv10*dv3;
+    alpha_vdim[19][l] = -0.8164965809277261*B1[3]*dv10*dv3;
+    alpha_vdim[22][l] = dv10*(2.828427124746191*(B2[7]*wv2+E0[7])-2.828427124746191*B1[7]*wv3);
+    alpha_vdim[26][l] = 0.8164965809277261*B2[4]*dv10*dv2;
+    alpha_vdim[27][l] = 0.8164965809277261*B2[5]*dv10*dv2;
+    alpha_vdim[28][l] = 0.8164965809277261*B2[6]*dv10*dv2;
+    alpha_vdim[32][l] = -0.8164965809277261*B1[4]*dv10*dv3;
+    alpha_vdim[33][l] = -0.8164965809277261*B1[5]*dv10*dv3;
+    alpha_vdim[34][l] = -0.8164965809277261*B1[6]*dv10*dv3;
+    alpha_vdim[43][l] = 0.8164965809277261*B2[7]*dv10*dv2;
+    alpha_vdim[47][l] = -0.8164965809277261*B1[7]*dv10*dv3;
+    cflFreq_mid += 3.0*fabs(0.0625*alpha_vdim[0][l]);
+
+    alpha_vdim[64][l] = dv11*(2.828427124746191*B0[0]*wv3-2.828427124746191*B2[0]*wv1+2.828427124746191*E1[0]);
+    alpha_vdim[65][l] = dv11*(2.828427124746191*B0[1]*wv3-2.828427124746191*B2[1]*wv1+2.828427124746191*E1[1]);
+    alpha_vdim[66][l] = dv11*(2.828427124746191*B0[2]*wv3-2.828427124746191*B2[2]*wv1+2.828427124746191*E1[2]);
+    alpha_vdim[67][l] = dv11*(2.828427124746191*B0[3]*wv3-2.828427124746191*B2[3]*wv1+2.828427124746191*E1[3]);
+    alpha_vdim[68][l] = -0.8164965809277261*B2[0]*dv1*dv11;
+    alpha_vdim[70][l] = 0.8164965809277261*B0[0]*dv11*dv3;
+    alpha_vdim[71][l] = dv11*(2.828427124746191*B0[4]*wv3-2.828427124746191*B2[4]*wv1+2.828427124746191*E1[4]);
+    alpha_vdim[72][l] = dv11*(2.828427124746191*B0[5]*wv3-2.828427124746191*B2[5]*wv1+2.828427124746191*E1[5]);
+    alpha_vdim[73][l] = dv11*(2.828427124746191*B0[6]*wv3-2.828427124746191*B2[6]*wv1+2.828427124746191*E1[6]);
+    alpha_vdim[74][l] = -0.8164965809277261*B2[1]*dv1*dv11;
+    alpha_vdim[75][l] = -0.8164965809277261*B2[2]*dv1*dv11;
+    alpha_vdim[76][l] = -0.8164965809277261*B2[3]*dv1*dv11;
+    alpha_vdim[81][l] = 0.8164965809277261*B0[1]*dv11*dv3;
+    alpha_vdim[82][l] = 0.8164965809277261*B0[2]*dv11*dv3;
+    alpha_vdim[83][l] = 0.8164965809277261*B0[3]*dv11*dv3;
+    alpha_vdim[86][l] = dv11*(2.828427124746191*B0[7]*wv3-2.828427124746191*B2[7]*wv1+2.828427124746191*E1[7]);
+    alpha_vdim[87][l] = -0.8164965809277261*B2[4]*dv1*dv11;
+    alpha_vdim[88][l] = -0.8164965809277261*B2[5]*dv1*dv11;
+    alpha_vdim[89][l] = -0.8164965809277261*B2[6]*dv1*dv11;
+    alpha_vdim[96][l] = 0.8164965809277261*B0[4]*dv11*dv3;
+    alpha_vdim[97][l] = 0.8164965809277261*B0[5]*dv11*dv3;
+    alpha_vdim[98][l] = 0.8164965809277261*B0[6]*dv11*dv3;
+    alpha_vdim[106][l] = -0.8164965809277261*B2[7]*dv1*dv11;
+    alpha_vdim[111][l] = 0.8164965809277261*B0[7]*dv11*dv3;
+    cflFreq_mid += 3.0*fabs(0.0625*alpha_vdim[64][l]);
+
+    alpha_vdim[128][l] = dv12*(2.828427124746191*(B1[0]*wv1+E2[0])-2.828427124746191*B0[0]*wv2);
+    alpha_vdim[129][l] = dv12*(2.828427124746191*(B1[1]*wv1+E2[1])-2.828427124746191*B0[1]*wv2);
+    alpha_vdim[130][l] = dv12*(2.828427124746191*(B1[2]*wv1+E2[2])-2.828427124746191*B0[2]*wv2);
+    alpha_vdim[131][l] = dv12*(2.828427124746191*(B1[3]*wv1+E2[3])-2.828427124746191*B0[3]*wv2);
+    alpha_vdim[132][l] = 0.8164965809277261*B1[0]*dv1*dv12;
+    alpha_vdim[133][l] = -0.8164965809277261*B0[0]*dv12*dv2;
+    alpha_vdim[135][l] = dv12*(2.828427124746191*(B1[4]*wv1+E2[4])-2.828427124746191*B0[4]*wv2);
+    alpha_vdim[136][l] = dv12*(2.828427124746191*(B1[5]*wv1+E2[5])-2.828427124746191*B0[5]*wv2);
+    alpha_vdim[137][l] = dv12*(2.828427124746191*(B1[6]*wv1+E2[6])-2.828427124746191*B0[6]*wv2);
+    alpha_vdim[138][l] = 0.8164965809277261*B1[1]*dv1*dv12;
+    alpha_vdim[139][l] = 0.8164965809277261*B1[2]*dv1*dv12;
+    alpha_vdim[140][l] = 0.8164965809277261*B1[3]*dv1*dv12;
+    alpha_vdim[141][l] = -0.8164965809277261*B0[1]*dv12*dv2;
+    alpha_vdim[142][l] = -0.8164965809277261*B0[2]*dv12*dv2;
+    alpha_vdim[143][l] = -0.8164965809277261*B0[3]*dv12*dv2;
+    alpha_vdim[150][l] = dv12*(2.828427124746191*(B1[7]*wv1+E2[7])-2.828427124746191*B0[7]*wv2);
+    alpha_vdim[151][l] = 0.8164965809277261*B1[4]*dv1*dv12;
+    alpha_vdim[152][l] = 0.8164965809277261*B1[5]*dv1*dv12;
+    alpha_vdim[153][l] = 0.8164965809277261*B1[6]*dv1*dv12;
+    alpha_vdim[154][l] = -0.8164965809277261*B0[4]*dv12*dv2;
+    alpha_vdim[155][l] = -0.8164965809277261*B0[5]*dv12*dv2;
+    alpha_vdim[156][l] = -0.8164965809277261*B0[6]*dv12*dv2;
+    alpha_vdim[170][l] = 0.8164965809277261*B1[7]*dv1*dv12;
+    alpha_vdim[171][l] = -0.8164965809277261*B0[7]*dv12*dv2;
+    cflFreq_mid += 3.0*fabs(0.0625*alpha_vdim[128][l]);
+
+    out[1][l] += 0.2165063509461096*(alpha_cdim[4][l]*f[4][l]+alpha_cdim[0][l]*f[0][l]);
+    out[2][l] += 0.2165063509461096*(f[5][l]*alpha_cdim[69][l]+f[0][l]*alpha_cdim[64][l]);
+    out[3][l] += 0.2165063509461096*(f[6][l]*alpha_cdim[134][l]+f[0][l]*alpha_cdim[128][l]);
+    out[4][l] += 0.2165063509461096*(alpha_vdim[47][l]*f[47][l]+alpha_vdim[43][l]*f[43][l]+alpha_vdim[34][l]*f[34][l]+alpha_vdim[33][l]*f[33][l]+alpha_vdim[32][l]*f[32][l]+alpha_vdim[28][l]*f[28][l]+alpha_vdim[27][l]*f[27][l]+alpha_vdim[26][l]*f[26][l]+alpha_vdim[22][l]*f[22][l]+alpha_vdim[19][l]*f[19][l]+alpha_vdim[18][l]*f[18][l]+alpha_vdim[17][l]*f[17][l]+alpha_vdim[15][l]*f[15][l]+alpha_vdim[14][l]*f[14][l]+alpha_vdim[13][l]*f[13][l]+alpha_vdim[9][l]*f[9][l]+alpha_vdim[8][l]*f[8][l]+alpha_vdim[7][l]*f[7][l]+alpha_vdim[6][l]*f[6][l]+alpha_vdim[5][l]*f[5][l]+alpha_vdim[3][l]*f[3][l]+alpha_vdim[2][l]*f[2][l]+alpha_vdim[1][l]*f[1][l]+alpha_vdim[0][l]*f[0][l]);
+    out[5][l] += 0.2165063509461096*(f[47][l]*alpha_vdim[111][l]+f[42][l]*alpha_vdim[106][l]+f[34][l]*alpha_vdim[98][l]+f[33][l]*alpha_vdim[97][l]+f[32][l]*alpha_vdim[96][l]+f[25][l]*alpha_vdim[89][l]+f[24][l]*alpha_vdim[88][l]+f[23][l]*alpha_vdim[87][l]+f[22][l]*alpha_vdim[86][l]+f[19][l]*alpha_vdim[83][l]+f[18][l]*alpha_vdim[82][l]+f[17][l]*alpha_vdim[81][l]+f[12][l]*alpha_vdim[76][l]+f[11][l]*alpha_vdim[75][l]+f[10][l]*alpha_vdim[74][l]+f[9][l]*alpha_vdim[73][l]+f[8][l]*alpha_vdim[72][l]+f[7][l]*alpha_vdim[71][l]+f[6][l]*alpha_vdim[70][l]+f[4][l]*alpha_vdim[68][l]+f[3][l]*alpha_vdim[67][l]+f[2][l]*alpha_vdim[66][l]+f[1][l]*alpha_vdim[65][l]+f[0][l]*alpha_vdim[64][l]);
+    out[6][l] += 0.2165063509461096*(f[43][l]*alpha_vdim[171][l]+f[42][l]*alpha_vdim[170][l]+f[28][l]*alpha_vdim[156][l]+f[27][l]*alpha_vdim[155][l]+f[26][l]*alpha_vdim[154][l]+f[25][l]*alpha_vdim[153][l]+f[24][l]*alpha_vdim[152][l]+f[23][l]*alpha_vdim[151][l]+f[22][l]*alpha_vdim[150][l]+f[15][l]*alpha_vdim[143][l]+f[14][l]*alpha_vdim[142][l]+f[13][l]*alpha_vdim[141][l]+f[12][l]*alpha_vdim[140][l]+f[11][l]*alpha_vdim[139][l]+f[10][l]*alpha_vdim[138][l]+f[9][l]*alpha_vdim[137][l]+f[8][l]*alpha_vdim[136][l]+f[7][l]*alpha_vdim[135][l]+f[5][l]*alpha_vdim[133][l]+f[4][l]*alpha_vdim[132][l]+f[3][l]*alpha_vdim[131][l]+f[2][l]*alpha_vdim[130][l]+f[1][l]*alpha_vdim[129][l]+f[0][l]*alpha_vdim[128][l]);
+    out[7][l] += 0.2165063509461096*(f[13][l]*alpha_cdim[69][l]+f[1][l]*alpha_cdim[64][l]+alpha_cdim[4][l]*f[11][l]+alpha_cdim[0][l]*f[2][l]);
+    out[8][l] += 0.2165063509461096*(f[17][l]*alpha_cdim[134][l]+f[1][l]*alpha_cdim[128][l]+alpha_cdim[4][l]*f[12][l]+alpha_cdim[0][l]*f[3][l]);
+    out[9][l] += 0.2165063509461096*(f[18][l]*alpha_cdim[134][l]+f[2][l]*alpha_cdim[128][l]+f[15][l]*alpha_cdim[69][l]+f[3][l]*alpha_cdim[64][l]);
+    out[10][l] += 0.2165063509461096*(alpha_vdim[34][l]*f[47][l]+f[34][l]*alpha_vdim[47][l]+alpha_vdim[28][l]*f[43][l]+f[28][l]*alpha_vdim[43][l]+alpha_vdim[19][l]*f[33][l]+f[19][l]*alpha_vdim[33][l]+alpha_vdim[18][l]*f[32][l]+f[18][l]*alpha_vdim[32][l]+alpha_vdim[15][l]*f[27][l]+f[15][l]*alpha_vdim[27][l]+alpha_vdim[14][l]*f[26][l]+f[14][l]*alpha_vdim[26][l]+alpha_vdim[9][l]*f[22][l]+f[9][l]*alpha_vdim[22][l]+alpha_vdim[6][l]*f[17][l]+f[6][l]*alpha_vdim[17][l]+alpha_vdim[5][l]*f[13][l]+f[5][l]*alpha_vdim[13][l]+alpha_vdim[3][l]*f[8][l]+f[3][l]*alpha_vdim[8][l]+alpha_vdim[2][l]*f[7][l]+f[2][l]*alpha_vdim[7][l]+alpha_cdim[0][l]*f[4][l]+f[0][l]*alpha_cdim[4][l]+alpha_vdim[0][l]*f[1][l]+f[0][l]*alpha_vdim[1][l]);
+    out[11][l] += 0.2165063509461096*(f[16][l]*alpha_cdim[69][l]+f[4][l]*alpha_cdim[64][l]+alpha_vdim[33][l]*f[47][l]+f[33][l]*alpha_vdim[47][l]+alpha_vdim[27][l]*f[43][l]+f[27][l]*alpha_vdim[43][l]+alpha_vdim[19][l]*f[34][l]+f[19][l]*alpha_vdim[34][l]+alpha_vdim[17][l]*f[32][l]+f[17][l]*alpha_vdim[32][l]+alpha_vdim[15][l]*f[28][l]+f[15][l]*alpha_vdim[28][l]+alpha_vdim[13][l]*f[26][l]+f[13][l]*alpha_vdim[26][l]+alpha_vdim[8][l]*f[22][l]+f[8][l]*alpha_vdim[22][l]+alpha_vdim[6][l]*f[18][l]+f[6][l]*alpha_vdim[18][l]+alpha_vdim[5][l]*f[14][l]+f[5][l]*alpha_vdim[14][l]+alpha_vdim[3][l]*f[9][l]+f[3][l]*alpha_vdim[9][l]+alpha_vdim[1][l]*f[7][l]+f[1][l]*alpha_vdim[7][l]+alpha_vdim[0][l]*f[2][l]+f[0][l]*alpha_vdim[2][l]);
+    out[12][l] += 0.2165063509461096*(f[20][l]*alpha_cdim[134][l]+f[4][l]*alpha_cdim[128][l]+alpha_vdim[32][l]*f[47][l]+f[32][l]*alpha_vdim[47][l]+alpha_vdim[26][l]*f[43][l]+f[26][l]*alpha_vdim[43][l]+alpha_vdim[18][l]*f[34][l]+f[18][l]*alpha_vdim[34][l]+alpha_vdim[17][l]*f[33][l]+f[17][l]*alpha_vdim[33][l]+alpha_vdim[14][l]*f[28][l]+f[14][l]*alpha_vdim[28][l]+alpha_vdim[13][l]*f[27][l]+f[13][l]*alpha_vdim[27][l]+alpha_vdim[7][l]*f[22][l]+f[7][l]*alpha_vdim[22][l]+alpha_vdim[6][l]*f[19][l]+f[6][l]*alpha_vdim[19][l]+alpha_vdim[5][l]*f[15][l]+f[5][l]*alpha_vdim[15][l]+alpha_vdim[2][l]*f[9][l]+f[2][l]*alpha_vdim[9][l]+alpha_vdim[1][l]*f[8][l]+f[1][l]*alpha_vdim[8][l]+alpha_vdim[0][l]*f[3][l]+f[0][l]*alpha_vdim[3][l]);
+    out[13][l] += 0.2165063509461096*(f[34][l]*alpha_vdim[111][l]+f[25][l]*alpha_vdim[106][l]+f[47][l]*alpha_vdim[98][l]+f[19][l]*alpha_vdim[97][l]+f[18][l]*alpha_vdim[96][l]+f[42][l]*alpha_vdim[89][l]+f[12][l]*alpha_vdim[88][l]+f[11][l]*alpha_vdim[87][l]+f[9][l]*alpha_vdim[86][l]+f[33][l]*alpha_vdim[83][l]+f[32][l]*alpha_vdim[82][l]+f[6][l]*alpha_vdim[81][l]+f[24][l]*alpha_vdim[76][l]+f[23][l]*alpha_vdim[75][l]+f[4][l]*alpha_vdim[74][l]+f[22][l]*alpha_vdim[73][l]+f[3][l]*alpha_vdim[72][l]+f[2][l]*alpha_vdim[71][l]+f[17][l]*alpha_vdim[70][l]+f[10][l]*alpha_vdim[68][l]+f[8][l]*alpha_vdim[67][l]+f[7][l]*alpha_vdim[66][l]+f[0][l]*alpha_vdim[65][l]+f[1][l]*alpha_vdim[64][l]+alpha_cdim[4][l]*f[16][l]+alpha_cdim[0][l]*f[5][l]);
+    out[14][l] += 0.2165063509461096*(f[33][l]*alpha_vdim[111][l]+f[24][l]*alpha_vdim[106][l]+f[19][l]*alpha_vdim[98][l]+f[47][l]*alpha_vdim[97][l]+f[17][l]*alpha_vdim[96][l]+f[12][l]*alpha_vdim[89][l]+f[42][l]*alpha_vdim[88][l]+f[10][l]*alpha_vdim[87][l]+f[8][l]*alpha_vdim[86][l]+f[34][l]*alpha_vdim[83][l]+f[6][l]*alpha_vdim[82][l]+f[32][l]*alpha_vdim[81][l]+f[25][l]*alpha_vdim[76][l]+f[4][l]*alpha_vdim[75][l]+f[23][l]*alpha_vdim[74][l]+f[3][l]*alpha_vdim[73][l]+f[22][l]*alpha_vdim[72][l]+f[1][l]*alpha_vdim[71][l]+f[18][l]*alpha_vdim[70][l]+f[0][l]*alpha_cdim[69][l]+f[11][l]*alpha_vdim[68][l]+f[9][l]*alpha_vdim[67][l]+f[0][l]*alpha_vdim[66][l]+f[7][l]*alpha_vdim[65][l]+f[2][l]*alpha_vdim[64][l]+f[5][l]*alpha_cdim[64][l]);
+    out[15][l] += 0.2165063509461096*(f[21][l]*alpha_cdim[134][l]+f[5][l]*alpha_cdim[128][l]+f[32][l]*alpha_vdim[111][l]+f[23][l]*alpha_vdim[106][l]+f[18][l]*alpha_vdim[98][l]+f[17][l]*alpha_vdim[97][l]+f[47][l]*alpha_vdim[96][l]+f[11][l]*alpha_vdim[89][l]+f[10][l]*alpha_vdim[88][l]+f[42][l]*alpha_vdim[87][l]+f[7][l]*alpha_vdim[86][l]+f[6][l]*alpha_vdim[83][l]+f[34][l]*alpha_vdim[82][l]+f[33][l]*alpha_vdim[81][l]+f[4][l]*alpha_vdim[76][l]+f[25][l]*alpha_vdim[75][l]+f[24][l]*alpha_vdim[74][l]+f[2][l]*alpha_vdim[73][l]+f[1][l]*alpha_vdim[72][l]+f[22][l]*alpha_vdim[71][l]+f[19][l]*alpha_vdim[70][l]+f[12][l]*alpha_vdim[68][l]+f[0][l]*alpha_vdim[67][l]+f[9][l]*alpha_vdim[66][l]+f[8][l]*alpha_vdim[65][l]+f[3][l]*alpha_vdim[64][l]);
+    out[16][l] += 0.2165063509461096*(f[58][l]*alpha_vdim[111][l]+f[22][l]*alpha_vdim[106][l]+f[50][l]*alpha_vdim[98][l]+f[49][l]*alpha_vdim[97][l]+f[48][l]*alpha_vdim[96][l]+f[9][l]*alpha_vdim[89][l]+f[8][l]*alpha_vdim[88][l]+f[7][l]*alpha_vdim[87][l]+f[42][l]*alpha_vdim[86][l]+f[37][l]*alpha_vdim[83][l]+f[36][l]*alpha_vdim[82][l]+f[35][l]*alpha_vdim[81][l]+f[3][l]*alpha_vdim[76][l]+f[2][l]*alpha_vdim[75][l]+f[1][l]*alpha_vdim[74][l]+f[25][l]*alpha_vdim[73][l]+f[24][l]*alpha_vdim[72][l]+f[23][l]*alpha_vdim[71][l]+f[20][l]*alpha_vdim[70][l]+f[0][l]*alpha_vdim[68][l]+f[12][l]*alpha_vdim[67][l]+f[11][l]*alpha_vdim[66][l]+f[10][l]*alpha_vdim[65][l]+f[4][l]*alpha_vdim[64][l]+alpha_vdim[47][l]*f[59][l]+alpha_vdim[34][l]*f[53][l]+alpha_vdim[33][l]*f[52][l]+alpha_vdim[32][l]*f[51][l]+alpha_vdim[22][l]*f[43][l]+f[22][l]*alpha_vdim[43][l]+alpha_vdim[19][l]*f[40][l]+alpha_vdim[18][l]*f[39][l]+alpha_vdim[17][l]*f[38][l]+alpha_vdim[9][l]*f[28][l]+f[9][l]*alpha_vdim[28][l]+alpha_vdim[8][l]*f[27][l]+f[8][l]*alpha_vdim[27][l]+alpha_vdim[7][l]*f[26][l]+f[7][l]*alpha_vdim[26][l]+alpha_vdim[6][l]*f[21][l]+alpha_vdim[3][l]*f[15][l]+f[3][l]*alpha_vdim[15][l]+alpha_vdim[2][l]*f[14][l]+f[2][l]*alpha_vdim[14][l]+alpha_vdim[1][l]*f[13][l]+f[1][l]*alpha_vdim[13][l]+alpha_vdim[0][l]*f[5][l]+f[0][l]*alpha_vdim[5][l]);
+    out[17][l] += 0.2165063509461096*(f[28][l]*alpha_vdim[171][l]+f[25][l]*alpha_vdim[170][l]+f[43][l]*alpha_vdim[156][l]+f[15][l]*alpha_vdim[155][l]+f[14][l]*alpha_vdim[154][l]+f[42][l]*alpha_vdim[153][l]+f[12][l]*alpha_vdim[152][l]+f[11][l]*alpha_vdim[151][l]+f[9][l]*alpha_vdim[150][l]+f[27][l]*alpha_vdim[143][l]+f[26][l]*alpha_vdim[142][l]+f[5][l]*alpha_vdim[141][l]+f[24][l]*alpha_vdim[140][l]+f[23][l]*alpha_vdim[139][l]+f[4][l]*alpha_vdim[138][l]+f[22][l]*alpha_vdim[137][l]+f[3][l]*alpha_vdim[136][l]+f[2][l]*alpha_vdim[135][l]+f[13][l]*alpha_vdim[133][l]+f[10][l]*alpha_vdim[132][l]+f[8][l]*alpha_vdim[131][l]+f[7][l]*alpha_vdim[130][l]+f[0][l]*alpha_vdim[129][l]+f[1][l]*alpha_vdim[128][l]+alpha_cdim[4][l]*f[20][l]+alpha_cdim[0][l]*f[6][l]);
+    out[18][l] += 0.2165063509461096*(f[27][l]*alpha_vdim[171][l]+f[24][l]*alpha_vdim[170][l]+f[15][l]*alpha_vdim[156][l]+f[43][l]*alpha_vdim[155][l]+f[13][l]*alpha_vdim[154][l]+f[12][l]*alpha_vdim[153][l]+f[42][l]*alpha_vdim[152][l]+f[10][l]*alpha_vdim[151][l]+f[8][l]*alpha_vdim[150][l]+f[28][l]*alpha_vdim[143][l]+f[5][l]*alpha_vdim[142][l]+f[26][l]*alpha_vdim[141][l]+f[25][l]*alpha_vdim[140][l]+f[4][l]*alpha_vdim[139][l]+f[23][l]*alpha_vdim[138][l]+f[3][l]*alpha_vdim[137][l]+f[22][l]*alpha_vdim[136][l]+f[1][l]*alpha_vdim[135][l]+f[14][l]*alpha_vdim[133][l]+f[11][l]*alpha_vdim[132][l]+f[9][l]*alpha_vdim[131][l]+f[0][l]*alpha_vdim[130][l]+f[7][l]*alpha_vdim[129][l]+f[2][l]*alpha_vdim[128][l]+f[21][l]*alpha_cdim[69][l]+f[6][l]*alpha_cdim[64][l]);
+    out[19][l] += 0.2165063509461096*(f[26][l]*alpha_vdim[171][l]+f[23][l]*alpha_vdim[170][l]+f[14][l]*alpha_vdim[156][l]+f[13][l]*alpha_vdim[155][l]+f[43][l]*alpha_vdim[154][l]+f[11][l]*alpha_vdim[153][l]+f[10][l]*alpha_vdim[152][l]+f[42][l]*alpha_vdim[151][l]+f[7][l]*alpha_vdim[150][l]+f[5][l]*alpha_vdim[143][l]+f[28][l]*alpha_vdim[142][l]+f[27][l]*alpha_vdim[141][l]+f[4][l]*alpha_vdim[140][l]+f[25][l]*alpha_vdim[139][l]+f[24][l]*alpha_vdim[138][l]+f[2][l]*alpha_vdim[137][l]+f[1][l]*alpha_vdim[136][l]+f[22][l]*alpha_vdim[135][l]+f[0][l]*alpha_cdim[134][l]+f[15][l]*alpha_vdim[133][l]+f[12][l]*alpha_vdim[132][l]+f[0][l]*alpha_vdim[131][l]+f[9][l]*alpha_vdim[130][l]+f[8][l]*alpha_vdim[129][l]+f[3][l]*alpha_vdim[128][l]+f[6][l]*alpha_cdim[128][l]);
+    out[20][l] += 0.2165063509461096*(f[57][l]*alpha_vdim[171][l]+f[22][l]*alpha_vdim[170][l]+f[46][l]*alpha_vdim[156][l]+f[45][l]*alpha_vdim[155][l]+f[44][l]*alpha_vdim[154][l]+f[9][l]*alpha_vdim[153][l]+f[8][l]*alpha_vdim[152][l]+f[7][l]*alpha_vdim[151][l]+f[42][l]*alpha_vdim[150][l]+f[31][l]*alpha_vdim[143][l]+f[30][l]*alpha_vdim[142][l]+f[29][l]*alpha_vdim[141][l]+f[3][l]*alpha_vdim[140][l]+f[2][l]*alpha_vdim[139][l]+f[1][l]*alpha_vdim[138][l]+f[25][l]*alpha_vdim[137][l]+f[24][l]*alpha_vdim[136][l]+f[23][l]*alpha_vdim[135][l]+f[16][l]*alpha_vdim[133][l]+f[0][l]*alpha_vdim[132][l]+f[12][l]*alpha_vdim[131][l]+f[11][l]*alpha_vdim[130][l]+f[10][l]*alpha_vdim[129][l]+f[4][l]*alpha_vdim[128][l]+alpha_vdim[43][l]*f[59][l]+alpha_vdim[28][l]*f[53][l]+alpha_vdim[27][l]*f[52][l]+alpha_vdim[26][l]*f[51][l]+alpha_vdim[22][l]*f[47][l]+f[22][l]*alpha_vdim[47][l]+alpha_vdim[15][l]*f[40][l]+alpha_vdim[14][l]*f[39][l]+alpha_vdim[13][l]*f[38][l]+alpha_vdim[9][l]*f[34][l]+f[9][l]*alpha_vdim[34][l]+alpha_vdim[8][l]*f[33][l]+f[8][l]*alpha_vdim[33][l]+alpha_vdim[7][l]*f[32][l]+f[7][l]*alpha_vdim[32][l]+alpha_vdim[5][l]*f[21][l]+alpha_vdim[3][l]*f[19][l]+f[3][l]*alpha_vdim[19][l]+alpha_vdim[2][l]*f[18][l]+f[2][l]*alpha_vdim[18][l]+alpha_vdim[1][l]*f[17][l]+f[1][l]*alpha_vdim[17][l]+alpha_vdim[0][l]*f[6][l]+f[0][l]*alpha_vdim[6][l]);
+    out[21][l] += 0.2165063509461096*(f[22][l]*alpha_vdim[171][l]+f[57][l]*alpha_vdim[170][l]+f[9][l]*alpha_vdim[156][l]+f[8][l]*alpha_vdim[155][l]+f[7][l]*alpha_vdim[154][l]+f[46][l]*alpha_vdim[153][l]+f[45][l]*alpha_vdim[152][l]+f[44][l]*alpha_vdim[151][l]+f[43][l]*alpha_vdim[150][l]+f[3][l]*alpha_vdim[143][l]+f[2][l]*alpha_vdim[142][l]+f[1][l]*alpha_vdim[141][l]+f[31][l]*alpha_vdim[140][l]+f[30][l]*alpha_vdim[139][l]+f[29][l]*alpha_vdim[138][l]+f[28][l]*alpha_vdim[137][l]+f[27][l]*alpha_vdim[136][l]+f[26][l]*alpha_vdim[135][l]+f[0][l]*alpha_vdim[133][l]+f[16][l]*alpha_vdim[132][l]+f[15][l]*alpha_vdim[131][l]+f[14][l]*alpha_vdim[130][l]+f[13][l]*alpha_vdim[129][l]+f[5][l]*alpha_vdim[128][l]+f[22][l]*alpha_vdim[111][l]+f[58][l]*alpha_vdim[106][l]+f[9][l]*alpha_vdim[98][l]+f[8][l]*alpha_vdim[97][l]+f[7][l]*alpha_vdim[96][l]+f[50][l]*alpha_vdim[89][l]+f[49][l]*alpha_vdim[88][l]+f[48][l]*alpha_vdim[87][l]+f[47][l]*alpha_vdim[86][l]+f[3][l]*alpha_vdim[83][l]+f[2][l]*alpha_vdim[82][l]+f[1][l]*alpha_vdim[81][l]+f[37][l]*alpha_vdim[76][l]+f[36][l]*alpha_vdim[75][l]+f[35][l]*alpha_vdim[74][l]+f[34][l]*alpha_vdim[73][l]+f[33][l]*alpha_vdim[72][l]+f[32][l]*alpha_vdim[71][l]+f[0][l]*alpha_vdim[70][l]+f[20][l]*alpha_vdim[68][l]+f[19][l]*alpha_vdim[67][l]+f[18][l]*alpha_vdim[66][l]+f[17][l]*alpha_vdim[65][l]+f[6][l]*alpha_vdim[64][l]);
+    out[22][l] += 0.2165063509461096*(f[32][l]*alpha_cdim[134][l]+f[7][l]*alpha_cdim[128][l]+f[27][l]*alpha_cdim[69][l]+f[8][l]*alpha_cdim[64][l]+alpha_cdim[4][l]*f[25][l]+alpha_cdim[0][l]*f[9][l]);
+    out[23][l] += 0.2165063509461096*(f[29][l]*alpha_cdim[69][l]+f[10][l]*alpha_cdim[64][l]+alpha_vdim[19][l]*f[47][l]+f[19][l]*alpha_vdim[47][l]+alpha_vdim[15][l]*f[43][l]+f[15][l]*alpha_vdim[43][l]+alpha_vdim[33][l]*f[34][l]+f[33][l]*alpha_vdim[34][l]+alpha_vdim[6][l]*f[32][l]+f[6][l]*alpha_vdim[32][l]+alpha_vdim[27][l]*f[28][l]+f[27][l]*alpha_vdim[28][l]+alpha_vdim[5][l]*f[26][l]+f[5][l]*alpha_vdim[26][l]+alpha_vdim[3][l]*f[22][l]+f[3][l]*alpha_vdim[22][l]+alpha_vdim[17][l]*f[18][l]+f[17][l]*alpha_vdim[18][l]+alpha_vdim[13][l]*f[14][l]+f[13][l]*alpha_vdim[14][l]+alpha_cdim[0][l]*f[11][l]+alpha_vdim[8][l]*f[9][l]+f[8][l]*alpha_vdim[9][l]+alpha_vdim[0][l]*f[7][l]+f[0][l]*alpha_vdim[7][l]+f[2][l]*(alpha_cdim[4][l]+alpha_vdim[1][l])+f[1][l]*alpha_vdim[2][l]);
+    out[24][l] += 0.2165063509461096*(f[35][l]*alpha_cdim[134][l]+f[10][l]*alpha_cdim[128][l]+alpha_vdim[18][l]*f[47][l]+f[18][l]*alpha_vdim[47][l]+alpha_vdim[14][l]*f[43][l]+f[14][l]*alpha_vdim[43][l]+alpha_vdim[32][l]*f[34][l]+f[32][l]*alpha_vdim[34][l]+alpha_vdim[6][l]*f[33][l]+f[6][l]*alpha_vdim[33][l]+alpha_vdim[26][l]*f[28][l]+f[26][l]*alpha_vdim[28][l]+alpha_vdim[5][l]*f[27][l]+f[5][l]*alpha_vdim[27][l]+alpha_vdim[2][l]*f[22][l]+f[2][l]*alpha_vdim[22][l]+alpha_vdim[17][l]*f[19][l]+f[17][l]*alpha_vdim[19][l]+alpha_vdim[13][l]*f[15][l]+f[13][l]*alpha_vdim[15][l]+alpha_cdim[0][l]*f[12][l]+alpha_vdim[7][l]*f[9][l]+f[7][l]*alpha_vdim[9][l]+alpha_vdim[0][l]*f[8][l]+f[0][l]*alpha_vdim[8][l]+f[3][l]*(alpha_cdim[4][l]+alpha_vdim[1][l])+f[1][l]*alpha_vdim[3][l]);
+    out[25][l] += 0.2165063509461096*(f[36][l]*alpha_cdim[134][l]+f[11][l]*alpha_cdim[128][l]+f[31][l]*alpha_cdim[69][l]+f[12][l]*alpha_cdim[64][l]+alpha_vdim[17][l]*f[47][l]+f[17][l]*alpha_vdim[47][l]+alpha_vdim[13][l]*f[43][l]+f[13][l]*alpha_vdim[43][l]+alpha_vdim[6][l]*f[34][l]+f[6][l]*alpha_vdim[34][l]+alpha_vdim[32][l]*f[33][l]+f[32][l]*alpha_vdim[33][l]+alpha_vdim[5][l]*f[28][l]+f[5][l]*alpha_vdim[28][l]+alpha_vdim[26][l]*f[27][l]+f[26][l]*alpha_vdim[27][l]+alpha_vdim[1][l]*f[22][l]+f[1][l]*alpha_vdim[22][l]+alpha_vdim[18][l]*f[19][l]+f[18][l]*alpha_vdim[19][l]+alpha_vdim[14][l]*f[15][l]+f[14][l]*alpha_vdim[15][l]+alpha_vdim[0][l]*f[9][l]+f[0][l]*alpha_vdim[9][l]+alpha_vdim[7][l]*f[8][l]+f[7][l]*alpha_vdim[8][l]+alpha_vdim[2][l]*f[3][l]+f[2][l]*alpha_vdim[3][l]);
+    out[26][l] += 0.2165063509461096*(f[19][l]*alpha_vdim[111][l]+f[12][l]*alpha_vdim[106][l]+f[33][l]*alpha_vdim[98][l]+f[34][l]*alpha_vdim[97][l]+f[6][l]*alpha_vdim[96][l]+f[24][l]*alpha_vdim[89][l]+f[25][l]*alpha_vdim[88][l]+f[4][l]*alpha_vdim[87][l]+f[3][l]*alpha_vdim[86][l]+f[47][l]*alpha_vdim[83][l]+f[17][l]*alpha_vdim[82][l]+f[18][l]*alpha_vdim[81][l]+f[42][l]*alpha_vdim[76][l]+f[10][l]*alpha_vdim[75][l]+f[11][l]*alpha_vdim[74][l]+f[8][l]*alpha_vdim[73][l]+f[9][l]*alpha_vdim[72][l]+f[0][l]*alpha_vdim[71][l]+f[32][l]*alpha_vdim[70][l]+f[1][l]*alpha_cdim[69][l]+f[23][l]*alpha_vdim[68][l]+f[22][l]*alpha_vdim[67][l]+f[1][l]*alpha_vdim[66][l]+f[2][l]*alpha_vdim[65][l]+f[7][l]*alpha_vdim[64][l]+f[13][l]*alpha_cdim[64][l]+alpha_cdim[4][l]*f[30][l]+alpha_cdim[0][l]*f[14][l]);
+    out[27][l] += 0.2165063509461096*(f[38][l]*alpha_cdim[134][l]+f[13][l]*alpha_cdim[128][l]+f[18][l]*alpha_vdim[111][l]+f[11][l]*alpha_vdim[106][l]+f[32][l]*alpha_vdim[98][l]+f[6][l]*alpha_vdim[97][l]+f[34][l]*alpha_vdim[96][l]+f[23][l]*alpha_vdim[89][l]+f[4][l]*alpha_vdim[88][l]+f[25][l]*alpha_vdim[87][l]+f[2][l]*alpha_vdim[86][l]+f[17][l]*alpha_vdim[83][l]+f[47][l]*alpha_vdim[82][l]+f[19][l]*alpha_vdim[81][l]+f[10][l]*alpha_vdim[76][l]+f[42][l]*alpha_vdim[75][l]+f[12][l]*alpha_vdim[74][l]+f[7][l]*alpha_vdim[73][l]+f[0][l]*alpha_vdim[72][l]+f[9][l]*alpha_vdim[71][l]+f[33][l]*alpha_vdim[70][l]+f[24][l]*alpha_vdim[68][l]+f[1][l]*alpha_vdim[67][l]+f[22][l]*alpha_vdim[66][l]+f[3][l]*alpha_vdim[65][l]+f[8][l]*alpha_vdim[64][l]+alpha_cdim[4][l]*f[31][l]+alpha_cdim[0][l]*f[15][l]);
+    out[28][l] += 0.2165063509461096*(f[39][l]*alpha_cdim[134][l]+f[14][l]*alpha_cdim[128][l]+f[17][l]*alpha_vdim[111][l]+f[10][l]*alpha_vdim[106][l]+f[6][l]*alpha_vdim[98][l]+f[32][l]*alpha_vdim[97][l]+f[33][l]*alpha_vdim[96][l]+f[4][l]*alpha_vdim[89][l]+f[23][l]*alpha_vdim[88][l]+f[24][l]*alpha_vdim[87][l]+f[1][l]*alpha_vdim[86][l]+f[18][l]*alpha_vdim[83][l]+f[19][l]*alpha_vdim[82][l]+f[47][l]*alpha_vdim[81][l]+f[11][l]*alpha_vdim[76][l]+f[12][l]*alpha_vdim[75][l]+f[42][l]*alpha_vdim[74][l]+f[0][l]*alpha_vdim[73][l]+f[7][l]*alpha_vdim[72][l]+f[8][l]*alpha_vdim[71][l]+f[34][l]*alpha_vdim[70][l]+f[3][l]*alpha_cdim[69][l]+f[25][l]*alpha_vdim[68][l]+f[2][l]*alpha_vdim[67][l]+f[3][l]*alpha_vdim[66][l]+f[22][l]*alpha_vdim[65][l]+f[9][l]*alpha_vdim[64][l]+f[15][l]*alpha_cdim[64][l]);
+    out[29][l] += 0.2165063509461096*(f[50][l]*alpha_vdim[111][l]+f[9][l]*alpha_vdim[106][l]+f[58][l]*alpha_vdim[98][l]+f[37][l]*alpha_vdim[97][l]+f[36][l]*alpha_vdim[96][l]+f[22][l]*alpha_vdim[89][l]+f[3][l]*alpha_vdim[88][l]+f[2][l]*alpha_vdim[87][l]+f[25][l]*alpha_vdim[86][l]+f[49][l]*alpha_vdim[83][l]+f[48][l]*alpha_vdim[82][l]+f[20][l]*alpha_vdim[81][l]+f[8][l]*alpha_vdim[76][l]+f[7][l]*alpha_vdim[75][l]+f[0][l]*alpha_vdim[74][l]+f[42][l]*alpha_vdim[73][l]+f[12][l]*alpha_vdim[72][l]+f[11][l]*alpha_vdim[71][l]+f[35][l]*alpha_vdim[70][l]+f[1][l]*alpha_vdim[68][l]+f[24][l]*alpha_vdim[67][l]+f[23][l]*alpha_vdim[66][l]+f[4][l]*alpha_vdim[65][l]+f[10][l]*alpha_vdim[64][l]+alpha_vdim[34][l]*f[59][l]+alpha_vdim[47][l]*f[53][l]+alpha_vdim[19][l]*f[52][l]+alpha_vdim[18][l]*f[51][l]+alpha_vdim[9][l]*f[43][l]+f[9][l]*alpha_vdim[43][l]+alpha_vdim[33][l]*f[40][l]+alpha_vdim[32][l]*f[39][l]+alpha_vdim[6][l]*f[38][l]+alpha_vdim[22][l]*f[28][l]+f[22][l]*alpha_vdim[28][l]+alpha_vdim[3][l]*f[27][l]+f[3][l]*alpha_vdim[27][l]+alpha_vdim[2][l]*f[26][l]+f[2][l]*alpha_vdim[26][l]+alpha_vdim[17][l]*f[21][l]+alpha_cdim[0][l]*f[16][l]+alpha_vdim[8][l]*f[15][l]+f[8][l]*alpha_vdim[15][l]+alpha_vdim[7][l]*f[14][l]+f[7][l]*alpha_vdim[14][l]+alpha_vdim[0][l]*f[13][l]+f[0][l]*alpha_vdim[13][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[5][l]+f[1][l]*alpha_vdim[5][l]);
+    out[30][l] += 0.2165063509461096*(f[49][l]*alpha_vdim[111][l]+f[8][l]*alpha_vdim[106][l]+f[37][l]*alpha_vdim[98][l]+f[58][l]*alpha_vdim[97][l]+f[35][l]*alpha_vdim[96][l]+f[3][l]*alpha_vdim[89][l]+f[22][l]*alpha_vdim[88][l]+f[1][l]*alpha_vdim[87][l]+f[24][l]*alpha_vdim[86][l]+f[50][l]*alpha_vdim[83][l]+f[20][l]*alpha_vdim[82][l]+f[48][l]*alpha_vdim[81][l]+f[9][l]*alpha_vdim[76][l]+f[0][l]*alpha_vdim[75][l]+f[7][l]*alpha_vdim[74][l]+f[12][l]*alpha_vdim[73][l]+f[42][l]*alpha_vdim[72][l]+f[10][l]*alpha_vdim[71][l]+f[36][l]*alpha_vdim[70][l]+f[4][l]*alpha_cdim[69][l]+f[2][l]*alpha_vdim[68][l]+f[25][l]*alpha_vdim[67][l]+f[4][l]*alpha_vdim[66][l]+f[23][l]*alpha_vdim[65][l]+f[11][l]*alpha_vdim[64][l]+f[16][l]*alpha_cdim[64][l]+alpha_vdim[33][l]*f[59][l]+alpha_vdim[19][l]*f[53][l]+alpha_vdim[47][l]*f[52][l]+alpha_vdim[17][l]*f[51][l]+alpha_vdim[8][l]*f[43][l]+f[8][l]*alpha_vdim[43][l]+alpha_vdim[34][l]*f[40][l]+alpha_vdim[6][l]*f[39][l]+alpha_vdim[32][l]*f[38][l]+alpha_vdim[3][l]*f[28][l]+f[3][l]*alpha_vdim[28][l]+alpha_vdim[22][l]*f[27][l]+f[22][l]*alpha_vdim[27][l]+alpha_vdim[1][l]*f[26][l]+f[1][l]*alpha_vdim[26][l]+alpha_vdim[18][l]*f[21][l]+alpha_vdim[9][l]*f[15][l]+f[9][l]*alpha_vdim[15][l]+alpha_vdim[0][l]*f[14][l]+f[0][l]*alpha_vdim[14][l]+alpha_vdim[7][l]*f[13][l]+f[7][l]*alpha_vdim[13][l]+alpha_vdim[2][l]*f[5][l]+f[2][l]*alpha_vdim[5][l]);
+    out[31][l] += 0.2165063509461096*(f[41][l]*alpha_cdim[134][l]+f[16][l]*alpha_cdim[128][l]+f[48][l]*alpha_vdim[111][l]+f[7][l]*alpha_vdim[106][l]+f[36][l]*alpha_vdim[98][l]+f[35][l]*alpha_vdim[97][l]+f[58][l]*alpha_vdim[96][l]+f[2][l]*alpha_vdim[89][l]+f[1][l]*alpha_vdim[88][l]+f[22][l]*alpha_vdim[87][l]+f[23][l]*alpha_vdim[86][l]+f[20][l]*alpha_vdim[83][l]+f[50][l]*alpha_vdim[82][l]+f[49][l]*alpha_vdim[81][l]+f[0][l]*alpha_vdim[76][l]+f[9][l]*alpha_vdim[75][l]+f[8][l]*alpha_vdim[74][l]+f[11][l]*alpha_vdim[73][l]+f[10][l]*alpha_vdim[72][l]+f[42][l]*alpha_vdim[71][l]+f[37][l]*alpha_vdim[70][l]+f[3][l]*alpha_vdim[68][l]+f[4][l]*alpha_vdim[67][l]+f[25][l]*alpha_vdim[66][l]+f[24][l]*alpha_vdim[65][l]+f[12][l]*alpha_vdim[64][l]+alpha_vdim[32][l]*f[59][l]+alpha_vdim[18][l]*f[53][l]+alpha_vdim[17][l]*f[52][l]+alpha_vdim[47][l]*f[51][l]+alpha_vdim[7][l]*f[43][l]+f[7][l]*alpha_vdim[43][l]+alpha_vdim[6][l]*f[40][l]+alpha_vdim[34][l]*f[39][l]+alpha_vdim[33][l]*f[38][l]+alpha_vdim[2][l]*f[28][l]+f[2][l]*alpha_vdim[28][l]+alpha_vdim[1][l]*f[27][l]+f[1][l]*alpha_vdim[27][l]+alpha_vdim[22][l]*f[26][l]+f[22][l]*alpha_vdim[26][l]+alpha_vdim[19][l]*f[21][l]+alpha_vdim[0][l]*f[15][l]+f[0][l]*alpha_vdim[15][l]+alpha_vdim[9][l]*f[14][l]+f[9][l]*alpha_vdim[14][l]+alpha_vdim[8][l]*f[13][l]+f[8][l]*alpha_vdim[13][l]+alpha_vdim[3][l]*f[5][l]+f[3][l]*alpha_vdim[5][l]);
+    out[32][l] += 0.2165063509461096*(f[15][l]*alpha_vdim[171][l]+f[12][l]*alpha_vdim[170][l]+f[27][l]*alpha_vdim[156][l]+f[28][l]*alpha_vdim[155][l]+f[5][l]*alpha_vdim[154][l]+f[24][l]*alpha_vdim[153][l]+f[25][l]*alpha_vdim[152][l]+f[4][l]*alpha_vdim[151][l]+f[3][l]*alpha_vdim[150][l]+f[43][l]*alpha_vdim[143][l]+f[13][l]*alpha_vdim[142][l]+f[14][l]*alpha_vdim[141][l]+f[42][l]*alpha_vdim[140][l]+f[10][l]*alpha_vdim[139][l]+f[11][l]*alpha_vdim[138][l]+f[8][l]*alpha_vdim[137][l]+f[9][l]*alpha_vdim[136][l]+f[0][l]*alpha_vdim[135][l]+f[26][l]*alpha_vdim[133][l]+f[23][l]*alpha_vdim[132][l]+f[22][l]*alpha_vdim[131][l]+f[1][l]*alpha_vdim[130][l]+f[2][l]*alpha_vdim[129][l]+f[7][l]*alpha_vdim[128][l]+f[38][l]*alpha_cdim[69][l]+f[17][l]*alpha_cdim[64][l]+alpha_cdim[4][l]*f[36][l]+alpha_cdim[0][l]*f[18][l]);
+    out[33][l] += 0.2165063509461096*(f[14][l]*alpha_vdim[171][l]+f[11][l]*alpha_vdim[170][l]+f[26][l]*alpha_vdim[156][l]+f[5][l]*alpha_vdim[155][l]+f[28][l]*alpha_vdim[154][l]+f[23][l]*alpha_vdim[153][l]+f[4][l]*alpha_vdim[152][l]+f[25][l]*alpha_vdim[151][l]+f[2][l]*alpha_vdim[150][l]+f[13][l]*alpha_vdim[143][l]+f[43][l]*alpha_vdim[142][l]+f[15][l]*alpha_vdim[141][l]+f[10][l]*alpha_vdim[140][l]+f[42][l]*alpha_vdim[139][l]+f[12][l]*alpha_vdim[138][l]+f[7][l]*alpha_vdim[137][l]+f[0][l]*alpha_vdim[136][l]+f[9][l]*alpha_vdim[135][l]+f[1][l]*alpha_cdim[134][l]+f[27][l]*alpha_vdim[133][l]+f[24][l]*alpha_vdim[132][l]+f[1][l]*alpha_vdim[131][l]+f[22][l]*alpha_vdim[130][l]+f[3][l]*alpha_vdim[129][l]+f[8][l]*alpha_vdim[128][l]+f[17][l]*alpha_cdim[128][l]+alpha_cdim[4][l]*f[37][l]+alpha_cdim[0][l]*f[19][l]);
+    out[34][l] += 0.2165063509461096*(f[13][l]*alpha_vdim[171][l]+f[10][l]*alpha_vdim[170][l]+f[5][l]*alpha_vdim[156][l]+f[26][l]*alpha_vdim[155][l]+f[27][l]*alpha_vdim[154][l]+f[4][l]*alpha_vdim[153][l]+f[23][l]*alpha_vdim[152][l]+f[24][l]*alpha_vdim[151][l]+f[1][l]*alpha_vdim[150][l]+f[14][l]*alpha_vdim[143][l]+f[15][l]*alpha_vdim[142][l]+f[43][l]*alpha_vdim[141][l]+f[11][l]*alpha_vdim[140][l]+f[12][l]*alpha_vdim[139][l]+f[42][l]*alpha_vdim[138][l]+f[0][l]*alpha_vdim[137][l]+f[7][l]*alpha_vdim[136][l]+f[8][l]*alpha_vdim[135][l]+f[2][l]*alpha_cdim[134][l]+f[28][l]*alpha_vdim[133][l]+f[25][l]*alpha_vdim[132][l]+f[2][l]*alpha_vdim[131][l]+f[3][l]*alpha_vdim[130][l]+f[22][l]*alpha_vdim[129][l]+f[9][l]*alpha_vdim[128][l]+f[18][l]*alpha_cdim[128][l]+f[40][l]*alpha_cdim[69][l]+f[19][l]*alpha_cdim[64][l]);
+    out[35][l] += 0.2165063509461096*(f[46][l]*alpha_vdim[171][l]+f[9][l]*alpha_vdim[170][l]+f[57][l]*alpha_vdim[156][l]+f[31][l]*alpha_vdim[155][l]+f[30][l]*alpha_vdim[154][l]+f[22][l]*alpha_vdim[153][l]+f[3][l]*alpha_vdim[152][l]+f[2][l]*alpha_vdim[151][l]+f[25][l]*alpha_vdim[150][l]+f[45][l]*alpha_vdim[143][l]+f[44][l]*alpha_vdim[142][l]+f[16][l]*alpha_vdim[141][l]+f[8][l]*alpha_vdim[140][l]+f[7][l]*alpha_vdim[139][l]+f[0][l]*alpha_vdim[138][l]+f[42][l]*alpha_vdim[137][l]+f[12][l]*alpha_vdim[136][l]+f[11][l]*alpha_vdim[135][l]+f[29][l]*alpha_vdim[133][l]+f[1][l]*alpha_vdim[132][l]+f[24][l]*alpha_vdim[131][l]+f[23][l]*alpha_vdim[130][l]+f[4][l]*alpha_vdim[129][l]+f[10][l]*alpha_vdim[128][l]+alpha_vdim[28][l]*f[59][l]+alpha_vdim[43][l]*f[53][l]+alpha_vdim[15][l]*f[52][l]+alpha_vdim[14][l]*f[51][l]+alpha_vdim[9][l]*f[47][l]+f[9][l]*alpha_vdim[47][l]+alpha_vdim[27][l]*f[40][l]+alpha_vdim[26][l]*f[39][l]+alpha_vdim[5][l]*f[38][l]+alpha_vdim[22][l]*f[34][l]+f[22][l]*alpha_vdim[34][l]+alpha_vdim[3][l]*f[33][l]+f[3][l]*alpha_vdim[33][l]+alpha_vdim[2][l]*f[32][l]+f[2][l]*alpha_vdim[32][l]+alpha_vdim[13][l]*f[21][l]+alpha_cdim[0][l]*f[20][l]+alpha_vdim[8][l]*f[19][l]+f[8][l]*alpha_vdim[19][l]+alpha_vdim[7][l]*f[18][l]+f[7][l]*alpha_vdim[18][l]+alpha_vdim[0][l]*f[17][l]+f[0][l]*alpha_vdim[17][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[6][l]+f[1][l]*alpha_vdim[6][l]);
+    out[36][l] += 0.2165063509461096*(f[45][l]*alpha_vdim[171][l]+f[8][l]*alpha_vdim[170][l]+f[31][l]*alpha_vdim[156][l]+f[57][l]*alpha_vdim[155][l]+f[29][l]*alpha_vdim[154][l]+f[3][l]*alpha_vdim[153][l]+f[22][l]*alpha_vdim[152][l]+f[1][l]*alpha_vdim[151][l]+f[24][l]*alpha_vdim[150][l]+f[46][l]*alpha_vdim[143][l]+f[16][l]*alpha_vdim[142][l]+f[44][l]*alpha_vdim[141][l]+f[9][l]*alpha_vdim[140][l]+f[0][l]*alpha_vdim[139][l]+f[7][l]*alpha_vdim[138][l]+f[12][l]*alpha_vdim[137][l]+f[42][l]*alpha_vdim[136][l]+f[10][l]*alpha_vdim[135][l]+f[30][l]*alpha_vdim[133][l]+f[2][l]*alpha_vdim[132][l]+f[25][l]*alpha_vdim[131][l]+f[4][l]*alpha_vdim[130][l]+f[23][l]*alpha_vdim[129][l]+f[11][l]*alpha_vdim[128][l]+f[41][l]*alpha_cdim[69][l]+f[20][l]*alpha_cdim[64][l]+alpha_vdim[27][l]*f[59][l]+alpha_vdim[15][l]*f[53][l]+alpha_vdim[43][l]*f[52][l]+alpha_vdim[13][l]*f[51][l]+alpha_vdim[8][l]*f[47][l]+f[8][l]*alpha_vdim[47][l]+alpha_vdim[28][l]*f[40][l]+alpha_vdim[5][l]*f[39][l]+alpha_vdim[26][l]*f[38][l]+alpha_vdim[3][l]*f[34][l]+f[3][l]*alpha_vdim[34][l]+alpha_vdim[22][l]*f[33][l]+f[22][l]*alpha_vdim[33][l]+alpha_vdim[1][l]*f[32][l]+f[1][l]*alpha_vdim[32][l]+alpha_vdim[14][l]*f[21][l]+alpha_vdim[9][l]*f[19][l]+f[9][l]*alpha_vdim[19][l]+alpha_vdim[0][l]*f[18][l]+f[0][l]*alpha_vdim[18][l]+alpha_vdim[7][l]*f[17][l]+f[7][l]*alpha_vdim[17][l]+alpha_vdim[2][l]*f[6][l]+f[2][l]*alpha_vdim[6][l]);
+    out[37][l] += 0.2165063509461096*(f[44][l]*alpha_vdim[171][l]+f[7][l]*alpha_vdim[170][l]+f[30][l]*alpha_vdim[156][l]+f[29][l]*alpha_vdim[155][l]+f[57][l]*alpha_vdim[154][l]+f[2][l]*alpha_vdim[153][l]+f[1][l]*alpha_vdim[152][l]+f[22][l]*alpha_vdim[151][l]+f[23][l]*alpha_vdim[150][l]+f[16][l]*alpha_vdim[143][l]+f[46][l]*alpha_vdim[142][l]+f[45][l]*alpha_vdim[141][l]+f[0][l]*alpha_vdim[140][l]+f[9][l]*alpha_vdim[139][l]+f[8][l]*alpha_vdim[138][l]+f[11][l]*alpha_vdim[137][l]+f[10][l]*alpha_vdim[136][l]+f[42][l]*alpha_vdim[135][l]+f[4][l]*alpha_cdim[134][l]+f[31][l]*alpha_vdim[133][l]+f[3][l]*alpha_vdim[132][l]+f[4][l]*alpha_vdim[131][l]+f[25][l]*alpha_vdim[130][l]+f[24][l]*alpha_vdim[129][l]+f[12][l]*alpha_vdim[128][l]+f[20][l]*alpha_cdim[128][l]+alpha_vdim[26][l]*f[59][l]+alpha_vdim[14][l]*f[53][l]+alpha_vdim[13][l]*f[52][l]+alpha_vdim[43][l]*f[51][l]+alpha_vdim[7][l]*f[47][l]+f[7][l]*alpha_vdim[47][l]+alpha_vdim[5][l]*f[40][l]+alpha_vdim[28][l]*f[39][l]+alpha_vdim[27][l]*f[38][l]+alpha_vdim[2][l]*f[34][l]+f[2][l]*alpha_vdim[34][l]+alpha_vdim[1][l]*f[33][l]+f[1][l]*alpha_vdim[33][l]+alpha_vdim[22][l]*f[32][l]+f[22][l]*alpha_vdim[32][l]+alpha_vdim[15][l]*f[21][l]+alpha_vdim[0][l]*f[19][l]+f[0][l]*alpha_vdim[19][l]+alpha_vdim[9][l]*f[18][l]+f[9][l]*alpha_vdim[18][l]+alpha_vdim[8][l]*f[17][l]+f[8][l]*alpha_vdim[17][l]+alpha_vdim[3][l]*f[6][l]+f[3][l]*alpha_vdim[6][l]);
+    out[38][l] += 0.2165063509461096*(f[9][l]*alpha_vdim[171][l]+f[46][l]*alpha_vdim[170][l]+f[22][l]*alpha_vdim[156][l]+f[3][l]*alpha_vdim[155][l]+f[2][l]*alpha_vdim[154][l]+f[57][l]*alpha_vdim[153][l]+f[31][l]*alpha_vdim[152][l]+f[30][l]*alpha_vdim[151][l]+f[28][l]*alpha_vdim[150][l]+f[8][l]*alpha_vdim[143][l]+f[7][l]*alpha_vdim[142][l]+f[0][l]*alpha_vdim[141][l]+f[45][l]*alpha_vdim[140][l]+f[44][l]*alpha_vdim[139][l]+f[16][l]*alpha_vdim[138][l]+f[43][l]*alpha_vdim[137][l]+f[15][l]*alpha_vdim[136][l]+f[14][l]*alpha_vdim[135][l]+f[1][l]*alpha_vdim[133][l]+f[29][l]*alpha_vdim[132][l]+f[27][l]*alpha_vdim[131][l]+f[26][l]*alpha_vdim[130][l]+f[5][l]*alpha_vdim[129][l]+f[13][l]*alpha_vdim[128][l]+f[9][l]*alpha_vdim[111][l]+f[50][l]*alpha_vdim[106][l]+f[22][l]*alpha_vdim[98][l]+f[3][l]*alpha_vdim[97][l]+f[2][l]*alpha_vdim[96][l]+f[58][l]*alpha_vdim[89][l]+f[37][l]*alpha_vdim[88][l]+f[36][l]*alpha_vdim[87][l]+f[34][l]*alpha_vdim[86][l]+f[8][l]*alpha_vdim[83][l]+f[7][l]*alpha_vdim[82][l]+f[0][l]*alpha_vdim[81][l]+f[49][l]*alpha_vdim[76][l]+f[48][l]*alpha_vdim[75][l]+f[20][l]*alpha_vdim[74][l]+f[47][l]*alpha_vdim[73][l]+f[19][l]*alpha_vdim[72][l]+f[18][l]*alpha_vdim[71][l]+f[1][l]*alpha_vdim[70][l]+f[35][l]*alpha_vdim[68][l]+f[33][l]*alpha_vdim[67][l]+f[32][l]*alpha_vdim[66][l]+f[6][l]*alpha_vdim[65][l]+f[17][l]*alpha_vdim[64][l]+alpha_cdim[4][l]*f[41][l]+alpha_cdim[0][l]*f[21][l]);
+    out[39][l] += 0.2165063509461096*(f[8][l]*alpha_vdim[171][l]+f[45][l]*alpha_vdim[170][l]+f[3][l]*alpha_vdim[156][l]+f[22][l]*alpha_vdim[155][l]+f[1][l]*alpha_vdim[154][l]+f[31][l]*alpha_vdim[153][l]+f[57][l]*alpha_vdim[152][l]+f[29][l]*alpha_vdim[151][l]+f[27][l]*alpha_vdim[150][l]+f[9][l]*alpha_vdim[143][l]+f[0][l]*alpha_vdim[142][l]+f[7][l]*alpha_vdim[141][l]+f[46][l]*alpha_vdim[140][l]+f[16][l]*alpha_vdim[139][l]+f[44][l]*alpha_vdim[138][l]+f[15][l]*alpha_vdim[137][l]+f[43][l]*alpha_vdim[136][l]+f[13][l]*alpha_vdim[135][l]+f[2][l]*alpha_vdim[133][l]+f[30][l]*alpha_vdim[132][l]+f[28][l]*alpha_vdim[131][l]+f[5][l]*alpha_vdim[130][l]+f[26][l]*alpha_vdim[129][l]+f[14][l]*alpha_vdim[128][l]+f[8][l]*alpha_vdim[111][l]+f[49][l]*alpha_vdim[106][l]+f[3][l]*alpha_vdim[98][l]+f[22][l]*alpha_vdim[97][l]+f[1][l]*alpha_vdim[96][l]+f[37][l]*alpha_vdim[89][l]+f[58][l]*alpha_vdim[88][l]+f[35][l]*alpha_vdim[87][l]+f[33][l]*alpha_vdim[86][l]+f[9][l]*alpha_vdim[83][l]+f[0][l]*alpha_vdim[82][l]+f[7][l]*alpha_vdim[81][l]+f[50][l]*alpha_vdim[76][l]+f[20][l]*alpha_vdim[75][l]+f[48][l]*alpha_vdim[74][l]+f[19][l]*alpha_vdim[73][l]+f[47][l]*alpha_vdim[72][l]+f[17][l]*alpha_vdim[71][l]+f[2][l]*alpha_vdim[70][l]+f[6][l]*alpha_cdim[69][l]+f[36][l]*alpha_vdim[68][l]+f[34][l]*alpha_vdim[67][l]+f[6][l]*alpha_vdim[66][l]+f[32][l]*alpha_vdim[65][l]+f[18][l]*alpha_vdim[64][l]+f[21][l]*alpha_cdim[64][l]);
+    out[40][l] += 0.2165063509461096*(f[7][l]*alpha_vdim[171][l]+f[44][l]*alpha_vdim[170][l]+f[2][l]*alpha_vdim[156][l]+f[1][l]*alpha_vdim[155][l]+f[22][l]*alpha_vdim[154][l]+f[30][l]*alpha_vdim[153][l]+f[29][l]*alpha_vdim[152][l]+f[57][l]*alpha_vdim[151][l]+f[26][l]*alpha_vdim[150][l]+f[0][l]*alpha_vdim[143][l]+f[9][l]*alpha_vdim[142][l]+f[8][l]*alpha_vdim[141][l]+f[16][l]*alpha_vdim[140][l]+f[46][l]*alpha_vdim[139][l]+f[45][l]*alpha_vdim[138][l]+f[14][l]*alpha_vdim[137][l]+f[13][l]*alpha_vdim[136][l]+f[43][l]*alpha_vdim[135][l]+f[5][l]*alpha_cdim[134][l]+f[3][l]*alpha_vdim[133][l]+f[31][l]*alpha_vdim[132][l]+f[5][l]*alpha_vdim[131][l]+f[28][l]*alpha_vdim[130][l]+f[27][l]*alpha_vdim[129][l]+f[15][l]*alpha_vdim[128][l]+f[21][l]*alpha_cdim[128][l]+f[7][l]*alpha_vdim[111][l]+f[48][l]*alpha_vdim[106][l]+f[2][l]*alpha_vdim[98][l]+f[1][l]*alpha_vdim[97][l]+f[22][l]*alpha_vdim[96][l]+f[36][l]*alpha_vdim[89][l]+f[35][l]*alpha_vdim[88][l]+f[58][l]*alpha_vdim[87][l]+f[32][l]*alpha_vdim[86][l]+f[0][l]*alpha_vdim[83][l]+f[9][l]*alpha_vdim[82][l]+f[8][l]*alpha_vdim[81][l]+f[20][l]*alpha_vdim[76][l]+f[50][l]*alpha_vdim[75][l]+f[49][l]*alpha_vdim[74][l]+f[18][l]*alpha_vdim[73][l]+f[17][l]*alpha_vdim[72][l]+f[47][l]*alpha_vdim[71][l]+f[3][l]*alpha_vdim[70][l]+f[37][l]*alpha_vdim[68][l]+f[6][l]*alpha_vdim[67][l]+f[34][l]*alpha_vdim[66][l]+f[33][l]*alpha_vdim[65][l]+f[19][l]*alpha_vdim[64][l]);
+    out[41][l] += 0.2165063509461096*(f[42][l]*alpha_vdim[171][l]+f[43][l]*alpha_vdim[170][l]+f[25][l]*alpha_vdim[156][l]+f[24][l]*alpha_vdim[155][l]+f[23][l]*alpha_vdim[154][l]+f[28][l]*alpha_vdim[153][l]+f[27][l]*alpha_vdim[152][l]+f[26][l]*alpha_vdim[151][l]+f[57][l]*alpha_vdim[150][l]+f[12][l]*alpha_vdim[143][l]+f[11][l]*alpha_vdim[142][l]+f[10][l]*alpha_vdim[141][l]+f[15][l]*alpha_vdim[140][l]+f[14][l]*alpha_vdim[139][l]+f[13][l]*alpha_vdim[138][l]+f[46][l]*alpha_vdim[137][l]+f[45][l]*alpha_vdim[136][l]+f[44][l]*alpha_vdim[135][l]+f[4][l]*alpha_vdim[133][l]+f[5][l]*alpha_vdim[132][l]+f[31][l]*alpha_vdim[131][l]+f[30][l]*alpha_vdim[130][l]+f[29][l]*alpha_vdim[129][l]+f[16][l]*alpha_vdim[128][l]+f[42][l]*alpha_vdim[111][l]+f[47][l]*alpha_vdim[106][l]+f[25][l]*alpha_vdim[98][l]+f[24][l]*alpha_vdim[97][l]+f[23][l]*alpha_vdim[96][l]+f[34][l]*alpha_vdim[89][l]+f[33][l]*alpha_vdim[88][l]+f[32][l]*alpha_vdim[87][l]+f[58][l]*alpha_vdim[86][l]+f[12][l]*alpha_vdim[83][l]+f[11][l]*alpha_vdim[82][l]+f[10][l]*alpha_vdim[81][l]+f[19][l]*alpha_vdim[76][l]+f[18][l]*alpha_vdim[75][l]+f[17][l]*alpha_vdim[74][l]+f[50][l]*alpha_vdim[73][l]+f[49][l]*alpha_vdim[72][l]+f[48][l]*alpha_vdim[71][l]+f[4][l]*alpha_vdim[70][l]+f[6][l]*alpha_vdim[68][l]+f[37][l]*alpha_vdim[67][l]+f[36][l]*alpha_vdim[66][l]+f[35][l]*alpha_vdim[65][l]+f[20][l]*alpha_vdim[64][l]+alpha_vdim[22][l]*f[59][l]+alpha_vdim[9][l]*f[53][l]+alpha_vdim[8][l]*f[52][l]+alpha_vdim[7][l]*f[51][l]+alpha_vdim[43][l]*f[47][l]+f[43][l]*alpha_vdim[47][l]+alpha_vdim[3][l]*f[40][l]+alpha_vdim[2][l]*f[39][l]+alpha_vdim[1][l]*f[38][l]+alpha_vdim[28][l]*f[34][l]+f[28][l]*alpha_vdim[34][l]+alpha_vdim[27][l]*f[33][l]+f[27][l]*alpha_vdim[33][l]+alpha_vdim[26][l]*f[32][l]+f[26][l]*alpha_vdim[32][l]+alpha_vdim[0][l]*f[21][l]+alpha_vdim[15][l]*f[19][l]+f[15][l]*alpha_vdim[19][l]+alpha_vdim[14][l]*f[18][l]+f[14][l]*alpha_vdim[18][l]+alpha_vdim[13][l]*f[17][l]+f[13][l]*alpha_vdim[17][l]+alpha_vdim[5][l]*f[6][l]+f[5][l]*alpha_vdim[6][l]);
+    out[42][l] += 0.2165063509461096*(f[48][l]*alpha_cdim[134][l]+f[23][l]*alpha_cdim[128][l]+f[45][l]*alpha_cdim[69][l]+f[24][l]*alpha_cdim[64][l]+alpha_vdim[6][l]*f[47][l]+f[6][l]*alpha_vdim[47][l]+alpha_vdim[5][l]*f[43][l]+f[5][l]*alpha_vdim[43][l]+alpha_vdim[17][l]*f[34][l]+f[17][l]*alpha_vdim[34][l]+alpha_vdim[18][l]*f[33][l]+f[18][l]*alpha_vdim[33][l]+alpha_vdim[19][l]*f[32][l]+f[19][l]*alpha_vdim[32][l]+alpha_vdim[13][l]*f[28][l]+f[13][l]*alpha_vdim[28][l]+alpha_vdim[14][l]*f[27][l]+f[14][l]*alpha_vdim[27][l]+alpha_vdim[15][l]*f[26][l]+f[15][l]*alpha_vdim[26][l]+alpha_cdim[0][l]*f[25][l]+alpha_vdim[0][l]*f[22][l]+f[0][l]*alpha_vdim[22][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[9][l]+f[1][l]*alpha_vdim[9][l]+alpha_vdim[2][l]*f[8][l]+f[2][l]*alpha_vdim[8][l]+alpha_vdim[3][l]*f[7][l]+f[3][l]*alpha_vdim[7][l]);
+    out[43][l] += 0.2165063509461096*(f[51][l]*alpha_cdim[134][l]+f[26][l]*alpha_cdim[128][l]+f[6][l]*alpha_vdim[111][l]+f[4][l]*alpha_vdim[106][l]+f[17][l]*alpha_vdim[98][l]+f[18][l]*alpha_vdim[97][l]+f[19][l]*alpha_vdim[96][l]+f[10][l]*alpha_vdim[89][l]+f[11][l]*alpha_vdim[88][l]+f[12][l]*alpha_vdim[87][l]+f[0][l]*alpha_vdim[86][l]+f[32][l]*alpha_vdim[83][l]+f[33][l]*alpha_vdim[82][l]+f[34][l]*alpha_vdim[81][l]+f[23][l]*alpha_vdim[76][l]+f[24][l]*alpha_vdim[75][l]+f[25][l]*alpha_vdim[74][l]+f[1][l]*alpha_vdim[73][l]+f[2][l]*alpha_vdim[72][l]+f[3][l]*alpha_vdim[71][l]+f[47][l]*alpha_vdim[70][l]+f[8][l]*alpha_cdim[69][l]+f[42][l]*alpha_vdim[68][l]+f[7][l]*alpha_vdim[67][l]+f[8][l]*alpha_vdim[66][l]+f[9][l]*alpha_vdim[65][l]+f[22][l]*alpha_vdim[64][l]+f[27][l]*alpha_cdim[64][l]+alpha_cdim[4][l]*f[46][l]+alpha_cdim[0][l]*f[28][l]);
+    out[44][l] += 0.2165063509461096*(f[37][l]*alpha_vdim[111][l]+f[3][l]*alpha_vdim[106][l]+f[49][l]*alpha_vdim[98][l]+f[50][l]*alpha_vdim[97][l]+f[20][l]*alpha_vdim[96][l]+f[8][l]*alpha_vdim[89][l]+f[9][l]*alpha_vdim[88][l]+f[0][l]*alpha_vdim[87][l]+f[12][l]*alpha_vdim[86][l]+f[58][l]*alpha_vdim[83][l]+f[35][l]*alpha_vdim[82][l]+f[36][l]*alpha_vdim[81][l]+f[22][l]*alpha_vdim[76][l]+f[1][l]*alpha_vdim[75][l]+f[2][l]*alpha_vdim[74][l]+f[24][l]*alpha_vdim[73][l]+f[25][l]*alpha_vdim[72][l]+f[4][l]*alpha_vdim[71][l]+f[48][l]*alpha_vdim[70][l]+f[10][l]*alpha_cdim[69][l]+f[7][l]*alpha_vdim[68][l]+f[42][l]*alpha_vdim[67][l]+f[10][l]*alpha_vdim[66][l]+f[11][l]*alpha_vdim[65][l]+f[23][l]*alpha_vdim[64][l]+f[29][l]*alpha_cdim[64][l]+alpha_vdim[19][l]*f[59][l]+alpha_vdim[33][l]*f[53][l]+alpha_vdim[34][l]*f[52][l]+alpha_vdim[6][l]*f[51][l]+f[40][l]*alpha_vdim[47][l]+alpha_vdim[3][l]*f[43][l]+f[3][l]*alpha_vdim[43][l]+alpha_vdim[17][l]*f[39][l]+alpha_vdim[18][l]*f[38][l]+f[21][l]*alpha_vdim[32][l]+alpha_cdim[0][l]*f[30][l]+alpha_vdim[8][l]*f[28][l]+f[8][l]*alpha_vdim[28][l]+alpha_vdim[9][l]*f[27][l]+f[9][l]*alpha_vdim[27][l]+alpha_vdim[0][l]*f[26][l]+f[0][l]*alpha_vdim[26][l]+alpha_vdim[15][l]*f[22][l]+f[15][l]*alpha_vdim[22][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[14][l]+f[1][l]*alpha_vdim[14][l]+alpha_vdim[2][l]*f[13][l]+f[2][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*f[7][l]+f[5][l]*alpha_vdim[7][l]);
+    out[45][l] += 0.2165063509461096*(f[54][l]*alpha_cdim[134][l]+f[29][l]*alpha_cdim[128][l]+f[36][l]*alpha_vdim[111][l]+f[2][l]*alpha_vdim[106][l]+f[48][l]*alpha_vdim[98][l]+f[20][l]*alpha_vdim[97][l]+f[50][l]*alpha_vdim[96][l]+f[7][l]*alpha_vdim[89][l]+f[0][l]*alpha_vdim[88][l]+f[9][l]*alpha_vdim[87][l]+f[11][l]*alpha_vdim[86][l]+f[35][l]*alpha_vdim[83][l]+f[58][l]*alpha_vdim[82][l]+f[37][l]*alpha_vdim[81][l]+f[1][l]*alpha_vdim[76][l]+f[22][l]*alpha_vdim[75][l]+f[3][l]*alpha_vdim[74][l]+f[23][l]*alpha_vdim[73][l]+f[4][l]*alpha_vdim[72][l]+f[25][l]*alpha_vdim[71][l]+f[49][l]*alpha_vdim[70][l]+f[8][l]*alpha_vdim[68][l]+f[10][l]*alpha_vdim[67][l]+f[42][l]*alpha_vdim[66][l]+f[12][l]*alpha_vdim[65][l]+f[24][l]*alpha_vdim[64][l]+alpha_vdim[18][l]*f[59][l]+alpha_vdim[32][l]*f[53][l]+alpha_vdim[6][l]*f[52][l]+alpha_vdim[34][l]*f[51][l]+f[39][l]*alpha_vdim[47][l]+alpha_vdim[2][l]*f[43][l]+f[2][l]*alpha_vdim[43][l]+alpha_vdim[17][l]*f[40][l]+alpha_vdim[19][l]*f[38][l]+f[21][l]*alpha_vdim[33][l]+alpha_cdim[0][l]*f[31][l]+alpha_vdim[7][l]*f[28][l]+f[7][l]*alpha_vdim[28][l]+alpha_vdim[0][l]*f[27][l]+f[0][l]*alpha_vdim[27][l]+alpha_vdim[9][l]*f[26][l]+f[9][l]*alpha_vdim[26][l]+alpha_vdim[14][l]*f[22][l]+f[14][l]*alpha_vdim[22][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[15][l]+f[1][l]*alpha_vdim[15][l]+alpha_vdim[3][l]*f[13][l]+f[3][l]*alpha_vdim[13][l]+alpha_vdim[5][l]*f[8][l]+f[5][l]*alpha_vdim[8][l]);
+    out[46][l] += 0.2165063509461096*(f[55][l]*alpha_cdim[134][l]+f[30][l]*alpha_cdim[128][l]+f[35][l]*alpha_vdim[111][l]+f[1][l]*alpha_vdim[106][l]+f[20][l]*alpha_vdim[98][l]+f[48][l]*alpha_vdim[97][l]+f[49][l]*alpha_vdim[96][l]+f[0][l]*alpha_vdim[89][l]+f[7][l]*alpha_vdim[88][l]+f[8][l]*alpha_vdim[87][l]+f[10][l]*alpha_vdim[86][l]+f[36][l]*alpha_vdim[83][l]+f[37][l]*alpha_vdim[82][l]+f[58][l]*alpha_vdim[81][l]+f[2][l]*alpha_vdim[76][l]+f[3][l]*alpha_vdim[75][l]+f[22][l]*alpha_vdim[74][l]+f[4][l]*alpha_vdim[73][l]+f[23][l]*alpha_vdim[72][l]+f[24][l]*alpha_vdim[71][l]+f[50][l]*alpha_vdim[70][l]+f[12][l]*alpha_cdim[69][l]+f[9][l]*alpha_vdim[68][l]+f[11][l]*alpha_vdim[67][l]+f[12][l]*alpha_vdim[66][l]+f[42][l]*alpha_vdim[65][l]+f[25][l]*alpha_vdim[64][l]+f[31][l]*alpha_cdim[64][l]+alpha_vdim[17][l]*f[59][l]+alpha_vdim[6][l]*f[53][l]+alpha_vdim[32][l]*f[52][l]+alpha_vdim[33][l]*f[51][l]+f[38][l]*alpha_vdim[47][l]+alpha_vdim[1][l]*f[43][l]+f[1][l]*alpha_vdim[43][l]+alpha_vdim[18][l]*f[40][l]+alpha_vdim[19][l]*f[39][l]+f[21][l]*alpha_vdim[34][l]+alpha_vdim[0][l]*f[28][l]+f[0][l]*alpha_vdim[28][l]+alpha_vdim[7][l]*f[27][l]+f[7][l]*alpha_vdim[27][l]+alpha_vdim[8][l]*f[26][l]+f[8][l]*alpha_vdim[26][l]+alpha_vdim[13][l]*f[22][l]+f[13][l]*alpha_vdim[22][l]+alpha_vdim[2][l]*f[15][l]+f[2][l]*alpha_vdim[15][l]+alpha_vdim[3][l]*f[14][l]+f[3][l]*alpha_vdim[14][l]+alpha_vdim[5][l]*f[9][l]+f[5][l]*alpha_vdim[9][l]);
+    out[47][l] += 0.2165063509461096*(f[5][l]*alpha_vdim[171][l]+f[4][l]*alpha_vdim[170][l]+f[13][l]*alpha_vdim[156][l]+f[14][l]*alpha_vdim[155][l]+f[15][l]*alpha_vdim[154][l]+f[10][l]*alpha_vdim[153][l]+f[11][l]*alpha_vdim[152][l]+f[12][l]*alpha_vdim[151][l]+f[0][l]*alpha_vdim[150][l]+f[26][l]*alpha_vdim[143][l]+f[27][l]*alpha_vdim[142][l]+f[28][l]*alpha_vdim[141][l]+f[23][l]*alpha_vdim[140][l]+f[24][l]*alpha_vdim[139][l]+f[25][l]*alpha_vdim[138][l]+f[1][l]*alpha_vdim[137][l]+f[2][l]*alpha_vdim[136][l]+f[3][l]*alpha_vdim[135][l]+f[7][l]*alpha_cdim[134][l]+f[43][l]*alpha_vdim[133][l]+f[42][l]*alpha_vdim[132][l]+f[7][l]*alpha_vdim[131][l]+f[8][l]*alpha_vdim[130][l]+f[9][l]*alpha_vdim[129][l]+f[22][l]*alpha_vdim[128][l]+f[32][l]*alpha_cdim[128][l]+f[52][l]*alpha_cdim[69][l]+f[33][l]*alpha_cdim[64][l]+alpha_cdim[4][l]*f[50][l]+alpha_cdim[0][l]*f[34][l]);
+    out[48][l] += 0.2165063509461096*(f[31][l]*alpha_vdim[171][l]+f[3][l]*alpha_vdim[170][l]+f[45][l]*alpha_vdim[156][l]+f[46][l]*alpha_vdim[155][l]+f[16][l]*alpha_vdim[154][l]+f[8][l]*alpha_vdim[153][l]+f[9][l]*alpha_vdim[152][l]+f[0][l]*alpha_vdim[151][l]+f[12][l]*alpha_vdim[150][l]+f[57][l]*alpha_vdim[143][l]+f[29][l]*alpha_vdim[142][l]+f[30][l]*alpha_vdim[141][l]+f[22][l]*alpha_vdim[140][l]+f[1][l]*alpha_vdim[139][l]+f[2][l]*alpha_vdim[138][l]+f[24][l]*alpha_vdim[137][l]+f[25][l]*alpha_vdim[136][l]+f[4][l]*alpha_vdim[135][l]+f[44][l]*alpha_vdim[133][l]+f[7][l]*alpha_vdim[132][l]+f[42][l]*alpha_vdim[131][l]+f[10][l]*alpha_vdim[130][l]+f[11][l]*alpha_vdim[129][l]+f[23][l]*alpha_vdim[128][l]+f[54][l]*alpha_cdim[69][l]+f[35][l]*alpha_cdim[64][l]+alpha_vdim[15][l]*f[59][l]+alpha_vdim[27][l]*f[53][l]+alpha_vdim[28][l]*f[52][l]+alpha_vdim[5][l]*f[51][l]+alpha_vdim[3][l]*f[47][l]+f[3][l]*alpha_vdim[47][l]+f[40][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[39][l]+alpha_vdim[14][l]*f[38][l]+alpha_cdim[0][l]*f[36][l]+alpha_vdim[8][l]*f[34][l]+f[8][l]*alpha_vdim[34][l]+alpha_vdim[9][l]*f[33][l]+f[9][l]*alpha_vdim[33][l]+alpha_vdim[0][l]*f[32][l]+f[0][l]*alpha_vdim[32][l]+f[21][l]*alpha_vdim[26][l]+alpha_vdim[19][l]*f[22][l]+f[19][l]*alpha_vdim[22][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[18][l]+f[1][l]*alpha_vdim[18][l]+alpha_vdim[2][l]*f[17][l]+f[2][l]*alpha_vdim[17][l]+alpha_vdim[6][l]*f[7][l]+f[6][l]*alpha_vdim[7][l]);
+    out[49][l] += 0.2165063509461096*(f[30][l]*alpha_vdim[171][l]+f[2][l]*alpha_vdim[170][l]+f[44][l]*alpha_vdim[156][l]+f[16][l]*alpha_vdim[155][l]+f[46][l]*alpha_vdim[154][l]+f[7][l]*alpha_vdim[153][l]+f[0][l]*alpha_vdim[152][l]+f[9][l]*alpha_vdim[151][l]+f[11][l]*alpha_vdim[150][l]+f[29][l]*alpha_vdim[143][l]+f[57][l]*alpha_vdim[142][l]+f[31][l]*alpha_vdim[141][l]+f[1][l]*alpha_vdim[140][l]+f[22][l]*alpha_vdim[139][l]+f[3][l]*alpha_vdim[138][l]+f[23][l]*alpha_vdim[137][l]+f[4][l]*alpha_vdim[136][l]+f[25][l]*alpha_vdim[135][l]+f[10][l]*alpha_cdim[134][l]+f[45][l]*alpha_vdim[133][l]+f[8][l]*alpha_vdim[132][l]+f[10][l]*alpha_vdim[131][l]+f[42][l]*alpha_vdim[130][l]+f[12][l]*alpha_vdim[129][l]+f[24][l]*alpha_vdim[128][l]+f[35][l]*alpha_cdim[128][l]+alpha_vdim[14][l]*f[59][l]+alpha_vdim[26][l]*f[53][l]+alpha_vdim[5][l]*f[52][l]+alpha_vdim[28][l]*f[51][l]+alpha_vdim[2][l]*f[47][l]+f[2][l]*alpha_vdim[47][l]+f[39][l]*alpha_vdim[43][l]+alpha_vdim[13][l]*f[40][l]+alpha_vdim[15][l]*f[38][l]+alpha_cdim[0][l]*f[37][l]+alpha_vdim[7][l]*f[34][l]+f[7][l]*alpha_vdim[34][l]+alpha_vdim[0][l]*f[33][l]+f[0][l]*alpha_vdim[33][l]+alpha_vdim[9][l]*f[32][l]+f[9][l]*alpha_vdim[32][l]+f[21][l]*alpha_vdim[27][l]+alpha_vdim[18][l]*f[22][l]+f[18][l]*alpha_vdim[22][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[19][l]+f[1][l]*alpha_vdim[19][l]+alpha_vdim[3][l]*f[17][l]+f[3][l]*alpha_vdim[17][l]+alpha_vdim[6][l]*f[8][l]+f[6][l]*alpha_vdim[8][l]);
+    out[50][l] += 0.2165063509461096*(f[29][l]*alpha_vdim[171][l]+f[1][l]*alpha_vdim[170][l]+f[16][l]*alpha_vdim[156][l]+f[44][l]*alpha_vdim[155][l]+f[45][l]*alpha_vdim[154][l]+f[0][l]*alpha_vdim[153][l]+f[7][l]*alpha_vdim[152][l]+f[8][l]*alpha_vdim[151][l]+f[10][l]*alpha_vdim[150][l]+f[30][l]*alpha_vdim[143][l]+f[31][l]*alpha_vdim[142][l]+f[57][l]*alpha_vdim[141][l]+f[2][l]*alpha_vdim[140][l]+f[3][l]*alpha_vdim[139][l]+f[22][l]*alpha_vdim[138][l]+f[4][l]*alpha_vdim[137][l]+f[23][l]*alpha_vdim[136][l]+f[24][l]*alpha_vdim[135][l]+f[11][l]*alpha_cdim[134][l]+f[46][l]*alpha_vdim[133][l]+f[9][l]*alpha_vdim[132][l]+f[11][l]*alpha_vdim[131][l]+f[12][l]*alpha_vdim[130][l]+f[42][l]*alpha_vdim[129][l]+f[25][l]*alpha_vdim[128][l]+f[36][l]*alpha_cdim[128][l]+f[56][l]*alpha_cdim[69][l]+f[37][l]*alpha_cdim[64][l]+alpha_vdim[13][l]*f[59][l]+alpha_vdim[5][l]*f[53][l]+alpha_vdim[26][l]*f[52][l]+alpha_vdim[27][l]*f[51][l]+alpha_vdim[1][l]*f[47][l]+f[1][l]*alpha_vdim[47][l]+f[38][l]*alpha_vdim[43][l]+alpha_vdim[14][l]*f[40][l]+alpha_vdim[15][l]*f[39][l]+alpha_vdim[0][l]*f[34][l]+f[0][l]*alpha_vdim[34][l]+alpha_vdim[7][l]*f[33][l]+f[7][l]*alpha_vdim[33][l]+alpha_vdim[8][l]*f[32][l]+f[8][l]*alpha_vdim[32][l]+f[21][l]*alpha_vdim[28][l]+alpha_vdim[17][l]*f[22][l]+f[17][l]*alpha_vdim[22][l]+alpha_vdim[2][l]*f[19][l]+f[2][l]*alpha_vdim[19][l]+alpha_vdim[3][l]*f[18][l]+f[3][l]*alpha_vdim[18][l]+alpha_vdim[6][l]*f[9][l]+f[6][l]*alpha_vdim[9][l]);
+    out[51][l] += 0.2165063509461096*(f[3][l]*alpha_vdim[171][l]+f[31][l]*alpha_vdim[170][l]+f[8][l]*alpha_vdim[156][l]+f[9][l]*alpha_vdim[155][l]+f[0][l]*alpha_vdim[154][l]+f[45][l]*alpha_vdim[153][l]+f[46][l]*alpha_vdim[152][l]+f[16][l]*alpha_vdim[151][l]+f[15][l]*alpha_vdim[150][l]+f[22][l]*alpha_vdim[143][l]+f[1][l]*alpha_vdim[142][l]+f[2][l]*alpha_vdim[141][l]+f[57][l]*alpha_vdim[140][l]+f[29][l]*alpha_vdim[139][l]+f[30][l]*alpha_vdim[138][l]+f[27][l]*alpha_vdim[137][l]+f[28][l]*alpha_vdim[136][l]+f[5][l]*alpha_vdim[135][l]+f[7][l]*alpha_vdim[133][l]+f[44][l]*alpha_vdim[132][l]+f[43][l]*alpha_vdim[131][l]+f[13][l]*alpha_vdim[130][l]+f[14][l]*alpha_vdim[129][l]+f[26][l]*alpha_vdim[128][l]+f[3][l]*alpha_vdim[111][l]+f[37][l]*alpha_vdim[106][l]+f[8][l]*alpha_vdim[98][l]+f[9][l]*alpha_vdim[97][l]+f[0][l]*alpha_vdim[96][l]+f[49][l]*alpha_vdim[89][l]+f[50][l]*alpha_vdim[88][l]+f[20][l]*alpha_vdim[87][l]+f[19][l]*alpha_vdim[86][l]+f[22][l]*alpha_vdim[83][l]+f[1][l]*alpha_vdim[82][l]+f[2][l]*alpha_vdim[81][l]+f[58][l]*alpha_vdim[76][l]+f[35][l]*alpha_vdim[75][l]+f[36][l]*alpha_vdim[74][l]+f[33][l]*alpha_vdim[73][l]+f[34][l]*alpha_vdim[72][l]+f[6][l]*alpha_vdim[71][l]+f[7][l]*alpha_vdim[70][l]+f[17][l]*alpha_cdim[69][l]+f[48][l]*alpha_vdim[68][l]+f[47][l]*alpha_vdim[67][l]+f[17][l]*alpha_vdim[66][l]+f[18][l]*alpha_vdim[65][l]+f[32][l]*alpha_vdim[64][l]+f[38][l]*alpha_cdim[64][l]+alpha_cdim[4][l]*f[55][l]+alpha_cdim[0][l]*f[39][l]);
+    out[52][l] += 0.2165063509461096*(f[2][l]*alpha_vdim[171][l]+f[30][l]*alpha_vdim[170][l]+f[7][l]*alpha_vdim[156][l]+f[0][l]*alpha_vdim[155][l]+f[9][l]*alpha_vdim[154][l]+f[44][l]*alpha_vdim[153][l]+f[16][l]*alpha_vdim[152][l]+f[46][l]*alpha_vdim[151][l]+f[14][l]*alpha_vdim[150][l]+f[1][l]*alpha_vdim[143][l]+f[22][l]*alpha_vdim[142][l]+f[3][l]*alpha_vdim[141][l]+f[29][l]*alpha_vdim[140][l]+f[57][l]*alpha_vdim[139][l]+f[31][l]*alpha_vdim[138][l]+f[26][l]*alpha_vdim[137][l]+f[5][l]*alpha_vdim[136][l]+f[28][l]*alpha_vdim[135][l]+f[13][l]*alpha_cdim[134][l]+f[8][l]*alpha_vdim[133][l]+f[45][l]*alpha_vdim[132][l]+f[13][l]*alpha_vdim[131][l]+f[43][l]*alpha_vdim[130][l]+f[15][l]*alpha_vdim[129][l]+f[27][l]*alpha_vdim[128][l]+f[38][l]*alpha_cdim[128][l]+f[2][l]*alpha_vdim[111][l]+f[36][l]*alpha_vdim[106][l]+f[7][l]*alpha_vdim[98][l]+f[0][l]*alpha_vdim[97][l]+f[9][l]*alpha_vdim[96][l]+f[48][l]*alpha_vdim[89][l]+f[20][l]*alpha_vdim[88][l]+f[50][l]*alpha_vdim[87][l]+f[18][l]*alpha_vdim[86][l]+f[1][l]*alpha_vdim[83][l]+f[22][l]*alpha_vdim[82][l]+f[3][l]*alpha_vdim[81][l]+f[35][l]*alpha_vdim[76][l]+f[58][l]*alpha_vdim[75][l]+f[37][l]*alpha_vdim[74][l]+f[32][l]*alpha_vdim[73][l]+f[6][l]*alpha_vdim[72][l]+f[34][l]*alpha_vdim[71][l]+f[8][l]*alpha_vdim[70][l]+f[49][l]*alpha_vdim[68][l]+f[17][l]*alpha_vdim[67][l]+f[47][l]*alpha_vdim[66][l]+f[19][l]*alpha_vdim[65][l]+f[33][l]*alpha_vdim[64][l]+alpha_cdim[4][l]*f[56][l]+alpha_cdim[0][l]*f[40][l]);
+    out[53][l] += 0.2165063509461096*(f[1][l]*alpha_vdim[171][l]+f[29][l]*alpha_vdim[170][l]+f[0][l]*alpha_vdim[156][l]+f[7][l]*alpha_vdim[155][l]+f[8][l]*alpha_vdim[154][l]+f[16][l]*alpha_vdim[153][l]+f[44][l]*alpha_vdim[152][l]+f[45][l]*alpha_vdim[151][l]+f[13][l]*alpha_vdim[150][l]+f[2][l]*alpha_vdim[143][l]+f[3][l]*alpha_vdim[142][l]+f[22][l]*alpha_vdim[141][l]+f[30][l]*alpha_vdim[140][l]+f[31][l]*alpha_vdim[139][l]+f[57][l]*alpha_vdim[138][l]+f[5][l]*alpha_vdim[137][l]+f[26][l]*alpha_vdim[136][l]+f[27][l]*alpha_vdim[135][l]+f[14][l]*alpha_cdim[134][l]+f[9][l]*alpha_vdim[133][l]+f[46][l]*alpha_vdim[132][l]+f[14][l]*alpha_vdim[131][l]+f[15][l]*alpha_vdim[130][l]+f[43][l]*alpha_vdim[129][l]+f[28][l]*alpha_vdim[128][l]+f[39][l]*alpha_cdim[128][l]+f[1][l]*alpha_vdim[111][l]+f[35][l]*alpha_vdim[106][l]+f[0][l]*alpha_vdim[98][l]+f[7][l]*alpha_vdim[97][l]+f[8][l]*alpha_vdim[96][l]+f[20][l]*alpha_vdim[89][l]+f[48][l]*alpha_vdim[88][l]+f[49][l]*alpha_vdim[87][l]+f[17][l]*alpha_vdim[86][l]+f[2][l]*alpha_vdim[83][l]+f[3][l]*alpha_vdim[82][l]+f[22][l]*alpha_vdim[81][l]+f[36][l]*alpha_vdim[76][l]+f[37][l]*alpha_vdim[75][l]+f[58][l]*alpha_vdim[74][l]+f[6][l]*alpha_vdim[73][l]+f[32][l]*alpha_vdim[72][l]+f[33][l]*alpha_vdim[71][l]+f[9][l]*alpha_vdim[70][l]+f[19][l]*alpha_cdim[69][l]+f[50][l]*alpha_vdim[68][l]+f[18][l]*alpha_vdim[67][l]+f[19][l]*alpha_vdim[66][l]+f[47][l]*alpha_vdim[65][l]+f[34][l]*alpha_vdim[64][l]+f[40][l]*alpha_cdim[64][l]);
+    out[54][l] += 0.2165063509461096*(f[25][l]*alpha_vdim[171][l]+f[28][l]*alpha_vdim[170][l]+f[42][l]*alpha_vdim[156][l]+f[12][l]*alpha_vdim[155][l]+f[11][l]*alpha_vdim[154][l]+f[43][l]*alpha_vdim[153][l]+f[15][l]*alpha_vdim[152][l]+f[14][l]*alpha_vdim[151][l]+f[46][l]*alpha_vdim[150][l]+f[24][l]*alpha_vdim[143][l]+f[23][l]*alpha_vdim[142][l]+f[4][l]*alpha_vdim[141][l]+f[27][l]*alpha_vdim[140][l]+f[26][l]*alpha_vdim[139][l]+f[5][l]*alpha_vdim[138][l]+f[57][l]*alpha_vdim[137][l]+f[31][l]*alpha_vdim[136][l]+f[30][l]*alpha_vdim[135][l]+f[10][l]*alpha_vdim[133][l]+f[13][l]*alpha_vdim[132][l]+f[45][l]*alpha_vdim[131][l]+f[44][l]*alpha_vdim[130][l]+f[16][l]*alpha_vdim[129][l]+f[29][l]*alpha_vdim[128][l]+f[25][l]*alpha_vdim[111][l]+f[34][l]*alpha_vdim[106][l]+f[42][l]*alpha_vdim[98][l]+f[12][l]*alpha_vdim[97][l]+f[11][l]*alpha_vdim[96][l]+f[47][l]*alpha_vdim[89][l]+f[19][l]*alpha_vdim[88][l]+f[18][l]*alpha_vdim[87][l]+f[50][l]*alpha_vdim[86][l]+f[24][l]*alpha_vdim[83][l]+f[23][l]*alpha_vdim[82][l]+f[4][l]*alpha_vdim[81][l]+f[33][l]*alpha_vdim[76][l]+f[32][l]*alpha_vdim[75][l]+f[6][l]*alpha_vdim[74][l]+f[58][l]*alpha_vdim[73][l]+f[37][l]*alpha_vdim[72][l]+f[36][l]*alpha_vdim[71][l]+f[10][l]*alpha_vdim[70][l]+f[17][l]*alpha_vdim[68][l]+f[49][l]*alpha_vdim[67][l]+f[48][l]*alpha_vdim[66][l]+f[20][l]*alpha_vdim[65][l]+f[35][l]*alpha_vdim[64][l]+alpha_vdim[9][l]*f[59][l]+alpha_vdim[22][l]*f[53][l]+alpha_vdim[3][l]*f[52][l]+alpha_vdim[2][l]*f[51][l]+alpha_vdim[28][l]*f[47][l]+f[28][l]*alpha_vdim[47][l]+alpha_vdim[34][l]*f[43][l]+f[34][l]*alpha_vdim[43][l]+alpha_cdim[0][l]*f[41][l]+alpha_vdim[8][l]*f[40][l]+alpha_vdim[7][l]*f[39][l]+alpha_vdim[0][l]*f[38][l]+alpha_vdim[15][l]*f[33][l]+f[15][l]*alpha_vdim[33][l]+alpha_vdim[14][l]*f[32][l]+f[14][l]*alpha_vdim[32][l]+alpha_vdim[19][l]*f[27][l]+f[19][l]*alpha_vdim[27][l]+alpha_vdim[18][l]*f[26][l]+f[18][l]*alpha_vdim[26][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[21][l]+alpha_vdim[5][l]*f[17][l]+f[5][l]*alpha_vdim[17][l]+alpha_vdim[6][l]*f[13][l]+f[6][l]*alpha_vdim[13][l]);
+    out[55][l] += 0.2165063509461096*(f[24][l]*alpha_vdim[171][l]+f[27][l]*alpha_vdim[170][l]+f[12][l]*alpha_vdim[156][l]+f[42][l]*alpha_vdim[155][l]+f[10][l]*alpha_vdim[154][l]+f[15][l]*alpha_vdim[153][l]+f[43][l]*alpha_vdim[152][l]+f[13][l]*alpha_vdim[151][l]+f[45][l]*alpha_vdim[150][l]+f[25][l]*alpha_vdim[143][l]+f[4][l]*alpha_vdim[142][l]+f[23][l]*alpha_vdim[141][l]+f[28][l]*alpha_vdim[140][l]+f[5][l]*alpha_vdim[139][l]+f[26][l]*alpha_vdim[138][l]+f[31][l]*alpha_vdim[137][l]+f[57][l]*alpha_vdim[136][l]+f[29][l]*alpha_vdim[135][l]+f[11][l]*alpha_vdim[133][l]+f[14][l]*alpha_vdim[132][l]+f[46][l]*alpha_vdim[131][l]+f[16][l]*alpha_vdim[130][l]+f[44][l]*alpha_vdim[129][l]+f[30][l]*alpha_vdim[128][l]+f[24][l]*alpha_vdim[111][l]+f[33][l]*alpha_vdim[106][l]+f[12][l]*alpha_vdim[98][l]+f[42][l]*alpha_vdim[97][l]+f[10][l]*alpha_vdim[96][l]+f[19][l]*alpha_vdim[89][l]+f[47][l]*alpha_vdim[88][l]+f[17][l]*alpha_vdim[87][l]+f[49][l]*alpha_vdim[86][l]+f[25][l]*alpha_vdim[83][l]+f[4][l]*alpha_vdim[82][l]+f[23][l]*alpha_vdim[81][l]+f[34][l]*alpha_vdim[76][l]+f[6][l]*alpha_vdim[75][l]+f[32][l]*alpha_vdim[74][l]+f[37][l]*alpha_vdim[73][l]+f[58][l]*alpha_vdim[72][l]+f[35][l]*alpha_vdim[71][l]+f[11][l]*alpha_vdim[70][l]+f[20][l]*alpha_cdim[69][l]+f[18][l]*alpha_vdim[68][l]+f[50][l]*alpha_vdim[67][l]+f[20][l]*alpha_vdim[66][l]+f[48][l]*alpha_vdim[65][l]+f[36][l]*alpha_vdim[64][l]+f[41][l]*alpha_cdim[64][l]+alpha_vdim[8][l]*f[59][l]+alpha_vdim[3][l]*f[53][l]+alpha_vdim[22][l]*f[52][l]+alpha_vdim[1][l]*f[51][l]+alpha_vdim[27][l]*f[47][l]+f[27][l]*alpha_vdim[47][l]+alpha_vdim[33][l]*f[43][l]+f[33][l]*alpha_vdim[43][l]+alpha_vdim[9][l]*f[40][l]+alpha_vdim[0][l]*f[39][l]+alpha_vdim[7][l]*f[38][l]+alpha_vdim[15][l]*f[34][l]+f[15][l]*alpha_vdim[34][l]+alpha_vdim[13][l]*f[32][l]+f[13][l]*alpha_vdim[32][l]+alpha_vdim[19][l]*f[28][l]+f[19][l]*alpha_vdim[28][l]+alpha_vdim[17][l]*f[26][l]+f[17][l]*alpha_vdim[26][l]+alpha_vdim[2][l]*f[21][l]+alpha_vdim[5][l]*f[18][l]+f[5][l]*alpha_vdim[18][l]+alpha_vdim[6][l]*f[14][l]+f[6][l]*alpha_vdim[14][l]);
+    out[56][l] += 0.2165063509461096*(f[23][l]*alpha_vdim[171][l]+f[26][l]*alpha_vdim[170][l]+f[11][l]*alpha_vdim[156][l]+f[10][l]*alpha_vdim[155][l]+f[42][l]*alpha_vdim[154][l]+f[14][l]*alpha_vdim[153][l]+f[13][l]*alpha_vdim[152][l]+f[43][l]*alpha_vdim[151][l]+f[44][l]*alpha_vdim[150][l]+f[4][l]*alpha_vdim[143][l]+f[25][l]*alpha_vdim[142][l]+f[24][l]*alpha_vdim[141][l]+f[5][l]*alpha_vdim[140][l]+f[28][l]*alpha_vdim[139][l]+f[27][l]*alpha_vdim[138][l]+f[30][l]*alpha_vdim[137][l]+f[29][l]*alpha_vdim[136][l]+f[57][l]*alpha_vdim[135][l]+f[16][l]*alpha_cdim[134][l]+f[12][l]*alpha_vdim[133][l]+f[15][l]*alpha_vdim[132][l]+f[16][l]*alpha_vdim[131][l]+f[46][l]*alpha_vdim[130][l]+f[45][l]*alpha_vdim[129][l]+f[31][l]*alpha_vdim[128][l]+f[41][l]*alpha_cdim[128][l]+f[23][l]*alpha_vdim[111][l]+f[32][l]*alpha_vdim[106][l]+f[11][l]*alpha_vdim[98][l]+f[10][l]*alpha_vdim[97][l]+f[42][l]*alpha_vdim[96][l]+f[18][l]*alpha_vdim[89][l]+f[17][l]*alpha_vdim[88][l]+f[47][l]*alpha_vdim[87][l]+f[48][l]*alpha_vdim[86][l]+f[4][l]*alpha_vdim[83][l]+f[25][l]*alpha_vdim[82][l]+f[24][l]*alpha_vdim[81][l]+f[6][l]*alpha_vdim[76][l]+f[34][l]*alpha_vdim[75][l]+f[33][l]*alpha_vdim[74][l]+f[36][l]*alpha_vdim[73][l]+f[35][l]*alpha_vdim[72][l]+f[58][l]*alpha_vdim[71][l]+f[12][l]*alpha_vdim[70][l]+f[19][l]*alpha_vdim[68][l]+f[20][l]*alpha_vdim[67][l]+f[50][l]*alpha_vdim[66][l]+f[49][l]*alpha_vdim[65][l]+f[37][l]*alpha_vdim[64][l]+alpha_vdim[7][l]*f[59][l]+alpha_vdim[2][l]*f[53][l]+alpha_vdim[1][l]*f[52][l]+alpha_vdim[22][l]*f[51][l]+alpha_vdim[26][l]*f[47][l]+f[26][l]*alpha_vdim[47][l]+alpha_vdim[32][l]*f[43][l]+f[32][l]*alpha_vdim[43][l]+alpha_vdim[0][l]*f[40][l]+alpha_vdim[9][l]*f[39][l]+alpha_vdim[8][l]*f[38][l]+alpha_vdim[14][l]*f[34][l]+f[14][l]*alpha_vdim[34][l]+alpha_vdim[13][l]*f[33][l]+f[13][l]*alpha_vdim[33][l]+alpha_vdim[18][l]*f[28][l]+f[18][l]*alpha_vdim[28][l]+alpha_vdim[17][l]*f[27][l]+f[17][l]*alpha_vdim[27][l]+alpha_vdim[3][l]*f[21][l]+alpha_vdim[5][l]*f[19][l]+f[5][l]*alpha_vdim[19][l]+alpha_vdim[6][l]*f[15][l]+f[6][l]*alpha_vdim[15][l]);
+    out[57][l] += 0.2165063509461096*(f[60][l]*alpha_cdim[134][l]+f[44][l]*alpha_cdim[128][l]+f[20][l]*alpha_vdim[111][l]+f[0][l]*alpha_vdim[106][l]+f[35][l]*alpha_vdim[98][l]+f[36][l]*alpha_vdim[97][l]+f[37][l]*alpha_vdim[96][l]+f[1][l]*alpha_vdim[89][l]+f[2][l]*alpha_vdim[88][l]+f[3][l]*alpha_vdim[87][l]+f[4][l]*alpha_vdim[86][l]+f[48][l]*alpha_vdim[83][l]+f[49][l]*alpha_vdim[82][l]+f[50][l]*alpha_vdim[81][l]+f[7][l]*alpha_vdim[76][l]+f[8][l]*alpha_vdim[75][l]+f[9][l]*alpha_vdim[74][l]+f[10][l]*alpha_vdim[73][l]+f[11][l]*alpha_vdim[72][l]+f[12][l]*alpha_vdim[71][l]+f[58][l]*alpha_vdim[70][l]+f[24][l]*alpha_cdim[69][l]+f[22][l]*alpha_vdim[68][l]+f[23][l]*alpha_vdim[67][l]+f[24][l]*alpha_vdim[66][l]+f[25][l]*alpha_vdim[65][l]+f[42][l]*alpha_vdim[64][l]+f[45][l]*alpha_cdim[64][l]+alpha_vdim[6][l]*f[59][l]+alpha_vdim[17][l]*f[53][l]+alpha_vdim[18][l]*f[52][l]+alpha_vdim[19][l]*f[51][l]+f[21][l]*alpha_vdim[47][l]+alpha_cdim[0][l]*f[46][l]+alpha_vdim[0][l]*f[43][l]+f[0][l]*alpha_vdim[43][l]+alpha_vdim[32][l]*f[40][l]+alpha_vdim[33][l]*f[39][l]+alpha_vdim[34][l]*f[38][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[28][l]+f[1][l]*alpha_vdim[28][l]+alpha_vdim[2][l]*f[27][l]+f[2][l]*alpha_vdim[27][l]+alpha_vdim[3][l]*f[26][l]+f[3][l]*alpha_vdim[26][l]+alpha_vdim[5][l]*f[22][l]+f[5][l]*alpha_vdim[22][l]+alpha_vdim[7][l]*f[15][l]+f[7][l]*alpha_vdim[15][l]+alpha_vdim[8][l]*f[14][l]+f[8][l]*alpha_vdim[14][l]+alpha_vdim[9][l]*f[13][l]+f[9][l]*alpha_vdim[13][l]);
+    out[58][l] += 0.2165063509461096*(f[16][l]*alpha_vdim[171][l]+f[0][l]*alpha_vdim[170][l]+f[29][l]*alpha_vdim[156][l]+f[30][l]*alpha_vdim[155][l]+f[31][l]*alpha_vdim[154][l]+f[1][l]*alpha_vdim[153][l]+f[2][l]*alpha_vdim[152][l]+f[3][l]*alpha_vdim[151][l]+f[4][l]*alpha_vdim[150][l]+f[44][l]*alpha_vdim[143][l]+f[45][l]*alpha_vdim[142][l]+f[46][l]*alpha_vdim[141][l]+f[7][l]*alpha_vdim[140][l]+f[8][l]*alpha_vdim[139][l]+f[9][l]*alpha_vdim[138][l]+f[10][l]*alpha_vdim[137][l]+f[11][l]*alpha_vdim[136][l]+f[12][l]*alpha_vdim[135][l]+f[23][l]*alpha_cdim[134][l]+f[57][l]*alpha_vdim[133][l]+f[22][l]*alpha_vdim[132][l]+f[23][l]*alpha_vdim[131][l]+f[24][l]*alpha_vdim[130][l]+f[25][l]*alpha_vdim[129][l]+f[42][l]*alpha_vdim[128][l]+f[48][l]*alpha_cdim[128][l]+f[61][l]*alpha_cdim[69][l]+f[49][l]*alpha_cdim[64][l]+alpha_vdim[5][l]*f[59][l]+alpha_vdim[13][l]*f[53][l]+alpha_vdim[14][l]*f[52][l]+alpha_vdim[15][l]*f[51][l]+alpha_cdim[0][l]*f[50][l]+alpha_vdim[0][l]*f[47][l]+f[0][l]*alpha_vdim[47][l]+f[21][l]*alpha_vdim[43][l]+alpha_vdim[26][l]*f[40][l]+alpha_vdim[27][l]*f[39][l]+alpha_vdim[28][l]*f[38][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[34][l]+f[1][l]*alpha_vdim[34][l]+alpha_vdim[2][l]*f[33][l]+f[2][l]*alpha_vdim[33][l]+alpha_vdim[3][l]*f[32][l]+f[3][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[22][l]+f[6][l]*alpha_vdim[22][l]+alpha_vdim[7][l]*f[19][l]+f[7][l]*alpha_vdim[19][l]+alpha_vdim[8][l]*f[18][l]+f[8][l]*alpha_vdim[18][l]+alpha_vdim[9][l]*f[17][l]+f[9][l]*alpha_vdim[17][l]);
+    out[59][l] += 0.2165063509461096*(f[0][l]*alpha_vdim[171][l]+f[16][l]*alpha_vdim[170][l]+f[1][l]*alpha_vdim[156][l]+f[2][l]*alpha_vdim[155][l]+f[3][l]*alpha_vdim[154][l]+f[29][l]*alpha_vdim[153][l]+f[30][l]*alpha_vdim[152][l]+f[31][l]*alpha_vdim[151][l]+f[5][l]*alpha_vdim[150][l]+f[7][l]*alpha_vdim[143][l]+f[8][l]*alpha_vdim[142][l]+f[9][l]*alpha_vdim[141][l]+f[44][l]*alpha_vdim[140][l]+f[45][l]*alpha_vdim[139][l]+f[46][l]*alpha_vdim[138][l]+f[13][l]*alpha_vdim[137][l]+f[14][l]*alpha_vdim[136][l]+f[15][l]*alpha_vdim[135][l]+f[26][l]*alpha_cdim[134][l]+f[22][l]*alpha_vdim[133][l]+f[57][l]*alpha_vdim[132][l]+f[26][l]*alpha_vdim[131][l]+f[27][l]*alpha_vdim[130][l]+f[28][l]*alpha_vdim[129][l]+f[43][l]*alpha_vdim[128][l]+f[51][l]*alpha_cdim[128][l]+f[0][l]*alpha_vdim[111][l]+f[20][l]*alpha_vdim[106][l]+f[1][l]*alpha_vdim[98][l]+f[2][l]*alpha_vdim[97][l]+f[3][l]*alpha_vdim[96][l]+f[35][l]*alpha_vdim[89][l]+f[36][l]*alpha_vdim[88][l]+f[37][l]*alpha_vdim[87][l]+f[6][l]*alpha_vdim[86][l]+f[7][l]*alpha_vdim[83][l]+f[8][l]*alpha_vdim[82][l]+f[9][l]*alpha_vdim[81][l]+f[48][l]*alpha_vdim[76][l]+f[49][l]*alpha_vdim[75][l]+f[50][l]*alpha_vdim[74][l]+f[17][l]*alpha_vdim[73][l]+f[18][l]*alpha_vdim[72][l]+f[19][l]*alpha_vdim[71][l]+f[22][l]*alpha_vdim[70][l]+f[33][l]*alpha_cdim[69][l]+f[58][l]*alpha_vdim[68][l]+f[32][l]*alpha_vdim[67][l]+f[33][l]*alpha_vdim[66][l]+f[34][l]*alpha_vdim[65][l]+f[47][l]*alpha_vdim[64][l]+f[52][l]*alpha_cdim[64][l]+alpha_cdim[4][l]*f[62][l]+alpha_cdim[0][l]*f[53][l]);
+    out[60][l] += 0.2165063509461096*(f[12][l]*alpha_vdim[171][l]+f[15][l]*alpha_vdim[170][l]+f[24][l]*alpha_vdim[156][l]+f[25][l]*alpha_vdim[155][l]+f[4][l]*alpha_vdim[154][l]+f[27][l]*alpha_vdim[153][l]+f[28][l]*alpha_vdim[152][l]+f[5][l]*alpha_vdim[151][l]+f[31][l]*alpha_vdim[150][l]+f[42][l]*alpha_vdim[143][l]+f[10][l]*alpha_vdim[142][l]+f[11][l]*alpha_vdim[141][l]+f[43][l]*alpha_vdim[140][l]+f[13][l]*alpha_vdim[139][l]+f[14][l]*alpha_vdim[138][l]+f[45][l]*alpha_vdim[137][l]+f[46][l]*alpha_vdim[136][l]+f[16][l]*alpha_vdim[135][l]+f[23][l]*alpha_vdim[133][l]+f[26][l]*alpha_vdim[132][l]+f[57][l]*alpha_vdim[131][l]+f[29][l]*alpha_vdim[130][l]+f[30][l]*alpha_vdim[129][l]+f[44][l]*alpha_vdim[128][l]+f[12][l]*alpha_vdim[111][l]+f[19][l]*alpha_vdim[106][l]+f[24][l]*alpha_vdim[98][l]+f[25][l]*alpha_vdim[97][l]+f[4][l]*alpha_vdim[96][l]+f[33][l]*alpha_vdim[89][l]+f[34][l]*alpha_vdim[88][l]+f[6][l]*alpha_vdim[87][l]+f[37][l]*alpha_vdim[86][l]+f[42][l]*alpha_vdim[83][l]+f[10][l]*alpha_vdim[82][l]+f[11][l]*alpha_vdim[81][l]+f[47][l]*alpha_vdim[76][l]+f[17][l]*alpha_vdim[75][l]+f[18][l]*alpha_vdim[74][l]+f[49][l]*alpha_vdim[73][l]+f[50][l]*alpha_vdim[72][l]+f[20][l]*alpha_vdim[71][l]+f[23][l]*alpha_vdim[70][l]+f[35][l]*alpha_cdim[69][l]+f[32][l]*alpha_vdim[68][l]+f[58][l]*alpha_vdim[67][l]+f[35][l]*alpha_vdim[66][l]+f[36][l]*alpha_vdim[65][l]+f[48][l]*alpha_vdim[64][l]+f[54][l]*alpha_cdim[64][l]+alpha_vdim[3][l]*f[59][l]+alpha_cdim[0][l]*f[55][l]+alpha_vdim[8][l]*f[53][l]+alpha_vdim[9][l]*f[52][l]+alpha_vdim[0][l]*f[51][l]+alpha_vdim[15][l]*f[47][l]+f[15][l]*alpha_vdim[47][l]+alpha_vdim[19][l]*f[43][l]+f[19][l]*alpha_vdim[43][l]+alpha_vdim[22][l]*f[40][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[39][l]+alpha_vdim[2][l]*f[38][l]+alpha_vdim[27][l]*f[34][l]+f[27][l]*alpha_vdim[34][l]+alpha_vdim[28][l]*f[33][l]+f[28][l]*alpha_vdim[33][l]+alpha_vdim[5][l]*f[32][l]+f[5][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[26][l]+f[6][l]*alpha_vdim[26][l]+alpha_vdim[7][l]*f[21][l]+alpha_vdim[13][l]*f[18][l]+f[13][l]*alpha_vdim[18][l]+alpha_vdim[14][l]*f[17][l]+f[14][l]*alpha_vdim[17][l]);
+    out[61][l] += 0.2165063509461096*(f[11][l]*alpha_vdim[171][l]+f[14][l]*alpha_vdim[170][l]+f[23][l]*alpha_vdim[156][l]+f[4][l]*alpha_vdim[155][l]+f[25][l]*alpha_vdim[154][l]+f[26][l]*alpha_vdim[153][l]+f[5][l]*alpha_vdim[152][l]+f[28][l]*alpha_vdim[151][l]+f[30][l]*alpha_vdim[150][l]+f[10][l]*alpha_vdim[143][l]+f[42][l]*alpha_vdim[142][l]+f[12][l]*alpha_vdim[141][l]+f[13][l]*alpha_vdim[140][l]+f[43][l]*alpha_vdim[139][l]+f[15][l]*alpha_vdim[138][l]+f[44][l]*alpha_vdim[137][l]+f[16][l]*alpha_vdim[136][l]+f[46][l]*alpha_vdim[135][l]+f[29][l]*alpha_cdim[134][l]+f[24][l]*alpha_vdim[133][l]+f[27][l]*alpha_vdim[132][l]+f[29][l]*alpha_vdim[131][l]+f[57][l]*alpha_vdim[130][l]+f[31][l]*alpha_vdim[129][l]+f[45][l]*alpha_vdim[128][l]+f[54][l]*alpha_cdim[128][l]+f[11][l]*alpha_vdim[111][l]+f[18][l]*alpha_vdim[106][l]+f[23][l]*alpha_vdim[98][l]+f[4][l]*alpha_vdim[97][l]+f[25][l]*alpha_vdim[96][l]+f[32][l]*alpha_vdim[89][l]+f[6][l]*alpha_vdim[88][l]+f[34][l]*alpha_vdim[87][l]+f[36][l]*alpha_vdim[86][l]+f[10][l]*alpha_vdim[83][l]+f[42][l]*alpha_vdim[82][l]+f[12][l]*alpha_vdim[81][l]+f[17][l]*alpha_vdim[76][l]+f[47][l]*alpha_vdim[75][l]+f[19][l]*alpha_vdim[74][l]+f[48][l]*alpha_vdim[73][l]+f[20][l]*alpha_vdim[72][l]+f[50][l]*alpha_vdim[71][l]+f[24][l]*alpha_vdim[70][l]+f[33][l]*alpha_vdim[68][l]+f[35][l]*alpha_vdim[67][l]+f[58][l]*alpha_vdim[66][l]+f[37][l]*alpha_vdim[65][l]+f[49][l]*alpha_vdim[64][l]+alpha_vdim[2][l]*f[59][l]+alpha_cdim[0][l]*f[56][l]+alpha_vdim[7][l]*f[53][l]+alpha_vdim[0][l]*f[52][l]+alpha_vdim[9][l]*f[51][l]+alpha_vdim[14][l]*f[47][l]+f[14][l]*alpha_vdim[47][l]+alpha_vdim[18][l]*f[43][l]+f[18][l]*alpha_vdim[43][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[40][l]+alpha_vdim[22][l]*f[39][l]+alpha_vdim[3][l]*f[38][l]+alpha_vdim[26][l]*f[34][l]+f[26][l]*alpha_vdim[34][l]+alpha_vdim[5][l]*f[33][l]+f[5][l]*alpha_vdim[33][l]+alpha_vdim[28][l]*f[32][l]+f[28][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[27][l]+f[6][l]*alpha_vdim[27][l]+alpha_vdim[8][l]*f[21][l]+alpha_vdim[13][l]*f[19][l]+f[13][l]*alpha_vdim[19][l]+alpha_vdim[15][l]*f[17][l]+f[15][l]*alpha_vdim[17][l]);
+    out[62][l] += 0.2165063509461096*(f[10][l]*alpha_vdim[171][l]+f[13][l]*alpha_vdim[170][l]+f[4][l]*alpha_vdim[156][l]+f[23][l]*alpha_vdim[155][l]+f[24][l]*alpha_vdim[154][l]+f[5][l]*alpha_vdim[153][l]+f[26][l]*alpha_vdim[152][l]+f[27][l]*alpha_vdim[151][l]+f[29][l]*alpha_vdim[150][l]+f[11][l]*alpha_vdim[143][l]+f[12][l]*alpha_vdim[142][l]+f[42][l]*alpha_vdim[141][l]+f[14][l]*alpha_vdim[140][l]+f[15][l]*alpha_vdim[139][l]+f[43][l]*alpha_vdim[138][l]+f[16][l]*alpha_vdim[137][l]+f[44][l]*alpha_vdim[136][l]+f[45][l]*alpha_vdim[135][l]+f[30][l]*alpha_cdim[134][l]+f[25][l]*alpha_vdim[133][l]+f[28][l]*alpha_vdim[132][l]+f[30][l]*alpha_vdim[131][l]+f[31][l]*alpha_vdim[130][l]+f[57][l]*alpha_vdim[129][l]+f[46][l]*alpha_vdim[128][l]+f[55][l]*alpha_cdim[128][l]+f[10][l]*alpha_vdim[111][l]+f[17][l]*alpha_vdim[106][l]+f[4][l]*alpha_vdim[98][l]+f[23][l]*alpha_vdim[97][l]+f[24][l]*alpha_vdim[96][l]+f[6][l]*alpha_vdim[89][l]+f[32][l]*alpha_vdim[88][l]+f[33][l]*alpha_vdim[87][l]+f[35][l]*alpha_vdim[86][l]+f[11][l]*alpha_vdim[83][l]+f[12][l]*alpha_vdim[82][l]+f[42][l]*alpha_vdim[81][l]+f[18][l]*alpha_vdim[76][l]+f[19][l]*alpha_vdim[75][l]+f[47][l]*alpha_vdim[74][l]+f[20][l]*alpha_vdim[73][l]+f[48][l]*alpha_vdim[72][l]+f[49][l]*alpha_vdim[71][l]+f[25][l]*alpha_vdim[70][l]+f[37][l]*alpha_cdim[69][l]+f[34][l]*alpha_vdim[68][l]+f[36][l]*alpha_vdim[67][l]+f[37][l]*alpha_vdim[66][l]+f[58][l]*alpha_vdim[65][l]+f[50][l]*alpha_vdim[64][l]+f[56][l]*alpha_cdim[64][l]+alpha_vdim[1][l]*f[59][l]+alpha_vdim[0][l]*f[53][l]+alpha_vdim[7][l]*f[52][l]+alpha_vdim[8][l]*f[51][l]+alpha_vdim[13][l]*f[47][l]+f[13][l]*alpha_vdim[47][l]+alpha_vdim[17][l]*f[43][l]+f[17][l]*alpha_vdim[43][l]+alpha_vdim[2][l]*f[40][l]+alpha_vdim[3][l]*f[39][l]+alpha_vdim[22][l]*f[38][l]+alpha_vdim[5][l]*f[34][l]+f[5][l]*alpha_vdim[34][l]+alpha_vdim[26][l]*f[33][l]+f[26][l]*alpha_vdim[33][l]+alpha_vdim[27][l]*f[32][l]+f[27][l]*alpha_vdim[32][l]+alpha_vdim[6][l]*f[28][l]+f[6][l]*alpha_vdim[28][l]+alpha_vdim[9][l]*f[21][l]+alpha_vdim[14][l]*f[19][l]+f[14][l]*alpha_vdim[19][l]+alpha_vdim[15][l]*f[18][l]+f[15][l]*alpha_vdim[18][l]);
+    out[63][l] += 0.2165063509461096*(f[4][l]*alpha_vdim[171][l]+f[5][l]*alpha_vdim[170][l]+f[10][l]*alpha_vdim[156][l]+f[11][l]*alpha_vdim[155][l]+f[12][l]*alpha_vdim[154][l]+f[13][l]*alpha_vdim[153][l]+f[14][l]*alpha_vdim[152][l]+f[15][l]*alpha_vdim[151][l]+f[16][l]*alpha_vdim[150][l]+f[23][l]*alpha_vdim[143][l]+f[24][l]*alpha_vdim[142][l]+f[25][l]*alpha_vdim[141][l]+f[26][l]*alpha_vdim[140][l]+f[27][l]*alpha_vdim[139][l]+f[28][l]*alpha_vdim[138][l]+f[29][l]*alpha_vdim[137][l]+f[30][l]*alpha_vdim[136][l]+f[31][l]*alpha_vdim[135][l]+f[44][l]*alpha_cdim[134][l]+f[42][l]*alpha_vdim[133][l]+f[43][l]*alpha_vdim[132][l]+f[44][l]*alpha_vdim[131][l]+f[45][l]*alpha_vdim[130][l]+f[46][l]*alpha_vdim[129][l]+f[57][l]*alpha_vdim[128][l]+f[60][l]*alpha_cdim[128][l]+f[4][l]*alpha_vdim[111][l]+f[6][l]*alpha_vdim[106][l]+f[10][l]*alpha_vdim[98][l]+f[11][l]*alpha_vdim[97][l]+f[12][l]*alpha_vdim[96][l]+f[17][l]*alpha_vdim[89][l]+f[18][l]*alpha_vdim[88][l]+f[19][l]*alpha_vdim[87][l]+f[20][l]*alpha_vdim[86][l]+f[23][l]*alpha_vdim[83][l]+f[24][l]*alpha_vdim[82][l]+f[25][l]*alpha_vdim[81][l]+f[32][l]*alpha_vdim[76][l]+f[33][l]*alpha_vdim[75][l]+f[34][l]*alpha_vdim[74][l]+f[35][l]*alpha_vdim[73][l]+f[36][l]*alpha_vdim[72][l]+f[37][l]*alpha_vdim[71][l]+f[42][l]*alpha_vdim[70][l]+f[49][l]*alpha_cdim[69][l]+f[47][l]*alpha_vdim[68][l]+f[48][l]*alpha_vdim[67][l]+f[49][l]*alpha_vdim[66][l]+f[50][l]*alpha_vdim[65][l]+f[58][l]*alpha_vdim[64][l]+f[61][l]*alpha_cdim[64][l]+alpha_cdim[0][l]*f[62][l]+alpha_vdim[0][l]*f[59][l]+(alpha_cdim[4][l]+alpha_vdim[1][l])*f[53][l]+alpha_vdim[2][l]*f[52][l]+alpha_vdim[3][l]*f[51][l]+alpha_vdim[5][l]*f[47][l]+f[5][l]*alpha_vdim[47][l]+alpha_vdim[6][l]*f[43][l]+f[6][l]*alpha_vdim[43][l]+alpha_vdim[7][l]*f[40][l]+alpha_vdim[8][l]*f[39][l]+alpha_vdim[9][l]*f[38][l]+alpha_vdim[13][l]*f[34][l]+f[13][l]*alpha_vdim[34][l]+alpha_vdim[14][l]*f[33][l]+f[14][l]*alpha_vdim[33][l]+alpha_vdim[15][l]*f[32][l]+f[15][l]*alpha_vdim[32][l]+alpha_vdim[17][l]*f[28][l]+f[17][l]*alpha_vdim[28][l]+alpha_vdim[18][l]*f[27][l]+f[18][l]*alpha_vdim[27][l]+alpha_vdim[19][l]*f[26][l]+f[19][l]*alpha_vdim[26][l]+f[21][l]*alpha_vdim[22][l]);
+
+    cfl[l] = cflFreq_mid;
+  } 
+} 
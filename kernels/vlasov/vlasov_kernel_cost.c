@@ -0,0 +1,339 @@
+// Generated by gen-kernel-cost.sh. Do not edit.
+
+#include <string.h>
+#include <gkyl_vlasov_kernel_cost.h>
+
+static const struct gkyl_kern_cost vlasov_kernel_costs[] = {
+  { "vlasov_boundary_surfvx_1x1v_ser_p1", 60, 224 },
+  { "vlasov_boundary_surfvx_1x1v_ser_p2", 120, 296 },
+  { "vlasov_boundary_surfvx_1x1v_tensor_p1", 45, 160 },
+  { "vlasov_boundary_surfvx_1x1v_tensor_p2", 127, 328 },
+  { "vlasov_boundary_surfvx_1x2v_ser_p1", 376, 576 },
+  { "vlasov_boundary_surfvx_1x2v_ser_p2", 688, 720 },
+  { "vlasov_boundary_surfvx_1x2v_tensor_p1", 177, 320 },
+  { "vlasov_boundary_surfvx_1x2v_tensor_p2", 881, 944 },
+  { "vlasov_boundary_surfvx_1x3v_ser_p1", 2016, 1376 },
+  { "vlasov_boundary_surfvx_1x3v_ser_p2", 3384, 1656 },
+  { "vlasov_boundary_surfvx_1x3v_tensor_p1", 585, 608 },
+  { "vlasov_boundary_surfvx_1x3v_tensor_p2", 5601, 2712 },
+  { "vlasov_boundary_surfvx_2x2v_ser_p1", 1407, 1120 },
+  { "vlasov_boundary_surfvx_2x2v_ser_p2", 4165, 1696 },
+  { "vlasov_boundary_surfvx_2x2v_tensor_p1", 641, 608 },
+  { "vlasov_boundary_surfvx_2x2v_tensor_p2", 7209, 2768 },
+  { "vlasov_boundary_surfvx_2x3v_ser_p1", 7793, 2704 },
+  { "vlasov_boundary_surfvx_2x3v_ser_p2", 20039, 3824 },
+  { "vlasov_boundary_surfvx_2x3v_tensor_p1", 2193, 1168 },
+  { "vlasov_boundary_surfvx_2x3v_tensor_p2", 45789, 8040 },
+  { "vlasov_boundary_surfvx_3x3v_ser_p1", 29797, 5360 },
+  { "vlasov_boundary_surfvx_3x3v_tensor_p1", 8385, 2288 },
+  { "vlasov_boundary_surfvy_1x2v_ser_p1", 378, 576 },
+  { "vlasov_boundary_surfvy_1x2v_ser_p2", 676, 720 },
+  { "vlasov_boundary_surfvy_1x2v_tensor_p1", 175, 320 },
+  { "vlasov_boundary_surfvy_1x2v_tensor_p2", 864, 944 },
+  { "vlasov_boundary_surfvy_1x3v_ser_p1", 2018, 1376 },
+  { "vlasov_boundary_surfvy_1x3v_ser_p2", 3325, 1656 },
+  { "vlasov_boundary_surfvy_1x3v_tensor_p1", 571, 608 },
+  { "vlasov_boundary_surfvy_1x3v_tensor_p2", 5470, 2712 },
+  { "vlasov_boundary_surfvy_2x2v_ser_p1", 1411, 1120 },
+  { "vlasov_boundary_surfvy_2x2v_ser_p2", 4092, 1696 },
+  { "vlasov_boundary_surfvy_2x2v_tensor_p1", 637, 608 },
+  { "vlasov_boundary_surfvy_2x2v_tensor_p2", 7070, 2768 },
+  { "vlasov_boundary_surfvy_2x3v_ser_p1", 7813, 2704 },
+  { "vlasov_boundary_surfvy_2x3v_ser_p2", 19645, 3824 },
+  { "vlasov_boundary_surfvy_2x3v_tensor_p1", 2149, 1168 },
+  { "vlasov_boundary_surfvy_2x3v_tensor_p2", 44580, 8040 },
+  { "vlasov_boundary_surfvy_3x3v_ser_p1", 29837, 5360 },
+  { "vlasov_boundary_surfvy_3x3v_tensor_p1", 8265, 2288 },
+  { "vlasov_boundary_surfvz_1x3v_ser_p1", 2008, 1376 },
+  { "vlasov_boundary_surfvz_1x3v_ser_p2", 3241, 1656 },
+  { "vlasov_boundary_surfvz_1x3v_tensor_p1", 561, 608 },
+  { "vlasov_boundary_surfvz_1x3v_tensor_p2", 5319, 2712 },
+  { "vlasov_boundary_surfvz_2x3v_ser_p1", 7761, 2704 },
+  { "vlasov_boundary_surfvz_2x3v_ser_p2", 19292, 3824 },
+  { "vlasov_boundary_surfvz_2x3v_tensor_p1", 2113, 1168 },
+  { "vlasov_boundary_surfvz_2x3v_tensor_p2", 43817, 8040 },
+  { "vlasov_boundary_surfvz_3x3v_ser_p1", 29701, 5360 },
+  { "vlasov_boundary_surfvz_3x3v_tensor_p1", 8161, 2288 },
+  { "vlasov_boundary_surfx_1x1v_ser_p1", 53, 216 },
+  { "vlasov_boundary_surfx_1x1v_ser_p2", 79, 280 },
+  { "vlasov_boundary_surfx_1x1v_tensor_p1", 38, 152 },
+  { "vlasov_boundary_surfx_1x1v_tensor_p2", 88, 312 },
+  { "vlasov_boundary_surfx_1x2v_ser_p1", 137, 536 },
+  { "vlasov_boundary_surfx_1x2v_ser_p2", 191, 664 },
+  { "vlasov_boundary_surfx_1x2v_tensor_p1", 75, 280 },
+  { "vlasov_boundary_surfx_1x2v_tensor_p2", 262, 888 },
+  { "vlasov_boundary_surfx_1x3v_ser_p1", 337, 1304 },
+  { "vlasov_boundary_surfx_1x3v_ser_p2", 449, 1560 },
+  { "vlasov_boundary_surfx_1x3v_tensor_p1", 149, 536 },
+  { "vlasov_boundary_surfx_1x3v_tensor_p2", 784, 2616 },
+  { "vlasov_boundary_surfx_2x2v_ser_p1", 273, 1048 },
+  { "vlasov_boundary_surfx_2x2v_ser_p2", 449, 1560 },
+  { "vlasov_boundary_surfx_2x2v_tensor_p1", 149, 536 },
+  { "vlasov_boundary_surfx_2x2v_tensor_p2", 784, 2616 },
+  { "vlasov_boundary_surfx_2x3v_ser_p1", 673, 2584 },
+  { "vlasov_boundary_surfx_2x3v_ser_p2", 1033, 3608 },
+  { "vlasov_boundary_surfx_2x3v_tensor_p1", 297, 1048 },
+  { "vlasov_boundary_surfx_2x3v_tensor_p2", 2350, 7800 },
+  { "vlasov_boundary_surfx_3x3v_ser_p1", 1345, 5144 },
+  { "vlasov_boundary_surfx_3x3v_tensor_p1", 593, 2072 },
+  { "vlasov_boundary_surfy_2x2v_ser_p1", 273, 1048 },
+  { "vlasov_boundary_surfy_2x2v_ser_p2", 449, 1560 },
+  { "vlasov_boundary_surfy_2x2v_tensor_p1", 149, 536 },
+  { "vlasov_boundary_surfy_2x2v_tensor_p2", 784, 2616 },
+  { "vlasov_boundary_surfy_2x3v_ser_p1", 673, 2584 },
+  { "vlasov_boundary_surfy_2x3v_ser_p2", 1033, 3608 },
+  { "vlasov_boundary_surfy_2x3v_tensor_p1", 297, 1048 },
+  { "vlasov_boundary_surfy_2x3v_tensor_p2", 2350, 7800 },
+  { "vlasov_boundary_surfy_3x3v_ser_p1", 1345, 5144 },
+  { "vlasov_boundary_surfy_3x3v_tensor_p1", 593, 2072 },
+  { "vlasov_boundary_surfz_3x3v_ser_p1", 1345, 5144 },
+  { "vlasov_boundary_surfz_3x3v_tensor_p1", 593, 2072 },
+  { "vlasov_gen_geo_surfx_3x3v_ser_p1", 77093, 6680 },
+  { "vlasov_gen_geo_surfy_3x3v_ser_p1", 79081, 6680 },
+  { "vlasov_gen_geo_surfz_3x3v_ser_p1", 76793, 6680 },
+  { "vlasov_poisson_boundary_surfvx_1x1v_ser_p1", 54, 224 },
+  { "vlasov_poisson_boundary_surfvx_1x1v_ser_p2", 107, 296 },
+  { "vlasov_poisson_boundary_surfvx_1x2v_ser_p1", 276, 560 },
+  { "vlasov_poisson_boundary_surfvx_1x2v_ser_p2", 483, 696 },
+  { "vlasov_poisson_boundary_surfvx_1x3v_ser_p1", 1588, 1344 },
+  { "vlasov_poisson_boundary_surfvx_1x3v_ser_p2", 2531, 1608 },
+  { "vlasov_poisson_boundary_surfvx_2x2v_ser_p1", 1014, 1088 },
+  { "vlasov_poisson_boundary_surfvx_2x2v_ser_p2", 2761, 1624 },
+  { "vlasov_poisson_boundary_surfvx_2x3v_ser_p1", 6085, 2640 },
+  { "vlasov_poisson_boundary_surfvx_2x3v_ser_p2", 14329, 3688 },
+  { "vlasov_poisson_boundary_surfvx_3x3v_ser_p1", 23028, 5224 },
+  { "vlasov_poisson_boundary_surfvy_2x2v_ser_p1", 1015, 1088 },
+  { "vlasov_poisson_boundary_surfvy_2x2v_ser_p2", 2680, 1624 },
+  { "vlasov_poisson_boundary_surfvy_2x3v_ser_p1", 6101, 2640 },
+  { "vlasov_poisson_boundary_surfvy_2x3v_ser_p2", 13927, 3688 },
+  { "vlasov_poisson_boundary_surfvy_3x3v_ser_p1", 23060, 5224 },
+  { "vlasov_poisson_boundary_surfvz_3x3v_ser_p1", 22932, 5224 },
+  { "vlasov_poisson_extem_boundary_surfvx_1x1v_ser_p1", 54, 224 },
+  { "vlasov_poisson_extem_boundary_surfvx_1x1v_ser_p2", 107, 296 },
+  { "vlasov_poisson_extem_boundary_surfvx_1x2v_ser_p1", 319, 568 },
+  { "vlasov_poisson_extem_boundary_surfvx_1x2v_ser_p2", 599, 712 },
+  { "vlasov_poisson_extem_boundary_surfvx_1x3v_ser_p1", 1780, 1360 },
+  { "vlasov_poisson_extem_boundary_surfvx_1x3v_ser_p2", 3049, 1640 },
+  { "vlasov_poisson_extem_boundary_surfvx_2x2v_ser_p1", 1299, 1120 },
+  { "vlasov_poisson_extem_boundary_surfvx_2x2v_ser_p2", 3736, 1704 },
+  { "vlasov_poisson_extem_boundary_surfvx_2x3v_ser_p1", 7147, 2688 },
+  { "vlasov_poisson_extem_boundary_surfvx_2x3v_ser_p2", 18163, 3808 },
+  { "vlasov_poisson_extem_boundary_surfvx_3x3v_ser_p1", 28221, 5336 },
+  { "vlasov_poisson_extem_boundary_surfvy_1x2v_ser_p1", 316, 560 },
+  { "vlasov_poisson_extem_boundary_surfvy_1x2v_ser_p2", 578, 696 },
+  { "vlasov_poisson_extem_boundary_surfvy_1x3v_ser_p1", 1692, 1344 },
+  { "vlasov_poisson_extem_boundary_surfvy_1x3v_ser_p2", 2753, 1608 },
+  { "vlasov_poisson_extem_boundary_surfvy_2x2v_ser_p1", 1299, 1120 },
+  { "vlasov_poisson_extem_boundary_surfvy_2x2v_ser_p2", 3655, 1704 },
+  { "vlasov_poisson_extem_boundary_surfvy_2x3v_ser_p1", 7163, 2688 },
+  { "vlasov_poisson_extem_boundary_surfvy_2x3v_ser_p2", 17769, 3808 },
+  { "vlasov_poisson_extem_boundary_surfvy_3x3v_ser_p1", 28253, 5336 },
+  { "vlasov_poisson_extem_boundary_surfvz_1x3v_ser_p1", 1684, 1344 },
+  { "vlasov_poisson_extem_boundary_surfvz_1x3v_ser_p2", 2672, 1608 },
+  { "vlasov_poisson_extem_boundary_surfvz_2x3v_ser_p1", 6942, 2648 },
+  { "vlasov_poisson_extem_boundary_surfvz_2x3v_ser_p2", 17130, 3704 },
+  { "vlasov_poisson_extem_boundary_surfvz_3x3v_ser_p1", 28125, 5336 },
+  { "vlasov_poisson_extem_surfvx_1x1v_ser_p1", 94, 272 },
+  { "vlasov_poisson_extem_surfvx_1x1v_ser_p2", 190, 360 },
+  { "vlasov_poisson_extem_surfvx_1x2v_ser_p1", 591, 696 },
+  { "vlasov_poisson_extem_surfvx_1x2v_ser_p2", 1111, 872 },
+  { "vlasov_poisson_extem_surfvx_1x3v_ser_p1", 3426, 1680 },
+  { "vlasov_poisson_extem_surfvx_1x3v_ser_p2", 5833, 2024 },
+  { "vlasov_poisson_extem_surfvx_2x2v_ser_p1", 2431, 1376 },
+  { "vlasov_poisson_extem_surfvx_2x2v_ser_p2", 6962, 2088 },
+  { "vlasov_poisson_extem_surfvx_2x3v_ser_p1", 13797, 3328 },
+  { "vlasov_poisson_extem_surfvx_2x3v_ser_p2", 34659, 4704 },
+  { "vlasov_poisson_extem_surfvx_3x3v_ser_p1", 54421, 6616 },
+  { "vlasov_poisson_extem_surfvy_1x2v_ser_p1", 588, 688 },
+  { "vlasov_poisson_extem_surfvy_1x2v_ser_p2", 1075, 856 },
+  { "vlasov_poisson_extem_surfvy_1x3v_ser_p1", 3278, 1664 },
+  { "vlasov_poisson_extem_surfvy_1x3v_ser_p2", 5307, 1992 },
+  { "vlasov_poisson_extem_surfvy_2x2v_ser_p1", 2431, 1376 },
+  { "vlasov_poisson_extem_surfvy_2x2v_ser_p2", 6800, 2088 },
+  { "vlasov_poisson_extem_surfvy_2x3v_ser_p1", 13829, 3328 },
+  { "vlasov_poisson_extem_surfvy_2x3v_ser_p2", 33863, 4704 },
+  { "vlasov_poisson_extem_surfvy_3x3v_ser_p1", 54485, 6616 },
+  { "vlasov_poisson_extem_surfvz_1x3v_ser_p1", 3262, 1664 },
+  { "vlasov_poisson_extem_surfvz_1x3v_ser_p2", 5145, 1992 },
+  { "vlasov_poisson_extem_surfvz_2x3v_ser_p1", 13440, 3288 },
+  { "vlasov_poisson_extem_surfvz_2x3v_ser_p2", 32711, 4600 },
+  { "vlasov_poisson_extem_surfvz_3x3v_ser_p1", 54229, 6616 },
+  { "vlasov_poisson_extem_vol_1x1v_ser_p1", 48, 152 },
+  { "vlasov_poisson_extem_vol_1x1v_ser_p2", 83, 216 },
+  { "vlasov_poisson_extem_vol_1x2v_ser_p1", 209, 424 },
+  { "vlasov_poisson_extem_vol_1x2v_ser_p2", 451, 536 },
+  { "vlasov_poisson_extem_vol_1x3v_ser_p1", 673, 1024 },
+  { "vlasov_poisson_extem_vol_1x3v_ser_p2", 1538, 1240 },
+  { "vlasov_poisson_extem_vol_2x2v_ser_p1", 928, 856 },
+  { "vlasov_poisson_extem_vol_2x2v_ser_p2", 2804, 1320 },
+  { "vlasov_poisson_extem_vol_2x3v_ser_p1", 3694, 2048 },
+  { "vlasov_poisson_extem_vol_2x3v_ser_p2", 11961, 2928 },
+  { "vlasov_poisson_extem_vol_3x3v_ser_p1", 16543, 4096 },
+  { "vlasov_poisson_surfvx_1x1v_ser_p1", 94, 272 },
+  { "vlasov_poisson_surfvx_1x1v_ser_p2", 190, 360 },
+  { "vlasov_poisson_surfvx_1x2v_ser_p1", 524, 688 },
+  { "vlasov_poisson_surfvx_1x2v_ser_p2", 923, 856 },
+  { "vlasov_poisson_surfvx_1x3v_ser_p1", 3114, 1664 },
+  { "vlasov_poisson_surfvx_1x3v_ser_p2", 4979, 1992 },
+  { "vlasov_poisson_surfvx_2x2v_ser_p1", 1966, 1344 },
+  { "vlasov_poisson_surfvx_2x2v_ser_p2", 5375, 2008 },
+  { "vlasov_poisson_surfvx_2x3v_ser_p1", 12039, 3280 },
+  { "vlasov_poisson_surfvx_2x3v_ser_p2", 28413, 4584 },
+  { "vlasov_poisson_surfvx_3x3v_ser_p1", 45772, 6504 },
+  { "vlasov_poisson_surfvy_2x2v_ser_p1", 1967, 1344 },
+  { "vlasov_poisson_surfvy_2x2v_ser_p2", 5213, 2008 },
+  { "vlasov_poisson_surfvy_2x3v_ser_p1", 12071, 3280 },
+  { "vlasov_poisson_surfvy_2x3v_ser_p2", 27609, 4584 },
+  { "vlasov_poisson_surfvy_3x3v_ser_p1", 45836, 6504 },
+  { "vlasov_poisson_surfvz_3x3v_ser_p1", 45580, 6504 },
+  { "vlasov_poisson_vol_1x1v_ser_p1", 48, 152 },
+  { "vlasov_poisson_vol_1x1v_ser_p2", 83, 216 },
+  { "vlasov_poisson_vol_1x2v_ser_p1", 97, 360 },
+  { "vlasov_poisson_vol_1x2v_ser_p2", 166, 480 },
+  { "vlasov_poisson_vol_1x3v_ser_p1", 206, 832 },
+  { "vlasov_poisson_vol_1x3v_ser_p2", 346, 1064 },
+  { "vlasov_poisson_vol_2x2v_ser_p1", 412, 808 },
+  { "vlasov_poisson_vol_2x2v_ser_p2", 1245, 1240 },
+  { "vlasov_poisson_vol_2x3v_ser_p1", 929, 1920 },
+  { "vlasov_poisson_vol_2x3v_ser_p2", 2660, 2752 },
+  { "vlasov_poisson_vol_3x3v_ser_p1", 3901, 3928 },
+  { "vlasov_stream_gen_geo_vol_3x3v_ser_p1", 30706, 3784 },
+  { "vlasov_stream_vol_1x1v_ser_p1", 24, 96 },
+  { "vlasov_stream_vol_1x1v_ser_p2", 38, 152 },
+  { "vlasov_stream_vol_1x1v_tensor_p1", 16, 72 },
+  { "vlasov_stream_vol_1x1v_tensor_p2", 44, 168 },
+  { "vlasov_stream_vol_1x2v_ser_p1", 52, 216 },
+  { "vlasov_stream_vol_1x2v_ser_p2", 80, 328 },
+  { "vlasov_stream_vol_1x2v_tensor_p1", 26, 120 },
+  { "vlasov_stream_vol_1x2v_tensor_p2", 120, 456 },
+  { "vlasov_stream_vol_1x3v_ser_p1", 118, 504 },
+  { "vlasov_stream_vol_1x3v_ser_p2", 174, 728 },
+  { "vlasov_stream_vol_1x3v_tensor_p1", 46, 216 },
+  { "vlasov_stream_vol_1x3v_tensor_p2", 348, 1320 },
+  { "vlasov_stream_vol_2x2v_ser_p1", 196, 624 },
+  { "vlasov_stream_vol_2x2v_ser_p2", 348, 1008 },
+  { "vlasov_stream_vol_2x2v_tensor_p1", 92, 336 },
+  { "vlasov_stream_vol_2x2v_tensor_p2", 696, 1776 },
+  { "vlasov_stream_vol_2x3v_ser_p1", 460, 1488 },
+  { "vlasov_stream_vol_2x3v_ser_p2", 764, 2256 },
+  { "vlasov_stream_vol_2x3v_tensor_p1", 172, 624 },
+  { "vlasov_stream_vol_2x3v_tensor_p2", 2064, 5232 },
+  { "vlasov_stream_vol_3x3v_ser_p1", 1362, 3432 },
+  { "vlasov_stream_vol_3x3v_tensor_p1", 498, 1416 },
+  { "vlasov_surfvx_1x1v_ser_p1", 106, 272 },
+  { "vlasov_surfvx_1x1v_ser_p2", 215, 360 },
+  { "vlasov_surfvx_1x1v_tensor_p1", 78, 192 },
+  { "vlasov_surfvx_1x1v_tensor_p2", 228, 400 },
+  { "vlasov_surfvx_1x2v_ser_p1", 692, 704 },
+  { "vlasov_surfvx_1x2v_ser_p2", 1266, 880 },
+  { "vlasov_surfvx_1x2v_tensor_p1", 311, 384 },
+  { "vlasov_surfvx_1x2v_tensor_p2", 1644, 1160 },
+  { "vlasov_surfvx_1x3v_ser_p1", 3832, 1696 },
+  { "vlasov_surfvx_1x3v_ser_p2", 6387, 2040 },
+  { "vlasov_surfvx_1x3v_tensor_p1", 1059, 736 },
+  { "vlasov_surfvx_1x3v_tensor_p2", 10781, 3360 },
+  { "vlasov_surfvx_2x2v_ser_p1", 2627, 1376 },
+  { "vlasov_surfvx_2x2v_ser_p2", 7759, 2080 },
+  { "vlasov_surfvx_2x2v_tensor_p1", 1149, 736 },
+  { "vlasov_surfvx_2x2v_tensor_p2", 13713, 3416 },
+  { "vlasov_surfvx_2x3v_ser_p1", 14903, 3344 },
+  { "vlasov_surfvx_2x3v_ser_p2", 37911, 4720 },
+  { "vlasov_surfvx_2x3v_tensor_p1", 4021, 1424 },
+  { "vlasov_surfvx_2x3v_tensor_p2", 88878, 9984 },
+  { "vlasov_surfvx_3x3v_ser_p1", 57157, 6640 },
+  { "vlasov_surfvx_3x3v_tensor_p1", 15465, 2800 },
+  { "vlasov_surfvy_1x2v_ser_p1", 692, 704 },
+  { "vlasov_surfvy_1x2v_ser_p2", 1236, 880 },
+  { "vlasov_surfvy_1x2v_tensor_p1", 303, 384 },
+  { "vlasov_surfvy_1x2v_tensor_p2", 1604, 1160 },
+  { "vlasov_surfvy_1x3v_ser_p1", 3832, 1696 },
+  { "vlasov_surfvy_1x3v_ser_p2", 6263, 2040 },
+  { "vlasov_surfvy_1x3v_tensor_p1", 1027, 736 },
+  { "vlasov_surfvy_1x3v_tensor_p2", 10513, 3360 },
+  { "vlasov_surfvy_2x2v_ser_p1", 2627, 1376 },
+  { "vlasov_surfvy_2x2v_ser_p2", 7597, 2080 },
+  { "vlasov_surfvy_2x2v_tensor_p1", 1133, 736 },
+  { "vlasov_surfvy_2x2v_tensor_p2", 13417, 3416 },
+  { "vlasov_surfvy_2x3v_ser_p1", 14935, 3344 },
+  { "vlasov_surfvy_2x3v_ser_p2", 37107, 4720 },
+  { "vlasov_surfvy_2x3v_tensor_p1", 3925, 1424 },
+  { "vlasov_surfvy_2x3v_tensor_p2", 86442, 9984 },
+  { "vlasov_surfvy_3x3v_ser_p1", 57221, 6640 },
+  { "vlasov_surfvy_3x3v_tensor_p1", 15209, 2800 },
+  { "vlasov_surfvz_1x3v_ser_p1", 3816, 1696 },
+  { "vlasov_surfvz_1x3v_ser_p2", 6101, 2040 },
+  { "vlasov_surfvz_1x3v_tensor_p1", 1011, 736 },
+  { "vlasov_surfvz_1x3v_tensor_p2", 10217, 3360 },
+  { "vlasov_surfvz_2x3v_ser_p1", 14839, 3344 },
+  { "vlasov_surfvz_2x3v_ser_p2", 36417, 4720 },
+  { "vlasov_surfvz_2x3v_tensor_p1", 3861, 1424 },
+  { "vlasov_surfvz_2x3v_tensor_p2", 84934, 9984 },
+  { "vlasov_surfvz_3x3v_ser_p1", 56965, 6640 },
+  { "vlasov_surfvz_3x3v_tensor_p1", 15017, 2800 },
+  { "vlasov_surfx_1x1v_ser_p1", 96, 264 },
+  { "vlasov_surfx_1x1v_ser_p2", 146, 344 },
+  { "vlasov_surfx_1x1v_tensor_p1", 69, 184 },
+  { "vlasov_surfx_1x1v_tensor_p2", 163, 384 },
+  { "vlasov_surfx_1x2v_ser_p1", 249, 664 },
+  { "vlasov_surfx_1x2v_ser_p2", 353, 824 },
+  { "vlasov_surfx_1x2v_tensor_p1", 137, 344 },
+  { "vlasov_surfx_1x2v_tensor_p2", 487, 1104 },
+  { "vlasov_surfx_1x3v_ser_p1", 613, 1624 },
+  { "vlasov_surfx_1x3v_ser_p2", 829, 1944 },
+  { "vlasov_surfx_1x3v_tensor_p1", 273, 664 },
+  { "vlasov_surfx_1x3v_tensor_p2", 1459, 3264 },
+  { "vlasov_surfx_2x2v_ser_p1", 497, 1304 },
+  { "vlasov_surfx_2x2v_ser_p2", 829, 1944 },
+  { "vlasov_surfx_2x2v_tensor_p1", 273, 664 },
+  { "vlasov_surfx_2x2v_tensor_p2", 1459, 3264 },
+  { "vlasov_surfx_2x3v_ser_p1", 1225, 3224 },
+  { "vlasov_surfx_2x3v_ser_p2", 1905, 4504 },
+  { "vlasov_surfx_2x3v_tensor_p1", 545, 1304 },
+  { "vlasov_surfx_2x3v_tensor_p2", 4375, 9744 },
+  { "vlasov_surfx_3x3v_ser_p1", 2449, 6424 },
+  { "vlasov_surfx_3x3v_tensor_p1", 1089, 2584 },
+  { "vlasov_surfy_2x2v_ser_p1", 497, 1304 },
+  { "vlasov_surfy_2x2v_ser_p2", 829, 1944 },
+  { "vlasov_surfy_2x2v_tensor_p1", 273, 664 },
+  { "vlasov_surfy_2x2v_tensor_p2", 1459, 3264 },
+  { "vlasov_surfy_2x3v_ser_p1", 1225, 3224 },
+  { "vlasov_surfy_2x3v_ser_p2", 1905, 4504 },
+  { "vlasov_surfy_2x3v_tensor_p1", 545, 1304 },
+  { "vlasov_surfy_2x3v_tensor_p2", 4375, 9744 },
+  { "vlasov_surfy_3x3v_ser_p1", 2449, 6424 },
+  { "vlasov_surfy_3x3v_tensor_p1", 1089, 2584 },
+  { "vlasov_surfz_3x3v_ser_p1", 2449, 6424 },
+  { "vlasov_surfz_3x3v_tensor_p1", 1089, 2584 },
+  { "vlasov_vol_1x1v_ser_p1", 56, 160 },
+  { "vlasov_vol_1x1v_ser_p2", 97, 224 },
+  { "vlasov_vol_1x1v_tensor_p1", 37, 112 },
+  { "vlasov_vol_1x1v_tensor_p2", 112, 240 },
+  { "vlasov_vol_1x2v_ser_p1", 319, 456 },
+  { "vlasov_vol_1x2v_ser_p2", 609, 576 },
+  { "vlasov_vol_1x2v_tensor_p1", 135, 256 },
+  { "vlasov_vol_1x2v_tensor_p2", 942, 736 },
+  { "vlasov_vol_1x3v_ser_p1", 1489, 1096 },
+  { "vlasov_vol_1x3v_ser_p2", 2778, 1336 },
+  { "vlasov_vol_1x3v_tensor_p1", 436, 512 },
+  { "vlasov_vol_1x3v_tensor_p2", 5937, 2120 },
+  { "vlasov_vol_2x2v_ser_p1", 1132, 896 },
+  { "vlasov_vol_2x2v_ser_p2", 3559, 1376 },
+  { "vlasov_vol_2x2v_tensor_p1", 420, 504 },
+  { "vlasov_vol_2x2v_tensor_p2", 9107, 2184 },
+  { "vlasov_vol_2x3v_ser_p1", 5517, 2160 },
+  { "vlasov_vol_2x3v_ser_p2", 16655, 3120 },
+  { "vlasov_vol_2x3v_tensor_p1", 1497, 1000 },
+  { "vlasov_vol_2x3v_tensor_p2", 60785, 6304 },
+  { "vlasov_vol_3x3v_ser_p1", 20614, 4280 },
+  { "vlasov_vol_3x3v_tensor_p1", 5402, 1968 },
+};
+
+const struct gkyl_kern_cost*
+gkyl_vlasov_kernel_cost(const char *name)
+{
+  int nkern = sizeof(vlasov_kernel_costs)/sizeof(vlasov_kernel_costs[0]);
+  for (int i=0; i<nkern; ++i)
+    if (strcmp(vlasov_kernel_costs[i].name, name) == 0)
+      return &vlasov_kernel_costs[i];
+  return 0;
+}
@@ -397,6 +397,8 @@ main(int argc, char **argv)
     .num_species = 2,
     .species = { elc, ion },
 
+    .num_threads = app_args.num_threads,
+
     .field = field,
 
     .has_low_inp = true,
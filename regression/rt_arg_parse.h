@@ -29,6 +29,10 @@ struct gkyl_app_args {
   enum gkyl_basis_type basis_type; // type of basis functions to use
   enum gkyl_mp_recon mp_recon; // the XX in MP-XX
   bool skip_limiters; // should we skip limiters?
+  bool is_restart; // is this a restarted simulation?
+  int restart_frame; // frame to restart from
+  bool use_single_precision; // store distribution functions in single precision?
+  bool use_kernel_stat; // count and time DG kernels?
 };
 
 static int
@@ -76,6 +80,10 @@ parse_app_args(int argc, char **argv)
   bool step_mode = false;
   bool trace_mem = false;
   bool skip_limiters = false;
+  bool is_restart = false;
+  int restart_frame = 0;
+  bool use_single_precision = false;
+  bool use_kernel_stat = false;
   int num_steps = INT_MAX;
   int num_threads = 1; // by default use only 1 thread
 
@@ -89,7 +97,7 @@ parse_app_args(int argc, char **argv)
   args.basis_type = GKYL_BASIS_MODAL_SERENDIPITY;
 
   int c;
-  while ((c = getopt(argc, argv, "+hgmMt:s:i:b:x:y:z:u:v:w:r:c:d:e:")) != -1) {
+  while ((c = getopt(argc, argv, "+hgmMSKt:s:i:b:x:y:z:u:v:w:r:c:d:e:R:")) != -1) {
     switch (c)
     {
       case 'h':
@@ -105,6 +113,11 @@ parse_app_args(int argc, char **argv)
         printf("        (Only used for MP-XX solvers)\n");
         printf(" -l     Turn off limiters\n");
         printf(" -m     Turn on memory allocation/deallocation tracing\n");
+        printf(" -RN    Restart simulation from frame N\n");
+        printf(" -S     Store distribution functions in single precision\n");
+        printf("        (Only used by Vlasov solvers that support it)\n");
+        printf(" -K     Count and time DG kernels and write roofline table\n");
+        printf("        (Only used by Vlasov solvers that support it)\n");
         printf("\n");
         printf(" Grid resolution in configuration space:\n");
         printf(" -xNX -yNY -zNZ\n");
@@ -127,6 +140,14 @@ parse_app_args(int argc, char **argv)
         trace_mem = true;
         break;
 
+      case 'S':
+        use_single_precision = true;
+        break;
+
+      case 'K':
+        use_kernel_stat = true;
+        break;
+
       case 'l':
         skip_limiters = true;
         break;        
@@ -190,6 +211,11 @@ parse_app_args(int argc, char **argv)
         assert(args.mp_recon != -1);
         break;        
 
+      case 'R':
+        is_restart = true;
+        restart_frame = atoi(optarg);
+        break;
+
       case '?':
         break;
     }
@@ -202,6 +228,10 @@ parse_app_args(int argc, char **argv)
   args.num_steps = num_steps;
   args.num_threads = num_threads;
   args.skip_limiters = skip_limiters;
+  args.is_restart = is_restart;
+  args.restart_frame = restart_frame;
+  args.use_single_precision = use_single_precision;
+  args.use_kernel_stat = use_kernel_stat;
 
   return args;
 }
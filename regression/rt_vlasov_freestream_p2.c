@@ -243,6 +243,8 @@ main(int argc, char **argv)
 
     .num_diag_moments = 3,
     .diag_moments = { "M0", "M1i", "M2" },
+
+    .use_single_precision = app_args.use_single_precision,
   };
 
   // Vlasov-Maxwell app.
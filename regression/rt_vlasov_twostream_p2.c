@@ -333,6 +333,8 @@ main(int argc, char **argv)
 
     .num_diag_moments = 3,
     .diag_moments = { "M0", "M1i", "M2" },
+
+    .use_single_precision = app_args.use_single_precision,
   };
 
   // Field.
@@ -368,6 +370,8 @@ main(int argc, char **argv)
     .field = field,
 
     .use_gpu = app_args.use_gpu,
+    .use_kernel_stat = app_args.use_kernel_stat,
+    .num_threads = app_args.num_threads,
 
     .has_low_inp = true,
     .low_inp = {
@@ -387,8 +391,27 @@ main(int argc, char **argv)
   struct gkyl_tm_trigger io_trig = { .dt = t_end / num_frames };
 
   // Initialize simulation.
-  gkyl_vlasov_app_apply_ic(app, t_curr);
-  write_data(&io_trig, app, t_curr, false);
+  if (app_args.is_restart) {
+    struct gkyl_app_restart_status status = gkyl_vlasov_app_read_from_frame(app, app_args.restart_frame);
+
+    if (status.io_status != GKYL_ARRAY_RIO_SUCCESS) {
+      gkyl_vlasov_app_cout(app, stderr, "*** Failed to read restart frame %d! (status %d)\n",
+        app_args.restart_frame, status.io_status);
+      goto freeresources;
+    }
+
+    t_curr = status.stime;
+    // next frame is written after this one
+    io_trig.curr = status.frame + 1;
+    io_trig.tcurr = io_trig.curr*io_trig.dt;
+
+    gkyl_vlasov_app_cout(app, stdout, "Restarting from frame %d", status.frame);
+    gkyl_vlasov_app_cout(app, stdout, " at time = %g\n", t_curr);
+  }
+  else {
+    gkyl_vlasov_app_apply_ic(app, t_curr);
+    write_data(&io_trig, app, t_curr, false);
+  }
 
   // Compute initial guess of maximum stable time-step.
   double dt = t_end - t_curr;
@@ -458,6 +481,7 @@ main(int argc, char **argv)
   gkyl_vlasov_app_cout(app, stdout, "Number of write calls %ld\n", stat.nio);
   gkyl_vlasov_app_cout(app, stdout, "IO time took %g secs \n", stat.io_tm);
 
+freeresources:
   // Free resources after simulation completion.
   gkyl_rect_decomp_release(decomp);
   gkyl_comm_release(comm);
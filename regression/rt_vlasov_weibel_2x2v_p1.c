@@ -365,6 +365,8 @@ main(int argc, char **argv)
 
     .num_diag_moments = 2,
     .diag_moments = { "M0", "M1i" },
+
+    .use_single_precision = app_args.use_single_precision,
   };
 
   // Field.
@@ -400,6 +402,7 @@ main(int argc, char **argv)
     .field = field,
  
     .use_gpu = app_args.use_gpu,
+    .use_kernel_stat = app_args.use_kernel_stat,
 
     .has_low_inp = true,
     .low_inp = {
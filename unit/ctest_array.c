@@ -453,6 +453,212 @@ void test_array_set_offset_range()
   gkyl_array_release(a2);
 }
 
+void test_array_rk_combine()
+{
+  struct gkyl_array *f0 = gkyl_array_new(GKYL_DOUBLE, 3, 10);
+  struct gkyl_array *f1 = gkyl_array_new(GKYL_DOUBLE, 3, 10);
+  struct gkyl_array *rhs = gkyl_array_new(GKYL_DOUBLE, 3, 10);
+
+  double *f0_d  = f0->data, *f1_d = f1->data, *rhs_d = rhs->data;
+  for (unsigned i=0; i<3*f0->size; ++i) {
+    f0_d[i] = i*1.0;
+    f1_d[i] = i*0.1;
+    rhs_d[i] = i*0.5;
+  }
+
+  // rhs = f1 + 0.1*rhs (output aliases rhs, inp0 not used)
+  gkyl_array_rk_combine(rhs, 0.0, 0, 1.0, f1, 0.1, rhs);
+  for (unsigned i=0; i<3*f0->size; ++i)
+    TEST_CHECK( gkyl_compare(rhs_d[i], i*0.1+0.1*i*0.5, 1e-14) );
+
+  // f1 = 3/4*f0 + 1/4*(f1 + 0.2*rhs) (output aliases inp1)
+  gkyl_array_rk_combine(f1, 3.0/4.0, f0, 1.0/4.0, f1, 0.2, rhs);
+  for (unsigned i=0; i<3*f0->size; ++i) {
+    double rhs_i = i*0.1+0.1*i*0.5;
+    TEST_CHECK( gkyl_compare(f1_d[i], 0.75*i*1.0 + 0.25*(i*0.1 + 0.2*rhs_i), 1e-14) );
+  }
+
+  gkyl_array_release(f0);
+  gkyl_array_release(f1);
+  gkyl_array_release(rhs);
+}
+
+void test_array_float_storage()
+{
+  struct gkyl_array *f0 = gkyl_array_new(GKYL_FLOAT, 3, 10);
+  struct gkyl_array *f1 = gkyl_array_new(GKYL_FLOAT, 3, 10);
+  struct gkyl_array *rhs = gkyl_array_new(GKYL_FLOAT, 3, 10);
+  struct gkyl_array *fd = gkyl_array_new(GKYL_DOUBLE, 3, 10);
+
+  gkyl_array_clear(f0, 0.5);
+  float *f0_f = f0->data, *f1_f = f1->data, *rhs_f = rhs->data;
+  for (unsigned i=0; i<3*f0->size; ++i)
+    TEST_CHECK( f0_f[i] == 0.5f );
+
+  // double -> float conversion rounds each element
+  double *fd_d = fd->data;
+  for (unsigned i=0; i<3*fd->size; ++i)
+    fd_d[i] = 1.0/(i+1.0);
+  gkyl_array_convert(f1, fd);
+  for (unsigned i=0; i<3*f1->size; ++i)
+    TEST_CHECK( f1_f[i] == (float) (1.0/(i+1.0)) );
+
+  for (unsigned i=0; i<3*rhs->size; ++i)
+    rhs_f[i] = i*0.5f;
+
+  // f1 = 3/4*f0 + 1/4*(f1 + 0.2*rhs) in double, rounded on store
+  gkyl_array_rk_combine(f1, 3.0/4.0, f0, 1.0/4.0, f1, 0.2, rhs);
+  for (unsigned i=0; i<3*f1->size; ++i) {
+    double f1_i = (float) (1.0/(i+1.0));
+    TEST_CHECK( f1_f[i] == (float) (0.75*0.5 + 0.25*(f1_i + 0.2*(i*0.5))) );
+  }
+
+  // float -> double conversion is exact
+  gkyl_array_convert(fd, f1);
+  for (unsigned i=0; i<3*fd->size; ++i)
+    TEST_CHECK( fd_d[i] == f1_f[i] );
+
+  gkyl_array_release(f0);
+  gkyl_array_release(f1);
+  gkyl_array_release(rhs);
+  gkyl_array_release(fd);
+}
+
+void test_array_soa_layout()
+{
+  struct gkyl_array *aos = gkyl_array_new(GKYL_DOUBLE, 3, 100);
+  struct gkyl_array *soa = gkyl_array_layout_new(GKYL_DOUBLE, 3, 100, GKYL_ARRAY_SOA);
+  struct gkyl_array *aos2 = gkyl_array_new(GKYL_DOUBLE, 3, 100);
+
+  TEST_CHECK( aos->layout == GKYL_ARRAY_AOS );
+  TEST_CHECK( soa->layout == GKYL_ARRAY_SOA );
+
+  for (long i=0; i<aos->size; ++i) {
+    double *d = gkyl_array_fetch(aos, i);
+    for (int k=0; k<3; ++k) d[k] = 10.0*i+k;
+  }
+
+  gkyl_array_convert_layout(soa, aos);
+  // components are stored in contiguous blocks
+  double *soa_d = soa->data;
+  for (long i=0; i<soa->size; ++i)
+    for (int k=0; k<3; ++k) {
+      TEST_CHECK( soa_d[k*soa->size+i] == 10.0*i+k );
+      TEST_CHECK( *(double*) gkyl_array_cfetch_comp(soa, i, k) == 10.0*i+k );
+      TEST_CHECK( *(double*) gkyl_array_cfetch_comp(aos, i, k) == 10.0*i+k );
+    }
+
+  gkyl_array_convert_layout(aos2, soa);
+  TEST_CHECK( 0 == memcmp(aos->data, aos2->data, aos->esznc*aos->size) );
+
+  // pack/unpack use the AoS element format
+  double buff[3*5];
+  gkyl_array_pack_elems(buff, soa, 7, 5);
+  TEST_CHECK( 0 == memcmp(buff, gkyl_array_cfetch(aos, 7), sizeof(buff)) );
+  for (int i=0; i<15; ++i) buff[i] = -i;
+  gkyl_array_unpack_elems(soa, 20, 5, buff);
+  for (int i=0; i<5; ++i)
+    for (int k=0; k<3; ++k)
+      TEST_CHECK( *(double*) gkyl_array_cfetch_comp(soa, 20+i, k) == -(3.0*i+k) );
+
+  struct gkyl_array *soa2 = gkyl_array_clone(soa);
+  TEST_CHECK( soa2->layout == GKYL_ARRAY_SOA );
+  TEST_CHECK( 0 == memcmp(soa->data, soa2->data, soa->esznc*soa->size) );
+
+  gkyl_array_release(aos);
+  gkyl_array_release(aos2);
+  gkyl_array_release(soa);
+  gkyl_array_release(soa2);
+}
+
+// Check that ops on SoA arrays give the same values as on AoS arrays
+static void
+check_same_values(const struct gkyl_array *soa, const struct gkyl_array *aos)
+{
+  for (long i=0; i<aos->size; ++i)
+    for (int k=0; k<aos->ncomp; ++k)
+      TEST_CHECK( *(const double*) gkyl_array_cfetch_comp(soa, i, k) ==
+        *(const double*) gkyl_array_cfetch_comp(aos, i, k) );
+}
+
+void test_array_soa_ops()
+{
+  int lower[] = {1, 1}, upper[] = {10, 20};
+  struct gkyl_range range, sub_range;
+  gkyl_range_init(&range, 2, lower, upper);
+  int sublower[] = {3, 4}, subupper[] = {7, 15};
+  gkyl_sub_range_init(&sub_range, &range, sublower, subupper);
+
+  struct gkyl_array *a1 = gkyl_array_new(GKYL_DOUBLE, 4, range.volume);
+  struct gkyl_array *a2 = gkyl_array_new(GKYL_DOUBLE, 2, range.volume);
+  struct gkyl_array *s1 = gkyl_array_layout_new(GKYL_DOUBLE, 4, range.volume, GKYL_ARRAY_SOA);
+  struct gkyl_array *s2 = gkyl_array_layout_new(GKYL_DOUBLE, 2, range.volume, GKYL_ARRAY_SOA);
+
+  double *a1_d = a1->data, *a2_d = a2->data;
+  for (long i=0; i<4*a1->size; ++i) a1_d[i] = 0.5*i;
+  for (long i=0; i<2*a2->size; ++i) a2_d[i] = 1.0+0.25*i;
+  gkyl_array_convert_layout(s1, a1);
+  gkyl_array_convert_layout(s2, a2);
+
+  gkyl_array_accumulate_range(a1, 0.5, a2, &sub_range);
+  gkyl_array_accumulate_range(s1, 0.5, s2, &sub_range);
+  check_same_values(s1, a1);
+
+  gkyl_array_accumulate_offset_range(a1, 1.5, a2, 2, &sub_range);
+  gkyl_array_accumulate_offset_range(s1, 1.5, s2, 2, &sub_range);
+  check_same_values(s1, a1);
+
+  gkyl_array_set_offset_range(a2, 2.0, a1, 1, &sub_range);
+  gkyl_array_set_offset_range(s2, 2.0, s1, 1, &sub_range);
+  check_same_values(s2, a2);
+
+  gkyl_array_scale_range(a1, 0.75, &sub_range);
+  gkyl_array_scale_range(s1, 0.75, &sub_range);
+  gkyl_array_shiftc_range(a1, 3.0, 3, &sub_range);
+  gkyl_array_shiftc_range(s1, 3.0, 3, &sub_range);
+  check_same_values(s1, a1);
+
+  gkyl_array_accumulate_offset(a1, -1.0, a2, 1);
+  gkyl_array_accumulate_offset(s1, -1.0, s2, 1);
+  gkyl_array_shiftc(a1, 2.0, 0);
+  gkyl_array_shiftc(s1, 2.0, 0);
+  check_same_values(s1, a1);
+
+  double ra[4], rs[4];
+  for (int op=GKYL_MIN; op<=GKYL_SUM; ++op) {
+    gkyl_array_reduce_range(ra, a1, op, &sub_range);
+    gkyl_array_reduce_range(rs, s1, op, &sub_range);
+    for (int k=0; k<4; ++k)
+      TEST_CHECK( gkyl_compare_double(ra[k], rs[k], 1e-14) );
+    gkyl_array_reduce(ra, a1, op);
+    gkyl_array_reduce(rs, s1, op);
+    for (int k=0; k<4; ++k)
+      TEST_CHECK( gkyl_compare_double(ra[k], rs[k], 1e-14) );
+  }
+
+  // buffers hold the same (AoS) data for both layouts
+  double *ba = gkyl_malloc(a1->esznc*sub_range.volume);
+  double *bs = gkyl_malloc(a1->esznc*sub_range.volume);
+  gkyl_array_copy_to_buffer(ba, a1, &sub_range);
+  gkyl_array_copy_to_buffer(bs, s1, &sub_range);
+  TEST_CHECK( 0 == memcmp(ba, bs, a1->esznc*sub_range.volume) );
+
+  gkyl_array_clear_range(s1, 0.0, &sub_range);
+  gkyl_array_copy_from_buffer(s1, bs, &sub_range);
+  check_same_values(s1, a1);
+
+  gkyl_array_clear_range(a1, -2.0, &sub_range);
+  gkyl_array_clear_range(s1, -2.0, &sub_range);
+  check_same_values(s1, a1);
+
+  gkyl_free(ba);
+  gkyl_free(bs);
+  gkyl_array_release(a1);
+  gkyl_array_release(a2);
+  gkyl_array_release(s1);
+  gkyl_array_release(s2);
+}
+
 void test_array_scale()
 {
   struct gkyl_array *a1 = gkyl_array_new(GKYL_DOUBLE, 1, 10);
@@ -1152,6 +1358,52 @@ void test_rio_3()
   gkyl_array_release(arr2);
 }
 
+void test_rio_soa()
+{
+  int lower[] = {1, 1}, upper[] = {12, 9};
+  struct gkyl_range range, sub_range;
+  gkyl_range_init(&range, 2, lower, upper);
+  int sublower[] = {2, 3}, subupper[] = {10, 8};
+  gkyl_sub_range_init(&sub_range, &range, sublower, subupper);
+
+  struct gkyl_array *aos = gkyl_array_new(GKYL_DOUBLE, 3, range.volume);
+  struct gkyl_array *soa = gkyl_array_layout_new(GKYL_DOUBLE, 3, range.volume, GKYL_ARRAY_SOA);
+  double *aos_d = aos->data;
+  for (long i=0; i<3*aos->size; ++i) aos_d[i] = 1.0+0.5*i;
+  gkyl_array_convert_layout(soa, aos);
+
+  // files written from either layout are identical
+  FILE *fp = 0;
+  with_file (fp, "ctest_array_soa_aos.dat", "w")
+    gkyl_sub_array_write(&sub_range, aos, fp);
+  with_file (fp, "ctest_array_soa_soa.dat", "w")
+    gkyl_sub_array_write(&sub_range, soa, fp);
+
+  size_t sz = 2*sizeof(uint64_t) + aos->esznc*sub_range.volume;
+  char *fa = gkyl_malloc(sz), *fs = gkyl_malloc(sz);
+  with_file (fp, "ctest_array_soa_aos.dat", "r")
+    TEST_CHECK( 1 == fread(fa, sz, 1, fp) );
+  with_file (fp, "ctest_array_soa_soa.dat", "r")
+    TEST_CHECK( 1 == fread(fs, sz, 1, fp) );
+  TEST_CHECK( 0 == memcmp(fa, fs, sz) );
+
+  struct gkyl_array *soa2 = gkyl_array_layout_new(GKYL_DOUBLE, 3, range.volume, GKYL_ARRAY_SOA);
+  gkyl_array_clear(soa2, 0.0);
+  gkyl_array_copy_range(soa, soa2, &sub_range);
+  with_file (fp, "ctest_array_soa_aos.dat", "r")
+    TEST_CHECK( gkyl_sub_array_read(&sub_range, soa, fp) );
+
+  for (long i=0; i<aos->size; ++i)
+    for (int k=0; k<3; ++k)
+      TEST_CHECK( *(double*) gkyl_array_cfetch_comp(soa, i, k) == aos_d[3*i+k] );
+
+  gkyl_free(fa);
+  gkyl_free(fs);
+  gkyl_array_release(aos);
+  gkyl_array_release(soa);
+  gkyl_array_release(soa2);
+}
+
 void
 test_grid_array_rio_1()
 {
@@ -1276,6 +1528,80 @@ test_grid_array_rio_2()
   gkyl_array_release(arr2);
 }
 
+void
+test_grid_array_rio_3()
+{
+  double lower[] = {1.0, 1.0}, upper[] = {2.5, 5.0};
+  int cells[] = {20, 60};
+  struct gkyl_rect_grid grid;
+  gkyl_rect_grid_init(&grid, 2, lower, upper, cells);
+
+  int nghost[] = { 1, 2 };
+  struct gkyl_range range, ext_range;
+  gkyl_create_grid_ranges(&grid, nghost, &ext_range, &range);
+
+  struct gkyl_array *arr = gkyl_array_new(GKYL_DOUBLE, 2, ext_range.volume);
+  gkyl_array_clear(arr, 0.0);
+
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, &range);
+  while (gkyl_range_iter_next(&iter)) {
+    long loc = gkyl_range_idx(&range, iter.idx);
+    double *d = gkyl_array_fetch(arr, loc);
+    for (int k=0; k<2; ++k)
+      d[k] = (10.5*iter.idx[0] + 220.5*iter.idx[1])*(k+0.5);
+  }
+
+  char mstr[] = "some meta-data";
+  struct gkyl_array_meta meta = { .meta_sz = sizeof mstr, .meta = mstr };
+  gkyl_grid_sub_array_write_with_meta(&grid, &range, &meta, arr,
+    "ctest_array_grid_array_3.gkyl");
+
+  // check meta-data
+  FILE *fp = fopen("ctest_array_grid_array_3.gkyl", "rb");
+  struct gkyl_rect_grid grid2;
+  struct gkyl_array_header_info hdr;
+  int status = gkyl_grid_sub_array_header_read_fp(&grid2, &hdr, fp);
+  fclose(fp);
+
+  TEST_CHECK( status == GKYL_ARRAY_RIO_SUCCESS );
+  TEST_CHECK( gkyl_rect_grid_cmp(&grid, &grid2) );
+  TEST_CHECK( hdr.meta_size == sizeof mstr );
+  if (hdr.meta_size == sizeof mstr)
+    TEST_CHECK( strcmp(hdr.meta, mstr) == 0 );
+  TEST_CHECK( hdr.tot_cells == range.volume );
+  gkyl_array_header_info_release(&hdr);
+
+  // read back a portion of the domain (as on a different decomposition)
+  int sub_lower[] = { 6, 17 }, sub_upper[] = { 13, 42 };
+  struct gkyl_range sub_inrange, sub_range, sub_ext_range;
+  gkyl_range_init(&sub_inrange, 2, sub_lower, sub_upper);
+  gkyl_create_ranges(&sub_inrange, nghost, &sub_ext_range, &sub_range);
+
+  struct gkyl_array *arr2 = gkyl_array_new(GKYL_DOUBLE, 2, sub_ext_range.volume);
+  gkyl_array_clear(arr2, 0.0);
+
+  status = gkyl_grid_sub_array_read(&grid2, &sub_range, arr2,
+    "ctest_array_grid_array_3.gkyl");
+  TEST_CHECK( status == GKYL_ARRAY_RIO_SUCCESS );
+
+  gkyl_range_iter_init(&iter, &sub_range);
+  while (gkyl_range_iter_next(&iter)) {
+    const double *rhs = gkyl_array_cfetch(arr, gkyl_range_idx(&range, iter.idx));
+    const double *lhs = gkyl_array_cfetch(arr2, gkyl_range_idx(&sub_range, iter.idx));
+    for (int k=0; k<2; ++k)
+      TEST_CHECK( lhs[k] == rhs[k] );
+  }
+
+  // missing file
+  status = gkyl_grid_sub_array_read(&grid2, &sub_range, arr2,
+    "ctest_array_grid_array_does_not_exist.gkyl");
+  TEST_CHECK( status == GKYL_ARRAY_RIO_FOPEN_FAILED );
+
+  gkyl_array_release(arr);
+  gkyl_array_release(arr2);
+}
+
 // Cuda specific tests
 #ifdef GKYL_HAVE_CUDA
 
@@ -2331,6 +2657,10 @@ TEST_LIST = {
   { "array_set_range", test_array_set_range },
   { "array_set_offset", test_array_set_offset },
   { "array_set_offset_range", test_array_set_offset_range },
+  { "array_rk_combine", test_array_rk_combine },
+  { "array_float_storage", test_array_float_storage },
+  { "array_soa_layout", test_array_soa_layout },
+  { "array_soa_ops", test_array_soa_ops },
   { "array_scale", test_array_scale },
   { "array_scale_by_cell", test_array_scale_by_cell },
   { "array_shiftc", test_array_shiftc },
@@ -2349,8 +2679,10 @@ TEST_LIST = {
   { "rio_1", test_rio_1 },
   { "rio_2", test_rio_2 },
   { "rio_3", test_rio_3 },
+  { "rio_soa", test_rio_soa },
   { "grid_array_rio_1", test_grid_array_rio_1 },
   { "grid_array_rio_2", test_grid_array_rio_2 },
+  { "grid_array_rio_3", test_grid_array_rio_3 },
 #ifdef GKYL_HAVE_CUDA
   { "cu_array_base", test_cu_array_base },
   { "cu_array_clear", test_cu_array_clear},
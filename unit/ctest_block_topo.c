@@ -106,10 +106,84 @@ test_mobius_domain()
   gkyl_block_topo_release(btopo);
 }
 
+void
+test_partition()
+{
+  // L-domain with 3 blocks (see test_L_domain)
+  struct gkyl_block_topo *btopo = gkyl_block_topo_new(2, 3);
+
+  btopo->conn[0] = (struct gkyl_block_connections) {
+    .connections[0] = {
+      { .bid = 0, .dir = 0, .edge = GKYL_PHYSICAL },
+      { .bid = 0, .dir = 0, .edge = GKYL_PHYSICAL }
+    },
+    .connections[1] = {
+      { .bid = 1, .dir = 1, .edge = GKYL_UPPER_POSITIVE },
+      { .bid = 0, .dir = 1, .edge = GKYL_PHYSICAL }
+    }
+  };
+  btopo->conn[1] = (struct gkyl_block_connections) {
+    .connections[0] = {
+      { .bid = 0, .dir = 0, .edge = GKYL_PHYSICAL },
+      { .bid = 2, .dir = 0, .edge = GKYL_LOWER_POSITIVE }
+    },
+    .connections[1] = {
+      { .bid = 0, .dir = 1, .edge = GKYL_PHYSICAL },
+      { .bid = 0, .dir = 1, .edge = GKYL_LOWER_POSITIVE }
+    }
+  };
+  btopo->conn[2] = (struct gkyl_block_connections) {
+    .connections[0] = {
+      { .bid = 1, .dir = 0, .edge = GKYL_UPPER_POSITIVE },
+      { .bid = 0, .dir = 0, .edge = GKYL_PHYSICAL }
+    },
+    .connections[1] = {
+      { .bid = 0, .dir = 1, .edge = GKYL_PHYSICAL },
+      { .bid = 0, .dir = 1, .edge = GKYL_PHYSICAL }
+    }
+  };
+  TEST_CHECK( 1 == gkyl_block_topo_check_consistency(btopo) );
+
+  int rank[3];
+
+  // expensive block gets a rank to itself
+  double max_load = gkyl_block_topo_partition(btopo, (double[]) { 4.0, 1.0, 1.0 }, 2, rank);
+  TEST_CHECK( max_load == 4.0 );
+  TEST_CHECK( rank[0] == 0 );
+  TEST_CHECK( rank[1] == 1 );
+  TEST_CHECK( rank[2] == 1 );
 
+  gkyl_block_topo_partition(btopo, (double[]) { 1.0, 1.0, 4.0 }, 2, rank);
+  TEST_CHECK( rank[2] == 0 );
+  TEST_CHECK( rank[0] == 1 );
+  TEST_CHECK( rank[1] == 1 );
+
+  // equal loads: block 2 goes to the rank owning its neighbor, block 1
+  gkyl_block_topo_partition(btopo, (double[]) { 1.0, 1.0, 1.0 }, 2, rank);
+  TEST_CHECK( rank[0] == 0 );
+  TEST_CHECK( rank[1] == 1 );
+  TEST_CHECK( rank[2] == 1 );
+
+  max_load = gkyl_block_topo_partition(btopo, (double[]) { 1.0, 1.0, 1.0 }, 3, rank);
+  TEST_CHECK( max_load == 1.0 );
+  for (int i=0; i<3; ++i)
+    TEST_CHECK( rank[i] == i );
+
+  // whole blocks: more ranks do not help once one block dominates
+  max_load = gkyl_block_topo_partition(btopo, (double[]) { 64.0, 1.0, 1.0 }, 3, rank);
+  TEST_CHECK( max_load == 64.0 );
+  TEST_CHECK( rank[0] == 0 );
+
+  gkyl_block_topo_partition(btopo, (double[]) { 1.0, 2.0, 3.0 }, 1, rank);
+  for (int i=0; i<3; ++i)
+    TEST_CHECK( rank[i] == 0 );
+
+  gkyl_block_topo_release(btopo);
+}
 
 TEST_LIST = {
   { "mobius_domain", test_mobius_domain },
   { "L_domain", test_L_domain },
+  { "partition", test_partition },
   { NULL, NULL },
 };
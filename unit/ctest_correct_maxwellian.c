@@ -79,7 +79,7 @@ void eval_vtsq_2v(double t, const double *xn, double* restrict fout, void *ctx)
 }
 
 void
-test_1x1v(int poly_order, bool use_gpu)
+test_1x1v_(int poly_order, bool use_gpu, bool use_cell_mask, bool use_anderson)
 {
   double lower[] = {0.1, -6.0}, upper[] = {1.0, 6.0};
   int cells[] = {2, 32};
@@ -197,6 +197,8 @@ test_1x1v(int poly_order, bool use_gpu)
     .use_gpu = false,
     .max_iter = 100,
     .eps = 1e-12,
+    .use_cell_mask = use_cell_mask,
+    .use_anderson = use_anderson,
   };
   gkyl_vlasov_lte_correct *corr_lte = gkyl_vlasov_lte_correct_inew( &inp );
 
@@ -217,6 +219,9 @@ test_1x1v(int poly_order, bool use_gpu)
 
   struct gkyl_vlasov_lte_correct_status stat_corr = gkyl_vlasov_lte_correct_all_moments(corr_lte, 
     distf, moms, &local, &confLocal);
+  TEST_CHECK( stat_corr.iter_converged == 0 );
+  TEST_CHECK( stat_corr.max_cell_iter == stat_corr.num_iter );
+  TEST_CHECK( stat_corr.num_cell_iter <= stat_corr.num_iter*confLocal.volume );
 
   // Moments computed from all-moment-corrected LTE distribution function 
   gkyl_vlasov_lte_moments_advance(lte_moms, &local, &confLocal, distf, moms);
@@ -282,11 +287,144 @@ test_1x1v(int poly_order, bool use_gpu)
   gkyl_vlasov_lte_moments_release(lte_moms);
 }
 
+// n, V_drift and T/m varying in x so that cells converge at
+// different rates
+void eval_moms_1v_var(double t, const double *xn, double* restrict fout, void *ctx)
+{
+  double x = xn[0];
+  fout[0] = 1.0 + 0.5*sin(2*M_PI*x);
+  fout[1] = 0.5*cos(2*M_PI*x);
+  fout[2] = 0.2 + 1.5*x;
+}
+
+// Iteration counts of the correction with and without the cell mask
+// and Anderson mixing, starting from the same f_lte
+void
+test_1x1v_iter_counts(int poly_order)
+{
+  double lower[] = {0.0, -6.0}, upper[] = {1.0, 6.0};
+  int cells[] = {16, 32};
+  int vdim = 1, cdim = 1;
+  int ndim = cdim+vdim;
+
+  double confLower[] = {lower[0]}, confUpper[] = {upper[0]};
+  int confCells[] = {cells[0]};
+  double velLower[] = {lower[1]}, velUpper[] = {upper[1]};
+  int velCells[] = {cells[1]};
+
+  struct gkyl_rect_grid grid, confGrid, vel_grid;
+  gkyl_rect_grid_init(&grid, ndim, lower, upper, cells);
+  gkyl_rect_grid_init(&confGrid, cdim, confLower, confUpper, confCells);
+  gkyl_rect_grid_init(&vel_grid, vdim, velLower, velUpper, velCells);
+
+  int velGhost[] = { 0 }, confGhost[] = { 1 }, ghost[] = { confGhost[0], 0 };
+  struct gkyl_range velLocal, velLocal_ext, confLocal, confLocal_ext, local, local_ext;
+  gkyl_create_grid_ranges(&vel_grid, velGhost, &velLocal_ext, &velLocal);
+  gkyl_create_grid_ranges(&confGrid, confGhost, &confLocal_ext, &confLocal);
+  gkyl_create_grid_ranges(&grid, ghost, &local_ext, &local);
+
+  struct gkyl_basis basis, confBasis, velBasis;
+  gkyl_cart_modal_serendip(&basis, ndim, poly_order);
+  gkyl_cart_modal_serendip(&confBasis, cdim, poly_order);
+  gkyl_cart_modal_serendip(&velBasis, vdim, poly_order);
+
+  // target (n, V_drift, T/m)
+  struct gkyl_array *moms = mkarr((vdim+2)*confBasis.num_basis, confLocal_ext.volume);
+  gkyl_proj_on_basis *proj_moms = gkyl_proj_on_basis_new(&confGrid, &confBasis,
+    poly_order+1, vdim+2, eval_moms_1v_var, NULL);
+  gkyl_proj_on_basis_advance(proj_moms, 0.0, &confLocal, moms);
+
+  struct gkyl_vlasov_lte_proj_on_basis_inp inp_lte = {
+    .phase_grid = &grid,
+    .vel_grid = &vel_grid, 
+    .conf_basis = &confBasis,
+    .vel_basis = &velBasis, 
+    .phase_basis = &basis,
+    .conf_range =  &confLocal,
+    .conf_range_ext = &confLocal_ext,
+    .vel_range = &velLocal,
+    .phase_range = &local,
+    .model_id = GKYL_MODEL_DEFAULT,
+    .mass = 1.0,
+    .use_gpu = false,
+  };  
+  gkyl_vlasov_lte_proj_on_basis *proj_lte = gkyl_vlasov_lte_proj_on_basis_inew(&inp_lte);
+  struct gkyl_array *distf0 = mkarr(basis.num_basis, local_ext.volume);
+  struct gkyl_array *distf = mkarr(basis.num_basis, local_ext.volume);
+  gkyl_vlasov_lte_proj_on_basis_advance(proj_lte, &local, &confLocal, moms, distf0);
+
+  // Picard, Picard with cell mask, Anderson without cell mask
+  bool use_cell_mask[] = { false, true, false };
+  bool use_anderson[] = { false, false, true };
+  struct gkyl_vlasov_lte_correct_status stat[3];
+  for (int r=0; r<3; ++r) {
+    struct gkyl_vlasov_lte_correct_inp inp = {
+      .phase_grid = &grid,
+      .vel_grid = &vel_grid, 
+      .conf_basis = &confBasis,
+      .vel_basis = &velBasis, 
+      .phase_basis = &basis,
+      .conf_range =  &confLocal,
+      .conf_range_ext = &confLocal_ext,
+      .vel_range = &velLocal,
+      .phase_range = &local,
+      .model_id = GKYL_MODEL_DEFAULT,
+      .use_gpu = false,
+      .max_iter = 100,
+      .eps = 1e-12,
+      .use_cell_mask = use_cell_mask[r],
+      .use_anderson = use_anderson[r],
+    };
+    gkyl_vlasov_lte_correct *corr_lte = gkyl_vlasov_lte_correct_inew( &inp );
+    gkyl_array_copy(distf, distf0);
+    stat[r] = gkyl_vlasov_lte_correct_all_moments(corr_lte, distf, moms, &local, &confLocal);
+    TEST_CHECK( stat[r].iter_converged == 0 );
+    TEST_MSG( "run %d: %d iterations", r, stat[r].num_iter );
+    gkyl_vlasov_lte_correct_release(corr_lte);
+  }
+
+  // converged cells drop out of the masked iterations
+  TEST_CHECK( stat[1].num_iter == stat[0].num_iter );
+  TEST_CHECK( stat[1].num_cell_iter < stat[1].num_iter*confLocal.volume );
+  TEST_MSG( "%ld cell iterations in %d iterations", stat[1].num_cell_iter, stat[1].num_iter );
+  // Anderson mixing needs no more iterations than Picard
+  TEST_CHECK( stat[2].num_iter <= stat[0].num_iter );
+  TEST_MSG( "Anderson %d, Picard %d iterations", stat[2].num_iter, stat[0].num_iter );
+
+  gkyl_array_release(moms);
+  gkyl_array_release(distf0);
+  gkyl_array_release(distf);
+  gkyl_proj_on_basis_release(proj_moms);
+  gkyl_vlasov_lte_proj_on_basis_release(proj_lte);
+}
+
+void
+test_1x1v(int poly_order, bool use_gpu)
+{
+  test_1x1v_(poly_order, use_gpu, false, false);
+}
+
 void test_1x1v_p1() { test_1x1v(1, false); }
 void test_1x1v_p2() { test_1x1v(2, false); }
+void test_1x1v_p1_cell_mask() { test_1x1v_(1, false, true, false); }
+void test_1x1v_p2_cell_mask() { test_1x1v_(2, false, true, false); }
+void test_1x1v_p1_anderson() { test_1x1v_(1, false, true, true); }
+void test_1x1v_p2_anderson() { test_1x1v_(2, false, true, true); }
+void test_1x1v_p1_anderson_only() { test_1x1v_(1, false, false, true); }
+void test_1x1v_p2_anderson_only() { test_1x1v_(2, false, false, true); }
+void test_1x1v_p1_iter_counts() { test_1x1v_iter_counts(1); }
+void test_1x1v_p2_iter_counts() { test_1x1v_iter_counts(2); }
 
 TEST_LIST = {
   { "test_1x1v_p1", test_1x1v_p1 },
   { "test_1x1v_p2", test_1x1v_p2 },
+  { "test_1x1v_p1_cell_mask", test_1x1v_p1_cell_mask },
+  { "test_1x1v_p2_cell_mask", test_1x1v_p2_cell_mask },
+  { "test_1x1v_p1_anderson", test_1x1v_p1_anderson },
+  { "test_1x1v_p2_anderson", test_1x1v_p2_anderson },
+  { "test_1x1v_p1_anderson_only", test_1x1v_p1_anderson_only },
+  { "test_1x1v_p2_anderson_only", test_1x1v_p2_anderson_only },
+  { "test_1x1v_p1_iter_counts", test_1x1v_p1_iter_counts },
+  { "test_1x1v_p2_iter_counts", test_1x1v_p2_iter_counts },
   { NULL, NULL },
 };
@@ -1728,6 +1728,84 @@ test_3d_p3_cu()
 
 #endif
 
+// fill array with smooth data: comp c in cell n is base + amp*sin(...)
+static void
+fill_div_array(struct gkyl_array *arr, double base, double amp, double phase)
+{
+  for (long n=0; n<arr->size; ++n) {
+    double *d = gkyl_array_fetch(arr, n);
+    for (int c=0; c<arr->ncomp; ++c)
+      d[c] = (c%8 == 0 ? base : 0.0) + amp*sin(0.37*n + 1.1*c + phase);
+  }
+}
+
+void
+test_div_cache()
+{
+  struct gkyl_basis basis;
+  gkyl_cart_modal_serendip(&basis, 2, 2);
+  int nb = basis.num_basis;
+
+  int lower[] = { 1, 1 }, upper[] = { 6, 5 };
+  struct gkyl_range ext_range, range;
+  gkyl_range_init(&ext_range, 2, (int[]) { 0, 0 }, (int[]) { 7, 6 });
+  gkyl_sub_range_init(&range, &ext_range, lower, upper);
+
+  struct gkyl_array *num = gkyl_array_new(GKYL_DOUBLE, 2*nb, ext_range.volume);
+  struct gkyl_array *den = gkyl_array_new(GKYL_DOUBLE, 2*nb, ext_range.volume);
+  struct gkyl_array *out = gkyl_array_new(GKYL_DOUBLE, 2*nb, ext_range.volume);
+  struct gkyl_array *out_ref = gkyl_array_new(GKYL_DOUBLE, 2*nb, ext_range.volume);
+  fill_div_array(num, 1.0, 0.3, 0.0);
+  fill_div_array(den, 2.0, 0.05, 1.0);
+  // negative corner value in one cell, so the kernel uses cell average
+  double *d = gkyl_array_fetch(den, gkyl_range_idx(&range, (int[]) { 2, 3 }));
+  d[nb+1] = 5.0;
+
+  gkyl_dg_bin_op_mem *mem = gkyl_dg_bin_op_mem_new(range.volume, nb);
+
+  for (int r=0; r<4; ++r) {
+    if (r == 2) {
+      // change denominator in a single cell
+      d = gkyl_array_fetch(den, gkyl_range_idx(&range, (int[]) { 4, 2 }));
+      d[nb] *= 1.5;
+    }
+    fill_div_array(num, 1.0, 0.3, 0.5*r);
+
+    gkyl_array_clear(out, 0.0);
+    gkyl_dg_div_op_range(mem, basis, 1, out, 0, num, 1, den, &range);
+
+    // reference uses fresh memory, so nothing is cached
+    gkyl_dg_bin_op_mem *mem_ref = gkyl_dg_bin_op_mem_new(range.volume, nb);
+    gkyl_array_clear(out_ref, 0.0);
+    gkyl_dg_div_op_range(mem_ref, basis, 1, out_ref, 0, num, 1, den, &range);
+    gkyl_dg_bin_op_mem_release(mem_ref);
+
+    for (long n=0; n<ext_range.volume; ++n) {
+      const double *o = gkyl_array_cfetch(out, n), *oref = gkyl_array_cfetch(out_ref, n);
+      for (int k=0; k<2*nb; ++k)
+        TEST_CHECK( o[k] == oref[k] );
+    }
+  }
+
+  // (num/den)*den = num away from the cell using the cell average
+  gkyl_dg_mul_op_range(basis, 0, out_ref, 1, out, 1, den, &range);
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, &range);
+  while (gkyl_range_iter_next(&iter)) {
+    if (iter.idx[0] == 2 && iter.idx[1] == 3) continue;
+    long loc = gkyl_range_idx(&range, iter.idx);
+    const double *n_d = gkyl_array_cfetch(num, loc), *o_d = gkyl_array_cfetch(out_ref, loc);
+    for (int k=0; k<nb; ++k)
+      TEST_CHECK( gkyl_compare(n_d[k], o_d[k], 1e-12) );
+  }
+
+  gkyl_dg_bin_op_mem_release(mem);
+  gkyl_array_release(num);
+  gkyl_array_release(den);
+  gkyl_array_release(out);
+  gkyl_array_release(out_ref);
+}
+
 TEST_LIST = {
   { "test_1d_p1", test_1d_p1 },
   { "test_1d_p2", test_1d_p2 },
@@ -1740,6 +1818,7 @@ TEST_LIST = {
   { "test_3d_p3", test_3d_p3 },
   { "test_4d_p1", test_4d_p1 },
   { "test_4d_p2", test_4d_p2 },
+  { "test_div_cache", test_div_cache },
 #ifdef GKYL_HAVE_CUDA
   { "test_1d_p1_cu", test_1d_p1_cu },
   { "test_1d_p2_cu", test_1d_p2_cu },
@@ -8,6 +8,12 @@
 #include <gkyl_basis.h>
 #include <gkyl_dg_vlasov.h>
 #include <gkyl_hyper_dg.h>
+#include <gkyl_mom_bcorr_lbo_vlasov.h>
+#include <gkyl_mom_calc.h>
+#include <gkyl_mom_calc_bcorr.h>
+#include <gkyl_mom_vlasov.h>
+#include <gkyl_thread_pool.h>
+#include <gkyl_vlasov_kernel_cost.h>
 
 static struct gkyl_array*
 mkarr1(bool use_gpu, long nc, long size)
@@ -561,15 +567,622 @@ test_vlasov_2x3v_p1_cu()
   test_vlasov_2x3v_p1_(true);
 }
 
+void
+test_vlasov_1x2v_p2_threads()
+{
+  // compare threaded update with serial update: both must agree exactly
+  int cdim = 1, vdim = 2;
+  int pdim = cdim+vdim;
+
+  int cells[] = {24, 12, 12};
+  int ghost[] = {1, 0, 0};
+  double lower[] = {0., -1., -1.};
+  double upper[] = {1., 1., 1.};
+
+  struct gkyl_rect_grid confGrid;
+  struct gkyl_range confRange, confRange_ext;
+  gkyl_rect_grid_init(&confGrid, cdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&confGrid, ghost, &confRange_ext, &confRange);
+
+  struct gkyl_rect_grid phaseGrid;
+  struct gkyl_range phaseRange, phaseRange_ext;
+  gkyl_rect_grid_init(&phaseGrid, pdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&phaseGrid, ghost, &phaseRange_ext, &phaseRange);
+
+  int poly_order = 2;
+  struct gkyl_basis basis, confBasis;
+  gkyl_cart_modal_serendip(&basis, pdim, poly_order);
+  gkyl_cart_modal_serendip(&confBasis, cdim, poly_order);
+
+  struct gkyl_dg_eqn *eqn = gkyl_dg_vlasov_new(&confBasis, &basis, &confRange, &phaseRange,
+    GKYL_MODEL_DEFAULT, GKYL_FIELD_E_B, false);
+
+  int up_dirs[GKYL_MAX_DIM] = {0, 1, 2};
+  int zero_flux_flags[GKYL_MAX_DIM] = {0, 1, 1};
+  gkyl_hyper_dg *slvr = gkyl_hyper_dg_new(&phaseGrid, &basis, eqn, pdim, up_dirs, zero_flux_flags, 1, false);
+
+  struct gkyl_array *fin = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *qmem = mkarr1(false, 8*confBasis.num_basis, confRange_ext.volume);
+  struct gkyl_array *rhs1 = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *rhs2 = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *cfl1 = mkarr1(false, 1, phaseRange_ext.volume);
+  struct gkyl_array *cfl2 = mkarr1(false, 1, phaseRange_ext.volume);
+
+  int nf = phaseRange_ext.volume*basis.num_basis;
+  double *fin_d = fin->data;
+  for (int i=0; i<nf; i++)
+    fin_d[i] = (double)(2*i+11 % nf) / nf  * ((i%2 == 0) ? 1 : -1);
+  int nem = confRange_ext.volume*confBasis.num_basis;
+  double *qmem_d = qmem->data;
+  for (int i=0; i<nem; i++)
+    qmem_d[i] = (double)(-i+27 % nem) / nem  * ((i%2 == 0) ? 1 : -1);
+
+  gkyl_vlasov_set_auxfields(eqn,
+    (struct gkyl_dg_vlasov_auxfields) { .field = qmem, .cot_vec = 0, .alpha_geo = 0 });
+
+  gkyl_array_clear(rhs1, 0.0); gkyl_array_clear(cfl1, 0.0);
+  gkyl_hyper_dg_advance(slvr, &phaseRange, fin, cfl1, rhs1);
+
+  struct gkyl_job_pool *job_pool = gkyl_thread_pool_new(4);
+  gkyl_hyper_dg_set_job_pool(slvr, job_pool);
+  gkyl_array_clear(rhs2, 0.0); gkyl_array_clear(cfl2, 0.0);
+  gkyl_hyper_dg_advance(slvr, &phaseRange, fin, cfl2, rhs2);
+
+  const double *r1 = rhs1->data, *r2 = rhs2->data;
+  for (int i=0; i<nf; ++i)
+    TEST_CHECK( r1[i] == r2[i] );
+  const double *c1 = cfl1->data, *c2 = cfl2->data;
+  for (long i=0; i<phaseRange_ext.volume; ++i)
+    TEST_CHECK( c1[i] == c2[i] );
+
+  // interior and boundary updates together must match full update
+  gkyl_array_clear(rhs2, 0.0); gkyl_array_clear(cfl2, 0.0);
+  gkyl_hyper_dg_advance_interior(slvr, &phaseRange, fin, cfl2, rhs2);
+  gkyl_hyper_dg_advance_boundary(slvr, &phaseRange, fin, cfl2, rhs2);
+
+  for (int i=0; i<nf; ++i)
+    TEST_CHECK( r1[i] == r2[i] );
+  for (long i=0; i<phaseRange_ext.volume; ++i)
+    TEST_CHECK( c1[i] == c2[i] );
+
+  gkyl_job_pool_release(job_pool);
+  gkyl_array_release(fin);
+  gkyl_array_release(qmem);
+  gkyl_array_release(rhs1);
+  gkyl_array_release(rhs2);
+  gkyl_array_release(cfl1);
+  gkyl_array_release(cfl2);
+  gkyl_hyper_dg_release(slvr);
+  gkyl_dg_eqn_release(eqn);
+}
+
+void
+test_vlasov_1x2v_p2_float()
+{
+  // single-precision storage of f and rhs must agree with the
+  // double-precision update to float round-off
+  int cdim = 1, vdim = 2;
+  int pdim = cdim+vdim;
+
+  int cells[] = {8, 6, 6};
+  int ghost[] = {1, 0, 0};
+  double lower[] = {0., -1., -1.};
+  double upper[] = {1., 1., 1.};
+
+  struct gkyl_rect_grid confGrid;
+  struct gkyl_range confRange, confRange_ext;
+  gkyl_rect_grid_init(&confGrid, cdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&confGrid, ghost, &confRange_ext, &confRange);
+
+  struct gkyl_rect_grid phaseGrid;
+  struct gkyl_range phaseRange, phaseRange_ext;
+  gkyl_rect_grid_init(&phaseGrid, pdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&phaseGrid, ghost, &phaseRange_ext, &phaseRange);
+
+  int poly_order = 2;
+  struct gkyl_basis basis, confBasis;
+  gkyl_cart_modal_serendip(&basis, pdim, poly_order);
+  gkyl_cart_modal_serendip(&confBasis, cdim, poly_order);
+
+  struct gkyl_dg_eqn *eqn = gkyl_dg_vlasov_new(&confBasis, &basis, &confRange, &phaseRange,
+    GKYL_MODEL_DEFAULT, GKYL_FIELD_E_B, false);
+
+  int up_dirs[GKYL_MAX_DIM] = {0, 1, 2};
+  int zero_flux_flags[GKYL_MAX_DIM] = {0, 1, 1};
+  gkyl_hyper_dg *slvr = gkyl_hyper_dg_new(&phaseGrid, &basis, eqn, pdim, up_dirs, zero_flux_flags, 1, false);
+
+  struct gkyl_array *fin = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *qmem = mkarr1(false, 8*confBasis.num_basis, confRange_ext.volume);
+  struct gkyl_array *rhs = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *cfl1 = mkarr1(false, 1, phaseRange_ext.volume);
+  struct gkyl_array *cfl2 = mkarr1(false, 1, phaseRange_ext.volume);
+  struct gkyl_array *fin_f = gkyl_array_new(GKYL_FLOAT, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *rhs_f = gkyl_array_new(GKYL_FLOAT, basis.num_basis, phaseRange_ext.volume);
+
+  int nf = phaseRange_ext.volume*basis.num_basis;
+  double *fin_d = fin->data;
+  for (int i=0; i<nf; i++)
+    fin_d[i] = (double)(2*i+11 % nf) / nf  * ((i%2 == 0) ? 1 : -1);
+  int nem = confRange_ext.volume*confBasis.num_basis;
+  double *qmem_d = qmem->data;
+  for (int i=0; i<nem; i++)
+    qmem_d[i] = (double)(-i+27 % nem) / nem  * ((i%2 == 0) ? 1 : -1);
+
+  // use the same (float-representable) input for both updates
+  gkyl_array_convert(fin_f, fin);
+  gkyl_array_convert(fin, fin_f);
+
+  gkyl_vlasov_set_auxfields(eqn,
+    (struct gkyl_dg_vlasov_auxfields) { .field = qmem, .cot_vec = 0, .alpha_geo = 0 });
+
+  gkyl_array_clear(rhs, 0.0); gkyl_array_clear(cfl1, 0.0);
+  gkyl_hyper_dg_advance(slvr, &phaseRange, fin, cfl1, rhs);
+
+  gkyl_vlasov_set_storage_type(eqn, GKYL_FLOAT);
+  gkyl_array_clear(rhs_f, 0.0); gkyl_array_clear(cfl2, 0.0);
+  gkyl_hyper_dg_advance(slvr, &phaseRange, fin_f, cfl2, rhs_f);
+
+  const double *r1 = rhs->data;
+  const float *r2 = rhs_f->data;
+  double rmax = 0.0;
+  for (int i=0; i<nf; ++i)
+    rmax = fmax(rmax, fabs(r1[i]));
+  for (int i=0; i<nf; ++i)
+    TEST_CHECK( fabs(r1[i]-r2[i]) < 1e-6*rmax );
+
+  // CFL frequencies do not depend on f
+  const double *c1 = cfl1->data, *c2 = cfl2->data;
+  for (long i=0; i<phaseRange_ext.volume; ++i)
+    TEST_CHECK( c1[i] == c2[i] );
+
+  // the batched volume term updates float storage cell by cell
+  int batch_size;
+  vol_batch_termf_t vol_batch_term = gkyl_vlasov_vol_batch_term(eqn, &batch_size);
+  gkyl_hyper_dg_set_vol_batch(slvr, vol_batch_term, batch_size);
+  struct gkyl_array *rhs_f2 = gkyl_array_new(GKYL_FLOAT, basis.num_basis, phaseRange_ext.volume);
+  gkyl_array_clear(rhs_f2, 0.0); gkyl_array_clear(cfl2, 0.0);
+  gkyl_hyper_dg_advance(slvr, &phaseRange, fin_f, cfl2, rhs_f2);
+
+  const float *r3 = rhs_f2->data;
+  for (int i=0; i<nf; ++i)
+    TEST_CHECK( r2[i] == r3[i] );
+  for (long i=0; i<phaseRange_ext.volume; ++i)
+    TEST_CHECK( c1[i] == c2[i] );
+
+  gkyl_array_release(rhs_f2);
+  gkyl_array_release(fin);
+  gkyl_array_release(qmem);
+  gkyl_array_release(rhs);
+  gkyl_array_release(cfl1);
+  gkyl_array_release(cfl2);
+  gkyl_array_release(fin_f);
+  gkyl_array_release(rhs_f);
+  gkyl_hyper_dg_release(slvr);
+  gkyl_dg_eqn_release(eqn);
+}
+
+void
+test_vlasov_1x2v_p2_kernel_stat()
+{
+  // kernel counters must see every kernel call and not change results
+  int cdim = 1, vdim = 2;
+  int pdim = cdim+vdim;
+
+  int cells[] = {24, 12, 12};
+  int ghost[] = {1, 0, 0};
+  double lower[] = {0., -1., -1.};
+  double upper[] = {1., 1., 1.};
+
+  struct gkyl_rect_grid confGrid;
+  struct gkyl_range confRange, confRange_ext;
+  gkyl_rect_grid_init(&confGrid, cdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&confGrid, ghost, &confRange_ext, &confRange);
+
+  struct gkyl_rect_grid phaseGrid;
+  struct gkyl_range phaseRange, phaseRange_ext;
+  gkyl_rect_grid_init(&phaseGrid, pdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&phaseGrid, ghost, &phaseRange_ext, &phaseRange);
+
+  int poly_order = 2;
+  struct gkyl_basis basis, confBasis;
+  gkyl_cart_modal_serendip(&basis, pdim, poly_order);
+  gkyl_cart_modal_serendip(&confBasis, cdim, poly_order);
+
+  struct gkyl_dg_eqn *eqn = gkyl_dg_vlasov_new(&confBasis, &basis, &confRange, &phaseRange,
+    GKYL_MODEL_DEFAULT, GKYL_FIELD_E_B, false);
+
+  int up_dirs[GKYL_MAX_DIM] = {0, 1, 2};
+  int zero_flux_flags[GKYL_MAX_DIM] = {0, 1, 1};
+  gkyl_hyper_dg *slvr = gkyl_hyper_dg_new(&phaseGrid, &basis, eqn, pdim, up_dirs, zero_flux_flags, 1, false);
+
+  struct gkyl_array *fin = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *qmem = mkarr1(false, 8*confBasis.num_basis, confRange_ext.volume);
+  struct gkyl_array *rhs1 = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *rhs2 = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *cfl1 = mkarr1(false, 1, phaseRange_ext.volume);
+  struct gkyl_array *cfl2 = mkarr1(false, 1, phaseRange_ext.volume);
+
+  int nf = phaseRange_ext.volume*basis.num_basis;
+  double *fin_d = fin->data;
+  for (int i=0; i<nf; i++)
+    fin_d[i] = (double)(2*i+11 % nf) / nf  * ((i%2 == 0) ? 1 : -1);
+  int nem = confRange_ext.volume*confBasis.num_basis;
+  double *qmem_d = qmem->data;
+  for (int i=0; i<nem; i++)
+    qmem_d[i] = (double)(-i+27 % nem) / nem  * ((i%2 == 0) ? 1 : -1);
+
+  gkyl_vlasov_set_auxfields(eqn,
+    (struct gkyl_dg_vlasov_auxfields) { .field = qmem, .cot_vec = 0, .alpha_geo = 0 });
+
+  struct gkyl_hyper_dg_kernel_stat kst = gkyl_hyper_dg_get_kernel_stat(slvr);
+  TEST_CHECK( kst.nvol == 0 );
+
+  gkyl_array_clear(rhs1, 0.0); gkyl_array_clear(cfl1, 0.0);
+  gkyl_hyper_dg_advance(slvr, &phaseRange, fin, cfl1, rhs1);
+  const double *r1 = rhs1->data, *r2 = rhs2->data;
+  const double *c1 = cfl1->data, *c2 = cfl2->data;
+
+  struct gkyl_job_pool *job_pool = gkyl_thread_pool_new(4);
+  gkyl_hyper_dg_set_kernel_stat(slvr, true);
+  for (int th=0; th<2; ++th) {
+    gkyl_hyper_dg_set_job_pool(slvr, th ? job_pool : 0);
+
+    gkyl_array_clear(rhs2, 0.0); gkyl_array_clear(cfl2, 0.0);
+    gkyl_hyper_dg_advance(slvr, &phaseRange, fin, cfl2, rhs2);
+
+    for (int i=0; i<nf; ++i)
+      TEST_CHECK( r1[i] == r2[i] );
+    for (long i=0; i<phaseRange_ext.volume; ++i)
+      TEST_CHECK( c1[i] == c2[i] );
+  }
+
+  // counts accumulate over the serial and the threaded update
+  long nvx = cells[1], ny = cells[2];
+  kst = gkyl_hyper_dg_get_kernel_stat(slvr);
+  TEST_CHECK( kst.nvol == 2*phaseRange.volume );
+  TEST_CHECK( kst.nsurf[0] == 2*phaseRange.volume );
+  TEST_CHECK( kst.nboundary_surf[0] == 0 );
+  TEST_CHECK( kst.nsurf[1] == 2*cells[0]*(nvx-2)*ny );
+  TEST_CHECK( kst.nboundary_surf[1] == 2*cells[0]*2*ny );
+  TEST_CHECK( kst.nsurf[2] == 2*cells[0]*nvx*(ny-2) );
+  TEST_CHECK( kst.nboundary_surf[2] == 2*cells[0]*nvx*2 );
+  TEST_CHECK( kst.vol_tm > 0 && kst.surf_tm[1] > 0 && kst.boundary_surf_tm[2] > 0 );
+
+  // turning counters on again resets them
+  gkyl_hyper_dg_set_kernel_stat(slvr, true);
+  kst = gkyl_hyper_dg_get_kernel_stat(slvr);
+  TEST_CHECK( kst.nvol == 0 && kst.vol_tm == 0 );
+
+  // kernel names and their static costs
+  char name[128];
+  gkyl_vlasov_kernel_name(eqn, GKYL_VLASOV_TERM_VOL, 0, name, sizeof name);
+  TEST_CHECK( strcmp(name, "vlasov_vol_1x2v_ser_p2") == 0 );
+  gkyl_vlasov_kernel_name(eqn, GKYL_VLASOV_TERM_SURF, 0, name, sizeof name);
+  TEST_CHECK( strcmp(name, "vlasov_surfx_1x2v_ser_p2") == 0 );
+  gkyl_vlasov_kernel_name(eqn, GKYL_VLASOV_TERM_SURF, 2, name, sizeof name);
+  TEST_CHECK( strcmp(name, "vlasov_surfvy_1x2v_ser_p2") == 0 );
+  gkyl_vlasov_kernel_name(eqn, GKYL_VLASOV_TERM_BOUNDARY_SURF, 1, name, sizeof name);
+  TEST_CHECK( strcmp(name, "vlasov_boundary_surfvx_1x2v_ser_p2") == 0 );
+
+  const struct gkyl_kern_cost *cost = gkyl_vlasov_kernel_cost(name);
+  TEST_CHECK( cost != 0 );
+  if (cost) {
+    TEST_CHECK( cost->flops > 0 );
+    // reads at least f in the skin and edge cells, and writes out
+    TEST_CHECK( cost->bytes >= 3*basis.num_basis*sizeof(double) );
+  }
+  TEST_CHECK( gkyl_vlasov_kernel_cost("vlasov_no_such_kernel") == 0 );
+
+  gkyl_job_pool_release(job_pool);
+  gkyl_array_release(fin);
+  gkyl_array_release(qmem);
+  gkyl_array_release(rhs1);
+  gkyl_array_release(rhs2);
+  gkyl_array_release(cfl1);
+  gkyl_array_release(cfl2);
+  gkyl_hyper_dg_release(slvr);
+  gkyl_dg_eqn_release(eqn);
+}
+
+void
+test_vlasov_3x3v_p1_gen_geo_kernel_name()
+{
+  // names of general-geometry kernels differ from the Cartesian ones
+  int cdim = 3, vdim = 3;
+  int pdim = cdim+vdim;
+
+  int cells[] = {2, 2, 2, 2, 2, 2};
+  int ghost[] = {1, 1, 1, 0, 0, 0};
+  double lower[] = {0., 0., 0., -1., -1., -1.};
+  double upper[] = {1., 1., 1., 1., 1., 1.};
+
+  struct gkyl_rect_grid confGrid, phaseGrid;
+  struct gkyl_range confRange, confRange_ext, phaseRange, phaseRange_ext;
+  gkyl_rect_grid_init(&confGrid, cdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&confGrid, ghost, &confRange_ext, &confRange);
+  gkyl_rect_grid_init(&phaseGrid, pdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&phaseGrid, ghost, &phaseRange_ext, &phaseRange);
+
+  struct gkyl_basis basis, confBasis;
+  gkyl_cart_modal_serendip(&basis, pdim, 1);
+  gkyl_cart_modal_serendip(&confBasis, cdim, 1);
+
+  struct gkyl_dg_eqn *eqn = gkyl_dg_vlasov_new(&confBasis, &basis, &confRange, &phaseRange,
+    GKYL_MODEL_GEN_GEO, GKYL_FIELD_NULL, false);
+
+  char name[128];
+  gkyl_vlasov_kernel_name(eqn, GKYL_VLASOV_TERM_VOL, 0, name, sizeof name);
+  TEST_CHECK( strcmp(name, "vlasov_stream_gen_geo_vol_3x3v_ser_p1") == 0 );
+  gkyl_vlasov_kernel_name(eqn, GKYL_VLASOV_TERM_SURF, 1, name, sizeof name);
+  TEST_CHECK( strcmp(name, "vlasov_gen_geo_surfy_3x3v_ser_p1") == 0 );
+  gkyl_vlasov_kernel_name(eqn, GKYL_VLASOV_TERM_BOUNDARY_SURF, 0, name, sizeof name);
+  TEST_CHECK( strcmp(name, "") == 0 );
+
+  gkyl_dg_eqn_release(eqn);
+}
+
 #ifndef GKYL_HAVE_CUDA
 int hyper_dg_kernel_test(const gkyl_hyper_dg *slvr) {
   return 0;
 }
 #endif
 
+void
+test_vlasov_1x2v_p2_vol_batch_(enum gkyl_field_id field_id)
+{
+  // batched volume term must match the per-cell volume term to
+  // round-off, with and without threads
+  int cdim = 1, vdim = 2;
+  int pdim = cdim+vdim;
+
+  // 12 cells in vy: one full batch and a partial one
+  int cells[] = {16, 10, 12};
+  int ghost[] = {1, 0, 0};
+  double lower[] = {0., -1., -1.};
+  double upper[] = {1., 1., 1.};
+
+  struct gkyl_rect_grid confGrid;
+  struct gkyl_range confRange, confRange_ext;
+  gkyl_rect_grid_init(&confGrid, cdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&confGrid, ghost, &confRange_ext, &confRange);
+
+  struct gkyl_rect_grid phaseGrid;
+  struct gkyl_range phaseRange, phaseRange_ext;
+  gkyl_rect_grid_init(&phaseGrid, pdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&phaseGrid, ghost, &phaseRange_ext, &phaseRange);
+
+  int poly_order = 2;
+  struct gkyl_basis basis, confBasis;
+  gkyl_cart_modal_serendip(&basis, pdim, poly_order);
+  gkyl_cart_modal_serendip(&confBasis, cdim, poly_order);
+
+  struct gkyl_dg_eqn *eqn = gkyl_dg_vlasov_new(&confBasis, &basis, &confRange, &phaseRange,
+    GKYL_MODEL_DEFAULT, field_id, false);
+
+  int batch_size;
+  vol_batch_termf_t vol_batch_term = gkyl_vlasov_vol_batch_term(eqn, &batch_size);
+  TEST_CHECK( vol_batch_term != 0 );
+  TEST_CHECK( batch_size > 1 );
+
+  // no velocity-space update without fields
+  int num_up_dirs = field_id == GKYL_FIELD_NULL ? cdim : pdim;
+  int up_dirs[GKYL_MAX_DIM] = {0, 1, 2};
+  int zero_flux_flags[GKYL_MAX_DIM] = {0, 1, 1};
+  gkyl_hyper_dg *slvr = gkyl_hyper_dg_new(&phaseGrid, &basis, eqn, num_up_dirs, up_dirs, zero_flux_flags, 1, false);
+
+  struct gkyl_array *fin = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *qmem = mkarr1(false, 8*confBasis.num_basis, confRange_ext.volume);
+  struct gkyl_array *rhs1 = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *rhs2 = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *cfl1 = mkarr1(false, 1, phaseRange_ext.volume);
+  struct gkyl_array *cfl2 = mkarr1(false, 1, phaseRange_ext.volume);
+
+  int nf = phaseRange_ext.volume*basis.num_basis;
+  double *fin_d = fin->data;
+  for (int i=0; i<nf; i++)
+    fin_d[i] = (double)(2*i+11 % nf) / nf  * ((i%2 == 0) ? 1 : -1);
+  int nem = confRange_ext.volume*confBasis.num_basis;
+  double *qmem_d = qmem->data;
+  for (int i=0; i<nem; i++)
+    qmem_d[i] = (double)(-i+27 % nem) / nem  * ((i%2 == 0) ? 1 : -1);
+
+  gkyl_vlasov_set_auxfields(eqn,
+    (struct gkyl_dg_vlasov_auxfields) { .field = qmem, .cot_vec = 0, .alpha_geo = 0 });
+
+  gkyl_array_clear(rhs1, 0.0); gkyl_array_clear(cfl1, 0.0);
+  gkyl_hyper_dg_advance(slvr, &phaseRange, fin, cfl1, rhs1);
+  const double *r1 = rhs1->data, *r2 = rhs2->data;
+  const double *c1 = cfl1->data, *c2 = cfl2->data;
+
+  gkyl_hyper_dg_set_vol_batch(slvr, vol_batch_term, batch_size);
+
+  struct gkyl_job_pool *job_pool = gkyl_thread_pool_new(4);
+  for (int t=0; t<2; ++t) {
+    gkyl_hyper_dg_set_job_pool(slvr, t ? job_pool : 0);
+
+    gkyl_array_clear(rhs2, 0.0); gkyl_array_clear(cfl2, 0.0);
+    gkyl_hyper_dg_advance(slvr, &phaseRange, fin, cfl2, rhs2);
+
+    for (int i=0; i<nf; ++i)
+      TEST_CHECK( fabs(r1[i]-r2[i]) < 1e-12*(1.0+fabs(r1[i])) );
+    for (long i=0; i<phaseRange_ext.volume; ++i)
+      TEST_CHECK( gkyl_compare_double(c1[i], c2[i], 1e-12) );
+  }
+
+  gkyl_job_pool_release(job_pool);
+  gkyl_array_release(fin);
+  gkyl_array_release(qmem);
+  gkyl_array_release(rhs1);
+  gkyl_array_release(rhs2);
+  gkyl_array_release(cfl1);
+  gkyl_array_release(cfl2);
+  gkyl_hyper_dg_release(slvr);
+  gkyl_dg_eqn_release(eqn);
+}
+
+void
+test_vlasov_1x2v_p2_vol_batch()
+{
+  test_vlasov_1x2v_p2_vol_batch_(GKYL_FIELD_E_B);
+}
+
+void
+test_vlasov_1x2v_p2_stream_vol_batch()
+{
+  test_vlasov_1x2v_p2_vol_batch_(GKYL_FIELD_NULL);
+}
+
+void
+test_vlasov_1x2v_p2_fused_moms()
+{
+  // moments fused with the update must match gkyl_mom_calc and
+  // gkyl_mom_calc_bcorr, and must not change the update
+  int cdim = 1, vdim = 2;
+  int pdim = cdim+vdim;
+
+  int cells[] = {16, 10, 12};
+  int ghost[] = {1, 0, 0};
+  double lower[] = {0., -1., -1.};
+  double upper[] = {1., 1., 1.};
+  double v_bounds[] = {-1., -1., 1., 1.};
+
+  struct gkyl_rect_grid confGrid;
+  struct gkyl_range confRange, confRange_ext;
+  gkyl_rect_grid_init(&confGrid, cdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&confGrid, ghost, &confRange_ext, &confRange);
+
+  struct gkyl_rect_grid phaseGrid;
+  struct gkyl_range phaseRange, phaseRange_ext;
+  gkyl_rect_grid_init(&phaseGrid, pdim, lower, upper, cells);
+  gkyl_create_grid_ranges(&phaseGrid, ghost, &phaseRange_ext, &phaseRange);
+
+  int poly_order = 2;
+  struct gkyl_basis basis, confBasis;
+  gkyl_cart_modal_serendip(&basis, pdim, poly_order);
+  gkyl_cart_modal_serendip(&confBasis, cdim, poly_order);
+
+  struct gkyl_dg_eqn *eqn = gkyl_dg_vlasov_new(&confBasis, &basis, &confRange, &phaseRange,
+    GKYL_MODEL_DEFAULT, GKYL_FIELD_E_B, false);
+
+  int up_dirs[GKYL_MAX_DIM] = {0, 1, 2};
+  int zero_flux_flags[GKYL_MAX_DIM] = {0, 1, 1};
+  gkyl_hyper_dg *slvr = gkyl_hyper_dg_new(&phaseGrid, &basis, eqn, pdim, up_dirs, zero_flux_flags, 1, false);
+
+  struct gkyl_array *fin = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *qmem = mkarr1(false, 8*confBasis.num_basis, confRange_ext.volume);
+  struct gkyl_array *rhs1 = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *rhs2 = mkarr1(false, basis.num_basis, phaseRange_ext.volume);
+  struct gkyl_array *cfl = mkarr1(false, 1, phaseRange_ext.volume);
+
+  int nf = phaseRange_ext.volume*basis.num_basis;
+  double *fin_d = fin->data;
+  for (int i=0; i<nf; i++)
+    fin_d[i] = (double)(2*i+11 % nf) / nf  * ((i%2 == 0) ? 1 : -1);
+  int nem = confRange_ext.volume*confBasis.num_basis;
+  double *qmem_d = qmem->data;
+  for (int i=0; i<nem; i++)
+    qmem_d[i] = (double)(-i+27 % nem) / nem  * ((i%2 == 0) ? 1 : -1);
+
+  gkyl_vlasov_set_auxfields(eqn,
+    (struct gkyl_dg_vlasov_auxfields) { .field = qmem, .cot_vec = 0, .alpha_geo = 0 });
+
+  struct gkyl_mom_type *momt = gkyl_mom_vlasov_new(&confBasis, &basis, "FiveMoments", false);
+  struct gkyl_mom_type *bcorrt = gkyl_mom_bcorr_lbo_vlasov_new(&confBasis, &basis, v_bounds, false);
+  int nm = gkyl_mom_type_num_mom(momt)*confBasis.num_basis;
+  int nbc = (vdim+1)*confBasis.num_basis;
+
+  // reference moments and update
+  struct gkyl_array *m1 = mkarr1(false, nm, confRange_ext.volume);
+  struct gkyl_array *bc1 = mkarr1(false, nbc, confRange_ext.volume);
+  gkyl_mom_calc *mcalc = gkyl_mom_calc_new(&phaseGrid, momt, false);
+  gkyl_mom_calc_advance(mcalc, &phaseRange, &confRange, fin, m1);
+  gkyl_mom_calc_bcorr *bcalc = gkyl_mom_calc_bcorr_lbo_vlasov_new(&phaseGrid,
+    &confBasis, &basis, v_bounds, false);
+  gkyl_mom_calc_bcorr_advance(bcalc, &phaseRange, &confRange, fin, bc1);
+
+  gkyl_array_clear(rhs1, 0.0); gkyl_array_clear(cfl, 0.0);
+  gkyl_hyper_dg_advance(slvr, &phaseRange, fin, cfl, rhs1);
+
+  struct gkyl_array *m2 = mkarr1(false, nm, confRange_ext.volume);
+  struct gkyl_array *bc2 = mkarr1(false, nbc, confRange_ext.volume);
+  struct gkyl_hyper_dg_fused_moms fmom = {
+    .cdim = cdim,
+    .conf_range = confRange,
+    .num_mom = 2,
+    .momt = { momt, bcorrt },
+    .mout = { m2, bc2 },
+    .vel_edge = { false, true },
+  };
+  gkyl_hyper_dg_set_fused_moms(slvr, &fmom);
+
+  struct gkyl_job_pool *job_pool = gkyl_thread_pool_new(4);
+  for (int t=0; t<3; ++t) {
+    // serial, threaded, interior/boundary split
+    gkyl_hyper_dg_set_job_pool(slvr, t ? job_pool : 0);
+
+    gkyl_array_clear(m2, 0.0); gkyl_array_clear(bc2, 0.0);
+    gkyl_array_clear(rhs2, 0.0); gkyl_array_clear(cfl, 0.0);
+    if (t == 2) {
+      gkyl_hyper_dg_advance_interior(slvr, &phaseRange, fin, cfl, rhs2);
+      gkyl_hyper_dg_advance_boundary(slvr, &phaseRange, fin, cfl, rhs2);
+    }
+    else {
+      gkyl_hyper_dg_advance(slvr, &phaseRange, fin, cfl, rhs2);
+    }
+
+    const double *r1 = rhs1->data, *r2 = rhs2->data;
+    for (int i=0; i<nf; ++i)
+      TEST_CHECK( r1[i] == r2[i] );
+
+    struct gkyl_range_iter iter;
+    gkyl_range_iter_init(&iter, &confRange);
+    while (gkyl_range_iter_next(&iter)) {
+      long loc = gkyl_range_idx(&confRange, iter.idx);
+      const double *m1_d = gkyl_array_cfetch(m1, loc), *m2_d = gkyl_array_cfetch(m2, loc);
+      for (int k=0; k<nm; ++k)
+        TEST_CHECK( fabs(m1_d[k]-m2_d[k]) < 1e-12*(1.0+fabs(m1_d[k])) );
+      const double *bc1_d = gkyl_array_cfetch(bc1, loc), *bc2_d = gkyl_array_cfetch(bc2, loc);
+      for (int k=0; k<nbc; ++k)
+        TEST_CHECK( fabs(bc1_d[k]-bc2_d[k]) < 1e-12*(1.0+fabs(bc1_d[k])) );
+    }
+  }
+
+  // moments are no longer computed once turned off
+  gkyl_hyper_dg_set_fused_moms(slvr, 0);
+  gkyl_array_clear(m2, 0.0);
+  gkyl_hyper_dg_advance(slvr, &phaseRange, fin, cfl, rhs2);
+  double m2_max[1];
+  gkyl_array_reduce_range(m2_max, m2, GKYL_MAX, &confRange);
+  TEST_CHECK( m2_max[0] == 0.0 );
+
+  gkyl_job_pool_release(job_pool);
+  gkyl_mom_calc_release(mcalc);
+  gkyl_mom_calc_bcorr_release(bcalc);
+  gkyl_mom_type_release(momt);
+  gkyl_mom_type_release(bcorrt);
+  gkyl_array_release(m1);
+  gkyl_array_release(m2);
+  gkyl_array_release(bc1);
+  gkyl_array_release(bc2);
+  gkyl_array_release(fin);
+  gkyl_array_release(qmem);
+  gkyl_array_release(rhs1);
+  gkyl_array_release(rhs2);
+  gkyl_array_release(cfl);
+  gkyl_hyper_dg_release(slvr);
+  gkyl_dg_eqn_release(eqn);
+}
+
 TEST_LIST = {
   { "test_vlasov_1x2v_p2", test_vlasov_1x2v_p2 },
   { "test_vlasov_2x3v_p1", test_vlasov_2x3v_p1 },
+  { "test_vlasov_1x2v_p2_threads", test_vlasov_1x2v_p2_threads },
+  { "test_vlasov_1x2v_p2_float", test_vlasov_1x2v_p2_float },
+  { "test_vlasov_1x2v_p2_kernel_stat", test_vlasov_1x2v_p2_kernel_stat },
+  { "test_vlasov_3x3v_p1_gen_geo_kernel_name", test_vlasov_3x3v_p1_gen_geo_kernel_name },
+  { "test_vlasov_1x2v_p2_vol_batch", test_vlasov_1x2v_p2_vol_batch },
+  { "test_vlasov_1x2v_p2_stream_vol_batch", test_vlasov_1x2v_p2_stream_vol_batch },
+  { "test_vlasov_1x2v_p2_fused_moms", test_vlasov_1x2v_p2_fused_moms },
 #ifdef GKYL_HAVE_CUDA
   { "test_vlasov_1x2v_p2_cu", test_vlasov_1x2v_p2_cu },
   { "test_vlasov_2x3v_p1_cu", test_vlasov_2x3v_p1_cu },
@@ -0,0 +1,128 @@
+#include <acutest.h>
+
+#include <gkyl_alloc.h>
+#include <gkyl_array.h>
+#include <gkyl_job_pool.h>
+#include <gkyl_null_pool.h>
+#include <gkyl_range.h>
+#include <gkyl_thread_pool.h>
+
+struct count_ctx {
+  long n; // amount of work to do
+  long result; // result of work
+};
+
+static void
+count_job(void *ctx)
+{
+  struct count_ctx *cc = ctx;
+  long sum = 0;
+  for (long i=0; i<cc->n; ++i) sum += i;
+  cc->result = sum;
+}
+
+static void
+test_jobs(struct gkyl_job_pool *jp)
+{
+  enum { NJOBS = 200 };
+  struct count_ctx cc[NJOBS];
+
+  // jobs of very unequal cost
+  for (int i=0; i<NJOBS; ++i) {
+    cc[i].n = (i%7 == 0) ? 100000 : i;
+    cc[i].result = -1;
+    TEST_CHECK( gkyl_job_pool_add_work(jp, count_job, &cc[i]) );
+  }
+  gkyl_job_pool_wait(jp);
+
+  for (int i=0; i<NJOBS; ++i)
+    TEST_CHECK( cc[i].result == cc[i].n*(cc[i].n-1)/2 );
+
+  // pool must be reusable after wait
+  for (int i=0; i<NJOBS; ++i) {
+    cc[i].result = -1;
+    gkyl_job_pool_add_work(jp, count_job, &cc[i]);
+  }
+  gkyl_job_pool_wait(jp);
+  for (int i=0; i<NJOBS; ++i)
+    TEST_CHECK( cc[i].result == cc[i].n*(cc[i].n-1)/2 );
+}
+
+static void
+set_idx(const struct gkyl_range *range, void *ctx)
+{
+  struct gkyl_array *arr = ctx;
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, range);
+  while (gkyl_range_iter_next(&iter)) {
+    long lidx = gkyl_range_idx(range, iter.idx);
+    double *d = gkyl_array_fetch(arr, lidx);
+    d[0] += lidx;
+  }
+}
+
+static void
+test_parallel_for(struct gkyl_job_pool *jp)
+{
+  int lower[] = {1, 1}, upper[] = {37, 23};
+  struct gkyl_range range;
+  gkyl_range_init(&range, 2, lower, upper);
+
+  int sub_lower[] = {3, 2}, sub_upper[] = {30, 19};
+  struct gkyl_range sub_range;
+  gkyl_sub_range_init(&sub_range, &range, sub_lower, sub_upper);
+
+  long grains[] = { 0, 1, 17, 100000 };
+  for (int g=0; g<4; ++g) {
+    struct gkyl_array *arr = gkyl_array_new(GKYL_DOUBLE, 1, range.volume);
+    gkyl_job_pool_parallel_for(jp, &sub_range, grains[g], set_idx, arr);
+
+    // each cell of sub_range must be visited exactly once
+    struct gkyl_range_iter iter;
+    gkyl_range_iter_init(&iter, &range);
+    while (gkyl_range_iter_next(&iter)) {
+      long lidx = gkyl_range_idx(&range, iter.idx);
+      const double *d = gkyl_array_cfetch(arr, lidx);
+      double expected = gkyl_range_contains_idx(&sub_range, iter.idx) ? lidx : 0.0;
+      TEST_CHECK( d[0] == expected );
+    }
+    gkyl_array_release(arr);
+  }
+}
+
+void test_thread_pool_jobs()
+{
+  struct gkyl_job_pool *jp = gkyl_thread_pool_new(4);
+  TEST_CHECK( jp->pool_size == 4 );
+  test_jobs(jp);
+  gkyl_job_pool_release(jp);
+}
+
+void test_null_pool_jobs()
+{
+  struct gkyl_job_pool *jp = gkyl_null_pool_new(4);
+  test_jobs(jp);
+  gkyl_job_pool_release(jp);
+}
+
+void test_thread_pool_parallel_for()
+{
+  struct gkyl_job_pool *jp = gkyl_thread_pool_new(3);
+  test_parallel_for(jp);
+  gkyl_job_pool_release(jp);
+}
+
+void test_null_pool_parallel_for()
+{
+  struct gkyl_job_pool *jp = gkyl_null_pool_new(3);
+  test_parallel_for(jp);
+  gkyl_job_pool_release(jp);
+}
+
+TEST_LIST = {
+  { "thread_pool_jobs", test_thread_pool_jobs },
+  { "null_pool_jobs", test_null_pool_jobs },
+  { "thread_pool_parallel_for", test_thread_pool_parallel_for },
+  { "null_pool_parallel_for", test_null_pool_parallel_for },
+  { NULL, NULL },
+};
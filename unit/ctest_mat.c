@@ -2,6 +2,9 @@
 #include <gkyl_alloc.h>
 #include <gkyl_mat.h>
 #include <gkyl_mat_priv.h>
+#include <gkyl_thread_pool.h>
+
+#include <math.h>
 
 void
 test_mat_base()
@@ -287,6 +290,156 @@ test_nmat_linsolve_(bool pre_alloc)
 void test_nmat_linsolve() { test_nmat_linsolve_(false); }
 void test_nmat_linsolve_pa() { test_nmat_linsolve_(true); }
 
+static void
+test_nmat_linsolve_batch_(size_t num, size_t nr, size_t nc, int nthreads)
+{
+  struct gkyl_nmat *As = gkyl_nmat_new(num, nr, nr);
+  struct gkyl_nmat *xs = gkyl_nmat_new(num, nr, nc);
+  struct gkyl_nmat *As_ref = gkyl_nmat_new(num, nr, nr);
+  struct gkyl_nmat *xs_ref = gkyl_nmat_new(num, nr, nc);
+
+  // smooth but non-symmetric matrices with small diagonal so pivoting
+  // is needed and differs between matrices
+  for (size_t n=0; n<num; ++n) {
+    struct gkyl_mat A = gkyl_nmat_get(As, n);
+    for (size_t j=0; j<nr; ++j)
+      for (size_t i=0; i<nr; ++i)
+        gkyl_mat_set(&A, i, j, sin(0.7*i + 1.3*j*j + 0.1*n) + (i == j ? 1e-3 : 0.0));
+    struct gkyl_mat x = gkyl_nmat_get(xs, n);
+    for (size_t j=0; j<nc; ++j)
+      for (size_t i=0; i<nr; ++i)
+        gkyl_mat_set(&x, i, j, cos(0.3*i + j + 0.2*n));
+  }
+  gkyl_nmat_copy(As_ref, As);
+  gkyl_nmat_copy(xs_ref, xs);
+
+  gkyl_nmat_mem *mem = gkyl_nmat_linsolve_lu_new(As->num, As->nr);
+  struct gkyl_job_pool *jp = nthreads > 1 ? gkyl_thread_pool_new(nthreads) : 0;
+  gkyl_nmat_linsolve_lu_set_job_pool(mem, jp);
+  // solve twice to check reuse of memory
+  for (int r=0; r<2; ++r) {
+    if (r == 1) {
+      gkyl_nmat_copy(As, As_ref);
+      gkyl_nmat_copy(xs, xs_ref);
+    }
+    TEST_CHECK( gkyl_nmat_linsolve_lu_pa(mem, As, xs) );
+  }
+  gkyl_nmat_linsolve_lu_release(mem);
+  if (jp)
+    gkyl_job_pool_release(jp);
+
+  // compare with matrix-by-matrix LAPACK solve
+  long *ipiv = gkyl_malloc(sizeof(long[nr]));
+  for (size_t n=0; n<num; ++n) {
+    struct gkyl_mat A = gkyl_nmat_get(As_ref, n);
+    struct gkyl_mat x = gkyl_nmat_get(xs_ref, n);
+    TEST_CHECK( gkyl_mat_linsolve_lu(&A, &x, ipiv) );
+
+    struct gkyl_mat xb = gkyl_nmat_get(xs, n);
+    double xmax = 0.0;
+    for (size_t k=0; k<nr*nc; ++k)
+      xmax = fmax(xmax, fabs(x.data[k]));
+    for (size_t k=0; k<nr*nc; ++k)
+      TEST_CHECK( fabs(xb.data[k]-x.data[k]) < 1e-10*xmax );
+  }
+  gkyl_free(ipiv);
+
+  gkyl_nmat_release(As);
+  gkyl_nmat_release(xs);
+  gkyl_nmat_release(As_ref);
+  gkyl_nmat_release(xs_ref);
+}
+
+void test_nmat_linsolve_batch() { test_nmat_linsolve_batch_(37, 20, 1, 1); }
+void test_nmat_linsolve_batch_nrhs() { test_nmat_linsolve_batch_(19, 8, 3, 1); }
+void test_nmat_linsolve_batch_threads() { test_nmat_linsolve_batch_(101, 32, 1, 4); }
+
+void
+test_nmat_linsolve_singular()
+{
+  struct gkyl_nmat *As = gkyl_nmat_new(11, 4, 4);
+  struct gkyl_nmat *xs = gkyl_nmat_new(11, 4, 1);
+  for (size_t n=0; n<As->num; ++n) {
+    struct gkyl_mat A = gkyl_nmat_get(As, n);
+    gkyl_mat_clear(&A, 0.0);
+    for (size_t i=0; i<A.nr; ++i)
+      gkyl_mat_set(&A, i, i, 1.0);
+    struct gkyl_mat x = gkyl_nmat_get(xs, n);
+    gkyl_mat_clear(&x, 1.0);
+  }
+  // one singular matrix in the middle of the second group
+  struct gkyl_mat A = gkyl_nmat_get(As, 9);
+  gkyl_mat_set(&A, 2, 2, 0.0);
+
+  TEST_CHECK( !gkyl_nmat_linsolve_lu(As, xs) );
+
+  gkyl_nmat_release(As);
+  gkyl_nmat_release(xs);
+}
+
+void
+test_nmat_lu_factor_singular()
+{
+  // one full batch with a singular matrix (zero column) in one lane
+  size_t num = 8, nr = 6, sing = 3;
+  struct gkyl_nmat *As = gkyl_nmat_new(num, nr, nr);
+  struct gkyl_nmat *LUs = gkyl_nmat_new(num, nr, nr);
+  struct gkyl_nmat *xs = gkyl_nmat_new(num, nr, 1);
+  struct gkyl_nmat *ys = gkyl_nmat_new(num, nr, 1);
+  for (size_t n=0; n<num; ++n) {
+    struct gkyl_mat A = gkyl_nmat_get(As, n);
+    for (size_t j=0; j<nr; ++j)
+      for (size_t i=0; i<nr; ++i)
+        gkyl_mat_set(&A, i, j, n == sing && j == 2 ? 0.0 :
+          sin(0.7*i + 1.3*j*j + 0.1*n) + (i == j ? 1e-3 : 0.0));
+    struct gkyl_mat x = gkyl_nmat_get(xs, n);
+    for (size_t i=0; i<nr; ++i)
+      gkyl_mat_set(&x, i, 0, cos(0.3*i + 0.2*n));
+  }
+  gkyl_nmat_copy(LUs, As);
+  gkyl_nmat_copy(ys, xs);
+
+  gkyl_nmat_mem *mem = gkyl_nmat_linsolve_lu_new(num, nr);
+
+  // factoring fails, but the other lanes are still factored
+  TEST_CHECK( !gkyl_nmat_lu_factor_pa(mem, LUs) );
+  gkyl_nmat_lu_solve_pa(mem, LUs, ys);
+
+  // a combined solve leaves the RHS of the singular matrix alone
+  TEST_CHECK( !gkyl_nmat_linsolve_lu_pa(mem, As, xs) );
+  struct gkyl_mat xsing = gkyl_nmat_get(xs, sing);
+  for (size_t i=0; i<nr; ++i)
+    TEST_CHECK( gkyl_mat_get(&xsing, i, 0) == cos(0.3*i + 0.2*sing) );
+
+  // compare the others with matrix-by-matrix LAPACK solves
+  long *ipiv = gkyl_malloc(sizeof(long[nr]));
+  struct gkyl_mat *A = gkyl_mat_new(nr, nr, 0.0), *x = gkyl_mat_new(nr, 1, 0.0);
+  for (size_t n=0; n<num; ++n) {
+    if (n == sing) continue;
+    for (size_t j=0; j<nr; ++j)
+      for (size_t i=0; i<nr; ++i)
+        gkyl_mat_set(A, i, j, sin(0.7*i + 1.3*j*j + 0.1*n) + (i == j ? 1e-3 : 0.0));
+    for (size_t i=0; i<nr; ++i)
+      gkyl_mat_set(x, i, 0, cos(0.3*i + 0.2*n));
+    TEST_CHECK( gkyl_mat_linsolve_lu(A, x, ipiv) );
+
+    struct gkyl_mat xb = gkyl_nmat_get(xs, n), yb = gkyl_nmat_get(ys, n);
+    for (size_t i=0; i<nr; ++i) {
+      TEST_CHECK( gkyl_compare(gkyl_mat_get(&xb, i, 0), gkyl_mat_get(x, i, 0), 1e-10) );
+      TEST_CHECK( gkyl_compare(gkyl_mat_get(&yb, i, 0), gkyl_mat_get(x, i, 0), 1e-10) );
+    }
+  }
+  gkyl_free(ipiv);
+  gkyl_mat_release(A);
+  gkyl_mat_release(x);
+
+  gkyl_nmat_linsolve_lu_release(mem);
+  gkyl_nmat_release(As);
+  gkyl_nmat_release(LUs);
+  gkyl_nmat_release(xs);
+  gkyl_nmat_release(ys);
+}
+
 #ifdef GKYL_HAVE_CUDA
 
 void
@@ -884,6 +1037,11 @@ TEST_LIST = {
   { "nmat_base", test_nmat_base },
   { "nmat_linsolve", test_nmat_linsolve },
   { "nmat_linsolve_pa", test_nmat_linsolve_pa },
+  { "nmat_linsolve_batch", test_nmat_linsolve_batch },
+  { "nmat_linsolve_batch_nrhs", test_nmat_linsolve_batch_nrhs },
+  { "nmat_linsolve_batch_threads", test_nmat_linsolve_batch_threads },
+  { "nmat_linsolve_singular", test_nmat_linsolve_singular },
+  { "nmat_lu_factor_singular", test_nmat_lu_factor_singular },
   { "mv", test_mat_mv},
   { "nmat_mv", test_nmat_mv},
   { "nmat_mm", test_nmat_mm},
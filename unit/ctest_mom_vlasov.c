@@ -5,11 +5,13 @@
 #include <gkyl_array_ops.h>
 #include <gkyl_array_rio.h>
 #include <gkyl_mom_calc.h>
+#include <gkyl_mom_calc_bcorr.h>
 #include <gkyl_mom_vlasov.h>
 #include <gkyl_proj_on_basis.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_decomp.h>
 #include <gkyl_rect_grid.h>
+#include <gkyl_thread_pool.h>
 
 void
 test_mom_vlasov()
@@ -673,6 +675,120 @@ test_2x3v_p1()
   gkyl_array_release(distf);
 }
 
+static bool
+mom_conf_equal(const struct gkyl_array *m1, const struct gkyl_array *m2,
+  const struct gkyl_range *range, double eps)
+{
+  bool equal = true;
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, range);
+  while (gkyl_range_iter_next(&iter)) {
+    long linc = gkyl_range_idx(range, iter.idx);
+    const double *m1ptr = gkyl_array_cfetch(m1, linc), *m2ptr = gkyl_array_cfetch(m2, linc);
+    for (int k=0; k<m1->ncomp; ++k)
+      if (eps == 0.0 ? m1ptr[k] != m2ptr[k] : fabs(m1ptr[k]-m2ptr[k]) > eps*(1.0+fabs(m1ptr[k])))
+        equal = false;
+  }
+  return equal;
+}
+
+void
+test_1x3v_p1_threads_(int nconf)
+{
+  // threaded moments must match serial ones: exactly when threads
+  // split configuration space, to round-off otherwise
+  int poly_order = 1;
+  double lower[] = {-2.0, -2.0, -2.0, -2.0}, upper[] = {2.0, 2.0, 2.0, 2.0};
+  int cells[] = {nconf, 8, 6, 5};
+  int ndim = sizeof(lower)/sizeof(lower[0]);
+  int vdim = 3, cdim = 1;
+
+  double confLower[] = {lower[0]}, confUpper[] = {upper[0]};
+  int confCells[] = {cells[0]};
+  double v_bounds[] = {lower[1], lower[2], lower[3], upper[1], upper[2], upper[3]};
+
+  struct gkyl_rect_grid grid;
+  gkyl_rect_grid_init(&grid, ndim, lower, upper, cells);
+  struct gkyl_rect_grid confGrid;
+  gkyl_rect_grid_init(&confGrid, cdim, confLower, confUpper, confCells);
+
+  struct gkyl_basis basis, confBasis;
+  gkyl_cart_modal_hybrid(&basis, cdim, vdim);
+  gkyl_cart_modal_serendip(&confBasis, cdim, poly_order);
+
+  int confGhost[] = { 1 };
+  struct gkyl_range confLocal, confLocal_ext;
+  gkyl_create_grid_ranges(&confGrid, confGhost, &confLocal_ext, &confLocal);
+  int ghost[] = { confGhost[0], 0, 0, 0 };
+  struct gkyl_range local, local_ext;
+  gkyl_create_grid_ranges(&grid, ghost, &local_ext, &local);
+
+  struct gkyl_array *distf = mkarr(basis.num_basis, local_ext.volume);
+  long nf = local_ext.volume*basis.num_basis;
+  double *distf_d = distf->data;
+  for (long i=0; i<nf; ++i)
+    distf_d[i] = (double)((7*i+3) % 101)/101.0 * ((i%3 == 0) ? -1 : 1);
+
+  struct gkyl_mom_type *m2ij_t = gkyl_mom_vlasov_new(&confBasis, &basis, "M2ij", false);
+  gkyl_mom_calc *mcalc = gkyl_mom_calc_new(&grid, m2ij_t, false);
+  gkyl_mom_calc_bcorr *bcalc = gkyl_mom_calc_bcorr_lbo_vlasov_new(&grid,
+    &confBasis, &basis, v_bounds, false);
+
+  int nm = m2ij_t->num_mom*confBasis.num_basis;
+  struct gkyl_array *m_serial = mkarr(nm, confLocal_ext.volume);
+  struct gkyl_array *m_thr = mkarr(nm, confLocal_ext.volume);
+  struct gkyl_array *m_det = mkarr(nm, confLocal_ext.volume);
+  struct gkyl_array *bc_serial = mkarr((vdim+1)*confBasis.num_basis, confLocal_ext.volume);
+  struct gkyl_array *bc_thr = mkarr((vdim+1)*confBasis.num_basis, confLocal_ext.volume);
+
+  gkyl_mom_calc_advance(mcalc, &local, &confLocal, distf, m_serial);
+  gkyl_mom_calc_bcorr_advance(bcalc, &local, &confLocal, distf, bc_serial);
+
+  // deterministic sums are the same serially and on any number of
+  // threads, whichever way the threads split the work
+  gkyl_mom_calc_set_deterministic(mcalc, true);
+  gkyl_mom_calc_advance(mcalc, &local, &confLocal, distf, m_det);
+  TEST_CHECK( mom_conf_equal(m_serial, m_det, &confLocal, 1e-12) );
+
+  for (int nthreads=1; nthreads<=4; nthreads *= 2) {
+    bool conf_split = confLocal.volume >= 4*nthreads;
+    struct gkyl_job_pool *job_pool = gkyl_thread_pool_new(nthreads);
+    gkyl_mom_calc_set_job_pool(mcalc, job_pool);
+    gkyl_mom_calc_bcorr_set_job_pool(bcalc, job_pool);
+
+    gkyl_mom_calc_set_deterministic(mcalc, false);
+    gkyl_mom_calc_advance(mcalc, &local, &confLocal, distf, m_thr);
+    TEST_CHECK( mom_conf_equal(m_serial, m_thr, &confLocal, conf_split ? 0.0 : 1e-12) );
+
+    gkyl_mom_calc_set_deterministic(mcalc, true);
+    gkyl_mom_calc_advance(mcalc, &local, &confLocal, distf, m_thr);
+    TEST_CHECK( mom_conf_equal(m_det, m_thr, &confLocal, 0.0) );
+    TEST_MSG( "deterministic moments differ on %d threads", nthreads );
+
+    gkyl_mom_calc_bcorr_advance(bcalc, &local, &confLocal, distf, bc_thr);
+    TEST_CHECK( mom_conf_equal(bc_serial, bc_thr, &confLocal, 0.0) );
+
+    gkyl_mom_calc_set_job_pool(mcalc, 0);
+    gkyl_mom_calc_bcorr_set_job_pool(bcalc, 0);
+    gkyl_job_pool_release(job_pool);
+  }
+
+  gkyl_array_release(m_serial); gkyl_array_release(m_thr); gkyl_array_release(m_det);
+  gkyl_array_release(bc_serial); gkyl_array_release(bc_thr);
+  gkyl_mom_calc_release(mcalc);
+  gkyl_mom_calc_bcorr_release(bcalc);
+  gkyl_mom_type_release(m2ij_t);
+  gkyl_array_release(distf);
+}
+
+void
+test_1x3v_p1_threads()
+{
+  test_1x3v_p1_threads_(2); // split velocity space
+  test_1x3v_p1_threads_(12); // split configuration space on 2 threads, velocity on 4
+  test_1x3v_p1_threads_(24); // split configuration space
+}
+
 #ifdef GKYL_HAVE_CUDA
 int cu_mom_vlasov_test(const struct gkyl_mom_type *mom);
 
@@ -1312,6 +1428,7 @@ TEST_LIST = {
   { "test_2x2v_p1", test_2x2v_p1 },
 //  { "test_big_2x2v_p2", test_big_2x2v_p2 },  
   { "test_2x3v_p1", test_2x3v_p1 },
+  { "test_1x3v_p1_threads", test_1x3v_p1_threads },
 #ifdef GKYL_HAVE_CUDA
   { "cu_mom_vlasov", test_cu_mom_vlasov },
   { "test_1x1v_p1_cu", test_1x1v_p1_cu },
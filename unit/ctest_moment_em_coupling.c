@@ -0,0 +1,163 @@
+#include <acutest.h>
+
+#include <gkyl_array.h>
+#include <gkyl_array_ops.h>
+#include <gkyl_moment_em_coupling.h>
+#include <gkyl_range.h>
+#include <gkyl_rect_decomp.h>
+#include <gkyl_rect_grid.h>
+#include <gkyl_sources_implicit.h>
+
+#include <math.h>
+#include <string.h>
+
+// Fill array with smooth, cell-dependent data: comp c in cell n is
+// base[c] + amp*sin(...)
+static void
+fill_array(struct gkyl_array *arr, const double *base, double amp, double phase)
+{
+  for (long n=0; n<arr->size; ++n) {
+    double *d = gkyl_array_fetch(arr, n);
+    for (int c=0; c<arr->ncomp; ++c)
+      d[c] = base[c] + amp*sin(0.37*n + 1.1*c + phase);
+  }
+}
+
+static void
+test_batch(int nfluids, enum gkyl_eqn_type type, double t_ramp)
+{
+  // cell count is not a multiple of IMPLICIT_SRC_BATCH
+  double lower[] = { 0.0, 0.0 }, upper[] = { 1.0, 1.0 };
+  int cells[] = { 19, 11 };
+  struct gkyl_rect_grid grid;
+  gkyl_rect_grid_init(&grid, 2, lower, upper, cells);
+
+  int nghost[] = { 2, 2 };
+  struct gkyl_range range, ext_range;
+  gkyl_create_grid_ranges(&grid, nghost, &ext_range, &range);
+
+  int meqn = type == GKYL_EQN_EULER ? 5 : 10;
+  double charge[] = { -1.0, 1.0, 2.0 }, mass[] = { 1.0/25.0, 1.0, 4.0 };
+
+  struct gkyl_moment_em_coupling_inp inp = {
+    .grid = &grid,
+    .nfluids = nfluids,
+    .epsilon0 = 1.0,
+    .mu0 = 1.0,
+    .t_ramp_E = t_ramp,
+    .t_ramp_curr = t_ramp,
+  };
+  for (int i=0; i<nfluids; ++i)
+    inp.param[i] = (struct gkyl_moment_em_coupling_data) {
+      .type = type, .charge = charge[i], .mass = mass[i], .k0 = 0.5
+    };
+  gkyl_moment_em_coupling *mom_em = gkyl_moment_em_coupling_new(inp);
+
+  struct gkyl_array *fb[GKYL_MAX_SPECIES], *fc[GKYL_MAX_SPECIES];
+  struct gkyl_array *app_accel[GKYL_MAX_SPECIES], *p_rhs[GKYL_MAX_SPECIES], *nT[GKYL_MAX_SPECIES];
+  double fbase[] = { 1.0, 0.1, -0.2, 0.3, 4.0, 2.0, 0.1, 0.1, 2.0, 0.1, 2.0 };
+  double zero[10] = { 0.0 };
+  for (int i=0; i<nfluids; ++i) {
+    fb[i] = gkyl_array_new(GKYL_DOUBLE, meqn, ext_range.volume);
+    fc[i] = gkyl_array_new(GKYL_DOUBLE, meqn, ext_range.volume);
+    app_accel[i] = gkyl_array_new(GKYL_DOUBLE, 3, ext_range.volume);
+    p_rhs[i] = gkyl_array_new(GKYL_DOUBLE, meqn, ext_range.volume);
+    nT[i] = gkyl_array_new(GKYL_DOUBLE, 2, ext_range.volume);
+
+    fill_array(fb[i], fbase, 0.05, i);
+    gkyl_array_copy(fc[i], fb[i]);
+    fill_array(app_accel[i], zero, 0.01, 2.0+i);
+    fill_array(p_rhs[i], zero, 0.02, 3.0+i);
+    gkyl_array_clear(nT[i], 0.0);
+  }
+
+  double embase[] = { 0.1, -0.1, 0.2, 0.5, 0.3, 1.0, 0.0, 0.0 };
+  struct gkyl_array *emb = gkyl_array_new(GKYL_DOUBLE, 8, ext_range.volume);
+  struct gkyl_array *emc = gkyl_array_new(GKYL_DOUBLE, 8, ext_range.volume);
+  struct gkyl_array *app_current = gkyl_array_new(GKYL_DOUBLE, 3, ext_range.volume);
+  struct gkyl_array *ext_em = gkyl_array_new(GKYL_DOUBLE, 6, ext_range.volume);
+  fill_array(emb, embase, 0.1, 0.5);
+  fill_array(app_current, zero, 0.01, 0.7);
+  fill_array(ext_em, zero, 0.05, 0.9);
+
+  // zero field in a few cells exercises the B_mag = 0 case
+  for (long n=0; n<ext_range.volume; n+=7) {
+    double *em = gkyl_array_fetch(emb, n);
+    const double *ext = gkyl_array_cfetch(ext_em, n);
+    for (int d=3; d<6; ++d) em[d] = -ext[d];
+  }
+  gkyl_array_copy(emc, emb);
+  struct gkyl_array *em0 = gkyl_array_new(GKYL_DOUBLE, 8, ext_range.volume);
+  gkyl_array_copy(em0, emb);
+
+  double t_curr = 0.5, dt = 0.01;
+
+  // batched update
+  const struct gkyl_array *capp_accel[GKYL_MAX_SPECIES], *cp_rhs[GKYL_MAX_SPECIES], *cnT[GKYL_MAX_SPECIES];
+  for (int i=0; i<nfluids; ++i) {
+    capp_accel[i] = app_accel[i]; cp_rhs[i] = p_rhs[i]; cnT[i] = nT[i];
+  }
+  gkyl_moment_em_coupling_implicit_advance(mom_em, t_curr, dt, &range, fb, capp_accel, cp_rhs,
+    emb, app_current, ext_em, cnT);
+
+  // cell-by-cell reference
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, &range);
+  while (gkyl_range_iter_next(&iter)) {
+    long n = gkyl_range_idx(&range, iter.idx);
+    double *fluid_s[GKYL_MAX_SPECIES];
+    const double *app_accel_s[GKYL_MAX_SPECIES], *p_rhs_s[GKYL_MAX_SPECIES], *nT_s[GKYL_MAX_SPECIES];
+    for (int i=0; i<nfluids; ++i) {
+      fluid_s[i] = gkyl_array_fetch(fc[i], n);
+      app_accel_s[i] = gkyl_array_cfetch(app_accel[i], n);
+      p_rhs_s[i] = gkyl_array_cfetch(p_rhs[i], n);
+      nT_s[i] = gkyl_array_cfetch(nT[i], n);
+    }
+    implicit_source_coupling_update(mom_em, t_curr, dt, fluid_s, app_accel_s, p_rhs_s,
+      gkyl_array_fetch(emc, n), gkyl_array_cfetch(app_current, n), gkyl_array_cfetch(ext_em, n), nT_s);
+  }
+
+  // batched update agrees with cell-by-cell one to round-off (the
+  // compiler may reorder floating-point operations differently in the
+  // vectorized loops, e.g. under -ffast-math)
+  for (long n=0; n<ext_range.volume; ++n) {
+    for (int i=0; i<nfluids; ++i) {
+      const double *b = gkyl_array_cfetch(fb[i], n), *c = gkyl_array_cfetch(fc[i], n);
+      for (int k=0; k<meqn; ++k)
+        TEST_CHECK( gkyl_compare_double(b[k], c[k], 1e-14) );
+    }
+    const double *b = gkyl_array_cfetch(emb, n), *c = gkyl_array_cfetch(emc, n);
+    for (int k=0; k<8; ++k)
+      TEST_CHECK( gkyl_compare_double(b[k], c[k], 1e-14) );
+  }
+
+  // and the electric field was actually updated
+  long lidx = gkyl_range_idx(&range, (int[]) { 3, 4 });
+  const double *e_new = gkyl_array_cfetch(emb, lidx), *e_old = gkyl_array_cfetch(em0, lidx);
+  TEST_CHECK( e_new[0] != e_old[0] );
+
+  for (int i=0; i<nfluids; ++i) {
+    gkyl_array_release(fb[i]);
+    gkyl_array_release(fc[i]);
+    gkyl_array_release(app_accel[i]);
+    gkyl_array_release(p_rhs[i]);
+    gkyl_array_release(nT[i]);
+  }
+  gkyl_array_release(emb);
+  gkyl_array_release(emc);
+  gkyl_array_release(em0);
+  gkyl_array_release(app_current);
+  gkyl_array_release(ext_em);
+  gkyl_moment_em_coupling_release(mom_em);
+}
+
+void test_batch_5m() { test_batch(2, GKYL_EQN_EULER, 0.0); }
+void test_batch_5m_3s_ramp() { test_batch(3, GKYL_EQN_EULER, 1.0); }
+void test_batch_10m() { test_batch(2, GKYL_EQN_TEN_MOMENT, 0.0); }
+
+TEST_LIST = {
+  { "batch_5m", test_batch_5m },
+  { "batch_5m_3s_ramp", test_batch_5m_3s_ramp },
+  { "batch_10m", test_batch_10m },
+  { NULL, NULL },
+};
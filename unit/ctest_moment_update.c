@@ -0,0 +1,101 @@
+#include <acutest.h>
+
+#include <gkyl_moment.h>
+#include <gkyl_wv_euler.h>
+
+#include <float.h>
+#include <math.h>
+
+// blast wave: the waves speed up over the first steps, as the high
+// pressure region expands
+static void
+eval_blast(double t, const double *xn, double *fout, void *ctx)
+{
+  double gas_gamma = 1.4;
+  double x = xn[0];
+  double rho = 1.0, u = 0.0, p = fabs(x-0.5) < 0.05 ? 1000.0 : 0.01;
+
+  fout[0] = rho;
+  fout[1] = rho*u; fout[2] = 0.0; fout[3] = 0.0;
+  fout[4] = p/(gas_gamma-1) + 0.5*rho*u*u;
+}
+
+// take nsteps steps of the blast wave, each with the time-step
+// suggested by the previous one, and return the app statistics
+static struct gkyl_moment_stat
+run_blast(bool skip_dt_predict, int nsteps, double *tend)
+{
+  struct gkyl_wv_eqn *euler = gkyl_wv_euler_new(1.4, false);
+
+  struct gkyl_moment app_inp = {
+    .name = "ctest_moment_update_blast",
+
+    .ndim = 1,
+    .lower = { 0.0 },
+    .upper = { 1.0 },
+    .cells = { 200 },
+
+    .cfl_frac = 0.9,
+    .skip_dt_predict = skip_dt_predict,
+
+    .num_species = 1,
+    .species = {
+      {
+        .name = "euler",
+        .equation = euler,
+        .evolve = true,
+        .init = eval_blast,
+        .bcx = { GKYL_SPECIES_COPY, GKYL_SPECIES_COPY },
+      },
+    },
+  };
+  gkyl_moment_app *app = gkyl_moment_app_new(&app_inp);
+  gkyl_moment_app_apply_ic(app, 0.0);
+
+  double tcurr = 0.0, dt = gkyl_moment_app_max_dt(app);
+  for (int n=0; n<nsteps; ++n) {
+    struct gkyl_update_status status = gkyl_moment_update(app, dt);
+    TEST_CHECK( status.success );
+    tcurr += status.dt_actual;
+    dt = status.dt_suggested;
+  }
+  *tend = tcurr;
+
+  struct gkyl_moment_stat stat = gkyl_moment_app_stat(app);
+
+  gkyl_wv_eqn_release(euler);
+  gkyl_moment_app_release(app);
+
+  return stat;
+}
+
+static void
+test_dt_predict(void)
+{
+  int nsteps = 40;
+  double tend_skip, tend_pred;
+  struct gkyl_moment_stat stat_skip = run_blast(true, nsteps, &tend_skip);
+  struct gkyl_moment_stat stat_pred = run_blast(false, nsteps, &tend_pred);
+
+  // without the prediction, steps that speed up the waves are redone
+  TEST_CHECK( stat_skip.ndt_predict == 0 );
+  TEST_CHECK( stat_skip.nfail > 0 );
+  TEST_MSG("redone steps: %ld", stat_skip.nfail);
+
+  // with it, the time-step is cut before the step instead: the
+  // prediction from past steps alone still lets one of them through,
+  // the check on the current solution catches it
+  TEST_CHECK( stat_pred.ndt_predict > 0 );
+  TEST_CHECK( stat_pred.nfail == 0 );
+  TEST_MSG("redone steps: %ld (%ld without prediction)", stat_pred.nfail, stat_skip.nfail);
+
+  // cutting the time-step ahead of the step should not slow the run
+  // down much compared to redoing the step with the same cut
+  TEST_CHECK( tend_pred > 0.9*tend_skip );
+  TEST_MSG("end time: %g (%g without prediction)", tend_pred, tend_skip);
+}
+
+TEST_LIST = {
+  { "dt_predict", test_dt_predict },
+  { NULL, NULL },
+};
@@ -159,8 +159,50 @@ test_2d()
   gkyl_array_release(arr);
 }
 
+void
+test_sync_begin_end()
+{
+  struct gkyl_range range;
+  gkyl_range_init(&range, 1, (int[]) { 1 }, (int[]) { 10 });
+
+  int cuts[] = { 1 };
+  struct gkyl_rect_decomp *decomp =
+    gkyl_rect_decomp_new_from_cuts(range.ndim, cuts, &range);
+
+  struct gkyl_comm *comm = gkyl_null_comm_inew( &(struct gkyl_null_comm_inp) {
+      .decomp = decomp
+    }
+  );
+
+  int nghost[] = { 1 };
+  struct gkyl_range local, local_ext;
+  gkyl_create_ranges(&decomp->ranges[0], nghost, &local_ext, &local);
+
+  struct gkyl_array *arr = gkyl_array_new(GKYL_DOUBLE, 1, local_ext.volume);
+  gkyl_array_clear(arr, 1.5);
+
+  struct gkyl_comm_state *state = gkyl_comm_state_new(comm);
+
+  TEST_CHECK( 0 == gkyl_comm_array_sync_begin(comm, &local, &local_ext, arr, state) );
+  TEST_CHECK( 1 == gkyl_comm_array_sync_begin(comm, &local, &local_ext, arr, state) );
+  TEST_CHECK( 0 == gkyl_comm_array_sync_end(comm, state) );
+  TEST_CHECK( 1 == gkyl_comm_array_sync_end(comm, state) );
+
+  // sync is a no-op: array is unchanged
+  for (long i=0; i<arr->size; ++i) {
+    const double *f = gkyl_array_cfetch(arr, i);
+    TEST_CHECK( f[0] == 1.5 );
+  }
+
+  gkyl_comm_state_release(comm, state);
+  gkyl_rect_decomp_release(decomp);
+  gkyl_comm_release(comm);
+  gkyl_array_release(arr);
+}
+
 TEST_LIST = {
   { "test_1d", test_1d },
   { "test_2d", test_2d },
+  { "test_sync_begin_end", test_sync_begin_end },
   { NULL, NULL },
 };
@@ -0,0 +1,462 @@
+#include <acutest.h>
+
+#include <gkyl_array.h>
+#include <gkyl_range.h>
+#include <gkyl_rect_decomp.h>
+#include <gkyl_rect_grid.h>
+#include <gkyl_thread_pool.h>
+#include <gkyl_wave_geom.h>
+#include <gkyl_wave_prop.h>
+#include <gkyl_wv_euler.h>
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+static void
+nomapc2p(double t, const double *xc, double *xp, void *ctx)
+{
+  int *ndim = ctx;
+  for (int i=0; i<(*ndim); ++i) xp[i] = xc[i];
+}
+
+// Euler state with a density/pressure jump along a diagonal
+static void
+init_euler(const struct gkyl_rect_grid *grid, const struct gkyl_range *ext_range,
+  double gas_gamma, struct gkyl_array *q)
+{
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, ext_range);
+  while (gkyl_range_iter_next(&iter)) {
+    double xc[GKYL_MAX_DIM];
+    gkyl_rect_grid_cell_center(grid, iter.idx, xc);
+    double r = 0.0;
+    for (int d=0; d<grid->ndim; ++d) r += xc[d];
+
+    double rho = r < 0.9 ? 1.0 : 0.125, pr = r < 0.9 ? 1.0 : 0.1;
+    double u = 0.1*sin(2*M_PI*xc[0]), v = 0.05*cos(2*M_PI*xc[1]);
+
+    double *qc = gkyl_array_fetch(q, gkyl_range_idx(ext_range, iter.idx));
+    qc[0] = rho;
+    qc[1] = rho*u; qc[2] = rho*v; qc[3] = 0.0;
+    qc[4] = pr/(gas_gamma-1) + 0.5*rho*(u*u+v*v);
+  }
+}
+
+static void
+test_threaded_sweep(int ndim, int nthreads)
+{
+  double lower[] = { 0.0, 0.0, 0.0 }, upper[] = { 1.0, 1.0, 1.0 };
+  int cells[] = { 24, 20, 8 };
+  struct gkyl_rect_grid grid;
+  gkyl_rect_grid_init(&grid, ndim, lower, upper, cells);
+
+  int nghost[] = { 2, 2, 2 };
+  struct gkyl_range range, ext_range;
+  gkyl_create_grid_ranges(&grid, nghost, &ext_range, &range);
+
+  double gas_gamma = 1.4;
+  struct gkyl_wv_eqn *euler = gkyl_wv_euler_new(gas_gamma, false);
+  struct gkyl_wave_geom *geom = gkyl_wave_geom_new(&grid, &ext_range, nomapc2p, &ndim, false);
+  struct gkyl_job_pool *pool = gkyl_thread_pool_new(nthreads);
+
+  struct gkyl_array *qin = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+  struct gkyl_array *qser = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+  struct gkyl_array *qthr = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+  init_euler(&grid, &ext_range, gas_gamma, qin);
+  gkyl_array_copy(qser, qin);
+  gkyl_array_copy(qthr, qin);
+
+  for (int d=0; d<ndim; ++d) {
+    struct gkyl_wave_prop_inp winp = {
+      .grid = &grid,
+      .equation = euler,
+      .limiter = GKYL_MONOTONIZED_CENTERED,
+      .num_up_dirs = 1,
+      .update_dirs = { d },
+      .check_inv_domain = true,
+      .cfl = 0.9,
+      .geom = geom,
+    };
+    gkyl_wave_prop *ser = gkyl_wave_prop_new(&winp);
+    gkyl_wave_prop *thr = gkyl_wave_prop_new(&winp);
+    gkyl_wave_prop_set_job_pool(thr, pool);
+
+    double dt = 0.5*gkyl_wave_prop_max_dt(ser, &range, qin);
+    struct gkyl_wave_prop_status sser = gkyl_wave_prop_advance(ser, 0.0, dt, &range, qin, qser);
+    struct gkyl_wave_prop_status sthr = gkyl_wave_prop_advance(thr, 0.0, dt, &range, qin, qthr);
+
+    TEST_CHECK( sser.success == 1 && sthr.success == 1 );
+    TEST_CHECK( sser.dt_suggested == sthr.dt_suggested );
+    TEST_CHECK( sser.max_speed == sthr.max_speed );
+
+    // threaded update is bit-for-bit identical to serial one
+    TEST_CHECK( 0 == memcmp(qser->data, qthr->data, qser->esznc*qser->size) );
+
+    struct gkyl_wave_prop_stats st_ser = gkyl_wave_prop_stats(ser);
+    struct gkyl_wave_prop_stats st_thr = gkyl_wave_prop_stats(thr);
+    TEST_CHECK( st_ser.n_bad_cells == st_thr.n_bad_cells );
+    TEST_CHECK( st_ser.n_max_bad_cells == st_thr.n_max_bad_cells );
+
+    // too large a time-step fails on all threads
+    sthr = gkyl_wave_prop_advance(thr, 0.0, 4*dt, &range, qin, qthr);
+    TEST_CHECK( sthr.success == 0 );
+    TEST_CHECK( sthr.dt_suggested < 4*dt );
+
+    // failed steps suggest the same time-step as the serial sweep,
+    // which stops at the first pencil violating the CFL condition
+    double dt_max = sser.dt_suggested, fact[] = { 1.5, 3.0, 8.0 };
+    for (int i=0; i<3; ++i) {
+      sser = gkyl_wave_prop_advance(ser, 0.0, fact[i]*dt_max, &range, qin, qser);
+      sthr = gkyl_wave_prop_advance(thr, 0.0, fact[i]*dt_max, &range, qin, qthr);
+      TEST_CHECK( sser.success == 0 && sthr.success == 0 );
+      TEST_CHECK( sser.dt_suggested == sthr.dt_suggested );
+      TEST_MSG( "dt factor %g: serial %.17g threaded %.17g", fact[i],
+        sser.dt_suggested, sthr.dt_suggested );
+      TEST_CHECK( sser.max_speed == sthr.max_speed );
+    }
+
+    gkyl_wave_prop_release(ser);
+    gkyl_wave_prop_release(thr);
+  }
+
+  gkyl_array_release(qin);
+  gkyl_array_release(qser);
+  gkyl_array_release(qthr);
+  gkyl_job_pool_release(pool);
+  gkyl_wave_geom_release(geom);
+  gkyl_wv_eqn_release(euler);
+}
+
+static void
+test_multi_sweep(int ndim, int nthreads)
+{
+  double lower[] = { 0.0, 0.0, 0.0 }, upper[] = { 1.0, 1.0, 1.0 };
+  int cells[] = { 16, 12, 6 };
+  struct gkyl_rect_grid grid;
+  gkyl_rect_grid_init(&grid, ndim, lower, upper, cells);
+
+  int nghost[] = { 2, 2, 2 };
+  struct gkyl_range range, ext_range;
+  gkyl_create_grid_ranges(&grid, nghost, &ext_range, &range);
+
+  enum { NSYS = 3 };
+  double gas_gamma[NSYS] = { 1.4, 5.0/3.0, 1.3 };
+  struct gkyl_wave_geom *geom = gkyl_wave_geom_new(&grid, &ext_range, nomapc2p, &ndim, false);
+  struct gkyl_job_pool *pool = nthreads > 1 ? gkyl_thread_pool_new(nthreads) : 0;
+
+  struct gkyl_wv_eqn *euler[NSYS];
+  struct gkyl_array *qin[NSYS], *qsep[NSYS], *qmul[NSYS];
+  for (int k=0; k<NSYS; ++k) {
+    euler[k] = gkyl_wv_euler_new(gas_gamma[k], false);
+    qin[k] = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+    qsep[k] = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+    qmul[k] = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+    init_euler(&grid, &ext_range, gas_gamma[k], qin[k]);
+    gkyl_array_scale(qin[k], 1.0+0.5*k);
+  }
+
+  for (int d=0; d<ndim; ++d) {
+    gkyl_wave_prop *sep[NSYS], *mul[NSYS];
+    for (int k=0; k<NSYS; ++k) {
+      struct gkyl_wave_prop_inp winp = {
+        .grid = &grid,
+        .equation = euler[k],
+        .limiter = k == 1 ? GKYL_VAN_LEER : GKYL_MONOTONIZED_CENTERED,
+        .num_up_dirs = 1,
+        .update_dirs = { d },
+        .check_inv_domain = true,
+        .force_low_order_flux = k == 2,
+        .cfl = 0.9,
+        .geom = geom,
+      };
+      sep[k] = gkyl_wave_prop_new(&winp);
+      mul[k] = gkyl_wave_prop_new(&winp);
+      gkyl_wave_prop_set_job_pool(mul[k], pool);
+    }
+
+    double dt = DBL_MAX;
+    for (int k=0; k<NSYS; ++k)
+      dt = fmin(dt, 0.5*gkyl_wave_prop_max_dt(sep[k], &range, qin[k]));
+
+    struct gkyl_wave_prop_status ssep[NSYS], smul[NSYS];
+    for (int k=0; k<NSYS; ++k)
+      ssep[k] = gkyl_wave_prop_advance(sep[k], 0.0, dt, &range, qin[k], qsep[k]);
+
+    const struct gkyl_array *cqin[NSYS] = { qin[0], qin[1], qin[2] };
+    struct gkyl_wave_prop_status comb = gkyl_wave_prop_advance_multi(NSYS, mul, 0.0, dt, &range,
+      cqin, qmul, smul);
+
+    TEST_CHECK( comb.success == 1 );
+    double dt_min = DBL_MAX;
+    for (int k=0; k<NSYS; ++k) {
+      // fused update is bit-for-bit identical to separate ones
+      TEST_CHECK( 0 == memcmp(qsep[k]->data, qmul[k]->data, qsep[k]->esznc*qsep[k]->size) );
+      TEST_CHECK( ssep[k].success == smul[k].success );
+      TEST_CHECK( ssep[k].dt_suggested == smul[k].dt_suggested );
+      TEST_CHECK( ssep[k].max_speed == smul[k].max_speed );
+      dt_min = fmin(dt_min, ssep[k].dt_suggested);
+    }
+    TEST_CHECK( comb.dt_suggested == dt_min );
+
+    // too large a time-step fails all systems
+    comb = gkyl_wave_prop_advance_multi(NSYS, mul, 0.0, 4*dt, &range, cqin, qmul, smul);
+    TEST_CHECK( comb.success == 0 );
+    for (int k=0; k<NSYS; ++k)
+      TEST_CHECK( smul[k].success == 0 );
+
+    for (int k=0; k<NSYS; ++k) {
+      gkyl_wave_prop_release(sep[k]);
+      gkyl_wave_prop_release(mul[k]);
+    }
+  }
+
+  for (int k=0; k<NSYS; ++k) {
+    gkyl_array_release(qin[k]);
+    gkyl_array_release(qsep[k]);
+    gkyl_array_release(qmul[k]);
+    gkyl_wv_eqn_release(euler[k]);
+  }
+  if (pool)
+    gkyl_job_pool_release(pool);
+  gkyl_wave_geom_release(geom);
+}
+
+// two streams moving apart at high Mach number: the double rarefaction
+// makes the high-order update produce negative pressure
+static void
+init_euler_vacuum(const struct gkyl_rect_grid *grid, const struct gkyl_range *ext_range,
+  double gas_gamma, struct gkyl_array *q)
+{
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, ext_range);
+  while (gkyl_range_iter_next(&iter)) {
+    double xc[GKYL_MAX_DIM];
+    gkyl_rect_grid_cell_center(grid, iter.idx, xc);
+
+    double rho = 1.0, pr = 1.0e-4;
+    double u = xc[0] < 0.5 ? -5.0 : 5.0, v = xc[1] < 0.5 ? -5.0 : 5.0;
+
+    double *qc = gkyl_array_fetch(q, gkyl_range_idx(ext_range, iter.idx));
+    qc[0] = rho;
+    qc[1] = rho*u; qc[2] = rho*v; qc[3] = 0.0;
+    qc[4] = pr/(gas_gamma-1) + 0.5*rho*(u*u+v*v);
+  }
+}
+
+static void
+test_fix_count(int nthreads)
+{
+  int ndim = 2;
+  double lower[] = { 0.0, 0.0 }, upper[] = { 1.0, 1.0 };
+  int cells[] = { 32, 24 };
+  struct gkyl_rect_grid grid;
+  gkyl_rect_grid_init(&grid, ndim, lower, upper, cells);
+
+  int nghost[] = { 2, 2 };
+  struct gkyl_range range, ext_range;
+  gkyl_create_grid_ranges(&grid, nghost, &ext_range, &range);
+
+  double gas_gamma = 1.4;
+  struct gkyl_wv_eqn *euler = gkyl_wv_euler_new(gas_gamma, false);
+  struct gkyl_wave_geom *geom = gkyl_wave_geom_new(&grid, &ext_range, nomapc2p, &ndim, false);
+  struct gkyl_job_pool *pool = gkyl_thread_pool_new(nthreads);
+
+  struct gkyl_array *qin = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+  struct gkyl_array *qser = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+  struct gkyl_array *qthr = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+  struct gkyl_array *nfix_ser = gkyl_array_new(GKYL_DOUBLE, ndim, ext_range.volume);
+  struct gkyl_array *nfix_thr = gkyl_array_new(GKYL_DOUBLE, ndim, ext_range.volume);
+  init_euler_vacuum(&grid, &ext_range, gas_gamma, qin);
+
+  for (int d=0; d<ndim; ++d) {
+    struct gkyl_wave_prop_inp winp = {
+      .grid = &grid,
+      .equation = euler,
+      .limiter = GKYL_MONOTONIZED_CENTERED,
+      .num_up_dirs = 1,
+      .update_dirs = { d },
+      .check_inv_domain = true,
+      .cfl = 0.9,
+      .geom = geom,
+    };
+    gkyl_wave_prop *ser = gkyl_wave_prop_new(&winp);
+    gkyl_wave_prop *thr = gkyl_wave_prop_new(&winp);
+    gkyl_wave_prop_set_job_pool(thr, pool);
+    gkyl_wave_prop_set_fix_count(ser, nfix_ser);
+    gkyl_wave_prop_set_fix_count(thr, nfix_thr);
+
+    gkyl_array_clear(nfix_ser, 0.0);
+    gkyl_array_clear(nfix_thr, 0.0);
+
+    double dt = 0.9*gkyl_wave_prop_max_dt(ser, &range, qin);
+    gkyl_array_copy(qser, qin);
+    gkyl_array_copy(qthr, qin);
+    gkyl_wave_prop_advance(ser, 0.0, dt, &range, qin, qser);
+    gkyl_wave_prop_advance(thr, 0.0, dt, &range, qin, qthr);
+
+    struct gkyl_wave_prop_stats st_ser = gkyl_wave_prop_stats(ser);
+    struct gkyl_wave_prop_stats st_thr = gkyl_wave_prop_stats(thr);
+    TEST_CHECK( st_ser.n_bad_cells > 0 );
+    TEST_CHECK( st_ser.n_bad_cells == st_thr.n_bad_cells );
+    TEST_CHECK( st_ser.n_bad_advance_calls == st_thr.n_bad_advance_calls );
+    TEST_CHECK( st_ser.n_calls == 1 && st_thr.n_calls == 1 );
+    TEST_CHECK( st_thr.sweep_tm[d] > 0.0 );
+    TEST_CHECK( st_thr.sweep_tm[(d+1)%ndim] == 0.0 );
+
+    // per-cell counts are only in component d, and add up to the
+    // number of fixed cells
+    double tot = 0.0;
+    for (long i=0; i<ext_range.volume; ++i) {
+      const double *ns = gkyl_array_cfetch(nfix_ser, i), *nt = gkyl_array_cfetch(nfix_thr, i);
+      TEST_CHECK( ns[d] == nt[d] );
+      TEST_CHECK( ns[(d+1)%ndim] == 0.0 );
+      tot += ns[d];
+    }
+    TEST_CHECK( tot == st_ser.n_bad_cells );
+
+    // a call that fails (CFL violated) leaves the counts of accepted
+    // calls and the per-cell counts alone
+    gkyl_array_copy(qthr, qin);
+    struct gkyl_wave_prop_status status = gkyl_wave_prop_advance(thr, 0.0, 4.0*dt, &range, qin, qthr);
+    TEST_CHECK( !status.success );
+    struct gkyl_wave_prop_stats st_fail = gkyl_wave_prop_stats(thr);
+    TEST_CHECK( st_fail.n_calls == 2 );
+    TEST_CHECK( st_fail.n_failed_calls == 1 );
+    TEST_CHECK( st_fail.n_bad_cells == st_thr.n_bad_cells );
+    TEST_CHECK( st_fail.n_bad_advance_calls == st_thr.n_bad_advance_calls );
+    for (long i=0; i<ext_range.volume; ++i) {
+      const double *ns = gkyl_array_cfetch(nfix_ser, i), *nt = gkyl_array_cfetch(nfix_thr, i);
+      TEST_CHECK( ns[d] == nt[d] );
+    }
+
+    gkyl_wave_prop_release(ser);
+    gkyl_wave_prop_release(thr);
+  }
+
+  gkyl_array_release(qin);
+  gkyl_array_release(qser);
+  gkyl_array_release(qthr);
+  gkyl_array_release(nfix_ser);
+  gkyl_array_release(nfix_thr);
+  gkyl_job_pool_release(pool);
+  gkyl_wave_geom_release(geom);
+  gkyl_wv_eqn_release(euler);
+}
+
+static void
+test_boundary_fluct(int d)
+{
+  int ndim = 2;
+  double lower[] = { 0.0, 0.0 }, upper[] = { 1.0, 1.0 };
+  int cells[] = { 24, 20 };
+  struct gkyl_rect_grid grid;
+  gkyl_rect_grid_init(&grid, ndim, lower, upper, cells);
+
+  int nghost[] = { 2, 2 };
+  struct gkyl_range range, ext_range;
+  gkyl_create_grid_ranges(&grid, nghost, &ext_range, &range);
+
+  double gas_gamma = 1.4;
+  struct gkyl_wv_eqn *euler = gkyl_wv_euler_new(gas_gamma, false);
+  struct gkyl_wave_geom *geom = gkyl_wave_geom_new(&grid, &ext_range, nomapc2p, &ndim, false);
+
+  struct gkyl_array *qin = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+  struct gkyl_array *qref = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+  struct gkyl_array *qout = gkyl_array_new(GKYL_DOUBLE, 5, ext_range.volume);
+  struct gkyl_array *bfluct = gkyl_array_new(GKYL_DOUBLE, 10, ext_range.volume);
+  init_euler(&grid, &ext_range, gas_gamma, qin);
+  gkyl_array_copy(qref, qin);
+  gkyl_array_copy(qout, qin);
+
+  struct gkyl_wave_prop_inp winp = {
+    .grid = &grid,
+    .equation = euler,
+    .limiter = GKYL_MONOTONIZED_CENTERED,
+    .num_up_dirs = 1,
+    .update_dirs = { d },
+    .check_inv_domain = true,
+    .cfl = 0.9,
+    .geom = geom,
+  };
+  gkyl_wave_prop *ref = gkyl_wave_prop_new(&winp);
+  gkyl_wave_prop *slvr = gkyl_wave_prop_new(&winp);
+  gkyl_wave_prop_set_boundary_fluct(slvr, bfluct);
+
+  double dt = 0.5*gkyl_wave_prop_max_dt(ref, &range, qin);
+  gkyl_wave_prop_advance(ref, 0.0, dt, &range, qin, qref);
+  gkyl_wave_prop_advance(slvr, 0.0, dt, &range, qin, qout);
+
+  // storing the boundary fluctuations does not change the update
+  TEST_CHECK( 0 == memcmp(qref->data, qout->data, qref->esznc*qref->size) );
+
+  // in each pencil, the change in the total is given by the fluxes
+  // through the two end faces, F(q) - R at the lower face and F(q) + R
+  // at the upper one
+  struct gkyl_range perp_range;
+  gkyl_range_shorten_from_above(&perp_range, &range, d, 1);
+
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, &perp_range);
+  while (gkyl_range_iter_next(&iter)) {
+    int lo[GKYL_MAX_DIM], up[GKYL_MAX_DIM];
+    for (int k=0; k<ndim; ++k) lo[k] = up[k] = iter.idx[k];
+    up[d] = range.upper[d];
+
+    double dq[5] = { 0.0 };
+    for (int i=range.lower[d]; i<=range.upper[d]; ++i) {
+      int idx[GKYL_MAX_DIM];
+      for (int k=0; k<ndim; ++k) idx[k] = iter.idx[k];
+      idx[d] = i;
+      long loc = gkyl_range_idx(&range, idx);
+      const double *qn = gkyl_array_cfetch(qout, loc), *qo = gkyl_array_cfetch(qin, loc);
+      for (int m=0; m<5; ++m) dq[m] += qn[m] - qo[m];
+    }
+
+    long lo_loc = gkyl_range_idx(&range, lo), up_loc = gkyl_range_idx(&range, up);
+    const double *q_lo = gkyl_array_cfetch(qin, lo_loc), *q_up = gkyl_array_cfetch(qin, up_loc);
+    const double *r_lo = gkyl_array_cfetch(bfluct, lo_loc);
+    const double *r_up = (const double*) gkyl_array_cfetch(bfluct, up_loc) + 5;
+
+    double ql_lo[5], ql_up[5], jump_local[5], jump[5];
+    const struct gkyl_wave_cell_geom *cg = gkyl_wave_geom_get(geom, lo);
+    gkyl_wv_eqn_rotate_to_local(euler, cg->tau1[d], cg->tau2[d], cg->norm[d], q_lo, ql_lo);
+    gkyl_wv_eqn_rotate_to_local(euler, cg->tau1[d], cg->tau2[d], cg->norm[d], q_up, ql_up);
+    gkyl_wv_eqn_flux_jump(euler, ql_lo, ql_up, jump_local);
+    gkyl_wv_eqn_rotate_to_global(euler, cg->tau1[d], cg->tau2[d], cg->norm[d], jump_local, jump);
+
+    for (int m=0; m<5; ++m) {
+      double expect = -dt/grid.dx[d]*(jump[m] + r_up[m] + r_lo[m]);
+      TEST_CHECK( gkyl_compare_double(dq[m], expect, 1e-12) );
+      TEST_MSG( "d = %d, m = %d: %.15e vs %.15e", d, m, dq[m], expect );
+    }
+  }
+
+  gkyl_wave_prop_release(ref);
+  gkyl_wave_prop_release(slvr);
+  gkyl_array_release(qin);
+  gkyl_array_release(qref);
+  gkyl_array_release(qout);
+  gkyl_array_release(bfluct);
+  gkyl_wave_geom_release(geom);
+  gkyl_wv_eqn_release(euler);
+}
+
+void test_threaded_sweep_2d() { test_threaded_sweep(2, 4); }
+void test_threaded_sweep_3d() { test_threaded_sweep(3, 3); }
+void test_multi_sweep_2d() { test_multi_sweep(2, 1); }
+void test_multi_sweep_3d() { test_multi_sweep(3, 2); }
+void test_fix_count_2d() { test_fix_count(3); }
+void test_boundary_fluct_x() { test_boundary_fluct(0); }
+void test_boundary_fluct_y() { test_boundary_fluct(1); }
+
+TEST_LIST = {
+  { "threaded_sweep_2d", test_threaded_sweep_2d },
+  { "threaded_sweep_3d", test_threaded_sweep_3d },
+  { "multi_sweep_2d", test_multi_sweep_2d },
+  { "multi_sweep_3d", test_multi_sweep_3d },
+  { "fix_count_2d", test_fix_count_2d },
+  { "boundary_fluct_x", test_boundary_fluct_x },
+  { "boundary_fluct_y", test_boundary_fluct_y },
+  { NULL, NULL },
+};
@@ -8,6 +8,7 @@
 #include <gkyl_util.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_decomp.h>
+#include <gkyl_array_rio.h>
 #include <gkyl_mpi_comm.h>
 
 void
@@ -226,6 +227,93 @@ mpi_n4_sync_2d(bool use_corners)
 void mpi_n4_sync_2d_no_corner() { mpi_n4_sync_2d(false); }
 void mpi_n4_sync_2d_use_corner() { mpi_n4_sync_2d(true); }
 
+void
+mpi_n4_sync_begin_end_2d()
+{
+  int m_sz;
+  MPI_Comm_size(MPI_COMM_WORLD, &m_sz);
+  if (m_sz != 4) return;
+
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  struct gkyl_range range;
+  gkyl_range_init(&range, 2, (int[]) { 1, 1 }, (int[]) { 10, 10 });
+
+  int cuts[] = { 2, 2 };
+  struct gkyl_rect_decomp *decomp = gkyl_rect_decomp_new_from_cuts(2, cuts, &range);
+
+  struct gkyl_comm *comm = gkyl_mpi_comm_new( &(struct gkyl_mpi_comm_inp) {
+      .mpi_comm = MPI_COMM_WORLD,
+      .decomp = decomp,
+      .sync_corners = true,
+    }
+  );
+
+  int nghost[] = { 1, 1 };
+  struct gkyl_range local, local_ext;
+  gkyl_create_ranges(&decomp->ranges[rank], nghost, &local_ext, &local);
+
+  struct gkyl_array *arrA = gkyl_array_new(GKYL_DOUBLE, 2, local_ext.volume);
+  struct gkyl_array *arrB = gkyl_array_new(GKYL_DOUBLE, 2, local_ext.volume);
+  gkyl_array_clear(arrA, 200005);
+  gkyl_array_clear(arrB, 200005);
+
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, &local);
+  while (gkyl_range_iter_next(&iter)) {
+    long idx = gkyl_range_idx(&local, iter.idx);
+    double *fA = gkyl_array_fetch(arrA, idx);
+    fA[0] = iter.idx[0]; fA[1] = iter.idx[1];
+    double *fB = gkyl_array_fetch(arrB, idx);
+    fB[0] = -iter.idx[0]; fB[1] = -iter.idx[1];
+  }
+
+  struct gkyl_comm_state *stA = gkyl_comm_state_new(comm);
+  struct gkyl_comm_state *stB = gkyl_comm_state_new(comm);
+
+  // two syncs in flight at the same time
+  int status = gkyl_comm_array_sync_begin(comm, &local, &local_ext, arrA, stA);
+  TEST_CHECK( status == 0 );
+  status = gkyl_comm_array_sync_begin(comm, &local, &local_ext, arrB, stB);
+  TEST_CHECK( status == 0 );
+
+  // state is busy till end is called
+  status = gkyl_comm_array_sync_begin(comm, &local, &local_ext, arrA, stA);
+  TEST_CHECK( status == 1 );
+
+  status = gkyl_comm_array_sync_end(comm, stB);
+  TEST_CHECK( status == 0 );
+  status = gkyl_comm_array_sync_end(comm, stA);
+  TEST_CHECK( status == 0 );
+
+  // nothing in flight
+  status = gkyl_comm_array_sync_end(comm, stA);
+  TEST_CHECK( status == 1 );
+
+  struct gkyl_range in_range; // interior, including ghost cells
+  gkyl_sub_range_intersect(&in_range, &local_ext, &range);
+
+  gkyl_range_iter_init(&iter, &in_range);
+  while (gkyl_range_iter_next(&iter)) {
+    long idx = gkyl_range_idx(&in_range, iter.idx);
+    const double *fA = gkyl_array_cfetch(arrA, idx);
+    const double *fB = gkyl_array_cfetch(arrB, idx);
+
+    TEST_CHECK( iter.idx[0] == fA[0] );
+    TEST_CHECK( iter.idx[1] == fA[1] );
+    TEST_CHECK( -iter.idx[0] == fB[0] );
+    TEST_CHECK( -iter.idx[1] == fB[1] );
+  }
+
+  gkyl_comm_state_release(comm, stA);
+  gkyl_comm_state_release(comm, stB);
+  gkyl_rect_decomp_release(decomp);
+  gkyl_comm_release(comm);
+  gkyl_array_release(arrA);
+  gkyl_array_release(arrB);
+}
+
 void
 mpi_n4_sync_1x1v()
 {
@@ -626,6 +714,213 @@ mpi_n2_array_isend_irecv_2d()
   gkyl_comm_release(comm);
 }
 
+void
+mpi_n4_array_write_read_2d()
+{
+  int m_sz;
+  MPI_Comm_size(MPI_COMM_WORLD, &m_sz);
+  if (m_sz != 4) return;
+
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  struct gkyl_rect_grid grid;
+  gkyl_rect_grid_init(&grid, 2, (double[]) { 0.0, 0.0 }, (double[]) { 1.0, 2.0 },
+    (int[]) { 10, 14 });
+
+  struct gkyl_range range;
+  gkyl_range_init(&range, 2, (int[]) { 1, 1 }, (int[]) { 10, 14 });
+  int nghost[] = { 1, 1 };
+
+  // write on a 2x2 decomposition ...
+  struct gkyl_rect_decomp *decomp_w = gkyl_rect_decomp_new_from_cuts(2, (int[]) { 2, 2 }, &range);
+  struct gkyl_comm *comm_w = gkyl_mpi_comm_new( &(struct gkyl_mpi_comm_inp) {
+      .mpi_comm = MPI_COMM_WORLD,
+      .decomp = decomp_w,
+    }
+  );
+
+  struct gkyl_range local_w, local_ext_w;
+  gkyl_create_ranges(&decomp_w->ranges[rank], nghost, &local_ext_w, &local_w);
+  struct gkyl_array *arr_w = gkyl_array_new(GKYL_DOUBLE, 2, local_ext_w.volume);
+
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, &local_w);
+  while (gkyl_range_iter_next(&iter)) {
+    double *f = gkyl_array_fetch(arr_w, gkyl_range_idx(&local_w, iter.idx));
+    f[0] = iter.idx[0]; f[1] = iter.idx[1];
+  }
+
+  char mstr[] = "frame 3";
+  struct gkyl_array_meta meta = { .meta_sz = sizeof mstr, .meta = mstr };
+  gkyl_comm_array_write(comm_w, &grid, &local_w, &meta, arr_w,
+    "mctest_mpi_comm_array_write_read_2d.gkyl");
+
+  // ... and read back on a 4x1 decomposition
+  struct gkyl_rect_decomp *decomp_r = gkyl_rect_decomp_new_from_cuts(2, (int[]) { 4, 1 }, &range);
+  struct gkyl_comm *comm_r = gkyl_mpi_comm_new( &(struct gkyl_mpi_comm_inp) {
+      .mpi_comm = MPI_COMM_WORLD,
+      .decomp = decomp_r,
+    }
+  );
+
+  struct gkyl_range local_r, local_ext_r;
+  gkyl_create_ranges(&decomp_r->ranges[rank], nghost, &local_ext_r, &local_r);
+  struct gkyl_array *arr_r = gkyl_array_new(GKYL_DOUBLE, 2, local_ext_r.volume);
+  gkyl_array_clear(arr_r, 0.0);
+
+  int status = gkyl_comm_array_read(comm_r, &grid, &local_r, arr_r,
+    "mctest_mpi_comm_array_write_read_2d.gkyl");
+  TEST_CHECK( status == GKYL_ARRAY_RIO_SUCCESS );
+
+  gkyl_range_iter_init(&iter, &local_r);
+  while (gkyl_range_iter_next(&iter)) {
+    const double *f = gkyl_array_cfetch(arr_r, gkyl_range_idx(&local_r, iter.idx));
+    TEST_CHECK( f[0] == iter.idx[0] );
+    TEST_CHECK( f[1] == iter.idx[1] );
+  }
+
+  // reading on a different grid must fail on all ranks
+  struct gkyl_rect_grid grid2;
+  gkyl_rect_grid_init(&grid2, 2, (double[]) { 0.0, 0.0 }, (double[]) { 1.0, 3.0 },
+    (int[]) { 10, 14 });
+  status = gkyl_comm_array_read(comm_r, &grid2, &local_r, arr_r,
+    "mctest_mpi_comm_array_write_read_2d.gkyl");
+  TEST_CHECK( status == GKYL_ARRAY_RIO_DATA_MISMATCH );
+
+  gkyl_array_release(arr_w);
+  gkyl_array_release(arr_r);
+  gkyl_comm_release(comm_w);
+  gkyl_comm_release(comm_r);
+  gkyl_rect_decomp_release(decomp_w);
+  gkyl_rect_decomp_release(decomp_r);
+}
+
+void
+mpi_n4_array_soa_2d()
+{
+  int m_sz;
+  MPI_Comm_size(MPI_COMM_WORLD, &m_sz);
+  if (m_sz != 4) return;
+
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  struct gkyl_rect_grid grid;
+  gkyl_rect_grid_init(&grid, 2, (double[]) { 0.0, 0.0 }, (double[]) { 1.0, 2.0 },
+    (int[]) { 10, 14 });
+
+  struct gkyl_range range;
+  gkyl_range_init(&range, 2, (int[]) { 1, 1 }, (int[]) { 10, 14 });
+  int nghost[] = { 1, 1 };
+
+  // write an SoA array on a 2x2 decomposition ...
+  struct gkyl_rect_decomp *decomp_w = gkyl_rect_decomp_new_from_cuts(2, (int[]) { 2, 2 }, &range);
+  struct gkyl_comm *comm_w = gkyl_mpi_comm_new( &(struct gkyl_mpi_comm_inp) {
+      .mpi_comm = MPI_COMM_WORLD,
+      .decomp = decomp_w,
+    }
+  );
+
+  struct gkyl_range local_w, local_ext_w;
+  gkyl_create_ranges(&decomp_w->ranges[rank], nghost, &local_ext_w, &local_w);
+  struct gkyl_array *arr_w = gkyl_array_layout_new(GKYL_DOUBLE, 3, local_ext_w.volume, GKYL_ARRAY_SOA);
+  gkyl_array_clear(arr_w, 0.0);
+
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, &local_w);
+  while (gkyl_range_iter_next(&iter)) {
+    long loc = gkyl_range_idx(&local_w, iter.idx);
+    for (int c=0; c<3; ++c)
+      *(double*) gkyl_array_fetch_comp(arr_w, loc, c) = 100.0*c + 10.0*iter.idx[0] + iter.idx[1];
+  }
+
+  gkyl_comm_array_write(comm_w, &grid, &local_w, 0, arr_w,
+    "mctest_mpi_comm_array_soa_2d.gkyl");
+
+  // ... and read it back on a 4x1 decomposition, into both layouts
+  struct gkyl_rect_decomp *decomp_r = gkyl_rect_decomp_new_from_cuts(2, (int[]) { 4, 1 }, &range);
+  struct gkyl_comm *comm_r = gkyl_mpi_comm_new( &(struct gkyl_mpi_comm_inp) {
+      .mpi_comm = MPI_COMM_WORLD,
+      .decomp = decomp_r,
+    }
+  );
+
+  struct gkyl_range local_r, local_ext_r;
+  gkyl_create_ranges(&decomp_r->ranges[rank], nghost, &local_ext_r, &local_r);
+  struct gkyl_array *arr_aos = gkyl_array_new(GKYL_DOUBLE, 3, local_ext_r.volume);
+  struct gkyl_array *arr_soa = gkyl_array_layout_new(GKYL_DOUBLE, 3, local_ext_r.volume, GKYL_ARRAY_SOA);
+  gkyl_array_clear(arr_aos, 0.0);
+  gkyl_array_clear(arr_soa, 0.0);
+
+  int status = gkyl_comm_array_read(comm_r, &grid, &local_r, arr_aos,
+    "mctest_mpi_comm_array_soa_2d.gkyl");
+  TEST_CHECK( status == GKYL_ARRAY_RIO_SUCCESS );
+  status = gkyl_comm_array_read(comm_r, &grid, &local_r, arr_soa,
+    "mctest_mpi_comm_array_soa_2d.gkyl");
+  TEST_CHECK( status == GKYL_ARRAY_RIO_SUCCESS );
+
+  gkyl_range_iter_init(&iter, &local_r);
+  while (gkyl_range_iter_next(&iter)) {
+    long loc = gkyl_range_idx(&local_r, iter.idx);
+    const double *f = gkyl_array_cfetch(arr_aos, loc);
+    for (int c=0; c<3; ++c) {
+      double val = 100.0*c + 10.0*iter.idx[0] + iter.idx[1];
+      TEST_CHECK( f[c] == val );
+      TEST_CHECK( *(const double*) gkyl_array_cfetch_comp(arr_soa, loc, c) == val );
+    }
+  }
+
+  // send the SoA array to the next rank, received into an SoA array
+  // (isend/irecv) and an AoS array (send/recv)
+  int next = (rank+1) % m_sz, prev = (rank+m_sz-1) % m_sz;
+  long nelem = 50;
+  struct gkyl_array *recv_soa = gkyl_array_layout_new(GKYL_DOUBLE, 3, nelem, GKYL_ARRAY_SOA);
+  struct gkyl_array *recv_aos = gkyl_array_new(GKYL_DOUBLE, 3, nelem);
+  struct gkyl_array *send_soa = gkyl_array_layout_new(GKYL_DOUBLE, 3, nelem, GKYL_ARRAY_SOA);
+  for (long i=0; i<nelem; ++i)
+    for (int c=0; c<3; ++c)
+      *(double*) gkyl_array_fetch_comp(send_soa, i, c) = 1000.0*rank + 10.0*i + c;
+
+  struct gkyl_comm_state *cstate_s = gkyl_comm_state_new(comm_r);
+  struct gkyl_comm_state *cstate_r = gkyl_comm_state_new(comm_r);
+  gkyl_comm_array_irecv(comm_r, recv_soa, prev, 21, cstate_r);
+  gkyl_comm_array_isend(comm_r, send_soa, next, 21, cstate_s);
+  gkyl_comm_state_wait(comm_r, cstate_r);
+  gkyl_comm_state_wait(comm_r, cstate_s);
+
+  if (rank % 2 == 0) {
+    gkyl_comm_array_send(comm_r, send_soa, next, 22);
+    gkyl_comm_array_recv(comm_r, recv_aos, prev, 22);
+  }
+  else {
+    gkyl_comm_array_recv(comm_r, recv_aos, prev, 22);
+    gkyl_comm_array_send(comm_r, send_soa, next, 22);
+  }
+
+  for (long i=0; i<nelem; ++i) {
+    const double *f = gkyl_array_cfetch(recv_aos, i);
+    for (int c=0; c<3; ++c) {
+      double val = 1000.0*prev + 10.0*i + c;
+      TEST_CHECK( *(const double*) gkyl_array_cfetch_comp(recv_soa, i, c) == val );
+      TEST_CHECK( f[c] == val );
+    }
+  }
+
+  gkyl_comm_state_release(comm_r, cstate_s);
+  gkyl_comm_state_release(comm_r, cstate_r);
+  gkyl_array_release(send_soa);
+  gkyl_array_release(recv_soa);
+  gkyl_array_release(recv_aos);
+  gkyl_array_release(arr_w);
+  gkyl_array_release(arr_aos);
+  gkyl_array_release(arr_soa);
+  gkyl_comm_release(comm_w);
+  gkyl_comm_release(comm_r);
+  gkyl_rect_decomp_release(decomp_w);
+  gkyl_rect_decomp_release(decomp_r);
+}
+
 void
 mpi_n4_multicomm_2d()
 {
@@ -736,12 +1031,15 @@ TEST_LIST = {
   {"mpi_n2_sync_1d", mpi_n2_sync_1d},
   {"mpi_n4_sync_2d_no_corner", mpi_n4_sync_2d_no_corner },
   {"mpi_n4_sync_2d_use_corner", mpi_n4_sync_2d_use_corner},
+  {"mpi_n4_sync_begin_end_2d", mpi_n4_sync_begin_end_2d},
   {"mpi_n2_sync_1x1v", mpi_n4_sync_1x1v },
   {"mpi_n1_per_sync_2d", mpi_n1_per_sync_2d },
   {"mpi_n2_per_sync_2d", mpi_n2_per_sync_2d },
   {"mpi_n2_array_send_irecv_1d", mpi_n2_array_send_irecv_1d},
   {"mpi_n2_array_isend_irecv_2d", mpi_n2_array_isend_irecv_2d},
   {"mpi_n4_multicomm_2d", mpi_n4_multicomm_2d},
+  {"mpi_n4_array_write_read_2d", mpi_n4_array_write_read_2d},
+  {"mpi_n4_array_soa_2d", mpi_n4_array_soa_2d},
   {NULL, NULL},
 };
 
@@ -65,6 +65,13 @@ array_free(const struct gkyl_ref_count *ref)
 
 struct gkyl_array*
 gkyl_array_new(enum gkyl_elem_type type, size_t ncomp, size_t size)
+{
+  return gkyl_array_layout_new(type, ncomp, size, GKYL_ARRAY_AOS);
+}
+
+struct gkyl_array*
+gkyl_array_layout_new(enum gkyl_elem_type type, size_t ncomp, size_t size,
+  enum gkyl_array_layout layout)
 {
   struct gkyl_array* arr = gkyl_malloc(sizeof(struct gkyl_array));
 
@@ -72,6 +79,7 @@ gkyl_array_new(enum gkyl_elem_type type, size_t ncomp, size_t size)
   arr->elemsz = array_elem_size[type];
   arr->ncomp = ncomp;
   arr->size = size;
+  arr->layout = layout;
   arr->flags = 0;
 
   GKYL_CLEAR_CU_ALLOC(arr->flags);
@@ -111,13 +119,29 @@ gkyl_array_is_cu_dev(const struct gkyl_array *arr)
   return GKYL_IS_CU_ALLOC(arr->flags);  
 }
 
+// Copy the first ncopy indices of SoA arrays (host only): each
+// component block is copied separately
+static void
+array_copy_soa(struct gkyl_array* dest, const struct gkyl_array* src, long ncopy)
+{
+  for (size_t c=0; c<src->ncomp; ++c)
+    memcpy(gkyl_array_fetch_comp(dest, 0, c), gkyl_array_cfetch_comp(src, 0, c),
+      ncopy*src->elemsz);
+}
+
 struct gkyl_array*
 gkyl_array_copy(struct gkyl_array* dest, const struct gkyl_array* src)
 {
   assert(dest->esznc == src->esznc);
+  assert(dest->layout == src->layout);
   
   long ncopy = src->size < dest->size ? src->size : dest->size;
 
+  if (src->layout == GKYL_ARRAY_SOA) {
+    array_copy_soa(dest, src, ncopy);
+    return dest;
+  }
+
   bool dest_is_cu_dev = gkyl_array_is_cu_dev(dest);
   bool src_is_cu_dev = gkyl_array_is_cu_dev(src);
 
@@ -143,9 +167,15 @@ struct gkyl_array*
 gkyl_array_copy_async(struct gkyl_array* dest, const struct gkyl_array* src)
 {
   assert(dest->esznc == src->esznc);
+  assert(dest->layout == src->layout);
   
   long ncopy = src->size < dest->size ? src->size : dest->size;
 
+  if (src->layout == GKYL_ARRAY_SOA) {
+    array_copy_soa(dest, src, ncopy);
+    return dest;
+  }
+
   bool dest_is_cu_dev = gkyl_array_is_cu_dev(dest);
   bool src_is_cu_dev = gkyl_array_is_cu_dev(src);
 
@@ -167,6 +197,73 @@ gkyl_array_copy_async(struct gkyl_array* dest, const struct gkyl_array* src)
   return dest;
 }
 
+// Copy n elements of size esz from src to dst, with the given strides
+// (in elements) between consecutive elements
+static void
+strided_copy(size_t esz, long n, char *dst, size_t dst_stride,
+  const char *src, size_t src_stride)
+{
+  if (esz == sizeof(uint64_t)) {
+    uint64_t *d = (uint64_t*) dst;
+    const uint64_t *s = (const uint64_t*) src;
+    for (long i=0; i<n; ++i) d[i*dst_stride] = s[i*src_stride];
+  }
+  else if (esz == sizeof(uint32_t)) {
+    uint32_t *d = (uint32_t*) dst;
+    const uint32_t *s = (const uint32_t*) src;
+    for (long i=0; i<n; ++i) d[i*dst_stride] = s[i*src_stride];
+  }
+  else {
+    for (long i=0; i<n; ++i)
+      memcpy(dst + i*dst_stride*esz, src + i*src_stride*esz, esz);
+  }
+}
+
+void
+gkyl_array_pack_elems(void *buff, const struct gkyl_array *arr, long loc, long n)
+{
+  if (arr->layout == GKYL_ARRAY_AOS) {
+    memcpy(buff, gkyl_array_cfetch(arr, loc), n*arr->esznc);
+    return;
+  }
+  for (size_t c=0; c<arr->ncomp; ++c)
+    strided_copy(arr->elemsz, n, ((char*) buff) + c*arr->elemsz, arr->ncomp,
+      gkyl_array_cfetch_comp(arr, loc, c), 1);
+}
+
+void
+gkyl_array_unpack_elems(struct gkyl_array *arr, long loc, long n, const void *buff)
+{
+  if (arr->layout == GKYL_ARRAY_AOS) {
+    memcpy(gkyl_array_fetch(arr, loc), buff, n*arr->esznc);
+    return;
+  }
+  for (size_t c=0; c<arr->ncomp; ++c)
+    strided_copy(arr->elemsz, n, gkyl_array_fetch_comp(arr, loc, c), 1,
+      ((const char*) buff) + c*arr->elemsz, arr->ncomp);
+}
+
+struct gkyl_array*
+gkyl_array_convert_layout(struct gkyl_array *dest, const struct gkyl_array *src)
+{
+  assert(dest->type == src->type && dest->ncomp == src->ncomp && dest->size == src->size);
+  assert(!gkyl_array_is_cu_dev(dest) && !gkyl_array_is_cu_dev(src));
+
+  if (dest->layout == src->layout)
+    return gkyl_array_copy(dest, src);
+
+  // transpose in blocks of indices so the strided side stays in cache
+  long nblk = 64;
+  for (long loc=0; loc<src->size; loc += nblk) {
+    long n = loc+nblk <= src->size ? nblk : src->size-loc;
+    for (size_t c=0; c<src->ncomp; ++c)
+      strided_copy(src->elemsz, n,
+        gkyl_array_fetch_comp(dest, loc, c), gkyl_array_loc_stride(dest),
+        gkyl_array_cfetch_comp(src, loc, c), gkyl_array_loc_stride(src));
+  }
+  return dest;
+}
+
 struct gkyl_array*
 gkyl_array_clone(const struct gkyl_array* src)
 {
@@ -177,6 +274,7 @@ gkyl_array_clone(const struct gkyl_array* src)
   arr->ncomp = src->ncomp;
   arr->esznc = src->esznc;
   arr->size = src->size;
+  arr->layout = src->layout;
   arr->flags = src->flags;
 
   if (GKYL_IS_CU_ALLOC(src->flags)) {
@@ -225,6 +323,7 @@ gkyl_array_cu_dev_new(enum gkyl_elem_type type, size_t ncomp, size_t size)
   arr->elemsz = array_elem_size[type];
   arr->ncomp = ncomp;
   arr->size = size;
+  arr->layout = GKYL_ARRAY_AOS;
   arr->flags = 0;
   
   GKYL_SET_CU_ALLOC(arr->flags);
@@ -273,6 +372,7 @@ gkyl_array_cu_host_new(enum gkyl_elem_type type, size_t ncomp, size_t size)
   arr->elemsz = array_elem_size[type];
   arr->ncomp = ncomp;
   arr->size = size;
+  arr->layout = GKYL_ARRAY_AOS;
   arr->flags = 0;
 
   GKYL_CLEAR_CU_ALLOC(arr->flags);
@@ -17,15 +17,86 @@ gkyl_array_copy_func_is_cu_dev(const struct gkyl_array_copy_func *bc)
   return GKYL_IS_CU_ALLOC(bc->flags);
 }
 
+// Arrays with the SoA layout (host only) are updated component by
+// component along rows of the range: cells in a row along the last
+// direction have consecutive linear indices, so each component is
+// unit stride there and the loops below vectorize over cells.
+
+#define IS_SOA(arr) ((arr)->layout == GKYL_ARRAY_SOA)
+// Index stride of 'arr', in elements
+#define LSTRIDE(arr) gkyl_array_loc_stride(arr)
+
+// Set 'rows' to the range of first cells of the rows of 'range' along
+// its last direction, returning the row length
+static long
+range_rows(const struct gkyl_range *range, struct gkyl_range *rows)
+{
+  int last = range->ndim-1;
+  gkyl_range_shorten_from_above(rows, range, last, 1);
+  return gkyl_range_shape(range, last);
+}
+
+static inline void
+row_clear(long n, double *out, size_t os, double val)
+{
+  for (long j=0; j<n; ++j)
+    out[j*os] = val;
+}
+
+static inline void
+row_shift(long n, double *out, size_t os, double a)
+{
+  for (long j=0; j<n; ++j)
+    out[j*os] += a;
+}
+
+static inline void
+row_acc(long n, double * GKYL_RESTRICT out, size_t os, double a,
+  const double * GKYL_RESTRICT inp, size_t is)
+{
+  if (os == 1 && is == 1) {
+    for (long j=0; j<n; ++j)
+      out[j] += a*inp[j];
+  }
+  else {
+    for (long j=0; j<n; ++j)
+      out[j*os] += a*inp[j*is];
+  }
+}
+
+static inline void
+row_set(long n, double *out, size_t os, double a, const double *inp, size_t is)
+{
+  // out and inp alias for scale
+  if (os == 1 && is == 1) {
+    for (long j=0; j<n; ++j)
+      out[j] = a*inp[j];
+  }
+  else {
+    for (long j=0; j<n; ++j)
+      out[j*os] = a*inp[j*is];
+  }
+}
+
 struct gkyl_array*
 gkyl_array_clear(struct gkyl_array* out, double val)
 {
-  assert(out->type == GKYL_DOUBLE);
+  assert(out->type == GKYL_DOUBLE || out->type == GKYL_FLOAT);
 
 #ifdef GKYL_HAVE_CUDA
-  if (gkyl_array_is_cu_dev(out)) {gkyl_array_clear_cu(out, val); return out; }
+  if (gkyl_array_is_cu_dev(out)) {
+    assert(out->type == GKYL_DOUBLE);
+    gkyl_array_clear_cu(out, val); return out;
+  }
 #endif
 
+  if (out->type == GKYL_FLOAT) {
+    float *out_f = out->data;
+    for (size_t i=0; i<NELM(out); ++i)
+      out_f[i] = val;
+    return out;
+  }
+
   double *out_d = out->data;
   for (size_t i=0; i<NELM(out); ++i)
     out_d[i] = val;
@@ -38,6 +109,7 @@ gkyl_array_accumulate(struct gkyl_array* out, double a,
 {
   assert(out->type == GKYL_DOUBLE);
   assert(out->size == inp->size && out->elemsz == inp->elemsz);
+  assert(out->layout == inp->layout);
 
 #ifdef GKYL_HAVE_CUDA
   assert(gkyl_array_is_cu_dev(out)==gkyl_array_is_cu_dev(inp));
@@ -63,6 +135,16 @@ gkyl_array_accumulate_offset(struct gkyl_array* out, double a,
   if (gkyl_array_is_cu_dev(out) && gkyl_array_is_cu_dev(inp)) { gkyl_array_accumulate_offset_cu(out, a, inp, coff); return out; }
 #endif
 
+  if (IS_SOA(out) || IS_SOA(inp)) {
+    long n = NCOM(out) < NCOM(inp) ? NCOM(out) : NCOM(inp);
+    int outoff = NCOM(out) < NCOM(inp) ? 0 : coff;
+    int inoff = NCOM(out) < NCOM(inp) ? coff : 0;
+    for (long c=0; c<n; ++c)
+      row_acc(out->size, gkyl_array_fetch_comp(out, 0, c+outoff), LSTRIDE(out),
+        a, gkyl_array_cfetch_comp(inp, 0, c+inoff), LSTRIDE(inp));
+    return out;
+  }
+
   double *out_d = out->data;
   const double *inp_d = inp->data;
   if (NCOM(out) < NCOM(inp)) {
@@ -85,6 +167,7 @@ gkyl_array_set(struct gkyl_array* out, double a,
 {
   assert(out->type == GKYL_DOUBLE);
   assert(out->size == inp->size && out->elemsz == inp->elemsz);
+  assert(out->layout == inp->layout);
 
 #ifdef GKYL_HAVE_CUDA
   assert(gkyl_array_is_cu_dev(out)==gkyl_array_is_cu_dev(inp));
@@ -110,6 +193,16 @@ gkyl_array_set_offset(struct gkyl_array* out, double a,
   if (gkyl_array_is_cu_dev(out)) { gkyl_array_set_offset_cu(out, a, inp, coff); return out; }
 #endif
 
+  if (IS_SOA(out) || IS_SOA(inp)) {
+    long n = NCOM(out) < NCOM(inp) ? NCOM(out) : NCOM(inp);
+    int outoff = NCOM(out) < NCOM(inp) ? 0 : coff;
+    int inoff = NCOM(out) < NCOM(inp) ? coff : 0;
+    for (long c=0; c<n; ++c)
+      row_set(out->size, gkyl_array_fetch_comp(out, 0, c+outoff), LSTRIDE(out),
+        a, gkyl_array_cfetch_comp(inp, 0, c+inoff), LSTRIDE(inp));
+    return out;
+  }
+
   double *out_d = out->data;
   const double *inp_d = inp->data;
   if (NCOM(out) < NCOM(inp)) {
@@ -147,6 +240,14 @@ gkyl_array_scale_by_cell(struct gkyl_array* out, const struct gkyl_array* a)
 
   double *out_d = out->data;
   const double *a_d = a->data;
+  if (IS_SOA(out)) {
+    for (size_t c=0; c<NCOM(out); ++c) {
+      double *out_c = gkyl_array_fetch_comp(out, 0, c);
+      for (size_t i=0; i<out->size; ++i)
+        out_c[i] = a_d[i]*out_c[i];
+    }
+    return out;
+  }
   for (size_t i=0; i<out->size; ++i)
     for (size_t c=0; c<NCOM(out); ++c)
       out_d[i*NCOM(out)+c] = a_d[i]*out_d[i*NCOM(out)+c];
@@ -162,12 +263,92 @@ gkyl_array_shiftc(struct gkyl_array* out, double a, unsigned k)
   if (gkyl_array_is_cu_dev(out)) { gkyl_array_shiftc_cu(out, a, k); return out; }
 #endif
 
+  if (IS_SOA(out)) {
+    row_shift(out->size, gkyl_array_fetch_comp(out, 0, k), 1, a);
+    return out;
+  }
+
   double *out_d = out->data;
   for (size_t i=0; i<out->size; ++i)
     out_d[i*NCOM(out)+k] = a+out_d[i*NCOM(out)+k];
   return out;
 }
 
+struct gkyl_array*
+gkyl_array_rk_combine(struct gkyl_array *out,
+  double a, const struct gkyl_array *inp0, double b, const struct gkyl_array *inp1,
+  double c, const struct gkyl_array *rhs)
+{
+  assert(out->type == GKYL_DOUBLE || out->type == GKYL_FLOAT);
+  assert(out->size == inp1->size && out->elemsz == inp1->elemsz);
+  assert(out->size == rhs->size && out->elemsz == rhs->elemsz);
+  assert(a == 0.0 || (out->size == inp0->size && out->elemsz == inp0->elemsz));
+  assert(out->layout == inp1->layout && out->layout == rhs->layout);
+  assert(a == 0.0 || out->layout == inp0->layout);
+
+#ifdef GKYL_HAVE_CUDA
+  assert(gkyl_array_is_cu_dev(out)==gkyl_array_is_cu_dev(inp1));
+  if (gkyl_array_is_cu_dev(out)) {
+    assert(out->type == GKYL_DOUBLE);
+    gkyl_array_rk_combine_cu(out, a, inp0, b, inp1, c, rhs); return out;
+  }
+#endif
+
+  if (out->type == GKYL_FLOAT) {
+    // single-precision storage: combine in double, round once on store
+    float *out_f = out->data;
+    const float *inp1_f = inp1->data, *rhs_f = rhs->data;
+    const float *inp0_f = a == 0.0 ? 0 : inp0->data;
+    for (size_t i=0; i<NELM(out); ++i) {
+      double u = b*((double) inp1_f[i] + c*(double) rhs_f[i]);
+      out_f[i] = inp0_f ? a*(double) inp0_f[i] + u : u;
+    }
+    return out;
+  }
+
+  // inputs may alias out, so no restrict qualifiers here
+  double *out_d = out->data;
+  const double *inp1_d = inp1->data, *rhs_d = rhs->data;
+  if (a == 0.0) {
+    for (size_t i=0; i<NELM(out); ++i)
+      out_d[i] = b*(inp1_d[i] + c*rhs_d[i]);
+  }
+  else {
+    const double *inp0_d = inp0->data;
+    for (size_t i=0; i<NELM(out); ++i)
+      out_d[i] = a*inp0_d[i] + b*(inp1_d[i] + c*rhs_d[i]);
+  }
+  return out;
+}
+
+struct gkyl_array*
+gkyl_array_convert(struct gkyl_array *out, const struct gkyl_array *inp)
+{
+  assert(out->type == GKYL_DOUBLE || out->type == GKYL_FLOAT);
+  assert(inp->type == GKYL_DOUBLE || inp->type == GKYL_FLOAT);
+  assert(out->size == inp->size && out->ncomp == inp->ncomp);
+  assert(out->layout == inp->layout);
+  // conversion is only done on the host
+  assert(!gkyl_array_is_cu_dev(out) && !gkyl_array_is_cu_dev(inp));
+
+  if (out->type == inp->type)
+    return gkyl_array_copy(out, inp);
+
+  if (out->type == GKYL_FLOAT) {
+    float *out_f = out->data;
+    const double *inp_d = inp->data;
+    for (size_t i=0; i<NELM(out); ++i)
+      out_f[i] = inp_d[i];
+  }
+  else {
+    double *out_d = out->data;
+    const float *inp_f = inp->data;
+    for (size_t i=0; i<NELM(out); ++i)
+      out_d[i] = inp_f[i];
+  }
+  return out;
+}
+
 void 
 gkyl_array_reduce(double *out, const struct gkyl_array *arr, enum gkyl_array_op op)
 {
@@ -193,6 +374,26 @@ gkyl_array_reduce(double *out, const struct gkyl_array *arr, enum gkyl_array_op
   long nc = NCOM(arr);
   double *arr_d = arr->data;
 
+  if (IS_SOA(arr)) {
+    for (long k=0; k<nc; ++k) {
+      const double *d = gkyl_array_cfetch_comp(arr, 0, k);
+      double r = op == GKYL_MIN ? DBL_MAX : (op == GKYL_MAX ? -DBL_MAX : 0.0);
+      switch (op) {
+        case GKYL_MIN:
+          for (size_t i=0; i<arr->size; ++i) r = fmin(r, d[i]);
+          break;
+        case GKYL_MAX:
+          for (size_t i=0; i<arr->size; ++i) r = fmax(r, d[i]);
+          break;
+        case GKYL_SUM:
+          for (size_t i=0; i<arr->size; ++i) r += d[i];
+          break;
+      }
+      out[k] = r;
+    }
+    return;
+  }
+
   switch (op) {
     case GKYL_MIN:
       for (long k=0; k<nc; ++k) out[k] = DBL_MAX;
@@ -236,6 +437,20 @@ gkyl_array_clear_range(struct gkyl_array *out, double val, const struct gkyl_ran
   long n = NCOM(out);
 
   struct gkyl_range_iter iter;
+
+  if (IS_SOA(out)) {
+    if (range->volume == 0) return out;
+    struct gkyl_range rows;
+    long len = range_rows(range, &rows);
+    gkyl_range_iter_init(&iter, &rows);
+    while (gkyl_range_iter_next(&iter)) {
+      long start = gkyl_range_idx(range, iter.idx);
+      for (long c=0; c<n; ++c)
+        row_clear(len, gkyl_array_fetch_comp(out, start, c), 1, val);
+    }
+    return out;
+  }
+
   gkyl_range_iter_init(&iter, range);
 
   while (gkyl_range_iter_next(&iter)) {
@@ -263,6 +478,21 @@ gkyl_array_accumulate_range(struct gkyl_array *out,
   long n = outnc<inpnc ? outnc : inpnc;
 
   struct gkyl_range_iter iter;
+
+  if (IS_SOA(out) || IS_SOA(inp)) {
+    if (range->volume == 0) return out;
+    struct gkyl_range rows;
+    long len = range_rows(range, &rows);
+    gkyl_range_iter_init(&iter, &rows);
+    while (gkyl_range_iter_next(&iter)) {
+      long start = gkyl_range_idx(range, iter.idx);
+      for (long c=0; c<n; ++c)
+        row_acc(len, gkyl_array_fetch_comp(out, start, c), LSTRIDE(out),
+          a, gkyl_array_cfetch_comp(inp, start, c), LSTRIDE(inp));
+    }
+    return out;
+  }
+
   gkyl_range_iter_init(&iter, range);
 
   while (gkyl_range_iter_next(&iter)) {
@@ -300,6 +530,21 @@ gkyl_array_accumulate_offset_range(struct gkyl_array *out,
   }
 
   struct gkyl_range_iter iter;
+
+  if (IS_SOA(out) || IS_SOA(inp)) {
+    if (range->volume == 0) return out;
+    struct gkyl_range rows;
+    long len = range_rows(range, &rows);
+    gkyl_range_iter_init(&iter, &rows);
+    while (gkyl_range_iter_next(&iter)) {
+      long start = gkyl_range_idx(range, iter.idx);
+      for (long c=0; c<n; ++c)
+        row_acc(len, gkyl_array_fetch_comp(out, start, c+outoff), LSTRIDE(out),
+          a, gkyl_array_cfetch_comp(inp, start, c+inoff), LSTRIDE(inp));
+    }
+    return out;
+  }
+
   gkyl_range_iter_init(&iter, range);
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(range, iter.idx);
@@ -327,6 +572,21 @@ gkyl_array_set_range(struct gkyl_array *out,
   long n = outnc<inpnc ? outnc : inpnc;
 
   struct gkyl_range_iter iter;
+
+  if (IS_SOA(out) || IS_SOA(inp)) {
+    if (range->volume == 0) return out;
+    struct gkyl_range rows;
+    long len = range_rows(range, &rows);
+    gkyl_range_iter_init(&iter, &rows);
+    while (gkyl_range_iter_next(&iter)) {
+      long start = gkyl_range_idx(range, iter.idx);
+      for (long c=0; c<n; ++c)
+        row_set(len, gkyl_array_fetch_comp(out, start, c), LSTRIDE(out),
+          a, gkyl_array_cfetch_comp(inp, start, c), LSTRIDE(inp));
+    }
+    return out;
+  }
+
   gkyl_range_iter_init(&iter, range);
 
   while (gkyl_range_iter_next(&iter)) {
@@ -364,6 +624,21 @@ gkyl_array_set_offset_range(struct gkyl_array *out,
   }
 
   struct gkyl_range_iter iter;
+
+  if (IS_SOA(out) || IS_SOA(inp)) {
+    if (range->volume == 0) return out;
+    struct gkyl_range rows;
+    long len = range_rows(range, &rows);
+    gkyl_range_iter_init(&iter, &rows);
+    while (gkyl_range_iter_next(&iter)) {
+      long start = gkyl_range_idx(range, iter.idx);
+      for (long c=0; c<n; ++c)
+        row_set(len, gkyl_array_fetch_comp(out, start, c+outoff), LSTRIDE(out),
+          a, gkyl_array_cfetch_comp(inp, start, c+inoff), LSTRIDE(inp));
+    }
+    return out;
+  }
+
   gkyl_range_iter_init(&iter, range);
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(range, iter.idx);
@@ -396,6 +671,17 @@ gkyl_array_shiftc_range(struct gkyl_array* out, double a, unsigned k, const stru
 #endif
 
   struct gkyl_range_iter iter;
+
+  if (IS_SOA(out)) {
+    if (range->volume == 0) return out;
+    struct gkyl_range rows;
+    long len = range_rows(range, &rows);
+    gkyl_range_iter_init(&iter, &rows);
+    while (gkyl_range_iter_next(&iter))
+      row_shift(len, gkyl_array_fetch_comp(out, gkyl_range_idx(range, iter.idx), k), 1, a);
+    return out;
+  }
+
   gkyl_range_iter_init(&iter, range);
 
   while (gkyl_range_iter_next(&iter)) {
@@ -431,6 +717,37 @@ gkyl_array_reduce_range(double *res,
 
   long n = NCOM(arr);
   struct gkyl_range_iter iter;
+
+  if (IS_SOA(arr)) {
+    for (long i=0; i<n; ++i)
+      res[i] = op == GKYL_MIN ? DBL_MAX : (op == GKYL_MAX ? -DBL_MAX : 0.0);
+    if (range->volume == 0) return;
+
+    struct gkyl_range rows;
+    long len = range_rows(range, &rows);
+    gkyl_range_iter_init(&iter, &rows);
+    while (gkyl_range_iter_next(&iter)) {
+      long start = gkyl_range_idx(range, iter.idx);
+      for (long i=0; i<n; ++i) {
+        const double *d = gkyl_array_cfetch_comp(arr, start, i);
+        double r = res[i];
+        switch (op) {
+          case GKYL_MIN:
+            for (long j=0; j<len; ++j) r = fmin(r, d[j]);
+            break;
+          case GKYL_MAX:
+            for (long j=0; j<len; ++j) r = fmax(r, d[j]);
+            break;
+          case GKYL_SUM:
+            for (long j=0; j<len; ++j) r += d[j];
+            break;
+        }
+        res[i] = r;
+      }
+    }
+    return;
+  }
+
   gkyl_range_iter_init(&iter, range);
 
   switch (op) {
@@ -478,7 +795,24 @@ gkyl_array_copy_range(struct gkyl_array *out,
   if (gkyl_array_is_cu_dev(out)) { gkyl_array_copy_range_cu(out, inp, range); return out; }
 #endif
 
+  assert(out->layout == inp->layout);
+
   struct gkyl_range_iter iter;
+
+  if (IS_SOA(out)) {
+    if (range->volume == 0) return out;
+    struct gkyl_range rows;
+    long len = range_rows(range, &rows);
+    gkyl_range_iter_init(&iter, &rows);
+    while (gkyl_range_iter_next(&iter)) {
+      long start = gkyl_range_idx(range, iter.idx);
+      for (size_t c=0; c<NCOM(out); ++c)
+        memcpy(gkyl_array_fetch_comp(out, start, c), gkyl_array_cfetch_comp(inp, start, c),
+          len*inp->elemsz);
+    }
+    return out;
+  }
+
   gkyl_range_iter_init(&iter, range);
 
   while (gkyl_range_iter_next(&iter)) {
@@ -493,6 +827,7 @@ gkyl_array_copy_range_to_range(struct gkyl_array *out,
   const struct gkyl_array *inp, struct gkyl_range *out_range, struct gkyl_range *inp_range)
 {
   assert(out->elemsz == inp->elemsz);
+  assert(out->layout == inp->layout);
   assert((inp_range->volume < 1) || (out_range->volume == inp_range->volume));
 
 #ifdef GKYL_HAVE_CUDA
@@ -516,7 +851,14 @@ gkyl_array_copy_range_to_range(struct gkyl_array *out,
 
     long linidx_inp = gkyl_range_idx(inp_range, iter.idx);
     long linidx_out = gkyl_range_idx(out_range, idx_out);
-    memcpy(gkyl_array_fetch(out, linidx_out), gkyl_array_cfetch(inp, linidx_inp), inp->esznc);
+    if (IS_SOA(out)) {
+      for (size_t c=0; c<NCOM(out); ++c)
+        memcpy(gkyl_array_fetch_comp(out, linidx_out, c), gkyl_array_cfetch_comp(inp, linidx_inp, c),
+          inp->elemsz);
+    }
+    else {
+      memcpy(gkyl_array_fetch(out, linidx_out), gkyl_array_cfetch(inp, linidx_inp), inp->esznc);
+    }
   }
   return out;
 }
@@ -532,6 +874,22 @@ gkyl_array_copy_to_buffer(void *data, const struct gkyl_array *arr,
 #define _F(loc) gkyl_array_cfetch(arr, loc)
 
   struct gkyl_range_iter iter;
+
+  // buffers always hold the components of a cell together
+  if (IS_SOA(arr)) {
+    if (range->volume == 0) return;
+    struct gkyl_range rows;
+    long len = range_rows(range, &rows);
+    gkyl_range_iter_init(&iter, &rows);
+    long count = 0;
+    while (gkyl_range_iter_next(&iter)) {
+      gkyl_array_pack_elems(((char*) data) + arr->esznc*count, arr,
+        gkyl_range_idx(range, iter.idx), len);
+      count += len;
+    }
+    return;
+  }
+
   gkyl_range_iter_init(&iter, range);
 
   long count = 0;
@@ -554,6 +912,21 @@ gkyl_array_copy_from_buffer(struct gkyl_array *arr,
 #define _F(loc) gkyl_array_fetch(arr, loc)
 
   struct gkyl_range_iter iter;
+
+  if (IS_SOA(arr)) {
+    if (range->volume == 0) return;
+    struct gkyl_range rows;
+    long len = range_rows(range, &rows);
+    gkyl_range_iter_init(&iter, &rows);
+    long count = 0;
+    while (gkyl_range_iter_next(&iter)) {
+      gkyl_array_unpack_elems(arr, gkyl_range_idx(range, iter.idx), len,
+        ((const char*) data) + arr->esznc*count);
+      count += len;
+    }
+    return;
+  }
+
   gkyl_range_iter_init(&iter, range);
 
   long count = 0;
@@ -565,6 +938,18 @@ gkyl_array_copy_from_buffer(struct gkyl_array *arr,
 #undef _F
 }
 
+// Apply copy function to a single-precision element. Copy functions
+// operate on doubles, so the input is promoted and the output rounded
+// back into the (single-precision) buffer.
+static void
+copy_fn_float(struct gkyl_array_copy_func *cf, size_t nc, float *out, const float *inp)
+{
+  double inp_d[nc], out_d[nc];
+  for (size_t c=0; c<nc; ++c) inp_d[c] = inp[c];
+  cf->func(nc, out_d, inp_d, cf->ctx);
+  for (size_t c=0; c<nc; ++c) out[c] = out_d[c];
+}
+
 void
 gkyl_array_copy_to_buffer_fn(void *data, const struct gkyl_array *arr,
   const struct gkyl_range *range, struct gkyl_array_copy_func *cf)
@@ -576,13 +961,26 @@ gkyl_array_copy_to_buffer_fn(void *data, const struct gkyl_array *arr,
   struct gkyl_range_iter iter;
   gkyl_range_iter_init(&iter, range);
 
+  double elem_buff[NCOM(arr)]; // components of a cell of an SoA array
+
   long count = 0;
   while (gkyl_range_iter_next(&iter)) {
     long loc = gkyl_range_idx(range, iter.idx);
 
-    const double *inp = gkyl_array_cfetch(arr, loc);
-    double *out = flat_fetch(data, arr->esznc*count);
-    cf->func(NCOM(arr), out, inp, cf->ctx);
+    const void *elem = gkyl_array_cfetch(arr, loc);
+    if (IS_SOA(arr)) {
+      gkyl_array_pack_elems(elem_buff, arr, loc, 1);
+      elem = elem_buff;
+    }
+
+    if (arr->type == GKYL_FLOAT) {
+      copy_fn_float(cf, NCOM(arr), flat_fetch(data, arr->esznc*count), elem);
+    }
+    else {
+      const double *inp = elem;
+      double *out = flat_fetch(data, arr->esznc*count);
+      cf->func(NCOM(arr), out, inp, cf->ctx);
+    }
     count += 1;
   }
 }
@@ -606,6 +1004,8 @@ gkyl_array_flip_copy_to_buffer_fn(void *data, const struct gkyl_array *arr,
 
   int uplo = range->upper[dir]+range->lower[dir];
 
+  double elem_buff[NCOM(arr)]; // components of a cell of an SoA array
+
   while (gkyl_range_iter_next(&iter)) {
     long loc = gkyl_range_idx(range, iter.idx);
 
@@ -614,8 +1014,19 @@ gkyl_array_flip_copy_to_buffer_fn(void *data, const struct gkyl_array *arr,
     
     long count = gkyl_range_idx(&buff_range, fidx);
 
-    const double *inp = gkyl_array_cfetch(arr, loc);
-    double *out = flat_fetch(data, arr->esznc*count);
-    cf->func(NCOM(arr), out, inp, cf->ctx);
+    const void *elem = gkyl_array_cfetch(arr, loc);
+    if (IS_SOA(arr)) {
+      gkyl_array_pack_elems(elem_buff, arr, loc, 1);
+      elem = elem_buff;
+    }
+
+    if (arr->type == GKYL_FLOAT) {
+      copy_fn_float(cf, NCOM(arr), flat_fetch(data, arr->esznc*count), elem);
+    }
+    else {
+      const double *inp = elem;
+      double *out = flat_fetch(data, arr->esznc*count);
+      cf->func(NCOM(arr), out, inp, cf->ctx);
+    }
   }  
 }
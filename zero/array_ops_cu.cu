@@ -111,6 +111,24 @@ gkyl_array_shiftc_cu_kernel(struct gkyl_array* out, double a, unsigned k)
     out_d[linc*out->ncomp+k] = a+out_d[linc*out->ncomp+k];
 } 
 
+__global__ void
+gkyl_array_rk_combine_cu_kernel(struct gkyl_array* out, double a, const struct gkyl_array* inp0,
+  double b, const struct gkyl_array* inp1, double c, const struct gkyl_array* rhs)
+{
+  double *out_d = (double*) out->data;
+  const double *inp1_d = (const double*) inp1->data;
+  const double *rhs_d = (const double*) rhs->data;
+  if (a == 0.0) {
+    for (unsigned long linc = START_ID; linc < NELM(out); linc += blockDim.x*gridDim.x)
+      out_d[linc] = b*(inp1_d[linc] + c*rhs_d[linc]);
+  }
+  else {
+    const double *inp0_d = (const double*) inp0->data;
+    for (unsigned long linc = START_ID; linc < NELM(out); linc += blockDim.x*gridDim.x)
+      out_d[linc] = a*inp0_d[linc] + b*(inp1_d[linc] + c*rhs_d[linc]);
+  }
+}
+
 // Host-side wrappers for array operations
 void
 gkyl_array_clear_cu(struct gkyl_array* out, double val)
@@ -162,6 +180,14 @@ gkyl_array_shiftc_cu(struct gkyl_array* out, double a, unsigned k)
   gkyl_array_shiftc_cu_kernel<<<out->nblocks, out->nthreads>>>(out->on_dev, a, k);
 }
 
+void
+gkyl_array_rk_combine_cu(struct gkyl_array* out, double a, const struct gkyl_array* inp0,
+  double b, const struct gkyl_array* inp1, double c, const struct gkyl_array* rhs)
+{
+  gkyl_array_rk_combine_cu_kernel<<<out->nblocks, out->nthreads>>>(out->on_dev,
+    a, a == 0.0 ? 0 : inp0->on_dev, b, inp1->on_dev, c, rhs->on_dev);
+}
+
 // Range-based methods
 // Range-based methods need to inverse index from linc to idx.
 // Must use gkyl_sub_range_inv_idx so that linc=0 maps to idxc={1,1,...}
@@ -5,24 +5,66 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <gkyl_alloc.h>
 #include <gkyl_array_rio.h>
 #include <gkyl_elem_type_priv.h>
 
+// Number of cells of an SoA array staged at a time when reading or
+// writing: files always store the components of a cell together
+enum { SOA_CHUNK = 1024 };
+
+// Write n elements starting at loc
+static void
+array_write_elems(const struct gkyl_array *arr, long loc, long n, FILE *fp)
+{
+  if (arr->layout == GKYL_ARRAY_AOS) {
+    fwrite(gkyl_array_cfetch(arr, loc), arr->esznc*n, 1, fp);
+    return;
+  }
+
+  long nbuff = n < SOA_CHUNK ? n : SOA_CHUNK;
+  void *buff = gkyl_malloc(arr->esznc*nbuff);
+  for (long i=0; i<n; i+=nbuff) {
+    long nc = n-i < nbuff ? n-i : nbuff;
+    gkyl_array_pack_elems(buff, arr, loc+i, nc);
+    fwrite(buff, arr->esznc*nc, 1, fp);
+  }
+  gkyl_free(buff);
+}
+
+// Read n elements starting at loc: returns false on failure
+static bool
+array_read_elems(struct gkyl_array *arr, long loc, long n, FILE *fp)
+{
+  if (arr->layout == GKYL_ARRAY_AOS)
+    return 1 == fread(gkyl_array_fetch(arr, loc), arr->esznc*n, 1, fp);
+
+  bool status = true;
+  long nbuff = n < SOA_CHUNK ? n : SOA_CHUNK;
+  void *buff = gkyl_malloc(arr->esznc*nbuff);
+  for (long i=0; i<n && status; i+=nbuff) {
+    long nc = n-i < nbuff ? n-i : nbuff;
+    status = (1 == fread(buff, arr->esznc*nc, 1, fp));
+    if (status)
+      gkyl_array_unpack_elems(arr, loc+i, nc, buff);
+  }
+  gkyl_free(buff);
+  return status;
+}
+
 void
 gkyl_array_write(const struct gkyl_array *arr, FILE *fp)
 {
   uint64_t esznc = arr->esznc, size = arr->size;
   fwrite(&esznc, sizeof(uint64_t), 1, fp);
   fwrite(&size, sizeof(uint64_t), 1, fp);
-  fwrite(arr->data, arr->esznc*arr->size, 1, fp);
+  array_write_elems(arr, 0, arr->size, fp);
 }
 
 static void
 gkyl_sub_array_write_priv(const struct gkyl_range *range,
   const struct gkyl_array *arr, FILE *fp)
 {
-#define _F(loc) gkyl_array_cfetch(arr, loc)
-
   // construct skip iterator to allow writing (potentially) in chunks
   // rather than element by element or requiring a copy of data
   struct gkyl_range_skip_iter skip;
@@ -33,9 +75,8 @@ gkyl_sub_array_write_priv(const struct gkyl_range *range,
 
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(&skip.range, iter.idx);
-    fwrite(_F(start), arr->esznc*skip.delta, 1, fp);
+    array_write_elems(arr, start, skip.delta, fp);
   }
-#undef _F
 }
 
 void
@@ -58,8 +99,10 @@ gkyl_grid_sub_array_header_write_fp(const struct gkyl_rect_grid *grid,
   uint64_t version = 1;
   fwrite(&version, sizeof(uint64_t), 1, fp);
   fwrite(&hdr->file_type, sizeof(uint64_t), 1, fp);
-  uint64_t meta_size = 0; // THIS WILL CHANGE ONCE METADATA IS EMBEDDED
+  uint64_t meta_size = hdr->meta ? hdr->meta_size : 0;
   fwrite(&meta_size, sizeof(uint64_t), 1, fp);
+  if (meta_size > 0)
+    fwrite(hdr->meta, meta_size, 1, fp);
   
   // Version 0 format is used for rest of the header
   uint64_t real_type = gkyl_array_data_type[hdr->etype];
@@ -74,7 +117,7 @@ gkyl_grid_sub_array_header_write_fp(const struct gkyl_rect_grid *grid,
 
 int
 gkyl_grid_sub_array_write_fp(const struct gkyl_rect_grid *grid,
-  const struct gkyl_range *range,
+  const struct gkyl_range *range, const struct gkyl_array_meta *meta,
   const struct gkyl_array *arr, FILE *fp)
 {
   gkyl_grid_sub_array_header_write_fp(grid,
@@ -82,7 +125,9 @@ gkyl_grid_sub_array_write_fp(const struct gkyl_rect_grid *grid,
       .file_type = gkyl_file_type_int[GKYL_FIELD_DATA_FILE],
       .etype = arr->type,
       .esznc = arr->esznc,
-      .tot_cells = range->volume
+      .tot_cells = range->volume,
+      .meta_size = meta ? meta->meta_sz : 0,
+      .meta = meta ? meta->meta : 0
     },
     fp
   );
@@ -92,17 +137,94 @@ gkyl_grid_sub_array_write_fp(const struct gkyl_rect_grid *grid,
 }
 
 int
-gkyl_grid_sub_array_write(const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+gkyl_grid_sub_array_write_with_meta(const struct gkyl_rect_grid *grid,
+  const struct gkyl_range *range, const struct gkyl_array_meta *meta,
   const struct gkyl_array *arr, const char *fname)
 {
   FILE *fp = 0;
   int err;
   with_file (fp, fname, "w") {
-    err = gkyl_grid_sub_array_write_fp(grid, range, arr, fp);
+    err = gkyl_grid_sub_array_write_fp(grid, range, meta, arr, fp);
   }
   return err;
 }
 
+int
+gkyl_grid_sub_array_write(const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  const struct gkyl_array *arr, const char *fname)
+{
+  return gkyl_grid_sub_array_write_with_meta(grid, range, 0, arr, fname);
+}
+
+int
+gkyl_grid_sub_array_header_read_fp(struct gkyl_rect_grid *grid,
+  struct gkyl_array_header_info *hdr, FILE *fp)
+{
+  hdr->meta_size = 0;
+  hdr->meta = 0;
+  hdr->nrange = 0;
+
+  // Version 1 header
+  char g0[6];
+  if (1 != fread(g0, sizeof(char[5]), 1, fp)) // no trailing '\0'
+    return GKYL_ARRAY_RIO_BAD_VERSION;
+  g0[5] = '\0'; // add the NULL
+  if (strcmp(g0, "gkyl0") != 0)
+    return GKYL_ARRAY_RIO_BAD_VERSION;
+
+  uint64_t version;
+  if (1 != fread(&version, sizeof(uint64_t), 1, fp))
+    return GKYL_ARRAY_RIO_FREAD_FAILED;
+  if (version != 1)
+    return GKYL_ARRAY_RIO_BAD_VERSION;
+
+  if (1 != fread(&hdr->file_type, sizeof(uint64_t), 1, fp))
+    return GKYL_ARRAY_RIO_FREAD_FAILED;
+  if (1 != fread(&hdr->meta_size, sizeof(uint64_t), 1, fp))
+    return GKYL_ARRAY_RIO_FREAD_FAILED;
+
+  if (hdr->meta_size > 0) {
+    hdr->meta = gkyl_malloc(hdr->meta_size);
+    if (1 != fread(hdr->meta, hdr->meta_size, 1, fp)) {
+      gkyl_array_header_info_release(hdr);
+      return GKYL_ARRAY_RIO_FREAD_FAILED;
+    }
+  }
+
+  // Version 0 format is used for rest of the header
+  int status = GKYL_ARRAY_RIO_SUCCESS;
+  uint64_t real_type = 0;
+  if (1 != fread(&real_type, sizeof(uint64_t), 1, fp))
+    status = GKYL_ARRAY_RIO_FREAD_FAILED;
+  else if (real_type > 3 && real_type != 32)
+    status = GKYL_ARRAY_RIO_DATA_MISMATCH;
+  else if (!gkyl_rect_grid_read(grid, fp))
+    status = GKYL_ARRAY_RIO_FREAD_FAILED;
+  else if (1 != fread(&hdr->esznc, sizeof(uint64_t), 1, fp))
+    status = GKYL_ARRAY_RIO_FREAD_FAILED;
+  else if (1 != fread(&hdr->tot_cells, sizeof(uint64_t), 1, fp))
+    status = GKYL_ARRAY_RIO_FREAD_FAILED;
+  else if (hdr->file_type == gkyl_file_type_int[GKYL_MULTI_RANGE_DATA_FILE])
+    if (1 != fread(&hdr->nrange, sizeof(uint64_t), 1, fp))
+      status = GKYL_ARRAY_RIO_FREAD_FAILED;
+
+  if (status == GKYL_ARRAY_RIO_SUCCESS)
+    hdr->etype = gkyl_array_code_to_data_type[real_type];
+  else
+    gkyl_array_header_info_release(hdr);
+
+  return status;
+}
+
+void
+gkyl_array_header_info_release(struct gkyl_array_header_info *hdr)
+{
+  if (hdr->meta)
+    gkyl_free(hdr->meta);
+  hdr->meta = 0;
+  hdr->meta_size = 0;
+}
+
 struct gkyl_array*
 gkyl_array_new_from_file(enum gkyl_elem_type type, FILE *fp)
 {
@@ -126,8 +248,6 @@ gkyl_array_new_from_file(enum gkyl_elem_type type, FILE *fp)
 bool
 gkyl_sub_array_read(const struct gkyl_range *range, struct gkyl_array *arr, FILE *fp)
 {
-#define _F(loc) gkyl_array_fetch(arr, loc)
-  
   uint64_t esznc, size;
   if (1 != fread(&esznc, sizeof(uint64_t), 1, fp))
     return false;
@@ -147,55 +267,121 @@ gkyl_sub_array_read(const struct gkyl_range *range, struct gkyl_array *arr, FILE
 
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(&skip.range, iter.idx);
-    if (1 != fread(_F(start), arr->esznc*skip.delta, 1, fp))
+    if (!array_read_elems(arr, start, skip.delta, fp))
       return false;
   }
 
   return true;
-#undef _F
 }
 
-int
-gkyl_grid_sub_array_read(struct gkyl_rect_grid *grid, const struct gkyl_range *range,
-  struct gkyl_array *arr, const char* fname)
+// Read the cells of 'range' that lie inside block 'blk'. The data for
+// blk is stored in fp, starting at the current file position, in
+// row-major order. Data is read one row (of the intersection) at a
+// time. On return the file position is at the end of the block data.
+static int
+sub_array_read_block(const struct gkyl_range *blk, const struct gkyl_range *range,
+  struct gkyl_array *arr, FILE *fp)
 {
-  FILE *fp = 0;
-  with_file (fp, fname, "r") {
-
-    size_t frr;
-    // Version 1 header
-    
-    char g0[6];
-    frr = fread(g0, sizeof(char[5]), 1, fp); // no trailing '\0'
-    g0[5] = '\0'; // add the NULL
-    if (strcmp(g0, "gkyl0") != 0)
-      return 1;
+  off_t blk_start = ftello(fp);
+  size_t esznc = arr->esznc;
+  
+  struct gkyl_range inter;
+  if (gkyl_range_intersect(&inter, blk, range)) {
+    int last = inter.ndim-1;
+    long nrow = inter.upper[last]-inter.lower[last]+1;
+    long blk_zero = gkyl_range_idx(blk, blk->lower);
+
+    struct gkyl_range_iter iter;
+    gkyl_range_iter_init(&iter, &inter);
+    while (gkyl_range_iter_next(&iter)) {
+      if (iter.idx[last] != inter.lower[last]) continue; // only start of rows
+
+      long boff = gkyl_range_idx(blk, iter.idx) - blk_zero;
+      if (0 != fseeko(fp, blk_start + boff*esznc, SEEK_SET))
+        return GKYL_ARRAY_RIO_FREAD_FAILED;
+      long loc = gkyl_range_idx(range, iter.idx);
+      if (!array_read_elems(arr, loc, nrow, fp))
+        return GKYL_ARRAY_RIO_FREAD_FAILED;
+    }
+  }
+  if (0 != fseeko(fp, blk_start + blk->volume*esznc, SEEK_SET))
+    return GKYL_ARRAY_RIO_FREAD_FAILED;
+  return GKYL_ARRAY_RIO_SUCCESS;
+}
 
-    uint64_t version;
-    frr = fread(&version, sizeof(uint64_t), 1, fp);
-    if (version != 1)
-      return 1;
+static int
+grid_sub_array_read_fp(struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  struct gkyl_array *arr, FILE *fp)
+{
+  struct gkyl_array_header_info hdr;
+  int status = gkyl_grid_sub_array_header_read_fp(grid, &hdr, fp);
+  if (status != GKYL_ARRAY_RIO_SUCCESS)
+    return status;
+  gkyl_array_header_info_release(&hdr); // meta-data not needed here
+
+  if ((hdr.esznc != arr->esznc) || (grid->ndim != range->ndim))
+    return GKYL_ARRAY_RIO_DATA_MISMATCH;
+
+  // global range on which data in the file is indexed
+  int lower[GKYL_MAX_DIM], upper[GKYL_MAX_DIM];
+  for (int d=0; d<grid->ndim; ++d) {
+    lower[d] = 1;
+    upper[d] = grid->cells[d];
+  }
+  struct gkyl_range global;
+  gkyl_range_init(&global, grid->ndim, lower, upper);
+
+  if (hdr.file_type == gkyl_file_type_int[GKYL_FIELD_DATA_FILE]) {
+    if (hdr.tot_cells == range->volume) {
+      // data fills range exactly: read it in order
+      struct gkyl_range blk;
+      gkyl_range_init(&blk, range->ndim, range->lower, range->upper);
+      return sub_array_read_block(&blk, range, arr, fp);
+    }
+    if (hdr.tot_cells != global.volume)
+      return GKYL_ARRAY_RIO_DATA_MISMATCH;
+    return sub_array_read_block(&global, range, arr, fp);
+  }
 
-    uint64_t file_type;
-    frr = fread(&file_type, sizeof(uint64_t), 1, fp);
-    if (file_type != 1)
-      return 1;
+  if (hdr.file_type == gkyl_file_type_int[GKYL_MULTI_RANGE_DATA_FILE]) {
+    for (uint64_t r=0; r<hdr.nrange; ++r) {
+      uint64_t loidx[GKYL_MAX_DIM], upidx[GKYL_MAX_DIM], sz;
+      if (grid->ndim != fread(loidx, sizeof(uint64_t), grid->ndim, fp))
+        return GKYL_ARRAY_RIO_FREAD_FAILED;
+      if (grid->ndim != fread(upidx, sizeof(uint64_t), grid->ndim, fp))
+        return GKYL_ARRAY_RIO_FREAD_FAILED;
+      if (1 != fread(&sz, sizeof(uint64_t), 1, fp))
+        return GKYL_ARRAY_RIO_FREAD_FAILED;
+
+      for (int d=0; d<grid->ndim; ++d) {
+        lower[d] = loidx[d];
+        upper[d] = upidx[d];
+      }
+      struct gkyl_range blk;
+      gkyl_range_init(&blk, grid->ndim, lower, upper);
+      if (blk.volume != sz)
+        return GKYL_ARRAY_RIO_DATA_MISMATCH;
+
+      status = sub_array_read_block(&blk, range, arr, fp);
+      if (status != GKYL_ARRAY_RIO_SUCCESS)
+        return status;
+    }
+    return GKYL_ARRAY_RIO_SUCCESS;
+  }
 
-    uint64_t meta_size;
-    frr = fread(&meta_size, sizeof(uint64_t), 1, fp);
+  return GKYL_ARRAY_RIO_DATA_MISMATCH;
+}
 
-    // read ahead by specified bytes: meta-data is not read in this
-    // method
-    fseek(fp, meta_size, SEEK_CUR);
-    
-    uint64_t real_type = 0;
-    if (1 != fread(&real_type, sizeof(uint64_t), 1, fp))
-      break;
-    
-    gkyl_rect_grid_read(grid, fp);
-    gkyl_sub_array_read(range, arr, fp);
-  }
-  return errno;  
+int
+gkyl_grid_sub_array_read(struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  struct gkyl_array *arr, const char* fname)
+{
+  FILE *fp = fopen(fname, "r");
+  if (!fp)
+    return GKYL_ARRAY_RIO_FOPEN_FAILED;
+  int status = grid_sub_array_read_fp(grid, range, arr, fp);
+  fclose(fp);
+  return status;
 }
 
 struct gkyl_array*
@@ -1,6 +1,8 @@
 #include <gkyl_alloc.h>
 #include <gkyl_block_topo.h>
 
+#include <math.h>
+
 // for use in consistency checking
 static const enum gkyl_oriented_edge complimentary_edges[] = {
   [0] = 0, // can't happen for fully-specified edges
@@ -59,6 +61,50 @@ gkyl_block_topo_check_consistency(const struct gkyl_block_topo *btopo)
   return 1;
 }
 
+double
+gkyl_block_topo_partition(const struct gkyl_block_topo *btopo,
+  const double *cost, int num_ranks, int *rank)
+{
+  int nblocks = btopo->num_blocks;
+  double *load = gkyl_calloc(num_ranks, sizeof(double));
+  bool *has_nbr = gkyl_malloc(num_ranks*sizeof(bool));
+  
+  for (int i=0; i<nblocks; ++i) rank[i] = -1;
+
+  for (int n=0; n<nblocks; ++n) {
+    // most expensive block not yet assigned (lowest ID among equals)
+    int b = -1;
+    for (int i=0; i<nblocks; ++i)
+      if (rank[i] < 0 && (b < 0 || cost[i] > cost[b]))
+        b = i;
+
+    for (int r=0; r<num_ranks; ++r) has_nbr[r] = false;
+    for (int d=0; d<btopo->ndim; ++d) {
+      const struct gkyl_target_edge *te = btopo->conn[b].connections[d];
+      for (int e=0; e<2; ++e)
+        if (te[e].edge != GKYL_PHYSICAL && rank[te[e].bid] >= 0)
+          has_nbr[rank[te[e].bid]] = true;
+    }
+
+    int best = 0;
+    for (int r=1; r<num_ranks; ++r)
+      if (load[r] < load[best] || (load[r] == load[best] && has_nbr[r] && !has_nbr[best]))
+        best = r;
+
+    rank[b] = best;
+    load[best] += cost[b];
+  }
+
+  double max_load = 0.0;
+  for (int r=0; r<num_ranks; ++r)
+    max_load = fmax(max_load, load[r]);
+
+  gkyl_free(has_nbr);
+  gkyl_free(load);
+
+  return max_load;
+}
+
 void
 gkyl_block_topo_release(struct gkyl_block_topo* btopo)
 {
@@ -7,6 +7,8 @@
 #include <gkyl_mat.h>
 #include <gkyl_util.h>
 
+#include <string.h>
+
 gkyl_dg_bin_op_mem*
 gkyl_dg_bin_op_mem_new(size_t nbatch, size_t neqn)
 {
@@ -20,6 +22,13 @@ gkyl_dg_bin_op_mem_new(size_t nbatch, size_t neqn)
   mem->xs = gkyl_nmat_new(nbatch, neqn, 1);
   mem->lu_mem = gkyl_nmat_linsolve_lu_new(mem->As->num, mem->As->nr);
 
+  mem->lu_valid = false;
+  mem->div_set_op = 0;
+  mem->num_cached = 0;
+  mem->LUs = 0; // allocated on first division
+  mem->rop_cache = gkyl_malloc(sizeof(double[nbatch*neqn]));
+  mem->rhs_mask = gkyl_malloc(sizeof(double[nbatch*neqn]));
+
   return mem;
 }
 
@@ -36,6 +45,12 @@ gkyl_dg_bin_op_mem_cu_dev_new(size_t nbatch, size_t neqn)
   mem->xs = gkyl_nmat_cu_dev_new(nbatch, neqn, 1);
   mem->lu_mem = gkyl_nmat_linsolve_lu_cu_dev_new(mem->As->num, mem->As->nr);
 
+  mem->lu_valid = false;
+  mem->div_set_op = 0;
+  mem->num_cached = 0;
+  mem->LUs = 0;
+  mem->rop_cache = mem->rhs_mask = 0;
+
   return mem;
 }
 
@@ -45,6 +60,10 @@ gkyl_dg_bin_op_mem_release(gkyl_dg_bin_op_mem *mem)
   gkyl_nmat_release(mem->As);
   gkyl_nmat_release(mem->xs);
   gkyl_nmat_linsolve_lu_release(mem->lu_mem);
+  if (mem->LUs)
+    gkyl_nmat_release(mem->LUs);
+  gkyl_free(mem->rop_cache);
+  gkyl_free(mem->rhs_mask);
   
   if (mem->on_gpu)
     gkyl_cu_free(mem);
@@ -279,74 +298,76 @@ void gkyl_dg_mul_conf_phase_op_range(struct gkyl_basis *cbasis,
   }
 }
 
-// division
-void
-gkyl_dg_div_op(gkyl_dg_bin_op_mem *mem, struct gkyl_basis basis,
-  int c_oop, struct gkyl_array* out,
-  int c_lop, const struct gkyl_array* lop,
-  int c_rop, const struct gkyl_array* rop)
+// Returns true if the cached LU factors in mem were computed with
+// the same kernel from the same denominator in each cell of range
+static bool
+div_cache_is_valid(const struct gkyl_dg_bin_op_mem *mem, div_set_op_t div_set_op,
+  int num_basis, int c_rop, const struct gkyl_array* rop, const struct gkyl_range *range)
 {
-#ifdef GKYL_HAVE_CUDA
-  if (gkyl_array_is_cu_dev(out)) {
-    return gkyl_dg_div_op_cu(mem, basis, c_oop, out, c_lop, lop, c_rop, rop);
-  }
-#endif
+  if (!mem->lu_valid || mem->div_set_op != div_set_op || mem->num_cached != range->volume)
+    return false;
 
-  int num_basis = basis.num_basis;
-  int ndim = basis.ndim;
-  int poly_order = basis.poly_order;
-  div_set_op_t div_set_op;
-  switch (basis.b_type) {
-    case GKYL_BASIS_MODAL_SERENDIPITY:
-      div_set_op = choose_ser_div_set_kern(ndim, poly_order);
-
-      break;
-
-    case GKYL_BASIS_MODAL_TENSOR:
-      div_set_op = choose_ten_div_set_kern(ndim, poly_order);
-      
-      break;
-
-    default:
-      assert(false);
-      break;    
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, range);
+  long count = 0;
+  while (gkyl_range_iter_next(&iter)) {
+    long loc = gkyl_range_idx(range, iter.idx);
+    const double *rop_d = gkyl_array_cfetch(rop, loc);
+    if (memcmp(rop_d+c_rop*num_basis, mem->rop_cache+count*num_basis, sizeof(double[num_basis])))
+      return false;
+    count += 1;
   }
+  return true;
+}
 
-  struct gkyl_nmat *As = mem->As;
-  struct gkyl_nmat *xs = mem->xs;
+// Build and LU-factor the division matrices for denominator rop,
+// storing them (and a copy of rop) in the cache
+static void
+div_cache_update(struct gkyl_dg_bin_op_mem *mem, div_set_op_t div_set_op,
+  int num_basis, int c_rop, const struct gkyl_array* rop, const struct gkyl_range *range)
+{
+  if (!mem->LUs)
+    mem->LUs = gkyl_nmat_new(mem->batch_sz, mem->nrows, mem->nrows);
+  
+  double ones[num_basis];
+  for (int k=0; k<num_basis; ++k) ones[k] = 1.0;
 
-  for (size_t i=0; i<out->size; ++i) {
-    
-    const double *lop_d = gkyl_array_cfetch(lop, i);
-    const double *rop_d = gkyl_array_cfetch(rop, i);
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, range);
+  long count = 0;
+  while (gkyl_range_iter_next(&iter)) {
+    long loc = gkyl_range_idx(range, iter.idx);
+    const double *rop_d = gkyl_array_cfetch(rop, loc);
 
-    struct gkyl_mat A = gkyl_nmat_get(As, i);
-    struct gkyl_mat x = gkyl_nmat_get(xs, i);
+    struct gkyl_mat A = gkyl_nmat_get(mem->LUs, count);
+    struct gkyl_mat x = gkyl_nmat_get(mem->xs, count);
     gkyl_mat_clear(&A, 0.0); gkyl_mat_clear(&x, 0.0);
-    div_set_op(&A, &x, lop_d+c_lop*num_basis, rop_d+c_rop*num_basis);
+    // with a numerator of all ones the RHS is the mask of numerator
+    // coefficients the kernel keeps in this cell
+    div_set_op(&A, &x, ones, rop_d+c_rop*num_basis);
+
+    memcpy(mem->rop_cache+count*num_basis, rop_d+c_rop*num_basis, sizeof(double[num_basis]));
+    memcpy(mem->rhs_mask+count*num_basis, x.data, sizeof(double[num_basis]));
+    count += 1;
   }
 
-  bool status = gkyl_nmat_linsolve_lu_pa(mem->lu_mem, As, xs);
+  // range may have fewer cells than mem was allocated for
+  struct gkyl_nmat LUs = *mem->LUs;
+  LUs.num = range->volume;
+  bool status = gkyl_nmat_lu_factor_pa(mem->lu_mem, &LUs);
   assert(status);
 
-  for (size_t i=0; i<out->size; ++i) {
-    double *out_d = gkyl_array_fetch(out, i);
-    struct gkyl_mat x = gkyl_nmat_get(xs, i);
-    binop_div_copy_sol(&x, out_d+c_oop*num_basis);
-  }
+  mem->lu_valid = status;
+  mem->div_set_op = div_set_op;
+  mem->num_cached = range->volume;
 }
 
-void gkyl_dg_div_op_range(gkyl_dg_bin_op_mem *mem, struct gkyl_basis basis,
+static void
+div_op_range_ho(gkyl_dg_bin_op_mem *mem, struct gkyl_basis basis,
   int c_oop, struct gkyl_array* out,
   int c_lop, const struct gkyl_array* lop,
   int c_rop, const struct gkyl_array* rop, const struct gkyl_range *range)
 {
-#ifdef GKYL_HAVE_CUDA
-  if (gkyl_array_is_cu_dev(out)) {
-    return gkyl_dg_div_op_range_cu(mem, basis, c_oop, out, c_lop, lop, c_rop, rop, range);
-  }
-#endif
-
   int num_basis = basis.num_basis;
   int ndim = basis.ndim;
   int poly_order = basis.poly_order;
@@ -366,9 +387,11 @@ void gkyl_dg_div_op_range(gkyl_dg_bin_op_mem *mem, struct gkyl_basis basis,
       assert(false);
       break;    
   }
+  assert(range->volume <= mem->batch_sz);
+
+  if (!div_cache_is_valid(mem, div_set_op, num_basis, c_rop, rop, range))
+    div_cache_update(mem, div_set_op, num_basis, c_rop, rop, range);
 
-  // allocate memory for use in kernels
-  struct gkyl_nmat *As = mem->As;
   struct gkyl_nmat *xs = mem->xs;
 
   struct gkyl_range_iter iter;
@@ -377,20 +400,19 @@ void gkyl_dg_div_op_range(gkyl_dg_bin_op_mem *mem, struct gkyl_basis basis,
   while (gkyl_range_iter_next(&iter)) {
     long loc = gkyl_range_idx(range, iter.idx);
 
-    const double *lop_d = gkyl_array_cfetch(lop, loc);
-    const double *rop_d = gkyl_array_cfetch(rop, loc);
+    const double *lop_d = gkyl_array_cfetch(lop, loc) + c_lop*num_basis;
+    const double *mask = mem->rhs_mask + count*num_basis;
 
-    struct gkyl_mat A = gkyl_nmat_get(As, count);
     struct gkyl_mat x = gkyl_nmat_get(xs, count);
-    gkyl_mat_clear(&A, 0.0); gkyl_mat_clear(&x, 0.0); 
-
-    div_set_op(&A, &x, lop_d+c_lop*num_basis, rop_d+c_rop*num_basis);
+    for (int k=0; k<num_basis; ++k)
+      x.data[k] = mask[k]*lop_d[k];
 
     count += 1;
   }
 
-  bool status = gkyl_nmat_linsolve_lu_pa(mem->lu_mem, As, xs);
-  assert(status);
+  struct gkyl_nmat LUs = *mem->LUs;
+  LUs.num = range->volume;
+  gkyl_nmat_lu_solve_pa(mem->lu_mem, &LUs, xs);
 
   gkyl_range_iter_init(&iter, range);
   count = 0;
@@ -405,6 +427,39 @@ void gkyl_dg_div_op_range(gkyl_dg_bin_op_mem *mem, struct gkyl_basis basis,
   }
 }
 
+// division
+void
+gkyl_dg_div_op(gkyl_dg_bin_op_mem *mem, struct gkyl_basis basis,
+  int c_oop, struct gkyl_array* out,
+  int c_lop, const struct gkyl_array* lop,
+  int c_rop, const struct gkyl_array* rop)
+{
+#ifdef GKYL_HAVE_CUDA
+  if (gkyl_array_is_cu_dev(out)) {
+    return gkyl_dg_div_op_cu(mem, basis, c_oop, out, c_lop, lop, c_rop, rop);
+  }
+#endif
+
+  // linear index of cell i in this range is just i
+  struct gkyl_range range;
+  gkyl_range_init(&range, 1, (int[]) { 0 }, (int[]) { out->size-1 });
+  div_op_range_ho(mem, basis, c_oop, out, c_lop, lop, c_rop, rop, &range);
+}
+
+void gkyl_dg_div_op_range(gkyl_dg_bin_op_mem *mem, struct gkyl_basis basis,
+  int c_oop, struct gkyl_array* out,
+  int c_lop, const struct gkyl_array* lop,
+  int c_rop, const struct gkyl_array* rop, const struct gkyl_range *range)
+{
+#ifdef GKYL_HAVE_CUDA
+  if (gkyl_array_is_cu_dev(out)) {
+    return gkyl_dg_div_op_range_cu(mem, basis, c_oop, out, c_lop, lop, c_rop, rop, range);
+  }
+#endif
+
+  div_op_range_ho(mem, basis, c_oop, out, c_lop, lop, c_rop, rop, range);
+}
+
 void
 gkyl_dg_calc_op_range(struct gkyl_basis basis, int c_oop, struct gkyl_array *out,
   int c_iop, const struct gkyl_array *iop,
@@ -424,6 +479,8 @@ gkyl_dg_calc_op_range(struct gkyl_basis basis, int c_oop, struct gkyl_array *out
   double fact = // factor for rescaling return value of op_func
     op == GKYL_DG_OP_MEAN ? sqrt(pow(2,ndim)) : pow(2,ndim);
 
+  double iop_p[num_basis]; // promoted data for GKYL_FLOAT input
+
   struct gkyl_range_iter iter;
   gkyl_range_iter_init(&iter, &range);
 
@@ -431,10 +488,16 @@ gkyl_dg_calc_op_range(struct gkyl_basis basis, int c_oop, struct gkyl_array *out
     long loc = gkyl_range_idx(&range, iter.idx);
 
     const double *iop_d = gkyl_array_cfetch(iop, loc);
+    iop_d += c_iop*num_basis;
+    if (iop->type == GKYL_FLOAT) {
+      // single-precision storage: promote the component to double
+      const float *iop_f = gkyl_array_cfetch(iop, loc);
+      for (int k=0; k<num_basis; ++k) iop_p[k] = iop_f[c_iop*num_basis+k];
+      iop_d = iop_p;
+    }
     double *out_d = gkyl_array_fetch(out, loc);
 
-    out_d[c_oop] =
-      op_func(num_basis, iop_d+c_iop*num_basis)/fact;
+    out_d[c_oop] = op_func(num_basis, iop_d)/fact;
   }  
 }
 
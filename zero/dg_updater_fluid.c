@@ -65,6 +65,14 @@ gkyl_dg_updater_fluid_advance(gkyl_dg_updater_fluid *fluid,
   fluid->fluid_tm += gkyl_time_diff_now_sec(wst);
 }
 
+void
+gkyl_dg_updater_fluid_set_job_pool(gkyl_dg_updater_fluid *fluid,
+  const struct gkyl_job_pool *job_pool)
+{
+  if (!fluid->use_gpu)
+    gkyl_hyper_dg_set_job_pool(fluid->up_fluid, job_pool);
+}
+
 struct gkyl_dg_updater_fluid_tm
 gkyl_dg_updater_fluid_get_tm(const gkyl_dg_updater_fluid *fluid)
 {
@@ -64,6 +64,16 @@ gkyl_dg_updater_lbo_vlasov_advance(struct gkyl_dg_updater_collisions *lbo,
   lbo->diff_tm += gkyl_time_diff_now_sec(wst);
 }
 
+void
+gkyl_dg_updater_lbo_vlasov_set_job_pool(struct gkyl_dg_updater_collisions *lbo,
+  const struct gkyl_job_pool *job_pool)
+{
+  if (!lbo->use_gpu) {
+    gkyl_hyper_dg_set_job_pool(lbo->drag, job_pool);
+    gkyl_hyper_dg_set_job_pool(lbo->diff, job_pool);
+  }
+}
+
 struct gkyl_dg_updater_lbo_vlasov_tm
 gkyl_dg_updater_lbo_vlasov_get_tm(const gkyl_dg_updater_collisions *coll)
 {
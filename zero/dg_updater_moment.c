@@ -77,6 +77,16 @@ gkyl_dg_updater_moment_new(const struct gkyl_rect_grid *grid,
   return up;
 }
 
+void
+gkyl_dg_updater_moment_set_job_pool(struct gkyl_dg_updater_moment *moment,
+  const struct gkyl_job_pool *job_pool, bool deterministic)
+{
+  if (!moment->use_gpu) {
+    gkyl_mom_calc_set_job_pool(moment->up_moment, job_pool);
+    gkyl_mom_calc_set_deterministic(moment->up_moment, deterministic);
+  }
+}
+
 void
 gkyl_dg_updater_moment_advance(struct gkyl_dg_updater_moment *moment,
   const struct gkyl_range *update_phase_rng, const struct gkyl_range *update_conf_rng,
@@ -63,6 +63,13 @@ gkyl_dg_updater_vlasov_new(const struct gkyl_rect_grid *grid,
   }
   up->up_vlasov = gkyl_hyper_dg_new(grid, pbasis, up->eqn_vlasov, num_up_dirs, up_dirs, zero_flux_flags, 1, up->use_gpu);
 
+  // vectorized multi-cell volume kernels on the CPU, when available
+  if (!up->use_gpu && up->model_id != GKYL_MODEL_SR && up->model_id != GKYL_MODEL_CANONICAL_PB) {
+    int batch_size;
+    vol_batch_termf_t vol_batch_term = gkyl_vlasov_vol_batch_term(up->eqn_vlasov, &batch_size);
+    gkyl_hyper_dg_set_vol_batch(up->up_vlasov, vol_batch_term, batch_size);
+  }
+
   up->vlasov_tm = 0.0;
   
   return up;
@@ -81,6 +88,37 @@ gkyl_dg_updater_vlasov_advance(gkyl_dg_updater_vlasov *vlasov,
   vlasov->vlasov_tm += gkyl_time_diff_now_sec(wst);
 }
 
+void
+gkyl_dg_updater_vlasov_set_job_pool(gkyl_dg_updater_vlasov *vlasov,
+  const struct gkyl_job_pool *job_pool)
+{
+  if (!vlasov->use_gpu)
+    gkyl_hyper_dg_set_job_pool(vlasov->up_vlasov, job_pool);
+}
+
+void
+gkyl_dg_updater_vlasov_set_kernel_stat(gkyl_dg_updater_vlasov *vlasov, bool on)
+{
+  if (!vlasov->use_gpu)
+    gkyl_hyper_dg_set_kernel_stat(vlasov->up_vlasov, on);
+}
+
+void
+gkyl_dg_updater_vlasov_set_fused_moms(gkyl_dg_updater_vlasov *vlasov,
+  const struct gkyl_hyper_dg_fused_moms *fmom)
+{
+  if (!vlasov->use_gpu)
+    gkyl_hyper_dg_set_fused_moms(vlasov->up_vlasov, fmom);
+}
+
+struct gkyl_hyper_dg_kernel_stat
+gkyl_dg_updater_vlasov_get_kernel_stat(const gkyl_dg_updater_vlasov *vlasov)
+{
+  if (vlasov->use_gpu)
+    return (struct gkyl_hyper_dg_kernel_stat) { 0 };
+  return gkyl_hyper_dg_get_kernel_stat(vlasov->up_vlasov);
+}
+
 struct gkyl_dg_updater_vlasov_tm
 gkyl_dg_updater_vlasov_get_tm(const gkyl_dg_updater_vlasov *vlasov)
 {
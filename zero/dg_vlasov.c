@@ -40,6 +40,89 @@ gkyl_vlasov_set_auxfields(const struct gkyl_dg_eqn *eqn, struct gkyl_dg_vlasov_a
   vlasov->auxfields.alpha_geo = auxin.alpha_geo; // alpha^i (e^i . alpha) used in surface term if general geometry enabled
 }
 
+void
+gkyl_vlasov_set_storage_type(const struct gkyl_dg_eqn *eqn, enum gkyl_elem_type type)
+{
+  assert(type == GKYL_DOUBLE || type == GKYL_FLOAT);
+  // single-precision storage is only supported on the host
+  assert(!gkyl_dg_eqn_is_cu_dev(eqn));
+
+  struct dg_vlasov *vlasov = container_of(eqn, struct dg_vlasov, eqn);
+  if (type == GKYL_FLOAT) {
+    assert(vlasov->num_basis <= VLASOV_F32_MAX_NUM_BASIS);
+    vlasov->eqn.vol_term = vol_f32;
+    vlasov->eqn.surf_term = surf_f32;
+    vlasov->eqn.boundary_surf_term = boundary_surf_f32;
+  }
+  else {
+    vlasov->eqn.vol_term = vlasov->vol_f64;
+    vlasov->eqn.surf_term = surf;
+    vlasov->eqn.boundary_surf_term = boundary_surf;
+  }
+}
+
+void
+gkyl_vlasov_kernel_name(const struct gkyl_dg_eqn *eqn, enum gkyl_vlasov_term term, int dir,
+  char *name, size_t sz)
+{
+  const struct dg_vlasov *vlasov = container_of(eqn, struct dg_vlasov, eqn);
+  int cdim = vlasov->cdim, vdim = vlasov->pdim-vlasov->cdim;
+  const char *dir_str[] = { "x", "y", "z" };
+  const char *basis_str = vlasov->b_type == GKYL_BASIS_MODAL_TENSOR ? "tensor" : "ser";
+  bool gen_geo = vlasov->model_id == GKYL_MODEL_GEN_GEO;
+
+  // kernel name without the "_<cdim>x<vdim>v_<basis>_p<poly_order>" suffix
+  char prefix[64] = { 0 };
+  if (term == GKYL_VLASOV_TERM_VOL) {
+    if (gen_geo)
+      snprintf(prefix, sizeof prefix, "vlasov_stream_gen_geo_vol");
+    else if (vlasov->field_id == GKYL_FIELD_NULL)
+      snprintf(prefix, sizeof prefix, "vlasov_stream_vol");
+    else if (vlasov->field_id == GKYL_FIELD_PHI)
+      snprintf(prefix, sizeof prefix, "vlasov_poisson_vol");
+    else if (vlasov->field_id == GKYL_FIELD_PHI_A)
+      snprintf(prefix, sizeof prefix, "vlasov_poisson_extem_vol");
+    else
+      snprintf(prefix, sizeof prefix, "vlasov_vol");
+  }
+  else if (dir < cdim) {
+    const char *bry = term == GKYL_VLASOV_TERM_BOUNDARY_SURF ? "boundary_" : "";
+    if (gen_geo) {
+      // general geometry has no boundary surface kernels
+      if (term == GKYL_VLASOV_TERM_BOUNDARY_SURF) {
+        snprintf(name, sz, "%s", "");
+        return;
+      }
+      snprintf(prefix, sizeof prefix, "vlasov_gen_geo_surf%s", dir_str[dir]);
+    }
+    else {
+      snprintf(prefix, sizeof prefix, "vlasov_%ssurf%s", bry, dir_str[dir]);
+    }
+  }
+  else if (dir < cdim+vdim) {
+    const char *bry = term == GKYL_VLASOV_TERM_BOUNDARY_SURF ? "boundary_" : "";
+    const char *field_str = "";
+    if (vlasov->field_id == GKYL_FIELD_PHI)
+      field_str = "poisson_";
+    else if (vlasov->field_id == GKYL_FIELD_PHI_A)
+      field_str = "poisson_extem_";
+    snprintf(prefix, sizeof prefix, "vlasov_%s%ssurfv%s", field_str, bry, dir_str[dir-cdim]);
+  }
+  snprintf(name, sz, "%s_%dx%dv_%s_p%d", prefix, cdim, vdim, basis_str, vlasov->poly_order);
+}
+
+vol_batch_termf_t
+gkyl_vlasov_vol_batch_term(const struct gkyl_dg_eqn *eqn, int *batch_size)
+{
+  assert(!gkyl_dg_eqn_is_cu_dev(eqn));
+
+  const struct dg_vlasov *vlasov = container_of(eqn, struct dg_vlasov, eqn);
+  *batch_size = GKYL_VLASOV_BATCH;
+  if (vlasov->batch_vol || vlasov->batch_stream_vol)
+    return vol_batch;
+  return 0;
+}
+
 struct gkyl_dg_eqn*
 gkyl_dg_vlasov_new(const struct gkyl_basis* cbasis, const struct gkyl_basis* pbasis,
   const struct gkyl_range* conf_range, const struct gkyl_range* phase_range,
@@ -250,6 +333,28 @@ gkyl_dg_vlasov_new(const struct gkyl_basis* cbasis, const struct gkyl_basis* pba
   vlasov->auxfields.alpha_geo = 0;
   vlasov->conf_range = *conf_range;
   vlasov->phase_range = *phase_range;
+
+  vlasov->num_basis = pbasis->num_basis;
+  vlasov->vol_f64 = vlasov->eqn.vol_term;
+  vlasov->b_type = cbasis->b_type;
+  vlasov->poly_order = poly_order;
+  vlasov->model_id = model_id;
+  vlasov->field_id = field_id;
+
+  // batched volume kernels: streaming and Vlasov-Maxwell only
+  vlasov->batch_stream_vol = 0;
+  vlasov->batch_vol = 0;
+  if (model_id == GKYL_MODEL_DEFAULT) {
+    const gkyl_dg_vlasov_batch_stream_vol_kern_list *batch_stream_vol_kernels =
+      cbasis->b_type == GKYL_BASIS_MODAL_TENSOR ? tensor_batch_stream_vol_kernels : ser_batch_stream_vol_kernels;
+    const gkyl_dg_vlasov_batch_vol_kern_list *batch_vol_kernels =
+      cbasis->b_type == GKYL_BASIS_MODAL_TENSOR ? tensor_batch_vol_kernels : ser_batch_vol_kernels;
+
+    if (field_id == GKYL_FIELD_NULL)
+      vlasov->batch_stream_vol = CK(batch_stream_vol_kernels,cdim,vdim,poly_order);
+    else if (field_id == GKYL_FIELD_E_B)
+      vlasov->batch_vol = CK(batch_vol_kernels,cdim,vdim,poly_order);
+  }
   
   vlasov->eqn.flags = 0;
   GKYL_CLEAR_CU_ALLOC(vlasov->eqn.flags);
@@ -245,6 +245,12 @@ gkyl_dg_vlasov_cu_dev_new(const struct gkyl_basis* cbasis, const struct gkyl_bas
 
   vlasov->cdim = cdim;
   vlasov->pdim = pdim;
+  vlasov->b_type = cbasis->b_type;
+  vlasov->poly_order = poly_order;
+  vlasov->model_id = model_id;
+  vlasov->field_id = field_id;
+  vlasov->batch_stream_vol = 0; // batched kernels are host only
+  vlasov->batch_vol = 0;
 
   vlasov->eqn.num_equations = 1;
   vlasov->conf_range = *conf_range;
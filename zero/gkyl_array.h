@@ -8,6 +8,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
+// Memory layout of array data
+enum gkyl_array_layout {
+  GKYL_ARRAY_AOS = 0, // ncomp components of each index stored together (default)
+  GKYL_ARRAY_SOA, // each component stored in its own block of size elements
+};
+
 /**
  * Array object. This is an untype, undimensioned, reference counted
  * array object. All additional structure is provided else where,
@@ -17,6 +23,7 @@ struct gkyl_array {
   enum gkyl_elem_type type; // type of data stored in array
   size_t elemsz, ncomp; // size of elements, number of 'components'
   size_t size; // number of indices
+  enum gkyl_array_layout layout; // memory layout of data
 
   size_t esznc; // elemsz*ncomp
   void *data; // pointer to data
@@ -42,6 +49,23 @@ struct gkyl_array {
  */
 struct gkyl_array* gkyl_array_new(enum gkyl_elem_type type, size_t ncomp, size_t size);
 
+/**
+ * Create new array with given memory layout. With GKYL_ARRAY_SOA the
+ * array stores ncomp blocks of size elements, one per component, so
+ * that loops over indices of a component are unit stride. Such arrays
+ * must be accessed with gkyl_array_fetch_comp (not gkyl_array_fetch)
+ * and are only supported on the host. Delete using gkyl_array_release
+ * method.
+ * 
+ * @param type Type of data in array
+ * @param ncomp Number of components at each index
+ * @param size Number of indices 
+ * @param layout Memory layout
+ * @return Pointer to newly allocated array.
+ */
+struct gkyl_array* gkyl_array_layout_new(enum gkyl_elem_type type, size_t ncomp, size_t size,
+  enum gkyl_array_layout layout);
+
 /**
  * Create new array with data on NV-GPU. Delete using
  * gkyl_array_release method.
@@ -99,6 +123,42 @@ struct gkyl_array* gkyl_array_copy(struct gkyl_array* dest,
 struct gkyl_array* gkyl_array_copy_async(struct gkyl_array* dest,
   const struct gkyl_array* src);
 
+/**
+ * Copy src into dest, which may have a different memory layout. The
+ * arrays must have the same element type, number of components and
+ * size. Host only.
+ *
+ * @param dest Destination for copy.
+ * @param src Source to copy from.
+ * @return dest is returned
+ */
+struct gkyl_array* gkyl_array_convert_layout(struct gkyl_array *dest,
+  const struct gkyl_array *src);
+
+/**
+ * Copy n consecutive indices, starting at loc, into a buffer with the
+ * components of each index stored together (the AoS layout). This is
+ * the layout of communication buffers and files for all arrays.
+ *
+ * @param buff Buffer of at least n*esznc bytes.
+ * @param arr Array to copy from
+ * @param loc First index to copy
+ * @param n Number of indices to copy
+ */
+void gkyl_array_pack_elems(void *buff, const struct gkyl_array *arr, long loc, long n);
+
+/**
+ * Copy n consecutive indices, starting at loc, from a buffer with the
+ * components of each index stored together (the AoS layout). Inverse
+ * of gkyl_array_pack_elems.
+ *
+ * @param arr Array to copy into
+ * @param loc First index to copy
+ * @param n Number of indices to copy
+ * @param buff Buffer of at least n*esznc bytes.
+ */
+void gkyl_array_unpack_elems(struct gkyl_array *arr, long loc, long n, const void *buff);
+
 /**
  * Clone array: pointer to newly created array is returned.
  * 
@@ -108,7 +168,9 @@ struct gkyl_array* gkyl_array_copy_async(struct gkyl_array* dest,
 struct gkyl_array* gkyl_array_clone(const struct gkyl_array* arr);
 
 /**
- * Fetches a pointer to the element stored at the index 'loc'.
+ * Fetches a pointer to the element stored at the index 'loc'. The
+ * ncomp components of the element are contiguous, so this can only be
+ * used for arrays with the (default) AoS layout.
  *
  * @param arr Array to fetch from
  * @param loc Element to fetch
@@ -129,6 +191,61 @@ gkyl_array_cfetch(const struct gkyl_array* arr, long loc)
   return ((const char*) arr->data) + loc*arr->esznc;
 }
 
+/**
+ * Distance, in elements, between consecutive components stored at an
+ * index: 1 for the AoS layout and size for the SoA layout.
+ *
+ * @param arr Array object
+ * @return Component stride
+ */
+GKYL_CU_DH
+static inline size_t
+gkyl_array_comp_stride(const struct gkyl_array* arr)
+{
+  return arr->layout == GKYL_ARRAY_SOA ? arr->size : 1;
+}
+
+/**
+ * Distance, in elements, between a component stored at consecutive
+ * indices: ncomp for the AoS layout and 1 for the SoA layout.
+ *
+ * @param arr Array object
+ * @return Index stride
+ */
+GKYL_CU_DH
+static inline size_t
+gkyl_array_loc_stride(const struct gkyl_array* arr)
+{
+  return arr->layout == GKYL_ARRAY_SOA ? 1 : arr->ncomp;
+}
+
+/**
+ * Fetches a pointer to component 'comp' stored at index 'loc', for
+ * either layout. Component k is at the returned pointer plus
+ * (k-comp)*gkyl_array_comp_stride(arr) elements.
+ *
+ * @param arr Array to fetch from
+ * @param loc Index to fetch
+ * @param comp Component to fetch
+ * @return Component 'comp' at location 'loc'
+ */
+GKYL_CU_DH
+static inline void*
+gkyl_array_fetch_comp(struct gkyl_array* arr, long loc, int comp)
+{
+  size_t off = loc*gkyl_array_loc_stride(arr) + comp*gkyl_array_comp_stride(arr);
+  return ((char*) arr->data) + off*arr->elemsz;
+}
+
+/** Same as above, except fetches a constant pointer */
+GKYL_CU_DH
+static inline const void*
+gkyl_array_cfetch_comp(const struct gkyl_array* arr, long loc, int comp)
+{
+  size_t off = loc*gkyl_array_loc_stride(arr) + comp*gkyl_array_comp_stride(arr);
+  return ((const char*) arr->data) + off*arr->elemsz;
+}
+
 /**
  * Acquire pointer to array. The pointer must be released using
  * gkyl_array_release method.
@@ -12,6 +12,11 @@ flat_fetch(void *data, size_t loc)
   return ((char*) data) + loc;
 }
 
+// Host ops below accept arrays with the SoA layout (see
+// gkyl_array_layout_new). Binary ops on whole arrays need the inputs
+// and output to share a layout; range and offset ops accept mixed
+// layouts, except the copy ops. Buffers always use the AoS layout.
+
 // Struct used to pass function pointer and context to various buffer
 // copy operators
 struct gkyl_array_copy_func {
@@ -33,7 +38,8 @@ bool
 gkyl_array_copy_func_is_cu_dev(const struct gkyl_array_copy_func *bc);
 
 /**
- * Clear out = val. Returns out.
+ * Clear out = val. Returns out. Also accepts GKYL_FLOAT arrays on
+ * the host.
  *
  * @param out Output array
  * @param val Factor to set 
@@ -119,6 +125,39 @@ struct gkyl_array* gkyl_array_scale_by_cell(struct gkyl_array *out, const struct
  */
 struct gkyl_array* gkyl_array_shiftc(struct gkyl_array *out, double a, unsigned k);
 
+/**
+ * Compute out = a*inp0 + b*(inp1 + c*rhs). This fuses a forward Euler
+ * update with the stage combination of an SSP-RK scheme, making a
+ * single pass over the data. Any of the inputs may be the same array
+ * as out. If a is 0.0, inp0 is not accessed (and may be NULL).
+ * GKYL_FLOAT arrays (host only) are combined in double precision and
+ * rounded once on store. Returns out.
+ *
+ * @param out Output array
+ * @param a Factor multiplying inp0
+ * @param inp0 First input array
+ * @param b Factor multiplying forward Euler update
+ * @param inp1 Second input array
+ * @param c Time-step multiplying rhs
+ * @param rhs Right-hand side (time derivative) of inp1
+ * @return out array
+ */
+struct gkyl_array* gkyl_array_rk_combine(struct gkyl_array *out,
+  double a, const struct gkyl_array *inp0, double b, const struct gkyl_array *inp1,
+  double c, const struct gkyl_array *rhs);
+
+/**
+ * Copy inp into out, converting between GKYL_DOUBLE and GKYL_FLOAT
+ * element types as needed. Arrays must have the same size and number
+ * of components. Only supported for arrays on the host. Returns out.
+ *
+ * @param out Output array
+ * @param inp Input array
+ * @return out array
+ */
+struct gkyl_array* gkyl_array_convert(struct gkyl_array *out,
+  const struct gkyl_array *inp);
+
 /**
  * Clear out = val. Returns out.
  *
@@ -319,6 +358,9 @@ void gkyl_array_scale_by_cell_cu(struct gkyl_array* out, const struct gkyl_array
 
 void gkyl_array_shiftc_cu(struct gkyl_array* out, double a, unsigned k);
 
+void gkyl_array_rk_combine_cu(struct gkyl_array* out, double a, const struct gkyl_array* inp0,
+  double b, const struct gkyl_array* inp1, double c, const struct gkyl_array* rhs);
+
 void gkyl_array_shiftc_range_cu(struct gkyl_array *out, double a, unsigned k, const struct gkyl_range *range);
 
 /**
@@ -5,6 +5,22 @@
 #include <gkyl_range.h>
 #include <gkyl_rect_grid.h>
 
+// Status of array read
+enum gkyl_array_rio_status {
+  GKYL_ARRAY_RIO_SUCCESS = 0,
+  GKYL_ARRAY_RIO_FOPEN_FAILED, // could not open file
+  GKYL_ARRAY_RIO_BAD_VERSION, // not a gkyl file or wrong version
+  GKYL_ARRAY_RIO_FREAD_FAILED, // read failed or file truncated
+  GKYL_ARRAY_RIO_DATA_MISMATCH, // file data incompatible with array
+};
+
+// Meta-data to embed in output files. The contents are opaque to the
+// I/O routines: apps store msgpack encoded data here.
+struct gkyl_array_meta {
+  size_t meta_sz; // size of meta-data in bytes
+  char *meta; // meta-data
+};
+
 // Array header data to write: this is for low-level control and is
 // typically not something most user would every encounter
 struct gkyl_array_header_info {
@@ -12,6 +28,9 @@ struct gkyl_array_header_info {
   enum gkyl_elem_type etype; // element type
   uint64_t esznc; // elem sz * number of components
   uint64_t tot_cells; // total number of cells in grid
+  uint64_t meta_size; // size in bytes of meta-data
+  char *meta; // meta-data (may be NULL if meta_size is 0)
+  uint64_t nrange; // number of ranges (only for multi-range files)
 };
 
 /**
@@ -49,10 +68,25 @@ int gkyl_grid_sub_array_write(const struct gkyl_rect_grid *grid,
   const struct gkyl_range *range,
   const struct gkyl_array *arr, const char *fname);
 
+/**
+ * Write out grid and array data to file in .gkyl format, embedding
+ * the specified meta-data in the file header.
+ *
+ * @param grid Grid object to write
+ * @param range Range describing portion of the array to output.
+ * @param meta Meta-data to write (may be NULL)
+ * @param arr Array object to write
+ * @param fname Name of output file (include .gkyl extension)
+ * @return Status flag: 0 if write succeeded, 'errno' otherwise
+ */
+int gkyl_grid_sub_array_write_with_meta(const struct gkyl_rect_grid *grid,
+  const struct gkyl_range *range, const struct gkyl_array_meta *meta,
+  const struct gkyl_array *arr, const char *fname);
+
 // Same as above method, except takes an open FILE pointer. @a fp must
 // be opened with right permissions.
 int gkyl_grid_sub_array_write_fp(const struct gkyl_rect_grid *grid,
-  const struct gkyl_range *range,
+  const struct gkyl_range *range, const struct gkyl_array_meta *meta,
   const struct gkyl_array *arr, FILE *fp);
 
 /**
@@ -66,6 +100,27 @@ int gkyl_grid_sub_array_write_fp(const struct gkyl_rect_grid *grid,
 int gkyl_grid_sub_array_header_write_fp(const struct gkyl_rect_grid *grid,
   struct gkyl_array_header_info *hdr, FILE *fp);
 
+/**
+ * Read grid and header data from file. On success the file position
+ * is at the start of the array data (for multi-range files, at the
+ * start of the first range). Meta-data, if present, is allocated and
+ * must be freed with gkyl_array_header_info_release.
+ *
+ * @param grid On output, grid in file
+ * @param hdr On output, header data
+ * @param fp File handle to read from.
+ * @return Status of read (see enum gkyl_array_rio_status)
+ */
+int gkyl_grid_sub_array_header_read_fp(struct gkyl_rect_grid *grid,
+  struct gkyl_array_header_info *hdr, FILE *fp);
+
+/**
+ * Free memory allocated by gkyl_grid_sub_array_header_read_fp.
+ *
+ * @param hdr Header to release
+ */
+void gkyl_array_header_info_release(struct gkyl_array_header_info *hdr);
+
 /**
  * Read data from file and create new array. 
  *
@@ -92,12 +147,19 @@ bool gkyl_sub_array_read(const struct gkyl_range *range,
 /**
  * Read grid and array data from file. The input array must be
  * pre-allocated and must be big enough to hold the read data.
- * 
+ *
+ * If the file holds exactly range->volume cells they are read into
+ * range in order. Otherwise the data in the file is assumed to be
+ * indexed by the global (1-indexed) range of the grid, and only the
+ * cells that lie in @a range are read. This works for single and
+ * multi-range files, so data written on one decomposition can be read
+ * back on a different one.
+ *
  * @param grid Grid object to read
  * @param range Range describing portion of the array.
  * @param arr Array object to read
  * @param fname Name of input file
- * @return Status flag: 0 if write succeeded, 'errno' otherwise
+ * @return Status of read (see enum gkyl_array_rio_status)
  */
 int gkyl_grid_sub_array_read(struct gkyl_rect_grid *grid, const struct gkyl_range *range,
   struct gkyl_array *arr, const char* fname);
@@ -54,6 +54,30 @@ struct gkyl_block_topo* gkyl_block_topo_new(int ndim, int nblocks);
  */
 int gkyl_block_topo_check_consistency(const struct gkyl_block_topo *btopo);
 
+/**
+ * Assign blocks to ranks, balancing the total cost of the blocks
+ * assigned to each rank. Blocks are taken in order of decreasing
+ * cost and each is assigned to the rank with the smallest total cost
+ * so far. Ties are broken in favor of a rank that already owns a
+ * neighbor of the block (to reduce communication), and then of the
+ * lowest rank. The assignment is deterministic, so all ranks compute
+ * the same one.
+ *
+ * Blocks are not split, so the largest load is at least the cost of
+ * the most expensive block: however many ranks are used, the speedup
+ * is bounded by the total cost over that of the most expensive block.
+ * When one block dominates (e.g. a refined block updated with many
+ * subcycles), the blocks must be made smaller to scale further.
+ *
+ * @param btopo Block topology
+ * @param cost Cost of updating each block
+ * @param num_ranks Number of ranks
+ * @param rank On output, rank each block is assigned to
+ * @return Largest total cost assigned to a rank
+ */
+double gkyl_block_topo_partition(const struct gkyl_block_topo *btopo,
+  const double *cost, int num_ranks, int *rank);
+
 /**
  * Free block topology.
  *
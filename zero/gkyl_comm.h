@@ -12,6 +12,7 @@
 
 // Forward declaration
 struct gkyl_comm;
+struct gkyl_array_meta;
 
 struct gkyl_comm_state;
 
@@ -48,6 +49,17 @@ typedef int (*gkyl_array_sync_t)(struct gkyl_comm *comm,
   const struct gkyl_range *local, const struct gkyl_range *local_ext,
   struct gkyl_array *array);
 
+// Start "synchronizing" @a array across the regions or blocks. The
+// sync is completed by a call to the corresponding sync_end, using
+// the same @a state.
+typedef int (*gkyl_array_sync_begin_t)(struct gkyl_comm *comm,
+  const struct gkyl_range *local, const struct gkyl_range *local_ext,
+  struct gkyl_array *array, struct gkyl_comm_state *state);
+
+// Complete "synchronization" started by sync_begin with @a state.
+typedef int (*gkyl_array_sync_end_t)(struct gkyl_comm *comm,
+  struct gkyl_comm_state *state);
+
 // "Synchronize" @a array across the periodic directions
 typedef int (*gkyl_array_per_sync_t)(struct gkyl_comm *comm,
   const struct gkyl_range *local, const struct gkyl_range *local_ext,
@@ -57,8 +69,14 @@ typedef int (*gkyl_array_per_sync_t)(struct gkyl_comm *comm,
 // Write array to specified file
 typedef int (*gkyl_array_write_t)(struct gkyl_comm *comm,
   const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  const struct gkyl_array_meta *meta,
   const struct gkyl_array *arr, const char *fname);
 
+// Read array from specified file
+typedef int (*gkyl_array_read_t)(struct gkyl_comm *comm,
+  const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  struct gkyl_array *arr, const char *fname);
+
 // Create a new communicator that extends the communicator to work on a
 // extended domain specified by erange
 typedef struct gkyl_comm* (*extend_comm_t)(const struct gkyl_comm *comm,
@@ -97,10 +115,13 @@ struct gkyl_comm {
   gkyl_array_irecv_t gkyl_array_irecv; // nonblocking recv array.
   all_reduce_t all_reduce; // all reduce function
   gkyl_array_sync_t gkyl_array_sync; // sync array
+  gkyl_array_sync_begin_t gkyl_array_sync_begin; // start sync of array
+  gkyl_array_sync_end_t gkyl_array_sync_end; // complete sync of array
   gkyl_array_per_sync_t gkyl_array_per_sync; // sync array in periodic dirs
   barrier_t barrier; // barrier
 
   gkyl_array_write_t gkyl_array_write; // array output
+  gkyl_array_read_t gkyl_array_read; // array input
   extend_comm_t extend_comm; // extend communicator
   split_comm_t split_comm; // split communicator.
 
@@ -238,6 +259,45 @@ static int gkyl_comm_array_sync(struct gkyl_comm *comm,
   return comm->gkyl_array_sync(comm, local, local_ext, array);
 }
 
+/**
+ * Start synchronizing array across domain. Skin-cell data is packed
+ * and sent, and receives into ghost-cells are posted, but the call
+ * returns without waiting for them to complete. The ghost-cells of
+ * array are only valid after gkyl_comm_array_sync_end is called with
+ * the same state object. Between the two calls the skin-cells of
+ * array must not be modified, but the interior of local can be
+ * updated. A state object can have only one sync in flight; use
+ * separate states (see gkyl_comm_state_new) for multiple arrays.
+ *
+ * @param comm Communicator
+ * @param local Local range for array: sub-range of local_ext
+ * @param local_ext Extended range, i.e. range over which array is defined
+ * @param array Array to synchronize
+ * @param state State object for this sync
+ * @return error code: 0 for success
+ */
+static int gkyl_comm_array_sync_begin(struct gkyl_comm *comm,
+  const struct gkyl_range *local,
+  const struct gkyl_range *local_ext,
+  struct gkyl_array *array, struct gkyl_comm_state *state)
+{
+  return comm->gkyl_array_sync_begin(comm, local, local_ext, array, state);
+}
+
+/**
+ * Complete synchronization started by gkyl_comm_array_sync_begin,
+ * copying received data into ghost-cells.
+ *
+ * @param comm Communicator
+ * @param state State object passed to gkyl_comm_array_sync_begin
+ * @return error code: 0 for success
+ */
+static int gkyl_comm_array_sync_end(struct gkyl_comm *comm,
+  struct gkyl_comm_state *state)
+{
+  return comm->gkyl_array_sync_end(comm, state);
+}
+
 /**
  * Synchronize array across domain in periodic directions.
  *
@@ -321,6 +381,7 @@ gkyl_comm_group_call_end(struct gkyl_comm *comm)
  * @param comm Communicator
  * @param grid Grid object to write
  * @param range Range describing portion of the array to output.
+ * @param meta Meta-data to embed in file header (may be NULL)
  * @param arr Array object to write
  * @param fname Name of output file (include .gkyl extension)
  * @return Status flag: 0 if write succeeded, 'errno' otherwise
@@ -328,9 +389,30 @@ gkyl_comm_group_call_end(struct gkyl_comm *comm)
 static int
 gkyl_comm_array_write(struct gkyl_comm *comm,
   const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  const struct gkyl_array_meta *meta,
   const struct gkyl_array *arr, const char *fname)
 {
-  return comm->gkyl_array_write(comm, grid, range, arr, fname);
+  return comm->gkyl_array_write(comm, grid, range, meta, arr, fname);
+}
+
+/**
+ * Read array data from a .gkyl file into the local @a range. The
+ * file may have been written with a different decomposition (or
+ * number of ranks) than the one used by this communicator.
+ *
+ * @param comm Communicator
+ * @param grid Grid of the array: must match the grid in the file
+ * @param range Local range to read into
+ * @param arr Array object to read into
+ * @param fname Name of input file
+ * @return Status of read (see enum gkyl_array_rio_status): same on all ranks
+ */
+static int
+gkyl_comm_array_read(struct gkyl_comm *comm,
+  const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  struct gkyl_array *arr, const char *fname)
+{
+  return comm->gkyl_array_read(comm, grid, range, arr, fname);
 }
 
 /**
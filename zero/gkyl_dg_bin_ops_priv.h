@@ -18,6 +18,13 @@
 
 enum gkyl_dg_op { GKYL_DG_OP_MEAN, GKYL_DG_OP_MEAN_L2 };
 
+// Function pointer type for multiplication
+typedef void (*mul_op_t)(const double *f, const double *g, double *fg);
+typedef struct gkyl_kern_op_count (*mul_op_count_t)(void);
+
+// Function pointer type for setting matrices for division
+typedef void (*div_set_op_t)(struct gkyl_mat *A, struct gkyl_mat *rhs, const double *f, const double *g);
+
 // Memory for use in the bin ops
 struct gkyl_dg_bin_op_mem {
   bool on_gpu; // flag to indicate if we are on GPU  
@@ -25,14 +32,17 @@ struct gkyl_dg_bin_op_mem {
   size_t nrows, ncols; // number of rows and colsx
   struct gkyl_nmat *As, *xs; // data for matrices needed in division
   gkyl_nmat_mem *lu_mem; // data for use in LU solve
-};
 
-// Function pointer type for multiplication
-typedef void (*mul_op_t)(const double *f, const double *g, double *fg);
-typedef struct gkyl_kern_op_count (*mul_op_count_t)(void);
-
-// Function pointer type for setting matrices for division
-typedef void (*div_set_op_t)(struct gkyl_mat *A, struct gkyl_mat *rhs, const double *f, const double *g);
+  // Host-side cache of factored division matrices. The LHS of the
+  // weak division depends only on the denominator, so the LU factors
+  // are reused as long as the denominator in each cell is unchanged.
+  bool lu_valid; // true if LUs hold factors of denominator in rop_cache
+  div_set_op_t div_set_op; // kernel used to build cached factors
+  long num_cached; // number of cells in cache
+  struct gkyl_nmat *LUs; // cached LU factors
+  double *rop_cache; // denominator used to compute factors
+  double *rhs_mask; // 1 or 0: which numerator coefficients enter RHS
+};
 
 // for use in kernel tables
 typedef struct { mul_op_t kernels[4]; } mul_op_kern_list;
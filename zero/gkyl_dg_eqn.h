@@ -13,6 +13,15 @@ typedef double (*vol_termf_t)(const struct gkyl_dg_eqn *eqn,
   const double*  xc, const double*  dx, const int*  idx,
   const double* qIn, double* GKYL_RESTRICT qRhsOut);
 
+// Function pointer type for batched volume kernel: updates ncells
+// consecutive cells along the last direction, starting with the cell
+// at idx (center xc). The data of these cells is contiguous in qIn,
+// qRhsOut and cflrate, and the CFL frequency of each cell is added
+// to its cflrate entry
+typedef void (*vol_batch_termf_t)(const struct gkyl_dg_eqn *eqn, int ncells,
+  const double*  xc, const double*  dx, const int*  idx,
+  const double* qIn, double* GKYL_RESTRICT qRhsOut, double* GKYL_RESTRICT cflrate);
+
 // Function pointer type for surface kernel
 typedef double (*surf_termf_t)(const struct gkyl_dg_eqn *eqn, 
   int dir,
@@ -3,6 +3,7 @@
 #include <gkyl_array.h>
 #include <gkyl_basis.h>
 #include <gkyl_eqn_type.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_grid.h>
 #include <gkyl_wave_geom.h>
@@ -60,6 +61,16 @@ void gkyl_dg_updater_fluid_advance(gkyl_dg_updater_fluid *fluid,
   const struct gkyl_range *update_rng, const struct gkyl_array* GKYL_RESTRICT fIn,
   struct gkyl_array* GKYL_RESTRICT cflrate, struct gkyl_array* GKYL_RESTRICT rhs);
 
+/**
+ * Set job pool for threaded CPU update. Pass NULL to disable
+ * threading.
+ *
+ * @param fluid fluid updater object
+ * @param job_pool Job pool to use (or NULL)
+ */
+void gkyl_dg_updater_fluid_set_job_pool(gkyl_dg_updater_fluid *fluid,
+  const struct gkyl_job_pool *job_pool);
+
 /**
  * Return total time spent in drag and diffusion terms
  *
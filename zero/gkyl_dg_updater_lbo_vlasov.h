@@ -4,6 +4,7 @@
 #include <gkyl_basis.h>
 #include <gkyl_dg_lbo_vlasov_diff.h>
 #include <gkyl_dg_lbo_vlasov_drag.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_grid.h>
 
@@ -52,6 +53,16 @@ void gkyl_dg_updater_lbo_vlasov_advance(struct gkyl_dg_updater_collisions *lbo,
   const struct gkyl_range *update_rng, const struct gkyl_array* GKYL_RESTRICT fIn,
   struct gkyl_array* GKYL_RESTRICT cflrate, struct gkyl_array* GKYL_RESTRICT rhs);
 
+/**
+ * Set job pool for threaded CPU update of the drag and diffusion
+ * terms. Pass NULL to disable threading.
+ *
+ * @param lbo LBO updater object
+ * @param job_pool Job pool to use (or NULL)
+ */
+void gkyl_dg_updater_lbo_vlasov_set_job_pool(struct gkyl_dg_updater_collisions *lbo,
+  const struct gkyl_job_pool *job_pool);
+
 /**
  * Return total time spent in drag and diffusion terms
  *
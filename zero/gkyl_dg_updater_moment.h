@@ -3,6 +3,7 @@
 #include <gkyl_array.h>
 #include <gkyl_basis.h>
 #include <gkyl_eqn_type.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_grid.h>
 
@@ -59,6 +60,17 @@ gkyl_dg_updater_moment_acquire_type(const struct gkyl_dg_updater_moment* moment)
 int 
 gkyl_dg_updater_moment_num_mom(const struct gkyl_dg_updater_moment* moment);
 
+/**
+ * Set job pool used to thread the moment computation on the CPU (no-op
+ * on GPUs). See gkyl_mom_calc_set_job_pool.
+ *
+ * @param moment moment updater object
+ * @param job_pool Job pool to use (or NULL)
+ * @param deterministic Should results be independent of the number of threads?
+ */
+void gkyl_dg_updater_moment_set_job_pool(struct gkyl_dg_updater_moment *moment,
+  const struct gkyl_job_pool *job_pool, bool deterministic);
+
 /**
  * Compute moment. The update_phase_rng and update_conf_rng MUST be a sub-range of the
  * be a sub-range of the range on which the array is defined. 
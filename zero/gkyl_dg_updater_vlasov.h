@@ -3,6 +3,8 @@
 #include <gkyl_array.h>
 #include <gkyl_basis.h>
 #include <gkyl_eqn_type.h>
+#include <gkyl_hyper_dg.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_grid.h>
 
@@ -64,6 +66,45 @@ void gkyl_dg_updater_vlasov_advance(gkyl_dg_updater_vlasov *vlasov,
   const struct gkyl_range *update_rng, const struct gkyl_array* GKYL_RESTRICT fIn,
   struct gkyl_array* GKYL_RESTRICT cflrate, struct gkyl_array* GKYL_RESTRICT rhs);
 
+/**
+ * Set job pool for threaded CPU update. The update range passed to
+ * advance is split across the workers of the pool. Pass NULL to
+ * disable threading.
+ *
+ * @param vlasov vlasov updater object
+ * @param job_pool Job pool to use (or NULL)
+ */
+void gkyl_dg_updater_vlasov_set_job_pool(gkyl_dg_updater_vlasov *vlasov,
+  const struct gkyl_job_pool *job_pool);
+
+/**
+ * Turn per-kernel counters on or off (CPU only). See
+ * gkyl_hyper_dg_set_kernel_stat.
+ *
+ * @param vlasov vlasov updater object
+ * @param on Should kernel calls be counted and timed?
+ */
+void gkyl_dg_updater_vlasov_set_kernel_stat(gkyl_dg_updater_vlasov *vlasov, bool on);
+
+/**
+ * Compute velocity moments of fIn in the same sweep as the update
+ * (CPU only, ignored on GPUs). See gkyl_hyper_dg_set_fused_moms.
+ *
+ * @param vlasov vlasov updater object
+ * @param fmom Moments to compute (or NULL to turn off)
+ */
+void gkyl_dg_updater_vlasov_set_fused_moms(gkyl_dg_updater_vlasov *vlasov,
+  const struct gkyl_hyper_dg_fused_moms *fmom);
+
+/**
+ * Get per-kernel counters.
+ *
+ * @param vlasov vlasov updater object
+ * @return Kernel call counts and times
+ */
+struct gkyl_hyper_dg_kernel_stat gkyl_dg_updater_vlasov_get_kernel_stat(
+  const gkyl_dg_updater_vlasov *vlasov);
+
 /**
  * Return total time spent in vlasov equation
  *
@@ -14,6 +14,13 @@ struct gkyl_dg_vlasov_auxfields {
   const struct gkyl_array *alpha_geo; // alpha^i (e^i . alpha) used in surface term if general geometry enabled
 };
 
+// Terms of the Vlasov equation (for looking up kernel names)
+enum gkyl_vlasov_term {
+  GKYL_VLASOV_TERM_VOL, // volume term
+  GKYL_VLASOV_TERM_SURF, // surface term
+  GKYL_VLASOV_TERM_BOUNDARY_SURF, // zero-flux boundary surface term
+};
+
 /**
  * Create a new Vlasov equation object.
  *
@@ -53,6 +60,47 @@ struct gkyl_dg_eqn* gkyl_dg_vlasov_cu_dev_new(const struct gkyl_basis* cbasis,
  */
 void gkyl_vlasov_set_auxfields(const struct gkyl_dg_eqn *eqn, struct gkyl_dg_vlasov_auxfields auxin);
 
+/**
+ * Set the element type used to store the distribution function and
+ * its RHS. With GKYL_FLOAT the kernels still compute in double
+ * precision: cell data is promoted on input and the RHS rounded on
+ * output. Single-precision storage is only supported on the host.
+ *
+ * @param eqn Equation pointer.
+ * @param type Storage type (GKYL_DOUBLE or GKYL_FLOAT).
+ */
+void gkyl_vlasov_set_storage_type(const struct gkyl_dg_eqn *eqn, enum gkyl_elem_type type);
+
+/**
+ * Get the batched volume term, which updates up to batch_size
+ * consecutive cells along the last velocity direction per call using
+ * the vectorized kernels in gkyl_vlasov_batch_kernels.h. Only
+ * streaming (no field) and Vlasov-Maxwell volume terms of the default
+ * model have batched kernels. Host only.
+ *
+ * @param eqn Equation pointer.
+ * @param batch_size On output, maximum number of cells per call.
+ * @return Batched volume term, or NULL if there are no batched kernels.
+ */
+vol_batch_termf_t gkyl_vlasov_vol_batch_term(const struct gkyl_dg_eqn *eqn, int *batch_size);
+
+/**
+ * Write the name of the generated kernel used for a term of the
+ * equation, e.g. "vlasov_surfvx_1x2v_ser_p2" for the surface term in
+ * the first velocity direction of a 1x2v p=2 Vlasov-Maxwell
+ * equation. The name can be used to look up the kernel cost with
+ * gkyl_vlasov_kernel_cost. The name is empty if the term has no
+ * kernel (boundary surface terms in general geometry).
+ *
+ * @param eqn Equation pointer.
+ * @param term Term of the equation.
+ * @param dir Phase-space direction of surface term (ignored for volume term).
+ * @param name On output, kernel name.
+ * @param sz Size of name buffer.
+ */
+void gkyl_vlasov_kernel_name(const struct gkyl_dg_eqn *eqn, enum gkyl_vlasov_term term, int dir,
+  char *name, size_t sz);
+
 #ifdef GKYL_HAVE_CUDA
 /**
  * CUDA device function to set auxiliary fields (e.g. q/m*EM) needed in updating the force terms.
@@ -6,6 +6,7 @@
 #include <gkyl_dg_eqn.h>
 #include <gkyl_eqn_type.h>
 #include <gkyl_vlasov_kernels.h>
+#include <gkyl_vlasov_batch_kernels.h>
 #include <gkyl_range.h>
 #include <gkyl_util.h>
 
@@ -24,6 +25,14 @@ typedef double (*vlasov_accel_surf_t)(const double *w, const double *dxv,
 typedef double (*vlasov_accel_boundary_surf_t)(const double *w, const double *dxv,
   const double *field, const int edge, const double *fEdge, const double *fSkin, double* GKYL_RESTRICT out);
 
+typedef void (*vlasov_batch_stream_vol_t)(const double w[][GKYL_VLASOV_BATCH], const double *dxv,
+  const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH],
+  double* GKYL_RESTRICT cfl);
+
+typedef void (*vlasov_batch_vol_t)(const double w[][GKYL_VLASOV_BATCH], const double *dxv,
+  const double *field, const double f[][GKYL_VLASOV_BATCH], double (* GKYL_RESTRICT out)[GKYL_VLASOV_BATCH],
+  double* GKYL_RESTRICT cfl);
+
 // The cv_index[cd].vdim[vd] is used to index the various list of
 // kernels below
 static struct { int vdim[4]; } cv_index[] = {
@@ -53,6 +62,9 @@ typedef struct { vlasov_accel_boundary_surf_t kernels[3]; } gkyl_dg_vlasov_poiss
 typedef struct { vlasov_accel_boundary_surf_t kernels[3]; } gkyl_dg_vlasov_poisson_extem_accel_boundary_surf_kern_list;
 typedef struct { vlasov_accel_boundary_surf_t kernels[3]; } gkyl_dg_vlasov_accel_boundary_surf_kern_list;
 
+typedef struct { vlasov_batch_stream_vol_t kernels[3]; } gkyl_dg_vlasov_batch_stream_vol_kern_list;
+typedef struct { vlasov_batch_vol_t kernels[3]; } gkyl_dg_vlasov_batch_vol_kern_list;
+
 struct dg_vlasov {
   struct gkyl_dg_eqn eqn; // Base object.
   int cdim; // Config-space dimensions.
@@ -64,8 +76,21 @@ struct dg_vlasov {
   struct gkyl_range conf_range; // Configuration space range (for indexing fields)
   struct gkyl_range phase_range; // Phase space range (for indexing alpha_geo in geometry)
   struct gkyl_dg_vlasov_auxfields auxfields; // Auxiliary fields.
+  int num_basis; // Number of phase-space basis functions.
+  vol_termf_t vol_f64; // Double-precision volume term (for single-precision storage).
+  enum gkyl_basis_type b_type; // Basis type (for kernel names).
+  int poly_order; // Polynomial order (for kernel names).
+  enum gkyl_model_id model_id; // Model (for kernel names).
+  enum gkyl_field_id field_id; // Field type (for kernel names).
+  vlasov_batch_stream_vol_t batch_stream_vol; // Batched streaming volume term (or NULL).
+  vlasov_batch_vol_t batch_vol; // Batched Vlasov-Maxwell volume term (or NULL).
 };
 
+// Largest phase-space basis supported by the kernel tables (3x3v p2
+// serendipity); sizes scratch buffers for single-precision storage
+// and the staging buffers of the batched volume term
+#define VLASOV_F32_MAX_NUM_BASIS 256
+
 //
 // Serendipity volume kernels (streaming only, no geometry)
 // Need to be separated like this for GPU build
@@ -1500,6 +1525,59 @@ static const gkyl_dg_vlasov_accel_boundary_surf_kern_list tensor_accel_boundary_
   { NULL, vlasov_boundary_surfvz_3x3v_tensor_p1, NULL }, // 5
 };
 
+//
+// Batched volume kernels (host only). Serendipity and tensor lists for
+// streaming and for Vlasov-Maxwell.
+//
+
+static const gkyl_dg_vlasov_batch_stream_vol_kern_list ser_batch_stream_vol_kernels[] = {
+  // 1x kernels
+  { NULL, vlasov_batch_stream_vol_1x1v_ser_p1, vlasov_batch_stream_vol_1x1v_ser_p2 }, // 0
+  { NULL, vlasov_batch_stream_vol_1x2v_ser_p1, vlasov_batch_stream_vol_1x2v_ser_p2 }, // 1
+  { NULL, vlasov_batch_stream_vol_1x3v_ser_p1, vlasov_batch_stream_vol_1x3v_ser_p2 }, // 2
+  // 2x kernels
+  { NULL, vlasov_batch_stream_vol_2x2v_ser_p1, vlasov_batch_stream_vol_2x2v_ser_p2 }, // 3
+  { NULL, vlasov_batch_stream_vol_2x3v_ser_p1, vlasov_batch_stream_vol_2x3v_ser_p2 }, // 4
+  // 3x kernels
+  { NULL, vlasov_batch_stream_vol_3x3v_ser_p1, NULL }, // 5
+};
+
+static const gkyl_dg_vlasov_batch_stream_vol_kern_list tensor_batch_stream_vol_kernels[] = {
+  // 1x kernels
+  { NULL, vlasov_batch_stream_vol_1x1v_tensor_p1, vlasov_batch_stream_vol_1x1v_tensor_p2 }, // 0
+  { NULL, vlasov_batch_stream_vol_1x2v_tensor_p1, vlasov_batch_stream_vol_1x2v_tensor_p2 }, // 1
+  { NULL, vlasov_batch_stream_vol_1x3v_tensor_p1, vlasov_batch_stream_vol_1x3v_tensor_p2 }, // 2
+  // 2x kernels
+  { NULL, vlasov_batch_stream_vol_2x2v_tensor_p1, vlasov_batch_stream_vol_2x2v_tensor_p2 }, // 3
+  { NULL, vlasov_batch_stream_vol_2x3v_tensor_p1, vlasov_batch_stream_vol_2x3v_tensor_p2 }, // 4
+  // 3x kernels
+  { NULL, vlasov_batch_stream_vol_3x3v_tensor_p1, NULL }, // 5
+};
+
+static const gkyl_dg_vlasov_batch_vol_kern_list ser_batch_vol_kernels[] = {
+  // 1x kernels
+  { NULL, vlasov_batch_vol_1x1v_ser_p1, vlasov_batch_vol_1x1v_ser_p2 }, // 0
+  { NULL, vlasov_batch_vol_1x2v_ser_p1, vlasov_batch_vol_1x2v_ser_p2 }, // 1
+  { NULL, vlasov_batch_vol_1x3v_ser_p1, vlasov_batch_vol_1x3v_ser_p2 }, // 2
+  // 2x kernels
+  { NULL, vlasov_batch_vol_2x2v_ser_p1, vlasov_batch_vol_2x2v_ser_p2 }, // 3
+  { NULL, vlasov_batch_vol_2x3v_ser_p1, vlasov_batch_vol_2x3v_ser_p2 }, // 4
+  // 3x kernels
+  { NULL, vlasov_batch_vol_3x3v_ser_p1, NULL }, // 5
+};
+
+static const gkyl_dg_vlasov_batch_vol_kern_list tensor_batch_vol_kernels[] = {
+  // 1x kernels
+  { NULL, vlasov_batch_vol_1x1v_tensor_p1, vlasov_batch_vol_1x1v_tensor_p2 }, // 0
+  { NULL, vlasov_batch_vol_1x2v_tensor_p1, vlasov_batch_vol_1x2v_tensor_p2 }, // 1
+  { NULL, vlasov_batch_vol_1x3v_tensor_p1, vlasov_batch_vol_1x3v_tensor_p2 }, // 2
+  // 2x kernels
+  { NULL, vlasov_batch_vol_2x2v_tensor_p1, vlasov_batch_vol_2x2v_tensor_p2 }, // 3
+  { NULL, vlasov_batch_vol_2x3v_tensor_p1, vlasov_batch_vol_2x3v_tensor_p2 }, // 4
+  // 3x kernels
+  { NULL, vlasov_batch_vol_3x3v_tensor_p1, NULL }, // 5
+};
+
 // "Choose Kernel" based on cdim, vdim and polyorder
 #define CK(lst,cdim,vd,poly_order) lst[cv_index[cdim].vdim[vd]].kernels[poly_order]
 
@@ -1563,3 +1641,156 @@ boundary_surf(const struct gkyl_dg_eqn *eqn,
   }
   return 0.;
 }
+
+//
+// Single-precision storage. The distribution function and its RHS are
+// stored as floats while the kernels compute in double precision: the
+// wrappers below promote the cell data, call the double-precision term
+// into a scratch buffer and accumulate the result into the float RHS.
+// Host only.
+//
+
+GKYL_CU_DH
+static inline void
+f32_promote(int nb, const double *qIn, double *q)
+{
+  const float *qf = (const float*) qIn;
+  for (int k=0; k<nb; ++k) q[k] = qf[k];
+}
+
+GKYL_CU_DH
+static inline void
+f32_accumulate(int nb, const double *out, double *qRhsOut)
+{
+  float *rhs = (float*) qRhsOut;
+  for (int k=0; k<nb; ++k) rhs[k] += out[k];
+}
+
+GKYL_CU_DH
+static double
+vol_f32(const struct gkyl_dg_eqn *eqn, const double* xc, const double* dx,
+  const int* idx, const double* qIn, double* GKYL_RESTRICT qRhsOut)
+{
+  struct dg_vlasov *vlasov = container_of(eqn, struct dg_vlasov, eqn);
+  int nb = vlasov->num_basis;
+
+  double q[VLASOV_F32_MAX_NUM_BASIS], out[VLASOV_F32_MAX_NUM_BASIS];
+  f32_promote(nb, qIn, q);
+  for (int k=0; k<nb; ++k) out[k] = 0.0;
+
+  double cflfreq = vlasov->vol_f64(eqn, xc, dx, idx, q, out);
+  f32_accumulate(nb, out, qRhsOut);
+  return cflfreq;
+}
+
+GKYL_CU_D
+static double
+surf_f32(const struct gkyl_dg_eqn *eqn, 
+  int dir,
+  const double* xcL, const double* xcC, const double* xcR, 
+  const double* dxL, const double* dxC, const double* dxR,
+  const int* idxL, const int* idxC, const int* idxR,
+  const double* qInL, const double* qInC, const double* qInR, double* GKYL_RESTRICT qRhsOut)
+{
+  struct dg_vlasov *vlasov = container_of(eqn, struct dg_vlasov, eqn);
+  int nb = vlasov->num_basis;
+
+  double qL[VLASOV_F32_MAX_NUM_BASIS], qC[VLASOV_F32_MAX_NUM_BASIS], qR[VLASOV_F32_MAX_NUM_BASIS];
+  double out[VLASOV_F32_MAX_NUM_BASIS];
+  f32_promote(nb, qInL, qL);
+  f32_promote(nb, qInC, qC);
+  f32_promote(nb, qInR, qR);
+  for (int k=0; k<nb; ++k) out[k] = 0.0;
+
+  double cflfreq = surf(eqn, dir, xcL, xcC, xcR, dxL, dxC, dxR,
+    idxL, idxC, idxR, qL, qC, qR, out);
+  f32_accumulate(nb, out, qRhsOut);
+  return cflfreq;
+}
+
+GKYL_CU_D
+static double
+boundary_surf_f32(const struct gkyl_dg_eqn *eqn,
+  int dir,
+  const double* xcEdge, const double* xcSkin,
+  const double* dxEdge, const double* dxSkin,
+  const int* idxEdge, const int* idxSkin, const int edge,
+  const double* qInEdge, const double* qInSkin, double* GKYL_RESTRICT qRhsOut)
+{
+  struct dg_vlasov *vlasov = container_of(eqn, struct dg_vlasov, eqn);
+  int nb = vlasov->num_basis;
+
+  double qEdge[VLASOV_F32_MAX_NUM_BASIS], qSkin[VLASOV_F32_MAX_NUM_BASIS];
+  double out[VLASOV_F32_MAX_NUM_BASIS];
+  f32_promote(nb, qInEdge, qEdge);
+  f32_promote(nb, qInSkin, qSkin);
+  for (int k=0; k<nb; ++k) out[k] = 0.0;
+
+  double cflfreq = boundary_surf(eqn, dir, xcEdge, xcSkin, dxEdge, dxSkin,
+    idxEdge, idxSkin, edge, qEdge, qSkin, out);
+  f32_accumulate(nb, out, qRhsOut);
+  return cflfreq;
+}
+
+//
+// Batched volume term. Cell data is transposed into staging buffers,
+// one lane per cell, and lanes past ncells repeat the last cell (their
+// results are discarded). Host only.
+//
+
+static void
+vol_batch(const struct gkyl_dg_eqn *eqn, int ncells,
+  const double* xc, const double* dx, const int* idx,
+  const double* qIn, double* GKYL_RESTRICT qRhsOut, double* GKYL_RESTRICT cflrate)
+{
+  struct dg_vlasov *vlasov = container_of(eqn, struct dg_vlasov, eqn);
+  int pdim = vlasov->pdim, nb = vlasov->num_basis;
+
+  if (eqn->vol_term == vol_f32) {
+    // no batched kernels for single-precision storage: update cell by cell
+    const float *qf = (const float*) qIn;
+    float *rhsf = (float*) qRhsOut;
+    int idxl[GKYL_MAX_DIM];
+    double xcl[GKYL_MAX_DIM];
+    gkyl_copy_int_arr(pdim, idx, idxl);
+    for (int d=0; d<pdim; ++d) xcl[d] = xc[d];
+    for (int l=0; l<ncells; ++l) {
+      idxl[pdim-1] = idx[pdim-1]+l;
+      xcl[pdim-1] = xc[pdim-1]+l*dx[pdim-1];
+      cflrate[l] += vol_f32(eqn, xcl, dx, idxl,
+        (const double*) (qf+l*nb), (double*) (rhsf+l*nb));
+    }
+    return;
+  }
+
+  double w[GKYL_MAX_DIM][GKYL_VLASOV_BATCH], cfl[GKYL_VLASOV_BATCH];
+  double f[VLASOV_F32_MAX_NUM_BASIS][GKYL_VLASOV_BATCH];
+  double out[VLASOV_F32_MAX_NUM_BASIS][GKYL_VLASOV_BATCH];
+  for (int l=0; l<GKYL_VLASOV_BATCH; ++l) {
+    int lc = l < ncells ? l : ncells-1;
+    for (int d=0; d<pdim-1; ++d) w[d][l] = xc[d];
+    w[pdim-1][l] = xc[pdim-1]+lc*dx[pdim-1];
+
+    const double *q = qIn+lc*nb;
+    const double *r = qRhsOut+lc*nb;
+    for (int k=0; k<nb; ++k) {
+      f[k][l] = q[k];
+      out[k][l] = r[k];
+    }
+  }
+
+  if (vlasov->batch_vol) {
+    long cidx = gkyl_range_idx(&vlasov->conf_range, idx);
+    vlasov->batch_vol(w, dx, (const double*) gkyl_array_cfetch(vlasov->auxfields.field, cidx),
+      (const double (*)[GKYL_VLASOV_BATCH]) f, out, cfl);
+  }
+  else {
+    vlasov->batch_stream_vol(w, dx, (const double (*)[GKYL_VLASOV_BATCH]) f, out, cfl);
+  }
+
+  for (int l=0; l<ncells; ++l) {
+    double *r = qRhsOut+l*nb;
+    for (int k=0; k<nb; ++k) r[k] = out[k][l];
+    cflrate[l] += cfl[l]; // frequencies are additive
+  }
+}
@@ -4,12 +4,42 @@
 #include <gkyl_array.h>
 #include <gkyl_basis.h>
 #include <gkyl_dg_eqn.h>
+#include <gkyl_job_pool.h>
+#include <gkyl_mom_type.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_grid.h>
 
 // Object type
 typedef struct gkyl_hyper_dg gkyl_hyper_dg;
 
+// Call counts and time spent (in seconds) in each entry of the
+// equation kernel table. Surface entries are indexed by direction.
+struct gkyl_hyper_dg_kernel_stat {
+  long nvol; // calls to volume kernel
+  double vol_tm; // time in volume kernel
+  long nsurf[GKYL_MAX_DIM]; // calls to surface kernels
+  double surf_tm[GKYL_MAX_DIM]; // time in surface kernels
+  long nboundary_surf[GKYL_MAX_DIM]; // calls to zero-flux boundary kernels
+  double boundary_surf_tm[GKYL_MAX_DIM]; // time in zero-flux boundary kernels
+};
+
+// Maximum number of moments that can be fused into the update
+#define GKYL_HYPER_DG_MAX_FUSED_MOMS 4
+
+// Velocity moments of fIn computed in the same sweep as the update
+// (see gkyl_hyper_dg_set_fused_moms)
+struct gkyl_hyper_dg_fused_moms {
+  int cdim; // number of configuration-space dimensions
+  struct gkyl_range conf_range; // range used to index moment arrays
+  int num_mom; // number of moments
+  const struct gkyl_mom_type *momt[GKYL_HYPER_DG_MAX_FUSED_MOMS]; // moment types
+  struct gkyl_array *mout[GKYL_HYPER_DG_MAX_FUSED_MOMS]; // moments are accumulated here
+  // if true, the moment is a velocity-boundary correction: it is only
+  // computed in cells on the velocity-space edges of the update
+  // range, with the edge (enum gkyl_vel_edge) passed to the kernel
+  bool vel_edge[GKYL_HYPER_DG_MAX_FUSED_MOMS];
+};
+
 /**
  * Create new updater to update equations using DG algorithm.
  *
@@ -58,6 +88,37 @@ gkyl_hyper_dg* gkyl_hyper_dg_cu_dev_new(const struct gkyl_rect_grid *grid_cu,
 void gkyl_hyper_dg_advance(gkyl_hyper_dg *hdg, const struct gkyl_range *update_rng,
   const struct gkyl_array *fIn, struct gkyl_array *cflrate, struct gkyl_array *rhs);
 
+/**
+ * Compute RHS of DG update in the interior of update_rng, i.e. in
+ * cells that do not need ghost-cell data of fIn. Together with
+ * gkyl_hyper_dg_advance_boundary this computes the same RHS as
+ * gkyl_hyper_dg_advance, and so the interior can be updated while
+ * ghost-cells are being synchronized (see
+ * gkyl_comm_array_sync_begin).
+ *
+ * @param hdg Hyper DG updater object
+ * @param update_rng Range on which to compute.
+ * @param fIn Input to updater
+ * @param cflrate CFL scalar rate (frequency) array (units of 1/[T])
+ * @param rhs RHS output
+ */
+void gkyl_hyper_dg_advance_interior(gkyl_hyper_dg *hdg, const struct gkyl_range *update_rng,
+  const struct gkyl_array *fIn, struct gkyl_array *cflrate, struct gkyl_array *rhs);
+
+/**
+ * Compute RHS of DG update in the skin layer of update_rng, i.e. in
+ * cells not updated by gkyl_hyper_dg_advance_interior. Ghost-cells of
+ * fIn must be valid before this is called.
+ *
+ * @param hdg Hyper DG updater object
+ * @param update_rng Range on which to compute.
+ * @param fIn Input to updater
+ * @param cflrate CFL scalar rate (frequency) array (units of 1/[T])
+ * @param rhs RHS output
+ */
+void gkyl_hyper_dg_advance_boundary(gkyl_hyper_dg *hdg, const struct gkyl_range *update_rng,
+  const struct gkyl_array *fIn, struct gkyl_array *cflrate, struct gkyl_array *rhs);
+
 // CUDA call
 void gkyl_hyper_dg_advance_cu(gkyl_hyper_dg* hdg, const struct gkyl_range *update_range,
   const struct gkyl_array* GKYL_RESTRICT fIn, struct gkyl_array* GKYL_RESTRICT cflrate,
@@ -91,6 +152,71 @@ void gkyl_hyper_dg_gen_stencil_advance(gkyl_hyper_dg* hdg, const struct gkyl_ran
 void gkyl_hyper_dg_set_update_vol(gkyl_hyper_dg *hdg, int update_vol_term);
 // On-device version
 void gkyl_hyper_dg_set_update_vol_cu(gkyl_hyper_dg *hdg, int update_vol_term);
+
+/**
+ * Set job pool to use for CPU shared-memory parallel update. When a
+ * pool with more than one worker is set, gkyl_hyper_dg_advance splits
+ * the update range into pool_size pieces and updates each piece on a
+ * worker. Pass NULL to go back to the serial update. The pool is
+ * acquired by the updater.
+ *
+ * @param hdg Hyper DG updater object
+ * @param job_pool Job pool to use (or NULL)
+ */
+void gkyl_hyper_dg_set_job_pool(gkyl_hyper_dg *hdg, const struct gkyl_job_pool *job_pool);
+
+/**
+ * Turn per-kernel counters on or off for the CPU update. When on,
+ * every volume, surface and boundary-surface kernel call is counted
+ * and timed, which adds two clock reads per call. Turning counters
+ * on resets them.
+ *
+ * @param hdg Hyper DG updater object
+ * @param on Should kernel calls be counted and timed?
+ */
+void gkyl_hyper_dg_set_kernel_stat(gkyl_hyper_dg *hdg, bool on);
+
+/**
+ * Set a batched volume term for the CPU update. The volume term is
+ * then computed for batch_size consecutive cells along the last
+ * direction at a time, before the surface terms of those cells, so
+ * each cell is still updated volume term first. Batched kernels
+ * vectorize across cells and may round differently from the
+ * per-cell volume term. Pass NULL to go back to the per-cell volume
+ * term.
+ *
+ * @param hdg Hyper DG updater object
+ * @param vol_batch_term Batched volume term (or NULL)
+ * @param batch_size Maximum number of cells per call of vol_batch_term
+ */
+void gkyl_hyper_dg_set_vol_batch(gkyl_hyper_dg *hdg, vol_batch_termf_t vol_batch_term,
+  int batch_size);
+
+/**
+ * Compute velocity moments of fIn in the same sweep as the CPU
+ * update, so that no extra pass over phase space is needed. Each
+ * cell visited by gkyl_hyper_dg_advance (or by the interior/boundary
+ * variants) adds its contribution to the moment arrays, which are
+ * NOT cleared: clear them before the first advance of a step. With a
+ * job pool, each worker accumulates into its own copy of the moment
+ * arrays and the copies are summed at the end of the advance, so
+ * moments may round differently than with gkyl_mom_calc. Only double
+ * precision input is supported. Pass NULL to turn fused moments off.
+ *
+ * @param hdg Hyper DG updater object
+ * @param fmom Moments to compute (or NULL)
+ */
+void gkyl_hyper_dg_set_fused_moms(gkyl_hyper_dg *hdg,
+  const struct gkyl_hyper_dg_fused_moms *fmom);
+
+/**
+ * Get per-kernel counters accumulated since they were turned on. All
+ * entries are zero if counters are off.
+ *
+ * @param hdg Hyper DG updater object
+ * @return Kernel call counts and times
+ */
+struct gkyl_hyper_dg_kernel_stat gkyl_hyper_dg_get_kernel_stat(const gkyl_hyper_dg *hdg);
   
 /**
  * Delete updater.
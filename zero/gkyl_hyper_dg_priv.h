@@ -1,6 +1,8 @@
 #pragma once
 
 #include <gkyl_dg_eqn.h>
+#include <gkyl_hyper_dg.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_rect_grid.h>
 #include <gkyl_util.h>
 
@@ -14,6 +16,13 @@ struct gkyl_hyper_dg {
   int zero_flux_flags[GKYL_MAX_DIM];
   int update_vol_term; // should we update volume term?
   const struct gkyl_dg_eqn *equation; // equation object
+  const struct gkyl_job_pool *job_pool; // pool for threaded update (NULL for serial)
+  struct gkyl_hyper_dg_kernel_stat *kernel_stat; // per-kernel counters (NULL if off)
+  vol_batch_termf_t vol_batch_term; // batched volume term (NULL if off)
+  int vol_batch_size; // cells per call of vol_batch_term
+  struct gkyl_hyper_dg_fused_moms *fused_moms; // moments computed in update (NULL if off)
+  int num_mom_buff; // number of workers with moment buffers
+  struct gkyl_array **mom_buff; // per-worker moment arrays (num_mom_buff*num_mom)
 
   uint32_t flags;
   struct gkyl_hyper_dg *on_dev; // pointer to itself or device data
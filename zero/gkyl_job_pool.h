@@ -1,13 +1,19 @@
 #pragma once
 
+#include <gkyl_range.h>
 #include <gkyl_ref_count.h>
 
+#include <stdbool.h>
+
 // forward declare for use in function pointers
 struct gkyl_job_pool;
 
 // Function pointer sig for function that does the actual work 
 typedef void (*jp_work_func)(void *ctx);
 
+// Function pointer sig for function that does work on a sub-range
+typedef void (*jp_range_func)(const struct gkyl_range *range, void *ctx);
+
 // Function sig that adds work to the pool
 typedef bool (*jp_add_work)(const struct gkyl_job_pool *jp, jp_work_func func, void *ctx);
 
@@ -33,12 +39,31 @@ struct gkyl_job_pool {
 bool gkyl_job_pool_add_work(const struct gkyl_job_pool *jp, jp_work_func func, void *ctx);
 
 /**
- * Wait till all jobs are completed
+ * Wait till all jobs are completed. Must not be called from inside a
+ * job running on the same pool.
  *
  * @param jp Job-pool object.
  */
 void gkyl_job_pool_wait(const struct gkyl_job_pool *jp);
 
+/**
+ * Run func in parallel over range. The range is split into pieces of
+ * about 'grain' cells each (using gkyl_range_split) and each piece is
+ * added as a job to the pool. The function returns once all jobs in
+ * the pool have completed. Pieces are much smaller than the range
+ * when grain is small, so idle workers can pick up (or steal) the
+ * remaining pieces.
+ *
+ * @param jp Job-pool object.
+ * @param range Range to loop over
+ * @param grain Approximate number of cells in each piece (if <= 0,
+ *   one piece per worker is used)
+ * @param func Function called on each piece
+ * @param ctx Context object passed to func
+ */
+void gkyl_job_pool_parallel_for(const struct gkyl_job_pool *jp,
+  const struct gkyl_range *range, long grain, jp_range_func func, void *ctx);
+
 /**
  * Acquire pointer to job-pool. Delete using the release()
  * method
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <gkyl_array.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_ref_count.h>
 #include <gkyl_util.h>
 
@@ -342,6 +343,17 @@ gkyl_nmat_mem *gkyl_nmat_linsolve_lu_new(size_t num, size_t nrow);
 // Same as above, except for GPUs
 gkyl_nmat_mem *gkyl_nmat_linsolve_lu_cu_dev_new(size_t num, size_t nrow);
 
+/**
+ * Set job pool used to thread host-side batched LU solves. The
+ * matrices are solved in groups of a few at a time and the groups are
+ * distributed over the workers in the pool. Pass NULL to solve
+ * serially (the default).
+ *
+ * @param mem Memory for batched LU solves (host-side only)
+ * @param job_pool Job pool to use (or NULL)
+ */
+void gkyl_nmat_linsolve_lu_set_job_pool(gkyl_nmat_mem *mem, const struct gkyl_job_pool *job_pool);
+
 /**
  * Release memory allocated for batched LU solves.
  *
@@ -402,7 +414,9 @@ bool gkyl_nmat_linsolve_lu(struct gkyl_nmat *A, struct gkyl_nmat *x);
  * (each column represents a RHS vector) and on output "x" is replaced
  * with the solution(s). Returns true on success, false
  * otherwise. Note that on output each of the As is replaced by its LU
- * factors.
+ * factors. On the host, a singular matrix does not affect the others:
+ * they are still solved, and the RHS of the singular one is left
+ * unchanged.
  *
  * The memory required in this call must be pre-allocated.
  *
@@ -412,6 +426,30 @@ bool gkyl_nmat_linsolve_lu(struct gkyl_nmat *A, struct gkyl_nmat *x);
  */
 bool gkyl_nmat_linsolve_lu_pa(gkyl_nmat_mem *mem, struct gkyl_nmat *A, struct gkyl_nmat *x);
 
+/**
+ * LU-factor a batch of matrices in place, keeping the pivots in the
+ * pre-allocated memory so that the factors can be used in any number
+ * of later calls to gkyl_nmat_lu_solve_pa. A may hold fewer matrices
+ * than mem was allocated for. Host-side only. Returns true on success,
+ * false if any matrix is singular; the other matrices are still
+ * factored.
+ *
+ * @param mem Preallocated memory needed in the factorization
+ * @param A list of matrices, replaced by LU factors on return
+ */
+bool gkyl_nmat_lu_factor_pa(gkyl_nmat_mem *mem, struct gkyl_nmat *A);
+
+/**
+ * Solve batched linear systems using the LU factors (and pivots in
+ * mem) from the most recent call to gkyl_nmat_lu_factor_pa. Host-side
+ * only.
+ *
+ * @param mem Memory used in the factorization
+ * @param LU list of LU factors
+ * @param x list of RHS vectors, replaced by solution on exit
+ */
+void gkyl_nmat_lu_solve_pa(gkyl_nmat_mem *mem, const struct gkyl_nmat *LU, struct gkyl_nmat *x);
+
 /**
  * Release multi-matrix
  *
@@ -2,6 +2,7 @@
 
 #include <gkyl_array.h>
 #include <gkyl_basis.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_mom_type.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_grid.h>
@@ -30,6 +31,31 @@ struct gkyl_mom_calc*
 gkyl_mom_calc_cu_dev_new(const struct gkyl_rect_grid *grid,
   const struct gkyl_mom_type *momt);
 
+/**
+ * Set job pool used to thread the moment computation on the CPU. If
+ * conf_rng has enough cells, threads work on disjoint sets of
+ * configuration-space cells and the result is identical to the
+ * serial one. Otherwise, velocity space is split into blocks, each
+ * accumulating its own copy of the moments, and the copies are summed
+ * pairwise in a fixed tree order. Pass NULL to compute serially.
+ *
+ * @param calc Moment calculator updater
+ * @param job_pool Job pool to use (or NULL)
+ */
+void gkyl_mom_calc_set_job_pool(gkyl_mom_calc *calc, const struct gkyl_job_pool *job_pool);
+
+/**
+ * Make the moment computation independent of the number of threads:
+ * velocity space is always summed in the same fixed blocks and tree
+ * order, also when running serially or threading over
+ * configuration-space cells. Off by default, in which case there is
+ * one block per thread (results still do not change from run to run).
+ *
+ * @param calc Moment calculator updater
+ * @param on Should summation order be fixed?
+ */
+void gkyl_mom_calc_set_deterministic(gkyl_mom_calc *calc, bool on);
+
 /**
  * Compute moment of distribution function. The phase_rng and conf_rng
  * MUST be a sub-ranges of the range on which the distribution
@@ -3,6 +3,7 @@
 #include <gkyl_array.h>
 #include <gkyl_basis.h>
 #include <gkyl_eqn_type.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_mom_type.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_grid.h>
@@ -30,6 +31,17 @@ struct gkyl_mom_calc_bcorr*
 gkyl_mom_calc_bcorr_cu_dev_new(const struct gkyl_rect_grid *grid,
   const struct gkyl_mom_type *momt);
 
+/**
+ * Set job pool used to thread the corrections on the CPU over
+ * configuration-space cells. Results do not depend on the number of
+ * threads. Pass NULL to compute serially.
+ *
+ * @param bcorr Boundary correction updater object
+ * @param job_pool Job pool to use (or NULL)
+ */
+void gkyl_mom_calc_bcorr_set_job_pool(gkyl_mom_calc_bcorr *bcorr,
+  const struct gkyl_job_pool *job_pool);
+
 /**
  * Compute boundary correction moments.
  *
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <gkyl_job_pool.h>
 #include <gkyl_mom_type.h>
 #include <gkyl_rect_grid.h>
 
@@ -11,6 +12,7 @@ struct gkyl_mom_calc_bcorr {
   int update_dirs[GKYL_MAX_DIM]; // directions to update
   int space;
   const struct gkyl_mom_type *momt; // moment type object
+  const struct gkyl_job_pool *job_pool; // job pool (NULL if not threaded)
 
   uint32_t flags;
   struct gkyl_mom_calc_bcorr *on_dev;
@@ -1,12 +1,20 @@
 #pragma once
 
+#include <gkyl_job_pool.h>
 #include <gkyl_mom_type.h>
 #include <gkyl_rect_grid.h>
 
+// Number of velocity-space blocks used by the deterministic threaded
+// reduction (independent of the number of threads)
+#define GKYL_MOM_CALC_NUM_VBLOCK 32
+
 struct gkyl_mom_calc {
   struct gkyl_rect_grid grid;
   const struct gkyl_mom_type *momt;
 
+  const struct gkyl_job_pool *job_pool; // job pool (NULL if not threaded)
+  bool deterministic; // if true, results do not depend on the number of threads
+
   uint32_t flags;
   struct gkyl_mom_calc *on_dev; // pointer to itself or device data
 };
@@ -52,4 +52,7 @@ struct gkyl_moment_em_coupling {
   bool has_einstein_medium_sources; // Run with coupled fluid-Einstein sources in plane-symmetric spacetimes.
   double medium_gas_gamma; // Adiabatic index for coupled fluid-Einstein sources in plane-symmetric spacetimes.
   double medium_kappa; // Stress-energy prefactor for coupled fluid-Einstein sources in plane-symmetric spacetimes.
+
+  struct implicit_src_cell *cells; // Pointers to the data in each cell of a block (batched implicit solver).
+  struct implicit_src_batch *batch; // Scratch space for the batched implicit solver.
 };
\ No newline at end of file
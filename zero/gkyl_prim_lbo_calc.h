@@ -2,6 +2,7 @@
 
 #include <gkyl_array.h>
 #include <gkyl_basis.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_prim_lbo_type.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_grid.h>
@@ -52,6 +53,15 @@ void gkyl_prim_lbo_calc_advance_cu(struct gkyl_prim_lbo_calc* calc,
   const struct gkyl_array *moms, const struct gkyl_array *boundary_corrections,
   struct gkyl_array* prim_moms_out);
 
+/**
+ * Set job pool used to thread the batched linear solve on the host.
+ *
+ * @param calc Primitive moment calculator updater
+ * @param job_pool Job pool to use (or NULL)
+ */
+void gkyl_prim_lbo_calc_set_job_pool(struct gkyl_prim_lbo_calc* calc,
+  const struct gkyl_job_pool *job_pool);
+
 /**
  * Delete pointer to primitive moment calculator updater.
  *
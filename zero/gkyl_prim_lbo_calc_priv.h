@@ -10,6 +10,7 @@ struct gkyl_prim_lbo_calc {
   bool is_first; // flag to indicate first call to update
   struct gkyl_nmat *As, *xs; // matrices for LHS and RHS
   gkyl_nmat_mem *mem; // memory for use in batched linear solve
+  const struct gkyl_job_pool *job_pool; // pool to thread linear solve (or NULL)
 
   uint32_t flags;
   struct gkyl_prim_lbo_calc *on_dev; // pointer to itself or device data
@@ -129,3 +129,13 @@ void gkyl_rect_grid_write(const struct gkyl_rect_grid *grid, FILE *fp);
  * @return True if read succeeded, false otherwise
  */
 bool gkyl_rect_grid_read(struct gkyl_rect_grid *grid, FILE *fp);
+
+/**
+ * Check if two grids are the same: they must have the same number of
+ * cells and the same extents (to within round-off).
+ *
+ * @param grid1 Grid to compare
+ * @param grid2 Grid to compare
+ * @return True if grids are the same, false otherwise
+ */
+bool gkyl_rect_grid_cmp(const struct gkyl_rect_grid *grid1, const struct gkyl_rect_grid *grid2);
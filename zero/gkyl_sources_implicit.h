@@ -3,6 +3,43 @@
 // Forward-declaration of the private gkyl_moment_em_coupling object type.
 typedef struct gkyl_moment_em_coupling gkyl_moment_em_coupling;
 
+// Number of cells processed together by the batched implicit source solver.
+#define IMPLICIT_SRC_BATCH 64
+
+// Pointers to the data in a single cell needed by the implicit source solver.
+struct implicit_src_cell {
+  double *fluid[GKYL_MAX_SPECIES]; // Fluid variables for each species.
+  const double *app_accel[GKYL_MAX_SPECIES]; // Applied accelerations for each species.
+  const double *p_rhs[GKYL_MAX_SPECIES]; // Pressure tensor RHS for each species.
+  const double *nT_sources[GKYL_MAX_SPECIES]; // Number density and temperature sources for each species.
+  double *em; // Electromagnetic variables.
+  const double *app_current; // Applied current.
+  const double *ext_em; // External electromagnetic variables.
+};
+
+// Scratch space for the batched implicit source solver. All per-cell quantities are stored contiguously
+// over the cells of a block (structure-of-arrays), so the cell loops of the solver vectorize.
+struct implicit_src_batch {
+  double rho[GKYL_MAX_SPECIES][IMPLICIT_SRC_BATCH]; // Density (rhs) of each species.
+  double mom[GKYL_MAX_SPECIES][3][IMPLICIT_SRC_BATCH]; // Momentum of each species: rhs on input, new value on output.
+  double app_accel[GKYL_MAX_SPECIES][3][IMPLICIT_SRC_BATCH]; // Applied acceleration of each species.
+  double ke_old[GKYL_MAX_SPECIES][IMPLICIT_SRC_BATCH]; // Kinetic energy at known time (Euler).
+  double energy_old[GKYL_MAX_SPECIES][IMPLICIT_SRC_BATCH]; // Total energy at known time (Euler).
+  double p_tensor_new[GKYL_MAX_SPECIES][IMPLICIT_SRC_BATCH][6]; // Rotated and relaxed pressure tensor (10-moment).
+
+  double E[3][IMPLICIT_SRC_BATCH]; // Electric field: old value on input, new value on output.
+  double B[3][IMPLICIT_SRC_BATCH]; // Total (self-consistent plus external) magnetic field.
+  double ext_E[3][IMPLICIT_SRC_BATCH]; // External electric field.
+  double app_current[3][IMPLICIT_SRC_BATCH]; // Applied current.
+
+  // Intermediate quantities of the implicit solve.
+  double B_mag[IMPLICIT_SRC_BATCH], bhat[3][IMPLICIT_SRC_BATCH];
+  double w0_sq[IMPLICIT_SRC_BATCH], gam_sq[IMPLICIT_SRC_BATCH], delta[IMPLICIT_SRC_BATCH];
+  double K[3][IMPLICIT_SRC_BATCH], F_bar[3][IMPLICIT_SRC_BATCH];
+  double J_old[GKYL_MAX_SPECIES][3][IMPLICIT_SRC_BATCH], J[GKYL_MAX_SPECIES][3][IMPLICIT_SRC_BATCH];
+  double wc_dt[GKYL_MAX_SPECIES][IMPLICIT_SRC_BATCH], wp_dt_sq[GKYL_MAX_SPECIES][IMPLICIT_SRC_BATCH];
+};
+
 /**
 * Integrate the electromagnetic source terms of a charged multi-fluid equation system within a single cell, using an implicit forcing solver
 * (specifically the time-centered Crank-Nicolson/implicit Runge-Kutta method).
@@ -109,4 +146,33 @@ implicit_frictional_source_update(const gkyl_moment_em_coupling* mom_em, double
 void
 implicit_source_coupling_update(const gkyl_moment_em_coupling* mom_em, double t_curr, double dt, double* fluid_s[GKYL_MAX_SPECIES],
   const double* app_accel_s[GKYL_MAX_SPECIES], const double* p_rhs_s[GKYL_MAX_SPECIES], double* em, const double* app_current,
-  const double* ext_em, const double* nT_sources_s[GKYL_MAX_SPECIES]);
\ No newline at end of file
+  const double* ext_em, const double* nT_sources_s[GKYL_MAX_SPECIES]);
+
+/**
+* Integrate the electromagnetic source terms of a charged multi-fluid equation system for a block of cells at once, using the same
+* implicit forcing solver as implicit_em_source_update. Inputs and outputs are in the structure-of-arrays scratch.
+*
+* @param mom_em Moment-EM coupling object.
+* @param t_curr Current simulation time.
+* @param dt Current stable time-step.
+* @param ncells Number of cells in block (at most IMPLICIT_SRC_BATCH).
+* @param b Scratch holding the input (rho, mom, app_accel, E, B, ext_E, app_current) and output (mom, E) variables.
+*/
+void
+implicit_em_source_update_batch(const gkyl_moment_em_coupling* mom_em, double t_curr, double dt, int ncells,
+  struct implicit_src_batch* b);
+
+/**
+* Integrate the source terms of a charged multi-fluid equation system for a block of cells, using the batched implicit forcing solver.
+* Gives the same result as calling implicit_source_coupling_update in each cell.
+*
+* @param mom_em Moment-EM coupling object.
+* @param t_curr Current simulation time.
+* @param dt Current stable time-step.
+* @param ncells Number of cells in block (at most IMPLICIT_SRC_BATCH).
+* @param cells Pointers to the data in each cell of block.
+* @param b Scratch space.
+*/
+void
+implicit_source_coupling_update_batch(const gkyl_moment_em_coupling* mom_em, double t_curr, double dt, int ncells,
+  const struct implicit_src_cell* cells, struct implicit_src_batch* b);
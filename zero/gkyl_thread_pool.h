@@ -3,7 +3,9 @@
 #include <gkyl_job_pool.h>
 
 /**
- * Create a new thread-pool object
+ * Create a new thread-pool object. Each worker thread has its own
+ * deque of jobs and idle workers steal jobs from the other workers,
+ * so blocks of unequal cost are balanced across the pool.
  *
  * @param nthreads Number of threads to create
  * @return Pointer to new job-pool object
@@ -32,6 +32,12 @@ struct gkyl_vlasov_lte_correct_inp {
   bool use_gpu; // bool for gpu usage
   double eps; // tolerance for the iterator
   int max_iter; // number of total iterations
+  // CPU only: stop updating configuration-space cells once their
+  // moments have converged
+  bool use_cell_mask;
+  // CPU only: accelerate the fixed-point update of the moments in
+  // each configuration-space cell with Anderson mixing (depth 1)
+  bool use_anderson;
 };
 
 // Correction status
@@ -39,6 +45,8 @@ struct gkyl_vlasov_lte_correct_status {
   bool iter_converged; // true if iterations converged
   int num_iter; // number of iterations for the correction
   double error[6]; // error in each moment, up to 6 components
+  long num_cell_iter; // iterations summed over configuration-space cells
+  int max_cell_iter; // largest number of iterations in a cell
 };  
 
 /**
@@ -58,6 +66,8 @@ gkyl_vlasov_lte_correct_inew(const struct gkyl_vlasov_lte_correct_inp *inp);
  * so that *all* its stationary-frame moments (n, V_drift, T/m) match target moments.
  * NOTE: If this algorithm fails, the returns the original distribution function
  * with only the desired stationary-frame density moment corrected.
+ * With use_cell_mask, cells whose moments have converged are no longer
+ * reprojected, and their moments are not recomputed.
  *
  * @param up LTE distribution function moment correction updater
  * @param f_lte LTE distribution function to fix (modified in-place)
@@ -29,6 +29,15 @@ struct gkyl_vlasov_lte_correct
   bool use_last_converged; // Boolean for if we are using the results of the iterative scheme
                            // *even if* the scheme fails to converge. 
 
+  // per-cell iteration state (CPU only), indexed like conf_range_ext
+  bool use_cell_mask; // true if converged cells are no longer updated
+  bool use_anderson; // true if the moment update uses Anderson mixing
+  bool *cell_active; // true if cell has not converged yet
+  int *cell_niter; // number of iterations in each cell
+  double *cell_error; // last error in each cell, num_comp per cell
+  struct gkyl_array *d_moms_prev; // previous d_moms (Anderson mixing)
+  struct gkyl_array *dd_moms_prev; // previous dd_moms (Anderson mixing)
+
   bool use_gpu; // Boolean if we are performing projection on device.
   double *error_cu; // error on device if using GPUs 
   struct gkyl_array *abs_diff_moms;
@@ -2,6 +2,7 @@
 
 #include <gkyl_array.h>
 #include <gkyl_basis.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_grid.h> 
 
@@ -42,6 +43,18 @@ struct gkyl_vlasov_lte_moments_inp {
 struct gkyl_vlasov_lte_moments*
 gkyl_vlasov_lte_moments_inew(const struct gkyl_vlasov_lte_moments_inp *inp);
 
+/**
+ * Set job pool used to thread the velocity moments on the CPU (see
+ * gkyl_mom_calc_set_job_pool). The stationary-frame pressure of the
+ * special relativistic model is still computed serially.
+ *
+ * @param lte_moms LTE moments updater
+ * @param job_pool Job pool to use (or NULL)
+ * @param deterministic Should results be independent of the number of threads?
+ */
+void gkyl_vlasov_lte_moments_set_job_pool(struct gkyl_vlasov_lte_moments *lte_moms,
+  const struct gkyl_job_pool *job_pool, bool deterministic);
+
 /**
  * Compute the density moments of an arbitrary distribution function for the equivalent 
  * LTE (local thermodynamic equlibrium) distribution function.
@@ -4,6 +4,7 @@
 #include <gkyl_basis.h>
 #include <gkyl_comm.h>
 #include <gkyl_evalf_def.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_range.h>
 #include <gkyl_rect_grid.h>
 #include <gkyl_wave_geom.h>
@@ -30,6 +31,7 @@ struct gkyl_wave_prop_status {
   int success; // 1 if step worked, 0 otherwise
   double dt_suggested; // suggested time-step
   double max_speed; // max wave speed due to sweep in one direction
+  double dt_stable; // CFL-limited time-step (dt_suggested is not below dt on success)
 };
 
 // Object type for updater
@@ -53,12 +55,19 @@ struct gkyl_wave_prop_inp {
   const struct gkyl_comm *comm; // communcator
 };
 
-// Some statics from update calls
+// Some statics from update calls. Positivity fixes are only counted for
+// calls that succeed: fixes done in calls that fail because the CFL
+// condition is violated (and are hence redone) are counted separately.
 struct gkyl_wave_prop_stats {
   long n_calls; // number of calls to updater
-  long n_bad_advance_calls; // number of calls in which positivity had to be fixed
+  long n_bad_advance_calls; // number of 1D sweeps in which positivity had to be fixed
   long n_bad_cells; // number  of cells fixed
-  long n_max_bad_cells; // maximum number of cells fixed in any call
+  long n_max_bad_cells; // maximum number of cells fixed in any 1D sweep
+  long n_failed_calls; // number of calls that failed (CFL violated)
+  long n_failed_bad_cells; // number of cells fixed in failed calls
+  // wall-clock time spent sweeping along each direction (for fused
+  // multi-system updates this is the time of the fused sweep)
+  double sweep_tm[GKYL_MAX_DIM];
 };
 
 /**
@@ -69,6 +78,53 @@ struct gkyl_wave_prop_stats {
  */
 gkyl_wave_prop* gkyl_wave_prop_new(const struct gkyl_wave_prop_inp *winp);
 
+/**
+ * Set job pool to use for CPU shared-memory parallel update. When a
+ * pool with more than one worker is set, the 1D pencils in each
+ * direction are split into pool_size pieces and each piece is swept on
+ * a worker with its own slice buffers. The updated solution is
+ * identical to the serial one. Pass NULL to go back to the serial
+ * update. The pool is acquired by the updater.
+ *
+ * @param wv Updater object
+ * @param job_pool Job pool to use (or NULL)
+ */
+void gkyl_wave_prop_set_job_pool(gkyl_wave_prop *wv, const struct gkyl_job_pool *job_pool);
+
+/**
+ * Set array in which positivity fixes are counted, cell by cell.
+ * Whenever a cell fails the invariant-domain check in a sweep along
+ * direction dir, component dir of fix_count in that cell is
+ * incremented by one. Summing a component along its direction gives
+ * the count for each 1D pencil. Fixes made in a call that fails
+ * (because the CFL condition is violated) are not counted. The array
+ * must have at least ndim components and be defined on the same range
+ * as the solution. Pass NULL to stop counting. The array is not owned
+ * by the updater.
+ *
+ * @param wv Updater object
+ * @param fix_count Array for counts (or NULL)
+ */
+void gkyl_wave_prop_set_fix_count(gkyl_wave_prop *wv, struct gkyl_array *fix_count);
+
+/**
+ * Set array in which the fluctuations entering the boundary cells of
+ * the update range through the range boundary are stored. After a
+ * sweep along dir, the first and last cell of each pencil hold,
+ * respectively, in components [0,meqn) the fluctuation through their
+ * lower face, apdq - F2, and in components [meqn,2*meqn) the
+ * fluctuation through their upper face, amdq + F2 (F2 is the
+ * second-order correction flux, if it was applied). A boundary cell
+ * was updated by -dt/dx times these. Other cells are not
+ * touched. The array must have at least 2*meqn components and be
+ * defined on the same range as the solution. Pass NULL to stop
+ * storing. The array is not owned by the updater.
+ *
+ * @param wv Updater object
+ * @param bfluct Array for boundary fluctuations (or NULL)
+ */
+void gkyl_wave_prop_set_boundary_fluct(gkyl_wave_prop *wv, struct gkyl_array *bfluct);
+
 /**
  * Compute wave-propagation update. The update_rng MUST be a sub-range
  * of the range on which the array is defined. That is, it must be
@@ -86,6 +142,33 @@ struct gkyl_wave_prop_status gkyl_wave_prop_advance(gkyl_wave_prop *wv,
   double tm, double dt, const struct gkyl_range *update_range,
   const struct gkyl_array *qin, struct gkyl_array *qout);
 
+/**
+ * Compute wave-propagation update of nwv systems of equations (for
+ * example, the species of a multi-fluid simulation) in a single
+ * traversal of the grid. The updaters must share the grid, geometry
+ * and update directions. In each direction all systems are swept along
+ * a pencil before moving to the next one, so cell indices and geometry
+ * are loaded once for all systems. The solution of each system is the
+ * same as from gkyl_wave_prop_advance. If the CFL condition is
+ * violated for any system, the update of all systems fails. The job
+ * pool of the first updater is used for the threaded update.
+ *
+ * @param nwv Number of systems to update
+ * @param wv Updater for each system
+ * @param tm Current time
+ * @param dt time-step
+ * @param update_rng Range on which to compute.
+ * @param qin Input for each system
+ * @param qout Solution at tm+dt for each system
+ * @param status On output, status of update of each system
+ * @return Combined status: success only if all updates succeeded,
+ *   minimum suggested time-step and maximum wave speed
+ */
+struct gkyl_wave_prop_status gkyl_wave_prop_advance_multi(int nwv, gkyl_wave_prop *const *wv,
+  double tm, double dt, const struct gkyl_range *update_range,
+  const struct gkyl_array *const *qin, struct gkyl_array *const *qout,
+  struct gkyl_wave_prop_status *status);
+
 /**
  * Compute an estimate of maximum stable time-step for given input
  * state 'qin'
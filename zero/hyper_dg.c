@@ -5,6 +5,7 @@
 #include <gkyl_alloc.h>
 #include <gkyl_alloc_flags_priv.h>
 #include <gkyl_array_ops.h>
+#include <gkyl_eqn_type.h>
 #include <gkyl_hyper_dg.h>
 #include <gkyl_hyper_dg_priv.h>
 #include <gkyl_range.h>
@@ -40,28 +41,225 @@ gkyl_hyper_dg_set_update_vol(gkyl_hyper_dg *hdg, int update_vol_term)
   hdg->update_vol_term = update_vol_term;
 }
 
+static void
+mom_buff_release(gkyl_hyper_dg *hdg)
+{
+  int num_mom = hdg->fused_moms ? hdg->fused_moms->num_mom : 0;
+  for (int i=0; i<hdg->num_mom_buff*num_mom; ++i)
+    gkyl_array_release(hdg->mom_buff[i]);
+  gkyl_free(hdg->mom_buff);
+  hdg->mom_buff = 0;
+  hdg->num_mom_buff = 0;
+}
+
+// (Re)allocate per-worker moment arrays when fused moments are
+// computed with a job pool
+static void
+mom_buff_alloc(gkyl_hyper_dg *hdg)
+{
+  mom_buff_release(hdg);
+  int nthreads = hdg->job_pool ? hdg->job_pool->pool_size : 1;
+  if (!hdg->fused_moms || nthreads < 2) return;
+
+  int num_mom = hdg->fused_moms->num_mom;
+  hdg->num_mom_buff = nthreads;
+  hdg->mom_buff = gkyl_malloc(sizeof(struct gkyl_array*[nthreads*num_mom]));
+  for (int t=0; t<nthreads; ++t)
+    for (int m=0; m<num_mom; ++m) {
+      const struct gkyl_array *mout = hdg->fused_moms->mout[m];
+      hdg->mom_buff[t*num_mom+m] = gkyl_array_new(GKYL_DOUBLE, mout->ncomp, mout->size);
+    }
+}
+
 void
-gkyl_hyper_dg_advance(struct gkyl_hyper_dg *hdg, const struct gkyl_range *update_range,
-  const struct gkyl_array *fIn, struct gkyl_array *cflrate, struct gkyl_array *rhs)
+gkyl_hyper_dg_set_job_pool(gkyl_hyper_dg *hdg, const struct gkyl_job_pool *job_pool)
+{
+  if (hdg->job_pool)
+    gkyl_job_pool_release(hdg->job_pool);
+  hdg->job_pool = job_pool ? gkyl_job_pool_acquire(job_pool) : 0;
+  mom_buff_alloc(hdg);
+}
+
+void
+gkyl_hyper_dg_set_fused_moms(gkyl_hyper_dg *hdg, const struct gkyl_hyper_dg_fused_moms *fmom)
 {
+  mom_buff_release(hdg);
+  if (hdg->fused_moms) {
+    for (int m=0; m<hdg->fused_moms->num_mom; ++m) {
+      gkyl_mom_type_release(hdg->fused_moms->momt[m]);
+      gkyl_array_release(hdg->fused_moms->mout[m]);
+    }
+    gkyl_free(hdg->fused_moms);
+    hdg->fused_moms = 0;
+  }
+  if (fmom) {
+    assert(fmom->num_mom <= GKYL_HYPER_DG_MAX_FUSED_MOMS);
+    hdg->fused_moms = gkyl_malloc(sizeof(struct gkyl_hyper_dg_fused_moms));
+    *hdg->fused_moms = *fmom;
+    for (int m=0; m<fmom->num_mom; ++m) {
+      gkyl_mom_type_acquire(fmom->momt[m]);
+      gkyl_array_acquire(fmom->mout[m]);
+    }
+  }
+  mom_buff_alloc(hdg);
+}
+
+void
+gkyl_hyper_dg_set_kernel_stat(gkyl_hyper_dg *hdg, bool on)
+{
+  if (on) {
+    if (!hdg->kernel_stat)
+      hdg->kernel_stat = gkyl_malloc(sizeof(struct gkyl_hyper_dg_kernel_stat));
+    *hdg->kernel_stat = (struct gkyl_hyper_dg_kernel_stat) { 0 };
+  }
+  else if (hdg->kernel_stat) {
+    gkyl_free(hdg->kernel_stat);
+    hdg->kernel_stat = 0;
+  }
+}
+
+void
+gkyl_hyper_dg_set_vol_batch(gkyl_hyper_dg *hdg, vol_batch_termf_t vol_batch_term, int batch_size)
+{
+  hdg->vol_batch_term = vol_batch_term;
+  hdg->vol_batch_size = vol_batch_term ? batch_size : 1;
+  assert(hdg->vol_batch_size > 0);
+}
+
+struct gkyl_hyper_dg_kernel_stat
+gkyl_hyper_dg_get_kernel_stat(const gkyl_hyper_dg *hdg)
+{
+  return hdg->kernel_stat ? *hdg->kernel_stat : (struct gkyl_hyper_dg_kernel_stat) { 0 };
+}
+
+static void
+kernel_stat_accumulate(struct gkyl_hyper_dg_kernel_stat *out, const struct gkyl_hyper_dg_kernel_stat *inp)
+{
+  out->nvol += inp->nvol;
+  out->vol_tm += inp->vol_tm;
+  for (int d=0; d<GKYL_MAX_DIM; ++d) {
+    out->nsurf[d] += inp->nsurf[d];
+    out->surf_tm[d] += inp->surf_tm[d];
+    out->nboundary_surf[d] += inp->nboundary_surf[d];
+    out->boundary_surf_tm[d] += inp->boundary_surf_tm[d];
+  }
+}
+
+// Add contribution of cell idxc to the fused moments in mout
+static void
+hyper_dg_fused_moms_cell(const struct gkyl_hyper_dg *hdg, const struct gkyl_range *update_range,
+  const int *idxc, const double *xcc, const double *fc, struct gkyl_array *const *mout)
+{
+  const struct gkyl_hyper_dg_fused_moms *fmom = hdg->fused_moms;
+  int cdim = fmom->cdim, vdim = hdg->ndim-cdim;
+  long midx = gkyl_range_idx(&fmom->conf_range, idxc);
+  
+  for (int m=0; m<fmom->num_mom; ++m) {
+    double *out = gkyl_array_fetch(mout[m], midx);
+    if (!fmom->vel_edge[m]) {
+      gkyl_mom_type_calc(fmom->momt[m], xcc, hdg->grid.dx, idxc, fc, out, 0);
+      continue;
+    }
+    // boundary corrections, in the order used by gkyl_mom_calc_bcorr
+    for (int d=0; d<vdim; ++d) {
+      enum gkyl_vel_edge edge;
+      if (idxc[cdim+d] == update_range->upper[cdim+d]) {
+        edge = d + GKYL_MAX_CDIM;
+        gkyl_mom_type_calc(fmom->momt[m], xcc, hdg->grid.dx, idxc, fc, out, &edge);
+      }
+      if (idxc[cdim+d] == update_range->lower[cdim+d]) {
+        edge = d;
+        gkyl_mom_type_calc(fmom->momt[m], xcc, hdg->grid.dx, idxc, fc, out, &edge);
+      }
+    }
+  }
+}
+
+// Volume term of the cells in iter_range, computed with the batched
+// volume term for runs of consecutive cells along the last direction
+static void
+hyper_dg_advance_vol_batch(const struct gkyl_hyper_dg *hdg, const struct gkyl_range *update_range,
+  const struct gkyl_range *iter_range,
+  const struct gkyl_array *fIn, struct gkyl_array *cflrate, struct gkyl_array *rhs,
+  struct gkyl_hyper_dg_kernel_stat *kst)
+{
+  struct timespec wst;
+  int ndim = hdg->ndim, last = ndim-1;
+  int idxc[GKYL_MAX_DIM];
+  double xcc[GKYL_MAX_DIM];
+
+  // one cell per row along the last direction
+  struct gkyl_range rows;
+  gkyl_range_shorten_from_above(&rows, iter_range, last, 1);
+
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, &rows);
+  while (gkyl_range_iter_next(&iter)) {
+    gkyl_copy_int_arr(ndim, iter.idx, idxc);
+    while (idxc[last] <= iter_range->upper[last]) {
+      int ncells = GKYL_MIN2(hdg->vol_batch_size, iter_range->upper[last]-idxc[last]+1);
+      gkyl_rect_grid_cell_center(&hdg->grid, idxc, xcc);
+
+      long linc = gkyl_range_idx(update_range, idxc);
+      if (kst) wst = gkyl_wall_clock();
+      hdg->vol_batch_term(hdg->equation, ncells, xcc, hdg->grid.dx, idxc,
+        gkyl_array_cfetch(fIn, linc), gkyl_array_fetch(rhs, linc),
+        gkyl_array_fetch(cflrate, linc)
+      );
+      if (kst) {
+        kst->nvol += ncells;
+        kst->vol_tm += gkyl_time_diff_now_sec(wst);
+      }
+      idxc[last] += ncells;
+    }
+  }
+}
+
+// Update cells in iter_range, which is update_range, a split of it,
+// or a sub-range of it. Indexing and the zero-flux edge checks always
+// use the full update_range. Kernel calls are counted and timed in
+// kst, unless it is NULL. Fused moments (if any) are accumulated in
+// mout.
+static void
+hyper_dg_advance_range(const struct gkyl_hyper_dg *hdg, const struct gkyl_range *update_range,
+  const struct gkyl_range *iter_range,
+  const struct gkyl_array *fIn, struct gkyl_array *cflrate, struct gkyl_array *rhs,
+  struct gkyl_hyper_dg_kernel_stat *kst, struct gkyl_array *const *mout)
+{
+  struct timespec wst;
   int ndim = hdg->ndim;
   int idxl[GKYL_MAX_DIM], idxc[GKYL_MAX_DIM], idxr[GKYL_MAX_DIM], idx_edge[GKYL_MAX_DIM];
   double xcl[GKYL_MAX_DIM], xcc[GKYL_MAX_DIM], xcr[GKYL_MAX_DIM], xc_edge[GKYL_MAX_DIM];
   // integer used for selecting between left-edge zero-flux BCs and right-edge zero-flux BCs
   int edge;
 
+  // with a batched volume term all volume terms in iter_range are
+  // done first: each cell still gets its volume term before its
+  // surface terms
+  bool vol_batch = hdg->update_vol_term && hdg->vol_batch_term;
+  if (vol_batch && iter_range->volume > 0)
+    hyper_dg_advance_vol_batch(hdg, update_range, iter_range, fIn, cflrate, rhs, kst);
+
   struct gkyl_range_iter iter;
-  gkyl_range_iter_init(&iter, update_range);
+  gkyl_range_iter_init(&iter, iter_range);
   while (gkyl_range_iter_next(&iter)) {
     gkyl_copy_int_arr(ndim, iter.idx, idxc);
     gkyl_rect_grid_cell_center(&hdg->grid, idxc, xcc);
 
     long linc = gkyl_range_idx(update_range, idxc);
-    if (hdg->update_vol_term) {
+    if (mout)
+      hyper_dg_fused_moms_cell(hdg, update_range, idxc, xcc, gkyl_array_cfetch(fIn, linc), mout);
+    
+    if (hdg->update_vol_term && !vol_batch) {
+      if (kst) wst = gkyl_wall_clock();
       double cflr = hdg->equation->vol_term(
         hdg->equation, xcc, hdg->grid.dx, idxc,
         gkyl_array_cfetch(fIn, linc), gkyl_array_fetch(rhs, linc)
       );
+      if (kst) {
+        kst->nvol += 1;
+        kst->vol_tm += gkyl_time_diff_now_sec(wst);
+      }
       double *cflrate_d = gkyl_array_fetch(cflrate, linc);
       cflrate_d[0] += cflr; // frequencies are additive
     }
@@ -80,12 +278,17 @@ gkyl_hyper_dg_advance(struct gkyl_hyper_dg *hdg, const struct gkyl_range *update
         gkyl_rect_grid_cell_center(&hdg->grid, idx_edge, xc_edge);
         long lin_edge = gkyl_range_idx(update_range, idx_edge);
 
+        if (kst) wst = gkyl_wall_clock();
         cfls = hdg->equation->boundary_surf_term(hdg->equation,
           dir, xc_edge, xcc, hdg->grid.dx, hdg->grid.dx,
           idx_edge, idxc, edge,
           gkyl_array_cfetch(fIn, lin_edge), gkyl_array_cfetch(fIn, linc),
           gkyl_array_fetch(rhs, linc)
         );
+        if (kst) {
+          kst->nboundary_surf[dir] += 1;
+          kst->boundary_surf_tm[dir] += gkyl_time_diff_now_sec(wst);
+        }
       }
       else {
         gkyl_copy_int_arr(ndim, iter.idx, idxl);
@@ -97,12 +300,17 @@ gkyl_hyper_dg_advance(struct gkyl_hyper_dg *hdg, const struct gkyl_range *update
         long linl = gkyl_range_idx(update_range, idxl); 
         long linr = gkyl_range_idx(update_range, idxr);
 
+        if (kst) wst = gkyl_wall_clock();
         cfls = hdg->equation->surf_term(hdg->equation,
           dir, xcl, xcc, xcr, hdg->grid.dx, hdg->grid.dx, hdg->grid.dx,
           idxl, idxc, idxr,
           gkyl_array_cfetch(fIn, linl), gkyl_array_cfetch(fIn, linc), gkyl_array_cfetch(fIn, linr),
           gkyl_array_fetch(rhs, linc)
         );
+        if (kst) {
+          kst->nsurf[dir] += 1;
+          kst->surf_tm[dir] += gkyl_time_diff_now_sec(wst);
+        }
       }
       double *cflrate_d = gkyl_array_fetch(cflrate, linc);
       cflrate_d[0] += cfls; // frequencies are additive      
@@ -110,6 +318,162 @@ gkyl_hyper_dg_advance(struct gkyl_hyper_dg *hdg, const struct gkyl_range *update
   }
 }
 
+// data for each worker thread
+struct hyper_dg_thread_data {
+  const struct gkyl_hyper_dg *hdg; // shared updater
+  const struct gkyl_range *update_range; // full update range
+  struct gkyl_range range; // thread-specific split of range to visit
+  const struct gkyl_array *fIn; // shared input
+  struct gkyl_array *cflrate, *rhs; // shared output
+  struct gkyl_hyper_dg_kernel_stat kst; // thread-local kernel counters
+  struct gkyl_array *const *mout; // thread-local fused moments (NULL if off)
+};
+
+static void
+hyper_dg_thread_worker(void *ctx)
+{
+  struct hyper_dg_thread_data *td = ctx;
+  // each cell only writes its own rhs and cflrate entries, so the
+  // CFL frequencies accumulated by different threads never overlap
+  struct gkyl_hyper_dg_kernel_stat *kst = td->hdg->kernel_stat ? &td->kst : 0;
+  hyper_dg_advance_range(td->hdg, td->update_range, &td->range, td->fIn, td->cflrate, td->rhs,
+    kst, td->mout);
+}
+
+// Update cells in iter_range, splitting the work across the job pool
+// (if one is set)
+static void
+hyper_dg_advance_iter(const struct gkyl_hyper_dg *hdg, const struct gkyl_range *update_range,
+  const struct gkyl_range *iter_range,
+  const struct gkyl_array *fIn, struct gkyl_array *cflrate, struct gkyl_array *rhs)
+{
+  const struct gkyl_hyper_dg_fused_moms *fmom = hdg->fused_moms;
+  if (fmom)
+    assert(fIn->type == GKYL_DOUBLE);
+
+  int nthreads = hdg->job_pool ? hdg->job_pool->pool_size : 1;
+  if (nthreads < 2 || iter_range->volume < nthreads) {
+    struct gkyl_array *const *mout = fmom ? fmom->mout : 0;
+    hyper_dg_advance_range(hdg, update_range, iter_range, fIn, cflrate, rhs,
+      hdg->kernel_stat, mout);
+    return;
+  }
+
+  // moments from different workers may land in the same
+  // configuration-space cell: each worker sums into its own arrays
+  if (fmom)
+    for (int i=0; i<nthreads*fmom->num_mom; ++i)
+      gkyl_array_clear_range(hdg->mom_buff[i], 0.0, &fmom->conf_range);
+
+  struct gkyl_range rng = *iter_range;
+  struct hyper_dg_thread_data td[nthreads];
+  for (int tid=0; tid<nthreads; ++tid) {
+    td[tid] = (struct hyper_dg_thread_data) {
+      .hdg = hdg,
+      .update_range = update_range,
+      .range = gkyl_range_split(&rng, nthreads, tid),
+      .fIn = fIn,
+      .cflrate = cflrate,
+      .rhs = rhs,
+      .kst = { 0 },
+      .mout = fmom ? hdg->mom_buff + tid*fmom->num_mom : 0,
+    };
+    gkyl_job_pool_add_work(hdg->job_pool, hyper_dg_thread_worker, &td[tid]);
+  }
+  gkyl_job_pool_wait(hdg->job_pool);
+
+  if (hdg->kernel_stat)
+    for (int tid=0; tid<nthreads; ++tid)
+      kernel_stat_accumulate(hdg->kernel_stat, &td[tid].kst);
+
+  if (fmom)
+    for (int tid=0; tid<nthreads; ++tid)
+      for (int m=0; m<fmom->num_mom; ++m)
+        gkyl_array_accumulate_range(fmom->mout[m], 1.0, hdg->mom_buff[tid*fmom->num_mom+m],
+          &fmom->conf_range);
+}
+
+void
+gkyl_hyper_dg_advance(struct gkyl_hyper_dg *hdg, const struct gkyl_range *update_range,
+  const struct gkyl_array *fIn, struct gkyl_array *cflrate, struct gkyl_array *rhs)
+{
+  hyper_dg_advance_iter(hdg, update_range, update_range, fIn, cflrate, rhs);
+}
+
+// Cells in update_range that need ghost-cell data are those adjacent
+// to the range boundary in update directions without zero-flux
+// BCs. Returns false if the interior is empty.
+static bool
+hyper_dg_interior_range(const struct gkyl_hyper_dg *hdg, const struct gkyl_range *update_range,
+  struct gkyl_range *interior)
+{
+  int lower[GKYL_MAX_DIM], upper[GKYL_MAX_DIM];
+  for (int d=0; d<update_range->ndim; ++d) {
+    lower[d] = update_range->lower[d];
+    upper[d] = update_range->upper[d];
+  }
+  for (int d=0; d<hdg->num_up_dirs; ++d) {
+    int dir = hdg->update_dirs[d];
+    if (!hdg->zero_flux_flags[dir]) {
+      lower[dir] += 1;
+      upper[dir] -= 1;
+      if (lower[dir] > upper[dir])
+        return false;
+    }
+  }
+  gkyl_sub_range_init(interior, update_range, lower, upper);
+  return true;
+}
+
+void
+gkyl_hyper_dg_advance_interior(gkyl_hyper_dg *hdg, const struct gkyl_range *update_range,
+  const struct gkyl_array *fIn, struct gkyl_array *cflrate, struct gkyl_array *rhs)
+{
+  struct gkyl_range interior;
+  if (hyper_dg_interior_range(hdg, update_range, &interior))
+    hyper_dg_advance_iter(hdg, update_range, &interior, fIn, cflrate, rhs);
+}
+
+void
+gkyl_hyper_dg_advance_boundary(gkyl_hyper_dg *hdg, const struct gkyl_range *update_range,
+  const struct gkyl_array *fIn, struct gkyl_array *cflrate, struct gkyl_array *rhs)
+{
+  // The boundary layer is covered by disjoint slabs: for each
+  // direction needing ghost-cells, the lower and upper layers of the
+  // region left after removing the slabs of previous directions.
+  int lower[GKYL_MAX_DIM], upper[GKYL_MAX_DIM];
+  for (int d=0; d<update_range->ndim; ++d) {
+    lower[d] = update_range->lower[d];
+    upper[d] = update_range->upper[d];
+  }
+
+  for (int d=0; d<hdg->num_up_dirs; ++d) {
+    int dir = hdg->update_dirs[d];
+    if (hdg->zero_flux_flags[dir]) continue;
+
+    int slo[GKYL_MAX_DIM], sup[GKYL_MAX_DIM];
+    struct gkyl_range slab;
+
+    gkyl_copy_int_arr(update_range->ndim, lower, slo);
+    gkyl_copy_int_arr(update_range->ndim, upper, sup);
+    sup[dir] = lower[dir];
+    gkyl_sub_range_init(&slab, update_range, slo, sup);
+    hyper_dg_advance_iter(hdg, update_range, &slab, fIn, cflrate, rhs);
+
+    if (upper[dir] > lower[dir]) {
+      gkyl_copy_int_arr(update_range->ndim, lower, slo);
+      gkyl_copy_int_arr(update_range->ndim, upper, sup);
+      slo[dir] = upper[dir];
+      gkyl_sub_range_init(&slab, update_range, slo, sup);
+      hyper_dg_advance_iter(hdg, update_range, &slab, fIn, cflrate, rhs);
+    }
+
+    lower[dir] += 1;
+    upper[dir] -= 1;
+    if (lower[dir] > upper[dir]) break; // no cells left
+  }
+}
+
 void
 gkyl_hyper_dg_gen_stencil_advance(gkyl_hyper_dg *hdg, const struct gkyl_range *update_range,
   const struct gkyl_array *fIn, struct gkyl_array *cflrate, struct gkyl_array *rhs)
@@ -228,6 +592,12 @@ gkyl_hyper_dg_new(const struct gkyl_rect_grid *grid,
     
   up->update_vol_term = update_vol_term;
   up->equation = gkyl_dg_eqn_acquire(equation);
+  up->job_pool = 0; // serial update by default
+  up->kernel_stat = 0; // no kernel counters by default
+  gkyl_hyper_dg_set_vol_batch(up, 0, 1); // per-cell volume term by default
+  up->fused_moms = 0; // no fused moments by default
+  up->num_mom_buff = 0;
+  up->mom_buff = 0;
 
   up->flags = 0;
   GKYL_CLEAR_CU_ALLOC(up->flags);
@@ -239,7 +609,12 @@ gkyl_hyper_dg_new(const struct gkyl_rect_grid *grid,
 
 void gkyl_hyper_dg_release(struct gkyl_hyper_dg* hdg)
 {
+  gkyl_hyper_dg_set_fused_moms(hdg, 0);
   gkyl_dg_eqn_release(hdg->equation);
+  if (hdg->job_pool)
+    gkyl_job_pool_release(hdg->job_pool);
+  if (hdg->kernel_stat)
+    gkyl_free(hdg->kernel_stat);
   if (GKYL_IS_CU_ALLOC(hdg->flags))
     gkyl_cu_free(hdg->on_dev);
   gkyl_free(hdg);
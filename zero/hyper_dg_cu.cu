@@ -132,6 +132,13 @@ gkyl_hyper_dg_cu_dev_new(const struct gkyl_rect_grid *grid,
     up->zero_flux_flags[i] = zero_flux_flags[i];
     
   up->update_vol_term = update_vol_term;
+  up->job_pool = 0; // job pool not used on device
+  up->kernel_stat = 0; // kernel counters not used on device
+  up->vol_batch_term = 0; // batched volume term not used on device
+  up->vol_batch_size = 1;
+  up->fused_moms = 0; // fused moments not used on device
+  up->num_mom_buff = 0;
+  up->mom_buff = 0;
 
   // aquire pointer to equation object
   struct gkyl_dg_eqn *eqn = gkyl_dg_eqn_acquire(equation);
@@ -1,5 +1,20 @@
+#include <gkyl_alloc.h>
 #include <gkyl_job_pool.h>
 
+// context for each piece of a parallel-for
+struct parallel_for_ctx {
+  struct gkyl_range range; // split range for this piece
+  jp_range_func func; // function to call
+  void *ctx; // user context
+};
+
+static void
+parallel_for_job(void *ctx)
+{
+  struct parallel_for_ctx *pctx = ctx;
+  pctx->func(&pctx->range, pctx->ctx);
+}
+
 bool
 gkyl_job_pool_add_work(const struct gkyl_job_pool *jp, jp_work_func func, void *ctx)
 {
@@ -12,6 +27,32 @@ gkyl_job_pool_wait(const struct gkyl_job_pool *jp)
   jp->wait(jp);
 }
 
+void
+gkyl_job_pool_parallel_for(const struct gkyl_job_pool *jp,
+  const struct gkyl_range *range, long grain, jp_range_func func, void *ctx)
+{
+  if (range->volume == 0) return;
+  
+  long nsplit = jp->pool_size;
+  if (grain > 0)
+    nsplit = (range->volume + grain - 1)/grain;
+  if (nsplit > range->volume) nsplit = range->volume;
+  if (nsplit < 1) nsplit = 1;
+
+  struct gkyl_range rng = *range;
+  struct parallel_for_ctx *pctx = gkyl_malloc(sizeof(struct parallel_for_ctx[nsplit]));
+  for (long i=0; i<nsplit; ++i) {
+    pctx[i] = (struct parallel_for_ctx) {
+      .range = gkyl_range_split(&rng, nsplit, i),
+      .func = func,
+      .ctx = ctx
+    };
+    gkyl_job_pool_add_work(jp, parallel_for_job, &pctx[i]);
+  }
+  gkyl_job_pool_wait(jp);
+  gkyl_free(pctx);
+}
+
 struct gkyl_job_pool*
 gkyl_job_pool_acquire(const struct gkyl_job_pool *jp)
 {
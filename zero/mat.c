@@ -1,5 +1,6 @@
 #include <gkyl_alloc.h>
 #include <gkyl_alloc_flags_priv.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_mat.h>
 #include <gkyl_mat_priv.h>
 #include <gkyl_ref_count.h>
@@ -22,6 +23,7 @@
 #endif
 
 #include <assert.h>
+#include <math.h>
 #include <string.h>
 
 /** Map Gkyl flags to CBLAS flags */
@@ -38,6 +40,10 @@ struct gkyl_nmat_mem {
 
   // data needed in batched LU solves on host
   long *ipiv_ho; // host-side pivot vector
+  int *ipiv_lu; // pivots of all matrices from the last factorization
+  double *work_ho; // packed batch workspace (serial solves)
+  size_t work_sz; // number of doubles in work_ho
+  const struct gkyl_job_pool *job_pool; // pool to thread over batches (or NULL)
 
   // data needed in batched LU solves on device
   int *ipiv_cu; // device-side pivot vector
@@ -402,6 +408,10 @@ gkyl_nmat_linsolve_lu_new(size_t num, size_t nrow)
   mem->nrows = nrow;
   
   mem->ipiv_ho = gkyl_malloc(sizeof(long[nrow]));
+  mem->ipiv_lu = 0;
+  mem->work_ho = 0;
+  mem->work_sz = 0;
+  mem->job_pool = 0;
 
 #ifdef GKYL_HAVE_CUDA
   mem->cuh = 0;
@@ -410,6 +420,15 @@ gkyl_nmat_linsolve_lu_new(size_t num, size_t nrow)
   return mem;
 }
 
+void
+gkyl_nmat_linsolve_lu_set_job_pool(gkyl_nmat_mem *mem, const struct gkyl_job_pool *job_pool)
+{
+  assert(mem->on_gpu == false);
+  if (mem->job_pool)
+    gkyl_job_pool_release(mem->job_pool);
+  mem->job_pool = job_pool ? gkyl_job_pool_acquire(job_pool) : 0;
+}
+
 gkyl_nmat_mem *
 gkyl_nmat_linsolve_lu_cu_dev_new(size_t num, size_t nrow)
 {
@@ -444,6 +463,10 @@ gkyl_nmat_linsolve_lu_release(gkyl_nmat_mem *mem)
   }
   else {
     gkyl_free(mem->ipiv_ho);
+    gkyl_free(mem->ipiv_lu);
+    gkyl_free(mem->work_ho);
+    if (mem->job_pool)
+      gkyl_job_pool_release(mem->job_pool);
   }
   
   gkyl_free(mem);
@@ -570,6 +593,263 @@ gkyl_nmat_mv(double alpha, double beta, enum gkyl_mat_trans transa, struct gkyl_
 }
 
 
+// Host-side batched LU solves: matrices are packed NMAT_LANES at a
+// time into an interleaved layout, element (i,j) of lane l stored at
+// [(j*nr+i)*NMAT_LANES+l], so that the innermost loop of the
+// factorization and triangular solves runs over lanes with unit
+// stride and a compile-time trip count. Each lane is factored with
+// partial pivoting exactly like dgetf2. Matrices larger than
+// NMAT_BATCH_MAX_NROW go through LAPACK one at a time: beyond that a
+// packed batch no longer fits in cache and the per-matrix blocked
+// factorization is faster.
+
+#define NMAT_LANES 8
+#define NMAT_BATCH_MAX_NROW 48
+
+// number of doubles in the packed workspace for one batch
+static inline size_t
+nmat_batch_work_sz(size_t nr, size_t nc)
+{
+  return NMAT_LANES*(nr*nr + nr*nc + nr);
+}
+
+// Copy 'nlanes' matrices starting at 'start' into packed layout. Empty
+// lanes are filled with the identity so they never fail to factor. 'x'
+// may be NULL when only factoring.
+static void
+nmat_batch_pack(const struct gkyl_nmat *A, const struct gkyl_nmat *x, size_t start, int nlanes,
+  double * GKYL_RESTRICT Ab, double * GKYL_RESTRICT xb)
+{
+  size_t nr = A->nr, nc = x ? x->nc : 0;
+  for (int l=0; l<nlanes; ++l) {
+    const double *Al = A->mptr[start+l];
+    for (size_t k=0; k<nr*nr; ++k) Ab[k*NMAT_LANES+l] = Al[k];
+    if (nc) {
+      const double *xl = x->mptr[start+l];
+      for (size_t k=0; k<nr*nc; ++k) xb[k*NMAT_LANES+l] = xl[k];
+    }
+  }
+  for (int l=nlanes; l<NMAT_LANES; ++l) {
+    for (size_t j=0; j<nr; ++j)
+      for (size_t i=0; i<nr; ++i)
+        Ab[(j*nr+i)*NMAT_LANES+l] = i == j ? 1.0 : 0.0;
+    for (size_t k=0; k<nr*nc; ++k) xb[k*NMAT_LANES+l] = 0.0;
+  }
+}
+
+// Copy 'nlanes' matrices back from packed layout. The RHS of a lane
+// that failed to factor is left untouched.
+static void
+nmat_batch_unpack(struct gkyl_nmat *A, struct gkyl_nmat *x, size_t start, int nlanes,
+  const bool lane_ok[NMAT_LANES], const double * GKYL_RESTRICT Ab, const double * GKYL_RESTRICT xb)
+{
+  size_t nr = A->nr, nc = x ? x->nc : 0;
+  for (int l=0; l<nlanes; ++l) {
+    double *Al = A->mptr[start+l];
+    for (size_t k=0; k<nr*nr; ++k) Al[k] = Ab[k*NMAT_LANES+l];
+    if (nc && lane_ok[l]) {
+      double *xl = x->mptr[start+l];
+      for (size_t k=0; k<nr*nc; ++k) xl[k] = xb[k*NMAT_LANES+l];
+    }
+  }
+}
+
+// LU-factor one packed batch in place. 'piv' must have space for
+// nr*NMAT_LANES entries and holds the pivot rows (stored as doubles so
+// the whole workspace is a single allocation). A singular lane is
+// flagged in 'lane_ok' and, as in dgetf2, its zero pivot column is
+// left unscaled, so the factorization of the other lanes always
+// completes. Returns false if any lane is singular.
+static bool
+nmat_batch_lu_factor(size_t nr, double * GKYL_RESTRICT Ab, double * GKYL_RESTRICT piv,
+  bool lane_ok[NMAT_LANES])
+{
+  bool status = true;
+  const size_t W = NMAT_LANES;
+  for (size_t l=0; l<W; ++l) lane_ok[l] = true;
+
+  for (size_t k=0; k<nr; ++k) {
+    double *Ak = Ab + k*nr*W; // column k
+
+    // pivot search and row interchange, lane by lane
+    for (size_t l=0; l<W; ++l) {
+      size_t p = k;
+      double amax = fabs(Ak[k*W+l]);
+      for (size_t i=k+1; i<nr; ++i) {
+        double a = fabs(Ak[i*W+l]);
+        if (a > amax) { amax = a; p = i; }
+      }
+      piv[k*W+l] = p;
+      if (amax == 0.0) lane_ok[l] = status = false;
+      if (p != k)
+        for (size_t j=0; j<nr; ++j) {
+          double *Aj = Ab + j*nr*W;
+          double tmp = Aj[k*W+l]; Aj[k*W+l] = Aj[p*W+l]; Aj[p*W+l] = tmp;
+        }
+    }
+
+    // scale column below diagonal by the inverse pivot (the column of
+    // a zero pivot is all zeros and is left alone)
+    double rpiv[NMAT_LANES];
+    for (size_t l=0; l<W; ++l) rpiv[l] = Ak[k*W+l] != 0.0 ? 1.0/Ak[k*W+l] : 1.0;
+    for (size_t i=k+1; i<nr; ++i)
+      for (size_t l=0; l<W; ++l) Ak[i*W+l] *= rpiv[l];
+
+    // rank-1 update of trailing sub-matrix
+    for (size_t j=k+1; j<nr; ++j) {
+      double *Aj = Ab + j*nr*W;
+      double ukj[NMAT_LANES];
+      for (size_t l=0; l<W; ++l) ukj[l] = Aj[k*W+l];
+      for (size_t i=k+1; i<nr; ++i)
+        for (size_t l=0; l<W; ++l) Aj[i*W+l] -= Ak[i*W+l]*ukj[l];
+    }
+  }
+  return status;
+}
+
+// Solve with a packed batch of LU factors, overwriting RHSs in xb
+static void
+nmat_batch_lu_solve(size_t nr, size_t nc, const double * GKYL_RESTRICT Ab,
+  double * GKYL_RESTRICT xb, const double * GKYL_RESTRICT piv)
+{
+  const size_t W = NMAT_LANES;
+  
+  for (size_t c=0; c<nc; ++c) {
+    double *b = xb + c*nr*W;
+
+    // apply row interchanges
+    for (size_t k=0; k<nr; ++k)
+      for (size_t l=0; l<W; ++l) {
+        size_t p = piv[k*W+l];
+        if (p != k) {
+          double tmp = b[k*W+l]; b[k*W+l] = b[p*W+l]; b[p*W+l] = tmp;
+        }
+      }
+    // forward substitution with unit lower-triangular L
+    for (size_t k=0; k<nr; ++k) {
+      const double *Ak = Ab + k*nr*W;
+      for (size_t i=k+1; i<nr; ++i)
+        for (size_t l=0; l<W; ++l) b[i*W+l] -= Ak[i*W+l]*b[k*W+l];
+    }
+    // backward substitution with U
+    for (size_t k=nr; k-- > 0; ) {
+      const double *Ak = Ab + k*nr*W;
+      for (size_t l=0; l<W; ++l) b[k*W+l] /= Ak[k*W+l];
+      for (size_t i=0; i<k; ++i)
+        for (size_t l=0; l<W; ++l) b[i*W+l] -= Ak[i*W+l]*b[k*W+l];
+    }
+  }
+}
+
+// Solve with the LU factors of a single (unpacked) matrix. Same
+// operations, in the same order, as nmat_batch_lu_solve.
+static void
+mat_lu_solve(size_t nr, size_t nc, const double * GKYL_RESTRICT LU,
+  const int * GKYL_RESTRICT piv, double * GKYL_RESTRICT x)
+{
+  for (size_t c=0; c<nc; ++c) {
+    double *b = x + c*nr;
+
+    for (size_t k=0; k<nr; ++k) {
+      size_t p = piv[k];
+      if (p != k) {
+        double tmp = b[k]; b[k] = b[p]; b[p] = tmp;
+      }
+    }
+    for (size_t k=0; k<nr; ++k) {
+      const double *LUk = LU + k*nr;
+      for (size_t i=k+1; i<nr; ++i)
+        b[i] -= LUk[i]*b[k];
+    }
+    for (size_t k=nr; k-- > 0; ) {
+      const double *LUk = LU + k*nr;
+      b[k] /= LUk[k];
+      for (size_t i=0; i<k; ++i)
+        b[i] -= LUk[i]*b[k];
+    }
+  }
+}
+
+struct nmat_batch_ctx {
+  struct gkyl_nmat *A, *x; // x is NULL when only factoring
+  int *ipiv; // if not NULL, pivots of each matrix are stored here
+  double *work; // workspace (NULL: allocate per piece)
+  bool *batch_status; // status of each batch
+};
+
+// factor (and solve) batches with indices in (possibly split) 1D range
+static void
+nmat_batch_range(const struct gkyl_range *range, void *ctx)
+{
+  struct nmat_batch_ctx *bctx = ctx;
+  struct gkyl_nmat *A = bctx->A, *x = bctx->x;
+  size_t nr = A->nr, nc = x ? x->nc : 0;
+  
+  double *work = bctx->work ? bctx->work :
+    gkyl_malloc(sizeof(double[nmat_batch_work_sz(nr, nc)]));
+  double *Ab = work, *xb = Ab + NMAT_LANES*nr*nr, *piv = xb + NMAT_LANES*nr*nc;
+
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, range);
+  while (gkyl_range_iter_next(&iter)) {
+    long b = iter.idx[0];
+    size_t start = b*NMAT_LANES;
+    int nlanes = A->num-start < NMAT_LANES ? A->num-start : NMAT_LANES;
+    nmat_batch_pack(A, x, start, nlanes, Ab, xb);
+    bool lane_ok[NMAT_LANES];
+    bool status = nmat_batch_lu_factor(nr, Ab, piv, lane_ok);
+    // lanes are independent: a singular lane only spoils its own RHS,
+    // which is not unpacked
+    if (nc)
+      nmat_batch_lu_solve(nr, nc, Ab, xb, piv);
+    nmat_batch_unpack(A, x, start, nlanes, lane_ok, Ab, xb);
+    if (bctx->ipiv)
+      for (int l=0; l<nlanes; ++l)
+        for (size_t k=0; k<nr; ++k)
+          bctx->ipiv[(start+l)*nr+k] = piv[k*NMAT_LANES+l];
+    bctx->batch_status[b] = status;
+  }
+
+  if (!bctx->work)
+    gkyl_free(work);
+}
+
+// run nmat_batch_range over all batches, threaded if a pool is set
+static bool
+ho_nmat_batch_run(gkyl_nmat_mem *mem, struct gkyl_nmat *A, struct gkyl_nmat *x, int *ipiv)
+{
+  bool status = true;
+  
+  long nbatch = (A->num + NMAT_LANES - 1)/NMAT_LANES;
+  if (nbatch == 0) return status;
+  bool *batch_status = gkyl_malloc(sizeof(bool[nbatch]));
+
+  struct gkyl_range brange;
+  gkyl_range_init(&brange, 1, (int[]) { 0 }, (int[]) { nbatch-1 });
+  
+  struct nmat_batch_ctx bctx = {
+    .A = A, .x = x, .ipiv = ipiv, .batch_status = batch_status
+  };
+  if (mem->job_pool && mem->job_pool->pool_size > 1 && nbatch > 1) {
+    gkyl_job_pool_parallel_for(mem->job_pool, &brange, 0, nmat_batch_range, &bctx);
+  }
+  else {
+    size_t sz = nmat_batch_work_sz(A->nr, x ? x->nc : 0);
+    if (sz > mem->work_sz) {
+      mem->work_ho = gkyl_realloc(mem->work_ho, sizeof(double[sz]));
+      mem->work_sz = sz;
+    }
+    bctx.work = mem->work_ho;
+    nmat_batch_range(&brange, &bctx);
+  }
+
+  for (long b=0; b<nbatch; ++b)
+    status = status && batch_status[b];
+  gkyl_free(batch_status);
+
+  return status;
+}
+
 static bool
 ho_nmat_linsolve_lu(gkyl_nmat_mem *mem, struct gkyl_nmat *A, struct gkyl_nmat *x)
 {
@@ -581,14 +861,73 @@ ho_nmat_linsolve_lu(gkyl_nmat_mem *mem, struct gkyl_nmat *A, struct gkyl_nmat *x
 
   bool status = true;
 
-  for (size_t i=0; i<num; ++i) {
-    struct gkyl_mat Ai = gkyl_nmat_get(A,i);
-    struct gkyl_mat xi = gkyl_nmat_get(x,i);
-    status = gkyl_mat_linsolve_lu( &Ai, &xi, mem->ipiv_ho );
-    if (!status) break;
+  if (A->nr > NMAT_BATCH_MAX_NROW) {
+    // as in the batched path, a singular matrix does not stop the rest
+    for (size_t i=0; i<num; ++i) {
+      struct gkyl_mat Ai = gkyl_nmat_get(A,i);
+      struct gkyl_mat xi = gkyl_nmat_get(x,i);
+      if (!gkyl_mat_linsolve_lu( &Ai, &xi, mem->ipiv_ho ))
+        status = false;
+    }
+    return status;
   }
 
-  return status;
+  return ho_nmat_batch_run(mem, A, x, 0);
+}
+
+// LU factor a single matrix with LAPACK, storing 0-based pivots
+static bool
+mat_lu_factor_lapack(struct gkyl_mat *A, int *piv)
+{
+#ifdef GKYL_USING_FRAMEWORK_ACCELERATE
+  __CLPK_integer info;
+  __CLPK_integer n = A->nr;
+  __CLPK_integer lda = A->nr;
+  __CLPK_integer ipiv[A->nr];
+  dgetrf_(&n, &n, A->data, &lda, ipiv, &info);
+#else
+  lapack_int ipiv[A->nr];
+  int info = LAPACKE_dgetrf(LAPACK_COL_MAJOR, A->nr, A->nr, A->data, A->nr, ipiv);
+#endif
+  for (size_t k=0; k<A->nr; ++k)
+    piv[k] = ipiv[k]-1;
+  
+  return info == 0 ? true : false;
+}
+
+bool
+gkyl_nmat_lu_factor_pa(gkyl_nmat_mem *mem, struct gkyl_nmat *A)
+{
+  assert(mem->on_gpu == false);
+  assert(A->num <= mem->num);
+  assert(mem->nrows == A->nr);
+
+  if (!mem->ipiv_lu)
+    mem->ipiv_lu = gkyl_malloc(sizeof(int[mem->num*mem->nrows]));
+
+  if (A->nr > NMAT_BATCH_MAX_NROW) {
+    bool status = true;
+    for (size_t i=0; i<A->num; ++i) {
+      struct gkyl_mat Ai = gkyl_nmat_get(A,i);
+      if (!mat_lu_factor_lapack(&Ai, mem->ipiv_lu+i*A->nr))
+        status = false;
+    }
+    return status;
+  }
+  
+  return ho_nmat_batch_run(mem, A, 0, mem->ipiv_lu);
+}
+
+void
+gkyl_nmat_lu_solve_pa(gkyl_nmat_mem *mem, const struct gkyl_nmat *LU, struct gkyl_nmat *x)
+{
+  assert(mem->on_gpu == false);
+  assert(mem->ipiv_lu);
+  assert(LU->num <= x->num);
+
+  size_t nr = LU->nr, nc = x->nc;
+  for (size_t i=0; i<LU->num; ++i)
+    mat_lu_solve(nr, nc, LU->mptr[i], mem->ipiv_lu+i*nr, x->mptr[i]);
 }
 
 static bool
@@ -19,6 +19,8 @@ gkyl_mom_calc_new(const struct gkyl_rect_grid *grid,
   
   up->grid = *grid;
   up->momt = gkyl_mom_type_acquire(momt);
+  up->job_pool = 0;
+  up->deterministic = false;
 
   up->flags = 0;
   GKYL_CLEAR_CU_ALLOC(up->flags);
@@ -37,46 +39,203 @@ copy_idx_arrays(int cdim, int pdim, const int *cidx, const int *vidx, int *out)
 }
 
 void
-gkyl_mom_calc_advance(const struct gkyl_mom_calc* calc,
-  const struct gkyl_range *phase_rng, const struct gkyl_range *conf_rng,
-  const struct gkyl_array *GKYL_RESTRICT fin, struct gkyl_array *GKYL_RESTRICT mout)
+gkyl_mom_calc_set_job_pool(gkyl_mom_calc *calc, const struct gkyl_job_pool *job_pool)
+{
+  if (calc->job_pool)
+    gkyl_job_pool_release(calc->job_pool);
+  calc->job_pool = job_pool ? gkyl_job_pool_acquire(job_pool) : 0;
+}
+
+void
+gkyl_mom_calc_set_deterministic(gkyl_mom_calc *calc, bool on)
+{
+  calc->deterministic = on;
+}
+
+// Add the contribution of block vblock (out of nvblock) of the
+// velocity space of configuration-space cell cidx to out
+static void
+mom_calc_conf_cell(const struct gkyl_mom_calc* calc,
+  const struct gkyl_range *phase_rng, const struct gkyl_range *conf_rng, const int *cidx,
+  int nvblock, int vblock, const struct gkyl_array *GKYL_RESTRICT fin, double *out)
 {
   double xc[GKYL_MAX_DIM];
+  double fin_d[fin->ncomp]; // promoted cell data for GKYL_FLOAT input
   struct gkyl_range vel_rng;
-  struct gkyl_range_iter conf_iter, vel_iter;
+  struct gkyl_range_iter vel_iter;
   
   int pidx[GKYL_MAX_DIM], rem_dir[GKYL_MAX_DIM] = { 0 };
   for (int d=0; d<conf_rng->ndim; ++d) rem_dir[d] = 1;
 
+  gkyl_range_deflate(&vel_rng, phase_rng, rem_dir, cidx);
+  if (nvblock > 1) {
+    struct gkyl_range vel_split = gkyl_range_split(&vel_rng, nvblock, vblock);
+    gkyl_range_iter_init(&vel_iter, &vel_split);
+  }
+  else {
+    gkyl_range_iter_no_split_init(&vel_iter, &vel_rng);
+  }
+
+  while (gkyl_range_iter_next(&vel_iter)) {
+    
+    copy_idx_arrays(conf_rng->ndim, phase_rng->ndim, cidx, vel_iter.idx, pidx);
+    gkyl_rect_grid_cell_center(&calc->grid, pidx, xc);
+    
+    long fidx = gkyl_range_idx(&vel_rng, vel_iter.idx);
+
+    const double *fptr = gkyl_array_cfetch(fin, fidx);
+    if (fin->type == GKYL_FLOAT) {
+      // single-precision storage: promote cell data to double
+      const float *fin_f = gkyl_array_cfetch(fin, fidx);
+      for (int k=0; k<fin->ncomp; ++k) fin_d[k] = fin_f[k];
+      fptr = fin_d;
+    }
+
+    gkyl_mom_type_calc(calc->momt, xc, calc->grid.dx, pidx, fptr, out, 0);
+  }
+}
+
+// Pairwise tree reduction of nvblock blocks of len doubles into the
+// first block
+static void
+vblock_tree_sum(int nvblock, long len, double *vbuff)
+{
+  for (int stride=1; stride<nvblock; stride *= 2)
+    for (int b=0; b+stride<nvblock; b += 2*stride) {
+      double *bout = vbuff + b*len;
+      const double *bin = vbuff + (b+stride)*len;
+      for (long i=0; i<len; ++i) bout[i] += bin[i];
+    }
+}
+
+struct mom_calc_ctx {
+  const struct gkyl_mom_calc *calc;
+  const struct gkyl_range *phase_rng, *conf_rng;
+  const struct gkyl_array *fin;
+  struct gkyl_array *mout;
+  int nvblock; // number of velocity-space blocks
+  double *vbuff; // per-block moments, [nvblock][conf_rng->volume][ncomp]
+};
+
+// compute moments in the (split) configuration-space range. If
+// nvblock > 1 each cell sums its velocity-space blocks with the same
+// tree as mom_calc_vblock_range, so both give identical results.
+static void
+mom_calc_conf_range(const struct gkyl_range *range, void *ctx)
+{
+  struct mom_calc_ctx *mctx = ctx;
+  int nvblock = mctx->nvblock, ncomp = mctx->mout->ncomp;
+  double *vb = nvblock > 1 ? gkyl_malloc(sizeof(double[nvblock*ncomp])) : 0;
+  
+  struct gkyl_range_iter conf_iter;
+  gkyl_range_iter_init(&conf_iter, range);
+  while (gkyl_range_iter_next(&conf_iter)) {
+    long midx = gkyl_range_idx(mctx->conf_rng, conf_iter.idx);
+    double *mout_d = gkyl_array_fetch(mctx->mout, midx);
+    if (nvblock > 1) {
+      for (int i=0; i<nvblock*ncomp; ++i) vb[i] = 0.0;
+      for (int b=0; b<nvblock; ++b)
+        mom_calc_conf_cell(mctx->calc, mctx->phase_rng, mctx->conf_rng, conf_iter.idx,
+          nvblock, b, mctx->fin, vb + b*ncomp);
+      vblock_tree_sum(nvblock, ncomp, vb);
+      for (int k=0; k<ncomp; ++k) mout_d[k] = vb[k];
+    }
+    else {
+      mom_calc_conf_cell(mctx->calc, mctx->phase_rng, mctx->conf_rng, conf_iter.idx, 1, 0,
+        mctx->fin, mout_d);
+    }
+  }
+  gkyl_free(vb);
+}
+
+// compute moments from the velocity-space blocks in range
+static void
+mom_calc_vblock_range(const struct gkyl_range *range, void *ctx)
+{
+  struct mom_calc_ctx *mctx = ctx;
+  int ncomp = mctx->mout->ncomp;
+  long cvol = mctx->conf_rng->volume;
+  
+  struct gkyl_range_iter biter, conf_iter;
+  gkyl_range_iter_init(&biter, range);
+  while (gkyl_range_iter_next(&biter)) {
+    int b = biter.idx[0];
+    double *bout = mctx->vbuff + b*cvol*ncomp;
+    for (long i=0; i<cvol*ncomp; ++i) bout[i] = 0.0;
+    
+    long c = 0;
+    gkyl_range_iter_init(&conf_iter, mctx->conf_rng);
+    while (gkyl_range_iter_next(&conf_iter)) {
+      mom_calc_conf_cell(mctx->calc, mctx->phase_rng, mctx->conf_rng, conf_iter.idx,
+        mctx->nvblock, b, mctx->fin, bout + c*ncomp);
+      c += 1;
+    }
+  }
+}
+
+void
+gkyl_mom_calc_advance(const struct gkyl_mom_calc* calc,
+  const struct gkyl_range *phase_rng, const struct gkyl_range *conf_rng,
+  const struct gkyl_array *GKYL_RESTRICT fin, struct gkyl_array *GKYL_RESTRICT mout)
+{
   gkyl_array_clear_range(mout, 0.0, conf_rng);
 
+  struct mom_calc_ctx mctx = {
+    .calc = calc,
+    .phase_rng = phase_rng,
+    .conf_rng = conf_rng,
+    .fin = fin,
+    .mout = mout,
+    // in deterministic mode every path sums the same fixed blocks in
+    // the same order, so results do not depend on the path taken
+    .nvblock = calc->deterministic ? GKYL_MOM_CALC_NUM_VBLOCK : 1,
+  };
+
   // the outer loop is over configuration space cells; for each
   // config-space cell the inner loop walks over the velocity space
   // computing the contribution to the moment
-  gkyl_range_iter_init(&conf_iter, conf_rng);
-  while (gkyl_range_iter_next(&conf_iter)) {
-    long midx = gkyl_range_idx(conf_rng, conf_iter.idx);
+  int nthreads = calc->job_pool ? calc->job_pool->pool_size : 1;
+  if (nthreads < 2) {
+    mom_calc_conf_range(conf_rng, &mctx);
+    return;
+  }
+  if (conf_rng->volume >= 4*nthreads) {
+    // each thread owns its configuration-space cells
+    gkyl_job_pool_parallel_for(calc->job_pool, conf_rng, 0, mom_calc_conf_range, &mctx);
+    return;
+  }
 
-    gkyl_range_deflate(&vel_rng, phase_rng, rem_dir, conf_iter.idx);
-    gkyl_range_iter_no_split_init(&vel_iter, &vel_rng);
+  // too few configuration-space cells to keep the threads busy: split
+  // velocity space into blocks and sum the blocks afterwards
+  int nvblock = calc->deterministic ? GKYL_MOM_CALC_NUM_VBLOCK : nthreads;
+  int ncomp = mout->ncomp;
+  long cvol = conf_rng->volume;
+  mctx.nvblock = nvblock;
+  mctx.vbuff = gkyl_malloc(sizeof(double[nvblock*cvol*ncomp]));
 
-    while (gkyl_range_iter_next(&vel_iter)) {
-      
-      copy_idx_arrays(conf_rng->ndim, phase_rng->ndim, conf_iter.idx, vel_iter.idx, pidx);
-      gkyl_rect_grid_cell_center(&calc->grid, pidx, xc);
-      
-      long fidx = gkyl_range_idx(&vel_rng, vel_iter.idx);
+  struct gkyl_range brange;
+  gkyl_range_init(&brange, 1, (int[]) { 0 }, (int[]) { nvblock-1 });
+  gkyl_job_pool_parallel_for(calc->job_pool, &brange, 0, mom_calc_vblock_range, &mctx);
 
-      gkyl_mom_type_calc(calc->momt, xc, calc->grid.dx, pidx,
-        gkyl_array_cfetch(fin, fidx), gkyl_array_fetch(mout, midx), 0
-        );
-    }
+  // pairwise tree reduction of the blocks into block 0
+  vblock_tree_sum(nvblock, cvol*ncomp, mctx.vbuff);
+
+  long c = 0;
+  struct gkyl_range_iter conf_iter;
+  gkyl_range_iter_init(&conf_iter, conf_rng);
+  while (gkyl_range_iter_next(&conf_iter)) {
+    double *mout_d = gkyl_array_fetch(mout, gkyl_range_idx(conf_rng, conf_iter.idx));
+    for (int k=0; k<ncomp; ++k) mout_d[k] = mctx.vbuff[c*ncomp+k];
+    c += 1;
   }
+  gkyl_free(mctx.vbuff);
 }
 
 void gkyl_mom_calc_release(gkyl_mom_calc* up)
 {
   gkyl_mom_type_release(up->momt);
+  if (up->job_pool)
+    gkyl_job_pool_release(up->job_pool);
   if (GKYL_IS_CU_ALLOC(up->flags))
     gkyl_cu_free(up->on_dev);
   gkyl_free(up);
@@ -25,6 +25,7 @@ gkyl_mom_calc_bcorr_new(const struct gkyl_rect_grid *grid,
   gkyl_mom_calc_bcorr *up = gkyl_malloc(sizeof(gkyl_mom_calc_bcorr));
   up->grid = *grid;
   up->momt = gkyl_mom_type_acquire(momt);
+  up->job_pool = 0;
   up->flags = 0;
   GKYL_CLEAR_CU_ALLOC(up->flags);
   up->on_dev = up;
@@ -42,10 +43,30 @@ copy_idx_arrays(int cdim, int pdim, const int *cidx, const int *vidx, int *out)
 }
 
 void
-gkyl_mom_calc_bcorr_advance(const struct gkyl_mom_calc_bcorr *bcorr,
-  const struct gkyl_range *phase_rng, const struct gkyl_range *conf_rng,
-  const struct gkyl_array *GKYL_RESTRICT fIn, struct gkyl_array *GKYL_RESTRICT out)
+gkyl_mom_calc_bcorr_set_job_pool(gkyl_mom_calc_bcorr *bcorr, const struct gkyl_job_pool *job_pool)
 {
+  if (bcorr->job_pool)
+    gkyl_job_pool_release(bcorr->job_pool);
+  bcorr->job_pool = job_pool ? gkyl_job_pool_acquire(job_pool) : 0;
+}
+
+struct mom_calc_bcorr_ctx {
+  const struct gkyl_mom_calc_bcorr *bcorr;
+  const struct gkyl_range *phase_rng, *conf_rng;
+  const struct gkyl_array *fin;
+  struct gkyl_array *out;
+};
+
+// compute corrections in the (split) configuration-space range
+static void
+mom_calc_bcorr_conf_range(const struct gkyl_range *range, void *ctx)
+{
+  struct mom_calc_bcorr_ctx *bctx = ctx;
+  const struct gkyl_mom_calc_bcorr *bcorr = bctx->bcorr;
+  const struct gkyl_range *phase_rng = bctx->phase_rng, *conf_rng = bctx->conf_rng;
+  const struct gkyl_array *fIn = bctx->fin;
+  struct gkyl_array *out = bctx->out;
+
   double xc[GKYL_MAX_DIM];
   struct gkyl_range vel_rng;
   struct gkyl_range_iter conf_iter, vel_iter;
@@ -54,12 +75,11 @@ gkyl_mom_calc_bcorr_advance(const struct gkyl_mom_calc_bcorr *bcorr,
   enum gkyl_vel_edge edge;
   
   for (int d=0; d<conf_rng->ndim; ++d) rem_dir[d] = 1;
-  gkyl_array_clear_range(out, 0.0, conf_rng);
 
   // outer loop is over configuration space cells; for each
   // config-space cell inner loop walks over the edges of velocity
   // space
-  gkyl_range_iter_init(&conf_iter, conf_rng);
+  gkyl_range_iter_init(&conf_iter, range);
   while (gkyl_range_iter_next(&conf_iter)) {
     long midx = gkyl_range_idx(conf_rng, conf_iter.idx);
     
@@ -107,10 +127,35 @@ gkyl_mom_calc_bcorr_advance(const struct gkyl_mom_calc_bcorr *bcorr,
   }
 }
 
+void
+gkyl_mom_calc_bcorr_advance(const struct gkyl_mom_calc_bcorr *bcorr,
+  const struct gkyl_range *phase_rng, const struct gkyl_range *conf_rng,
+  const struct gkyl_array *GKYL_RESTRICT fIn, struct gkyl_array *GKYL_RESTRICT out)
+{
+  gkyl_array_clear_range(out, 0.0, conf_rng);
+
+  struct mom_calc_bcorr_ctx bctx = {
+    .bcorr = bcorr,
+    .phase_rng = phase_rng,
+    .conf_rng = conf_rng,
+    .fin = fIn,
+    .out = out,
+  };
+  // configuration-space cells are independent; the velocity-space
+  // edges are too small to be worth splitting
+  int nthreads = bcorr->job_pool ? bcorr->job_pool->pool_size : 1;
+  if (nthreads > 1 && conf_rng->volume >= nthreads)
+    gkyl_job_pool_parallel_for(bcorr->job_pool, conf_rng, 0, mom_calc_bcorr_conf_range, &bctx);
+  else
+    mom_calc_bcorr_conf_range(conf_rng, &bctx);
+}
+
 void
 gkyl_mom_calc_bcorr_release(gkyl_mom_calc_bcorr* up)
 {
   gkyl_mom_type_release(up->momt);
+  if (up->job_pool)
+    gkyl_job_pool_release(up->job_pool);
   if (GKYL_IS_CU_ALLOC(up->flags))
     gkyl_cu_free(up->on_dev);
   gkyl_free(up);
@@ -65,6 +65,8 @@ gkyl_mom_calc_cu_dev_new(const struct gkyl_rect_grid *grid,
 
   struct gkyl_mom_type *mt = gkyl_mom_type_acquire(momt);
   up->momt = mt->on_dev; // so memcpy below gets dev copy
+  up->job_pool = 0; // job pool not used on device
+  up->deterministic = false;
 
   up->flags = 0;
   GKYL_SET_CU_ALLOC(up->flags);
@@ -94,6 +94,13 @@ gkyl_moment_em_coupling_new(struct gkyl_moment_em_coupling_inp inp)
     mom_em->medium_kappa = inp.medium_kappa;
   }
 
+  mom_em->cells = 0;
+  mom_em->batch = 0;
+  if (mom_em->is_charged_species) {
+    mom_em->cells = gkyl_malloc(sizeof(struct implicit_src_cell[IMPLICIT_SRC_BATCH]));
+    mom_em->batch = gkyl_malloc(sizeof(struct implicit_src_batch));
+  }
+
   return mom_em;
 }
 
@@ -111,6 +118,36 @@ gkyl_moment_em_coupling_implicit_advance(const gkyl_moment_em_coupling* mom_em,
   struct gkyl_range_iter iter;
   gkyl_range_iter_init(&iter, update_range);
 
+  if (mom_em->is_charged_species) {
+    // Gather blocks of cells and solve the implicit EM system for all cells in a block at once.
+    struct implicit_src_cell *cells = mom_em->cells;
+    int ncells = 0;
+
+    while (gkyl_range_iter_next(&iter)) {
+      long cell_idx = gkyl_range_idx(update_range, iter.idx);
+      struct implicit_src_cell *c = &cells[ncells++];
+
+      for (int i = 0; i < nfluids; i++) {
+        c->fluid[i] = gkyl_array_fetch(fluid[i], cell_idx);
+        c->app_accel[i] = gkyl_array_cfetch(app_accel[i], cell_idx);
+        c->p_rhs[i] = gkyl_array_cfetch(p_rhs[i], cell_idx);
+        c->nT_sources[i] = gkyl_array_cfetch(nT_sources[i], cell_idx);
+      }
+      c->em = gkyl_array_fetch(em, cell_idx);
+      c->app_current = gkyl_array_cfetch(app_current, cell_idx);
+      c->ext_em = gkyl_array_cfetch(ext_em, cell_idx);
+
+      if (ncells == IMPLICIT_SRC_BATCH) {
+        implicit_source_coupling_update_batch(mom_em, t_curr, dt, ncells, cells, mom_em->batch);
+        ncells = 0;
+      }
+    }
+    if (ncells > 0) {
+      implicit_source_coupling_update_batch(mom_em, t_curr, dt, ncells, cells, mom_em->batch);
+    }
+    return;
+  }
+
   while (gkyl_range_iter_next(&iter)) {
     long cell_idx = gkyl_range_idx(update_range, iter.idx);
 
@@ -170,5 +207,9 @@ gkyl_moment_em_coupling_explicit_advance(const gkyl_moment_em_coupling* mom_em,
 void
 gkyl_moment_em_coupling_release(gkyl_moment_em_coupling* mom_em)
 {
+  if (mom_em->cells) {
+    gkyl_free(mom_em->cells);
+    gkyl_free(mom_em->batch);
+  }
   gkyl_free(mom_em);
 }
\ No newline at end of file
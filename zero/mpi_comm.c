@@ -43,6 +43,16 @@ struct comm_buff_stat {
 struct gkyl_comm_state {
   MPI_Request req;
   MPI_Status stat;
+
+  // staging for isend/irecv of SoA arrays, which are sent in the AoS
+  // format used by buffers and files: allocated on first use
+  gkyl_mem_buff soa_buff; // AoS copy of the data
+  struct gkyl_array *soa_recv; // SoA array to unpack into on wait (NULL if none)
+
+  // data for split (begin/end) array sync: allocated on first use
+  struct gkyl_array *sync_array; // array being synced (NULL if no sync in flight)
+  int nrecv, nsend; // number of posted recv/send
+  struct comm_buff_stat *recv, *send; // recv/send buffers and requests
 };
 
 // Private struct wrapping MPI-specific code
@@ -108,11 +118,35 @@ get_size(struct gkyl_comm *comm, int *sz)
   return 0;
 }
 
+// Messages always hold the components of an index together, so SoA
+// arrays are packed into (or unpacked from) an AoS staging buffer:
+// returns the buffer to send from or receive into.
+static void*
+soa_stage_buff(gkyl_mem_buff *buff, const struct gkyl_array *array)
+{
+  size_t sz = array->esznc*array->size;
+  if (0 == *buff)
+    *buff = gkyl_mem_buff_new(sz);
+  else if (gkyl_mem_buff_size(*buff) < sz)
+    *buff = gkyl_mem_buff_resize(*buff, sz);
+  return gkyl_mem_buff_data(*buff);
+}
+
 static int
 array_send(struct gkyl_array *array, int dest, int tag, struct gkyl_comm *comm)
 {
   size_t vol = array->ncomp*array->size;
-  struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);  
+  struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);
+
+  if (array->layout == GKYL_ARRAY_SOA) {
+    gkyl_mem_buff buff = 0;
+    void *data = soa_stage_buff(&buff, array);
+    gkyl_array_pack_elems(data, array, 0, array->size);
+    int ret = MPI_Send(data, vol, g2_mpi_datatype[array->type], dest, tag, mpi->mcomm);
+    gkyl_mem_buff_release(buff);
+    return ret == MPI_SUCCESS ? 0 : 1;
+  }
+  
   int ret = MPI_Send(array->data, vol, g2_mpi_datatype[array->type], dest, tag, mpi->mcomm); 
   return ret == MPI_SUCCESS ? 0 : 1;
 }
@@ -121,8 +155,16 @@ static int
 array_isend(struct gkyl_array *array, int dest, int tag, struct gkyl_comm *comm, struct gkyl_comm_state *state)
 {
   size_t vol = array->ncomp*array->size;
-  struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);  
-  int ret = MPI_Isend(array->data, vol, g2_mpi_datatype[array->type], dest, tag, mpi->mcomm, &state->req); 
+  struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);
+
+  void *data = array->data;
+  if (array->layout == GKYL_ARRAY_SOA) {
+    // the packed copy must live until the send completes
+    data = soa_stage_buff(&state->soa_buff, array);
+    gkyl_array_pack_elems(data, array, 0, array->size);
+  }
+  
+  int ret = MPI_Isend(data, vol, g2_mpi_datatype[array->type], dest, tag, mpi->mcomm, &state->req); 
   return ret == MPI_SUCCESS ? 0 : 1;
 }
 
@@ -132,6 +174,16 @@ array_recv(struct gkyl_array *array, int src, int tag, struct gkyl_comm *comm)
   size_t vol = array->ncomp*array->size;
   struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);  
   MPI_Status stat;
+
+  if (array->layout == GKYL_ARRAY_SOA) {
+    gkyl_mem_buff buff = 0;
+    void *data = soa_stage_buff(&buff, array);
+    int ret = MPI_Recv(data, vol, g2_mpi_datatype[array->type], src, tag, mpi->mcomm, &stat);
+    gkyl_array_unpack_elems(array, 0, array->size, data);
+    gkyl_mem_buff_release(buff);
+    return ret == MPI_SUCCESS ? 0 : 1;
+  }
+  
   int ret = MPI_Recv(array->data, vol, g2_mpi_datatype[array->type], src, tag, mpi->mcomm, &stat); 
   return ret == MPI_SUCCESS ? 0 : 1;
 }
@@ -140,8 +192,16 @@ static int
 array_irecv(struct gkyl_array *array, int src, int tag, struct gkyl_comm *comm, struct gkyl_comm_state *state)
 {
   size_t vol = array->ncomp*array->size;
-  struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);  
-  int ret = MPI_Irecv(array->data, vol, g2_mpi_datatype[array->type], src, tag, mpi->mcomm, &state->req); 
+  struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);
+
+  void *data = array->data;
+  if (array->layout == GKYL_ARRAY_SOA) {
+    // unpacked into the array by comm_state_wait
+    data = soa_stage_buff(&state->soa_buff, array);
+    state->soa_recv = array;
+  }
+  
+  int ret = MPI_Irecv(data, vol, g2_mpi_datatype[array->type], src, tag, mpi->mcomm, &state->req); 
   return ret == MPI_SUCCESS ? 0 : 1;
 }
 
@@ -156,13 +216,15 @@ all_reduce(struct gkyl_comm *comm, enum gkyl_elem_type type,
   return ret == MPI_SUCCESS ? 0 : 1;
 }
 
-static int
-array_sync(struct gkyl_comm *comm,
+// Post nonblocking recv into ghost-cells and nonblocking sends of
+// skin-cell data, using the supplied recv/send buffers. On output
+// nrecv and nsend are set to the number of posted recv/send.
+static void
+array_sync_post(struct mpi_comm *mpi,
   const struct gkyl_range *local, const struct gkyl_range *local_ext,
-  struct gkyl_array *array)
+  struct gkyl_array *array, struct comm_buff_stat *recv, struct comm_buff_stat *send,
+  int *nrecv, int *nsend)
 {
-  struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);
-
   int elo[GKYL_MAX_DIM], eup[GKYL_MAX_DIM];
   for (int i=0; i<mpi->decomp->ndim; ++i)
     elo[i] = eup[i] = local_ext->upper[i]-local->upper[i];
@@ -175,15 +237,15 @@ array_sync(struct gkyl_comm *comm,
     int nid = mpi->neigh->neigh[n];
     
     int isrecv = gkyl_sub_range_intersect(
-      &mpi->recv[nridx].range, local_ext, &mpi->decomp->ranges[nid]);
-    size_t recv_vol = array->esznc*mpi->recv[nridx].range.volume;
+      &recv[nridx].range, local_ext, &mpi->decomp->ranges[nid]);
+    size_t recv_vol = array->esznc*recv[nridx].range.volume;
 
     if (isrecv) {
-      if (gkyl_mem_buff_size(mpi->recv[nridx].buff) < recv_vol)
-        gkyl_mem_buff_resize(mpi->recv[nridx].buff, recv_vol);
+      if (gkyl_mem_buff_size(recv[nridx].buff) < recv_vol)
+        gkyl_mem_buff_resize(recv[nridx].buff, recv_vol);
       
-      MPI_Irecv(gkyl_mem_buff_data(mpi->recv[nridx].buff),
-        recv_vol, MPI_CHAR, nid, tag, mpi->mcomm, &mpi->recv[nridx].status);
+      MPI_Irecv(gkyl_mem_buff_data(recv[nridx].buff),
+        recv_vol, MPI_CHAR, nid, tag, mpi->mcomm, &recv[nridx].status);
 
       nridx += 1;
     }
@@ -199,42 +261,101 @@ array_sync(struct gkyl_comm *comm,
     gkyl_range_extend(&neigh_ext, &mpi->decomp->ranges[nid], elo, eup);
 
     int issend = gkyl_sub_range_intersect(
-      &mpi->send[nsidx].range, local, &neigh_ext);
-    size_t send_vol = array->esznc*mpi->send[nsidx].range.volume;
+      &send[nsidx].range, local, &neigh_ext);
+    size_t send_vol = array->esznc*send[nsidx].range.volume;
 
     if (issend) {
-      if (gkyl_mem_buff_size(mpi->send[nsidx].buff) < send_vol)
-        gkyl_mem_buff_resize(mpi->send[nsidx].buff, send_vol);
+      if (gkyl_mem_buff_size(send[nsidx].buff) < send_vol)
+        gkyl_mem_buff_resize(send[nsidx].buff, send_vol);
       
-      gkyl_array_copy_to_buffer(gkyl_mem_buff_data(mpi->send[nsidx].buff),
-        array, &(mpi->send[nsidx].range));
+      gkyl_array_copy_to_buffer(gkyl_mem_buff_data(send[nsidx].buff),
+        array, &(send[nsidx].range));
       
-      MPI_Isend(gkyl_mem_buff_data(mpi->send[nsidx].buff),
-        send_vol, MPI_CHAR, nid, tag, mpi->mcomm, &mpi->send[nsidx].status);
+      MPI_Isend(gkyl_mem_buff_data(send[nsidx].buff),
+        send_vol, MPI_CHAR, nid, tag, mpi->mcomm, &send[nsidx].status);
 
       nsidx += 1;
     }
   }
 
+  *nrecv = nridx;
+  *nsend = nsidx;
+}
+
+// Complete sends and recvs posted by array_sync_post, copying
+// received data into ghost-cells
+static void
+array_sync_complete(struct gkyl_array *array,
+  struct comm_buff_stat *recv, int nrecv, struct comm_buff_stat *send, int nsend)
+{
   // complete send
-  for (int s=0; s<nsidx; ++s) {
-    int issend = mpi->send[s].range.volume;
+  for (int s=0; s<nsend; ++s) {
+    int issend = send[s].range.volume;
     if (issend)
-      MPI_Wait(&mpi->send[s].status, MPI_STATUS_IGNORE);
+      MPI_Wait(&send[s].status, MPI_STATUS_IGNORE);
   }
 
   // complete recv, copying data into ghost-cells
-  for (int r=0; r<nridx; ++r) {
-    int isrecv = mpi->recv[r].range.volume;
+  for (int r=0; r<nrecv; ++r) {
+    int isrecv = recv[r].range.volume;
     if (isrecv) {
-      MPI_Wait(&mpi->recv[r].status, MPI_STATUS_IGNORE);
+      MPI_Wait(&recv[r].status, MPI_STATUS_IGNORE);
       
       gkyl_array_copy_from_buffer(array,
-        gkyl_mem_buff_data(mpi->recv[r].buff),
-        &(mpi->recv[r].range)
+        gkyl_mem_buff_data(recv[r].buff),
+        &(recv[r].range)
       );
     }
   }
+}
+
+static int
+array_sync(struct gkyl_comm *comm,
+  const struct gkyl_range *local, const struct gkyl_range *local_ext,
+  struct gkyl_array *array)
+{
+  struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);
+
+  int nridx = 0, nsidx = 0;
+  array_sync_post(mpi, local, local_ext, array, mpi->recv, mpi->send, &nridx, &nsidx);
+  array_sync_complete(array, mpi->recv, nridx, mpi->send, nsidx);
+  
+  return 0;
+}
+
+static int
+array_sync_begin(struct gkyl_comm *comm,
+  const struct gkyl_range *local, const struct gkyl_range *local_ext,
+  struct gkyl_array *array, struct gkyl_comm_state *state)
+{
+  struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);
+
+  if (state->sync_array) return 1; // a sync is already in flight on this state
+
+  if (0 == state->recv) {
+    state->recv = gkyl_malloc(sizeof(struct comm_buff_stat[MAX_RECV_NEIGH]));
+    state->send = gkyl_malloc(sizeof(struct comm_buff_stat[MAX_RECV_NEIGH]));
+    for (int i=0; i<MAX_RECV_NEIGH; ++i) {
+      state->recv[i].buff = gkyl_mem_buff_new(16);
+      state->send[i].buff = gkyl_mem_buff_new(16);
+    }
+  }
+
+  state->sync_array = array;
+  array_sync_post(mpi, local, local_ext, array, state->recv, state->send,
+    &state->nrecv, &state->nsend);
+  
+  return 0;
+}
+
+static int
+array_sync_end(struct gkyl_comm *comm, struct gkyl_comm_state *state)
+{
+  if (0 == state->sync_array) return 1; // nothing in flight
+
+  array_sync_complete(state->sync_array, state->recv, state->nrecv,
+    state->send, state->nsend);
+  state->sync_array = 0;
   
   return 0;
 }
@@ -381,7 +502,7 @@ barrier(struct gkyl_comm *comm)
 // set of functions to help with parallel array output using MPI-IO
 static void
 sub_array_decomp_write(struct mpi_comm *comm, const struct gkyl_rect_decomp *decomp,
-  const struct gkyl_range *range,
+  const struct gkyl_range *range, size_t meta_sz,
   const struct gkyl_array *arr, MPI_File fp)
 {
 #define _F(loc) gkyl_array_cfetch(arr, loc)
@@ -390,7 +511,7 @@ sub_array_decomp_write(struct mpi_comm *comm, const struct gkyl_rect_decomp *dec
   MPI_Comm_rank(comm->mcomm, &rank);
 
   // seek to appropriate place in the file, depending on rank
-  size_t hdr_sz = gkyl_base_hdr_size(0) + gkyl_file_type_3_hrd_size(range->ndim);
+  size_t hdr_sz = gkyl_base_hdr_size(meta_sz) + gkyl_file_type_3_hrd_size(range->ndim);
   size_t file_loc = hdr_sz +
     arr->esznc*comm->local_range_offset +
     rank*gkyl_file_type_3_range_hrd_size(range->ndim);
@@ -433,12 +554,28 @@ sub_array_decomp_write(struct mpi_comm *comm, const struct gkyl_rect_decomp *dec
   struct gkyl_range_iter iter;
   gkyl_range_iter_init(&iter, &skip.range);
 
+  // files always hold the components of a cell together, so chunks of
+  // SoA arrays are packed into a staging buffer first
+  gkyl_mem_buff soa_buff = 0;
+  if (arr->layout == GKYL_ARRAY_SOA)
+    soa_buff = gkyl_mem_buff_new(arr->esznc*skip.delta);
+
   MPI_Status status;
   while (gkyl_range_iter_next(&iter)) {
     long start = gkyl_range_idx(&skip.range, iter.idx);
-    MPI_File_write(fp, _F(start), arr->esznc*skip.delta, MPI_CHAR, &status);
+    if (soa_buff) {
+      void *data = gkyl_mem_buff_data(soa_buff);
+      gkyl_array_pack_elems(data, arr, start, skip.delta);
+      MPI_File_write(fp, data, arr->esznc*skip.delta, MPI_CHAR, &status);
+    }
+    else {
+      MPI_File_write(fp, _F(start), arr->esznc*skip.delta, MPI_CHAR, &status);
+    }
   }
 
+  if (soa_buff)
+    gkyl_mem_buff_release(soa_buff);
+
 #undef _F
 }
 
@@ -446,8 +583,11 @@ static int
 grid_sub_array_decomp_write_fp(struct mpi_comm *comm,
   const struct gkyl_rect_grid *grid,
   const struct gkyl_rect_decomp *decomp, const struct gkyl_range *range,
+  const struct gkyl_array_meta *meta,
   const struct gkyl_array *arr, MPI_File fp)
 {
+  size_t meta_sz = meta ? meta->meta_sz : 0;
+
   char *buff; size_t buff_sz;
   FILE *fbuff = open_memstream(&buff, &buff_sz);
 
@@ -457,7 +597,9 @@ grid_sub_array_decomp_write_fp(struct mpi_comm *comm,
       .file_type = gkyl_file_type_int[GKYL_MULTI_RANGE_DATA_FILE],
       .etype = arr->type,
       .esznc = arr->esznc,
-      .tot_cells = decomp->parent_range.volume
+      .tot_cells = decomp->parent_range.volume,
+      .meta_size = meta_sz,
+      .meta = meta ? meta->meta : 0
     },
     fbuff
   );
@@ -475,13 +617,14 @@ grid_sub_array_decomp_write_fp(struct mpi_comm *comm,
   free(buff);
   
   // write data in array
-  sub_array_decomp_write(comm, decomp, range, arr, fp);
+  sub_array_decomp_write(comm, decomp, range, meta_sz, arr, fp);
   return errno;
 }
 
 static int
 array_write(struct gkyl_comm *comm,
   const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  const struct gkyl_array_meta *meta,
   const struct gkyl_array *arr, const char *fname)
 {
   struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);
@@ -490,11 +633,33 @@ array_write(struct gkyl_comm *comm,
     MPI_File_open(mpi->mcomm, fname, MPI_MODE_CREATE|MPI_MODE_WRONLY, MPI_INFO_NULL, &fp);
   if (err != MPI_SUCCESS)
     return err;
-  err = grid_sub_array_decomp_write_fp(mpi, grid, mpi->decomp, range, arr, fp);
+  err = grid_sub_array_decomp_write_fp(mpi, grid, mpi->decomp, range, meta, arr, fp);
   MPI_File_close(&fp);
   return err;
 }
 
+static int
+array_read(struct gkyl_comm *comm,
+  const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  struct gkyl_array *arr, const char *fname)
+{
+  struct mpi_comm *mpi = container_of(comm, struct mpi_comm, base);
+
+  // each rank reads the portion of the file overlapping its local
+  // range: the file may have been written with a different decomp
+  struct gkyl_rect_grid fgrid;
+  int status = gkyl_grid_sub_array_read(&fgrid, range, arr, fname);
+  if (status == GKYL_ARRAY_RIO_SUCCESS) {
+    if (!gkyl_rect_grid_cmp(grid, &fgrid))
+      status = GKYL_ARRAY_RIO_DATA_MISMATCH;
+  }
+
+  // all ranks must agree on the status
+  int g_status;
+  MPI_Allreduce(&status, &g_status, 1, MPI_INT, MPI_MAX, mpi->mcomm);
+  return g_status;
+}
+
 static struct gkyl_comm*
 extend_comm(const struct gkyl_comm *comm, const struct gkyl_range *erange)
 {
@@ -532,17 +697,38 @@ split_comm(const struct gkyl_comm *comm, int color, struct gkyl_rect_decomp *new
 static struct gkyl_comm_state* comm_state_new(struct gkyl_comm *comm)
 {
   struct gkyl_comm_state *state = gkyl_malloc(sizeof *state);
+  state->sync_array = 0;
+  state->nrecv = state->nsend = 0;
+  state->recv = state->send = 0;
+  state->soa_buff = 0;
+  state->soa_recv = 0;
   return state;
 }
 
 static void comm_state_release(struct gkyl_comm_state *state)
 {
+  if (state->recv) {
+    for (int i=0; i<MAX_RECV_NEIGH; ++i) {
+      gkyl_mem_buff_release(state->recv[i].buff);
+      gkyl_mem_buff_release(state->send[i].buff);
+    }
+    gkyl_free(state->recv);
+    gkyl_free(state->send);
+  }
+  if (state->soa_buff)
+    gkyl_mem_buff_release(state->soa_buff);
   gkyl_free(state);
 }
 
 static void comm_state_wait(struct gkyl_comm_state *state)
 {
   MPI_Wait(&state->req, &state->stat);
+
+  if (state->soa_recv) {
+    gkyl_array_unpack_elems(state->soa_recv, 0, state->soa_recv->size,
+      gkyl_mem_buff_data(state->soa_buff));
+    state->soa_recv = 0;
+  }
 }
 
 struct gkyl_comm*
@@ -588,8 +774,11 @@ gkyl_mpi_comm_new(const struct gkyl_mpi_comm_inp *inp)
       mpi->send[i].buff = gkyl_mem_buff_new(16);
 
     mpi->base.gkyl_array_sync = array_sync;
+    mpi->base.gkyl_array_sync_begin = array_sync_begin;
+    mpi->base.gkyl_array_sync_end = array_sync_end;
     mpi->base.gkyl_array_per_sync = array_per_sync;
     mpi->base.gkyl_array_write = array_write;
+    mpi->base.gkyl_array_read = array_read;
   }
   
   mpi->base.get_rank = get_rank;
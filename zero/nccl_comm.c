@@ -320,6 +320,22 @@ array_sync(struct gkyl_comm *comm, const struct gkyl_range *local,
   return 0;
 }
 
+// NCCL sync is completed on the CUDA stream inside array_sync, so the
+// split sync does all the work in begin and end is a no-op
+static int
+array_sync_begin(struct gkyl_comm *comm, const struct gkyl_range *local,
+  const struct gkyl_range *local_ext, struct gkyl_array *array,
+  struct gkyl_comm_state *state)
+{
+  return array_sync(comm, local, local_ext, array);
+}
+
+static int
+array_sync_end(struct gkyl_comm *comm, struct gkyl_comm_state *state)
+{
+  return 0;
+}
+
 static int
 array_per_sync(struct gkyl_comm *comm, const struct gkyl_range *local,
   const struct gkyl_range *local_ext,
@@ -556,6 +572,8 @@ gkyl_nccl_comm_new(const struct gkyl_nccl_comm_inp *inp)
     nccl->touches_any_edge = num_touches > 0 ? true : false;
   
     nccl->base.gkyl_array_sync = array_sync;
+    nccl->base.gkyl_array_sync_begin = array_sync_begin;
+    nccl->base.gkyl_array_sync_end = array_sync_end;
     nccl->base.gkyl_array_per_sync = array_per_sync;
   }
   
@@ -7,6 +7,12 @@
 #include <string.h>
 #include <math.h>
 
+// State object: there is nothing to wait on, but we keep track of
+// begin/end calls to catch mismatched use
+struct gkyl_comm_state {
+  bool sync_in_flight; // true between sync_begin and sync_end
+};
+
 // Private struct
 struct null_comm {
   struct gkyl_comm base; // base communicator
@@ -63,6 +69,43 @@ array_sync(struct gkyl_comm *comm,
   return 0;
 }
 
+static int
+array_sync_begin(struct gkyl_comm *comm,
+  const struct gkyl_range *local, const struct gkyl_range *local_ext,
+  struct gkyl_array *array, struct gkyl_comm_state *state)
+{
+  if (state->sync_in_flight) return 1;
+  state->sync_in_flight = true;
+  return 0;
+}
+
+static int
+array_sync_end(struct gkyl_comm *comm, struct gkyl_comm_state *state)
+{
+  if (!state->sync_in_flight) return 1;
+  state->sync_in_flight = false;
+  return 0;
+}
+
+static struct gkyl_comm_state*
+comm_state_new(struct gkyl_comm *comm)
+{
+  struct gkyl_comm_state *state = gkyl_malloc(sizeof *state);
+  state->sync_in_flight = false;
+  return state;
+}
+
+static void
+comm_state_release(struct gkyl_comm_state *state)
+{
+  gkyl_free(state);
+}
+
+static void
+comm_state_wait(struct gkyl_comm_state *state)
+{
+}
+
 // apply periodic BCs
 static void
 apply_periodic_bc(const struct skin_ghost_ranges *sgr, char *data,
@@ -117,9 +160,24 @@ barrier(struct gkyl_comm *comm)
 static int
 array_write(struct gkyl_comm *comm,
   const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  const struct gkyl_array_meta *meta,
   const struct gkyl_array *arr, const char *fname)
 {
-  return gkyl_grid_sub_array_write(grid, range, arr, fname);
+  return gkyl_grid_sub_array_write_with_meta(grid, range, meta, arr, fname);
+}
+
+static int
+array_read(struct gkyl_comm *comm,
+  const struct gkyl_rect_grid *grid, const struct gkyl_range *range,
+  struct gkyl_array *arr, const char *fname)
+{
+  struct gkyl_rect_grid fgrid;
+  int status = gkyl_grid_sub_array_read(&fgrid, range, arr, fname);
+  if (status == GKYL_ARRAY_RIO_SUCCESS) {
+    if (!gkyl_rect_grid_cmp(grid, &fgrid))
+      status = GKYL_ARRAY_RIO_DATA_MISMATCH;
+  }
+  return status;
 }
 
 static struct gkyl_comm*
@@ -152,8 +210,14 @@ gkyl_null_comm_new(void)
   comm->base.get_size = get_size;
   comm->base.all_reduce = all_reduce;
   comm->base.gkyl_array_sync = array_sync;
+  comm->base.gkyl_array_sync_begin = array_sync_begin;
+  comm->base.gkyl_array_sync_end = array_sync_end;
   comm->base.barrier = barrier;
   comm->base.gkyl_array_write = array_write;
+  comm->base.gkyl_array_read = array_read;
+  comm->base.comm_state_new = comm_state_new;
+  comm->base.comm_state_release = comm_state_release;
+  comm->base.comm_state_wait = comm_state_wait;
 
   comm->base.ref_count = gkyl_ref_count_init(comm_free);
 
@@ -184,9 +248,15 @@ gkyl_null_comm_inew(const struct gkyl_null_comm_inp *inp)
   comm->base.get_size = get_size;
   comm->base.all_reduce = all_reduce;
   comm->base.gkyl_array_sync = array_sync;
+  comm->base.gkyl_array_sync_begin = array_sync_begin;
+  comm->base.gkyl_array_sync_end = array_sync_end;
   comm->base.gkyl_array_per_sync = array_per_sync;
   comm->base.barrier = barrier;
   comm->base.gkyl_array_write = array_write;
+  comm->base.gkyl_array_read = array_read;
+  comm->base.comm_state_new = comm_state_new;
+  comm->base.comm_state_release = comm_state_release;
+  comm->base.comm_state_wait = comm_state_wait;
   comm->base.extend_comm = extend_comm;
 
   comm->base.ref_count = gkyl_ref_count_init(comm_free);
@@ -26,6 +26,7 @@ gkyl_prim_lbo_calc_new(const struct gkyl_rect_grid *grid,
   up->is_first = true;
   up->As = up->xs = 0;
   up->mem = 0;
+  up->job_pool = 0;
 
   up->flags = 0;
   GKYL_CLEAR_CU_ALLOC(up->flags);
@@ -34,6 +35,16 @@ gkyl_prim_lbo_calc_new(const struct gkyl_rect_grid *grid,
   return up;
 }
 
+void
+gkyl_prim_lbo_calc_set_job_pool(struct gkyl_prim_lbo_calc* calc, const struct gkyl_job_pool *job_pool)
+{
+  if (calc->job_pool)
+    gkyl_job_pool_release(calc->job_pool);
+  calc->job_pool = job_pool ? gkyl_job_pool_acquire(job_pool) : 0;
+  if (calc->mem)
+    gkyl_nmat_linsolve_lu_set_job_pool(calc->mem, calc->job_pool);
+}
+
 void
 gkyl_prim_lbo_calc_advance(struct gkyl_prim_lbo_calc* calc, 
   const struct gkyl_range *conf_rng,
@@ -51,6 +62,7 @@ gkyl_prim_lbo_calc_advance(struct gkyl_prim_lbo_calc* calc,
     calc->As = gkyl_nmat_new(conf_rng->volume, N, N);
     calc->xs = gkyl_nmat_new(conf_rng->volume, N, 1);
     calc->mem = gkyl_nmat_linsolve_lu_new(calc->As->num, calc->As->nr);
+    gkyl_nmat_linsolve_lu_set_job_pool(calc->mem, calc->job_pool);
     calc->is_first = false;
   }
 
@@ -103,6 +115,8 @@ void gkyl_prim_lbo_calc_release(gkyl_prim_lbo_calc* up)
     gkyl_nmat_release(up->xs);
   if (up->mem)
     gkyl_nmat_linsolve_lu_release(up->mem);
+  if (up->job_pool)
+    gkyl_job_pool_release(up->job_pool);
   
   if (GKYL_IS_CU_ALLOC(up->flags))
     gkyl_cu_free(up->on_dev);
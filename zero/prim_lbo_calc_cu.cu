@@ -113,6 +113,7 @@ gkyl_prim_lbo_calc_cu_dev_new(const struct gkyl_rect_grid *grid,
   up->is_first = true;
   up->As = up->xs = 0;
   up->mem = 0;
+  up->job_pool = 0;
 
   struct gkyl_prim_lbo_type *pt = gkyl_prim_lbo_type_acquire(prim);
   up->prim = pt->on_dev; // so memcpy below gets dev copy
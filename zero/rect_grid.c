@@ -152,3 +152,19 @@ gkyl_rect_grid_read(struct gkyl_rect_grid *grid, FILE *fp)
 
   return true;
 }
+
+bool
+gkyl_rect_grid_cmp(const struct gkyl_rect_grid *grid1, const struct gkyl_rect_grid *grid2)
+{
+  if (grid1->ndim != grid2->ndim)
+    return false;
+  for (int d=0; d<grid1->ndim; ++d) {
+    if (grid1->cells[d] != grid2->cells[d])
+      return false;
+    if (!gkyl_compare_double(grid1->lower[d], grid2->lower[d], 1e-14))
+      return false;
+    if (!gkyl_compare_double(grid1->upper[d], grid2->upper[d], 1e-14))
+      return false;
+  }
+  return true;
+}
@@ -473,128 +473,122 @@ implicit_frictional_source_update(const gkyl_moment_em_coupling* mom_em, double
   }
 }
 
-void
-implicit_source_coupling_update(const gkyl_moment_em_coupling* mom_em, double t_curr, double dt, double* fluid_s[GKYL_MAX_SPECIES],
-  const double* app_accel_s[GKYL_MAX_SPECIES], const double* p_rhs_s[GKYL_MAX_SPECIES], double* em, const double* app_current,
-  const double* ext_em, const double* nT_sources_s[GKYL_MAX_SPECIES])
+// Set up the RHS of the implicit solve for species i in a single cell, with fluid variables at the known time-step.
+// Also stores the old kinetic/total energies (Euler) or the rotated and relaxed pressure tensor (10-moment).
+static inline void
+source_prepare_species(const gkyl_moment_em_coupling* mom_em, double dt, int i, const double* f, const double* p_rhs,
+  const double* em, const double* ext_em, double fluid_rhs[4], double* ke_old, double* energy_old, double p_tensor_new[6])
 {
-  int nfluids = mom_em->nfluids;
-  double ke_old[GKYL_MAX_SPECIES];
-  double energy_old[GKYL_MAX_SPECIES];
-  double fluid_rhs[GKYL_MAX_SPECIES][4];
-  double p_tensor_old[6], p_tensor_rhs[6], p_tensor_new[GKYL_MAX_SPECIES][6];
+  double p_tensor_old[6], p_tensor_rhs[6];
 
-  for (int i = 0; i < nfluids; i++) {
-    const double *f = fluid_s[i];
-    const double *p_rhs = p_rhs_s[i];
+  double q = mom_em->param[i].charge;
+  double m = mom_em->param[i].mass;
+  double k0 = mom_em->param[i].k0;
 
-    double q = mom_em->param[i].charge;
-    double m = mom_em->param[i].mass;
-    double k0 = mom_em->param[i].k0;
+  // Setup RHS of implicit solve with fluid variables at known time-step
+  // includes potential contributions from transport terms/density & momentum sources
+  double rho = f[0];
+  double mom_x = f[1], mom_y = f[2], mom_z = f[3];
+  double rho_rhs = p_rhs[0];
+  double mom_x_rhs = p_rhs[1], mom_y_rhs = p_rhs[2], mom_z_rhs = p_rhs[3];
 
-    // Setup RHS of implicit solve with fluid variables at known time-step
-    // includes potential contributions from transport terms/density & momentum sources
-    double rho = f[0];
-    double mom_x = f[1], mom_y = f[2], mom_z = f[3];
-    double rho_rhs = p_rhs[0];
-    double mom_x_rhs = p_rhs[1], mom_y_rhs = p_rhs[2], mom_z_rhs = p_rhs[3];
-
-    fluid_rhs[i][0] = rho + (0.5 * dt * rho_rhs);
-    fluid_rhs[i][1] = mom_x + (0.5 * dt * mom_x_rhs);
-    fluid_rhs[i][2] = mom_y + (0.5 * dt * mom_y_rhs);
-    fluid_rhs[i][3] = mom_z + (0.5 * dt * mom_x_rhs);
+  fluid_rhs[0] = rho + (0.5 * dt * rho_rhs);
+  fluid_rhs[1] = mom_x + (0.5 * dt * mom_x_rhs);
+  fluid_rhs[2] = mom_y + (0.5 * dt * mom_y_rhs);
+  fluid_rhs[3] = mom_z + (0.5 * dt * mom_x_rhs);
 
-    if (mom_em->param[i].type == GKYL_EQN_EULER) {
-      double energy = f[4];
+  if (mom_em->param[i].type == GKYL_EQN_EULER) {
+    double energy = f[4];
 
-      // Include potential contributions from transport terms to energy
-      double energy_rhs = p_rhs[4];
+    // Include potential contributions from transport terms to energy
+    double energy_rhs = p_rhs[4];
 
-      // kinetic energy at known time (including potential transport terms)
-      ke_old[i] = 0.5 * (((fluid_rhs[i][1] * fluid_rhs[i][1]) 
-        + (fluid_rhs[i][2] * fluid_rhs[i][2]) 
-        + (fluid_rhs[i][3] * fluid_rhs[i][3])) / fluid_rhs[i][0]);
+    // kinetic energy at known time (including potential transport terms)
+    *ke_old = 0.5 * (((fluid_rhs[1] * fluid_rhs[1]) 
+      + (fluid_rhs[2] * fluid_rhs[2]) 
+      + (fluid_rhs[3] * fluid_rhs[3])) / fluid_rhs[0]);
 
-      // total energy at known time (including potential transport terms)
-      energy_old[i] = energy + (0.5 * dt * energy_rhs);
+    // total energy at known time (including potential transport terms)
+    *energy_old = energy + (0.5 * dt * energy_rhs);
+  }
+  else if (mom_em->param[i].type == GKYL_EQN_TEN_MOMENT) {
+    double q_over_m = q / m;
+
+    double p11 = f[4], p12 = f[5], p13 = f[6];
+    double p22 = f[7], p23 = f[8], p33 = f[9];
+
+    p_tensor_old[0] = p11 - ((mom_x * mom_x) / rho);
+    p_tensor_old[1] = p12 - ((mom_x * mom_y) / rho);
+    p_tensor_old[2] = p13 - ((mom_x * mom_z) / rho);
+    p_tensor_old[3] = p22 - ((mom_y * mom_y) / rho);
+    p_tensor_old[4] = p23 - ((mom_y * mom_z) / rho);
+    p_tensor_old[5] = p33 - ((mom_z * mom_z) / rho);
+
+    double p11_rhs = p_rhs[4], p12_rhs = p_rhs[5], p13_rhs = p_rhs[6];
+    double p22_rhs = p_rhs[7], p23_rhs = p_rhs[8], p33_rhs = p_rhs[9];
+
+    p_tensor_rhs[0] = p_tensor_old[0] + (0.5 * dt * p11_rhs);
+    p_tensor_rhs[1] = p_tensor_old[1] + (0.5 * dt * p12_rhs);
+    p_tensor_rhs[2] = p_tensor_old[2] + (0.5 * dt * p13_rhs);
+    p_tensor_rhs[3] = p_tensor_old[3] + (0.5 * dt * p22_rhs);
+    p_tensor_rhs[4] = p_tensor_old[4] + (0.5 * dt * p23_rhs);
+    p_tensor_rhs[5] = p_tensor_old[5] + (0.5 * dt * p33_rhs);
+
+    double p = (1.0 / 3.0) * (p_tensor_old[0] + p_tensor_old[3] + p_tensor_old[5]);
+    double v_th = sqrt(p / rho);
+    double nu = v_th * k0;
+    double exp_nu = exp(nu * dt);
+
+    if (mom_em->is_charged_species) {
+      pressure_tensor_rotate(q_over_m, dt, em, ext_em, p_tensor_old, p_tensor_rhs, p_tensor_new);
     }
-    else if (mom_em->param[i].type == GKYL_EQN_TEN_MOMENT) {
-      double q_over_m = q / m;
-
-      double p11 = f[4], p12 = f[5], p13 = f[6];
-      double p22 = f[7], p23 = f[8], p33 = f[9];
-
-      p_tensor_old[0] = p11 - ((mom_x * mom_x) / rho);
-      p_tensor_old[1] = p12 - ((mom_x * mom_y) / rho);
-      p_tensor_old[2] = p13 - ((mom_x * mom_z) / rho);
-      p_tensor_old[3] = p22 - ((mom_y * mom_y) / rho);
-      p_tensor_old[4] = p23 - ((mom_y * mom_z) / rho);
-      p_tensor_old[5] = p33 - ((mom_z * mom_z) / rho);
-
-      double p11_rhs = p_rhs[4], p12_rhs = p_rhs[5], p13_rhs = p_rhs[6];
-      double p22_rhs = p_rhs[7], p23_rhs = p_rhs[8], p33_rhs = p_rhs[9];
-
-      p_tensor_rhs[0] = p_tensor_old[0] + (0.5 * dt * p11_rhs);
-      p_tensor_rhs[1] = p_tensor_old[1] + (0.5 * dt * p12_rhs);
-      p_tensor_rhs[2] = p_tensor_old[2] + (0.5 * dt * p13_rhs);
-      p_tensor_rhs[3] = p_tensor_old[3] + (0.5 * dt * p22_rhs);
-      p_tensor_rhs[4] = p_tensor_old[4] + (0.5 * dt * p23_rhs);
-      p_tensor_rhs[5] = p_tensor_old[5] + (0.5 * dt * p33_rhs);
-
-      double p = (1.0 / 3.0) * (p_tensor_old[0] + p_tensor_old[3] + p_tensor_old[5]);
-      double v_th = sqrt(p / rho);
-      double nu = v_th * k0;
-      double exp_nu = exp(nu * dt);
-
-      if (mom_em->is_charged_species) {
-        pressure_tensor_rotate(q_over_m, dt, em, ext_em, p_tensor_old, p_tensor_rhs, p_tensor_new[i]);
-      }
 
-      p_tensor_new[i][0] = ((p_tensor_new[i][0] - p) / exp_nu) + p;
-      p_tensor_new[i][1] = p_tensor_new[i][1] / exp_nu;
-      p_tensor_new[i][2] = p_tensor_new[i][2] / exp_nu;
-      p_tensor_new[i][3] = ((p_tensor_new[i][3] - p) / exp_nu) + p;
-      p_tensor_new[i][4] = p_tensor_new[i][4] / exp_nu;
-      p_tensor_new[i][5] = ((p_tensor_new[i][5] - p) / exp_nu) + p;
-    }
+    p_tensor_new[0] = ((p_tensor_new[0] - p) / exp_nu) + p;
+    p_tensor_new[1] = p_tensor_new[1] / exp_nu;
+    p_tensor_new[2] = p_tensor_new[2] / exp_nu;
+    p_tensor_new[3] = ((p_tensor_new[3] - p) / exp_nu) + p;
+    p_tensor_new[4] = p_tensor_new[4] / exp_nu;
+    p_tensor_new[5] = ((p_tensor_new[5] - p) / exp_nu) + p;
   }
+}
 
-  if (mom_em->is_charged_species) {
-    implicit_em_source_update(mom_em, t_curr, dt, fluid_rhs, fluid_s, app_accel_s, em, app_current, ext_em);
-  }
-  else {
-    implicit_neut_source_update(mom_em, t_curr, dt, fluid_rhs, fluid_s, app_accel_s);
+// Update the energy (Euler) or pressure tensor (10-moment) of species i in a single cell, once its momentum is known at the new time.
+static inline void
+source_finish_species(const gkyl_moment_em_coupling* mom_em, int i, double* f, double ke_old, double energy_old,
+  const double p_tensor_new[6])
+{
+  if (mom_em->param[i].type == GKYL_EQN_EULER) {
+    double rho = f[0];
+    double mom_x = f[1], mom_y = f[2], mom_z = f[3];
+    double energy = f[4];
+    
+    // Energy at new time is new kinetic energy plus potential contribution from
+    // transport terms. We use a time-centered approach even though the update
+    // from the transport terms is a simple forward Euler.
+    f[4] = (0.5 * ((mom_x * mom_x) + (mom_y * mom_y) + (mom_z * mom_z)) / rho) 
+            + 2.0*energy_old - energy - ke_old;
   }
+  // As I do not understand how the source terms for gradient-based closure interact with the source terms for the expanding-box
+  // model, I'm disabling the former whenever the latter are present, pro tem. This should be updated! -JG 07/25/24
+  else if (mom_em->param[i].type == GKYL_EQN_TEN_MOMENT && mom_em->param[i].charge != 0.0) {
+    double rho = f[0];
+    double mom_x = f[1], mom_y = f[2], mom_z = f[3];
 
-  for (int i = 0; i < nfluids; i++) {
-    double *f = fluid_s[i];
-
-    if (mom_em->param[i].type == GKYL_EQN_EULER) {
-      double rho = f[0];
-      double mom_x = f[1], mom_y = f[2], mom_z = f[3];
-      double energy = f[4];
-      
-      // Energy at new time is new kinetic energy plus potential contribution from
-      // transport terms. We use a time-centered approach even though the update
-      // from the transport terms is a simple forward Euler.
-      f[4] = (0.5 * ((mom_x * mom_x) + (mom_y * mom_y) + (mom_z * mom_z)) / rho) 
-              + 2.0*energy_old[i] - energy - ke_old[i];
-    }
-    // As I do not understand how the source terms for gradient-based closure interact with the source terms for the expanding-box
-    // model, I'm disabling the former whenever the latter are present, pro tem. This should be updated! -JG 07/25/24
-    else if (mom_em->param[i].type == GKYL_EQN_TEN_MOMENT && mom_em->param[i].charge != 0.0) {
-      double rho = f[0];
-      double mom_x = f[1], mom_y = f[2], mom_z = f[3];
-
-      f[4] = ((mom_x * mom_x) / rho) + p_tensor_new[i][0];
-      f[5] = ((mom_x * mom_y) / rho) + p_tensor_new[i][1];
-      f[6] = ((mom_x * mom_z) / rho) + p_tensor_new[i][2];
-      f[7] = ((mom_y * mom_y) / rho) + p_tensor_new[i][3];
-      f[8] = ((mom_y * mom_z) / rho) + p_tensor_new[i][4];
-      f[9] = ((mom_z * mom_z) / rho) + p_tensor_new[i][5];
-    }
+    f[4] = ((mom_x * mom_x) / rho) + p_tensor_new[0];
+    f[5] = ((mom_x * mom_y) / rho) + p_tensor_new[1];
+    f[6] = ((mom_x * mom_z) / rho) + p_tensor_new[2];
+    f[7] = ((mom_y * mom_y) / rho) + p_tensor_new[3];
+    f[8] = ((mom_y * mom_z) / rho) + p_tensor_new[4];
+    f[9] = ((mom_z * mom_z) / rho) + p_tensor_new[5];
   }
+}
 
+// Apply the remaining (collisional, frictional, volume, reactive, etc.) sources in a single cell.
+static inline void
+source_other_update(const gkyl_moment_em_coupling* mom_em, double t_curr, double dt, double* fluid_s[GKYL_MAX_SPECIES],
+  const double* app_accel_s[GKYL_MAX_SPECIES], double* em, const double* app_current, const double* ext_em,
+  const double* nT_sources_s[GKYL_MAX_SPECIES])
+{
   if (mom_em->has_collision) {
     implicit_collision_source_update(mom_em, dt, fluid_s);
   }
@@ -620,4 +614,224 @@ implicit_source_coupling_update(const gkyl_moment_em_coupling* mom_em, double t_
   if (mom_em->has_einstein_medium_sources) {
     explicit_medium_source_update(mom_em, t_curr, dt, fluid_s);
   }
-}
\ No newline at end of file
+}
+
+void
+implicit_source_coupling_update(const gkyl_moment_em_coupling* mom_em, double t_curr, double dt, double* fluid_s[GKYL_MAX_SPECIES],
+  const double* app_accel_s[GKYL_MAX_SPECIES], const double* p_rhs_s[GKYL_MAX_SPECIES], double* em, const double* app_current,
+  const double* ext_em, const double* nT_sources_s[GKYL_MAX_SPECIES])
+{
+  int nfluids = mom_em->nfluids;
+  double ke_old[GKYL_MAX_SPECIES];
+  double energy_old[GKYL_MAX_SPECIES];
+  double fluid_rhs[GKYL_MAX_SPECIES][4];
+  double p_tensor_new[GKYL_MAX_SPECIES][6];
+
+  for (int i = 0; i < nfluids; i++) {
+    source_prepare_species(mom_em, dt, i, fluid_s[i], p_rhs_s[i], em, ext_em, fluid_rhs[i], &ke_old[i], &energy_old[i],
+      p_tensor_new[i]);
+  }
+
+  if (mom_em->is_charged_species) {
+    implicit_em_source_update(mom_em, t_curr, dt, fluid_rhs, fluid_s, app_accel_s, em, app_current, ext_em);
+  }
+  else {
+    implicit_neut_source_update(mom_em, t_curr, dt, fluid_rhs, fluid_s, app_accel_s);
+  }
+
+  for (int i = 0; i < nfluids; i++) {
+    source_finish_species(mom_em, i, fluid_s[i], ke_old[i], energy_old[i], p_tensor_new[i]);
+  }
+
+  source_other_update(mom_em, t_curr, dt, fluid_s, app_accel_s, em, app_current, ext_em, nT_sources_s);
+}
+
+void
+implicit_em_source_update_batch(const gkyl_moment_em_coupling* mom_em, double t_curr, double dt, int ncells,
+  struct implicit_src_batch* b)
+{
+  int nfluids = mom_em->nfluids;
+  double epsilon0 = mom_em->epsilon0;
+
+  // Quantities that are the same in every cell.
+  double scale_fact_E = mom_em->ramp_app_E ? fmin(1.0, t_curr / mom_em->t_ramp_E) : 1.0;
+  double scale_fact_curr = mom_em->ramp_app_curr ? fmin(1.0, t_curr / mom_em->t_ramp_curr) : 1.0;
+  double dt_sq = dt * dt;
+
+  for (int k = 0; k < ncells; k++) {
+    double Bx = b->B[0][k], By = b->B[1][k], Bz = b->B[2][k];
+    double B_mag = sqrt((Bx * Bx) + (By * By) + (Bz * Bz));
+
+    b->B_mag[k] = B_mag;
+    b->bhat[0][k] = B_mag > 0.0 ? Bx / B_mag : 0.0;
+    b->bhat[1][k] = B_mag > 0.0 ? By / B_mag : 0.0;
+    b->bhat[2][k] = B_mag > 0.0 ? Bz / B_mag : 0.0;
+
+    b->w0_sq[k] = 0.0; b->gam_sq[k] = 0.0; b->delta[k] = 0.0;
+    b->K[0][k] = 0.0; b->K[1][k] = 0.0; b->K[2][k] = 0.0;
+  }
+
+  for (int i = 0; i < nfluids; i++) {
+    double q_over_m = mom_em->param[i].charge / mom_em->param[i].mass;
+    double q_over_m_sq = q_over_m * q_over_m;
+    double half_dt_q_over_m = 0.5 * dt * q_over_m;
+
+    const double* GKYL_RESTRICT rho_s = b->rho[i];
+    const double* GKYL_RESTRICT mom_x = b->mom[i][0];
+    const double* GKYL_RESTRICT mom_y = b->mom[i][1];
+    const double* GKYL_RESTRICT mom_z = b->mom[i][2];
+
+    for (int k = 0; k < ncells; k++) {
+      double rho = rho_s[k];
+      double bx = b->bhat[0][k], by = b->bhat[1][k], bz = b->bhat[2][k];
+
+      double J_old_x = mom_x[k] * q_over_m;
+      double J_old_y = mom_y[k] * q_over_m;
+      double J_old_z = mom_z[k] * q_over_m;
+
+      double Jx = J_old_x + (half_dt_q_over_m * rho * ((q_over_m * b->ext_E[0][k] * scale_fact_E) + b->app_accel[i][0][k]));
+      double Jy = J_old_y + (half_dt_q_over_m * rho * ((q_over_m * b->ext_E[1][k] * scale_fact_E) + b->app_accel[i][1][k]));
+      double Jz = J_old_z + (half_dt_q_over_m * rho * ((q_over_m * b->ext_E[2][k] * scale_fact_E) + b->app_accel[i][2][k]));
+
+      double wc_dt = q_over_m * b->B_mag[k] * dt;
+      double wp_dt_sq = (rho * q_over_m_sq * dt_sq) / epsilon0;
+
+      double denom = 1.0 + ((wc_dt * wc_dt) / 4.0);
+      b->w0_sq[k] += wp_dt_sq / denom;
+      b->gam_sq[k] += (wp_dt_sq * (wc_dt * wc_dt)) / denom;
+      b->delta[k] += (wp_dt_sq * wc_dt) / denom;
+
+      double bJ = (bx * Jx) + (by * Jy) + (bz * Jz);
+      b->K[0][k] -= (dt / denom) * (Jx + (((wc_dt * wc_dt) / 4.0) * bx * bJ) - ((wc_dt / 2.0) * ((by * Jz) - (bz * Jy))));
+      b->K[1][k] -= (dt / denom) * (Jy + (((wc_dt * wc_dt) / 4.0) * by * bJ) - ((wc_dt / 2.0) * ((bz * Jx) - (bx * Jz))));
+      b->K[2][k] -= (dt / denom) * (Jz + (((wc_dt * wc_dt) / 4.0) * bz * bJ) - ((wc_dt / 2.0) * ((bx * Jy) - (by * Jx))));
+
+      b->J_old[i][0][k] = J_old_x; b->J_old[i][1][k] = J_old_y; b->J_old[i][2][k] = J_old_z;
+      b->J[i][0][k] = Jx; b->J[i][1][k] = Jy; b->J[i][2][k] = Jz;
+      b->wc_dt[i][k] = wc_dt;
+      b->wp_dt_sq[i][k] = wp_dt_sq;
+    }
+  }
+
+  for (int k = 0; k < ncells; k++) {
+    double bx = b->bhat[0][k], by = b->bhat[1][k], bz = b->bhat[2][k];
+    double w0_sq = b->w0_sq[k], gam_sq = b->gam_sq[k], delta = b->delta[k];
+    double Delta_sq = (delta * delta) / (1.0 + (w0_sq / 4.0));
+
+    double Fx_old = b->E[0][k] * epsilon0;
+    double Fy_old = b->E[1][k] * epsilon0;
+    double Fz_old = b->E[2][k] * epsilon0;
+
+    double Fx = Fx_old - (0.5 * dt * b->app_current[0][k] * scale_fact_curr);
+    double Fy = Fy_old - (0.5 * dt * b->app_current[1][k] * scale_fact_curr);
+    double Fz = Fz_old - (0.5 * dt * b->app_current[2][k] * scale_fact_curr);
+
+    double Fx_K = Fx + (0.5 * b->K[0][k]);
+    double Fy_K = Fy + (0.5 * b->K[1][k]);
+    double Fz_K = Fz + (0.5 * b->K[2][k]);
+
+    double c0 = 1.0 / (1.0 + (w0_sq / 4.0) + (Delta_sq / 64.0));
+    double c1 = ((Delta_sq / 64.0) - (gam_sq / 16.0)) / (1.0 + (w0_sq / 4.0) + (gam_sq / 16.0));
+    double c2 = (delta / 8.0) / (1.0 + (w0_sq / 4.0));
+    double bF = (bx * Fx_K) + (by * Fy_K) + (bz * Fz_K);
+
+    double Fx_bar = c0 * (Fx_K + (c1 * bx * bF) + (c2 * ((by * Fz_K) - (bz * Fy_K))));
+    double Fy_bar = c0 * (Fy_K + (c1 * by * bF) + (c2 * ((bz * Fx_K) - (bx * Fz_K))));
+    double Fz_bar = c0 * (Fz_K + (c1 * bz * bF) + (c2 * ((bx * Fy_K) - (by * Fx_K))));
+
+    b->E[0][k] = ((2.0 * Fx_bar) - Fx_old) / epsilon0;
+    b->E[1][k] = ((2.0 * Fy_bar) - Fy_old) / epsilon0;
+    b->E[2][k] = ((2.0 * Fz_bar) - Fz_old) / epsilon0;
+
+    b->F_bar[0][k] = Fx_bar; b->F_bar[1][k] = Fy_bar; b->F_bar[2][k] = Fz_bar;
+  }
+
+  for (int i = 0; i < nfluids; i++) {
+    double q_over_m = mom_em->param[i].charge / mom_em->param[i].mass;
+
+    for (int k = 0; k < ncells; k++) {
+      double bx = b->bhat[0][k], by = b->bhat[1][k], bz = b->bhat[2][k];
+      double wc_dt = b->wc_dt[i][k];
+      double half_wp_dt = (b->wp_dt_sq[i][k] / dt) / 2.0;
+
+      double Jx_star = b->J[i][0][k] + (b->F_bar[0][k] * half_wp_dt);
+      double Jy_star = b->J[i][1][k] + (b->F_bar[1][k] * half_wp_dt);
+      double Jz_star = b->J[i][2][k] + (b->F_bar[2][k] * half_wp_dt);
+
+      double bJ = (bx * Jx_star) + (by * Jy_star) + (bz * Jz_star);
+      double denom = 1.0 + ((wc_dt * wc_dt) / 4.0);
+
+      double Jx_new = ((2.0 * (Jx_star + (((wc_dt * wc_dt) / 4.0) * bx * bJ) - ((wc_dt / 2.0) * ((by * Jz_star) - (bz * Jy_star))))) / denom)
+        - b->J_old[i][0][k];
+      double Jy_new = ((2.0 * (Jy_star + (((wc_dt * wc_dt) / 4.0) * by * bJ) - ((wc_dt / 2.0) * ((bz * Jx_star) - (bx * Jz_star))))) / denom)
+        - b->J_old[i][1][k];
+      double Jz_new = ((2.0 * (Jz_star + (((wc_dt * wc_dt) / 4.0) * bz * bJ) - ((wc_dt / 2.0) * ((bx * Jy_star) - (by * Jx_star))))) / denom)
+        - b->J_old[i][2][k];
+
+      b->mom[i][0][k] = Jx_new / q_over_m;
+      b->mom[i][1][k] = Jy_new / q_over_m;
+      b->mom[i][2][k] = Jz_new / q_over_m;
+    }
+  }
+}
+
+void
+implicit_source_coupling_update_batch(const gkyl_moment_em_coupling* mom_em, double t_curr, double dt, int ncells,
+  const struct implicit_src_cell* cells, struct implicit_src_batch* b)
+{
+  int nfluids = mom_em->nfluids;
+
+  // Gather the block into structure-of-arrays scratch.
+  for (int k = 0; k < ncells; k++) {
+    const struct implicit_src_cell* c = &cells[k];
+
+    for (int i = 0; i < nfluids; i++) {
+      double fluid_rhs[4];
+      source_prepare_species(mom_em, dt, i, c->fluid[i], c->p_rhs[i], c->em, c->ext_em, fluid_rhs, &b->ke_old[i][k],
+        &b->energy_old[i][k], b->p_tensor_new[i][k]);
+
+      b->rho[i][k] = fluid_rhs[0];
+      b->mom[i][0][k] = fluid_rhs[1]; b->mom[i][1][k] = fluid_rhs[2]; b->mom[i][2][k] = fluid_rhs[3];
+      b->app_accel[i][0][k] = c->app_accel[i][0];
+      b->app_accel[i][1][k] = c->app_accel[i][1];
+      b->app_accel[i][2][k] = c->app_accel[i][2];
+    }
+
+    for (int d = 0; d < 3; d++) {
+      b->E[d][k] = c->em[d];
+      b->B[d][k] = c->em[3 + d] + c->ext_em[3 + d];
+      b->ext_E[d][k] = c->ext_em[d];
+      b->app_current[d][k] = c->app_current[d];
+    }
+  }
+
+  implicit_em_source_update_batch(mom_em, t_curr, dt, ncells, b);
+
+  // Scatter the results back and finish the update in each cell.
+  for (int k = 0; k < ncells; k++) {
+    const struct implicit_src_cell* c = &cells[k];
+    double* fluid_s[GKYL_MAX_SPECIES];
+    const double* app_accel_s[GKYL_MAX_SPECIES];
+    const double* nT_sources_s[GKYL_MAX_SPECIES];
+
+    for (int d = 0; d < 3; d++) {
+      c->em[d] = b->E[d][k];
+    }
+
+    for (int i = 0; i < nfluids; i++) {
+      double *f = c->fluid[i];
+
+      f[1] = b->mom[i][0][k];
+      f[2] = b->mom[i][1][k];
+      f[3] = b->mom[i][2][k];
+
+      source_finish_species(mom_em, i, f, b->ke_old[i][k], b->energy_old[i][k], b->p_tensor_new[i][k]);
+
+      fluid_s[i] = c->fluid[i];
+      app_accel_s[i] = c->app_accel[i];
+      nT_sources_s[i] = c->nT_sources[i];
+    }
+
+    source_other_update(mom_em, t_curr, dt, fluid_s, app_accel_s, c->em, c->app_current, c->ext_em, nT_sources_s);
+  }
+}
@@ -1,19 +1,191 @@
 #include <gkyl_thread_pool.h>
 #include <gkyl_alloc.h>
 
-#include <thpool.h>
+#include <pthread.h>
+#include <stdbool.h>
+
+// Work-stealing thread pool. Each worker owns a deque of jobs. A
+// worker pops jobs from the bottom of its own deque and, when that is
+// empty, steals from the top of the other workers' deques. Idle
+// workers sleep on a condition variable instead of polling.
+
+struct ws_job {
+  jp_work_func func; // function to run
+  void *ctx; // context for function
+};
+
+// Double-ended queue of jobs, stored as a growable ring buffer. The
+// owner pushes/pops at the tail, thieves take from the head.
+struct ws_deque {
+  pthread_mutex_t lock;
+  struct ws_job *jobs; // ring buffer
+  long head, tail; // jobs in [head, tail) (modulo cap)
+  long cap; // capacity of ring buffer
+};
+
+struct jp_thread_pool;
+
+struct ws_worker {
+  int id; // worker ID
+  struct jp_thread_pool *th; // pool this worker belongs to
+  pthread_t thread;
+};
 
 struct jp_thread_pool {
   struct gkyl_job_pool jp; // base job-pool object
-  threadpool thpool; // thread-pool object
+
+  int nthreads; // number of workers
+  struct ws_worker *workers; // worker threads
+  struct ws_deque *deques; // one deque per worker
+
+  pthread_mutex_t lock; // protects counters below
+  pthread_cond_t has_work; // signaled when jobs are queued
+  pthread_cond_t all_done; // signaled when num_pending drops to zero
+  long num_queued; // jobs sitting in deques
+  long num_pending; // jobs added but not yet completed
+  int next_deque; // round-robin deque for jobs added from outside
+  bool shutdown; // set when pool is being destroyed
 };
 
+// worker running on this thread (NULL if not a pool worker)
+static _Thread_local struct ws_worker *ws_self = 0;
+
+static void
+deque_init(struct ws_deque *dq)
+{
+  pthread_mutex_init(&dq->lock, 0);
+  dq->cap = 64;
+  dq->jobs = gkyl_malloc(sizeof(struct ws_job[dq->cap]));
+  dq->head = dq->tail = 0;
+}
+
+static void
+deque_release(struct ws_deque *dq)
+{
+  pthread_mutex_destroy(&dq->lock);
+  gkyl_free(dq->jobs);
+}
+
+static void
+deque_push(struct ws_deque *dq, struct ws_job job)
+{
+  pthread_mutex_lock(&dq->lock);
+  if (dq->tail-dq->head == dq->cap) {
+    // full: double capacity, unrolling the ring into the new buffer
+    long ncap = 2*dq->cap;
+    struct ws_job *njobs = gkyl_malloc(sizeof(struct ws_job[ncap]));
+    for (long i=dq->head; i<dq->tail; ++i)
+      njobs[i-dq->head] = dq->jobs[i % dq->cap];
+    gkyl_free(dq->jobs);
+    dq->jobs = njobs;
+    dq->tail = dq->tail-dq->head;
+    dq->head = 0;
+    dq->cap = ncap;
+  }
+  dq->jobs[dq->tail % dq->cap] = job;
+  dq->tail += 1;
+  pthread_mutex_unlock(&dq->lock);
+}
+
+// pop from bottom (owner side)
+static bool
+deque_pop(struct ws_deque *dq, struct ws_job *job)
+{
+  bool found = false;
+  pthread_mutex_lock(&dq->lock);
+  if (dq->tail > dq->head) {
+    dq->tail -= 1;
+    *job = dq->jobs[dq->tail % dq->cap];
+    found = true;
+  }
+  pthread_mutex_unlock(&dq->lock);
+  return found;
+}
+
+// steal from top (thief side)
+static bool
+deque_steal(struct ws_deque *dq, struct ws_job *job)
+{
+  bool found = false;
+  pthread_mutex_lock(&dq->lock);
+  if (dq->tail > dq->head) {
+    *job = dq->jobs[dq->head % dq->cap];
+    dq->head += 1;
+    found = true;
+  }
+  pthread_mutex_unlock(&dq->lock);
+  return found;
+}
+
+// find a job for worker 'id': own deque first, then steal
+static bool
+find_job(struct jp_thread_pool *th, int id, struct ws_job *job)
+{
+  if (deque_pop(&th->deques[id], job))
+    return true;
+  for (int i=1; i<th->nthreads; ++i)
+    if (deque_steal(&th->deques[(id+i) % th->nthreads], job))
+      return true;
+  return false;
+}
+
+static void*
+worker_func(void *arg)
+{
+  struct ws_worker *w = arg;
+  struct jp_thread_pool *th = w->th;
+  ws_self = w;
+
+  while (1) {
+    struct ws_job job;
+    if (find_job(th, w->id, &job)) {
+      pthread_mutex_lock(&th->lock);
+      th->num_queued -= 1;
+      pthread_mutex_unlock(&th->lock);
+
+      job.func(job.ctx);
+
+      pthread_mutex_lock(&th->lock);
+      th->num_pending -= 1;
+      if (th->num_pending == 0)
+        pthread_cond_broadcast(&th->all_done);
+      pthread_mutex_unlock(&th->lock);
+      continue;
+    }
+
+    // nothing to do: sleep till more work is queued
+    pthread_mutex_lock(&th->lock);
+    while (th->num_queued == 0 && !th->shutdown)
+      pthread_cond_wait(&th->has_work, &th->lock);
+    bool done = th->shutdown && th->num_queued == 0;
+    pthread_mutex_unlock(&th->lock);
+    if (done) break;
+  }
+  return 0;
+}
+
 static void
 thread_pool_free(const struct gkyl_ref_count *ref)
 {
   struct gkyl_job_pool *base = container_of(ref, struct gkyl_job_pool, ref_count);
   struct jp_thread_pool *th = container_of(base, struct jp_thread_pool, jp);
-  thpool_destroy(th->thpool);
+
+  pthread_mutex_lock(&th->lock);
+  th->shutdown = true;
+  pthread_cond_broadcast(&th->has_work);
+  pthread_mutex_unlock(&th->lock);
+
+  for (int i=0; i<th->nthreads; ++i)
+    pthread_join(th->workers[i].thread, 0);
+  for (int i=0; i<th->nthreads; ++i)
+    deque_release(&th->deques[i]);
+
+  pthread_cond_destroy(&th->has_work);
+  pthread_cond_destroy(&th->all_done);
+  pthread_mutex_destroy(&th->lock);
+
+  gkyl_free(th->workers);
+  gkyl_free(th->deques);
   gkyl_free(th);
 }
 
@@ -21,23 +193,57 @@ static bool
 thread_pool_add_work(const struct gkyl_job_pool *jp, jp_work_func func, void *ctx)
 {
   struct jp_thread_pool *th = container_of(jp, struct jp_thread_pool, jp);
-  int status = thpool_add_work(th->thpool, func, ctx);
-  return status == 0 ? true : false;
+
+  int id;
+  if (ws_self && ws_self->th == th) {
+    // job spawned from a worker: keep it local, others can steal it
+    id = ws_self->id;
+  }
+  else {
+    pthread_mutex_lock(&th->lock);
+    id = th->next_deque;
+    th->next_deque = (th->next_deque+1) % th->nthreads;
+    pthread_mutex_unlock(&th->lock);
+  }
+  deque_push(&th->deques[id], (struct ws_job) { .func = func, .ctx = ctx });
+
+  pthread_mutex_lock(&th->lock);
+  th->num_queued += 1;
+  th->num_pending += 1;
+  pthread_cond_signal(&th->has_work);
+  pthread_mutex_unlock(&th->lock);
+
+  return true;
 }
 
 static void
 thread_pool_wait(const struct gkyl_job_pool *jp)
 {
   struct jp_thread_pool *th = container_of(jp, struct jp_thread_pool, jp);
-  thpool_wait(th->thpool);
+  pthread_mutex_lock(&th->lock);
+  while (th->num_pending > 0)
+    pthread_cond_wait(&th->all_done, &th->lock);
+  pthread_mutex_unlock(&th->lock);
 }
 
 struct gkyl_job_pool*
 gkyl_thread_pool_new(int nthreads)
 {
   struct jp_thread_pool *th = gkyl_malloc(sizeof(struct jp_thread_pool));
-  // initialize the actual pool object
-  th->thpool = thpool_init(nthreads);  
+
+  nthreads = nthreads < 1 ? 1 : nthreads;
+  th->nthreads = nthreads;
+
+  pthread_mutex_init(&th->lock, 0);
+  pthread_cond_init(&th->has_work, 0);
+  pthread_cond_init(&th->all_done, 0);
+  th->num_queued = th->num_pending = 0;
+  th->next_deque = 0;
+  th->shutdown = false;
+
+  th->deques = gkyl_malloc(sizeof(struct ws_deque[nthreads]));
+  for (int i=0; i<nthreads; ++i)
+    deque_init(&th->deques[i]);
 
   th->jp.pool_size = nthreads;
   th->jp.add_work = thread_pool_add_work;
@@ -45,6 +251,13 @@ gkyl_thread_pool_new(int nthreads)
 
   // set reference counter
   th->jp.ref_count = gkyl_ref_count_init(thread_pool_free);
-    
+
+  th->workers = gkyl_malloc(sizeof(struct ws_worker[nthreads]));
+  for (int i=0; i<nthreads; ++i) {
+    th->workers[i].id = i;
+    th->workers[i].th = th;
+    pthread_create(&th->workers[i].thread, 0, worker_func, &th->workers[i]);
+  }
+
   return &th->jp;
 }
@@ -51,6 +51,24 @@ gkyl_vlasov_lte_correct_inew(const struct gkyl_vlasov_lte_correct_inp *inp)
   // Allocate host-side error for checking convergence and returning in the status object 
   up->error = gkyl_malloc(sizeof(double[up->num_comp]));
 
+  // Per-cell iteration state for masked and accelerated iterations
+  up->use_cell_mask = !up->use_gpu && inp->use_cell_mask;
+  up->use_anderson = !up->use_gpu && inp->use_anderson;
+  up->cell_active = 0;
+  up->cell_niter = 0;
+  up->cell_error = 0;
+  up->d_moms_prev = 0;
+  up->dd_moms_prev = 0;
+  if (up->use_cell_mask || up->use_anderson) {
+    up->cell_active = gkyl_malloc(sizeof(bool[conf_local_ext_ncells]));
+    up->cell_niter = gkyl_malloc(sizeof(int[conf_local_ext_ncells]));
+    up->cell_error = gkyl_malloc(sizeof(double[conf_local_ext_ncells*up->num_comp]));
+  }
+  if (up->use_anderson) {
+    up->d_moms_prev = gkyl_array_new(GKYL_DOUBLE, up->num_comp*up->num_conf_basis, conf_local_ext_ncells);
+    up->dd_moms_prev = gkyl_array_new(GKYL_DOUBLE, up->num_comp*up->num_conf_basis, conf_local_ext_ncells);
+  }
+
   // Moments structure 
   struct gkyl_vlasov_lte_moments_inp inp_mom = {
     .phase_grid = inp->phase_grid,
@@ -98,6 +116,247 @@ gkyl_vlasov_lte_correct_inew(const struct gkyl_vlasov_lte_correct_inp *inp)
   return up;
 }
 
+// Error in the cell averages of moms compared to the target moments.
+// For density and temperature, this error is a relative error
+// compared to the target moment value so that we can converge to the
+// correct target moments in SI units and minimize finite precision
+// issues. V_drift may be ~ 0 and if it is, we need to use absolute
+// error. We can converge safely using absolute error if V_drift ~
+// O(1). Otherwise, we use relative error for V_drift.
+static void
+cell_moms_error(int num_comp, int nc, const double *moms, const double *moms_target,
+  double *err)
+{
+  int T_idx = num_comp-1; // T/m is always the last component
+  err[0] = fabs(moms[0*nc] - moms_target[0*nc])/moms_target[0*nc];
+  err[T_idx] = fabs(moms[T_idx*nc] - moms_target[T_idx*nc])/moms_target[T_idx*nc];
+  for (int d=1; d<num_comp-1; ++d) {
+    if (fabs(moms_target[d*nc]) < 1.0)
+      err[d] = fabs(moms[d*nc] - moms_target[d*nc]);
+    else
+      err[d] = fabs(moms[d*nc] - moms_target[d*nc])/moms_target[d*nc];
+  }
+}
+
+// Sub-ranges of phase_local and conf_local for the run of
+// configuration-space cells cidx with the last configuration-space
+// index going from ilo to iup
+static void
+run_ranges(const struct gkyl_range *phase_local, const struct gkyl_range *conf_local,
+  const int *cidx, int ilo, int iup, struct gkyl_range *phase_run, struct gkyl_range *conf_run)
+{
+  int cdim = conf_local->ndim;
+  int lower[GKYL_MAX_DIM], upper[GKYL_MAX_DIM];
+  for (int d=0; d<phase_local->ndim; ++d) {
+    lower[d] = d < cdim ? cidx[d] : phase_local->lower[d];
+    upper[d] = d < cdim ? cidx[d] : phase_local->upper[d];
+  }
+  lower[cdim-1] = ilo; upper[cdim-1] = iup;
+  gkyl_sub_range_init(phase_run, phase_local, lower, upper);
+  gkyl_sub_range_init(conf_run, conf_local, lower, upper);
+}
+
+// Compute the moments of f_lte (proj false) or reproject f_lte (proj
+// true) in the active configuration-space cells. Consecutive active
+// cells along the last configuration-space direction are done in one
+// call, so that the updaters (and the LU factors cached in their
+// weak divisions) work on as many cells at once as possible.
+static void
+active_cells_advance(gkyl_vlasov_lte_correct *up, bool proj,
+  const struct gkyl_range *phase_local, const struct gkyl_range *conf_local,
+  struct gkyl_array *f_lte)
+{
+  int last = conf_local->ndim-1;
+  struct gkyl_range rows, phase_run, conf_run;
+  gkyl_range_shorten_from_above(&rows, conf_local, last, 1);
+
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, &rows);
+  while (gkyl_range_iter_next(&iter)) {
+    int cidx[GKYL_MAX_DIM];
+    for (int d=0; d<conf_local->ndim; ++d) cidx[d] = iter.idx[d];
+
+    int ilo = conf_local->lower[last], iup = conf_local->upper[last];
+    for (int i=ilo; i<=iup+1; ++i) {
+      bool active = false;
+      if (i <= iup) {
+        cidx[last] = i;
+        active = up->cell_active[gkyl_range_idx(conf_local, cidx)];
+      }
+      if (active) continue;
+      // cells ilo to i-1 form a run of active cells
+      if (i > ilo) {
+        run_ranges(phase_local, conf_local, cidx, ilo, i-1, &phase_run, &conf_run);
+        if (proj)
+          gkyl_vlasov_lte_proj_on_basis_advance(up->proj_lte, 
+            &phase_run, &conf_run, up->moms_iter, f_lte);
+        else
+          gkyl_vlasov_lte_moments_advance(up->moments_up, 
+            &phase_run, &conf_run, f_lte, up->moms_iter);
+      }
+      ilo = i+1;
+    }
+  }
+}
+
+// New d_moms in a cell from the residual dd = moms_target - moms_iter
+// using Anderson mixing of depth 1 with the previous iterate. The
+// components are weighted by the scale used in the error so that
+// density and temperature in SI units do not dominate. Falls back to
+// the fixed-point update d += dd if mixing gives non-positive density
+// or temperature.
+static void
+cell_anderson_update(int num_comp, int nc, bool has_prev, const double *moms_target,
+  double *d, const double *dd, double *d_prev, double *dd_prev)
+{
+  int n = num_comp*nc, T_idx = num_comp-1;
+  double d_new[n];
+
+  double gamma = 0.0;
+  if (has_prev) {
+    double num = 0.0, den = 0.0;
+    for (int c=0; c<num_comp; ++c) {
+      double scale = fabs(moms_target[c*nc]);
+      if (c != 0 && c != T_idx && scale < 1.0)
+        scale = 1.0;
+      double w = 1.0/(scale*scale);
+      for (int k=c*nc; k<(c+1)*nc; ++k) {
+        double ddr = dd[k]-dd_prev[k];
+        num += w*ddr*dd[k];
+        den += w*ddr*ddr;
+      }
+    }
+    gamma = den > 0.0 ? num/den : 0.0;
+  }
+  for (int k=0; k<n; ++k)
+    d_new[k] = d[k] + dd[k] - gamma*((d[k]-d_prev[k]) + (dd[k]-dd_prev[k]));
+
+  if (!(moms_target[0] + d_new[0] > 0.0 && moms_target[T_idx*nc] + d_new[T_idx*nc] > 0.0))
+    for (int k=0; k<n; ++k)
+      d_new[k] = d[k] + dd[k];
+
+  for (int k=0; k<n; ++k) {
+    d_prev[k] = d[k];
+    dd_prev[k] = dd[k];
+    d[k] = d_new[k];
+  }
+}
+
+// Iterate on the host with per-cell convergence masks and/or
+// Anderson mixing. Cells that are no longer active are neither
+// reprojected nor have their moments recomputed.
+static int
+correct_all_moments_cells(gkyl_vlasov_lte_correct *up,
+  struct gkyl_array *f_lte, const struct gkyl_array *moms_target, 
+  const struct gkyl_range *phase_local, const struct gkyl_range *conf_local,
+  bool *ispositive_f_lte)
+{
+  int num_comp = up->num_comp;
+  int nc = up->num_conf_basis;
+  int T_idx = num_comp-1;
+  double tol = up->eps;
+  long ncells = conf_local->volume;
+
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, conf_local);
+  while (gkyl_range_iter_next(&iter)) {
+    long midx = gkyl_range_idx(conf_local, iter.idx);
+    up->cell_active[midx] = true;
+    up->cell_niter[midx] = 0;
+    for (int i=0; i<num_comp; ++i)
+      up->cell_error[midx*num_comp+i] = 1.0;
+  }
+  gkyl_array_clear(up->d_moms, 0.0);
+  gkyl_array_clear(up->dd_moms, 0.0);
+
+  long nactive = ncells, nunconverged = ncells;
+  int niter = 0;
+  *ispositive_f_lte = true;
+  while (*ispositive_f_lte && niter < up->max_iter && nunconverged > 0) {
+    // 1. Calculate the LTE moments (n, V_drift, T) in the active cells
+    if (nactive == ncells)
+      gkyl_vlasov_lte_moments_advance(up->moments_up, phase_local, conf_local, f_lte, up->moms_iter);
+    else
+      active_cells_advance(up, false, phase_local, conf_local, f_lte);
+
+    // 2. Check convergence and update the moments used in the projection
+    nunconverged = 0;
+    gkyl_range_iter_init(&iter, conf_local);
+    while (gkyl_range_iter_next(&iter)) {
+      long midx = gkyl_range_idx(conf_local, iter.idx);
+      if (!up->cell_active[midx]) continue;
+
+      double *moms_iter = gkyl_array_fetch(up->moms_iter, midx);
+      const double *moms_target_c = gkyl_array_cfetch(moms_target, midx);
+      double *d_moms = gkyl_array_fetch(up->d_moms, midx);
+      double *dd_moms = gkyl_array_fetch(up->dd_moms, midx);
+
+      up->cell_niter[midx] += 1;
+      double *err = up->cell_error + midx*num_comp;
+      cell_moms_error(num_comp, nc, moms_iter, moms_target_c, err);
+      *ispositive_f_lte = (moms_iter[0*nc] > 0.0) && (moms_iter[T_idx*nc] > 0.0) && *ispositive_f_lte;
+
+      double max_error = 0.0;
+      for (int i=0; i<num_comp; ++i)
+        max_error = fmax(max_error, err[i]);
+      if (max_error >= tol)
+        nunconverged += 1;
+
+      // ddMi^(k+1) = Mi_corr - Mi_new, dMi^(k+1) = dMi^k + ddMi^(k+1)
+      for (int k=0; k<num_comp*nc; ++k)
+        dd_moms[k] = moms_target_c[k] - moms_iter[k];
+      if (up->use_anderson)
+        cell_anderson_update(num_comp, nc, up->cell_niter[midx] > 1, moms_target_c,
+          d_moms, dd_moms, gkyl_array_fetch(up->d_moms_prev, midx),
+          gkyl_array_fetch(up->dd_moms_prev, midx));
+      else
+        for (int k=0; k<num_comp*nc; ++k)
+          d_moms[k] += dd_moms[k];
+
+      // n^(k+1) = M^k + dM^(k+1)
+      for (int k=0; k<num_comp*nc; ++k)
+        moms_iter[k] = moms_target_c[k] + d_moms[k];
+    }
+
+    // 3. Reproject the LTE distribution function in the active cells
+    if (nactive == ncells)
+      gkyl_vlasov_lte_proj_on_basis_advance(up->proj_lte, 
+        phase_local, conf_local, up->moms_iter, f_lte);
+    else
+      active_cells_advance(up, true, phase_local, conf_local, f_lte);
+
+    // 4. Converged cells get this last projection (as in the unmasked loop)
+    // and are left alone from here on
+    if (up->use_cell_mask) {
+      gkyl_range_iter_init(&iter, conf_local);
+      while (gkyl_range_iter_next(&iter)) {
+        long midx = gkyl_range_idx(conf_local, iter.idx);
+        if (!up->cell_active[midx]) continue;
+        double max_error = 0.0;
+        for (int i=0; i<num_comp; ++i)
+          max_error = fmax(max_error, up->cell_error[midx*num_comp+i]);
+        if (max_error < tol) {
+          up->cell_active[midx] = false;
+          nactive -= 1;
+        }
+      }
+    }
+
+    niter += 1;
+  }
+
+  // Maximum over cells of the last error in each cell
+  for (int i=0; i<num_comp; ++i)
+    up->error[i] = 0.0;
+  gkyl_range_iter_init(&iter, conf_local);
+  while (gkyl_range_iter_next(&iter)) {
+    long midx = gkyl_range_idx(conf_local, iter.idx);
+    for (int i=0; i<num_comp; ++i)
+      up->error[i] = fmax(up->error[i], up->cell_error[midx*num_comp+i]);
+  }
+  return niter;
+}
+
 struct gkyl_vlasov_lte_correct_status
 gkyl_vlasov_lte_correct_all_moments(gkyl_vlasov_lte_correct *up,
   struct gkyl_array *f_lte, const struct gkyl_array *moms_target, 
@@ -126,8 +385,20 @@ gkyl_vlasov_lte_correct_all_moments(gkyl_vlasov_lte_correct *up,
   gkyl_array_clear(up->d_moms, 0.0);
   gkyl_array_clear(up->dd_moms, 0.0);
 
+  if (up->use_cell_mask || up->use_anderson) {
+    bool ispositive;
+    niter = correct_all_moments_cells(up, f_lte, moms_target, phase_local, conf_local, &ispositive);
+    ispositive_f_lte = ispositive;
+    max_error = 0.0;
+    for (int d=0; d<num_comp; ++d) {
+      max_error = fmax(max_error, up->error[d]);
+    }
+  }
+
   // Iteration loop, max_iter iterations is usually sufficient for machine precision moments
-  while ((ispositive_f_lte) && ((niter < max_iter) && (max_error > tol))) {
+  // (skipped if the iterations were done cell by cell above)
+  while ((!up->use_cell_mask && !up->use_anderson)
+    && (ispositive_f_lte) && ((niter < max_iter) && (max_error > tol))) {
     // 1. Calculate the LTE moments (n, V_drift, T) from the projected LTE distribution
     gkyl_vlasov_lte_moments_advance(up->moments_up, phase_local, conf_local, f_lte, up->moms_iter);
 
@@ -166,23 +437,13 @@ gkyl_vlasov_lte_correct_all_moments(gkyl_vlasov_lte_correct *up,
           const double *moms_local = gkyl_array_cfetch(up->moms_iter, midx);
           const double *moms_target_local = gkyl_array_cfetch(moms_target, midx);
           // Check the error in the absolute value of the cell average
-          // Note: for density and temperature, this error is a relative error compared to the target moment value
-          // so that we can converge to the correct target moments in SI units and minimize finite precision issues.
-          up->error[0] = fmax(fabs(moms_local[0*nc] - moms_target_local[0*nc])/moms_target_local[0*nc],fabs(up->error[0]));
-          int T_idx = num_comp-1; // T/m is always the last component
-          up->error[T_idx] = fmax(fabs(moms_local[T_idx*nc] - moms_target_local[T_idx*nc])/moms_target_local[T_idx*nc],fabs(up->error[T_idx]));
-
-          // However, V_drift may be ~ 0 and if it is, we need to use absolute error. We can converge safely using
-          // absolute error if V_drift ~ O(1). Otherwise, we use relative error for V_drift. 
-          for (int d=1; d<num_comp-1; ++d) {
-            if (fabs(moms_target_local[d*nc]) < 1.0) {
-              up->error[d] = fmax(fabs(moms_local[d*nc] - moms_target_local[d*nc]),fabs(up->error[d]));
-            }
-            else {
-              up->error[d] = fmax(fabs(moms_local[d*nc] - moms_target_local[d*nc])/moms_target_local[d*nc],fabs(up->error[d]));
-            }            
+          double err[num_comp];
+          cell_moms_error(num_comp, nc, moms_local, moms_target_local, err);
+          for (int d=0; d<num_comp; ++d) {
+            up->error[d] = fmax(err[d], up->error[d]);
           }
           // Check if density and temperature are positive, if they aren't we will break out of the iteration
+          int T_idx = num_comp-1; // T/m is always the last component
           ispositive_f_lte = (moms_local[0*nc] > 0.0) && ispositive_f_lte;
           ispositive_f_lte = (moms_local[T_idx*nc] > 0.0) && ispositive_f_lte;
         }
@@ -246,20 +507,10 @@ gkyl_vlasov_lte_correct_all_moments(gkyl_vlasov_lte_correct *up,
         const double *moms_local = gkyl_array_cfetch(up->moms_iter, midx);
         const double *moms_target_local = gkyl_array_cfetch(moms_target, midx);
         // Check the error in the absolute value of the cell average
-        // Note: for density and temperature, this error is a relative error compared to the target moment value.
-        up->error[0] = fmax(fabs(moms_local[0*nc] - moms_target_local[0*nc])/moms_target_local[0*nc], fabs(up->error[0]));
-        int T_idx = num_comp-1; // T/m is always the last component
-        up->error[T_idx] = fmax(fabs(moms_local[T_idx*nc] - moms_target_local[T_idx*nc])/moms_target_local[T_idx*nc], fabs(up->error[T_idx]));
-
-        // However, V_drift may be ~ 0 and if it is, we need to use absolute error. 
-        // Otherwise, we use relative error for V_drift. 
-        for (int d=1; d<num_comp-1; ++d) {
-          if (fabs(moms_target_local[d*nc]) < 1.0) {
-            up->error[d] = fmax(fabs(moms_local[d*nc] - moms_target_local[d*nc]), fabs(up->error[d]));
-          }
-          else {
-            up->error[d] = fmax(fabs(moms_local[d*nc] - moms_target_local[d*nc])/moms_target_local[d*nc], fabs(up->error[d]));
-          }            
+        double err[num_comp];
+        cell_moms_error(num_comp, nc, moms_local, moms_target_local, err);
+        for (int d=0; d<num_comp; ++d) {
+          up->error[d] = fmax(err[d], up->error[d]);
         }
       }
     }
@@ -268,6 +519,22 @@ gkyl_vlasov_lte_correct_all_moments(gkyl_vlasov_lte_correct *up,
   struct gkyl_vlasov_lte_correct_status status;
   status.iter_converged = corr_status;
   status.num_iter = niter;
+  status.num_cell_iter = 0;
+  status.max_cell_iter = 0;
+  if (up->use_cell_mask || up->use_anderson) {
+    struct gkyl_range_iter citer;
+    gkyl_range_iter_init(&citer, conf_local);
+    while (gkyl_range_iter_next(&citer)) {
+      int cell_niter = up->cell_niter[gkyl_range_idx(conf_local, citer.idx)];
+      status.num_cell_iter += cell_niter;
+      status.max_cell_iter = cell_niter > status.max_cell_iter ? cell_niter : status.max_cell_iter;
+    }
+  }
+  else {
+    // every cell takes part in every iteration
+    status.num_cell_iter = niter*conf_local->volume;
+    status.max_cell_iter = niter;
+  }
   for (int i=0; i<num_comp; ++i) {
     status.error[i] = up->error[i];
   }
@@ -285,6 +552,15 @@ gkyl_vlasov_lte_correct_release(gkyl_vlasov_lte_correct *up)
     gkyl_cu_free(up->error_cu);
   }
   gkyl_free(up->error);
+  if (up->use_cell_mask || up->use_anderson) {
+    gkyl_free(up->cell_active);
+    gkyl_free(up->cell_niter);
+    gkyl_free(up->cell_error);
+  }
+  if (up->use_anderson) {
+    gkyl_array_release(up->d_moms_prev);
+    gkyl_array_release(up->dd_moms_prev);
+  }
 
   gkyl_vlasov_lte_moments_release(up->moments_up);
   gkyl_vlasov_lte_proj_on_basis_release(up->proj_lte);
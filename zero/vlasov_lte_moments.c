@@ -107,6 +107,16 @@ gkyl_vlasov_lte_moments_inew(const struct gkyl_vlasov_lte_moments_inp *inp)
   return up;
 }
 
+void
+gkyl_vlasov_lte_moments_set_job_pool(struct gkyl_vlasov_lte_moments *lte_moms,
+  const struct gkyl_job_pool *job_pool, bool deterministic)
+{
+  gkyl_dg_updater_moment_set_job_pool(lte_moms->M0_calc, job_pool, deterministic);
+  gkyl_dg_updater_moment_set_job_pool(lte_moms->M1i_calc, job_pool, deterministic);
+  if (lte_moms->model_id != GKYL_MODEL_SR)
+    gkyl_dg_updater_moment_set_job_pool(lte_moms->Pcalc, job_pool, deterministic);
+}
+
 void 
 gkyl_vlasov_lte_density_moment_advance(struct gkyl_vlasov_lte_moments *lte_moms, 
   const struct gkyl_range *phase_local, const struct gkyl_range *conf_local, 
@@ -199,7 +209,7 @@ gkyl_vlasov_lte_moments_advance(struct gkyl_vlasov_lte_moments *lte_moms,
       gkyl_dg_updater_moment_advance(lte_moms->Pcalc, phase_local, conf_local, 
         fin, lte_moms->pressure);
       // Subtract off V_drift dot M1i from total M2
-      gkyl_array_clear(lte_moms->V_drift_dot_M1i, 0.0);
+      gkyl_array_clear_range(lte_moms->V_drift_dot_M1i, 0.0, conf_local);
       gkyl_dg_dot_product_op_range(lte_moms->conf_basis, 
         lte_moms->V_drift_dot_M1i, lte_moms->V_drift, lte_moms->M1i, conf_local); 
       gkyl_array_accumulate_range(lte_moms->pressure, -1.0, 
@@ -207,7 +217,7 @@ gkyl_vlasov_lte_moments_advance(struct gkyl_vlasov_lte_moments *lte_moms,
     }
 
     // Rescale pressure by 1.0/vdim and set the first component of moms_out to be the density. 
-    gkyl_array_scale(lte_moms->pressure, 1.0/vdim);
+    gkyl_array_scale_range(lte_moms->pressure, 1.0/vdim, conf_local);
     gkyl_array_set_range(moms_out, 1.0, lte_moms->M0, conf_local);
   }
   // ( T/m = P/(mn) ) 
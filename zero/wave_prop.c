@@ -1,3 +1,4 @@
+#include <assert.h>
 #include <float.h>
 #include <math.h>
 #include <time.h>
@@ -5,12 +6,31 @@
 #include <gkyl_alloc.h>
 #include <gkyl_array.h>
 #include <gkyl_array_ops.h>
+#include <gkyl_job_pool.h>
 #include <gkyl_null_comm.h>
 #include <gkyl_rect_decomp.h>
 #include <gkyl_util.h>
 #include <gkyl_wave_geom.h>
 #include <gkyl_wave_prop.h>
 
+// data for 1D slice update: each thread sweeping pencils needs its own
+struct wave_prop_slice {
+  struct gkyl_array *waves, *apdq, *amdq, *speeds, *flux2;
+  // flags to indicate if fluctuations should be recomputed
+  struct gkyl_array *redo_fluct;
+};
+
+// state accumulated while sweeping pencils
+struct wave_prop_sweep {
+  double cfla; // maximum CFL number
+  double max_speed; // maximum wave speed
+  bool is_cfl_violated; // true if CFL number exceeded the limit
+
+  long n_bad_advance_calls; // number of pencils in which positivity had to be fixed
+  long n_bad_cells; // number of cells fixed
+  long n_max_bad_cells; // maximum number of cells fixed in a pencil
+};
+
 struct gkyl_wave_prop {
   struct gkyl_rect_grid grid; // grid object
   int ndim; // number of dimensions
@@ -28,16 +48,16 @@ struct gkyl_wave_prop {
   struct gkyl_wave_geom *geom; // geometry object
   struct gkyl_comm *comm; // communcator
   
-  // data for 1D slice update
-  struct gkyl_array *waves, *apdq, *amdq, *speeds, *flux2;
-  // flags to indicate if fluctuations should be recomputed
-  struct gkyl_array *redo_fluct;
+  int max_1d; // maximum number of cells in a 1D slice
+  int num_slices; // number of slice buffers (one per thread)
+  struct wave_prop_slice *slices; // slice buffers
+  const struct gkyl_job_pool *job_pool; // pool for threaded update (NULL for serial)
+
+  struct gkyl_array *fix_count; // per-cell count of positivity fixes (NULL if not counted)
+  struct gkyl_array *fix_count_call; // counts of the current call, added to fix_count on success
+  struct gkyl_array *bfluct; // fluctuations through range boundary (NULL if not stored)
 
-  // some stats
-  long n_calls; // number of calls to updater
-  long n_bad_advance_calls; // number of calls in which positivity had to be fixed
-  long n_bad_cells; // number  of cells fixed
-  long n_max_bad_cells; // maximum number of cells fixed in a call
+  struct gkyl_wave_prop_stats stats; // some stats
 };
 
 static inline double
@@ -89,6 +109,29 @@ limiter_function(double r, enum gkyl_wave_limiter limiter)
   return theta;
 }
 
+static void
+slice_init(const gkyl_wave_prop *wv, struct wave_prop_slice *sl)
+{
+  int meqn = wv->equation->num_equations, mwaves = wv->equation->num_waves;
+  sl->waves = gkyl_array_new(GKYL_DOUBLE, meqn*mwaves, wv->max_1d);
+  sl->apdq = gkyl_array_new(GKYL_DOUBLE, meqn, wv->max_1d);
+  sl->amdq = gkyl_array_new(GKYL_DOUBLE, meqn, wv->max_1d);
+  sl->speeds = gkyl_array_new(GKYL_DOUBLE, mwaves, wv->max_1d);
+  sl->flux2 = gkyl_array_new(GKYL_DOUBLE, meqn, wv->max_1d);
+  sl->redo_fluct = gkyl_array_new(GKYL_DOUBLE, meqn, wv->max_1d);
+}
+
+static void
+slice_release(struct wave_prop_slice *sl)
+{
+  gkyl_array_release(sl->waves);
+  gkyl_array_release(sl->apdq);
+  gkyl_array_release(sl->amdq);
+  gkyl_array_release(sl->speeds);
+  gkyl_array_release(sl->flux2);
+  gkyl_array_release(sl->redo_fluct);
+}
+
 gkyl_wave_prop*
 gkyl_wave_prop_new(const struct gkyl_wave_prop_inp *winp)
 {
@@ -127,19 +170,17 @@ gkyl_wave_prop_new(const struct gkyl_wave_prop_inp *winp)
 
   // allocate memory to store 1D slices of waves, speeds and
   // second-order correction flux
-  int meqn = winp->equation->num_equations, mwaves = winp->equation->num_waves;
-  up->waves = gkyl_array_new(GKYL_DOUBLE, meqn*mwaves, max_1d);
-  up->apdq = gkyl_array_new(GKYL_DOUBLE, meqn, max_1d);
-  up->amdq = gkyl_array_new(GKYL_DOUBLE, meqn, max_1d);
-  up->speeds = gkyl_array_new(GKYL_DOUBLE, mwaves, max_1d);
-  up->flux2 = gkyl_array_new(GKYL_DOUBLE, meqn, max_1d);
-
-  up->redo_fluct = gkyl_array_new(GKYL_DOUBLE, meqn, max_1d);
+  up->max_1d = max_1d;
+  up->num_slices = 1;
+  up->slices = gkyl_malloc(sizeof(struct wave_prop_slice));
+  slice_init(up, &up->slices[0]);
+  up->job_pool = 0; // serial update by default
 
   up->geom = gkyl_wave_geom_acquire(winp->geom);
 
-  up->n_calls = up->n_bad_advance_calls = 0;
-  up->n_bad_cells = up->n_max_bad_cells = 0;
+  up->fix_count = up->fix_count_call = 0;
+  up->bfluct = 0;
+  up->stats = (struct gkyl_wave_prop_stats) { };
 
   return up;
 }
@@ -250,301 +291,568 @@ limit_waves(const gkyl_wave_prop *wv, int mwaves,
   }
 }
 
-// advance method
-struct gkyl_wave_prop_status
-gkyl_wave_prop_advance(gkyl_wave_prop *wv,
-  double tm, double dt, const struct gkyl_range *update_range,
-  const struct gkyl_array *qin, struct gkyl_array *qout)
+// Linear indices and geometry of the cells of a pencil, computed once
+// and shared by all systems swept along it. Entry j is for the cell
+// with index loidx-1+j along the pencil.
+struct pencil_geom {
+  long *lidx; // linear index of cell
+  const struct gkyl_wave_cell_geom **cg; // cell geometry
+};
+
+static void
+pencil_geom_set(const struct gkyl_wave_geom *geom, const struct gkyl_range *update_range,
+  int dir, int lo, int up, const int *idx, struct pencil_geom *pg)
+{
+  int idxc[GKYL_MAX_DIM];
+  gkyl_copy_int_arr(update_range->ndim, idx, idxc);
+  for (int i=lo; i<=up; ++i) {
+    idxc[dir] = i;
+    pg->lidx[i-lo] = gkyl_range_idx(update_range, idxc);
+    pg->cg[i-lo] = gkyl_wave_geom_get(geom, idxc);
+  }
+}
+
+// Sweep a single pencil along 'dir', with cell indices and geometry in
+// pg, using the slice buffers 'sl'. Returns false (and stops) if the
+// CFL condition is violated.
+static bool
+sweep_pencil(const gkyl_wave_prop *wv, int dir, double dt,
+  const struct gkyl_range *update_range, const struct pencil_geom *pg,
+  const struct gkyl_array *qin, struct gkyl_array *qout,
+  struct wave_prop_slice *sl, struct wave_prop_sweep *sw)
 {
-  wv->n_calls += 1;
-  
-  int ndim = update_range->ndim;
   int meqn = wv->equation->num_equations;
   //  when forced to use Lax fluxes, we only have a single wave
   int mwaves = wv->force_low_order_flux ? 2 :  wv->equation->num_waves;
 
-  double cfla = 0.0, cfl = wv->cfl, cflm = 1.1*cfl;
-  double is_cfl_violated = 0.0; // delibrately a double
+  double cfla = sw->cfla, cflm = 1.1*wv->cfl;
+  double max_speed = sw->max_speed;
+  bool cfl_ok = true;
   
   double ql_local[meqn], qr_local[meqn];
-  double fjump_local[meqn];
   double waves_local[meqn*mwaves];
   double amdq_local[meqn], apdq_local[meqn];
   double delta[meqn];
 
-  int idxl[GKYL_MAX_DIM], idxr[GKYL_MAX_DIM];
-
-  double max_speed = 0.0;
-
   // state of the update
   enum update_state {
     WV_FIRST_SWEEP, WV_POSITIVITY_SWEEP, WV_FIN_SWEEP
   } state, next_state;
 
-  for (int d=0; d<wv->num_up_dirs; ++d) {
-    int dir = wv->update_dirs[d];
+  double dtdx = dt/wv->grid.dx[dir];
 
-    double dtdx = dt/wv->grid.dx[dir];
+  // upper/lower bounds in direction 'd'. These are edge indices
+  int loidx = update_range->lower[dir]-1;
+  int upidx = update_range->upper[dir]+2;
 
-    // upper/lower bounds in direction 'd'. These are edge indices
-    int loidx = update_range->lower[dir]-1;
-    int upidx = update_range->upper[dir]+2;
+  // cell indices in 1D slice for interior cells
+  int loidx_c = update_range->lower[dir];
+  int upidx_c = update_range->upper[dir];
 
-    // cell indices in 1D slice for interior cells
-    int loidx_c = update_range->lower[dir];
-    int upidx_c = update_range->upper[dir];
+  // offset of cell index into pencil data
+  int pc = -(loidx-1);
 
-    struct gkyl_range slice_range;
-    gkyl_range_init(&slice_range, 1, (int[]) { loidx }, (int[]) { upidx } );
+  struct gkyl_range slice_range;
+  gkyl_range_init(&slice_range, 1, (int[]) { loidx }, (int[]) { upidx } );
 
-    struct gkyl_range perp_range;
-    gkyl_range_shorten_from_above(&perp_range, update_range, dir, 1);
-    struct gkyl_range_iter iter;
-    gkyl_range_iter_init(&iter, &perp_range);
-
-    // outer loop is over perpendicular directions, inner loop over 1D
-    // slice along that direction
-    while (gkyl_range_iter_next(&iter)) {
+  gkyl_array_clear(sl->redo_fluct, 1.0);
       
-      gkyl_copy_int_arr(ndim, iter.idx, idxl);
-      gkyl_copy_int_arr(ndim, iter.idx, idxr);
+  enum gkyl_wv_flux_type ftype = wv->force_low_order_flux ?
+    GKYL_WV_LOW_ORDER_FLUX : GKYL_WV_HIGH_ORDER_FLUX;
 
-      gkyl_array_clear(wv->redo_fluct, 1.0);
-      
-      enum gkyl_wv_flux_type ftype = wv->force_low_order_flux ?
-        GKYL_WV_LOW_ORDER_FLUX : GKYL_WV_HIGH_ORDER_FLUX;
+  state = WV_FIRST_SWEEP;
+  bool has_flux2 = false; // true if second-order correction is in qout
 
-      state = WV_FIRST_SWEEP;
+  // perform 1D sweeps, fixing positivity if required
+  while (state != WV_FIN_SWEEP) {
 
-      // perform 1D sweeps, fixing positivity if required
-      while (state != WV_FIN_SWEEP) {
+    if (state == WV_POSITIVITY_SWEEP)
+      ftype = GKYL_WV_LOW_ORDER_FLUX;
 
-        if (state == WV_POSITIVITY_SWEEP)
-          ftype = GKYL_WV_LOW_ORDER_FLUX;
-
-        // copy previous time-step solution
-        for (int i=loidx_c; i<=upidx_c; ++i) {
-          idxl[dir] = i; // cell index
-          long lidx = gkyl_range_idx(update_range, idxl);
-          copy_wv_vec(meqn, gkyl_array_fetch(qout, lidx), gkyl_array_cfetch(qin, lidx));
-        }
-
-        for (int i=loidx; i<=upidx; ++i) {
-          idxl[dir] = i-1; idxr[dir] = i;
-          long sidx = gkyl_ridx(slice_range, i);
+    // copy previous time-step solution
+    for (int i=loidx_c; i<=upidx_c; ++i) {
+      long lidx = pg->lidx[i+pc];
+      copy_wv_vec(meqn, gkyl_array_fetch(qout, lidx), gkyl_array_cfetch(qin, lidx));
+    }
 
-          const struct gkyl_wave_cell_geom *cg = gkyl_wave_geom_get(wv->geom, idxr);
-          double *s = gkyl_array_fetch(wv->speeds, sidx);
-          const double *redo_fluct = gkyl_array_cfetch(wv->redo_fluct, sidx);
+    for (int i=loidx; i<=upidx; ++i) {
+      long sidx = gkyl_ridx(slice_range, i);
 
-          if (redo_fluct[0] > 0.0) {
+      const struct gkyl_wave_cell_geom *cg = pg->cg[i+pc];
+      double *s = gkyl_array_fetch(sl->speeds, sidx);
+      const double *redo_fluct = gkyl_array_cfetch(sl->redo_fluct, sidx);
 
-            // compute fluctuations and waves only if needed (this
-            // prevents doing the full 1D sweep with low-order fluxes
-            // on positivity violations)
-            long lidx = gkyl_range_idx(update_range, idxl);
-            long ridx = gkyl_range_idx(update_range, idxr);
+      if (redo_fluct[0] > 0.0) {
 
-            const double *qinl = gkyl_array_cfetch(qin, lidx);
-            const double *qinr = gkyl_array_cfetch(qin, ridx);
+        // compute fluctuations and waves only if needed (this
+        // prevents doing the full 1D sweep with low-order fluxes
+        // on positivity violations)
+        const double *qinl = gkyl_array_cfetch(qin, pg->lidx[i-1+pc]);
+        const double *qinr = gkyl_array_cfetch(qin, pg->lidx[i+pc]);
 
-            gkyl_wv_eqn_rotate_to_local(wv->equation, cg->tau1[dir], cg->tau2[dir], cg->norm[dir], qinl, ql_local);
-            gkyl_wv_eqn_rotate_to_local(wv->equation, cg->tau1[dir], cg->tau2[dir], cg->norm[dir], qinr, qr_local);
+        gkyl_wv_eqn_rotate_to_local(wv->equation, cg->tau1[dir], cg->tau2[dir], cg->norm[dir], qinl, ql_local);
+        gkyl_wv_eqn_rotate_to_local(wv->equation, cg->tau1[dir], cg->tau2[dir], cg->norm[dir], qinr, qr_local);
 
-            if (wv->split_type == GKYL_WAVE_QWAVE)
-              calc_jump(meqn, ql_local, qr_local, delta);
-            else
-              gkyl_wv_eqn_flux_jump(wv->equation, ql_local, qr_local, delta);
+        if (wv->split_type == GKYL_WAVE_QWAVE)
+          calc_jump(meqn, ql_local, qr_local, delta);
+        else
+          gkyl_wv_eqn_flux_jump(wv->equation, ql_local, qr_local, delta);
 
-            double my_max_speed = gkyl_wv_eqn_waves(wv->equation, ftype, delta,
-              ql_local, qr_local, waves_local, s);
-            max_speed = max_speed > my_max_speed ? max_speed : my_max_speed;
+        double my_max_speed = gkyl_wv_eqn_waves(wv->equation, ftype, delta,
+          ql_local, qr_local, waves_local, s);
+        max_speed = max_speed > my_max_speed ? max_speed : my_max_speed;
 
-            double lenr = cg->lenr[dir];
-            for (int mw=0; mw<mwaves; ++mw)
-              s[mw] *= lenr; // rescale speeds
+        double lenr = cg->lenr[dir];
+        for (int mw=0; mw<mwaves; ++mw)
+          s[mw] *= lenr; // rescale speeds
 
-            // compute fluctuations in local coordinates
-            if (wv->split_type == GKYL_WAVE_QWAVE)
-              gkyl_wv_eqn_qfluct(wv->equation, ftype, ql_local, qr_local,
-                waves_local, s, amdq_local, apdq_local);
-            else
-              gkyl_wv_eqn_ffluct(wv->equation, ftype, ql_local, qr_local,
-                waves_local, s, amdq_local, apdq_local);
+        // compute fluctuations in local coordinates
+        if (wv->split_type == GKYL_WAVE_QWAVE)
+          gkyl_wv_eqn_qfluct(wv->equation, ftype, ql_local, qr_local,
+            waves_local, s, amdq_local, apdq_local);
+        else
+          gkyl_wv_eqn_ffluct(wv->equation, ftype, ql_local, qr_local,
+            waves_local, s, amdq_local, apdq_local);
         
-            double *waves = gkyl_array_fetch(wv->waves, sidx);
-            for (int mw=0; mw<mwaves; ++mw)
-              // rotate waves back
-              gkyl_wv_eqn_rotate_to_global(wv->equation, 
-                cg->tau1[dir], cg->tau2[dir], cg->norm[dir], &waves_local[mw*meqn], &waves[mw*meqn]
-              );
-
-            // rotate fluctuations
-            double *amdq = gkyl_array_fetch(wv->amdq, sidx);
-            gkyl_wv_eqn_rotate_to_global(wv->equation, 
-              cg->tau1[dir], cg->tau2[dir], cg->norm[dir], amdq_local, amdq);
+        double *waves = gkyl_array_fetch(sl->waves, sidx);
+        for (int mw=0; mw<mwaves; ++mw)
+          // rotate waves back
+          gkyl_wv_eqn_rotate_to_global(wv->equation, 
+            cg->tau1[dir], cg->tau2[dir], cg->norm[dir], &waves_local[mw*meqn], &waves[mw*meqn]
+          );
+
+        // rotate fluctuations
+        double *amdq = gkyl_array_fetch(sl->amdq, sidx);
+        gkyl_wv_eqn_rotate_to_global(wv->equation, 
+          cg->tau1[dir], cg->tau2[dir], cg->norm[dir], amdq_local, amdq);
             
-            double *apdq = gkyl_array_fetch(wv->apdq, sidx);
-           gkyl_wv_eqn_rotate_to_global(wv->equation, 
-              cg->tau1[dir], cg->tau2[dir], cg->norm[dir], apdq_local, apdq);
-          }
+        double *apdq = gkyl_array_fetch(sl->apdq, sidx);
+        gkyl_wv_eqn_rotate_to_global(wv->equation, 
+          cg->tau1[dir], cg->tau2[dir], cg->norm[dir], apdq_local, apdq);
+      }
           
-          cfla = calc_cfla(mwaves, cfla, dtdx/cg->kappa, s);
-        }
-
-        if (cfla > cflm) // check time-step before any updates are performed
-          is_cfl_violated = 1.0;
-
-        if (is_cfl_violated > 0) {
-          // we need to use this goto to jump out of this deep loop to
-          // avoid potential problems with taking too large a
-          // time-step. NOTE: This jump is local to a rank. An
-          // all-reduce here can't be done as one may end up with a
-          // hang due to missing allreduce from some ranks.
-          goto outsideloop;
-        }
+      cfla = calc_cfla(mwaves, cfla, dtdx/cg->kappa, s);
+    }
 
-        // compute first-order update in each cell
-        for (int i=loidx_c; i<=upidx_c; ++i) { // loop is over cells
-        
-          idxl[dir] = i; // cell index and left-edge index
-          long lidx = gkyl_range_idx(update_range, idxl);
+    if (cfla > cflm) { // check time-step before any updates are performed
+      // stop sweeping to avoid potential problems with taking too
+      // large a time-step. NOTE: This is local to a rank (and
+      // thread). An all-reduce here can't be done as one may end up
+      // with a hang due to missing allreduce from some ranks.
+      sw->is_cfl_violated = true;
+      cfl_ok = false;
+      break;
+    }
 
-          const struct gkyl_wave_cell_geom *cg = gkyl_wave_geom_get(wv->geom, idxl);
+    // compute first-order update in each cell
+    for (int i=loidx_c; i<=upidx_c; ++i) { // loop is over cells
+      const struct gkyl_wave_cell_geom *cg = pg->cg[i+pc];
 
-          calc_first_order_update(meqn, dtdx/cg->kappa,
-            gkyl_array_fetch(qout, lidx), 
-            gkyl_array_cfetch(wv->amdq, gkyl_ridx(slice_range, i+1)),
-            gkyl_array_cfetch(wv->apdq, gkyl_ridx(slice_range, i))
-          );
-        }
+      calc_first_order_update(meqn, dtdx/cg->kappa,
+        gkyl_array_fetch(qout, pg->lidx[i+pc]), 
+        gkyl_array_cfetch(sl->amdq, gkyl_ridx(slice_range, i+1)),
+        gkyl_array_cfetch(sl->apdq, gkyl_ridx(slice_range, i))
+      );
+    }
 
-        if (state == WV_FIRST_SWEEP) {
-          // we only compute second-correction if we are in first sweep
+    has_flux2 = false;
+    if (state == WV_FIRST_SWEEP) {
+      // we only compute second-correction if we are in first sweep
+      has_flux2 = true;
           
-          // apply limiters to waves for all edges in update range,
-          // including edges that are on the range boundary
-          limit_waves(wv, mwaves, &slice_range,
-            update_range->lower[dir], update_range->upper[dir]+1, wv->waves, wv->speeds);
-
-          // get the kappa in the first ghost cell on left (needed in
-          // the second order flux calculation)
-          idxl[dir] = update_range->lower[dir]-1;
-          const struct gkyl_wave_cell_geom *cg = gkyl_wave_geom_get(wv->geom, idxl);
-          double kappal = cg->kappa;
-
-          gkyl_array_clear(wv->flux2, 0.0);
-          // compute second-order correction fluxes at each interface:
-          // note that there is one extra edge than cell
-          for (int i=loidx_c; i<=upidx_c+1; ++i) {
-            long sidx = gkyl_ridx(slice_range, i);
-
-            const double *waves = gkyl_array_cfetch(wv->waves, sidx);
-            const double *s = gkyl_array_cfetch(wv->speeds, sidx);
-            double *flux2 = gkyl_array_fetch(wv->flux2, sidx);
-
-            idxl[dir] = i;
-            const struct gkyl_wave_cell_geom *cg = gkyl_wave_geom_get(wv->geom, idxl);
-            double kappar = cg->kappa;
-
-            if (wv->split_type == GKYL_WAVE_QWAVE) {
-              for (int mw=0; mw<mwaves; ++mw)
-                calc_second_order_qflux(meqn, dtdx/(0.5*(kappal+kappar)), s[mw], &waves[mw*meqn], flux2);
-            }
-            else {
-              for (int mw=0; mw<mwaves; ++mw)
-                calc_second_order_fflux(meqn, dtdx/(0.5*(kappal+kappar)), s[mw], &waves[mw*meqn], flux2);
-            }
-
-            kappal = kappar;
-          }
+      // apply limiters to waves for all edges in update range,
+      // including edges that are on the range boundary
+      limit_waves(wv, mwaves, &slice_range,
+        update_range->lower[dir], update_range->upper[dir]+1, sl->waves, sl->speeds);
+
+      // get the kappa in the first ghost cell on left (needed in
+      // the second order flux calculation)
+      double kappal = pg->cg[update_range->lower[dir]-1+pc]->kappa;
+
+      gkyl_array_clear(sl->flux2, 0.0);
+      // compute second-order correction fluxes at each interface:
+      // note that there is one extra edge than cell
+      for (int i=loidx_c; i<=upidx_c+1; ++i) {
+        long sidx = gkyl_ridx(slice_range, i);
+
+        const double *waves = gkyl_array_cfetch(sl->waves, sidx);
+        const double *s = gkyl_array_cfetch(sl->speeds, sidx);
+        double *flux2 = gkyl_array_fetch(sl->flux2, sidx);
+
+        double kappar = pg->cg[i+pc]->kappa;
+
+        if (wv->split_type == GKYL_WAVE_QWAVE) {
+          for (int mw=0; mw<mwaves; ++mw)
+            calc_second_order_qflux(meqn, dtdx/(0.5*(kappal+kappar)), s[mw], &waves[mw*meqn], flux2);
+        }
+        else {
+          for (int mw=0; mw<mwaves; ++mw)
+            calc_second_order_fflux(meqn, dtdx/(0.5*(kappal+kappar)), s[mw], &waves[mw*meqn], flux2);
+        }
 
-          // add second correction flux to solution in each interior cell
-          for (int i=loidx_c; i<=upidx_c; ++i) {
-            long sidx = gkyl_ridx(slice_range, i);
+        kappal = kappar;
+      }
 
-            idxl[dir] = i;
-            const struct gkyl_wave_cell_geom *cg = gkyl_wave_geom_get(wv->geom, idxl);
+      // add second correction flux to solution in each interior cell
+      for (int i=loidx_c; i<=upidx_c; ++i) {
+        const struct gkyl_wave_cell_geom *cg = pg->cg[i+pc];
 
-            calc_second_order_update(meqn, dtdx/cg->kappa,
-              gkyl_array_fetch(qout, gkyl_range_idx(update_range, idxl)),
-              gkyl_array_cfetch(wv->flux2, gkyl_ridx(slice_range, i)),
-              gkyl_array_cfetch(wv->flux2, gkyl_ridx(slice_range, i+1))
-            );
-          }
-        }
+        calc_second_order_update(meqn, dtdx/cg->kappa,
+          gkyl_array_fetch(qout, pg->lidx[i+pc]),
+          gkyl_array_cfetch(sl->flux2, gkyl_ridx(slice_range, i)),
+          gkyl_array_cfetch(sl->flux2, gkyl_ridx(slice_range, i+1))
+        );
+      }
+    }
 
-        next_state = WV_FIN_SWEEP;
-        // check invariant domains if needed
-        if ( (state == WV_FIRST_SWEEP) && wv->check_inv_domain) {
-          long n_bad_cells = 0;            
+    next_state = WV_FIN_SWEEP;
+    // check invariant domains if needed
+    if ( (state == WV_FIRST_SWEEP) && wv->check_inv_domain) {
+      long n_bad_cells = 0;            
 
-          gkyl_array_clear(wv->redo_fluct, 0.0); // by default no edge needs recomputing
+      gkyl_array_clear(sl->redo_fluct, 0.0); // by default no edge needs recomputing
           
-          // check if invariant domains are violated, flagging edges
-          // of each bad cell
-          for (int i=loidx_c; i<=upidx_c; ++i) {
-            idxl[dir] = i;
-            const double *qt = gkyl_array_cfetch(qout, gkyl_range_idx(update_range, idxl));
-            if (!gkyl_wv_eqn_check_inv(wv->equation, qt)) {
-
-              double *redo_fluct_l = gkyl_array_fetch(wv->redo_fluct, gkyl_ridx(slice_range, i));
-              double *redo_fluct_r = gkyl_array_fetch(wv->redo_fluct, gkyl_ridx(slice_range, i+1));
-              // mark left and right edges so fluctuations are redone
-              redo_fluct_l[0] = 1.0;
-              redo_fluct_r[0] = 1.0;
-
-              n_bad_cells += 1;
-            }
-          }
-
-          if (n_bad_cells > 0) {
-            // we need to resweep the 1D slice again
-            next_state = WV_POSITIVITY_SWEEP;
-            wv->n_bad_advance_calls += 1;
+      // check if invariant domains are violated, flagging edges
+      // of each bad cell
+      for (int i=loidx_c; i<=upidx_c; ++i) {
+        const double *qt = gkyl_array_cfetch(qout, pg->lidx[i+pc]);
+        if (!gkyl_wv_eqn_check_inv(wv->equation, qt)) {
+
+          double *redo_fluct_l = gkyl_array_fetch(sl->redo_fluct, gkyl_ridx(slice_range, i));
+          double *redo_fluct_r = gkyl_array_fetch(sl->redo_fluct, gkyl_ridx(slice_range, i+1));
+          // mark left and right edges so fluctuations are redone
+          redo_fluct_l[0] = 1.0;
+          redo_fluct_r[0] = 1.0;
+
+          if (wv->fix_count) {
+            // pencils own their cells, so no two workers touch this
+            double *nfix = gkyl_array_fetch(wv->fix_count_call, pg->lidx[i+pc]);
+            nfix[dir] += 1.0;
           }
 
-          wv->n_bad_cells += n_bad_cells;
-          wv->n_max_bad_cells = wv->n_max_bad_cells >  n_bad_cells ? wv->n_max_bad_cells : n_bad_cells;
+          n_bad_cells += 1;
         }
+      }
 
-        state = next_state; // change state for next sweep
+      if (n_bad_cells > 0) {
+        // we need to resweep the 1D slice again
+        next_state = WV_POSITIVITY_SWEEP;
+        sw->n_bad_advance_calls += 1;
+      }
+
+      sw->n_bad_cells += n_bad_cells;
+      sw->n_max_bad_cells = sw->n_max_bad_cells >  n_bad_cells ? sw->n_max_bad_cells : n_bad_cells;
+    }
+
+    state = next_state; // change state for next sweep
         
-      } // end loop over sweeps
-    } // end loop over perpendicular directions
-  } // end loop over directions
+  } // end loop over sweeps
+
+  if (cfl_ok && wv->bfluct) {
+    // store what entered the boundary cells through the range
+    // boundary
+    const double *apdq = gkyl_array_cfetch(sl->apdq, gkyl_ridx(slice_range, loidx_c));
+    const double *amdq = gkyl_array_cfetch(sl->amdq, gkyl_ridx(slice_range, upidx_c+1));
+    const double *f2l = gkyl_array_cfetch(sl->flux2, gkyl_ridx(slice_range, loidx_c));
+    const double *f2u = gkyl_array_cfetch(sl->flux2, gkyl_ridx(slice_range, upidx_c+1));
+    
+    double *bl = gkyl_array_fetch(wv->bfluct, pg->lidx[loidx_c+pc]);
+    double *bu = gkyl_array_fetch(wv->bfluct, pg->lidx[upidx_c+pc]);
+    for (int m=0; m<meqn; ++m) {
+      bl[m] = apdq[m] - (has_flux2 ? f2l[m] : 0.0);
+      bu[meqn+m] = amdq[m] + (has_flux2 ? f2u[m] : 0.0);
+    }
+  }
+  
+  sw->cfla = cfla;
+  sw->max_speed = max_speed;
+  return cfl_ok;
+}
+
+// Sweep the pencils along 'dir' that start at the cells of
+// perp_range, for each of the nwv systems, using slice buffers 'tid'
+// of each updater. All systems are swept along a pencil before moving
+// to the next pencil, so the cell indices and geometry of the pencil
+// are computed once and are still in cache for the later systems.
+// Pencils only read qin along their own line and only write their own
+// cells in qout, so disjoint pieces of perp_range can be swept
+// concurrently. Stops early (with is_cfl_violated set) if the CFL
+// condition is violated.
+static void
+sweep_pencils(int nwv, gkyl_wave_prop *const *wv, int dir, double dt,
+  const struct gkyl_range *update_range, const struct gkyl_range *perp_range,
+  const struct gkyl_array *const *qin, struct gkyl_array *const *qout,
+  int tid, struct wave_prop_sweep *sw)
+{
+  // pencil data covers cells loidx-1 to upidx
+  int lo = update_range->lower[dir]-2, up = update_range->upper[dir]+2;
+  struct pencil_geom pg = {
+    .lidx = gkyl_malloc(sizeof(long[up-lo+1])),
+    .cg = gkyl_malloc(sizeof(const struct gkyl_wave_cell_geom*[up-lo+1]))
+  };
+
+  struct gkyl_range_iter iter;
+  gkyl_range_iter_init(&iter, perp_range);
+
+  // outer loop is over perpendicular directions, inner loop over 1D
+  // slice along that direction
+  while (gkyl_range_iter_next(&iter)) {
+    pencil_geom_set(wv[0]->geom, update_range, dir, lo, up, iter.idx, &pg);
+    
+    for (int k=0; k<nwv; ++k)
+      if (!sweep_pencil(wv[k], dir, dt, update_range, &pg, qin[k], qout[k],
+          &wv[k]->slices[tid], &sw[k]))
+        goto outsideloop;
+  }
 
   outsideloop:
-  ;
+  
+  gkyl_free(pg.lidx);
+  gkyl_free(pg.cg);
+}
 
-  // compute actual CFL, status & max-speed across all domains
-  double red_vars[3] = { cfla, is_cfl_violated, max_speed };
-  double red_vars_global[3] = { 0.0, 0.0, 0.0 };
-  gkyl_comm_all_reduce(wv->comm, GKYL_DOUBLE, GKYL_MAX, 3, &red_vars, &red_vars_global);
+struct wave_prop_thread_data {
+  int nwv;
+  gkyl_wave_prop *const *wv;
+  int dir;
+  double dt;
+  const struct gkyl_range *update_range;
+  struct gkyl_range perp_range; // piece of pencils to sweep
+  const struct gkyl_array *const *qin;
+  struct gkyl_array *const *qout;
+  int tid; // index of slice buffers of this thread
+  struct wave_prop_sweep *sw; // state for each system
+};
 
-  cfla = red_vars_global[0];
-  is_cfl_violated = red_vars_global[1];
-  max_speed = red_vars_global[2];
+static void
+wave_prop_thread_worker(void *ctx)
+{
+  struct wave_prop_thread_data *td = ctx;
+  sweep_pencils(td->nwv, td->wv, td->dir, td->dt, td->update_range, &td->perp_range,
+    td->qin, td->qout, td->tid, td->sw);
+}
 
-  double dt_suggested = dt*cfl/fmax(cfla, DBL_MIN);
+static void
+sweep_combine(struct wave_prop_sweep *sw, const struct wave_prop_sweep *tsw)
+{
+  sw->cfla = fmax(sw->cfla, tsw->cfla);
+  sw->max_speed = fmax(sw->max_speed, tsw->max_speed);
+  sw->is_cfl_violated = sw->is_cfl_violated || tsw->is_cfl_violated;
+  sw->n_bad_advance_calls += tsw->n_bad_advance_calls;
+  sw->n_bad_cells += tsw->n_bad_cells;
+  sw->n_max_bad_cells = sw->n_max_bad_cells > tsw->n_max_bad_cells ?
+    sw->n_max_bad_cells : tsw->n_max_bad_cells;
+}
+
+// Sweep all pencils along 'dir', splitting them across the job pool
+// (if one is set). The result is independent of the number of threads
+// as each pencil is updated exactly as in the serial sweep and only
+// maxima and sums of the per-thread states are taken. Threads get
+// consecutive pieces of the pencils, so their states are combined in
+// that order and, as in the serial sweep, nothing after the first
+// piece that violated the CFL condition is included.
+static void
+sweep_dir(int nwv, gkyl_wave_prop *const *wv, int dir, double dt,
+  const struct gkyl_range *update_range,
+  const struct gkyl_array *const *qin, struct gkyl_array *const *qout,
+  struct wave_prop_sweep *sw)
+{
+  struct gkyl_range perp_range;
+  gkyl_range_shorten_from_above(&perp_range, update_range, dir, 1);
 
-  if (is_cfl_violated > 0.0)
-    // indicate failure, and return smaller stable time-step
-    return (struct gkyl_wave_prop_status) {
-      .success = 0,
-      .dt_suggested = dt_suggested,
-      .max_speed = max_speed,
+  int nthreads = wv[0]->job_pool ? wv[0]->num_slices : 1;
+  for (int k=1; k<nwv; ++k)
+    nthreads = nthreads < wv[k]->num_slices ? nthreads : wv[k]->num_slices;
+  
+  if (nthreads < 2 || perp_range.volume < nthreads) {
+    sweep_pencils(nwv, wv, dir, dt, update_range, &perp_range, qin, qout, 0, sw);
+    return;
+  }
+
+  struct wave_prop_sweep tsw[nthreads][nwv];
+  struct wave_prop_thread_data td[nthreads];
+  for (int tid=0; tid<nthreads; ++tid) {
+    for (int k=0; k<nwv; ++k)
+      tsw[tid][k] = (struct wave_prop_sweep) {
+        .cfla = sw[k].cfla,
+        .max_speed = sw[k].max_speed
+      };
+    
+    td[tid] = (struct wave_prop_thread_data) {
+      .nwv = nwv,
+      .wv = wv,
+      .dir = dir,
+      .dt = dt,
+      .update_range = update_range,
+      .perp_range = gkyl_range_split(&perp_range, nthreads, tid),
+      .qin = qin,
+      .qout = qout,
+      .tid = tid,
+      .sw = tsw[tid],
     };
+    gkyl_job_pool_add_work(wv[0]->job_pool, wave_prop_thread_worker, &td[tid]);
+  }
+  gkyl_job_pool_wait(wv[0]->job_pool);
+
+  for (int tid=0; tid<nthreads; ++tid) {
+    bool is_cfl_violated = false;
+    for (int k=0; k<nwv; ++k) {
+      sweep_combine(&sw[k], &tsw[tid][k]);
+      is_cfl_violated = is_cfl_violated || tsw[tid][k].is_cfl_violated;
+    }
+    // serial sweep stops at the first violation
+    if (is_cfl_violated) break;
+  }
+}
+
+void
+gkyl_wave_prop_set_job_pool(gkyl_wave_prop *wv, const struct gkyl_job_pool *job_pool)
+{
+  if (wv->job_pool)
+    gkyl_job_pool_release(wv->job_pool);
+  wv->job_pool = job_pool ? gkyl_job_pool_acquire(job_pool) : 0;
+
+  // one set of slice buffers per worker
+  int num_slices = job_pool && job_pool->pool_size > 1 ? job_pool->pool_size : 1;
+  for (int i=num_slices; i<wv->num_slices; ++i)
+    slice_release(&wv->slices[i]);
+  wv->slices = gkyl_realloc(wv->slices, sizeof(struct wave_prop_slice[num_slices]));
+  for (int i=wv->num_slices; i<num_slices; ++i)
+    slice_init(wv, &wv->slices[i]);
+  wv->num_slices = num_slices;
+}
+
+void
+gkyl_wave_prop_set_fix_count(gkyl_wave_prop *wv, struct gkyl_array *fix_count)
+{
+  assert(!fix_count || fix_count->ncomp >= wv->ndim);
+  if (wv->fix_count_call)
+    gkyl_array_release(wv->fix_count_call);
+  wv->fix_count_call = 0;
+
+  wv->fix_count = fix_count;
+  if (fix_count) {
+    wv->fix_count_call = gkyl_array_new(GKYL_DOUBLE, fix_count->ncomp, fix_count->size);
+    gkyl_array_clear(wv->fix_count_call, 0.0);
+  }
+}
+
+void
+gkyl_wave_prop_set_boundary_fluct(gkyl_wave_prop *wv, struct gkyl_array *bfluct)
+{
+  assert(!bfluct || bfluct->ncomp >= 2*wv->equation->num_equations);
+  wv->bfluct = bfluct;
+}
+
+struct gkyl_wave_prop_status
+gkyl_wave_prop_advance_multi(int nwv, gkyl_wave_prop *const *wv,
+  double tm, double dt, const struct gkyl_range *update_range,
+  const struct gkyl_array *const *qin, struct gkyl_array *const *qout,
+  struct gkyl_wave_prop_status *status)
+{
+  for (int k=1; k<nwv; ++k) {
+    // systems must share geometry and update directions
+    assert(wv[k]->geom == wv[0]->geom);
+    assert(wv[k]->num_up_dirs == wv[0]->num_up_dirs);
+    for (int d=0; d<wv[0]->num_up_dirs; ++d)
+      assert(wv[k]->update_dirs[d] == wv[0]->update_dirs[d]);
+  }
   
-  // on success, suggest only bigger time-step; (Only way dt can
-  // reduce is if the update fails. If the code comes here the update
-  // succeeded and so we should not allow dt to reduce).
-
-  return (struct gkyl_wave_prop_status) {
-    .success = is_cfl_violated > 0.0 ? 0 : 1,
-    .dt_suggested = dt_suggested > dt ? dt_suggested : dt,
-    .max_speed = max_speed,
+  struct wave_prop_sweep sw[nwv];
+  for (int k=0; k<nwv; ++k) {
+    wv[k]->stats.n_calls += 1;
+    sw[k] = (struct wave_prop_sweep) { 0 };
+  }
+
+  bool is_cfl_violated = false;
+  for (int d=0; d<wv[0]->num_up_dirs; ++d) {
+    int dir = wv[0]->update_dirs[d];
+    struct timespec tm_dir = gkyl_wall_clock();
+    sweep_dir(nwv, wv, dir, dt, update_range, qin, qout, sw);
+    double sweep_tm = gkyl_time_diff_now_sec(tm_dir);
+    
+    for (int k=0; k<nwv; ++k) {
+      wv[k]->stats.sweep_tm[dir] += sweep_tm;
+      is_cfl_violated = is_cfl_violated || sw[k].is_cfl_violated;
+    }
+    if (is_cfl_violated)
+      break;
+  }
+
+  // compute actual CFL, status & max-speed across all domains: one
+  // reduction for all systems
+  double red_vars[3*nwv], red_vars_global[3*nwv];
+  for (int k=0; k<nwv; ++k) {
+    red_vars[3*k] = sw[k].cfla;
+    red_vars[3*k+1] = is_cfl_violated ? 1.0 : 0.0;
+    red_vars[3*k+2] = sw[k].max_speed;
+    red_vars_global[3*k] = red_vars_global[3*k+1] = red_vars_global[3*k+2] = 0.0;
+  }
+  gkyl_comm_all_reduce(wv[0]->comm, GKYL_DOUBLE, GKYL_MAX, 3*nwv, red_vars, red_vars_global);
+
+  struct gkyl_wave_prop_status comb = {
+    .success = 1, .dt_suggested = DBL_MAX, .max_speed = 0.0, .dt_stable = DBL_MAX
   };
+  for (int k=0; k<nwv; ++k) {
+    double cfla = red_vars_global[3*k];
+    double max_speed = red_vars_global[3*k+2];
+    double dt_suggested = dt*wv[k]->cfl/fmax(cfla, DBL_MIN);
+
+    // merge stats of this call (already combined over workers): fixes
+    // in a call that failed are redone, so they are counted apart
+    struct gkyl_wave_prop_stats *st = &wv[k]->stats;
+    if (red_vars_global[3*k+1] > 0.0) {
+      st->n_failed_calls += 1;
+      st->n_failed_bad_cells += sw[k].n_bad_cells;
+    }
+    else {
+      st->n_bad_advance_calls += sw[k].n_bad_advance_calls;
+      st->n_bad_cells += sw[k].n_bad_cells;
+      st->n_max_bad_cells = st->n_max_bad_cells > sw[k].n_max_bad_cells ?
+        st->n_max_bad_cells : sw[k].n_max_bad_cells;
+    }
+    if (wv[k]->fix_count && sw[k].n_bad_cells > 0) {
+      // only touch per-cell counts when this call fixed some cells
+      if (red_vars_global[3*k+1] == 0.0)
+        gkyl_array_accumulate(wv[k]->fix_count, 1.0, wv[k]->fix_count_call);
+      gkyl_array_clear(wv[k]->fix_count_call, 0.0);
+    }
+
+    if (red_vars_global[3*k+1] > 0.0)
+      // indicate failure, and return smaller stable time-step
+      status[k] = (struct gkyl_wave_prop_status) {
+        .success = 0,
+        .dt_suggested = dt_suggested,
+        .max_speed = max_speed,
+        .dt_stable = dt_suggested,
+      };
+    else
+      // on success, suggest only bigger time-step; (Only way dt can
+      // reduce is if the update fails. If the code comes here the
+      // update succeeded and so we should not allow dt to reduce).
+      status[k] = (struct gkyl_wave_prop_status) {
+        .success = 1,
+        .dt_suggested = dt_suggested > dt ? dt_suggested : dt,
+        .max_speed = max_speed,
+        .dt_stable = dt_suggested,
+      };
+
+    comb.success = comb.success && status[k].success;
+    comb.dt_suggested = fmin(comb.dt_suggested, status[k].dt_suggested);
+    comb.max_speed = fmax(comb.max_speed, status[k].max_speed);
+    comb.dt_stable = fmin(comb.dt_stable, status[k].dt_stable);
+  }
+  return comb;
+}
+
+// advance method
+struct gkyl_wave_prop_status
+gkyl_wave_prop_advance(gkyl_wave_prop *wv,
+  double tm, double dt, const struct gkyl_range *update_range,
+  const struct gkyl_array *qin, struct gkyl_array *qout)
+{
+  struct gkyl_wave_prop_status status;
+  return gkyl_wave_prop_advance_multi(1, &wv, tm, dt, update_range, &qin, &qout, &status);
 }
 
 double
@@ -574,24 +882,20 @@ gkyl_wave_prop_max_dt(const gkyl_wave_prop *wv, const struct gkyl_range *update_
 struct gkyl_wave_prop_stats
 gkyl_wave_prop_stats(const gkyl_wave_prop *wv)
 {
-  return (struct gkyl_wave_prop_stats) {
-    .n_calls = wv->n_calls,
-    .n_bad_advance_calls = wv->n_bad_advance_calls,
-    .n_bad_cells = wv->n_bad_cells,
-    .n_max_bad_cells = wv->n_max_bad_cells
-  };
+  return wv->stats;
 }
 
 void
 gkyl_wave_prop_release(gkyl_wave_prop* up)
 {
   gkyl_wv_eqn_release(up->equation);
-  gkyl_array_release(up->waves);
-  gkyl_array_release(up->apdq);
-  gkyl_array_release(up->amdq);
-  gkyl_array_release(up->speeds);
-  gkyl_array_release(up->flux2);
-  gkyl_array_release(up->redo_fluct);
+  for (int i=0; i<up->num_slices; ++i)
+    slice_release(&up->slices[i]);
+  gkyl_free(up->slices);
+  if (up->job_pool)
+    gkyl_job_pool_release(up->job_pool);
+  if (up->fix_count_call)
+    gkyl_array_release(up->fix_count_call);
   gkyl_comm_release(up->comm);
   
   gkyl_wave_geom_release(up->geom);